@@ -182,9 +182,14 @@ void AgentServer::Impl::init_or_die() {
         }
         max_publish_version_worker_count =
                 std::max(max_publish_version_worker_count, MIN_TRANSACTION_PUBLISH_WORKER_COUNT);
-        BUILD_DYNAMIC_TASK_THREAD_POOL("publish_version", MIN_TRANSACTION_PUBLISH_WORKER_COUNT,
-                                       max_publish_version_worker_count, DEFAULT_DYNAMIC_THREAD_POOL_QUEUE_SIZE,
-                                       _thread_pool_publish_version);
+        auto st = ThreadPoolBuilder("publish_version")
+                          .set_min_threads(MIN_TRANSACTION_PUBLISH_WORKER_COUNT)
+                          .set_max_threads(max_publish_version_worker_count)
+                          .set_max_queue_size(DEFAULT_DYNAMIC_THREAD_POOL_QUEUE_SIZE)
+                          .set_work_stealing(config::enable_publish_version_work_stealing)
+                          .set_queue_time_metric(true)
+                          .build(&_thread_pool_publish_version);
+        CHECK(st.ok()) << st;
         REGISTER_THREAD_POOL_METRICS(publish_version, _thread_pool_publish_version);
 #endif
 
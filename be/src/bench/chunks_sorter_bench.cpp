@@ -159,6 +159,8 @@ struct SortParameters {
     bool low_card = false;
     bool nullable = false;
     int max_buffered_chunks = ChunksSorterTopn::kDefaultBufferedChunks;
+    // Whether the full sort sorts by the normalized keys, see config::enable_sort_normalized_key
+    bool normalized_key = true;
 
     SortParameters() = default;
 
@@ -232,6 +234,8 @@ static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, Logical
     const int64_t max_buffered_rows = 1024 * 1024;
     const int64_t max_buffered_bytes = max_buffered_rows * 256;
     const std::vector<SlotId> early_materialized_slots;
+    const bool normalized_key = config::enable_sort_normalized_key;
+    config::enable_sort_normalized_key = params.normalized_key;
 
     for (auto _ : state) {
         state.PauseTiming();
@@ -305,6 +309,7 @@ static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, Logical
     state.counters["data_size"] += data_size;
     state.counters["mem_usage"] = mem_usage;
     state.SetItemsProcessed(item_processed);
+    config::enable_sort_normalized_key = normalized_key;
 
     suite.TearDown();
 }
@@ -462,6 +467,28 @@ static void BM_fullsort_varchar_column_incr(benchmark::State& state) {
     do_bench(state, FullSort, TYPE_VARCHAR, state.range(0), state.range(1));
 }
 
+// Compare the columns one by one, instead of the normalized keys
+static void BM_fullsort_notnull_columnwise(benchmark::State& state) {
+    SortParameters params;
+    params.normalized_key = false;
+    do_bench(state, FullSort, TYPE_INT, state.range(0), state.range(1), params);
+}
+static void BM_fullsort_nullable_columnwise(benchmark::State& state) {
+    SortParameters params = SortParameters::with_nullable(true);
+    params.normalized_key = false;
+    do_bench(state, FullSort, TYPE_INT, state.range(0), state.range(1), params);
+}
+static void BM_fullsort_varchar_columnwise(benchmark::State& state) {
+    SortParameters params;
+    params.normalized_key = false;
+    do_bench(state, FullSort, TYPE_VARCHAR, state.range(0), state.range(1), params);
+}
+static void BM_fullsort_low_card_columnwise(benchmark::State& state) {
+    SortParameters params = SortParameters::with_low_card(true);
+    params.normalized_key = false;
+    do_bench(state, FullSort, TYPE_INT, state.range(0), state.range(1), params);
+}
+
 // Low cardinality
 static void BM_fullsort_low_card_colinc(benchmark::State& state) {
     do_bench(state, FullSort, TYPE_INT, state.range(0), state.range(1), SortParameters::with_low_card(true));
@@ -536,6 +563,12 @@ BENCHMARK(BM_fullsort_nullable)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_float_notnull)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_varchar_column_incr)->Apply(CustomArgsFull);
 
+// Full sort without the normalized keys
+BENCHMARK(BM_fullsort_notnull_columnwise)->Apply(CustomArgsFull);
+BENCHMARK(BM_fullsort_nullable_columnwise)->Apply(CustomArgsFull);
+BENCHMARK(BM_fullsort_varchar_columnwise)->Apply(CustomArgsFull);
+BENCHMARK(BM_fullsort_low_card_columnwise)->Apply(CustomArgsFull);
+
 // Low-Cardinality Sort
 BENCHMARK(BM_fullsort_low_card_colinc)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_low_card_nullable)->Apply(CustomArgsFull);
@@ -0,0 +1,198 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <testutil/assert.h>
+
+#include <memory>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exec/join_hash_map.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "util/runtime_profile.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+// Probe a one BIGINT key hash table with chunks of random keys. The build side has `build_rows` unique keys,
+// and about half of the probe keys hit the table.
+class JoinProbePerf {
+public:
+    JoinProbePerf(int64_t build_rows, TJoinOp::type join_type, bool enable_prefetch, bool enable_radix_partition)
+            : _build_rows(build_rows),
+              _join_type(join_type),
+              _enable_prefetch(enable_prefetch),
+              _enable_radix_partition(enable_radix_partition) {}
+
+    void SetUp();
+    void TearDown();
+    void do_bench(benchmark::State& state);
+
+private:
+    std::shared_ptr<RowDescriptor> _create_row_desc(TTupleId tuple_id);
+    ChunkPtr _create_chunk(size_t num_rows, int64_t max_key, SlotId slot_id);
+
+    static constexpr int kProbeChunks = 64;
+
+    int64_t _build_rows;
+    TJoinOp::type _join_type;
+    bool _enable_prefetch;
+    bool _enable_radix_partition;
+
+    ObjectPool _pool;
+    std::mt19937_64 _rng{0};
+    TypeDescriptor _type = TypeDescriptor::from_logical_type(TYPE_BIGINT);
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::shared_ptr<RuntimeProfile> _profile;
+    std::shared_ptr<RowDescriptor> _probe_desc;
+    std::shared_ptr<RowDescriptor> _build_desc;
+    JoinHashTable _hash_table;
+    std::vector<ChunkPtr> _probe_chunks;
+};
+
+std::shared_ptr<RowDescriptor> JoinProbePerf::_create_row_desc(TTupleId tuple_id) {
+    TDescriptorTableBuilder desc_builder;
+    for (int i = 0; i < 2; i++) {
+        TTupleDescriptorBuilder tuple_builder;
+        tuple_builder.add_slot(
+                TSlotDescriptorBuilder().type(TYPE_BIGINT).column_name("c0").column_pos(0).nullable(false).build());
+        tuple_builder.build(&desc_builder);
+    }
+    DescriptorTbl* tbl = nullptr;
+    CHECK(DescriptorTbl::create(_runtime_state.get(), &_pool, desc_builder.desc_tbl(), &tbl,
+                                config::vector_chunk_size)
+                  .ok());
+    return std::make_shared<RowDescriptor>(*tbl, std::vector<TTupleId>{tuple_id});
+}
+
+ChunkPtr JoinProbePerf::_create_chunk(size_t num_rows, int64_t max_key, SlotId slot_id) {
+    std::uniform_int_distribution<int64_t> dist(0, max_key);
+    auto column = ColumnHelper::create_column(_type, false);
+    auto* data_column = down_cast<Int64Column*>(column.get());
+    for (size_t i = 0; i < num_rows; i++) {
+        data_column->append(dist(_rng));
+    }
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(std::move(column), slot_id);
+    return chunk;
+}
+
+void JoinProbePerf::SetUp() {
+    config::vector_chunk_size = 4096;
+    TQueryOptions query_options;
+    query_options.batch_size = config::vector_chunk_size;
+    _runtime_state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    _runtime_state->init_instance_mem_tracker();
+    _profile = std::make_shared<RuntimeProfile>("join_probe_bench");
+
+    _probe_desc = _create_row_desc(0);
+    _build_desc = _create_row_desc(1);
+    SlotId probe_slot = _probe_desc->tuple_descriptors()[0]->slots()[0]->id();
+    SlotId build_slot = _build_desc->tuple_descriptors()[0]->slots()[0]->id();
+
+    HashTableParam param;
+    param.join_type = _join_type;
+    param.probe_row_desc = _probe_desc.get();
+    param.build_row_desc = _build_desc.get();
+    param.join_keys.emplace_back(JoinKeyDesc{&_type, false, nullptr});
+    param.search_ht_timer = ADD_TIMER(_profile, "SearchHashTableTime");
+    param.output_build_column_timer = ADD_TIMER(_profile, "OutputBuildColumnTime");
+    param.output_probe_column_timer = ADD_TIMER(_profile, "OutputProbeColumnTime");
+    param.enable_probe_prefetch = _enable_prefetch;
+    param.radix_partition_min_rows = _enable_radix_partition ? 1 : 0;
+    _hash_table.create(param);
+
+    // unique build keys [0, build_rows), appended chunk by chunk.
+    for (int64_t start = 0; start < _build_rows; start += config::vector_chunk_size) {
+        size_t num_rows = std::min<int64_t>(config::vector_chunk_size, _build_rows - start);
+        auto column = ColumnHelper::create_column(_type, false);
+        auto* data_column = down_cast<Int64Column*>(column.get());
+        for (size_t i = 0; i < num_rows; i++) {
+            data_column->append(start + i);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(column, build_slot);
+        _hash_table.append_chunk(chunk, Columns{column});
+    }
+    CHECK(_hash_table.build(_runtime_state.get()).ok());
+
+    for (int i = 0; i < kProbeChunks; i++) {
+        _probe_chunks.emplace_back(_create_chunk(config::vector_chunk_size, _build_rows * 2, probe_slot));
+    }
+}
+
+void JoinProbePerf::TearDown() {
+    _hash_table.close();
+    _probe_chunks.clear();
+}
+
+void JoinProbePerf::do_bench(benchmark::State& state) {
+    size_t probe_rows = 0;
+    int64_t probe_ns = 0;
+    for (auto _ : state) {
+        for (auto& probe_chunk : _probe_chunks) {
+            state.PauseTiming();
+            ChunkPtr chunk = probe_chunk->clone_unique();
+            Columns key_columns{chunk->columns()[0]};
+            state.ResumeTiming();
+
+            const int64_t start_ns = MonotonicNanos();
+            bool has_remain = true;
+            while (has_remain) {
+                ChunkPtr result = std::make_shared<Chunk>();
+                CHECK(_hash_table.probe(_runtime_state.get(), key_columns, &chunk, &result, &has_remain).ok());
+                benchmark::DoNotOptimize(result);
+            }
+            probe_ns += MonotonicNanos() - start_ns;
+            probe_rows += key_columns[0]->size();
+        }
+    }
+    state.counters["probe_ns_per_row"] =
+            benchmark::Counter(probe_rows == 0 ? 0.0 : static_cast<double>(probe_ns) / probe_rows);
+}
+
+static void bench_join_probe(benchmark::State& state) {
+    int64_t build_rows = state.range(0);
+    auto join_type = static_cast<TJoinOp::type>(state.range(1));
+    bool enable_prefetch = state.range(2);
+    bool enable_radix_partition = state.range(3);
+
+    JoinProbePerf perf(build_rows, join_type, enable_prefetch, enable_radix_partition);
+    perf.SetUp();
+    perf.do_bench(state);
+    perf.TearDown();
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    // build_rows, join_type, enable_prefetch, enable_radix_partition
+    for (int64_t build_rows : {1L << 14, 1L << 18, 1L << 22, 1L << 24}) {
+        for (auto join_type : {TJoinOp::INNER_JOIN, TJoinOp::LEFT_SEMI_JOIN, TJoinOp::LEFT_ANTI_JOIN}) {
+            b->Args({build_rows, join_type, 0, 0});
+            b->Args({build_rows, join_type, 1, 0});
+            b->Args({build_rows, join_type, 1, 1});
+        }
+    }
+}
+
+BENCHMARK(bench_join_probe)->Apply(process_args)->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
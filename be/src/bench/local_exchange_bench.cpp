@@ -0,0 +1,151 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <thread>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/chunk_buffer_memory_manager.h"
+#include "exec/pipeline/exchange/local_exchange.h"
+#include "exec/pipeline/exchange/local_exchange_source_operator.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+// Shuffles small chunks from several sinks to several sources of a local exchange at the same time, to measure the
+// contention on the sources with and without batching the rows of each source.
+class LocalExchangePerf {
+public:
+    LocalExchangePerf(int dop, int chunk_count, int src_chunk_size, int batch_rows)
+            : _dop(dop), _chunk_count(chunk_count), _src_chunk_size(src_chunk_size), _batch_rows(batch_rows) {}
+
+    void do_bench(benchmark::State& state);
+
+private:
+    ChunkPtr _init_src_chunk();
+    void _run();
+
+    int _dop = 64;
+    int _chunk_count = 1000;
+    int _src_chunk_size = 256;
+    int _batch_rows = 256;
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::unique_ptr<LocalExchangeSourceOperatorFactory> _source_factory;
+    std::vector<OperatorPtr> _sources;
+    ChunkPtr _src_chunk;
+};
+
+ChunkPtr LocalExchangePerf::_init_src_chunk() {
+    auto chunk = std::make_shared<Chunk>();
+    for (int i = 0; i < 4; i++) {
+        auto column = Int64Column::create();
+        for (int k = 0; k < _src_chunk_size; k++) {
+            column->append(rand());
+        }
+        chunk->append_column(std::move(column), i);
+    }
+    return chunk;
+}
+
+void LocalExchangePerf::_run() {
+    auto memory_manager = std::make_shared<ChunkBufferMemoryManager>(_dop, std::numeric_limits<int32_t>::max());
+    _source_factory = std::make_unique<LocalExchangeSourceOperatorFactory>(1, 1, memory_manager);
+    CHECK(_source_factory->prepare(_runtime_state.get()).ok());
+    _sources.clear();
+    for (int i = 0; i < _dop; i++) {
+        _sources.emplace_back(_source_factory->create(_dop, i));
+    }
+
+    std::atomic<int> running_sinks = _dop;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < _dop; i++) {
+        threads.emplace_back([&]() {
+            RandomPartitioner partitioner(_source_factory.get());
+            for (int k = 0; k < _chunk_count; k++) {
+                auto indexes = std::make_shared<std::vector<uint32_t>>(_src_chunk->num_rows());
+                CHECK(partitioner.partition_chunk(_src_chunk, _dop, *indexes).ok());
+                CHECK(partitioner.send_chunk(_src_chunk, indexes).ok());
+            }
+            CHECK(partitioner.flush().ok());
+            if (--running_sinks == 0) {
+                for (auto& source : _sources) {
+                    CHECK(source->set_finishing(_runtime_state.get()).ok());
+                }
+            }
+        });
+    }
+    for (int i = 0; i < _dop; i++) {
+        threads.emplace_back([&, i]() {
+            auto& source = _sources[i];
+            while (!source->is_finished()) {
+                if (source->has_output()) {
+                    CHECK(source->pull_chunk(_runtime_state.get()).ok());
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void LocalExchangePerf::do_bench(benchmark::State& state) {
+    TQueryOptions query_options;
+    query_options.__set_batch_size(4096);
+    _runtime_state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    _src_chunk = _init_src_chunk();
+    const int32_t batch_rows = config::local_exchange_shuffle_batch_rows;
+    config::local_exchange_shuffle_batch_rows = _batch_rows;
+    for (auto _ : state) {
+        _run();
+    }
+    config::local_exchange_shuffle_batch_rows = batch_rows;
+    state.SetItemsProcessed(state.iterations() * _dop * _chunk_count * _src_chunk_size);
+}
+
+static void bench_func(benchmark::State& state) {
+    int dop = state.range(0);
+    int chunk_count = state.range(1);
+    int src_chunk_size = state.range(2);
+    int batch_rows = state.range(3);
+
+    LocalExchangePerf perf(dop, chunk_count, src_chunk_size, batch_rows);
+    perf.do_bench(state);
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    // dop, chunk_count, src_chunk_size, batch_rows
+    for (int dop : {8, 32, 64}) {
+        for (int src_chunk_size : {256, 4096}) {
+            b->Args({dop, 1000, src_chunk_size, 0});
+            b->Args({dop, 1000, src_chunk_size, 256});
+            b->Args({dop, 1000, src_chunk_size, 1024});
+        }
+    }
+}
+
+BENCHMARK(bench_func)->Apply(process_args)->UseRealTime();
+
+} // namespace starrocks::pipeline
+
+BENCHMARK_MAIN();
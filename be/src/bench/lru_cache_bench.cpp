@@ -0,0 +1,86 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+static constexpr int kNumKeys = 100000;
+
+static void noop_deleter(const CacheKey& key, void* value) {}
+
+static const std::vector<std::string>& bench_keys() {
+    static std::vector<std::string> keys = [] {
+        std::vector<std::string> keys;
+        keys.reserve(2 * kNumKeys);
+        for (int i = 0; i < 2 * kNumKeys; i++) {
+            keys.emplace_back("lru_cache_bench_key_" + std::to_string(i));
+        }
+        return keys;
+    }();
+    return keys;
+}
+
+// All the threads share the same cache holding the first kNumKeys keys.
+static Cache* bench_cache(CachePolicy policy) {
+    static std::unique_ptr<Cache> caches[2];
+    static std::once_flag once[2];
+    const int index = static_cast<int>(policy);
+    std::call_once(once[index], [&] {
+        caches[index].reset(new_lru_cache(kNumKeys, ChargeMode::VALUESIZE, policy));
+        for (int i = 0; i < kNumKeys; i++) {
+            caches[index]->release(caches[index]->insert(bench_keys()[i], nullptr, 1, &noop_deleter));
+        }
+    });
+    return caches[index].get();
+}
+
+// Args: policy, percentage of the lookups missing the cache and followed by inserting the key.
+static void BM_lru_cache_lookup(benchmark::State& state) {
+    const auto policy = static_cast<CachePolicy>(state.range(0));
+    const int miss_percent = static_cast<int>(state.range(1));
+    Cache* cache = bench_cache(policy);
+    const auto& keys = bench_keys();
+
+    uint64_t i = static_cast<uint64_t>(state.thread_index()) * 7919;
+    for (auto _ : state) {
+        i++;
+        const bool miss = static_cast<int>(i % 100) < miss_percent;
+        // The missed keys are inserted and then evict the others, so the hit ratio stays about the same.
+        const auto& key = miss ? keys[kNumKeys + i % kNumKeys] : keys[(i * 31) % kNumKeys];
+        auto* handle = cache->lookup(key);
+        if (handle == nullptr) {
+            handle = cache->insert(key, nullptr, 1, &noop_deleter);
+        }
+        benchmark::DoNotOptimize(handle);
+        cache->release(handle);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_lru_cache_lookup)
+        ->ArgsProduct({{static_cast<int>(CachePolicy::LRU), static_cast<int>(CachePolicy::TINY_LFU)}, {0, 10}})
+        ->ThreadRange(1, 64)
+        ->UseRealTime();
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -269,6 +269,76 @@ static void BM_primitive(benchmark::State& state) {
     }
 }
 
+// Low cardinality strings written with dictionary encoding, read as the dictionary codes if `useDictCodes`.
+template <bool isNullable, bool useDictCodes>
+static void BM_dict_string(benchmark::State& state) {
+    const static size_t dictSize = 64;
+    MemoryOutputStream buffer(bufferSize);
+    ORC_UNIQUE_PTR<orc::Type> schema(orc::Type::buildTypeFromString(getOrcSchemaString(TYPE_VARCHAR)));
+    const orc::Type* orcType = schema->getSubtype(0);
+
+    // prepare data.
+    {
+        orc::WriterOptions writerOptions;
+        writerOptions.setDictionaryKeySizeThreshold(1.0);
+        ORC_UNIQUE_PTR<orc::Writer> writer = createWriter(*schema, &buffer, writerOptions);
+
+        std::vector<std::string> dict;
+        for (size_t i = 0; i < dictSize; i++) {
+            dict.emplace_back(strings::Substitute("Hello, ORC dictionary! $0", i));
+        }
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = writer->createRowBatch(batchSize);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* c0 = dynamic_cast<orc::StringVectorBatch*>(root->fields[0]);
+        for (size_t k = 0; k < batchNum; k++) {
+            c0->hasNulls = false;
+            for (size_t i = 0; i < batchSize; i++) {
+                const std::string& value = dict[(i * 7 + k) % dictSize];
+                c0->data[i] = const_cast<char*>(value.data());
+                c0->length[i] = value.length();
+                c0->notNull[i] = 1;
+                handleNull<isNullable>(c0, i, k);
+            }
+            c0->numElements = batchSize;
+            root->numElements = batchSize;
+            writer->add(*batch);
+        }
+        writer->close();
+    }
+
+    TypeDescriptor c0Type = TypeDescriptor::from_logical_type(TYPE_VARCHAR);
+    orc::ReaderOptions readerOptions;
+    ORC_UNIQUE_PTR<orc::InputStream> inputStream(new MemoryInputStream(buffer.getData(), buffer.getLength()));
+    ORC_UNIQUE_PTR<orc::Reader> reader = createReader(std::move(inputStream), readerOptions);
+
+    const OrcMappingPtr orcMapping = nullptr;
+    OrcChunkReader orcChunkReader(batchSize, {});
+    orcChunkReader.disable_broker_load_mode();
+    std::unique_ptr<ORCColumnReader> orcColumnReader =
+            ORCColumnReader::create(c0Type, orcType, isNullable, orcMapping, &orcChunkReader).value();
+
+    for (auto _ : state) {
+        orc::RowReaderOptions options;
+        std::list<std::string> columns = {"c0"};
+        options.include(columns);
+        options.setEnableLazyDecoding(useDictCodes);
+        ORC_UNIQUE_PTR<orc::RowReader> rr = reader->createRowReader(options);
+
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = rr->createRowBatch(columnSize);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* c0 = root->fields[0];
+        size_t totalNumRows = 0;
+        while (rr->next(*batch)) {
+            ColumnPtr column = ColumnHelper::create_column(c0Type, isNullable);
+            orcColumnReader->get_next(c0, column, 0, c0->numElements);
+            DCHECK_EQ(useDictCodes, c0->isEncoded);
+            DCHECK_EQ(c0->numElements, column->size());
+            totalNumRows += c0->numElements;
+        }
+        DCHECK_EQ(batchSize * batchNum, totalNumRows);
+    }
+}
+
 #define NULLABLE true
 #define NON_NULLABLE false
 
@@ -288,6 +358,20 @@ BENCHMARK_TEMPLATE(BM_primitive, NON_NULLABLE, LogicalType::TYPE_VARCHAR)
         ->Unit(benchmark::kMillisecond)
         ->Iterations(benchmarkIterationTimes);
 
+// Dictionary-encoded string, decoded by the dictionary codes or by the pointers and lengths of the batch
+BENCHMARK_TEMPLATE(BM_dict_string, NULLABLE, true)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(benchmarkIterationTimes);
+BENCHMARK_TEMPLATE(BM_dict_string, NULLABLE, false)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(benchmarkIterationTimes);
+BENCHMARK_TEMPLATE(BM_dict_string, NON_NULLABLE, true)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(benchmarkIterationTimes);
+BENCHMARK_TEMPLATE(BM_dict_string, NON_NULLABLE, false)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(benchmarkIterationTimes);
+
 // Char
 BENCHMARK_TEMPLATE(BM_primitive, NULLABLE, LogicalType::TYPE_CHAR)
         ->Unit(benchmark::kMillisecond)
@@ -19,6 +19,8 @@
 
 #include "formats/parquet/encoding_dict.h"
 #include "formats/parquet/encoding_plain.h"
+#include "util/faststring.h"
+#include "util/rle_encoding.h"
 
 namespace starrocks {
 namespace parquet {
@@ -98,6 +100,53 @@ static void BM_DictDecoder(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecoder)->DenseRange(0, 100, 10)->Unit(benchmark::kMillisecond);
 
+// Encodes kTestChunkSize random values of `bit_width` bits, in literal runs mostly.
+static faststring encode_random_values(int bit_width) {
+    faststring buffer;
+    RleEncoder<uint32_t> encoder(&buffer, bit_width);
+    std::mt19937 rng(bit_width);
+    const uint64_t max_value = (1UL << bit_width) - 1;
+    for (int i = 0; i < kTestChunkSize; i++) {
+        encoder.Put(rng() & max_value);
+    }
+    encoder.Flush();
+    return buffer;
+}
+
+// The dictionary decoding of a fixed-width column, by the bit width of the dictionary codes.
+template <typename T>
+static void BM_RleDictDecode(benchmark::State& state) {
+    const int bit_width = state.range(0);
+    std::vector<T> dict(1UL << bit_width);
+    for (size_t i = 0; i < dict.size(); i++) {
+        dict[i] = static_cast<T>(i * 7);
+    }
+    faststring buffer = encode_random_values(bit_width);
+    std::vector<T> values(kTestChunkSize);
+    for (auto _ : state) {
+        RleBatchDecoder<uint32_t> decoder(buffer.data(), buffer.size(), bit_width);
+        benchmark::DoNotOptimize(decoder.GetBatchWithDict(dict.data(), dict.size(), values.data(), kTestChunkSize));
+    }
+    state.SetItemsProcessed(state.iterations() * kTestChunkSize);
+}
+
+BENCHMARK_TEMPLATE(BM_RleDictDecode, int32_t)->DenseRange(1, 16, 3);
+BENCHMARK_TEMPLATE(BM_RleDictDecode, int64_t)->DenseRange(1, 16, 3);
+
+// The decoding of the definition and repetition levels.
+static void BM_RleLevelDecode(benchmark::State& state) {
+    const int bit_width = state.range(0);
+    faststring buffer = encode_random_values(bit_width);
+    std::vector<int16_t> levels(kTestChunkSize);
+    for (auto _ : state) {
+        RleDecoder<int16_t> decoder(buffer.data(), buffer.size(), bit_width);
+        benchmark::DoNotOptimize(decoder.GetBatch(levels.data(), kTestChunkSize));
+    }
+    state.SetItemsProcessed(state.iterations() * kTestChunkSize);
+}
+
+BENCHMARK(BM_RleLevelDecode)->DenseRange(1, 4, 1);
+
 } // namespace parquet
 } // namespace starrocks
 
@@ -0,0 +1,386 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exec/aggregator.h"
+#include "exec/chunk_buffer_memory_manager.h"
+#include "exec/pipeline/aggregate/aggregate_blocking_sink_operator.h"
+#include "exec/pipeline/aggregate/aggregate_blocking_source_operator.h"
+#include "exec/pipeline/exchange/local_exchange.h"
+#include "exec/pipeline/exchange/local_exchange_sink_operator.h"
+#include "exec/pipeline/exchange/local_exchange_source_operator.h"
+#include "exec/pipeline/noop_sink_operator.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/pipeline/sort/local_merge_sort_source_operator.h"
+#include "exec/pipeline/sort/partition_sort_sink_operator.h"
+#include "exec/pipeline/sort/sort_context.h"
+#include "exec/pipeline/source_operator.h"
+#include "exec/pipeline/spill_process_channel.h"
+#include "exec/sort_exec_exprs.h"
+#include "gutil/walltime.h"
+#include "runtime/current_thread.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/mem_tracker.h"
+#include "runtime/runtime_state.h"
+#include "testutil/exprs_test_helper.h"
+
+namespace starrocks::pipeline {
+
+// Emits a copy of each of the chunks of the benchmark, like a scan materializing the rows it reads.
+class BenchScanOperator final : public SourceOperator {
+public:
+    BenchScanOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                      const std::vector<ChunkPtr>& chunks)
+            : SourceOperator(factory, id, "bench_scan", plan_node_id, false, driver_sequence), _chunks(chunks) {}
+
+    bool has_output() const override { return _next < _chunks.size(); }
+    bool is_finished() const override { return _next >= _chunks.size(); }
+
+    Status set_finishing(RuntimeState* state) override {
+        _next = _chunks.size();
+        return Status::OK();
+    }
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override {
+        ChunkPtr chunk = _chunks[_next++]->clone_unique();
+        return chunk;
+    }
+
+private:
+    const std::vector<ChunkPtr>& _chunks;
+    size_t _next = 0;
+};
+
+class BenchScanOperatorFactory final : public SourceOperatorFactory {
+public:
+    BenchScanOperatorFactory(int32_t id, int32_t plan_node_id, const std::vector<ChunkPtr>& chunks)
+            : SourceOperatorFactory(id, "bench_scan", plan_node_id), _chunks(chunks) {}
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<BenchScanOperator>(this, _id, _plan_node_id, driver_sequence, _chunks);
+    }
+
+private:
+    const std::vector<ChunkPtr>& _chunks;
+};
+
+enum class BenchPipeline { AGG, SORT, EXCHANGE };
+
+// Runs the pipelines of a plan fragment end to end over chunks of two BIGINT columns (k, v), where k has `num_keys`
+// distinct values:
+// - AGG: scan -> aggregate_blocking_sink, aggregate_blocking_source -> noop_sink, for `select k, sum(v) group by k`.
+// - SORT: scan -> local_sort_sink, local_merge_source -> noop_sink, for `order by k`.
+// - EXCHANGE: scan -> local_exchange_sink, local_exchange_source -> noop_sink, a passthrough exchange.
+// The operators are created from their factories and the pipelines are driven in one thread the way
+// PipelineDriver::process moves the chunks, so the numbers include the operator overhead but not the scheduling.
+// Reports the rows per second, the cycles per row and the peak memory of a run.
+class PipelineOperatorPerf {
+public:
+    PipelineOperatorPerf(BenchPipeline pipeline, int64_t num_keys) : _pipeline(pipeline), _num_keys(num_keys) {}
+
+    void SetUp();
+    void do_bench(benchmark::State& state);
+
+private:
+    struct RunningPipeline {
+        Operators operators;
+        // the operators before it are finished
+        size_t first_unfinished = 0;
+    };
+
+    static constexpr int kChunkSize = 4096;
+    static constexpr int kNumChunks = 256;
+
+    void _init_desc_tbl();
+    void _init_chunks();
+    TExpr _slot_ref(TupleId tuple_id, SlotId slot_id) const;
+
+    std::vector<OpFactories> _build_pipelines(RuntimeState* state);
+    OpFactories _with_noop_sink(OpFactories operators);
+    Status _run(int64_t* peak_memory);
+    static StatusOr<bool> _step(RuntimeState* state, RunningPipeline* pipeline);
+
+    const BenchPipeline _pipeline;
+    const int64_t _num_keys;
+
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _desc_state;
+    DescriptorTbl* _desc_tbl = nullptr;
+    TTypeDesc _bigint_type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BIGINT);
+    std::vector<ChunkPtr> _chunks;
+
+    // referred to by the AggregatorFactory of a run
+    TPlanNode _agg_tnode;
+    int32_t _next_operator_id = 0;
+};
+
+void PipelineOperatorPerf::_init_desc_tbl() {
+    // tuple 0: the scan (k, v), also the tuple materialized by the sort
+    // tuple 1 and 2: the intermediate and output tuples of the aggregation (k, sum(v))
+    TDescriptorTableBuilder desc_builder;
+    for (int i = 0; i < 3; i++) {
+        TTupleDescriptorBuilder tuple_builder;
+        tuple_builder.add_slot(
+                TSlotDescriptorBuilder().type(TYPE_BIGINT).column_name("k").column_pos(0).nullable(false).build());
+        tuple_builder.add_slot(
+                TSlotDescriptorBuilder().type(TYPE_BIGINT).column_name("v").column_pos(1).nullable(false).build());
+        tuple_builder.build(&desc_builder);
+    }
+    CHECK(DescriptorTbl::create(_desc_state.get(), &_pool, desc_builder.desc_tbl(), &_desc_tbl, kChunkSize).ok());
+}
+
+void PipelineOperatorPerf::_init_chunks() {
+    std::mt19937_64 rng(0);
+    std::uniform_int_distribution<int64_t> key_dist(0, _num_keys - 1);
+    const auto& slots = _desc_tbl->get_tuple_descriptor(0)->slots();
+    for (int i = 0; i < kNumChunks; i++) {
+        auto keys = Int64Column::create();
+        auto values = Int64Column::create();
+        for (int k = 0; k < kChunkSize; k++) {
+            keys->append(key_dist(rng));
+            values->append(static_cast<int64_t>(rng() % 1000));
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(keys), slots[0]->id());
+        chunk->append_column(std::move(values), slots[1]->id());
+        _chunks.emplace_back(std::move(chunk));
+    }
+}
+
+TExpr PipelineOperatorPerf::_slot_ref(TupleId tuple_id, SlotId slot_id) const {
+    return ExprsTestHelper::create_slot_expr(
+            ExprsTestHelper::create_slot_expr_node(tuple_id, slot_id, _bigint_type, false));
+}
+
+void PipelineOperatorPerf::SetUp() {
+    TQueryOptions query_options;
+    query_options.__set_batch_size(kChunkSize);
+    _desc_state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    _init_desc_tbl();
+    _init_chunks();
+
+    const auto& scan_slots = _desc_tbl->get_tuple_descriptor(0)->slots();
+    auto& agg_node = _agg_tnode.agg_node;
+    _agg_tnode.__set_node_type(TPlanNodeType::AGGREGATION_NODE);
+    _agg_tnode.__set_limit(-1);
+    agg_node.__set_need_finalize(true);
+    agg_node.__set_streaming_preaggregation_mode(TStreamingPreaggregationMode::AUTO);
+    agg_node.__set_intermediate_tuple_id(1);
+    agg_node.__set_output_tuple_id(2);
+    agg_node.grouping_exprs.emplace_back(_slot_ref(0, scan_slots[0]->id()));
+    auto sum_fn = ExprsTestHelper::create_builtin_function("sum", {_bigint_type}, _bigint_type, _bigint_type);
+    auto value_ref = ExprsTestHelper::create_slot_expr_node(0, scan_slots[1]->id(), _bigint_type, false);
+    agg_node.aggregate_functions.emplace_back(ExprsTestHelper::create_aggregate_expr(sum_fn, {value_ref}));
+}
+
+OpFactories PipelineOperatorPerf::_with_noop_sink(OpFactories operators) {
+    operators.emplace_back(std::make_shared<NoopSinkOperatorFactory>(++_next_operator_id, 0));
+    return operators;
+}
+
+std::vector<OpFactories> PipelineOperatorPerf::_build_pipelines(RuntimeState* state) {
+    const int32_t plan_node_id = 1;
+    auto scan = std::make_shared<BenchScanOperatorFactory>(++_next_operator_id, 0, _chunks);
+
+    switch (_pipeline) {
+    case BenchPipeline::AGG: {
+        auto aggregator_factory = std::make_shared<AggregatorFactory>(_agg_tnode);
+        auto sink = std::make_shared<AggregateBlockingSinkOperatorFactory>(
+                ++_next_operator_id, plan_node_id, aggregator_factory, std::make_shared<SpillProcessChannelFactory>(1));
+        auto source = std::make_shared<AggregateBlockingSourceOperatorFactory>(++_next_operator_id, plan_node_id,
+                                                                               aggregator_factory);
+        return {{scan, sink}, _with_noop_sink({source})};
+    }
+    case BenchPipeline::SORT: {
+        auto* tuple_desc = _desc_tbl->get_tuple_descriptor(0);
+        const auto& slots = tuple_desc->slots();
+        TSortInfo sort_info;
+        std::vector<bool> is_asc_order{true};
+        std::vector<bool> is_null_first{false};
+        TSortInfo sort_info;
+        sort_info.ordering_exprs.emplace_back(_slot_ref(0, slots[0]->id()));
+        sort_info.__set_is_asc_order(is_asc_order);
+        sort_info.__set_nulls_first(is_null_first);
+        sort_info.__set_sort_tuple_slot_exprs({_slot_ref(0, slots[0]->id()), _slot_ref(0, slots[1]->id())});
+        auto* sort_exec_exprs = state->obj_pool()->add(new SortExecExprs());
+        CHECK(sort_exec_exprs->init(sort_info, state->obj_pool(), state).ok());
+
+        RowDescriptor row_desc(*_desc_tbl, {0});
+        std::vector<OrderByType> order_by_types{{TypeDescriptor(TYPE_BIGINT), false},
+                                                {TypeDescriptor(TYPE_BIGINT), false}};
+        auto sort_context_factory = std::make_shared<SortContextFactory>(
+                state, TTopNType::ROW_NUMBER, true, sort_exec_exprs->lhs_ordering_expr_ctxs(), is_asc_order,
+                is_null_first, std::vector<TExpr>{}, 0, -1, "", order_by_types,
+                std::vector<RuntimeFilterBuildDescriptor*>{});
+        auto sink = std::make_shared<PartitionSortSinkOperatorFactory>(
+                ++_next_operator_id, plan_node_id, sort_context_factory, *sort_exec_exprs, is_asc_order,
+                is_null_first, "", 0, -1, TTopNType::ROW_NUMBER, order_by_types, tuple_desc, row_desc, row_desc,
+                std::vector<ExprContext*>{}, 1024000, 16 * 1024 * 1024, std::vector<SlotId>{},
+                std::make_shared<SpillProcessChannelFactory>(1));
+        auto source = std::make_shared<LocalMergeSortSourceOperatorFactory>(++_next_operator_id, plan_node_id,
+                                                                            sort_context_factory);
+        return {{scan, sink}, _with_noop_sink({source})};
+    }
+    case BenchPipeline::EXCHANGE: {
+        auto memory_manager = std::make_shared<ChunkBufferMemoryManager>(
+                1, config::local_exchange_buffer_mem_limit_per_driver);
+        auto source =
+                std::make_shared<LocalExchangeSourceOperatorFactory>(++_next_operator_id, plan_node_id, memory_manager);
+        auto exchanger = std::make_shared<PassthroughExchanger>(memory_manager, source.get());
+        auto sink = std::make_shared<LocalExchangeSinkOperatorFactory>(++_next_operator_id, plan_node_id, exchanger);
+        return {{scan, sink}, _with_noop_sink({source})};
+    }
+    }
+    __builtin_unreachable();
+}
+
+// Moves the chunks along the operators of `pipeline` once, like a round of PipelineDriver::process, and returns
+// whether anything happened.
+StatusOr<bool> PipelineOperatorPerf::_step(RuntimeState* state, RunningPipeline* pipeline) {
+    auto& operators = pipeline->operators;
+    bool progressed = false;
+    for (size_t i = pipeline->first_unfinished; i + 1 < operators.size(); i++) {
+        auto& curr_op = operators[i];
+        auto& next_op = operators[i + 1];
+        if (curr_op->has_output() && next_op->need_input()) {
+            ASSIGN_OR_RETURN(auto chunk, curr_op->pull_chunk(state));
+            if (chunk != nullptr && chunk->num_rows() > 0) {
+                RETURN_IF_ERROR(next_op->push_chunk(state, chunk));
+            }
+            progressed = true;
+        }
+        if (i == pipeline->first_unfinished && curr_op->is_finished()) {
+            RETURN_IF_ERROR(next_op->set_finishing(state));
+            pipeline->first_unfinished = i + 1;
+            progressed = true;
+        }
+    }
+    return progressed;
+}
+
+Status PipelineOperatorPerf::_run(int64_t* peak_memory) {
+    MemTracker mem_tracker(-1, "pipeline_operator_bench");
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(&mem_tracker);
+    auto query_ctx = std::make_shared<QueryContext>();
+    TQueryOptions query_options;
+    query_options.__set_batch_size(kChunkSize);
+    RuntimeState state(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    state.set_desc_tbl(_desc_tbl);
+    state.set_query_ctx(query_ctx.get());
+    state.init_instance_mem_tracker();
+
+    auto factories = _build_pipelines(&state);
+    std::vector<RunningPipeline> pipelines(factories.size());
+    for (size_t i = 0; i < factories.size(); i++) {
+        for (auto& factory : factories[i]) {
+            RETURN_IF_ERROR(factory->prepare(&state));
+            pipelines[i].operators.emplace_back(factory->create(1, 0));
+        }
+    }
+    for (auto& pipeline : pipelines) {
+        for (auto& op : pipeline.operators) {
+            RETURN_IF_ERROR(op->prepare(&state));
+        }
+    }
+
+    size_t num_running = pipelines.size();
+    while (num_running > 0) {
+        bool progressed = false;
+        num_running = 0;
+        for (auto& pipeline : pipelines) {
+            if (pipeline.operators.back()->is_finished()) {
+                continue;
+            }
+            ASSIGN_OR_RETURN(bool pipeline_progressed, _step(&state, &pipeline));
+            progressed |= pipeline_progressed;
+            num_running++;
+        }
+        if (num_running > 0 && !progressed) {
+            return Status::InternalError("the pipelines of the benchmark are blocked");
+        }
+    }
+
+    for (auto& pipeline : pipelines) {
+        for (auto& op : pipeline.operators) {
+            RETURN_IF_ERROR(op->set_finished(&state));
+        }
+    }
+    for (auto& pipeline : pipelines) {
+        for (auto& op : pipeline.operators) {
+            op->close(&state);
+        }
+    }
+    for (auto& pipeline_factories : factories) {
+        for (auto& factory : pipeline_factories) {
+            factory->close(&state);
+        }
+    }
+    *peak_memory = mem_tracker.peak_consumption();
+    return Status::OK();
+}
+
+void PipelineOperatorPerf::do_bench(benchmark::State& state) {
+    const int64_t num_rows = static_cast<int64_t>(kNumChunks) * kChunkSize;
+    int64_t cycles = 0;
+    int64_t max_peak_memory = 0;
+    for (auto _ : state) {
+        int64_t peak_memory = 0;
+        const int64_t start = CycleClock::Now();
+        Status status = _run(&peak_memory);
+        CHECK(status.ok()) << status;
+        cycles += CycleClock::Now() - start;
+        max_peak_memory = std::max(max_peak_memory, peak_memory);
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+    state.counters["cycles_per_row"] =
+            benchmark::Counter(static_cast<double>(cycles) / num_rows, benchmark::Counter::kAvgIterations);
+    state.counters["peak_memory"] = benchmark::Counter(max_peak_memory, benchmark::Counter::kDefaults,
+                                                       benchmark::Counter::OneK::kIs1024);
+}
+
+static void run_bench(benchmark::State& state, BenchPipeline pipeline) {
+    PipelineOperatorPerf perf(pipeline, state.range(0));
+    perf.SetUp();
+    perf.do_bench(state);
+}
+
+static void bench_agg(benchmark::State& state) {
+    run_bench(state, BenchPipeline::AGG);
+}
+
+static void bench_sort(benchmark::State& state) {
+    run_bench(state, BenchPipeline::SORT);
+}
+
+static void bench_exchange(benchmark::State& state) {
+    run_bench(state, BenchPipeline::EXCHANGE);
+}
+
+// num_keys
+BENCHMARK(bench_agg)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_sort)->Arg(1 << 10)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_exchange)->Arg(1 << 10)->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks::pipeline
+
+BENCHMARK_MAIN();
@@ -116,6 +116,47 @@ static void process_args(benchmark::internal::Benchmark* b) {
 
 BENCHMARK(bench_func)->Apply(process_args);
 
+// Unions `bitmap_count` bitmaps of `value_count` random values in [0, end), one by one with |= when `multi_way` is
+// 0, otherwise in one BitmapValue::fast_union.
+static void bench_union_func(benchmark::State& state) {
+    size_t bitmap_count = state.range(0);
+    size_t value_count = state.range(1);
+    size_t end = state.range(2);
+    bool multi_way = state.range(3);
+
+    Random rand(0);
+    std::vector<BitmapValue> bitmaps(bitmap_count);
+    std::vector<const BitmapValue*> values;
+    for (auto& bitmap : bitmaps) {
+        for (size_t i = 0; i < value_count; i++) {
+            bitmap.add(rand.Next64() % end);
+        }
+        values.push_back(&bitmap);
+    }
+
+    for (auto _ : state) {
+        BitmapValue result;
+        if (multi_way) {
+            result.fast_union(values);
+        } else {
+            for (const auto* value : values) {
+                result |= *value;
+            }
+        }
+        benchmark::DoNotOptimize(result.cardinality());
+    }
+}
+
+static void process_union_args(benchmark::internal::Benchmark* b) {
+    for (int64_t multi_way : {0, 1}) {
+        b->Args({1000, 1000, 100000000, multi_way});
+        b->Args({1000, 10000, 5000000000, multi_way});
+        b->Args({100, 100000, 10000000, multi_way});
+    }
+}
+
+BENCHMARK(bench_union_func)->Apply(process_union_args);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,309 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <filesystem>
+#include <memory>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/datum.h"
+#include "common/config.h"
+#include "fs/fs_memory.h"
+#include "fs/fs_posix.h"
+#include "gen_cpp/olap_file.pb.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
+#include "storage/olap_common.h"
+#include "storage/page_cache.h"
+#include "storage/predicate_tree/predicate_tree.hpp"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema.h"
+#include "storage/types.h"
+
+namespace starrocks {
+
+enum class ValueDistribution {
+    // 0, 1, 2, ... in the order of the rows
+    SEQUENTIAL,
+    // uniform over [0, 2^31)
+    RANDOM,
+    // uniform over 64 values
+    LOW_CARDINALITY,
+};
+
+// Scans one column of a segment written by SegmentWriter, where the values follow `distribution` so that the
+// writer picks the encoding it would pick for such data (dictionary for low cardinality, bit shuffle or plain
+// otherwise), with a `column < x` predicate which keeps about `selectivity_pct` percent of the rows (none if 100).
+// The segment lives in memory or in a local file, and the pages are read through the page cache or not.
+// Reports the decoded bytes per second and the ns per row of each stage of the scan: io, decompress, predicate and
+// the rest of the decoding.
+class SegmentScanPerf {
+public:
+    SegmentScanPerf(LogicalType type, ValueDistribution distribution, int selectivity_pct, bool use_page_cache,
+                    bool local_file, CompressionTypePB compression)
+            : _type(type),
+              _distribution(distribution),
+              _selectivity_pct(selectivity_pct),
+              _use_page_cache(use_page_cache),
+              _local_file(local_file),
+              _compression(compression) {}
+
+    void SetUp();
+    void TearDown();
+    void do_bench(benchmark::State& state);
+
+private:
+    static constexpr int kChunkSize = 4096;
+    static constexpr int kNumRows = 4 * 1024 * 1024;
+
+    int64_t _value_of(int64_t row, std::mt19937_64* rng) const;
+    std::string _format(int64_t value) const;
+    void _write_segment();
+    std::unique_ptr<ColumnPredicate> _create_predicate() const;
+    Status _scan(OlapReaderStatistics* stats, int64_t* num_rows);
+
+    const LogicalType _type;
+    const ValueDistribution _distribution;
+    const int _selectivity_pct;
+    const bool _use_page_cache;
+    const bool _local_file;
+    const CompressionTypePB _compression;
+
+    std::shared_ptr<FileSystem> _fs;
+    std::string _dir;
+    std::string _file_name;
+    TabletSchemaCSPtr _tablet_schema;
+    std::shared_ptr<Segment> _segment;
+    std::unique_ptr<MemTracker> _page_cache_mem_tracker;
+};
+
+int64_t SegmentScanPerf::_value_of(int64_t row, std::mt19937_64* rng) const {
+    switch (_distribution) {
+    case ValueDistribution::SEQUENTIAL:
+        return row;
+    case ValueDistribution::RANDOM:
+        return (*rng)() % (1L << 31);
+    case ValueDistribution::LOW_CARDINALITY:
+        return (*rng)() % 64;
+    }
+    __builtin_unreachable();
+}
+
+std::string SegmentScanPerf::_format(int64_t value) const {
+    // zero padded, so the strings are in the order of the values
+    return _type == TYPE_VARCHAR ? fmt::format("{:010d}", value) : std::to_string(value);
+}
+
+void SegmentScanPerf::_write_segment() {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    schema_pb.set_num_short_key_columns(1);
+    schema_pb.set_compression_type(_compression);
+    auto* key = schema_pb.add_column();
+    key->set_unique_id(0);
+    key->set_name("k");
+    key->set_type("INT");
+    key->set_is_key(true);
+    key->set_is_nullable(false);
+    key->set_length(4);
+    key->set_index_length(4);
+    key->set_aggregation("NONE");
+    auto* value = schema_pb.add_column();
+    value->set_unique_id(1);
+    value->set_name("v");
+    value->set_type(_type == TYPE_VARCHAR ? "VARCHAR" : "INT");
+    value->set_is_key(false);
+    value->set_is_nullable(false);
+    value->set_length(_type == TYPE_VARCHAR ? 32 : 4);
+    value->set_index_length(_type == TYPE_VARCHAR ? 16 : 4);
+    value->set_aggregation("NONE");
+    _tablet_schema = TabletSchema::create(schema_pb);
+
+    auto wfile = _fs->new_writable_file(_file_name);
+    CHECK(wfile.ok()) << wfile.status();
+    SegmentWriterOptions opts;
+    SegmentWriter writer(std::move(wfile).value(), 0, _tablet_schema, opts);
+    CHECK(writer.init().ok());
+
+    std::mt19937_64 rng(0);
+    auto schema = ChunkHelper::convert_schema(_tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, kChunkSize);
+    std::vector<std::string> strings(kChunkSize);
+    for (int64_t start = 0; start < kNumRows; start += kChunkSize) {
+        chunk->reset();
+        auto& columns = chunk->columns();
+        for (int64_t row = start; row < start + kChunkSize; row++) {
+            columns[0]->append_datum(Datum(static_cast<int32_t>(row)));
+            const int64_t v = _value_of(row, &rng);
+            if (_type == TYPE_VARCHAR) {
+                strings[row - start] = _format(v);
+                columns[1]->append_datum(Datum(Slice(strings[row - start])));
+            } else {
+                columns[1]->append_datum(Datum(static_cast<int32_t>(v)));
+            }
+        }
+        CHECK(writer.append_chunk(*chunk).ok());
+    }
+    uint64_t file_size = 0;
+    uint64_t index_size = 0;
+    uint64_t footer_position = 0;
+    CHECK(writer.finalize(&file_size, &index_size, &footer_position).ok());
+
+    auto segment = Segment::open(_fs, FileInfo{_file_name}, 0, _tablet_schema);
+    CHECK(segment.ok()) << segment.status();
+    _segment = std::move(segment).value();
+}
+
+std::unique_ptr<ColumnPredicate> SegmentScanPerf::_create_predicate() const {
+    if (_selectivity_pct >= 100) {
+        return nullptr;
+    }
+    int64_t max_value = 0;
+    switch (_distribution) {
+    case ValueDistribution::SEQUENTIAL:
+        max_value = kNumRows;
+        break;
+    case ValueDistribution::RANDOM:
+        max_value = 1L << 31;
+        break;
+    case ValueDistribution::LOW_CARDINALITY:
+        max_value = 64;
+        break;
+    }
+    const std::string operand = _format(max_value * _selectivity_pct / 100);
+    return std::unique_ptr<ColumnPredicate>(new_column_lt_predicate(get_type_info(_type), 1, Slice(operand)));
+}
+
+void SegmentScanPerf::SetUp() {
+    config::vector_chunk_size = kChunkSize;
+    if (StoragePageCache::instance() == nullptr) {
+        _page_cache_mem_tracker = std::make_unique<MemTracker>();
+        StoragePageCache::create_global_cache(_page_cache_mem_tracker.get(), 4L * 1024 * 1024 * 1024);
+    }
+    if (_local_file) {
+        _fs = new_fs_posix();
+        _dir = (std::filesystem::temp_directory_path() / "segment_scan_bench").string();
+    } else {
+        _fs = std::make_shared<MemoryFileSystem>();
+        _dir = "/segment_scan_bench";
+    }
+    CHECK(_fs->create_dir_recursive(_dir).ok());
+    _file_name = _dir + "/bench.dat";
+    _write_segment();
+}
+
+void SegmentScanPerf::TearDown() {
+    _segment.reset();
+    StoragePageCache::instance()->prune();
+    (void)_fs->delete_file(_file_name);
+}
+
+Status SegmentScanPerf::_scan(OlapReaderStatistics* stats, int64_t* num_rows) {
+    SegmentReadOptions opts;
+    opts.fs = _fs;
+    opts.stats = stats;
+    opts.tablet_schema = _tablet_schema;
+    opts.use_page_cache = _use_page_cache;
+    opts.chunk_size = kChunkSize;
+    auto predicate = _create_predicate();
+    if (predicate != nullptr) {
+        PredicateAndNode pred_root;
+        pred_root.add_child(PredicateColumnNode{predicate.get()});
+        opts.pred_tree = PredicateTree::create(std::move(pred_root));
+    }
+
+    auto schema = ChunkHelper::convert_schema(_tablet_schema, {1});
+    ASSIGN_OR_RETURN(auto iter, _segment->new_iterator(schema, opts));
+    auto chunk = ChunkHelper::new_chunk(schema, kChunkSize);
+    while (true) {
+        chunk->reset();
+        auto st = iter->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        *num_rows += chunk->num_rows();
+    }
+    iter->close();
+    return Status::OK();
+}
+
+void SegmentScanPerf::do_bench(benchmark::State& state) {
+    OlapReaderStatistics stats;
+    int64_t output_rows = 0;
+    for (auto _ : state) {
+        if (!_use_page_cache) {
+            state.PauseTiming();
+            StoragePageCache::instance()->prune();
+            state.ResumeTiming();
+        }
+        Status st = _scan(&stats, &output_rows);
+        CHECK(st.ok()) << st;
+    }
+
+    const int64_t predicate_ns =
+            stats.vec_cond_evaluate_ns + stats.branchless_cond_evaluate_ns + stats.expr_cond_evaluate_ns;
+    const int64_t decode_ns =
+            std::max<int64_t>(0, stats.block_load_ns - stats.io_ns - stats.decompress_ns - predicate_ns);
+    const double rows = static_cast<double>(state.iterations()) * kNumRows;
+    state.SetBytesProcessed(stats.uncompressed_bytes_read);
+    state.SetItemsProcessed(static_cast<int64_t>(rows));
+    state.counters["io_ns_per_row"] = benchmark::Counter(stats.io_ns / rows);
+    state.counters["decompress_ns_per_row"] = benchmark::Counter(stats.decompress_ns / rows);
+    state.counters["decode_ns_per_row"] = benchmark::Counter(decode_ns / rows);
+    state.counters["predicate_ns_per_row"] = benchmark::Counter(predicate_ns / rows);
+    state.counters["output_rows"] = benchmark::Counter(output_rows, benchmark::Counter::kAvgIterations);
+}
+
+static void bench_segment_scan(benchmark::State& state) {
+    auto type = static_cast<LogicalType>(state.range(0));
+    auto distribution = static_cast<ValueDistribution>(state.range(1));
+    int selectivity_pct = state.range(2);
+    bool use_page_cache = state.range(3);
+    bool local_file = state.range(4);
+    auto compression = static_cast<CompressionTypePB>(state.range(5));
+
+    SegmentScanPerf perf(type, distribution, selectivity_pct, use_page_cache, local_file, compression);
+    perf.SetUp();
+    perf.do_bench(state);
+    perf.TearDown();
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    // type, distribution, selectivity_pct, use_page_cache, local_file, compression
+    for (LogicalType type : {TYPE_INT, TYPE_VARCHAR}) {
+        for (auto distribution :
+             {ValueDistribution::SEQUENTIAL, ValueDistribution::RANDOM, ValueDistribution::LOW_CARDINALITY}) {
+            const auto d = static_cast<int64_t>(distribution);
+            for (int selectivity_pct : {100, 50, 1}) {
+                b->Args({type, d, selectivity_pct, 0, 1, CompressionTypePB::LZ4_FRAME});
+            }
+            b->Args({type, d, 100, 1, 1, CompressionTypePB::LZ4_FRAME});
+            b->Args({type, d, 100, 0, 0, CompressionTypePB::LZ4_FRAME});
+            b->Args({type, d, 100, 0, 1, CompressionTypePB::ZSTD});
+        }
+    }
+}
+
+BENCHMARK(bench_segment_scan)->Apply(process_args)->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
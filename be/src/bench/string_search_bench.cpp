@@ -0,0 +1,100 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "column/binary_column.h"
+#include "runtime/Volnitsky.h"
+
+namespace starrocks {
+
+// Searches a needle in each value of a column, as the per-row path does, or in the bytes of all the values at once
+// by Volnitsky or FirstLastByteStringSearcher, as the buffer-level path of LIKE and locate does.
+enum SearchMode { PER_ROW = 0, VOLNITSKY = 1, FIRST_LAST_BYTE = 2 };
+
+static BinaryColumn::Ptr create_column(size_t num_rows, size_t value_size) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist('a', 'z');
+    auto column = BinaryColumn::create();
+    std::string value(value_size, ' ');
+    for (size_t i = 0; i < num_rows; i++) {
+        for (auto& c : value) {
+            c = dist(rng);
+        }
+        column->append(Slice(value));
+    }
+    return column;
+}
+
+template <typename Searcher>
+static size_t search_column(const BinaryColumn& column, const std::string& needle) {
+    const auto& offsets = column.get_offset();
+    const char* begin = reinterpret_cast<const char*>(column.get_bytes().data());
+    const char* pos = begin;
+    const char* end = begin + column.get_bytes().size();
+    Searcher searcher(needle.data(), needle.size(), end - pos);
+    size_t i = 0;
+    size_t hits = 0;
+    while (pos < end && end != (pos = searcher.search(pos, end - pos))) {
+        while (begin + offsets[i + 1] <= pos) {
+            ++i;
+        }
+        hits += pos + needle.size() <= begin + offsets[i + 1];
+        pos = begin + offsets[i + 1];
+        ++i;
+    }
+    return hits;
+}
+
+static void BM_column_string_search(benchmark::State& state) {
+    const auto mode = static_cast<SearchMode>(state.range(0));
+    const std::string needle(state.range(1), 'x');
+    auto column = create_column(4096, state.range(2));
+
+    for (auto _ : state) {
+        size_t hits = 0;
+        if (mode == PER_ROW) {
+            for (size_t i = 0; i < column->size(); i++) {
+                Slice value = column->get_slice(i);
+                hits += memmem(value.data, value.size, needle.data(), needle.size()) != nullptr;
+            }
+        } else if (mode == VOLNITSKY) {
+            hits = search_column<VolnitskyUTF8>(*column, needle);
+        } else {
+            hits = search_column<FirstLastByteStringSearcher>(*column, needle);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+}
+
+static void BM_column_string_search_args(benchmark::internal::Benchmark* b) {
+    for (int needle_size : {3, 8, 20}) {
+        for (int value_size : {16, 128}) {
+            for (int mode : {PER_ROW, VOLNITSKY, FIRST_LAST_BYTE}) {
+                b->Args({mode, needle_size, value_size});
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_column_string_search)->Apply(BM_column_string_search_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
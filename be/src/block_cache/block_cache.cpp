@@ -24,10 +24,13 @@
 #ifdef WITH_STARCACHE
 #include "block_cache/starcache_wrapper.h"
 #endif
+#include "block_cache/datacache_policy.h"
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/statusor.h"
 #include "gutil/strings/substitute.h"
+#include "util/hash_util.hpp"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -70,6 +73,8 @@ Status BlockCache::init(const CacheOptions& options) {
         return Status::NotSupported("unsupported block cache engine");
     }
     RETURN_IF_ERROR(_kv_cache->init(cache_options));
+    // The sampled blocks are bounded by 64K, which covers the caches of up to 4TB with 1MB blocks by default.
+    _hit_rate_curve = std::make_unique<HitRateCurve>(_block_size, config::datacache_auto_tune_sample_ratio, 64 * 1024);
     _initialized.store(true, std::memory_order_relaxed);
     if (_disk_space_monitor) {
         _disk_space_monitor->start();
@@ -89,6 +94,15 @@ Status BlockCache::write_buffer(const CacheKey& cache_key, off_t offset, const I
 
     size_t index = offset / _block_size;
     std::string block_key = fmt::format("{}/{}", cache_key, index);
+    if (options != nullptr && options->tag != nullptr) {
+        auto* policy = DataCachePolicy::instance();
+        if (!policy->admit(*options->tag, block_key, [this] { return _under_pressure(); })) {
+            return Status::ResourceBusy("rejected by the datacache policy");
+        }
+        RETURN_IF_ERROR(_kv_cache->write_buffer(block_key, buffer, options));
+        policy->record_write(*options->tag, buffer.size());
+        return Status::OK();
+    }
     return _kv_cache->write_buffer(block_key, buffer, options);
 }
 
@@ -121,7 +135,14 @@ Status BlockCache::read_buffer(const CacheKey& cache_key, off_t offset, size_t s
 
     size_t index = offset / _block_size;
     std::string block_key = fmt::format("{}/{}", cache_key, index);
-    return _kv_cache->read_buffer(block_key, offset - index * _block_size, size, buffer, options);
+    if (config::datacache_auto_tune_enable && _hit_rate_curve != nullptr) {
+        _hit_rate_curve->record(HashUtil::hash64(block_key.data(), block_key.size(), 0));
+    }
+    auto st = _kv_cache->read_buffer(block_key, offset - index * _block_size, size, buffer, options);
+    if (options != nullptr && options->tag != nullptr && (st.ok() || st.is_not_found())) {
+        DataCachePolicy::instance()->record_read(*options->tag, st.ok());
+    }
+    return st;
 }
 
 StatusOr<size_t> BlockCache::read_buffer(const CacheKey& cache_key, off_t offset, size_t size, char* data,
@@ -181,6 +202,20 @@ const DataCacheMetrics BlockCache::cache_metrics(int level) const {
     return _kv_cache->cache_metrics(level);
 }
 
+bool BlockCache::_under_pressure() {
+    // The usage is refreshed at most once a second, as collecting the metrics is not cheap.
+    const int64_t now = MonotonicMillis();
+    int64_t last = _pressure_check_ms.load(std::memory_order_relaxed);
+    if (now - last >= 1000 && _pressure_check_ms.compare_exchange_strong(last, now)) {
+        auto metrics = cache_metrics(0);
+        const double quota = double(metrics.mem_quota_bytes) + double(metrics.disk_quota_bytes);
+        const double used = double(metrics.mem_used_bytes) + double(metrics.disk_used_bytes);
+        _is_under_pressure.store(quota > 0 && used >= quota * config::datacache_policy_pressure_ratio,
+                                 std::memory_order_relaxed);
+    }
+    return _is_under_pressure.load(std::memory_order_relaxed);
+}
+
 Status BlockCache::shutdown() {
     if (!_initialized.load(std::memory_order_relaxed)) {
         return Status::OK();
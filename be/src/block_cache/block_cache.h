@@ -17,6 +17,7 @@
 #include <atomic>
 
 #include "block_cache/disk_space_monitor.h"
+#include "block_cache/hit_rate_curve.h"
 #include "block_cache/kv_cache.h"
 #include "common/status.h"
 
@@ -35,7 +36,8 @@ public:
     // Init the block cache instance
     Status init(const CacheOptions& options);
 
-    // Write data buffer to cache, the `offset` must be aligned by block size
+    // Write data buffer to cache, the `offset` must be aligned by block size. The data of a tagged write may be
+    // rejected by the DataCachePolicy, with a ResourceBusy status.
     Status write_buffer(const CacheKey& cache_key, off_t offset, const IOBuffer& buffer,
                         WriteCacheOptions* options = nullptr);
 
@@ -77,6 +79,10 @@ public:
 
     const DataCacheMetrics cache_metrics(int level = 0) const;
 
+    // The hit ratio curve estimated from the reads of the cache, it is recorded if
+    // `config::datacache_auto_tune_enable` is on, and nullptr before init.
+    HitRateCurve* hit_rate_curve() { return _hit_rate_curve.get(); }
+
     // Shutdown the cache instance to save some state meta
     Status shutdown();
 
@@ -93,10 +99,16 @@ private:
     BlockCache() = default;
 #endif
 
+    // Returns whether the cache usage reaches `config::datacache_policy_pressure_ratio`.
+    bool _under_pressure();
+
     size_t _block_size = 0;
     std::unique_ptr<KvCache> _kv_cache;
     std::unique_ptr<DiskSpaceMonitor> _disk_space_monitor;
+    std::unique_ptr<HitRateCurve> _hit_rate_curve;
     std::atomic<bool> _initialized = false;
+    std::atomic<int64_t> _pressure_check_ms = 0;
+    std::atomic<bool> _is_under_pressure = false;
 };
 
 } // namespace starrocks
@@ -46,6 +46,13 @@ struct CacheOptions {
     double skip_read_factor = 0;
 };
 
+// The table and column the data written into or read from the cache belongs to, by which the datacache policies
+// are applied and the statistics are collected. The column is empty if the data is not of a single column.
+struct DataCacheTag {
+    std::string table;
+    std::string column;
+};
+
 struct WriteCacheOptions {
     // If ttl_seconds=0 (default), no ttl restriction will be set. If an old one exists, remove it.
     uint64_t ttl_seconds = 0;
@@ -56,6 +63,7 @@ struct WriteCacheOptions {
     // the write finish. So the cache library can use the buffer directly without copying it to another buffer.
     bool allow_zero_copy = false;
     std::function<void(int, const std::string&)> callback = nullptr;
+    const DataCacheTag* tag = nullptr;
 
     struct Stats {
         int64_t write_mem_bytes = 0;
@@ -65,6 +73,7 @@ struct WriteCacheOptions {
 
 struct ReadCacheOptions {
     bool use_adaptor = false;
+    const DataCacheTag* tag = nullptr;
 
     struct Stats {
         int64_t read_mem_bytes = 0;
@@ -0,0 +1,155 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "block_cache/datacache_policy.h"
+
+#include <string_view>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "gutil/strings/split.h"
+#include "gutil/strings/strip.h"
+#include "util/string_parser.hpp"
+
+namespace starrocks {
+
+static std::string tag_name(const DataCacheTag& tag) {
+    return tag.column.empty() ? tag.table : tag.table + "." + tag.column;
+}
+
+DataCachePolicy* DataCachePolicy::instance() {
+    static DataCachePolicy policy;
+    return &policy;
+}
+
+StatusOr<std::unordered_map<std::string, DataCachePolicy::Policy>> DataCachePolicy::parse(
+        const std::string& policies) {
+    std::unordered_map<std::string, Policy> result;
+    for (auto& item : strings::Split(policies, ";", strings::SkipWhitespace())) {
+        std::vector<std::string> kv = strings::Split(item, strings::delimiter::Limit(":", 1));
+        if (kv.size() != 2) {
+            return Status::InvalidArgument(fmt::format("invalid datacache policy: {}", item));
+        }
+        StripWhiteSpace(&kv[0]);
+        if (kv[0].empty()) {
+            return Status::InvalidArgument(fmt::format("missing table of datacache policy: {}", item));
+        }
+        Policy policy;
+        for (auto& prop : strings::Split(kv[1], ",", strings::SkipWhitespace())) {
+            std::vector<std::string> pv = strings::Split(prop, strings::delimiter::Limit("=", 1));
+            if (pv.size() != 2) {
+                return Status::InvalidArgument(fmt::format("invalid datacache policy property: {}", prop));
+            }
+            StripWhiteSpace(&pv[0]);
+            StripWhiteSpace(&pv[1]);
+            StringParser::ParseResult res = StringParser::PARSE_FAILURE;
+            if (pv[0] == "priority") {
+                policy.priority = StringParser::string_to_int<int32_t>(pv[1].data(), pv[1].size(), &res);
+            } else if (pv[0] == "admission_ratio") {
+                policy.admission_ratio = StringParser::string_to_float<double>(pv[1].data(), pv[1].size(), &res);
+                if (policy.admission_ratio < 0 || policy.admission_ratio > 1) {
+                    res = StringParser::PARSE_FAILURE;
+                }
+            } else if (pv[0] == "pinned") {
+                policy.pinned = StringParser::string_to_bool(pv[1].data(), pv[1].size(), &res);
+            }
+            if (res != StringParser::PARSE_SUCCESS) {
+                return Status::InvalidArgument(fmt::format("invalid datacache policy property: {}", prop));
+            }
+        }
+        result[kv[0]] = policy;
+    }
+    return result;
+}
+
+DataCachePolicy::Policy DataCachePolicy::get_policy(const DataCacheTag& tag) {
+    std::lock_guard l(_policies_mutex);
+    if (_policies_conf != config::datacache_column_policies) {
+        _policies_conf = config::datacache_column_policies;
+        auto res = parse(_policies_conf);
+        if (res.ok()) {
+            _policies = std::move(res).value();
+        } else {
+            LOG(WARNING) << "Ignore the datacache policies: " << res.status();
+            _policies.clear();
+        }
+    }
+    if (_policies.empty()) {
+        return {};
+    }
+    if (!tag.column.empty()) {
+        if (auto iter = _policies.find(tag_name(tag)); iter != _policies.end()) {
+            return iter->second;
+        }
+    }
+    auto iter = _policies.find(tag.table);
+    return iter != _policies.end() ? iter->second : Policy{};
+}
+
+bool DataCachePolicy::admit(const DataCacheTag& tag, const std::string& block_key,
+                            const std::function<bool()>& under_pressure) {
+    const Policy policy = get_policy(tag);
+    bool admitted = true;
+    if (policy.pinned) {
+        return true;
+    }
+    if (policy.priority < 0 && under_pressure()) {
+        admitted = false;
+    } else if (policy.admission_ratio < 1) {
+        constexpr uint64_t kBuckets = 10000;
+        admitted = std::hash<std::string_view>()(block_key) % kBuckets < policy.admission_ratio * kBuckets;
+    }
+    if (!admitted) {
+        std::lock_guard l(_stats_mutex);
+        if (auto* stats = _stats_of(tag); stats != nullptr) {
+            stats->reject_count++;
+        }
+    }
+    return admitted;
+}
+
+void DataCachePolicy::record_read(const DataCacheTag& tag, bool hit) {
+    std::lock_guard l(_stats_mutex);
+    if (auto* stats = _stats_of(tag); stats != nullptr) {
+        (hit ? stats->hit_count : stats->miss_count)++;
+    }
+}
+
+void DataCachePolicy::record_write(const DataCacheTag& tag, int64_t bytes) {
+    std::lock_guard l(_stats_mutex);
+    if (auto* stats = _stats_of(tag); stats != nullptr) {
+        stats->write_count++;
+        stats->write_bytes += bytes;
+    }
+}
+
+std::vector<std::pair<std::string, DataCachePolicy::TagStats>> DataCachePolicy::tag_stats() const {
+    std::lock_guard l(_stats_mutex);
+    return {_stats.begin(), _stats.end()};
+}
+
+DataCachePolicy::TagStats* DataCachePolicy::_stats_of(const DataCacheTag& tag) {
+    auto name = tag_name(tag);
+    auto iter = _stats.find(name);
+    if (iter != _stats.end()) {
+        return &iter->second;
+    }
+    if (_stats.size() >= kMaxTags) {
+        return nullptr;
+    }
+    return &_stats[std::move(name)];
+}
+
+} // namespace starrocks
@@ -0,0 +1,90 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "block_cache/cache_options.h"
+#include "common/statusor.h"
+
+namespace starrocks {
+
+// DataCachePolicy decides which blocks of the tables and columns are admitted into the BlockCache, by the policies
+// configured by `config::datacache_column_policies`, and collects the hits, misses and writes of each table and
+// column, reported by the datacache http action.
+//
+// The cache engines do not expose per-entry eviction priorities, so the policies are enforced when the blocks are
+// written: the blocks of a negative priority are rejected when the cache is under pressure, a column or table with
+// an admission ratio below 1 only has that ratio of its blocks admitted, chosen by the hash of the block key, and
+// the blocks of the pinned ones are always admitted. The admitted blocks are evicted by the engine as usual.
+class DataCachePolicy {
+public:
+    struct Policy {
+        int32_t priority = 0;
+        double admission_ratio = 1.0;
+        bool pinned = false;
+    };
+
+    struct TagStats {
+        int64_t hit_count = 0;
+        int64_t miss_count = 0;
+        int64_t write_count = 0;
+        int64_t write_bytes = 0;
+        int64_t reject_count = 0;
+    };
+
+    // The max number of tables and columns whose statistics are collected.
+    static constexpr size_t kMaxTags = 10000;
+
+    static DataCachePolicy* instance();
+
+    // Parses the policies in the format of `config::datacache_column_policies`, keyed by `<db>.<table>[.<column>]`.
+    static StatusOr<std::unordered_map<std::string, Policy>> parse(const std::string& policies);
+
+    // Returns the policy of the column of `tag`, or the one of its table if the column has no policy.
+    Policy get_policy(const DataCacheTag& tag);
+
+    // Returns whether the block named `block_key` of `tag` is admitted into the cache. `under_pressure` returns
+    // whether the cache usage reaches `config::datacache_policy_pressure_ratio`, and is only called for the blocks
+    // of a negative priority.
+    bool admit(const DataCacheTag& tag, const std::string& block_key, const std::function<bool()>& under_pressure);
+
+    void record_read(const DataCacheTag& tag, bool hit);
+    void record_write(const DataCacheTag& tag, int64_t bytes);
+
+    // Returns the statistics keyed by `<db>.<table>[.<column>]`.
+    std::vector<std::pair<std::string, TagStats>> tag_stats() const;
+
+private:
+    // Returns nullptr if the statistics of too many tags are collected. Requires `_stats_mutex`.
+    TagStats* _stats_of(const DataCacheTag& tag);
+
+    std::mutex _policies_mutex;
+    // The config value `_policies` is parsed from.
+    std::string _policies_conf;
+    std::unordered_map<std::string, Policy> _policies;
+
+    mutable std::mutex _stats_mutex;
+    std::unordered_map<std::string, TagStats> _stats;
+};
+
+} // namespace starrocks
@@ -14,9 +14,15 @@
 
 #include "block_cache/disk_space_monitor.h"
 
+#include <algorithm>
+
 #include "block_cache/block_cache.h"
+#include "block_cache/hit_rate_curve.h"
 #include "common/config.h"
+#include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
 #include "util/await.h"
+#include "util/starrocks_metrics.h"
 #include "util/thread.h"
 
 namespace starrocks {
@@ -29,6 +35,8 @@ const size_t DiskSpaceMonitor::QUOTA_ALIGN_UNIT = 10uL * 1024 * 1024;
 
 const int64_t DiskSpaceMonitor::AUTO_INCREASE_THRESHOLD = 90;
 
+const int64_t DiskSpaceMonitor::AUTO_TUNE_MIN_ACCESSES = 10000;
+
 StatusOr<size_t> DiskSpaceMonitor::FileSystemWrapper::directory_capacity(const std::string& dir) {
     size_t capacity = 0;
     auto st = FileSystem::Default()->iterate_dir2(dir, [&](DirEntry entry) {
@@ -72,13 +80,22 @@ bool DiskSpaceMonitor::is_stopped() {
 void DiskSpaceMonitor::_adjust_datacache_callback() {
     while (!is_stopped()) {
         std::unique_lock<std::mutex> lck(_mutex);
-        if (config::datacache_enable && config::datacache_auto_adjust_enable &&
+        if (config::datacache_enable && (config::datacache_auto_adjust_enable || config::datacache_auto_tune_enable) &&
             !_adjusting.load(std::memory_order_acquire)) {
             _update_disk_stats();
             _update_cache_stats();
-            if (_adjust_spaces_by_disk_usage(false)) {
+            bool adjusted = false;
+            if (config::datacache_auto_adjust_enable && _adjust_spaces_by_disk_usage(false)) {
                 Status st = adjust_cache_quota(_dir_spaces);
                 LOG_IF(WARNING, !st.ok()) << "fail to adjust datacache disk quota, reason: " << st.message();
+                adjusted = true;
+            }
+            // The quotas are tuned by the hit ratio only if the disk usage does not require an adjustment.
+            _tune_period += config::datacache_disk_adjust_interval_seconds;
+            if (!adjusted && config::datacache_auto_tune_enable &&
+                _tune_period >= config::datacache_auto_tune_interval_seconds) {
+                _tune_period = 0;
+                _tune_quotas_by_hit_ratio();
             }
         }
         lck.unlock();
@@ -261,6 +278,137 @@ void DiskSpaceMonitor::_reset_spaces() {
     }
 }
 
+void DiskSpaceMonitor::_tune_quotas_by_hit_ratio() {
+    HitRateCurve* curve = _cache->hit_rate_curve();
+    if (curve == nullptr) {
+        return;
+    }
+    const auto metrics = _cache->cache_metrics();
+    const size_t mem_quota = std::max<int64_t>(metrics.mem_quota_bytes, 0);
+    if (curve->num_accesses() >= AUTO_TUNE_MIN_ACCESSES) {
+        StarRocksMetrics::instance()->datacache_auto_tune_estimated_hit_ratio.set_value(
+                100 * curve->hit_ratio(mem_quota + _total_cache_quota));
+        _tune_mem_quota(*curve, mem_quota);
+        _tune_disk_quota(*curve, mem_quota);
+    }
+    // follow the recent accesses
+    curve->decay();
+}
+
+void DiskSpaceMonitor::_tune_mem_quota(const HitRateCurve& curve, size_t mem_quota) {
+    const int64_t max_quota = config::datacache_auto_tune_max_mem_quota;
+    const int64_t min_quota = config::datacache_auto_tune_min_mem_quota;
+    if (max_quota <= 0) {
+        return;
+    }
+    // The memory tier holds the hottest blocks, so its hit ratio is the one of an LRU cache of its capacity.
+    const int64_t step = std::max<int64_t>(mem_quota / 10, 64L * 1024 * 1024);
+    const double hit_ratio = curve.hit_ratio(mem_quota);
+    const double gain = curve.hit_ratio(mem_quota + step) - hit_ratio;
+    const double loss = mem_quota >= step ? hit_ratio - curve.hit_ratio(mem_quota - step) : 1.0;
+
+    // The memory is given back to the queries once the process memory is high, whatever the hit ratio is.
+    bool memory_high = false;
+    MemTracker* process_tracker = GlobalEnv::GetInstance()->process_mem_tracker();
+    if (process_tracker != nullptr && process_tracker->has_limit()) {
+        const int64_t memory_high_bytes = process_tracker->limit() * config::memory_high_level / 100;
+        memory_high = process_tracker->consumption() + step > memory_high_bytes;
+    }
+
+    int64_t new_quota = mem_quota;
+    const double min_gain = config::datacache_auto_tune_min_hit_ratio_gain;
+    if (memory_high || loss < min_gain / 2) {
+        new_quota = std::max<int64_t>(min_quota, mem_quota - std::min<int64_t>(step, mem_quota));
+    } else if (gain >= min_gain) {
+        new_quota = std::min<int64_t>(max_quota, mem_quota + step);
+    }
+    if (new_quota == static_cast<int64_t>(mem_quota)) {
+        return;
+    }
+    Status st = _cache->update_mem_quota(new_quota);
+    if (!st.ok()) {
+        LOG(WARNING) << "fail to tune datacache memory quota, reason: " << st.message();
+        return;
+    }
+    LOG(INFO) << "tune datacache memory quota from " << mem_quota << " to " << new_quota
+              << ", hit ratio: " << hit_ratio << ", gain of growth: " << gain << ", loss of shrink: " << loss
+              << ", memory high: " << memory_high;
+    StarRocksMetrics::instance()->datacache_auto_tune_mem_quota_bytes.set_value(new_quota);
+    if (new_quota > static_cast<int64_t>(mem_quota)) {
+        StarRocksMetrics::instance()->datacache_auto_tune_grow_total.increment(1);
+    } else {
+        StarRocksMetrics::instance()->datacache_auto_tune_shrink_total.increment(1);
+    }
+}
+
+void DiskSpaceMonitor::_tune_disk_quota(const HitRateCurve& curve, size_t mem_quota) {
+    if (_dir_spaces.empty()) {
+        return;
+    }
+    const int64_t max_quota = config::datacache_auto_tune_max_disk_quota;
+    const int64_t min_quota = config::datacache_auto_tune_min_disk_quota;
+    const size_t num_dirs = _dir_spaces.size();
+    // a tenth of the quota, aligned by QUOTA_ALIGN_UNIT
+    const size_t dir_step =
+            std::max(QUOTA_ALIGN_UNIT, _total_cache_quota / 10 / num_dirs / QUOTA_ALIGN_UNIT * QUOTA_ALIGN_UNIT);
+    const size_t step = dir_step * num_dirs;
+    // The disk tier holds the blocks next to the ones of the memory tier.
+    const size_t capacity = mem_quota + _total_cache_quota;
+    const double hit_ratio = curve.hit_ratio(capacity);
+    const double gain = curve.hit_ratio(capacity + step) - hit_ratio;
+    const double loss = _total_cache_quota >= step ? hit_ratio - curve.hit_ratio(capacity - step) : 1.0;
+    const bool can_shrink = std::all_of(_dir_spaces.begin(), _dir_spaces.end(),
+                                        [dir_step](const auto& dir_space) { return dir_space.size >= dir_step; });
+
+    const double min_gain = config::datacache_auto_tune_min_hit_ratio_gain;
+    int64_t delta = 0;
+    if (gain >= min_gain && (max_quota <= 0 || _total_cache_quota + step <= max_quota) &&
+        _disk_allows_growth(dir_step)) {
+        delta = dir_step;
+    } else if (loss < min_gain / 2 && can_shrink && _total_cache_quota >= min_quota + step) {
+        delta = -static_cast<int64_t>(dir_step);
+    }
+    if (delta == 0) {
+        return;
+    }
+
+    for (auto& dir_space : _dir_spaces) {
+        dir_space.size += delta;
+    }
+    Status st = adjust_cache_quota(_dir_spaces);
+    if (!st.ok()) {
+        LOG(WARNING) << "fail to tune datacache disk quota, reason: " << st.message();
+        for (auto& dir_space : _dir_spaces) {
+            dir_space.size -= delta;
+        }
+        return;
+    }
+    const size_t new_quota = _total_cache_quota + delta * num_dirs;
+    LOG(INFO) << "tune datacache disk quota from " << _total_cache_quota << " to " << new_quota
+              << ", hit ratio: " << hit_ratio << ", gain of growth: " << gain << ", loss of shrink: " << loss;
+    _total_cache_quota = new_quota;
+    StarRocksMetrics::instance()->datacache_auto_tune_disk_quota_bytes.set_value(new_quota);
+    if (delta > 0) {
+        StarRocksMetrics::instance()->datacache_auto_tune_grow_total.increment(1);
+    } else {
+        StarRocksMetrics::instance()->datacache_auto_tune_shrink_total.increment(1);
+    }
+}
+
+bool DiskSpaceMonitor::_disk_allows_growth(size_t dir_step) {
+    for (const auto& [disk_id, dirs] : _disk_to_dirs) {
+        const auto& disk = _disk_stats[disk_id];
+        if (disk.capacity_bytes == 0) {
+            return false;
+        }
+        const size_t used_bytes = disk.capacity_bytes - disk.available_bytes + dir_step * dirs.size();
+        if (static_cast<int64_t>(used_bytes * 100 / disk.capacity_bytes) > config::datacache_disk_safe_level) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status DiskSpaceMonitor::adjust_cache_quota(const std::vector<DirSpace>& dir_spaces) {
     _adjusting.store(true, std::memory_order_release);
     Status st = _cache->update_disk_spaces(dir_spaces);
@@ -27,6 +27,7 @@
 namespace starrocks {
 
 class BlockCache;
+class HitRateCurve;
 class DiskSpaceMonitor {
 public:
     struct DiskStats {
@@ -70,6 +71,8 @@ public:
     // the disk expansion will be skipped.
     // NOTICE: When users update the disk quota manually, this threshold will be ignored.
     const static int64_t AUTO_INCREASE_THRESHOLD;
+    // The min number of the accesses recorded by the hit ratio curve to tune the cache quotas by it.
+    const static int64_t AUTO_TUNE_MIN_ACCESSES;
 
 private:
     void _update_disk_stats();
@@ -83,6 +86,13 @@ private:
 
     void _adjust_datacache_callback();
 
+    // Grow or shrink the memory and disk quotas by a step, based on the marginal hit ratio gain of the step.
+    void _tune_quotas_by_hit_ratio();
+    void _tune_mem_quota(const HitRateCurve& curve, size_t mem_quota);
+    void _tune_disk_quota(const HitRateCurve& curve, size_t mem_quota);
+    // Whether the disks stay under the safe level after each cache directory grows by |dir_step|.
+    bool _disk_allows_growth(size_t dir_step);
+
     void _reset() {
         _dir_spaces.clear();
         _disk_stats.clear();
@@ -104,6 +114,7 @@ private:
     size_t _total_cache_usage = 0;
     size_t _total_cache_quota = 0;
     int64_t _disk_free_period = 0;
+    int64_t _tune_period = 0;
 
     std::atomic<bool> _stopped = true;
     std::atomic<bool> _adjusting = false;
@@ -0,0 +1,130 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/hit_rate_curve.h"
+
+#include <algorithm>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+HitRateCurve::HitRateCurve(size_t block_size, uint32_t sample_ratio, size_t max_samples)
+        : _block_size(std::max<size_t>(block_size, 1)),
+          _sample_ratio(std::max<uint32_t>(sample_ratio, 1)),
+          _max_samples(std::max<size_t>(max_samples, kNumBuckets)),
+          _bucket_width((_max_samples + kNumBuckets - 1) / kNumBuckets),
+          _tree(2 * _max_samples + 1, 0),
+          _histogram(kNumBuckets, 0) {}
+
+void HitRateCurve::record(uint64_t hash) {
+    // mix the bits, as the sampling takes the low bits of the hash
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    if (hash % _sample_ratio != 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> l(_mutex);
+    _num_sampled += 1;
+    if (_clock + 1 >= _tree.size()) {
+        _compact();
+    }
+    auto [iter, inserted] = _last_access.emplace(hash, _clock);
+    if (!inserted) {
+        const uint32_t last = iter->second;
+        const int64_t distance = _tree_sum(_clock) - _tree_sum(last + 1);
+        DCHECK_GE(distance, 0);
+        const size_t bucket = distance / _bucket_width;
+        if (bucket < kNumBuckets) {
+            _histogram[bucket] += 1;
+        }
+        _tree_add(last, -1);
+        iter->second = _clock;
+    }
+    _tree_add(_clock, 1);
+    _clock++;
+}
+
+double HitRateCurve::hit_ratio(size_t capacity) const {
+    std::lock_guard<std::mutex> l(_mutex);
+    if (_num_sampled == 0) {
+        return 0;
+    }
+    // the capacity in sampled blocks
+    const double blocks = static_cast<double>(capacity) / _block_size / _sample_ratio;
+    double hits = 0;
+    for (size_t i = 0; i < kNumBuckets; i++) {
+        const double begin = static_cast<double>(i * _bucket_width);
+        if (blocks <= begin) {
+            break;
+        }
+        // the accesses of a bucket are taken as evenly distributed over its distances
+        hits += _histogram[i] * std::min(1.0, (blocks - begin) / _bucket_width);
+    }
+    return std::min(1.0, hits / _num_sampled);
+}
+
+void HitRateCurve::decay() {
+    std::lock_guard<std::mutex> l(_mutex);
+    for (auto& count : _histogram) {
+        count /= 2;
+    }
+    _num_sampled /= 2;
+}
+
+double HitRateCurve::num_accesses() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _num_sampled * _sample_ratio;
+}
+
+void HitRateCurve::_compact() {
+    // Renumber the last accesses from zero in their order, and forget the least recently accessed blocks beyond
+    // |_max_samples|, whose next accesses are misses anyway.
+    std::vector<std::pair<uint32_t, uint64_t>> accesses;
+    accesses.reserve(_last_access.size());
+    for (const auto& [hash, time] : _last_access) {
+        accesses.emplace_back(time, hash);
+    }
+    std::sort(accesses.begin(), accesses.end());
+    const size_t num_kept = std::min(accesses.size(), _max_samples);
+    const size_t first = accesses.size() - num_kept;
+
+    _last_access.clear();
+    std::fill(_tree.begin(), _tree.end(), 0);
+    for (size_t i = first; i < accesses.size(); i++) {
+        const uint32_t time = i - first;
+        _last_access.emplace(accesses[i].second, time);
+        _tree_add(time, 1);
+    }
+    _clock = num_kept;
+}
+
+void HitRateCurve::_tree_add(size_t time, int32_t delta) {
+    for (size_t i = time + 1; i < _tree.size(); i += i & (~i + 1)) {
+        _tree[i] += delta;
+    }
+}
+
+int64_t HitRateCurve::_tree_sum(size_t time) const {
+    // the sum over [0, time)
+    int64_t sum = 0;
+    for (size_t i = time; i > 0; i -= i & (~i + 1)) {
+        sum += _tree[i];
+    }
+    return sum;
+}
+
+} // namespace starrocks
@@ -0,0 +1,72 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace starrocks {
+
+// Estimates the hit ratio of an LRU cache of any capacity from its access stream, which is the ghost of the cache.
+// The reuse distance of an access is the number of distinct blocks accessed since the last access of the same
+// block, and the access hits an LRU cache if the cache holds more blocks than that. Only the blocks whose hash falls
+// into 1/|sample_ratio| of the hash space are tracked, and their distances are scaled back by |sample_ratio|, so at
+// most |max_samples| blocks are kept whatever the cache size is.
+class HitRateCurve {
+public:
+    HitRateCurve(size_t block_size, uint32_t sample_ratio, size_t max_samples);
+
+    // Records an access of the block of |hash|.
+    void record(uint64_t hash);
+
+    // The estimated hit ratio in [0, 1] of an LRU cache of |capacity| bytes over the recorded accesses.
+    double hit_ratio(size_t capacity) const;
+
+    // Halves the recorded accesses, so that the curve follows the recent ones.
+    void decay();
+
+    // The number of the recorded accesses, scaled back by the sample ratio.
+    double num_accesses() const;
+
+private:
+    static constexpr size_t kNumBuckets = 1024;
+
+    void _compact();
+    void _tree_add(size_t time, int32_t delta);
+    int64_t _tree_sum(size_t time) const;
+
+    const size_t _block_size;
+    const uint32_t _sample_ratio;
+    const size_t _max_samples;
+    // the number of sampled blocks of the reuse distances of each histogram bucket
+    const size_t _bucket_width;
+
+    mutable std::mutex _mutex;
+    // the logical time of the last access of each sampled block
+    std::unordered_map<uint64_t, uint32_t> _last_access;
+    // A Fenwick tree over the logical time, which is 1 at the time of the last access of each sampled block, so the
+    // number of the blocks accessed after a time is the sum after it.
+    std::vector<int32_t> _tree;
+    uint32_t _clock = 0;
+    // _histogram[i] is the number of the sampled accesses whose reuse distances, in sampled blocks, are in
+    // [i * _bucket_width, (i + 1) * _bucket_width). The accesses of the new blocks or of longer distances are misses
+    // of any capacity, they are counted in _num_sampled only.
+    std::vector<double> _histogram;
+    double _num_sampled = 0;
+};
+
+} // namespace starrocks
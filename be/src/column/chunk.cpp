@@ -94,6 +94,7 @@ void Chunk::reset() {
     }
     _delete_state = DEL_NOT_SATISFIED;
     _extra_data.reset();
+    _selection.reset();
 }
 
 void Chunk::swap_chunk(Chunk& other) {
@@ -103,12 +104,16 @@ void Chunk::swap_chunk(Chunk& other) {
     _slot_id_to_index.swap(other._slot_id_to_index);
     std::swap(_delete_state, other._delete_state);
     _extra_data.swap(other._extra_data);
+    _selection.swap(other._selection);
 }
 
 void Chunk::set_num_rows(size_t count) {
     for (ColumnPtr& c : _columns) {
         c->resize(count);
     }
+    if (_selection != nullptr) {
+        _selection->resize(count, 1);
+    }
 }
 
 void Chunk::update_rows(const Chunk& src, const uint32_t* indexes) {
@@ -267,6 +272,9 @@ std::unique_ptr<Chunk> Chunk::clone_unique() const {
     }
     chunk->_owner_info = _owner_info;
     chunk->_extra_data = std::move(_extra_data);
+    if (_selection != nullptr) {
+        chunk->_selection = std::make_shared<Filter>(*_selection);
+    }
     chunk->check_or_die();
     return chunk;
 }
@@ -289,6 +297,16 @@ void Chunk::rolling_append_selective(Chunk& src, const uint32_t* indexes, uint32
 }
 
 size_t Chunk::filter(const Buffer<uint8_t>& selection, bool force) {
+    if (_selection != nullptr) {
+        DCHECK_EQ(selection.size(), _selection->size());
+        FilterPtr merged = std::move(_selection);
+        const size_t size = std::min(selection.size(), merged->size());
+        uint8_t* data = merged->data();
+        for (size_t i = 0; i < size; i++) {
+            data[i] &= selection[i];
+        }
+        return filter(*merged, force);
+    }
     if (!force && SIMD::count_zero(selection) == 0) {
         return num_rows();
     }
@@ -298,6 +316,14 @@ size_t Chunk::filter(const Buffer<uint8_t>& selection, bool force) {
     return num_rows();
 }
 
+size_t Chunk::compact_selection() {
+    if (_selection == nullptr) {
+        return num_rows();
+    }
+    FilterPtr selection = std::move(_selection);
+    return filter(*selection);
+}
+
 size_t Chunk::filter_range(const Buffer<uint8_t>& selection, size_t from, size_t to) {
     for (auto& column : _columns) {
         column->filter_range(selection, from, to);
@@ -201,6 +201,7 @@ public:
     // Remove rows from this chunk according to the vector |selection|.
     // The n-th row will be removed if selection[n] is zero.
     // The size of |selection| must be equal to the number of rows.
+    // If the chunk has a selection, the rows filtered out by it are removed as well.
     // @param force whether check zero-count of filter, skip the filter procedure if no data to filter
     // @return the number of rows after filter.
     size_t filter(const Buffer<uint8_t>& selection, bool force = false);
@@ -208,6 +209,21 @@ public:
     // Return the number of rows after filter.
     size_t filter_range(const Buffer<uint8_t>& selection, size_t from, size_t to);
 
+    // The selection vector of a chunk filtered lazily by SelectOperator: the n-th row is filtered out if
+    // selection[n] is zero, but the columns still hold it until compact_selection(). num_rows() counts the rows
+    // of the columns. Only the operators returning true from Operator::accept_chunk_selection() see a chunk with
+    // a selection, the pipeline driver compacts it before any other operator.
+    bool has_selection() const { return _selection != nullptr; }
+    const FilterPtr& selection() const { return _selection; }
+    // The size of |selection| must be equal to the number of rows.
+    void set_selection(FilterPtr selection) {
+        DCHECK(selection == nullptr || selection->size() == num_rows());
+        _selection = std::move(selection);
+    }
+    // Remove the rows filtered out by the selection from the columns and clear the selection.
+    // Return the number of rows after compaction.
+    size_t compact_selection();
+
     // Return the data of n-th row.
     // This method is relatively slow and mainly used for unit tests now.
     DatumTuple get(size_t n) const;
@@ -302,6 +318,7 @@ private:
     DelCondSatisfied _delete_state = DEL_NOT_SATISFIED;
     query_cache::owner_info _owner_info;
     ChunkExtraDataPtr _extra_data;
+    FilterPtr _selection;
 };
 
 inline const ColumnPtr& Chunk::get_column_by_name(const std::string& column_name) const {
@@ -63,6 +63,9 @@ Status ColumnAccessPath::init(const std::string& parent_path, const TColumnAcces
     if (column_path.__isset.type_desc) {
         _value_type = TypeDescriptor::from_thrift(column_path.type_desc);
     }
+    if (column_path.__isset.index_keys) {
+        _index_keys = column_path.index_keys;
+    }
 
     for (const auto& child : column_path.children) {
         ColumnAccessPathPtr child_path = std::make_unique<ColumnAccessPath>();
@@ -99,6 +102,7 @@ StatusOr<ColumnAccessPathPtr> ColumnAccessPath::convert_by_index(const Field* fi
     path->_absolute_path = this->_absolute_path;
     path->_column_index = index;
     path->_value_type = this->_value_type;
+    path->_index_keys = this->_index_keys;
 
     // json field has none sub-fields, and we only convert the root path, child path find reader by name
     if (field->type()->type() == LogicalType::TYPE_JSON) {
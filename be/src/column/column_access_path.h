@@ -71,6 +71,12 @@ public:
 
     bool is_from_predicate() const { return _from_predicate; }
 
+    // the keys of the map entries accessed by an INDEX path, e.g. 'a' of m['a'], empty if they are unknown
+    const std::vector<std::string>& index_keys() const { return _index_keys; }
+
+    // for test
+    void set_index_keys(std::vector<std::string> index_keys) { _index_keys = std::move(index_keys); }
+
     const std::string& absolute_path() const { return _absolute_path; }
 
     // flat json use this to get the type of the path
@@ -105,6 +111,8 @@ private:
     // the data type of the subfield
     TypeDescriptor _value_type;
 
+    std::vector<std::string> _index_keys;
+
     std::vector<std::unique_ptr<ColumnAccessPath>> _children;
 };
 
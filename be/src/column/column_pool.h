@@ -99,6 +99,9 @@ struct ColumnPoolInfo {
     size_t local_cnt = 0;
     size_t central_free_items = 0;
     size_t central_free_bytes = 0;
+    // the number of get_column() served by the pool and by a new allocation.
+    int64_t hit_count = 0;
+    int64_t miss_count = 0;
 };
 
 template <typename T>
@@ -211,8 +214,13 @@ public:
             return nullptr;
         }
         T* ptr = lp->get_object();
-        if (ptr == nullptr && AllocOnEmpty) {
-            ptr = new (std::nothrow) T();
+        if (ptr != nullptr) {
+            _hit_count << 1;
+        } else {
+            _miss_count << 1;
+            if (AllocOnEmpty) {
+                ptr = new (std::nothrow) T();
+            }
         }
         return ptr;
     }
@@ -274,6 +282,8 @@ public:
     ColumnPoolInfo describe_column_pool() {
         ColumnPoolInfo info;
         info.local_cnt = _nlocal.load(std::memory_order_relaxed);
+        info.hit_count = _hit_count.get_value();
+        info.miss_count = _miss_count.get_value();
         if (_free_blocks.empty()) {
             return info;
         }
@@ -379,6 +389,10 @@ private:
     mutable std::mutex _free_blocks_lock;
     std::vector<DynamicFreeBlock*> _free_blocks;
     int64_t _first_push_time = 0;
+
+    // bvar::Adder keeps the counts per thread, so counting does not contend on a shared cache line.
+    bvar::Adder<int64_t> _hit_count;
+    bvar::Adder<int64_t> _miss_count;
 };
 
 using ColumnPoolList =
@@ -88,14 +88,14 @@ void DecimalV3Column<T>::crc32_hash(uint32_t* hash, uint32_t from, uint32_t to)
                 auto& decimal_v2_value = (DecimalV2Value&)(data[i]);
                 int64_t int_val = decimal_v2_value.int_value();
                 int32_t frac_val = decimal_v2_value.frac_value();
-                uint32_t seed = HashUtil::zlib_crc_hash(&int_val, sizeof(int_val), hash[i]);
-                hash[i] = HashUtil::zlib_crc_hash(&frac_val, sizeof(frac_val), seed);
+                uint32_t seed = HashUtil::zlib_crc_hash_fixed<sizeof(int_val)>(&int_val, hash[i]);
+                hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(frac_val)>(&frac_val, seed);
             }
             return;
         }
     }
     for (uint32_t i = from; i < to; ++i) {
-        hash[i] = HashUtil::zlib_crc_hash(&data[i], sizeof(T), hash[i]);
+        hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(T)>(&data[i], hash[i]);
     }
 }
 
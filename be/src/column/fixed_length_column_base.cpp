@@ -228,17 +228,23 @@ void FixedLengthColumnBase<T>::fnv_hash(uint32_t* hash, uint32_t from, uint32_t
 // Must same with RawValue::zlib_crc32
 template <typename T>
 void FixedLengthColumnBase<T>::crc32_hash(uint32_t* hash, uint32_t from, uint32_t to) const {
-    for (uint32_t i = from; i < to; ++i) {
-        if constexpr (IsDate<T> || IsTimestamp<T>) {
-            std::string str = _data[i].to_string();
-            hash[i] = HashUtil::zlib_crc_hash(str.data(), static_cast<int32_t>(str.size()), hash[i]);
-        } else if constexpr (IsDecimal<T>) {
+    if constexpr (IsDate<T> || IsTimestamp<T>) {
+        // hash the same bytes as to_string(), but formatted into a buffer rather than a string of each value
+        char str[T::max_string_length()];
+        for (uint32_t i = from; i < to; ++i) {
+            int len = _data[i].to_string(str, sizeof(str));
+            hash[i] = HashUtil::zlib_crc_hash(str, len, hash[i]);
+        }
+    } else if constexpr (IsDecimal<T>) {
+        for (uint32_t i = from; i < to; ++i) {
             int64_t int_val = _data[i].int_value();
             int32_t frac_val = _data[i].frac_value();
-            uint32_t seed = HashUtil::zlib_crc_hash(&int_val, sizeof(int_val), hash[i]);
-            hash[i] = HashUtil::zlib_crc_hash(&frac_val, sizeof(frac_val), seed);
-        } else {
-            hash[i] = HashUtil::zlib_crc_hash(&_data[i], sizeof(ValueType), hash[i]);
+            uint32_t seed = HashUtil::zlib_crc_hash_fixed<sizeof(int_val)>(&int_val, hash[i]);
+            hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(frac_val)>(&frac_val, seed);
+        }
+    } else {
+        for (uint32_t i = from; i < to; ++i) {
+            hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(ValueType)>(&_data[i], hash[i]);
         }
     }
 }
@@ -0,0 +1,109 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "util/slice.h"
+
+namespace starrocks {
+
+// GermanString is a 16-byte view of a string: the length, the first 4 bytes, and either the remaining bytes
+// inline if the string has at most 12 bytes, or a pointer to the whole string otherwise.
+// Most comparisons of short strings are decided by the length and the prefix without dereferencing, and the
+// strings of at most 12 bytes never dereference. It has the same size as a Slice, so the kernels inlining
+// the values of a BinaryColumn (e.g. the sort permutations) can use it instead of a Slice at no memory cost.
+// Like a Slice, a long GermanString does not own its data and is only valid as long as the column it views.
+class GermanString {
+public:
+    static constexpr uint32_t INLINE_SIZE = 12;
+    static constexpr uint32_t PREFIX_SIZE = 4;
+
+    GermanString() : _size(0) { memset(_inlined, 0, INLINE_SIZE); }
+
+    // Implicit, so that a container of Slice can fill a container of GermanString.
+    GermanString(const Slice& slice) { // NOLINT
+        _size = static_cast<uint32_t>(slice.size);
+        if (_size <= INLINE_SIZE) {
+            memset(_inlined, 0, INLINE_SIZE);
+            if (_size > 0) {
+                memcpy(_inlined, slice.data, _size);
+            }
+        } else {
+            memcpy(_prefix, slice.data, PREFIX_SIZE);
+            _long.ptr = slice.data;
+        }
+    }
+
+    uint32_t size() const { return _size; }
+    bool is_inline() const { return _size <= INLINE_SIZE; }
+    const char* data() const { return is_inline() ? _inlined : _long.ptr; }
+
+    Slice to_slice() const { return {data(), _size}; }
+
+    // The same order as Slice::compare, normalized to -1, 0 and 1.
+    int compare(const GermanString& rhs) const {
+        uint32_t lhs_prefix = _prefix_as_uint();
+        uint32_t rhs_prefix = rhs._prefix_as_uint();
+        if (lhs_prefix != rhs_prefix) {
+            // The shorter strings are padded with zero, the smallest byte, so the prefixes order as the strings.
+            return __builtin_bswap32(lhs_prefix) < __builtin_bswap32(rhs_prefix) ? -1 : 1;
+        }
+        const uint32_t min_size = std::min(_size, rhs._size);
+        if (min_size > PREFIX_SIZE) {
+            int r = memcmp(data() + PREFIX_SIZE, rhs.data() + PREFIX_SIZE, min_size - PREFIX_SIZE);
+            if (r != 0) {
+                return r < 0 ? -1 : 1;
+            }
+        }
+        return _size == rhs._size ? 0 : (_size < rhs._size ? -1 : 1);
+    }
+
+    bool operator==(const GermanString& rhs) const {
+        if (_size != rhs._size || _prefix_as_uint() != rhs._prefix_as_uint()) {
+            return false;
+        }
+        if (is_inline()) {
+            return memcmp(_inlined + PREFIX_SIZE, rhs._inlined + PREFIX_SIZE, INLINE_SIZE - PREFIX_SIZE) == 0;
+        }
+        return memcmp(_long.ptr + PREFIX_SIZE, rhs._long.ptr + PREFIX_SIZE, _size - PREFIX_SIZE) == 0;
+    }
+    bool operator!=(const GermanString& rhs) const { return !(*this == rhs); }
+    bool operator<(const GermanString& rhs) const { return compare(rhs) < 0; }
+
+private:
+    uint32_t _prefix_as_uint() const {
+        uint32_t prefix;
+        memcpy(&prefix, _prefix, PREFIX_SIZE);
+        return prefix;
+    }
+
+    uint32_t _size;
+    union {
+        // _prefix aliases the first 4 bytes of _inlined
+        char _prefix[PREFIX_SIZE];
+        char _inlined[INLINE_SIZE];
+        struct {
+            char prefix[PREFIX_SIZE];
+            const char* ptr;
+        } __attribute__((packed)) _long;
+    };
+};
+
+static_assert(sizeof(GermanString) == 16);
+
+} // namespace starrocks
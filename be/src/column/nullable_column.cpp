@@ -347,7 +347,7 @@ void NullableColumn::fnv_hash(uint32_t* hash, uint32_t from, uint32_t to) const
         return;
     }
 
-    auto null_data = _null_column->get_data();
+    const auto& null_data = _null_column->get_data();
     uint32_t value = 0x9e3779b9;
     while (from < to) {
         uint32_t new_from = from + 1;
@@ -372,7 +372,7 @@ void NullableColumn::crc32_hash(uint32_t* hash, uint32_t from, uint32_t to) cons
         return;
     }
 
-    auto null_data = _null_column->get_data();
+    const auto& null_data = _null_column->get_data();
     // NULL is treat as 0 when crc32 hash for data loading
     static const int INT_VALUE = 0;
     while (from < to) {
@@ -382,7 +382,7 @@ void NullableColumn::crc32_hash(uint32_t* hash, uint32_t from, uint32_t to) cons
         }
         if (null_data[from]) {
             for (uint32_t i = from; i < new_from; ++i) {
-                hash[i] = HashUtil::zlib_crc_hash(&INT_VALUE, 4, hash[i]);
+                hash[i] = HashUtil::zlib_crc_hash_fixed<sizeof(INT_VALUE)>(&INT_VALUE, hash[i]);
             }
         } else {
             _data_column->crc32_hash(hash, from, new_from);
@@ -95,6 +95,9 @@ CONF_Int32(push_worker_count_high_priority, "3");
 
 // The count of thread to publish version per transaction
 CONF_mInt32(transaction_publish_version_worker_count, "0");
+// Whether the thread pools which publish versions queue their tasks into per-worker queues and let the idle workers
+// steal them, instead of one queue shared by all the workers, which is contended by many small publish tasks.
+CONF_Bool(enable_publish_version_work_stealing, "false");
 
 // The count of thread to apply rowset in primary key table
 // 0 means apply worker count is equal to cpu core count
@@ -143,6 +146,8 @@ CONF_mInt32(max_download_speed_kbps, "50000");
 CONF_mInt32(download_low_speed_limit_kbps, "50");
 // The download low speed time(seconds).
 CONF_mInt32(download_low_speed_time, "300");
+// The max number of the files of a clone task downloaded at once, they share max_download_speed_kbps.
+CONF_mInt32(clone_download_parallelism, "4");
 // The sleep time for one second.
 CONF_Int32(sleep_one_second, "1");
 // The sleep time for five seconds.
@@ -195,6 +200,12 @@ CONF_Bool(compress_rowbatches, "true");
 // Compress ratio when shuffle row_batches in network, not in storage engine.
 // If ratio is less than this value, use uncompressed data instead.
 CONF_mDouble(rpc_compress_ratio_threshold, "1.1");
+
+// The number of threads which compress a block with ZSTD together, when the block is at least
+// zstd_multithread_min_block_bytes large, e.g. the blocks of spill or the large pages of lake segments. 0 means
+// compressing every block by the calling thread only. The blocks are compatible with the ones compressed by one thread.
+CONF_mInt32(zstd_compress_workers, "0");
+CONF_mInt64(zstd_multithread_min_block_bytes, "4194304");
 // Serialize and deserialize each returned row batch.
 CONF_Bool(serialize_batch, "false");
 // Interval between profile reports; in seconds.
@@ -227,14 +238,23 @@ CONF_mInt32(max_pushdown_conditions_per_column, "1024");
 CONF_mInt32(exchg_node_buffer_size_bytes, "10485760");
 // The block_size every block allocate for sorter.
 CONF_Int32(sorter_block_size, "8388608");
+// Whether the sorter inlines the strings into its permutation as 16-byte German strings, which hold a 4-byte prefix
+// and the strings of at most 12 bytes inline, instead of slices, so most comparisons do not dereference the strings.
+CONF_mBool(enable_german_string_sort, "true");
 
 CONF_mInt64(column_dictionary_key_ratio_threshold, "0");
 CONF_mInt64(column_dictionary_key_size_threshold, "0");
 // The memory_limitation_per_thread_for_schema_change unit GB.
 CONF_mInt32(memory_limitation_per_thread_for_schema_change, "2");
 CONF_mDouble(memory_ratio_for_sorting_schema_change, "0.8");
+// The max number of rowsets of a tablet converted at once by a direct schema change which evaluates no expression.
+CONF_mInt32(schema_change_rowset_parallelism, "4");
 
 CONF_mInt32(update_cache_expire_sec, "360");
+// The capacity in bytes of the cache of the rows of primary key tablets read by the point queries of the
+// short circuit path. 0 disables the cache. The cache is created at the first point query, so changing
+// it takes effect after a restart.
+CONF_Int64(pk_row_cache_capacity, "0");
 CONF_mInt32(file_descriptor_cache_clean_interval, "3600");
 CONF_mInt32(disk_stat_monitor_interval, "5");
 CONF_mInt32(profile_report_interval, "30");
@@ -349,6 +369,10 @@ CONF_mBool(enable_rowset_verify, "false");
 // the columns will be divided into groups for vertical compaction.
 CONF_Int64(vertical_compaction_max_columns_per_group, "5");
 
+// The number of chunks a vertical compaction merges ahead of the writer, in a task of the compaction read-ahead
+// pool, so that merging the input of a column group overlaps with encoding its output. 0 disables the read-ahead.
+CONF_mInt32(vertical_compaction_read_ahead_chunks, "2");
+
 CONF_Bool(enable_event_based_compaction_framework, "true");
 
 CONF_Bool(enable_size_tiered_compaction_strategy, "true");
@@ -358,6 +382,14 @@ CONF_mInt64(size_tiered_level_multiple, "5");
 CONF_mInt64(size_tiered_level_multiple_dupkey, "10");
 CONF_mInt64(size_tiered_level_num, "7");
 
+// Raise the compaction priority of the tablets whose recent queries read many overlapping segments. The score of a
+// candidate is multiplied by (1 + compaction_read_amp_weight * log2(1 + read amplification score)). The read
+// amplification score of a tablet sums, over its recent queries, the rowsets read beyond the first one and the
+// rows merged away in units of vector_chunk_size, halved every compaction_read_amp_half_life_seconds.
+// 0 disables the feedback from the queries.
+CONF_mDouble(compaction_read_amp_weight, "0.1");
+CONF_mInt64(compaction_read_amp_half_life_seconds, "600");
+
 CONF_Bool(enable_check_string_lengths, "true");
 
 // Max row source mask memory bytes, default is 200M.
@@ -404,6 +436,31 @@ CONF_Double(dictionary_encoding_ratio_for_non_string_column, "0");
 // The minimum chunk size for dictionary encoding speculation
 CONF_Int32(dictionary_speculate_min_chunk_size, "10000");
 
+// Whether the new segments encode the FLOAT and DOUBLE columns by ALP, which stores the decimal values as
+// frame-of-reference coded integers, instead of BIT_SHUFFLE. Ignored if dictionary encoding is enabled for them.
+CONF_mBool(enable_alp_float_encoding, "false");
+// Whether the new segments encode the TINYINT, SMALLINT, INT, BIGINT, DATE and DATETIME columns by delta or
+// delta-of-delta bit packing, which suits the sorted or monotonic values like timestamps and auto-increment ids,
+// instead of BIT_SHUFFLE. Ignored if dictionary encoding is enabled for them.
+CONF_mBool(enable_delta_integer_encoding, "false");
+// Whether the new segments choose the encoding of each data page of the fixed-length columns not using dictionary
+// encoding, among BIT_SHUFFLE, FOR_ENCODING, DELTA_ENCODING and ALP_ENCODING, by trial-encoding a sample of the
+// page. It suits the tables whose data vary a lot across the pages. The encoding of a page is recorded in its
+// footer if it differs from the encoding of the column.
+CONF_mBool(enable_adaptive_page_encoding, "false");
+// The number of leading values of a page trial-encoded with each candidate encoding.
+CONF_mInt32(adaptive_page_encoding_sample_size, "1024");
+// The fraction of space a page encoding has to save against the encoding of the column to be chosen.
+CONF_mDouble(adaptive_page_encoding_min_space_saving, "0.1");
+// The number of buckets of the equi-depth histogram stored in the segment zone map of each column, built from a
+// sample of the values when the segment is written and exported by the meta scan for the optimizer to estimate
+// the selectivity of range predicates. 0 disables the histograms.
+CONF_mInt32(segment_zone_map_histogram_buckets, "0");
+// Whether the new segments encode the VARCHAR columns speculated not to use dictionary encoding by FSST, which
+// compresses each string with a symbol table of its page, instead of PLAIN_ENCODING. The `=` and `!=` predicates
+// are evaluated on the compressed strings.
+CONF_mBool(enable_fsst_string_encoding, "false");
+
 // Whether to use special thread pool for streaming load to avoid deadlock for
 // concurrent streaming loads. The maximum number of threads and queue size are
 // set INT32_MAX which indicate there is no limit for the thread pool. Note you
@@ -411,6 +468,11 @@ CONF_Int32(dictionary_speculate_min_chunk_size, "10000");
 CONF_mBool(enable_streaming_load_thread_pool, "true");
 CONF_Int32(streaming_load_thread_pool_num_min, "0");
 CONF_Int32(streaming_load_thread_pool_idle_time_ms, "2000");
+// Whether to decompress the compressed csv bodies of the stream loads by a task of the streaming load thread pool,
+// ahead of the scanner parsing them, instead of in the scanner. The task buffers at most
+// stream_load_pipelined_decompression_buffer_bytes of the decompressed body.
+CONF_mBool(enable_stream_load_pipelined_decompression, "false");
+CONF_mInt64(stream_load_pipelined_decompression_buffer_bytes, "8388608");
 
 // The maximum amount of data that can be processed by a stream load
 CONF_mInt64(streaming_load_max_mb, "102400");
@@ -502,6 +564,12 @@ CONF_Bool(mmap_buffers, "false");
 // Sleep time in seconds between memory maintenance iterations
 CONF_mInt64(memory_maintenance_sleep_time_s, "10");
 
+// Whether to allocate the storage cache pages, the metadata and the load memory from their own jemalloc arenas,
+// so that they do not fragment the arenas of the query execution. Only read at startup.
+CONF_Bool(enable_jemalloc_arena_per_memory_class, "false");
+// The memory maintenance purges a dedicated jemalloc arena when its dirty pages exceed this size.
+CONF_mInt64(jemalloc_arena_purge_dirty_bytes, "268435456");
+
 // Aligement
 CONF_Int32(memory_max_alignment, "16");
 
@@ -556,6 +624,12 @@ CONF_mInt32(max_consumer_num_per_group, "3");
 // Max pulsar consumer num in one data consumer group, for routine load.
 CONF_mInt32(max_pulsar_consumer_num_per_group, "10");
 
+// The bytes of the consumed messages buffered in the pipe between the consumers and the scanner of a routine load
+// task. The consumers block when it is full, so a larger buffer absorbs the bursts of the partitions.
+CONF_mInt64(routine_load_pipe_max_buffered_bytes, "1048576");
+// The number of the messages buffered between the consumers of a data consumer group and the pipe.
+CONF_mInt32(routine_load_consumer_group_queue_size, "500");
+
 // kafka request timeout
 CONF_Int32(routine_load_kafka_timeout_second, "10");
 
@@ -617,6 +691,11 @@ CONF_mInt32(flush_thread_num_per_store, "2");
 // Default value is cpu cores * 2
 CONF_mInt32(lake_flush_thread_num_per_store, "0");
 
+// The number of the segments in flight from the primary replica to each secondary replica in the replicated storage
+// mode. The primary sends the next segment without waiting for the secondary to write the previous ones, and only
+// waits for all of them before sending the eos. 1 waits for each segment before sending the next one.
+CONF_Int64(segment_replicate_max_inflight_requests, "1");
+
 // Config for tablet meta checkpoint.
 CONF_mInt32(tablet_meta_checkpoint_min_new_rowsets_num, "10");
 CONF_mInt32(tablet_meta_checkpoint_min_interval_secs, "600");
@@ -651,6 +730,10 @@ CONF_Int32(txn_shard_size, "1024");
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_load_tablet_failure, "false");
 
+// The number of threads of each data dir to parse the tablet metas and create the tablets at startup,
+// 1 to load the tablets one by one in the thread scanning the metas.
+CONF_Int32(load_tablet_threads_per_data_dir, "4");
+
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 
@@ -694,6 +777,10 @@ CONF_mInt16(null_encoding, "0");
 // Do pre-aggregate if effect greater than the factor, factor range:[1-100].
 CONF_Int16(pre_aggregate_factor, "80");
 
+// Skip the merge and the aggregation of a unique or aggregate key tablet in a query when the segment zone maps of
+// the first key column prove that no two segments share a key, and read the segments one after another instead.
+CONF_mBool(enable_disjoint_keys_merge_elimination, "true");
+
 #ifdef __x86_64__
 // Enable genearate minidump for crash.
 CONF_Bool(sys_minidump_enable, "false");
@@ -743,10 +830,34 @@ CONF_Int64(pipeline_sink_io_thread_pool_queue_size, "102400");
 CONF_Int64(pipeline_sink_buffer_size, "64");
 // The degree of parallelism of brpc.
 CONF_Int64(pipeline_sink_brpc_dop, "64");
+// Limit the bytes in flight to each exchange receiver by the buffer credit advertised in its responses,
+// instead of only by pipeline_sink_brpc_dop, so slow receivers are not flooded and fast ones are kept busy.
+CONF_mBool(enable_exchange_sink_credit_flow_control, "false");
 // Used to reject coming fragment instances, when the number of running drivers
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
 CONF_mBool(pipeline_print_profile, "false");
+// Whether a pipeline driver shrinks the chunks of its scan and chunk accumulate operators for wide rows, so that
+// a chunk holds about pipeline_adaptive_chunk_target_bytes. The chunks never exceed the chunk_size of the query.
+CONF_mBool(enable_pipeline_adaptive_chunk_size, "false");
+CONF_mInt64(pipeline_adaptive_chunk_target_bytes, "1048576");
+// Whether the drivers after an adaptive DOP point, in the passthrough state, take the chunks backed up for the other
+// drivers when they have nothing to do, and keep doing so after their own input is finished.
+CONF_mBool(enable_adaptive_dop_chunk_stealing, "true");
+// Only one of every pipeline_operator_timer_sample_interval push_chunk/pull_chunk calls of a driver is timed, and
+// counted as this many calls in PushTotalTime/PullTotalTime of the operators. 1 times every call.
+CONF_mInt32(pipeline_operator_timer_sample_interval, "1");
+// Whether the cpu time of the pipeline drivers is attributed to queries and operators by sampling the operators they
+// are running every query_cpu_sampler_interval_ms. The samples of the last query_cpu_sampler_retention_minutes
+// minutes are shown by /api/query_cpu_profile.
+CONF_mBool(enable_query_cpu_sampler, "true");
+CONF_mInt32(query_cpu_sampler_interval_ms, "10");
+CONF_mInt32(query_cpu_sampler_retention_minutes, "10");
+// Whether SelectOperator keeps the rows it filters out in the chunk with a selection vector instead of compacting
+// the columns, when at least lazy_chunk_selection_min_density of the rows pass. The chunk is compacted before the
+// first operator that does not honor the selection, e.g. an exchange or a hash join.
+CONF_mBool(enable_lazy_chunk_selection, "false");
+CONF_mDouble(lazy_chunk_selection_min_density, "0.5");
 
 // The arguments of multilevel feedback pipeline_driver_queue. It prioritizes small queries over larger ones,
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
@@ -761,11 +872,38 @@ CONF_Int64(pipeline_scan_queue_mode, "0");
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_scan_queue_level_time_slice_base_ns, "100000000");
 CONF_Double(pipeline_scan_queue_ratio_of_adjacent_queue, "1.5");
+// Whether the driver queue and the scan task queue always pick the short query workgroup first when it has ready
+// drivers or tasks, and preempt the running drivers and tasks of the other workgroups at their next yield check.
+CONF_mBool(enable_short_query_workgroup_strict_priority, "false");
+// The drivers of non short query workgroups that have run on core for more than
+// pipeline_big_driver_cpu_time_threshold_ms yield every pipeline_big_driver_yield_time_slice_ms at most, instead of
+// every 100ms, so that the big queries hold the executor threads in shorter slices. <= 0 disables it.
+CONF_mInt64(pipeline_big_driver_cpu_time_threshold_ms, "1000");
+CONF_mInt64(pipeline_big_driver_yield_time_slice_ms, "20");
+// BE side admission of the queries. The drivers of a new query are parked in the poller for at most
+// query_admission_max_wait_ms, until its workgroup has less than query_admission_max_ready_drivers_per_workgroup ready
+// drivers and enough free memory for the query_mem_limit of the query. The query starts anyway when the wait expires,
+// so the queries arriving in a burst are started one after another instead of all at once. 0 disables the admission.
+CONF_mInt64(query_admission_max_wait_ms, "0");
+CONF_mInt64(query_admission_max_ready_drivers_per_workgroup, "1024");
+// The colocate execution groups run the buckets with the most estimated rows first, and start a pending bucket only
+// while the estimated rows of the running buckets stay within this budget, so that several small buckets run at once
+// but a large one runs alone, which bounds the peak memory of the colocate aggregations and joins. A bucket always
+// starts when no other bucket is running. The rows are estimated by the row counts of the tablets of each bucket.
+// 0 disables it, and the group runs at most pipeline_dop buckets at once in the order of the bucket sequences.
+CONF_mInt64(colocate_group_running_bucket_rows_budget, "0");
 
 CONF_Int32(pipeline_analytic_max_buffer_size, "128");
 CONF_Int32(pipeline_analytic_removable_chunk_num, "128");
 CONF_Bool(pipeline_analytic_enable_streaming_process, "true");
 CONF_Bool(pipeline_analytic_enable_removable_cumulative_process, "true");
+// Whether to evaluate min/max over a sliding ROWS frame, e.g. `ROWS BETWEEN N PRECEDING AND CURRENT ROW`, by the
+// monotonic candidates of the frame, instead of aggregating the whole frame for each row.
+CONF_Bool(pipeline_analytic_enable_sliding_extreme_process, "true");
+// The local partition topn of ROW_NUMBER keeps the top rows of each partition in a bounded buffer and drops the rows
+// that can't enter them as they arrive, instead of buffering the partitions for a sorter each, if offset + limit is
+// not larger than this. 0 disables it.
+CONF_mInt64(local_partition_topn_heap_max_limit, "64");
 CONF_Int32(pipline_limit_max_delivery, "4096");
 /// For parallel scan on the single tablet.
 // These three configs are used to calculate the minimum number of rows picked up from a segment at one time.
@@ -779,6 +917,10 @@ CONF_mInt64(tablet_internal_parallel_max_splitted_scan_bytes, "536870912");
 // Only when scan_dop is not less than min_scan_dop, this table can use tablet internal parallel,
 // where scan_dop = estimated_scan_rows / splitted_scan_rows.
 CONF_mInt64(tablet_internal_parallel_min_scan_dop, "4");
+// The splits of tablet internal parallel start with up to splitted_scan_rows * ratio rows, and shrink to
+// splitted_scan_rows as the rest rows of the scan decrease, so that the scan operators finish at about the same time
+// with fewer splits. <= 1 means that all the splits have splitted_scan_rows rows.
+CONF_mInt64(tablet_internal_parallel_adaptive_split_max_ratio, "1");
 
 // Only the num rows of lake tablet less than lake_tablet_rows_splitted_ratio * splitted_scan_rows, than the lake tablet can be splitted.
 CONF_mDouble(lake_tablet_rows_splitted_ratio, "1.5");
@@ -847,6 +989,12 @@ CONF_Int32(orc_loading_buffer_size, "8388608");
 CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
 CONF_Bool(parquet_page_index_enable, "true");
+// Whether the scanners of a query share the iceberg delete files they read, so a delete file is read once per query
+// instead of once per scan range.
+CONF_mBool(iceberg_delete_file_cache_enable, "true");
+// The runs of at least this many consecutive rows deleted by iceberg position deletes are removed from the row ranges
+// read by the parquet reader, so they are not decoded at all.
+CONF_mInt32(parquet_skip_deleted_rows_min_run, "64");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
@@ -869,6 +1017,15 @@ CONF_Int32(hdfs_client_hedged_read_threadpool_size, "128");
 CONF_Int32(hdfs_client_hedged_read_threshold_millis, "2500");
 CONF_Int32(hdfs_client_max_cache_size, "64");
 CONF_Int32(hdfs_client_io_read_retry, "0");
+// Keep the read-only handles of the HDFS files in a cache after they are read, keyed by the path and the modification
+// time of the file, so the next scan range of a file skips opening it from the NameNode. Only the readers which know
+// the modification time of the file, e.g. HdfsScanner, use the cache.
+CONF_mBool(hdfs_client_enable_file_handle_cache, "false");
+CONF_mInt32(hdfs_client_file_handle_cache_capacity, "1024");
+// dfs.client.read.shortcircuit, reading the blocks on the local DataNode from the local disk directly, which needs
+// dfs.domain.socket.path to be the domain socket of the DataNode.
+CONF_Bool(hdfs_client_enable_short_circuit_read, "false");
+CONF_String(hdfs_client_domain_socket_path, "");
 
 // Enable output trace logs in aws-sdk-cpp for diagnosis purpose.
 // Once logging is enabled in your application, the SDK will generate log files in your current working directory
@@ -889,8 +1046,20 @@ CONF_mBool(aws_sdk_enable_compliant_rfc3986_encoding, "false");
 CONF_mInt64(experimental_s3_max_single_part_size, "16777216");
 // default: 16MB
 CONF_mInt64(experimental_s3_min_upload_part_size, "16777216");
+// The max number of parts a S3 output stream uploads at the same time while it keeps buffering the next part,
+// so its memory is bounded by about (1 + this) * experimental_s3_min_upload_part_size.
+CONF_mInt32(experimental_s3_max_inflight_upload_parts, "4");
 
 CONF_Int64(max_load_dop, "16");
+// The number of the in-flight add chunk rpcs of each node channel of a load, if the load does not set load_dop.
+CONF_mInt64(tablet_sink_default_parallel_requests, "1");
+// A node channel of the tablet sink coalesces the rows of all the tablets on its node into one request until it has
+// at least this many bytes, besides the chunk_size rows, so that high partition count loads send fewer and larger
+// add chunk rpcs. 0 sends a request every chunk_size rows.
+CONF_mInt64(tablet_sink_node_channel_request_min_bytes, "0");
+// The encode level of the chunks sent by the tablet sink, same as the session variable transmission_encode_level.
+// The receivers decode the chunks by the encode levels in them. It must be 0 until all the BEs are upgraded.
+CONF_mInt32(load_transmission_encode_level, "0");
 
 CONF_Bool(enable_load_colocate_mv, "true");
 
@@ -906,6 +1075,19 @@ CONF_Int64(send_rpc_runtime_filter_timeout_ms, "1000");
 // if runtime filter size is larger than send_runtime_filter_via_http_rpc_min_size, be will transmit runtime filter via http protocol.
 // this is a default value, maybe changed by global_runtime_filter_rpc_http_min_size in session variable.
 CONF_Int64(send_runtime_filter_via_http_rpc_min_size, "67108864");
+// The global runtime filters larger than runtime_filter_broadcast_bounded_fanout_min_bytes are broadcast along a
+// tree in which every node sends at most runtime_filter_broadcast_max_fanout copies, so the merge node does not send
+// log2(n) copies of a large filter by itself. Smaller filters are broadcast in halves with the least depth.
+// runtime_filter_broadcast_max_fanout <= 0 means disabled.
+CONF_mInt64(runtime_filter_broadcast_max_fanout, "2");
+CONF_mInt64(runtime_filter_broadcast_bounded_fanout_min_bytes, "4194304");
+// A local runtime filter on an integer key uses an exact bitset over [min, max] instead of the bloom filter
+// if the range has at most row_count * runtime_filter_bitset_max_bits_per_row values, 0 means disabled.
+// The default keeps the bitset no larger than the bloom filter of the same rows.
+CONF_mInt64(runtime_filter_bitset_max_bits_per_row, "8");
+// A local runtime filter with an exact bitset of at most this many values is pushed down to the storage as an IN
+// predicate, which prunes the pages by zone maps and bitmap indexes. 0 means disabled.
+CONF_mInt64(runtime_filter_in_pushdown_max_values, "1024");
 
 CONF_Int64(rpc_connect_timeout_ms, "30000");
 
@@ -975,10 +1157,21 @@ CONF_mInt64(experimental_lake_wait_per_delete_ms, "0");
 CONF_mBool(experimental_lake_ignore_pk_consistency_check, "false");
 CONF_mInt64(lake_publish_version_slow_log_ms, "1000");
 CONF_mBool(lake_enable_publish_version_trace_log, "false");
+// A publish request of at least `lake_publish_version_prefetch_min_tablets` tablets reads the base metadata and
+// txn logs of all its tablets ahead of the publish tasks, with up to `lake_publish_version_prefetch_thread_num`
+// reads in flight. Set `lake_publish_version_prefetch_min_tablets` to 0 to disable it.
+CONF_mInt32(lake_publish_version_prefetch_min_tablets, "16");
+CONF_Int32(lake_publish_version_prefetch_thread_num, "64");
 CONF_mString(lake_vacuum_retry_pattern, "*request rate*");
 CONF_mInt64(lake_vacuum_retry_max_attempts, "5");
 CONF_mInt64(lake_vacuum_retry_min_delay_ms, "100");
 CONF_mInt64(lake_max_garbage_version_distance, "100");
+// Write the metadata of a lake tablet as a delta of the last full metadata (the checkpoint) instead of a full copy,
+// and write a new checkpoint every `lake_tablet_metadata_checkpoint_interval` versions. Readers rebuild the full
+// metadata from the delta and the checkpoint, which usually stays in the metacache.
+// BEs of old versions cannot read the delta files, do not enable it before all BEs are upgraded.
+CONF_mBool(lake_enable_incremental_tablet_metadata, "false");
+CONF_mInt64(lake_tablet_metadata_checkpoint_interval, "10");
 CONF_mBool(enable_primary_key_recover, "false");
 CONF_mBool(lake_enable_compaction_async_write, "false");
 CONF_mInt64(lake_pk_compaction_max_input_rowsets, "1000");
@@ -988,6 +1181,12 @@ CONF_mInt32(lake_pk_preload_memory_limit_percent, "30");
 CONF_mInt32(lake_pk_index_sst_min_compaction_versions, "2");
 CONF_mInt32(lake_pk_index_sst_max_compaction_bytes, /*1GB*/ "1073741824");
 CONF_Int32(lake_pk_index_block_cache_limit_percent, "10");
+// A pk index major compaction splits the key space of its input sstables into at most
+// `lake_pk_index_sst_merge_dop` ranges of at least `lake_pk_index_sst_merge_min_range_bytes` input each, and merges
+// the ranges in parallel into one output sstable per range.
+CONF_mInt32(lake_pk_index_sst_merge_dop, "4");
+CONF_mInt64(lake_pk_index_sst_merge_min_range_bytes, /*64MB*/ "67108864");
+CONF_Int32(lake_pk_index_sst_merge_thread_num, "4");
 
 CONF_mBool(dependency_librdkafka_debug_enable, "false");
 
@@ -1032,6 +1231,27 @@ CONF_Int64(spill_max_log_block_container_bytes, "10737418240"); // 10GB
 // be the same with storage path. Spill will return with error when used size has exceeded
 // the limit.
 CONF_mDouble(spill_max_dir_bytes_ratio, "0.8"); // 80%
+// The number of chunks each spill input stream reads ahead during restore. A larger value lets the restore
+// keep up with the disk bandwidth at the cost of memory, which is about this number of chunks per spilled
+// block group, or per block for the ordered restore.
+CONF_mInt32(spill_restore_prefetch_chunks, "2");
+// When spilling to both local disks and remote storage, the blocks of the partitions restored last by a
+// partitioned spiller (the last 1 - spill_local_hot_partition_ratio of them) are written to remote storage
+// once the local spill dirs are used more than spill_local_cold_block_max_usage_ratio, so that the local
+// capacity is kept for the partitions restored first.
+CONF_mDouble(spill_local_hot_partition_ratio, "0.5");
+CONF_mDouble(spill_local_cold_block_max_usage_ratio, "0.5");
+// The read ahead buffer size when restoring a block from remote storage. 0 disables the read ahead.
+CONF_mInt64(spill_remote_read_buffer_bytes, "8388608");
+// Under memory pressure, move the spillable operators of a query to low memory mode one by one, from the one
+// holding the most revocable memory, until enough memory is freed, instead of all of them at once.
+CONF_mBool(enable_spill_gradual_trigger, "true");
+// Spillable operators start to spill when the process memory usage exceeds this ratio of the process memory
+// limit, besides the query and workgroup spill thresholds. 1.0 disables it.
+CONF_mDouble(spill_process_mem_limit_threshold, "0.9");
+// When spill is enabled for a query, the multi cast local exchanger of a CTE writes the chunks pushed into it to
+// spill blocks once the chunks buffered for its slower consumers exceed this size. 0 disables it.
+CONF_mInt64(multi_cast_local_exchange_spill_mem_bytes, "1073741824");
 
 CONF_Int32(internal_service_query_rpc_thread_num, "-1");
 
@@ -1115,6 +1335,22 @@ CONF_mInt64(datacache_disk_idle_seconds_for_expansion, "7200");
 // cache quota will be reset to zero to avoid overly frequent population and eviction.
 // Default: 100G
 CONF_mInt64(datacache_min_disk_quota_for_adjustment, "107374182400");
+// Whether to tune the datacache quotas by the hit ratio curve of the cache, which is estimated from the sampled
+// accesses. A quota grows by a step if the step increases the hit ratio by at least
+// `datacache_auto_tune_min_hit_ratio_gain`, and shrinks by a step if the step decreases it by less than half of that.
+// The disk quota is tuned within the bounds below and never beyond `datacache_disk_safe_level`, the memory quota is
+// tuned only if its max bound is set, and it is given back once the process memory reaches `memory_high_level`.
+CONF_mBool(datacache_auto_tune_enable, "false");
+CONF_mDouble(datacache_auto_tune_min_hit_ratio_gain, "0.01");
+// One of this many blocks is sampled to estimate the hit ratio curve.
+CONF_Int32(datacache_auto_tune_sample_ratio, "64");
+CONF_mInt64(datacache_auto_tune_min_disk_quota, "0");
+// 0 means the disk quota is bounded by `datacache_disk_safe_level` only.
+CONF_mInt64(datacache_auto_tune_max_disk_quota, "0");
+CONF_mInt64(datacache_auto_tune_min_mem_quota, "0");
+CONF_mInt64(datacache_auto_tune_max_mem_quota, "0");
+// The interval seconds to tune the quotas, the recorded accesses are halved after each tuning.
+CONF_mInt64(datacache_auto_tune_interval_seconds, "600");
 
 // The following configurations will be deprecated, and we use the `datacache` prefix instead.
 // But it is temporarily necessary to keep them for a period of time to be compatible with
@@ -1169,6 +1405,19 @@ CONF_mBool(enable_pindex_rebuild_in_compaction, "true");
 // enable read pindex by page
 CONF_mBool(enable_pindex_read_by_page, "true");
 
+// The in-memory primary index probes a batch of keys in the order of their hashes once it holds at least this many
+// keys, so that the lookups walk the hash table in order instead of missing cache at random. 0 to disable.
+CONF_mInt64(primary_index_sorted_lookup_min_size, "1048576");
+// ImmutableIndex probes the keys of a shard in the order of their pages and buckets.
+CONF_mBool(enable_pindex_sorted_shard_lookup, "true");
+
+// Load the primary indexes of the primary key tablets written within pk_index_warmup_recent_write_seconds in the
+// background after the BE starts, and the index of a tablet after it is cloned, instead of on the first write.
+CONF_Bool(enable_pk_index_warmup, "true");
+CONF_mInt64(pk_index_warmup_recent_write_seconds, "3600");
+// The number of indexes loaded at the same time on each disk by the warmup.
+CONF_Int32(pk_index_warmup_threads_per_disk, "1");
+
 // Used by query cache, cache entries are evicted when it exceeds its capacity(500MB in default)
 CONF_Int64(query_cache_capacity, "536870912");
 
@@ -1178,6 +1427,11 @@ CONF_Int64(query_cache_capacity, "536870912");
 // ranges in [1,16], default value is 4.
 CONF_mInt32(query_cache_num_lanes_per_driver, "4");
 
+// A tablet whose cached result is older than the required version only scans the delta rowsets since the cached
+// version and merges them with the cached result, unless the delta rows plus the cached rows exceed this ratio of
+// the rows of the tablet, then the tablet is recomputed from scratch. 0 always reuses the cached result.
+CONF_mDouble(query_cache_delta_reuse_max_cost_ratio, "1.0");
+
 // Used to limit buffer size of tablet send channel.
 CONF_mInt64(send_channel_buffer_limit, "67108864");
 
@@ -1257,6 +1511,12 @@ CONF_mBool(enable_drop_tablet_if_unfinished_txn, "true");
 CONF_Int32(lake_service_max_concurrency, "0");
 
 CONF_mInt64(lake_vacuum_min_batch_delete_size, "100");
+// Number of threads reading the metadata of the tablets of a vacuum request in parallel.
+CONF_Int32(lake_vacuum_collect_thread_num, "16");
+// Max number of delete batches of a vacuum request being deleted at the same time.
+CONF_mInt64(lake_vacuum_max_inflight_delete_batches, "4");
+// Max number of delete requests sent to one bucket per second by all vacuum tasks of a node, 0 means no limit.
+CONF_mInt64(lake_vacuum_delete_qps_per_bucket, "0");
 
 // TOPN RuntimeFilter parameters
 CONF_mInt32(desc_hint_split_range, "10");
@@ -1266,6 +1526,11 @@ CONF_mInt32(desc_hint_split_range, "10");
 CONF_mInt64(lake_local_pk_index_unused_threshold_seconds, "86400"); // 1 day
 
 CONF_mBool(lake_enable_vertical_compaction_fill_data_cache, "false");
+// The output segments of a lake compaction whose input rowsets are no larger than this are written through to the
+// local data cache and opened into the metacache after the compaction, so that queries after the compaction do not
+// read the new segments from the object storage. Negative means no limit, 0 disables it.
+CONF_mInt64(lake_compaction_fill_data_cache_max_bytes, /*1GB=*/"1073741824");
+CONF_mBool(lake_compaction_warm_up_output_segments, "true");
 
 CONF_mInt32(dictionary_cache_refresh_timeout_ms, "60000"); // 1 min
 CONF_mInt32(dictionary_cache_refresh_threadpool_size, "8");
@@ -1309,9 +1574,236 @@ CONF_mInt64(jit_lru_cache_size, "0");
 CONF_mInt64(arrow_io_coalesce_read_max_buffer_size, "8388608");
 CONF_mInt64(arrow_io_coalesce_read_max_distance_size, "1048576");
 CONF_mInt64(arrow_read_batch_size, "4096");
+// Share the buffers of the fixed-width and string columns with the arrow arrays they are converted to,
+// instead of copying them, when both layouts agree. The arrays keep the columns alive.
+CONF_mBool(enable_arrow_zero_copy_export, "false");
 
 // Set to true to enable socket_keepalive option in brpc
 CONF_mBool(brpc_socket_keepalive, "false");
 CONF_mBool(apply_del_vec_after_all_index_filter, "true");
 
+// The hash table of hash join is built and probed partition by partition (radix partitioned by the high bits of
+// bucket index) when the row count of build side reaches this limit, 0 means disable it.
+CONF_mInt64(hash_join_radix_partition_min_rows, "4194304");
+
+// Whether to prefetch the hash table of hash join in batch when probing a table which doesn't fit in cache.
+CONF_mBool(enable_hash_join_probe_prefetch, "true");
+
+// Max number of threads linking the radix partitions of one large hash join table, <= 1 means the build
+// driver links the whole table alone.
+CONF_mInt32(hash_join_parallel_build_dop, "4");
+// Number of threads of the pool shared by parallel hash join builds, <= 0 means the number of cpu cores.
+CONF_Int32(hash_join_build_thread_pool_thread_num, "0");
+
+// Whether the inner nest loop join with a conjunct `probe_col <op> build_col` (op is one of <, <=, >, >=, e.g. a
+// BETWEEN of two build columns) sorts the build rows by build_col, and permutes each probe row only with the build
+// rows found by binary search that may satisfy the conjunct, instead of all the build rows.
+CONF_mBool(enable_nljoin_range_index, "true");
+
+// Max number of ready drivers a pipeline executor thread takes from the driver queue at a time. The drivers not
+// executed yet wait in the run queue of the thread, and can be stolen by the idle threads. <= 1 means taking one
+// driver at a time without the run queues.
+CONF_mInt32(pipeline_driver_queue_take_batch_size, "4");
+
+// Whether the poller skips the drivers blocked by the observable source operators (exchange source and local
+// exchange source) until the operators notify that they may have output.
+CONF_mBool(enable_pipeline_event_driven_wakeup, "true");
+// The interval at which the poller checks all the blocked drivers, including the ones waiting for notifications,
+// to handle cancellation, expiration and profile reporting.
+CONF_mInt32(pipeline_poller_full_scan_interval_ms, "50");
+
+// Whether to bind the pipeline executor threads and scan threads to NUMA nodes in round robin, and let the free
+// chunks of MemChunkAllocator be reused only on the NUMA node where they are freed. It takes effect on machines
+// with more than one NUMA node, and needs the threads to be restarted.
+CONF_Bool(enable_numa_aware_scheduling, "false");
+
+// The serialized chunks of exchange sink at least this large are referenced by the brpc attachment instead of
+// being copied into it, < 0 means always copying.
+CONF_mInt64(exchange_zero_copy_attachment_min_bytes, "65536");
+
+// A merging exchange of at least this many senders merges them in parallel by all of its drivers, with the merge path
+// cascade merger, instead of in one driver, even if the plan does not enable parallel merge. 0 leaves the choice
+// to the plan.
+CONF_mInt32(exchange_parallel_merge_min_senders, "0");
+
+// The exchange sink stops sending chunks to a receiver which has been closed, e.g. after its limit is reached, and
+// finishes once all of its receivers are closed, so the upstream operators stop early.
+CONF_mBool(enable_exchange_receiver_early_finish, "true");
+
+// Number of the first rows sampled by each hash shuffle of exchange sink and local exchange to detect the hot keys
+// and the skew of partitions, which are reported in the profile, 0 means disable it.
+CONF_mInt64(shuffle_skew_detect_sample_rows, "65536");
+
+// The rows a local shuffle exchange sink batches for each source before handing them over, so that the sources are
+// locked once for several small input chunks at a high DOP. 0 hands over the rows of every input chunk at once.
+CONF_mInt32(local_exchange_shuffle_batch_rows, "256");
+
+// Whether the concurrent scans of the same tablet with the same version, columns and pushdown predicates share the
+// chunks decoded by one of them. Only the scans without global dicts, column access paths and unarrived runtime
+// filters can be shared.
+CONF_mBool(enable_scan_sharing, "false");
+// Max bytes of the chunks buffered by a shared scan for the followers, the slowest followers exceeding it read the
+// tablet by themselves.
+CONF_mInt64(scan_share_max_buffered_bytes, "67108864");
+// A follower of a shared scan reads the tablet by itself after waiting this long for the next chunk.
+CONF_mInt64(scan_share_follower_max_wait_ms, "1000");
+
+// Whether the scans of duplicate key tables with non-pushdown predicates read the columns not referenced by any
+// predicate only for the rows passing the predicates, by the row ids output by the tablet reader.
+CONF_mBool(enable_scan_late_materialization, "false");
+
+// Directory of the second tier of the storage page cache on the local disk, which keeps the decoded pages missing
+// in memory to avoid reading and decompressing them again, empty means disable it. The block files of the cache in
+// it are removed when BE starts, and BE fails to start if it is a non-empty directory not created by the cache.
+CONF_String(storage_page_disk_cache_path, "");
+CONF_Int64(storage_page_disk_cache_capacity, "10737418240");
+// Max bytes of the pages waiting for being written to the disk tier of the page cache, the pages beyond it are not
+// written to the disk.
+CONF_mInt64(storage_page_disk_cache_max_pending_bytes, "67108864");
+
+// Eviction policy of the storage page cache, LRU or TINY_LFU. TINY_LFU admits a page to the cache only if it is
+// accessed more frequently than the page to be evicted, so the large scans accessing each page once do not flush the
+// frequently used pages. The hit ratio of both policies can be compared by the metrics page_cache_hit_count and
+// page_cache_lookup_count.
+CONF_String(storage_page_cache_policy, "LRU");
+
+// Whether the segment iterator evaluates the comparison predicates of the integer columns on the encoded
+// BIT_SHUFFLE, FOR_ENCODING and RLE pages, and the `=` and `!=` predicates of the VARCHAR columns on the compressed
+// FSST_ENCODING pages first, and decodes only the rows passing them.
+CONF_mBool(enable_encoded_page_predicate, "true");
+
+// Whether the segment iterator reads the columns of the predicates ANDed at the root one by one, in the order adapted
+// to the cost and the selectivity observed at runtime, and reads the next columns only for the rows passing them.
+CONF_mBool(enable_adaptive_predicate_order, "true");
+
+// Whether the segment iterator of a primary key table with the row store decodes the projected value columns
+// from the row column instead of reading their own pages, if that is estimated to read fewer bytes for the
+// ranges to scan, e.g. for many columns of a few rows.
+CONF_mBool(enable_hybrid_row_column_scan, "true");
+// The cost of decoding a byte of the row column relative to the cost of reading a byte of the column pages.
+CONF_mDouble(hybrid_row_column_scan_decode_cost_ratio, "4.0");
+
+// Whether to load the bloom filter indexes of the predicate columns of all the segments to scan in the background
+// once the segment iterators are created, instead of one segment after another when each segment is initialized.
+CONF_mBool(enable_index_prefetch, "true");
+CONF_Int32(index_prefetch_thread_num, "32");
+
+// Whether to read the data pages of the columns of the lake tablets ahead of the column iterators in the background.
+CONF_mBool(enable_column_read_ahead, "true");
+// The max number of pages and bytes read ahead for each column.
+CONF_mInt32(column_read_ahead_max_pages, "16");
+CONF_mInt64(column_read_ahead_max_buffer_size, "4194304");
+CONF_Int32(column_read_ahead_thread_num, "64");
+
+// Whether to read the batches of ranges of the local files by io_uring, with all the reads of a batch in flight
+// at the same time, e.g. the coalesced buffers of SharedBufferedInputStream. Falls back to pread() if the kernel
+// does not support io_uring.
+CONF_Bool(enable_io_uring, "false");
+// The max number of the coalesced buffers read in one batch by SharedBufferedInputStream, for the streams reading
+// the batches concurrently, i.e. the local files by io_uring and the S3 objects by parallel ranged GETs.
+CONF_mInt32(io_coalesce_read_batch_size, "8");
+
+// The S3 input stream merges the ranges of a batch read whose gap is at most `max_merge_distance` into one ranged
+// GET of at most `max_merged_size`, and issues up to `max_parallelism` GETs at the same time.
+CONF_mInt64(s3_vectored_read_max_merge_distance, "1048576");
+CONF_mInt64(s3_vectored_read_max_merged_size, "16777216");
+CONF_mInt32(s3_vectored_read_max_parallelism, "8");
+
+// Whether to prefetch the next blocks of the remote files into datacache in the background when they are read
+// sequentially after missing the cache, which is triggered after `datacache_prefetch_sequential_reads` sequential
+// reads and prefetches up to `datacache_prefetch_blocks` blocks ahead of the reads.
+CONF_mBool(datacache_prefetch_enable, "true");
+CONF_mInt32(datacache_prefetch_sequential_reads, "2");
+CONF_mInt32(datacache_prefetch_blocks, "4");
+// The max bytes being prefetched by a query at the same time.
+CONF_mInt64(datacache_prefetch_max_bytes_per_query, "67108864");
+CONF_Int32(datacache_prefetch_thread_num, "16");
+
+// The datacache policies of the tables and columns, separated by ';', each of which is `<db>.<table>[.<column>]`
+// followed by ':' and the comma-separated properties among `priority=<int>`, `admission_ratio=<0~1>` and
+// `pinned=<bool>`, e.g. "db.t1:admission_ratio=0.2;db.t1.c1:pinned=true;db.t2:priority=-1". The policy of a column
+// overrides the one of its table. The blocks of a negative priority are not admitted into the cache when its usage
+// reaches `datacache_policy_pressure_ratio`, only the given ratio of the blocks are admitted, and the pinned blocks
+// are always admitted.
+CONF_mString(datacache_column_policies, "");
+CONF_mDouble(datacache_policy_pressure_ratio, "0.9");
+
+// Whether to skip the pages of the parquet columns without any row selected by the predicates or the other filters,
+// by the offset indexes of the columns, without loading the pages.
+CONF_mBool(parquet_page_late_materialization_enable, "true");
+
+// Whether to read the io ranges of the next stripe of an ORC file in the background while the current one is being
+// decoded, by the threads of `scan_io_prefetch_thread_num`. It is not used for the scans with datacache enabled.
+CONF_mBool(orc_stripe_prefetch_enable, "true");
+// The same for the next row group of a Parquet file.
+CONF_mBool(parquet_row_group_prefetch_enable, "true");
+CONF_Int32(scan_io_prefetch_thread_num, "32");
+
+// Whether to encode and compress the columns of the chunks written into a Parquet file by a task per column on the
+// sink executors, instead of one after another on the sink driver.
+CONF_mBool(parquet_writer_parallel_column_enable, "true");
+
+// The max number of files a connector sink driver writes at the same time, one per partition. Writing a new partition
+// beyond it commits the file of the least recently written partition first. 0 means unlimited.
+CONF_mInt32(connector_sink_max_open_partition_writers, "128");
+
+// Whether to decode the dictionary-encoded strings of ORC files into the string columns by the dictionary codes,
+// instead of through the pointers and lengths of the strings materialized by the ORC reader.
+CONF_mBool(orc_dict_string_direct_decode_enable, "true");
+
+// Whether to create the zone maps of the typed sub-columns extracted from the json columns by flat json, i.e. the
+// ones of the types supporting zone maps.
+CONF_mBool(json_flat_create_zonemap, "true");
+
+// Whether to compile the expressions by JIT in the background, evaluating them by the interpreter until compiled,
+// instead of compiling them when the query is prepared. The compilations wait in the queue of at most
+// `jit_compile_max_pending_tasks`, beyond which the expressions are compiled in place.
+CONF_mBool(jit_async_compile, "true");
+CONF_Int32(jit_compile_thread_num, "4");
+CONF_Int32(jit_compile_max_pending_tasks, "256");
+// The directory to store the object code of the functions compiled by JIT, which are loaded instead of compiled again
+// after the BE restarts. It is not used if empty.
+CONF_String(jit_object_cache_dir, "");
+
+// The functions called by the conjuncts are evaluated on the rows passing the previous conjuncts only, if they are
+// at most this ratio of the chunk. The arguments are gathered and the results are scattered back then.
+CONF_mDouble(expr_selective_evaluate_max_ratio, "0.3");
+
+// The results of the expensive deterministic functions, e.g. regexp_extract and ST_GeomFromText, are memoized by the
+// value of their only non-constant string argument, which pays off for the low-cardinality inputs.
+CONF_mBool(enable_expr_result_memoization, "true");
+// The max number of input values memoized for a function of an expression context, the memo is reset beyond it.
+CONF_mInt32(expr_result_memoization_capacity, "4096");
+// The memoization of a function is given up if the hit rate of its first this many rows is below the min hit rate.
+CONF_mInt32(expr_result_memoization_probe_rows, "16384");
+CONF_mDouble(expr_result_memoization_min_hit_rate, "0.5");
+
+// Whether to match the constant patterns of an OR of LIKE and REGEXP on the same column by one hyperscan scan of each
+// value. The compiled patterns are cached across queries, in the cache of at most this bytes.
+CONF_mBool(enable_multi_pattern_match, "true");
+CONF_Int64(multi_pattern_matcher_cache_bytes, "67108864");
+
+// The columns of the chunks of at least this number of columns are appended to the segment writers, and gathered by
+// the sorted order of the memtables, by ranges of columns in parallel, by at most `column_parallel_dop` threads of
+// the pool of `column_parallel_thread_pool_thread_num` threads (<= 0 means the number of cpu cores).
+CONF_mInt32(column_parallel_min_columns, "64");
+CONF_mInt32(column_parallel_dop, "4");
+CONF_Int32(column_parallel_thread_pool_thread_num, "0");
+
+// Whether to sort the rows of the memtables by a radix sort on their memcmp-able encoded sort keys, instead of
+// comparing the sort key columns one by one, if there are more than one sort key columns of the types supported by
+// the primary key encoding and no merge condition.
+CONF_mBool(enable_memtable_radix_sort, "true");
+// Whether to skip sorting the rows of the memtables that are already in the order of the sort key, e.g. the time
+// series loaded in the order of time, checked by comparing the adjacent rows before sorting.
+CONF_mBool(enable_memtable_sorted_input_fast_path, "true");
+
+// The max bytes of the columns read from the update files by a column mode partial update, kept to update all the
+// segments of the updated rows, instead of reading the update files again for each segment.
+CONF_mInt64(partial_update_column_mode_cache_bytes, "536870912");
+
+// Whether the full sort sorts the rows by the memcmp-able normalized keys of the leading ORDER BY columns, which are
+// 16 bytes prefixes of fixed width, and compares the columns only for the rows of the same prefix.
+CONF_mBool(enable_sort_normalized_key, "true");
+
 } // namespace starrocks::config
@@ -47,6 +47,7 @@
 #endif
 #include "gutil/cpu.h"
 #include "jemalloc/jemalloc.h"
+#include "runtime/memory/jemalloc_arenas.h"
 #include "runtime/memory/mem_chunk_allocator.h"
 #include "runtime/time_types.h"
 #include "runtime/user_function_cache.h"
@@ -111,6 +112,9 @@ void gc_memory(void* arg_this) {
         ReleaseColumnPool releaser(kFreeRatio);
         ForEach<ColumnPoolList>(releaser);
         LOG_IF(INFO, releaser.freed_bytes() > 0) << "Released " << releaser.freed_bytes() << " bytes from column pool";
+
+        int64_t purged_bytes = JemallocArenas::instance()->purge_dirty_arenas();
+        LOG_IF(INFO, purged_bytes > 0) << "Purged " << purged_bytes << " dirty bytes from jemalloc arenas";
     }
 }
 
@@ -305,6 +309,10 @@ void Daemon::init(bool as_cn, const std::vector<StorePath>& paths) {
 
     TimezoneUtils::init_time_zones();
 
+    if (auto st = JemallocArenas::instance()->init(); !st.ok()) {
+        LOG(WARNING) << "failed to create the jemalloc arenas of the memory classes: " << st;
+    }
+
     std::thread gc_thread(gc_memory, this);
     Thread::set_thread_name(gc_thread, "gc_daemon");
     _daemon_threads.emplace_back(std::move(gc_thread));
@@ -58,7 +58,7 @@ private:
     const int64_t _max_file_size;
     RuntimeState* _state;
 
-    std::map<std::string, std::shared_ptr<formats::FileWriter>> _partition_writers;
+    PartitionWriters _partition_writers;
 
     inline static std::string DEFAULT_PARTITION = "__DEFAULT_PARTITION__";
 };
@@ -188,6 +188,15 @@ void FileDataSource::_init_counter() {
         _scanner_init_chunk_timer = ADD_CHILD_TIMER(p, "CreateChunkTime", prefix);
         _scanner_file_reader_timer = ADD_CHILD_TIMER(p, "FileReadTime", prefix);
         _scanner_file_read_count = ADD_CHILD_COUNTER(p, "FileReadCount", TUnit::UNIT, prefix);
+        _scanner_parse_bytes = ADD_CHILD_COUNTER(p, "ParseBytes", TUnit::BYTES, prefix);
+        _scanner_parse_timer = ADD_CHILD_TIMER(p, "ParseTime", prefix);
+        // The parse time is spent by a single scanner thread, so this is the throughput per core.
+        p->add_derived_counter(
+                "ParseThroughput", TUnit::BYTES_PER_SECOND,
+                [bytes = _scanner_parse_bytes, timer = _scanner_parse_timer] {
+                    return RuntimeProfile::units_per_second(bytes, timer);
+                },
+                prefix);
     }
 }
 
@@ -203,6 +212,8 @@ void FileDataSource::_update_counter() {
     COUNTER_UPDATE(_scanner_init_chunk_timer, _counter.init_chunk_ns);
     COUNTER_UPDATE(_scanner_file_reader_timer, _counter.file_read_ns);
     COUNTER_UPDATE(_scanner_file_read_count, _counter.file_read_count);
+    COUNTER_UPDATE(_scanner_parse_bytes, _counter.parse_bytes);
+    COUNTER_UPDATE(_scanner_parse_timer, _counter.parse_ns);
 }
 
 } // namespace starrocks::connector
@@ -23,6 +23,8 @@
 #include "exec/hdfs_scanner_text.h"
 #include "exec/jni_scanner.h"
 #include "exprs/expr.h"
+#include "runtime/global_dict/config.h"
+#include "runtime/global_dict/parser.h"
 #include "hive_chunk_sink.h"
 #include "storage/chunk_helper.h"
 
@@ -125,6 +127,7 @@ Status HiveDataSource::open(RuntimeState* state) {
 
     RETURN_IF_ERROR(_init_conjunct_ctxs(state));
     _init_tuples_and_slots(state);
+    RETURN_IF_ERROR(_init_global_dicts(state));
     _init_counter(state);
     RETURN_IF_ERROR(_init_partition_values());
     if (_filter_by_eval_partition_conjuncts) {
@@ -327,6 +330,24 @@ void HiveDataSource::_init_tuples_and_slots(RuntimeState* state) {
     }
 }
 
+Status HiveDataSource::_init_global_dicts(RuntimeState* state) {
+    const auto& global_dict_map = state->get_query_global_dict_map();
+    if (global_dict_map.empty()) {
+        return Status::OK();
+    }
+    for (SlotDescriptor* slot : _materialize_slots) {
+        auto iter = global_dict_map.find(slot->id());
+        if (iter != global_dict_map.end() && slot->type().type == LowCardDictType) {
+            _global_dictmaps.emplace(slot->id(), const_cast<GlobalDictMap*>(&iter->second.first));
+        }
+    }
+    // Only the parquet reader outputs the codes of the global dicts.
+    if (!_global_dictmaps.empty() && _scan_range.file_format != THdfsFileFormat::PARQUET) {
+        return Status::NotSupported("global dict is only supported by the parquet files");
+    }
+    return Status::OK();
+}
+
 Status HiveDataSource::_decompose_conjunct_ctxs(RuntimeState* state) {
     if (_conjunct_ctxs.empty()) {
         return Status::OK();
@@ -339,6 +360,8 @@ Status HiveDataSource::_decompose_conjunct_ctxs(RuntimeState* state) {
 
     std::vector<ExprContext*> cloned_conjunct_ctxs;
     RETURN_IF_ERROR(Expr::clone_if_not_exists(state, &_pool, _conjunct_ctxs, &cloned_conjunct_ctxs));
+    // The conjuncts on the slots of the global dicts are evaluated on the dict codes.
+    RETURN_IF_ERROR(state->mutable_dict_optimize_parser()->rewrite_conjuncts(&cloned_conjunct_ctxs));
 
     for (ExprContext* ctx : cloned_conjunct_ctxs) {
         const Expr* root_expr = ctx->root();
@@ -408,6 +431,11 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
         _profile.shared_buffered_direct_io_count =
                 ADD_CHILD_COUNTER(_runtime_profile, "DirectIOCount", TUnit::UNIT, prefix);
         _profile.shared_buffered_direct_io_timer = ADD_CHILD_TIMER(_runtime_profile, "DirectIOTime", prefix);
+        _profile.shared_buffered_prefetch_io_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "PrefetchIOBytes", TUnit::BYTES, prefix);
+        _profile.shared_buffered_prefetch_io_count =
+                ADD_CHILD_COUNTER(_runtime_profile, "PrefetchIOCount", TUnit::UNIT, prefix);
+        _profile.shared_buffered_prefetch_wait_timer = ADD_CHILD_TIMER(_runtime_profile, "PrefetchWaitTime", prefix);
     }
 
     if (_use_datacache) {
@@ -438,6 +466,14 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadBlockBufferCounter", TUnit::UNIT, prefix);
         _profile.datacache_read_block_buffer_bytes =
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadBlockBufferBytes", TUnit::BYTES, prefix);
+        _profile.datacache_prefetch_counter =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCachePrefetchCounter", TUnit::UNIT, prefix);
+        _profile.datacache_prefetch_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCachePrefetchBytes", TUnit::BYTES, prefix);
+        _profile.datacache_prefetch_hit_counter =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCachePrefetchHitCounter", TUnit::UNIT, prefix);
+        _profile.datacache_prefetch_waste_counter =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCachePrefetchWasteCounter", TUnit::UNIT, prefix);
     }
 
     {
@@ -565,6 +601,7 @@ Status HiveDataSource::_init_scanner(RuntimeState* state) {
     scanner_params.can_use_any_column = _can_use_any_column;
     scanner_params.can_use_min_max_count_opt = _can_use_min_max_count_opt;
     scanner_params.use_file_metacache = _use_file_metacache;
+    scanner_params.global_dictmaps = &_global_dictmaps;
 
     HdfsScanner* scanner = nullptr;
     auto format = scan_range.file_format;
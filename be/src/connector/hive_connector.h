@@ -104,6 +104,7 @@ private:
     HdfsScanner* _create_odps_jni_scanner(const FSOptions& options);
     HdfsScanner* _create_kudu_jni_scanner(const FSOptions& options);
     Status _check_all_slots_nullable();
+    Status _init_global_dicts(RuntimeState* state);
 
     // =====================================
     ObjectPool _pool;
@@ -146,6 +147,8 @@ private:
     // materialized columns.
     std::vector<SlotDescriptor*> _materialize_slots;
     std::vector<int> _materialize_index_in_chunk;
+    // the query global dicts of the materialized slots of the low-cardinality optimization, by slot id.
+    ColumnIdToGlobalDictMap _global_dictmaps;
 
     // partition columns.
     std::vector<SlotDescriptor*> _partition_slots;
@@ -14,6 +14,8 @@
 
 #include "connector/lake_connector.h"
 
+#include <fmt/format.h>
+
 #include "exec/connector_scan_node.h"
 #include "exec/olap_scan_prepare.h"
 #include "exec/pipeline/fragment_context.h"
@@ -405,6 +407,10 @@ void LakeDataSource::init_counter(RuntimeState* state) {
     _bi_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "BitmapIndexFilter", segment_init_name);
     _bi_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "BitmapIndexFilterRows", TUnit::UNIT, segment_init_name);
     _bf_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "BloomFilterFilterRows", TUnit::UNIT, segment_init_name);
+    _ngram_bf_pages_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "NgramBloomFilterPages", TUnit::UNIT, segment_init_name);
+    _ngram_bf_filtered_pages_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "NgramBloomFilterFilterPages", TUnit::UNIT, segment_init_name);
     _seg_zm_filtered_counter =
             ADD_CHILD_COUNTER(_runtime_profile, "SegmentZoneMapFilterRows", TUnit::UNIT, segment_init_name);
     _seg_rt_filtered_counter =
@@ -421,6 +427,11 @@ void LakeDataSource::init_counter(RuntimeState* state) {
     _zone_map_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "ZoneMapIndexFiter", segment_init_name);
     _rows_key_range_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "ShortKeyFilter", segment_init_name);
     _bf_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "BloomFilterFilter", segment_init_name);
+    _index_prefetch_wait_timer = ADD_CHILD_TIMER(_runtime_profile, "IndexPrefetchWait", segment_init_name);
+    _index_prefetch_io_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "IndexPrefetchIOCount", TUnit::UNIT, segment_init_name);
+    _index_prefetch_io_bytes =
+            ADD_CHILD_COUNTER(_runtime_profile, "IndexPrefetchIOBytes", TUnit::BYTES, segment_init_name);
 
     // SegmentRead
     const std::string segment_read_name = "SegmentRead";
@@ -476,6 +487,10 @@ void LakeDataSource::init_counter(RuntimeState* state) {
     _prefetch_hit_counter = ADD_CHILD_COUNTER(_runtime_profile, "PrefetchHitCount", TUnit::UNIT, io_statistics_name);
     _prefetch_wait_finish_timer = ADD_CHILD_TIMER(_runtime_profile, "PrefetchWaitFinishTime", io_statistics_name);
     _prefetch_pending_timer = ADD_CHILD_TIMER(_runtime_profile, "PrefetchPendingTime", io_statistics_name);
+    // Read-ahead of the column pages
+    _read_ahead_counter = ADD_CHILD_COUNTER(_runtime_profile, "ReadAheadCount", TUnit::UNIT, io_statistics_name);
+    _read_ahead_hit_counter = ADD_CHILD_COUNTER(_runtime_profile, "ReadAheadHitCount", TUnit::UNIT, io_statistics_name);
+    _read_ahead_wait_timer = ADD_CHILD_TIMER(_runtime_profile, "ReadAheadWaitTime", io_statistics_name);
 }
 
 void LakeDataSource::update_realtime_counter(Chunk* chunk) {
@@ -510,6 +525,9 @@ void LakeDataSource::update_counter() {
     COUNTER_UPDATE(_zone_map_filter_timer, _reader->stats().zone_map_filter_ns);
     COUNTER_UPDATE(_rows_key_range_filter_timer, _reader->stats().rows_key_range_filter_ns);
     COUNTER_UPDATE(_bf_filter_timer, _reader->stats().bf_filter_ns);
+    COUNTER_UPDATE(_index_prefetch_wait_timer, _reader->stats().index_prefetch_wait_ns);
+    COUNTER_UPDATE(_index_prefetch_io_counter, _reader->stats().index_prefetch_io_count);
+    COUNTER_UPDATE(_index_prefetch_io_bytes, _reader->stats().index_prefetch_io_bytes);
     COUNTER_UPDATE(_read_pk_index_timer, _reader->stats().read_pk_index_ns);
 
     COUNTER_UPDATE(_raw_rows_counter, _reader->stats().raw_rows_read);
@@ -518,16 +536,30 @@ void LakeDataSource::update_counter() {
     cond_evaluate_ns += _reader->stats().vec_cond_evaluate_ns;
     cond_evaluate_ns += _reader->stats().branchless_cond_evaluate_ns;
     cond_evaluate_ns += _reader->stats().expr_cond_evaluate_ns;
+    cond_evaluate_ns += _reader->stats().encoded_pred_evaluate_ns;
     // In order to avoid exposing too detailed metrics, we still record these infos on `_pred_filter_timer`
     // When we support metric classification, we can disassemble it again.
     COUNTER_UPDATE(_pred_filter_timer, cond_evaluate_ns);
-    COUNTER_UPDATE(_pred_filter_counter, _reader->stats().rows_vec_cond_filtered);
+    COUNTER_UPDATE(_pred_filter_counter,
+                   _reader->stats().rows_vec_cond_filtered + _reader->stats().rows_encoded_pred_filtered);
     COUNTER_UPDATE(_del_vec_filter_counter, _reader->stats().rows_del_vec_filtered);
+    for (const auto& [name, stats] : _reader->stats().predicate_column_stats) {
+        auto* input_rows = ADD_CHILD_COUNTER(_runtime_profile, fmt::format("PredColumn[{}]InputRows", name),
+                                             TUnit::UNIT, "PredFilter");
+        auto* output_rows = ADD_CHILD_COUNTER(_runtime_profile, fmt::format("PredColumn[{}]OutputRows", name),
+                                              TUnit::UNIT, "PredFilter");
+        auto* evaluate_timer = ADD_CHILD_TIMER(_runtime_profile, fmt::format("PredColumn[{}]Time", name), "PredFilter");
+        COUNTER_UPDATE(input_rows, stats.input_rows);
+        COUNTER_UPDATE(output_rows, stats.output_rows);
+        COUNTER_UPDATE(evaluate_timer, stats.evaluate_ns);
+    }
 
     COUNTER_UPDATE(_seg_zm_filtered_counter, _reader->stats().segment_stats_filtered);
     COUNTER_UPDATE(_seg_rt_filtered_counter, _reader->stats().runtime_stats_filtered);
     COUNTER_UPDATE(_zm_filtered_counter, _reader->stats().rows_stats_filtered);
     COUNTER_UPDATE(_bf_filtered_counter, _reader->stats().rows_bf_filtered);
+    COUNTER_UPDATE(_ngram_bf_pages_counter, _reader->stats().ngram_bf_pages_checked);
+    COUNTER_UPDATE(_ngram_bf_filtered_pages_counter, _reader->stats().ngram_bf_pages_filtered);
     COUNTER_UPDATE(_sk_filtered_counter, _reader->stats().rows_key_range_filtered);
     COUNTER_UPDATE(_rows_after_sk_filtered_counter, _reader->stats().rows_after_key_range);
     COUNTER_UPDATE(_rows_key_range_counter, _reader->stats().rows_key_range_num);
@@ -590,6 +622,9 @@ void LakeDataSource::update_counter() {
     COUNTER_UPDATE(_prefetch_hit_counter, _reader->stats().prefetch_hit_count);
     COUNTER_UPDATE(_prefetch_wait_finish_timer, _reader->stats().prefetch_wait_finish_ns);
     COUNTER_UPDATE(_prefetch_pending_timer, _reader->stats().prefetch_pending_ns);
+    COUNTER_UPDATE(_read_ahead_counter, _reader->stats().read_ahead_count);
+    COUNTER_UPDATE(_read_ahead_hit_counter, _reader->stats().read_ahead_hit_count);
+    COUNTER_UPDATE(_read_ahead_wait_timer, _reader->stats().read_ahead_wait_ns);
 
     // update cache related info for CACHE SELECT
     if (_runtime_state->query_options().__isset.query_type &&
@@ -131,8 +131,13 @@ private:
     RuntimeProfile::Counter* _rows_key_range_filter_timer = nullptr;
     RuntimeProfile::Counter* _rows_key_range_counter = nullptr;
     RuntimeProfile::Counter* _bf_filter_timer = nullptr;
+    RuntimeProfile::Counter* _index_prefetch_wait_timer = nullptr;
+    RuntimeProfile::Counter* _index_prefetch_io_counter = nullptr;
+    RuntimeProfile::Counter* _index_prefetch_io_bytes = nullptr;
     RuntimeProfile::Counter* _zm_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bf_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _ngram_bf_pages_counter = nullptr;
+    RuntimeProfile::Counter* _ngram_bf_filtered_pages_counter = nullptr;
     RuntimeProfile::Counter* _seg_zm_filtered_counter = nullptr;
     RuntimeProfile::Counter* _seg_rt_filtered_counter = nullptr;
     RuntimeProfile::Counter* _sk_filtered_counter = nullptr;
@@ -174,6 +179,9 @@ private:
     RuntimeProfile::Counter* _prefetch_hit_counter = nullptr;
     RuntimeProfile::Counter* _prefetch_wait_finish_timer = nullptr;
     RuntimeProfile::Counter* _prefetch_pending_timer = nullptr;
+    RuntimeProfile::Counter* _read_ahead_counter = nullptr;
+    RuntimeProfile::Counter* _read_ahead_hit_counter = nullptr;
+    RuntimeProfile::Counter* _read_ahead_wait_timer = nullptr;
 };
 
 // ================================
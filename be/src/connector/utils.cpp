@@ -16,6 +16,7 @@
 
 #include "column/column.h"
 #include "column/datum.h"
+#include "common/config.h"
 #include "exprs/expr.h"
 #include "formats/parquet/parquet_file_writer.h"
 #include "util/url_coding.h"
@@ -114,27 +115,28 @@ StatusOr<ConnectorChunkSink::Futures> HiveUtils::hive_style_partitioning_write_c
         const formats::FileWriterFactory* file_writer_factory, LocationProvider* location_provider,
         std::map<std::string, std::shared_ptr<formats::FileWriter>>& partition_writers) {
     ConnectorChunkSink::Futures futures;
-    auto it = partition_writers.find(partition);
-    if (it != partition_writers.end()) {
-        auto* writer = it->second.get();
+    auto* writer = partition_writers.touch(partition);
+    if (writer != nullptr) {
         if (writer->get_written_bytes() >= max_file_size) {
             futures.commit_file_futures.push_back(writer->commit());
-            partition_writers.erase(it);
-            auto path = partitioned ? location_provider->get(partition) : location_provider->get();
-            ASSIGN_OR_RETURN(auto new_writer, file_writer_factory->create(path));
-            RETURN_IF_ERROR(new_writer->init());
-            futures.add_chunk_futures.push_back(new_writer->write(chunk));
-            partition_writers.emplace(partition, std::move(new_writer));
+            partition_writers.erase(partition);
         } else {
             futures.add_chunk_futures.push_back(writer->write(chunk));
+            return futures;
         }
     } else {
-        auto path = partitioned ? location_provider->get(partition) : location_provider->get();
-        ASSIGN_OR_RETURN(auto new_writer, file_writer_factory->create(path));
-        RETURN_IF_ERROR(new_writer->init());
-        futures.add_chunk_futures.push_back(new_writer->write(chunk));
-        partition_writers.emplace(partition, std::move(new_writer));
+        // bound the memory of the open writers when the chunks of many partitions are interleaved
+        const int32_t max_open_writers = config::connector_sink_max_open_partition_writers;
+        while (max_open_writers > 0 && partition_writers.size() >= static_cast<size_t>(max_open_writers)) {
+            futures.commit_file_futures.push_back(partition_writers.pop_least_recent()->commit());
+        }
     }
+
+    auto path = partitioned ? location_provider->get(partition) : location_provider->get();
+    ASSIGN_OR_RETURN(auto new_writer, file_writer_factory->create(path));
+    RETURN_IF_ERROR(new_writer->init());
+    futures.add_chunk_futures.push_back(new_writer->write(chunk));
+    partition_writers.put(partition, std::move(new_writer));
     return futures;
 }
 
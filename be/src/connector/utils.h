@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <list>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/statusor.h"
@@ -29,6 +31,56 @@ namespace starrocks::connector {
 
 class LocationProvider;
 
+// The open file writers of a sink by their partitions, iterated from the least recently written one.
+class PartitionWriters {
+public:
+    using Writer = std::shared_ptr<formats::FileWriter>;
+    using List = std::list<std::pair<std::string, Writer>>;
+
+    // Returns the writer of `partition` and makes it the most recently written one, or nullptr if absent.
+    formats::FileWriter* touch(const std::string& partition) {
+        auto it = _index.find(partition);
+        if (it == _index.end()) {
+            return nullptr;
+        }
+        _writers.splice(_writers.end(), _writers, it->second);
+        return it->second->second.get();
+    }
+
+    // Adds `writer` of `partition` as the most recently written one, replacing the old one if exists.
+    void put(const std::string& partition, Writer writer) {
+        erase(partition);
+        _writers.emplace_back(partition, std::move(writer));
+        _index[partition] = std::prev(_writers.end());
+    }
+
+    void erase(const std::string& partition) {
+        auto it = _index.find(partition);
+        if (it != _index.end()) {
+            _writers.erase(it->second);
+            _index.erase(it);
+        }
+    }
+
+    // Removes and returns the least recently written writer. requires: !empty()
+    Writer pop_least_recent() {
+        DCHECK(!_writers.empty());
+        auto writer = std::move(_writers.front().second);
+        _index.erase(_writers.front().first);
+        _writers.pop_front();
+        return writer;
+    }
+
+    size_t size() const { return _writers.size(); }
+    bool empty() const { return _writers.empty(); }
+    List::iterator begin() { return _writers.begin(); }
+    List::iterator end() { return _writers.end(); }
+
+private:
+    List _writers;
+    std::unordered_map<std::string, List::iterator> _index;
+};
+
 class HiveUtils {
 public:
     static StatusOr<std::string> make_partition_name(
@@ -39,10 +91,13 @@ public:
             const std::vector<std::string>& column_names,
             const std::vector<std::unique_ptr<ColumnEvaluator>>& column_evaluators, Chunk* chunk);
 
+    // Writes `chunk` of `partition` into its open writer, which is committed and replaced once it has
+    // `max_file_size` bytes. When a new writer would exceed config::connector_sink_max_open_partition_writers open
+    // writers, the least recently written one is committed first.
     static StatusOr<ConnectorChunkSink::Futures> hive_style_partitioning_write_chunk(
             const ChunkPtr& chunk, bool partitioned, const std::string& partition, int64_t max_file_size,
             const formats::FileWriterFactory* file_writer_factory, LocationProvider* location_provider,
-            std::map<std::string, std::shared_ptr<formats::FileWriter>>& partition_writers);
+            PartitionWriters& partition_writers);
 
 private:
     static StatusOr<std::string> column_value(const TypeDescriptor& type_desc, const ColumnPtr& column);
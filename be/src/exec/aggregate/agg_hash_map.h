@@ -46,7 +46,7 @@ using AggDataPtr = uint8_t*;
 template <PhmapSeed seed>
 using Int8AggHashMap = SmallFixedSizeHashMap<int8_t, AggDataPtr, seed>;
 template <PhmapSeed seed>
-using Int16AggHashMap = phmap::flat_hash_map<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>>;
+using Int16AggHashMap = SmallFixedSizeHashMap<int16_t, AggDataPtr, seed>;
 template <PhmapSeed seed>
 using Int32AggHashMap = phmap::flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
 template <PhmapSeed seed>
@@ -74,6 +74,8 @@ using FixedSize16SliceAggHashMap =
 // two level agg hash map
 template <PhmapSeed seed>
 using Int32AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+template <PhmapSeed seed>
+using Int64AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>>;
 
 // The SliceAggTwoLevelHashMap will have 2 ^ 4 = 16 sub map,
 // The 16 is same as PartitionedAggregationNode::PARTITION_FANOUT
@@ -773,6 +775,8 @@ struct AggHashMapWithSerializedKeyFixedSize
     // TODO: make has_null_column as a constexpr
     bool has_null_column = false;
     int fixed_byte_size = -1; // unset state
+    // the value sizes of the key columns, see serialize_nullable_fixed_size_keys
+    std::vector<uint32_t> key_byte_sizes;
     struct CacheEntry {
         FixedSizeSliceKey key;
         size_t hashval;
@@ -799,12 +803,12 @@ struct AggHashMapWithSerializedKeyFixedSize
                                               Buffer<AggDataPtr>* agg_states, Func&& allocate_func,
                                               std::vector<uint8_t>* not_founds) {
         auto* buffer = reinterpret_cast<uint8_t*>(caches.data());
-        for (const auto& key_column : key_columns) {
-            key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_fixed_size);
-        }
         if (has_null_column) {
-            for (size_t i = 0; i < chunk_size; ++i) {
-                caches[i].key.u.size = slice_sizes[i];
+            serialize_nullable_fixed_size_keys(key_columns, key_byte_sizes, buffer, max_fixed_size, chunk_size,
+                                               slice_sizes);
+        } else {
+            for (const auto& key_column : key_columns) {
+                key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_fixed_size);
             }
         }
         for (size_t i = 0; i < chunk_size; i++) {
@@ -844,15 +848,14 @@ struct AggHashMapWithSerializedKeyFixedSize
                                                 std::vector<uint8_t>* not_founds) {
         constexpr int key_size = sizeof(FixedSizeSliceKey);
         auto* buffer = reinterpret_cast<uint8_t*>(caches.data());
-        for (const auto& key_column : key_columns) {
-            key_column->serialize_batch(buffer, slice_sizes, chunk_size, key_size);
-        }
-        auto* key = reinterpret_cast<FixedSizeSliceKey*>(caches.data());
         if (has_null_column) {
-            for (size_t i = 0; i < chunk_size; ++i) {
-                key[i].u.size = slice_sizes[i];
+            serialize_nullable_fixed_size_keys(key_columns, key_byte_sizes, buffer, key_size, chunk_size, slice_sizes);
+        } else {
+            for (const auto& key_column : key_columns) {
+                key_column->serialize_batch(buffer, slice_sizes, chunk_size, key_size);
             }
         }
+        auto* key = reinterpret_cast<FixedSizeSliceKey*>(caches.data());
         for (size_t i = 0; i < chunk_size; ++i) {
             if constexpr (allocate_and_compute_state) {
                 auto iter = this->hash_map.lazy_emplace(key[i], [&](const auto& ctor) {
@@ -901,20 +904,16 @@ struct AggHashMapWithSerializedKeyFixedSize
 
     void insert_keys_to_columns(ResultVector& keys, const Columns& key_columns, int32_t chunk_size) {
         DCHECK(fixed_byte_size != -1);
+        if (has_null_column) {
+            deserialize_nullable_fixed_size_keys(keys.data(), key_columns, tmp_slices, chunk_size);
+            return;
+        }
         tmp_slices.reserve(chunk_size);
 
-        if (!has_null_column) {
-            for (int i = 0; i < chunk_size; i++) {
-                FixedSizeSliceKey& key = keys[i];
-                tmp_slices[i].data = key.u.data;
-                tmp_slices[i].size = fixed_byte_size;
-            }
-        } else {
-            for (int i = 0; i < chunk_size; i++) {
-                FixedSizeSliceKey& key = keys[i];
-                tmp_slices[i].data = key.u.data;
-                tmp_slices[i].size = key.u.size;
-            }
+        for (int i = 0; i < chunk_size; i++) {
+            FixedSizeSliceKey& key = keys[i];
+            tmp_slices[i].data = key.u.data;
+            tmp_slices[i].size = fixed_byte_size;
         }
 
         // deserialize by column
@@ -32,7 +32,7 @@ namespace starrocks {
 template <PhmapSeed seed>
 using Int8AggHashSet = SmallFixedSizeHashSet<int8_t, seed>;
 template <PhmapSeed seed>
-using Int16AggHashSet = phmap::flat_hash_set<int16_t, StdHashWithSeed<int16_t, seed>>;
+using Int16AggHashSet = SmallFixedSizeHashSet<int16_t, seed>;
 template <PhmapSeed seed>
 using Int32AggHashSet = phmap::flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>>;
 template <PhmapSeed seed>
@@ -60,6 +60,8 @@ using FixedSize16SliceAggHashSet = phmap::flat_hash_set<SliceKey16, FixedSizeSli
 // two level agg hash set
 template <PhmapSeed seed>
 using Int32AggTwoLevelHashSet = phmap::parallel_flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>>;
+template <PhmapSeed seed>
+using Int64AggTwoLevelHashSet = phmap::parallel_flat_hash_set<int64_t, StdHashWithSeed<int64_t, seed>>;
 
 template <PhmapSeed seed>
 using SliceAggTwoLevelHashSet =
@@ -420,6 +422,71 @@ struct AggHashSetOfSerializedKey : public AggHashSet<HashSet, AggHashSetOfSerial
     int32_t _chunk_size;
 };
 
+// The fixed size keys of nullable key columns are laid out as a null bitmap of the key columns followed by the
+// values at fixed offsets, a null value is left as zero bytes. A row takes one bit per key column besides the values,
+// instead of the null byte per nullable column and the length byte of the variable length serialization, so keys of
+// a few small nullable columns still fit in a fixed size slice. `key_sizes` are the value sizes of the key columns,
+// the columns of only nulls do not know theirs. `buffer` must be zeroed.
+inline void serialize_nullable_fixed_size_keys(const Columns& key_columns, const std::vector<uint32_t>& key_sizes,
+                                               uint8_t* buffer, uint32_t row_size, size_t chunk_size,
+                                               Buffer<uint32_t>& slice_sizes) {
+    DCHECK_EQ(key_columns.size(), key_sizes.size());
+    uint32_t offset = (key_columns.size() + 7) / 8;
+    slice_sizes.assign(chunk_size, offset);
+    for (size_t j = 0; j < key_columns.size(); j++) {
+        const uint8_t null_bit = 1 << (j % 8);
+        uint8_t* null_bits = buffer + j / 8;
+        if (key_columns[j]->only_null()) {
+            for (size_t i = 0; i < chunk_size; i++) {
+                null_bits[i * row_size] |= null_bit;
+                slice_sizes[i] += key_sizes[j];
+            }
+        } else if (key_columns[j]->is_nullable()) {
+            auto* nullable_column = down_cast<NullableColumn*>(key_columns[j].get());
+            nullable_column->data_column()->serialize_batch(buffer, slice_sizes, chunk_size, row_size);
+            if (nullable_column->has_null()) {
+                const auto& null_data = nullable_column->immutable_null_column_data();
+                for (size_t i = 0; i < chunk_size; i++) {
+                    if (null_data[i]) {
+                        null_bits[i * row_size] |= null_bit;
+                        memset(buffer + i * row_size + offset, 0, key_sizes[j]);
+                    }
+                }
+            }
+        } else {
+            key_columns[j]->serialize_batch(buffer, slice_sizes, chunk_size, row_size);
+        }
+        offset += key_sizes[j];
+        DCHECK(chunk_size == 0 || slice_sizes[0] == offset);
+    }
+}
+
+// Appends the keys serialized by serialize_nullable_fixed_size_keys to `key_columns`.
+template <typename FixedSizeSliceKey>
+void deserialize_nullable_fixed_size_keys(const FixedSizeSliceKey* keys, const Columns& key_columns,
+                                          std::vector<Slice>& tmp_slices, size_t chunk_size) {
+    const size_t bitmap_size = (key_columns.size() + 7) / 8;
+    tmp_slices.resize(chunk_size);
+    for (size_t i = 0; i < chunk_size; i++) {
+        tmp_slices[i].data = const_cast<char*>(keys[i].u.data) + bitmap_size;
+    }
+    for (size_t j = 0; j < key_columns.size(); j++) {
+        if (!key_columns[j]->is_nullable()) {
+            key_columns[j]->deserialize_and_append_batch(tmp_slices, chunk_size);
+            continue;
+        }
+        auto* nullable_column = down_cast<NullableColumn*>(key_columns[j].get());
+        nullable_column->data_column()->deserialize_and_append_batch(tmp_slices, chunk_size);
+        auto& null_data = nullable_column->null_column_data();
+        const size_t old_size = null_data.size();
+        null_data.resize(old_size + chunk_size);
+        for (size_t i = 0; i < chunk_size; i++) {
+            null_data[old_size + i] = (static_cast<uint8_t>(keys[i].u.data[j / 8]) >> (j % 8)) & 1;
+        }
+        nullable_column->update_has_null();
+    }
+}
+
 template <typename HashSet>
 struct AggHashSetOfSerializedKeyFixedSize : public AggHashSet<HashSet, AggHashSetOfSerializedKeyFixedSize<HashSet>> {
     using Iterator = typename HashSet::iterator;
@@ -429,6 +496,8 @@ struct AggHashSetOfSerializedKeyFixedSize : public AggHashSet<HashSet, AggHashSe
 
     bool has_null_column = false;
     int fixed_byte_size = -1; // unset state
+    // the value sizes of the key columns, see serialize_nullable_fixed_size_keys
+    std::vector<uint32_t> key_byte_sizes;
     static constexpr size_t max_fixed_size = sizeof(FixedSizeSliceKey);
 
     AggHashSetOfSerializedKeyFixedSize(int32_t chunk_size)
@@ -455,18 +524,17 @@ struct AggHashSetOfSerializedKeyFixedSize : public AggHashSet<HashSet, AggHashSe
             memset(buffer, 0x0, max_fixed_size * chunk_size);
         }
 
-        for (const auto& key_column : key_columns) {
-            key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_fixed_size);
-        }
-
-        auto* key = reinterpret_cast<FixedSizeSliceKey*>(buffer);
-
         if (has_null_column) {
-            for (size_t i = 0; i < chunk_size; ++i) {
-                key[i].u.size = slice_sizes[i];
+            serialize_nullable_fixed_size_keys(key_columns, key_byte_sizes, buffer, max_fixed_size, chunk_size,
+                                               slice_sizes);
+        } else {
+            for (const auto& key_column : key_columns) {
+                key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_fixed_size);
             }
         }
 
+        auto* key = reinterpret_cast<FixedSizeSliceKey*>(buffer);
+
         for (size_t i = 0; i < chunk_size; ++i) {
             if constexpr (compute_and_allocate) {
                 this->hash_set.insert(key[i]);
@@ -478,20 +546,16 @@ struct AggHashSetOfSerializedKeyFixedSize : public AggHashSet<HashSet, AggHashSe
 
     void insert_keys_to_columns(ResultVector& keys, const Columns& key_columns, int32_t chunk_size) {
         DCHECK(fixed_byte_size != -1);
+        if (has_null_column) {
+            deserialize_nullable_fixed_size_keys(keys.data(), key_columns, tmp_slices, chunk_size);
+            return;
+        }
         tmp_slices.reserve(chunk_size);
 
-        if (!has_null_column) {
-            for (int i = 0; i < chunk_size; i++) {
-                FixedSizeSliceKey& key = keys[i];
-                tmp_slices[i].data = key.u.data;
-                tmp_slices[i].size = fixed_byte_size;
-            }
-        } else {
-            for (int i = 0; i < chunk_size; i++) {
-                FixedSizeSliceKey& key = keys[i];
-                tmp_slices[i].data = key.u.data;
-                tmp_slices[i].size = key.u.size;
-            }
+        for (int i = 0; i < chunk_size; i++) {
+            FixedSizeSliceKey& key = keys[i];
+            tmp_slices[i].data = key.u.data;
+            tmp_slices[i].size = fixed_byte_size;
         }
 
         // deserialize by column
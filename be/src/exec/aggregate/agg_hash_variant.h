@@ -57,6 +57,7 @@ namespace starrocks {
     M(phase1_null_string)            \
     M(phase1_slice_two_level)        \
     M(phase1_int32_two_level)        \
+    M(phase1_int64_two_level)        \
     M(phase2_uint8)                  \
     M(phase2_int8)                   \
     M(phase2_int16)                  \
@@ -84,6 +85,7 @@ namespace starrocks {
     M(phase2_null_string)            \
     M(phase2_slice_two_level)        \
     M(phase2_int32_two_level)        \
+    M(phase2_int64_two_level)        \
     M(phase1_slice_fx4)              \
     M(phase1_slice_fx8)              \
     M(phase1_slice_fx16)             \
@@ -156,6 +158,8 @@ template <PhmapSeed seed>
 using SerializedKeyTwoLevelAggHashMap = AggHashMapWithSerializedKey<SliceAggTwoLevelHashMap<seed>>;
 template <PhmapSeed seed>
 using Int32TwoLevelAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_INT, Int32AggTwoLevelHashMap<seed>>;
+template <PhmapSeed seed>
+using Int64TwoLevelAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_BIGINT, Int64AggTwoLevelHashMap<seed>>;
 
 // fixed slice key type.
 template <PhmapSeed seed>
@@ -228,6 +232,8 @@ template <PhmapSeed seed>
 using SerializedTwoLevelKeyAggHashSet = AggHashSetOfSerializedKey<SliceAggTwoLevelHashSet<seed>>;
 template <PhmapSeed seed>
 using Int32TwoLevelAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_INT, Int32AggTwoLevelHashSet<seed>>;
+template <PhmapSeed seed>
+using Int64TwoLevelAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_BIGINT, Int64AggTwoLevelHashSet<seed>>;
 
 // For fixed slice type.
 template <PhmapSeed seed>
@@ -303,6 +309,7 @@ using AggHashMapWithKeyPtr = std::variant<
         std::unique_ptr<NullOneStringAggHashMap<PhmapSeed1>>, std::unique_ptr<SerializedKeyAggHashMap<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyTwoLevelAggHashMap<PhmapSeed1>>,
         std::unique_ptr<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed1>>,
@@ -332,6 +339,7 @@ using AggHashMapWithKeyPtr = std::variant<
         std::unique_ptr<NullOneStringAggHashMap<PhmapSeed2>>, std::unique_ptr<SerializedKeyAggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyTwoLevelAggHashMap<PhmapSeed2>>,
         std::unique_ptr<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>>;
@@ -363,6 +371,7 @@ using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<NullOneStringAggHashSet<PhmapSeed1>>, std::unique_ptr<SerializedKeyAggHashSet<PhmapSeed1>>,
         std::unique_ptr<SerializedTwoLevelKeyAggHashSet<PhmapSeed1>>,
         std::unique_ptr<Int32TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>,
         std::unique_ptr<UInt8AggHashSetOfOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<Int8AggHashSetOfOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<Int16AggHashSetOfOneNumberKey<PhmapSeed2>>,
@@ -389,6 +398,7 @@ using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<NullOneStringAggHashSet<PhmapSeed2>>, std::unique_ptr<SerializedKeyAggHashSet<PhmapSeed2>>,
         std::unique_ptr<SerializedTwoLevelKeyAggHashSet<PhmapSeed2>>,
         std::unique_ptr<Int32TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed1>>,
@@ -425,6 +435,7 @@ struct AggHashMapVariant {
         phase1_slice,
         phase1_slice_two_level,
         phase1_int32_two_level,
+        phase1_int64_two_level,
 
         phase1_slice_fx4,
         phase1_slice_fx8,
@@ -457,6 +468,7 @@ struct AggHashMapVariant {
         phase2_slice,
         phase2_slice_two_level,
         phase2_int32_two_level,
+        phase2_int64_two_level,
 
         phase2_slice_fx4,
         phase2_slice_fx8,
@@ -530,6 +542,7 @@ struct AggHashSetVariant {
         phase1_slice,
         phase1_slice_two_level,
         phase1_int32_two_level,
+        phase1_int64_two_level,
         phase2_uint8,
         phase2_int8,
         phase2_int16,
@@ -557,6 +570,7 @@ struct AggHashSetVariant {
         phase2_slice,
         phase2_slice_two_level,
         phase2_int32_two_level,
+        phase2_int64_two_level,
 
         phase1_slice_fx4,
         phase1_slice_fx8,
@@ -63,6 +63,14 @@ size_t AggrAutoContext::get_continuous_limit() {
     return continuous_limit;
 }
 
+void AggrAutoContext::settle(AggrAutoState state) {
+    if (settled_state != INIT_PREAGG && settled_state != state) {
+        continuous_limit = InitContinuousLimit;
+    }
+    settled_state = state;
+    reset_reduction_window();
+}
+
 bool AggrAutoContext::is_high_reduction(const size_t agg_count, const size_t chunk_size) {
     return agg_count >= HighReduction * chunk_size;
 }
@@ -71,6 +79,18 @@ bool AggrAutoContext::is_low_reduction(const size_t agg_count, const size_t chun
     return agg_count <= LowReduction * chunk_size;
 }
 
+bool AggrAutoContext::observe_reduction(const size_t agg_count, const size_t chunk_size) {
+    window_agg_rows += agg_count;
+    window_rows += chunk_size;
+    return ++window_chunks >= ReductionWindow;
+}
+
+void AggrAutoContext::reset_reduction_window() {
+    window_chunks = 0;
+    window_agg_rows = 0;
+    window_rows = 0;
+}
+
 Status init_udaf_context(int64_t fid, const std::string& url, const std::string& checksum, const std::string& symbol,
                          FunctionContext* context);
 
@@ -1161,15 +1181,15 @@ Status Aggregator::evaluate_agg_fn_exprs(Chunk* chunk, bool use_intermediate) {
 }
 
 bool is_group_columns_fixed_size(std::vector<ExprContext*>& group_by_expr_ctxs, std::vector<ColumnType>& group_by_types,
-                                 size_t* max_size, bool* has_null) {
+                                 size_t* max_size, bool* has_null, std::vector<uint32_t>* key_sizes) {
     size_t size = 0;
     *has_null = false;
+    key_sizes->clear();
 
     for (size_t i = 0; i < group_by_expr_ctxs.size(); i++) {
         ExprContext* ctx = group_by_expr_ctxs[i];
         if (group_by_types[i].is_nullable) {
             *has_null = true;
-            size += 1; // 1 bytes for  null flag.
         }
         LogicalType ltype = ctx->root()->type().type;
         if (ctx->root()->type().is_complex_type()) {
@@ -1178,6 +1198,11 @@ bool is_group_columns_fixed_size(std::vector<ExprContext*>& group_by_expr_ctxs,
         size_t byte_size = get_size_of_fixed_length_type(ltype);
         if (byte_size == 0) return false;
         size += byte_size;
+        key_sizes->emplace_back(byte_size);
+    }
+    if (*has_null) {
+        // a null bit per key column, see serialize_nullable_fixed_size_keys
+        size += (group_by_expr_ctxs.size() + 7) / 8;
     }
     *max_size = size;
     return true;
@@ -1267,25 +1292,24 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
 
     bool has_null_column = false;
     int fixed_byte_size = 0;
+    std::vector<uint32_t> key_byte_sizes;
     // this optimization don't need to be limited to multi-column group by.
     // single column like float/double/decimal/largeint could also be applied to.
     if (type == HashVariantType::Type::phase1_slice || type == HashVariantType::Type::phase2_slice) {
         size_t max_size = 0;
-        if (is_group_columns_fixed_size(_group_by_expr_ctxs, _group_by_types, &max_size, &has_null_column)) {
-            // we need reserve a byte for serialization length for nullable columns
-            if (max_size < 4 || (!has_null_column && max_size == 4)) {
+        if (is_group_columns_fixed_size(_group_by_expr_ctxs, _group_by_types, &max_size, &has_null_column,
+                                        &key_byte_sizes)) {
+            if (max_size <= 4) {
                 type = _aggr_phase == AggrPhase1 ? HashVariantType::Type::phase1_slice_fx4
                                                  : HashVariantType::Type::phase2_slice_fx4;
-            } else if (max_size < 8 || (!has_null_column && max_size == 8)) {
+            } else if (max_size <= 8) {
                 type = _aggr_phase == AggrPhase1 ? HashVariantType::Type::phase1_slice_fx8
                                                  : HashVariantType::Type::phase2_slice_fx8;
-            } else if (max_size < 16 || (!has_null_column && max_size == 16)) {
+            } else if (max_size <= 16) {
                 type = _aggr_phase == AggrPhase1 ? HashVariantType::Type::phase1_slice_fx16
                                                  : HashVariantType::Type::phase2_slice_fx16;
             }
-            if (!has_null_column) {
-                fixed_byte_size = max_size;
-            }
+            fixed_byte_size = max_size;
         }
     }
     VLOG_ROW << "hash type is "
@@ -1296,6 +1320,7 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
         if constexpr (is_combined_fixed_size_key<std::decay_t<decltype(*variant)>>) {
             variant->has_null_column = has_null_column;
             variant->fixed_byte_size = fixed_byte_size;
+            variant->key_byte_sizes = key_byte_sizes;
         }
     });
 }
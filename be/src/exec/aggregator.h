@@ -169,18 +169,33 @@ struct AggrAutoContext {
     static constexpr double HighReduction = 0.9;
     static constexpr size_t MaxHtSize = 64 * 1024 * 1024; // 64 MB
     static constexpr int StableLimit = 5;
+    static constexpr size_t InitContinuousLimit = 100;
+    // PREAGG and SELECTIVE_PREAGG keep observing the reduction of every chunk, and go back to ADJUST
+    // as soon as the reduction of a window of ReductionWindow chunks doesn't fit the state any more.
+    static constexpr size_t ReductionWindow = 8;
     std::string get_auto_state_string(const AggrAutoState& state);
     size_t get_continuous_limit();
     void update_continuous_limit();
+    // ADJUST settles down on `state`. If it differs from the last settled state, the reduction of the input
+    // has changed, so the continuous limit is reset to re-check the input as often as at the beginning.
+    void settle(AggrAutoState state);
     bool is_high_reduction(const size_t agg_count, const size_t chunk_size);
     bool is_low_reduction(const size_t agg_count, const size_t chunk_size);
+    // Accumulate a chunk of which agg_count rows are aggregated into existing groups,
+    // returns true when a whole window has been observed.
+    bool observe_reduction(const size_t agg_count, const size_t chunk_size);
+    void reset_reduction_window();
     size_t init_preagg_count = 0;
     size_t adjust_count = 0;
     size_t pass_through_count = 0;
     size_t force_preagg_count = 0;
     size_t preagg_count = 0;
     size_t selective_preagg_count = 0;
-    size_t continuous_limit = 100;
+    size_t continuous_limit = InitContinuousLimit;
+    AggrAutoState settled_state = INIT_PREAGG;
+    size_t window_chunks = 0;
+    size_t window_agg_rows = 0;
+    size_t window_rows = 0;
 };
 
 struct StreamingHtMinReductionEntry {
@@ -21,6 +21,7 @@
 #include "column/chunk.h"
 #include "exec/pipeline/analysis/analytic_sink_operator.h"
 #include "exec/pipeline/analysis/analytic_source_operator.h"
+#include "exec/pipeline/analysis/spillable_analytic_sink_operator.h"
 #include "exec/pipeline/hash_partition_context.h"
 #include "exec/pipeline/hash_partition_sink_operator.h"
 #include "exec/pipeline/hash_partition_source_operator.h"
@@ -133,8 +134,13 @@ pipeline::OpFactories AnalyticNode::decompose_to_pipeline(pipeline::PipelineBuil
             degree_of_parallelism, _tnode, child(0)->row_desc(), _result_tuple_desc, _use_hash_based_partition);
     auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
 
-    ops_with_sink.emplace_back(
-            std::make_shared<AnalyticSinkOperatorFactory>(context->next_operator_id(), id(), _tnode, analytor_factory));
+    if (runtime_state()->enable_spill() && runtime_state()->enable_analytic_spill()) {
+        ops_with_sink.emplace_back(std::make_shared<SpillableAnalyticSinkOperatorFactory>(
+                context->next_operator_id(), id(), _tnode, analytor_factory));
+    } else {
+        ops_with_sink.emplace_back(std::make_shared<AnalyticSinkOperatorFactory>(context->next_operator_id(), id(),
+                                                                                 _tnode, analytor_factory));
+    }
     this->init_runtime_filter_for_operator(ops_with_sink.back().get(), context, rc_rf_probe_collector);
     context->add_pipeline(ops_with_sink);
 
@@ -22,6 +22,10 @@
 #include "column/column_helper.h"
 #include "common/config.h"
 #include "common/status.h"
+#include "exec/spill/executor.h"
+#include "exec/spill/options.h"
+#include "exec/spill/spiller.hpp"
+#include "exec/spill/spiller_factory.h"
 #include "exprs/agg/count.h"
 #include "exprs/agg/window.h"
 #include "exprs/anyval_util.h"
@@ -107,6 +111,9 @@ Analytor::Analytor(const TPlanNode& tnode, const RowDescriptor& child_row_desc,
         if (config::pipeline_analytic_enable_removable_cumulative_process) {
             _use_removable_cumulative_process = (window.__isset.window_start && window.__isset.window_end);
         }
+        if (config::pipeline_analytic_enable_sliding_extreme_process) {
+            _use_sliding_extreme_process = (window.__isset.window_start && window.__isset.window_end);
+        }
         _is_unbounded_preceding = !window.__isset.window_start;
     }
 }
@@ -169,6 +176,11 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
         if (!(fn.name.function_name == "sum" || fn.name.function_name == "avg" || fn.name.function_name == "count")) {
             _use_removable_cumulative_process = false;
         }
+        if (fn.name.function_name == "min" || fn.name.function_name == "max") {
+            _sliding_extremes.emplace_back(fn.name.function_name == "max");
+        } else {
+            _use_sliding_extreme_process = false;
+        }
 
         bool is_input_nullable = false;
         if (fn.name.function_name == "count" || fn.name.function_name == "row_number" ||
@@ -356,6 +368,10 @@ void Analytor::close(RuntimeState* state) {
         _buffer.pop();
     }
     _input_chunks.clear();
+    for (auto& spilled : _spilled_chunks) {
+        spilled.spiller->cancel();
+    }
+    _spilled_chunks.clear();
     _is_closed = true;
 
     auto agg_close = [this, state]() {
@@ -421,8 +437,13 @@ Status Analytor::_prepare_processing_mode(RuntimeState* state, RuntimeProfile* r
     _process_impl = &Analytor::_materializing_process;
     std::stringstream process_mode;
     process_mode << (_need_partition_materializing ? "Materializing/" : "Streaming/");
-    process_mode << (_use_removable_cumulative_process ? "RemovableCumulative"
-                                                       : (_is_unbounded_preceding ? "Cumulative" : "ByDefinition"));
+    if (_use_removable_cumulative_process) {
+        process_mode << "RemovableCumulative";
+    } else if (_use_sliding_extreme_process) {
+        process_mode << "SlidingExtreme";
+    } else {
+        process_mode << (_is_unbounded_preceding ? "Cumulative" : "ByDefinition");
+    }
     runtime_profile->add_info_string("ProcessMode", process_mode.str());
     if (!_tnode.analytic_node.__isset.window) {
         _materializing_process_impl = &Analytor::_materializing_process_for_unbounded_frame;
@@ -615,6 +636,7 @@ Status Analytor::_add_chunk(const ChunkPtr& chunk) {
     _input_chunk_first_row_positions.emplace_back(_input_rows);
     _input_rows += chunk_size;
     _input_chunks.emplace_back(chunk);
+    _buffered_chunk_bytes += chunk->bytes_usage();
     COUNTER_ADD(_peak_buffered_rows, chunk_size);
 
     return Status::OK();
@@ -812,6 +834,8 @@ Status Analytor::_streaming_process_for_sliding_frame(RuntimeState* state) {
 
             if (_use_removable_cumulative_process) {
                 _update_window_batch_removable_cumulatively();
+            } else if (_use_sliding_extreme_process) {
+                _update_window_batch_sliding_extreme();
             } else {
                 // Update agg state in batch manner for each row.
                 _reset_window_state();
@@ -909,6 +933,13 @@ void Analytor::_materializing_process_for_sliding_frame(RuntimeState* state) {
         while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
             _update_window_batch_removable_cumulatively();
 
+            _get_window_function_result(_window_result_position(), _window_result_position() + 1);
+            _update_current_row_position(1);
+        }
+    } else if (_use_sliding_extreme_process) {
+        while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
+            _update_window_batch_sliding_extreme();
+
             _get_window_function_result(_window_result_position(), _window_result_position() + 1);
             _update_current_row_position(1);
         }
@@ -961,8 +992,56 @@ void Analytor::_update_window_batch_removable_cumulatively() {
     }
 }
 
+void Analytor::_update_window_batch_sliding_extreme() {
+    const FrameRange frame = _get_frame_range();
+    const int64_t frame_start = std::max<int64_t>(frame.start, _partition.start);
+    const int64_t frame_end = std::min<int64_t>(frame.end, _partition.end);
+
+    _reset_window_state();
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        const Column* agg_column = _agg_intput_columns[i][0].get();
+        auto& extreme = _sliding_extremes[i];
+        extreme.slide(agg_column, _removed_from_buffer_rows, _get_global_position(frame_start),
+                      _get_global_position(std::max(frame_start, frame_end)));
+        const int64_t position = extreme.extreme_position();
+        if (position < 0) {
+            // The frame has only nulls, so the reset state gives NULL.
+            continue;
+        }
+        // The min/max of the frame is the min/max of the single row of the extreme.
+        const int64_t local_position = position - _removed_from_buffer_rows;
+        _agg_functions[i]->update_batch_single_state_with_frame(
+                _agg_fn_ctxs[i], _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i], &agg_column,
+                _partition.start, _partition.end, local_position, local_position + 1);
+    }
+}
+
+void SlidingFrameExtreme::slide(const Column* column, int64_t base, int64_t frame_start, int64_t frame_end) {
+    const Column* data_column = ColumnHelper::get_data_column(column);
+    for (int64_t position = std::max(frame_start, _end); position < frame_end; position++) {
+        const int64_t row = position - base;
+        if (column->is_null(row)) {
+            continue;
+        }
+        // A candidate no better than the new row can never be the extreme of the later frames.
+        while (!_candidates.empty()) {
+            const int cmp = data_column->compare_at(_candidates.back() - base, row, *data_column, 1);
+            if (_is_max ? cmp > 0 : cmp < 0) {
+                break;
+            }
+            _candidates.pop_back();
+        }
+        _candidates.push_back(position);
+    }
+    _end = std::max(_end, frame_end);
+    while (!_candidates.empty() && _candidates.front() < frame_start) {
+        _candidates.pop_front();
+    }
+}
+
 Status Analytor::_output_result_chunk(ChunkPtr* chunk) {
     ChunkPtr output_chunk = std::move(_input_chunks[_output_chunk_index]);
+    _buffered_chunk_bytes -= output_chunk->bytes_usage();
     for (size_t i = 0; i < _result_window_columns.size(); i++) {
         output_chunk->append_column(_result_window_columns[i], _result_tuple_desc->slots()[i]->id());
     }
@@ -979,6 +1058,102 @@ Status Analytor::_output_result_chunk(ChunkPtr* chunk) {
 
     *chunk = output_chunk;
     _output_chunk_index++;
+    return _restore_output_chunk_if_spilled();
+}
+
+Status Analytor::spill_buffered_chunks(const std::shared_ptr<spill::SpillerFactory>& spill_factory,
+                                       const spill::SpilledOptions& spill_options,
+                                       const spill::SpillProcessMetrics& spill_metrics) {
+    // The chunk being output must stay in memory, and the chunks spilled before are still spilled.
+    int64_t begin = _output_chunk_index + 1;
+    if (!_spilled_chunks.empty()) {
+        begin = std::max(begin, _spilled_chunks.back().end);
+    }
+    const int64_t end = _input_chunks.size();
+    if (begin >= end) {
+        return Status::OK();
+    }
+
+    // A spiller restores the chunks with the columns of the first chunk spilled, so the chunks of one spiller
+    // must have the same nullability of columns, otherwise a new spiller is started.
+    auto same_layout = [](const Chunk& lhs, const Chunk& rhs) {
+        if (lhs.num_columns() != rhs.num_columns()) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.num_columns(); i++) {
+            if (lhs.get_column_by_index(i)->is_nullable() != rhs.get_column_by_index(i)->is_nullable()) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::shared_ptr<spill::Spiller> spiller;
+    ChunkPtr first_chunk;
+    int64_t spiller_begin = begin;
+    auto finish_spiller = [&](int64_t spiller_end) -> Status {
+        if (spiller == nullptr) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(spiller->flush<spill::SyncTaskExecutor>(_state, TRACKER_WITH_SPILLER_GUARD(_state, spiller)));
+        _spilled_chunks.push_back({std::move(spiller), spiller_begin, spiller_end, spiller_begin});
+        spiller = nullptr;
+        return Status::OK();
+    };
+
+    for (int64_t i = begin; i < end; i++) {
+        ChunkPtr chunk = std::move(_input_chunks[i]);
+        _buffered_chunk_bytes -= chunk->bytes_usage();
+        for (size_t j = 0; j < chunk->num_columns(); j++) {
+            if (chunk->get_column_by_index(j)->is_constant()) {
+                chunk->update_column_by_index(
+                        ColumnHelper::unpack_and_duplicate_const_column(chunk->num_rows(),
+                                                                        chunk->get_column_by_index(j)),
+                        j);
+            }
+        }
+        if (spiller == nullptr || !same_layout(*first_chunk, *chunk)) {
+            RETURN_IF_ERROR(finish_spiller(i));
+            spiller = spill_factory->create(spill_options);
+            spiller->set_metrics(spill_metrics);
+            RETURN_IF_ERROR(spiller->prepare(_state));
+            spiller_begin = i;
+            first_chunk = chunk;
+        }
+        RETURN_IF_ERROR(
+                spiller->spill<spill::SyncTaskExecutor>(_state, chunk, TRACKER_WITH_SPILLER_GUARD(_state, spiller)));
+    }
+    return finish_spiller(end);
+}
+
+Status Analytor::_restore_output_chunk_if_spilled() {
+    if (!_has_output() || _input_chunks[_output_chunk_index] != nullptr) {
+        return Status::OK();
+    }
+    DCHECK(!_spilled_chunks.empty());
+    auto& spilled = _spilled_chunks.front();
+    DCHECK_EQ(spilled.restored, _output_chunk_index);
+    auto& spiller = spilled.spiller;
+    if (!spilled.restoring) {
+        // Everything is flushed synchronously, so the callback acquires the input stream at once. It is deferred
+        // to here to not read back the spilled chunks before they are needed.
+        RETURN_IF_ERROR(spiller->set_flush_all_call_back<spill::SyncTaskExecutor>(
+                []() { return Status::OK(); }, _state, TRACKER_WITH_SPILLER_GUARD(_state, spiller)));
+        spilled.restoring = true;
+    }
+
+    ChunkPtr chunk;
+    while (chunk == nullptr || chunk->is_empty()) {
+        RETURN_IF_ERROR(
+                spiller->trigger_restore<spill::SyncTaskExecutor>(_state, TRACKER_WITH_SPILLER_GUARD(_state, spiller)));
+        ASSIGN_OR_RETURN(chunk,
+                         spiller->restore<spill::SyncTaskExecutor>(_state, TRACKER_WITH_SPILLER_GUARD(_state, spiller)));
+    }
+    _buffered_chunk_bytes += chunk->bytes_usage();
+    _input_chunks[_output_chunk_index] = std::move(chunk);
+    if (++spilled.restored == spilled.end) {
+        _spilled_chunks.pop_front();
+    }
     return Status::OK();
 }
 
@@ -989,6 +1164,9 @@ void Analytor::_reset_state_for_next_partition() {
     _partition.start = _partition.end;
     _current_row_position = _partition.start;
     _reset_window_state();
+    for (auto& extreme : _sliding_extremes) {
+        extreme.reset();
+    }
     DCHECK_GE(_current_row_position, 0);
 }
 
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <deque>
+#include <memory>
 #include <queue>
 #include <string>
 
@@ -28,6 +31,13 @@
 
 namespace starrocks {
 
+namespace spill {
+class Spiller;
+class SpillerFactory;
+struct SpilledOptions;
+struct SpillProcessMetrics;
+} // namespace spill
+
 class ManagedFunctionStates;
 using ManagedFunctionStatesPtr = std::unique_ptr<ManagedFunctionStates>;
 
@@ -37,6 +47,32 @@ struct FunctionTypes {
     bool is_nullable; // window function result whether is nullable
 };
 
+// The candidates of the min/max of a sliding ROWS frame, which only moves forward: the rows of the frame that are
+// not dominated by a later row, so the values of the candidates are monotonic, and the first one is the extreme.
+// Every row is pushed and popped at most once, so a frame of N rows costs O(1) per row instead of O(N).
+class SlidingFrameExtreme {
+public:
+    explicit SlidingFrameExtreme(bool is_max) : _is_max(is_max) {}
+
+    // Slide the frame to the global positions [frame_start, frame_end) of `column`, whose first row is at the
+    // global position `base`. The null rows are skipped like min/max do.
+    void slide(const Column* column, int64_t base, int64_t frame_start, int64_t frame_end);
+
+    // The global position of the min/max of the frame, or -1 if the frame is empty or has only nulls.
+    int64_t extreme_position() const { return _candidates.empty() ? -1 : _candidates.front(); }
+
+    void reset() {
+        _candidates.clear();
+        _end = 0;
+    }
+
+private:
+    const bool _is_max;
+    std::deque<int64_t> _candidates;
+    // The rows before it have been pushed.
+    int64_t _end = 0;
+};
+
 class Analytor;
 using AnalytorPtr = std::shared_ptr<Analytor>;
 using Analytors = std::vector<AnalytorPtr>;
@@ -135,6 +171,15 @@ public:
         _buffer.push(chunk);
     }
 
+    // Spill the buffered input chunks whose results are not output yet. They are restored one by one by
+    // _output_result_chunk when their turn to be output comes, so a large partition waiting for its end
+    // only keeps the columns evaluated by the window functions in memory. Only used by the spillable sink.
+    Status spill_buffered_chunks(const std::shared_ptr<spill::SpillerFactory>& spill_factory,
+                                 const spill::SpilledOptions& spill_options,
+                                 const spill::SpillProcessMetrics& spill_metrics);
+    // The bytes of the buffered input chunks that spill_buffered_chunks could release.
+    size_t spillable_bytes() const { return std::max<int64_t>(_buffered_chunk_bytes, 0); }
+
     std::string debug_string() const;
 
 private:
@@ -193,8 +238,10 @@ private:
 
     void _update_window_batch(int64_t partition_start, int64_t partition_end, int64_t frame_start, int64_t frame_end);
     void _update_window_batch_removable_cumulatively();
+    void _update_window_batch_sliding_extreme();
 
     Status _output_result_chunk(ChunkPtr* chunk);
+    Status _restore_output_chunk_if_spilled();
 
     void _reset_state_for_next_partition();
     void _reset_window_state();
@@ -290,6 +337,9 @@ private:
     // Any of these conditions is satisfied, the materializing processing is required.
     bool _need_partition_materializing = false;
     bool _use_removable_cumulative_process = false;
+    // Evaluate the min/max of a sliding ROWS frame by SlidingFrameExtreme, one per window function.
+    bool _use_sliding_extreme_process = false;
+    std::vector<SlidingFrameExtreme> _sliding_extremes;
     // When calculating window functions such as CUME_DIST and PERCENT_RANK,
     // it's necessary to specify the size of the partition.
     bool _should_set_partition_size = false;
@@ -317,6 +367,18 @@ private:
     std::vector<int64_t> _input_chunk_first_row_positions;
     int64_t _input_rows = 0;
     bool _input_eos = false;
+    // The bytes of the input chunks that are buffered in memory and not output yet
+    int64_t _buffered_chunk_bytes = 0;
+
+    // The input chunks [begin, end) are spilled by spiller, and the ones before restored are restored.
+    struct SpilledChunks {
+        std::shared_ptr<spill::Spiller> spiller;
+        int64_t begin;
+        int64_t end;
+        int64_t restored;
+        bool restoring = false;
+    };
+    std::deque<SpilledChunks> _spilled_chunks;
 
     // Temporary output related structures
     Columns _result_window_columns;
@@ -14,6 +14,7 @@
 
 #include "chunks_sorter_full_sort.h"
 
+#include "common/config.h"
 #include "exec/sorting/merge.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
@@ -111,8 +112,13 @@ Status ChunksSorterFullSort::_partial_sort(RuntimeState* state, bool done) {
         SCOPED_TIMER(_sort_timer);
         DataSegment segment(_sort_exprs, _unsorted_chunk);
         _sort_permutation.resize(0);
-        RETURN_IF_ERROR(
-                sort_and_tie_columns(state->cancelled_ref(), segment.order_by_columns, _sort_desc, &_sort_permutation));
+        if (config::enable_sort_normalized_key) {
+            RETURN_IF_ERROR(sort_and_tie_columns_by_normalized_key(state->cancelled_ref(), segment.order_by_columns,
+                                                                   _sort_desc, &_sort_permutation));
+        } else {
+            RETURN_IF_ERROR(sort_and_tie_columns(state->cancelled_ref(), segment.order_by_columns, _sort_desc,
+                                                 &_sort_permutation));
+        }
         auto sorted_chunk = _unsorted_chunk->clone_empty_with_slot(_unsorted_chunk->num_rows());
         materialize_by_permutation(sorted_chunk.get(), {_unsorted_chunk}, _sort_permutation);
         RETURN_IF_ERROR(sorted_chunk->upgrade_if_overflow());
@@ -160,9 +160,10 @@ Status ScrollParser::parse(const std::string& scroll_result, bool exactly_once)
     if (!inner_hits_node.IsArray()) {
         return Status::OK();
     }
-    _inner_hits_node.CopyFrom(inner_hits_node, _document_node.GetAllocator());
+    // the hits are read from the document in place, which lives as long as the parser
+    _inner_hits_node = &inner_hits_node;
     // how many documents contains in this batch
-    _size = _inner_hits_node.Size();
+    _size = _inner_hits_node->Size();
 
     return Status::OK();
 }
@@ -175,104 +176,121 @@ Status ScrollParser::fill_chunk(RuntimeState* state, ChunkPtr* chunk, bool* line
     *line_eos = false;
 
     *chunk = std::make_shared<Chunk>();
-    std::vector<SlotDescriptor*> slot_descs = _tuple_desc->slots();
+    const std::vector<SlotDescriptor*>& slot_descs = _tuple_desc->slots();
 
     size_t left_sz = _size - _cur_line;
     size_t fill_sz = std::min(left_sz, (size_t)state->chunk_size());
 
-    // init column information
-    for (auto& slot_desc : slot_descs) {
+    // the hits of this chunk, and their `_source` or `fields` node, nullptr if a hit has neither of them
+    std::vector<const rapidjson::Value*> hits(fill_sz);
+    std::vector<const rapidjson::Value*> lines(fill_sz);
+    std::vector<uint8_t> pure_doc_values(fill_sz);
+    for (size_t i = 0; i < fill_sz; ++i) {
+        const rapidjson::Value& obj = (*_inner_hits_node)[_cur_line + i];
+        auto source = obj.FindMember(FIELD_SOURCE);
+        auto fields = obj.FindMember(FIELD_FIELDS);
+        DCHECK(source == obj.MemberEnd() || fields == obj.MemberEnd());
+        hits[i] = &obj;
+        pure_doc_values[i] = fields != obj.MemberEnd();
+        if (source != obj.MemberEnd()) {
+            lines[i] = &source->value;
+        } else if (fields != obj.MemberEnd()) {
+            lines[i] = &fields->value;
+        } else {
+            lines[i] = nullptr;
+        }
+    }
+
+    // fill the chunk column by column, so the field name of a column is resolved once per chunk
+    for (SlotDescriptor* slot_desc : slot_descs) {
         ColumnPtr column = ColumnHelper::create_column(slot_desc->type(), slot_desc->is_nullable());
         column->reserve(fill_sz);
+        RETURN_IF_ERROR(_fill_column(slot_desc, hits, lines, pure_doc_values, column.get()));
         (*chunk)->append_column(std::move(column), slot_desc->id());
     }
+    _cur_line += fill_sz;
+    return Status::OK();
+}
 
-    auto slots = _tuple_desc->slots();
-    // TODO: we could fill chunk by column rather than row
-    for (size_t i = 0; i < fill_sz; ++i) {
-        const rapidjson::Value& obj = _inner_hits_node[_cur_line + i];
-        bool pure_doc_value = _is_pure_doc_value(obj);
-        bool has_source = obj.HasMember(FIELD_SOURCE);
-        bool has_fields = obj.HasMember(FIELD_FIELDS);
-
-        if (!has_source && !has_fields) {
-            for (size_t col_idx = 0; col_idx < slots.size(); ++col_idx) {
-                SlotDescriptor* slot_desc = slot_descs[col_idx];
-                ColumnPtr& column = (*chunk)->get_column_by_slot_id(slot_desc->id());
-                if (slot_desc->is_nullable()) {
-                    column->append_default();
-                } else {
-                    return Status::DataQualityError(
-                            fmt::format("col `{}` is not null, but value from ES is null", slot_desc->col_name()));
-                }
-            }
-            continue;
+Status ScrollParser::_fill_column(const SlotDescriptor* slot_desc, const std::vector<const rapidjson::Value*>& hits,
+                                  const std::vector<const rapidjson::Value*>& lines,
+                                  const std::vector<uint8_t>& pure_doc_values, Column* column) {
+    const std::string& col_name = slot_desc->col_name();
+    // _id field must exists in every document, this is guaranteed by ES
+    // if _id was found in tuple, we would get `_id` value from inner-hit node
+    // json-format response would like below:
+    //    "hits": {
+    //            "hits": [
+    //                {
+    //                    "_id": "UhHNc3IB8XwmcbhBk1ES",
+    //                    "_source": {
+    //                          "k": 201,
+    //                    }
+    //                }
+    //            ]
+    //        }
+    const bool is_id = col_name == FIELD_ID;
+    rapidjson::Value source_name(rapidjson::StringRef(col_name.data(), col_name.size()));
+    rapidjson::Value doc_value_name;
+    bool has_doc_value_name = false;
+    if (_doc_value_context != nullptr) {
+        auto it = _doc_value_context->find(col_name);
+        if (it != _doc_value_context->end()) {
+            doc_value_name.SetString(rapidjson::StringRef(it->second.data(), it->second.size()));
+            has_doc_value_name = true;
         }
-        DCHECK(has_source ^ has_fields);
-        const rapidjson::Value& line = has_source ? obj[FIELD_SOURCE] : obj[FIELD_FIELDS];
-
-        for (size_t col_idx = 0; col_idx < slots.size(); ++col_idx) {
-            SlotDescriptor* slot_desc = slot_descs[col_idx];
-            ColumnPtr& column = (*chunk)->get_column_by_slot_id(slot_desc->id());
-
-            // _id field must exists in every document, this is guaranteed by ES
-            // if _id was found in tuple, we would get `_id` value from inner-hit node
-            // json-format response would like below:
-            //    "hits": {
-            //            "hits": [
-            //                {
-            //                    "_id": "UhHNc3IB8XwmcbhBk1ES",
-            //                    "_source": {
-            //                          "k": 201,
-            //                    }
-            //                }
-            //            ]
-            //        }
-            if (slot_desc->col_name() == FIELD_ID) {
-                // actually this branch will not be reached, this is guaranteed by Doris FE.
-                if (pure_doc_value) {
-                    return Status::RuntimeError("obtain `_id` is not supported in doc_values mode");
-                }
-                LogicalType type = slot_desc->type().type;
-                DCHECK(type == TYPE_CHAR || type == TYPE_VARCHAR);
-
-                const auto& _id = obj[FIELD_ID];
-                Slice slice(_id.GetString(), _id.GetStringLength());
-                _append_data<TYPE_VARCHAR>(column.get(), slice);
+    }
 
+    for (size_t i = 0; i < lines.size(); ++i) {
+        if (lines[i] == nullptr) {
+            if (slot_desc->is_nullable()) {
+                column->append_default();
                 continue;
             }
+            return Status::DataQualityError(
+                    fmt::format("col `{}` is not null, but value from ES is null", slot_desc->col_name()));
+        }
+        const bool pure_doc_value = pure_doc_values[i];
 
-            // if pure_doc_value enabled, docvalue_context must contains the key
-            // todo: need move all `pure_docvalue` for every tuple outside fill_tuple
-            //  should check pure_docvalue for one table scan not every tuple
-            const char* col_name = pure_doc_value ? _doc_value_context->at(slot_desc->col_name()).c_str()
-                                                  : slot_desc->col_name().c_str();
-
-            auto has_col = line.HasMember(col_name);
-            if (has_col) {
-                const rapidjson::Value& col = line[col_name];
-                // doc value
-                bool is_null = col.IsNull() || (pure_doc_value && col.IsArray() && (col.Empty() || col[0].IsNull()));
-                if (!is_null) {
-                    // append value from ES to column
-                    RETURN_IF_ERROR(_append_value_from_json_val(column.get(), slot_desc->type(), col, pure_doc_value));
-                    continue;
-                }
-                // handle null col
-                if (slot_desc->is_nullable()) {
-                    _append_null(column.get());
-                } else {
-                    return Status::DataQualityError(
-                            fmt::format("col `{}` is not null, but value from ES is null", slot_desc->col_name()));
-                }
-            } else {
-                // if don't has col in ES , append a default value
-                _append_null(column.get());
+        if (is_id) {
+            // actually this branch will not be reached, this is guaranteed by Doris FE.
+            if (pure_doc_value) {
+                return Status::RuntimeError("obtain `_id` is not supported in doc_values mode");
             }
+            DCHECK(slot_desc->type().type == TYPE_CHAR || slot_desc->type().type == TYPE_VARCHAR);
+            const auto& _id = (*hits[i])[FIELD_ID];
+            Slice slice(_id.GetString(), _id.GetStringLength());
+            _append_data<TYPE_VARCHAR>(column, slice);
+            continue;
+        }
+
+        // if pure_doc_value enabled, docvalue_context must contains the key
+        if (pure_doc_value && !has_doc_value_name) {
+            return Status::InternalError(fmt::format("no doc value field of col `{}`", col_name));
+        }
+        const rapidjson::Value& line = *lines[i];
+        auto member = line.FindMember(pure_doc_value ? doc_value_name : source_name);
+        if (member == line.MemberEnd()) {
+            // if don't has col in ES , append a default value
+            _append_null(column);
+            continue;
+        }
+        const rapidjson::Value& col = member->value;
+        // doc value
+        bool is_null = col.IsNull() || (pure_doc_value && col.IsArray() && (col.Empty() || col[0].IsNull()));
+        if (!is_null) {
+            // append value from ES to column
+            RETURN_IF_ERROR(_append_value_from_json_val(column, slot_desc->type(), col, pure_doc_value));
+            continue;
+        }
+        // handle null col
+        if (slot_desc->is_nullable()) {
+            _append_null(column);
+        } else {
+            return Status::DataQualityError(
+                    fmt::format("col `{}` is not null, but value from ES is null", slot_desc->col_name()));
         }
     }
-    _cur_line += fill_sz;
     return Status::OK();
 }
 
@@ -283,13 +301,6 @@ void ScrollParser::set_params(const TupleDescriptor* descs, const std::map<std::
     _timezone = timezone;
 }
 
-bool ScrollParser::_is_pure_doc_value(const rapidjson::Value& obj) {
-    if (obj.HasMember(FIELD_FIELDS)) {
-        return true;
-    }
-    return false;
-}
-
 template <LogicalType type, typename CppType>
 void ScrollParser::_append_data(Column* column, CppType& value) {
     auto appender = [](auto* column, CppType& value) {
@@ -44,7 +44,11 @@ public:
                     const std::string& timezone);
 
 private:
-    static bool _is_pure_doc_value(const rapidjson::Value& obj);
+    // Appends the values of `slot_desc` of the hits to `column`, `lines` and `pure_doc_values` are the `_source` or
+    // `fields` node of the hits and whether it is `fields`.
+    Status _fill_column(const SlotDescriptor* slot_desc, const std::vector<const rapidjson::Value*>& hits,
+                        const std::vector<const rapidjson::Value*>& lines, const std::vector<uint8_t>& pure_doc_values,
+                        Column* column);
 
     template <LogicalType type, class CppType = RunTimeCppType<type>>
     static void _append_data(Column* column, CppType& value);
@@ -96,7 +100,7 @@ private:
     size_t _size;
     rapidjson::SizeType _cur_line;
     rapidjson::Document _document_node;
-    rapidjson::Value _inner_hits_node;
+    const rapidjson::Value* _inner_hits_node = nullptr;
 
     rapidjson::StringBuffer _scratch_buffer;
     rapidjson::Writer<rapidjson::StringBuffer> _temp_writer;
@@ -20,6 +20,9 @@
 
 namespace starrocks {
 
+// The distance in rows of prefetching the hash set ahead of the lookups.
+static constexpr size_t EXCEPT_HASH_SET_PREFETCH_DIST = 16;
+
 template <typename HashSet>
 Status ExceptHashSet<HashSet>::BufferState::init(RuntimeState* state) {
     buffer = mem_pool.allocate(max_one_row_size * state->chunk_size());
@@ -35,18 +38,22 @@ void ExceptHashSet<HashSet>::build_set(RuntimeState* state, const ChunkPtr& chun
     size_t chunk_size = chunk->num_rows();
     buffer_state->slice_sizes.assign(state->chunk_size(), 0);
 
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunk, exprs);
+    Columns key_columns = _evaluate_key_columns(chunk, exprs);
+    size_t cur_max_one_row_size = _get_max_serialize_size(key_columns);
     if (UNLIKELY(cur_max_one_row_size > buffer_state->max_one_row_size)) {
         buffer_state->max_one_row_size = cur_max_one_row_size;
         buffer_state->mem_pool.clear();
         buffer_state->buffer = buffer_state->mem_pool.allocate(buffer_state->max_one_row_size * state->chunk_size());
     }
 
-    _serialize_columns(chunk, exprs, chunk_size, buffer_state);
+    _serialize_columns(key_columns, chunk_size, buffer_state);
 
     for (size_t i = 0; i < chunk_size; ++i) {
+        if (i + EXCEPT_HASH_SET_PREFETCH_DIST < chunk_size) {
+            _hash_set->prefetch_hash(buffer_state->hash_values[i + EXCEPT_HASH_SET_PREFETCH_DIST]);
+        }
         ExceptSliceFlag key(buffer_state->buffer + i * buffer_state->max_one_row_size, buffer_state->slice_sizes[i]);
-        _hash_set->lazy_emplace(key, [&](const auto& ctor) {
+        _hash_set->lazy_emplace_with_hash(key, buffer_state->hash_values[i], [&](const auto& ctor) {
             uint8_t* pos = pool->allocate(key.slice.size);
             memcpy(pos, key.slice.data, key.slice.size);
             ctor(pos, key.slice.size);
@@ -66,7 +73,8 @@ Status ExceptHashSet<HashSet>::erase_duplicate_row(RuntimeState* state, const Ch
     size_t chunk_size = chunk->num_rows();
     buffer_state->slice_sizes.assign(state->chunk_size(), 0);
 
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunk, exprs);
+    Columns key_columns = _evaluate_key_columns(chunk, exprs);
+    size_t cur_max_one_row_size = _get_max_serialize_size(key_columns);
     if (UNLIKELY(cur_max_one_row_size > buffer_state->max_one_row_size)) {
         buffer_state->max_one_row_size = cur_max_one_row_size;
         buffer_state->mem_pool.clear();
@@ -77,11 +85,14 @@ Status ExceptHashSet<HashSet>::erase_duplicate_row(RuntimeState* state, const Ch
         RETURN_IF_LIMIT_EXCEEDED(state, "Except, while probe hash table.");
     }
 
-    _serialize_columns(chunk, exprs, chunk_size, buffer_state);
+    _serialize_columns(key_columns, chunk_size, buffer_state);
 
     for (size_t i = 0; i < chunk_size; ++i) {
+        if (i + EXCEPT_HASH_SET_PREFETCH_DIST < chunk_size) {
+            _hash_set->prefetch_hash(buffer_state->hash_values[i + EXCEPT_HASH_SET_PREFETCH_DIST]);
+        }
         ExceptSliceFlag key(buffer_state->buffer + i * buffer_state->max_one_row_size, buffer_state->slice_sizes[i]);
-        auto iter = _hash_set->find(key);
+        auto iter = _hash_set->find(key, buffer_state->hash_values[i]);
         if (iter != _hash_set->end()) {
             iter->deleted = true;
         }
@@ -120,10 +131,19 @@ int64_t ExceptHashSet<HashSet>::mem_usage(BufferState* buffer_state) {
 }
 
 template <typename HashSet>
-size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs) {
-    size_t max_size = 0;
+Columns ExceptHashSet<HashSet>::_evaluate_key_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs) {
+    Columns key_columns;
+    key_columns.reserve(exprs.size());
     for (auto expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get());
+        key_columns.emplace_back(EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get()));
+    }
+    return key_columns;
+}
+
+template <typename HashSet>
+size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const Columns& key_columns) {
+    size_t max_size = 0;
+    for (const auto& key_column : key_columns) {
         max_size += key_column->max_one_element_serialize_size();
         if (!key_column->is_nullable()) {
             max_size += sizeof(bool);
@@ -133,11 +153,9 @@ size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunk, co
 }
 
 template <typename HashSet>
-void ExceptHashSet<HashSet>::_serialize_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs,
-                                                size_t chunk_size, BufferState* buffer_state) {
-    for (auto expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get());
-
+void ExceptHashSet<HashSet>::_serialize_columns(const Columns& key_columns, size_t chunk_size,
+                                                BufferState* buffer_state) {
+    for (const auto& key_column : key_columns) {
         // The serialized buffer is always nullable.
         if (key_column->is_nullable()) {
             key_column->serialize_batch(buffer_state->buffer, buffer_state->slice_sizes, chunk_size,
@@ -147,6 +165,13 @@ void ExceptHashSet<HashSet>::_serialize_columns(const ChunkPtr& chunk, const std
                                                         buffer_state->max_one_row_size, nullptr, false);
         }
     }
+
+    buffer_state->hash_values.resize(chunk_size);
+    const auto& hash_function = _hash_set->hash_function();
+    for (size_t i = 0; i < chunk_size; ++i) {
+        ExceptSliceFlag key(buffer_state->buffer + i * buffer_state->max_one_row_size, buffer_state->slice_sizes[i]);
+        buffer_state->hash_values[i] = hash_function(key);
+    }
 }
 
 template class ExceptHashSet<phmap::flat_hash_set<ExceptSliceFlag, ExceptSliceFlagHash, ExceptSliceFlagEqual>>;
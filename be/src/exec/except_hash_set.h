@@ -64,6 +64,7 @@ public:
     public:
         size_t max_one_row_size{8};
         Buffer<uint32_t> slice_sizes;
+        Buffer<size_t> hash_values;
 
         MemPool mem_pool;
         uint8_t* buffer{nullptr};
@@ -89,9 +90,12 @@ public:
     int64_t mem_usage(BufferState* buffer_state);
 
 private:
-    size_t _get_max_serialize_size(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs);
-    void _serialize_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs, size_t chunk_size,
-                            BufferState* buffer_state);
+    // Evaluates the key columns of `chunk` once, they are used both to size the buffer and to serialize the keys.
+    static Columns _evaluate_key_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs);
+    static size_t _get_max_serialize_size(const Columns& key_columns);
+    // Serializes the keys of the chunk into the buffer and computes their hash values, so the hash set can be
+    // prefetched ahead of the lookups.
+    void _serialize_columns(const Columns& key_columns, size_t chunk_size, BufferState* buffer_state);
 
 private:
     std::unique_ptr<HashSet> _hash_set;
@@ -242,6 +242,17 @@ void ExchangeNode::debug_string(int indentation_level, std::stringstream* out) c
     *out << ")";
 }
 
+bool ExchangeNode::use_parallel_merge(bool is_parallel_merge, bool is_constant_lhs_ordering, int num_senders,
+                                      size_t degree_of_parallelism) {
+    if (is_parallel_merge || is_constant_lhs_ordering) {
+        return true;
+    }
+    // Merging the streams of many senders in one driver is the tail latency of the query, so they can be merged by
+    // all the drivers even if the plan does not ask for it. Off by default, the plan decides.
+    const int32_t min_senders = config::exchange_parallel_merge_min_senders;
+    return min_senders > 0 && num_senders >= min_senders && degree_of_parallelism > 1;
+}
+
 pipeline::OpFactories ExchangeNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
     auto exec_group = context->find_exec_group_by_plan_node_id(_id);
@@ -255,7 +266,8 @@ pipeline::OpFactories ExchangeNode::decompose_to_pipeline(pipeline::PipelineBuil
         exchange_source_op->set_degree_of_parallelism(context->degree_of_parallelism());
         operators.emplace_back(exchange_source_op);
     } else {
-        if (_is_parallel_merge || _sort_exec_exprs.is_constant_lhs_ordering()) {
+        if (use_parallel_merge(_is_parallel_merge, _sort_exec_exprs.is_constant_lhs_ordering(), _num_senders,
+                               context->degree_of_parallelism())) {
             auto exchange_merge_sort_source_operator = std::make_shared<ExchangeParallelMergeSourceOperatorFactory>(
                     context->next_operator_id(), id(), _num_senders, _input_row_desc, &_sort_exec_exprs, _is_asc_order,
                     _nulls_first, _offset, _limit);
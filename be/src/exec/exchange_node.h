@@ -74,6 +74,10 @@ public:
     std::vector<std::shared_ptr<pipeline::OperatorFactory>> decompose_to_pipeline(
             pipeline::PipelineBuilderContext* context) override;
 
+    // Whether a merging exchange merges the streams of its senders by all of its drivers rather than in one driver.
+    static bool use_parallel_merge(bool is_parallel_merge, bool is_constant_lhs_ordering, int num_senders,
+                                   size_t degree_of_parallelism);
+
 protected:
     void debug_string(int indentation_level, std::stringstream* out) const override;
 
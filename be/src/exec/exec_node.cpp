@@ -610,7 +610,8 @@ Status eager_prune_eval_conjuncts(const std::vector<ExprContext*>& ctxs, Chunk*
     int zero_count = 0;
 
     for (auto* ctx : ctxs) {
-        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk))
+        // The later conjuncts may be evaluated on the rows passing the previous ones only.
+        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk, zero_count > 0 ? raw_filter->data() : nullptr))
         size_t true_count = ColumnHelper::count_true_with_notnull(column);
 
         if (true_count == column->size()) {
@@ -660,21 +661,24 @@ Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, Chunk* ch
     // It's just by intuition.
     TRY_CATCH_ALLOC_SCOPE_START()
     const int eager_prune_max_column_number = 5;
-    if (filter_ptr == nullptr && chunk->num_columns() <= eager_prune_max_column_number) {
+    if (filter_ptr == nullptr && chunk->num_columns() <= eager_prune_max_column_number && !chunk->has_selection()) {
         return eager_prune_eval_conjuncts(ctxs, chunk);
     }
 
     if (!apply_filter) {
         DCHECK(filter_ptr) << "Must provide a filter if not apply it directly";
     }
-    FilterPtr filter(new Filter(chunk->num_rows(), 1));
+    // The rows filtered out by the selection of the chunk are filtered out by the conjuncts as well.
+    FilterPtr filter(chunk->has_selection() ? new Filter(*chunk->selection()) : new Filter(chunk->num_rows(), 1));
     if (filter_ptr != nullptr) {
         *filter_ptr = filter;
     }
     Filter* raw_filter = filter.get();
+    bool filtered = chunk->has_selection();
 
     for (auto* ctx : ctxs) {
-        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk))
+        // The later conjuncts may be evaluated on the rows passing the previous ones only.
+        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk, filtered ? raw_filter->data() : nullptr))
         size_t true_count = ColumnHelper::count_true_with_notnull(column);
 
         if (true_count == column->size()) {
@@ -699,6 +703,7 @@ Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, Chunk* ch
                 }
                 return Status::OK();
             }
+            filtered = true;
         }
     }
 
@@ -20,6 +20,7 @@
 #include "column/column_helper.h"
 #include "column/hash_set.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exec/csv_scanner.h"
 #include "exec/orc_scanner.h"
 #include "exec/parquet_scanner.h"
@@ -288,6 +289,15 @@ Status FileScanner::create_sequential_file(const TBrokerRangeDesc& range_desc, c
         if (params.__isset.non_blocking_read) {
             non_blocking_read = params.non_blocking_read;
         }
+        if (compression != CompressionTypePB::NO_COMPRESSION && !non_blocking_read &&
+            config::enable_stream_load_pipelined_decompression) {
+            ASSIGN_OR_RETURN(auto decompressed_pipe,
+                             start_pipelined_decompression(std::move(pipe), compression,
+                                                           _state->exec_env()->streaming_load_thread_pool()));
+            auto stream = std::make_shared<StreamLoadPipeInputStream>(std::move(decompressed_pipe), false);
+            *file = std::make_shared<SequentialFile>(std::move(stream), "stream-load-pipe");
+            return Status::OK();
+        }
         auto stream = std::make_shared<StreamLoadPipeInputStream>(std::move(pipe), non_blocking_read);
         src_file = std::make_shared<SequentialFile>(std::move(stream), "stream-load-pipe");
         break;
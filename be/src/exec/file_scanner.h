@@ -45,6 +45,10 @@ struct ScannerCounter {
 
     int64_t file_read_ns = 0;
     int64_t file_read_count = 0;
+
+    // The bytes parsed by the scanner and the time spent, excluding the file reading.
+    int64_t parse_bytes = 0;
+    int64_t parse_ns = 0;
 };
 
 class FileScanner {
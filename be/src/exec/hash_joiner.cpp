@@ -27,6 +27,7 @@
 #include "exprs/expr.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "simd/simd.h"
 #include "util/runtime_profile.h"
 
@@ -39,6 +40,7 @@ void HashJoinProbeMetrics::prepare(RuntimeProfile* runtime_profile) {
     probe_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "ProbeConjunctEvaluateTime");
     other_join_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "OtherJoinConjunctEvaluateTime");
     where_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "WhereConjunctEvaluateTime");
+    shared_hash_table_rows = ADD_COUNTER(runtime_profile, "SharedHashTableRows", TUnit::UNIT);
 }
 
 void HashJoinBuildMetrics::prepare(RuntimeProfile* runtime_profile) {
@@ -50,6 +52,7 @@ void HashJoinBuildMetrics::prepare(RuntimeProfile* runtime_profile) {
     runtime_filter_num = ADD_COUNTER(runtime_profile, "RuntimeFilterNum", TUnit::UNIT);
     build_keys_per_bucket = ADD_COUNTER(runtime_profile, "BuildKeysPerBucket%", TUnit::UNIT);
     hash_table_memory_usage = ADD_COUNTER(runtime_profile, "HashTableMemoryUsage", TUnit::BYTES);
+    build_radix_partitions = ADD_COUNTER(runtime_profile, "BuildRadixPartitions", TUnit::UNIT);
 }
 
 HashJoiner::HashJoiner(const HashJoinerParam& param)
@@ -143,6 +146,12 @@ void HashJoiner::_init_hash_table_param(HashTableParam* param) {
     param->probe_output_slots = _probe_output_slots;
     param->mor_reader_mode = _mor_reader_mode;
     param->enable_late_materialization = _enable_late_materialization;
+    // choose the radix partitioned layout for large build side, see JoinHashTableItems::init_radix_partition.
+    param->radix_partition_min_rows = static_cast<uint32_t>(
+            std::clamp<int64_t>(config::hash_join_radix_partition_min_rows, 0, std::numeric_limits<uint32_t>::max()));
+    param->parallel_build_dop = static_cast<uint32_t>(std::max(config::hash_join_parallel_build_dop, 1));
+    param->build_pool = ExecEnv::GetInstance()->hash_join_build_pool();
+    param->enable_probe_prefetch = config::enable_hash_join_probe_prefetch;
 
     std::set<SlotId> predicate_slots;
     for (ExprContext* expr_context : _conjunct_ctxs) {
@@ -207,6 +216,8 @@ Status HashJoiner::build_ht(RuntimeState* state) {
         size_t bucket_size = _hash_join_builder->hash_table().get_bucket_size();
         COUNTER_SET(build_metrics().build_buckets_counter, static_cast<int64_t>(bucket_size));
         COUNTER_SET(build_metrics().build_keys_per_bucket, static_cast<int64_t>(100 * avg_keys_per_bucket()));
+        COUNTER_SET(build_metrics().build_radix_partitions,
+                    static_cast<int64_t>(_hash_join_builder->hash_table().get_radix_partition_num()));
     }
 
     return Status::OK();
@@ -321,6 +332,8 @@ void HashJoiner::reference_hash_table(HashJoiner* src_join_builder) {
     _hash_table_build_rows = src_join_builder->_hash_table_build_rows;
     _output_probe_column_count = src_join_builder->_output_probe_column_count;
     _output_build_column_count = src_join_builder->_output_build_column_count;
+    // The table items are shared read-only with the builder, only the probe state is private to this prober.
+    COUNTER_SET(probe_metrics().shared_hash_table_rows, static_cast<int64_t>(_hash_table_build_rows));
 
     _has_referenced_hash_table = true;
 
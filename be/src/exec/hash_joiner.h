@@ -142,6 +142,8 @@ struct HashJoinProbeMetrics {
     RuntimeProfile::Counter* other_join_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* where_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
+    // rows of the hash table this prober reads from another joiner, 0 when it probes its own table.
+    RuntimeProfile::Counter* shared_hash_table_rows = nullptr;
 
     void prepare(RuntimeProfile* runtime_profile);
 };
@@ -155,6 +157,7 @@ struct HashJoinBuildMetrics {
     RuntimeProfile::Counter* runtime_filter_num = nullptr;
     RuntimeProfile::Counter* build_keys_per_bucket = nullptr;
     RuntimeProfile::Counter* hash_table_memory_usage = nullptr;
+    RuntimeProfile::Counter* build_radix_partitions = nullptr;
 
     void prepare(RuntimeProfile* runtime_profile);
 };
@@ -16,9 +16,11 @@
 
 #include "column/column_helper.h"
 #include "exec/exec_node.h"
+#include "exec/pipeline/query_context.h"
 #include "fs/hdfs/fs_hdfs.h"
 #include "io/compressed_input_stream.h"
 #include "io/shared_buffered_input_stream.h"
+#include "runtime/exec_env.h"
 #include "util/compression/stream_compression.h"
 
 namespace starrocks {
@@ -45,6 +47,15 @@ public:
         return _stream->read_at_fully(offset, data, size);
     }
 
+    Status read_at_fully_batch(const std::vector<io::ReadRange>& ranges) override {
+        SCOPED_RAW_TIMER(&_stats->io_ns);
+        for (const auto& range : ranges) {
+            _stats->io_count += 1;
+            _stats->bytes_read += range.count;
+        }
+        return _stream->read_at_fully_batch(ranges);
+    }
+
     StatusOr<std::string_view> peek(int64_t count) override {
         auto st = _stream->peek(count);
         return st;
@@ -142,6 +153,7 @@ Status HdfsScanner::_build_scanner_context() {
     ctx.split_context = _scanner_params.split_context;
     ctx.enable_split_tasks = _scanner_params.enable_split_tasks;
     ctx.connector_max_split_size = _scanner_params.connector_max_split_size;
+    ctx.global_dictmaps = _scanner_params.global_dictmaps;
     return Status::OK();
 }
 
@@ -210,8 +222,10 @@ void HdfsScanner::close() noexcept {
 
 Status HdfsScanner::open_random_access_file() {
     CHECK(_file == nullptr) << "File has already been opened";
+    RandomAccessFileOptions file_opts;
+    file_opts.modification_time = _scanner_params.modification_time;
     ASSIGN_OR_RETURN(std::unique_ptr<RandomAccessFile> raw_file,
-                     _scanner_params.fs->new_random_access_file(_scanner_params.path))
+                     _scanner_params.fs->new_random_access_file(file_opts, _scanner_params.path))
     const int64_t file_size = _scanner_params.file_size;
     raw_file->set_size(file_size);
     const std::string& filename = raw_file->filename();
@@ -235,7 +249,23 @@ Status HdfsScanner::open_random_access_file() {
         _cache_input_stream->set_enable_async_populate_mode(_scanner_params.enable_datacache_async_populate_mode);
         _cache_input_stream->set_enable_cache_io_adaptor(_scanner_params.enable_datacache_io_adaptor);
         _cache_input_stream->set_enable_block_buffer(config::datacache_block_buffer_enable);
+        const auto* tuple_desc = _scanner_params.tuple_desc;
+        if (const auto* table = tuple_desc != nullptr ? tuple_desc->table_desc() : nullptr; table != nullptr) {
+            _cache_input_stream->set_cache_tag_table(table->database() + "." + table->name());
+        }
         _shared_buffered_input_stream->set_align_size(_cache_input_stream->get_align_size());
+        auto* prefetch_pool = ExecEnv::GetInstance()->datacache_prefetch_thread_pool();
+        if (config::datacache_prefetch_enable && prefetch_pool != nullptr && _runtime_state->query_ctx() != nullptr) {
+            // The prefetching reads the file by its own stream, as the streams of the scanner are not thread-safe.
+            auto opener = [fs = _scanner_params.fs, path = _scanner_params.path,
+                           file_size]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+                ASSIGN_OR_RETURN(auto file, fs->new_random_access_file(path));
+                file->set_size(file_size);
+                return std::shared_ptr<io::SeekableInputStream>(std::move(file));
+            };
+            _cache_input_stream->enable_prefetch(prefetch_pool, std::move(opener),
+                                                 _runtime_state->query_ctx()->mutable_datacache_prefetch_bytes());
+        }
         input_stream = _cache_input_stream;
     }
 
@@ -312,7 +342,8 @@ void HdfsScanner::update_hdfs_counter(HdfsScanProfile* profile) {
             COUNTER_UPDATE(counter, statistics->value(i));
         } else if (name == HdfsReadMetricsKey::kTotalHedgedReadOps ||
                    name == HdfsReadMetricsKey::kTotalHedgedReadOpsInCurThread ||
-                   name == HdfsReadMetricsKey::kTotalHedgedReadOpsWin) {
+                   name == HdfsReadMetricsKey::kTotalHedgedReadOpsWin ||
+                   name == HdfsReadMetricsKey::kTotalFileHandleCacheHits) {
             auto&& counter = ADD_CHILD_COUNTER(runtime_profile, name, TUnit::UNIT, kHdfsIOProfileSectionPrefix);
             COUNTER_UPDATE(counter, statistics->value(i));
         }
@@ -364,6 +395,10 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->datacache_write_fail_bytes, stats.write_cache_fail_bytes);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_counter, stats.read_block_buffer_count);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_bytes, stats.read_block_buffer_bytes);
+        COUNTER_UPDATE(profile->datacache_prefetch_counter, stats.prefetch_count);
+        COUNTER_UPDATE(profile->datacache_prefetch_bytes, stats.prefetch_bytes);
+        COUNTER_UPDATE(profile->datacache_prefetch_hit_counter, stats.prefetch_hit_count);
+        COUNTER_UPDATE(profile->datacache_prefetch_waste_counter, stats.prefetch_waste_count);
 
         if (_runtime_state->query_options().__isset.query_type &&
             _runtime_state->query_options().query_type == TQueryType::LOAD) {
@@ -384,6 +419,10 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->shared_buffered_direct_io_count, _shared_buffered_input_stream->direct_io_count());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_bytes, _shared_buffered_input_stream->direct_io_bytes());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_timer, _shared_buffered_input_stream->direct_io_timer());
+        COUNTER_UPDATE(profile->shared_buffered_prefetch_io_count, _shared_buffered_input_stream->prefetch_io_count());
+        COUNTER_UPDATE(profile->shared_buffered_prefetch_io_bytes, _shared_buffered_input_stream->prefetch_io_bytes());
+        COUNTER_UPDATE(profile->shared_buffered_prefetch_wait_timer,
+                       _shared_buffered_input_stream->prefetch_wait_timer());
     }
 
     {
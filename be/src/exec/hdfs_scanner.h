@@ -25,6 +25,7 @@
 #include "io/cache_input_stream.h"
 #include "io/shared_buffered_input_stream.h"
 #include "runtime/descriptors.h"
+#include "runtime/global_dict/types.h"
 #include "runtime/runtime_state.h"
 #include "util/runtime_profile.h"
 
@@ -129,6 +130,10 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* datacache_write_fail_bytes = nullptr;
     RuntimeProfile::Counter* datacache_read_block_buffer_counter = nullptr;
     RuntimeProfile::Counter* datacache_read_block_buffer_bytes = nullptr;
+    RuntimeProfile::Counter* datacache_prefetch_counter = nullptr;
+    RuntimeProfile::Counter* datacache_prefetch_bytes = nullptr;
+    RuntimeProfile::Counter* datacache_prefetch_hit_counter = nullptr;
+    RuntimeProfile::Counter* datacache_prefetch_waste_counter = nullptr;
 
     RuntimeProfile::Counter* shared_buffered_shared_io_count = nullptr;
     RuntimeProfile::Counter* shared_buffered_shared_io_bytes = nullptr;
@@ -137,6 +142,9 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* shared_buffered_direct_io_count = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_bytes = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_timer = nullptr;
+    RuntimeProfile::Counter* shared_buffered_prefetch_io_count = nullptr;
+    RuntimeProfile::Counter* shared_buffered_prefetch_io_bytes = nullptr;
+    RuntimeProfile::Counter* shared_buffered_prefetch_wait_timer = nullptr;
 
     RuntimeProfile::Counter* app_io_bytes_read_counter = nullptr;
     RuntimeProfile::Counter* app_io_timer = nullptr;
@@ -223,6 +231,10 @@ struct HdfsScannerParams {
     MORParams mor_params;
 
     int64_t connector_max_split_size = 0;
+
+    // The query global dicts of the string slots of the low-cardinality optimization, by slot id. Those slots
+    // are of LowCardDictType and are filled with the codes of the global dicts.
+    const ColumnIdToGlobalDictMap* global_dictmaps = nullptr;
 };
 
 struct HdfsScannerContext {
@@ -296,6 +308,8 @@ struct HdfsScannerContext {
 
     int64_t connector_max_split_size = 0;
 
+    const ColumnIdToGlobalDictMap* global_dictmaps = nullptr;
+
     // update materialized column against data file.
     // and to update not_existed slots and conjuncts.
     // and to update `conjunct_ctxs_by_slot` field.
@@ -24,6 +24,7 @@
 #include "formats/orc/orc_min_max_decoder.h"
 #include "formats/orc/utils.h"
 #include "gen_cpp/orc_proto.pb.h"
+#include "runtime/exec_env.h"
 #include "simd/simd.h"
 #include "storage/chunk_helper.h"
 #include "util/runtime_profile.h"
@@ -323,7 +324,7 @@ Status HdfsOrcScanner::build_iceberg_delete_builder() {
     SCOPED_RAW_TIMER(&_app_stats.iceberg_delete_file_build_ns);
     const IcebergDeleteBuilder iceberg_delete_builder(_scanner_params.fs, _scanner_params.path,
                                                       _scanner_params.conjunct_ctxs, _scanner_params.materialize_slots,
-                                                      &_need_skip_rowids);
+                                                      &_need_skip_rowids, IcebergDeleteCache::get(_runtime_state));
 
     for (const auto& tdelete_file : _scanner_params.deletes) {
         RETURN_IF_ERROR(iceberg_delete_builder.build_orc(_runtime_state->timezone(), *tdelete_file,
@@ -490,6 +491,14 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
     }
 
     RETURN_IF_ERROR(build_io_ranges(orc_hdfs_file_stream, stripes));
+    if (auto* pool = ExecEnv::GetInstance()->scan_io_prefetch_thread_pool();
+        config::orc_stripe_prefetch_enable && pool != nullptr && stripes.size() >= 2 &&
+        !_scanner_params.use_datacache && _shared_buffered_input_stream != nullptr) {
+        // Datacache has its own prefetching, and the shared buffers are not read by the hits of the cache.
+        _shared_buffered_input_stream->enable_prefetch(pool);
+        orc_hdfs_file_stream->enable_stripe_prefetch(_scanner_ctx.scan_range->offset,
+                                                     _scanner_ctx.scan_range->offset + _scanner_ctx.scan_range->length);
+    }
     RETURN_IF_ERROR(resolve_columns(reader.get()));
     if (_should_skip_file) {
         return Status::OK();
@@ -507,6 +516,7 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
     _orc_reader->set_hive_column_names(_scanner_ctx.hive_column_names);
     _orc_reader->set_case_sensitive(_scanner_ctx.case_sensitive);
     _orc_reader->set_use_orc_column_names(_scanner_ctx.orc_use_column_names);
+    _orc_reader->set_dict_string_direct_decode(config::orc_dict_string_direct_decode_enable);
     // for hive table, we set this flag
     _orc_reader->set_invalid_as_null(true);
     if (config::enable_orc_late_materialization && _lazy_load_ctx.lazy_load_slots.size() != 0 &&
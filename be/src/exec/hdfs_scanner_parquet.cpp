@@ -18,6 +18,7 @@
 #include "exec/iceberg/iceberg_delete_builder.h"
 #include "formats/parquet/file_reader.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -29,7 +30,8 @@ Status HdfsParquetScanner::do_init(RuntimeState* runtime_state, const HdfsScanne
         SCOPED_RAW_TIMER(&_app_stats.iceberg_delete_file_build_ns);
         std::unique_ptr<IcebergDeleteBuilder> iceberg_delete_builder(
                 new IcebergDeleteBuilder(scanner_params.fs, scanner_params.path, scanner_params.conjunct_ctxs,
-                                         scanner_params.materialize_slots, &_need_skip_rowids));
+                                         scanner_params.materialize_slots, &_need_skip_rowids,
+                                         IcebergDeleteCache::get(runtime_state)));
         for (const auto& tdelete_file : scanner_params.deletes) {
             RETURN_IF_ERROR(iceberg_delete_builder->build_parquet(
                     runtime_state->timezone(), *tdelete_file, scanner_params.mor_params.equality_slots,
@@ -146,6 +148,12 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
 
 Status HdfsParquetScanner::do_open(RuntimeState* runtime_state) {
     RETURN_IF_ERROR(open_random_access_file());
+    if (auto* pool = ExecEnv::GetInstance()->scan_io_prefetch_thread_pool();
+        config::parquet_row_group_prefetch_enable && pool != nullptr && !_scanner_params.use_datacache &&
+        _shared_buffered_input_stream != nullptr) {
+        // Datacache has its own prefetching, and the shared buffers are not read by the hits of the cache.
+        _shared_buffered_input_stream->enable_prefetch(pool);
+    }
     // create file reader
     _reader = std::make_shared<parquet::FileReader>(runtime_state->chunk_size(), _file.get(), _file->get_size().value(),
                                                     _scanner_params.modification_time,
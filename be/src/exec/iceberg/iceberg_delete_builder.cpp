@@ -14,6 +14,8 @@
 
 #include "exec/iceberg/iceberg_delete_builder.h"
 
+#include <algorithm>
+
 #include "column/vectorized_fwd.h"
 #include "exec/hdfs_scanner.h"
 #include "exec/iceberg/iceberg_delete_file_iterator.h"
@@ -38,8 +40,57 @@ static const IcebergColumnMeta k_delete_file_path{
 static const IcebergColumnMeta k_delete_file_pos{
         .id = INT32_MAX - 102, .col_name = "pos", .type = TPrimitiveType::BIGINT};
 
-Status ParquetPositionDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
-                                           int64_t file_length, std::set<int64_t>* need_skip_rowids) {
+Status PositionDeleteBuilder::build(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                                    std::set<int64_t>* need_skip_rowids) {
+    return read(timezone, file_path, file_length, [&](const Slice& datafile_path, int64_t pos) {
+        if (datafile_path == _datafile_path) {
+            need_skip_rowids->emplace(pos);
+        }
+    });
+}
+
+Status PositionDeleteBuilder::build_all(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                                        IcebergPositionDeletes* positions) {
+    // the rows of a position delete file are sorted by the data file path, so look up each data file once.
+    std::string last_datafile_path;
+    std::vector<int64_t>* last_positions = nullptr;
+    RETURN_IF_ERROR(read(timezone, file_path, file_length, [&](const Slice& datafile_path, int64_t pos) {
+        if (last_positions == nullptr || datafile_path != last_datafile_path) {
+            last_datafile_path = datafile_path.to_string();
+            last_positions = &(*positions)[last_datafile_path];
+        }
+        last_positions->emplace_back(pos);
+    }));
+    for (auto& [_, datafile_positions] : *positions) {
+        std::sort(datafile_positions.begin(), datafile_positions.end());
+        datafile_positions.erase(std::unique(datafile_positions.begin(), datafile_positions.end()),
+                                 datafile_positions.end());
+    }
+    return Status::OK();
+}
+
+Status EqualityDeleteBuilder::build(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                                    const std::shared_ptr<DefaultMORProcessor>& mor_processor,
+                                    std::vector<SlotDescriptor*> slots, TupleDescriptor* delete_column_tuple_desc,
+                                    const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state) {
+    return read(timezone, file_path, file_length, std::move(slots), delete_column_tuple_desc,
+                iceberg_equal_delete_schema, state,
+                [&](ChunkPtr& chunk) { return mor_processor->append_chunk_to_hashtable(chunk); });
+}
+
+Status EqualityDeleteBuilder::build_all(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                                        std::vector<SlotDescriptor*> slots, TupleDescriptor* delete_column_tuple_desc,
+                                        const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
+                                        std::vector<ChunkPtr>* chunks) {
+    return read(timezone, file_path, file_length, std::move(slots), delete_column_tuple_desc,
+                iceberg_equal_delete_schema, state, [&](ChunkPtr& chunk) {
+                    chunks->emplace_back(chunk);
+                    return Status::OK();
+                });
+}
+
+Status ParquetPositionDeleteBuilder::read(const std::string& timezone, const std::string& delete_file_path,
+                                          int64_t file_length, const PositionConsumer& consumer) {
     std::vector<SlotDescriptor*> slot_descriptors{&(IcebergDeleteFileMeta::get_delete_file_path_slot()),
                                                   &(IcebergDeleteFileMeta::get_delete_file_pos_slot())};
     auto iter = std::make_unique<IcebergDeleteFileIterator>();
@@ -57,9 +108,8 @@ Status ParquetPositionDeleteBuilder::build(const std::string& timezone, const st
         ::arrow::StringArray* file_path_array = static_cast<arrow::StringArray*>(batch->column(0).get());
         ::arrow::Int64Array* pos_array = static_cast<arrow::Int64Array*>(batch->column(1).get());
         for (size_t row = 0; row < batch->num_rows(); row++) {
-            if (file_path_array->Value(row) == _datafile_path) {
-                need_skip_rowids->emplace(pos_array->Value(row));
-            }
+            auto file_path = file_path_array->Value(row);
+            consumer(Slice(file_path.data(), file_path.size()), pos_array->Value(row));
         }
     }
 
@@ -71,8 +121,8 @@ Status ParquetPositionDeleteBuilder::build(const std::string& timezone, const st
     return Status::OK();
 }
 
-Status ORCPositionDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
-                                       int64_t file_length, std::set<int64_t>* need_skip_rowids) {
+Status ORCPositionDeleteBuilder::read(const std::string& timezone, const std::string& delete_file_path,
+                                      int64_t file_length, const PositionConsumer& consumer) {
     std::vector<SlotDescriptor*> slot_descriptors{&(IcebergDeleteFileMeta::get_delete_file_path_slot()),
                                                   &(IcebergDeleteFileMeta::get_delete_file_pos_slot())};
 
@@ -125,19 +175,16 @@ Status ORCPositionDeleteBuilder::build(const std::string& timezone, const std::s
         auto* file_path_col = static_cast<BinaryColumn*>(chunk->get_column_by_slot_id(k_delete_file_path.id).get());
         auto* position_col = static_cast<Int64Column*>(chunk->get_column_by_slot_id(k_delete_file_pos.id).get());
         for (auto row = 0; row < chunk_size; row++) {
-            if (file_path_col->get_slice(row) != _datafile_path) {
-                continue;
-            }
-            need_skip_rowids->emplace(position_col->get_data()[row]);
+            consumer(file_path_col->get_slice(row), position_col->get_data()[row]);
         }
     }
 }
 
-Status ORCEqualityDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
-                                       int64_t file_length, const std::shared_ptr<DefaultMORProcessor> mor_processor,
-                                       std::vector<SlotDescriptor*> slot_descs,
-                                       TupleDescriptor* delete_column_tuple_desc,
-                                       const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state) {
+Status ORCEqualityDeleteBuilder::read(const std::string& timezone, const std::string& delete_file_path,
+                                      int64_t file_length, std::vector<SlotDescriptor*> slot_descs,
+                                      TupleDescriptor* delete_column_tuple_desc,
+                                      const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
+                                      const ChunkConsumer& consumer) {
     std::unique_ptr<RandomAccessFile> file;
     ASSIGN_OR_RETURN(file, _fs->new_random_access_file(delete_file_path));
 
@@ -175,17 +222,16 @@ Status ORCEqualityDeleteBuilder::build(const std::string& timezone, const std::s
         }
 
         ChunkPtr chunk = ret.value();
-        RETURN_IF_ERROR(mor_processor->append_chunk_to_hashtable(chunk));
+        RETURN_IF_ERROR(consumer(chunk));
     }
     return Status::OK();
 }
 
-Status ParquetEqualityDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
-                                           int64_t file_length,
-                                           const std::shared_ptr<DefaultMORProcessor> mor_processor,
-                                           std::vector<SlotDescriptor*> slot_descs,
-                                           TupleDescriptor* delete_column_tuple_desc,
-                                           const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state) {
+Status ParquetEqualityDeleteBuilder::read(const std::string& timezone, const std::string& delete_file_path,
+                                          int64_t file_length, std::vector<SlotDescriptor*> slot_descs,
+                                          TupleDescriptor* delete_column_tuple_desc,
+                                          const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
+                                          const ChunkConsumer& consumer) {
     std::unique_ptr<RandomAccessFile> file;
     ASSIGN_OR_RETURN(file, _fs->new_random_access_file(delete_file_path));
 
@@ -230,8 +276,51 @@ Status ParquetEqualityDeleteBuilder::build(const std::string& timezone, const st
         }
 
         RETURN_IF_ERROR(status);
-        ChunkPtr& result = chunk;
-        RETURN_IF_ERROR(mor_processor->append_chunk_to_hashtable(result));
+        RETURN_IF_ERROR(consumer(chunk));
+    }
+    return Status::OK();
+}
+
+Status IcebergDeleteBuilder::_build_position_deletes(PositionDeleteBuilder* builder, const std::string& timezone,
+                                                     const TIcebergDeleteFile& delete_file) const {
+    if (_cache == nullptr) {
+        return builder->build(timezone, delete_file.full_path, delete_file.length, _need_skip_rowids);
+    }
+    ASSIGN_OR_RETURN(auto positions,
+                     _cache->get_position_deletes(delete_file.full_path, [&](IcebergPositionDeletes* positions) {
+                         return builder->build_all(timezone, delete_file.full_path, delete_file.length, positions);
+                     }));
+    auto iter = positions->find(_datafile_path);
+    if (iter != positions->end()) {
+        _need_skip_rowids->insert(iter->second.begin(), iter->second.end());
+    }
+    return Status::OK();
+}
+
+Status IcebergDeleteBuilder::_build_equality_deletes(EqualityDeleteBuilder* builder, const std::string& timezone,
+                                                     const TIcebergDeleteFile& delete_file,
+                                                     const std::vector<SlotDescriptor*>& slots,
+                                                     TupleDescriptor* delete_column_tuple_desc,
+                                                     const TIcebergSchema* iceberg_equal_delete_schema,
+                                                     RuntimeState* state,
+                                                     const std::shared_ptr<DefaultMORProcessor>& mor_processor) const {
+    if (_cache == nullptr) {
+        return builder->build(timezone, delete_file.full_path, delete_file.length, mor_processor, slots,
+                              delete_column_tuple_desc, iceberg_equal_delete_schema, state);
+    }
+    // the same delete file may be read into different slots by the scan nodes of a query
+    std::string key = delete_file.full_path;
+    for (const auto* slot : slots) {
+        key.append("#").append(std::to_string(slot->id()));
+    }
+    ASSIGN_OR_RETURN(auto chunks, _cache->get_equality_deletes(key, [&](std::vector<ChunkPtr>* chunks) {
+        return builder->build_all(timezone, delete_file.full_path, delete_file.length, slots,
+                                  delete_column_tuple_desc, iceberg_equal_delete_schema, state, chunks);
+    }));
+    for (const auto& chunk : *chunks) {
+        // the hash table may take over the columns of the chunk, so it gets a copy of the shared one
+        ChunkPtr copy = chunk->clone_unique();
+        RETURN_IF_ERROR(mor_processor->append_chunk_to_hashtable(copy));
     }
     return Status::OK();
 }
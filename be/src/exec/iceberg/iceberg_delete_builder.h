@@ -14,9 +14,11 @@
 
 #pragma once
 
+#include <functional>
 #include <utility>
 
 #include "common/status.h"
+#include "exec/iceberg/iceberg_delete_cache.h"
 #include "exec/mor_processor.h"
 #include "exec/parquet_scanner.h"
 #include "fs/fs.h"
@@ -28,11 +30,25 @@ struct IcebergColumnMeta;
 
 class PositionDeleteBuilder {
 public:
-    PositionDeleteBuilder() = default;
+    explicit PositionDeleteBuilder(std::string datafile_path) : _datafile_path(std::move(datafile_path)) {}
     virtual ~PositionDeleteBuilder() = default;
 
-    virtual Status build(const std::string& timezone, const std::string& file_path, int64_t file_length,
-                         std::set<int64_t>* need_skip_rowids) = 0;
+    // Collects the positions of the data file of this builder deleted by the delete file.
+    Status build(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                 std::set<int64_t>* need_skip_rowids);
+
+    // Collects the positions of all the data files deleted by the delete file.
+    Status build_all(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                     IcebergPositionDeletes* positions);
+
+protected:
+    using PositionConsumer = std::function<void(const Slice& datafile_path, int64_t pos)>;
+
+    // Passes every (file_path, pos) row of the delete file to `consumer`.
+    virtual Status read(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                        const PositionConsumer& consumer) = 0;
+
+    const std::string _datafile_path;
 };
 
 class EqualityDeleteBuilder {
@@ -40,10 +56,25 @@ public:
     EqualityDeleteBuilder() = default;
     virtual ~EqualityDeleteBuilder() = default;
 
-    virtual Status build(const std::string& timezone, const std::string& file_path, int64_t file_length,
-                         std::shared_ptr<DefaultMORProcessor> mor_processor, std::vector<SlotDescriptor*> slots,
-                         TupleDescriptor* delete_column_tuple_desc, const TIcebergSchema* iceberg_equal_delete_schema,
-                         RuntimeState* state) = 0;
+    Status build(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                 const std::shared_ptr<DefaultMORProcessor>& mor_processor, std::vector<SlotDescriptor*> slots,
+                 TupleDescriptor* delete_column_tuple_desc, const TIcebergSchema* iceberg_equal_delete_schema,
+                 RuntimeState* state);
+
+    // Collects the rows of the delete file into `chunks`.
+    Status build_all(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                     std::vector<SlotDescriptor*> slots, TupleDescriptor* delete_column_tuple_desc,
+                     const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
+                     std::vector<ChunkPtr>* chunks);
+
+protected:
+    using ChunkConsumer = std::function<Status(ChunkPtr& chunk)>;
+
+    // Passes the rows of the delete file to `consumer` chunk by chunk.
+    virtual Status read(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                        std::vector<SlotDescriptor*> slots, TupleDescriptor* delete_column_tuple_desc,
+                        const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
+                        const ChunkConsumer& consumer) = 0;
 };
 
 class ORCEqualityDeleteBuilder : public EqualityDeleteBuilder {
@@ -52,10 +83,11 @@ public:
             : _fs(fs), _datafile_path(std::move(datafile_path)) {}
     ~ORCEqualityDeleteBuilder() override = default;
 
-    Status build(const std::string& timezone, const std::string& file_path, int64_t file_length,
-                 std::shared_ptr<DefaultMORProcessor> mor_processor, std::vector<SlotDescriptor*> slots,
-                 TupleDescriptor* delete_column_tuple_desc, const TIcebergSchema* iceberg_equal_delete_schema,
-                 RuntimeState* stage) override;
+protected:
+    Status read(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                std::vector<SlotDescriptor*> slots, TupleDescriptor* delete_column_tuple_desc,
+                const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
+                const ChunkConsumer& consumer) override;
 
 private:
     FileSystem* _fs;
@@ -68,10 +100,11 @@ public:
             : _fs(fs), _datafile_path(std::move(datafile_path)) {}
     ~ParquetEqualityDeleteBuilder() override = default;
 
-    Status build(const std::string& timezone, const std::string& file_path, int64_t file_length,
-                 std::shared_ptr<DefaultMORProcessor> mor_processor, std::vector<SlotDescriptor*> slots,
-                 TupleDescriptor* delete_column_tuple_desc, const TIcebergSchema* iceberg_equal_delete_schema,
-                 RuntimeState* stage) override;
+protected:
+    Status read(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                std::vector<SlotDescriptor*> slots, TupleDescriptor* delete_column_tuple_desc,
+                const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
+                const ChunkConsumer& consumer) override;
 
 private:
     FileSystem* _fs;
@@ -82,52 +115,54 @@ private:
 class ORCPositionDeleteBuilder : public PositionDeleteBuilder {
 public:
     ORCPositionDeleteBuilder(FileSystem* fs, std::string datafile_path)
-            : _fs(fs), _datafile_path(std::move(datafile_path)) {}
+            : PositionDeleteBuilder(std::move(datafile_path)), _fs(fs) {}
     ~ORCPositionDeleteBuilder() override = default;
 
-    Status build(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
-                 std::set<int64_t>* need_skip_rowids) override;
+protected:
+    Status read(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
+                const PositionConsumer& consumer) override;
 
 private:
     FileSystem* _fs;
-    std::string _datafile_path;
 };
 
 class ParquetPositionDeleteBuilder : public PositionDeleteBuilder {
 public:
     ParquetPositionDeleteBuilder(FileSystem* fs, std::string datafile_path)
-            : _fs(fs), _datafile_path(std::move(datafile_path)) {}
+            : PositionDeleteBuilder(std::move(datafile_path)), _fs(fs) {}
     ~ParquetPositionDeleteBuilder() override = default;
 
-    Status build(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
-                 std::set<int64_t>* need_skip_rowids) override;
+protected:
+    Status read(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
+                const PositionConsumer& consumer) override;
 
 private:
     FileSystem* _fs;
-    std::string _datafile_path;
 };
 
 class IcebergDeleteBuilder {
 public:
     IcebergDeleteBuilder(FileSystem* fs, std::string datafile_path, std::vector<ExprContext*> conjunct_ctxs,
-                         std::vector<SlotDescriptor*> materialize_slots, std::set<int64_t>* need_skip_rowids)
+                         std::vector<SlotDescriptor*> materialize_slots, std::set<int64_t>* need_skip_rowids,
+                         IcebergDeleteCache* cache = nullptr)
             : _fs(fs),
               _datafile_path(std::move(datafile_path)),
               _conjunct_ctxs(std::move(conjunct_ctxs)),
               _materialize_slots(std::move(materialize_slots)),
-              _need_skip_rowids(need_skip_rowids) {}
+              _need_skip_rowids(need_skip_rowids),
+              _cache(cache) {}
     ~IcebergDeleteBuilder() = default;
 
     Status build_orc(const std::string& timezone, const TIcebergDeleteFile& delete_file,
                      const std::vector<SlotDescriptor*>& slots, RuntimeState* state,
                      std::shared_ptr<DefaultMORProcessor> mor_processor) const {
         if (delete_file.file_content == TIcebergFileContent::POSITION_DELETES) {
-            return ORCPositionDeleteBuilder(_fs, _datafile_path)
-                    .build(timezone, delete_file.full_path, delete_file.length, _need_skip_rowids);
+            ORCPositionDeleteBuilder builder(_fs, _datafile_path);
+            return _build_position_deletes(&builder, timezone, delete_file);
         } else if (delete_file.file_content == TIcebergFileContent::EQUALITY_DELETES) {
-            return ORCEqualityDeleteBuilder(_fs, _datafile_path)
-                    .build(timezone, delete_file.full_path, delete_file.length, std::move(mor_processor),
-                           std::move(slots), nullptr, nullptr, state);
+            ORCEqualityDeleteBuilder builder(_fs, _datafile_path);
+            return _build_equality_deletes(&builder, timezone, delete_file, slots, nullptr, nullptr, state,
+                                           mor_processor);
         } else {
             const auto s = strings::Substitute("Unsupported iceberg file content: $0", delete_file.file_content);
             LOG(WARNING) << s;
@@ -140,12 +175,12 @@ public:
                          const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
                          std::shared_ptr<DefaultMORProcessor> mor_processor) const {
         if (delete_file.file_content == TIcebergFileContent::POSITION_DELETES) {
-            return ParquetPositionDeleteBuilder(_fs, _datafile_path)
-                    .build(timezone, delete_file.full_path, delete_file.length, _need_skip_rowids);
+            ParquetPositionDeleteBuilder builder(_fs, _datafile_path);
+            return _build_position_deletes(&builder, timezone, delete_file);
         } else if (delete_file.file_content == TIcebergFileContent::EQUALITY_DELETES) {
-            return ParquetEqualityDeleteBuilder(_fs, _datafile_path)
-                    .build(timezone, delete_file.full_path, delete_file.length, std::move(mor_processor),
-                           std::move(slots), delete_column_tuple_desc, iceberg_equal_delete_schema, state);
+            ParquetEqualityDeleteBuilder builder(_fs, _datafile_path);
+            return _build_equality_deletes(&builder, timezone, delete_file, slots, delete_column_tuple_desc,
+                                           iceberg_equal_delete_schema, state, mor_processor);
         } else {
             auto s = strings::Substitute("Unsupported iceberg file content: $0", delete_file.file_content);
             LOG(WARNING) << s;
@@ -154,11 +189,21 @@ public:
     }
 
 private:
+    // Builds the deletes of the data file by `builder` directly, or from the delete file shared in `_cache`.
+    Status _build_position_deletes(PositionDeleteBuilder* builder, const std::string& timezone,
+                                   const TIcebergDeleteFile& delete_file) const;
+    Status _build_equality_deletes(EqualityDeleteBuilder* builder, const std::string& timezone,
+                                   const TIcebergDeleteFile& delete_file, const std::vector<SlotDescriptor*>& slots,
+                                   TupleDescriptor* delete_column_tuple_desc,
+                                   const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
+                                   const std::shared_ptr<DefaultMORProcessor>& mor_processor) const;
+
     FileSystem* _fs;
     std::string _datafile_path;
     std::vector<ExprContext*> _conjunct_ctxs;
     std::vector<SlotDescriptor*> _materialize_slots;
     std::set<int64_t>* _need_skip_rowids;
+    IcebergDeleteCache* _cache;
 };
 
 class IcebergDeleteFileMeta {
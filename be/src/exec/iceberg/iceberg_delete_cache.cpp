@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/iceberg/iceberg_delete_cache.h"
+
+#include "common/config.h"
+#include "exec/pipeline/query_context.h"
+#include "runtime/current_thread.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks {
+
+IcebergDeleteCache* IcebergDeleteCache::get(RuntimeState* state) {
+    if (!config::iceberg_delete_file_cache_enable || state == nullptr || state->query_ctx() == nullptr) {
+        return nullptr;
+    }
+    return state->query_ctx()->iceberg_delete_cache();
+}
+
+template <typename T>
+StatusOr<std::shared_ptr<const T>> IcebergDeleteCache::_get_or_load(Entries<T>* entries, const std::string& key,
+                                                                     const std::function<Status(T*)>& loader) {
+    std::shared_ptr<Entry<T>> entry;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        auto& slot = (*entries)[key];
+        if (slot == nullptr) {
+            slot = std::make_shared<Entry<T>>();
+        }
+        entry = slot;
+    }
+    // the other scanners of the same delete file wait here until it is loaded
+    std::call_once(entry->once, [&]() {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+        auto value = std::make_shared<T>();
+        entry->status = loader(value.get());
+        if (entry->status.ok()) {
+            entry->value = std::move(value);
+        }
+    });
+    RETURN_IF_ERROR(entry->status);
+    return entry->value;
+}
+
+StatusOr<std::shared_ptr<const IcebergPositionDeletes>> IcebergDeleteCache::get_position_deletes(
+        const std::string& delete_file_path, const PositionLoader& loader) {
+    return _get_or_load(&_position_deletes, delete_file_path, loader);
+}
+
+StatusOr<std::shared_ptr<const std::vector<ChunkPtr>>> IcebergDeleteCache::get_equality_deletes(
+        const std::string& key, const EqualityLoader& loader) {
+    return _get_or_load(&_equality_deletes, key, loader);
+}
+
+size_t IcebergDeleteCache::num_loaded() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _position_deletes.size() + _equality_deletes.size();
+}
+
+} // namespace starrocks
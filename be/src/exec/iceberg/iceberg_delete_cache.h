@@ -0,0 +1,83 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+class MemTracker;
+class RuntimeState;
+
+// The positions deleted by a position delete file, by the data files they belong to, in ascending order.
+using IcebergPositionDeletes = phmap::flat_hash_map<std::string, std::vector<int64_t>>;
+
+// The delete files read by the scanners of a query. A delete file of an iceberg table usually applies to many data
+// files, and a data file is usually split into many scan ranges, so without the cache every scan range reads all of
+// its delete files again. The first scanner which needs a delete file loads it, the other ones wait for it and share
+// the result until the query finishes.
+class IcebergDeleteCache {
+public:
+    // The loaded memory is accounted to `mem_tracker`, which should outlive the cache.
+    explicit IcebergDeleteCache(MemTracker* mem_tracker) : _mem_tracker(mem_tracker) {}
+
+    // Returns the cache of the query of `state`, or nullptr if there is no query context or the cache is disabled.
+    static IcebergDeleteCache* get(RuntimeState* state);
+
+    using PositionLoader = std::function<Status(IcebergPositionDeletes*)>;
+    using EqualityLoader = std::function<Status(std::vector<ChunkPtr>*)>;
+
+    // Returns the positions deleted by the position delete file `delete_file_path`, loaded by `loader` if absent.
+    StatusOr<std::shared_ptr<const IcebergPositionDeletes>> get_position_deletes(const std::string& delete_file_path,
+                                                                                 const PositionLoader& loader);
+
+    // Returns the rows of the equality delete file of `key`, loaded by `loader` if absent. The chunks are shared,
+    // callers should not modify them.
+    StatusOr<std::shared_ptr<const std::vector<ChunkPtr>>> get_equality_deletes(const std::string& key,
+                                                                                const EqualityLoader& loader);
+
+    // The number of delete files loaded, for tests.
+    size_t num_loaded() const;
+
+private:
+    template <typename T>
+    struct Entry {
+        std::once_flag once;
+        Status status;
+        std::shared_ptr<const T> value;
+    };
+
+    template <typename T>
+    using Entries = phmap::flat_hash_map<std::string, std::shared_ptr<Entry<T>>>;
+
+    template <typename T>
+    StatusOr<std::shared_ptr<const T>> _get_or_load(Entries<T>* entries, const std::string& key,
+                                                    const std::function<Status(T*)>& loader);
+
+    MemTracker* _mem_tracker;
+    mutable std::mutex _mutex;
+    Entries<IcebergPositionDeletes> _position_deletes;
+    Entries<std::vector<ChunkPtr>> _equality_deletes;
+};
+
+} // namespace starrocks
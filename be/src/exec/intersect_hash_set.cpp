@@ -19,6 +19,10 @@
 #include "util/phmap/phmap_dump.h"
 
 namespace starrocks {
+
+// The distance in rows of prefetching the hash set ahead of the lookups.
+static constexpr size_t INTERSECT_HASH_SET_PREFETCH_DIST = 16;
+
 template <typename HashSet>
 Status IntersectHashSet<HashSet>::init(RuntimeState* state) {
     _hash_set = std::make_unique<HashSet>();
@@ -34,18 +38,22 @@ void IntersectHashSet<HashSet>::build_set(RuntimeState* state, const ChunkPtr& c
     size_t chunk_size = chunkPtr->num_rows();
 
     _slice_sizes.assign(state->chunk_size(), 0);
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunkPtr, exprs);
+    Columns key_columns = _evaluate_key_columns(chunkPtr, exprs);
+    size_t cur_max_one_row_size = _get_max_serialize_size(key_columns);
     if (UNLIKELY(cur_max_one_row_size > _max_one_row_size)) {
         _max_one_row_size = cur_max_one_row_size;
         _mem_pool->clear();
         _buffer = _mem_pool->allocate(_max_one_row_size * state->chunk_size());
     }
 
-    _serialize_columns(chunkPtr, exprs, chunk_size);
+    _serialize_columns(key_columns, chunk_size);
 
     for (size_t i = 0; i < chunk_size; ++i) {
+        if (i + INTERSECT_HASH_SET_PREFETCH_DIST < chunk_size) {
+            _hash_set->prefetch_hash(_hash_values[i + INTERSECT_HASH_SET_PREFETCH_DIST]);
+        }
         IntersectSliceFlag key(_buffer + i * _max_one_row_size, _slice_sizes[i]);
-        _hash_set->lazy_emplace(key, [&](const auto& ctor) {
+        _hash_set->lazy_emplace_with_hash(key, _hash_values[i], [&](const auto& ctor) {
             // we must persist the slice before insert
             uint8_t* pos = pool->allocate(key.slice.size);
             memcpy(pos, key.slice.data, key.slice.size);
@@ -59,7 +67,8 @@ Status IntersectHashSet<HashSet>::refine_intersect_row(RuntimeState* state, cons
                                                        const std::vector<ExprContext*>& exprs, const int hit_times) {
     size_t chunk_size = chunkPtr->num_rows();
     _slice_sizes.assign(state->chunk_size(), 0);
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunkPtr, exprs);
+    Columns key_columns = _evaluate_key_columns(chunkPtr, exprs);
+    size_t cur_max_one_row_size = _get_max_serialize_size(key_columns);
     if (UNLIKELY(cur_max_one_row_size > _max_one_row_size)) {
         _max_one_row_size = cur_max_one_row_size;
         _mem_pool->clear();
@@ -70,11 +79,14 @@ Status IntersectHashSet<HashSet>::refine_intersect_row(RuntimeState* state, cons
         RETURN_IF_LIMIT_EXCEEDED(state, "Intersect, while probe hash table.");
     }
 
-    _serialize_columns(chunkPtr, exprs, chunk_size);
+    _serialize_columns(key_columns, chunk_size);
 
     for (size_t i = 0; i < chunk_size; ++i) {
+        if (i + INTERSECT_HASH_SET_PREFETCH_DIST < chunk_size) {
+            _hash_set->prefetch_hash(_hash_values[i + INTERSECT_HASH_SET_PREFETCH_DIST]);
+        }
         IntersectSliceFlag key(_buffer + i * _max_one_row_size, _slice_sizes[i]);
-        auto iter = _hash_set->find(key);
+        auto iter = _hash_set->find(key, _hash_values[i]);
         if (iter != _hash_set->end() && iter->hit_times == hit_times - 1) {
             iter->hit_times = hit_times;
         }
@@ -112,11 +124,20 @@ int64_t IntersectHashSet<HashSet>::mem_usage() const {
 }
 
 template <typename HashSet>
-size_t IntersectHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunkPtr,
-                                                          const std::vector<ExprContext*>& exprs) {
-    size_t max_size = 0;
+Columns IntersectHashSet<HashSet>::_evaluate_key_columns(const ChunkPtr& chunkPtr,
+                                                         const std::vector<ExprContext*>& exprs) {
+    Columns key_columns;
+    key_columns.reserve(exprs.size());
     for (auto* expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunkPtr.get());
+        key_columns.emplace_back(EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunkPtr.get()));
+    }
+    return key_columns;
+}
+
+template <typename HashSet>
+size_t IntersectHashSet<HashSet>::_get_max_serialize_size(const Columns& key_columns) {
+    size_t max_size = 0;
+    for (const auto& key_column : key_columns) {
         max_size += key_column->max_one_element_serialize_size();
         if (!key_column->is_nullable()) {
             max_size += sizeof(bool);
@@ -126,11 +147,8 @@ size_t IntersectHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunkP
 }
 
 template <typename HashSet>
-void IntersectHashSet<HashSet>::_serialize_columns(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs,
-                                                   size_t chunk_size) {
-    for (auto expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunkPtr.get());
-
+void IntersectHashSet<HashSet>::_serialize_columns(const Columns& key_columns, size_t chunk_size) {
+    for (const auto& key_column : key_columns) {
         // The serialized buffer is always nullable.
         if (key_column->is_nullable()) {
             key_column->serialize_batch(_buffer, _slice_sizes, chunk_size, _max_one_row_size);
@@ -139,6 +157,12 @@ void IntersectHashSet<HashSet>::_serialize_columns(const ChunkPtr& chunkPtr, con
                                                         false);
         }
     }
+
+    _hash_values.resize(chunk_size);
+    const auto& hash_function = _hash_set->hash_function();
+    for (size_t i = 0; i < chunk_size; ++i) {
+        _hash_values[i] = hash_function(IntersectSliceFlag(_buffer + i * _max_one_row_size, _slice_sizes[i]));
+    }
 }
 
 // instantiation
@@ -75,13 +75,19 @@ public:
     int64_t mem_usage() const;
 
 private:
-    void _serialize_columns(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs, size_t chunk_size);
+    // Evaluates the key columns of the chunk once, they are used both to size the buffer and to serialize the keys.
+    static Columns _evaluate_key_columns(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs);
 
-    size_t _get_max_serialize_size(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs);
+    // Serializes the keys of the chunk into the buffer and computes their hash values, so the hash set can be
+    // prefetched ahead of the lookups.
+    void _serialize_columns(const Columns& key_columns, size_t chunk_size);
+
+    static size_t _get_max_serialize_size(const Columns& key_columns);
 
     std::unique_ptr<HashSet> _hash_set;
 
     Buffer<uint32_t> _slice_sizes;
+    Buffer<size_t> _hash_values;
     size_t _max_one_row_size = 8;
     std::unique_ptr<MemPool> _mem_pool;
     uint8_t* _buffer;
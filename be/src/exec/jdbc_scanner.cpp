@@ -410,6 +410,7 @@ Status JDBCScanner::_init_column_class_name(RuntimeState* state) {
         Expr* cast_expr =
                 VectorizedCastExprFactory::from_type(intermediate, _slot_descs[i]->type(), column_ref, &_pool, true);
         _cast_exprs.push_back(_pool.add(new ExprContext(cast_expr)));
+        _need_cast.push_back(ret_type != _slot_descs[i]->type().type || ret_type == TYPE_CHAR);
     }
     RETURN_IF_ERROR(Expr::prepare(_cast_exprs, state));
     RETURN_IF_ERROR(Expr::open(_cast_exprs, state));
@@ -493,15 +494,23 @@ Status JDBCScanner::_fill_chunk(jobject jchunk, size_t num_rows, ChunkPtr* chunk
     }
 
     // convert intermediate results type to output chunks
-    // TODO: avoid the cast overhead when from type == to type
     for (size_t col_idx = 0; col_idx < _slot_descs.size(); col_idx++) {
         SlotDescriptor* slot_desc = _slot_descs[col_idx];
         // use reference, then we check the column's nullable and set the final result to the referred column.
         ColumnPtr& column = (*chunk)->get_column_by_slot_id(slot_desc->id());
-        ASSIGN_OR_RETURN(auto result, _cast_exprs[col_idx]->evaluate(_result_chunk.get()));
-        // unfold const_nullable_column to avoid error down_cast.
-        // unpack_and_duplicate_const_column is not suitable, we need set correct type.
-        result = ColumnHelper::unfold_const_column(slot_desc->type(), num_rows, result);
+        ColumnPtr result;
+        if (_need_cast[col_idx]) {
+            ASSIGN_OR_RETURN(result, _cast_exprs[col_idx]->evaluate(_result_chunk.get()));
+            // unfold const_nullable_column to avoid error down_cast.
+            // unpack_and_duplicate_const_column is not suitable, we need set correct type.
+            result = ColumnHelper::unfold_const_column(slot_desc->type(), num_rows, result);
+        } else {
+            // the result column is already of the slot type, hand it over instead of copying it by a cast, and
+            // read the next batch into a new one.
+            ColumnPtr& result_column = _result_chunk->get_column_by_index(col_idx);
+            result = std::move(result_column);
+            result_column = result->clone_empty();
+        }
         if (column->is_nullable() == result->is_nullable()) {
             column = result;
         } else if (column->is_nullable() && !result->is_nullable()) {
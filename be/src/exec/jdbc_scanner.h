@@ -92,6 +92,8 @@ private:
     std::vector<std::string> _column_class_names;
     std::vector<LogicalType> _result_column_types;
     std::vector<ExprContext*> _cast_exprs;
+    // whether the result column should be cast to the slot type, or is already of it
+    std::vector<bool> _need_cast;
     ChunkPtr _result_chunk;
 
     std::unique_ptr<JVMClass> _jdbc_bridge_cls;
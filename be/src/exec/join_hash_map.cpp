@@ -17,6 +17,7 @@
 #include <column/chunk.h>
 #include <runtime/descriptors.h>
 
+#include <atomic>
 #include <memory>
 
 #include "column/vectorized_fwd.h"
@@ -24,9 +25,70 @@
 #include "exec/hash_join_node.h"
 #include "serde/column_array_serde.h"
 #include "simd/simd.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
+namespace {
+// The partitions of a radix partitioned table are split into ranges, claimed one by one by the build driver
+// and the helpers. A helper started after all the ranges are claimed touches nothing but next_range, so the
+// rows can be released once all the ranges are linked, even if some helpers are still queued.
+struct RadixBuildTasks {
+    Buffer<uint32_t> rows;
+    std::vector<uint32_t> offsets;
+    const uint32_t* row_buckets = nullptr;
+    uint32_t* first = nullptr;
+    uint32_t* next = nullptr;
+    uint32_t partition_num = 0;
+    uint32_t num_ranges = 0;
+    std::atomic<uint32_t> next_range{0};
+    std::unique_ptr<CountDownLatch> linked_ranges;
+
+    // Rows of different partitions never share a bucket, so disjoint ranges can be linked concurrently.
+    void link_ranges() {
+        for (uint32_t r = next_range.fetch_add(1); r < num_ranges; r = next_range.fetch_add(1)) {
+            const uint32_t begin = offsets[static_cast<uint64_t>(r) * partition_num / num_ranges];
+            const uint32_t end = offsets[static_cast<uint64_t>(r + 1) * partition_num / num_ranges];
+            for (uint32_t i = begin; i < end; i++) {
+                const uint32_t row = rows[i];
+                next[row] = first[row_buckets[row]];
+                first[row_buckets[row]] = row;
+            }
+            linked_ranges->count_down();
+        }
+    }
+};
+} // namespace
+
+void JoinHashMapHelper::radix_build(JoinHashTableItems* table_items) {
+    auto& buckets = table_items->radix_build_buckets;
+    const uint32_t partition_num = table_items->radix_partition_num;
+    auto tasks = std::make_shared<RadixBuildTasks>();
+    radix_partition(buckets.data(), buckets.size(), table_items->radix_partition_shift, partition_num, &tasks->rows,
+                    &tasks->offsets);
+    tasks->row_buckets = buckets.data();
+    tasks->first = table_items->first.data();
+    tasks->next = table_items->next.data();
+    tasks->partition_num = partition_num;
+
+    ThreadPool* pool = table_items->build_pool;
+    const uint32_t dop = pool == nullptr ? 1 : std::min(table_items->parallel_build_dop, partition_num);
+    // several ranges per thread, so a range taken by a slow helper is short to wait for.
+    tasks->num_ranges = dop <= 1 ? 1 : std::min(partition_num, dop * 4);
+    tasks->linked_ranges = std::make_unique<CountDownLatch>(tasks->num_ranges);
+    for (uint32_t i = 1; i < dop; i++) {
+        // the ranges of a helper failed to submit are linked by the others.
+        (void)pool->submit_func([tasks]() { tasks->link_ranges(); });
+    }
+    tasks->link_ranges();
+    // all the ranges are claimed here, only wait for the ones the running helpers are linking.
+    tasks->linked_ranges->wait();
+
+    Buffer<uint32_t>().swap(tasks->rows);
+    Buffer<uint32_t>().swap(buckets);
+}
+
 // if the same hash values are clustered, after the first probe, all related hash buckets are cached, without too many
 // misses. So check time locality of probe keys here.
 void HashTableProbeState::consider_probe_time_locality() {
@@ -79,6 +141,7 @@ void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* t
     table_items->next.resize(table_items->row_count + 1, 0);
     table_items->build_slice.resize(table_items->row_count + 1);
     table_items->build_pool = std::make_unique<MemPool>();
+    table_items->init_radix_partition();
 }
 
 void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
@@ -128,6 +191,9 @@ void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHash
         }
         _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem, &ptr);
     }
+    if (table_items->is_radix_partitioned()) {
+        JoinHashMapHelper::radix_build(table_items);
+    }
     table_items->calculate_ht_info(serialize_size);
 }
 
@@ -140,11 +206,7 @@ void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, Ha
                                                                             table_items->bucket_size);
         *ptr += table_items->build_slice[start + i].size;
     }
-
-    for (size_t i = 0; i < count; i++) {
-        table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-        table_items->first[probe_state->buckets[i]] = start + i;
-    }
+    JoinHashMapHelper::insert_build_rows(table_items, probe_state->buckets, nullptr, start, count);
 }
 
 void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
@@ -167,13 +229,8 @@ void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_
             *ptr += table_items->build_slice[start + i].size;
         }
     }
-
-    for (size_t i = 0; i < count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-            table_items->first[probe_state->buckets[i]] = start + i;
-        }
-    }
+    JoinHashMapHelper::insert_build_rows(table_items, probe_state->buckets, probe_state->is_nulls.data(), start,
+                                         count);
 }
 
 void SerializedJoinProbeFunc::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
@@ -226,10 +283,7 @@ void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_item
                 JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
         ptr += probe_state->probe_slice[i].size;
     }
-
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, nullptr, row_count);
 }
 
 void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& table_items,
@@ -258,11 +312,9 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
         if (probe_state->is_nulls[i] == 0) {
             probe_state->buckets[i] =
                     JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
         }
     }
+    JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, probe_state->is_nulls.data(), row_count);
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
@@ -336,6 +388,10 @@ void JoinHashTable::create(const HashTableParam& param) {
     _table_items->join_type = param.join_type;
     _table_items->mor_reader_mode = param.mor_reader_mode;
     _table_items->enable_late_materialization = param.enable_late_materialization;
+    _table_items->radix_partition_min_rows = param.radix_partition_min_rows;
+    _table_items->parallel_build_dop = param.parallel_build_dop;
+    _table_items->build_pool = param.build_pool;
+    _table_items->enable_probe_prefetch = param.enable_probe_prefetch;
 
     if (_table_items->join_type == TJoinOp::RIGHT_SEMI_JOIN || _table_items->join_type == TJoinOp::RIGHT_ANTI_JOIN ||
         _table_items->join_type == TJoinOp::RIGHT_OUTER_JOIN) {
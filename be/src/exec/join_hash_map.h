@@ -37,6 +37,10 @@
 namespace starrocks {
 
 class ColumnRef;
+class ThreadPool;
+
+// This is just an empirical value based on benchmark, and you can tweak it if more proper value is found.
+static constexpr size_t JOIN_HASH_MAP_PREFETCH_DIST = 16;
 
 #define APPLY_FOR_JOIN_VARIANTS(M) \
     M(empty)                       \
@@ -129,9 +133,51 @@ struct JoinHashTableItems {
     float keys_per_bucket = 0;
     size_t used_buckets = 0;
     bool cache_miss_serious = false;
+    // Prefetch the buckets and the chain heads of probe rows ahead when the table doesn't fit in L2 cache.
+    static constexpr size_t PROBE_PREFETCH_MIN_BYTES = 1UL << 21;
+    bool enable_probe_prefetch = false;
+    bool probe_prefetch = false;
     bool mor_reader_mode = false;
     bool enable_late_materialization = false;
 
+    // Radix partitioning of a large table. Rows are scattered by the high bits of their bucket index into
+    // radix_partition_num partitions, and both build and probe visit `first` partition by partition, so that
+    // each pass only touches a slice of `first` that fits in cache.
+    // It's enabled when row_count reaches radix_partition_min_rows, 0 means never.
+    static constexpr uint32_t RADIX_PARTITION_BUCKETS = 1 << 16;
+    static constexpr uint32_t MAX_RADIX_PARTITION_NUM = 1 << 10;
+    static constexpr uint32_t RADIX_INVALID_BUCKET = UINT32_MAX;
+    uint32_t radix_partition_min_rows = 0;
+    uint32_t radix_partition_num = 1;
+    uint32_t radix_partition_shift = 0;
+    // max number of threads linking the partitions of a radix partitioned table, <= 1 means single-threaded.
+    uint32_t parallel_build_dop = 1;
+    // threads helping the build driver to link the partitions, nullptr means the driver links them alone.
+    ThreadPool* build_pool = nullptr;
+    // bucket of each build row, only alive during building.
+    Buffer<uint32_t> radix_build_buckets;
+
+    bool is_radix_partitioned() const { return radix_partition_num > 1; }
+
+    // must be called after bucket_size is decided.
+    void init_radix_partition() {
+        radix_partition_num = 1;
+        radix_partition_shift = 0;
+        if (radix_partition_min_rows == 0 || row_count < radix_partition_min_rows) {
+            return;
+        }
+        uint32_t num = std::min(bucket_size / RADIX_PARTITION_BUCKETS, MAX_RADIX_PARTITION_NUM);
+        if (num <= 1) {
+            return;
+        }
+        // bucket_size is always a power of 2.
+        uint32_t bucket_bits = __builtin_ctz(bucket_size);
+        uint32_t partition_bits = 31 - __builtin_clz(num);
+        radix_partition_num = 1U << partition_bits;
+        radix_partition_shift = bucket_bits - partition_bits;
+        radix_build_buckets.assign(row_count + 1, RADIX_INVALID_BUCKET);
+    }
+
     float get_keys_per_bucket() const { return keys_per_bucket; }
     bool ht_cache_miss_serious() const { return cache_miss_serious; }
 
@@ -146,6 +192,8 @@ struct JoinHashTableItems {
             cache_miss_serious = row_count > (1UL << 18) &&
                                  ((probe_bytes > (1UL << 25) && keys_per_bucket > 2) ||
                                   (probe_bytes > (1UL << 26) && keys_per_bucket > 1.5) || probe_bytes > (1UL << 27));
+            probe_prefetch = enable_probe_prefetch &&
+                             probe_bytes + bucket_size * sizeof(uint32_t) > PROBE_PREFETCH_MIN_BYTES;
             VLOG_QUERY << "ht cache miss serious = " << cache_miss_serious << " row# = " << row_count
                        << " , bytes = " << probe_bytes << " , depth = " << keys_per_bucket;
         }
@@ -162,6 +210,8 @@ struct HashTableProbeState {
     Buffer<uint8_t> is_nulls;
     Buffer<uint32_t> buckets;
     Buffer<uint32_t> next;
+    // probe rows ordered by radix partition, used when the table is radix partitioned.
+    Buffer<uint32_t> radix_rows;
     Buffer<Slice> probe_slice;
     Buffer<uint8_t>* null_array = nullptr;
     ColumnPtr probe_key_column;
@@ -256,7 +306,8 @@ struct HashTableProbeState {
               cur_row_match_count(rhs.cur_row_match_count),
               probe_pool(rhs.probe_pool == nullptr ? nullptr : std::make_unique<MemPool>()),
               search_ht_timer(rhs.search_ht_timer),
-              output_probe_column_timer(rhs.output_probe_column_timer) {}
+              output_probe_column_timer(rhs.output_probe_column_timer),
+              output_build_column_timer(rhs.output_build_column_timer) {}
 
     // Disable copy assignment.
     HashTableProbeState& operator=(const HashTableProbeState& rhs) = delete;
@@ -289,6 +340,10 @@ struct HashTableParam {
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
     RuntimeProfile::Counter* output_probe_column_timer = nullptr;
     bool mor_reader_mode = false;
+    uint32_t radix_partition_min_rows = 0;
+    uint32_t parallel_build_dop = 1;
+    ThreadPool* build_pool = nullptr;
+    bool enable_probe_prefetch = false;
 };
 
 template <class T>
@@ -354,6 +409,129 @@ public:
         }
     }
 
+    // Stable counting sort of rows [0, count) by the radix partition of their bucket, the rows whose bucket is
+    // RADIX_INVALID_BUCKET are dropped. Being stable, the rows of the same bucket keep their original order.
+    // If partition_offsets is not null, it gets partition_num + 1 offsets into rows, partition i is
+    // [offsets[i], offsets[i + 1]).
+    static void radix_partition(const uint32_t* buckets, uint32_t count, uint32_t shift, uint32_t partition_num,
+                                Buffer<uint32_t>* rows, std::vector<uint32_t>* partition_offsets = nullptr) {
+        std::vector<uint32_t> offsets(partition_num + 1, 0);
+        for (uint32_t i = 0; i < count; i++) {
+            if (buckets[i] != JoinHashTableItems::RADIX_INVALID_BUCKET) {
+                offsets[(buckets[i] >> shift) + 1]++;
+            }
+        }
+        for (uint32_t i = 0; i < partition_num; i++) {
+            offsets[i + 1] += offsets[i];
+        }
+        if (partition_offsets != nullptr) {
+            *partition_offsets = offsets;
+        }
+        rows->resize(offsets[partition_num]);
+        for (uint32_t i = 0; i < count; i++) {
+            if (buckets[i] != JoinHashTableItems::RADIX_INVALID_BUCKET) {
+                (*rows)[offsets[buckets[i] >> shift]++] = i;
+            }
+        }
+    }
+
+    // Link rows [start, start + count) into the bucket chains, buckets[i] is the bucket of row `start + i`,
+    // and rows with non-zero is_nulls[i] are skipped. For a radix partitioned table, the buckets are only
+    // recorded here, and linked by radix_build() after all the rows are hashed.
+    static void insert_build_rows(JoinHashTableItems* table_items, const Buffer<uint32_t>& buckets,
+                                  const uint8_t* is_nulls, uint32_t start, uint32_t count) {
+        if (table_items->is_radix_partitioned()) {
+            auto& build_buckets = table_items->radix_build_buckets;
+            for (uint32_t i = 0; i < count; i++) {
+                build_buckets[start + i] = (is_nulls != nullptr && is_nulls[i] != 0)
+                                                   ? JoinHashTableItems::RADIX_INVALID_BUCKET
+                                                   : buckets[i];
+            }
+            return;
+        }
+
+        if (is_nulls == nullptr) {
+            for (uint32_t i = 0; i < count; i++) {
+                table_items->next[start + i] = table_items->first[buckets[i]];
+                table_items->first[buckets[i]] = start + i;
+            }
+        } else {
+            for (uint32_t i = 0; i < count; i++) {
+                if (is_nulls[i] == 0) {
+                    table_items->next[start + i] = table_items->first[buckets[i]];
+                    table_items->first[buckets[i]] = start + i;
+                }
+            }
+        }
+    }
+
+    // Link all the recorded build rows partition by partition. The chain of each bucket is the same as
+    // the one built row by row. Partitions own disjoint ranges of `first`, so when parallel_build_dop > 1
+    // the threads of build_pool help the driver to link them. Helpers claim ranges of partitions like the
+    // driver does, and the driver only waits for the ranges being linked by the running helpers, never for
+    // the helpers still queued in the pool.
+    static void radix_build(JoinHashTableItems* table_items);
+
+    // Fetch the chain heads of probe rows [0, count) into probe_state->next, rows with non-zero is_nulls[i]
+    // get 0. For a radix partitioned table, `first` is visited partition by partition.
+    // The buckets of the whole chunk are already computed, so when prefetch is enabled the bucket of the row
+    // JOIN_HASH_MAP_PREFETCH_DIST rows ahead is prefetched before resolving the current one.
+    static void lookup_chain_heads(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
+                                   const uint8_t* is_nulls, uint32_t count) {
+        auto& buckets = probe_state->buckets;
+        auto& next = probe_state->next;
+        const uint32_t* first = table_items.first.data();
+        if (!table_items.is_radix_partitioned()) {
+            if (is_nulls == nullptr) {
+                if (table_items.probe_prefetch) {
+                    for (uint32_t i = 0; i < count; i++) {
+                        if (i + JOIN_HASH_MAP_PREFETCH_DIST < count) {
+                            __builtin_prefetch(first + buckets[i + JOIN_HASH_MAP_PREFETCH_DIST]);
+                        }
+                        next[i] = first[buckets[i]];
+                    }
+                } else {
+                    for (uint32_t i = 0; i < count; i++) {
+                        next[i] = first[buckets[i]];
+                    }
+                }
+            } else {
+                if (table_items.probe_prefetch) {
+                    for (uint32_t i = 0; i < count; i++) {
+                        if (i + JOIN_HASH_MAP_PREFETCH_DIST < count && is_nulls[i + JOIN_HASH_MAP_PREFETCH_DIST] == 0) {
+                            __builtin_prefetch(first + buckets[i + JOIN_HASH_MAP_PREFETCH_DIST]);
+                        }
+                        next[i] = is_nulls[i] == 0 ? first[buckets[i]] : 0;
+                    }
+                } else {
+                    for (uint32_t i = 0; i < count; i++) {
+                        next[i] = is_nulls[i] == 0 ? first[buckets[i]] : 0;
+                    }
+                }
+            }
+            return;
+        }
+
+        if (is_nulls != nullptr) {
+            for (uint32_t i = 0; i < count; i++) {
+                if (is_nulls[i] != 0) {
+                    buckets[i] = JoinHashTableItems::RADIX_INVALID_BUCKET;
+                    next[i] = 0;
+                }
+            }
+        }
+        radix_partition(buckets.data(), count, table_items.radix_partition_shift, table_items.radix_partition_num,
+                        &probe_state->radix_rows);
+        const auto& rows = probe_state->radix_rows;
+        const size_t num_rows = rows.size();
+        for (size_t i = 0; i < num_rows; i++) {
+            if (table_items.probe_prefetch && i + JOIN_HASH_MAP_PREFETCH_DIST < num_rows) {
+                __builtin_prefetch(first + buckets[rows[i + JOIN_HASH_MAP_PREFETCH_DIST]]);
+            }
+            next[rows[i]] = first[buckets[rows[i]]];
+        }
+    }
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -690,6 +868,17 @@ private:
     void _probe_index_output(ChunkPtr* chunk);
     void _build_index_output(ChunkPtr* chunk);
 
+    // Prefetch the build key and the chain link of the chain head of probe row `i + JOIN_HASH_MAP_PREFETCH_DIST`,
+    // so that resolving the chains of a chunk doesn't become a sequence of dependent cache misses.
+    void _prefetch_chain_head(const Buffer<CppType>& build_data, size_t i, size_t probe_row_count) const {
+        size_t ahead = i + JOIN_HASH_MAP_PREFETCH_DIST;
+        if (ahead < probe_row_count) {
+            uint32_t build_index = _probe_state->next[ahead];
+            __builtin_prefetch(build_data.data() + build_index);
+            __builtin_prefetch(_table_items->next.data() + build_index);
+        }
+    }
+
     void _search_ht(RuntimeState* state, ChunkPtr* probe_chunk);
     void _search_ht_remain(RuntimeState* state);
 
@@ -840,6 +1029,7 @@ public:
     size_t get_build_column_count() const { return _table_items->build_column_count; }
     size_t get_output_build_column_count() const { return _table_items->output_build_column_count; }
     size_t get_bucket_size() const { return _table_items->bucket_size; }
+    uint32_t get_radix_partition_num() const { return _table_items->radix_partition_num; }
     float get_keys_per_bucket() const;
     void remove_duplicate_index(Filter* filter);
     JoinHashTableItems* table_items() const { return _table_items.get(); }
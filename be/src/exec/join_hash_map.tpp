@@ -26,6 +26,7 @@ void JoinBuildFunc<LT>::prepare(RuntimeState* runtime, JoinHashTableItems* table
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
     table_items->first.resize(table_items->bucket_size, 0);
     table_items->next.resize(table_items->row_count + 1, 0);
+    table_items->init_radix_partition();
 }
 
 template <LogicalType LT>
@@ -54,7 +55,20 @@ template <LogicalType LT>
 void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                              HashTableProbeState* probe_state) {
     auto& data = get_key_data(*table_items);
-    if (table_items->key_columns[0]->is_nullable()) {
+    if (table_items->is_radix_partitioned()) {
+        const uint8_t* is_nulls = nullptr;
+        if (table_items->key_columns[0]->is_nullable()) {
+            auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+            is_nulls = nullable_column->null_column()->get_data().data();
+        }
+        auto& buckets = table_items->radix_build_buckets;
+        for (size_t i = 1; i < table_items->row_count + 1; i++) {
+            if (is_nulls == nullptr || is_nulls[i] == 0) {
+                buckets[i] = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
+            }
+        }
+        JoinHashMapHelper::radix_build(table_items);
+    } else if (table_items->key_columns[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
@@ -125,6 +139,7 @@ void FixedSizeJoinBuildFunc<LT>::prepare(RuntimeState* state, JoinHashTableItems
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
     table_items->first.resize(table_items->bucket_size, 0);
     table_items->next.resize(table_items->row_count + 1, 0);
+    table_items->init_radix_partition();
     table_items->build_key_column = ColumnType::create(table_items->row_count + 1);
 }
 
@@ -167,6 +182,9 @@ void FixedSizeJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinH
         }
         _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem);
     }
+    if (table_items->is_radix_partitioned()) {
+        JoinHashMapHelper::radix_build(table_items);
+    }
     table_items->calculate_ht_info(table_items->build_key_column->byte_size());
 }
 
@@ -178,11 +196,7 @@ void FixedSizeJoinBuildFunc<LT>::_build_columns(JoinHashTableItems* table_items,
 
     const auto& data = get_key_data(*table_items);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
-
-    for (uint32_t i = 0; i < count; i++) {
-        table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-        table_items->first[probe_state->buckets[i]] = start + i;
-    }
+    JoinHashMapHelper::insert_build_rows(table_items, probe_state->buckets, nullptr, start, count);
 }
 
 template <LogicalType LT>
@@ -203,13 +217,8 @@ void FixedSizeJoinBuildFunc<LT>::_build_nullable_columns(JoinHashTableItems* tab
                                                            count);
     const auto& data = get_key_data(*table_items);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
-
-    for (size_t i = 0; i < count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-            table_items->first[probe_state->buckets[i]] = start + i;
-        }
-    }
+    JoinHashMapHelper::insert_build_rows(table_items, probe_state->buckets, probe_state->is_nulls.data(), start,
+                                         count);
 }
 
 template <LogicalType LT>
@@ -270,27 +279,17 @@ void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashT
 
         if (nullable_column->has_null()) {
             auto& null_array = nullable_column->null_column()->get_data();
-            for (size_t i = 0; i < probe_row_count; i++) {
-                if (null_array[i] == 0) {
-                    probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-                } else {
-                    probe_state->next[i] = 0;
-                }
-            }
+            JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, null_array.data(), probe_row_count);
             probe_state->null_array = &nullable_column->null_column()->get_data();
         } else {
-            for (size_t i = 0; i < probe_row_count; i++) {
-                probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-            }
+            JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, nullptr, probe_row_count);
             probe_state->null_array = nullptr;
         }
         probe_state->consider_probe_time_locality();
         return;
     }
 
-    for (size_t i = 0; i < probe_row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, nullptr, probe_row_count);
     probe_state->consider_probe_time_locality();
     probe_state->null_array = nullptr;
 }
@@ -350,10 +349,7 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
-
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, nullptr, row_count);
 }
 
 template <LogicalType LT>
@@ -376,14 +372,7 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
-
-    for (uint32_t i = 0; i < row_count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
-        }
-    }
+    JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, probe_state->is_nulls.data(), row_count);
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
@@ -1029,7 +1018,11 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht(RuntimeState* state,
     }
 
     size_t probe_row_count = _probe_state->probe_row_count;
+    const bool prefetch = _table_items->probe_prefetch;
     for (; i < probe_row_count; i++) {
+        if (prefetch) {
+            _prefetch_chain_head(build_data, i, probe_row_count);
+        }
         if constexpr (first_probe) {
             _probe_state->probe_match_filter[i] = 0;
         }
@@ -1251,7 +1244,11 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join(Ru
                                                                               const Buffer<CppType>& probe_data) {
     size_t match_count = 0;
     size_t probe_row_count = _probe_state->probe_row_count;
+    const bool prefetch = _table_items->probe_prefetch;
     for (size_t i = 0; i < probe_row_count; i++) {
+        if (prefetch) {
+            _prefetch_chain_head(build_data, i, probe_row_count);
+        }
         size_t index = _probe_state->next[i];
         if (index == 0) {
             continue;
@@ -1278,10 +1275,14 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
     size_t match_count = 0;
 
     size_t probe_row_count = _probe_state->probe_row_count;
+    const bool prefetch = _table_items->probe_prefetch;
     DCHECK_LT(0, _table_items->row_count);
     if (_table_items->join_type == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN && _probe_state->null_array != nullptr) {
         // process left anti join from not in
         for (size_t i = 0; i < probe_row_count; i++) {
+            if (prefetch) {
+                _prefetch_chain_head(build_data, i, probe_row_count);
+            }
             size_t index = _probe_state->next[i];
             if ((*_probe_state->null_array)[i] == 1) {
                 continue;
@@ -1308,6 +1309,9 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
         }
     } else {
         for (size_t i = 0; i < probe_row_count; i++) {
+            if (prefetch) {
+                _prefetch_chain_head(build_data, i, probe_row_count);
+            }
             size_t index = _probe_state->next[i];
             if (index == 0) {
                 _probe_state->probe_index[match_count] = i;
@@ -354,6 +354,33 @@ JsonReader::JsonReader(starrocks::RuntimeState* state, starrocks::ScannerCounter
         index++;
         _slot_desc_dict.emplace(desc->col_name(), desc);
     }
+    _init_flat_json_paths();
+}
+
+void JsonReader::_init_flat_json_paths() {
+    const auto& json_paths = _scanner->_json_paths;
+    if (json_paths.empty()) {
+        return;
+    }
+    // The jsonpaths are flat if each of them refers to a distinct top-level field of the object, e.g. "$.a".
+    std::unordered_map<std::string_view, SlotDescriptor*> path_dict;
+    for (size_t i = 0; i < _slot_descs.size() && i < json_paths.size(); i++) {
+        if (_slot_descs[i] == nullptr) {
+            continue;
+        }
+        const auto& path = json_paths[i];
+        if (path.size() != 2 || !path[1].is_valid || path[1].idx != -1 || path[1].key.empty() ||
+            path[1].key == "*") {
+            return;
+        }
+        if (!path_dict.emplace(path[1].key, _slot_descs[i]).second) {
+            return;
+        }
+    }
+    // The fields of each object are then matched to the slots by one scan, in the same way as without jsonpaths,
+    // instead of one lookup per jsonpath.
+    _slot_desc_dict = std::move(path_dict);
+    _flat_json_paths = true;
 }
 
 Status JsonReader::open() {
@@ -423,6 +450,7 @@ Status JsonReader::read_chunk(Chunk* chunk, int32_t rows_to_read) {
             _empty_parser = false;
         }
 
+        SCOPED_RAW_TIMER(&_counter->parse_ns);
         Status st;
         // Eliminates virtual function call.
         if (!_scanner->_root_paths.empty()) {
@@ -578,6 +606,11 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
             }
 
             DCHECK(column_index >= 0);
+            if (UNLIKELY(_parsed_columns[column_index])) {
+                // Only the first one of the duplicated keys is used.
+                key_index++;
+                continue;
+            }
             _parsed_columns[column_index] = true;
             auto& column = chunk->get_column_by_index(column_index);
             simdjson::ondemand::value val = field.value();
@@ -676,7 +709,7 @@ Status JsonReader::_construct_row_with_jsonpath(simdjson::ondemand::object* row,
 }
 
 Status JsonReader::_construct_row(simdjson::ondemand::object* row, Chunk* chunk) {
-    if (_scanner->_json_paths.empty()) return _construct_row_without_jsonpath(row, chunk);
+    if (_scanner->_json_paths.empty() || _flat_json_paths) return _construct_row_without_jsonpath(row, chunk);
 
     return _construct_row_with_jsonpath(row, chunk);
 }
@@ -826,6 +859,8 @@ Status JsonReader::_read_and_parse_json() {
     }
 
     _empty_parser = false;
+    SCOPED_RAW_TIMER(&_counter->parse_ns);
+    _counter->parse_bytes += _payload_size;
     return _parser->parse(_payload, _payload_size, _payload_capacity);
 }
 
@@ -112,6 +112,8 @@ private:
     Status _read_file_broker();
     Status _parse_payload();
 
+    void _init_flat_json_paths();
+
     Status _construct_row(simdjson::ondemand::object* row, Chunk* chunk);
 
     Status _construct_row_without_jsonpath(simdjson::ondemand::object* row, Chunk* chunk);
@@ -133,7 +135,10 @@ private:
     std::vector<SlotDescriptor*> _slot_descs;
     //Attention: _slot_desc_dict's key is the string_view of the column of _slot_descs,
     // so the lifecycle of _slot_descs should be longer than _slot_desc_dict;
+    // With flat jsonpaths, the keys are the top-level fields referred by the jsonpaths instead of the column names.
     std::unordered_map<std::string_view, SlotDescriptor*> _slot_desc_dict;
+    // Whether all the jsonpaths refer to distinct top-level fields, which are read like without jsonpaths.
+    bool _flat_json_paths = false;
 
     // For performance reason, the simdjson parser should be reused over several files.
     //https://github.com/simdjson/simdjson/blob/master/doc/performance.md
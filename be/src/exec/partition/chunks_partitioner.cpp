@@ -31,8 +31,9 @@ ChunksPartitioner::ChunksPartitioner(const bool has_nullable_partition_column,
     _partition_columns.resize(partition_exprs.size());
 }
 
-Status ChunksPartitioner::prepare(RuntimeState* state) {
+Status ChunksPartitioner::prepare(RuntimeState* state, int32_t partition_chunk_size) {
     _state = state;
+    _partition_chunk_size = partition_chunk_size > 0 ? partition_chunk_size : state->chunk_size();
     _mem_pool = std::make_unique<MemPool>();
     _obj_pool = std::make_unique<ObjectPool>();
     _init_hash_map_variant();
@@ -163,7 +164,7 @@ void ChunksPartitioner::_init_hash_map_variant() {
             }
         }
     }
-    _hash_map_variant.init(_state, type);
+    _hash_map_variant.init(_state, type, _partition_chunk_size);
 
     _hash_map_variant.visit([&](auto& hash_map_with_key) {
         if constexpr (std::decay_t<decltype(*hash_map_with_key)>::is_fixed_length_slice) {
@@ -40,7 +40,8 @@ public:
     ChunksPartitioner(const bool has_nullable_partition_column, const std::vector<ExprContext*>& partition_exprs,
                       std::vector<PartitionColumnType> partition_types);
 
-    Status prepare(RuntimeState* state);
+    // @partition_chunk_size: the max rows of each chunk buffered for a partition, 0 means state->chunk_size().
+    Status prepare(RuntimeState* state, int32_t partition_chunk_size = 0);
 
     // Chunk is divided into multiple parts by partition columns,
     // and each partition corresponds to a key-value pair in the hash map.
@@ -233,6 +234,7 @@ private:
     const std::vector<PartitionColumnType> _partition_types;
 
     RuntimeState* _state = nullptr;
+    int32_t _partition_chunk_size = 0;
     std::unique_ptr<MemPool> _mem_pool = nullptr;
     std::unique_ptr<ObjectPool> _obj_pool = nullptr;
 
@@ -85,14 +85,14 @@ DEFINE_PARTITION_MAP_TRAITS(PartitionHashMapVariant::Type::phase1_slice_fx16,
 
 } // namespace detail
 
-void PartitionHashMapVariant::init(RuntimeState* state, Type type_) {
+void PartitionHashMapVariant::init(RuntimeState* state, Type type_, int32_t chunk_size) {
     type = type_;
     switch (type_) {
 #define M(NAME)                                                                                              \
     case Type::NAME:                                                                                         \
         hash_map_with_key =                                                                                  \
                 std::make_unique<detail::PartitionHashMapVariantTypeTraits<Type::NAME>::HashMapWithKeyType>( \
-                        state->chunk_size());                                                                \
+                        chunk_size);                                                                         \
         break;
         M(phase1_uint8);
         M(phase1_int8);
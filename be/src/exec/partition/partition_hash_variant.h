@@ -189,7 +189,8 @@ struct PartitionHashMapVariant {
         return std::visit(std::forward<Vistor>(vistor), hash_map_with_key);
     }
 
-    void init(RuntimeState* state, Type type_);
+    // chunk_size is the max rows of each chunk buffered for a partition
+    void init(RuntimeState* state, Type type_, int32_t chunk_size);
 
     void reset();
 
@@ -17,6 +17,7 @@
 #include <utility>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/pipeline/adaptive/adaptive_dop_param.h"
 #include "exec/pipeline/adaptive/event.h"
@@ -120,10 +121,29 @@ bool PassthroughState::has_output(int32_t driver_seq) const {
         return true;
     }
 
-    if (_ctx->_is_finishing_per_driver_seq[driver_seq]) {
-        return num_chunks > 0;
+    if (_ctx->_is_finishing_per_driver_seq[driver_seq] && num_chunks > 0) {
+        return true;
     }
-    return false;
+    return _find_backlog(driver_seq) >= 0;
+}
+
+int32_t PassthroughState::_find_backlog(int32_t driver_seq) const {
+    if (!_ctx->_allow_steal || !config::enable_adaptive_dop_chunk_stealing) {
+        return -1;
+    }
+    int32_t backlog = -1;
+    size_t max_num_chunks = UNPLUG_THRESHOLD_PER_DRIVER_SEQ - 1;
+    for (int32_t i = 0; i < static_cast<int32_t>(_ctx->_upstream_dop); i++) {
+        if (i == driver_seq) {
+            continue;
+        }
+        size_t num_chunks = _in_chunk_queue_per_driver_seq[i].queue.size_approx();
+        if (num_chunks > max_num_chunks) {
+            max_num_chunks = num_chunks;
+            backlog = i;
+        }
+    }
+    return backlog;
 }
 
 StatusOr<ChunkPtr> PassthroughState::pull_chunk(int32_t driver_seq) {
@@ -136,10 +156,19 @@ StatusOr<ChunkPtr> PassthroughState::pull_chunk(int32_t driver_seq) {
 
     auto& passthrough_chunk_queue = _in_chunk_queue_per_driver_seq[driver_seq].queue;
     ChunkPtr chunk = nullptr;
-    if (UNLIKELY(!passthrough_chunk_queue.try_dequeue(chunk))) {
-        return Status::InternalError("attempt to dequeue from the empty passthrough queue of CollectStatsSource");
+    if (passthrough_chunk_queue.try_dequeue(chunk)) {
+        return chunk;
+    }
+    if (int32_t backlog = _find_backlog(driver_seq); backlog >= 0) {
+        // the chunks of a passthrough queue keep their order only for its own driver, which is not needed when
+        // stealing is allowed. The backlog may have been drained by its driver in the meantime.
+        _in_chunk_queue_per_driver_seq[backlog].queue.try_dequeue(chunk);
+        return chunk;
+    }
+    if (_ctx->_allow_steal) {
+        return chunk;
     }
-    return chunk;
+    return Status::InternalError("attempt to dequeue from the empty passthrough queue of CollectStatsSource");
 }
 
 Status PassthroughState::set_finishing(int32_t driver_seq) {
@@ -155,7 +184,7 @@ bool PassthroughState::is_downstream_finished(int32_t driver_seq) const {
     const auto& passthrough_chunk_queue = _in_chunk_queue_per_driver_seq[driver_seq].queue;
     // _is_finishing_per_driver_seq is set to true using memory_order_release after all the chunks are enqueued.
     // Therefore, enqueueing chunk hapens before setting _is_finishing_per_driver_seq to true.
-    return buffer_chunk_queue.empty() && passthrough_chunk_queue.size_approx() <= 0;
+    return buffer_chunk_queue.empty() && passthrough_chunk_queue.size_approx() <= 0 && _find_backlog(driver_seq) < 0;
 }
 bool PassthroughState::is_upstream_finished(int32_t driver_seq) const {
     return _ctx->_is_finished_per_driver_seq[driver_seq];
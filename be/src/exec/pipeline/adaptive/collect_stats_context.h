@@ -47,6 +47,9 @@ enum class CollectStatsStateEnum { BLOCK = 0, PASSTHROUGH, ROUND_ROBIN };
 ///   when BlockState receives max_block_rows_per_driver_seq*DOP rows and SourceOp hasn't been not EOS.
 ///   - It doesn't adjust DOP of pipeline#2,
 ///   - and passes chunks from the i-th pipeline#1 driver to the i-th pipeline#2 driver.
+///   - If the distribution of SourceOp needs not be kept, a pipeline#2 driver with nothing to do takes the chunks
+///     backed up for another driver, so the busy drivers are helped by the starved ones, and a driver keeps
+///     helping after its own input is finished instead of retiring.
 /// - RoundRobinState is transformed to,
 ///   when SourceOp has been EOS before BlockState receives max_block_rows_per_driver_seq*DOP rows.
 ///   - It adjust DOP of pipeline#2 to compute_max_le_power2(num_rows/max_block_rows_per_driver_seq),
@@ -75,6 +78,8 @@ public:
     size_t downstream_dop() const { return _downstream_dop; }
     void set_downstream_dop(size_t downstream_dop) { _downstream_dop = downstream_dop; }
     void incr_sinker() { ++_upstream_dop; }
+    // Whether the pipeline#2 drivers may take the chunks of each other, set before the drivers run.
+    void set_allow_steal(bool allow_steal) { _allow_steal = allow_steal; }
 
     const int64_t max_output_amplification_factor() const { return _max_output_amplification_factor; }
 
@@ -103,6 +108,8 @@ private:
     size_t _upstream_dop = 0;
     size_t _downstream_dop = 0;
 
+    bool _allow_steal = false;
+
     const size_t _max_block_rows_per_driver_seq;
     const int64_t _max_output_amplification_factor;
 
@@ -178,6 +185,10 @@ private:
     static constexpr size_t MAX_PASSTHROUGH_CHUNKS_PER_DRIVER_SEQ = 32;
     static constexpr size_t UNPLUG_THRESHOLD_PER_DRIVER_SEQ = MAX_PASSTHROUGH_CHUNKS_PER_DRIVER_SEQ / 2;
 
+    // Returns the driver other than `driver_seq` with the most chunks backed up, at least
+    // UNPLUG_THRESHOLD_PER_DRIVER_SEQ of them, or -1 if there is none or stealing is not allowed.
+    int32_t _find_backlog(int32_t driver_seq) const;
+
     using ChunkQueue = moodycamel::ConcurrentQueue<ChunkPtr>;
     struct ChunkQueueWrapper {
         ChunkQueueWrapper() : queue(), token(queue) {}
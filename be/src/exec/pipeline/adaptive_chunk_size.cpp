@@ -0,0 +1,60 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/adaptive_chunk_size.h"
+
+#include <algorithm>
+
+#include "column/chunk.h"
+
+namespace starrocks::pipeline {
+
+AdaptiveChunkSizeController::AdaptiveChunkSizeController(size_t max_chunk_size, size_t target_bytes)
+        : _max_chunk_size(std::max<size_t>(1, max_chunk_size)),
+          _min_chunk_size(std::max<size_t>(1, _max_chunk_size / 8)),
+          _target_bytes(target_bytes),
+          _chunk_size(_max_chunk_size) {}
+
+void AdaptiveChunkSizeController::update(const Chunk& chunk) {
+    const size_t num_rows = chunk.num_rows();
+    if (num_rows == 0 || _num_chunks++ % kSampleInterval != 0) {
+        return;
+    }
+    const double bytes_per_row = static_cast<double>(chunk.bytes_usage()) / num_rows;
+    if (_bytes_per_row == 0) {
+        _bytes_per_row = bytes_per_row;
+    } else {
+        _bytes_per_row = kSmoothingFactor * bytes_per_row + (1 - kSmoothingFactor) * _bytes_per_row;
+    }
+    _resize();
+}
+
+void AdaptiveChunkSizeController::_resize() {
+    if (_bytes_per_row <= 0 || _target_bytes == 0) {
+        return;
+    }
+    const double rows = _target_bytes / _bytes_per_row;
+    if (rows >= _max_chunk_size) {
+        _chunk_size.store(_max_chunk_size, std::memory_order_relaxed);
+        return;
+    }
+    // Round down to a power of two, so that small changes of the row width do not change the size of every chunk.
+    size_t chunk_size = 1;
+    while (chunk_size * 2 <= rows) {
+        chunk_size *= 2;
+    }
+    _chunk_size.store(std::clamp(chunk_size, _min_chunk_size, _max_chunk_size), std::memory_order_relaxed);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,66 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace starrocks {
+class Chunk;
+}
+
+namespace starrocks::pipeline {
+
+// AdaptiveChunkSizeController samples the chunks produced by the source operator of a pipeline driver and
+// derives the number of rows per chunk that keeps a chunk within `target_bytes`, so that the chunks of wide rows
+// stay in the CPU caches. The size never exceeds the chunk_size of the runtime state, which the operators rely on,
+// and never drops below 1/8 of it, so the per-chunk overhead of the narrow rows does not grow much.
+//
+// update() is called by the driver thread only, chunk_size() may be read by the scan io threads.
+class AdaptiveChunkSizeController {
+public:
+    AdaptiveChunkSizeController(size_t max_chunk_size, size_t target_bytes);
+
+    // Samples one chunk out of every kSampleInterval chunks, since bytes_usage() is not free for some columns.
+    void update(const Chunk& chunk);
+
+    size_t chunk_size() const { return _chunk_size.load(std::memory_order_relaxed); }
+
+    size_t max_chunk_size() const { return _max_chunk_size; }
+    size_t min_chunk_size() const { return _min_chunk_size; }
+
+    // Exponential moving average of the bytes per row of the sampled chunks, 0 before the first sample.
+    double bytes_per_row() const { return _bytes_per_row; }
+
+private:
+    static constexpr size_t kSampleInterval = 8;
+    static constexpr double kSmoothingFactor = 0.25;
+
+    void _resize();
+
+    const size_t _max_chunk_size;
+    const size_t _min_chunk_size;
+    const size_t _target_bytes;
+
+    size_t _num_chunks = 0;
+    double _bytes_per_row = 0;
+    std::atomic<size_t> _chunk_size;
+};
+
+using AdaptiveChunkSizeControllerPtr = std::shared_ptr<AdaptiveChunkSizeController>;
+
+} // namespace starrocks::pipeline
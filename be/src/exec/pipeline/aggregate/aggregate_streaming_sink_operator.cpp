@@ -29,12 +29,19 @@ Status AggregateStreamingSinkOperator::prepare(RuntimeState* state) {
     if (_aggregator->streaming_preaggregation_mode() == TStreamingPreaggregationMode::LIMITED_MEM) {
         _limited_mem_state.limited_memory_size = config::streaming_agg_limited_memory_size;
     }
+    _auto_pass_through_chunks = ADD_COUNTER(_unique_metrics, "AutoPassThroughChunks", TUnit::UNIT);
+    _auto_preagg_chunks = ADD_COUNTER(_unique_metrics, "AutoPreaggChunks", TUnit::UNIT);
+    _auto_selective_preagg_chunks = ADD_COUNTER(_unique_metrics, "AutoSelectivePreaggChunks", TUnit::UNIT);
+    _auto_state_switches = ADD_COUNTER(_unique_metrics, "AutoStateSwitches", TUnit::UNIT);
     return _aggregator->open(state);
 }
 
 void AggregateStreamingSinkOperator::close(RuntimeState* state) {
     auto* counter = ADD_COUNTER(_unique_metrics, "HashTableMemoryUsage", TUnit::BYTES);
     counter->set(_aggregator->hash_map_memory_usage());
+    if (_auto_state_switches != nullptr && _auto_state_switches->value() > 0) {
+        _unique_metrics->add_info_string("AutoLastState", _auto_context.get_auto_state_string(_auto_state));
+    }
     _aggregator->unref(state);
     Operator::close(state);
 }
@@ -163,8 +170,19 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_selective_preaggregation(c
  * should be small enough to limit the size of hash table.
  *
  * SELECTIVE_PREAGG state aggregates continuous_limit chunks, then shifting to ADJUST state.
+ *
+ * PREAGG and SELECTIVE_PREAGG also track the reduction over windows of AggrAutoContext::ReductionWindow chunks, and
+ * shift to ADJUST early once it doesn't fit them: a lowly aggregated window for PREAGG, a lowly or highly aggregated
+ * window for SELECTIVE_PREAGG. When ADJUST settles down on another state than last time, continuous_limit is reset,
+ * so that a driver whose input changes (e.g. a new partition of the scan) reacts as fast as at the beginning.
  */
 Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk, const size_t chunk_size) {
+    const AggrAutoState prev_state = _auto_state;
+    DeferOp count_switch([&]() {
+        if (_auto_state != prev_state) {
+            COUNTER_UPDATE(_auto_state_switches, 1);
+        }
+    });
     size_t allocated_bytes = _aggregator->hash_map_variant().allocated_memory_usage(_aggregator->mem_pool());
     const size_t continuous_limit = _auto_context.get_continuous_limit();
     switch (_auto_state) {
@@ -175,6 +193,7 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
             _aggregator->should_expand_preagg_hash_tables(_aggregator->num_input_rows(), chunk_size, allocated_bytes,
                                                           _aggregator->hash_map_variant().size())) {
             // hash table is not full or allow to expand the hash table according reduction rate
+            COUNTER_UPDATE(_auto_preagg_chunks, 1);
             SCOPED_TIMER(_aggregator->agg_compute_timer());
             TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map(chunk_size));
             if (_aggregator->is_none_group_by_exprs()) {
@@ -204,11 +223,13 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
         size_t hit_count = SIMD::count_zero(_aggregator->streaming_selection());
         if (_auto_context.adjust_count < continuous_limit && _auto_context.is_low_reduction(hit_count, chunk_size)) {
             RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
+            COUNTER_UPDATE(_auto_pass_through_chunks, 1);
             _auto_context.pass_through_count++;
             _auto_context.preagg_count = 0;
             _auto_context.selective_preagg_count = 0;
             if (_auto_context.pass_through_count == AggrAutoContext::StableLimit) {
                 _auto_state = AggrAutoState::PASS_THROUGH;
+                _auto_context.settle(_auto_state);
                 VLOG_ROW << "auto agg: continuous " << AggrAutoContext::StableLimit << " low reduction "
                          << hit_count * 1.0 / chunk_size << " "
                          << _auto_context.get_auto_state_string(AggrAutoState::ADJUST) << " -> "
@@ -219,6 +240,7 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
                    _auto_context.is_high_reduction(hit_count, chunk_size) &&
                    allocated_bytes < AggrAutoContext::MaxHtSize) {
             RETURN_IF_ERROR(_push_chunk_by_force_preaggregation(chunk, chunk_size));
+            COUNTER_UPDATE(_auto_preagg_chunks, 1);
 
             _auto_context.preagg_count++;
             _auto_context.pass_through_count = 0;
@@ -226,6 +248,7 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
             if (_auto_context.preagg_count == AggrAutoContext::StableLimit) {
                 _auto_state = AggrAutoState::PREAGG;
                 _auto_context.preagg_count = 0;
+                _auto_context.settle(_auto_state);
                 VLOG_ROW << "auto agg: continuous " << AggrAutoContext::StableLimit << " high reduction "
                          << hit_count * 1.0 / chunk_size << " "
                          << _auto_context.get_auto_state_string(AggrAutoState::ADJUST) << " -> "
@@ -233,11 +256,13 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
             }
         } else {
             RETURN_IF_ERROR(_push_chunk_by_selective_preaggregation(chunk, chunk_size, false));
+            COUNTER_UPDATE(_auto_selective_preagg_chunks, 1);
             _auto_context.selective_preagg_count++;
             _auto_context.pass_through_count = 0;
             _auto_context.preagg_count = 0;
             if (_auto_context.selective_preagg_count == AggrAutoContext::StableLimit) {
                 _auto_state = AggrAutoState::SELECTIVE_PREAGG;
+                _auto_context.settle(_auto_state);
                 VLOG_ROW << "auto agg: continuous " << AggrAutoContext::StableLimit << " "
                          << _auto_context.get_auto_state_string(AggrAutoState::ADJUST)
                          << _auto_context.get_auto_state_string(_auto_state);
@@ -247,6 +272,7 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
     }
     case AggrAutoState::PASS_THROUGH: {
         RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
+        COUNTER_UPDATE(_auto_pass_through_chunks, 1);
         _auto_context.pass_through_count++;
         if (_auto_context.pass_through_count > continuous_limit) {
             _auto_state =
@@ -264,11 +290,24 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
     }
     case AggrAutoState::FORCE_PREAGG:
     case AggrAutoState::PREAGG: {
+        const size_t ht_size = _aggregator->hash_map_variant().size();
         RETURN_IF_ERROR(_push_chunk_by_force_preaggregation(chunk, chunk_size));
+        COUNTER_UPDATE(_auto_preagg_chunks, 1);
         _auto_context.preagg_count++;
         auto limit = _auto_state == AggrAutoState::FORCE_PREAGG ? AggrAutoContext::ForcePreaggLimit
                                                                 : AggrAutoContext::PreaggLimit;
-        if (_auto_context.preagg_count > limit) {
+        bool low_reduction_window = false;
+        if (_auto_state == AggrAutoState::PREAGG) {
+            // rows not creating new groups are aggregated into existing ones.
+            const size_t new_groups = _aggregator->hash_map_variant().size() - ht_size;
+            const size_t agg_count = chunk_size > new_groups ? chunk_size - new_groups : 0;
+            if (_auto_context.observe_reduction(agg_count, chunk_size)) {
+                low_reduction_window =
+                        _auto_context.is_low_reduction(_auto_context.window_agg_rows, _auto_context.window_rows);
+                _auto_context.reset_reduction_window();
+            }
+        }
+        if (_auto_context.preagg_count > limit || low_reduction_window) {
             auto current_state = _auto_context.get_auto_state_string(_auto_state);
             _auto_state = AggrAutoState::ADJUST;
             _auto_context.preagg_count = 0;
@@ -280,8 +319,19 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
     }
     case AggrAutoState::SELECTIVE_PREAGG: {
         RETURN_IF_ERROR(_push_chunk_by_selective_preaggregation(chunk, chunk_size, true));
+        COUNTER_UPDATE(_auto_selective_preagg_chunks, 1);
         _auto_context.selective_preagg_count++;
-        if (_auto_context.selective_preagg_count > continuous_limit) {
+        bool unfit_reduction_window = false;
+        if (_auto_context.observe_reduction(SIMD::count_zero(_aggregator->streaming_selection()), chunk_size)) {
+            const size_t agg_rows = _auto_context.window_agg_rows;
+            const size_t rows = _auto_context.window_rows;
+            // a highly aggregated window only fits PREAGG if the hash table is still allowed to grow.
+            unfit_reduction_window = _auto_context.is_low_reduction(agg_rows, rows) ||
+                                     (_auto_context.is_high_reduction(agg_rows, rows) &&
+                                      allocated_bytes < AggrAutoContext::MaxHtSize);
+            _auto_context.reset_reduction_window();
+        }
+        if (_auto_context.selective_preagg_count > continuous_limit || unfit_reduction_window) {
             _auto_state = AggrAutoState::ADJUST;
             _auto_context.selective_preagg_count = 0;
             _auto_context.adjust_count = 0;
@@ -76,6 +76,11 @@ private:
     AggrAutoState _auto_state{};
     AggrAutoContext _auto_context;
     LimitedMemAggState _limited_mem_state;
+
+    RuntimeProfile::Counter* _auto_pass_through_chunks = nullptr;
+    RuntimeProfile::Counter* _auto_preagg_chunks = nullptr;
+    RuntimeProfile::Counter* _auto_selective_preagg_chunks = nullptr;
+    RuntimeProfile::Counter* _auto_state_switches = nullptr;
 };
 
 class AggregateStreamingSinkOperatorFactory final : public OperatorFactory {
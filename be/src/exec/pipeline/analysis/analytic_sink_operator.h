@@ -42,7 +42,7 @@ public:
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
     Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
 
-private:
+protected:
     TPlanNode _tnode;
     // It is used to perform analytic algorithms
     // shared by AnalyticSourceOperator
@@ -0,0 +1,64 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/analysis/spillable_analytic_sink_operator.h"
+
+#include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/query_context.h"
+#include "gen_cpp/InternalService_types.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+Status SpillableAnalyticSinkOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(AnalyticSinkOperator::prepare(state));
+    _spill_metrics = spill::SpillProcessMetrics(_unique_metrics.get(), state->mutable_total_spill_bytes());
+    if (state->spill_mode() == TSpillMode::FORCE) {
+        _strategy = spill::SpillStrategy::SPILL_ALL;
+    }
+    _peak_revocable_mem_bytes = _unique_metrics->AddHighWaterMarkCounter(
+            "PeakRevocableMemoryBytes", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
+    return Status::OK();
+}
+
+Status SpillableAnalyticSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    RETURN_IF_ERROR(AnalyticSinkOperator::push_chunk(state, chunk));
+    // Spill in batches of at least min_spilled_size, the chunks of the partition being output are spilled
+    // again once they are buffered enough.
+    if (_strategy == spill::SpillStrategy::SPILL_ALL &&
+        _analytor->spillable_bytes() >= _spill_options->min_spilled_size) {
+        RETURN_IF_ERROR(_analytor->spill_buffered_chunks(_spill_factory, *_spill_options, _spill_metrics));
+    }
+    set_revocable_mem_bytes(_analytor->spillable_bytes());
+    return Status::OK();
+}
+
+Status SpillableAnalyticSinkOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorFactory::prepare(state));
+
+    _spill_options = std::make_shared<spill::SpilledOptions>();
+    _spill_options->spill_mem_table_bytes_size = state->spill_mem_table_size();
+    _spill_options->mem_table_pool_size = state->spill_mem_table_num();
+    _spill_options->spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+    _spill_options->min_spilled_size = state->spill_operator_min_bytes();
+    _spill_options->block_manager = state->query_ctx()->spill_manager()->block_manager();
+    _spill_options->name = "spillable-analytic-sink";
+    _spill_options->plan_node_id = _plan_node_id;
+    _spill_options->encode_level = state->spill_encode_level();
+    _spill_options->wg = state->fragment_ctx()->workgroup();
+
+    return Status::OK();
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,81 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "exec/pipeline/analysis/analytic_sink_operator.h"
+#include "exec/spill/options.h"
+#include "exec/spill/spiller.h"
+#include "exec/spill/spiller_factory.h"
+
+namespace starrocks::pipeline {
+
+// The input of an analytic node is sorted by the partition and order keys, and a partition is buffered until its
+// end is found. The spillable sink spills the buffered input chunks, except the columns the window functions are
+// evaluated on, and they are streamed back one by one when the results of them are output.
+class SpillableAnalyticSinkOperator final : public AnalyticSinkOperator {
+public:
+    SpillableAnalyticSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                                  const TPlanNode& tnode, AnalytorPtr&& analytor,
+                                  std::shared_ptr<spill::SpilledOptions> spill_options,
+                                  std::shared_ptr<spill::SpillerFactory> spill_factory)
+            : AnalyticSinkOperator(factory, id, plan_node_id, driver_sequence, tnode, std::move(analytor)),
+              _spill_options(std::move(spill_options)),
+              _spill_factory(std::move(spill_factory)) {}
+
+    ~SpillableAnalyticSinkOperator() override = default;
+
+    Status prepare(RuntimeState* state) override;
+
+    void set_execute_mode(int performance_level) override { _strategy = spill::SpillStrategy::SPILL_ALL; }
+
+    bool spillable() const override { return true; }
+
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
+
+private:
+    std::shared_ptr<spill::SpilledOptions> _spill_options;
+    std::shared_ptr<spill::SpillerFactory> _spill_factory;
+    spill::SpillProcessMetrics _spill_metrics;
+    spill::SpillStrategy _strategy = spill::SpillStrategy::NO_SPILL;
+};
+
+class SpillableAnalyticSinkOperatorFactory final : public OperatorFactory {
+public:
+    SpillableAnalyticSinkOperatorFactory(int32_t id, int32_t plan_node_id, const TPlanNode& tnode,
+                                         AnalytorFactoryPtr analytor_factory)
+            : OperatorFactory(id, "spillable_analytic_sink", plan_node_id),
+              _tnode(tnode),
+              _analytor_factory(std::move(analytor_factory)) {}
+
+    ~SpillableAnalyticSinkOperatorFactory() override = default;
+
+    Status prepare(RuntimeState* state) override;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        auto analytor = _analytor_factory->create(driver_sequence);
+        return std::make_shared<SpillableAnalyticSinkOperator>(this, _id, _plan_node_id, driver_sequence, _tnode,
+                                                               std::move(analytor), _spill_options, _spill_factory);
+    }
+
+private:
+    TPlanNode _tnode;
+    AnalytorFactoryPtr _analytor_factory;
+    std::shared_ptr<spill::SpilledOptions> _spill_options;
+    std::shared_ptr<spill::SpillerFactory> _spill_factory = std::make_shared<spill::SpillerFactory>();
+};
+} // namespace starrocks::pipeline
@@ -25,6 +25,9 @@ Status ChunkAccumulateOperator::prepare(RuntimeState* state) {
 }
 
 Status ChunkAccumulateOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_adaptive_chunk_size != nullptr) {
+        _acc.set_max_size(std::min<size_t>(_adaptive_chunk_size->chunk_size(), state->chunk_size()));
+    }
     _acc.push(chunk);
     return Status::OK();
 }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "exec/pipeline/adaptive_chunk_size.h"
 #include "exec/pipeline/operator.h"
 #include "storage/chunk_helper.h"
 
@@ -46,8 +47,14 @@ public:
 
     Status reset_state(RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) override;
 
+    // Accumulate up to the chunk size adapted by the driver instead of the chunk_size of the runtime state.
+    void set_adaptive_chunk_size(AdaptiveChunkSizeControllerPtr controller) {
+        _adaptive_chunk_size = std::move(controller);
+    }
+
 private:
     ChunkPipelineAccumulator _acc;
+    AdaptiveChunkSizeControllerPtr _adaptive_chunk_size;
 };
 
 class ChunkAccumulateOperatorFactory final : public OperatorFactory {
@@ -35,6 +35,8 @@
 #include "service/brpc.h"
 #include "util/compression/block_compression.h"
 #include "util/compression/compression_utils.h"
+#include "util/iobuf_util.h"
+#include "util/pretty_printer.h"
 
 namespace starrocks::pipeline {
 
@@ -385,6 +387,11 @@ ExchangeSinkOperator::ExchangeSinkOperator(
 
     _shuffler = std::make_unique<Shuffler>(runtime_state()->func_version() <= 3, !_is_channel_bound_driver_sequence,
                                            _part_type, _channels.size(), _num_shuffles_per_channel);
+    if ((_part_type == TPartitionType::HASH_PARTITIONED ||
+         _part_type == TPartitionType::BUCKET_SHUFFLE_HASH_PARTITIONED) &&
+        _num_shuffles > 1 && config::shuffle_skew_detect_sample_rows > 0) {
+        _skew_detector = std::make_unique<ShuffleSkewDetector>(_num_shuffles, config::shuffle_skew_detect_sample_rows);
+    }
 }
 
 Status ExchangeSinkOperator::prepare(RuntimeState* state) {
@@ -461,7 +468,9 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
 }
 
 bool ExchangeSinkOperator::is_finished() const {
-    return _is_finished;
+    // finish early once all the receivers need no more chunks, e.g. a limit above the exchange is reached,
+    // so the operators before the sink stop producing chunks nobody reads
+    return _is_finished || (_buffer != nullptr && _buffer->is_all_receivers_finished());
 }
 
 bool ExchangeSinkOperator::need_input() const {
@@ -586,6 +595,9 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
             // Compute row indexes for each channel's each shuffle
             _channel_row_idx_start_points.assign(_num_shuffles + 1, 0);
             _shuffler->exchange_shuffle(_shuffle_channel_ids, _hash_values, num_rows);
+            if (_skew_detector != nullptr && _skew_detector->is_sampling()) {
+                _skew_detector->sample(_hash_values.data(), _shuffle_channel_ids.data(), num_rows);
+            }
 
             for (size_t i = 0; i < num_rows; ++i) {
                 _channel_row_idx_start_points[_shuffle_channel_ids[i]]++;
@@ -662,6 +674,21 @@ void ExchangeSinkOperator::close(RuntimeState* state) {
     if (_driver_sequence == 0) {
         _buffer->update_profile(_unique_metrics.get());
     }
+    if (_encode_context != nullptr) {
+        // e.g. "0: level=3, ratio=0.42, time=1.2ms; 1: level=0, ratio=1.00, time=15.3us"
+        std::string column_stats;
+        const auto& stats = _encode_context->column_encode_stats();
+        for (size_t i = 0; i < stats.size(); ++i) {
+            double ratio = stats[i].raw_bytes == 0 ? 1 : stats[i].encoded_bytes * 1.0 / stats[i].raw_bytes;
+            column_stats += fmt::format("{}{}: level={}, ratio={:.2f}, time={}", i == 0 ? "" : "; ", i,
+                                        _encode_context->get_encode_level(i), ratio,
+                                        PrettyPrinter::print(stats[i].encode_ns, TUnit::TIME_NS));
+        }
+        _unique_metrics->add_info_string("ColumnEncodeStats", column_stats);
+    }
+    if (_skew_detector != nullptr) {
+        _skew_detector->update_profile(_unique_metrics.get());
+    }
     Operator::close(state);
 }
 
@@ -673,7 +700,11 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
         SCOPED_TIMER(_serialize_chunk_timer);
         // We only serialize chunk meta for first chunk
         if (*is_first_chunk) {
-            _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(src->columns().size(), _encode_level);
+            // The context is shared by all the channels, which send chunks of the same columns.
+            if (_encode_context == nullptr) {
+                _encode_context =
+                        serde::EncodeContext::get_encode_context_shared_ptr(src->columns().size(), _encode_level);
+            }
             StatusOr<ChunkPB> res = Status::OK();
             TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize(*src, _encode_context));
             RETURN_IF_ERROR(res);
@@ -740,6 +771,16 @@ int64_t ExchangeSinkOperator::construct_brpc_attachment(const PTransmitChunkPara
         auto chunk = chunk_request->mutable_chunks(i);
         chunk->set_data_size(chunk->data().size());
 
+        const int64_t zero_copy_min_bytes = config::exchange_zero_copy_attachment_min_bytes;
+        if (zero_copy_min_bytes >= 0 && chunk->data_size() >= zero_copy_min_bytes) {
+            // The serialized data is moved into the attachment, and is freed after brpc sends it out. The memory
+            // has been consumed by the current thread when serializing the chunk.
+            attachment_physical_bytes +=
+                    iobuf_append_string_without_copy(&attachment, std::move(*chunk->mutable_data()));
+            chunk->clear_data();
+            continue;
+        }
+
         int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
         attachment.append(chunk->data());
         attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
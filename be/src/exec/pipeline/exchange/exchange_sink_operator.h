@@ -22,6 +22,7 @@
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exec/data_sink.h"
+#include "exec/pipeline/exchange/shuffle_skew_detector.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
 #include "exec/pipeline/fragment_context.h"
@@ -208,6 +209,8 @@ private:
     const std::vector<int32_t>& _output_columns;
 
     std::unique_ptr<Shuffler> _shuffler;
+    // Only set for hash shuffle if shuffle_skew_detect_sample_rows > 0.
+    std::unique_ptr<ShuffleSkewDetector> _skew_detector;
 
     std::shared_ptr<serde::EncodeContext> _encode_context = nullptr;
 };
@@ -30,11 +30,15 @@ public:
     virtual ~ExchangeSourceOperator() = default;
 
     Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
 
     bool has_output() const override;
 
     bool is_finished() const override;
 
+    // DataStreamRecvr notifies the observer when the chunks arrive or the senders finish.
+    bool is_observable() const override { return true; }
+
     Status set_finishing(RuntimeState* state) override;
 
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
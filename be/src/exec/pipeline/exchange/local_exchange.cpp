@@ -17,6 +17,7 @@
 #include <memory>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exprs/expr_context.h"
 #include "util/runtime_profile.h"
@@ -53,6 +54,11 @@ Status Partitioner::partition_chunk(const ChunkPtr& chunk, int32_t num_partition
 Status Partitioner::send_chunk(const ChunkPtr& chunk,
                                const std::shared_ptr<std::vector<uint32_t>>& partition_row_indexes) {
     size_t num_partitions = _source->get_sources().size();
+    const int32_t batch_rows = config::local_exchange_shuffle_batch_rows;
+    if (batch_rows > 0 && _pending_chunks.size() != num_partitions) {
+        _pending_chunks.resize(num_partitions);
+        _pending_rows.resize(num_partitions, 0);
+    }
     for (size_t i = 0; i < num_partitions; ++i) {
         size_t from = partition_begin_offset(i);
         size_t size = partition_end_offset(i) - from;
@@ -61,8 +67,31 @@ Status Partitioner::send_chunk(const ChunkPtr& chunk,
             continue;
         }
 
-        RETURN_IF_ERROR(_source->get_sources()[i]->add_chunk(chunk, partition_row_indexes, from, size,
-                                                             partition_memory_usage(i)));
+        if (batch_rows <= 0) {
+            RETURN_IF_ERROR(_source->get_sources()[i]->add_chunk(chunk, partition_row_indexes, from, size,
+                                                                 partition_memory_usage(i)));
+            continue;
+        }
+        _pending_chunks[i].push_back(PartitionChunkRef{chunk, partition_row_indexes, static_cast<uint32_t>(from),
+                                                       static_cast<uint32_t>(size), partition_memory_usage(i)});
+        _pending_rows[i] += size;
+        if (_pending_rows[i] >= static_cast<size_t>(batch_rows)) {
+            RETURN_IF_ERROR(_source->get_sources()[i]->add_chunks(&_pending_chunks[i]));
+            _pending_chunks[i].clear();
+            _pending_rows[i] = 0;
+        }
+    }
+    return Status::OK();
+}
+
+Status Partitioner::flush() {
+    for (size_t i = 0; i < _pending_chunks.size(); ++i) {
+        if (_pending_chunks[i].empty()) {
+            continue;
+        }
+        RETURN_IF_ERROR(_source->get_sources()[i]->add_chunks(&_pending_chunks[i]));
+        _pending_chunks[i].clear();
+        _pending_rows[i] = 0;
     }
     return Status::OK();
 }
@@ -97,9 +126,22 @@ Status ShufflePartitioner::shuffle_channel_ids(const ChunkPtr& chunk, int32_t nu
     _shuffle_channel_id.resize(num_rows);
 
     _shuffler->local_exchange_shuffle(_shuffle_channel_id, _hash_values, num_rows);
+
+    if (_skew_detector == nullptr && config::shuffle_skew_detect_sample_rows > 0 && num_partitions > 1) {
+        _skew_detector = std::make_unique<ShuffleSkewDetector>(num_partitions, config::shuffle_skew_detect_sample_rows);
+    }
+    if (_skew_detector != nullptr && _skew_detector->is_sampling()) {
+        _skew_detector->sample(_hash_values.data(), _shuffle_channel_id.data(), num_rows);
+    }
     return Status::OK();
 }
 
+void ShufflePartitioner::update_profile(RuntimeProfile* profile) {
+    if (_skew_detector != nullptr) {
+        _skew_detector->update_profile(profile);
+    }
+}
+
 Status RandomPartitioner::shuffle_channel_ids(const ChunkPtr& chunk, int32_t num_partitions) {
     size_t num_rows = chunk->num_rows();
     _shuffle_channel_id.resize(num_rows, 0);
@@ -162,6 +204,14 @@ Status PartitionExchanger::accept(const ChunkPtr& chunk, const int32_t sink_driv
     return Status::OK();
 }
 
+Status PartitionExchanger::flush(int32_t sink_driver_sequence) {
+    return _partitioners[sink_driver_sequence]->flush();
+}
+
+void PartitionExchanger::update_sink_profile(int32_t sink_driver_sequence, RuntimeProfile* profile) {
+    _partitioners[sink_driver_sequence]->update_profile(profile);
+}
+
 OrderedPartitionExchanger::OrderedPartitionExchanger(const std::shared_ptr<ChunkBufferMemoryManager>& memory_manager,
                                                      LocalExchangeSourceOperatorFactory* source,
                                                      std::vector<ExprContext*> partition_expr_ctxs)
@@ -400,6 +450,10 @@ Status RandomPassthroughExchanger::accept(const ChunkPtr& chunk, const int32_t s
     return Status::OK();
 }
 
+Status RandomPassthroughExchanger::flush(int32_t sink_driver_sequence) {
+    return _random_partitioners[sink_driver_sequence]->flush();
+}
+
 void AdaptivePassthroughExchanger::incr_sinker() {
     LocalExchanger::incr_sinker();
     _random_partitioners.emplace_back(std::make_unique<RandomPartitioner>(_source));
@@ -437,4 +491,8 @@ Status AdaptivePassthroughExchanger::accept(const ChunkPtr& chunk, const int32_t
     return Status::OK();
 }
 
+Status AdaptivePassthroughExchanger::flush(int32_t sink_driver_sequence) {
+    return _random_partitioners[sink_driver_sequence]->flush();
+}
+
 } // namespace starrocks::pipeline
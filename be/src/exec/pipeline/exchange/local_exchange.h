@@ -20,6 +20,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/chunk_buffer_memory_manager.h"
 #include "exec/pipeline/exchange/local_exchange_source_operator.h"
+#include "exec/pipeline/exchange/shuffle_skew_detector.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exprs/expr_context.h"
 #include "util/runtime_profile.h"
@@ -46,8 +47,13 @@ public:
     Status partition_chunk(const ChunkPtr& chunk, int32_t num_partitions, std::vector<uint32_t>& partition_row_indexes);
 
     // Send chunk to each source by using `partition_row_indexes`.
+    // The rows of a source are batched with the ones of the following chunks until there are at least
+    // config::local_exchange_shuffle_batch_rows of them, and then handed over under one lock of the source.
     Status send_chunk(const ChunkPtr& chunk, const std::shared_ptr<std::vector<uint32_t>>& partition_row_indexes);
 
+    // Hand over the batched rows to the sources.
+    Status flush();
+
     size_t partition_begin_offset(size_t partition_id) { return _partition_row_indexes_start_points[partition_id]; }
 
     size_t partition_end_offset(size_t partition_id) { return _partition_row_indexes_start_points[partition_id + 1]; }
@@ -71,6 +77,10 @@ protected:
     std::vector<size_t> _partition_row_indexes_start_points;
     std::vector<size_t> _partition_memory_usage;
     std::vector<uint32_t> _shuffle_channel_id;
+
+    // the batched partition chunks and their number of rows of each source
+    std::vector<std::vector<PartitionChunkRef>> _pending_chunks;
+    std::vector<size_t> _pending_rows;
 };
 
 // Shuffle by partition columns and partition type.
@@ -86,6 +96,8 @@ public:
 
     Status shuffle_channel_ids(const ChunkPtr& chunk, int32_t num_partitions) override;
 
+    void update_profile(RuntimeProfile* profile);
+
 private:
     const TPartitionType::type _part_type;
     // Compute per-row partition values.
@@ -93,6 +105,7 @@ private:
     Columns _partitions_columns;
     std::vector<uint32_t> _hash_values;
     std::unique_ptr<Shuffler> _shuffler;
+    std::unique_ptr<ShuffleSkewDetector> _skew_detector;
 };
 
 // Random shuffle row-by-row for each chunk of source.
@@ -122,6 +135,13 @@ public:
 
     virtual Status accept(const ChunkPtr& chunk, int32_t sink_driver_sequence) = 0;
 
+    // Called by the sink_driver_sequence-th local sink operator when it finishes or finishes an epoch, to hand over
+    // the chunks it still holds to the sources.
+    virtual Status flush(int32_t sink_driver_sequence) { return Status::OK(); }
+
+    // Called by the sink_driver_sequence-th local sink operator when it finishes.
+    virtual void update_sink_profile(int32_t sink_driver_sequence, RuntimeProfile* profile) {}
+
     virtual void finish(RuntimeState* state) {
         if (decr_sinker() == 1) {
             for (auto* source : _source->get_sources()) {
@@ -187,6 +207,10 @@ public:
 
     Status accept(const ChunkPtr& chunk, int32_t sink_driver_sequence) override;
 
+    Status flush(int32_t sink_driver_sequence) override;
+
+    void update_sink_profile(int32_t sink_driver_sequence, RuntimeProfile* profile) override;
+
     void incr_sinker() override;
 
 private:
@@ -302,6 +326,7 @@ public:
 
     void incr_sinker() override;
     Status accept(const ChunkPtr& chunk, int32_t sink_driver_sequence) override;
+    Status flush(int32_t sink_driver_sequence) override;
 
 private:
     std::vector<std::unique_ptr<RandomPartitioner>> _random_partitioners;
@@ -319,6 +344,7 @@ public:
 
     void incr_sinker() override;
     Status accept(const ChunkPtr& chunk, int32_t sink_driver_sequence) override;
+    Status flush(int32_t sink_driver_sequence) override;
 
 private:
     std::vector<std::unique_ptr<RandomPartitioner>> _random_partitioners;
@@ -40,6 +40,8 @@ StatusOr<ChunkPtr> LocalExchangeSinkOperator::pull_chunk(RuntimeState* state) {
 
 Status LocalExchangeSinkOperator::set_finishing(RuntimeState* state) {
     _is_finished = true;
+    RETURN_IF_ERROR(_exchanger->flush(_driver_sequence));
+    _exchanger->update_sink_profile(_driver_sequence, _unique_metrics.get());
     _exchanger->finish(state);
     return Status::OK();
 }
@@ -45,7 +45,7 @@ public:
     bool is_epoch_finished() const override { return _is_epoch_finished; }
     Status set_epoch_finishing(RuntimeState* state) override {
         _is_epoch_finished = true;
-        return Status::OK();
+        return _exchanger->flush(_driver_sequence);
     }
     Status set_epoch_finished(RuntimeState* state) override {
         _exchanger->epoch_finish(state);
@@ -31,6 +31,7 @@ void LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk) {
     _local_memory_usage += memory_usage;
     _full_chunk_queue.emplace(std::move(chunk));
     _memory_manager->update_memory_usage(memory_usage, num_rows);
+    notify_observer();
 }
 
 // Used for PartitionExchanger.
@@ -49,6 +50,34 @@ Status LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk, const std::shared_
     _partition_rows_num += size;
     _local_memory_usage += memory_usage;
     _memory_manager->update_memory_usage(memory_usage, size);
+    notify_observer();
+
+    return Status::OK();
+}
+
+Status LocalExchangeSourceOperator::add_chunks(std::vector<PartitionChunkRef>* chunks) {
+    // unpack chunk's const column, since Chunk#append_selective cannot be const column
+    for (auto& ref : *chunks) {
+        ref.chunk->unpack_and_duplicate_const_columns();
+    }
+
+    std::lock_guard<std::mutex> l(_chunk_lock);
+    if (_is_finished) {
+        return Status::OK();
+    }
+
+    size_t num_rows = 0;
+    size_t memory_usage = 0;
+    for (auto& ref : *chunks) {
+        num_rows += ref.size;
+        memory_usage += ref.memory_usage;
+        _partition_chunk_queue.emplace(std::move(ref.chunk), std::move(ref.indexes), ref.from, ref.size,
+                                       ref.memory_usage);
+    }
+    _partition_rows_num += num_rows;
+    _local_memory_usage += memory_usage;
+    _memory_manager->update_memory_usage(memory_usage, num_rows);
+    notify_observer();
 
     return Status::OK();
 }
@@ -93,6 +122,7 @@ Status LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk, const std::shared_
 
     _local_memory_usage += memory_usage;
     _memory_manager->update_memory_usage(memory_usage, size);
+    notify_observer();
 
     return Status::OK();
 }
@@ -149,6 +179,7 @@ void LocalExchangeSourceOperator::enter_release_memory_mode() {
     _local_memory_limit = min_local_memory_limit;
     size_t max_memory_usage = min_local_memory_limit * _memory_manager->get_max_input_dop();
     _memory_manager->update_max_memory_usage(max_memory_usage);
+    notify_observer();
 }
 
 void LocalExchangeSourceOperator::set_execute_mode(int performance_level) {
@@ -53,6 +53,15 @@ struct PartitionKeyComparator {
     }
 };
 
+// The rows of `chunk` at the positions [from, from + size) of `indexes`, which a partition exchanger sends to a source.
+struct PartitionChunkRef {
+    ChunkPtr chunk;
+    std::shared_ptr<std::vector<uint32_t>> indexes;
+    uint32_t from = 0;
+    uint32_t size = 0;
+    size_t memory_usage = 0;
+};
+
 class LocalExchangeSourceOperator final : public SourceOperator {
     class PartitionChunk {
     public:
@@ -99,6 +108,9 @@ public:
     Status add_chunk(ChunkPtr chunk, const std::shared_ptr<std::vector<uint32_t>>& indexes, uint32_t from,
                      uint32_t size, size_t memory_bytes);
 
+    // Used for PartitionExchanger, adds the partition chunks batched by a sink under one lock.
+    Status add_chunks(std::vector<PartitionChunkRef>* chunks);
+
     Status add_chunk(ChunkPtr chunk, const std::shared_ptr<std::vector<uint32_t>>& indexes, uint32_t from,
                      uint32_t size, Columns& partition_columns, const std::vector<ExprContext*>& _partition_expr_ctxs,
                      size_t memory_bytes);
@@ -107,10 +119,14 @@ public:
 
     bool is_finished() const override;
 
+    // The exchanger notifies the observer when adding chunks or finishing this operator.
+    bool is_observable() const override { return true; }
+
     Status set_finished(RuntimeState* state) override;
     [[nodiscard]] Status set_finishing(RuntimeState* state) override {
         std::lock_guard<std::mutex> l(_chunk_lock);
         _is_finished = true;
+        notify_observer();
         return Status::OK();
     }
 
@@ -121,6 +137,7 @@ public:
     [[nodiscard]] Status set_epoch_finishing(RuntimeState* state) override {
         std::lock_guard<std::mutex> l(_chunk_lock);
         _is_epoch_finished = true;
+        notify_observer();
         return Status::OK();
     }
     Status reset_epoch(RuntimeState* state) override {
@@ -14,7 +14,12 @@
 
 #include "exec/pipeline/exchange/multi_cast_local_exchange.h"
 
+#include "common/config.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/spill/query_spill_manager.h"
+#include "serde/column_array_serde.h"
 #include "util/logging.h"
+#include "util/raw_container.h"
 
 namespace starrocks::pipeline {
 
@@ -39,6 +44,8 @@ MultiCastLocalExchanger::MultiCastLocalExchanger(RuntimeState* runtime_state, si
             "PeakMemoryUsage", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
     _peak_buffer_row_size_counter = _runtime_profile->AddHighWaterMarkCounter(
             "PeakBufferRowSize", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TUnit::UNIT));
+    _spill_chunks_counter = ADD_COUNTER(_runtime_profile, "SpillChunks", TUnit::UNIT);
+    _spill_bytes_counter = ADD_COUNTER(_runtime_profile, "SpillBytes", TUnit::BYTES);
 }
 
 MultiCastLocalExchanger::~MultiCastLocalExchanger() {
@@ -67,8 +74,26 @@ Status MultiCastLocalExchanger::push_chunk(const ChunkPtr& chunk, int32_t sink_d
 
     auto* cell = new Cell();
     cell->chunk = chunk;
+    cell->num_rows = chunk->num_rows();
     cell->memory_usage = chunk->memory_usage();
 
+    if (auto* block_manager = _spill_block_manager(); block_manager != nullptr) {
+        bool need_spill = false;
+        {
+            std::unique_lock l(_mutex);
+            const auto limit = static_cast<size_t>(config::multi_cast_local_exchange_spill_mem_bytes);
+            need_spill = _current_memory_usage + cell->memory_usage > limit;
+        }
+        // the cell is not visible to the consumers yet, so it is written without the lock
+        if (need_spill) {
+            auto st = _spill(cell, block_manager);
+            if (!st.ok()) {
+                delete cell;
+                return st;
+            }
+        }
+    }
+
     {
         std::unique_lock l(_mutex);
 
@@ -80,7 +105,7 @@ Status MultiCastLocalExchanger::push_chunk(const ChunkPtr& chunk, int32_t sink_d
 
         _tail->next = cell;
         _tail = cell;
-        _current_accumulated_row_size += chunk->num_rows();
+        _current_accumulated_row_size += cell->num_rows;
         _current_memory_usage += cell->memory_usage;
         _current_row_size = _current_accumulated_row_size - _head->accumulated_row_size;
         _peak_memory_usage_counter->set(_current_memory_usage);
@@ -107,22 +132,96 @@ bool MultiCastLocalExchanger::can_pull_chunk(int32_t mcast_consumer_index) const
 StatusOr<ChunkPtr> MultiCastLocalExchanger::pull_chunk(RuntimeState* state, int32_t mcast_consumer_index) {
     DCHECK(mcast_consumer_index < _consumer_number);
 
-    std::unique_lock l(_mutex);
-    DCHECK(_progress[mcast_consumer_index] != nullptr);
-    Cell* cell = _progress[mcast_consumer_index];
-    if (cell->next == nullptr) {
-        if (_opened_sink_number == 0) return Status::EndOfFile("mcast_local_exchanger eof");
-        return Status::InternalError("unreachable in multicast local exchanger");
+    spill::BlockPtr block;
+    ChunkPtr empty_chunk;
+    {
+        std::unique_lock l(_mutex);
+        DCHECK(_progress[mcast_consumer_index] != nullptr);
+        Cell* cell = _progress[mcast_consumer_index];
+        if (cell->next == nullptr) {
+            if (_opened_sink_number == 0) return Status::EndOfFile("mcast_local_exchanger eof");
+            return Status::InternalError("unreachable in multicast local exchanger");
+        }
+        cell = cell->next;
+        VLOG_FILE << "MultiCastLocalExchanger: return chunk to " << mcast_consumer_index
+                  << ", spilled = " << (cell->chunk == nullptr) << ", size = " << cell->num_rows;
+
+        _progress[mcast_consumer_index] = cell;
+        cell->used_count += 1;
+
+        if (cell->chunk != nullptr) {
+            ChunkPtr chunk = cell->chunk;
+            _update_progress(cell);
+            return chunk;
+        }
+        // the cell may be released by _update_progress, keep what is needed to restore it
+        block = cell->block;
+        empty_chunk = cell->empty_chunk;
+        _update_progress(cell);
     }
-    cell = cell->next;
-    VLOG_FILE << "MultiCastLocalExchanger: return chunk to " << mcast_consumer_index
-              << ", row = " << cell->chunk->debug_row(0) << ", size = " << cell->chunk->num_rows();
+    // every consumer reads the spilled chunk by itself, out of the lock
+    return _restore(block, *empty_chunk);
+}
+
+spill::BlockManager* MultiCastLocalExchanger::_spill_block_manager() const {
+    if (config::multi_cast_local_exchange_spill_mem_bytes <= 0 || _runtime_state->query_ctx() == nullptr) {
+        return nullptr;
+    }
+    auto* spill_manager = _runtime_state->query_ctx()->spill_manager();
+    return spill_manager != nullptr ? spill_manager->block_manager() : nullptr;
+}
 
-    _progress[mcast_consumer_index] = cell;
-    cell->used_count += 1;
+Status MultiCastLocalExchanger::_spill(Cell* cell, spill::BlockManager* block_manager) {
+    const Columns& columns = cell->chunk->columns();
+    int64_t max_size = 0;
+    for (const auto& column : columns) {
+        max_size += serde::ColumnArraySerde::max_serialized_size(*column);
+    }
+    raw::RawString buffer;
+    buffer.resize(max_size);
+    auto* begin = reinterpret_cast<uint8_t*>(buffer.data());
+    uint8_t* end = begin;
+    for (const auto& column : columns) {
+        end = serde::ColumnArraySerde::serialize(*column, end);
+        RETURN_IF(end == nullptr, Status::InternalError("failed to serialize the chunk of multi cast exchanger"));
+    }
+    const size_t size = end - begin;
+
+    spill::AcquireBlockOptions opts;
+    opts.query_id = _runtime_state->query_id();
+    opts.fragment_instance_id = _runtime_state->fragment_instance_id();
+    opts.plan_node_id = -1;
+    opts.name = "multi_cast_local_exchange";
+    opts.block_size = size;
+    ASSIGN_OR_RETURN(auto block, block_manager->acquire_block(opts));
+    RETURN_IF_ERROR(block->append({Slice(begin, size)}));
+    RETURN_IF_ERROR(block->flush());
+    RETURN_IF_ERROR(block_manager->release_block(block));
+
+    COUNTER_UPDATE(_spill_chunks_counter, 1);
+    COUNTER_UPDATE(_spill_bytes_counter, size);
+    cell->empty_chunk = cell->chunk->clone_empty(0);
+    cell->block = std::move(block);
+    cell->chunk = nullptr;
+    cell->memory_usage = cell->empty_chunk->memory_usage();
+    return Status::OK();
+}
 
-    _update_progress(cell);
-    return cell->chunk;
+StatusOr<ChunkPtr> MultiCastLocalExchanger::_restore(const spill::BlockPtr& block, const Chunk& empty_chunk) {
+    raw::RawString buffer;
+    buffer.resize(block->size());
+    auto reader = block->get_reader();
+    auto st = reader->read_fully(buffer.data(), buffer.size());
+    RETURN_IF(st.is_end_of_file(), Status::InternalError("not found enough data in multi cast exchanger block"));
+    RETURN_IF_ERROR(st);
+
+    ChunkPtr chunk = empty_chunk.clone_empty(0);
+    const auto* cursor = reinterpret_cast<const uint8_t*>(buffer.data());
+    for (auto& column : chunk->columns()) {
+        cursor = serde::ColumnArraySerde::deserialize(cursor, column.get());
+        RETURN_IF(cursor == nullptr, Status::InternalError("failed to deserialize the chunk of multi cast exchanger"));
+    }
+    return chunk;
 }
 
 void MultiCastLocalExchanger::open_source_operator(int32_t mcast_consumer_index) {
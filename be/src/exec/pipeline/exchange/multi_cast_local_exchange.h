@@ -16,6 +16,7 @@
 
 #include "column/chunk.h"
 #include "exec/pipeline/source_operator.h"
+#include "exec/spill/block_manager.h"
 
 namespace starrocks::pipeline {
 
@@ -39,6 +40,11 @@ namespace starrocks::pipeline {
 // 1. can accept chunk or not. we don't want to block any consumer. we can accept chunk only when a any consumer needs chunk.
 // 2. can throw chunk or not. we can only throw any chunk when all consumers have consumed that chunk.
 // 3. can pull chiunk. we maintain the progress of consumers.
+//
+// The consumers may run at very different speeds, and only the fastest one applies back pressure to the sink, so the
+// chunks between the slowest and the fastest consumer can pile up. When spill is enabled for the query and the
+// buffered chunks exceed config::multi_cast_local_exchange_spill_mem_bytes, the chunks pushed since then are written
+// to a spill block instead, and each consumer reads them back when it reaches them.
 
 class MultiCastLocalExchangeSinkOperator;
 // ===== exchanger =====
@@ -60,12 +66,21 @@ public:
 private:
     struct Cell {
         ChunkPtr chunk = nullptr;
+        // the spilled chunk when `chunk` is nullptr, and an empty chunk of its columns to restore it into
+        spill::BlockPtr block = nullptr;
+        ChunkPtr empty_chunk = nullptr;
+        size_t num_rows = 0;
         Cell* next = nullptr;
         size_t memory_usage = 0;
         size_t accumulated_row_size = 0;
         // how many consumers have used this chunk
         int32_t used_count = 0;
     };
+    // Returns the block manager to spill into, nullptr if spill is not enabled for the query.
+    spill::BlockManager* _spill_block_manager() const;
+    // Writes the chunk of `cell` into a spill block and releases it. `cell` must not be linked yet.
+    Status _spill(Cell* cell, spill::BlockManager* block_manager);
+    static StatusOr<ChunkPtr> _restore(const spill::BlockPtr& block, const Chunk& empty_chunk);
     void _update_progress(Cell* fast = nullptr);
     void _closer_consumer(int32_t mcast_consumer_index);
     RuntimeState* _runtime_state;
@@ -85,6 +100,8 @@ private:
     std::unique_ptr<RuntimeProfile> _runtime_profile;
     RuntimeProfile::HighWaterMarkCounter* _peak_memory_usage_counter = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _peak_buffer_row_size_counter = nullptr;
+    RuntimeProfile::Counter* _spill_chunks_counter = nullptr;
+    RuntimeProfile::Counter* _spill_bytes_counter = nullptr;
 };
 
 // ===== source op =====
@@ -0,0 +1,82 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/shuffle_skew_detector.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+#include "common/logging.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks::pipeline {
+
+ShuffleSkewDetector::ShuffleSkewDetector(size_t num_partitions, size_t num_sample_rows)
+        : _num_partitions(num_partitions), _num_sample_rows(num_sample_rows), _partition_rows(num_partitions, 0) {}
+
+void ShuffleSkewDetector::sample(const uint32_t* hash_values, const uint32_t* partitions, size_t num_rows) {
+    if (_is_detected) {
+        return;
+    }
+    num_rows = std::min<size_t>(num_rows, _num_sample_rows - _num_sampled_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        _key_rows[hash_values[i]]++;
+        DCHECK_LT(partitions[i], _num_partitions);
+        _partition_rows[partitions[i]]++;
+    }
+    _num_sampled_rows += num_rows;
+    if (_num_sampled_rows >= _num_sample_rows) {
+        _detect();
+    }
+}
+
+void ShuffleSkewDetector::_detect() {
+    _is_detected = true;
+    if (_num_sampled_rows == 0 || _num_partitions <= 1) {
+        _key_rows.clear();
+        return;
+    }
+
+    // A key is hot if it alone has more rows than the average rows of a partition.
+    for (const auto& [hash, num_rows] : _key_rows) {
+        if (num_rows * _num_partitions > _num_sampled_rows) {
+            _hot_keys.push_back({hash, num_rows});
+        }
+    }
+    std::sort(_hot_keys.begin(), _hot_keys.end(),
+              [](const HotKey& lhs, const HotKey& rhs) { return lhs.num_rows > rhs.num_rows; });
+
+    uint64_t max_partition_rows = *std::max_element(_partition_rows.begin(), _partition_rows.end());
+    _skew_ratio = max_partition_rows * 1.0 * _num_partitions / _num_sampled_rows;
+
+    // The keys are only needed for sampling.
+    phmap::flat_hash_map<uint32_t, uint64_t>().swap(_key_rows);
+}
+
+void ShuffleSkewDetector::update_profile(RuntimeProfile* profile) {
+    if (!_is_detected) {
+        _detect();
+    }
+    uint64_t hot_key_rows = 0;
+    for (const auto& hot_key : _hot_keys) {
+        hot_key_rows += hot_key.num_rows;
+    }
+    double hot_key_percent = _num_sampled_rows == 0 ? 0 : hot_key_rows * 100.0 / _num_sampled_rows;
+    profile->add_info_string("ShuffleHotKeys",
+                             fmt::format("{} ({:.2f}% of sampled rows)", _hot_keys.size(), hot_key_percent));
+    profile->add_info_string("ShuffleSkewRatio", fmt::format("{:.2f}", _skew_ratio));
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,76 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+class RuntimeProfile;
+}
+
+namespace starrocks::pipeline {
+
+// ShuffleSkewDetector samples the hash values of the shuffle keys and the partitions of the first rows, and
+// detects the hot keys, each of which alone has more rows than the average rows of a partition.
+// A key is identified by its hash value, so the keys with the same hash value are counted as one.
+class ShuffleSkewDetector {
+public:
+    struct HotKey {
+        uint32_t hash;
+        uint64_t num_rows;
+    };
+
+    ShuffleSkewDetector(size_t num_partitions, size_t num_sample_rows);
+
+    bool is_sampling() const { return !_is_detected; }
+
+    // Samples the rows until `num_sample_rows` rows are sampled, and then detects the hot keys.
+    void sample(const uint32_t* hash_values, const uint32_t* partitions, size_t num_rows);
+
+    bool is_detected() const { return _is_detected; }
+
+    // The hot keys in descending order of the number of rows, valid after detected.
+    const std::vector<HotKey>& hot_keys() const { return _hot_keys; }
+
+    // The ratio of the max rows of a partition to the average rows, 1 means no skew, valid after detected.
+    double skew_ratio() const { return _skew_ratio; }
+
+    uint64_t num_sampled_rows() const { return _num_sampled_rows; }
+
+    // Adds e.g. "ShuffleHotKeys: 2 (61.52% of sampled rows)" and "ShuffleSkewRatio: 3.85" to the profile.
+    // Detects with the sampled rows if fewer than `num_sample_rows` rows are ever sampled.
+    void update_profile(RuntimeProfile* profile);
+
+private:
+    void _detect();
+
+    const size_t _num_partitions;
+    const size_t _num_sample_rows;
+    bool _is_detected = false;
+
+    uint64_t _num_sampled_rows = 0;
+    phmap::flat_hash_map<uint32_t, uint64_t> _key_rows;
+    std::vector<uint64_t> _partition_rows;
+
+    std::vector<HotKey> _hot_keys;
+    double _skew_ratio = 1;
+};
+
+} // namespace starrocks::pipeline
@@ -52,8 +52,10 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _num_finished_rpcs[instance_id.lo] = 0;
             _num_in_flight_rpcs[instance_id.lo] = 0;
             _network_times[instance_id.lo] = TimeTrace{};
+            _flow_controls[instance_id.lo] = ChannelFlowControl{};
             _mutexes[instance_id.lo] = std::make_unique<Mutex>();
             _dest_addrs[instance_id.lo] = dest.brpc_server;
+            _receiver_finished[instance_id.lo] = false;
 
             PUniqueId finst_id;
             finst_id.set_hi(instance_id.hi);
@@ -150,6 +152,11 @@ bool SinkBuffer::is_finished() const {
     return _num_sending_rpc == 0 && _total_in_flight_rpc == 0;
 }
 
+bool SinkBuffer::is_all_receivers_finished() const {
+    return config::enable_exchange_receiver_early_finish && !_buffers.empty() &&
+           _num_finished_receivers >= _buffers.size();
+}
+
 void SinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* rpc_count = ADD_COUNTER(profile, "RpcCount", TUnit::UNIT);
     auto* rpc_avg_timer = ADD_TIMER(profile, "RpcAvgTime");
@@ -176,8 +183,40 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
 
     auto* bytes_unsent_counter = ADD_COUNTER(profile, "BytesUnsent", TUnit::BYTES);
     auto* request_unsent_counter = ADD_COUNTER(profile, "RequestUnsent", TUnit::UNIT);
-    COUNTER_SET(bytes_unsent_counter, _bytes_enqueued - _bytes_sent);
-    COUNTER_SET(request_unsent_counter, _request_enqueued - _request_sent);
+    COUNTER_SET(bytes_unsent_counter, _bytes_enqueued - _bytes_sent - _bytes_skipped);
+    COUNTER_SET(request_unsent_counter, _request_enqueued - _request_sent - _request_skipped);
+
+    if (_request_skipped > 0) {
+        auto* bytes_skipped_counter = ADD_COUNTER(profile, "BytesSkipped", TUnit::BYTES);
+        auto* request_skipped_counter = ADD_COUNTER(profile, "RequestSkipped", TUnit::UNIT);
+        COUNTER_SET(bytes_skipped_counter, _bytes_skipped);
+        COUNTER_SET(request_skipped_counter, _request_skipped);
+    }
+
+    // The channel blocked the longest by the flow control, and the one with the lowest bandwidth
+    int64_t max_channel_wait_time = 0;
+    int64_t min_channel_bandwidth = -1;
+    int64_t slowest_instance_lo = 0;
+    for (auto& [instance_lo, flow_control] : _flow_controls) {
+        max_channel_wait_time = std::max(max_channel_wait_time, flow_control.wait_time);
+        const int64_t network_time = _network_times[instance_lo].average_time();
+        if (flow_control.bytes_sent == 0 || network_time <= 0) {
+            continue;
+        }
+        const auto bandwidth = static_cast<int64_t>(flow_control.bytes_sent * 1e9 / network_time);
+        if (min_channel_bandwidth == -1 || bandwidth < min_channel_bandwidth) {
+            min_channel_bandwidth = bandwidth;
+            slowest_instance_lo = instance_lo;
+        }
+    }
+    auto* max_channel_wait_timer = ADD_TIMER(profile, "MaxChannelWaitTime");
+    COUNTER_SET(max_channel_wait_timer, max_channel_wait_time);
+    if (min_channel_bandwidth != -1) {
+        auto* min_channel_bandwidth_counter = ADD_COUNTER(profile, "MinChannelBandwidth", TUnit::BYTES_PER_SECOND);
+        COUNTER_SET(min_channel_bandwidth_counter, min_channel_bandwidth);
+        const auto& dest_addr = _dest_addrs[slowest_instance_lo];
+        profile->add_info_string("SlowestChannel", fmt::format("{}:{}", dest_addr.hostname, dest_addr.port));
+    }
 
     profile->add_derived_counter(
             "NetworkBandwidth", TUnit::BYTES_PER_SECOND,
@@ -196,17 +235,45 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
 int64_t SinkBuffer::_network_time() {
     int64_t max = 0;
     for (auto& [_, time_trace] : _network_times) {
-        double average_concurrency =
-                static_cast<double>(time_trace.accumulated_concurrency) / std::max(1, time_trace.times);
-        int64_t average_accumulated_time =
-                static_cast<int64_t>(time_trace.accumulated_time / std::max(1.0, average_concurrency));
-        if (average_accumulated_time > max) {
-            max = average_accumulated_time;
-        }
+        max = std::max(max, time_trace.average_time());
     }
     return max;
 }
 
+bool SinkBuffer::_is_blocked_by_flow_control(int64_t instance_lo, const TransmitChunkInfo& request) {
+    const int32_t num_in_flight_rpcs = _num_in_flight_rpcs[instance_lo];
+    if (_is_dest_merge) {
+        // discontinuous_acked_window_size means that we are not received all the ack
+        // with sequence from _max_continuous_acked_seqs[x] to _request_seqs[x]
+        // Limit the size of the window to avoid buffering too much out-of-order data at the receiving side
+        int64_t discontinuous_acked_window_size = _request_seqs[instance_lo] - _max_continuous_acked_seqs[instance_lo];
+        if (discontinuous_acked_window_size >= config::pipeline_sink_brpc_dop) {
+            return true;
+        }
+    } else if (num_in_flight_rpcs >= config::pipeline_sink_brpc_dop) {
+        return true;
+    }
+
+    return _flow_controls[instance_lo].is_blocked(num_in_flight_rpcs, request.attachment.size());
+}
+
+bool ChannelFlowControl::is_blocked(int32_t num_in_flight_rpcs, int64_t request_bytes) const {
+    // One request is always allowed, so that a receiver without credit acks it and advertises its credit again.
+    if (!config::enable_exchange_sink_credit_flow_control || credit_bytes < 0 || num_in_flight_rpcs == 0) {
+        return false;
+    }
+    return in_flight_bytes + request_bytes > credit_bytes;
+}
+
+void ChannelFlowControl::on_sent(int64_t bytes) {
+    if (wait_start_timestamp != -1) {
+        wait_time += MonotonicNanos() - wait_start_timestamp;
+        wait_start_timestamp = -1;
+    }
+    in_flight_bytes += bytes;
+    bytes_sent += bytes;
+}
+
 void SinkBuffer::cancel_one_sinker(RuntimeState* const state) {
     if (--_num_uncancelled_sinkers == 0) {
         _is_finishing = true;
@@ -286,19 +353,12 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
         }
 
         auto& buffer = _buffers[instance_id.lo];
-
-        bool too_much_brpc_process = false;
-        if (_is_dest_merge) {
-            // discontinuous_acked_window_size means that we are not received all the ack
-            // with sequence from _max_continuous_acked_seqs[x] to _request_seqs[x]
-            // Limit the size of the window to avoid buffering too much out-of-order data at the receiving side
-            int64_t discontinuous_acked_window_size =
-                    _request_seqs[instance_id.lo] - _max_continuous_acked_seqs[instance_id.lo];
-            too_much_brpc_process = discontinuous_acked_window_size >= config::pipeline_sink_brpc_dop;
-        } else {
-            too_much_brpc_process = _num_in_flight_rpcs[instance_id.lo] >= config::pipeline_sink_brpc_dop;
+        if (buffer.empty()) {
+            return Status::OK();
         }
-        if (buffer.empty() || too_much_brpc_process) {
+        auto& flow_control = _flow_controls[instance_id.lo];
+        if (_is_blocked_by_flow_control(instance_id.lo, buffer.front())) {
+            flow_control.on_blocked();
             return Status::OK();
         }
 
@@ -323,6 +383,14 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             need_wait = true;
             return Status::OK();
         }
+        // The receiver needs no more chunks, but the eos is still sent to finish its sender.
+        if (_receiver_finished[instance_id.lo] && !request.params->eos()) {
+            if (!request.attachment.empty()) {
+                _bytes_skipped += request.attachment.size();
+                _request_skipped++;
+            }
+            continue;
+        }
         if (request.params->eos()) {
             DeferOp eos_defer([this, &instance_id, &need_wait]() {
                 if (need_wait) {
@@ -364,9 +432,11 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             _bytes_sent += request.attachment.size();
             _request_sent++;
         }
+        const int64_t attachment_bytes = request.attachment.size();
+        flow_control.on_sent(attachment_bytes);
 
         auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(
-                {instance_id, request.params->sequence(), MonotonicNanos()});
+                {instance_id, request.params->sequence(), MonotonicNanos(), attachment_bytes});
         if (_first_send_time == -1) {
             _first_send_time = MonotonicNanos();
         }
@@ -378,6 +448,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
+                _flow_controls[ctx.instance_id.lo].on_acked(ctx.attachment_bytes);
             }
 
             const auto& dest_addr = _dest_addrs[ctx.instance_id.lo];
@@ -396,6 +467,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
+                _flow_controls[ctx.instance_id.lo].on_acked(ctx.attachment_bytes);
             }
             if (!status.ok()) {
                 _is_finishing = true;
@@ -409,6 +481,14 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 static_cast<void>(_try_to_send_rpc(ctx.instance_id, [&]() {
                     _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receiver_post_process_time());
                     _process_send_window(ctx.instance_id, ctx.sequence);
+                    if (result.has_receiver_credit_bytes()) {
+                        _flow_controls[ctx.instance_id.lo].credit_bytes = result.receiver_credit_bytes();
+                    }
+                    if (config::enable_exchange_receiver_early_finish && result.receiver_finished() &&
+                        !_receiver_finished[ctx.instance_id.lo]) {
+                        _receiver_finished[ctx.instance_id.lo] = true;
+                        ++_num_finished_receivers;
+                    }
                 }));
             }
         });
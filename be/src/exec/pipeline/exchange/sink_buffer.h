@@ -34,6 +34,7 @@
 #include "util/defer_op.h"
 #include "util/disposable_closure.h"
 #include "util/phmap/phmap.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -42,6 +43,7 @@ struct ClosureContext {
     TUniqueId instance_id;
     int64_t sequence;
     int64_t send_timestamp;
+    int64_t attachment_bytes;
 };
 
 struct TransmitChunkInfo {
@@ -74,6 +76,35 @@ struct TimeTrace {
         accumulated_time += time;
         accumulated_concurrency += concurrency;
     }
+
+    int64_t average_time() const {
+        double average_concurrency = static_cast<double>(accumulated_concurrency) / std::max(1, times);
+        return static_cast<int64_t>(accumulated_time / std::max(1.0, average_concurrency));
+    }
+};
+
+// Flow control state and stats of the channel to one destination.
+// With credit-based flow control, the receiver advertises in each response how many bytes the sender
+// may have in flight to it, so the sender keeps sending as long as the bytes in flight fit in the credit,
+// which pipelines more requests over a link with a long RTT and fewer to a receiver that falls behind.
+struct ChannelFlowControl {
+    // -1 until the receiver advertises its credit.
+    int64_t credit_bytes = -1;
+    int64_t in_flight_bytes = 0;
+    int64_t bytes_sent = 0;
+    // Time during which the channel has requests to send but is blocked by the flow control.
+    int64_t wait_time = 0;
+    int64_t wait_start_timestamp = -1;
+
+    // Whether a request of |request_bytes| must wait for the acks of the |num_in_flight_rpcs| requests in flight.
+    bool is_blocked(int32_t num_in_flight_rpcs, int64_t request_bytes) const;
+    void on_blocked() {
+        if (wait_start_timestamp == -1) {
+            wait_start_timestamp = MonotonicNanos();
+        }
+    }
+    void on_sent(int64_t bytes);
+    void on_acked(int64_t bytes) { in_flight_bytes -= bytes; }
 };
 
 // TODO(hcf) how to export brpc error
@@ -89,6 +120,10 @@ public:
     void set_finishing();
     bool is_finished() const;
 
+    // Whether all the receivers have told that they need no more chunks, e.g. they have reached their limits,
+    // so the sinkers can stop producing chunks.
+    bool is_all_receivers_finished() const;
+
     // Add counters to the given profile
     void update_profile(RuntimeProfile* profile);
 
@@ -124,6 +159,9 @@ private:
     // And we just pick the maximum accumulated_network_time among all destination
     int64_t _network_time();
 
+    // Whether the next request to the destination must wait for acks of the ones in flight.
+    bool _is_blocked_by_flow_control(int64_t instance_lo, const TransmitChunkInfo& request);
+
     FragmentContext* _fragment_ctx;
     MemTracker* const _mem_tracker;
     const int32_t _brpc_timeout_ms;
@@ -155,8 +193,12 @@ private:
     phmap::flat_hash_map<int64_t, int32_t> _num_finished_rpcs;
     phmap::flat_hash_map<int64_t, int32_t> _num_in_flight_rpcs;
     phmap::flat_hash_map<int64_t, TimeTrace> _network_times;
+    phmap::flat_hash_map<int64_t, ChannelFlowControl> _flow_controls;
     phmap::flat_hash_map<int64_t, std::unique_ptr<Mutex>> _mutexes;
     phmap::flat_hash_map<int64_t, TNetworkAddress> _dest_addrs;
+    // Whether the receiver of each destination is finished, the chunks to it except the eos are dropped.
+    phmap::flat_hash_map<int64_t, bool> _receiver_finished;
+    std::atomic<size_t> _num_finished_receivers = 0;
 
     // True means that SinkBuffer needn't input chunk and send chunk anymore,
     // but there may be still in-flight RPC running.
@@ -179,6 +221,8 @@ private:
     std::atomic<int64_t> _request_enqueued = 0;
     std::atomic<int64_t> _bytes_sent = 0;
     std::atomic<int64_t> _request_sent = 0;
+    std::atomic<int64_t> _bytes_skipped = 0;
+    std::atomic<int64_t> _request_skipped = 0;
 
     int64_t _pending_timestamp = -1;
     mutable std::atomic<int64_t> _last_full_timestamp = -1;
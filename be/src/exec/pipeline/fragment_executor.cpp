@@ -186,6 +186,7 @@ Status FragmentExecutor::_prepare_workgroup(const UnifiedExecPlanFragmentParams&
         enable_group_level_query_queue =
                 queue_options.__isset.enable_group_level_query_queue && queue_options.enable_group_level_query_queue;
     }
+    _query_ctx->init_admission_once(query_options.__isset.query_mem_limit ? query_options.query_mem_limit : -1);
     RETURN_IF_ERROR(_query_ctx->init_query_once(wg.get(), enable_group_level_query_queue));
 
     _fragment_ctx->set_workgroup(wg);
@@ -14,9 +14,13 @@
 
 #include "exec/pipeline/group_execution/execution_group.h"
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/scan/morsel.h"
 
 namespace starrocks::pipeline {
 // clang-format off
@@ -105,6 +109,29 @@ Status ColocateExecutionGroup::prepare_drivers(RuntimeState* state) {
 
 void ColocateExecutionGroup::submit_active_drivers() {
     VLOG_QUERY << "submit_active_drivers:" << to_string();
+    _bucket_rows_budget = config::colocate_group_running_bucket_rows_budget;
+    if (_bucket_rows_budget > 0) {
+        // must be estimated before any driver runs and takes the morsels out of the queues
+        _bucket_rows = _estimate_bucket_rows();
+    }
+    if (!_bucket_rows.empty()) {
+        std::vector<int32_t> buckets;
+        {
+            std::lock_guard guard(_bucket_mutex);
+            _pending_buckets.resize(_bucket_rows.size());
+            for (size_t i = 0; i < _bucket_rows.size(); ++i) {
+                _pending_buckets[i] = i;
+            }
+            std::stable_sort(_pending_buckets.begin(), _pending_buckets.end(),
+                             [this](int32_t lhs, int32_t rhs) { return _bucket_rows[lhs] > _bucket_rows[rhs]; });
+            _running_buckets.assign(_bucket_rows.size(), false);
+            buckets = _pick_buckets_unlocked();
+        }
+        for (auto driver_sequence : buckets) {
+            _submit_bucket(driver_sequence);
+        }
+        return;
+    }
     for (size_t i = 0; i < _pipelines.size(); ++i) {
         const auto& pipeline = _pipelines[i];
         DCHECK_EQ(pipeline->drivers().size(), pipeline->degree_of_parallelism());
@@ -138,7 +165,87 @@ std::string ColocateExecutionGroup::to_string() const {
     return ss.str();
 }
 
-void ColocateExecutionGroup::submit_next_driver() {
+std::vector<int64_t> ColocateExecutionGroup::_estimate_bucket_rows() const {
+    if (_pipelines.empty()) {
+        return {};
+    }
+    const size_t dop = _pipelines[0]->degree_of_parallelism();
+    std::vector<int64_t> bucket_rows(dop, 0);
+    bool has_scan = false;
+    for (const auto& pipeline : _pipelines) {
+        if (pipeline->degree_of_parallelism() != dop || pipeline->drivers().size() != dop) {
+            return {};
+        }
+        auto* morsel_queue_factory = pipeline->source_operator_factory()->morsel_queue_factory();
+        if (morsel_queue_factory == nullptr) {
+            continue;
+        }
+        if (morsel_queue_factory->is_shared() || morsel_queue_factory->size() != dop) {
+            return {};
+        }
+        for (size_t i = 0; i < dop; ++i) {
+            for (const auto* scan_range : morsel_queue_factory->create(i)->prepare_olap_scan_ranges()) {
+                if (scan_range == nullptr || !scan_range->__isset.row_count) {
+                    return {};
+                }
+                bucket_rows[i] += scan_range->row_count;
+            }
+        }
+        has_scan = true;
+    }
+    if (!has_scan) {
+        return {};
+    }
+    return bucket_rows;
+}
+
+std::vector<int32_t> ColocateExecutionGroup::_pick_buckets_unlocked() {
+    std::vector<int32_t> buckets;
+    auto it = _pending_buckets.begin();
+    while (it != _pending_buckets.end() && _num_running_buckets < _physical_dop) {
+        const int64_t rows = _bucket_rows[*it];
+        if (_num_running_buckets > 0 && _running_bucket_rows + rows > _bucket_rows_budget) {
+            // try the smaller buckets behind
+            ++it;
+            continue;
+        }
+        buckets.emplace_back(*it);
+        _running_buckets[*it] = true;
+        _num_running_buckets++;
+        _running_bucket_rows += rows;
+        it = _pending_buckets.erase(it);
+    }
+    return buckets;
+}
+
+void ColocateExecutionGroup::_submit_bucket(int32_t driver_sequence) {
+    for (const auto& pipeline : _pipelines) {
+        const auto& driver = pipeline->drivers()[driver_sequence];
+        VLOG_QUERY << "submit_bucket:" << driver_sequence << ":" << _bucket_rows[driver_sequence] << ":"
+                   << driver->to_readable_string();
+        _executor->submit(driver.get());
+    }
+}
+
+void ColocateExecutionGroup::submit_next_driver(int32_t driver_sequence) {
+    if (!_bucket_rows.empty()) {
+        std::vector<int32_t> buckets;
+        {
+            std::lock_guard guard(_bucket_mutex);
+            if (driver_sequence < 0 || static_cast<size_t>(driver_sequence) >= _running_buckets.size() ||
+                !_running_buckets[driver_sequence]) {
+                return;
+            }
+            _running_buckets[driver_sequence] = false;
+            _num_running_buckets--;
+            _running_bucket_rows -= _bucket_rows[driver_sequence];
+            buckets = _pick_buckets_unlocked();
+        }
+        for (auto next_driver_sequence : buckets) {
+            _submit_bucket(next_driver_sequence);
+        }
+        return;
+    }
     for (size_t i = 0; i < _pipelines.size(); ++i) {
         auto next_driver_idx = _submit_drivers[i].fetch_add(1);
         if (next_driver_idx >= _pipelines[i]->degree_of_parallelism()) {
@@ -17,7 +17,9 @@
 #include <atomic>
 #include <cstddef>
 #include <functional>
+#include <mutex>
 #include <unordered_set>
+#include <vector>
 
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/group_execution/execution_group_builder.h"
@@ -59,7 +61,8 @@ public:
 
     virtual void add_pipeline(PipelineRawPtr pipeline) = 0;
     virtual void close(RuntimeState* state) = 0;
-    virtual void submit_next_driver() = 0;
+    // called when the drivers of |driver_sequence| finished sinking into the grouped execution sink
+    virtual void submit_next_driver(int32_t driver_sequence) = 0;
     virtual bool is_empty() const = 0;
     virtual std::string to_string() const = 0;
     void attach_driver_executor(DriverExecutor* executor) { _executor = executor; }
@@ -110,7 +113,7 @@ public:
 
     void close(RuntimeState* state) override;
     // nothing to do
-    void submit_next_driver() override {}
+    void submit_next_driver(int32_t driver_sequence) override {}
     bool is_empty() const override { return _pipelines.empty(); }
     std::string to_string() const override;
 };
@@ -130,15 +133,31 @@ public:
     void add_pipeline(PipelineRawPtr pipeline) override;
 
     void close(RuntimeState* state) override;
-    void submit_next_driver() override;
+    void submit_next_driver(int32_t driver_sequence) override;
     bool is_empty() const override { return _pipelines.empty(); }
     std::string to_string() const override;
     void add_plan_node_id(int32_t plan_node_id) { _plan_node_ids.insert(plan_node_id); }
 
 private:
+    // Estimate the rows of each bucket by the row counts of its tablets, empty if any of them is unknown.
+    std::vector<int64_t> _estimate_bucket_rows() const;
+    // Pick the pending buckets that fit the rows budget, must hold _bucket_mutex.
+    std::vector<int32_t> _pick_buckets_unlocked();
+    void _submit_bucket(int32_t driver_sequence);
+
     size_t _physical_dop;
     // TODO: add Pad to fix false sharing problems
     std::unique_ptr<std::atomic<int>[]> _submit_drivers;
+
+    // Used instead of _submit_drivers if colocate_group_running_bucket_rows_budget is set and the rows are known.
+    int64_t _bucket_rows_budget = 0;
+    std::vector<int64_t> _bucket_rows;
+    std::mutex _bucket_mutex;
+    // the driver sequences not submitted yet, in the descending order of their rows
+    std::vector<int32_t> _pending_buckets;
+    std::vector<bool> _running_buckets;
+    size_t _num_running_buckets = 0;
+    int64_t _running_bucket_rows = 0;
 };
 
 } // namespace starrocks::pipeline
\ No newline at end of file
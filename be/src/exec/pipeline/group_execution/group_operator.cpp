@@ -40,7 +40,7 @@ void GroupedExecutionSinkOperator::close(RuntimeState* state) {
 Status GroupedExecutionSinkOperator::set_finishing(RuntimeState* state) {
     _is_finished = true;
     _exchanger->finish(state);
-    down_cast<GroupedExecutionSinkFactory*>(_factory)->submit();
+    down_cast<GroupedExecutionSinkFactory*>(_factory)->submit(_driver_sequence);
     return Status::OK();
 }
 
@@ -65,8 +65,8 @@ void GroupedExecutionSinkFactory::close(RuntimeState* state) {
     OperatorFactory::close(state);
 }
 
-void GroupedExecutionSinkFactory::submit() {
-    _exec_group->submit_next_driver();
+void GroupedExecutionSinkFactory::submit(int32_t driver_sequence) {
+    _exec_group->submit_next_driver(driver_sequence);
 }
 
 } // namespace starrocks::pipeline
\ No newline at end of file
@@ -68,7 +68,7 @@ public:
     Status prepare(RuntimeState* state) override;
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
     void close(RuntimeState* state) override;
-    void submit();
+    void submit(int32_t driver_sequence);
 
 private:
     ExecutionGroupRawPtr _exec_group;
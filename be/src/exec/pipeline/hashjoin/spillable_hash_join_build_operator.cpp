@@ -24,6 +24,7 @@
 #include "exec/join_hash_map.h"
 #include "exec/pipeline/hashjoin/hash_join_build_operator.h"
 #include "exec/pipeline/query_context.h"
+#include "exec/spill/operator_mem_resource_manager.h"
 #include "exec/spill/options.h"
 #include "exec/spill/spiller.h"
 #include "exec/spill/spiller.hpp"
@@ -255,6 +256,10 @@ Status SpillableHashJoinBuildOperatorFactory::prepare(RuntimeState* state) {
     _spill_options->mem_table_pool_size = state->spill_mem_table_num();
     _spill_options->spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
     _spill_options->min_spilled_size = state->spill_operator_min_bytes();
+    // the probe side builds the hash table of a restored partition within the operator memory budget,
+    // the hash table is estimated to be twice the size of the spilled rows, see init_spiller_partitions
+    _spill_options->max_partition_bytes = std::max<size_t>(
+            spill::OperatorMemoryResourceManager::operator_avaliable_memory_bytes(state) / 2, 1);
     _spill_options->block_manager = state->query_ctx()->spill_manager()->block_manager();
     _spill_options->name = "hash-join-build";
     _spill_options->plan_node_id = _plan_node_id;
@@ -42,6 +42,9 @@ Status SpillableHashJoinProbeOperator::prepare(RuntimeState* state) {
     _need_post_probe = has_post_probe(_join_prober->join_type());
     _probe_spiller->set_metrics(spill::SpillProcessMetrics(_unique_metrics.get(), state->mutable_total_spill_bytes()));
     metrics.hash_partitions = ADD_COUNTER(_unique_metrics.get(), "SpillPartitions", TUnit::UNIT);
+    metrics.max_partition_level = ADD_COUNTER(_unique_metrics.get(), "SpillPartitionMaxLevel", TUnit::UNIT);
+    metrics.max_partition_bytes = ADD_COUNTER(_unique_metrics.get(), "SpillPartitionMaxBytes", TUnit::BYTES);
+    metrics.oversized_partitions = ADD_COUNTER(_unique_metrics.get(), "SpillOversizedPartitions", TUnit::UNIT);
     metrics.build_partition_peak_memory_usage = _unique_metrics->AddHighWaterMarkCounter(
             "SpillBuildPartitionPeakMemoryUsage", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
     metrics.prober_peak_memory_usage = _unique_metrics->AddHighWaterMarkCounter(
@@ -468,6 +471,19 @@ void SpillableHashJoinProbeOperator::_acquire_next_partitions() {
 
         _probe_spiller->set_partition(_build_partitions);
         COUNTER_SET(metrics.hash_partitions, (int64_t)_build_partitions.size());
+
+        int64_t max_level = 0;
+        int64_t max_bytes = 0;
+        int64_t oversized_partitions = 0;
+        size_t budget = _mem_resource_manager.operator_avaliable_memory_bytes();
+        for (const auto* partition : _build_partitions) {
+            max_level = std::max<int64_t>(max_level, partition->level);
+            max_bytes = std::max<int64_t>(max_bytes, partition->bytes);
+            oversized_partitions += partition->bytes > budget;
+        }
+        COUNTER_SET(metrics.max_partition_level, max_level);
+        COUNTER_SET(metrics.max_partition_bytes, max_bytes);
+        COUNTER_SET(metrics.oversized_partitions, oversized_partitions);
     }
 
     size_t bytes_usage = 0;
@@ -47,6 +47,11 @@ private:
 
 struct SpillableHashJoinProbeMetrics {
     RuntimeProfile::Counter* hash_partitions = nullptr;
+    // the deepest split level and the largest size of the build partitions
+    RuntimeProfile::Counter* max_partition_level = nullptr;
+    RuntimeProfile::Counter* max_partition_bytes = nullptr;
+    // the build partitions larger than the operator memory budget
+    RuntimeProfile::Counter* oversized_partitions = nullptr;
     RuntimeProfile::Counter* probe_shuffle_timer = nullptr;
     RuntimeProfile::HighWaterMarkCounter* prober_peak_memory_usage = nullptr;
     RuntimeProfile::HighWaterMarkCounter* build_partition_peak_memory_usage = nullptr;
@@ -138,6 +138,7 @@ std::unique_ptr<SpillableNLJoinChunkStream> NLJoinBuildChunkStreamBuilder::build
 
 void NLJoinContext::close(RuntimeState* state) {
     _build_chunks.clear();
+    _range_index.reset();
     _build_stream_builder.close();
 }
 
@@ -238,6 +239,9 @@ Status NLJoinContext::finish_one_right_sinker(int32_t sinker_id, RuntimeState* s
         if (!_build_stream_builder.has_spilled()) {
             _build_chunks = _build_stream_builder.build();
             RETURN_IF_ERROR(_init_runtime_filter(state));
+            if (_range_conjunct.has_value() && !_build_chunks.empty()) {
+                _range_index = NLJoinRangeIndex::build(*_range_conjunct, _build_chunks, _build_chunk_desired_size);
+            }
         } else {
             _notify_runtime_filter_collector(state);
         }
@@ -17,12 +17,14 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "column/chunk.h"
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
 #include "exec/pipeline/context_with_dependency.h"
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
 #include "exec/pipeline/spill_process_channel.h"
 #include "exec/spill/executor.h"
 #include "exec/spill/serde.h"
@@ -181,6 +183,11 @@ public:
 
     const std::vector<uint8_t> get_shared_build_match_flag() const;
 
+    // Set by the prober factory on prepare, the range index is built on it once all the build chunks arrive.
+    void set_range_conjunct(const NLJoinRangeConjunct& conjunct) { _range_conjunct = conjunct; }
+    // nullptr if there is no range conjunct, or the build side is empty or spilled.
+    const NLJoinRangeIndex* range_index() const { return _range_index.get(); }
+
     const SpillProcessChannelFactoryPtr& spill_channel_factory() { return _spill_process_factory_ptr; }
     NLJoinBuildChunkStreamBuilder& builder() { return _build_stream_builder; }
 
@@ -207,6 +214,8 @@ private:
     int _build_chunk_desired_size = 0;
     int _num_post_probers = 0;
     std::vector<uint8_t> _shared_build_match_flag;
+    std::optional<NLJoinRangeConjunct> _range_conjunct;
+    std::unique_ptr<NLJoinRangeIndex> _range_index;
 
     // conjuncts in cross join, used for generate runtime_filter
     std::vector<ExprContext*> _rf_conjuncts_ctx;
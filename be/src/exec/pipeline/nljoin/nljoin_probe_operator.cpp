@@ -14,9 +14,12 @@
 
 #include "exec/pipeline/nljoin/nljoin_probe_operator.h"
 
+#include <tuple>
+
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -434,6 +437,51 @@ ChunkPtr NLJoinProbeOperator::_permute_chunk_for_inner_join(size_t chunk_size) {
     return result_chunk;
 }
 
+// Permute each probe row only with the build rows that the range index finds for it, the join conjuncts are still
+// evaluated on the permuted rows
+ChunkPtr NLJoinProbeOperator::_permute_chunk_for_range_join(size_t chunk_size) {
+    ChunkPtr result_chunk = _init_output_chunk(chunk_size);
+    const ColumnPtr& probe_key = _probe_chunk->get_column_by_slot_id(_range_index->conjunct().probe_slot);
+
+    while (_probe_row_current < _probe_chunk->num_rows() && result_chunk->num_rows() < chunk_size) {
+        if (!_range_probed) {
+            std::tie(_range_begin, _range_end) = _range_index->probe(*probe_key, _probe_row_current);
+            _range_probed = true;
+        }
+        size_t num_rows = std::min(_range_end - _range_begin, chunk_size - result_chunk->num_rows());
+        if (num_rows > 0) {
+            _permute_probe_row_with_range(result_chunk, _range_begin, _range_begin + num_rows);
+            _range_begin += num_rows;
+        }
+        if (_range_begin == _range_end) {
+            _range_probed = false;
+            _probe_row_current++;
+        }
+    }
+    return result_chunk;
+}
+
+void NLJoinProbeOperator::_permute_probe_row_with_range(const ChunkPtr& chunk, size_t begin, size_t end) {
+    COUNTER_UPDATE(_permute_rows_counter, end - begin);
+    _range_index->group_by_chunk(begin, end, &_range_chunk_rows);
+    for (size_t i = 0; i < _col_types.size(); i++) {
+        SlotDescriptor* slot = _col_types[i];
+        ColumnPtr& dst_col = chunk->get_column_by_slot_id(slot->id());
+        if (i < _probe_column_count) {
+            const ColumnPtr& src_col = _probe_chunk->get_column_by_slot_id(slot->id());
+            dst_col->append_value_multiple_times(*src_col, _probe_row_current, end - begin);
+        } else {
+            for (int chunk_index = 0; chunk_index < _num_build_chunks(); chunk_index++) {
+                const Buffer<uint32_t>& rows = _range_chunk_rows[chunk_index];
+                if (!rows.empty()) {
+                    Chunk* build_chunk = _cross_join_context->get_build_chunk(chunk_index);
+                    dst_col->append_selective(*build_chunk->get_column_by_slot_id(slot->id()), rows);
+                }
+            }
+        }
+    }
+}
+
 void NLJoinProbeOperator::_permute_chunk_base_left(ChunkPtr* chunk) {
     for (size_t i = 0; i < _probe_column_count; i++) {
         SlotId slot_id = _col_types[i]->id();
@@ -659,7 +707,8 @@ StatusOr<ChunkPtr> NLJoinProbeOperator::_pull_chunk_for_inner_join(size_t chunk_
     }
 
     while (!_is_curr_probe_chunk_finished()) {
-        ChunkPtr chunk = _permute_chunk_for_inner_join(chunk_size);
+        ChunkPtr chunk = _range_index != nullptr ? _permute_chunk_for_range_join(chunk_size)
+                                                 : _permute_chunk_for_inner_join(chunk_size);
         DCHECK(chunk);
         RETURN_IF_ERROR(_probe_for_inner_join(chunk));
         RETURN_IF_ERROR(eval_conjuncts(_conjunct_ctxs, chunk.get(), nullptr));
@@ -693,6 +742,10 @@ Status NLJoinProbeOperator::push_chunk(RuntimeState* state, const ChunkPtr& chun
     _probe_row_matched = false;
     _probe_row_finished = false;
     _reset_build_chunk_index();
+    if (_join_op == TJoinOp::INNER_JOIN) {
+        _range_index = _cross_join_context->range_index();
+        _range_probed = false;
+    }
 
     return Status::OK();
 }
@@ -725,6 +778,16 @@ Status NLJoinProbeOperatorFactory::prepare(RuntimeState* state) {
     _cross_join_context->ref();
 
     _init_row_desc();
+    if (_join_op == TJoinOp::INNER_JOIN && config::enable_nljoin_range_index) {
+        std::vector<SlotId> probe_slots;
+        std::vector<SlotId> build_slots;
+        for (size_t i = 0; i < _col_types.size(); i++) {
+            (i < _probe_column_count ? probe_slots : build_slots).emplace_back(_col_types[i]->id());
+        }
+        if (auto conjunct = NLJoinRangeIndex::find_range_conjunct(_join_conjuncts, probe_slots, build_slots)) {
+            _cross_join_context->set_range_conjunct(*conjunct);
+        }
+    }
     RETURN_IF_ERROR(Expr::prepare(_join_conjuncts, state));
     RETURN_IF_ERROR(Expr::open(_join_conjuncts, state));
     RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state));
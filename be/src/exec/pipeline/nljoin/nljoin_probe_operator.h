@@ -89,6 +89,8 @@ private:
     void _permute_probe_row(const ChunkPtr& chunk);
     ChunkPtr _permute_chunk_for_other_join(size_t chunk_size);
     ChunkPtr _permute_chunk_for_inner_join(size_t chunk_size);
+    ChunkPtr _permute_chunk_for_range_join(size_t chunk_size);
+    void _permute_probe_row_with_range(const ChunkPtr& chunk, size_t begin, size_t end);
     void _permute_chunk_base_left(ChunkPtr* chunk);
     void _permute_chunk_base_right(ChunkPtr* chunk);
     Status _permute_right_join(size_t chunk_size);
@@ -132,6 +134,14 @@ private:
     size_t _probe_row_start = 0;      // Start index of current chunk
     size_t _probe_row_current = 0;    // End index of current chunk
 
+    // Range join states, the build rows at [_range_begin, _range_end) of the range index are left to permute with
+    // the current probe row if _range_probed
+    const NLJoinRangeIndex* _range_index = nullptr;
+    bool _range_probed = false;
+    size_t _range_begin = 0;
+    size_t _range_end = 0;
+    std::vector<Buffer<uint32_t>> _range_chunk_rows;
+
     // Counters
     RuntimeProfile::Counter* _permute_rows_counter = nullptr;
     RuntimeProfile::Counter* _permute_left_rows_counter = nullptr;
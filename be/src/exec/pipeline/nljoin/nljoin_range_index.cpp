@@ -0,0 +1,180 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/type_traits.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "gen_cpp/Exprs_types.h"
+
+namespace starrocks::pipeline {
+
+static bool is_range_key_type(LogicalType type) {
+    switch (type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns the opcode of `b <op> a` for `a <op> b`.
+static TExprOpcode::type reverse_op(TExprOpcode::type op) {
+    switch (op) {
+    case TExprOpcode::LT:
+        return TExprOpcode::GT;
+    case TExprOpcode::LE:
+        return TExprOpcode::GE;
+    case TExprOpcode::GT:
+        return TExprOpcode::LT;
+    case TExprOpcode::GE:
+        return TExprOpcode::LE;
+    default:
+        return op;
+    }
+}
+
+std::optional<NLJoinRangeConjunct> NLJoinRangeIndex::find_range_conjunct(
+        const std::vector<ExprContext*>& join_conjuncts, const std::vector<SlotId>& probe_slots,
+        const std::vector<SlotId>& build_slots) {
+    auto contains = [](const std::vector<SlotId>& slots, SlotId id) {
+        return std::find(slots.begin(), slots.end(), id) != slots.end();
+    };
+    for (ExprContext* ctx : join_conjuncts) {
+        Expr* root = ctx->root();
+        if (root->node_type() != TExprNodeType::BINARY_PRED || root->get_num_children() != 2) {
+            continue;
+        }
+        TExprOpcode::type op = root->op();
+        if (op != TExprOpcode::LT && op != TExprOpcode::LE && op != TExprOpcode::GT && op != TExprOpcode::GE) {
+            continue;
+        }
+        Expr* left = root->get_child(0);
+        Expr* right = root->get_child(1);
+        if (!left->is_slotref() || !right->is_slotref() || left->type().type != right->type().type ||
+            !is_range_key_type(left->type().type)) {
+            continue;
+        }
+        SlotId left_slot = down_cast<ColumnRef*>(left)->slot_id();
+        SlotId right_slot = down_cast<ColumnRef*>(right)->slot_id();
+        if (contains(probe_slots, left_slot) && contains(build_slots, right_slot)) {
+            return NLJoinRangeConjunct{left_slot, right_slot, left->type().type, op};
+        }
+        if (contains(build_slots, left_slot) && contains(probe_slots, right_slot)) {
+            return NLJoinRangeConjunct{right_slot, left_slot, left->type().type, reverse_op(op)};
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<int64_t> NLJoinRangeIndex::_key_of(const Column& column, size_t row) const {
+    if (column.is_null(row)) {
+        return std::nullopt;
+    }
+    const Column* data_column = ColumnHelper::get_data_column(&column);
+    switch (_conjunct.type) {
+    case TYPE_TINYINT:
+        return down_cast<const RunTimeColumnType<TYPE_TINYINT>*>(data_column)->get_data()[row];
+    case TYPE_SMALLINT:
+        return down_cast<const RunTimeColumnType<TYPE_SMALLINT>*>(data_column)->get_data()[row];
+    case TYPE_INT:
+        return down_cast<const RunTimeColumnType<TYPE_INT>*>(data_column)->get_data()[row];
+    case TYPE_BIGINT:
+        return down_cast<const RunTimeColumnType<TYPE_BIGINT>*>(data_column)->get_data()[row];
+    case TYPE_DATE:
+        // ordered as the julian days
+        return down_cast<const RunTimeColumnType<TYPE_DATE>*>(data_column)->get_data()[row].julian();
+    case TYPE_DATETIME:
+        return down_cast<const RunTimeColumnType<TYPE_DATETIME>*>(data_column)->get_data()[row].timestamp();
+    default:
+        DCHECK(false) << "unsupported range key type " << _conjunct.type;
+        return std::nullopt;
+    }
+}
+
+std::unique_ptr<NLJoinRangeIndex> NLJoinRangeIndex::build(const NLJoinRangeConjunct& conjunct,
+                                                           const std::vector<ChunkPtr>& build_chunks,
+                                                           size_t chunk_size) {
+    for (size_t i = 0; i + 1 < build_chunks.size(); i++) {
+        if (build_chunks[i]->num_rows() != chunk_size) {
+            // the build rows could not be numbered by the chunk size
+            return nullptr;
+        }
+    }
+    std::unique_ptr<NLJoinRangeIndex> index(new NLJoinRangeIndex(conjunct, build_chunks.size(), chunk_size));
+
+    std::vector<std::pair<int64_t, uint32_t>> keys;
+    for (size_t i = 0; i < build_chunks.size(); i++) {
+        const ColumnPtr& column = build_chunks[i]->get_column_by_slot_id(conjunct.build_slot);
+        const uint32_t first_row = i * chunk_size;
+        for (size_t row = 0; row < column->size(); row++) {
+            if (auto key = index->_key_of(*column, row)) {
+                keys.emplace_back(*key, first_row + row);
+            }
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+
+    index->_keys.reserve(keys.size());
+    index->_rows.reserve(keys.size());
+    for (const auto& [key, row] : keys) {
+        index->_keys.emplace_back(key);
+        index->_rows.emplace_back(row);
+    }
+    return index;
+}
+
+std::pair<size_t, size_t> NLJoinRangeIndex::probe(const Column& probe_column, size_t row) const {
+    auto key = _key_of(probe_column, row);
+    if (!key) {
+        return {0, 0};
+    }
+    // the conjunct is `probe <op> build`
+    switch (_conjunct.op) {
+    case TExprOpcode::LT:
+        return {std::upper_bound(_keys.begin(), _keys.end(), *key) - _keys.begin(), _keys.size()};
+    case TExprOpcode::LE:
+        return {std::lower_bound(_keys.begin(), _keys.end(), *key) - _keys.begin(), _keys.size()};
+    case TExprOpcode::GT:
+        return {0, std::lower_bound(_keys.begin(), _keys.end(), *key) - _keys.begin()};
+    case TExprOpcode::GE:
+        return {0, std::upper_bound(_keys.begin(), _keys.end(), *key) - _keys.begin()};
+    default:
+        DCHECK(false) << "unsupported range conjunct op " << _conjunct.op;
+        return {0, _keys.size()};
+    }
+}
+
+void NLJoinRangeIndex::group_by_chunk(size_t begin, size_t end, std::vector<Buffer<uint32_t>>* chunk_rows) const {
+    chunk_rows->resize(_num_chunks);
+    for (auto& rows : *chunk_rows) {
+        rows.clear();
+    }
+    for (size_t i = begin; i < end; i++) {
+        (*chunk_rows)[_rows[i] / _chunk_size].emplace_back(_rows[i] % _chunk_size);
+    }
+}
+
+} // namespace starrocks::pipeline
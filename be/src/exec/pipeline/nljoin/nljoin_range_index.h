@@ -0,0 +1,84 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/global_types.h"
+#include "gen_cpp/Opcodes_types.h"
+#include "types/logical_type.h"
+
+namespace starrocks {
+class ExprContext;
+}
+
+namespace starrocks::pipeline {
+
+// A join conjunct `probe_slot <op> build_slot`, op is one of <, <=, >, >=.
+struct NLJoinRangeConjunct {
+    SlotId probe_slot;
+    SlotId build_slot;
+    LogicalType type;
+    TExprOpcode::type op;
+};
+
+// The build rows of a nest loop join ordered by the build slot of a range conjunct, so the build rows which may
+// satisfy the conjunct for a probe value are a contiguous range of this order, found by binary search. A BETWEEN
+// of two build slots is two range conjuncts, the rows of the range satisfy one of them, and the other one is still
+// evaluated by the join.
+//
+// A build row is referred by its index among all the build rows, the build chunks have `chunk_size` rows except the
+// last one. The build rows of a null key are left out since they never satisfy the conjunct.
+class NLJoinRangeIndex {
+public:
+    // Returns the first one of `join_conjuncts` which is a range conjunct between a slot of `probe_slots` and a slot
+    // of `build_slots` of the same integer, date or datetime type.
+    static std::optional<NLJoinRangeConjunct> find_range_conjunct(const std::vector<ExprContext*>& join_conjuncts,
+                                                                  const std::vector<SlotId>& probe_slots,
+                                                                  const std::vector<SlotId>& build_slots);
+
+    // Returns nullptr if a build chunk other than the last one does not have `chunk_size` rows.
+    static std::unique_ptr<NLJoinRangeIndex> build(const NLJoinRangeConjunct& conjunct,
+                                                   const std::vector<ChunkPtr>& build_chunks, size_t chunk_size);
+
+    const NLJoinRangeConjunct& conjunct() const { return _conjunct; }
+    size_t num_rows() const { return _rows.size(); }
+
+    // Returns the positions [begin, end) of the build rows which may match the `row`th value of `probe_column`.
+    std::pair<size_t, size_t> probe(const Column& probe_column, size_t row) const;
+
+    // Splits the build rows at the positions [begin, end) by their build chunks, into the row indexes in each chunk.
+    void group_by_chunk(size_t begin, size_t end, std::vector<Buffer<uint32_t>>* chunk_rows) const;
+
+private:
+    NLJoinRangeIndex(const NLJoinRangeConjunct& conjunct, size_t num_chunks, size_t chunk_size)
+            : _conjunct(conjunct), _num_chunks(num_chunks), _chunk_size(chunk_size) {}
+
+    // Returns the key of the `row`th value of `column`, std::nullopt for a null.
+    std::optional<int64_t> _key_of(const Column& column, size_t row) const;
+
+    const NLJoinRangeConjunct _conjunct;
+    const size_t _num_chunks;
+    const size_t _chunk_size;
+    // the keys of the build rows in ascending order, and the build rows of them
+    std::vector<int64_t> _keys;
+    std::vector<uint32_t> _rows;
+};
+
+} // namespace starrocks::pipeline
@@ -20,10 +20,12 @@
 #include "common/logging.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/query_context.h"
+#include "exec/pipeline/query_cpu_sampler.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_filter_cache.h"
 #include "runtime/runtime_state.h"
+#include "simd/simd.h"
 #include "util/failpoint/fail_point.h"
 #include "util/runtime_profile.h"
 
@@ -71,6 +73,7 @@ Status Operator::prepare(RuntimeState* state) {
     _finished_timer = ADD_TIMER(_common_metrics, "SetFinishedTime");
     _close_timer = ADD_TIMER(_common_metrics, "CloseTime");
     _prepare_timer = ADD_TIMER(_common_metrics, "PrepareTime");
+    _cpu_sampler_name_id = QueryCpuSampler::instance()->name_id(_name);
 
     _push_chunk_num_counter = ADD_COUNTER(_common_metrics, "PushChunkNum", TUnit::UNIT);
     _push_row_num_counter = ADD_COUNTER(_common_metrics, "PushRowNum", TUnit::UNIT);
@@ -189,7 +192,8 @@ Status Operator::eval_conjuncts_and_in_filters(const std::vector<ExprContext*>&
         _conjuncts_input_counter->update(before);
         RETURN_IF_ERROR(
                 starrocks::ExecNode::eval_conjuncts(_cached_conjuncts_and_in_filters, chunk, filter, apply_filter));
-        auto after = chunk->num_rows();
+        auto after = apply_filter || filter == nullptr || *filter == nullptr ? chunk->num_rows()
+                                                                              : SIMD::count_nonzero(**filter);
         _conjuncts_output_counter->update(after);
     }
 
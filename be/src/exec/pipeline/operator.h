@@ -96,6 +96,10 @@ public:
     // return true if operator should ignore eos chunk
     virtual bool ignore_empty_eos() const { return true; }
 
+    // return true if push_chunk honors the selection of the input chunk (see Chunk::selection()), otherwise
+    // the driver compacts the chunk before pushing it
+    virtual bool accept_chunk_selection() const { return false; }
+
     // Whether we could push chunk to this operator
     virtual bool need_input() const = 0;
 
@@ -298,6 +302,12 @@ protected:
     RuntimeProfile::Counter* _finished_timer = nullptr;
     RuntimeProfile::Counter* _close_timer = nullptr;
     RuntimeProfile::Counter* _prepare_timer = nullptr;
+    // The cpu cycles of the timed push_chunk/pull_chunk calls, which are added to _push_timer/_pull_timer by
+    // PipelineDriver at the end of each process().
+    int64_t _push_cycles = 0;
+    int64_t _pull_cycles = 0;
+    // The id of the name of this operator in QueryCpuSampler.
+    int32_t _cpu_sampler_name_id = -1;
 
     RuntimeProfile::Counter* _push_chunk_num_counter = nullptr;
     RuntimeProfile::Counter* _push_row_num_counter = nullptr;
@@ -408,6 +408,8 @@ OpFactories PipelineBuilderContext::maybe_interpolate_collect_stats(RuntimeState
     size_t dop = pred_source_op->degree_of_parallelism();
     CollectStatsContextPtr collect_stats_ctx =
             std::make_shared<CollectStatsContext>(state, dop, _fragment_context->adaptive_dop_param());
+    // the drivers may take the chunks of each other only if the distribution of the source needs not be kept
+    collect_stats_ctx->set_allow_steal(pred_source_op->could_local_shuffle());
 
     auto last_plan_node_id = pred_operators[pred_operators.size() - 1]->plan_node_id();
     pred_operators.emplace_back(std::make_shared<CollectStatsSinkOperatorFactory>(next_operator_id(), last_plan_node_id,
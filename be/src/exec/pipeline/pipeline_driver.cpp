@@ -20,8 +20,10 @@
 #include "column/chunk.h"
 #include "common/statusor.h"
 #include "exec/pipeline/adaptive/event.h"
+#include "exec/pipeline/chunk_accumulate_operator.h"
 #include "exec/pipeline/exchange/exchange_sink_operator.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
+#include "exec/pipeline/query_cpu_sampler.h"
 #include "exec/pipeline/scan/olap_scan_operator.h"
 #include "exec/pipeline/scan/scan_operator.h"
 #include "exec/pipeline/source_operator.h"
@@ -38,6 +40,7 @@
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/starrocks_metrics.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -119,6 +122,24 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     }
 
     source_op->add_morsel_queue(_morsel_queue);
+
+    _operator_timer_sample_interval = std::max(config::pipeline_operator_timer_sample_interval, 1);
+    _operator_timer_countdown = 1;
+
+    if (config::enable_pipeline_adaptive_chunk_size) {
+        _adaptive_chunk_size = std::make_shared<AdaptiveChunkSizeController>(
+                runtime_state->chunk_size(), config::pipeline_adaptive_chunk_target_bytes);
+        _adaptive_chunk_size_counter = ADD_COUNTER(_runtime_profile, "AdaptiveChunkSize", TUnit::UNIT);
+        COUNTER_SET(_adaptive_chunk_size_counter, static_cast<int64_t>(_adaptive_chunk_size->chunk_size()));
+        for (auto& op : _operators) {
+            if (auto* scan_op = dynamic_cast<ScanOperator*>(op.get()); scan_op != nullptr) {
+                scan_op->set_adaptive_chunk_size(_adaptive_chunk_size);
+            } else if (auto* acc_op = dynamic_cast<ChunkAccumulateOperator*>(op.get()); acc_op != nullptr) {
+                acc_op->set_adaptive_chunk_size(_adaptive_chunk_size);
+            }
+        }
+    }
+
     // fill OperatorWithDependency instances into _dependencies from _operators.
     DCHECK(_dependencies.empty());
     _dependencies.reserve(_operators.size());
@@ -188,6 +209,7 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
         }
     }
 
+    source_operator()->set_observer(&_observer);
     for (auto& op : _operators) {
         int64_t time_spent = 0;
         {
@@ -232,18 +254,26 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
     size_t total_rows_moved = 0;
     int64_t time_spent = 0;
     Status return_status = Status::OK();
+    const int64_t process_start_ns = MonotonicNanos();
+    const int64_t process_start_cycles = CycleClock::Now();
+    const bool sample_cpu = config::enable_query_cpu_sampler;
     DeferOp defer([&]() {
+        if (sample_cpu) {
+            QueryCpuSampler::clear_current();
+        }
         if (ScanOperator* scan = source_scan_operator()) {
             scan->end_driver_process(this);
         }
 
         _update_statistics(runtime_state, total_chunks_moved, total_rows_moved, time_spent);
+        _update_operator_timers(MonotonicNanos() - process_start_ns, CycleClock::Now() - process_start_cycles);
     });
 
     if (ScanOperator* scan = source_scan_operator()) {
         scan->begin_driver_process();
     }
 
+    const int64_t yield_max_time_spent_ns = _yield_max_time_spent_ns();
     while (true) {
         RETURN_IF_LIMIT_EXCEEDED(runtime_state, "Pipeline");
 
@@ -301,7 +331,12 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 StatusOr<ChunkPtr> maybe_chunk;
                 {
                     SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(curr_op);
-                    SCOPED_TIMER(curr_op->_pull_timer);
+                    if (sample_cpu) {
+                        QueryCpuSampler::set_current(_query_ctx->query_id(), curr_op->get_plan_node_id(),
+                                                     curr_op->_cpu_sampler_name_id);
+                    }
+                    const int64_t timer_scale = _next_operator_timer_scale();
+                    ScopedCycleTimer timer(timer_scale > 0 ? &curr_op->_pull_cycles : nullptr, timer_scale);
                     QUERY_TRACE_SCOPED(curr_op->get_name(), "pull_chunk");
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
@@ -330,10 +365,23 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                         }
 
                         total_rows_moved += row_num;
+                        if (i == 0 && _adaptive_chunk_size != nullptr) {
+                            _adaptive_chunk_size->update(*maybe_chunk.value());
+                            COUNTER_SET(_adaptive_chunk_size_counter,
+                                        static_cast<int64_t>(_adaptive_chunk_size->chunk_size()));
+                        }
                         {
                             SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(next_op);
-                            SCOPED_TIMER(next_op->_push_timer);
+                            if (sample_cpu) {
+                                QueryCpuSampler::set_current(_query_ctx->query_id(), next_op->get_plan_node_id(),
+                                                             next_op->_cpu_sampler_name_id);
+                            }
+                            const int64_t timer_scale = _next_operator_timer_scale();
+                            ScopedCycleTimer timer(timer_scale > 0 ? &next_op->_push_cycles : nullptr, timer_scale);
                             QUERY_TRACE_SCOPED(next_op->get_name(), "push_chunk");
+                            if (maybe_chunk.value()->has_selection() && !next_op->accept_chunk_selection()) {
+                                maybe_chunk.value()->compact_selection();
+                            }
                             _adjust_memory_usage(runtime_state, query_mem_tracker.get(), next_op, maybe_chunk.value());
                             RELEASE_RESERVED_GUARD();
                             return_status = next_op->push_chunk(runtime_state, maybe_chunk.value());
@@ -380,8 +428,8 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
             }
             // yield when total chunks moved or time spent on-core for evaluation
             // exceed the designated thresholds.
-            if (time_spent >= YIELD_MAX_TIME_SPENT_NS ||
-                driver_acct().get_accumulated_local_wait_time_spent() >= YIELD_MAX_TIME_SPENT_NS) {
+            if (time_spent >= yield_max_time_spent_ns ||
+                driver_acct().get_accumulated_local_wait_time_spent() >= yield_max_time_spent_ns) {
                 should_yield = true;
                 COUNTER_UPDATE(_yield_by_time_limit_counter, 1);
                 break;
@@ -487,6 +535,22 @@ void PipelineDriver::report_exec_state_if_necessary() {
     _fragment_ctx->report_exec_state_if_necessary();
 }
 
+void PipelineDriver::_update_operator_timers(int64_t elapsed_ns, int64_t elapsed_cycles) {
+    // The cycles are converted by the rate of the process() itself, so the frequency of the cycle counter need not
+    // be known.
+    const double ns_per_cycle = elapsed_cycles > 0 ? static_cast<double>(elapsed_ns) / elapsed_cycles : 0;
+    for (auto& op : _operators) {
+        if (op->_pull_cycles > 0) {
+            COUNTER_UPDATE(op->_pull_timer, static_cast<int64_t>(op->_pull_cycles * ns_per_cycle));
+            op->_pull_cycles = 0;
+        }
+        if (op->_push_cycles > 0) {
+            COUNTER_UPDATE(op->_push_timer, static_cast<int64_t>(op->_push_cycles * ns_per_cycle));
+            op->_push_cycles = 0;
+        }
+    }
+}
+
 void PipelineDriver::runtime_report_action() {
     if (is_finished()) {
         return;
@@ -610,26 +674,60 @@ void PipelineDriver::_adjust_memory_usage(RuntimeState* state, MemTracker* track
 
 const double release_buffer_mem_ratio = 0.8;
 
+// The memory to free to get back under the release threshold of the query, its workgroup and the process.
+// A negative value means that none of them is under pressure.
+int64_t PipelineDriver::_bytes_over_release_threshold(RuntimeState* state) const {
+    auto query_mem_tracker = _query_ctx->mem_tracker();
+    auto query_mem_limit = query_mem_tracker->lowest_limit();
+    DCHECK_GT(query_mem_limit, 0);
+    auto spill_mem_threshold = query_mem_limit * state->spill_mem_limit_threshold();
+    int64_t bytes_to_free =
+            query_mem_tracker->consumption() - static_cast<int64_t>(spill_mem_threshold * release_buffer_mem_ratio);
+
+    if (_workgroup != nullptr && _workgroup->mem_tracker() != nullptr &&
+        _workgroup->mem_tracker()->has_reserve_limit()) {
+        auto wg_tracker = _workgroup->mem_tracker();
+        bytes_to_free = std::max(bytes_to_free, wg_tracker->consumption() - static_cast<int64_t>(
+                                                                                wg_tracker->reserve_limit() *
+                                                                                release_buffer_mem_ratio));
+    }
+
+    auto process_mem_tracker = GlobalEnv::GetInstance()->process_mem_tracker();
+    if (process_mem_tracker != nullptr && process_mem_tracker->has_limit() &&
+        config::spill_process_mem_limit_threshold < 1.0) {
+        bytes_to_free = std::max(bytes_to_free,
+                                 process_mem_tracker->consumption() -
+                                         static_cast<int64_t>(process_mem_tracker->limit() *
+                                                              config::spill_process_mem_limit_threshold));
+    }
+    return bytes_to_free;
+}
+
 void PipelineDriver::_try_to_release_buffer(RuntimeState* state, OperatorPtr& op) {
     if (state->enable_spill() && op->releaseable()) {
         auto& mem_resource_mgr = op->mem_resource_manager();
         if (mem_resource_mgr.is_releasing()) {
             return;
         }
-        auto query_mem_tracker = _query_ctx->mem_tracker();
-        auto query_consumption = query_mem_tracker->consumption();
-        auto query_mem_limit = query_mem_tracker->lowest_limit();
-        DCHECK_GT(query_mem_limit, 0);
-        auto spill_mem_threshold = query_mem_limit * state->spill_mem_limit_threshold();
-        if (query_consumption >= spill_mem_threshold * release_buffer_mem_ratio) {
-            // if the currently used memory is very close to the threshold that triggers spill,
-            // try to release buffer first
-            TRACE_SPILL_LOG << "release operator due to mem pressure, consumption: " << query_consumption
-                            << ", release buffer threshold: "
-                            << static_cast<int64_t>(spill_mem_threshold * release_buffer_mem_ratio)
-                            << ", spill mem threshold: " << static_cast<int64_t>(spill_mem_threshold);
-            mem_resource_mgr.to_low_memory_mode();
+        auto* spill_manager = mem_resource_mgr.query_spill_manager();
+        bool gradual = config::enable_spill_gradual_trigger && mem_resource_mgr.spillable() && spill_manager != nullptr;
+        if (gradual) {
+            spill_manager->update_revocable_bytes(op.get(), op->revocable_mem_bytes());
         }
+        int64_t bytes_to_free = _bytes_over_release_threshold(state);
+        if (bytes_to_free < 0) {
+            return;
+        }
+        // spill the operators holding the most revocable memory first, and only as many as needed,
+        // instead of moving all the spillable operators of the query to low memory mode at once
+        if (gradual && !spill_manager->is_spill_candidate(op.get(), bytes_to_free)) {
+            return;
+        }
+        // if the currently used memory is very close to the threshold that triggers spill,
+        // try to release buffer first
+        TRACE_SPILL_LOG << "release operator due to mem pressure, bytes to free: " << bytes_to_free
+                        << ", revocable bytes: " << op->revocable_mem_bytes();
+        mem_resource_mgr.to_low_memory_mode();
     }
 }
 
@@ -833,6 +931,18 @@ Status PipelineDriver::_mark_operator_closed(OperatorPtr& op, RuntimeState* stat
     return Status::OK();
 }
 
+int64_t PipelineDriver::_yield_max_time_spent_ns() const {
+    // The long running drivers of the big queries yield in shorter slices, to reduce the time the drivers of the
+    // other workgroups wait for the executor threads.
+    const int64_t threshold_ms = config::pipeline_big_driver_cpu_time_threshold_ms;
+    const int64_t slice_ms = config::pipeline_big_driver_yield_time_slice_ms;
+    if (_workgroup == nullptr || _workgroup->is_sq_wg() || threshold_ms <= 0 || slice_ms <= 0 ||
+        _driver_acct.get_accumulated_time_spent() < threshold_ms * 1'000'000L) {
+        return YIELD_MAX_TIME_SPENT_NS;
+    }
+    return std::min(YIELD_MAX_TIME_SPENT_NS, slice_ms * 1'000'000L);
+}
+
 void PipelineDriver::_update_driver_acct(size_t total_chunks_moved, size_t total_rows_moved, size_t time_spent) {
     driver_acct().update_last_chunks_moved(total_chunks_moved);
     driver_acct().update_accumulated_rows_moved(total_rows_moved);
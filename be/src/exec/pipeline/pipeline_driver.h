@@ -20,7 +20,9 @@
 #include <chrono>
 
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/statusor.h"
+#include "exec/pipeline/adaptive_chunk_size.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/operator_with_dependency.h"
@@ -137,6 +139,9 @@ public:
                                               std::chrono::steady_clock::now().time_since_epoch())
                                               .count();
     }
+    // Called by WorkGroupDriverQueue when the driver is put into the ready queue, to measure the schedule latency.
+    void update_enter_ready_queue_timestamp(int64_t now_ns) { enter_ready_queue_timestamp = now_ns; }
+    int64_t get_ready_queue_time_spent(int64_t now_ns) const { return now_ns - enter_ready_queue_timestamp; }
     void update_last_chunks_moved(int64_t chunks_moved) {
         this->last_chunks_moved = chunks_moved;
         this->accumulated_chunks_moved += chunks_moved;
@@ -170,6 +175,7 @@ private:
     int64_t last_time_spent{0};
     int64_t last_chunks_moved{0};
     int64_t enter_local_queue_timestamp{0};
+    int64_t enter_ready_queue_timestamp{0};
     int64_t accumulated_time_spent{0};
     int64_t accumulated_local_wait_time_spent{0};
     int64_t accumulated_chunks_moved{0};
@@ -345,9 +351,20 @@ public:
         return !_all_global_rf_ready_or_timeout;
     }
 
+    // return true if the query isn't admitted by its workgroup yet.
+    bool admission_block() {
+        if (!_admitted) {
+            _admitted = _query_ctx->try_admit(workgroup());
+        }
+        return !_admitted;
+    }
+
     // return true if either dependencies_block or local_rf_block return true, which means that the current driver
     // should wait for both hash table and local runtime filters' readiness.
     bool is_precondition_block() {
+        if (admission_block()) {
+            return true;
+        }
         if (!_wait_global_rf_ready) {
             if (dependencies_block() || local_rf_block()) {
                 return true;
@@ -371,7 +388,8 @@ public:
 
     std::string get_preconditions_block_reasons() {
         if (_state == DriverState::PRECONDITION_BLOCK) {
-            return std::string(dependencies_block() ? "(dependencies," : "(") +
+            return std::string(admission_block() ? "(admission," : "(") +
+                   std::string(dependencies_block() ? "dependencies," : "") +
                    std::string(global_rf_block() ? "global runtime filter," : "") +
                    std::string(local_rf_block() ? "local runtime filter)" : ")");
         } else {
@@ -441,6 +459,13 @@ public:
     inline bool is_in_ready_queue() const { return _in_ready_queue.load(std::memory_order_acquire); }
     void set_in_ready_queue(bool v) { _in_ready_queue.store(v, std::memory_order_release); }
 
+    PipelineObserver* observer() { return &_observer; }
+    // Whether the poller can skip checking this blocked driver until its observer is notified.
+    bool is_waiting_for_notification() {
+        return _state == DriverState::INPUT_EMPTY && config::enable_pipeline_event_driven_wakeup &&
+               source_operator()->is_observable();
+    }
+
     inline std::string get_name() const { return strings::Substitute("PipelineDriver (id=$0)", _driver_id); }
 
     // Whether the query can be expirable or not.
@@ -482,18 +507,33 @@ protected:
 
     void _adjust_memory_usage(RuntimeState* state, MemTracker* tracker, OperatorPtr& op, const ChunkPtr& chunk);
     void _try_to_release_buffer(RuntimeState* state, OperatorPtr& op);
+    int64_t _bytes_over_release_threshold(RuntimeState* state) const;
+    // The on-core time after which the driver yields in the current execution round.
+    int64_t _yield_max_time_spent_ns() const;
 
     // Update metrics when the driver yields.
     void _update_driver_acct(size_t total_chunks_moved, size_t total_rows_moved, size_t time_spent);
     void _update_statistics(RuntimeState* state, size_t total_chunks_moved, size_t total_rows_moved, size_t time_spent);
     void _update_scan_statistics(RuntimeState* state);
     void _update_driver_level_timer();
+    // Returns the scale of the cycles of the next push_chunk/pull_chunk call, 0 if the call is not timed.
+    int64_t _next_operator_timer_scale() {
+        if (--_operator_timer_countdown > 0) {
+            return 0;
+        }
+        _operator_timer_countdown = _operator_timer_sample_interval;
+        return _operator_timer_sample_interval;
+    }
+    // Adds the cycles of the operators timed during a process() which took `elapsed_ns` and `elapsed_cycles` to
+    // their timers.
+    void _update_operator_timers(int64_t elapsed_ns, int64_t elapsed_cycles);
 
     RuntimeState* _runtime_state = nullptr;
     Operators _operators;
     DriverDependencies _dependencies;
     bool _all_dependencies_ready = false;
     bool _precondition_prepared = false;
+    bool _admitted = false;
 
     mutable std::vector<RuntimeFilterHolder*> _local_rf_holders;
     bool _all_local_rf_ready = false;
@@ -525,6 +565,10 @@ protected:
     // The index of QuerySharedDriverQueue._queues which this driver belongs to.
     size_t _driver_queue_level = 0;
     std::atomic<bool> _in_ready_queue{false};
+    PipelineObserver _observer;
+
+    // Set if enable_pipeline_adaptive_chunk_size, shared with the scan and the chunk accumulate operators.
+    AdaptiveChunkSizeControllerPtr _adaptive_chunk_size;
 
     // metrics
     RuntimeProfile::Counter* _total_timer = nullptr;
@@ -558,6 +602,12 @@ protected:
     MonotonicStopWatch* _pending_finish_timer_sw = nullptr;
 
     RuntimeProfile::HighWaterMarkCounter* _peak_driver_queue_size_counter = nullptr;
+    RuntimeProfile::Counter* _adaptive_chunk_size_counter = nullptr;
+
+    // Only one of every _operator_timer_sample_interval push_chunk/pull_chunk calls is timed, see
+    // config::pipeline_operator_timer_sample_interval.
+    int32_t _operator_timer_sample_interval = 1;
+    int32_t _operator_timer_countdown = 1;
 };
 
 } // namespace pipeline
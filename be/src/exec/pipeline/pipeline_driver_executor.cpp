@@ -14,12 +14,16 @@
 
 #include "exec/pipeline/pipeline_driver_executor.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "common/config.h"
 #include "exec/pipeline/stream_pipeline_driver.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "testutil/sync_point.h"
+#include "util/cpu_info.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
@@ -40,6 +44,9 @@ GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_
     REGISTER_GAUGE_STARROCKS_METRIC(pipe_driver_schedule_count, [this]() { return _schedule_count.load(); });
     REGISTER_GAUGE_STARROCKS_METRIC(pipe_driver_execution_time, [this]() { return _driver_execution_ns.load(); });
     REGISTER_GAUGE_STARROCKS_METRIC(pipe_driver_queue_len, [this]() { return _driver_queue->size(); });
+    REGISTER_GAUGE_STARROCKS_METRIC(pipe_driver_local_run_queue_hit_count,
+                                    [this]() { return _local_run_queue_hit_count.load(); });
+    REGISTER_GAUGE_STARROCKS_METRIC(pipe_driver_steal_count, [this]() { return _steal_count.load(); });
     REGISTER_GAUGE_STARROCKS_METRIC(pipe_poller_block_queue_len,
                                     [this]() { return _blocked_driver_poller->blocked_driver_queue_len(); });
 }
@@ -76,7 +83,13 @@ void GlobalDriverExecutor::_finalize_driver(DriverRawPtr driver, RuntimeState* r
 void GlobalDriverExecutor::_worker_thread() {
     auto current_thread = Thread::current_thread();
     const int worker_id = _next_id++;
+    if (config::enable_numa_aware_scheduling && CpuInfo::get_max_num_numa_nodes() > 1) {
+        // Spread the workers over the NUMA nodes, so that the run queues stolen first are on the same node.
+        CpuInfo::bind_current_thread_to_numa_node(worker_id % CpuInfo::get_max_num_numa_nodes());
+    }
     std::queue<DriverRawPtr> local_driver_queue;
+    auto run_queue = _register_run_queue(worker_id);
+    DeferOp unregister_run_queue([&]() { _unregister_run_queue(run_queue); });
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
@@ -90,7 +103,7 @@ void GlobalDriverExecutor::_worker_thread() {
             current_thread->set_idle(true);
         }
 
-        auto maybe_driver = _get_next_driver(local_driver_queue);
+        auto maybe_driver = _get_next_driver(local_driver_queue, run_queue.get());
         if (maybe_driver.status().is_cancelled()) {
             return;
         }
@@ -221,7 +234,8 @@ void GlobalDriverExecutor::_worker_thread() {
     }
 }
 
-StatusOr<DriverRawPtr> GlobalDriverExecutor::_get_next_driver(std::queue<DriverRawPtr>& local_driver_queue) {
+StatusOr<DriverRawPtr> GlobalDriverExecutor::_get_next_driver(std::queue<DriverRawPtr>& local_driver_queue,
+                                                              WorkerRunQueue* run_queue) {
     DriverRawPtr driver = nullptr;
     if (!local_driver_queue.empty()) {
         const size_t local_driver_num = local_driver_queue.size();
@@ -242,10 +256,100 @@ StatusOr<DriverRawPtr> GlobalDriverExecutor::_get_next_driver(std::queue<DriverR
         }
     }
 
+    if (run_queue->num_drivers > 0) {
+        std::lock_guard<std::mutex> lock(run_queue->mutex);
+        if (!run_queue->drivers.empty()) {
+            driver = run_queue->drivers.front();
+            run_queue->drivers.pop_front();
+            run_queue->num_drivers = run_queue->drivers.size();
+            _local_run_queue_hit_count++;
+            return driver;
+        }
+    }
+    if (driver = _steal_driver(run_queue); driver != nullptr) {
+        return driver;
+    }
+
     // If local driver queue is not empty, we cannot block here. Otherwise these local drivers may not be scheduled until
     // ready queue is not empty.
     const bool need_block = local_driver_queue.empty();
-    return this->_driver_queue->take(need_block);
+    const size_t batch_size = std::max(config::pipeline_driver_queue_take_batch_size, 1);
+    if (batch_size == 1) {
+        return this->_driver_queue->take(need_block);
+    }
+
+    // Take a batch under one lock of _driver_queue, the drivers except the first one wait in the run queue,
+    // from which the idle workers can steal them.
+    auto& batch = run_queue->batch;
+    batch.clear();
+    RETURN_IF_ERROR(this->_driver_queue->take_batch(need_block, batch_size, &batch));
+    if (batch.empty()) {
+        return nullptr;
+    }
+    if (batch.size() > 1) {
+        TEST_SYNC_POINT_CALLBACK("GlobalDriverExecutor::_get_next_driver::park_batch", &batch);
+        run_queue->numa_node = CpuInfo::get_current_numa_node();
+        {
+            std::lock_guard<std::mutex> lock(run_queue->mutex);
+            run_queue->drivers.insert(run_queue->drivers.end(), batch.begin() + 1, batch.end());
+            run_queue->num_drivers = run_queue->drivers.size();
+        }
+        // The workers which went to sleep on _driver_queue before these drivers are parked have missed them, so wake
+        // them up to steal the drivers, rather than leaving them to wait for the owner running the first one.
+        _driver_queue->wake_up_idle_takers(batch.size() - 1);
+    }
+    return batch[0];
+}
+
+DriverRawPtr GlobalDriverExecutor::_steal_driver(const WorkerRunQueue* run_queue) {
+    const int numa_node = CpuInfo::get_current_numa_node();
+    std::shared_lock<std::shared_mutex> lock(_run_queues_mutex);
+    const size_t num_run_queues = _run_queues.size();
+    // Start from different victims for different workers, to avoid all the idle workers stealing from the same one.
+    const auto start = static_cast<size_t>(run_queue->worker_id);
+    for (const bool same_numa_node : {true, false}) {
+        for (size_t i = 0; i < num_run_queues; i++) {
+            auto* victim = _run_queues[(start + i) % num_run_queues].get();
+            if (victim == run_queue || victim->num_drivers == 0 || (victim->numa_node == numa_node) != same_numa_node) {
+                continue;
+            }
+            std::lock_guard<std::mutex> victim_lock(victim->mutex);
+            if (!victim->drivers.empty()) {
+                DriverRawPtr driver = victim->drivers.back();
+                victim->drivers.pop_back();
+                victim->num_drivers = victim->drivers.size();
+                _steal_count++;
+                return driver;
+            }
+        }
+    }
+    return nullptr;
+}
+
+GlobalDriverExecutor::WorkerRunQueuePtr GlobalDriverExecutor::_register_run_queue(int worker_id) {
+    auto run_queue = std::make_shared<WorkerRunQueue>(worker_id);
+    run_queue->numa_node = CpuInfo::get_current_numa_node();
+    std::unique_lock<std::shared_mutex> lock(_run_queues_mutex);
+    _run_queues.emplace_back(run_queue);
+    return run_queue;
+}
+
+void GlobalDriverExecutor::_unregister_run_queue(const WorkerRunQueuePtr& run_queue) {
+    {
+        std::unique_lock<std::shared_mutex> lock(_run_queues_mutex);
+        _run_queues.erase(std::find(_run_queues.begin(), _run_queues.end(), run_queue));
+    }
+
+    std::vector<DriverRawPtr> drivers;
+    {
+        std::lock_guard<std::mutex> lock(run_queue->mutex);
+        drivers.assign(run_queue->drivers.begin(), run_queue->drivers.end());
+        run_queue->drivers.clear();
+        run_queue->num_drivers = 0;
+    }
+    if (!drivers.empty()) {
+        _driver_queue->put_back(drivers);
+    }
 }
 
 void GlobalDriverExecutor::submit(DriverRawPtr driver) {
@@ -277,9 +381,11 @@ void GlobalDriverExecutor::submit(DriverRawPtr driver) {
 
 void GlobalDriverExecutor::cancel(DriverRawPtr driver) {
     // if driver is already in ready queue, we should cancel it
-    // otherwise, just ignore it and wait for the poller to schedule
+    // otherwise, just wake up the poller to schedule it
     if (driver->is_in_ready_queue()) {
         this->_driver_queue->cancel(driver);
+    } else {
+        driver->observer()->notify();
     }
 }
 
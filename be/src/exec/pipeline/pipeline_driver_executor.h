@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include "exec/pipeline/audit_statistics_reporter.h"
@@ -89,8 +91,32 @@ public:
 
 private:
     using Base = FactoryMethod<DriverExecutor, GlobalDriverExecutor>;
+
+    // The ready drivers taken from _driver_queue in batch by a worker thread and not executed yet.
+    // The owner pops drivers from the front, and the idle peers steal drivers from the back.
+    struct WorkerRunQueue {
+        explicit WorkerRunQueue(int worker_id) : worker_id(worker_id) {}
+
+        const int worker_id;
+        // The NUMA node of the core which the owner ran on when it took the last batch.
+        std::atomic<int> numa_node = 0;
+        // The size of drivers, which lets the peers skip an empty run queue without locking it.
+        std::atomic<size_t> num_drivers = 0;
+        std::mutex mutex;
+        std::deque<DriverRawPtr> drivers;
+        // Only used by the owner to receive a batch from _driver_queue.
+        std::vector<DriverRawPtr> batch;
+    };
+    using WorkerRunQueuePtr = std::shared_ptr<WorkerRunQueue>;
+
     void _worker_thread();
-    StatusOr<DriverRawPtr> _get_next_driver(std::queue<DriverRawPtr>& local_driver_queue);
+    StatusOr<DriverRawPtr> _get_next_driver(std::queue<DriverRawPtr>& local_driver_queue,
+                                            WorkerRunQueue* run_queue);
+    // Steal a driver from the run queues of the other workers, the workers on the same NUMA node go first.
+    DriverRawPtr _steal_driver(const WorkerRunQueue* run_queue);
+    WorkerRunQueuePtr _register_run_queue(int worker_id);
+    // Give the drivers not executed yet back to _driver_queue, when the worker thread exits.
+    void _unregister_run_queue(const WorkerRunQueuePtr& run_queue);
     void _finalize_driver(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state);
     RuntimeProfile* _build_merged_instance_profile(QueryContext* query_ctx, FragmentContext* fragment_ctx,
                                                    ObjectPool* obj_pool);
@@ -112,6 +138,11 @@ private:
     std::atomic<int> _next_id = 0;
     std::atomic_int64_t _schedule_count = 0;
     std::atomic_int64_t _driver_execution_ns = 0;
+    std::atomic_int64_t _local_run_queue_hit_count = 0;
+    std::atomic_int64_t _steal_count = 0;
+
+    mutable std::shared_mutex _run_queues_mutex;
+    std::vector<WorkerRunQueuePtr> _run_queues;
 
     // metrics
     std::unique_ptr<UIntGauge> _driver_queue_len;
@@ -14,7 +14,12 @@
 
 #include "pipeline_driver_poller.h"
 
+#include <algorithm>
 #include <chrono>
+
+#include "common/config.h"
+#include "util/time.h"
+
 namespace starrocks::pipeline {
 
 void PipelineDriverPoller::start() {
@@ -58,9 +63,28 @@ void PipelineDriverPoller::run_internal() {
                     break;
                 }
                 tmp_blocked_drivers.splice(tmp_blocked_drivers.end(), _blocked_drivers);
+            } else if (tmp_blocked_drivers.empty() && !_polled_in_last_round && !_has_notification) {
+                // All the blocked drivers are waiting for notifications, so sleep until any one is notified,
+                // a new blocked driver comes, or it's time to check all of them.
+                const int64_t wait_ms = std::max<int64_t>(_next_full_scan_ms - MonotonicMillis(), 0);
+                _cond.wait_for(lock, std::chrono::milliseconds(wait_ms), [this]() {
+                    return _is_shutdown.load(std::memory_order_acquire) || _has_notification ||
+                           !_blocked_drivers.empty();
+                });
+                tmp_blocked_drivers.splice(tmp_blocked_drivers.end(), _blocked_drivers);
             }
+            _has_notification = false;
         }
 
+        // Check all the blocked drivers periodically, including the ones waiting for notifications,
+        // to handle cancellation, expiration, profile reporting and the state changes nobody notifies.
+        const int64_t now_ms = MonotonicMillis();
+        const bool full_scan = now_ms >= _next_full_scan_ms;
+        if (full_scan) {
+            _next_full_scan_ms = now_ms + config::pipeline_poller_full_scan_interval_ms;
+        }
+        _polled_in_last_round = false;
+
         {
             std::unique_lock write_lock(_local_mutex);
 
@@ -72,6 +96,13 @@ void PipelineDriverPoller::run_internal() {
             while (driver_it != _local_blocked_drivers.end()) {
                 auto* driver = *driver_it;
 
+                const bool notified = driver->observer()->take_notification();
+                if (!full_scan && !notified && driver->is_waiting_for_notification()) {
+                    ++driver_it;
+                    continue;
+                }
+                _polled_in_last_round = true;
+
                 if (!driver->is_query_never_expired() && driver->query_ctx()->is_query_expired()) {
                     // there are not any drivers belonging to a query context can make progress for an expiration period
                     // indicates that some fragments are missing because of failed exec_plan_fragment invocation. in
@@ -176,6 +207,7 @@ void PipelineDriverPoller::run_internal() {
 }
 
 void PipelineDriverPoller::add_blocked_driver(const DriverRawPtr driver) {
+    driver->observer()->attach_poller(this);
     std::unique_lock<std::mutex> lock(_global_mutex);
     _blocked_drivers.push_back(driver);
     _blocked_driver_queue_len++;
@@ -184,6 +216,12 @@ void PipelineDriverPoller::add_blocked_driver(const DriverRawPtr driver) {
     _cond.notify_one();
 }
 
+void PipelineDriverPoller::wakeup() {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    _has_notification = true;
+    _cond.notify_one();
+}
+
 void PipelineDriverPoller::park_driver(const DriverRawPtr driver) {
     std::unique_lock<std::mutex> lock(_global_parked_mutex);
     VLOG_ROW << "Add to parked driver:" << driver->to_readable_string();
@@ -45,6 +45,8 @@ public:
     void shutdown();
     // add blocked driver to poller
     void add_blocked_driver(const DriverRawPtr driver);
+    // wake up the polling thread waiting for notifications, invoked by PipelineObserver::notify()
+    void wakeup();
     // remove blocked driver from poller
     void remove_blocked_driver(DriverList& local_blocked_drivers, DriverList::iterator& driver_it);
     void on_cancel(DriverRawPtr driver, std::vector<DriverRawPtr>& ready_drivers, DriverList& local_blocked_drivers,
@@ -84,5 +86,11 @@ private:
     DriverList _parked_drivers;
 
     std::atomic<size_t> _blocked_driver_queue_len;
+
+    // Guarded by _global_mutex. Whether any blocked driver is notified since the polling thread checked last time.
+    bool _has_notification = false;
+    // Whether the last polling round has checked any driver, the others are all waiting for notifications.
+    bool _polled_in_last_round = true;
+    int64_t _next_full_scan_ms = 0;
 };
 } // namespace starrocks::pipeline
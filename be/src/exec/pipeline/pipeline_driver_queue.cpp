@@ -81,49 +81,79 @@ void QuerySharedDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
 }
 
 StatusOr<DriverRawPtr> QuerySharedDriverQueue::take(const bool block) {
-    // -1 means no candidates; else has candidate.
-    int queue_idx = -1;
-    double target_accu_time = 0;
-    DriverRawPtr driver_ptr = nullptr;
+    std::unique_lock<std::mutex> lock(_global_mutex);
+    while (true) {
+        if (_is_closed) {
+            return Status::Cancelled("Shutdown");
+        }
+        if (auto* driver = _take_locked(); driver != nullptr) {
+            // next pipeline driver to execute.
+            return driver;
+        }
+        if (!block || _idle_takers.consume_wakeup()) {
+            return nullptr;
+        }
+        ++_idle_takers.num_waiting;
+        _cv.wait(lock);
+        --_idle_takers.num_waiting;
+    }
+}
 
-    {
-        std::unique_lock<std::mutex> lock(_global_mutex);
-        while (true) {
-            if (_is_closed) {
-                return Status::Cancelled("Shutdown");
-            }
+Status QuerySharedDriverQueue::take_batch(const bool block, size_t max_num, std::vector<DriverRawPtr>* drivers) {
+    std::unique_lock<std::mutex> lock(_global_mutex);
+    while (true) {
+        if (_is_closed) {
+            return Status::Cancelled("Shutdown");
+        }
+        if (auto* driver = _take_locked(); driver != nullptr) {
+            drivers->emplace_back(driver);
+            break;
+        }
+        if (!block || _idle_takers.consume_wakeup()) {
+            return Status::OK();
+        }
+        ++_idle_takers.num_waiting;
+        _cv.wait(lock);
+        --_idle_takers.num_waiting;
+    }
 
-            // Find the queue with the smallest execution time.
-            for (int i = 0; i < QUEUE_SIZE; ++i) {
-                // we just search for queue has element
-                if (!_queues[i].empty()) {
-                    double local_target_time = _queues[i].accu_time_after_divisor();
-                    if (queue_idx < 0 || local_target_time < target_accu_time) {
-                        target_accu_time = local_target_time;
-                        queue_idx = i;
-                    }
-                }
-            }
+    while (drivers->size() < max_num && _num_drivers >= max_num) {
+        drivers->emplace_back(_take_locked());
+    }
+    return Status::OK();
+}
 
-            if (queue_idx >= 0) {
-                break;
-            }
-            if (!block) {
-                break;
-            }
-            _cv.wait(lock);
-        }
+void QuerySharedDriverQueue::wake_up_idle_takers(size_t num) {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    if (_idle_takers.add_wakeups(num) > 0) {
+        _cv.notify_all();
+    }
+}
 
-        if (queue_idx >= 0) {
-            // record queue's index to accumulate time for it.
-            driver_ptr = _queues[queue_idx].take(false);
-            driver_ptr->set_in_ready_queue(false);
+DriverRawPtr QuerySharedDriverQueue::_take_locked() {
+    // -1 means no candidates; else has candidate.
+    int queue_idx = -1;
+    double target_accu_time = 0;
 
-            --_num_drivers;
+    // Find the queue with the smallest execution time.
+    for (int i = 0; i < QUEUE_SIZE; ++i) {
+        // we just search for queue has element
+        if (!_queues[i].empty()) {
+            double local_target_time = _queues[i].accu_time_after_divisor();
+            if (queue_idx < 0 || local_target_time < target_accu_time) {
+                target_accu_time = local_target_time;
+                queue_idx = i;
+            }
         }
     }
+    if (queue_idx < 0) {
+        return nullptr;
+    }
 
-    // next pipeline driver to execute.
+    // record queue's index to accumulate time for it.
+    DriverRawPtr driver_ptr = _queues[queue_idx].take(false);
+    driver_ptr->set_in_ready_queue(false);
+    --_num_drivers;
     return driver_ptr;
 }
 
@@ -241,6 +271,43 @@ void WorkGroupDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
 StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
     std::unique_lock<std::mutex> lock(_global_mutex);
 
+    ASSIGN_OR_RETURN(auto* wg_entity, _wait_next_wg(lock, block));
+    if (wg_entity == nullptr) {
+        return nullptr;
+    }
+    return _take_from_wg(wg_entity, block);
+}
+
+Status WorkGroupDriverQueue::take_batch(const bool block, size_t max_num, std::vector<DriverRawPtr>* drivers) {
+    std::unique_lock<std::mutex> lock(_global_mutex);
+
+    ASSIGN_OR_RETURN(auto* wg_entity, _wait_next_wg(lock, block));
+    while (wg_entity != nullptr) {
+        ASSIGN_OR_RETURN(auto* driver, _take_from_wg(wg_entity, block));
+        if (driver == nullptr) {
+            break;
+        }
+        drivers->emplace_back(driver);
+        if (drivers->size() >= max_num || _num_drivers < max_num) {
+            break;
+        }
+        // The vruntime of workgroups is only updated by update_statistics() after running a driver, so the
+        // following drivers of the batch are still selected by the vruntime and bandwidth of the last round.
+        _update_bandwidth_control_period();
+        wg_entity = _take_next_wg();
+    }
+    return Status::OK();
+}
+
+void WorkGroupDriverQueue::wake_up_idle_takers(size_t num) {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    if (_idle_takers.add_wakeups(num) > 0) {
+        _cv.notify_all();
+    }
+}
+
+StatusOr<workgroup::WorkGroupDriverSchedEntity*> WorkGroupDriverQueue::_wait_next_wg(std::unique_lock<std::mutex>& lock,
+                                                                                      const bool block) {
     workgroup::WorkGroupDriverSchedEntity* wg_entity = nullptr;
     while (wg_entity == nullptr) {
         if (_is_closed) {
@@ -250,10 +317,12 @@ StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
         _update_bandwidth_control_period();
 
         if (_wg_entities.empty()) {
-            if (!block) {
+            if (!block || _idle_takers.consume_wakeup()) {
                 return nullptr;
             }
+            ++_idle_takers.num_waiting;
             _cv.wait(lock);
+            --_idle_takers.num_waiting;
         } else if (wg_entity = _take_next_wg(); wg_entity == nullptr) {
             int64_t cur_ns = MonotonicNanos();
             int64_t sleep_ns = _bandwidth_control_period_end_ns - cur_ns;
@@ -261,14 +330,20 @@ StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
                 continue;
             }
 
-            if (!block) {
+            if (!block || _idle_takers.consume_wakeup()) {
                 return nullptr;
             }
             // All the ready tasks are throttled, so wait until the new period or a new task comes.
+            ++_idle_takers.num_waiting;
             _cv.wait_for(lock, std::chrono::nanoseconds(sleep_ns));
+            --_idle_takers.num_waiting;
         }
     }
+    return wg_entity;
+}
 
+StatusOr<DriverRawPtr> WorkGroupDriverQueue::_take_from_wg(workgroup::WorkGroupDriverSchedEntity* wg_entity,
+                                                           const bool block) {
     // If wg only contains one ready driver, it will be not ready anymore
     // after taking away the only one driver.
     if (wg_entity->queue()->size() == 1) {
@@ -278,6 +353,8 @@ StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
     auto maybe_driver = wg_entity->queue()->take(block);
     if (maybe_driver.ok() && maybe_driver.value() != nullptr) {
         --_num_drivers;
+        wg_entity->record_schedule_latency_ns(
+                maybe_driver.value()->driver_acct().get_ready_queue_time_spent(MonotonicNanos()));
     }
     return maybe_driver;
 }
@@ -336,6 +413,10 @@ bool WorkGroupDriverQueue::should_yield(const DriverRawPtr driver, int64_t unacc
     // Return true, if the minimum-vruntime workgroup is not current workgroup anymore.
     auto* wg_entity = driver->workgroup()->driver_sched_entity();
     auto* min_entity = _min_wg_entity.load();
+    if (min_entity != nullptr && min_entity != wg_entity && min_entity->is_sq_wg() && !wg_entity->is_sq_wg() &&
+        config::enable_short_query_workgroup_strict_priority) {
+        return true;
+    }
     return min_entity != wg_entity && min_entity &&
            min_entity->vruntime_ns() < wg_entity->vruntime_ns() + unaccounted_runtime_ns / wg_entity->cpu_limit();
 }
@@ -359,6 +440,7 @@ void WorkGroupDriverQueue::_put_back(const DriverRawPtr driver) {
 
     auto* wg_entity = driver->workgroup()->driver_sched_entity();
     wg_entity->set_in_queue(this);
+    driver->driver_acct().update_enter_ready_queue_timestamp(MonotonicNanos());
     wg_entity->queue()->put_back(driver);
     driver->set_in_queue(this);
 
@@ -381,6 +463,15 @@ void WorkGroupDriverQueue::_update_min_wg() {
 }
 
 workgroup::WorkGroupDriverSchedEntity* WorkGroupDriverQueue::_take_next_wg() {
+    if (config::enable_short_query_workgroup_strict_priority) {
+        // The short query workgroup is never throttled, and runs before the others whatever its vruntime is.
+        for (auto* wg_entity : _wg_entities) {
+            if (wg_entity->is_sq_wg()) {
+                return wg_entity;
+            }
+        }
+    }
+
     workgroup::WorkGroupDriverSchedEntity* min_unthrottled_wg_entity = nullptr;
     for (auto* wg_entity : _wg_entities) {
         if (!_throttled(wg_entity)) {
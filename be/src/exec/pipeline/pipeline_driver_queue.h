@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <queue>
 
 #include "exec/pipeline/pipeline_driver.h"
@@ -36,6 +37,13 @@ public:
     virtual void put_back_from_executor(const DriverRawPtr driver) = 0;
 
     virtual StatusOr<DriverRawPtr> take(const bool block) = 0;
+    // Take at most `max_num` drivers into `drivers` in one critical section. Only the first driver is waited for
+    // when `block` is true, and the others are taken only if there are still at least `max_num` ready drivers,
+    // so that a batch never drains the queue while the other executor threads are waiting for it.
+    virtual Status take_batch(const bool block, size_t max_num, std::vector<DriverRawPtr>* drivers) = 0;
+    // Wake up at most `num` threads blocked in take() or take_batch(), which return without a driver, so that they
+    // can steal the drivers just parked in the run queue of another executor thread.
+    virtual void wake_up_idle_takers(size_t num) = 0;
     virtual void cancel(DriverRawPtr driver) = 0;
 
     // Update statistics of the driver's workgroup,
@@ -95,6 +103,29 @@ private:
     std::atomic<int64_t> _accu_consume_time = 0;
 };
 
+// The threads blocked in a driver queue and the wakeups not consumed by them yet, guarded by the lock of the queue.
+struct IdleDriverTakers {
+    size_t num_waiting = 0;
+    size_t num_wakeups = 0;
+
+    // Return true if a blocked thread should return without a driver instead of waiting again.
+    bool consume_wakeup() {
+        if (num_wakeups == 0) {
+            return false;
+        }
+        --num_wakeups;
+        return true;
+    }
+
+    // Return the number of the threads to notify, the wakeups never exceed the blocked threads.
+    size_t add_wakeups(size_t num) {
+        const size_t idle = num_waiting > num_wakeups ? num_waiting - num_wakeups : 0;
+        const size_t n = std::min(num, idle);
+        num_wakeups += n;
+        return n;
+    }
+};
+
 class QuerySharedDriverQueue : public FactoryMethod<DriverQueue, QuerySharedDriverQueue> {
     friend class FactoryMethod<DriverQueue, QuerySharedDriverQueue>;
 
@@ -110,6 +141,8 @@ public:
 
     // Return cancelled status, if the queue is closed.
     StatusOr<DriverRawPtr> take(const bool block) override;
+    Status take_batch(const bool block, size_t max_num, std::vector<DriverRawPtr>* drivers) override;
+    void wake_up_idle_takers(size_t num) override;
 
     void cancel(DriverRawPtr driver) override;
 
@@ -124,6 +157,9 @@ private:
     // When the driver at the i-th level costs _level_time_slices[i],
     // it will move to (i+1)-th level.
     int _compute_driver_level(const DriverRawPtr driver) const;
+    // Take the driver from the level with the smallest accumulated time, guarded by _global_mutex.
+    // Return nullptr if there is no ready driver.
+    DriverRawPtr _take_locked();
 
 private:
     // The time slice of the i-th level is (i+1)*LEVEL_TIME_SLICE_BASE ns,
@@ -140,6 +176,7 @@ private:
 
     mutable std::mutex _global_mutex;
     std::condition_variable _cv;
+    IdleDriverTakers _idle_takers;
     bool _is_closed = false;
 };
 
@@ -164,6 +201,9 @@ public:
     // Firstly, select the work group with the minimum vruntime.
     // Secondly, select the proper driver from the driver queue of this work group.
     StatusOr<DriverRawPtr> take(const bool block) override;
+    // The drivers of a batch may come from different work groups, each of which is selected as take() does.
+    Status take_batch(const bool block, size_t max_num, std::vector<DriverRawPtr>* drivers) override;
+    void wake_up_idle_takers(size_t num) override;
 
     void cancel(DriverRawPtr driver) override;
 
@@ -178,6 +218,10 @@ private:
     template <bool from_executor>
     void _put_back(const DriverRawPtr driver);
     workgroup::WorkGroupDriverSchedEntity* _take_next_wg();
+    // Wait for an unthrottled work group with ready drivers. Return nullptr if there is none and `block` is false.
+    StatusOr<workgroup::WorkGroupDriverSchedEntity*> _wait_next_wg(std::unique_lock<std::mutex>& lock,
+                                                                  const bool block);
+    StatusOr<DriverRawPtr> _take_from_wg(workgroup::WorkGroupDriverSchedEntity* wg_entity, const bool block);
     // _update_min_wg is invoked when an entity is enqueued or dequeued from _wg_entities.
     void _update_min_wg();
     // Apply hard bandwidth control to non-short-query workgroups, when there are queries of the short-query workgroup.
@@ -206,6 +250,7 @@ private:
 
     mutable std::mutex _global_mutex;
     std::condition_variable _cv;
+    IdleDriverTakers _idle_takers;
     bool _is_closed = false;
 
     // Contains the workgroups which include the drivers ready to be run.
@@ -0,0 +1,38 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_observer.h"
+
+#include <algorithm>
+
+#include "exec/pipeline/pipeline_driver_poller.h"
+
+namespace starrocks::pipeline {
+
+void PipelineObserver::notify() {
+    // Only the first notification since the last check needs to wake up the poller.
+    if (_notified.exchange(true)) {
+        return;
+    }
+    if (auto* poller = _poller.load(); poller != nullptr) {
+        poller->wakeup();
+    }
+}
+
+void PipelineObserverList::remove(PipelineObserver* observer) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _observers.erase(std::remove(_observers.begin(), _observers.end(), observer), _observers.end());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,74 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace starrocks::pipeline {
+
+class PipelineDriverPoller;
+
+// PipelineObserver is notified when the source operator of a driver may become ready, e.g. the chunks arrive at
+// the exchange source. A driver blocked on INPUT_EMPTY by an observable source operator is parked in the poller,
+// and is checked again only after being notified, instead of calling has_output() in every polling round.
+class PipelineObserver {
+public:
+    PipelineObserver() = default;
+    PipelineObserver(const PipelineObserver&) = delete;
+    PipelineObserver& operator=(const PipelineObserver&) = delete;
+
+    // Invoked by any thread changing the state which the driver is blocked on.
+    void notify();
+
+    // Invoked by the poller before checking the driver.
+    // Return whether the driver is notified since the last invocation.
+    bool take_notification() { return _notified.exchange(false); }
+
+    // Invoked when the driver is added to the poller, which checks the driver at least once.
+    void attach_poller(PipelineDriverPoller* poller) {
+        _poller.store(poller);
+        _notified.store(true);
+    }
+
+private:
+    std::atomic<bool> _notified = true;
+    std::atomic<PipelineDriverPoller*> _poller = nullptr;
+};
+
+// The observers watching the state shared by several drivers, e.g. the sender queue of DataStreamRecvr.
+class PipelineObserverList {
+public:
+    void add(PipelineObserver* observer) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _observers.emplace_back(observer);
+    }
+
+    void remove(PipelineObserver* observer);
+
+    void notify_all() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto* observer : _observers) {
+            observer->notify();
+        }
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<PipelineObserver*> _observers;
+};
+
+} // namespace starrocks::pipeline
@@ -14,6 +14,8 @@
 
 #include "exec/pipeline/project_operator.h"
 
+#include <algorithm>
+
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
@@ -25,6 +27,13 @@ namespace starrocks::pipeline {
 Status ProjectOperator::prepare(RuntimeState* state) {
     _expr_compute_timer = ADD_TIMER(_unique_metrics, "ExprComputeTime");
     _common_sub_expr_compute_timer = ADD_TIMER(_unique_metrics, "CommonSubExprComputeTime");
+
+    // The expressions are evaluated on the rows filtered out by the selection as well, so they must neither fail
+    // nor have side effects on these rows. Only the column references and the constants are known to be safe,
+    // otherwise the driver compacts the chunk before pushing it.
+    auto is_safe = [](ExprContext* ctx) { return ctx->root()->is_slotref() || ctx->root()->is_constant(); };
+    _accept_chunk_selection = std::all_of(_expr_ctxs.begin(), _expr_ctxs.end(), is_safe) &&
+                              std::all_of(_common_sub_expr_ctxs.begin(), _common_sub_expr_ctxs.end(), is_safe);
     return Operator::prepare(state);
 }
 
@@ -44,10 +53,14 @@ Status ProjectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
         return Status::OK();
     }
     TRY_CATCH_ALLOC_SCOPE_START();
+    // The rows filtered out by the selection of the chunk are projected as well, the selection is passed to the
+    // expressions and kept in the output chunk.
+    DCHECK(!chunk->has_selection() || _accept_chunk_selection);
+    uint8_t* selection = chunk->has_selection() ? chunk->selection()->data() : nullptr;
     {
         SCOPED_TIMER(_common_sub_expr_compute_timer);
         for (size_t i = 0; i < _common_sub_column_ids.size(); ++i) {
-            ASSIGN_OR_RETURN(auto col, _common_sub_expr_ctxs[i]->evaluate(chunk.get()));
+            ASSIGN_OR_RETURN(auto col, _common_sub_expr_ctxs[i]->evaluate(chunk.get(), selection));
             chunk->append_column(std::move(col), _common_sub_column_ids[i]);
             RETURN_IF_HAS_ERROR(_common_sub_expr_ctxs);
         }
@@ -57,7 +70,7 @@ Status ProjectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
     {
         SCOPED_TIMER(_expr_compute_timer);
         for (size_t i = 0; i < _column_ids.size(); ++i) {
-            ASSIGN_OR_RETURN(result_columns[i], _expr_ctxs[i]->evaluate(chunk.get()));
+            ASSIGN_OR_RETURN(result_columns[i], _expr_ctxs[i]->evaluate(chunk.get(), selection));
 
             if (result_columns[i]->only_null()) {
                 result_columns[i] = ColumnHelper::create_column(_expr_ctxs[i]->root()->type(), true);
@@ -86,6 +99,9 @@ Status ProjectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
         _cur_chunk->append_column(result_columns[i], _column_ids[i]);
     }
     _cur_chunk->owner_info() = chunk->owner_info();
+    if (!result_columns.empty()) {
+        _cur_chunk->set_selection(chunk->selection());
+    }
     TRY_CATCH_ALLOC_SCOPE_END()
     return Status::OK();
 }
@@ -43,6 +43,9 @@ public:
 
     bool need_input() const override { return !_is_finished && _cur_chunk == nullptr; }
 
+    // Only the projections safe to evaluate on the rows filtered out by the selection accept it, see prepare().
+    bool accept_chunk_selection() const override { return _accept_chunk_selection; }
+
     bool is_finished() const override { return _is_finished && _cur_chunk == nullptr; }
 
     bool ignore_empty_eos() const override { return false; }
@@ -67,6 +70,7 @@ private:
     const std::vector<ExprContext*>& _common_sub_expr_ctxs;
 
     bool _is_finished = false;
+    bool _accept_chunk_selection = false;
     ChunkPtr _cur_chunk = nullptr;
 
     RuntimeProfile::Counter* _expr_compute_timer = nullptr;
@@ -15,9 +15,11 @@
 #include "exec/pipeline/query_context.h"
 
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "agent/master_info.h"
+#include "exec/iceberg/iceberg_delete_cache.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/pipeline/scan/connector_scan_operator.h"
@@ -29,6 +31,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/query_statistics.h"
 #include "runtime/runtime_filter_cache.h"
+#include "testutil/sync_point.h"
 #include "util/thread.h"
 
 namespace starrocks::pipeline {
@@ -59,6 +62,8 @@ QueryContext::~QueryContext() noexcept {
     {
         SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker.get());
         _fragment_mgr.reset();
+        // the cached delete files are accounted to the query-level MemTracker
+        _iceberg_delete_cache.reset();
     }
 
     // Accounting memory usage during QueryContext's destruction should not use query-level MemTracker, but its released
@@ -171,6 +176,12 @@ Status QueryContext::init_spill_manager(const TQueryOptions& query_options) {
     return st;
 }
 
+IcebergDeleteCache* QueryContext::iceberg_delete_cache() {
+    std::call_once(_init_iceberg_delete_cache_once,
+                   [this]() { _iceberg_delete_cache = std::make_unique<IcebergDeleteCache>(_mem_tracker.get()); });
+    return _iceberg_delete_cache.get();
+}
+
 Status QueryContext::init_query_once(workgroup::WorkGroup* wg, bool enable_group_level_query_queue) {
     Status st = Status::OK();
     if (wg != nullptr) {
@@ -189,6 +200,32 @@ Status QueryContext::init_query_once(workgroup::WorkGroup* wg, bool enable_group
     return st;
 }
 
+void QueryContext::init_admission_once(int64_t estimated_mem_bytes) {
+    std::call_once(_admission_once, [this, estimated_mem_bytes]() {
+        const int64_t max_wait_ms = config::query_admission_max_wait_ms;
+        if (max_wait_ms <= 0) {
+            return;
+        }
+        _admission_mem_bytes = estimated_mem_bytes;
+        _admission_deadline_ns = MonotonicNanos() + max_wait_ms * 1'000'000L;
+        _admitted.store(false, std::memory_order_release);
+    });
+}
+
+bool QueryContext::try_admit(workgroup::WorkGroup* wg) {
+    if (_admitted.load(std::memory_order_acquire)) {
+        return true;
+    }
+    bool admitted = wg == nullptr || wg->can_admit_query(_admission_mem_bytes);
+    TEST_SYNC_POINT_CALLBACK("QueryContext::try_admit::can_admit", &admitted);
+    // The query starts anyway when the wait expires, so the queries arriving in a burst are shaped, not rejected.
+    if (admitted || MonotonicNanos() >= _admission_deadline_ns) {
+        _admitted.store(true, std::memory_order_release);
+        return true;
+    }
+    return false;
+}
+
 void QueryContext::release_workgroup_token_once() {
     auto* old = _wg_running_query_token_atomic_ptr.load();
     if (old != nullptr && _wg_running_query_token_atomic_ptr.compare_exchange_strong(old, nullptr)) {
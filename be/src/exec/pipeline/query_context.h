@@ -36,6 +36,7 @@
 
 namespace starrocks {
 
+class IcebergDeleteCache;
 class StreamEpochManager;
 
 namespace pipeline {
@@ -166,6 +167,11 @@ public:
 
     Status init_spill_manager(const TQueryOptions& query_options);
     Status init_query_once(workgroup::WorkGroup* wg, bool enable_group_level_query_queue);
+    /// Start the admission of the query, which lasts at most config::query_admission_max_wait_ms. No thread waits
+    /// for it: the drivers of a query not admitted yet are parked in the poller as PRECONDITION_BLOCK.
+    void init_admission_once(int64_t estimated_mem_bytes);
+    /// Whether `wg` can admit the query now, or the query has waited long enough. Once admitted, it stays admitted.
+    bool try_admit(workgroup::WorkGroup* wg);
     /// Release the workgroup token only once to avoid double-free.
     /// This method should only be invoked while the QueryContext is still valid,
     /// to avoid double-free between the destruction and this method.
@@ -194,6 +200,8 @@ public:
     int64_t get_scan_bytes() const { return _total_scan_bytes; }
     std::atomic_int64_t* mutable_total_spill_bytes() { return &_total_spill_bytes; }
     int64_t get_spill_bytes() { return _total_spill_bytes; }
+    // The bytes being prefetched into datacache by the scans of the query.
+    std::atomic_int64_t* mutable_datacache_prefetch_bytes() { return &_datacache_prefetch_bytes; }
 
     // Query start time, used to check how long the query has been running
     // To ensure that the minimum run time of the query will not be killed by the big query checking mechanism
@@ -223,6 +231,9 @@ public:
 
     spill::QuerySpillManager* spill_manager() { return _spill_manager.get(); }
 
+    // The iceberg delete files shared by the scanners of the query, created on first use.
+    IcebergDeleteCache* iceberg_delete_cache();
+
     void mark_prepared() { _is_prepared = true; }
     bool is_prepared() { return _is_prepared; }
 
@@ -265,12 +276,17 @@ private:
     std::atomic_bool _is_prepared = false;
 
     std::once_flag _init_query_once;
+    std::once_flag _admission_once;
+    std::atomic<bool> _admitted = true;
+    int64_t _admission_mem_bytes = 0;
+    int64_t _admission_deadline_ns = 0;
     int64_t _query_begin_time = 0;
     std::once_flag _init_spill_manager_once;
     std::atomic<int64_t> _total_cpu_cost_ns = 0;
     std::atomic<int64_t> _total_scan_rows_num = 0;
     std::atomic<int64_t> _total_scan_bytes = 0;
     std::atomic<int64_t> _total_spill_bytes = 0;
+    std::atomic<int64_t> _datacache_prefetch_bytes = 0;
     std::atomic<int64_t> _delta_cpu_cost_ns = 0;
     std::atomic<int64_t> _delta_scan_rows_num = 0;
     std::atomic<int64_t> _delta_scan_bytes = 0;
@@ -300,6 +316,9 @@ private:
 
     std::unique_ptr<spill::QuerySpillManager> _spill_manager;
 
+    std::once_flag _init_iceberg_delete_cache_once;
+    std::unique_ptr<IcebergDeleteCache> _iceberg_delete_cache;
+
     int64_t _static_query_mem_limit = 0;
     ConnectorScanOperatorMemShareArbitrator* _connector_scan_operator_mem_share_arbitrator = nullptr;
 };
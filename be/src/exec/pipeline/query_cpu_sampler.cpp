@@ -0,0 +1,186 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/query_cpu_sampler.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "util/thread.h"
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+QueryCpuSampler* QueryCpuSampler::instance() {
+    static QueryCpuSampler sampler;
+    return &sampler;
+}
+
+void QueryCpuSampler::start() {
+    std::lock_guard<std::mutex> l(_thread_mutex);
+    if (!_stopped) {
+        return;
+    }
+    _stopped = false;
+    _thread = std::thread([this] { _run(); });
+    Thread::set_thread_name(_thread, "query_cpu_sampler");
+}
+
+void QueryCpuSampler::stop() {
+    {
+        std::lock_guard<std::mutex> l(_thread_mutex);
+        if (_stopped) {
+            return;
+        }
+        _stopped = true;
+    }
+    _cv.notify_all();
+    _thread.join();
+}
+
+void QueryCpuSampler::_run() {
+    LOG(INFO) << "QueryCpuSampler start working.";
+    std::unique_lock<std::mutex> l(_thread_mutex);
+    while (!_stopped) {
+        const int64_t interval_ms = std::max(config::query_cpu_sampler_interval_ms, 1);
+        _cv.wait_for(l, std::chrono::milliseconds(interval_ms), [this] { return _stopped; });
+        if (_stopped) {
+            break;
+        }
+        if (config::enable_query_cpu_sampler) {
+            l.unlock();
+            sample(UnixMillis());
+            l.lock();
+        }
+    }
+    LOG(INFO) << "QueryCpuSampler going to exit.";
+}
+
+int32_t QueryCpuSampler::name_id(const std::string& name) {
+    std::lock_guard<std::mutex> l(_names_mutex);
+    auto [it, inserted] = _name_ids.try_emplace(name, static_cast<int32_t>(_names.size()));
+    if (inserted) {
+        _names.emplace_back(name);
+    }
+    return it->second;
+}
+
+QueryCpuSampler::ThreadSlot::ThreadSlot() : slot(std::make_shared<Slot>()) {
+    auto* sampler = instance();
+    std::lock_guard<std::mutex> l(sampler->_slots_mutex);
+    sampler->_slots.emplace_back(slot);
+}
+
+QueryCpuSampler::Slot* QueryCpuSampler::_current_slot() {
+    static thread_local ThreadSlot thread_slot;
+    return thread_slot.slot.get();
+}
+
+void QueryCpuSampler::set_current(const TUniqueId& query_id, int32_t plan_node_id, int32_t name_id) {
+    Slot* slot = _current_slot();
+    const uint64_t version = slot->version.load(std::memory_order_relaxed);
+    slot->version.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot->query_hi.store(query_id.hi, std::memory_order_relaxed);
+    slot->query_lo.store(query_id.lo, std::memory_order_relaxed);
+    slot->plan_node_id.store(plan_node_id, std::memory_order_relaxed);
+    slot->name_id.store(name_id, std::memory_order_relaxed);
+    slot->version.store(version + 2, std::memory_order_release);
+}
+
+void QueryCpuSampler::clear_current() {
+    _current_slot()->name_id.store(-1, std::memory_order_relaxed);
+}
+
+void QueryCpuSampler::sample(int64_t now_ms) {
+    std::vector<std::shared_ptr<Slot>> slots;
+    {
+        std::lock_guard<std::mutex> l(_slots_mutex);
+        // the slots only referred here belong to the threads which have exited
+        std::erase_if(_slots, [](const auto& slot) { return slot.use_count() == 1; });
+        slots = _slots;
+    }
+
+    std::vector<SampleKey> keys;
+    for (const auto& slot : slots) {
+        const uint64_t version = slot->version.load(std::memory_order_acquire);
+        if (version & 1) {
+            continue;
+        }
+        SampleKey key{slot->query_hi.load(std::memory_order_relaxed), slot->query_lo.load(std::memory_order_relaxed),
+                      slot->plan_node_id.load(std::memory_order_relaxed),
+                      slot->name_id.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (key.name_id < 0 || slot->version.load(std::memory_order_relaxed) != version) {
+            continue;
+        }
+        keys.emplace_back(key);
+    }
+
+    const int64_t minute = now_ms / 60000;
+    std::lock_guard<std::mutex> l(_buckets_mutex);
+    if (_buckets.empty() || _buckets.back().minute != minute) {
+        _buckets.push_back(Bucket{minute, {}});
+    }
+    while (_buckets.front().minute <= minute - std::max(config::query_cpu_sampler_retention_minutes, 1)) {
+        _buckets.pop_front();
+    }
+    for (const auto& key : keys) {
+        _buckets.back().samples[key]++;
+    }
+}
+
+std::vector<QueryCpuSampler::QuerySamples> QueryCpuSampler::top_queries(int64_t minutes, size_t limit) const {
+    // (query_id.hi, query_id.lo) => (plan_node_id, name_id) => samples
+    phmap::flat_hash_map<std::pair<int64_t, int64_t>, phmap::flat_hash_map<std::pair<int32_t, int32_t>, int64_t>>
+            query_samples;
+    {
+        const int64_t since_minute = UnixMillis() / 60000 - minutes;
+        std::lock_guard<std::mutex> l(_buckets_mutex);
+        for (const auto& bucket : _buckets) {
+            if (bucket.minute <= since_minute) {
+                continue;
+            }
+            for (const auto& [key, samples] : bucket.samples) {
+                query_samples[{key.query_hi, key.query_lo}][{key.plan_node_id, key.name_id}] += samples;
+            }
+        }
+    }
+
+    std::vector<QuerySamples> queries;
+    queries.reserve(query_samples.size());
+    {
+        std::lock_guard<std::mutex> l(_names_mutex);
+        for (const auto& [query_key, operators] : query_samples) {
+            QuerySamples query{{}, 0, {}};
+            query.query_id.__set_hi(query_key.first);
+            query.query_id.__set_lo(query_key.second);
+            for (const auto& [op, samples] : operators) {
+                query.samples += samples;
+                query.operators.push_back(OperatorSamples{op.first, _names[op.second], samples});
+            }
+            std::sort(query.operators.begin(), query.operators.end(),
+                      [](const auto& a, const auto& b) { return a.samples > b.samples; });
+            queries.emplace_back(std::move(query));
+        }
+    }
+    std::sort(queries.begin(), queries.end(), [](const auto& a, const auto& b) { return a.samples > b.samples; });
+    if (queries.size() > limit) {
+        queries.resize(limit);
+    }
+    return queries;
+}
+
+} // namespace starrocks::pipeline
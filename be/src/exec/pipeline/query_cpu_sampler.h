@@ -0,0 +1,123 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gen_cpp/Types_types.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks::pipeline {
+
+// Attributes the cpu time of the pipeline engine to queries and operators by sampling. The pipeline drivers publish
+// the operator they are running in a slot of their worker thread, and a background thread looks at all the slots
+// every config::query_cpu_sampler_interval_ms, so a query is charged about one interval for each sample of it. The
+// samples of the last config::query_cpu_sampler_retention_minutes minutes are kept, by minute.
+class QueryCpuSampler {
+public:
+    static QueryCpuSampler* instance();
+
+    void start();
+    void stop();
+
+    // Returns the id of an operator name, which is published instead of the name.
+    int32_t name_id(const std::string& name);
+
+    // Tells that the current thread is running the operator `name_id` of the plan node `plan_node_id` of the query.
+    static void set_current(const TUniqueId& query_id, int32_t plan_node_id, int32_t name_id);
+    // Tells that the current thread is not running any operator.
+    static void clear_current();
+
+    struct OperatorSamples {
+        int32_t plan_node_id;
+        std::string name;
+        int64_t samples;
+    };
+    struct QuerySamples {
+        TUniqueId query_id;
+        int64_t samples;
+        // in descending order of samples
+        std::vector<OperatorSamples> operators;
+    };
+    // Returns at most `limit` queries of the most samples in the last `minutes` minutes, in descending order.
+    std::vector<QuerySamples> top_queries(int64_t minutes, size_t limit) const;
+
+    // Takes a sample of all the threads at `now_ms`, called by the background thread, and by tests.
+    void sample(int64_t now_ms);
+
+private:
+    // Written by its thread only, `version` is odd while it is being written. The background thread drops the
+    // sample of a slot which changes while it reads it.
+    struct Slot {
+        std::atomic<uint64_t> version = 0;
+        std::atomic<int64_t> query_hi = 0;
+        std::atomic<int64_t> query_lo = 0;
+        std::atomic<int32_t> plan_node_id = 0;
+        // -1 if the thread is not running any operator
+        std::atomic<int32_t> name_id = -1;
+    };
+    struct ThreadSlot {
+        ThreadSlot();
+        std::shared_ptr<Slot> slot;
+    };
+    static Slot* _current_slot();
+
+    struct SampleKey {
+        int64_t query_hi;
+        int64_t query_lo;
+        int32_t plan_node_id;
+        int32_t name_id;
+
+        bool operator==(const SampleKey& other) const {
+            return query_hi == other.query_hi && query_lo == other.query_lo && plan_node_id == other.plan_node_id &&
+                   name_id == other.name_id;
+        }
+    };
+    struct SampleKeyHash {
+        size_t operator()(const SampleKey& key) const {
+            return phmap::HashState().combine(0, key.query_hi, key.query_lo, key.plan_node_id, key.name_id);
+        }
+    };
+    struct Bucket {
+        int64_t minute;
+        phmap::flat_hash_map<SampleKey, int64_t, SampleKeyHash> samples;
+    };
+
+    void _run();
+
+    mutable std::mutex _slots_mutex;
+    std::vector<std::shared_ptr<Slot>> _slots;
+
+    mutable std::mutex _names_mutex;
+    phmap::flat_hash_map<std::string, int32_t> _name_ids;
+    std::vector<std::string> _names;
+
+    mutable std::mutex _buckets_mutex;
+    std::deque<Bucket> _buckets;
+
+    std::mutex _thread_mutex;
+    std::condition_variable _cv;
+    bool _stopped = true;
+    std::thread _thread;
+};
+
+} // namespace starrocks::pipeline
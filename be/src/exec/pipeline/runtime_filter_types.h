@@ -448,6 +448,19 @@ public:
                     break;
                 }
             }
+            // a dense integer key of a local filter is kept by an exact bitset, which is cheaper to probe
+            auto* filter = desc->runtime_filter();
+            if (filter != nullptr && !desc->has_remote_targets() &&
+                RuntimeFilterHelper::init_runtime_filter_bitset(desc->build_expr_type(), filter, row_count)) {
+                for (auto& opt_params : _partial_bloom_filter_build_params) {
+                    auto& param = opt_params[i].value();
+                    if (param.column == nullptr || param.column->empty()) {
+                        continue;
+                    }
+                    RuntimeFilterHelper::fill_runtime_filter_bitset(param.column, desc->build_expr_type(), filter,
+                                                                    kHashJoinKeyColumnOffset);
+                }
+            }
         }
         return Status::OK();
     }
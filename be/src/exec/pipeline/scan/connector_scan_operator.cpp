@@ -765,7 +765,7 @@ Status ConnectorChunkSource::_open_data_source(RuntimeState* state, bool* mem_al
     if (!_data_source->has_any_predicate() && _limit != -1 && _limit < state->chunk_size()) {
         _ck_acc.set_max_size(_limit);
     } else {
-        _ck_acc.set_max_size(state->chunk_size());
+        _ck_acc.set_max_size(_scan_op->target_chunk_size(state));
     }
 
     _opened = true;
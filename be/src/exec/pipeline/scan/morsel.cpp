@@ -18,6 +18,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/olap_utils.h"
 #include "storage/chunk_helper.h"
@@ -28,6 +29,7 @@
 #include "storage/storage_engine.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_reader_params.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
@@ -231,12 +233,34 @@ void PhysicalSplitMorselQueue::set_key_ranges(TabletReaderParams::RangeStartOper
     _range_end_key = range_end_key;
 }
 
+/// SplitMorselQueue.
+int64_t SplitMorselQueue::_next_splitted_scan_rows() {
+    const int64_t max_ratio = config::tablet_internal_parallel_adaptive_split_max_ratio;
+    if (max_ratio <= 1) {
+        return _splitted_scan_rows;
+    }
+    if (_num_total_rows < 0) {
+        _num_total_rows = 0;
+        for (const auto& tablet : _tablets) {
+            _num_total_rows += tablet->num_rows();
+        }
+    }
+    // Each split takes a share of the rest rows, so the first splits are large to reduce the overhead per split,
+    // and the last ones, which decide when the scan operators finish, are small.
+    const int64_t rest_rows = std::max<int64_t>(_num_total_rows - _num_taken_rows, 0);
+    const int64_t rows = rest_rows / std::max<int64_t>(_degree_of_parallelism * 2, 1);
+    return std::clamp<int64_t>(rows, _splitted_scan_rows, _splitted_scan_rows * max_ratio);
+}
+
+/// PhysicalSplitMorselQueue.
 StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_single_tablet() {
+    const int64_t splitted_scan_rows = _next_splitted_scan_rows();
     size_t num_taken_rows = 0;
     RowidRangeOptionPtr rowid_range = nullptr;
     auto has_taken_from_tablet = [&rowid_range]() { return rowid_range != nullptr; };
 
-    while (num_taken_rows < _splitted_scan_rows) {
+    DeferOp add_taken_rows([this, &num_taken_rows]() { _num_taken_rows += num_taken_rows; });
+    while (num_taken_rows < splitted_scan_rows) {
         if (_tablet_idx >= _tablets.size()) {
             return rowid_range;
         }
@@ -268,7 +292,7 @@ StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_sing
         }
 
         SparseRange<> taken_range;
-        _segment_range_iter.next_range(_splitted_scan_rows, &taken_range);
+        _segment_range_iter.next_range(splitted_scan_rows, &taken_range);
         _num_segment_rest_rows -= taken_range.span_size();
         if (_num_segment_rest_rows < _splitted_scan_rows) {
             // If there are too few rows left in the segment, take them all this time.
@@ -515,6 +539,12 @@ StatusOr<MorselPtr> LogicalSplitMorselQueue::try_get() {
         RETURN_IF_ERROR(_init_tablet());
     }
 
+    // The rows per block of the tablet are estimated by its largest rowset.
+    const int64_t num_tablet_rows = std::max<int64_t>(_tablets[_tablet_idx]->num_rows(), 1);
+    const int64_t num_tablet_blocks = _segment_group->num_blocks();
+    _sample_splitted_scan_blocks =
+            std::max<int64_t>(_next_splitted_scan_rows() * num_tablet_blocks / num_tablet_rows, 1);
+
     // Take sub key ranges from each key range, until the number of taken blocks is greater than
     // `_sample_splitted_scan_blocks`.
     //
@@ -608,6 +638,8 @@ StatusOr<MorselPtr> LogicalSplitMorselQueue::try_get() {
             scan_morsel->get_plan_node_id(), *(scan_morsel->get_scan_range()),
             std::make_shared<ShortKeyRangesOption>(std::move(short_key_ranges), _is_first_split_of_tablet));
     _is_first_split_of_tablet = false;
+    _num_taken_rows +=
+            static_cast<int64_t>(num_taken_blocks) * num_tablet_rows / std::max<int64_t>(num_tablet_blocks, 1);
     morsel->set_rowsets(_tablet_rowsets[_tablet_idx]);
     _inc_split(_is_last_split_of_current_morsel());
     return morsel;
@@ -768,9 +800,6 @@ Status LogicalSplitMorselQueue::_init_tablet() {
 
     _short_key_schema =
             std::make_shared<Schema>(ChunkHelper::get_short_key_schema(_tablets[_tablet_idx]->tablet_schema()));
-    _sample_splitted_scan_blocks =
-            _splitted_scan_rows * _segment_group->num_blocks() / _tablets[_tablet_idx]->num_rows();
-    _sample_splitted_scan_blocks = std::max<int64_t>(_sample_splitted_scan_blocks, 1);
 
     if (_tablet_seek_ranges.empty()) {
         _block_ranges_per_seek_range.emplace_back(_segment_group->begin(), _segment_group->end());
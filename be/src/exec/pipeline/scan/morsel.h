@@ -419,6 +419,8 @@ public:
     Type type() const override { return SPLIT; }
 
 protected:
+    // The number of rows to take for the next split, see config::tablet_internal_parallel_adaptive_split_max_ratio.
+    int64_t _next_splitted_scan_rows();
     void _inc_split(bool is_last_split) {
         if (_ticket_checker == nullptr) {
             return;
@@ -433,6 +435,9 @@ protected:
     const int64_t _degree_of_parallelism;
     // The minimum number of rows picked up from a segment at one time.
     const int64_t _splitted_scan_rows;
+    // The estimated rows of all the tablets and of the splits taken so far.
+    int64_t _num_total_rows = -1;
+    int64_t _num_taken_rows = 0;
 
     std::atomic<size_t> _tablet_idx = 0;
     query_cache::TicketCheckerPtr _ticket_checker;
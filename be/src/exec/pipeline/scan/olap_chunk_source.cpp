@@ -14,13 +14,19 @@
 
 #include "exec/pipeline/scan/olap_chunk_source.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <sstream>
 #include <string_view>
 #include <unordered_map>
 
 #include "column/column.h"
 #include "column/column_access_path.h"
 #include "column/field.h"
+#include "column/fixed_length_column.h"
 #include "common/status.h"
 #include "exec/olap_scan_node.h"
 #include "exec/olap_scan_prepare.h"
@@ -43,6 +49,7 @@
 #include "storage/tablet_index.h"
 #include "types/logical_type.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -60,8 +67,19 @@ OlapChunkSource::~OlapChunkSource() {
 }
 
 void OlapChunkSource::close(RuntimeState* state) {
+    if (_shared_scan != nullptr) {
+        if (_shared_scan_follower_id >= 0) {
+            _shared_scan->detach(_shared_scan_follower_id);
+        } else {
+            // No effect if the leader has reached the end of the tablet.
+            _shared_scan->abort();
+        }
+        _shared_scan.reset();
+    }
     if (_reader) {
         _update_counter();
+    } else if (_rows_read_counter != nullptr) {
+        COUNTER_UPDATE(_rows_read_counter, _num_rows_read);
     }
     if (_prj_iter) {
         _prj_iter->close();
@@ -131,13 +149,22 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
     _bi_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "BitmapIndexFilter", segment_init_name);
     _bi_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "BitmapIndexFilterRows", TUnit::UNIT, segment_init_name);
     _bf_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "BloomFilterFilterRows", TUnit::UNIT, segment_init_name);
+    _ngram_bf_pages_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "NgramBloomFilterPages", TUnit::UNIT, segment_init_name);
+    _ngram_bf_filtered_pages_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "NgramBloomFilterFilterPages", TUnit::UNIT, segment_init_name);
     _gin_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "GinFilterRows", TUnit::UNIT, segment_init_name);
     _gin_filtered_timer = ADD_CHILD_TIMER(_runtime_profile, "GinFilter", segment_init_name);
+    _vector_index_filtered_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "VectorIndexFilterRows", TUnit::UNIT, segment_init_name);
+    _vector_index_filtered_timer = ADD_CHILD_TIMER(_runtime_profile, "VectorIndexFilter", segment_init_name);
     _seg_zm_filtered_counter =
             ADD_CHILD_COUNTER_SKIP_MIN_MAX(_runtime_profile, "SegmentZoneMapFilterRows", TUnit::UNIT,
                                            _get_counter_min_max_type("SegmentZoneMapFilterRows"), segment_init_name);
     _seg_rt_filtered_counter =
             ADD_CHILD_COUNTER(_runtime_profile, "SegmentRuntimeZoneMapFilterRows", TUnit::UNIT, segment_init_name);
+    _seg_rt_filtered_segments_counter = ADD_CHILD_COUNTER(_runtime_profile, "SegmentRuntimeZoneMapFilterSegments",
+                                                          TUnit::UNIT, segment_init_name);
     _zm_filtered_counter =
             ADD_CHILD_COUNTER(_runtime_profile, "ZoneMapIndexFilterRows", TUnit::UNIT, segment_init_name);
     _sk_filtered_counter =
@@ -152,6 +179,11 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
     _rows_key_range_counter =
             ADD_CHILD_COUNTER(_runtime_profile, "ShortKeyRangeNumber", TUnit::UNIT, segment_init_name);
     _bf_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "BloomFilterFilter", segment_init_name);
+    _index_prefetch_wait_timer = ADD_CHILD_TIMER(_runtime_profile, "IndexPrefetchWait", segment_init_name);
+    _index_prefetch_io_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "IndexPrefetchIOCount", TUnit::UNIT, segment_init_name);
+    _index_prefetch_io_bytes =
+            ADD_CHILD_COUNTER(_runtime_profile, "IndexPrefetchIOBytes", TUnit::BYTES, segment_init_name);
 
     // SegmentRead
     const std::string segment_read_name = "SegmentRead";
@@ -191,7 +223,7 @@ void OlapChunkSource::_decide_chunk_size(bool has_predicate) {
         // Improve for select * from table limit x, x is small
         _params.chunk_size = _limit;
     } else {
-        _params.chunk_size = _runtime_state->chunk_size();
+        _params.chunk_size = _scan_op->target_chunk_size(_runtime_state);
     }
 }
 
@@ -214,6 +246,9 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
     if (thrift_olap_scan_node.__isset.enable_gin_filter) {
         _params.enable_gin_filter = thrift_olap_scan_node.enable_gin_filter;
     }
+    if (thrift_olap_scan_node.__isset.vector_search_options) {
+        RETURN_IF_ERROR(_init_vector_search_option(thrift_olap_scan_node.vector_search_options));
+    }
     if (thrift_olap_scan_node.__isset.sorted_by_keys_per_tablet) {
         _params.sorted_by_keys_per_tablet = thrift_olap_scan_node.sorted_by_keys_per_tablet;
     }
@@ -399,10 +434,6 @@ Status OlapChunkSource::_prune_schema_by_access_paths(Schema* schema) {
 
 Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     const TOlapScanNode& thrift_olap_scan_node = _scan_node->thrift_olap_scan_node();
-    // output columns of `this` OlapScanner, i.e, the final output columns of `get_chunk`.
-    std::vector<uint32_t> scanner_columns;
-    // columns fetched from |_reader|.
-    std::vector<uint32_t> reader_columns;
 
     RETURN_IF_ERROR(_get_tablet(_scan_range));
 
@@ -421,28 +452,17 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
 
     RETURN_IF_ERROR(_init_global_dicts(&_params));
     RETURN_IF_ERROR(_init_unused_output_columns(thrift_olap_scan_node.unused_output_column_name));
-    RETURN_IF_ERROR(_init_scanner_columns(scanner_columns));
-    RETURN_IF_ERROR(_init_reader_params(_scan_ctx->key_ranges(), scanner_columns, reader_columns));
+    RETURN_IF_ERROR(_init_scanner_columns(_scanner_columns));
+    RETURN_IF_ERROR(_init_reader_params(_scan_ctx->key_ranges(), _scanner_columns, _reader_columns));
 
     // schema is new object, but fields not
-    starrocks::Schema child_schema = ChunkHelper::convert_schema(_tablet_schema, reader_columns);
-    RETURN_IF_ERROR(_init_column_access_paths(&child_schema));
+    _reader_schema = ChunkHelper::convert_schema(_tablet_schema, _reader_columns);
+    RETURN_IF_ERROR(_init_column_access_paths(&_reader_schema));
     // will modify schema field, need to copy schema
-    RETURN_IF_ERROR(_prune_schema_by_access_paths(&child_schema));
+    RETURN_IF_ERROR(_prune_schema_by_access_paths(&_reader_schema));
 
-    std::vector<RowsetSharedPtr> rowsets;
     for (auto& rowset : _morsel->rowsets()) {
-        rowsets.emplace_back(std::dynamic_pointer_cast<Rowset>(rowset));
-    }
-
-    _reader = std::make_shared<TabletReader>(_tablet, Version(_morsel->from_version(), _version),
-                                             std::move(child_schema), std::move(rowsets), &_tablet_schema);
-    _reader->set_use_gtid(_morsel->get_olap_scan_range()->__isset.gtid);
-    if (reader_columns.size() == scanner_columns.size()) {
-        _prj_iter = _reader;
-    } else {
-        starrocks::Schema output_schema = ChunkHelper::convert_schema(_tablet_schema, scanner_columns);
-        _prj_iter = new_projection_iterator(output_schema, _reader);
+        _reader_rowsets.emplace_back(std::dynamic_pointer_cast<Rowset>(rowset));
     }
 
     if (!_scan_ctx->not_push_down_conjuncts().empty() || !_non_pushdown_pred_tree.empty()) {
@@ -459,6 +479,31 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
         }
     }
 
+    if (_can_share_scan()) {
+        RETURN_IF_ERROR(_init_shared_scan());
+        if (_shared_scan_follower_id >= 0) {
+            // The follower reads the chunks of the leader, and creates its own reader only when falling back.
+            return Status::OK();
+        }
+    } else if (_can_late_materialize()) {
+        _init_late_materialization();
+    }
+
+    return _open_reader();
+}
+
+Status OlapChunkSource::_open_reader() {
+    _reader = std::make_shared<TabletReader>(_tablet, Version(_morsel->from_version(), _version),
+                                             std::move(_reader_schema), std::move(_reader_rowsets), &_tablet_schema);
+    _reader->set_use_gtid(_morsel->get_olap_scan_range()->__isset.gtid);
+    const auto& output_columns = _lazy_columns.empty() ? _scanner_columns : _eager_columns;
+    if (_reader_columns.size() == output_columns.size()) {
+        _prj_iter = _reader;
+    } else {
+        starrocks::Schema output_schema = ChunkHelper::convert_schema(_tablet_schema, output_columns);
+        _prj_iter = new_projection_iterator(output_schema, _reader);
+    }
+
     DCHECK(_params.global_dictmaps != nullptr);
     RETURN_IF_ERROR(_prj_iter->init_encoded_schema(*_params.global_dictmaps));
     RETURN_IF_ERROR(_prj_iter->init_output_schema(*_params.unused_output_column_ids));
@@ -467,10 +512,279 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     RETURN_IF_ERROR(_reader->prepare());
     RETURN_IF_ERROR(_reader->open(_params));
 
+    if (!_lazy_columns.empty()) {
+        _row_id_fetcher =
+                std::make_unique<RowIdFetcher>(_tablet_schema, _reader->row_id_segments(), _params.use_page_cache);
+        // Keep the order of the output columns as without late materialization.
+        Fields fields = _prj_iter->output_schema().fields();
+        fields.insert(fields.end(), _lazy_schema.fields().begin(), _lazy_schema.fields().end());
+        std::sort(fields.begin(), fields.end(), [](const auto& lhs, const auto& rhs) { return lhs->id() < rhs->id(); });
+        _late_materialized_schema = Schema(std::move(fields));
+    }
+
+    return Status::OK();
+}
+
+Status OlapChunkSource::_init_vector_search_option(const TVectorSearchOptions& options) {
+    const int32_t index = _tablet_schema->field_index(options.vector_column_name);
+    if (index < 0) {
+        return Status::InvalidArgument("Unknown vector search column: " + options.vector_column_name);
+    }
+    auto option = std::make_shared<VectorSearchOption>();
+    option->column_unique_id = _tablet_schema->column(index).unique_id();
+    option->query_vector.assign(options.query_vector.begin(), options.query_vector.end());
+    option->k = options.limit_k;
+    option->nprobe = options.__isset.nprobe ? options.nprobe : 0;
+    _params.vector_search_option = std::move(option);
+    return Status::OK();
+}
+
+bool OlapChunkSource::_can_share_scan() {
+    if (!config::enable_scan_sharing) {
+        return false;
+    }
+    // Each query reads its own top-k rows of the vector search.
+    if (_params.vector_search_option != nullptr) {
+        return false;
+    }
+    // The split morsels only read a part of the tablet.
+    if (dynamic_cast<PhysicalSplitScanMorsel*>(_morsel.get()) != nullptr ||
+        dynamic_cast<LogicalSplitScanMorsel*>(_morsel.get()) != nullptr) {
+        return false;
+    }
+    // The runtime filters arriving later are pushed down to the reader of each query.
+    if (!_scan_ctx->conjuncts_manager().unarrived_runtime_filters().unarrived_runtime_filters.empty()) {
+        return false;
+    }
+    // The global dicts, column access paths and unused output columns change the chunks output by the reader.
+    return _params.global_dictmaps->empty() && _column_access_paths.empty() && _unused_output_column_ids.empty();
+}
+
+// The chunks output by the reader are decided by the rowsets, the columns, the pushdown predicates and key ranges,
+// and the ordering options.
+std::string OlapChunkSource::_shared_scan_key() const {
+    std::stringstream ss;
+    ss << _tablet->tablet_id() << "@" << _morsel->from_version() << "-" << _version << ";rowsets=";
+    for (const auto& rowset : _reader_rowsets) {
+        ss << rowset->rowset_id_str() << ",";
+    }
+    ss << ";columns=";
+    for (uint32_t cid : _reader_columns) {
+        const auto& column = _tablet_schema->column(cid);
+        ss << cid << ":" << column.unique_id() << ":" << column.name() << ":" << static_cast<int>(column.type()) << ",";
+    }
+    ss << ";output=";
+    for (uint32_t cid : _scanner_columns) {
+        ss << cid << ",";
+    }
+    ss << ";options=" << _params.skip_aggregation << _params.use_pk_index << _params.sorted_by_keys_per_tablet
+       << _params.prune_column_after_index_filter << _params.enable_gin_filter << _scan_op->is_asc()
+       << _morsel->get_olap_scan_range()->__isset.gtid;
+    ss << ";ranges=" << static_cast<int>(_params.range) << "," << static_cast<int>(_params.end_range);
+    for (size_t i = 0; i < _params.start_key.size(); i++) {
+        ss << "[" << _params.start_key[i] << "|" << _params.end_key[i] << "]";
+    }
+    ss << ";predicates=" << _params.pred_tree.visit([](const auto& node) { return node.debug_string(); });
+    return ss.str();
+}
+
+Status OlapChunkSource::_init_shared_scan() {
+    _shared_scan =
+            SharedTabletScanManager::instance()->attach_or_create(_shared_scan_key(), &_shared_scan_follower_id);
+    if (_shared_scan_follower_id >= 0) {
+        _shared_scan_last_chunk_ns = MonotonicNanos();
+    }
+    _runtime_profile->add_info_string("SharedScan", "true");
+    _shared_scan_published_chunks = ADD_COUNTER(_runtime_profile, "SharedScanPublishedChunks", TUnit::UNIT);
+    _shared_scan_consumed_chunks = ADD_COUNTER(_runtime_profile, "SharedScanConsumedChunks", TUnit::UNIT);
+    _shared_scan_fallbacks = ADD_COUNTER(_runtime_profile, "SharedScanFallbacks", TUnit::UNIT);
+    return Status::OK();
+}
+
+Status OlapChunkSource::_read_chunk_from_shared_scan(RuntimeState* state, ChunkPtr* chunk) {
+    // Wait for the leader shortly, and yield the io thread if no chunk is ready.
+    static constexpr int64_t kWaitTimeoutUs = 1000;
+
+    if (state->is_cancelled()) {
+        return Status::Cancelled("canceled state");
+    }
+
+    do {
+        RETURN_IF_ERROR(state->check_mem_limit("read chunk from shared scan"));
+        auto res = _shared_scan->next(_shared_scan_follower_id, kWaitTimeoutUs);
+        if (res.status().is_time_out() &&
+            MonotonicNanos() - _shared_scan_last_chunk_ns >= config::scan_share_follower_max_wait_ms * 1000000) {
+            return Status::Aborted("wait for the leader of shared scan too long");
+        }
+        RETURN_IF_ERROR(res);
+        _shared_scan_last_chunk_ns = MonotonicNanos();
+        if (res.value() == nullptr) {
+            return Status::EndOfFile("end of shared scan");
+        }
+        *chunk = std::move(res.value());
+        _shared_scan_rows += (*chunk)->num_rows();
+        COUNTER_UPDATE(_shared_scan_consumed_chunks, 1);
+        RETURN_IF_ERROR(_filter_chunk((*chunk).get()));
+    } while ((*chunk)->num_rows() == 0);
+    _update_realtime_counter((*chunk).get());
+    if (_limit != -1 && _num_rows_read >= _limit) {
+        return Status::EndOfFile("limit reach");
+    }
+    return Status::OK();
+}
+
+Status OlapChunkSource::_fall_back_from_shared_scan() {
+    _shared_scan->detach(_shared_scan_follower_id);
+    _shared_scan.reset();
+    _shared_scan_follower_id = -1;
+    // The reader outputs the same rows in the same order as the leader, so skip the consumed ones.
+    _rows_to_skip = _shared_scan_rows;
+    COUNTER_UPDATE(_shared_scan_fallbacks, 1);
+
+    auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, _tablet->tablet_id());
+    return _open_reader();
+}
+
+bool OlapChunkSource::_can_late_materialize() const {
+    if (!config::enable_scan_late_materialization) {
+        return false;
+    }
+    // The rows of primary key tablets are identified by the rowset segment ids with delete vectors, and the rows of
+    // the other tablets are aggregated by the reader.
+    if (_tablet_schema->keys_type() != KeysType::DUP_KEYS) {
+        return false;
+    }
+    // Only the non-pushdown predicates filter the rows after reading.
+    if (_scan_ctx->not_push_down_conjuncts().empty() && _non_pushdown_pred_tree.empty()) {
+        return false;
+    }
+    // The subfields pruned by the column access paths are read by the segment iterators only.
+    return _column_access_paths.empty();
+}
+
+void OlapChunkSource::_init_late_materialization() {
+    // The columns referenced by the predicates and runtime filters are read eagerly.
+    std::unordered_set<ColumnId> eager_cids = _params.pred_tree.column_ids();
+    const auto& non_pushdown_cids = _non_pushdown_pred_tree.column_ids();
+    eager_cids.insert(non_pushdown_cids.begin(), non_pushdown_cids.end());
+    std::vector<SlotId> slot_ids;
+    for (ExprContext* ctx : _scan_ctx->not_push_down_conjuncts()) {
+        ctx->root()->get_slot_ids(&slot_ids);
+    }
+    for (const auto* slot_desc : _scan_ctx->conjuncts_manager().unarrived_runtime_filters().slot_descs) {
+        slot_ids.push_back(slot_desc->id());
+    }
+    for (auto* slot : *_slots) {
+        if (std::find(slot_ids.begin(), slot_ids.end(), slot->id()) != slot_ids.end()) {
+            eager_cids.insert(_tablet_schema->field_index(slot->col_name()));
+        }
+    }
+
+    // The key columns are read eagerly for the ordering, and the columns with global dicts are read as dict codes
+    // by the segment iterators.
+    for (uint32_t cid : _scanner_columns) {
+        if (eager_cids.count(cid) > 0 || _tablet_schema->column(cid).is_key() ||
+            _params.global_dictmaps->count(cid) > 0 || _unused_output_column_ids.count(cid) > 0) {
+            _eager_columns.push_back(cid);
+        } else {
+            _lazy_columns.push_back(cid);
+        }
+    }
+    if (_lazy_columns.empty() || _eager_columns.empty()) {
+        _lazy_columns.clear();
+        _eager_columns.clear();
+        return;
+    }
+
+    std::vector<uint32_t> reader_columns;
+    std::set_difference(_reader_columns.begin(), _reader_columns.end(), _lazy_columns.begin(), _lazy_columns.end(),
+                        std::back_inserter(reader_columns));
+    _reader_columns = std::move(reader_columns);
+    _reader_schema = ChunkHelper::convert_schema(_tablet_schema, _reader_columns);
+    _lazy_schema = ChunkHelper::convert_schema(_tablet_schema, _lazy_columns);
+    _params.output_row_ids = true;
+
+    std::string lazy_column_names;
+    for (uint32_t cid : _lazy_columns) {
+        if (!lazy_column_names.empty()) {
+            lazy_column_names += ",";
+        }
+        lazy_column_names += _tablet_schema->column(cid).name();
+    }
+    _runtime_profile->add_info_string("LateMaterializedColumns", lazy_column_names);
+    _late_materialize_timer = ADD_CHILD_TIMER(_runtime_profile, "LateMaterializeTime", IO_TASK_EXEC_TIMER_NAME);
+    _late_materialized_rows = ADD_COUNTER(_runtime_profile, "LateMaterializedRows", TUnit::UNIT);
+}
+
+Status OlapChunkSource::_read_chunk_with_late_materialization(RuntimeState* state, ChunkPtr* chunk) {
+    // The row ids are appended to the chunk of the eager columns as an extra column, so they are filtered along with
+    // the eager columns by the non-pushdown predicates.
+    static const FieldPtr kRowIdField =
+            std::make_shared<Field>(std::numeric_limits<ColumnId>::max(), "__row_id__", TYPE_BIGINT, false);
+
+    if (state->is_cancelled()) {
+        return Status::Cancelled("canceled state");
+    }
+
+    ChunkPtr eager_chunk(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _runtime_state->chunk_size(),
+                                                       _runtime_state->use_column_pool()));
+    ColumnPtr row_id_column;
+    do {
+        RETURN_IF_ERROR(state->check_mem_limit("read chunk from storage"));
+        _rssid_rowids.clear();
+        RETURN_IF_ERROR(_prj_iter->get_next(eager_chunk.get(), &_rssid_rowids));
+        DCHECK_EQ(eager_chunk->num_rows(), _rssid_rowids.size());
+
+        auto row_ids = Int64Column::create();
+        row_ids->append_numbers(_rssid_rowids.data(), _rssid_rowids.size() * sizeof(uint64_t));
+        eager_chunk->append_column(std::move(row_ids), kRowIdField);
+        RETURN_IF_ERROR(_filter_chunk(eager_chunk.get()));
+        const size_t row_id_index = eager_chunk->num_columns() - 1;
+        row_id_column = eager_chunk->get_column_by_index(row_id_index);
+        eager_chunk->remove_column_by_index(row_id_index);
+    } while (eager_chunk->num_rows() == 0);
+
+    const auto& row_ids = down_cast<const Int64Column*>(row_id_column.get())->get_data();
+    _rssid_rowids.assign(row_ids.begin(), row_ids.end());
+    ChunkUniquePtr lazy_chunk = ChunkHelper::new_chunk(_lazy_schema, _rssid_rowids.size());
+    {
+        SCOPED_TIMER(_late_materialize_timer);
+        RETURN_IF_ERROR(_row_id_fetcher->fetch(_rssid_rowids, lazy_chunk.get()));
+    }
+    COUNTER_UPDATE(_late_materialized_rows, lazy_chunk->num_rows());
+
+    Columns columns;
+    columns.reserve(_late_materialized_schema.num_fields());
+    for (const auto& field : _late_materialized_schema.fields()) {
+        const bool is_lazy = std::binary_search(_lazy_columns.begin(), _lazy_columns.end(), field->id());
+        columns.emplace_back(is_lazy ? lazy_chunk->get_column_by_id(field->id())
+                                     : eager_chunk->get_column_by_id(field->id()));
+    }
+    *chunk = std::make_shared<Chunk>(std::move(columns), std::make_shared<Schema>(_late_materialized_schema));
+    _init_chunk_slots((*chunk).get());
+    DCHECK_CHUNK(*chunk);
+
+    _update_realtime_counter((*chunk).get());
+    if (_limit != -1 && _num_rows_read >= _limit) {
+        return Status::EndOfFile("limit reach");
+    }
     return Status::OK();
 }
 
 Status OlapChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
+    if (!_lazy_columns.empty()) {
+        auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, _tablet->tablet_id());
+        return _read_chunk_with_late_materialization(_runtime_state, chunk);
+    }
+
+    if (_shared_scan_follower_id >= 0) {
+        Status status = _read_chunk_from_shared_scan(_runtime_state, chunk);
+        if (!status.is_aborted()) {
+            return status;
+        }
+        RETURN_IF_ERROR(_fall_back_from_shared_scan());
+    }
+
     chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _runtime_state->chunk_size(),
                                                _runtime_state->use_column_pool()));
     auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, _tablet->tablet_id());
@@ -513,30 +827,36 @@ Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, Chunk* chu
 
     do {
         RETURN_IF_ERROR(state->check_mem_limit("read chunk from storage"));
-        RETURN_IF_ERROR(_prj_iter->get_next(chunk));
-
-        TRY_CATCH_ALLOC_SCOPE_START()
-
-        for (auto slot : _query_slots) {
-            size_t column_index = chunk->schema()->get_field_index_by_name(slot->col_name());
-            chunk->set_slot_id_to_index(slot->id(), column_index);
+        Status status = _prj_iter->get_next(chunk);
+        if (status.is_end_of_file() && _shared_scan != nullptr) {
+            _shared_scan->finish();
         }
+        RETURN_IF_ERROR(status);
 
-        if (!_non_pushdown_pred_tree.empty()) {
-            SCOPED_TIMER(_expr_filter_timer);
+        if (_rows_to_skip > 0) {
+            // Skip the rows consumed from the shared scan before falling back.
             size_t nrows = chunk->num_rows();
-            _selection.resize(nrows);
-            RETURN_IF_ERROR(_non_pushdown_pred_tree.evaluate(chunk, _selection.data(), 0, nrows));
+            size_t nskip = std::min(nrows, _rows_to_skip);
+            _selection.assign(nrows, 1);
+            memset(_selection.data(), 0, nskip);
             chunk->filter(_selection);
-            DCHECK_CHUNK(chunk);
+            _rows_to_skip -= nskip;
+            if (chunk->num_rows() == 0) {
+                continue;
+            }
         }
-        if (!_scan_ctx->not_push_down_conjuncts().empty()) {
-            SCOPED_TIMER(_expr_filter_timer);
-            RETURN_IF_ERROR(ExecNode::eval_conjuncts(_scan_ctx->not_push_down_conjuncts(), chunk));
-            DCHECK_CHUNK(chunk);
+
+        if (_shared_scan != nullptr) {
+            if (_shared_scan->need_publish()) {
+                _shared_scan->publish(*chunk);
+                COUNTER_UPDATE(_shared_scan_published_chunks, 1);
+            } else {
+                // No follower attaches and no new follower can attach any more.
+                _shared_scan.reset();
+            }
         }
-        TRY_CATCH_ALLOC_SCOPE_END()
 
+        RETURN_IF_ERROR(_filter_chunk(chunk));
     } while (chunk->num_rows() == 0);
     _update_realtime_counter(chunk);
     // Improve for select * from table limit x, x is small
@@ -546,13 +866,48 @@ Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, Chunk* chu
     return Status::OK();
 }
 
+Status OlapChunkSource::_filter_chunk(Chunk* chunk) {
+    TRY_CATCH_ALLOC_SCOPE_START()
+
+    _init_chunk_slots(chunk);
+
+    if (!_non_pushdown_pred_tree.empty()) {
+        SCOPED_TIMER(_expr_filter_timer);
+        size_t nrows = chunk->num_rows();
+        _selection.resize(nrows);
+        RETURN_IF_ERROR(_non_pushdown_pred_tree.evaluate(chunk, _selection.data(), 0, nrows));
+        chunk->filter(_selection);
+        DCHECK_CHUNK(chunk);
+    }
+    if (!_scan_ctx->not_push_down_conjuncts().empty()) {
+        SCOPED_TIMER(_expr_filter_timer);
+        RETURN_IF_ERROR(ExecNode::eval_conjuncts(_scan_ctx->not_push_down_conjuncts(), chunk));
+        DCHECK_CHUNK(chunk);
+    }
+    TRY_CATCH_ALLOC_SCOPE_END()
+    return Status::OK();
+}
+
+void OlapChunkSource::_init_chunk_slots(Chunk* chunk) {
+    for (auto slot : _query_slots) {
+        size_t column_index = chunk->schema()->get_field_index_by_name(slot->col_name());
+        // The late materialized columns are not in the chunk before filtering.
+        if (column_index != static_cast<size_t>(-1)) {
+            chunk->set_slot_id_to_index(slot->id(), column_index);
+        }
+    }
+}
+
 void OlapChunkSource::_update_realtime_counter(Chunk* chunk) {
-    auto& stats = _reader->stats();
     size_t num_rows = chunk->num_rows();
     _num_rows_read += num_rows;
-    _scan_rows_num = stats.raw_rows_read;
-    _scan_bytes = stats.bytes_read;
-    _cpu_time_spent_ns = stats.decompress_ns + stats.vec_cond_ns + stats.del_filter_ns;
+    // The followers of a shared scan read nothing from the storage before falling back.
+    if (_reader != nullptr) {
+        auto& stats = _reader->stats();
+        _scan_rows_num = stats.raw_rows_read;
+        _scan_bytes = stats.bytes_read;
+        _cpu_time_spent_ns = stats.decompress_ns + stats.vec_cond_ns + stats.del_filter_ns;
+    }
 
     const TQueryOptions& query_options = _runtime_state->query_options();
     if (query_options.__isset.load_job_type && query_options.load_job_type == TLoadJobType::INSERT_QUERY) {
@@ -573,6 +928,10 @@ void OlapChunkSource::_update_counter() {
     COUNTER_UPDATE(_decompress_timer, _reader->stats().decompress_ns);
     COUNTER_UPDATE(_read_uncompressed_counter, _reader->stats().uncompressed_bytes_read);
     COUNTER_UPDATE(_bytes_read_counter, _reader->stats().bytes_read);
+    if (_row_id_fetcher != nullptr) {
+        COUNTER_UPDATE(_io_timer, _row_id_fetcher->stats().io_ns);
+        COUNTER_UPDATE(_bytes_read_counter, _row_id_fetcher->stats().bytes_read);
+    }
 
     COUNTER_UPDATE(_block_load_timer, _reader->stats().block_load_ns);
     COUNTER_UPDATE(_block_load_counter, _reader->stats().blocks_load);
@@ -589,6 +948,9 @@ void OlapChunkSource::_update_counter() {
     COUNTER_UPDATE(_zone_map_filter_timer, _reader->stats().zone_map_filter_ns);
     COUNTER_UPDATE(_rows_key_range_filter_timer, _reader->stats().rows_key_range_filter_ns);
     COUNTER_UPDATE(_bf_filter_timer, _reader->stats().bf_filter_ns);
+    COUNTER_UPDATE(_index_prefetch_wait_timer, _reader->stats().index_prefetch_wait_ns);
+    COUNTER_UPDATE(_index_prefetch_io_counter, _reader->stats().index_prefetch_io_count);
+    COUNTER_UPDATE(_index_prefetch_io_bytes, _reader->stats().index_prefetch_io_bytes);
     COUNTER_UPDATE(_read_pk_index_timer, _reader->stats().read_pk_index_ns);
 
     COUNTER_UPDATE(_raw_rows_counter, _reader->stats().raw_rows_read);
@@ -597,16 +959,31 @@ void OlapChunkSource::_update_counter() {
     cond_evaluate_ns += _reader->stats().vec_cond_evaluate_ns;
     cond_evaluate_ns += _reader->stats().branchless_cond_evaluate_ns;
     cond_evaluate_ns += _reader->stats().expr_cond_evaluate_ns;
+    cond_evaluate_ns += _reader->stats().encoded_pred_evaluate_ns;
     // In order to avoid exposing too detailed metrics, we still record these infos on `_pred_filter_timer`
     // When we support metric classification, we can disassemble it again.
     COUNTER_UPDATE(_pred_filter_timer, cond_evaluate_ns);
-    COUNTER_UPDATE(_pred_filter_counter, _reader->stats().rows_vec_cond_filtered);
+    COUNTER_UPDATE(_pred_filter_counter,
+                   _reader->stats().rows_vec_cond_filtered + _reader->stats().rows_encoded_pred_filtered);
     COUNTER_UPDATE(_del_vec_filter_counter, _reader->stats().rows_del_vec_filtered);
+    for (const auto& [name, stats] : _reader->stats().predicate_column_stats) {
+        auto* input_rows = ADD_CHILD_COUNTER(_runtime_profile, fmt::format("PredColumn[{}]InputRows", name),
+                                             TUnit::UNIT, "PredFilter");
+        auto* output_rows = ADD_CHILD_COUNTER(_runtime_profile, fmt::format("PredColumn[{}]OutputRows", name),
+                                              TUnit::UNIT, "PredFilter");
+        auto* evaluate_timer = ADD_CHILD_TIMER(_runtime_profile, fmt::format("PredColumn[{}]Time", name), "PredFilter");
+        COUNTER_UPDATE(input_rows, stats.input_rows);
+        COUNTER_UPDATE(output_rows, stats.output_rows);
+        COUNTER_UPDATE(evaluate_timer, stats.evaluate_ns);
+    }
 
     COUNTER_UPDATE(_seg_zm_filtered_counter, _reader->stats().segment_stats_filtered);
     COUNTER_UPDATE(_seg_rt_filtered_counter, _reader->stats().runtime_stats_filtered);
+    COUNTER_UPDATE(_seg_rt_filtered_segments_counter, _reader->stats().runtime_segments_filtered);
     COUNTER_UPDATE(_zm_filtered_counter, _reader->stats().rows_stats_filtered);
     COUNTER_UPDATE(_bf_filtered_counter, _reader->stats().rows_bf_filtered);
+    COUNTER_UPDATE(_ngram_bf_pages_counter, _reader->stats().ngram_bf_pages_checked);
+    COUNTER_UPDATE(_ngram_bf_filtered_pages_counter, _reader->stats().ngram_bf_pages_filtered);
     COUNTER_UPDATE(_sk_filtered_counter, _reader->stats().rows_key_range_filtered);
     COUNTER_UPDATE(_rows_after_sk_filtered_counter, _reader->stats().rows_after_key_range);
     COUNTER_UPDATE(_rows_key_range_counter, _reader->stats().rows_key_range_num);
@@ -618,6 +995,8 @@ void OlapChunkSource::_update_counter() {
     COUNTER_UPDATE(_bi_filter_timer, _reader->stats().bitmap_index_filter_timer);
     COUNTER_UPDATE(_gin_filtered_counter, _reader->stats().rows_gin_filtered);
     COUNTER_UPDATE(_gin_filtered_timer, _reader->stats().gin_index_filter_ns);
+    COUNTER_UPDATE(_vector_index_filtered_counter, _reader->stats().rows_vector_index_filtered);
+    COUNTER_UPDATE(_vector_index_filtered_timer, _reader->stats().vector_index_filter_ns);
     COUNTER_UPDATE(_block_seek_counter, _reader->stats().block_seek_num);
 
     COUNTER_UPDATE(_rowsets_read_count, _reader->stats().rowsets_read_count);
@@ -642,6 +1021,13 @@ void OlapChunkSource::_update_counter() {
         RuntimeProfile::Counter* c = ADD_CHILD_TIMER(_runtime_profile, "LateMaterialize", IO_TASK_EXEC_TIMER_NAME);
         COUNTER_UPDATE(c, _reader->stats().late_materialize_ns);
     }
+    if (_reader->stats().row_store_segments > 0) {
+        RuntimeProfile::Counter* c1 =
+                ADD_CHILD_COUNTER(_runtime_profile, "RowStoreSegments", TUnit::UNIT, "SegmentRead");
+        RuntimeProfile::Counter* c2 = ADD_CHILD_TIMER(_runtime_profile, "RowStoreDecode", "SegmentRead");
+        COUNTER_UPDATE(c1, _reader->stats().row_store_segments);
+        COUNTER_UPDATE(c2, _reader->stats().row_store_decode_ns);
+    }
     if (_reader->stats().del_filter_ns > 0) {
         RuntimeProfile::Counter* c1 = ADD_CHILD_TIMER(_runtime_profile, "DeleteFilter", IO_TASK_EXEC_TIMER_NAME);
         RuntimeProfile::Counter* c2 = ADD_COUNTER(_runtime_profile, "DeleteFilterRows", TUnit::UNIT);
@@ -20,6 +20,7 @@
 #include "exec/olap_scan_prepare.h"
 #include "exec/olap_utils.h"
 #include "exec/pipeline/scan/chunk_source.h"
+#include "exec/pipeline/scan/shared_tablet_scan.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
@@ -27,6 +28,7 @@
 #include "runtime/runtime_state.h"
 #include "storage/conjunctive_predicates.h"
 #include "storage/predicate_tree/predicate_tree.hpp"
+#include "storage/row_id_fetcher.h"
 #include "storage/tablet.h"
 #include "storage/tablet_reader.h"
 #include "util/runtime_profile.h"
@@ -60,11 +62,23 @@ private:
                                const std::vector<uint32_t>& scanner_columns, std::vector<uint32_t>& reader_columns);
     Status _init_scanner_columns(std::vector<uint32_t>& scanner_columns);
     Status _init_unused_output_columns(const std::vector<std::string>& unused_output_columns);
+    Status _init_vector_search_option(const TVectorSearchOptions& options);
     Status _init_olap_reader(RuntimeState* state);
+    Status _open_reader();
+    bool _can_share_scan();
+    std::string _shared_scan_key() const;
+    Status _init_shared_scan();
+    Status _read_chunk_from_shared_scan(RuntimeState* state, ChunkPtr* chunk);
+    Status _fall_back_from_shared_scan();
+    bool _can_late_materialize() const;
+    void _init_late_materialization();
+    Status _read_chunk_with_late_materialization(RuntimeState* state, ChunkPtr* chunk);
     TCounterMinMaxType::type _get_counter_min_max_type(const std::string& metric_name);
     void _init_counter(RuntimeState* state);
     Status _init_global_dicts(TabletReaderParams* params);
     Status _read_chunk_from_storage([[maybe_unused]] RuntimeState* state, Chunk* chunk);
+    Status _filter_chunk(Chunk* chunk);
+    void _init_chunk_slots(Chunk* chunk);
     void _update_counter();
     void _update_realtime_counter(Chunk* chunk);
     void _decide_chunk_size(bool has_predicate);
@@ -99,6 +113,33 @@ private:
     // projection iterator, doing the job of choosing |_scanner_columns| from |_reader_columns|.
     std::shared_ptr<ChunkIterator> _prj_iter;
 
+    // output columns of `this` OlapScanner, i.e, the final output columns of `get_chunk`.
+    std::vector<uint32_t> _scanner_columns;
+    // columns fetched from |_reader|.
+    std::vector<uint32_t> _reader_columns;
+    // The schema and rowsets to create |_reader|, which is created lazily by the followers of a shared scan.
+    Schema _reader_schema;
+    std::vector<RowsetSharedPtr> _reader_rowsets;
+
+    // Not null if this chunk source is the leader or a follower of a shared scan.
+    SharedTabletScanPtr _shared_scan;
+    // >= 0 if this chunk source is a follower of |_shared_scan|.
+    int _shared_scan_follower_id = -1;
+    // The number of rows consumed from |_shared_scan|, which are skipped after falling back to |_reader|.
+    size_t _shared_scan_rows = 0;
+    size_t _rows_to_skip = 0;
+    int64_t _shared_scan_last_chunk_ns = 0;
+
+    // The output columns not referenced by any predicate, which are fetched by |_row_id_fetcher| only for the rows
+    // passing the non-pushdown predicates, and |_eager_columns| are the other output columns read by |_reader|.
+    std::vector<uint32_t> _lazy_columns;
+    std::vector<uint32_t> _eager_columns;
+    Schema _lazy_schema;
+    // The schema of the chunks assembled from the eager and lazy columns.
+    Schema _late_materialized_schema;
+    std::unique_ptr<RowIdFetcher> _row_id_fetcher;
+    std::vector<uint64_t> _rssid_rowids;
+
     std::unordered_set<uint32_t> _unused_output_column_ids;
 
     // slot descriptors for each one of |output_columns|.
@@ -133,10 +174,16 @@ private:
     RuntimeProfile::Counter* _rows_key_range_filter_timer = nullptr;
     RuntimeProfile::Counter* _rows_key_range_counter = nullptr;
     RuntimeProfile::Counter* _bf_filter_timer = nullptr;
+    RuntimeProfile::Counter* _index_prefetch_wait_timer = nullptr;
+    RuntimeProfile::Counter* _index_prefetch_io_counter = nullptr;
+    RuntimeProfile::Counter* _index_prefetch_io_bytes = nullptr;
     RuntimeProfile::Counter* _zm_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bf_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _ngram_bf_pages_counter = nullptr;
+    RuntimeProfile::Counter* _ngram_bf_filtered_pages_counter = nullptr;
     RuntimeProfile::Counter* _seg_zm_filtered_counter = nullptr;
     RuntimeProfile::Counter* _seg_rt_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _seg_rt_filtered_segments_counter = nullptr;
     RuntimeProfile::Counter* _sk_filtered_counter = nullptr;
     RuntimeProfile::Counter* _rows_after_sk_filtered_counter = nullptr;
     RuntimeProfile::Counter* _block_seek_timer = nullptr;
@@ -150,6 +197,8 @@ private:
     RuntimeProfile::Counter* _bi_filter_timer = nullptr;
     RuntimeProfile::Counter* _gin_filtered_counter = nullptr;
     RuntimeProfile::Counter* _gin_filtered_timer = nullptr;
+    RuntimeProfile::Counter* _vector_index_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _vector_index_filtered_timer = nullptr;
     RuntimeProfile::Counter* _pushdown_predicates_counter = nullptr;
     RuntimeProfile::Counter* _non_pushdown_predicates_counter = nullptr;
     RuntimeProfile::Counter* _rowsets_read_count = nullptr;
@@ -160,6 +209,11 @@ private:
     RuntimeProfile::Counter* _json_flatten_timer = nullptr;
     RuntimeProfile::Counter* _access_path_hits_counter = nullptr;
     RuntimeProfile::Counter* _access_path_unhits_counter = nullptr;
+    RuntimeProfile::Counter* _shared_scan_published_chunks = nullptr;
+    RuntimeProfile::Counter* _shared_scan_consumed_chunks = nullptr;
+    RuntimeProfile::Counter* _shared_scan_fallbacks = nullptr;
+    RuntimeProfile::Counter* _late_materialize_timer = nullptr;
+    RuntimeProfile::Counter* _late_materialized_rows = nullptr;
 };
 } // namespace pipeline
 } // namespace starrocks
@@ -27,9 +27,11 @@
 #include "exec/workgroup/work_group.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
+#include "util/cpu_info.h"
 #include "util/debug/query_trace.h"
 #include "util/failpoint/fail_point.h"
 #include "util/runtime_profile.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks::pipeline {
 
@@ -87,6 +89,7 @@ Status ScanOperator::prepare(RuntimeState* state) {
 
     _prepare_chunk_source_timer = ADD_TIMER(_unique_metrics, "PrepareChunkSourceTime");
     _submit_io_task_timer = ADD_TIMER(_unique_metrics, "SubmitTaskTime");
+    _cross_numa_node_chunks_counter = ADD_COUNTER(_unique_metrics, "CrossNumaNodeChunks", TUnit::UNIT);
 
     RETURN_IF_ERROR(do_prepare(state));
     return Status::OK();
@@ -112,6 +115,8 @@ void ScanOperator::close(RuntimeState* state) {
             ADD_COUNTER_SKIP_MERGE(_unique_metrics, "TabletCount", TUnit::UNIT, TCounterMergeType::SKIP_FIRST_MERGE);
     COUNTER_SET(_tablets_counter, static_cast<int64_t>(_source_factory()->num_total_original_morsels()));
 
+    _read_histograms.to_profile(_unique_metrics.get());
+
     _merge_chunk_source_profiles(state);
 
     do_close(state);
@@ -255,6 +260,7 @@ StatusOr<ChunkPtr> ScanOperator::pull_chunk(RuntimeState* state) {
     RETURN_IF_ERROR(_try_to_trigger_next_scan(state));
     ChunkPtr res = get_chunk_from_buffer();
     if (res != nullptr) {
+        _update_cross_numa_node_chunks();
         begin_pull_chunk(res);
         // for query cache mechanism, we should emit EOS chunk when we receive the last chunk.
         auto [owner_id, is_eos] = _should_emit_eos(res);
@@ -265,6 +271,19 @@ StatusOr<ChunkPtr> ScanOperator::pull_chunk(RuntimeState* state) {
     return res;
 }
 
+void ScanOperator::_update_cross_numa_node_chunks() {
+    if (CpuInfo::get_max_num_numa_nodes() <= 1) {
+        return;
+    }
+    // The chunk is regarded as produced by the last io task, which is accurate enough to find out whether
+    // the scan threads and the driver threads run on the same NUMA node.
+    const int producer_numa_node = _io_task_numa_node.load(std::memory_order_relaxed);
+    if (producer_numa_node >= 0 && producer_numa_node != CpuInfo::get_current_numa_node()) {
+        COUNTER_UPDATE(_cross_numa_node_chunks_counter, 1);
+        StarRocksMetrics::instance()->pipe_scan_cross_numa_node_chunks.increment(1);
+    }
+}
+
 std::tuple<int64_t, bool> ScanOperator::_should_emit_eos(const ChunkPtr& chunk) {
     auto owner_id = chunk->owner_info().owner_id();
     auto is_last_chunk = chunk->owner_info().is_last_chunk();
@@ -282,6 +301,14 @@ int64_t ScanOperator::global_rf_wait_timeout_ns() const {
 
     return 1000'000L * global_rf_collector->scan_wait_timeout_ms();
 }
+
+size_t ScanOperator::target_chunk_size(RuntimeState* state) const {
+    if (_adaptive_chunk_size == nullptr) {
+        return state->chunk_size();
+    }
+    return std::min<size_t>(_adaptive_chunk_size->chunk_size(), state->chunk_size());
+}
+
 Status ScanOperator::_try_to_trigger_next_scan(RuntimeState* state) {
     // to sure to put it here for updating state.
     // because we want to update state based on raw data.
@@ -410,6 +437,7 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
             SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->instance_mem_tracker());
             SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(this);
 
+            _io_task_numa_node.store(CpuInfo::get_current_numa_node(), std::memory_order_relaxed);
             auto& chunk_source = _chunk_sources[chunk_source_index];
             SCOPED_SET_CUSTOM_COREDUMP_MSG(chunk_source->get_custom_coredump_msg());
 
@@ -426,6 +454,7 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
             });
             COUNTER_UPDATE(chunk_source->io_task_wait_timer(), MonotonicNanos() - io_task_start_nano);
             SCOPED_TIMER(chunk_source->io_task_exec_timer());
+            IOProfiler::ReadHistogramsScope read_histograms_scope(&_read_histograms);
 
             int64_t prev_cpu_time = chunk_source->get_cpu_time_spent();
             int64_t prev_scan_rows = chunk_source->get_scan_rows();
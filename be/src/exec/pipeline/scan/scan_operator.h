@@ -14,10 +14,12 @@
 
 #pragma once
 
+#include "exec/pipeline/adaptive_chunk_size.h"
 #include "exec/pipeline/source_operator.h"
 #include "exec/query_cache/cache_operator.h"
 #include "exec/query_cache/lane_arbiter.h"
 #include "exec/workgroup/work_group_fwd.h"
+#include "io/io_profiler.h"
 #include "util/spinlock.h"
 
 namespace starrocks {
@@ -76,6 +78,14 @@ public:
     void set_cache_operator(const query_cache::CacheOperatorPtr& cache_operator) { _cache_operator = cache_operator; }
     void set_ticket_checker(query_cache::TicketCheckerPtr& ticket_checker) { _ticket_checker = ticket_checker; }
 
+    void set_adaptive_chunk_size(AdaptiveChunkSizeControllerPtr controller) {
+        _adaptive_chunk_size = std::move(controller);
+    }
+
+    // The rows per chunk that a chunk source opened now should read, the chunk_size of the runtime state
+    // unless the driver adapts it to the width of the rows.
+    size_t target_chunk_size(RuntimeState* state) const;
+
     void set_query_ctx(const QueryContextPtr& query_ctx);
 
     virtual int available_pickup_morsel_count() { return _io_tasks_per_scan_operator; }
@@ -175,7 +185,12 @@ protected:
     // ticket_checker is used to count down the EOS generated by SplitMorsels from the identical original ScanMorsel.
     query_cache::TicketCheckerPtr _ticket_checker = nullptr;
 
+    AdaptiveChunkSizeControllerPtr _adaptive_chunk_size = nullptr;
+
 private:
+    // Count the chunks pulled on a different NUMA node from the one where they are scanned.
+    void _update_cross_numa_node_chunks();
+
     int32_t _io_task_retry_cnt = 0;
     workgroup::ScanExecutor* _scan_executor = nullptr;
 
@@ -201,6 +216,11 @@ private:
 
     RuntimeProfile::Counter* _prepare_chunk_source_timer = nullptr;
     RuntimeProfile::Counter* _submit_io_task_timer = nullptr;
+    RuntimeProfile::Counter* _cross_numa_node_chunks_counter = nullptr;
+    // The NUMA node where the last io task ran, -1 means no io task has run yet.
+    std::atomic<int> _io_task_numa_node = -1;
+    // The reads of the io tasks of this operator, by source.
+    IOProfiler::ReadHistograms _read_histograms;
 };
 
 class ScanOperatorFactory : public SourceOperatorFactory {
@@ -0,0 +1,243 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/scan/shared_tablet_scan.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks::pipeline {
+
+// The published chunks outlive the query of the leader when the followers are slower, so they are accounted to the
+// query pool instead of any query.
+#define SCOPED_SHARED_SCAN_MEM_TRACKER() \
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(GlobalEnv::GetInstance()->query_pool_mem_tracker())
+
+// Copy the chunk with its schema but without its slot ids, which are set by each chunk source itself.
+static ChunkUniquePtr copy_chunk(const Chunk& chunk) {
+    auto copied = chunk.clone_empty_with_schema(chunk.num_rows());
+    copied->append(chunk);
+    return copied;
+}
+
+SharedTabletScan::SharedTabletScan(std::string key, int64_t max_buffered_bytes)
+        : _key(std::move(key)), _max_buffered_bytes(max_buffered_bytes) {}
+
+SharedTabletScan::~SharedTabletScan() {
+    SCOPED_SHARED_SCAN_MEM_TRACKER();
+    _chunks.clear();
+}
+
+bool SharedTabletScan::need_publish() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _accept_followers || !_followers.empty();
+}
+
+void SharedTabletScan::publish(const Chunk& chunk) {
+    SCOPED_SHARED_SCAN_MEM_TRACKER();
+    ChunkPtr copied = copy_chunk(chunk);
+    const int64_t bytes = copied->memory_usage();
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (_finished || _aborted || (!_accept_followers && _followers.empty())) {
+            return;
+        }
+        _chunks.emplace_back(std::move(copied));
+        _buffered_bytes += bytes;
+        _trim_locked();
+    }
+    _cv.notify_all();
+}
+
+void SharedTabletScan::finish() {
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _finished = true;
+    }
+    _cv.notify_all();
+}
+
+void SharedTabletScan::abort() {
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (_finished) {
+            return;
+        }
+        _aborted = true;
+        _accept_followers = false;
+        SCOPED_SHARED_SCAN_MEM_TRACKER();
+        _chunks.clear();
+        _buffered_bytes = 0;
+    }
+    _cv.notify_all();
+}
+
+int SharedTabletScan::attach() {
+    std::lock_guard<std::mutex> l(_mutex);
+    if (!_accept_followers) {
+        return -1;
+    }
+    DCHECK_EQ(_base_seq, 0);
+    const int id = _next_follower_id++;
+    _followers.emplace(id, Follower{});
+    return id;
+}
+
+StatusOr<ChunkUniquePtr> SharedTabletScan::next(int follower_id, int64_t timeout_us) {
+    ChunkPtr chunk;
+    {
+        std::unique_lock<std::mutex> l(_mutex);
+        auto it = _followers.find(follower_id);
+        DCHECK(it != _followers.end());
+        Follower& follower = it->second;
+        auto is_ready = [&] {
+            return follower.evicted || _aborted || follower.next_seq < _base_seq + (int64_t)_chunks.size() ||
+                   _finished;
+        };
+        if (!_cv.wait_for(l, std::chrono::microseconds(timeout_us), is_ready)) {
+            return Status::TimedOut("wait for the leader of shared scan");
+        }
+        if (follower.evicted) {
+            return Status::Aborted("evicted from shared scan");
+        }
+        if (_aborted) {
+            return Status::Aborted("leader of shared scan aborted");
+        }
+        if (follower.next_seq == _base_seq + (int64_t)_chunks.size()) {
+            DCHECK(_finished);
+            return nullptr;
+        }
+        chunk = _chunks[follower.next_seq - _base_seq];
+        follower.next_seq++;
+        if (!_accept_followers) {
+            _trim_locked();
+        }
+    }
+    // The shared chunk stays immutable, and the follower filters its own copy.
+    ChunkUniquePtr copied = copy_chunk(*chunk);
+    {
+        SCOPED_SHARED_SCAN_MEM_TRACKER();
+        chunk.reset();
+    }
+    return copied;
+}
+
+void SharedTabletScan::detach(int follower_id) {
+    std::lock_guard<std::mutex> l(_mutex);
+    _followers.erase(follower_id);
+    if (!_accept_followers) {
+        _trim_locked();
+    }
+}
+
+bool SharedTabletScan::accept_followers() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _accept_followers;
+}
+
+int64_t SharedTabletScan::buffered_bytes() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _buffered_bytes;
+}
+
+size_t SharedTabletScan::num_followers() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _followers.size();
+}
+
+void SharedTabletScan::_trim_locked() {
+    if (_accept_followers && _buffered_bytes > _max_buffered_bytes) {
+        _accept_followers = false;
+    }
+    if (_accept_followers) {
+        // Keep all the chunks for the followers attaching later.
+        return;
+    }
+
+    // Drop the chunks consumed by all the followers.
+    int64_t min_next_seq = _base_seq + _chunks.size();
+    for (const auto& [_, follower] : _followers) {
+        if (!follower.evicted) {
+            min_next_seq = std::min(min_next_seq, follower.next_seq);
+        }
+    }
+    while (_base_seq < min_next_seq) {
+        _release_front_locked();
+    }
+
+    // Evict the slowest followers until the buffered chunks fit in the limit.
+    while (_buffered_bytes > _max_buffered_bytes && !_chunks.empty()) {
+        for (auto& [_, follower] : _followers) {
+            if (follower.next_seq == _base_seq) {
+                follower.evicted = true;
+            }
+        }
+        _release_front_locked();
+    }
+}
+
+void SharedTabletScan::_release_front_locked() {
+    SCOPED_SHARED_SCAN_MEM_TRACKER();
+    _buffered_bytes -= _chunks.front()->memory_usage();
+    _chunks.pop_front();
+    _base_seq++;
+}
+
+SharedTabletScanManager* SharedTabletScanManager::instance() {
+    static SharedTabletScanManager manager;
+    return &manager;
+}
+
+SharedTabletScanPtr SharedTabletScanManager::attach_or_create(const std::string& key, int* follower_id) {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto it = _scans.find(key);
+    if (it != _scans.end()) {
+        if (auto scan = it->second.lock(); scan != nullptr) {
+            if (int id = scan->attach(); id >= 0) {
+                *follower_id = id;
+                return scan;
+            }
+        }
+    }
+
+    // Remove the expired scans lazily, and amortize the cost by doubling the threshold.
+    if (_scans.size() >= _sweep_threshold) {
+        for (auto iter = _scans.begin(); iter != _scans.end();) {
+            if (iter->second.expired()) {
+                iter = _scans.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+        _sweep_threshold = std::max<size_t>(kMinSweepThreshold, _scans.size() * 2);
+    }
+
+    auto scan = std::make_shared<SharedTabletScan>(key, config::scan_share_max_buffered_bytes);
+    _scans[key] = scan;
+    *follower_id = -1;
+    return scan;
+}
+
+size_t SharedTabletScanManager::size() {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _scans.size();
+}
+
+} // namespace starrocks::pipeline
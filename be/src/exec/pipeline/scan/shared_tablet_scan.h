@@ -0,0 +1,129 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "gutil/macros.h"
+
+namespace starrocks::pipeline {
+
+class SharedTabletScan;
+using SharedTabletScanPtr = std::shared_ptr<SharedTabletScan>;
+
+// SharedTabletScan lets the concurrent chunk sources reading the same tablet with the same version, columns and
+// pushdown predicates share the chunks decoded by one of them.
+//
+// The chunk source creating the shared scan is the leader, which reads the tablet by its own TabletReader and
+// publishes a copy of every chunk before applying its non-pushdown predicates. The chunk sources attaching to it
+// are the followers, which read the published chunks in order without touching the storage, and then apply their
+// own non-pushdown predicates.
+//
+// Followers can only attach before any published chunk is dropped, so every follower sees the chunks from the
+// beginning. The published chunks are kept until all the followers consume them, and the total bytes of them are
+// limited by `max_buffered_bytes`. When the limit is exceeded, the slowest followers are evicted. An evicted
+// follower, or a follower whose leader aborts, should read the tablet by itself and skip the rows it has consumed.
+//
+// All the methods are thread-safe.
+class SharedTabletScan {
+public:
+    SharedTabletScan(std::string key, int64_t max_buffered_bytes);
+    ~SharedTabletScan();
+
+    DISALLOW_COPY_AND_MOVE(SharedTabletScan);
+
+    const std::string& key() const { return _key; }
+
+    // Leader interfaces.
+    // Whether the leader needs to publish chunks, that is, there are followers or new followers may attach.
+    bool need_publish() const;
+    void publish(const Chunk& chunk);
+    // Called when the leader reaches the end of the tablet.
+    void finish();
+    // Called when the leader stops before the end of the tablet, e.g. reaching the limit or failing.
+    void abort();
+
+    // Follower interfaces.
+    // Returns the follower id, or -1 if new followers cannot attach any more.
+    int attach();
+    // Returns the next chunk for the follower, or nullptr if all the chunks have been consumed.
+    // Returns TimedOut if no chunk is ready after waiting for `timeout_us`, and Aborted if the follower is evicted or
+    // the leader aborts, then the follower should fall back to reading the tablet by itself.
+    StatusOr<ChunkUniquePtr> next(int follower_id, int64_t timeout_us);
+    void detach(int follower_id);
+
+    bool accept_followers() const;
+    int64_t buffered_bytes() const;
+    size_t num_followers() const;
+
+private:
+    struct Follower {
+        // Sequence number of the next chunk to consume.
+        int64_t next_seq = 0;
+        bool evicted = false;
+    };
+
+    void _trim_locked();
+    void _release_front_locked();
+
+    const std::string _key;
+    const int64_t _max_buffered_bytes;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cv;
+
+    std::deque<ChunkPtr> _chunks;
+    // Sequence number of `_chunks.front()`.
+    int64_t _base_seq = 0;
+    int64_t _buffered_bytes = 0;
+
+    std::unordered_map<int, Follower> _followers;
+    int _next_follower_id = 0;
+
+    bool _accept_followers = true;
+    bool _finished = false;
+    bool _aborted = false;
+};
+
+// SharedTabletScanManager indexes the in-flight shared scans by their keys.
+class SharedTabletScanManager {
+public:
+    static SharedTabletScanManager* instance();
+
+    // Attaches to the in-flight shared scan of `key` as a follower, and stores the follower id in `follower_id`.
+    // If there isn't such a shared scan accepting followers, creates a new one, sets `follower_id` to -1, and the
+    // caller becomes the leader of it.
+    SharedTabletScanPtr attach_or_create(const std::string& key, int* follower_id);
+
+    size_t size();
+
+private:
+    SharedTabletScanManager() = default;
+
+    static constexpr size_t kMinSweepThreshold = 64;
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::weak_ptr<SharedTabletScan>> _scans;
+    size_t _sweep_threshold = kMinSweepThreshold;
+};
+
+} // namespace starrocks::pipeline
@@ -15,8 +15,10 @@
 #include "exec/pipeline/select_operator.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exprs/expr.h"
 #include "runtime/runtime_state.h"
+#include "simd/simd.h"
 
 namespace starrocks::pipeline {
 Status SelectOperator::prepare(RuntimeState* state) {
@@ -32,6 +34,12 @@ void SelectOperator::close(RuntimeState* state) {
 StatusOr<ChunkPtr> SelectOperator::pull_chunk(RuntimeState* state) {
     auto chunk_size = state->chunk_size();
 
+    // A chunk with a selection is only output as it is, the small ones are compacted to be merged.
+    if (_curr_chunk != nullptr && _curr_chunk->has_selection() &&
+        (_pre_output_chunk != nullptr || _curr_chunk->num_rows() < chunk_size / 2)) {
+        _curr_chunk->compact_selection();
+    }
+
     /*
      *  case pre chunk is empty:
      *  if input chunk is big enough( > chunk_size/2)
@@ -85,7 +93,25 @@ bool SelectOperator::need_input() const {
 }
 
 Status SelectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
-    RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get()));
+    if (!config::enable_lazy_chunk_selection) {
+        RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get()));
+        _curr_chunk = chunk;
+        return Status::OK();
+    }
+
+    // Keep a dense selection in the chunk, the following operators may drop columns or filter more rows
+    // before the columns are compacted.
+    FilterPtr filter;
+    RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get(), &filter, false));
+    if (filter != nullptr) {
+        const size_t num_rows = chunk->num_rows();
+        const size_t selected_rows = SIMD::count_nonzero(*filter);
+        if (selected_rows < num_rows && selected_rows >= num_rows * config::lazy_chunk_selection_min_density) {
+            chunk->set_selection(std::move(filter));
+        } else {
+            chunk->filter(*filter);
+        }
+    }
     _curr_chunk = chunk;
     return Status::OK();
 }
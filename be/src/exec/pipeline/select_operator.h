@@ -33,6 +33,8 @@ public:
     void close(RuntimeState* state) override;
     bool has_output() const override { return _curr_chunk != nullptr || _pre_output_chunk != nullptr; }
     bool need_input() const override;
+
+    bool accept_chunk_selection() const override { return true; }
     bool is_finished() const override { return _is_finished && !_curr_chunk && !_pre_output_chunk; }
 
     Status set_finishing(RuntimeState* state) override {
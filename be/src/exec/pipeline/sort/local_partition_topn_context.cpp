@@ -16,12 +16,95 @@
 
 #include <exec/partition/chunks_partitioner.h>
 
+#include <numeric>
 #include <utility>
 
+#include "column/column_helper.h"
+#include "common/config.h"
 #include "exec/chunks_sorter_topn.h"
+#include "exec/sorting/sorting.h"
+#include "simd/simd.h"
 
 namespace starrocks::pipeline {
 
+StatusOr<size_t> PartitionTopnRows::add(RuntimeState* state, const std::vector<ExprContext*>& sort_exprs,
+                                        const SortDescs& sort_descs, size_t limit, const ChunkPtr& chunk) {
+    auto evaluate_order_by_columns = [&sort_exprs](Chunk* rows) -> StatusOr<Columns> {
+        Columns columns;
+        columns.reserve(sort_exprs.size());
+        for (auto* expr_ctx : sort_exprs) {
+            ASSIGN_OR_RETURN(auto column, expr_ctx->evaluate(rows));
+            columns.emplace_back(ColumnHelper::unpack_and_duplicate_const_column(rows->num_rows(), column));
+        }
+        return columns;
+    };
+
+    const size_t num_rows = chunk->num_rows();
+    size_t num_dropped = 0;
+    if (_rows != nullptr && _rows->num_rows() >= limit && !sort_exprs.empty()) {
+        // For ROW_NUMBER, the rows equal to the last top row can't enter the top rows either.
+        std::vector<Datum> last_row;
+        last_row.reserve(_order_by_columns.size());
+        for (const auto& column : _order_by_columns) {
+            last_row.emplace_back(column->get(_rows->num_rows() - 1));
+        }
+        ASSIGN_OR_RETURN(auto order_by_columns, evaluate_order_by_columns(chunk.get()));
+        std::vector<int8_t> cmp_result(num_rows, 0);
+        compare_columns(order_by_columns, cmp_result, last_row, sort_descs);
+
+        Filter filter(num_rows);
+        for (size_t i = 0; i < num_rows; i++) {
+            filter[i] = cmp_result[i] < 0;
+        }
+        const size_t num_selected = SIMD::count_nonzero(filter);
+        num_dropped = num_rows - num_selected;
+        if (num_selected == 0) {
+            return num_dropped;
+        }
+        if (num_dropped > 0) {
+            chunk->filter(filter);
+        }
+    }
+
+    if (_rows == nullptr) {
+        _rows = chunk->clone_empty_with_slot(limit + chunk->num_rows());
+    }
+    _rows->append(*chunk);
+
+    ASSIGN_OR_RETURN(auto order_by_columns, evaluate_order_by_columns(_rows.get()));
+    std::vector<uint32_t> selection;
+    if (order_by_columns.empty()) {
+        selection.resize(std::min(limit, _rows->num_rows()));
+        std::iota(selection.begin(), selection.end(), 0);
+    } else {
+        Permutation perm;
+        RETURN_IF_ERROR(sort_and_tie_columns(state->cancelled_ref(), order_by_columns, sort_descs, &perm));
+        selection.resize(std::min(limit, perm.size()));
+        for (size_t i = 0; i < selection.size(); i++) {
+            selection[i] = perm[i].index_in_chunk;
+        }
+    }
+
+    ChunkPtr top_rows = _rows->clone_empty_with_slot(selection.size());
+    top_rows->append_selective(*_rows, selection.data(), 0, selection.size());
+    _rows = std::move(top_rows);
+    _order_by_columns.clear();
+    for (const auto& column : order_by_columns) {
+        auto top_column = column->clone_empty();
+        top_column->append_selective(*column, selection.data(), 0, selection.size());
+        _order_by_columns.emplace_back(std::move(top_column));
+    }
+    return num_dropped;
+}
+
+size_t PartitionTopnRows::memory_usage() const {
+    size_t usage = _rows != nullptr ? _rows->memory_usage() : 0;
+    for (const auto& column : _order_by_columns) {
+        usage += column->memory_usage();
+    }
+    return usage;
+}
+
 LocalPartitionTopnContext::LocalPartitionTopnContext(const std::vector<TExpr>& t_partition_exprs,
                                                      const std::vector<ExprContext*>& sort_exprs,
                                                      std::vector<bool> is_asc_order, std::vector<bool> is_null_first,
@@ -34,7 +117,10 @@ LocalPartitionTopnContext::LocalPartitionTopnContext(const std::vector<TExpr>& t
           _sort_keys(std::move(sort_keys)),
           _offset(offset),
           _partition_limit(partition_limit),
-          _topn_type(topn_type) {}
+          _topn_type(topn_type) {
+    _use_partition_topn_rows = _topn_type == TTopNType::ROW_NUMBER && config::local_partition_topn_heap_max_limit > 0 &&
+                               _offset + _partition_limit <= config::local_partition_topn_heap_max_limit;
+}
 
 Status LocalPartitionTopnContext::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Expr::create_expr_trees(state->obj_pool(), _t_partition_exprs, &_partition_exprs, state));
@@ -56,10 +142,46 @@ Status LocalPartitionTopnContext::prepare(RuntimeState* state) {
     }
 
     _chunks_partitioner = std::make_unique<ChunksPartitioner>(_has_nullable_key, _partition_exprs, _partition_types);
-    return _chunks_partitioner->prepare(state);
+    _chunk_size = state->chunk_size();
+    if (!_use_partition_topn_rows) {
+        return _chunks_partitioner->prepare(state);
+    }
+    // The partitioner hands the rows of a partition over in small batches, so a partition buffers at most
+    // the top rows and a batch.
+    _sort_descs = SortDescs(_is_asc_order, _is_null_first);
+    const auto batch_size = std::min<int64_t>(_chunk_size, std::max<int64_t>(2 * (_offset + _partition_limit), 32));
+    return _chunks_partitioner->prepare(state, batch_size);
+}
+
+Status LocalPartitionTopnContext::add_to_partition_topn_rows(RuntimeState* state, size_t partition_idx,
+                                                             const ChunkPtr& chunk) {
+    ASSIGN_OR_RETURN(auto num_dropped, _partition_topn_rows[partition_idx].add(state, _sort_exprs, _sort_descs,
+                                                                               _offset + _partition_limit, chunk));
+    _partition_topn_pruned_rows += num_dropped;
+    return Status::OK();
+}
+
+size_t LocalPartitionTopnContext::partition_topn_rows_memory_usage() const {
+    size_t usage = 0;
+    for (const auto& topn_rows : _partition_topn_rows) {
+        usage += topn_rows.memory_usage();
+    }
+    return usage;
 }
 
 Status LocalPartitionTopnContext::push_one_chunk_to_partitioner(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_use_partition_topn_rows) {
+        // The memory is bounded by the top rows of partitions, so never pass the chunks through.
+        Status add_status;
+        RETURN_IF_ERROR(_chunks_partitioner->offer<false>(
+                chunk, [this](size_t partition_idx) { _partition_topn_rows.emplace_back(); },
+                [this, state, &add_status](size_t partition_idx, const ChunkPtr& partition_chunk) {
+                    if (add_status.ok()) {
+                        add_status = add_to_partition_topn_rows(state, partition_idx, partition_chunk);
+                    }
+                }));
+        return add_status;
+    }
     auto st = _chunks_partitioner->offer<true>(
             chunk,
             [this, state](size_t partition_idx) {
@@ -86,6 +208,18 @@ Status LocalPartitionTopnContext::transfer_all_chunks_from_partitioner_to_sorter
     }
 
     _partition_num = _chunks_partitioner->num_partitions();
+    if (_use_partition_topn_rows) {
+        Status add_status;
+        RETURN_IF_ERROR(_chunks_partitioner->consume_from_hash_map(
+                [this, state, &add_status](int32_t partition_idx, const ChunkPtr& partition_chunk) {
+                    add_status = add_to_partition_topn_rows(state, partition_idx, partition_chunk);
+                    return add_status.ok();
+                }));
+        RETURN_IF_ERROR(add_status);
+        _is_transfered = true;
+        return Status::OK();
+    }
+
     RETURN_IF_ERROR(
             _chunks_partitioner->consume_from_hash_map([this, state](int32_t partition_idx, const ChunkPtr& chunk) {
                 (void)_chunks_sorters[partition_idx]->update(state, chunk);
@@ -102,9 +236,9 @@ Status LocalPartitionTopnContext::transfer_all_chunks_from_partitioner_to_sorter
 
 bool LocalPartitionTopnContext::has_output() {
     if (_chunks_partitioner->is_passthrough() && _is_transfered) {
-        return _sorter_index < _chunks_sorters.size() || !_chunks_partitioner->is_passthrough_buffer_empty();
+        return _sorter_index < num_sorters() || !_chunks_partitioner->is_passthrough_buffer_empty();
     }
-    return _is_sink_complete && _sorter_index < _chunks_sorters.size();
+    return _is_sink_complete && _sorter_index < num_sorters();
 }
 
 bool LocalPartitionTopnContext::is_finished() {
@@ -116,6 +250,9 @@ bool LocalPartitionTopnContext::is_finished() {
 
 StatusOr<ChunkPtr> LocalPartitionTopnContext::pull_one_chunk() {
     ChunkPtr chunk = nullptr;
+    if (_use_partition_topn_rows) {
+        return pull_one_chunk_from_partition_topn_rows();
+    }
     if (_sorter_index < _chunks_sorters.size()) {
         ASSIGN_OR_RETURN(chunk, pull_one_chunk_from_sorters());
         if (chunk != nullptr) {
@@ -138,6 +275,25 @@ StatusOr<ChunkPtr> LocalPartitionTopnContext::pull_one_chunk_from_sorters() {
     return chunk;
 }
 
+ChunkPtr LocalPartitionTopnContext::pull_one_chunk_from_partition_topn_rows() {
+    // Every partition has at most offset + limit top rows
+    const int64_t max_partition_rows = _offset + _partition_limit;
+    ChunkPtr chunk = nullptr;
+    while (_sorter_index < _partition_topn_rows.size() &&
+           (chunk == nullptr || chunk->num_rows() + max_partition_rows <= _chunk_size)) {
+        auto& topn_rows = _partition_topn_rows[_sorter_index++];
+        const auto& rows = topn_rows.rows();
+        if (rows != nullptr && rows->num_rows() > _offset) {
+            if (chunk == nullptr) {
+                chunk = rows->clone_empty_with_slot(_chunk_size);
+            }
+            chunk->append(*rows, _offset, rows->num_rows() - _offset);
+        }
+        topn_rows.reset();
+    }
+    return chunk;
+}
+
 LocalPartitionTopnContextFactory::LocalPartitionTopnContextFactory(
         RuntimeState*, const TTopNType::type topn_type, bool is_merging, const std::vector<ExprContext*>& sort_exprs,
         std::vector<bool> is_asc_order, std::vector<bool> is_null_first, const std::vector<TExpr>& t_partition_exprs,
@@ -32,6 +32,30 @@ class LocalPartitionTopnContextFactory;
 using LocalPartitionTopnContextPtr = std::shared_ptr<LocalPartitionTopnContext>;
 using LocalPartitionTopnContextFactoryPtr = std::shared_ptr<LocalPartitionTopnContextFactory>;
 
+// The top rows of one partition of ROW_NUMBER with a small limit, which replaces a ChunksSorterTopn per partition
+// when there are a large number of partitions. The rows of a partition come from the partitioner in small batches,
+// and the rows of a batch not less than the last top row are dropped at once, the rest are merged with the top rows
+// by sort, so a partition holds at most `limit` top rows plus a batch whatever its size is.
+class PartitionTopnRows {
+public:
+    // Return the number of rows dropped
+    StatusOr<size_t> add(RuntimeState* state, const std::vector<ExprContext*>& sort_exprs, const SortDescs& sort_descs,
+                         size_t limit, const ChunkPtr& chunk);
+
+    const ChunkPtr& rows() const { return _rows; }
+    void reset() {
+        _rows.reset();
+        _order_by_columns.clear();
+    }
+
+    size_t memory_usage() const;
+
+private:
+    // Sorted top rows and their order by columns
+    ChunkPtr _rows;
+    Columns _order_by_columns;
+};
+
 // LocalPartitionTopnContext is the bridge of each pair of LocalPartitionTopn{Sink/Source}Operators
 // The purpose of LocalPartitionTopn{Sink/Source}Operator is to reduce the amount of data,
 // so the output chunks are still remain unordered
@@ -72,10 +96,21 @@ public:
 
     size_t num_partitions() const { return _partition_num; }
 
+    bool use_partition_topn_rows() const { return _use_partition_topn_rows; }
+    // The memory usage of the top rows of all the partitions
+    size_t partition_topn_rows_memory_usage() const;
+    size_t partition_topn_pruned_rows() const { return _partition_topn_pruned_rows; }
+
 private:
     // Pull one chunk from one of the sorters
     // The output chunk stream is unordered
     [[nodiscard]] StatusOr<ChunkPtr> pull_one_chunk_from_sorters();
+    // Pull the top rows of several partitions as one chunk
+    ChunkPtr pull_one_chunk_from_partition_topn_rows();
+    Status add_to_partition_topn_rows(RuntimeState* state, size_t partition_idx, const ChunkPtr& chunk);
+    size_t num_sorters() const {
+        return _use_partition_topn_rows ? _partition_topn_rows.size() : _chunks_sorters.size();
+    }
 
     const std::vector<TExpr>& _t_partition_exprs;
     std::vector<ExprContext*> _partition_exprs;
@@ -99,6 +134,13 @@ private:
     int64_t _partition_limit;
     const TTopNType::type _topn_type;
 
+    // Use PartitionTopnRows instead of ChunksSorterTopn for each partition, see local_partition_topn_heap_max_limit
+    bool _use_partition_topn_rows = false;
+    std::vector<PartitionTopnRows> _partition_topn_rows;
+    SortDescs _sort_descs;
+    size_t _partition_topn_pruned_rows = 0;
+    int32_t _chunk_size = 0;
+
     int32_t _sorter_index = 0;
 };
 
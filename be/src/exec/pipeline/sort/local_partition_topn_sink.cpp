@@ -14,6 +14,7 @@
 
 #include "exec/pipeline/sort/local_partition_topn_sink.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace starrocks::pipeline {
@@ -44,6 +45,17 @@ Status LocalPartitionTopnSinkOperator::set_finishing(RuntimeState* state) {
     _unique_metrics->add_info_string("IsPassThrough", _partition_topn_ctx->is_passthrough() ? "Yes" : "No");
     auto* partition_num_counter = ADD_COUNTER(_unique_metrics, "PartitionNum", TUnit::UNIT);
     COUNTER_SET(partition_num_counter, static_cast<int64_t>(_partition_topn_ctx->num_partitions()));
+    if (_partition_topn_ctx->use_partition_topn_rows()) {
+        const auto num_partitions = std::max<int64_t>(1, _partition_topn_ctx->num_partitions());
+        const auto memory_usage = static_cast<int64_t>(_partition_topn_ctx->partition_topn_rows_memory_usage());
+        auto* memory_usage_counter = ADD_COUNTER(_unique_metrics, "PartitionTopnRowsMemoryUsage", TUnit::BYTES);
+        auto* avg_memory_usage_counter =
+                ADD_COUNTER(_unique_metrics, "AvgPartitionTopnRowsMemoryUsage", TUnit::BYTES);
+        auto* pruned_rows_counter = ADD_COUNTER(_unique_metrics, "PartitionTopnPrunedRows", TUnit::UNIT);
+        COUNTER_SET(memory_usage_counter, memory_usage);
+        COUNTER_SET(avg_memory_usage_counter, memory_usage / num_partitions);
+        COUNTER_SET(pruned_rows_counter, static_cast<int64_t>(_partition_topn_ctx->partition_topn_pruned_rows()));
+    }
     _is_finished = true;
     return Status::OK();
 }
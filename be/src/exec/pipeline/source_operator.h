@@ -18,6 +18,7 @@
 
 #include "exec/pipeline/adaptive/adaptive_fwd.h"
 #include "exec/pipeline/operator.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/pipeline/scan/chunk_source.h"
 #include "exec/workgroup/work_group_fwd.h"
 
@@ -149,6 +150,11 @@ public:
         return Status::InternalError("Shouldn't push chunk to source operator");
     }
 
+    // Return true if the operator notifies its observer whenever has_output() or is_finished() may become true,
+    // so that the driver blocked on INPUT_EMPTY needn't be polled until being notified.
+    virtual bool is_observable() const { return false; }
+    void set_observer(PipelineObserver* observer) { _observer = observer; }
+
     virtual void add_morsel_queue(MorselQueue* morsel_queue) { _morsel_queue = morsel_queue; };
     MorselQueue* morsel_queue() const { return _morsel_queue; }
 
@@ -160,7 +166,14 @@ public:
 protected:
     const SourceOperatorFactory* _source_factory() const { return down_cast<const SourceOperatorFactory*>(_factory); }
 
+    void notify_observer() {
+        if (_observer != nullptr) {
+            _observer->notify();
+        }
+    }
+
     MorselQueue* _morsel_queue = nullptr;
+    PipelineObserver* _observer = nullptr;
 };
 
 } // namespace pipeline
@@ -197,6 +197,10 @@ void TableFunctionOperator::_copy_result(const std::vector<ColumnPtr>& columns,
     uint32_t curr_output_size = columns[0]->size();
     const auto& fn_result_cols = _table_function_result.first;
     const auto& offsets_col = _table_function_result.second;
+    // the outer row of each output row, the table function results of the output rows are contiguous
+    const uint32_t fn_result_start = _next_output_row;
+    Buffer<uint32_t> outer_rows;
+    outer_rows.reserve(max_output_size - curr_output_size);
     while (curr_output_size < max_output_size && _next_output_row < fn_result_cols[0]->size()) {
         uint32_t start = _next_output_row;
         uint32_t end = offsets_col->get_data()[_next_output_row_offset + 1];
@@ -208,24 +212,8 @@ void TableFunctionOperator::_copy_result(const std::vector<ColumnPtr>& columns,
                 << " _next_output_row_offset=" << _next_output_row_offset
                 << " _input_index_of_first_result=" << _input_index_of_first_result;
 
-        if (copy_rows > 0) {
-            // Build outer data, repeat multiple times
-            for (size_t i = 0; i < _outer_slots.size(); ++i) {
-                ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
-                Datum value = input_column_ptr->get(_input_index_of_first_result + _next_output_row_offset);
-                if (value.is_null()) {
-                    DCHECK(columns[i]->is_nullable());
-                    down_cast<NullableColumn*>(columns[i].get())->append_nulls(copy_rows);
-                } else {
-                    columns[i]->append_value_multiple_times(&value, copy_rows);
-                }
-            }
-
-            // Build table function result
-            for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
-                columns[_outer_slots.size() + i]->append(*(fn_result_cols[i]), start, copy_rows);
-            }
-        }
+        // Build outer data, repeat multiple times
+        outer_rows.insert(outer_rows.end(), copy_rows, _input_index_of_first_result + _next_output_row_offset);
 
         curr_output_size += copy_rows;
         _next_output_row += copy_rows;
@@ -234,6 +222,20 @@ void TableFunctionOperator::_copy_result(const std::vector<ColumnPtr>& columns,
             _next_output_row_offset++;
         }
     }
+    if (outer_rows.empty()) {
+        return;
+    }
+
+    // Replicate the outer columns with one gather each, instead of appending each outer value row by row
+    for (size_t i = 0; i < _outer_slots.size(); ++i) {
+        const ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
+        columns[i]->append_selective(*input_column_ptr, outer_rows);
+    }
+
+    // Build table function result
+    for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
+        columns[_outer_slots.size() + i]->append(*(fn_result_cols[i]), fn_result_start, outer_rows.size());
+    }
 }
 
 } // namespace starrocks::pipeline
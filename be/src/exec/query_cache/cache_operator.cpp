@@ -20,6 +20,7 @@
 
 #include "column/vectorized_fwd.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "exec/pipeline/pipeline_driver.h"
 #include "storage/rowset/rowset.h"
 #include "storage/storage_engine.h"
@@ -183,6 +184,23 @@ Status CacheOperator::prepare(RuntimeState* state) {
     _cache_passthrough_rows_counter = ADD_COUNTER(_unique_metrics, "CachePassthroughRowNum", TUnit::UNIT);
     _cache_passthrough_bytes_counter = ADD_COUNTER(_unique_metrics, "CachePassthroughBytes", TUnit::BYTES);
 
+    _cache_miss_no_entry_counter = ADD_COUNTER(_unique_metrics, "CacheMissNoEntryTabletNum", TUnit::UNIT);
+    _cache_miss_newer_version_counter = ADD_COUNTER(_unique_metrics, "CacheMissNewerVersionTabletNum", TUnit::UNIT);
+    _cache_miss_delta_not_captured_counter =
+            ADD_COUNTER(_unique_metrics, "CacheMissDeltaNotCapturedTabletNum", TUnit::UNIT);
+    _cache_miss_delete_predicate_counter =
+            ADD_COUNTER(_unique_metrics, "CacheMissDeletePredicateTabletNum", TUnit::UNIT);
+    _cache_miss_not_multiversion_counter =
+            ADD_COUNTER(_unique_metrics, "CacheMissNotMultiversionTabletNum", TUnit::UNIT);
+    _cache_miss_delta_too_costly_counter =
+            ADD_COUNTER(_unique_metrics, "CacheMissDeltaTooCostlyTabletNum", TUnit::UNIT);
+
+    _cache_delta_reuse_tablets_counter = ADD_COUNTER(_unique_metrics, "CacheDeltaReuseTabletNum", TUnit::UNIT);
+    _cache_delta_rowsets_counter = ADD_COUNTER(_unique_metrics, "CacheDeltaRowsetNum", TUnit::UNIT);
+    _cache_delta_rows_counter = ADD_COUNTER(_unique_metrics, "CacheDeltaRowNum", TUnit::UNIT);
+    _cache_saved_scan_rows_counter = ADD_COUNTER(_unique_metrics, "CacheSavedScanRowNum", TUnit::UNIT);
+    _cache_saved_scan_bytes_counter = ADD_COUNTER(_unique_metrics, "CacheSavedScanBytes", TUnit::BYTES);
+
     return Status::OK();
 }
 
@@ -238,8 +256,7 @@ void CacheOperator::_handle_stale_cache_value_for_non_pk(int64_t tablet_id, Cach
 
     // Cache MISS if delta versions are not captured, because aggressive cumulative compactions.
     if (!status.ok()) {
-        buffer->state = PLBS_MISS;
-        buffer->cached_version = 0;
+        _mark_miss(buffer, _cache_miss_delta_not_captured_counter);
         return;
     }
 
@@ -248,27 +265,48 @@ void CacheOperator::_handle_stale_cache_value_for_non_pk(int64_t tablet_id, Cach
     auto all_rs_empty = true;
     auto min_version = std::numeric_limits<int64_t>::max();
     auto max_version = std::numeric_limits<int64_t>::min();
+    int64_t delta_rows = 0;
+    int64_t delta_bytes = 0;
     for (const auto& rs : rowsets) {
         all_rs_empty &= !rs->has_data_files();
         min_version = std::min(min_version, rs->start_version());
         max_version = std::max(max_version, rs->end_version());
+        delta_rows += rs->num_rows();
+        delta_bytes += rs->data_disk_size();
     }
     Version delta_versions(min_version, max_version);
     buffer->tablet = tablet;
     auto has_delete_predicates = tablet->has_delete_predicates(delta_versions);
     // case 1: there exist delete predicates in delta versions, or data model can not support multiversion cache and
     // the tablet has non-empty delta rowsets; then cache result is not reuse, so cache miss.
-    if (has_delete_predicates || (!_cache_param.can_use_multiversion && !all_rs_empty)) {
-        buffer->state = PLBS_MISS;
-        buffer->cached_version = 0;
+    if (has_delete_predicates) {
+        _mark_miss(buffer, _cache_miss_delete_predicate_counter);
         return;
     }
+    if (!_cache_param.can_use_multiversion && !all_rs_empty) {
+        _mark_miss(buffer, _cache_miss_not_multiversion_counter);
+        return;
+    }
+    // The partial hit scans the delta rowsets and merges the cached result again, which costs more than
+    // recomputing the tablet when most of its rows are new, e.g. after a large load into a small tablet.
+    if (!all_rs_empty && config::query_cache_delta_reuse_max_cost_ratio > 0) {
+        int64_t cached_rows = 0;
+        for (const auto& chunk : cache_value.result) {
+            cached_rows += chunk->num_rows();
+        }
+        auto total_rows = static_cast<double>(tablet->num_rows());
+        if (delta_rows + cached_rows > total_rows * config::query_cache_delta_reuse_max_cost_ratio) {
+            _mark_miss(buffer, _cache_miss_delta_too_costly_counter);
+            return;
+        }
+    }
 
     buffer->cached_version = cache_value.version;
     auto chunks = remap_chunks(cache_value.result, _cache_param.reverse_slot_remapping);
     _update_probe_metrics(tablet_id, chunks);
     buffer->chunks = std::move(chunks);
     // case 2: all delta versions are empty rowsets, so the cache result is hit totally.
+    _update_saved_scan_metrics(tablet, delta_rows, delta_bytes);
     if (all_rs_empty) {
         buffer->state = PLBS_HIT_TOTAL;
         buffer->chunks.back()->owner_info().set_last_chunk(true);
@@ -278,6 +316,9 @@ void CacheOperator::_handle_stale_cache_value_for_non_pk(int64_t tablet_id, Cach
     // case 3: otherwise, the cache result is partial result of per-tablet computation, so delta versions must
     //  be scanned and merged with cache result to generate total result.
     buffer->state = PLBS_HIT_PARTIAL;
+    _cache_delta_reuse_tablets_counter->update(1);
+    _cache_delta_rowsets_counter->update(rowsets.size());
+    _cache_delta_rows_counter->update(delta_rows);
     buffer->rowsets = std::move(rowsets);
     buffer->rowsets_acq_rel = std::move(rowsets_acq_rel);
     buffer->num_rows = 0;
@@ -297,8 +338,7 @@ void CacheOperator::_handle_stale_cache_value_for_pk(int64_t tablet_id, starrock
     // rowsets. Capturing delta rowsets is meaningless and unsupported, thus we capture all rowsets of the PK tablet.
     auto status = StorageEngine::instance()->tablet_manager()->capture_tablet_and_rowsets(tablet_id, 0, version);
     if (!status.ok()) {
-        buffer->state = PLBS_MISS;
-        buffer->cached_version = 0;
+        _mark_miss(buffer, _cache_miss_delta_not_captured_counter);
         return;
     }
     auto& [tablet, rowsets, rowsets_acq_rel] = status.value();
@@ -309,15 +349,19 @@ void CacheOperator::_handle_stale_cache_value_for_pk(int64_t tablet_id, starrock
         can_pickup_delta_rowsets |= rs->start_version() == snapshot_version + 1;
         exists_non_empty_delta_rowsets |= rs->start_version() > snapshot_version && rs->has_data_files();
     }
-    if (exists_non_empty_delta_rowsets || !can_pickup_delta_rowsets) {
-        buffer->state = PLBS_MISS;
-        buffer->cached_version = 0;
+    if (exists_non_empty_delta_rowsets) {
+        _mark_miss(buffer, _cache_miss_not_multiversion_counter);
+        return;
+    }
+    if (!can_pickup_delta_rowsets) {
+        _mark_miss(buffer, _cache_miss_delta_not_captured_counter);
         return;
     }
 
     buffer->cached_version = cache_value.version;
     auto chunks = remap_chunks(cache_value.result, _cache_param.reverse_slot_remapping);
     _update_probe_metrics(tablet_id, chunks);
+    _update_saved_scan_metrics(tablet, 0, 0);
     buffer->chunks = std::move(chunks);
     buffer->state = PLBS_HIT_TOTAL;
     buffer->chunks.back()->owner_info().set_last_chunk(true);
@@ -336,6 +380,22 @@ void CacheOperator::_update_probe_metrics(int64_t tablet_id, const std::vector<C
     _probe_tablets.insert(tablet_id);
 }
 
+void CacheOperator::_update_saved_scan_metrics(const TabletSharedPtr& tablet, int64_t delta_rows,
+                                               int64_t delta_bytes) {
+    if (tablet == nullptr) {
+        return;
+    }
+    _cache_saved_scan_rows_counter->update(std::max<int64_t>(0, static_cast<int64_t>(tablet->num_rows()) - delta_rows));
+    _cache_saved_scan_bytes_counter->update(
+            std::max<int64_t>(0, static_cast<int64_t>(tablet->tablet_footprint()) - delta_bytes));
+}
+
+void CacheOperator::_mark_miss(PerLaneBufferPtr& buffer, RuntimeProfile::Counter* reason_counter) {
+    buffer->state = PLBS_MISS;
+    buffer->cached_version = 0;
+    reason_counter->update(1);
+}
+
 bool CacheOperator::probe_cache(int64_t tablet_id, int64_t version) {
     _all_tablets.insert(tablet_id);
     // allocate lane and PerLaneBuffer for tablet_id
@@ -357,7 +417,7 @@ bool CacheOperator::probe_cache(int64_t tablet_id, int64_t version) {
 
     // Cache MISS when failed to probe
     if (!probe_status.ok()) {
-        buffer->state = PLBS_MISS;
+        _mark_miss(buffer, _cache_miss_no_entry_counter);
         return false;
     }
 
@@ -369,13 +429,15 @@ bool CacheOperator::probe_cache(int64_t tablet_id, int64_t version) {
         auto chunks = remap_chunks(cache_value.result, _cache_param.reverse_slot_remapping);
         _update_probe_metrics(tablet_id, chunks);
         buffer->chunks = std::move(chunks);
+#ifndef BE_TEST
+        _update_saved_scan_metrics(StorageEngine::instance()->tablet_manager()->get_tablet(tablet_id), 0, 0);
+#endif
     } else if (cache_value.version > version) {
         // It rarely happens that required version is less that cached version, the required version become
         // stale when the query is postponed to be processed because of some reasons, for examples, non-deterministic
         // query scheduling, network congestion etc. make queries be executed out-of-order. so we must prevent stale
         // result from replacing fresh cached result.
-        buffer->state = PLBS_MISS;
-        buffer->cached_version = 0;
+        _mark_miss(buffer, _cache_miss_newer_version_counter);
     } else {
         // Incremental updating cause the cached value become stale, It is a very critical and complex situation.
         // here we support a multi-version cache mechanism.
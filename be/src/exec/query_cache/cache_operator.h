@@ -68,6 +68,8 @@ public:
 
 private:
     void _update_probe_metrics(int64_t, const std::vector<ChunkPtr>& chunks);
+    void _update_saved_scan_metrics(const TabletSharedPtr& tablet, int64_t delta_rows, int64_t delta_bytes);
+    void _mark_miss(PerLaneBufferPtr& buffer, RuntimeProfile::Counter* reason_counter);
     void _handle_stale_cache_value(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer,
                                    int64_t version);
     void _handle_stale_cache_value_for_non_pk(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer,
@@ -107,6 +109,21 @@ private:
     RuntimeProfile::Counter* _cache_passthrough_tablets_counter = nullptr;
     RuntimeProfile::Counter* _cache_passthrough_rows_counter = nullptr;
     RuntimeProfile::Counter* _cache_passthrough_bytes_counter = nullptr;
+
+    // the reasons of the tablets missing the cache
+    RuntimeProfile::Counter* _cache_miss_no_entry_counter = nullptr;
+    RuntimeProfile::Counter* _cache_miss_newer_version_counter = nullptr;
+    RuntimeProfile::Counter* _cache_miss_delta_not_captured_counter = nullptr;
+    RuntimeProfile::Counter* _cache_miss_delete_predicate_counter = nullptr;
+    RuntimeProfile::Counter* _cache_miss_not_multiversion_counter = nullptr;
+    RuntimeProfile::Counter* _cache_miss_delta_too_costly_counter = nullptr;
+
+    // the partial hits only scan the delta rowsets since the cached version
+    RuntimeProfile::Counter* _cache_delta_reuse_tablets_counter = nullptr;
+    RuntimeProfile::Counter* _cache_delta_rowsets_counter = nullptr;
+    RuntimeProfile::Counter* _cache_delta_rows_counter = nullptr;
+    RuntimeProfile::Counter* _cache_saved_scan_rows_counter = nullptr;
+    RuntimeProfile::Counter* _cache_saved_scan_bytes_counter = nullptr;
 };
 
 class CacheOperatorFactory;
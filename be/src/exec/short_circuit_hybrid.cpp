@@ -85,7 +85,10 @@ Status ShortCircuitHybridScanNode::get_next(RuntimeState* state, ChunkPtr* chunk
     auto tablet_schema = _tablets[0]->tablet_schema()->schema();
     auto column_ids = tablet_schema->field_column_ids();
     auto tablet_schema_without_rowstore = std::make_unique<Schema>(tablet_schema, column_ids);
-    auto result_chunk = ChunkHelper::new_chunk(*_tuple_desc, result_size);
+    // point queries run at a high QPS, reuse the columns of the result chunks from the column pool.
+    auto result_chunk = runtime_state()->use_column_pool()
+                                ? ChunkHelper::new_chunk_pooled(_tuple_desc->slots(), result_size)
+                                : ChunkHelper::new_chunk(*_tuple_desc, result_size);
 
     //idx is column id, value is slot id
     if (result_size > 0) {
@@ -128,35 +131,40 @@ Status ShortCircuitHybridScanNode::_process_key_chunk() {
     _key_chunk = ChunkHelper::new_chunk(key_schema, _num_rows);
     _key_chunk->reset();
 
+    // Create, prepare and open the literals of all the keys at once, instead of one expr tree per literal.
+    const size_t num_key_columns = _tablet_schema->num_key_columns();
+    std::vector<TExpr> key_literal_exprs;
+    key_literal_exprs.reserve(_num_rows * num_key_columns);
     for (int i = 0; i < _num_rows; ++i) {
         // TODO (jkj) if expr is k1=1 and k2 in (3, 4), we need bind tablet with expr,
         // tablet 1  <---> k1 =1, k2 =3
         // tablet 2  <---> k1 =1, k2 =4
         // this prune need happen in fe
-        auto keys_literal_expr = (*_key_literal_exprs)[i].literal_exprs;
-        size_t num_pk_filters = keys_literal_expr.size();
+        const auto& keys_literal_expr = (*_key_literal_exprs)[i].literal_exprs;
         // must all columns
-        if (UNLIKELY(num_pk_filters != _tablet_schema->num_key_columns())) {
+        if (UNLIKELY(keys_literal_expr.size() != num_key_columns)) {
             return Status::Corruption("short circuit only support all key predicate");
         }
-        for (int j = 0; j < num_pk_filters; ++j) {
-            // init expr context
-            std::vector<ExprContext*> expr_ctxs;
-            std::vector<TExpr> key_literal_expr{keys_literal_expr[j]};
-            // prepare
-            RETURN_IF_ERROR(Expr::create_expr_trees(runtime_state()->obj_pool(), key_literal_expr, &expr_ctxs,
-                                                    runtime_state()));
-            RETURN_IF_ERROR(Expr::prepare(expr_ctxs, runtime_state()));
-            RETURN_IF_ERROR(Expr::open(expr_ctxs, runtime_state()));
-            auto& iteral_expr_ctx = expr_ctxs[0];
-            ASSIGN_OR_RETURN(ColumnPtr value, iteral_expr_ctx->root()->evaluate_const(iteral_expr_ctx));
-            if (UNLIKELY(value == nullptr || value->only_null() || value->is_null(0))) {
-                return Status::EndOfFile("iteral_expr_ctx evaluated to null, won’t execute here");
-            }
-            // add const column to chunk
-            auto const_column = ColumnHelper::get_data_column(value.get());
-            _key_chunk->get_column_by_index(j)->append(*const_column);
+        key_literal_exprs.insert(key_literal_exprs.end(), keys_literal_expr.begin(), keys_literal_expr.end());
+    }
+    std::vector<ExprContext*> expr_ctxs;
+    RETURN_IF_ERROR(
+            Expr::create_expr_trees(runtime_state()->obj_pool(), key_literal_exprs, &expr_ctxs, runtime_state()));
+    RETURN_IF_ERROR(Expr::prepare(expr_ctxs, runtime_state()));
+    RETURN_IF_ERROR(Expr::open(expr_ctxs, runtime_state()));
+
+    for (size_t j = 0; j < num_key_columns; ++j) {
+        _key_chunk->get_column_by_index(j)->reserve(_num_rows);
+    }
+    for (size_t i = 0; i < expr_ctxs.size(); ++i) {
+        auto* literal_expr_ctx = expr_ctxs[i];
+        ASSIGN_OR_RETURN(ColumnPtr value, literal_expr_ctx->root()->evaluate_const(literal_expr_ctx));
+        if (UNLIKELY(value == nullptr || value->only_null() || value->is_null(0))) {
+            return Status::EndOfFile("iteral_expr_ctx evaluated to null, won’t execute here");
         }
+        // add const column to chunk
+        auto const_column = ColumnHelper::get_data_column(value.get());
+        _key_chunk->get_column_by_index(i % num_key_columns)->append(*const_column);
     }
 
     return Status::OK();
@@ -224,11 +232,14 @@ Status ShortCircuitHybridScanNode::_process_value_chunk(std::vector<bool>& found
     }
 
     // transform  value
+    Buffer<uint32_t> value_indexes;
+    value_indexes.reserve(value_chunk_idx);
     for (int key_idx = 0; key_idx < key_idx_to_value_idx.size(); ++key_idx) {
         if (key_idx_to_value_idx[key_idx] != -1) {
-            _value_chunk->append(*(value_chunk.get()), key_idx_to_value_idx[key_idx], 1);
+            value_indexes.emplace_back(key_idx_to_value_idx[key_idx]);
         }
     }
+    _value_chunk->append_selective(*value_chunk, value_indexes.data(), 0, value_indexes.size());
 
     return Status::OK();
 }
@@ -411,6 +411,14 @@ Status SortedStreamingAggregator::_compute_group_by(size_t chunk_size) {
     _cmp_vector.assign(chunk_size, 0);
     const std::vector<uint8_t> dummy;
     SCOPED_TIMER(_agg_stat->agg_compute_timer);
+    if (_is_single_run(chunk_size)) {
+        // the whole chunk is one group, only compare the first row with the last row of the previous chunk
+        for (size_t i = 0; i < _group_by_columns.size() && _cmp_vector[0] == 0; ++i) {
+            _cmp_vector[0] = _last_columns[i]->empty() ||
+                             _last_columns[i]->compare_at(0, 0, *_group_by_columns[i], 1) != 0;
+        }
+        return Status::OK();
+    }
     for (size_t i = 0; i < _group_by_columns.size(); ++i) {
         ColumnSelfComparator cmp(_last_columns[i], _cmp_vector, dummy);
         RETURN_IF_ERROR(_group_by_columns[i]->accept(&cmp));
@@ -419,6 +427,21 @@ Status SortedStreamingAggregator::_compute_group_by(size_t chunk_size) {
     return Status::OK();
 }
 
+// The input is sorted by the group by columns, so if the first and the last rows of a chunk are in the same
+// group, all the rows between them are too. With long runs of keys, e.g. scanning a table clustered by date,
+// most chunks are a single group and skip the row by row comparison.
+bool SortedStreamingAggregator::_is_single_run(size_t chunk_size) const {
+    if (chunk_size < 2) {
+        return false;
+    }
+    for (const auto& column : _group_by_columns) {
+        if (column->is_constant() || column->compare_at(0, chunk_size - 1, *column, 1) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status SortedStreamingAggregator::_update_states(size_t chunk_size, bool is_update) {
     // TODO: split the states
     // allocate state stage
@@ -450,19 +473,44 @@ Status SortedStreamingAggregator::_update_states(size_t chunk_size, bool is_upda
         }
     }
 
+    // the start of each run of rows sharing a state, a run is updated with one call when the runs are long
+    std::vector<uint32_t> run_starts;
+    for (size_t i = 0; i < _cmp_vector.size(); ++i) {
+        if (i == 0 || _cmp_vector[i] != 0) {
+            run_starts.push_back(i);
+        }
+    }
+    const bool single_run = run_starts.size() == 1;
+    const bool long_runs = run_starts.size() * kMinAvgRunLengthPerStateUpdate <= chunk_size;
+    run_starts.push_back(chunk_size);
+
     // prepare output column
     // batch_update/merge stage
     {
         SCOPED_TIMER(_agg_stat->agg_compute_timer);
         for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
             if (!_is_merge_funcs[i] && is_update) {
-                _agg_functions[i]->update_batch(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i],
-                                                _agg_input_raw_columns[i].data(), _tmp_agg_states.data());
+                if (single_run) {
+                    _agg_functions[i]->update_batch_single_state(_agg_fn_ctxs[i], chunk_size,
+                                                                 _agg_input_raw_columns[i].data(),
+                                                                 _tmp_agg_states[0] + _agg_states_offsets[i]);
+                } else {
+                    _agg_functions[i]->update_batch(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i],
+                                                    _agg_input_raw_columns[i].data(), _tmp_agg_states.data());
+                }
             } else {
                 DCHECK_GE(_agg_input_columns[i].size(), 1);
-                _agg_functions[i]->merge_batch(_agg_fn_ctxs[i], _agg_input_columns[i][0]->size(),
-                                               _agg_states_offsets[i], _agg_input_columns[i][0].get(),
-                                               _tmp_agg_states.data());
+                const Column* input = _agg_input_columns[i][0].get();
+                if (long_runs) {
+                    for (size_t r = 0; r + 1 < run_starts.size(); ++r) {
+                        _agg_functions[i]->merge_batch_single_state(
+                                _agg_fn_ctxs[i], _tmp_agg_states[run_starts[r]] + _agg_states_offsets[i], input,
+                                run_starts[r], run_starts[r + 1] - run_starts[r]);
+                    }
+                } else {
+                    _agg_functions[i]->merge_batch(_agg_fn_ctxs[i], input->size(), _agg_states_offsets[i], input,
+                                                   _tmp_agg_states.data());
+                }
             }
         }
     }
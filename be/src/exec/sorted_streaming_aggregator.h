@@ -37,7 +37,12 @@ public:
     StatusOr<ChunkPtr> pull_eos_chunk();
 
 private:
+    // merge the rows of a run into its state with one call when the runs have at least this many rows on average
+    static constexpr size_t kMinAvgRunLengthPerStateUpdate = 16;
+
     Status _compute_group_by(size_t chunk_size);
+    // whether all the rows of the chunk are in the same group
+    bool _is_single_run(size_t chunk_size) const;
 
     Status _update_states(size_t chunk_size, bool is_update_phase);
     // init selector by _cmp_vector
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 #include <utility>
 
 #include "column/array_column.h"
@@ -23,13 +26,18 @@
 #include "column/column_visitor_adapter.h"
 #include "column/const_column.h"
 #include "column/fixed_length_column_base.h"
+#include "column/german_string.h"
 #include "column/json_column.h"
 #include "column/map_column.h"
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
+#include "common/config.h"
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
+#include "gutil/endian.h"
+#include "types/date_value.h"
+#include "types/timestamp_value.h"
 #include "util/orlp/pdqsort.h"
 
 namespace starrocks {
@@ -100,18 +108,10 @@ public:
 
     template <typename T>
     Status do_visit(const BinaryColumnBase<T>& column) {
-        DCHECK_GE(column.size(), _permutation.size());
-        using ItemType = InlinePermuteItem<Slice>;
-        auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
-            return lhs.inline_value.compare(rhs.inline_value);
-        };
-
-        auto inlined = create_inline_permutation<Slice>(_permutation, column.get_proxy_data());
-        RETURN_IF_ERROR(
-                sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range, _build_tie));
-        restore_inline_permutation(inlined, _permutation);
-
-        return Status::OK();
+        if (config::enable_german_string_sort) {
+            return _sort_binary_column<GermanString>(column);
+        }
+        return _sort_binary_column<Slice>(column);
     }
 
     template <typename T>
@@ -148,6 +148,23 @@ public:
     }
 
 private:
+    // The values are inlined into the permutation as ValueType, a Slice or a GermanString comparing by prefix.
+    template <typename ValueType, typename T>
+    Status _sort_binary_column(const BinaryColumnBase<T>& column) {
+        DCHECK_GE(column.size(), _permutation.size());
+        using ItemType = InlinePermuteItem<ValueType>;
+        auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
+            return lhs.inline_value.compare(rhs.inline_value);
+        };
+
+        auto inlined = create_inline_permutation<ValueType>(_permutation, column.get_proxy_data());
+        RETURN_IF_ERROR(
+                sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range, _build_tie));
+        restore_inline_permutation(inlined, _permutation);
+
+        return Status::OK();
+    }
+
     const std::atomic<bool>& _cancel;
     const SortDesc& _sort_desc;
     SmallPermutation& _permutation;
@@ -212,23 +229,11 @@ public:
         using ColumnType = BinaryColumnBase<T>;
 
         if (_need_inline_value()) {
-            using ItemType = CompactChunkItem<Slice>;
-            using Container = typename BinaryColumnBase<T>::BinaryDataProxyContainer;
-
-            auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
-                return lhs.inline_value.compare(rhs.inline_value);
-            };
-
-            std::vector<const Container*> containers;
-            for (const auto& col : _vertical_columns) {
-                const auto real = down_cast<const ColumnType*>(col.get());
-                containers.push_back(&real->get_proxy_data());
+            if (config::enable_german_string_sort) {
+                RETURN_IF_ERROR(_sort_inlined_binary_columns<GermanString>(column));
+            } else {
+                RETURN_IF_ERROR(_sort_inlined_binary_columns<Slice>(column));
             }
-
-            auto inlined = _create_inlined_permutation<Slice>(containers);
-            RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range,
-                                                _build_tie, _limit, &_pruned_limit));
-            _restore_inlined_permutation(inlined);
         } else {
             auto cmp = [&](const PermutationItem& lhs, const PermutationItem& rhs) {
                 auto left_column = down_cast<const ColumnType*>(_vertical_columns[lhs.chunk_index].get());
@@ -348,6 +353,29 @@ private:
     template <class T>
     using CompactChunkPermutation = std::vector<CompactChunkItem<T>>;
 
+    template <typename ValueType, typename T>
+    Status _sort_inlined_binary_columns(const BinaryColumnBase<T>& column) {
+        using ColumnType = BinaryColumnBase<T>;
+        using ItemType = CompactChunkItem<ValueType>;
+        using Container = typename BinaryColumnBase<T>::BinaryDataProxyContainer;
+
+        auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
+            return lhs.inline_value.compare(rhs.inline_value);
+        };
+
+        std::vector<const Container*> containers;
+        for (const auto& col : _vertical_columns) {
+            const auto real = down_cast<const ColumnType*>(col.get());
+            containers.push_back(&real->get_proxy_data());
+        }
+
+        auto inlined = _create_inlined_permutation<ValueType>(containers);
+        RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range,
+                                            _build_tie, _limit, &_pruned_limit));
+        _restore_inlined_permutation(inlined);
+        return Status::OK();
+    }
+
     bool _need_inline_value() {
         // TODO: figure out the inflection point
         // If limit exceeds 1/5 rows, inline will has benefits
@@ -464,6 +492,279 @@ Status stable_sort_and_tie_columns(const std::atomic<bool>& cancel, const Column
     return Status::OK();
 }
 
+Status stable_radix_sort_encoded_keys(const std::atomic<bool>& cancel, const BinaryColumn& keys,
+                                      SmallPermutation* small_perm) {
+    // The ranges of at most this number of rows are sorted by comparing the remaining bytes of the keys.
+    static constexpr size_t kComparisonSortThreshold = 64;
+    // The bucket 0 is for the keys ending before the byte, which go before the longer keys of the same prefix.
+    static constexpr size_t kNumBuckets = 257;
+    struct Range {
+        size_t begin;
+        size_t end;
+        // The keys of the range share the first `depth` bytes.
+        size_t depth;
+    };
+
+    const size_t num_rows = keys.size();
+    DCHECK_EQ(num_rows, small_perm->size());
+    const Bytes& bytes = keys.get_bytes();
+    const auto& offsets = keys.get_offset();
+    auto& perm = *small_perm;
+    std::vector<SmallPermuteItem> buffer(num_rows);
+    std::vector<uint16_t> digits(num_rows);
+    size_t counts[kNumBuckets];
+    size_t starts[kNumBuckets];
+
+    std::vector<Range> ranges{{0, num_rows, 0}};
+    while (!ranges.empty()) {
+        if (UNLIKELY(cancel.load(std::memory_order_acquire))) {
+            return Status::Cancelled("Sort cancelled");
+        }
+        const Range range = ranges.back();
+        ranges.pop_back();
+        const size_t begin = range.begin;
+        const size_t end = range.end;
+        const size_t depth = range.depth;
+
+        if (end - begin <= kComparisonSortThreshold) {
+            auto suffix = [&](SmallPermuteItem item) {
+                const uint32_t row = item.index_in_chunk;
+                return Slice(bytes.data() + offsets[row] + depth, offsets[row + 1] - offsets[row] - depth);
+            };
+            std::stable_sort(perm.begin() + begin, perm.begin() + end,
+                             [&](SmallPermuteItem lhs, SmallPermuteItem rhs) {
+                                 return suffix(lhs).compare(suffix(rhs)) < 0;
+                             });
+            continue;
+        }
+
+        std::fill(counts, counts + kNumBuckets, 0);
+        for (size_t i = begin; i < end; i++) {
+            const uint32_t row = perm[i].index_in_chunk;
+            const size_t pos = offsets[row] + depth;
+            digits[i] = pos < offsets[row + 1] ? bytes[pos] + 1 : 0;
+            counts[digits[i]]++;
+        }
+        if (counts[digits[begin]] == end - begin) {
+            // All the keys share the byte, or all of them end here.
+            if (digits[begin] != 0) {
+                ranges.push_back({begin, end, depth + 1});
+            }
+            continue;
+        }
+
+        for (size_t b = 0, pos = begin; b < kNumBuckets; b++) {
+            starts[b] = pos;
+            pos += counts[b];
+            if (b > 0 && counts[b] > 1) {
+                ranges.push_back({starts[b], pos, depth + 1});
+            }
+        }
+        // Scatter in the order of the range, which keeps the sort stable.
+        for (size_t i = begin; i < end; i++) {
+            buffer[starts[digits[i]]++] = perm[i];
+        }
+        std::copy(buffer.begin() + begin, buffer.begin() + end, perm.begin() + begin);
+    }
+    return Status::OK();
+}
+
+// Encode one sort column into the normalized keys of the rows, which are memcmp-able prefixes of fixed
+// kNormalizedKeyBytes bytes: a null byte for the nullable columns, then the big endian value with the sign bit flipped,
+// or the leading bytes of the string, and all of the value bytes inverted for the descending order.
+// The integer-like columns are encoded exactly if they fit in the remaining bytes, and truncated otherwise.
+class NormalizedKeyEncoder final : public ColumnVisitorAdapter<NormalizedKeyEncoder> {
+public:
+    static constexpr size_t kNormalizedKeyBytes = 16;
+
+    NormalizedKeyEncoder(SortDesc sort_desc, uint8_t* keys, size_t num_rows, size_t offset)
+            : ColumnVisitorAdapter(this), _sort_desc(sort_desc), _keys(keys), _num_rows(num_rows), _offset(offset) {}
+
+    // The bytes of the key taken by the column.
+    size_t encoded_bytes() const { return _encoded_bytes; }
+    // Whether the rows of the same encoded bytes are equal on the column.
+    bool exact() const { return _exact; }
+
+    Status do_visit(const NullableColumn& column) {
+        _nulls = column.has_null() ? column.immutable_null_column_data().data() : nullptr;
+        _nullable = true;
+        return column.data_column_ref().accept(this);
+    }
+
+    template <typename T>
+    Status do_visit(const BinaryColumnBase<T>& column) {
+        const size_t value_bytes = _value_bytes(std::numeric_limits<size_t>::max());
+        if (value_bytes == 0) {
+            return Status::NotSupported("no room in the normalized key");
+        }
+        const uint8_t flip = _sort_desc.asc_order() ? 0 : 0xFF;
+        for (size_t row = 0; row < _num_rows; row++) {
+            uint8_t* key = _encode_null(row);
+            if (key == nullptr) {
+                continue;
+            }
+            const Slice value = column.get_slice(row);
+            const size_t n = std::min(value.size, value_bytes);
+            for (size_t b = 0; b < n; b++) {
+                key[b] = static_cast<uint8_t>(value.data[b]) ^ flip;
+            }
+            std::memset(key + n, flip, value_bytes - n);
+        }
+        // The strings longer than the prefix, or ending with zeros, are not told apart by the prefix.
+        _exact = false;
+        return Status::OK();
+    }
+
+    template <typename T>
+    Status do_visit(const FixedLengthColumnBase<T>& column) {
+        const auto& data = column.get_data();
+        if constexpr (std::is_same_v<T, DateValue>) {
+            return _encode_integers<int32_t, uint32_t>([&](size_t row) { return data[row].julian(); });
+        } else if constexpr (std::is_same_v<T, TimestampValue>) {
+            return _encode_integers<int64_t, uint64_t>([&](size_t row) { return data[row].timestamp(); });
+        } else if constexpr (std::is_same_v<T, int128_t>) {
+            return _encode_integers<int128_t, uint128_t>([&](size_t row) { return data[row]; });
+        } else if constexpr (std::is_integral_v<T>) {
+            return _encode_integers<T, std::make_unsigned_t<T>>([&](size_t row) { return data[row]; });
+        } else {
+            // The floating points are left to the comparison, to keep the order of -0.0 and NaN of the comparators.
+            return Status::NotSupported("type not supported by the normalized key");
+        }
+    }
+
+    Status do_visit(const ConstColumn& column) { return Status::NotSupported("const column"); }
+    Status do_visit(const ArrayColumn& column) { return Status::NotSupported("array column"); }
+    Status do_visit(const MapColumn& column) { return Status::NotSupported("map column"); }
+    Status do_visit(const StructColumn& column) { return Status::NotSupported("struct column"); }
+    Status do_visit(const JsonColumn& column) { return Status::NotSupported("json column"); }
+    template <typename T>
+    Status do_visit(const ObjectColumn<T>& column) {
+        return Status::NotSupported("object column");
+    }
+
+private:
+    // The value bytes left after the null byte, at most `max_bytes`.
+    size_t _value_bytes(size_t max_bytes) {
+        const size_t header = _nullable ? 1 : 0;
+        if (_offset + header >= kNormalizedKeyBytes) {
+            return 0;
+        }
+        const size_t value_bytes = std::min(max_bytes, kNormalizedKeyBytes - _offset - header);
+        _encoded_bytes = header + value_bytes;
+        return value_bytes;
+    }
+
+    // Write the null byte of the row, and return where the value goes, or nullptr if the value is null.
+    // The nulls are ordered by the null byte, and their value bytes are left zero.
+    uint8_t* _encode_null(size_t row) {
+        uint8_t* key = _keys + row * kNormalizedKeyBytes + _offset;
+        if (!_nullable) {
+            return key;
+        }
+        const bool is_null = _nulls != nullptr && _nulls[row];
+        key[0] = (is_null == _sort_desc.is_null_first()) ? 0 : 1;
+        return is_null ? nullptr : key + 1;
+    }
+
+    template <typename S, typename U, typename GetValue>
+    Status _encode_integers(GetValue get_value) {
+        const size_t value_bytes = _value_bytes(sizeof(U));
+        if (value_bytes == 0) {
+            return Status::NotSupported("no room in the normalized key");
+        }
+        const uint8_t flip = _sort_desc.asc_order() ? 0 : 0xFF;
+        const U sign = std::is_signed_v<S> || std::is_same_v<S, int128_t> ? U(1) << (sizeof(U) * 8 - 1) : U(0);
+        for (size_t row = 0; row < _num_rows; row++) {
+            uint8_t* key = _encode_null(row);
+            if (key == nullptr) {
+                continue;
+            }
+            const U value = static_cast<U>(get_value(row)) ^ sign;
+            for (size_t b = 0; b < value_bytes; b++) {
+                key[b] = static_cast<uint8_t>(value >> (8 * (sizeof(U) - 1 - b))) ^ flip;
+            }
+        }
+        _exact = value_bytes == sizeof(U);
+        return Status::OK();
+    }
+
+    const SortDesc _sort_desc;
+    uint8_t* _keys;
+    const size_t _num_rows;
+    const size_t _offset;
+
+    bool _nullable = false;
+    const uint8_t* _nulls = nullptr;
+    size_t _encoded_bytes = 0;
+    bool _exact = false;
+};
+
+Status sort_and_tie_columns_by_normalized_key(const std::atomic<bool>& cancel, const Columns& columns,
+                                              const SortDescs& sort_desc, Permutation* permutation) {
+    if (columns.size() < 1) {
+        return Status::OK();
+    }
+    constexpr size_t kKeyBytes = NormalizedKeyEncoder::kNormalizedKeyBytes;
+    const size_t num_rows = columns[0]->size();
+
+    // Encode the leading columns until the key is full, or a column is truncated or not supported.
+    std::vector<uint8_t> keys(num_rows * kKeyBytes, 0);
+    size_t offset = 0;
+    size_t num_encoded_columns = 0;
+    bool exact = true;
+    while (exact && num_encoded_columns < columns.size() && offset < kKeyBytes) {
+        NormalizedKeyEncoder encoder(sort_desc.get_column_desc(num_encoded_columns), keys.data(), num_rows, offset);
+        if (!columns[num_encoded_columns]->accept(&encoder).ok()) {
+            break;
+        }
+        offset += encoder.encoded_bytes();
+        exact = encoder.exact();
+        num_encoded_columns++;
+    }
+    if (num_encoded_columns == 0) {
+        return sort_and_tie_columns(cancel, columns, sort_desc, permutation);
+    }
+
+    struct NormalizedKeyItem {
+        uint64_t high;
+        uint64_t low;
+        uint32_t index_in_chunk;
+    };
+    std::vector<NormalizedKeyItem> items(num_rows);
+    for (size_t row = 0; row < num_rows; row++) {
+        const uint8_t* key = keys.data() + row * kKeyBytes;
+        items[row] = {BigEndian::Load64(key), BigEndian::Load64(key + 8), static_cast<uint32_t>(row)};
+    }
+    std::vector<uint8_t>().swap(keys);
+    if (UNLIKELY(cancel.load(std::memory_order_acquire))) {
+        return Status::Cancelled("Sort cancelled");
+    }
+    ::pdqsort_branchless(items.begin(), items.end(), [](const NormalizedKeyItem& lhs, const NormalizedKeyItem& rhs) {
+        return lhs.high < rhs.high || (lhs.high == rhs.high && lhs.low < rhs.low);
+    });
+
+    // Only the rows of the same key are compared by the remaining columns, starting from the truncated one.
+    SmallPermutation small_perm(num_rows);
+    Tie tie(num_rows, 0);
+    for (size_t i = 0; i < num_rows; i++) {
+        small_perm[i].index_in_chunk = items[i].index_in_chunk;
+        if (i > 0) {
+            tie[i] = items[i].high == items[i - 1].high && items[i].low == items[i - 1].low;
+        }
+    }
+    std::pair<int, int> range{0, num_rows};
+    const size_t first_tie_column = exact ? num_encoded_columns : num_encoded_columns - 1;
+    for (size_t col_index = first_tie_column; col_index < columns.size(); col_index++) {
+        ColumnPtr column = columns[col_index];
+        bool build_tie = col_index != columns.size() - 1;
+        RETURN_IF_ERROR(sort_and_tie_column(cancel, column, sort_desc.get_column_desc(col_index), small_perm, tie,
+                                            range, build_tie));
+    }
+
+    restore_small_permutation(small_perm, *permutation);
+    return Status::OK();
+}
+
 Status sort_vertical_columns(const std::atomic<bool>& cancel, const std::vector<ColumnPtr>& columns,
                              const SortDesc& sort_desc, Permutation& permutation, Tie& tie, std::pair<int, int> range,
                              const bool build_tie, const size_t limit, size_t* limited) {
@@ -41,10 +41,21 @@ Status sort_and_tie_column(const std::atomic<bool>& cancel, const ColumnPtr& col
 Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
                             Permutation* permutation);
 
+// Sort multiple columns by the memcmp-able normalized keys encoded from the leading columns, and compare the columns
+// only for the rows of the same key. Same order as sort_and_tie_columns, which it falls back to if the first column
+// could not be encoded.
+Status sort_and_tie_columns_by_normalized_key(const std::atomic<bool>& cancel, const Columns& columns,
+                                              const SortDescs& sort_desc, Permutation* permutation);
+
 // Sort multiple columns, and stable
 Status stable_sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
                                    SmallPermutation* permutation);
 
+// Sort the rows by the memcmp order of their memcmp-able encoded keys, e.g. the ones encoded by
+// PrimaryKeyEncoder::encode_sort_key(), by a MSD radix sort on the bytes of the keys, and stable
+Status stable_radix_sort_encoded_keys(const std::atomic<bool>& cancel, const BinaryColumn& keys,
+                                      SmallPermutation* permutation);
+
 // Sort multiple columns in vertical
 Status sort_vertical_columns(const std::atomic<bool>& cancel, const std::vector<ColumnPtr>& columns,
                              const SortDesc& sort_desc, Permutation& permutation, Tie& tie, std::pair<int, int> range,
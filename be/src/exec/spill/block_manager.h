@@ -77,6 +77,10 @@ struct AcquireBlockOptions {
     std::string name;
     bool direct_io = false;
     size_t block_size = 0;
+    // the data will not be restored soon, e.g. it belongs to one of the last partitions to be restored
+    // by a partitioned spiller. HyBirdBlockManager prefers to put such blocks in remote storage so that
+    // the local disks are kept for the data restored first.
+    bool is_cold = false;
 };
 
 // BlockManager is used to manage the life cycle of the Block.
@@ -25,8 +25,8 @@ namespace starrocks::spill {
 // spill output stream. output serialized chunk data to BlockManager and add handle to block group.
 class BlockSpillOutputDataStream final : public SpillOutputDataStream {
 public:
-    BlockSpillOutputDataStream(Spiller* spiller, BlockGroup* block_group, BlockManager* block_manager)
-            : _spiller(spiller), _block_group(block_group), _block_manager(block_manager) {}
+    BlockSpillOutputDataStream(Spiller* spiller, BlockGroup* block_group, BlockManager* block_manager, bool is_cold)
+            : _spiller(spiller), _block_group(block_group), _block_manager(block_manager), _is_cold(is_cold) {}
     ~BlockSpillOutputDataStream() override = default;
 
     Status append(RuntimeState* state, const std::vector<Slice>& data, size_t total_write_size) override;
@@ -48,6 +48,7 @@ private:
 
     BlockGroup* _block_group{};
     BlockManager* _block_manager{};
+    bool _is_cold = false;
 };
 
 Status BlockSpillOutputDataStream::_prepare_block(RuntimeState* state, size_t write_size) {
@@ -61,6 +62,7 @@ Status BlockSpillOutputDataStream::_prepare_block(RuntimeState* state, size_t wr
         opts.plan_node_id = _spiller->options().plan_node_id;
         opts.name = _spiller->options().name;
         opts.block_size = write_size;
+        opts.is_cold = _is_cold;
         ASSIGN_OR_RETURN(auto block, _block_manager->acquire_block(opts));
         // update metrics
         auto block_count = GET_METRICS(block->is_remote(), _spiller->metrics(), block_count);
@@ -105,8 +107,8 @@ Status BlockSpillOutputDataStream::flush() {
 }
 
 std::shared_ptr<SpillOutputDataStream> create_spill_output_stream(Spiller* spiller, BlockGroup* block_group,
-                                                                  BlockManager* block_manager) {
-    return std::make_shared<BlockSpillOutputDataStream>(spiller, block_group, block_manager);
+                                                                  BlockManager* block_manager, bool is_cold) {
+    return std::make_shared<BlockSpillOutputDataStream>(spiller, block_group, block_manager, is_cold);
 }
 
 } // namespace starrocks::spill
\ No newline at end of file
@@ -31,7 +31,8 @@ public:
     virtual bool is_remote() const = 0;
 };
 using SpillOutputDataStreamPtr = std::shared_ptr<SpillOutputDataStream>;
+// is_cold: the data written into the stream will not be restored soon, see AcquireBlockOptions::is_cold
 SpillOutputDataStreamPtr create_spill_output_stream(Spiller* spiller, BlockGroup* block_group,
-                                                    BlockManager* block_manager);
+                                                    BlockManager* block_manager, bool is_cold = false);
 
 } // namespace starrocks::spill
\ No newline at end of file
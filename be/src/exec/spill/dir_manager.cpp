@@ -118,4 +118,14 @@ StatusOr<DirPtr> DirManager::acquire_writable_dir(const AcquireDirOptions& opts)
     return Status::CapacityLimitExceed("no writable spill storage directories");
 }
 
+double DirManager::usage_ratio() const {
+    int64_t total_size = 0;
+    int64_t max_size = 0;
+    for (const auto& dir : _dirs) {
+        total_size += dir->get_current_size();
+        max_size += dir->get_max_size();
+    }
+    return max_size > 0 ? static_cast<double>(total_size) / max_size : 1.0;
+}
+
 } // namespace starrocks::spill
\ No newline at end of file
@@ -96,6 +96,9 @@ public:
 
     StatusOr<DirPtr> acquire_writable_dir(const AcquireDirOptions& opts);
 
+    // the used ratio of the total capacity of all dirs
+    double usage_ratio() const;
+
 private:
     bool is_same_disk(const std::string& path1, const std::string& path2) {
         struct statfs stat1, stat2;
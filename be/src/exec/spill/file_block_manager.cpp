@@ -14,13 +14,17 @@
 
 #include "exec/spill/file_block_manager.h"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
+#include "common/config.h"
 #include "exec/spill/common.h"
 #include "fmt/format.h"
 #include "gen_cpp/Types_types.h"
 #include "gutil/casts.h"
 #include "util/defer_op.h"
+#include "util/raw_container.h"
 #include "util/uid_util.h"
 
 namespace starrocks::spill {
@@ -152,9 +156,16 @@ public:
     const Block* block() const override { return _block; }
 
 private:
+    // read ahead up to spill_remote_read_buffer_bytes from remote storage, so that restoring a chunk
+    // does not cost two small requests for its header and its data.
+    Status _read_buffered(void* data, int64_t count);
+    Status _read_at_most(void* data, int64_t count, int64_t* read_len);
+
     std::unique_ptr<io::InputStreamWrapper> _readable;
     size_t _length = 0;
     size_t _offset = 0;
+    raw::RawString _buffer;
+    size_t _buffer_offset = 0;
 };
 
 class FileBlock : public Block {
@@ -202,6 +213,9 @@ Status FileBlockReader::read_fully(void* data, int64_t count) {
     if (_offset + count > _length) {
         return Status::EndOfFile("no more data in this block");
     }
+    if (_block->is_remote() && config::spill_remote_read_buffer_bytes > 0) {
+        return _read_buffered(data, count);
+    }
 
     ASSIGN_OR_RETURN(auto read_len, _readable->read(data, count));
     RETURN_IF(read_len == 0, Status::EndOfFile("no more data in this block"));
@@ -211,6 +225,55 @@ Status FileBlockReader::read_fully(void* data, int64_t count) {
     return Status::OK();
 }
 
+Status FileBlockReader::_read_at_most(void* data, int64_t count, int64_t* read_len) {
+    *read_len = 0;
+    while (*read_len < count) {
+        ASSIGN_OR_RETURN(auto n, _readable->read(static_cast<uint8_t*>(data) + *read_len, count - *read_len));
+        if (n == 0) {
+            break;
+        }
+        *read_len += n;
+    }
+    return Status::OK();
+}
+
+Status FileBlockReader::_read_buffered(void* data, int64_t count) {
+    auto* dst = static_cast<uint8_t*>(data);
+    int64_t remaining = count;
+    while (remaining > 0) {
+        if (_buffer_offset == _buffer.size()) {
+            // _offset counts the bytes handed out, the bytes read from the file are _offset plus the buffered ones
+            size_t file_offset = _offset + (count - remaining);
+            size_t to_read = std::min<size_t>(config::spill_remote_read_buffer_bytes, _length - file_offset);
+            if (to_read == 0) {
+                return Status::EndOfFile("no more data in this block");
+            }
+            if (static_cast<size_t>(remaining) >= to_read) {
+                // the caller's buffer is larger than the read ahead, read into it directly
+                int64_t read_len = 0;
+                RETURN_IF_ERROR(_read_at_most(dst, remaining, &read_len));
+                RETURN_IF(read_len != remaining,
+                          Status::InternalError(fmt::format("block's length is mismatched, expected: {}, actual: {}",
+                                                            remaining, read_len)));
+                break;
+            }
+            _buffer.resize(to_read);
+            _buffer_offset = 0;
+            int64_t read_len = 0;
+            RETURN_IF_ERROR(_read_at_most(_buffer.data(), to_read, &read_len));
+            RETURN_IF(read_len == 0, Status::EndOfFile("no more data in this block"));
+            _buffer.resize(read_len);
+        }
+        size_t n = std::min<size_t>(remaining, _buffer.size() - _buffer_offset);
+        memcpy(dst, _buffer.data() + _buffer_offset, n);
+        _buffer_offset += n;
+        dst += n;
+        remaining -= n;
+    }
+    _offset += count;
+    return Status::OK();
+}
+
 FileBlockManager::FileBlockManager(const TUniqueId& query_id, DirManager* dir_mgr)
         : _query_id(query_id), _dir_mgr(dir_mgr) {}
 
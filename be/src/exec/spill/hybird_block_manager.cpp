@@ -14,14 +14,18 @@
 
 #include "exec/spill/hybird_block_manager.h"
 
+#include "common/config.h"
+#include "exec/spill/dir_manager.h"
 #include "util/failpoint/fail_point.h"
 
 namespace starrocks::spill {
 
 HyBirdBlockManager::HyBirdBlockManager(const TUniqueId& query_id, std::unique_ptr<BlockManager> local_block_manager,
-                                       std::unique_ptr<BlockManager> remote_block_manager)
+                                       std::unique_ptr<BlockManager> remote_block_manager,
+                                       const DirManager* local_dir_mgr)
         : _local_block_manager(std::move(local_block_manager)),
-          _remote_block_manager(std::move(remote_block_manager)) {}
+          _remote_block_manager(std::move(remote_block_manager)),
+          _local_dir_mgr(local_dir_mgr) {}
 
 HyBirdBlockManager::~HyBirdBlockManager() {
     _local_block_manager.reset();
@@ -44,6 +48,10 @@ DEFINE_FAIL_POINT(force_allocate_remote_block);
 StatusOr<BlockPtr> HyBirdBlockManager::acquire_block(const AcquireBlockOptions& opts) {
     bool enable_allocate_local_block = true;
     FAIL_POINT_TRIGGER_EXECUTE(force_allocate_remote_block, { enable_allocate_local_block = false; });
+    if (opts.is_cold && _local_dir_mgr != nullptr &&
+        _local_dir_mgr->usage_ratio() >= config::spill_local_cold_block_max_usage_ratio) {
+        enable_allocate_local_block = false;
+    }
     if (enable_allocate_local_block) {
         auto local_block = _local_block_manager->acquire_block(opts);
         if (local_block.ok()) {
@@ -18,13 +18,17 @@
 
 namespace starrocks::spill {
 
+class DirManager;
+
 // HybirdManager contains two independent BlockManagers, which manage local blocks and remote blocks respectively.
 // If the local disk capacity is large enough, we will allocate blocks from the local disk first,
 // otherwise allocate them from the remote storage.
+// Cold blocks (see AcquireBlockOptions::is_cold) go to the remote storage once the local dirs are used more than
+// spill_local_cold_block_max_usage_ratio, which keeps the rest of the local capacity for the data restored first.
 class HyBirdBlockManager : public BlockManager {
 public:
     HyBirdBlockManager(const TUniqueId& query_id, std::unique_ptr<BlockManager> local_block_manager,
-                       std::unique_ptr<BlockManager> remote_block_manager);
+                       std::unique_ptr<BlockManager> remote_block_manager, const DirManager* local_dir_mgr = nullptr);
     ~HyBirdBlockManager() override;
 
     Status open() override;
@@ -35,6 +39,7 @@ public:
 private:
     std::unique_ptr<BlockManager> _local_block_manager;
     std::unique_ptr<BlockManager> _remote_block_manager;
+    const DirManager* _local_dir_mgr = nullptr;
 };
 
 } // namespace starrocks::spill
\ No newline at end of file
@@ -34,6 +34,7 @@ void OperatorMemoryResourceManager::to_low_memory_mode() {
         _op->set_execute_mode(_performance_level);
         if (_spillable) {
             _query_spill_manager->increase_spilling_operators();
+            _query_spill_manager->remove_operator(_op);
         }
         if (_op->releaseable()) {
             set_releasing();
@@ -43,7 +44,10 @@ void OperatorMemoryResourceManager::to_low_memory_mode() {
 
 size_t OperatorMemoryResourceManager::operator_avaliable_memory_bytes() {
     // TODO: think about multi-operators
-    auto* runtime_state = _op->runtime_state();
+    return operator_avaliable_memory_bytes(_op->runtime_state());
+}
+
+size_t OperatorMemoryResourceManager::operator_avaliable_memory_bytes(RuntimeState* runtime_state) {
     size_t avaliable = runtime_state->spill_mem_table_size() * runtime_state->spill_mem_table_num();
     avaliable = std::max<size_t>(avaliable, runtime_state->spill_operator_min_bytes());
     avaliable = std::min<size_t>(avaliable, runtime_state->spill_operator_max_bytes());
@@ -51,6 +55,9 @@ size_t OperatorMemoryResourceManager::operator_avaliable_memory_bytes() {
 }
 
 void OperatorMemoryResourceManager::close() {
+    if (_spillable && _query_spill_manager != nullptr) {
+        _query_spill_manager->remove_operator(_op);
+    }
     if (_performance_level == MEM_RESOURCE_LOW_MEMORY && _query_spill_manager != nullptr) {
         _query_spill_manager->decrease_spilling_operators();
         _query_spill_manager->decrease_spillable_operators();
@@ -17,6 +17,10 @@
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/spill/query_spill_manager.h"
 
+namespace starrocks {
+class RuntimeState;
+}
+
 namespace starrocks::spill {
 enum MEM_RESOURCE {
     MEM_RESOURCE_DEFAULE_MEMORY = 0,
@@ -40,6 +44,7 @@ public:
 
     // For the current operator available memory (estimated value)
     size_t operator_avaliable_memory_bytes();
+    static size_t operator_avaliable_memory_bytes(RuntimeState* state);
 
     void set_releasing() { _is_releasing = true; }
 
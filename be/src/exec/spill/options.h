@@ -80,6 +80,9 @@ struct SpilledOptions {
     size_t mem_table_pool_size{};
     // memory table peak mem usage
     size_t spill_mem_table_bytes_size{};
+    // a spilled partition larger than this is split into the next level, so that each partition
+    // can be restored within the memory budget. 0 means spill_mem_table_bytes_size.
+    size_t max_partition_bytes = 0;
     // spilled format type
     SpillFormaterType spill_type{};
 
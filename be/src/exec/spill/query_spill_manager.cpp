@@ -25,6 +25,32 @@
 
 namespace starrocks::spill {
 
+void QuerySpillManager::update_revocable_bytes(const void* op, size_t bytes) {
+    std::lock_guard l(_revocable_bytes_mutex);
+    _revocable_bytes[op] = bytes;
+}
+
+void QuerySpillManager::remove_operator(const void* op) {
+    std::lock_guard l(_revocable_bytes_mutex);
+    _revocable_bytes.erase(op);
+}
+
+bool QuerySpillManager::is_spill_candidate(const void* op, int64_t bytes_to_free) {
+    std::lock_guard l(_revocable_bytes_mutex);
+    auto iter = _revocable_bytes.find(op);
+    if (iter == _revocable_bytes.end()) {
+        return true;
+    }
+    // the operators spilled before op, ties are broken by address to have a stable order
+    int64_t larger_bytes = 0;
+    for (const auto& [other, bytes] : _revocable_bytes) {
+        if (other != op && (bytes > iter->second || (bytes == iter->second && other < op))) {
+            larger_bytes += bytes;
+        }
+    }
+    return larger_bytes < bytes_to_free;
+}
+
 Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options) {
     bool enable_spill_to_remote_storage =
             query_options.__isset.enable_spill_to_remote_storage && query_options.enable_spill_to_remote_storage;
@@ -63,8 +89,9 @@ Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options)
     // init block manager
     auto local_block_manager = std::make_unique<LogBlockManager>(_uid, ExecEnv::GetInstance()->spill_dir_mgr());
     auto remote_block_manager = std::make_unique<FileBlockManager>(_uid, _remote_dir_manager.get());
-    _block_manager =
-            std::make_unique<HyBirdBlockManager>(_uid, std::move(local_block_manager), std::move(remote_block_manager));
+    _block_manager = std::make_unique<HyBirdBlockManager>(_uid, std::move(local_block_manager),
+                                                          std::move(remote_block_manager),
+                                                          ExecEnv::GetInstance()->spill_dir_mgr());
 
     return Status::OK();
 }
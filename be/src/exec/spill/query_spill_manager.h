@@ -41,11 +41,22 @@ public:
 
     BlockManager* block_manager() const { return _block_manager.get(); }
 
+    // Under memory pressure, the spillable operators of the query are moved to low memory mode one by one,
+    // from the one holding the most revocable memory, which frees the most memory for the fixed cost of a spill.
+    // Operators report their revocable bytes with update_revocable_bytes until they spill or close.
+    void update_revocable_bytes(const void* op, size_t bytes);
+    void remove_operator(const void* op);
+    // whether op is among the operators holding the most revocable memory which together free bytes_to_free
+    bool is_spill_candidate(const void* op, int64_t bytes_to_free);
+
 private:
     TUniqueId _uid;
     std::unique_ptr<BlockManager> _block_manager;
     std::unique_ptr<DirManager> _remote_dir_manager;
     std::atomic_size_t _spilling_operators = 0;
     size_t _spillable_operators = 0;
+
+    std::mutex _revocable_bytes_mutex;
+    std::unordered_map<const void*, size_t> _revocable_bytes;
 };
 } // namespace starrocks::spill
@@ -23,10 +23,30 @@
 #include "runtime/runtime_state.h"
 #include "serde/column_array_serde.h"
 #include "serde/encode_context.h"
+#include "util/compression/block_compression.h"
 #include "util/raw_container.h"
 
 namespace starrocks::spill {
 
+// Besides the column encodings of serde::EncodeContext, the higher bits of spill_encode_level choose a block
+// compression applied to the whole serialized chunk.
+static constexpr int ENCODE_COMPRESS_LZ4 = 16;
+static constexpr int ENCODE_COMPRESS_ZSTD = 32;
+static constexpr int COLUMN_ENCODE_LEVEL_MASK = ENCODE_COMPRESS_LZ4 - 1;
+
+static CompressionTypePB spill_compression_type(int encode_level) {
+    if (encode_level <= 0) {
+        return CompressionTypePB::NO_COMPRESSION;
+    }
+    if (encode_level & ENCODE_COMPRESS_ZSTD) {
+        return CompressionTypePB::ZSTD;
+    }
+    if (encode_level & ENCODE_COMPRESS_LZ4) {
+        return CompressionTypePB::LZ4;
+    }
+    return CompressionTypePB::NO_COMPRESSION;
+}
+
 class ColumnarSerde : public Serde {
 public:
     ColumnarSerde(Spiller* parent, ChunkBuilder chunk_builder)
@@ -38,6 +58,13 @@ public:
         if (_encode_context == nullptr) {
             auto column_number = _parent->chunk_builder().column_number();
             auto encode_level = _parent->options().encode_level;
+            auto compress_type = spill_compression_type(encode_level);
+            if (compress_type != CompressionTypePB::NO_COMPRESSION) {
+                RETURN_IF_ERROR(get_block_compression_codec(compress_type, &_codec));
+            }
+            if (encode_level > 0) {
+                encode_level &= COLUMN_ENCODE_LEVEL_MASK;
+            }
             _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(column_number, encode_level);
         }
         return Status::OK();
@@ -52,13 +79,23 @@ private:
     // header|encode levels|attachment...
     // header:
     // i32 sequence_id|i64 attachment size
+    // a compressed chunk has its own sequence id, and the attachment is
+    // i64 uncompressed size|i64 compressed size|compressed(encode levels|attachment...)
     static constexpr int32_t SEQUENCE_OFFSET = 0;
     static constexpr int32_t ATTACHMENT_SIZE_OFFSET = SEQUENCE_OFFSET + sizeof(int32_t);
     static constexpr int32_t HEADER_SIZE = ATTACHMENT_SIZE_OFFSET + sizeof(int64_t);
     static constexpr int32_t SEQUENCE_MAGIC_ID = 0xface;
+    static constexpr int32_t COMPRESSED_SEQUENCE_MAGIC_ID = 0xfacf;
+    static constexpr int32_t COMPRESSED_HEADER_SIZE = 2 * sizeof(int64_t);
 
     size_t _max_serialized_size(const ChunkPtr& chunk) const;
 
+    // compress the serialized chunk in ctx.serialize_buffer into ctx.compress_buffer, return the data to write,
+    // which is the uncompressed chunk if the compression does not make it smaller.
+    StatusOr<Slice> _compress(SerdeContext& ctx, size_t aligned_size);
+    // decompress the attachment in ctx.compress_buffer into ctx.serialize_buffer
+    Status _decompress(SerdeContext& ctx);
+
     inline const std::vector<uint32_t>& _get_encode_levels() {
         DCHECK(_encode_context != nullptr);
         std::shared_lock l(_mutex);
@@ -80,6 +117,7 @@ private:
     // here a std::shared_mutex is used to ensure concurrency safety.
     std::shared_mutex _mutex;
     std::shared_ptr<serde::EncodeContext> _encode_context;
+    const BlockCompressionCodec* _codec = nullptr;
     DECLARE_RACE_DETECTOR(detect_prepare)
 };
 
@@ -102,12 +140,12 @@ size_t ColumnarSerde::_max_serialized_size(const ChunkPtr& chunk) const {
 Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const ChunkPtr& chunk,
                                 const SpillOutputDataStreamPtr& output, bool aligned) {
     raw::RawString& serialize_buffer = ctx.serialize_buffer;
+    size_t ALIGNED_SIZE = 1;
+    if (aligned) {
+        ALIGNED_SIZE = AlignedBuffer::PAGE_SIZE;
+    }
     {
         SCOPED_TIMER(_parent->metrics().serialize_timer);
-        size_t ALIGNED_SIZE = 1;
-        if (aligned) {
-            ALIGNED_SIZE = AlignedBuffer::PAGE_SIZE;
-        }
         ctx.serialize_buffer.clear();
         const auto& columns = chunk->columns();
         // header|attachment...
@@ -155,8 +193,64 @@ Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const Ch
         UNALIGNED_STORE64(header_buffer + ATTACHMENT_SIZE_OFFSET, align_size - HEADER_SIZE);
         memcpy(serialize_buffer.data(), header_buffer, HEADER_SIZE);
     }
-    size_t written_bytes = serialize_buffer.size();
-    RETURN_IF_ERROR(output->append(state, {Slice(serialize_buffer.data(), written_bytes)}, written_bytes));
+    Slice data(serialize_buffer.data(), serialize_buffer.size());
+    if (_codec != nullptr) {
+        SCOPED_TIMER(_parent->metrics().compress_timer);
+        ASSIGN_OR_RETURN(data, _compress(ctx, ALIGNED_SIZE));
+    }
+    size_t written_bytes = data.size;
+    RETURN_IF_ERROR(output->append(state, {data}, written_bytes));
+    return Status::OK();
+}
+
+StatusOr<Slice> ColumnarSerde::_compress(SerdeContext& ctx, size_t aligned_size) {
+    const auto& serialize_buffer = ctx.serialize_buffer;
+    Slice uncompressed(serialize_buffer.data() + HEADER_SIZE, serialize_buffer.size() - HEADER_SIZE);
+    if (_codec->exceed_max_input_size(uncompressed.size)) {
+        return Slice(serialize_buffer.data(), serialize_buffer.size());
+    }
+    auto& compress_buffer = ctx.compress_buffer;
+    size_t max_compressed_len = _codec->max_compressed_len(uncompressed.size);
+    compress_buffer.resize(ALIGN_UP(HEADER_SIZE + COMPRESSED_HEADER_SIZE + max_compressed_len, aligned_size));
+    uint8_t* buf = reinterpret_cast<uint8_t*>(compress_buffer.data());
+    Slice compressed(buf + HEADER_SIZE + COMPRESSED_HEADER_SIZE, max_compressed_len);
+    RETURN_IF_ERROR(_codec->compress(uncompressed, &compressed));
+
+    size_t total_size = ALIGN_UP(HEADER_SIZE + COMPRESSED_HEADER_SIZE + compressed.size, aligned_size);
+    if (total_size >= serialize_buffer.size()) {
+        // the columns are already well encoded, keep the uncompressed chunk to save the decompression
+        return Slice(serialize_buffer.data(), serialize_buffer.size());
+    }
+    compress_buffer.resize(total_size);
+    UNALIGNED_STORE32(buf + SEQUENCE_OFFSET, COMPRESSED_SEQUENCE_MAGIC_ID);
+    UNALIGNED_STORE64(buf + ATTACHMENT_SIZE_OFFSET, total_size - HEADER_SIZE);
+    UNALIGNED_STORE64(buf + HEADER_SIZE, uncompressed.size);
+    UNALIGNED_STORE64(buf + HEADER_SIZE + sizeof(int64_t), compressed.size);
+    return Slice(compress_buffer.data(), total_size);
+}
+
+Status ColumnarSerde::_decompress(SerdeContext& ctx) {
+    if (_codec == nullptr) {
+        return Status::InternalError("found compressed chunk in block but spill compression is disabled");
+    }
+    const auto& compress_buffer = ctx.compress_buffer;
+    if (compress_buffer.size() < COMPRESSED_HEADER_SIZE) {
+        return Status::Corruption("invalid compressed chunk in block");
+    }
+    const uint8_t* buf = reinterpret_cast<const uint8_t*>(compress_buffer.data());
+    int64_t uncompressed_size = UNALIGNED_LOAD64(buf);
+    int64_t compressed_size = UNALIGNED_LOAD64(buf + sizeof(int64_t));
+    if (compressed_size < 0 || uncompressed_size < 0 ||
+        COMPRESSED_HEADER_SIZE + compressed_size > compress_buffer.size()) {
+        return Status::Corruption(fmt::format("invalid compressed chunk in block, compressed size: {}, block size: {}",
+                                              compressed_size, compress_buffer.size()));
+    }
+    ctx.serialize_buffer.resize(uncompressed_size);
+    Slice output(ctx.serialize_buffer.data(), uncompressed_size);
+    RETURN_IF_ERROR(_codec->decompress(Slice(buf + COMPRESSED_HEADER_SIZE, compressed_size), &output));
+    if (output.size != static_cast<size_t>(uncompressed_size)) {
+        return Status::Corruption(fmt::format("decompressed size mismatch {} vs {}", output.size, uncompressed_size));
+    }
     return Status::OK();
 }
 
@@ -173,8 +267,9 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
     }
 
     int32_t sequence_id = UNALIGNED_LOAD32(header_buffer + SEQUENCE_OFFSET);
-    int32_t attachment_size = UNALIGNED_LOAD32(header_buffer + ATTACHMENT_SIZE_OFFSET);
-    if (sequence_id != SEQUENCE_MAGIC_ID) {
+    int64_t attachment_size = UNALIGNED_LOAD64(header_buffer + ATTACHMENT_SIZE_OFFSET);
+    bool is_compressed = sequence_id == COMPRESSED_SEQUENCE_MAGIC_ID;
+    if (sequence_id != SEQUENCE_MAGIC_ID && !is_compressed) {
         return Status::InternalError(fmt::format("sequence id mismatch {} vs {}", sequence_id, SEQUENCE_MAGIC_ID));
     }
 
@@ -182,16 +277,21 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
     auto& columns = chunk->columns();
 
     auto& serialize_buffer = ctx.serialize_buffer;
-    serialize_buffer.resize(attachment_size);
-
-    auto buf = reinterpret_cast<uint8_t*>(serialize_buffer.data());
+    auto& read_buffer = is_compressed ? ctx.compress_buffer : serialize_buffer;
+    read_buffer.resize(attachment_size);
     {
         SCOPED_TIMER(read_io_timer);
         COUNTER_UPDATE(read_io_count, 1);
-        auto st = reader->read_fully(buf, attachment_size);
+        auto st = reader->read_fully(read_buffer.data(), attachment_size);
         RETURN_IF(st.is_end_of_file(), Status::InternalError("not found enough data in block"));
         RETURN_IF_ERROR(st);
     }
+    if (is_compressed) {
+        SCOPED_TIMER(_parent->metrics().decompress_timer);
+        RETURN_IF_ERROR(_decompress(ctx));
+    }
+
+    auto buf = reinterpret_cast<uint8_t*>(serialize_buffer.data());
 
     const uint32_t* encode_levels = nullptr;
     const uint8_t* read_cursor = buf;
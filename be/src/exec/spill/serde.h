@@ -86,6 +86,8 @@ private:
 
 struct SerdeContext {
     raw::RawString serialize_buffer;
+    // holds the compressed chunk when spill compression is enabled
+    raw::RawString compress_buffer;
 };
 class Spiller;
 // Serde is used to serialize and deserialize spilled data.
@@ -248,11 +248,13 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
                                                              std::vector<SpilledPartition*>& partitions_need_flush) {
     // find partitions that need split first
     if (options().splittable) {
+        size_t max_partition_bytes = options().max_partition_bytes > 0 ? options().max_partition_bytes
+                                                                        : options().spill_mem_table_bytes_size;
         for (const auto& [pid, partition] : _id_to_partitions) {
             const auto& mem_table = partition->spill_writer->mem_table();
             // partition not in memory
-            if (!partition->in_mem && partition->level < config::spill_max_partition_level &&
-                mem_table->mem_usage() + partition->bytes > options().spill_mem_table_bytes_size) {
+            if (!partition->in_mem && !partition->is_skewed && partition->level < config::spill_max_partition_level &&
+                mem_table->mem_usage() + partition->bytes > max_partition_bytes) {
                 RETURN_IF_ERROR(mem_table->done());
                 partition->in_mem = false;
                 partition->mem_size = 0;
@@ -374,7 +376,7 @@ Status PartitionedSpillerWriter::spill_partition(workgroup::YieldContext& yield_
     auto mem_table_mem_usage = mem_table->mem_usage();
     if (partition->spill_writer->output_stream() == nullptr) {
         auto output = create_spill_output_stream(_spiller, &partition->spill_writer->block_group(),
-                                                 _spiller->block_manager());
+                                                 _spiller->block_manager(), is_cold_partition(partition));
         std::lock_guard<std::mutex> l(_mutex);
         DCHECK_EQ(partition->spill_writer->output_stream(), nullptr);
         partition->spill_writer->output_stream() = output;
@@ -393,6 +395,22 @@ Status PartitionedSpillerWriter::spill_partition(workgroup::YieldContext& yield_
     return Status::OK();
 }
 
+bool PartitionedSpillerWriter::is_cold_partition(const SpilledPartition* partition) const {
+    // partitions are restored in the order of get_spill_partitions, from the lowest level and partition id
+    size_t num_partitions = _id_to_partitions.size();
+    auto num_hot_partitions = static_cast<size_t>(num_partitions * config::spill_local_hot_partition_ratio);
+    size_t rank = 0;
+    for (const auto& [level, partitions] : _level_to_partitions) {
+        for (const auto& p : partitions) {
+            if (p.get() == partition) {
+                return rank >= num_hot_partitions;
+            }
+            rank++;
+        }
+    }
+    return false;
+}
+
 Status PartitionedSpillerWriter::_spill_input_partitions(workgroup::YieldContext& yield_ctx, SerdeContext& context,
                                                          const std::vector<SpilledPartition*>& spilling_partitions) {
     SCOPED_TIMER(_spiller->metrics().flush_timer);
@@ -421,7 +439,6 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
     auto io_task = std::any_cast<SpillIOTaskContextPtr>(yield_ctx.task_context_data);
     auto& flush_ctx = std::static_pointer_cast<PartitionedFlushContext>(io_task)->split_stage_ctx;
 
-    // TODO: check skew data here
     for (; flush_ctx.spliting_idx < splitting_partitions.size(); flush_ctx.spliting_idx++) {
         // split stage
         auto partition = splitting_partitions[flush_ctx.spliting_idx];
@@ -455,6 +472,13 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
         RETURN_IF(!st.is_ok_or_eof(), st);
         TRACE_SPILL_LOG << "reader:" << flush_ctx.reader.get() << " read rows:" << flush_ctx.reader->read_rows();
         DCHECK_EQ(flush_ctx.left->num_rows + flush_ctx.right->num_rows, partition->num_rows);
+        if (flush_ctx.left->num_rows == 0 || flush_ctx.right->num_rows == 0) {
+            flush_ctx.left->is_skewed = flush_ctx.right->num_rows == 0;
+            flush_ctx.right->is_skewed = flush_ctx.left->num_rows == 0;
+            COUNTER_UPDATE(_spiller->metrics().skewed_partition_count, 1);
+            TRACE_SPILL_LOG << fmt::format("split partition[{}] is skewed, stop splitting it",
+                                           partition->debug_string());
+        }
 
         flush_ctx.left->spill_writer->acquire_mem_table();
         flush_ctx.right->spill_writer->acquire_mem_table();
@@ -211,6 +211,9 @@ struct SpilledPartition : public SpillPartitionInfo {
     }
 
     bool is_spliting = false;
+    // the last split of this partition put all its rows into one child, so splitting it again would
+    // most likely only rewrite the same rows, e.g. a partition of a few hot keys.
+    bool is_skewed = false;
     std::unique_ptr<RawSpillerWriter> spill_writer;
 };
 
@@ -289,6 +292,9 @@ public:
 
     Status spill_partition(workgroup::YieldContext& ctx, SerdeContext& context, SpilledPartition* partition);
 
+    // whether the partition is among the last ones to be restored, whose blocks may be demoted to remote storage
+    bool is_cold_partition(const SpilledPartition* partition) const;
+
     int64_t mem_consumption() const { return _mem_tracker->consumption(); }
 
 public:
@@ -72,6 +72,8 @@ SpillProcessMetrics::SpillProcessMetrics(RuntimeProfile* profile, std::atomic_in
 
     serialize_timer = ADD_CHILD_TIMER(profile, "SerializeTime", parent);
     deserialize_timer = ADD_CHILD_TIMER(profile, "DeserializeTime", parent);
+    compress_timer = ADD_CHILD_TIMER(profile, "CompressTime", "SerializeTime");
+    decompress_timer = ADD_CHILD_TIMER(profile, "DecompressTime", "DeserializeTime");
     mem_table_peak_memory_usage = profile->AddHighWaterMarkCounter(
             "MemTablePeakMemoryBytes", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES), parent);
     input_stream_peak_memory_usage = profile->AddHighWaterMarkCounter(
@@ -86,6 +88,7 @@ SpillProcessMetrics::SpillProcessMetrics(RuntimeProfile* profile, std::atomic_in
     partition_writer_peak_memory_usage =
             profile->AddHighWaterMarkCounter("PartitionWriterPeakMemoryBytes", TUnit::BYTES,
                                              RuntimeProfile::Counter::create_strategy(TUnit::BYTES), parent);
+    skewed_partition_count = ADD_CHILD_COUNTER(profile, "SkewedPartitionCount", TUnit::UNIT, parent);
 
     block_count = ADD_CHILD_COUNTER(profile, "BlockCount", TUnit::UNIT, parent);
     local_block_count = ADD_CHILD_COUNTER(profile, "LocalBlockCount", TUnit::UNIT, "BlockCount");
@@ -88,6 +88,9 @@ public:
     RuntimeProfile::Counter* serialize_timer = nullptr;
     // time spent to deserialize data after read it from disk
     RuntimeProfile::Counter* deserialize_timer = nullptr;
+    // time spent to compress/decompress the serialized chunks, only used when spill compression is enabled
+    RuntimeProfile::Counter* compress_timer = nullptr;
+    RuntimeProfile::Counter* decompress_timer = nullptr;
     // peak memory usage of mem table
     RuntimeProfile::HighWaterMarkCounter* mem_table_peak_memory_usage = nullptr;
     // peak memory usage of input stream
@@ -107,6 +110,8 @@ public:
     RuntimeProfile::Counter* restore_from_mem_table_rows = nullptr;
     // peak memory usage of partition writer, only used in join operator
     RuntimeProfile::HighWaterMarkCounter* partition_writer_peak_memory_usage = nullptr;
+    // the number of partitions no longer split because all rows went to one side, only used in join operator
+    RuntimeProfile::Counter* skewed_partition_count = nullptr;
 
     // the number of blocks created
     RuntimeProfile::Counter* block_count = nullptr;
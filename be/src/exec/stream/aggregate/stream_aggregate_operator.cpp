@@ -50,6 +50,8 @@ Status StreamAggregateOperator::set_epoch_finishing(RuntimeState* state) {
 
 Status StreamAggregateOperator::set_epoch_finished(RuntimeState* state) {
     // TODO:  async flush state
+    // The state written in this epoch becomes the checkpoint the next epochs start from.
+    RETURN_IF_ERROR(_aggregator->commit_epoch(state));
     // ATTENTION:
     // 1. reset state to reduce memory usage.
     // 2. reset state will change `_aggregator->is_ht_eos()`
@@ -60,7 +62,8 @@ Status StreamAggregateOperator::set_epoch_finished(RuntimeState* state) {
 Status StreamAggregateOperator::reset_epoch(RuntimeState* state) {
     _is_epoch_finished = false;
     _has_output = true;
-    return Status::OK();
+    // drop the state of an epoch which did not finish
+    return _aggregator->reset_epoch(state);
 }
 
 Status StreamAggregateOperator::prepare(RuntimeState* state) {
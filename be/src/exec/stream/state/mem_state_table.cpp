@@ -52,9 +52,27 @@ void convert_datum_rows_to_chunk(const std::vector<DatumRow>& rows, Chunk* chunk
 }
 
 [[nodiscard]] Status MemStateTable::commit(RuntimeState* state) {
+    for (auto& [key, value] : _epoch_kv_mapping) {
+        if (value.has_value()) {
+            _kv_mapping[key] = std::move(value.value());
+        } else {
+            _kv_mapping.erase(key);
+        }
+    }
+    _epoch_kv_mapping.clear();
     return Status::OK();
 }
 
+const DatumRow* MemStateTable::_find(const DatumKeyRow& key) const {
+    if (auto iter = _epoch_kv_mapping.find(key); iter != _epoch_kv_mapping.end()) {
+        return iter->second.has_value() ? &iter->second.value() : nullptr;
+    }
+    if (auto iter = _kv_mapping.find(key); iter != _kv_mapping.end()) {
+        return &iter->second;
+    }
+    return nullptr;
+}
+
 bool MemStateTable::_equal_keys(const DatumKeyRow& m_k, const DatumKeyRow& keys) const {
     for (auto i = 0; i < keys.size(); i++) {
         Datum datum(keys[i]);
@@ -73,9 +91,9 @@ bool MemStateTable::_equal_keys(const DatumKeyRow& m_k, const DatumKeyRow& keys)
     result_chunk = ChunkHelper::new_chunk(_v_schema, num_rows);
     for (size_t i = 0; i < num_rows; i++) {
         auto key_row = _convert_columns_to_key(keys, i);
-        if (auto iter = _kv_mapping.find(key_row); iter != _kv_mapping.end()) {
+        if (auto value = _find(key_row); value != nullptr) {
             found[i] = 1;
-            RETURN_IF_ERROR(_append_datum_row_to_chunk(iter->second, result_chunk));
+            RETURN_IF_ERROR(_append_datum_row_to_chunk(*value, result_chunk));
         }
     }
     return Status::OK();
@@ -112,10 +130,10 @@ bool MemStateTable::_equal_keys(const DatumKeyRow& m_k, const DatumKeyRow& keys)
     for (size_t i = 0; i < num_rows; i++) {
         if (selection[i]) {
             auto key_row = _convert_columns_to_key(keys, i);
-            if (auto iter = _kv_mapping.find(key_row); iter != _kv_mapping.end()) {
+            if (auto value = _find(key_row); value != nullptr) {
                 VLOG_ROW << "append key with selection";
                 found[i] = 1;
-                RETURN_IF_ERROR(_append_datum_row_to_chunk(iter->second, result_chunk));
+                RETURN_IF_ERROR(_append_datum_row_to_chunk(*value, result_chunk));
             } else {
                 VLOG_ROW << "append null without selection";
             }
@@ -134,22 +152,34 @@ bool MemStateTable::_equal_keys(const DatumKeyRow& m_k, const DatumKeyRow& keys)
 ChunkIteratorPtrOr MemStateTable::prefix_scan(const Columns& keys, size_t row_idx) const {
     auto key_row = _convert_columns_to_key(keys, row_idx);
     DCHECK_LE(key_row.size(), _k_num);
-    // prefix scan
-    std::vector<DatumRow> rows;
+    // prefix scan, the writes of the current epoch override the committed state
+    std::map<DatumKeyRow, const DatumRow*> matched;
     for (auto iter = _kv_mapping.begin(); iter != _kv_mapping.end(); iter++) {
-        // if equal
-        auto m_k = iter->first;
-        if (_equal_keys(m_k, key_row)) {
-            DatumRow row;
-            // add extra key cols + value cols
-            for (int32_t s = key_row.size(); s < m_k.size(); s++) {
-                row.push_back(Datum(m_k[s]));
-            }
-            for (auto& datum : iter->second) {
-                row.push_back(datum);
-            }
-            rows.push_back(std::move(row));
+        if (_equal_keys(iter->first, key_row)) {
+            matched.emplace(iter->first, &iter->second);
+        }
+    }
+    for (auto iter = _epoch_kv_mapping.begin(); iter != _epoch_kv_mapping.end(); iter++) {
+        if (!_equal_keys(iter->first, key_row)) {
+            continue;
+        }
+        if (iter->second.has_value()) {
+            matched[iter->first] = &iter->second.value();
+        } else {
+            matched.erase(iter->first);
+        }
+    }
+    std::vector<DatumRow> rows;
+    for (auto& [m_k, value] : matched) {
+        DatumRow row;
+        // add extra key cols + value cols
+        for (int32_t s = key_row.size(); s < m_k.size(); s++) {
+            row.push_back(Datum(m_k[s]));
+        }
+        for (auto& datum : *value) {
+            row.push_back(datum);
         }
+        rows.push_back(std::move(row));
     }
     if (rows.empty()) {
         return Status::EndOfFile("");
@@ -215,23 +245,25 @@ DatumKeyRow MemStateTable::_convert_columns_to_key(const Columns& cols, size_t i
             }
             auto k = _make_datum_key_row(chunk, 0, _k_num, i);
             if (ops[i] == StreamRowOp::OP_DELETE) {
-                _kv_mapping.erase(k);
+                _epoch_kv_mapping[k] = std::nullopt;
                 continue;
             }
             auto v = _make_datum_row(chunk, _k_num, _cols_num, i);
-            _kv_mapping[k] = std::move(v);
+            _epoch_kv_mapping[k] = std::move(v);
         }
     } else {
         for (auto i = 0; i < chunk_size; i++) {
             auto k = _make_datum_key_row(chunk, 0, _k_num, i);
             auto v = _make_datum_row(chunk, _k_num, _cols_num, i);
-            _kv_mapping[k] = std::move(v);
+            _epoch_kv_mapping[k] = std::move(v);
         }
     }
     return Status::OK();
 }
 
 [[nodiscard]] Status MemStateTable::reset_epoch(RuntimeState* state) {
+    // drop the writes not committed, the new epoch starts from the last committed state
+    _epoch_kv_mapping.clear();
     return Status::OK();
 }
 
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <map>
+#include <optional>
+
 #include "column/datum.h"
 #include "column/field.h"
 #include "column/schema.h"
@@ -46,6 +49,10 @@ private:
 };
 
 // NOTE: MemStateTable is only used for testing to mock `StateTable`.
+//
+// The writes of an epoch are kept apart from the committed state until commit(), and reset_epoch() drops
+// the ones not committed yet, so a failed epoch can be run again from the last checkpoint. Reads see the
+// writes of the current epoch over the committed state.
 class MemStateTable : public StateTable {
 public:
     // For MemStateTable, we assume flushed chunk's columns is assigned as:
@@ -90,12 +97,17 @@ private:
     static DatumKeyRow _make_datum_key_row(const ChunkPtr& chunk, size_t start, size_t end, int row_idx);
     static DatumRow _make_datum_row(const ChunkPtr& chunk, size_t start, size_t end, int row_idx);
     bool _equal_keys(const DatumKeyRow& m_k, const DatumKeyRow& keys) const;
+    // Returns the value of `key` in the current epoch or the committed state, nullptr if there is none.
+    const DatumRow* _find(const DatumKeyRow& key) const;
 
 private:
     std::vector<SlotDescriptor*> _slots;
     size_t _k_num;
     size_t _cols_num;
+    // the committed state
     std::map<DatumKeyRow, DatumRow> _kv_mapping;
+    // the writes of the current epoch, std::nullopt for a deleted key
+    std::map<DatumKeyRow, DatumRowOpt> _epoch_kv_mapping;
     // value's schema
     Schema _v_schema;
 };
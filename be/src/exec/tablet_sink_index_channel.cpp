@@ -14,6 +14,8 @@
 
 #include "exec/tablet_sink_index_channel.h"
 
+#include <algorithm>
+
 #include "column/chunk.h"
 #include "column/column_viewer.h"
 #include "column/nullable_column.h"
@@ -24,6 +26,7 @@
 #include "gutil/strings/join.h"
 #include "runtime/current_thread.h"
 #include "runtime/runtime_state.h"
+#include "serde/encode_context.h"
 #include "serde/protobuf_serde.h"
 #include "util/brpc_stub_cache.h"
 #include "util/compression/compression_utils.h"
@@ -113,7 +116,11 @@ Status NodeChannel::init(RuntimeState* state) {
             _err_st = Status::InternalError(fmt::format("load_dop should between [1-{}]", config::max_load_dop));
             return _err_st;
         }
+    } else {
+        _max_parallel_request_size = std::clamp<int64_t>(config::tablet_sink_default_parallel_requests, 1,
+                                                         std::max<int64_t>(1, config::max_load_dop));
     }
+    _min_request_bytes = config::tablet_sink_node_channel_request_min_bytes;
 
     // init add_chunk request closure
     for (size_t i = 0; i < _max_parallel_request_size; i++) {
@@ -343,7 +350,11 @@ Status NodeChannel::_serialize_chunk(const Chunk* src, ChunkPB* dst) {
         // This lambda is to get the result of TRY_CATCH_ALLOC_SCOPE_END()
         auto st = [&]() {
             TRY_CATCH_ALLOC_SCOPE_START()
-            res = serde::ProtobufChunkSerde::serialize(*src);
+            if (config::load_transmission_encode_level > 0 && _encode_context == nullptr) {
+                _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(
+                        src->columns().size(), config::load_transmission_encode_level);
+            }
+            res = serde::ProtobufChunkSerde::serialize(*src, _encode_context);
             return res.status();
             TRY_CATCH_ALLOC_SCOPE_END()
         }();
@@ -353,6 +364,9 @@ Status NodeChannel::_serialize_chunk(const Chunk* src, ChunkPB* dst) {
             return _err_st;
         }
         res->Swap(dst);
+        if (_encode_context != nullptr) {
+            _encode_context->set_encode_levels_in_pb(dst);
+        }
     }
     DCHECK(dst->has_uncompressed_size());
     DCHECK_EQ(dst->uncompressed_size(), dst->data().size());
@@ -447,7 +461,7 @@ Status NodeChannel::add_chunk(Chunk* input, const std::vector<int64_t>& tablet_i
         }
     }
 
-    if (_cur_chunk->num_rows() < _runtime_state->chunk_size()) {
+    if (!_is_cur_chunk_full()) {
         // 2. chunk not full
         if (_request_queue.empty()) {
             return Status::OK();
@@ -497,7 +511,7 @@ Status NodeChannel::add_chunks(Chunk* input, const std::vector<std::vector<int64
         }
     }
 
-    if (_cur_chunk->num_rows() < _runtime_state->chunk_size()) {
+    if (!_is_cur_chunk_full()) {
         // 2. chunk not full
         if (_request_queue.empty()) {
             return Status::OK();
@@ -522,6 +536,14 @@ Status NodeChannel::add_chunks(Chunk* input, const std::vector<std::vector<int64
     return _send_request(false);
 }
 
+bool NodeChannel::_is_cur_chunk_full() const {
+    if (_cur_chunk->num_rows() < _runtime_state->chunk_size()) {
+        return false;
+    }
+    // keep coalescing the rows of the tablets of this node, so that there are fewer and larger requests
+    return _min_request_bytes <= 0 || _cur_chunk->bytes_usage() >= _min_request_bytes;
+}
+
 Status NodeChannel::_filter_indexes_with_where_expr(Chunk* input, const std::vector<uint32_t>& indexes,
                                                     std::vector<uint32_t>& filtered_indexes) {
     DCHECK(_where_clause != nullptr);
@@ -43,6 +43,10 @@ class MemTracker;
 class TupleDescriptor;
 class TxnLogPB;
 
+namespace serde {
+class EncodeContext;
+} // namespace serde
+
 namespace stream_load {
 
 class OlapTableSink;    // forward declaration
@@ -176,6 +180,7 @@ private:
     bool _check_prev_request_done();
     bool _check_all_prev_request_done();
     Status _serialize_chunk(const Chunk* src, ChunkPB* dst);
+    bool _is_cur_chunk_full() const;
     void _open(int64_t index_id, RefCountClosure<PTabletWriterOpenResult>* open_closure,
                std::vector<PTabletWithPartition>& tablets, bool incrmental_open);
     Status _open_wait(RefCountClosure<PTabletWriterOpenResult>* open_closure);
@@ -234,6 +239,9 @@ private:
     size_t _max_parallel_request_size = 1;
     std::vector<ReusableClosure<PTabletWriterAddBatchResult>*> _add_batch_closures;
     std::unique_ptr<Chunk> _cur_chunk;
+    // the rows of all the tablets of this node are coalesced until _cur_chunk has this many bytes
+    int64_t _min_request_bytes = 0;
+    std::shared_ptr<serde::EncodeContext> _encode_context;
 
     PTabletWriterAddChunksRequest _rpc_request;
     using AddMultiChunkReq = std::pair<std::unique_ptr<Chunk>, PTabletWriterAddChunksRequest>;
@@ -14,7 +14,9 @@
 
 #include "exec/workgroup/scan_executor.h"
 
+#include "common/config.h"
 #include "exec/workgroup/scan_task_queue.h"
+#include "util/cpu_info.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks::workgroup {
@@ -51,6 +53,10 @@ void ScanExecutor::change_num_threads(int32_t num_threads) {
 
 void ScanExecutor::worker_thread() {
     auto current_thread = Thread::current_thread();
+    const int worker_id = _next_id++;
+    if (config::enable_numa_aware_scheduling && CpuInfo::get_max_num_numa_nodes() > 1) {
+        CpuInfo::bind_current_thread_to_numa_node(worker_id % CpuInfo::get_max_num_numa_nodes());
+    }
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
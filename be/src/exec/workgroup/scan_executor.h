@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "util/limit_setter.h"
 #include "util/threadpool.h"
 #include "work_group.h"
@@ -43,6 +45,7 @@ private:
     void worker_thread();
 
     LimitSetter _num_threads_setter;
+    std::atomic<int> _next_id = 0;
     std::unique_ptr<ScanTaskQueue> _task_queue;
     // _thread_pool must be placed after _task_queue, because worker threads in _thread_pool use _task_queue.
     std::unique_ptr<ThreadPool> _thread_pool;
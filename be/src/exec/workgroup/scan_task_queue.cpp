@@ -14,6 +14,7 @@
 
 #include "exec/workgroup/scan_task_queue.h"
 
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/workgroup/work_group.h"
 #include "exec/workgroup/work_group_fwd.h"
@@ -201,7 +202,11 @@ StatusOr<ScanTask> WorkGroupScanTaskQueue::take() {
 
     _num_tasks--;
 
-    return wg_entity->queue()->take();
+    auto maybe_task = wg_entity->queue()->take();
+    if (maybe_task.ok()) {
+        wg_entity->record_schedule_latency_ns(MonotonicNanos() - maybe_task.value().enter_queue_timestamp_ns);
+    }
+    return maybe_task;
 }
 
 bool WorkGroupScanTaskQueue::try_offer(ScanTask task) {
@@ -213,6 +218,7 @@ bool WorkGroupScanTaskQueue::try_offer(ScanTask task) {
 
     auto* wg_entity = _sched_entity(task.workgroup);
     wg_entity->set_in_queue(this);
+    task.enter_queue_timestamp_ns = MonotonicNanos();
     RETURN_IF_UNLIKELY(!wg_entity->queue()->try_offer(std::move(task)), false);
 
     if (_wg_entities.find(wg_entity) == _wg_entities.end()) {
@@ -233,6 +239,7 @@ void WorkGroupScanTaskQueue::force_put(ScanTask task) {
 
     auto* wg_entity = _sched_entity(task.workgroup);
     wg_entity->set_in_queue(this);
+    task.enter_queue_timestamp_ns = MonotonicNanos();
     wg_entity->queue()->force_put(std::move(task));
 
     if (_wg_entities.find(wg_entity) == _wg_entities.end()) {
@@ -276,6 +283,10 @@ bool WorkGroupScanTaskQueue::should_yield(const WorkGroup* wg, int64_t unaccount
     // Return true, if the minimum-vruntime workgroup is not current workgroup anymore.
     auto* wg_entity = _sched_entity(wg);
     auto* min_entity = _min_wg_entity.load();
+    if (min_entity != nullptr && min_entity != wg_entity && min_entity->is_sq_wg() && !wg_entity->is_sq_wg() &&
+        config::enable_short_query_workgroup_strict_priority) {
+        return true;
+    }
     return min_entity != wg_entity && min_entity &&
            min_entity->vruntime_ns() < wg_entity->vruntime_ns() + unaccounted_runtime_ns / wg_entity->cpu_limit();
 }
@@ -303,6 +314,15 @@ void WorkGroupScanTaskQueue::_update_min_wg() {
 }
 
 workgroup::WorkGroupScanSchedEntity* WorkGroupScanTaskQueue::_take_next_wg() {
+    if (config::enable_short_query_workgroup_strict_priority) {
+        // The short query workgroup is never throttled, and runs before the others whatever its vruntime is.
+        for (const auto& wg_entity : _wg_entities) {
+            if (wg_entity->is_sq_wg()) {
+                return wg_entity;
+            }
+        }
+    }
+
     workgroup::WorkGroupScanSchedEntity* min_unthrottled_wg_entity = nullptr;
     for (const auto& wg_entity : _wg_entities) {
         if (!_throttled(wg_entity)) {
@@ -110,6 +110,8 @@ public:
     int priority = 0;
     std::shared_ptr<ScanTaskGroup> task_group = nullptr;
     RuntimeProfile::HighWaterMarkCounter* peak_scan_task_queue_size_counter = nullptr;
+    // Set by WorkGroupScanTaskQueue when the task is put into the queue, to measure the schedule latency.
+    int64_t enter_queue_timestamp_ns = 0;
 };
 
 /// There are three types of ScanTaskQueue:
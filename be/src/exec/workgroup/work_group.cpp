@@ -43,6 +43,9 @@ struct WorkGroupMetrics {
     std::unique_ptr<starrocks::IntGauge> bigquery_count = nullptr;
 
     std::unique_ptr<starrocks::DoubleGauge> inuse_cpu_cores = nullptr;
+    // The cumulative schedule latency histograms, one gauge per bucket labeled by its upper bound.
+    std::vector<std::unique_ptr<starrocks::IntGauge>> driver_schedule_latency;
+    std::vector<std::unique_ptr<starrocks::IntGauge>> scan_schedule_latency;
     int64_t timestamp_ns = 0;
     int64_t cpu_runtime_ns = 0;
 };
@@ -69,9 +72,46 @@ void WorkGroupSchedEntity<Q>::adjust_runtime_ns(int64_t runtime_ns) {
     _vruntime_ns += runtime_ns / cpu_limit();
 }
 
+template <typename Q>
+void WorkGroupSchedEntity<Q>::record_schedule_latency_ns(int64_t latency_ns) {
+    size_t bucket = 0;
+    while (bucket < SCHEDULE_LATENCY_BUCKET_BOUNDS_NS.size() &&
+           latency_ns > SCHEDULE_LATENCY_BUCKET_BOUNDS_NS[bucket]) {
+        bucket++;
+    }
+    _schedule_latency_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
 template class WorkGroupSchedEntity<pipeline::DriverQueue>;
 template class WorkGroupSchedEntity<ScanTaskQueue>;
 
+// The buckets of the schedule latency histograms of a workgroup, labeled by their upper bounds in milliseconds.
+static std::vector<std::unique_ptr<IntGauge>> register_schedule_latency_metrics(const std::string& metric_name,
+                                                                                const std::string& wg_name) {
+    std::vector<std::unique_ptr<IntGauge>> gauges;
+    for (size_t i = 0; i < WorkGroupDriverSchedEntity::NUM_SCHEDULE_LATENCY_BUCKETS; i++) {
+        std::string le = i < WorkGroupDriverSchedEntity::SCHEDULE_LATENCY_BUCKET_BOUNDS_NS.size()
+                                 ? std::to_string(WorkGroupDriverSchedEntity::SCHEDULE_LATENCY_BUCKET_BOUNDS_NS[i] /
+                                                  1'000'000L)
+                                 : "+Inf";
+        auto gauge = std::make_unique<IntGauge>(MetricUnit::NOUNIT);
+        StarRocksMetrics::instance()->metrics()->register_metric(
+                metric_name, MetricLabels().add("name", wg_name).add("le", le), gauge.get());
+        gauges.emplace_back(std::move(gauge));
+    }
+    return gauges;
+}
+
+template <typename... Entities>
+static void set_schedule_latency_metrics(const std::vector<std::unique_ptr<IntGauge>>& gauges,
+                                         const Entities*... entities) {
+    int64_t cumulative_count = 0;
+    for (size_t i = 0; i < gauges.size(); i++) {
+        cumulative_count += (entities->schedule_latency_count(i) + ...);
+        gauges[i]->set_value(cumulative_count);
+    }
+}
+
 /// WorkGroup.
 RunningQueryToken::~RunningQueryToken() {
     wg->decr_num_queries();
@@ -228,6 +268,18 @@ void WorkGroup::decr_num_queries() {
     DCHECK_GT(old, 0);
 }
 
+bool WorkGroup::can_admit_query(int64_t estimated_mem_bytes) {
+    const int64_t max_ready_drivers = config::query_admission_max_ready_drivers_per_workgroup;
+    if (max_ready_drivers > 0 && _driver_sched_entity.queue()->size() >= max_ready_drivers) {
+        return false;
+    }
+    if (estimated_mem_bytes > 0 && _mem_tracker->has_limit() &&
+        _mem_tracker->consumption() + estimated_mem_bytes > _mem_tracker->limit()) {
+        return false;
+    }
+    return true;
+}
+
 Status WorkGroup::check_big_query(const QueryContext& query_context) {
     // Check big query run time
     if (_big_query_cpu_nanos_limit) {
@@ -349,6 +401,12 @@ void WorkGroupManager::add_metrics_unlocked(const WorkGroupPtr& wg, UniqueLockTy
                 "resource_group_bigquery_count", MetricLabels().add("name", wg->name()),
                 resource_group_bigquery_count.get());
 
+        // schedule latency
+        auto driver_schedule_latency =
+                register_schedule_latency_metrics("resource_group_driver_schedule_latency_count", wg->name());
+        auto scan_schedule_latency =
+                register_schedule_latency_metrics("resource_group_scan_schedule_latency_count", wg->name());
+
         unique_lock.lock();
         auto it = _wg_metrics.find(wg->name());
         if (it == _wg_metrics.end()) {
@@ -372,6 +430,8 @@ void WorkGroupManager::add_metrics_unlocked(const WorkGroupPtr& wg, UniqueLockTy
         if (concurrency_registered)
             wg_metrics->concurrency_overflow_count = std::move(resource_group_concurrency_overflow);
         if (bigquery_registered) wg_metrics->bigquery_count = std::move(resource_group_bigquery_count);
+        wg_metrics->driver_schedule_latency = std::move(driver_schedule_latency);
+        wg_metrics->scan_schedule_latency = std::move(scan_schedule_latency);
     }
     _wg_metrics[wg->name()]->group_unique_id = wg->unique_id();
 }
@@ -426,6 +486,9 @@ void WorkGroupManager::update_metrics_unlocked() {
             wg_metrics->total_queries->set_value(wg->num_total_queries());
             wg_metrics->concurrency_overflow_count->set_value(wg->concurrency_overflow_count());
             wg_metrics->bigquery_count->set_value(wg->bigquery_count());
+            set_schedule_latency_metrics(wg_metrics->driver_schedule_latency, wg->driver_sched_entity());
+            set_schedule_latency_metrics(wg_metrics->scan_schedule_latency, wg->scan_sched_entity(),
+                                         wg->connector_scan_sched_entity());
 
             int64_t new_timestamp_ns = MonotonicNanos();
             int64_t new_cpu_runtime_ns = wg->cpu_runtime_ns();
@@ -449,6 +512,12 @@ void WorkGroupManager::update_metrics_unlocked() {
             wg_metrics->concurrency_overflow_count->set_value(0);
             wg_metrics->bigquery_count->set_value(0);
             wg_metrics->inuse_cpu_cores->set_value(0);
+            for (auto& gauge : wg_metrics->driver_schedule_latency) {
+                gauge->set_value(0);
+            }
+            for (auto& gauge : wg_metrics->scan_schedule_latency) {
+                gauge->set_value(0);
+            }
         }
     }
 }
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #pragma once
+#include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -87,6 +88,18 @@ public:
     void incr_runtime_ns(int64_t runtime_ns);
     void adjust_runtime_ns(int64_t runtime_ns);
 
+    /// The upper bounds of the buckets of the schedule latency histogram, i.e. the time a driver or a task waits
+    /// in the ready queue from being put back to being taken. The last bucket counts the rest.
+    static constexpr std::array<int64_t, 4> SCHEDULE_LATENCY_BUCKET_BOUNDS_NS = {1'000'000L, 10'000'000L, 100'000'000L,
+                                                                                1'000'000'000L};
+    static constexpr size_t NUM_SCHEDULE_LATENCY_BUCKETS = SCHEDULE_LATENCY_BUCKET_BOUNDS_NS.size() + 1;
+
+    void record_schedule_latency_ns(int64_t latency_ns);
+    /// The number of the schedules whose latency falls in the bucket.
+    int64_t schedule_latency_count(size_t bucket) const {
+        return _schedule_latency_counts[bucket].load(std::memory_order_relaxed);
+    }
+
 private:
     WorkGroup* _workgroup; // The workgroup owning this entity.
 
@@ -98,6 +111,9 @@ private:
     int64_t _unadjusted_runtime_ns = 0;
     int64_t _curr_unadjusted_runtime_ns = 0;
     int64_t _last_unadjusted_runtime_ns = 0;
+
+    // Read by the metrics without the lock of the queue.
+    std::array<std::atomic<int64_t>, NUM_SCHEDULE_LATENCY_BUCKETS> _schedule_latency_counts{};
 };
 
 using WorkGroupDriverSchedEntity = WorkGroupSchedEntity<pipeline::DriverQueue>;
@@ -191,6 +207,9 @@ public:
     Status check_big_query(const QueryContext& query_context);
     StatusOr<RunningQueryTokenPtr> acquire_running_query_token(bool enable_group_level_query_queue);
     void decr_num_queries();
+    // Whether a new query, projected to use `estimated_mem_bytes`, can start now without overloading the workgroup,
+    // judged by the ready drivers and the free memory of the workgroup.
+    bool can_admit_query(int64_t estimated_mem_bytes);
     int64_t num_running_queries() const { return _num_running_queries; }
     int64_t num_total_queries() const { return _num_total_queries; }
     int64_t concurrency_overflow_count() const { return _concurrency_overflow_count; }
@@ -311,6 +311,18 @@ public:
     bool is_pod_state() const override { return pod_state(); }
 };
 
+// Whether most rows of the chunk share the agg state of their previous row. It's typical for a low-cardinality
+// GROUP BY whose input is clustered by the group by keys (e.g. the sort key of the table), where an update
+// can accumulate each run of rows locally and write it into the state once, instead of a dependent
+// load-add-store on the same state for every row.
+inline bool has_long_state_runs(const AggDataPtr* states, size_t chunk_size) {
+    size_t repeated = 0;
+    for (size_t i = 1; i < chunk_size; ++i) {
+        repeated += states[i] == states[i - 1];
+    }
+    return repeated * 2 >= chunk_size;
+}
+
 template <typename State, typename Derived>
 class AggregateFunctionBatchHelper : public AggregateFunctionStateHelper<State> {
 public:
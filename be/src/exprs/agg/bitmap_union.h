@@ -36,6 +36,16 @@ public:
         this->data(state) |= *(col->get_object(row_num));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        _union_rows(down_cast<const BitmapColumn*>(columns[0]), 0, chunk_size, state);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column, size_t start,
+                                  size_t size) const override {
+        _union_rows(down_cast<const BitmapColumn*>(column), start, size, state);
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         auto* col = down_cast<BitmapColumn*>(to);
         auto& bitmap = const_cast<BitmapValue&>(this->data(state));
@@ -54,6 +64,16 @@ public:
     }
 
     std::string get_name() const override { return "bitmap_union"; }
+
+private:
+    // Unions the bitmaps of a batch of rows into one state in a single multi-way pass.
+    void _union_rows(const BitmapColumn* col, size_t start, size_t size, AggDataPtr __restrict state) const {
+        std::vector<const BitmapValue*> values(size);
+        for (size_t i = 0; i < size; ++i) {
+            values[i] = col->get_object(start + i);
+        }
+        this->data(state).fast_union(values);
+    }
 };
 
 } // namespace starrocks
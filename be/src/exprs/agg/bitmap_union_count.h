@@ -39,13 +39,20 @@ public:
         this->data(state) |= *(col->get_object(row_num));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        _union_rows(down_cast<const BitmapColumn*>(columns[0]), 0, chunk_size, state);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column, size_t start,
+                                  size_t size) const override {
+        _union_rows(down_cast<const BitmapColumn*>(column), start, size, state);
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
-        const auto* col = down_cast<const BitmapColumn*>(columns[0]);
-        for (size_t i = frame_start; i < frame_end; ++i) {
-            this->data(state) |= *(col->get_object(i));
-        }
+        _union_rows(down_cast<const BitmapColumn*>(columns[0]), frame_start, frame_end - frame_start, state);
     }
 
     void get_values(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* dst, size_t start,
@@ -74,6 +81,16 @@ public:
     }
 
     std::string get_name() const override { return "bitmap_union_count"; }
+
+private:
+    // Unions the bitmaps of a batch of rows into one state in a single multi-way pass.
+    void _union_rows(const BitmapColumn* col, size_t start, size_t size, AggDataPtr __restrict state) const {
+        std::vector<const BitmapValue*> values(size);
+        for (size_t i = 0; i < size; ++i) {
+            values[i] = col->get_object(start + i);
+        }
+        this->data(state).fast_union(values);
+    }
 };
 
 } // namespace starrocks
@@ -55,6 +55,25 @@ public:
         --this->data(state).count;
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        if (has_long_state_runs(states, chunk_size)) {
+            size_t i = 0;
+            while (i < chunk_size) {
+                size_t j = i + 1;
+                while (j < chunk_size && states[j] == states[i]) {
+                    ++j;
+                }
+                this->data(states[i] + state_offset).count += j - i;
+                i = j;
+            }
+            return;
+        }
+        for (size_t i = 0; i < chunk_size; ++i) {
+            ++this->data(states[i] + state_offset).count;
+        }
+    }
+
     void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
                                    AggDataPtr __restrict state) const override {
         this->data(state).count += chunk_size;
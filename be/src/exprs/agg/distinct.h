@@ -19,6 +19,7 @@
 #include <limits>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "column/array_column.h"
 #include "column/binary_column.h"
@@ -234,10 +235,20 @@ struct DistinctAggregateStateV2<LT, SumLT, FixedLengthLTGuard<LT>> {
 
         size_t old_size = set.size();
         src += sizeof(size);
+        // precompute the hash values to prefetch the slots, see TDistinctAggregateFunction::update_batch
+        std::vector<size_t> hash_values(size);
         for (size_t i = 0; i < size; i++) {
+            T key;
+            memcpy(&key, src + i * sizeof(T), sizeof(T));
+            hash_values[i] = set.hash_function()(key);
+        }
+        for (size_t i = 0; i < size; i++) {
+            if (i + 16 < size) {
+                set.prefetch_hash(hash_values[i + 16]);
+            }
             T key;
             memcpy(&key, src, sizeof(T));
-            set.insert(key);
+            set.emplace_with_hash(hash_values[i], key);
             src += sizeof(T);
         }
         size_t new_size = set.size();
@@ -385,6 +396,17 @@ public:
         ctx->add_mem_usage(mem_usage);
     }
 
+    void merge_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column* column,
+                     AggDataPtr* states) const override {
+        _merge_rows(ctx, column, 0, chunk_size, [&](size_t i) { return &this->data(states[i] + state_offset); });
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column,
+                                  size_t start, size_t size) const override {
+        auto* agg_state = &this->data(state);
+        _merge_rows(ctx, column, start, size, [agg_state](size_t) { return agg_state; });
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         auto* column = down_cast<BinaryColumn*>(to);
         size_t old_size = column->get_bytes().size();
@@ -450,6 +472,56 @@ public:
             return "sum-distinct";
         }
     }
+
+private:
+    // Merges the rows [start, start + size) of `column` into the states returned by `state_of(row)`.
+    // Most of the rows merged after the pre-aggregation passes chunks through are single values (see
+    // convert_to_serialize_format), which are inserted with precomputed and prefetched hash values like
+    // update_batch. Serialized hash sets are merged as they come.
+    template <typename StateOf>
+    void _merge_rows(FunctionContext* ctx, const Column* column, size_t start, size_t size, StateOf&& state_of) const {
+        DCHECK(column->is_binary());
+        const auto* input_column = down_cast<const BinaryColumn*>(column);
+        size_t mem_usage = 0;
+        if constexpr (IsSlice<T>) {
+            for (size_t i = start; i < start + size; ++i) {
+                Slice slice = input_column->get_slice(i);
+                mem_usage += state_of(i)->deserialize_and_merge(ctx->mem_pool(), (const uint8_t*)slice.data,
+                                                                slice.size);
+            }
+        } else {
+            struct CacheEntry {
+                TDistinctAggState<LT, SumLT>* agg_state;
+                T key;
+                size_t hash_value;
+            };
+
+            std::vector<CacheEntry> cache;
+            cache.reserve(size);
+            for (size_t i = start; i < start + size; ++i) {
+                Slice slice = input_column->get_slice(i);
+                auto* agg_state = state_of(i);
+                if (slice.size >= MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA) {
+                    mem_usage += agg_state->deserialize_and_merge((const uint8_t*)slice.data, slice.size);
+                } else {
+                    T key;
+                    memcpy(&key, slice.data, sizeof(T));
+                    cache.push_back(CacheEntry{agg_state, key, agg_state->set.hash_function()(key)});
+                }
+            }
+            size_t prefetch_index = 16;
+
+            MemPool* mem_pool = ctx->mem_pool();
+            for (size_t i = 0; i < cache.size(); ++i) {
+                if (prefetch_index < cache.size()) {
+                    cache[prefetch_index].agg_state->set.prefetch_hash(cache[prefetch_index].hash_value);
+                    prefetch_index++;
+                }
+                mem_usage += cache[i].agg_state->update_with_hash(mem_pool, cache[i].key, cache[i].hash_value);
+            }
+        }
+        ctx->add_mem_usage(mem_usage);
+    }
 };
 
 template <LogicalType LT, AggDistinctType DistinctType, typename T = RunTimeCppType<LT>>
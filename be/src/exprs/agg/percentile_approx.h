@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "column/column_helper.h"
 #include "column/object_column.h"
 #include "column/vectorized_fwd.h"
@@ -56,6 +58,41 @@ public:
         data(state).is_null = false;
     }
 
+    // Adds the values of the chunk to the digest in one batch instead of row by row.
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const DoubleColumn* input = nullptr;
+        const uint8_t* nulls = nullptr;
+        if (columns[0]->is_nullable()) {
+            const auto* nullable_column = down_cast<const NullableColumn*>(columns[0]);
+            input = down_cast<const DoubleColumn*>(nullable_column->data_column().get());
+            if (nullable_column->has_null()) {
+                nulls = nullable_column->immutable_null_column_data().data();
+            }
+        } else {
+            input = down_cast<const DoubleColumn*>(columns[0]);
+        }
+
+        const auto& data = input->get_data();
+        std::vector<float> values;
+        values.reserve(chunk_size);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (nulls == nullptr || !nulls[i]) {
+                values.push_back(implicit_cast<float>(data[i]));
+            }
+        }
+        if (values.empty()) {
+            return;
+        }
+
+        DCHECK(!columns[1]->only_null());
+        DCHECK(!columns[1]->is_null(0));
+
+        this->data(state).percentile->add(values.data(), values.size());
+        this->data(state).targetQuantile = columns[1]->get(0).get_double();
+        this->data(state).is_null = false;
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         Slice src;
         if (column->is_nullable()) {
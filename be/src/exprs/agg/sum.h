@@ -71,6 +71,33 @@ public:
         this->data(state).sum -= column.get_data()[row_num];
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        const auto* column = down_cast<const InputColumnType*>(columns[0]);
+        const auto* data = column->get_data().data();
+        // Integer addition is associative, so the rows of a run can be summed up in a register first.
+        // Floating point sums keep the row order.
+        if constexpr (std::is_integral_v<ResultType> || std::is_same_v<ResultType, int128_t>) {
+            if (has_long_state_runs(states, chunk_size)) {
+                size_t i = 0;
+                while (i < chunk_size) {
+                    AggDataPtr state = states[i];
+                    ResultType sum = data[i];
+                    size_t j = i + 1;
+                    for (; j < chunk_size && states[j] == state; ++j) {
+                        sum += data[j];
+                    }
+                    this->data(state + state_offset).sum += sum;
+                    i = j;
+                }
+                return;
+            }
+        }
+        for (size_t i = 0; i < chunk_size; ++i) {
+            this->data(states[i] + state_offset).sum += data[i];
+        }
+    }
+
     void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
                                    AggDataPtr __restrict state) const override {
         const auto* column = down_cast<const InputColumnType*>(columns[0]);
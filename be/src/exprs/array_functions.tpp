@@ -54,8 +54,6 @@ private:
         ColumnPtr src_column = ColumnHelper::unpack_and_duplicate_const_column(chunk_size, columns[0]);
         ColumnPtr dest_column = src_column->clone_empty();
 
-        HashSet hash_set;
-
         if (columns[0]->is_nullable()) {
             const auto* src_nullable_column = down_cast<const NullableColumn*>(src_column.get());
             const auto* src_data_column = down_cast<const ArrayColumn*>(src_nullable_column->data_column().get());
@@ -66,61 +64,69 @@ private:
             dest_null_data = src_nullable_column->immutable_null_column_data();
             dest_nullable_column.set_has_null(src_nullable_column->has_null());
 
+            const uint8_t* row_nulls = nullptr;
             if (src_nullable_column->has_null()) {
-                for (size_t i = 0; i < chunk_size; i++) {
-                    if (!src_nullable_column->is_null(i)) {
-                        _array_distinct_item<HashSet>(*src_data_column, i, &hash_set, &dest_data_column);
-                        hash_set.clear();
-                    } else {
-                        dest_data_column.append_default();
-                    }
-                }
-            } else {
-                for (size_t i = 0; i < chunk_size; i++) {
-                    _array_distinct_item<HashSet>(*src_data_column, i, &hash_set, &dest_data_column);
-                    hash_set.clear();
-                }
+                row_nulls = src_nullable_column->immutable_null_column_data().data();
             }
+            _array_distinct_column<HashSet>(*src_data_column, row_nulls, &dest_data_column);
         } else {
             const auto* src_data_column = down_cast<const ArrayColumn*>(src_column.get());
             auto* dest_data_column = down_cast<ArrayColumn*>(dest_column.get());
-
-            for (size_t i = 0; i < chunk_size; i++) {
-                _array_distinct_item<HashSet>(*src_data_column, i, &hash_set, dest_data_column);
-                hash_set.clear();
-            }
+            _array_distinct_column<HashSet>(*src_data_column, nullptr, dest_data_column);
         }
         return dest_column;
     }
 
+    // Dedupes the elements of each row in place over the flattened elements column, and copies the kept
+    // elements, the first null and the first occurrence of each value, into `dest_column` at once.
+    // The rows of `row_nulls` become empty arrays.
     template <typename HashSet>
-    static void _array_distinct_item(const ArrayColumn& column, size_t index, HashSet* hash_set,
-                                     ArrayColumn* dest_column) {
-        bool has_null = false;
-        // TODO: may be has performance problem, optimize later
-        Datum v = column.get(index);
-        const auto& items = v.get<DatumArray>();
+    static void _array_distinct_column(const ArrayColumn& src_column, const uint8_t* row_nulls,
+                                       ArrayColumn* dest_column) {
+        const auto& src_offsets = src_column.offsets().get_data();
+        const Column* src_elements = &src_column.elements();
+        const uint8_t* element_nulls = nullptr;
+        if (src_elements->is_nullable()) {
+            const auto* nullable_elements = down_cast<const NullableColumn*>(src_elements);
+            if (nullable_elements->has_null()) {
+                element_nulls = nullable_elements->immutable_null_column_data().data();
+            }
+            src_elements = nullable_elements->data_column().get();
+        }
+        const auto* element_data = down_cast<const RunTimeColumnType<LT>*>(src_elements);
 
-        auto& dest_data_column = dest_column->elements_column();
         auto& dest_offsets = dest_column->offsets_column()->get_data();
+        Buffer<uint32_t> selection;
+        selection.reserve(src_column.elements().size());
+        HashSet hash_set;
 
-        for (const auto& item : items) {
-            if (item.is_null()) {
-                if (!has_null) {
-                    dest_data_column->append_nulls(1);
-                    has_null = true;
+        size_t num_rows = src_column.size();
+        for (size_t i = 0; i < num_rows; i++) {
+            if (row_nulls == nullptr || !row_nulls[i]) {
+                bool has_null = false;
+                for (uint32_t j = src_offsets[i]; j < src_offsets[i + 1]; j++) {
+                    if (element_nulls != nullptr && element_nulls[j]) {
+                        if (!has_null) {
+                            selection.push_back(j);
+                            has_null = true;
+                        }
+                        continue;
+                    }
+                    bool inserted;
+                    if constexpr (lt_is_string<LT>) {
+                        inserted = hash_set.emplace(element_data->get_slice(j)).second;
+                    } else {
+                        inserted = hash_set.emplace(element_data->get_data()[j]).second;
+                    }
+                    if (inserted) {
+                        selection.push_back(j);
+                    }
                 }
-                continue;
-            }
-
-            const auto& tt = item.get<CppType>();
-            if (hash_set->count(tt) == 0) {
-                hash_set->emplace(tt);
-                dest_data_column->append_datum(tt);
+                hash_set.clear();
             }
+            dest_offsets.emplace_back(selection.size());
         }
-
-        dest_offsets.emplace_back(dest_offsets.back() + hash_set->size() + has_null);
+        dest_column->elements_column()->append_selective(src_column.elements(), selection);
     }
 };
 
@@ -604,7 +610,7 @@ protected:
             return;
         }
 
-        auto null_first_fn = [src_null_column](size_t i) -> bool { return src_null_column.get_data()[i] == 1; };
+        auto null_first_fn = [&src_null_column](size_t i) -> bool { return src_null_column.get_data()[i] == 1; };
 
         auto begin_of_not_null =
                 std::partition(sort_index->begin() + start, sort_index->begin() + start + count, null_first_fn);
@@ -14,9 +14,15 @@
 
 #include "exprs/compound_predicate.h"
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exprs/binary_function.h"
+#include "exprs/column_ref.h"
+#include "exprs/function_call_expr.h"
 #include "exprs/jit/ir_helper.h"
+#include "exprs/like_predicate.h"
+#include "exprs/literal.h"
+#include "exprs/multi_pattern_matcher.h"
 #include "exprs/predicate.h"
 #include "exprs/unary_function.h"
 #include "runtime/runtime_state.h"
@@ -123,7 +129,34 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    Status prepare(RuntimeState* state, ExprContext* context) override {
+        RETURN_IF_ERROR(Expr::prepare(state, context));
+        if (!config::enable_multi_pattern_match || _pattern_matcher != nullptr) {
+            return Status::OK();
+        }
+        // Matches all the patterns by one scan of each value, if this is an OR of LIKE and REGEXP of one column.
+        ColumnRef* column_ref = nullptr;
+        std::vector<MultiPatternMatcher::Pattern> patterns;
+        if (!_collect_patterns(this, &column_ref, &patterns) || patterns.size() < 2) {
+            return Status::OK();
+        }
+        auto matcher = MultiPatternMatcher::get_or_compile(patterns);
+        if (matcher.ok()) {
+            _pattern_column = column_ref;
+            _pattern_matcher = std::move(matcher).value();
+        } else {
+            VLOG_QUERY << "Failed to match the patterns of " << patterns.size() << " LIKE or REGEXP at once, match "
+                       << "them one by one: " << matcher.status();
+        }
+        return Status::OK();
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        if (_pattern_matcher != nullptr) {
+            ASSIGN_OR_RETURN(auto column, _pattern_column->evaluate_checked(context, ptr));
+            return _pattern_matcher->match(column);
+        }
         ASSIGN_OR_RETURN(auto l, _children[0]->evaluate_checked(context, ptr));
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -181,6 +214,46 @@ public:
             << ", rhs_is_constant=" << _children[1]->is_constant() << ", expr (" << expr_debug_string << ") )";
         return out.str();
     }
+
+private:
+    // Collects the patterns of the leaves of the OR tree rooted by `expr`, returns false unless they are all LIKE or
+    // REGEXP of the same column with the constant patterns.
+    static bool _collect_patterns(Expr* expr, ColumnRef** column_ref,
+                                  std::vector<MultiPatternMatcher::Pattern>* patterns) {
+        if (expr->op() == TExprOpcode::COMPOUND_OR) {
+            return _collect_patterns(expr->get_child(0), column_ref, patterns) &&
+                   _collect_patterns(expr->get_child(1), column_ref, patterns);
+        }
+        auto* call = dynamic_cast<VectorizedFunctionCallExpr*>(expr);
+        if (call == nullptr || call->get_function_desc() == nullptr || call->get_num_children() != 2) {
+            return false;
+        }
+        auto fn = call->get_function_desc()->scalar_function;
+        if (fn != &LikePredicate::like && fn != &LikePredicate::regex) {
+            return false;
+        }
+        auto* column = call->get_child(0);
+        auto* literal = dynamic_cast<VectorizedLiteral*>(call->get_child(1));
+        if (!column->is_slotref() || literal == nullptr) {
+            return false;
+        }
+        auto* ref = down_cast<ColumnRef*>(column);
+        if (*column_ref != nullptr && (*column_ref)->slot_id() != ref->slot_id()) {
+            return false;
+        }
+        auto pattern = literal->evaluate_checked(nullptr, nullptr);
+        if (!pattern.ok() || pattern.value()->only_null()) {
+            return false;
+        }
+        *column_ref = ref;
+        patterns->push_back({ColumnHelper::get_const_value<TYPE_VARCHAR>(pattern.value()).to_string(),
+                             fn == &LikePredicate::like});
+        return true;
+    }
+
+    // Set if all the patterns are matched by `_pattern_matcher` instead of the children.
+    ColumnRef* _pattern_column = nullptr;
+    std::shared_ptr<const MultiPatternMatcher> _pattern_matcher;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
@@ -22,8 +22,132 @@
 #include "types/logical_type.h"
 
 namespace starrocks {
+
+// Returns `bits` such that |data[i]| <= 2^bits for every i in [0, n). The loop has no branch and reduces with OR,
+// so the compiler vectorizes it.
+static inline int decimal128_magnitude_bits(const int128_t* data, size_t n) {
+    uint128_t mask = 0;
+    for (size_t i = 0; i < n; ++i) {
+        mask |= static_cast<uint128_t>(data[i] ^ (data[i] >> 127));
+    }
+    return mask == 0 ? 0 : 128 - clz128(mask);
+}
+
+template <typename BinaryOperator>
+struct DecimalBinaryOperatorTraits {
+    using OpType = void;
+};
+
+template <typename Op, LogicalType Type, typename Guard0, typename Guard1>
+struct DecimalBinaryOperatorTraits<ArithmeticBinaryOperator<Op, Type, Guard0, Guard1>> {
+    using OpType = Op;
+};
+
+// The DECIMAL128 operations that can be evaluated without per-row overflow checks after a range analysis of the
+// operands of a chunk, see DecimalBinaryFunction::narrow_evaluate.
+template <typename BinaryOperator, typename LhsCppType, typename RhsCppType, typename ResultCppType,
+          typename Op = typename DecimalBinaryOperatorTraits<BinaryOperator>::OpType>
+constexpr bool is_narrowable_decimal128_op =
+        std::is_same_v<LhsCppType, int128_t> && std::is_same_v<RhsCppType, int128_t> &&
+        std::is_same_v<ResultCppType, int128_t> &&
+        (is_add_op<Op> || is_sub_op<Op> || is_reverse_sub_op<Op> || is_mul_op<Op> || is_div_op<Op>);
+
 template <OverflowMode overflow_mode, typename Op>
 struct DecimalBinaryFunction {
+    // Evaluates a DECIMAL128 add/sub/mul/div over a chunk without the per-row overflow checks when the magnitudes of
+    // the operands prove that no row overflows, and returns false to leave the chunk to the checked loop otherwise.
+    // The multiplications of operands that fit in 64 bits and the divisions of operands that fit in 63 bits are
+    // computed in 64-bit arithmetic. `scale_lhs` means the lhs is scaled up by `scale_factor` in the loop.
+    template <bool lhs_is_const, bool rhs_is_const, bool scale_lhs, typename NarrowOp>
+    static inline bool narrow_evaluate(size_t num_rows, const int128_t* lhs_data, const int128_t* rhs_data,
+                                       int128_t* result_data, const int128_t& lhs_datum, const int128_t& rhs_datum,
+                                       const int128_t& scale_factor) {
+        const int lhs_bits = lhs_is_const ? decimal128_magnitude_bits(&lhs_datum, 1)
+                                          : decimal128_magnitude_bits(lhs_data, num_rows);
+        const int rhs_bits = rhs_is_const ? decimal128_magnitude_bits(&rhs_datum, 1)
+                                          : decimal128_magnitude_bits(rhs_data, num_rows);
+        // scale_factor < 2^scale_bits
+        const int scale_bits = scale_lhs ? 128 - clz128(scale_factor) : 0;
+
+        auto lhs_at = [&](size_t i) -> int128_t {
+            if constexpr (lhs_is_const) {
+                return lhs_datum;
+            } else if constexpr (scale_lhs) {
+                return lhs_data[i] * scale_factor;
+            } else {
+                return lhs_data[i];
+            }
+        };
+        auto rhs_at = [&](size_t i) -> int128_t {
+            if constexpr (rhs_is_const) {
+                return rhs_datum;
+            } else {
+                return rhs_data[i];
+            }
+        };
+
+        if constexpr (is_add_op<NarrowOp> || is_sub_op<NarrowOp> || is_reverse_sub_op<NarrowOp>) {
+            // |lhs| < 2^126 and |rhs| < 2^126, so |lhs +/- rhs| < 2^127
+            if (std::max(lhs_bits + scale_bits, rhs_bits) > 125) {
+                return false;
+            }
+            for (size_t i = 0; i < num_rows; ++i) {
+                if constexpr (is_add_op<NarrowOp>) {
+                    result_data[i] = lhs_at(i) + rhs_at(i);
+                } else if constexpr (is_sub_op<NarrowOp>) {
+                    result_data[i] = lhs_at(i) - rhs_at(i);
+                } else {
+                    result_data[i] = rhs_at(i) - lhs_at(i);
+                }
+            }
+            return true;
+        } else if constexpr (is_mul_op<NarrowOp>) {
+            static_assert(!scale_lhs);
+            if (lhs_bits <= 63 && rhs_bits <= 63) {
+                // both operands fit in int64, and |lhs * rhs| <= 2^126
+                for (size_t i = 0; i < num_rows; ++i) {
+                    result_data[i] = static_cast<int128_t>(static_cast<int64_t>(lhs_at(i))) *
+                                     static_cast<int64_t>(rhs_at(i));
+                }
+                return true;
+            }
+            if (lhs_bits + rhs_bits <= 126) {
+                for (size_t i = 0; i < num_rows; ++i) {
+                    result_data[i] = lhs_at(i) * rhs_at(i);
+                }
+                return true;
+            }
+            return false;
+        } else if constexpr (is_div_op<NarrowOp>) {
+            // the scaled lhs and the rhs fit in int64 without reaching INT64_MIN, so the division can not trap
+            if (lhs_bits + scale_bits > 62 || rhs_bits > 62) {
+                return false;
+            }
+            bool has_zero = false;
+            if constexpr (rhs_is_const) {
+                has_zero = rhs_datum == 0;
+            } else {
+                for (size_t i = 0; i < num_rows; ++i) {
+                    has_zero |= rhs_data[i] == 0;
+                }
+            }
+            if (has_zero) {
+                // leave the divide-by-zero rows to the checked loop
+                return false;
+            }
+            for (size_t i = 0; i < num_rows; ++i) {
+                int64_t quotient;
+                DecimalV3Arithmetics<int64_t, false>::div_round(static_cast<int64_t>(lhs_at(i)),
+                                                                static_cast<int64_t>(rhs_at(i)), &quotient);
+                result_data[i] = quotient;
+            }
+            return true;
+        } else {
+            static_assert(is_div_op<NarrowOp>, "Invalid Op");
+            return false;
+        }
+    }
+
     // Adjust the scale of lhs operand, then evaluate binary operation, the rules about operand
     // scaling is defined in function: compute_result_type.  each operations are depicted as
     // following:
@@ -79,6 +203,15 @@ struct DecimalBinaryFunction {
             rhs_datum = rhs_data[0];
         }
 
+        if constexpr (is_narrowable_decimal128_op<BinaryOperator, LhsCppType, RhsCppType, ResultCppType>) {
+            using NarrowOp = typename DecimalBinaryOperatorTraits<BinaryOperator>::OpType;
+            // the const lhs has been scaled up above
+            if (narrow_evaluate<lhs_is_const, rhs_is_const, adjust_left && !lhs_is_const, NarrowOp>(
+                        num_rows, lhs_data, rhs_data, result_data, lhs_datum, rhs_datum, scale_factor)) {
+                return false;
+            }
+        }
+
         for (auto i = 0; i < num_rows; ++i) {
             if constexpr (lhs_is_const && rhs_is_const) {
                 overflow = BinaryOperator::template apply<check_overflow<overflow_mode>, false, LhsCppType, RhsCppType,
@@ -20,12 +20,15 @@
 #include "column/column_helper.h"
 #include "column/const_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/anyval_util.h"
 #include "exprs/builtin_functions.h"
 #include "exprs/expr_context.h"
+#include "exprs/function_result_memo.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
 #include "runtime/user_function_cache.h"
+#include "simd/simd.h"
 #include "storage/rowset/bloom_filter.h"
 #include "types/logical_type.h"
 #include "util/failpoint/fail_point.h"
@@ -88,6 +91,8 @@ Status VectorizedFunctionCallExpr::prepare(starrocks::RuntimeState* state, starr
     _is_returning_random_value = _fn.fid == 10300 /* rand */ || _fn.fid == 10301 /* random */ ||
                                  _fn.fid == 10302 /* rand */ || _fn.fid == 10303 /* random */ ||
                                  _fn.fid == 100015 /* uuid */ || _fn.fid == 100016 /* uniq_id */;
+    _is_memoizable = config::enable_expr_result_memoization && !_is_returning_random_value &&
+                     FunctionResultMemo::is_memoizable_function(_fn_desc->name);
 
     return Status::OK();
 }
@@ -183,6 +188,66 @@ StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_checked(starrocks::Expr
     }
 #endif
 
+    ASSIGN_OR_RETURN(auto result, _is_memoizable && ptr != nullptr && ptr->num_rows() > 0
+                                          ? _call_function_memoized(fn_ctx, args, ptr->num_rows())
+                                          : _call_function(fn_ctx, args));
+    // For no args function call (pi, e)
+    if (result->is_constant() && ptr != nullptr) {
+        result->resize(ptr->num_rows());
+    }
+    RETURN_IF_ERROR(result->unfold_const_children(_type));
+    return result;
+}
+
+StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_with_filter(ExprContext* context, Chunk* ptr,
+                                                                     uint8_t* filter) {
+    if (filter == nullptr || ptr == nullptr || _children.empty() || _is_returning_random_value) {
+        return evaluate_checked(context, ptr);
+    }
+    const size_t num_rows = ptr->num_rows();
+    const size_t num_selected = SIMD::count_nonzero(filter, num_rows);
+    if (num_selected == 0 || num_selected > num_rows * config::expr_selective_evaluate_max_ratio) {
+        return evaluate_checked(context, ptr);
+    }
+
+    // Calls the function on the selected rows only, the result of the other rows is undefined.
+    std::vector<uint32_t> selection;
+    selection.reserve(num_selected);
+    for (uint32_t i = 0; i < num_rows; i++) {
+        if (filter[i]) {
+            selection.push_back(i);
+        }
+    }
+    Columns args;
+    args.reserve(_children.size());
+    for (Expr* child : _children) {
+        ASSIGN_OR_RETURN(ColumnPtr column, context->evaluate(child, ptr, filter));
+        DCHECK_EQ(num_rows, column->size());
+        auto selected = column->clone_empty();
+        selected->append_selective(*column, selection.data(), 0, num_selected);
+        args.emplace_back(std::move(selected));
+    }
+
+    FunctionContext* fn_ctx = context->fn_context(_fn_context_index);
+    ASSIGN_OR_RETURN(auto result, _call_function(fn_ctx, args));
+    if (result->is_constant()) {
+        result->resize(num_rows);
+    } else {
+        // Each row takes the result of the first selected row from it, or the last one.
+        std::vector<uint32_t> indexes(num_rows);
+        for (uint32_t i = 0, pos = 0; i < num_rows; i++) {
+            indexes[i] = pos;
+            pos += filter[i] != 0 && pos + 1 < num_selected;
+        }
+        auto scattered = result->clone_empty();
+        scattered->append_selective(*result, indexes.data(), 0, num_rows);
+        result = std::move(scattered);
+    }
+    RETURN_IF_ERROR(result->unfold_const_children(_type));
+    return result;
+}
+
+StatusOr<ColumnPtr> VectorizedFunctionCallExpr::_call_function(FunctionContext* fn_ctx, const Columns& args) {
     StatusOr<ColumnPtr> result;
     if (_fn_desc->exception_safe) {
         result = _fn_desc->scalar_function(fn_ctx, args);
@@ -198,13 +263,24 @@ StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_checked(starrocks::Expr
                     fmt::format("Result column of function {} exceed limit: {}", _fn_desc->name, err_msg));
         }
     }
+    return result;
+}
 
-    // For no args function call (pi, e)
-    if (result.value()->is_constant() && ptr != nullptr) {
-        result.value()->resize(ptr->num_rows());
+StatusOr<ColumnPtr> VectorizedFunctionCallExpr::_call_function_memoized(FunctionContext* fn_ctx, const Columns& args,
+                                                                        size_t num_rows) {
+    size_t arg_index = 0;
+    if (!FunctionResultMemo::is_memoizable_args(args, &arg_index)) {
+        return _call_function(fn_ctx, args);
     }
-    RETURN_IF_ERROR(result.value()->unfold_const_children(_type));
-    return result;
+    auto& memo = fn_ctx->get_result_memo();
+    if (memo == nullptr) {
+        memo = std::make_unique<FunctionResultMemo>();
+    }
+    if (!memo->enabled()) {
+        return _call_function(fn_ctx, args);
+    }
+    return memo->evaluate(args, arg_index, num_rows,
+                          [this, fn_ctx](const Columns& memo_args) { return _call_function(fn_ctx, memo_args); });
 }
 
 bool VectorizedFunctionCallExpr::ngram_bloom_filter(ExprContext* context, const BloomFilter* bf,
@@ -236,19 +312,26 @@ bool VectorizedFunctionCallExpr::ngram_bloom_filter(ExprContext* context, const
 
     // if empty, which means needle is too short, so index_valid should be false
     DCHECK(!ngram_state->ngram_set.empty());
+    std::vector<uint64_t>& ngram_hashes = ngram_state->ngram_hashes;
+    if (ngram_hashes.empty()) {
+        ngram_hashes.reserve(ngram_state->ngram_set.size());
+        for (const auto& ngram : ngram_state->ngram_set) {
+            ngram_hashes.push_back(bf->hash(ngram.get_data(), ngram.get_size()));
+        }
+    }
     if (_fn_desc->name == "LIKE") {
-        for (auto& ngram : ngram_state->ngram_set) {
+        for (uint64_t hash : ngram_hashes) {
             // if any ngram in needle doesn't hit bf, this page has nothing to do with target,so filter it
-            if (!bf->test_bytes(ngram.get_data(), ngram.get_size())) {
+            if (!bf->test_hash(hash)) {
                 return false;
             }
         }
         // if all ngram in needle hit bf, this page may have something to do with needle, so don't filter it
         return true;
     } else {
-        for (auto& ngram : ngram_state->ngram_set) {
+        for (uint64_t hash : ngram_hashes) {
             // if any ngram in needle hit bf, this page may have something to do with needle, so don't filter it
-            if (bf->test_bytes(ngram.get_data(), ngram.get_size())) {
+            if (bf->test_hash(hash)) {
                 return true;
             }
         }
@@ -48,7 +48,15 @@ protected:
 
     [[nodiscard]] StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override;
 
+    // Calls the function on the rows selected by `filter` only, if they are at most
+    // `config::expr_selective_evaluate_max_ratio` of the chunk, e.g. for the conjuncts after the selective ones.
+    [[nodiscard]] StatusOr<ColumnPtr> evaluate_with_filter(ExprContext* context, Chunk* ptr, uint8_t* filter) override;
+
 private:
+    StatusOr<ColumnPtr> _call_function(FunctionContext* fn_ctx, const Columns& args);
+    // Calls the function through the result memo of |fn_ctx| if its arguments allow, see FunctionResultMemo.
+    StatusOr<ColumnPtr> _call_function_memoized(FunctionContext* fn_ctx, const Columns& args, size_t num_rows);
+
     bool split_normal_string_to_ngram(FunctionContext* fn_ctx, const NgramBloomFilterReaderOptions& reader_options,
                                       NgramBloomFilterState* ngram_state, const std::string& func_name) const;
 
@@ -58,6 +66,7 @@ private:
     const FunctionDescriptor* _fn_desc{nullptr};
 
     bool _is_returning_random_value = false;
+    bool _is_memoizable = false;
 };
 
 } // namespace starrocks
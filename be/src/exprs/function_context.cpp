@@ -21,6 +21,7 @@
 #include "column/struct_column.h"
 #include "column/type_traits.h"
 #include "exprs/agg/java_udaf_function.h"
+#include "exprs/function_result_memo.h"
 #include "runtime/runtime_state.h"
 #include "storage/rowset/bloom_filter.h"
 #include "types/logical_type_infra.h"
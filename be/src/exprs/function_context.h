@@ -33,6 +33,7 @@ class Column;
 class Slice;
 struct JavaUDAFContext;
 struct NgramBloomFilterState;
+class FunctionResultMemo;
 using ColumnPtr = std::shared_ptr<Column>;
 
 class FunctionContext {
@@ -177,6 +178,8 @@ public:
 
     std::unique_ptr<NgramBloomFilterState>& get_ngram_state() { return _ngramState; }
 
+    std::unique_ptr<FunctionResultMemo>& get_result_memo() { return _result_memo; }
+
 private:
     friend class ExprContext;
 
@@ -222,6 +225,9 @@ private:
 
     // used for ngram bloom filter to speed up some function
     std::unique_ptr<NgramBloomFilterState> _ngramState;
+
+    // used to memoize the results of some deterministic function
+    std::unique_ptr<FunctionResultMemo> _result_memo;
 };
 
 } // namespace starrocks
@@ -26,13 +26,14 @@ NullColumnPtr FunctionHelper::union_nullable_column(const ColumnPtr& v1, const C
     if (v1->is_nullable() && v2->is_nullable()) {
         const auto& n1 = ColumnHelper::as_raw_column<NullableColumn>(v1)->null_column();
         const auto& n2 = ColumnHelper::as_raw_column<NullableColumn>(v2)->null_column();
+        // the union of a null-free column is the other one
         if (!v1->has_null()) {
             result = n2->clone();
-        }
-        if (!v2->has_null()) {
+        } else if (!v2->has_null()) {
             result = n1->clone();
+        } else {
+            return union_null_column(n1, n2);
         }
-        return union_null_column(n1, n2);
     } else if (v1->is_nullable()) {
         result = ColumnHelper::as_raw_column<NullableColumn>(v1)->null_column()->clone();
     } else if (v2->is_nullable()) {
@@ -0,0 +1,137 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/function_result_memo.h"
+
+#include "column/binary_column.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+
+namespace starrocks {
+
+bool FunctionResultMemo::is_memoizable_function(const std::string& name) {
+    static const phmap::flat_hash_set<std::string> kFunctions = {
+            // string functions
+            "regexp_extract", "regexp_extract_all", "regexp_replace", "parse_url", "url_extract_host",
+            "url_extract_parameter",
+            // json functions
+            "get_json_string", "get_json_object", "get_json_int", "get_json_double", "parse_json",
+            // geo functions
+            "ST_GeomFromText", "ST_GeometryFromText", "ST_LineFromText", "ST_LineStringFromText", "ST_Polygon",
+            "ST_PolyFromText", "ST_PolygonFromText", "ST_AsText", "ST_AsWKT", "ST_X", "ST_Y"};
+    return kFunctions.contains(name);
+}
+
+bool FunctionResultMemo::is_memoizable_args(const Columns& args, size_t* arg_index) {
+    size_t num_non_constants = 0;
+    for (size_t i = 0; i < args.size(); i++) {
+        if (!args[i]->is_constant()) {
+            num_non_constants++;
+            *arg_index = i;
+        }
+    }
+    return num_non_constants == 1 && ColumnHelper::get_data_column(args[*arg_index].get())->is_binary();
+}
+
+StatusOr<ColumnPtr> FunctionResultMemo::evaluate(const Columns& args, size_t arg_index, size_t num_rows,
+                                                 const Function& fn) {
+    const ColumnPtr& input = args[arg_index];
+    DCHECK_EQ(num_rows, input->size());
+    const auto* values = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(input.get()));
+    const uint8_t* nulls =
+            input->is_nullable() ? down_cast<const NullableColumn*>(input.get())->null_column()->raw_data() : nullptr;
+
+    // 1. look up the rows, the values not memoized yet are numbered after the memoized ones
+    const uint32_t num_memoized = size();
+    std::vector<uint32_t> indexes(num_rows);
+    std::vector<uint32_t> miss_rows;
+    for (uint32_t i = 0; i < num_rows; i++) {
+        if (nulls != nullptr && nulls[i]) {
+            if (_null_index < 0) {
+                _null_index = num_memoized + miss_rows.size();
+                miss_rows.push_back(i);
+            }
+            indexes[i] = _null_index;
+            continue;
+        }
+        const Slice value = values->get_slice(i);
+        auto iter = _indexes.find(value);
+        if (iter == _indexes.end()) {
+            uint8_t* data = _pool.allocate(value.size);
+            RETURN_IF_UNLIKELY_NULL(data, Status::MemoryAllocFailed("alloc mem for function result memo failed"));
+            memcpy(data, value.data, value.size);
+            iter = _indexes.emplace(Slice(data, value.size), num_memoized + miss_rows.size()).first;
+            miss_rows.push_back(i);
+        }
+        indexes[i] = iter->second;
+    }
+
+    // 2. call the function on the values not memoized yet only
+    if (!miss_rows.empty()) {
+        const size_t num_misses = miss_rows.size();
+        Columns miss_args;
+        miss_args.reserve(args.size());
+        for (size_t i = 0; i < args.size(); i++) {
+            if (i == arg_index) {
+                auto column = input->clone_empty();
+                column->append_selective(*input, miss_rows.data(), 0, num_misses);
+                miss_args.emplace_back(std::move(column));
+            } else {
+                auto column = args[i]->clone();
+                column->resize(num_misses);
+                miss_args.emplace_back(std::move(column));
+            }
+        }
+        ASSIGN_OR_RETURN(auto miss_results, fn(miss_args));
+        miss_results = ColumnHelper::unpack_and_duplicate_const_column(num_misses, miss_results);
+        if (_results != nullptr && _results->is_nullable() != miss_results->is_nullable()) {
+            // the function returns a column of another nullability, evaluate this chunk as a whole
+            _reset();
+            return fn(args);
+        }
+        if (_results == nullptr) {
+            _results = miss_results->clone_empty();
+        }
+        _results->append(*miss_results);
+    }
+
+    // 3. gather the results, and reset the memo beyond its capacity
+    auto result = _results->clone_empty();
+    result->append_selective(*_results, indexes.data(), 0, num_rows);
+    if (size() > config::expr_result_memoization_capacity) {
+        _reset();
+    }
+
+    // 4. give up the memoization if it does not pay off
+    const bool probing = _lookups < config::expr_result_memoization_probe_rows;
+    _lookups += num_rows;
+    _hits += num_rows - miss_rows.size();
+    if (probing && _lookups >= config::expr_result_memoization_probe_rows &&
+        _hits < _lookups * config::expr_result_memoization_min_hit_rate) {
+        _enabled = false;
+        _reset();
+        _pool.free_all();
+    }
+    return result;
+}
+
+void FunctionResultMemo::_reset() {
+    _indexes.clear();
+    _null_index = -1;
+    _results.reset();
+    _pool.clear();
+}
+
+} // namespace starrocks
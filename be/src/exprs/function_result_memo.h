@@ -0,0 +1,66 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "column/column_hash.h"
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "runtime/mem_pool.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+// Memoizes the results of a deterministic function by the value of its only non-constant argument, which is a
+// string, e.g. the repeated URLs of regexp_extract or the geometries of ST_GeomFromText. It keeps the results of at
+// most config::expr_result_memoization_capacity values, and gives up once the hit rate of the first
+// config::expr_result_memoization_probe_rows rows is below config::expr_result_memoization_min_hit_rate.
+// It belongs to the FunctionContext of the call, so it is used by one thread at a time.
+class FunctionResultMemo {
+public:
+    using Function = std::function<StatusOr<ColumnPtr>(const Columns&)>;
+
+    // Whether the results of the builtin function of |name| are worth memoizing.
+    static bool is_memoizable_function(const std::string& name);
+
+    // Whether |args| can be memoized, it returns the index of the only non-constant argument in |arg_index|.
+    static bool is_memoizable_args(const Columns& args, size_t* arg_index);
+
+    bool enabled() const { return _enabled; }
+
+    // Calls |fn| on the values of |args[arg_index]| which are not memoized yet only, and gathers the results of
+    // all the |num_rows| rows from the memo.
+    StatusOr<ColumnPtr> evaluate(const Columns& args, size_t arg_index, size_t num_rows, const Function& fn);
+
+    size_t size() const { return _results == nullptr ? 0 : _results->size(); }
+
+private:
+    void _reset();
+
+    bool _enabled = true;
+    int64_t _lookups = 0;
+    int64_t _hits = 0;
+
+    // from the input value, whose data is in |_pool|, to the index of its result in |_results|
+    phmap::flat_hash_map<Slice, uint32_t, SliceHash, SliceEqual> _indexes;
+    // the index of the result of the null input, or -1
+    int64_t _null_index = -1;
+    ColumnPtr _results;
+    MemPool _pool;
+};
+
+} // namespace starrocks
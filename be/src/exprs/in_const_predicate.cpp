@@ -14,11 +14,62 @@
 
 #include "exprs/in_const_predicate.hpp"
 
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Value.h>
+
 #include "gutil/strings/substitute.h"
+#include "runtime/runtime_state.h"
 #include "types/logical_type_infra.h"
 
 namespace starrocks {
 
+namespace in_const_pred_detail {
+
+// The max number of the values of a compiled in-predicate, above which the hash set is faster than the comparisons.
+static constexpr size_t MAX_JIT_IN_VALUES = 32;
+
+bool is_jit_compilable(RuntimeState* state, LogicalType type, const std::vector<Expr*>& children) {
+    // The floats are excluded since the hash set does not treat -0.0 and 0.0 as the same value.
+    if (!state->can_jit_expr(CompilableExprType::CMP) || !IRHelper::support_jit(type) || is_float_type(type)) {
+        return false;
+    }
+    if (children.size() < 2 || children.size() > MAX_JIT_IN_VALUES + 1) {
+        return false;
+    }
+    // The values of the other types, e.g. the literals of TYPE_NULL, are not comparable with the value in IR.
+    return std::all_of(children.begin(), children.end(), [&](const Expr* child) { return child->type().type == type; });
+}
+
+StatusOr<LLVMDatum> generate_ir(ExprContext* context, JITContext* jit_ctx, const std::vector<Expr*>& children,
+                                bool is_not_in) {
+    auto& b = jit_ctx->builder;
+    ASSIGN_OR_RETURN(auto lhs, children[0]->generate_ir(context, jit_ctx));
+    llvm::Value* found = b.getInt8(0);
+    llvm::Value* null_in_set = b.getInt8(0);
+    for (size_t i = 1; i < children.size(); i++) {
+        ASSIGN_OR_RETURN(auto value, children[i]->generate_ir(context, jit_ctx));
+        auto* eq = b.CreateIntCast(b.CreateICmpEQ(lhs.value, value.value), b.getInt8Ty(), false);
+        // A null in the list matches nothing, but makes the result null if the value is not found.
+        found = b.CreateOr(found, b.CreateAnd(eq, b.CreateXor(value.null_flag, b.getInt8(1))));
+        null_in_set = b.CreateOr(null_in_set, value.null_flag);
+    }
+    auto* not_found = b.CreateXor(found, b.getInt8(1));
+    LLVMDatum result(b);
+    result.value = is_not_in ? not_found : found;
+    result.null_flag = b.CreateOr(lhs.null_flag, b.CreateAnd(null_in_set, not_found));
+    return result;
+}
+
+std::string jit_func_name(RuntimeState* state, const std::vector<Expr*>& children, bool is_not_in) {
+    std::string name = "{" + children[0]->jit_func_name(state) + (is_not_in ? " not in (" : " in (");
+    for (size_t i = 1; i < children.size(); i++) {
+        name += (i > 1 ? "," : "") + children[i]->jit_func_name(state);
+    }
+    return name + ")}";
+}
+
+} // namespace in_const_pred_detail
+
 ExprContext* VectorizedInConstPredicateBuilder::_create() {
     Expr* probe_expr = _expr;
 
@@ -21,6 +21,7 @@
 #include "column/hash_set.h"
 #include "common/object_pool.h"
 #include "exprs/function_helper.h"
+#include "exprs/jit/ir_helper.h"
 #include "exprs/literal.h"
 #include "exprs/predicate.h"
 #include "gutil/strings/substitute.h"
@@ -47,6 +48,13 @@ struct LHashSet<Type, std::enable_if_t<isSliceLT<Type>>> {
 template <LogicalType Type>
 using LHashSetType = typename LHashSet<Type>::LType;
 
+// The JIT of `children[0] [NOT] IN (children[1], ...)`, which compares the value with the values in the list one by
+// one, instead of looking up the hash set, so it is only used for the short lists of the types supported by JIT.
+bool is_jit_compilable(RuntimeState* state, LogicalType type, const std::vector<Expr*>& children);
+StatusOr<LLVMDatum> generate_ir(ExprContext* context, JITContext* jit_ctx, const std::vector<Expr*>& children,
+                                bool is_not_in);
+std::string jit_func_name(RuntimeState* state, const std::vector<Expr*>& children, bool is_not_in);
+
 } // namespace in_const_pred_detail
 
 /**
@@ -326,6 +334,20 @@ public:
         return evaluate_with_filter(context, ptr, nullptr);
     }
 
+    bool is_compilable(RuntimeState* state) const override {
+        return !_is_join_runtime_filter && !_eq_null && !is_use_array() &&
+               in_const_pred_detail::is_jit_compilable(state, Type, _children);
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        return in_const_pred_detail::generate_ir(context, jit_ctx, _children, _is_not_in);
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return in_const_pred_detail::jit_func_name(state, _children, _is_not_in) + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
     void insert(const ValueType& value) { _hash_set.emplace(value); }
 
     void insert_array(const ValueType& value) {
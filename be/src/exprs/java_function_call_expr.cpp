@@ -14,12 +14,15 @@
 
 #include "exprs/java_function_call_expr.h"
 
+#include <fmt/format.h>
+
 #include <any>
 #include <memory>
 #include <sstream>
 #include <tuple>
 #include <vector>
 
+#include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/column.h"
 #include "column/column_helper.h"
@@ -46,6 +49,9 @@ struct UDFFunctionCallHelper {
 
     // Now we don't support logical type function
     ColumnPtr call(FunctionContext* ctx, Columns& columns, size_t size) {
+        if (fn_desc->evaluate_batch != nullptr && size > 0) {
+            return call_vectorized(ctx, columns, size);
+        }
         auto& helper = JVMFunctionHelper::getInstance();
         JNIEnv* env = helper.getEnv();
         std::vector<DirectByteBuffer> buffers;
@@ -81,6 +87,75 @@ struct UDFFunctionCallHelper {
         return result_cols;
     }
 
+    // Call evaluateBatch with the buffers of the columns, see JavaUDFContext::evaluate_batch.
+    // The ByteBuffers are local references on the memory of the columns, so nothing is copied or boxed and
+    // they are all released with the local frame.
+    ColumnPtr call_vectorized(FunctionContext* ctx, Columns& columns, size_t size) {
+        auto& helper = JVMFunctionHelper::getInstance();
+        JNIEnv* env = helper.getEnv();
+        const int num_cols = ctx->get_num_args();
+        const TypeDescriptor result_type(call_desc->method_desc[0].type);
+        auto result = ColumnHelper::create_column(result_type, true);
+        result->resize(size);
+        auto* nullable_result = down_cast<NullableColumn*>(result.get());
+
+        for (int i = 0; i < num_cols; ++i) {
+            if (columns[i]->only_null()) {
+                auto nulls = ColumnHelper::create_column(*ctx->get_arg_type(i), true);
+                nulls->append_nulls(size);
+                columns[i] = std::move(nulls);
+            } else if (columns[i]->is_constant()) {
+                columns[i] = ColumnHelper::unpack_and_duplicate_const_column(size, columns[i]);
+            }
+        }
+
+        // at most 3 buffers for each argument, the input array and the 2 result buffers
+        env->PushLocalFrame(num_cols * 3 + 3);
+        auto defer = DeferOp([env]() { env->PopLocalFrame(nullptr); });
+        auto new_buffer = [env](const void* data, size_t bytes) {
+            return env->NewDirectByteBuffer(const_cast<void*>(data), static_cast<jlong>(bytes));
+        };
+
+        std::vector<jobject> inputs;
+        for (int i = 0; i < num_cols; ++i) {
+            const Column* column = columns[i].get();
+            if (column->is_nullable()) {
+                const auto& nulls = down_cast<const NullableColumn*>(column)->immutable_null_column_data();
+                inputs.emplace_back(new_buffer(nulls.data(), nulls.size()));
+                column = down_cast<const NullableColumn*>(column)->data_column().get();
+            } else {
+                inputs.emplace_back(nullptr);
+            }
+            if (column->is_binary()) {
+                const auto* binary = down_cast<const BinaryColumn*>(column);
+                const auto& offsets = binary->get_offset();
+                const auto& bytes = binary->get_bytes();
+                inputs.emplace_back(new_buffer(offsets.data(), offsets.size() * sizeof(uint32_t)));
+                inputs.emplace_back(new_buffer(bytes.data(), bytes.size()));
+            } else {
+                inputs.emplace_back(new_buffer(column->raw_data(), column->byte_size()));
+            }
+        }
+        jobjectArray input_arr = env->NewObjectArray(inputs.size(), helper.direct_buffer_class(), nullptr);
+        RETURN_IF_UNLIKELY_NULL(input_arr, ColumnHelper::create_const_null_column(size));
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            env->SetObjectArrayElement(input_arr, i, inputs[i]);
+        }
+
+        auto& result_nulls = nullable_result->null_column_data();
+        Column* result_data = nullable_result->mutable_data_column();
+        jobject nulls_buffer = new_buffer(result_nulls.data(), result_nulls.size());
+        jobject data_buffer = new_buffer(result_data->mutable_raw_data(), result_data->byte_size());
+        env->CallVoidMethod(fn_desc->udf_handle.handle(), fn_desc->evaluate_batch, static_cast<jint>(size), input_arr,
+                            nulls_buffer, data_buffer);
+        if (env->ExceptionCheck()) {
+            CHECK_UDF_CALL_EXCEPTION(env, ctx);
+            return ColumnHelper::create_const_null_column(size);
+        }
+        nullable_result->update_has_null();
+        return result;
+    }
+
     ColumnPtr get_boxed_result(FunctionContext* ctx, jobject result, size_t num_rows) {
         if (result == nullptr) {
             return ColumnHelper::create_const_null_column(num_rows);
@@ -190,6 +265,7 @@ StatusOr<std::shared_ptr<JavaUDFContext>> JavaFunctionCallExpr::_build_udf_func_
     // RETURN_IF_ERROR(add_method("prepare", &desc->prepare));
     // RETURN_IF_ERROR(add_method("method_close", &desc->close));
     RETURN_IF_ERROR(add_method("evaluate", &desc->evaluate));
+    RETURN_IF_ERROR(_resolve_evaluate_batch(desc.get()));
 
     // create UDF function instance
     ASSIGN_OR_RETURN(desc->udf_handle, desc->udf_class.newInstance());
@@ -216,6 +292,48 @@ StatusOr<std::shared_ptr<JavaUDFContext>> JavaFunctionCallExpr::_build_udf_func_
     return desc;
 }
 
+Status JavaFunctionCallExpr::_resolve_evaluate_batch(JavaUDFContext* desc) {
+    auto& helper = JVMFunctionHelper::getInstance();
+    JNIEnv* env = helper.getEnv();
+    jmethodID method = env->GetMethodID(desc->udf_class.clazz(), JavaUDFContext::EVALUATE_BATCH_METHOD_NAME,
+                                        JavaUDFContext::EVALUATE_BATCH_METHOD_SIGNATURE);
+    if (method == nullptr) {
+        // NoSuchMethodError, the UDF only has the row-based evaluate
+        env->ExceptionClear();
+        return Status::OK();
+    }
+    // the result is written in place, so it must be a fixed length type
+    auto is_fixed_length = [](LogicalType type) {
+        switch (type) {
+        case TYPE_BOOLEAN:
+        case TYPE_TINYINT:
+        case TYPE_SMALLINT:
+        case TYPE_INT:
+        case TYPE_BIGINT:
+        case TYPE_FLOAT:
+        case TYPE_DOUBLE:
+            return true;
+        default:
+            return false;
+        }
+    };
+    if (!is_fixed_length(_type.type)) {
+        return Status::NotSupported(fmt::format("{} of {} does not support the return type {}",
+                                                JavaUDFContext::EVALUATE_BATCH_METHOD_NAME, _fn.scalar_fn.symbol,
+                                                type_to_string(_type.type)));
+    }
+    for (Expr* child : _children) {
+        const auto type = child->type().type;
+        if (!is_fixed_length(type) && type != TYPE_VARCHAR && type != TYPE_CHAR) {
+            return Status::NotSupported(fmt::format("{} of {} does not support the argument type {}",
+                                                    JavaUDFContext::EVALUATE_BATCH_METHOD_NAME, _fn.scalar_fn.symbol,
+                                                    type_to_string(type)));
+        }
+    }
+    desc->evaluate_batch = method;
+    return Status::OK();
+}
+
 Status JavaFunctionCallExpr::open(RuntimeState* state, ExprContext* context,
                                   FunctionContext::FunctionStateScope scope) {
     // init parent open
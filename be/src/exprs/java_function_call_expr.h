@@ -41,6 +41,8 @@ private:
                                                                    FunctionContext::FunctionStateScope scope,
                                                                    const std::string& libpath);
     void _call_udf_close();
+    // Look up the optional evaluateBatch method of the UDF class.
+    Status _resolve_evaluate_batch(JavaUDFContext* desc);
     RuntimeState* _runtime_state = nullptr;
     std::shared_ptr<JavaUDFContext> _func_desc;
     std::shared_ptr<UDFFunctionCallHelper> _call_helper;
@@ -19,6 +19,7 @@
 #include <llvm/Analysis/Passes.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
@@ -35,6 +36,7 @@
 #include <llvm/Passes/PassBuilder.h>
 #include <llvm/Passes/PassPlugin.h>
 #include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
 #include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/TargetSelect.h>
@@ -54,6 +56,7 @@
 #include <llvm/Transforms/Vectorize/LoopVectorize.h>
 #include <llvm/Transforms/Vectorize/SLPVectorizer.h>
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -65,7 +68,9 @@
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
 #include "util/defer_op.h"
+#include "util/hash_util.hpp"
 #include "util/mem_info.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -157,6 +162,21 @@ Status JITEngine::init() {
     llvm::InitializeNativeTargetAsmParser();
     llvm::InitializeNativeTargetDisassembler();
     llvm::sys::DynamicLibrary::LoadLibraryPermanently(nullptr);
+    auto st = ThreadPoolBuilder("jit_compile")
+                      .set_min_threads(0)
+                      .set_max_threads(std::max(1, config::jit_compile_thread_num))
+                      .set_max_queue_size(config::jit_compile_max_pending_tasks)
+                      .build(&_compile_pool);
+    if (!st.ok()) {
+        // The expressions are compiled in place without the pool.
+        LOG(WARNING) << "Failed to create the JIT compile thread pool: " << st;
+    }
+    if (!config::jit_object_cache_dir.empty()) {
+        if (auto ec = llvm::sys::fs::create_directories(config::jit_object_cache_dir)) {
+            LOG(WARNING) << "Failed to create the JIT object cache dir " << config::jit_object_cache_dir << ": "
+                         << ec.message();
+        }
+    }
     _initialized = true;
     _support_jit = true;
     return Status::OK();
@@ -173,6 +193,9 @@ Status JITEngine::compile_scalar_function(ExprContext* context, JitObjectCache*
     if (cached) {
         return Status::OK();
     }
+    if (instance->_load_persisted_function(func_cache)) {
+        return Status::OK();
+    }
 
     ASSIGN_OR_RETURN(auto engine, Engine::create(*func_cache))
     // TODO: check need set module?
@@ -186,9 +209,77 @@ Status JITEngine::compile_scalar_function(ExprContext* context, JitObjectCache*
     }
     ASSIGN_OR_RETURN(auto function, engine->get_compiled_func(func_cache->get_func_name()));
     RETURN_IF_ERROR(func_cache->register_func(function));
+    instance->_persist_function(*func_cache);
     return Status::OK();
 }
 
+Status JITEngine::submit_compile_task(std::function<void()> task) {
+    if (_compile_pool == nullptr) {
+        return Status::ServiceUnavailable("JIT compile thread pool is not created");
+    }
+    return _compile_pool->submit_func(std::move(task));
+}
+
+// The object code depends on the host CPU and the LLVM version besides the function.
+static std::string persisted_object_path(const std::string& func_name) {
+    const std::string key = func_name + "@" + llvm::sys::getHostCPUName().str() + "@" LLVM_VERSION_STRING;
+    return fmt::format("{}/{:016x}.o", config::jit_object_cache_dir, HashUtil::hash64(key.data(), key.size(), 0));
+}
+
+bool JITEngine::_load_persisted_function(JitObjectCache* obj) {
+    if (config::jit_object_cache_dir.empty()) {
+        return false;
+    }
+    const std::string path = persisted_object_path(obj->get_func_name());
+    auto file = llvm::MemoryBuffer::getFile(path);
+    if (!file) {
+        return false;
+    }
+    std::shared_ptr<llvm::MemoryBuffer> obj_code =
+            llvm::MemoryBuffer::getMemBufferCopy((*file)->getBuffer(), (*file)->getBufferIdentifier());
+    auto engine = Engine::create(*obj);
+    if (!engine.ok()) {
+        return false;
+    }
+    if (auto st = engine.value()->add_object(std::move(*file)); !st.ok()) {
+        LOG(WARNING) << "Failed to load the JIT object " << path << ": " << st;
+        return false;
+    }
+    // The lookup fails if the file is of another function with the same hash.
+    auto function = engine.value()->get_compiled_func(obj->get_func_name());
+    if (!function.ok()) {
+        LOG(WARNING) << "Failed to load the JIT object " << path << ": " << function.status();
+        return false;
+    }
+    obj->set_cache(std::move(obj_code), nullptr);
+    return obj->register_func(function.value()).ok();
+}
+
+void JITEngine::_persist_function(const JitObjectCache& obj) {
+    if (config::jit_object_cache_dir.empty() || obj.get_obj_code() == nullptr) {
+        return;
+    }
+    const std::string path = persisted_object_path(obj.get_func_name());
+    // Written into a temporary file and renamed, so that a file being written is never loaded.
+    const std::string tmp_path = fmt::format("{}.{}.tmp", path, reinterpret_cast<uintptr_t>(&obj));
+    std::error_code ec;
+    {
+        llvm::raw_fd_ostream out(tmp_path, ec, llvm::sys::fs::OF_None);
+        if (!ec) {
+            out << obj.get_obj_code()->getBuffer();
+            out.close();
+            ec = out.error();
+        }
+    }
+    if (!ec) {
+        ec = llvm::sys::fs::rename(tmp_path, path);
+    }
+    if (ec) {
+        LOG(WARNING) << "Failed to persist the JIT object " << path << ": " << ec.message();
+        llvm::sys::fs::remove(tmp_path);
+    }
+}
+
 std::string JITEngine::dump_module_ir(const llvm::Module& module) {
     std::string ir;
     llvm::raw_string_ostream stream(ir);
@@ -441,6 +532,15 @@ Status JITEngine::Engine::optimize_and_finalize_module() {
     return Status::OK();
 }
 
+Status JITEngine::Engine::add_object(std::unique_ptr<llvm::MemoryBuffer> obj_code) {
+    auto err = _lljit->addObjectFile(std::move(obj_code));
+    if (err) {
+        return Status::JitCompileError("Failed to add object to LLJIT: " + llvm::toString(std::move(err)));
+    }
+    _module_finalized = true;
+    return Status::OK();
+}
+
 StatusOr<JITScalarFunction> JITEngine::Engine::get_compiled_func(const std::string& function) {
     if (!_module_finalized) {
         return Status::JitCompileError("module must be finalized before getting compiled function");
@@ -22,6 +22,7 @@
 #include <llvm/Transforms/IPO/PassManagerBuilder.h>
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -31,6 +32,7 @@
 #include "exprs/expr_context.h"
 #include "exprs/jit/ir_helper.h"
 #include "util/lru_cache.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -56,6 +58,7 @@ public:
     JITScalarFunction get_func() const { return _func; }
 
     size_t get_code_size() const { return _obj_code == nullptr ? 0 : _obj_code->getBufferSize(); }
+    const llvm::MemoryBuffer* get_obj_code() const { return _obj_code.get(); }
 
 private:
     const std::string _cache_key;
@@ -92,6 +95,10 @@ public:
 
     bool lookup_function(JitObjectCache* const obj);
 
+    // Runs the compilation in the background by the threads of `config::jit_compile_thread_num`. Returns an error if
+    // there are too many compilations waiting.
+    Status submit_compile_task(std::function<void()> task);
+
     Cache* get_func_cache() const { return _func_cache; }
 
     static Status generate_scalar_function_ir(ExprContext* context, llvm::Module& module, Expr* expr,
@@ -120,6 +127,9 @@ private:
 
         Status optimize_and_finalize_module();
 
+        // Adds the object code compiled by another engine, instead of the module.
+        Status add_object(std::unique_ptr<llvm::MemoryBuffer> obj_code);
+
         StatusOr<JITScalarFunction> get_compiled_func(const std::string& function);
 
     private:
@@ -134,9 +144,16 @@ private:
         std::unique_ptr<llvm::TargetMachine> _target_machine;
     };
 
+    // Loads the function compiled by the previous runs of the BE from `config::jit_object_cache_dir`, and registers
+    // it into the LRU cache.
+    bool _load_persisted_function(JitObjectCache* obj);
+    // Stores the object code of the compiled function into `config::jit_object_cache_dir`.
+    void _persist_function(const JitObjectCache& obj);
+
     bool _initialized = false;
     bool _support_jit = false;
     Cache* _func_cache;
+    std::unique_ptr<ThreadPool> _compile_pool;
 };
 
 } // namespace starrocks
@@ -22,6 +22,7 @@
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exprs/anyval_util.h"
@@ -68,10 +69,9 @@ Status JITExpr::prepare_impl(RuntimeState* state, ExprContext* context) {
         return Status::OK();
     }
     _is_prepared = true;
+    _uncompilable_children = _children;
 
     if (!is_constant()) {
-        auto start = MonotonicNanos();
-
         // Compile the expression into native code and retrieve the function pointer.
         auto* jit_engine = JITEngine::get_instance();
         if (!jit_engine->support_jit()) {
@@ -80,37 +80,69 @@ Status JITExpr::prepare_impl(RuntimeState* state, ExprContext* context) {
         auto expr_name = _expr->jit_func_name(state);
         _jit_obj_cache = std::make_unique<JitObjectCache>(expr_name, JITEngine::get_instance()->get_func_cache());
 
-        auto st = jit_engine->compile_scalar_function(context, _jit_obj_cache.get(), _expr, _children);
-        auto elapsed = MonotonicNanos() - start;
-        if (state->fragment_ctx() != nullptr) {
-            state->fragment_ctx()->update_jit_profile(elapsed);
-        }
-        if (!st.ok()) {
-            LOG(INFO) << "JIT: JIT compile failed, time cost: " << elapsed / 1000000.0 << " ms"
-                      << " Reason: " << st;
-        } else {
-            VLOG_QUERY << "JIT: JIT compile success, time cost: " << elapsed / 1000000.0
-                       << " ms :" << _jit_obj_cache->get_func_name()
-                       << " , mem cost: " << _jit_obj_cache->get_code_size();
-            _jit_function = _jit_obj_cache->get_func();
-            if (_jit_function == nullptr) {
-                return Status::RuntimeError("JIT func must be not null");
+        if (config::jit_async_compile && !jit_engine->lookup_function(_jit_obj_cache.get())) {
+            auto task = std::make_shared<std::packaged_task<void()>>([this, state, context]() {
+                // The failure is logged, and the original expression is always evaluated then.
+                (void)_compile(state, context);
+            });
+            _compile_done = task->get_future();
+            if (jit_engine->submit_compile_task([task]() { (*task)(); }).ok()) {
+                return Status::OK();
             }
+            // Too many compilations are waiting, compiles it in place.
+            _compile_done = {};
+        }
+        return _compile(state, context);
+    }
+    return Status::OK();
+}
+
+Status JITExpr::_compile(RuntimeState* state, ExprContext* context) {
+    auto start = MonotonicNanos();
+    auto st = JITEngine::compile_scalar_function(context, _jit_obj_cache.get(), _expr, _uncompilable_children);
+    auto elapsed = MonotonicNanos() - start;
+    if (state->fragment_ctx() != nullptr) {
+        state->fragment_ctx()->update_jit_profile(elapsed);
+    }
+    if (!st.ok()) {
+        LOG(INFO) << "JIT: JIT compile failed, time cost: " << elapsed / 1000000.0 << " ms"
+                  << " Reason: " << st;
+    } else {
+        VLOG_QUERY << "JIT: JIT compile success, time cost: " << elapsed / 1000000.0
+                   << " ms :" << _jit_obj_cache->get_func_name() << " , mem cost: " << _jit_obj_cache->get_code_size();
+        auto* function = _jit_obj_cache->get_func();
+        if (function == nullptr) {
+            return Status::RuntimeError("JIT func must be not null");
         }
+        _jit_function.store(function, std::memory_order_release);
     }
     return Status::OK();
 }
 
+void JITExpr::close(RuntimeState* state, ExprContext* context, FunctionContext::FunctionStateScope scope) {
+    if (_compile_done.valid()) {
+        _compile_done.wait();
+    }
+    Expr::close(state, context, scope);
+}
+
+JITExpr::~JITExpr() {
+    if (_compile_done.valid()) {
+        _compile_done.wait();
+    }
+}
+
 StatusOr<ColumnPtr> JITExpr::evaluate_checked(starrocks::ExprContext* context, Chunk* ptr) {
-    // If the expr fails to compile, evaluate using the original expr.
-    if (UNLIKELY(_jit_function == nullptr)) {
+    // If the expr fails to compile or is being compiled, evaluate using the original expr.
+    auto jit_function = _jit_function.load(std::memory_order_acquire);
+    if (UNLIKELY(jit_function == nullptr)) {
         return _expr->evaluate_checked(context, ptr);
     }
 
     std::vector<JITColumn> jit_columns;
-    jit_columns.reserve(_children.size() + 1);
+    jit_columns.reserve(_uncompilable_children.size() + 1);
     Columns args;
-    args.reserve(_children.size() + 1);
+    args.reserve(_uncompilable_children.size() + 1);
     auto unfold_ptr = [&](const ColumnPtr& column) {
         DCHECK(!column->is_constant());
         auto [un_col, un_col_null] = ColumnHelper::unpack_nullable_column(column);
@@ -122,7 +154,7 @@ StatusOr<ColumnPtr> JITExpr::evaluate_checked(starrocks::ExprContext* context, C
         jit_columns.emplace_back(JITColumn{data_col_ptr, null_flags_ptr});
     };
     size_t num_rows = 0;
-    for (Expr* child : _children) {
+    for (Expr* child : _uncompilable_children) {
         ColumnPtr column = EVALUATE_NULL_IF_ERROR(context, child, ptr);
         num_rows = std::max<size_t>(num_rows, column->size());
         args.emplace_back(column);
@@ -135,10 +167,10 @@ StatusOr<ColumnPtr> JITExpr::evaluate_checked(starrocks::ExprContext* context, C
         return result_column;
     }
     Columns backup_args;
-    backup_args.reserve(_children.size() + 1);
-    for (auto i = 0; i < _children.size(); i++) {
+    backup_args.reserve(_uncompilable_children.size() + 1);
+    for (auto i = 0; i < _uncompilable_children.size(); i++) {
         auto column = args[i];
-        auto child = _children[i];
+        auto child = _uncompilable_children[i];
         if (UNLIKELY((column->is_constant() ^ child->is_constant()) ||
                      (column->is_nullable() ^ child->is_nullable()))) {
             VLOG_QUERY << "[JIT INPUT] expr const = " << child->is_constant() << " null= " << child->is_nullable()
@@ -167,7 +199,7 @@ StatusOr<ColumnPtr> JITExpr::evaluate_checked(starrocks::ExprContext* context, C
 
     unfold_ptr(result_column);
     // inputs are not empty.
-    _jit_function(num_rows, jit_columns.data());
+    jit_function(num_rows, jit_columns.data());
     //TODO: _jit_function return has_null
     if (is_nullable()) {
         down_cast<NullableColumn*>(result_column.get())->update_has_null();
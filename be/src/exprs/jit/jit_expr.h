@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <future>
 #include <string>
+#include <vector>
 
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -32,11 +35,11 @@ public:
 
     JITExpr(const TExprNode& node, Expr* expr);
 
-    ~JITExpr() override = default;
+    ~JITExpr() override;
 
     Expr* clone(ObjectPool* pool) const override { return JITExpr::create(pool, _expr); }
 
-    bool is_jit_compiled() { return _jit_function != nullptr; }
+    bool is_jit_compiled() { return _jit_function.load(std::memory_order_acquire) != nullptr; }
 
     void set_uncompilable_children(RuntimeState* state);
 
@@ -50,11 +53,21 @@ protected:
     // Evaluate the expression using the compiled function.
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override;
 
+    // Waits for the compilation in the background, which refers to the exprs and the context.
+    void close(RuntimeState* state, ExprContext* context, FunctionContext::FunctionStateScope scope) override;
+
 private:
+    Status _compile(RuntimeState* state, ExprContext* context);
+
     // The original expression.
     Expr* _expr;
+    // The inputs of the compiled function.
+    std::vector<Expr*> _uncompilable_children;
     bool _is_prepared = false;
-    JITScalarFunction _jit_function = nullptr;
+    // Set by the compilation in the background if `config::jit_async_compile`, the original expression is evaluated
+    // until then.
+    std::atomic<JITScalarFunction> _jit_function = nullptr;
+    std::future<void> _compile_done;
     std::unique_ptr<JitObjectCache> _jit_obj_cache;
 };
 
@@ -563,6 +563,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_query_impl(FunctionContext* contex
         ColumnBuilder<ResultType> result(num_rows);
 
         JsonPath stored_path;
+        JsonPathShapeCache shape_cache;
         vpack::Builder builder;
         for (int row = 0; row < num_rows; ++row) {
             if (json_viewer.is_null(row)) {
@@ -571,7 +572,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_query_impl(FunctionContext* contex
             }
             JsonValue* json_value = json_viewer.value(row);
             builder.clear();
-            vpack::Slice slice = JsonPath::extract(json_value, state->real_path, &builder);
+            vpack::Slice slice = JsonPath::extract(json_value, state->real_path, &builder, &shape_cache);
             Status st = cast_vpjson_to<ResultType, false>(slice, result);
             if (!st.ok()) {
                 result.append_null();
@@ -600,6 +601,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_query_impl(FunctionContext* contex
     ColumnBuilder<ResultType> result(num_rows);
 
     JsonPath stored_path;
+    JsonPathShapeCache shape_cache;
     vpack::Builder builder;
     for (int row = 0; row < num_rows; ++row) {
         if (json_viewer.is_null(row) || path_viewer.is_null(row)) {
@@ -617,7 +619,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_query_impl(FunctionContext* contex
         }
 
         builder.clear();
-        vpack::Slice slice = JsonPath::extract(json_value, *jsonpath.value(), &builder);
+        vpack::Slice slice = JsonPath::extract(json_value, *jsonpath.value(), &builder, &shape_cache);
         Status st = cast_vpjson_to<ResultType, false>(slice, result);
         if (!st.ok()) {
             result.append_null();
@@ -647,6 +649,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_exists(FunctionContext* context, c
         ColumnBuilder<TYPE_BOOLEAN> result(rows);
 
         JsonPath stored_path;
+        JsonPathShapeCache shape_cache;
         for (int row = 0; row < rows; row++) {
             if (columns[0]->is_null(row)) {
                 result.append_null();
@@ -658,7 +661,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_exists(FunctionContext* context, c
             }
             JsonValue* json_value = json_viewer.value(row);
             vpack::Builder builder;
-            vpack::Slice slice = JsonPath::extract(json_value, state->real_path, &builder);
+            vpack::Slice slice = JsonPath::extract(json_value, state->real_path, &builder, &shape_cache);
             result.append(!slice.isNone());
         }
         return result.build(ColumnHelper::is_all_const(columns));
@@ -683,6 +686,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_exists(FunctionContext* context, c
     ColumnBuilder<TYPE_BOOLEAN> result(num_rows);
 
     JsonPath stored_path;
+    JsonPathShapeCache shape_cache;
     for (int row = 0; row < num_rows; row++) {
         if (json_viewer.is_null(row) || json_viewer.value(row) == nullptr || path_viewer.is_null(row)) {
             result.append_null();
@@ -700,7 +704,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_exists(FunctionContext* context, c
         }
         VLOG(2) << "json_exists for  " << path_str << " of " << json_value->to_string().value();
         vpack::Builder builder;
-        vpack::Slice slice = JsonPath::extract(json_value, *jsonpath.value(), &builder);
+        vpack::Slice slice = JsonPath::extract(json_value, *jsonpath.value(), &builder, &shape_cache);
         result.append(!slice.isNone());
     }
 
@@ -834,6 +838,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_length(FunctionContext* context, c
         ColumnViewer<TYPE_JSON> json_viewer(flat_column);
 
         JsonPath stored_path;
+        JsonPathShapeCache shape_cache;
         for (size_t row = 0; row < rows; row++) {
             if (json_viewer.is_null(row)) {
                 result.append_null();
@@ -843,7 +848,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_length(FunctionContext* context, c
             JsonValue* json = json_viewer.value(row);
             vpack::Slice target_slice;
             vpack::Builder builder;
-            target_slice = JsonPath::extract(json, state->real_path, &builder);
+            target_slice = JsonPath::extract(json, state->real_path, &builder, &shape_cache);
 
             if (target_slice.isObject() || target_slice.isArray()) {
                 result.append(target_slice.length());
@@ -894,6 +899,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_length(FunctionContext* context, c
     }
 
     JsonPath stored_path;
+    JsonPathShapeCache shape_cache;
     for (size_t row = 0; row < rows; row++) {
         if (json_column.is_null(row)) {
             result.append_null();
@@ -913,7 +919,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_length(FunctionContext* context, c
                 continue;
             }
 
-            target_slice = JsonPath::extract(json, *jsonpath.value(), &builder);
+            target_slice = JsonPath::extract(json, *jsonpath.value(), &builder, &shape_cache);
         }
 
         if (target_slice.isObject() || target_slice.isArray()) {
@@ -948,6 +954,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_keys_with_path(FunctionContext* co
     if (state->is_partial_match) {
         ColumnViewer<TYPE_JSON> json_viewer(flat_column);
         ColumnBuilder<TYPE_JSON> result(rows);
+        JsonPathShapeCache shape_cache;
 
         for (size_t row = 0; row < rows; ++row) {
             if (columns[0]->is_null(row) || json_viewer.is_null(row)) {
@@ -957,7 +964,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_keys_with_path(FunctionContext* co
 
             JsonValue* json = json_viewer.value(row);
             vpack::Builder builder;
-            auto slice = JsonPath::extract(json, state->real_path, &builder);
+            auto slice = JsonPath::extract(json, state->real_path, &builder, &shape_cache);
 
             if (!slice.isObject()) {
                 result.append_null();
@@ -1011,6 +1018,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_keys_with_path(FunctionContext* co
     ColumnBuilder<TYPE_JSON> result(rows);
     ColumnViewer<TYPE_VARCHAR> path_viewer(columns[1]);
     JsonPath stored_path;
+    JsonPathShapeCache shape_cache;
 
     for (size_t row = 0; row < rows; row++) {
         if (json_viewer.is_null(row) || json_viewer.value(row) == nullptr) {
@@ -1028,7 +1036,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_keys_with_path(FunctionContext* co
             continue;
         }
 
-        vslice = JsonPath::extract(json_value, *jsonpath.value(), &extract_builder);
+        vslice = JsonPath::extract(json_value, *jsonpath.value(), &extract_builder, &shape_cache);
 
         if (!vslice.isObject()) {
             result.append_null();
@@ -182,8 +182,38 @@ vpack::Slice JsonPathPiece::extract(const JsonValue* json, const std::vector<Jso
     return extract(json->to_vslice(), jsonpath, 1, b);
 }
 
+vpack::Slice JsonPathShapeCache::get(vpack::Slice object, size_t piece, const std::string& key) {
+    if (piece >= _entries.size()) {
+        _entries.resize(piece + 1);
+    }
+    auto& entry = _entries[piece];
+    const vpack::ValueLength length = object.length();
+    if (entry.index < length) {
+        vpack::Slice cached_key = object.keyAt(entry.index);
+        if (cached_key.isString() && cached_key.stringView() == key) {
+            entry.misses = 0;
+            _hits++;
+            return object.valueAt(entry.index);
+        }
+    }
+    if (entry.misses >= MAX_CONSECUTIVE_MISSES) {
+        return object.get(key);
+    }
+    entry.misses++;
+    // Iterates in the same order as keyAt(), i.e. by the index table of the object if any.
+    vpack::ValueLength index = 0;
+    for (const auto& it : vpack::ObjectIterator(object)) {
+        if (it.key.isString() && it.key.stringView() == key) {
+            entry.index = index;
+            return it.value;
+        }
+        index++;
+    }
+    return noneJsonSlice();
+}
+
 vpack::Slice JsonPathPiece::extract(vpack::Slice root, const std::vector<JsonPathPiece>& jsonpath, int path_index,
-                                    vpack::Builder* builder) {
+                                    vpack::Builder* builder, JsonPathShapeCache* cache) {
     vpack::Slice current_value = root;
 
     for (int i = path_index; i < jsonpath.size(); i++) {
@@ -201,7 +231,7 @@ vpack::Slice JsonPathPiece::extract(vpack::Slice root, const std::vector<JsonPat
                 return noneJsonSlice();
             }
 
-            next_item = current_value.get(item_key);
+            next_item = cache != nullptr ? cache->get(current_value, i, item_key) : current_value.get(item_key);
         }
         if (next_item.isNone()) {
             return noneJsonSlice();
@@ -229,7 +259,7 @@ vpack::Slice JsonPathPiece::extract(vpack::Slice root, const std::vector<JsonPat
                 builder->clear();
                 vpack::ArrayBuilder ab(builder);
                 array_selector->iterate(next_item, [&](vpack::Slice array_item) {
-                    auto sub = extract(array_item, jsonpath, i + 1, builder);
+                    auto sub = extract(array_item, jsonpath, i + 1, builder, cache);
                     if (!sub.isNone()) {
                         builder->add(sub);
                     }
@@ -263,6 +293,11 @@ vpack::Slice JsonPath::extract(const JsonValue* json, const JsonPath& jsonpath,
     return JsonPathPiece::extract(json, jsonpath.paths, b);
 }
 
+vpack::Slice JsonPath::extract(const JsonValue* json, const JsonPath& jsonpath, vpack::Builder* b,
+                               JsonPathShapeCache* cache) {
+    return JsonPathPiece::extract(json->to_vslice(), jsonpath.paths, 1, b, cache);
+}
+
 bool JsonPath::starts_with(const JsonPath* other) const {
     if (other->paths.size() > paths.size()) {
         // this: a.b, other: a.b.c.d
@@ -100,6 +100,32 @@ struct ArraySelectorSlice final : public ArraySelector {
     };
 };
 
+// JsonPathShapeCache remembers the position of each object key of a path in the last document it was found in.
+// Most documents of a column share the same shape, i.e. the same keys in their objects, and find the key at
+// the same position, which is verified by comparing the key at that position instead of searching the object.
+// The key is searched by a scan of the object when it is not at the remembered position, until a piece misses
+// `MAX_CONSECUTIVE_MISSES` documents in a row, after which the object is searched as without the cache.
+//
+// Not thread-safe, it is supposed to be a local of the loop over the rows of a column.
+class JsonPathShapeCache {
+public:
+    static constexpr uint32_t MAX_CONSECUTIVE_MISSES = 16;
+
+    // Returns the value of `key` in `object`, in which `piece` is the index of the key in the path.
+    vpack::Slice get(vpack::Slice object, size_t piece, const std::string& key);
+
+    int64_t hit_count() const { return _hits; }
+
+private:
+    struct Entry {
+        vpack::ValueLength index = 0;
+        uint32_t misses = 0;
+    };
+
+    std::vector<Entry> _entries;
+    int64_t _hits = 0;
+};
+
 // JsonPath implement that support array building
 struct JsonPathPiece {
     std::string key;
@@ -114,7 +140,7 @@ struct JsonPathPiece {
 
     static vpack::Slice extract(const JsonValue* json, const std::vector<JsonPathPiece>& jsonpath, vpack::Builder* b);
     static vpack::Slice extract(vpack::Slice root, const std::vector<JsonPathPiece>& jsonpath, int path_index,
-                                vpack::Builder* b);
+                                vpack::Builder* b, JsonPathShapeCache* cache = nullptr);
 };
 
 struct JsonPath {
@@ -142,6 +168,9 @@ struct JsonPath {
 
     static StatusOr<JsonPath> parse(Slice path_string);
     static vpack::Slice extract(const JsonValue* json, const JsonPath& jsonpath, vpack::Builder* b);
+    // Same as above, looks up the object keys of the path through `cache`.
+    static vpack::Slice extract(const JsonValue* json, const JsonPath& jsonpath, vpack::Builder* b,
+                                JsonPathShapeCache* cache);
 };
 
 } // namespace starrocks
@@ -17,6 +17,7 @@
 #include <memory>
 
 #include "exprs/binary_function.h"
+#include "exprs/string_functions.h"
 #include "glog/logging.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/Volnitsky.h"
@@ -276,6 +277,9 @@ StatusOr<ColumnPtr> LikePredicate::constant_ends_with_fn(FunctionContext* contex
     auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
 
     const auto& value = VECTORIZED_FN_ARGS(0);
+    if (!value->is_constant()) {
+        return StringFunctions::match_const_affix<false>(value, state->search_string_sv);
+    }
     auto pattern = state->_search_string_column;
 
     return VectorizedStrictBinaryFunction<ConstantEndsImpl>::evaluate<TYPE_VARCHAR, TYPE_BOOLEAN>(value, pattern);
@@ -291,6 +295,9 @@ StatusOr<ColumnPtr> LikePredicate::constant_starts_with_fn(FunctionContext* cont
     auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
 
     const auto& value = VECTORIZED_FN_ARGS(0);
+    if (!value->is_constant()) {
+        return StringFunctions::match_const_affix<true>(value, state->search_string_sv);
+    }
     auto pattern = state->_search_string_column;
 
     return VectorizedStrictBinaryFunction<ConstantStartsImpl>::evaluate<TYPE_VARCHAR, TYPE_BOOLEAN>(value, pattern);
@@ -359,7 +366,7 @@ StatusOr<ColumnPtr> LikePredicate::constant_substring_fn(FunctionContext* contex
         /// Current index in the array of strings.
         size_t i = 0;
 
-        auto searcher = VolnitskyUTF8(needle.data, needle.size, end - pos);
+        auto searcher = ColumnStringSearcher(needle.data, needle.size, end - pos);
         /// We will search for the next occurrence in all strings at once.
         while (pos < end && end != (pos = searcher.search(pos, end - pos))) {
             /// Determine which index it refers to.
@@ -545,10 +552,13 @@ StatusOr<ColumnPtr> LikePredicate::regex_match_partial(FunctionContext* context,
 
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
-    std::string re_pattern;
-    re_pattern.clear();
-
     auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(pattern, state->escape_char);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(const Slice& pattern, char escape_char) {
+    std::string re_pattern;
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -561,7 +571,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
@@ -586,6 +596,8 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
     return re_pattern;
 }
 
+template std::string LikePredicate::convert_like_pattern<true>(const Slice& pattern, char escape_char);
+
 void LikePredicate::remove_escape_character(std::string* search_string) {
     std::string tmp_search_string;
     tmp_search_string.swap(*search_string);
@@ -58,6 +58,11 @@ public:
      */
     DEFINE_VECTORIZED_FN(regex);
 
+    /// Convert a LIKE pattern (with embedded % and _) into the corresponding
+    /// regular expression pattern. Escaped chars are copied verbatim.
+    template <bool fullMatch>
+    static std::string convert_like_pattern(const Slice& pattern, char escape_char);
+
 private:
     /**
      * use for:
@@ -25,7 +25,7 @@
 namespace starrocks {
 
 struct LocateCaseSensitiveUTF8 {
-    using SearcherInBigHaystack = VolnitskyUTF8;
+    using SearcherInBigHaystack = ColumnStringSearcher;
     using SearcherInSmallHaystack = LibcASCIICaseSensitiveStringSearcher;
 
     static SearcherInBigHaystack createSearcherInBigHaystack(const char* needle_data, size_t needle_size,
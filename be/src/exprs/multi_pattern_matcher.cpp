@@ -0,0 +1,156 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "exprs/multi_pattern_matcher.h"
+
+#include <numeric>
+
+#include "column/column_builder.h"
+#include "column/column_helper.h"
+#include "column/column_viewer.h"
+#include "common/config.h"
+#include "exprs/like_predicate.h"
+#include "util/defer_op.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+// Used as the not null pointer of the empty values to avoid crash with hs_scan.
+static char DUMMY_STRING_FOR_EMPTY_VALUE = 'A';
+
+using MatcherPtr = std::shared_ptr<const MultiPatternMatcher>;
+
+static Cache* matcher_cache() {
+    static std::unique_ptr<Cache> cache(new_lru_cache(config::multi_pattern_matcher_cache_bytes));
+    return cache.get();
+}
+
+static std::string matcher_cache_key(const std::vector<MultiPatternMatcher::Pattern>& patterns) {
+    std::string key;
+    for (const auto& pattern : patterns) {
+        key.append(pattern.is_like ? "L" : "R");
+        key.append(std::to_string(pattern.pattern.size()));
+        key.append(":");
+        key.append(pattern.pattern);
+    }
+    return key;
+}
+
+StatusOr<MatcherPtr> MultiPatternMatcher::get_or_compile(const std::vector<Pattern>& patterns) {
+    auto* cache = matcher_cache();
+    std::string key = matcher_cache_key(patterns);
+    if (auto* handle = cache->lookup(CacheKey(key)); handle != nullptr) {
+        MatcherPtr matcher = *reinterpret_cast<MatcherPtr*>(cache->value(handle));
+        cache->release(handle);
+        return matcher;
+    }
+
+    ASSIGN_OR_RETURN(auto matcher, _compile(patterns));
+    size_t size = 0;
+    if (hs_database_size(matcher->_database, &size) != HS_SUCCESS) {
+        size = key.size();
+    }
+    auto* handle = cache->insert(CacheKey(key), new MatcherPtr(matcher), size, [](const CacheKey& key, void* value) {
+        delete reinterpret_cast<MatcherPtr*>(value);
+    });
+    if (handle != nullptr) {
+        cache->release(handle);
+    }
+    return matcher;
+}
+
+StatusOr<MatcherPtr> MultiPatternMatcher::_compile(const std::vector<Pattern>& patterns) {
+    std::vector<std::string> expressions;
+    expressions.reserve(patterns.size());
+    for (const auto& pattern : patterns) {
+        if (pattern.is_like) {
+            expressions.emplace_back(LikePredicate::convert_like_pattern<true>(Slice(pattern.pattern), '\\'));
+        } else {
+            expressions.emplace_back(pattern.pattern);
+        }
+    }
+    std::vector<const char*> expression_ptrs;
+    expression_ptrs.reserve(expressions.size());
+    for (const auto& expression : expressions) {
+        expression_ptrs.push_back(expression.c_str());
+    }
+    std::vector<unsigned int> flags(expressions.size(),
+                                    HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH);
+    std::vector<unsigned int> ids(expressions.size());
+    std::iota(ids.begin(), ids.end(), 0);
+
+    auto matcher = std::make_shared<MultiPatternMatcher>();
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expression_ptrs.data(), flags.data(), ids.data(), expressions.size(), HS_MODE_BLOCK,
+                         nullptr, &matcher->_database, &compile_err) != HS_SUCCESS) {
+        std::string error = compile_err != nullptr ? compile_err->message : "unknown error";
+        hs_free_compile_error(compile_err);
+        return Status::NotSupported("Invalid hyperscan expressions: " + error);
+    }
+    if (hs_alloc_scratch(matcher->_database, &matcher->_scratch) != HS_SUCCESS) {
+        return Status::InternalError("Unable to allocate hyperscan scratch space");
+    }
+    return MatcherPtr(std::move(matcher));
+}
+
+MultiPatternMatcher::~MultiPatternMatcher() {
+    if (_scratch != nullptr) {
+        hs_free_scratch(_scratch);
+    }
+    if (_database != nullptr) {
+        hs_free_database(_database);
+    }
+}
+
+StatusOr<ColumnPtr> MultiPatternMatcher::match(const ColumnPtr& column) const {
+    if (column->only_null()) {
+        return ColumnHelper::create_const_null_column(column->size());
+    }
+
+    hs_scratch_t* scratch = nullptr;
+    if (hs_error_t status = hs_clone_scratch(_scratch, &scratch); status != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to clone scratch space, status: {}", status));
+    }
+    DeferOp op([&] {
+        if (hs_error_t status = hs_free_scratch(scratch); status != HS_SUCCESS) {
+            LOG(ERROR) << "free scratch space failure. status: " << status;
+        }
+    });
+
+    ColumnViewer<TYPE_VARCHAR> viewer(column);
+    ColumnBuilder<TYPE_BOOLEAN> result(viewer.size());
+    for (size_t row = 0; row < viewer.size(); ++row) {
+        if (viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+        bool matched = false;
+        Slice value = viewer.value(row);
+        [[maybe_unused]] auto status = hs_scan(
+                _database, value.size > 0 ? value.data : &DUMMY_STRING_FOR_EMPTY_VALUE, value.size, 0, scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* ctx) -> int {
+                    *((bool*)ctx) = true;
+                    // Stops at the first matched pattern.
+                    return 1;
+                },
+                &matched);
+        DCHECK(status == HS_SUCCESS || status == HS_SCAN_TERMINATED) << " status: " << status;
+        result.append(matched);
+    }
+    return result.build(column->is_constant());
+}
+
+} // namespace starrocks
@@ -0,0 +1,65 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <hs/hs.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+
+namespace starrocks {
+
+// MultiPatternMatcher compiles a set of constant LIKE and REGEXP patterns into one hyperscan database, by which each
+// string is scanned once to check whether it matches any of the patterns, e.g. for
+// `col LIKE '%a%' OR col LIKE '%b%' OR col REGEXP 'c.*d'`.
+//
+// The compiled databases are immutable and shared by the queries with the same patterns, by a process-wide LRU cache
+// of `config::multi_pattern_matcher_cache_bytes`.
+class MultiPatternMatcher {
+public:
+    struct Pattern {
+        std::string pattern;
+        // LIKE pattern or REGEXP pattern.
+        bool is_like;
+    };
+
+    // Returns the matcher of the patterns from the cache, or compiles it. Returns an error if any pattern is not
+    // supported by hyperscan, in which case the patterns are expected to be matched one by one.
+    static StatusOr<std::shared_ptr<const MultiPatternMatcher>> get_or_compile(const std::vector<Pattern>& patterns);
+
+    MultiPatternMatcher() = default;
+    ~MultiPatternMatcher();
+
+    MultiPatternMatcher(const MultiPatternMatcher&) = delete;
+    void operator=(const MultiPatternMatcher&) = delete;
+
+    // Returns the boolean column of whether each value of the varchar `column` matches any of the patterns, and null
+    // for the null values.
+    StatusOr<ColumnPtr> match(const ColumnPtr& column) const;
+
+private:
+    static StatusOr<std::shared_ptr<const MultiPatternMatcher>> _compile(const std::vector<Pattern>& patterns);
+
+    hs_database_t* _database = nullptr;
+    // Cloned by each call of `match`.
+    hs_scratch_t* _scratch = nullptr;
+};
+
+} // namespace starrocks
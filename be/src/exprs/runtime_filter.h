@@ -364,6 +364,15 @@ public:
     virtual JoinRuntimeFilter* create_empty(ObjectPool* pool) = 0;
     void set_global() { this->_global = true; }
 
+    // The time the merge node took from the first partial filter to the broadcast, and the time from the broadcast
+    // to this node received the global filter, in milliseconds. -1 means unknown, e.g. for the local filters.
+    void set_global_latency(int64_t merge_latency_ms, int64_t broadcast_latency_ms) {
+        _merge_latency_ms = merge_latency_ms;
+        _broadcast_latency_ms = broadcast_latency_ms;
+    }
+    int64_t merge_latency_ms() const { return _merge_latency_ms; }
+    int64_t broadcast_latency_ms() const { return _broadcast_latency_ms; }
+
     // only used in local colocate filter
     bool is_group_colocate_filter() const { return !_group_colocate_filters.empty(); }
     std::vector<JoinRuntimeFilter*>& group_colocate_filter() { return _group_colocate_filters; }
@@ -374,6 +383,8 @@ protected:
 
     bool _has_null = false;
     bool _global = false;
+    int64_t _merge_latency_ms = -1;
+    int64_t _broadcast_latency_ms = -1;
     size_t _size = 0;
     int8_t _join_mode = 0;
     SimdBlockFilter _bf;
@@ -458,6 +469,9 @@ public:
     using ColumnType = RunTimeColumnType<Type>;
     using ContainerType = RunTimeProxyContainerType<Type>;
     using SelfType = RuntimeBloomFilter<Type>;
+    // The integers could be kept by an exact bitset over [min, max]
+    static constexpr bool kCanUseBitset =
+            std::is_integral_v<CppType> && !std::is_same_v<CppType, bool> && sizeof(CppType) <= sizeof(int64_t);
 
     RuntimeBloomFilter() { _init_min_max(); }
     ~RuntimeBloomFilter() override = default;
@@ -536,6 +550,58 @@ public:
 
     void insert_null() { _has_null = true; }
 
+    // Init an exact bitset over [min, max] of the inserted values if the range has at most max_bits values.
+    // The bitset is cheaper to test than the bloom filter and has no false positives, it is used instead of the
+    // bloom filter once built. It is not serialized, so it is only built for the local runtime filters.
+    bool init_bitset(size_t max_bits) {
+        if constexpr (kCanUseBitset) {
+            if (_min > _max) {
+                return false;
+            }
+            using UnsignedType = std::make_unsigned_t<CppType>;
+            const uint64_t range = static_cast<UnsignedType>(_max) - static_cast<UnsignedType>(_min);
+            if (range >= max_bits) {
+                return false;
+            }
+            _bitset_base = _min;
+            _bitset.assign(range / 64 + 1, 0);
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    void insert_bitset(const CppType& value) {
+        if constexpr (kCanUseBitset) {
+            const uint64_t offset = _bitset_offset(value);
+            DCHECK_LT(offset / 64, _bitset.size());
+            _bitset[offset / 64] |= uint64_t(1) << (offset % 64);
+        }
+    }
+
+    bool has_bitset() const { return !_bitset.empty(); }
+
+    // Get the values in the exact bitset in ascending order, return false if it has more than limit values.
+    bool get_bitset_values(size_t limit, std::vector<CppType>* values) const {
+        if constexpr (kCanUseBitset) {
+            using UnsignedType = std::make_unsigned_t<CppType>;
+            for (size_t i = 0; i < _bitset.size(); i++) {
+                uint64_t word = _bitset[i];
+                while (word != 0) {
+                    if (values->size() >= limit) {
+                        return false;
+                    }
+                    const uint64_t offset = i * 64 + __builtin_ctzll(word);
+                    values->push_back(static_cast<CppType>(static_cast<UnsignedType>(_bitset_base) + offset));
+                    word &= word - 1;
+                }
+            }
+            return true;
+        } else {
+            return false;
+        }
+    }
+
     CppType min_value() const { return _min; }
 
     CppType max_value() const { return _max; }
@@ -547,6 +613,8 @@ public:
         if (!_hash_partition_bf.empty()) {
             return _hash_partition_bf[0].can_use() ? _t_evaluate<true, true>(input_column, ctx)
                                                    : _t_evaluate<true, false>(input_column, ctx);
+        } else if (has_bitset()) {
+            return _t_evaluate<false, false, true>(input_column, ctx);
         } else {
             return _bf.can_use() ? _t_evaluate<false, true>(input_column, ctx)
                                  : _t_evaluate<false, false>(input_column, ctx);
@@ -555,6 +623,7 @@ public:
 
     // this->max = std::max(other->max, this->max)
     void merge(const JoinRuntimeFilter* rf) override {
+        _bitset.clear();
         JoinRuntimeFilter::merge(rf);
         _merge_min_max(down_cast<const RuntimeBloomFilter*>(rf));
     }
@@ -564,11 +633,13 @@ public:
     void intersect(const JoinRuntimeFilter* rf) override {
         auto other = down_cast<const RuntimeBloomFilter*>(rf);
 
+        _bitset.clear();
         update_min_max<true>(other->_min);
         update_min_max<false>(other->_max);
     }
 
     void concat(JoinRuntimeFilter* rf) override {
+        _bitset.clear();
         JoinRuntimeFilter::concat(rf);
         _merge_min_max(down_cast<const RuntimeBloomFilter*>(rf));
     }
@@ -577,6 +648,9 @@ public:
         LogicalType ltype = Type;
         std::stringstream ss;
         ss << "RuntimeBF(type = " << ltype << ", bfsize = " << _size << ", has_null = " << _has_null;
+        if (has_bitset()) {
+            ss << ", bitset_bits = " << _bitset.size() * 64;
+        }
         if constexpr (std::is_integral_v<CppType> || std::is_floating_point_v<CppType>) {
             if constexpr (!std::is_same_v<CppType, __int128>) {
                 ss << ", _min = " << _min << ", _max = " << _max;
@@ -837,6 +911,24 @@ private:
         return _bf.test_hash(hash);
     }
 
+    uint64_t _bitset_offset(CppType value) const {
+        if constexpr (kCanUseBitset) {
+            using UnsignedType = std::make_unsigned_t<CppType>;
+            return static_cast<UnsignedType>(value) - static_cast<UnsignedType>(_bitset_base);
+        } else {
+            return 0;
+        }
+    }
+
+    bool _test_bitset(CppType value) const {
+        const uint64_t offset = _bitset_offset(value);
+        // values less than the base wrap around to large offsets
+        if (offset / 64 >= _bitset.size()) {
+            return false;
+        }
+        return (_bitset[offset / 64] >> (offset % 64)) & 1;
+    }
+
     bool _test_data_with_hash(CppType value, const uint32_t shuffle_hash) const {
         if (shuffle_hash == BUCKET_ABSENT) {
             return false;
@@ -849,11 +941,13 @@ private:
     }
 
     using HashValues = std::vector<uint32_t>;
-    template <bool hash_partition>
+    template <bool hash_partition, bool use_bitset = false>
     void _rf_test_data(uint8_t* selection, const ContainerType& input_data, const HashValues& hash_values,
                        int idx) const {
         if (selection[idx]) {
-            if constexpr (hash_partition) {
+            if constexpr (use_bitset) {
+                selection[idx] = _test_bitset(input_data[idx]);
+            } else if constexpr (hash_partition) {
                 selection[idx] = _test_data_with_hash(input_data[idx], hash_values[idx]);
             } else {
                 selection[idx] = _test_data(input_data[idx]);
@@ -866,8 +960,10 @@ private:
     // and for global runtime filter, since it concates multiple runtime filters from partitions
     // so it has multiple `simd-block-filter` and `multi_partition` is true.
     // For more information, you can refers to doc `shuffle-aware runtime filter`.
-    template <bool multi_partition = false, bool can_use_bf = true>
+    // `use_bitset` means the exact bitset is tested instead of the bloom filter.
+    template <bool multi_partition = false, bool can_use_bf = true, bool use_bitset = false>
     void _t_evaluate(Column* input_column, RunningContext* ctx) const {
+        constexpr bool test_data = can_use_bf || use_bitset;
         size_t size = input_column->size();
         Filter& _selection_filter = ctx->use_merged_selection ? ctx->merged_selection : ctx->selection;
         _selection_filter.resize(size);
@@ -885,8 +981,8 @@ private:
             } else {
                 const auto& input_data = GetContainer<Type>().get_data(const_column->data_column());
                 _evaluate_min_max(input_data, _selection, 1);
-                if constexpr (can_use_bf) {
-                    _rf_test_data<multi_partition>(_selection, input_data, _hash_values, 0);
+                if constexpr (test_data) {
+                    _rf_test_data<multi_partition, use_bitset>(_selection, input_data, _hash_values, 0);
                 }
             }
             uint8_t sel = _selection[0];
@@ -901,24 +997,24 @@ private:
                     if (null_data[i]) {
                         _selection[i] = _has_null;
                     } else {
-                        if constexpr (can_use_bf) {
-                            _rf_test_data<multi_partition>(_selection, input_data, _hash_values, i);
+                        if constexpr (test_data) {
+                            _rf_test_data<multi_partition, use_bitset>(_selection, input_data, _hash_values, i);
                         }
                     }
                 }
             } else {
-                if constexpr (can_use_bf) {
+                if constexpr (test_data) {
                     for (int i = 0; i < size; ++i) {
-                        _rf_test_data<multi_partition>(_selection, input_data, _hash_values, i);
+                        _rf_test_data<multi_partition, use_bitset>(_selection, input_data, _hash_values, i);
                     }
                 }
             }
         } else {
             const auto& input_data = GetContainer<Type>().get_data(input_column);
             _evaluate_min_max(input_data, _selection, size);
-            if constexpr (can_use_bf) {
+            if constexpr (test_data) {
                 for (int i = 0; i < size; ++i) {
-                    _rf_test_data<multi_partition>(_selection, input_data, _hash_values, i);
+                    _rf_test_data<multi_partition, use_bitset>(_selection, input_data, _hash_values, i);
                 }
             }
         }
@@ -932,6 +1028,9 @@ private:
     bool _has_min_max = true;
     bool _left_close_interval = true;
     bool _right_close_interval = true;
+    // The exact bitset of values, bit i is set if _bitset_base + i is inserted
+    std::vector<uint64_t> _bitset;
+    CppType _bitset_base{};
 };
 
 } // namespace starrocks
@@ -18,6 +18,7 @@
 #include <thread>
 
 #include "column/column.h"
+#include "common/config.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exprs/in_const_predicate.hpp"
 #include "exprs/literal.h"
@@ -154,6 +155,50 @@ Status RuntimeFilterHelper::fill_runtime_bloom_filter(const ColumnPtr& column, L
     return Status::OK();
 }
 
+struct FilterBitsetIniter {
+    template <LogicalType ltype>
+    bool operator()(JoinRuntimeFilter* expr, size_t max_bits) {
+        auto* filter = (RuntimeBloomFilter<ltype>*)(expr);
+        return filter->init_bitset(max_bits);
+    }
+};
+
+bool RuntimeFilterHelper::init_runtime_filter_bitset(LogicalType type, JoinRuntimeFilter* filter, size_t row_count) {
+    const int64_t bits_per_row = config::runtime_filter_bitset_max_bits_per_row;
+    if (bits_per_row <= 0) {
+        return false;
+    }
+    const size_t max_bits = std::max<size_t>(row_count, 1) * bits_per_row;
+    return type_dispatch_filter(type, false, FilterBitsetIniter(), filter, max_bits);
+}
+
+struct FilterBitsetFiller {
+    template <LogicalType ltype>
+    auto operator()(const ColumnPtr& column, size_t column_offset, JoinRuntimeFilter* expr) {
+        auto* filter = (RuntimeBloomFilter<ltype>*)(expr);
+        if (column->is_nullable()) {
+            auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(column);
+            const auto& data_array = GetContainer<ltype>().get_data(nullable_column->data_column().get());
+            for (size_t j = column_offset; j < data_array.size(); j++) {
+                if (!nullable_column->is_null(j)) {
+                    filter->insert_bitset(data_array[j]);
+                }
+            }
+        } else {
+            const auto& data_array = GetContainer<ltype>().get_data(column.get());
+            for (size_t j = column_offset; j < data_array.size(); j++) {
+                filter->insert_bitset(data_array[j]);
+            }
+        }
+        return nullptr;
+    }
+};
+
+void RuntimeFilterHelper::fill_runtime_filter_bitset(const ColumnPtr& column, LogicalType type,
+                                                     JoinRuntimeFilter* filter, size_t column_offset) {
+    type_dispatch_filter(type, nullptr, FilterBitsetFiller(), column, column_offset, filter);
+}
+
 StatusOr<ExprContext*> RuntimeFilterHelper::rewrite_runtime_filter_in_cross_join_node(ObjectPool* pool,
                                                                                       ExprContext* conjunct,
                                                                                       Chunk* chunk) {
@@ -286,6 +331,12 @@ Status RuntimeFilterProbeDescriptor::prepare(RuntimeState* state, RuntimeProfile
     _latency_timer = ADD_COUNTER(p, strings::Substitute("JoinRuntimeFilter/$0/latency", _filter_id), TUnit::TIME_NS);
     // not set yet.
     _latency_timer->set((int64_t)(-1));
+    if (!_is_local) {
+        _merge_latency_timer =
+                ADD_COUNTER(p, strings::Substitute("JoinRuntimeFilter/$0/merge_latency", _filter_id), TUnit::TIME_NS);
+        _broadcast_latency_timer = ADD_COUNTER(
+                p, strings::Substitute("JoinRuntimeFilter/$0/broadcast_latency", _filter_id), TUnit::TIME_NS);
+    }
     return Status::OK();
 }
 
@@ -723,6 +774,12 @@ void RuntimeFilterProbeDescriptor::set_runtime_filter(const JoinRuntimeFilter* r
     if (_ready_timestamp == 0 && rf != nullptr && _latency_timer != nullptr) {
         _ready_timestamp = UnixMillis();
         _latency_timer->set((_ready_timestamp - _open_timestamp) * 1000);
+        if (_merge_latency_timer != nullptr && rf->merge_latency_ms() >= 0) {
+            _merge_latency_timer->set(rf->merge_latency_ms() * 1000 * 1000);
+        }
+        if (_broadcast_latency_timer != nullptr && rf->broadcast_latency_ms() >= 0) {
+            _broadcast_latency_timer->set(rf->broadcast_latency_ms() * 1000 * 1000);
+        }
     }
 }
 
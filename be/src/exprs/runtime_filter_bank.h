@@ -57,6 +57,11 @@ public:
     static JoinRuntimeFilter* create_runtime_bloom_filter(ObjectPool* pool, LogicalType type);
     static Status fill_runtime_bloom_filter(const ColumnPtr& column, LogicalType type, JoinRuntimeFilter* filter,
                                             size_t column_offset, bool eq_null);
+    // Try to init the exact bitset of a local runtime filter built from row_count rows, after all rows are inserted
+    // into the filter by fill_runtime_bloom_filter. Return false if the type or the range does not fit a bitset.
+    static bool init_runtime_filter_bitset(LogicalType type, JoinRuntimeFilter* filter, size_t row_count);
+    static void fill_runtime_filter_bitset(const ColumnPtr& column, LogicalType type, JoinRuntimeFilter* filter,
+                                           size_t column_offset);
 
     static StatusOr<ExprContext*> rewrite_runtime_filter_in_cross_join_node(ObjectPool* pool, ExprContext* conjunct,
                                                                             Chunk* chunk);
@@ -201,6 +206,9 @@ private:
     TPlanNodeId _probe_plan_node_id;
     // we want to measure when this runtime filter is applied since it's opened.
     RuntimeProfile::Counter* _latency_timer = nullptr;
+    // the latency of merging and broadcasting the global runtime filter.
+    RuntimeProfile::Counter* _merge_latency_timer = nullptr;
+    RuntimeProfile::Counter* _broadcast_latency_timer = nullptr;
     int64_t _open_timestamp = 0;
     int64_t _ready_timestamp = 0;
     int8_t _join_mode;
@@ -760,6 +760,9 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(starts_withImpl, str, prefix) {
 }
 
 StatusOr<ColumnPtr> StringFunctions::starts_with(FunctionContext* context, const Columns& columns) {
+    if (!columns[0]->is_constant() && columns[1]->is_constant() && !columns[1]->only_null()) {
+        return match_const_affix<true>(columns[0], ColumnHelper::get_const_value<TYPE_VARCHAR>(columns[1]));
+    }
     return VectorizedStrictBinaryFunction<starts_withImpl>::evaluate<TYPE_VARCHAR, TYPE_BOOLEAN>(columns[0],
                                                                                                  columns[1]);
 }
@@ -772,9 +775,45 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(ends_withImpl, str, suffix) {
 }
 
 StatusOr<ColumnPtr> StringFunctions::ends_with(FunctionContext* context, const Columns& columns) {
+    if (!columns[0]->is_constant() && columns[1]->is_constant() && !columns[1]->only_null()) {
+        return match_const_affix<false>(columns[0], ColumnHelper::get_const_value<TYPE_VARCHAR>(columns[1]));
+    }
     return VectorizedStrictBinaryFunction<ends_withImpl>::evaluate<TYPE_VARCHAR, TYPE_BOOLEAN>(columns[0], columns[1]);
 }
 
+template <bool is_prefix>
+ColumnPtr StringFunctions::match_const_affix(const ColumnPtr& str, const Slice& affix) {
+    DCHECK(!str->is_constant());
+    const BinaryColumn* binary = nullptr;
+    NullColumnPtr nulls = nullptr;
+    if (str->is_nullable()) {
+        const auto* nullable = down_cast<const NullableColumn*>(str.get());
+        binary = down_cast<const BinaryColumn*>(nullable->data_column().get());
+        nulls = nullable->null_column();
+    } else {
+        binary = down_cast<const BinaryColumn*>(str.get());
+    }
+
+    const auto& offsets = binary->get_offset();
+    const uint8_t* bytes = binary->get_bytes().data();
+    const size_t num_rows = binary->size();
+    auto result = BooleanColumn::create(num_rows);
+    uint8_t* res = result->get_data().data();
+    for (size_t i = 0; i < num_rows; i++) {
+        const size_t size = offsets[i + 1] - offsets[i];
+        res[i] = size >= affix.size &&
+                 memcmp(bytes + (is_prefix ? offsets[i] : offsets[i + 1] - affix.size), affix.data, affix.size) == 0;
+    }
+
+    if (nulls != nullptr) {
+        return NullableColumn::create(std::move(result), nulls);
+    }
+    return result;
+}
+
+template ColumnPtr StringFunctions::match_const_affix<true>(const ColumnPtr& str, const Slice& affix);
+template ColumnPtr StringFunctions::match_const_affix<false>(const ColumnPtr& str, const Slice& affix);
+
 struct SpaceFunction {
 public:
     template <LogicalType Type, LogicalType ResultType>
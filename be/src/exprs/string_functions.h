@@ -151,6 +151,11 @@ public:
      */
     DEFINE_VECTORIZED_FN(ends_with);
 
+    // Returns whether each value of the non-constant varchar `str` starts (or ends) with the constant `affix`, by the
+    // offsets and the bytes of the column directly, e.g. for `starts_with` and `LIKE 'abc%'`.
+    template <bool is_prefix>
+    static ColumnPtr match_const_affix(const ColumnPtr& str, const Slice& affix);
+
     /**
      * Return a string of the specified number of spaces
      *
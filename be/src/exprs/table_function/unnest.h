@@ -39,37 +39,47 @@ public:
         state->set_processed_rows(arg0->size());
         Columns result;
         if (arg0->has_null() || state->get_is_left_join()) {
-            auto offset_column = col_array->offsets_column();
+            const auto& offsets = col_array->offsets_column()->get_data();
+            const Column& elements = *col_array->elements_column();
+            const bool is_left_join = state->get_is_left_join();
             auto copy_count_column = UInt32Column::create();
+            copy_count_column->reserve(arg0->size() + 1);
             copy_count_column->append(0);
 
-            ColumnPtr unnested_array_elements = col_array->elements_column()->clone_empty();
+            ColumnPtr unnested_array_elements = elements.clone_empty();
 
+            // The elements of adjacent rows are contiguous, so they are copied in runs rather than row by row,
+            // and a run is only cut by a row whose elements are skipped or replaced by a null.
+            uint32_t run_start = 0;
+            uint32_t run_end = 0;
+            auto flush_run = [&]() {
+                if (run_end > run_start) {
+                    unnested_array_elements->append(elements, run_start, run_end - run_start);
+                }
+            };
             uint32_t offset = 0;
-            for (int row_idx = 0; row_idx < arg0->size(); ++row_idx) {
-                if (arg0->is_null(row_idx)) {
-                    if (state->get_is_left_join()) {
+            for (size_t row_idx = 0; row_idx < arg0->size(); ++row_idx) {
+                const uint32_t begin = offsets[row_idx];
+                const uint32_t end = offsets[row_idx + 1];
+                if (arg0->is_null(row_idx) || begin == end) {
+                    if (is_left_join) {
                         // to support unnest with null.
+                        flush_run();
+                        run_start = run_end = end;
                         unnested_array_elements->append_nulls(1);
                         offset += 1;
                     }
-                    copy_count_column->append(offset);
                 } else {
-                    if (offset_column->get(row_idx + 1).get_int32() == offset_column->get(row_idx).get_int32() &&
-                        state->get_is_left_join()) {
-                        // to support unnest with null.
-                        unnested_array_elements->append_nulls(1);
-                        offset += 1;
-                    } else {
-                        auto length =
-                                offset_column->get(row_idx + 1).get_int32() - offset_column->get(row_idx).get_int32();
-                        unnested_array_elements->append(*(col_array->elements_column()),
-                                                        offset_column->get(row_idx).get_int32(), length);
-                        offset += length;
+                    if (begin != run_end) {
+                        flush_run();
+                        run_start = begin;
                     }
-                    copy_count_column->append(offset);
+                    run_end = end;
+                    offset += end - begin;
                 }
+                copy_count_column->append(offset);
             }
+            flush_run();
 
             result.emplace_back(unnested_array_elements);
             return std::make_pair(result, copy_count_column);
@@ -26,6 +26,7 @@
 #include "runtime/datetime_value.h"
 #include "runtime/runtime_state.h"
 #include "types/date_value.h"
+#include "util/timezone_utils.h"
 
 namespace starrocks {
 // index as day of week(1: Sunday, 2: Monday....), value as distance of this day and first day(Monday) of this week.
@@ -114,6 +115,15 @@ ColumnPtr date_valid(const ColumnPtr& v1) {
         return date_valid<RESULT_TYPE>(p);                                                                 \
     }
 
+// Same as DateTimeValue::from_unixtime(unix_seconds, ctz), with the UTC offset looked up through `tz_cache`.
+static DateTimeValue unixtime_to_datetime_value(TimezoneOffsetCache& tz_cache, int64_t unix_seconds) {
+    TimestampValue ts;
+    ts.from_unix_second(tz_cache.utc_to_local(unix_seconds));
+    int year, month, day, hour, minute, second, usec;
+    ts.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
+    return {TIME_DATETIME, year, month, day, hour, minute, second, 0};
+}
+
 Status TimeFunctions::convert_tz_prepare(FunctionContext* context, FunctionContext::FunctionStateScope scope) {
     if (scope != FunctionContext::FRAGMENT_LOCAL || context->get_num_args() != 3 ||
         context->get_arg_type(1)->type != TYPE_VARCHAR || context->get_arg_type(2)->type != TYPE_VARCHAR ||
@@ -225,6 +235,8 @@ StatusOr<ColumnPtr> TimeFunctions::convert_tz_const(FunctionContext* context, co
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_DATETIME> result(size);
+    TimezoneOffsetCache from_cache(from);
+    TimezoneOffsetCache to_cache(to);
     for (int row = 0; row < size; ++row) {
         if (time_viewer.is_null(row)) {
             result.append_null();
@@ -232,26 +244,10 @@ StatusOr<ColumnPtr> TimeFunctions::convert_tz_const(FunctionContext* context, co
         }
 
         auto datetime_value = time_viewer.value(row);
-
-        int year, month, day, hour, minute, second, usec;
-        datetime_value.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
-        DateTimeValue ts_value(TIME_DATETIME, year, month, day, hour, minute, second, usec);
-
-        int64_t timestamp;
-        // TODO find a better approach to replace datetime_value.unix_timestamp
-        if (!ts_value.unix_timestamp(&timestamp, from)) {
-            result.append_null();
-            continue;
-        }
-        DateTimeValue ts_value2;
-        // TODO find a better approach to replace datetime_value.from_unixtime
-        if (!ts_value2.from_unixtime(timestamp, ts_value.microsecond(), to)) {
-            result.append_null();
-            continue;
-        }
+        int64_t unix_seconds = from_cache.local_to_utc(datetime_value.to_unix_second());
+        int64_t usec = timestamp::to_time(datetime_value.timestamp()) % USECS_PER_SEC;
         TimestampValue ts;
-        ts.from_timestamp(ts_value2.year(), ts_value2.month(), ts_value2.day(), ts_value2.hour(), ts_value2.minute(),
-                          ts_value2.second(), ts_value2.microsecond());
+        ts.from_unix_second(to_cache.utc_to_local(unix_seconds), usec);
         result.append(ts);
     }
 
@@ -1506,6 +1502,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime(FunctionContext* con
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row)) {
             result.append_null();
@@ -1518,11 +1515,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime(FunctionContext* con
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = unixtime_to_datetime_value(tz_cache, date);
         char buf[64];
         dtv.to_string(buf);
         result.append(Slice(buf));
@@ -1541,6 +1534,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime_ms(FunctionContext*
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row)) {
             result.append_null();
@@ -1553,11 +1547,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_to_datetime_ms(FunctionContext*
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = unixtime_to_datetime_value(tz_cache, date);
         char buf[64];
         dtv.to_string(buf);
         result.append(Slice(buf));
@@ -1648,6 +1638,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_general(FunctionCont
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row) || format_column.is_null(row)) {
             result.append_null();
@@ -1661,11 +1652,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_general(FunctionCont
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = unixtime_to_datetime_value(tz_cache, date);
         // use lambda to avoid adding method for TimeFunctions.
         if (format.size > DEFAULT_DATE_FORMAT_LIMIT) {
             result.append_null();
@@ -1696,6 +1683,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_const(std::string& f
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row) || format_content.empty()) {
             result.append_null();
@@ -1708,11 +1696,7 @@ StatusOr<ColumnPtr> TimeFunctions::_t_from_unix_with_format_const(std::string& f
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        DateTimeValue dtv = unixtime_to_datetime_value(tz_cache, date);
 
         char buf[128];
         if (!dtv.to_format_string((const char*)format_content.c_str(), format_content.size(), buf)) {
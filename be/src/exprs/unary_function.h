@@ -180,6 +180,12 @@ public:
             return v1;
         }
 
+        if (v1->is_nullable() && !v1->has_null()) {
+            // null-free fast path, like UnionNullableColumnBinaryFunction, the null column is not carried over
+            auto col = ColumnHelper::as_raw_column<NullableColumn>(v1);
+            return FN::template evaluate<Type, ResultType, Args...>(col->data_column(), std::forward<Args>(args)...);
+        }
+
         if (v1->is_nullable()) {
             auto col = ColumnHelper::as_raw_column<NullableColumn>(v1);
 
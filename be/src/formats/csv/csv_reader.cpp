@@ -16,6 +16,8 @@
 
 #include <unordered_set>
 
+#include "simd/simd.h"
+
 namespace starrocks {
 
 using Field = Slice;
@@ -270,8 +272,9 @@ Status CSVReader::more_rows() {
                 _buff.skip(1);
                 break;
             }
-            // other character
+            // other character, and the following ones without enclose or escape character.
             _buff.skip(1);
+            _buff.skip(_count_ordinary_bytes(true));
             break;
 
         case ENCLOSE_ESCAPE:
@@ -311,6 +314,15 @@ Status CSVReader::more_rows() {
                 preState = ORDINARY;
             }
 
+            // Skip the bytes without any special character, which are classified 64 bytes at a time by SIMD.
+            if (LIKELY(curState == ORDINARY && _row_delimiter_length == 1 && _column_delimiter_length == 1)) {
+                size_t n = _count_ordinary_bytes(false);
+                if (n > 0) {
+                    _buff.skip(n);
+                    break;
+                }
+            }
+
             // newrow
             if (UNLIKELY(is_row_delimiter(notGetLine))) {
                 curState = NEWROW;
@@ -468,6 +480,23 @@ Status CSVReader::more_rows() {
     }
 }
 
+size_t CSVReader::_count_ordinary_bytes(bool enclosed) {
+    const char* begin = _buff.position();
+    const char* end = begin + _buff.available();
+    const char* p = begin;
+    for (; p + 64 <= end; p += 64) {
+        uint64_t mask = SIMD::eq_mask64(p, _parse_options.escape) | SIMD::eq_mask64(p, _parse_options.enclose);
+        if (!enclosed) {
+            mask |= SIMD::eq_mask64(p, _parse_options.row_delimiter[0]) |
+                    SIMD::eq_mask64(p, _parse_options.column_delimiter[0]);
+        }
+        if (mask != 0) {
+            return p - begin + __builtin_ctzll(mask);
+        }
+    }
+    return p - begin;
+}
+
 Status CSVReader::next_record(CSVRow& row) {
     row.columns.clear();
     if (_csv_buff.empty()) {
@@ -555,15 +584,28 @@ void CSVReader::split_record(const Record& record, Fields* columns) const {
     const size_t size = record.size;
 
     if (_column_delimiter_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _parse_options.column_delimiter[0]) {
-                if (_parse_options.trim_space) {
-                    std::pair<const char*, size_t> newPos = trim(value, ptr - value);
-                    columns->emplace_back(newPos.first, newPos.second);
-                } else {
-                    columns->emplace_back(value, ptr - value);
-                }
-                value = ptr + 1;
+        const char delimiter = _parse_options.column_delimiter[0];
+        const char* end = record.data + size;
+        auto add_column = [&](const char* delimiter_ptr) {
+            if (_parse_options.trim_space) {
+                std::pair<const char*, size_t> newPos = trim(value, delimiter_ptr - value);
+                columns->emplace_back(newPos.first, newPos.second);
+            } else {
+                columns->emplace_back(value, delimiter_ptr - value);
+            }
+            value = delimiter_ptr + 1;
+        };
+        // Find the delimiters of 64 bytes at a time by SIMD, and then the delimiters in the tail one by one.
+        for (; ptr + 64 <= end; ptr += 64) {
+            uint64_t mask = SIMD::eq_mask64(ptr, delimiter);
+            while (mask != 0) {
+                add_column(ptr + __builtin_ctzll(mask));
+                mask &= mask - 1;
+            }
+        }
+        for (; ptr < end; ++ptr) {
+            if (*ptr == delimiter) {
+                add_column(ptr);
             }
         }
     } else {
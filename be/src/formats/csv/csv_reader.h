@@ -217,6 +217,10 @@ protected:
 private:
     Status _expand_buffer();
     Status _expand_buffer_loosely();
+    // Returns the number of the leading bytes available in the buffer without any escape or enclose character, nor
+    // any delimiter if not `enclosed`, which only works for the single-byte delimiters. Only the whole 64-byte blocks
+    // are scanned, leaving the tail to the caller.
+    size_t _count_ordinary_bytes(bool enclosed);
 
     size_t _parsed_bytes = 0;
     size_t _limit = 0;
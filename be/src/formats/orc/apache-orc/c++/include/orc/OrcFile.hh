@@ -97,6 +97,10 @@ public:
     virtual bool isIOAdaptiveCoalesceEnabled() const;
     virtual void releaseToOffset(const int64_t offset);
     virtual void setIORanges(std::vector<InputStream::IORange>& io_ranges);
+    // Whether to prefetch the stripe at [offset, offset + length) while the previous stripe is being read.
+    virtual bool isStripePrefetchEnabled(const int64_t offset, const int64_t length) const;
+    // Starts to read the io ranges of the next stripe in the background, which are set as setIORanges().
+    virtual void prefetchIORanges(std::vector<InputStream::IORange>& io_ranges);
 };
 
 /**
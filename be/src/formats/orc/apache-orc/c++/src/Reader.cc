@@ -251,6 +251,7 @@ RowReaderImpl::RowReaderImpl(const std::shared_ptr<FileContents>& _contents, con
     numberOfStripes = static_cast<uint64_t>(footer->stripes_size());
     currentStripe = numberOfStripes;
     lastStripe = 0;
+    prefetchedStripe = numberOfStripes;
     currentRowInStripe = 0;
     lazyLoadLastUsedRowInStripe = 0;
     rowsInCurrentStripe = 0;
@@ -390,6 +391,8 @@ void RowReaderImpl::seekToRow(uint64_t rowNumber) {
     currentStripe = seekToStripe;
     currentRowInStripe = rowNumber - firstRowOfStripe[currentStripe];
     previousRow = rowNumber;
+    // the io ranges of the prefetched stripe may be released by the seeking.
+    prefetchedStripe = num_stripes;
     startNextStripe();
 
     uint64_t rowsToSkip = currentRowInStripe;
@@ -1006,10 +1009,11 @@ void RowReaderImpl::markEndOfFile() {
     }
 }
 
-void RowReaderImpl::buildIORanges(std::vector<InputStream::IORange>* io_ranges) {
+void RowReaderImpl::buildIORanges(const proto::StripeInformation& stripeInfo, const proto::StripeFooter& stripeFooter,
+                                  std::vector<InputStream::IORange>* io_ranges) {
     // column streams: index & data
-    uint64_t offset = currentStripeInfo.offset();
-    for (const proto::Stream& stream : currentStripeFooter.streams()) {
+    uint64_t offset = stripeInfo.offset();
+    for (const proto::Stream& stream : stripeFooter.streams()) {
         uint32_t columnId = stream.column();
         uint64_t length = stream.length();
         // ColumnId = 0 is root column, we always need it
@@ -1094,14 +1098,21 @@ void RowReaderImpl::startNextStripe() {
         if (isIOCoalesceEnabled) {
             contents->stream->releaseToOffset(currentStripeInfo.offset());
         }
-        currentStripeFooter = getStripeFooter(currentStripeInfo, *contents);
-        // We need to check this stripe is already set in shared buffer(tiny stripe optimize) to avoid shared buffer overlap
-        if (isIOCoalesceEnabled &&
-            !contents->stream->isAlreadyCollectedInSharedBuffer(currentStripeInfo.offset(), stripeSize)) {
-            std::vector<InputStream::IORange> io_ranges;
-            buildIORanges(&io_ranges);
-            contents->stream->setIORanges(io_ranges);
+        if (prefetchedStripe == currentStripe) {
+            // the io ranges of this stripe have been set by prefetchNextStripe().
+            currentStripeFooter = std::move(prefetchedStripeFooter);
+        } else {
+            currentStripeFooter = getStripeFooter(currentStripeInfo, *contents);
+            // We need to check this stripe is already set in shared buffer(tiny stripe optimize)
+            // to avoid shared buffer overlap
+            if (isIOCoalesceEnabled &&
+                !contents->stream->isAlreadyCollectedInSharedBuffer(currentStripeInfo.offset(), stripeSize)) {
+                std::vector<InputStream::IORange> io_ranges;
+                buildIORanges(currentStripeInfo, currentStripeFooter, &io_ranges);
+                contents->stream->setIORanges(io_ranges);
+            }
         }
+        prefetchedStripe = static_cast<uint64_t>(footer->stripes_size());
 
         if (sargsApplier) {
             // read row group statistics and bloom filters of current stripe
@@ -1171,7 +1182,33 @@ void RowReaderImpl::startNextStripe() {
 
     if (currentStripe == lastStripe) {
         markEndOfFile();
+    } else if (isIOCoalesceEnabled) {
+        prefetchNextStripe();
+    }
+}
+
+void RowReaderImpl::prefetchNextStripe() {
+    uint64_t nextStripe = currentStripe + 1;
+    if (nextStripe >= lastStripe) {
+        return;
     }
+    const proto::StripeInformation& nextStripeInfo = footer->stripes(static_cast<int>(nextStripe));
+    size_t stripeSize = nextStripeInfo.indexlength() + nextStripeInfo.datalength() + nextStripeInfo.footerlength();
+    if ((nextStripeInfo.offset() + stripeSize) >= contents->stream->getLength() ||
+        !contents->stream->isStripePrefetchEnabled(nextStripeInfo.offset(), stripeSize) ||
+        contents->stream->isAlreadyCollectedInSharedBuffer(nextStripeInfo.offset(), stripeSize)) {
+        return;
+    }
+    // don't prefetch the stripe to be skipped by its statistics.
+    if (sargsApplier && contents->metadata &&
+        !sargsApplier->isStripeNeeded(contents->metadata->stripestats(static_cast<int>(nextStripe)))) {
+        return;
+    }
+    prefetchedStripeFooter = getStripeFooter(nextStripeInfo, *contents);
+    std::vector<InputStream::IORange> io_ranges;
+    buildIORanges(nextStripeInfo, prefetchedStripeFooter, &io_ranges);
+    contents->stream->prefetchIORanges(io_ranges);
+    prefetchedStripe = nextStripe;
 }
 
 bool RowReaderImpl::next(ColumnVectorBatch& data, ReadPosition* pos) {
@@ -1588,6 +1625,12 @@ void InputStream::releaseToOffset(const int64_t offset) {}
 
 void InputStream::setIORanges(std::vector<InputStream::IORange>& io_ranges) {}
 
+bool InputStream::isStripePrefetchEnabled(const int64_t offset, const int64_t length) const {
+    return false;
+}
+
+void InputStream::prefetchIORanges(std::vector<InputStream::IORange>& io_ranges) {}
+
 std::atomic<int32_t>* InputStream::get_lazy_column_coalesce_counter() {
     return nullptr;
 }
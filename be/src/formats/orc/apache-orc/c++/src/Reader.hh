@@ -157,11 +157,15 @@ private:
     uint64_t numRowGroupsInStripeRange;
     proto::StripeInformation currentStripeInfo;
     proto::StripeFooter currentStripeFooter;
+    // The stripe whose io ranges are prefetched while reading the current stripe, and its footer.
+    uint64_t prefetchedStripe;
+    proto::StripeFooter prefetchedStripeFooter;
     std::unique_ptr<ColumnReader> reader;
 
     bool enableEncodedBlock;
     // internal methods
     void startNextStripe();
+    void prefetchNextStripe();
     inline void markEndOfFile();
 
     // row index of current stripe with column id as the key
@@ -212,7 +216,8 @@ private:
      */
     bool hasBadBloomFilters();
 
-    void buildIORanges(std::vector<InputStream::IORange>* io_ranges);
+    void buildIORanges(const proto::StripeInformation& stripeInfo, const proto::StripeFooter& stripeFooter,
+                       std::vector<InputStream::IORange>* io_ranges);
 
 public:
     /**
@@ -70,6 +70,15 @@ public:
      */
     bool evaluateStripeStatistics(const proto::StripeStatistics& stripeStats, uint64_t stripeRowGroupCount);
 
+    /**
+     * Evaluate search argument on stripe statistics without updating the state
+     * and Reader Metrics, e.g. to decide whether to prefetch a stripe.
+     * @return true if stripe statistics satisfy the sargs
+     */
+    bool isStripeNeeded(const proto::StripeStatistics& stripeStats) const {
+        return stripeStats.colstats_size() == 0 || evaluateColumnStatistics(stripeStats.colstats());
+    }
+
     /**
      * TODO: use proto::RowIndex and proto::BloomFilter to do the evaluation
      * Pick the row groups that we need to load from the current stripe.
@@ -492,7 +492,64 @@ inline void Decimal32Or64Or128ColumnReader<DecimalType>::_fill_decimal_column_ge
     }
 }
 
+// Appends the strings of an encoded batch to `values` by the dictionary codes, without materializing the pointers
+// and the lengths of the strings in the batch. The nulls are handled by the caller and appended as empty strings.
+template <bool RemoveTrailingSpaces>
+static Status fill_binary_column_by_dict_codes(orc::EncodedStringVectorBatch* data, BinaryColumn* values,
+                                               size_t from, size_t size) {
+    const orc::StringDictionary& dict = *data->dictionary;
+    const char* dict_blob = dict.dictionaryBlob.data();
+    const int64_t* dict_offsets = dict.dictionaryOffset.data();
+    const auto dict_size = static_cast<int64_t>(dict.dictionaryOffset.size()) - 1;
+    const int64_t* codes = data->index.data() + from;
+    const char* not_nulls = data->hasNulls ? data->notNull.data() + from : nullptr;
+
+    size_t len = 0;
+    for (size_t i = 0; i < size; ++i) {
+        if (not_nulls != nullptr && !not_nulls[i]) {
+            continue;
+        }
+        int64_t code = codes[i];
+        if (UNLIKELY(code < 0 || code >= dict_size)) {
+            return Status::Corruption(
+                    strings::Substitute("Entry index $0 out of range $1 in orc string dictionary", code, dict_size));
+        }
+        len += dict_offsets[code + 1] - dict_offsets[code];
+    }
+
+    auto& vb = values->get_bytes();
+    auto& vo = values->get_offset();
+    size_t write_pos = vb.size();
+    size_t offset_pos = vo.size();
+    // vb is using RawVectorPad16, resize will not initialize vector
+    vb.resize(write_pos + len);
+    raw::stl_vector_resize_uninitialized(&vo, offset_pos + size);
+
+    uint8_t* bytes = vb.data();
+    for (size_t i = 0; i < size; ++i) {
+        if (not_nulls == nullptr || not_nulls[i]) {
+            const char* str = dict_blob + dict_offsets[codes[i]];
+            size_t str_size = dict_offsets[codes[i] + 1] - dict_offsets[codes[i]];
+            if constexpr (RemoveTrailingSpaces) {
+                str_size = remove_trailing_spaces(str, str_size);
+            }
+            strings::memcpy_inlined(bytes + write_pos, str, str_size);
+            write_pos += str_size;
+        }
+        vo[offset_pos + i] = write_pos;
+    }
+    if constexpr (RemoveTrailingSpaces) {
+        vb.resize(write_pos);
+    }
+    return Status::OK();
+}
+
 Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size) {
+    if (cvb->isEncoded) {
+        // The encoded batches are not read in broker load mode, which checks the lengths of the strings in the batch.
+        DCHECK(!_reader->get_broker_load_mode());
+        return _fill_by_dict_codes(cvb, col, from, size);
+    }
     auto* data = down_cast<orc::StringVectorBatch*>(cvb);
 
     size_t len = 0;
@@ -630,7 +687,35 @@ Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col,
     return Status::OK();
 }
 
+Status StringColumnReader::_fill_by_dict_codes(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from,
+                                               size_t size) {
+    if (_nullable) {
+        auto* c = ColumnHelper::as_raw_column<NullableColumn>(col);
+        size_t col_start = col->size();
+        c->null_column()->resize_uninitialized(col_start + size);
+        handle_null(cvb, c, col_start, from, size);
+    }
+    auto* data = down_cast<orc::EncodedStringVectorBatch*>(cvb);
+    auto* values = ColumnHelper::cast_to_raw<TYPE_VARCHAR>(ColumnHelper::get_data_column(col.get()));
+    if (_type.type == TYPE_CHAR) {
+        // Possibly there are some zero padding characters in value, we have to strip them off.
+        return fill_binary_column_by_dict_codes<true>(data, values, from, size);
+    }
+    return fill_binary_column_by_dict_codes<false>(data, values, from, size);
+}
+
 Status VarbinaryColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size) {
+    if (cvb->isEncoded) {
+        if (_nullable) {
+            auto* c = ColumnHelper::as_raw_column<NullableColumn>(col);
+            size_t col_start = col->size();
+            c->null_column()->resize_uninitialized(col_start + size);
+            handle_null(cvb, c, col_start, from, size);
+        }
+        auto* values = ColumnHelper::cast_to_raw<TYPE_VARBINARY>(ColumnHelper::get_data_column(col.get()));
+        return fill_binary_column_by_dict_codes<false>(down_cast<orc::EncodedStringVectorBatch*>(cvb), values, from,
+                                                       size);
+    }
     auto* data = down_cast<orc::StringVectorBatch*>(cvb);
     size_t len = 0;
     for (size_t i = 0; i < size; ++i) {
@@ -690,7 +775,7 @@ Status DateColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& column
     if (cvb->hasNulls) {
         for (size_t column_pos = column_start, vb_pos = from; column_pos < column_start + size;
              column_pos++, vb_pos++) {
-            if (!cvb->notNull[column_pos]) {
+            if (!cvb->notNull[vb_pos]) {
                 continue;
             }
             OrcDateHelper::orc_date_to_native_date(&(values[column_pos]), data->data[vb_pos]);
@@ -720,7 +805,7 @@ Status TimestampColumnReader<IsInstant>::get_next(orc::ColumnVectorBatch* cvb, C
     if (cvb->hasNulls) {
         for (size_t column_pos = column_start, vb_pos = from; column_pos < column_start + size;
              column_pos++, vb_pos++) {
-            if (!cvb->notNull[column_pos]) {
+            if (!cvb->notNull[vb_pos]) {
                 continue;
             }
             int64_t ns = 0;
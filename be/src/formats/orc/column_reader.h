@@ -208,6 +208,9 @@ public:
     ~StringColumnReader() override = default;
 
     Status get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size) override;
+
+private:
+    Status _fill_by_dict_codes(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size);
 };
 
 class VarbinaryColumnReader : public PrimitiveColumnReader {
@@ -180,6 +180,10 @@ Status OrcChunkReader::init(std::unique_ptr<orc::Reader> reader, const OrcPredic
         _row_reader_options.searchArgument(builder->build());
     }
 
+    if (_dict_string_direct_decode && !_broker_load_mode) {
+        _row_reader_options.setEnableLazyDecoding(true);
+    }
+
     try {
         _row_reader = _reader->createRowReader(_row_reader_options);
     } catch (std::exception& e) {
@@ -1252,10 +1256,32 @@ Status OrcChunkReader::apply_dict_filter_eval_cache(const std::unordered_map<Slo
         DCHECK(data.size() == size);
 
         auto* batch = down_cast<orc::StringVectorBatch*>(struct_batch->fieldsColumnIdMap[column_id]);
-        for (uint32_t i = 0; i < size; i++) {
-            int64_t code = batch->codes[i];
-            DCHECK(code < dict_filter.size());
-            data[i] = dict_filter[code];
+        if (batch->isEncoded) {
+            // The codes of the null values are not set in the index, and the last entry of the filter is for null.
+            auto* encoded_batch = down_cast<orc::EncodedStringVectorBatch*>(batch);
+            const int64_t dict_size = encoded_batch->dictionary->dictionaryOffset.size() - 1;
+            const int64_t* index = encoded_batch->index.data();
+            const char* not_null = batch->hasNulls ? batch->notNull.data() : nullptr;
+            DCHECK_EQ(dict_size + 1, dict_filter.size());
+            for (uint32_t i = 0; i < size; i++) {
+                if (not_null != nullptr && !not_null[i]) {
+                    data[i] = dict_filter[dict_size];
+                    continue;
+                }
+                int64_t code = index[i];
+                if (UNLIKELY(code < 0 || code >= dict_size)) {
+                    return Status::Corruption(strings::Substitute(
+                            "Entry index $0 out of range $1 in the string dictionary of orc file $2", code, dict_size,
+                            _current_file_name));
+                }
+                data[i] = dict_filter[code];
+            }
+        } else {
+            for (uint32_t i = 0; i < size; i++) {
+                int64_t code = batch->codes[i];
+                DCHECK(code < dict_filter.size());
+                data[i] = dict_filter[code];
+            }
         }
 
         bool all_zero = false;
@@ -70,6 +70,9 @@ public:
     // call them before calling init.
     void set_read_chunk_size(uint64_t v) { _read_chunk_size = v; }
     void set_row_reader_filter(std::shared_ptr<orc::RowReaderFilter> filter);
+    // Reads the dictionary-encoded strings as the dictionary codes, which are decoded into the string columns
+    // directly instead of through the pointers and lengths in the batch. Not applied in broker load mode.
+    void set_dict_string_direct_decode(bool v) { _dict_string_direct_decode = v; }
     Status build_search_argument_by_predicates(const OrcPredicates* orc_predicates);
     Status set_timezone(const std::string& tz);
     size_t num_columns() const { return _src_slot_descriptors.size(); }
@@ -174,6 +177,7 @@ private:
     // We make the same behavior as Trino & Presto.
     // https://trino.io/docs/current/connector/hive.html?highlight=hive#orc-format-configuration-properties
     bool _use_orc_column_names = false;
+    bool _dict_string_direct_decode = false;
     OrcMappingOptions _orc_mapping_options{};
     std::unique_ptr<OrcMapping> _root_mapping;
     std::vector<TypeDescriptor> _src_types;
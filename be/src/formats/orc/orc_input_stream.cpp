@@ -60,25 +60,30 @@ bool ORCHdfsFileStream::isAlreadyCollectedInSharedBuffer(const int64_t offset, c
     return _sb_stream->find_shared_buffer(offset, length).status().ok();
 }
 
-void ORCHdfsFileStream::setIORanges(std::vector<IORange>& io_ranges) {
-    if (!_sb_stream) return;
-
+std::vector<io::SharedBufferedInputStream::IORange> ORCHdfsFileStream::_to_sb_io_ranges(
+        const std::vector<IORange>& io_ranges) {
     std::vector<io::SharedBufferedInputStream::IORange> bs_io_ranges;
     bs_io_ranges.reserve(io_ranges.size());
     for (const auto& r : io_ranges) {
         bs_io_ranges.emplace_back(static_cast<int64_t>(r.offset), static_cast<int64_t>(r.size), r.is_active);
     }
+    return bs_io_ranges;
+}
 
+bool ORCHdfsFileStream::_coalesce_active_lazy_column() {
     // default we will coalesce active and lazy column into one io range
-    bool active_lazy_column_coalesce = true;
     if (isIOAdaptiveCoalesceEnabled() && _lazy_column_coalesce_counter->load(std::memory_order_relaxed) < 0) {
-        active_lazy_column_coalesce = false;
         _app_stats->orc_stripe_active_lazy_coalesce_seperately++;
-    } else {
-        _app_stats->orc_stripe_active_lazy_coalesce_together++;
+        return false;
     }
+    _app_stats->orc_stripe_active_lazy_coalesce_together++;
+    return true;
+}
 
-    const Status st = setIORanges(bs_io_ranges, active_lazy_column_coalesce);
+void ORCHdfsFileStream::setIORanges(std::vector<IORange>& io_ranges) {
+    if (!_sb_stream) return;
+
+    const Status st = setIORanges(_to_sb_io_ranges(io_ranges), _coalesce_active_lazy_column());
 
     if (!st.ok()) {
         auto msg = strings::Substitute("Failed to setIORanges $0: $1", _file->filename(), st.to_string());
@@ -86,6 +91,22 @@ void ORCHdfsFileStream::setIORanges(std::vector<IORange>& io_ranges) {
     }
 }
 
+bool ORCHdfsFileStream::isStripePrefetchEnabled(const int64_t offset, const int64_t length) const {
+    return _sb_stream != nullptr && _sb_stream->prefetch_enabled() && offset >= _prefetch_scan_start &&
+           offset < _prefetch_scan_end;
+}
+
+void ORCHdfsFileStream::prefetchIORanges(std::vector<IORange>& io_ranges) {
+    if (!_sb_stream) return;
+
+    const Status st = _sb_stream->prefetch_io_ranges(_to_sb_io_ranges(io_ranges), _coalesce_active_lazy_column());
+
+    if (!st.ok()) {
+        auto msg = strings::Substitute("Failed to prefetchIORanges $0: $1", _file->filename(), st.to_string());
+        throw orc::ParseError(msg);
+    }
+}
+
 std::atomic<int32_t>* ORCHdfsFileStream::get_lazy_column_coalesce_counter() {
     return _lazy_column_coalesce_counter;
 }
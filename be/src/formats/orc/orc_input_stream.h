@@ -73,15 +73,27 @@ public:
     bool isAlreadyCollectedInSharedBuffer(const int64_t offset, const int64_t length) const override;
     void releaseToOffset(const int64_t offset) override;
     void setIORanges(std::vector<IORange>& io_ranges) override;
+    bool isStripePrefetchEnabled(const int64_t offset, const int64_t length) const override;
+    void prefetchIORanges(std::vector<IORange>& io_ranges) override;
+    // Prefetches the stripes starting in [scan_start, scan_end) through the shared buffered stream.
+    void enable_stripe_prefetch(int64_t scan_start, int64_t scan_end) {
+        _prefetch_scan_start = scan_start;
+        _prefetch_scan_end = scan_end;
+    }
     Status setIORanges(const std::vector<io::SharedBufferedInputStream::IORange>& io_ranges,
                        const bool coalesce_active_lazy_column = true);
     std::atomic<int32_t>* get_lazy_column_coalesce_counter() override;
 
 private:
+    static std::vector<io::SharedBufferedInputStream::IORange> _to_sb_io_ranges(const std::vector<IORange>& io_ranges);
+    bool _coalesce_active_lazy_column();
+
     RandomAccessFile* _file;
     uint64_t _length;
     io::SharedBufferedInputStream* _sb_stream;
     std::atomic<int32_t>* _lazy_column_coalesce_counter = nullptr;
     HdfsScanStats* _app_stats = nullptr;
+    int64_t _prefetch_scan_start = 0;
+    int64_t _prefetch_scan_end = 0;
 };
 } // namespace starrocks
@@ -35,14 +35,40 @@ ChunkWriter::ChunkWriter(::parquet::RowGroupWriter* rg_writer, const std::vector
     int num_columns = rg_writer->num_columns();
     _estimated_buffered_bytes.resize(num_columns);
     std::fill(_estimated_buffered_bytes.begin(), _estimated_buffered_bytes.end(), 0);
+
+    int leaf_column_idx = 0;
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        _first_leaf_column_idx.emplace_back(leaf_column_idx);
+        leaf_column_idx += _num_leaf_columns(_schema->field(i));
+    }
+    DCHECK_EQ(num_columns, leaf_column_idx);
+}
+
+int ChunkWriter::_num_leaf_columns(const ::parquet::schema::NodePtr& node) {
+    if (node->is_primitive()) {
+        return 1;
+    }
+    const auto* group_node = static_cast<const ::parquet::schema::GroupNode*>(node.get());
+    int num_leaf_columns = 0;
+    for (int i = 0; i < group_node->field_count(); i++) {
+        num_leaf_columns += _num_leaf_columns(group_node->field(i));
+    }
+    return num_leaf_columns;
 }
 
 Status ChunkWriter::write(Chunk* chunk) {
     LevelBuilderContext ctx(chunk->num_rows());
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
+        RETURN_IF_ERROR(write_column(ctx, i, col));
+    }
+    return Status::OK();
+}
 
-    // Writes out all leaf parquet columns to the RowGroupWriter. Each leaf column is written fully before
-    // the next column is written. Columns are written in DFS order.
-    int leaf_column_idx = 0;
+Status ChunkWriter::write_column(const LevelBuilderContext& ctx, size_t col_idx, const ColumnPtr& col) {
+    // Writes out the leaf parquet columns of the column to the RowGroupWriter. Each leaf column is written fully
+    // before the next column is written. Columns are written in DFS order.
+    int leaf_column_idx = _first_leaf_column_idx[col_idx];
 
     auto write_leaf_column = [&](const LevelBuilderResult& result) {
         auto leaf_column_writer = ColumnChunkWriter(_rg_writer->column(leaf_column_idx));
@@ -51,17 +77,13 @@ Status ChunkWriter::write(Chunk* chunk) {
         ++leaf_column_idx;
     };
 
-    for (size_t i = 0; i < _type_descs.size(); i++) {
-        ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
-        auto level_builder = LevelBuilder(_type_descs[i], _schema->field(i));
-        RETURN_IF_ERROR(level_builder.write(ctx, col, write_leaf_column));
-    }
-
-    return Status::OK();
+    auto level_builder = LevelBuilder(_type_descs[col_idx], _schema->field(col_idx));
+    return level_builder.write(ctx, col, write_leaf_column);
 }
 
 void ChunkWriter::close() {
     _rg_writer->Close();
+    _rg_writer = nullptr;
 }
 
 // The current row group written bytes = total_bytes_written + total_compressed_bytes + estimated_bytes.
@@ -58,6 +58,8 @@ class StatusOr;
 
 namespace starrocks::parquet {
 
+class LevelBuilderContext;
+
 // Wraps parquet::RowGroupWriter.
 // Write chunks into buffer. Flush on closing.
 class ChunkWriter {
@@ -68,16 +70,26 @@ public:
 
     Status write(Chunk* chunk);
 
+    // Writes the `col_idx`th column of a chunk into its leaf parquet columns. The leaf parquet columns of different
+    // columns are independent, so different columns could be written concurrently.
+    Status write_column(const LevelBuilderContext& ctx, size_t col_idx, const ColumnPtr& col);
+
     void close();
 
+    bool closed() const { return _rg_writer == nullptr; }
+
     int64_t estimated_buffered_bytes() const;
 
 private:
+    static int _num_leaf_columns(const ::parquet::schema::NodePtr& node);
+
     ::parquet::RowGroupWriter* _rg_writer;
     std::vector<TypeDescriptor> _type_descs;
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
     std::function<StatusOr<ColumnPtr>(Chunk*, size_t)> _eval_func;
     std::vector<int64_t> _estimated_buffered_bytes;
+    // the index of the first leaf parquet column of each column
+    std::vector<int> _first_leaf_column_idx;
 };
 
 } // namespace starrocks::parquet
@@ -29,6 +29,7 @@
 #include "formats/parquet/types.h"
 #include "formats/parquet/utils.h"
 #include "io/shared_buffered_input_stream.h"
+#include "runtime/global_dict/types.h"
 #include "storage/column_predicate.h"
 #include "storage/range.h"
 #include "types/logical_type.h"
@@ -131,6 +132,11 @@ public:
 
     virtual void set_can_lazy_decode(bool can_lazy_decode) {}
 
+    // Outputs the codes of `global_dict` instead of the strings, into a column of LowCardDictType.
+    virtual Status set_global_dict(const GlobalDictMap* global_dict) {
+        return Status::NotSupported("global dict is not supported by the column reader");
+    }
+
     virtual Status filter_dict_column(const ColumnPtr& column, Filter* filter,
                                       const std::vector<std::string>& sub_field_path, const size_t& layer) {
         return Status::OK();
@@ -670,6 +670,7 @@ Status FileReader::_init_group_readers() {
     _group_reader_param.lazy_column_coalesce_counter = fd_scanner_ctx.lazy_column_coalesce_counter;
     // for pageIndex
     _group_reader_param.min_max_conjunct_ctxs = fd_scanner_ctx.min_max_conjunct_ctxs;
+    _group_reader_param.global_dictmaps = fd_scanner_ctx.global_dictmaps;
 
     int64_t row_group_first_row = 0;
     // select and create row group readers.
@@ -745,14 +746,31 @@ Status FileReader::_prepare_cur_row_group() {
             _scanner_ctx->stats->group_active_lazy_coalesce_seperately += 1;
         }
         r->set_end_offset(end_offset);
-        RETURN_IF_ERROR(_sb_stream->set_io_ranges(ranges, counter >= 0));
+        if (_prefetched_row_group_idx != _cur_row_group_idx) {
+            RETURN_IF_ERROR(_sb_stream->set_io_ranges(ranges, counter >= 0));
+        }
         _group_reader_param.sb_stream = _sb_stream;
+        RETURN_IF_ERROR(_prefetch_next_row_group());
     }
 
     // prepare row group
     return r->prepare();
 }
 
+Status FileReader::_prefetch_next_row_group() {
+    const size_t next_row_group_idx = _cur_row_group_idx + 1;
+    if (!_sb_stream->prefetch_enabled() || next_row_group_idx >= _row_group_size) {
+        return Status::OK();
+    }
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    int64_t end_offset = 0;
+    _row_group_readers[next_row_group_idx]->collect_io_ranges(&ranges, &end_offset, ColumnIOType::PAGES);
+    int32_t counter = _scanner_ctx->lazy_column_coalesce_counter->load(std::memory_order_relaxed);
+    RETURN_IF_ERROR(_sb_stream->prefetch_io_ranges(ranges, counter >= 0));
+    _prefetched_row_group_idx = next_row_group_idx;
+    return Status::OK();
+}
+
 Status FileReader::get_next(ChunkPtr* chunk) {
     if (_is_file_filtered) {
         return Status::EndOfFile("");
@@ -123,6 +123,8 @@ private:
     StatusOr<uint32_t> _parse_metadata_length(const std::vector<char>& footer_buff) const;
 
     Status _prepare_cur_row_group();
+    // Reads the io ranges of the next row group in the background while the current one is being decoded.
+    Status _prefetch_next_row_group();
 
     // decode min/max value from row group stats
     Status _decode_min_max_column(const ParquetField& field, const std::string& timezone, const TypeDescriptor& type,
@@ -141,6 +143,8 @@ private:
     std::vector<std::shared_ptr<GroupReader>> _row_group_readers;
     size_t _cur_row_group_idx = 0;
     size_t _row_group_size = 0;
+    // The row group whose io ranges have been set by _prefetch_next_row_group().
+    size_t _prefetched_row_group_idx = SIZE_MAX;
 
     size_t _total_row_count = 0;
     size_t _scan_row_count = 0;
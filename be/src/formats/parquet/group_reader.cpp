@@ -70,6 +70,9 @@ Status GroupReader::prepare() {
             page_index_reader->select_column_offset_index();
         }
     }
+    if (_need_skip_rowids != nullptr && !_need_skip_rowids->empty()) {
+        _skip_deleted_row_runs();
+    }
 
     if (!_is_group_filtered) {
         _range_iter = _range.new_iterator();
@@ -77,6 +80,32 @@ Status GroupReader::prepare() {
     return Status::OK();
 }
 
+void GroupReader::_skip_deleted_row_runs() {
+    const int64_t min_run = std::max(config::parquet_skip_deleted_rows_min_run, 1);
+    const int64_t end = _row_group_first_row + _row_group_metadata->num_rows;
+    SparseRange<uint64_t> kept;
+    int64_t kept_begin = _row_group_first_row;
+    auto iter = _need_skip_rowids->lower_bound(_row_group_first_row);
+    auto last = _need_skip_rowids->lower_bound(end);
+    while (iter != last) {
+        const int64_t run_begin = *iter;
+        int64_t run_end = run_begin + 1;
+        for (++iter; iter != last && *iter == run_end; ++iter) {
+            run_end++;
+        }
+        if (run_end - run_begin >= min_run) {
+            if (run_begin > kept_begin) {
+                kept.add(Range<uint64_t>(kept_begin, run_begin));
+            }
+            kept_begin = run_end;
+        }
+    }
+    if (end > kept_begin) {
+        kept.add(Range<uint64_t>(kept_begin, end));
+    }
+    _range &= kept;
+}
+
 Status GroupReader::get_next(ChunkPtr* chunk, size_t* row_count) {
     SCOPED_RAW_TIMER(&_param.stats->group_chunk_read_ns);
     if (_is_group_filtered) {
@@ -267,12 +296,26 @@ Status GroupReader::_create_column_reader(const GroupReaderParam::Column& column
     const auto* schema_node = _param.file_metadata->schema().get_stored_column_by_field_idx(column.idx_in_parquet);
     {
         SCOPED_RAW_TIMER(&_param.stats->column_reader_init_ns);
+        // The strings of a column of the global dict are read from the file and output as the codes.
+        static const TypeDescriptor kGlobalDictValueType =
+                TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH);
+        const GlobalDictMap* global_dict = nullptr;
+        if (_param.global_dictmaps != nullptr) {
+            auto iter = _param.global_dictmaps->find(column.slot_id());
+            if (iter != _param.global_dictmaps->end()) {
+                global_dict = iter->second;
+            }
+        }
+        const TypeDescriptor& read_type = global_dict != nullptr ? kGlobalDictValueType : column.slot_type();
         if (column.t_iceberg_schema_field == nullptr) {
-            RETURN_IF_ERROR(ColumnReader::create(_column_reader_opts, schema_node, column.slot_type(), &column_reader));
+            RETURN_IF_ERROR(ColumnReader::create(_column_reader_opts, schema_node, read_type, &column_reader));
         } else {
-            RETURN_IF_ERROR(ColumnReader::create(_column_reader_opts, schema_node, column.slot_type(),
+            RETURN_IF_ERROR(ColumnReader::create(_column_reader_opts, schema_node, read_type,
                                                  column.t_iceberg_schema_field, &column_reader));
         }
+        if (global_dict != nullptr) {
+            RETURN_IF_ERROR(column_reader->set_global_dict(global_dict));
+        }
 
         if (column.slot_type().is_complex_type()) {
             // For complex type columns, we need parse def & rep levels.
@@ -372,18 +415,28 @@ ChunkPtr GroupReader::_create_read_chunk(const std::vector<int>& column_indices)
 void GroupReader::collect_io_ranges(std::vector<io::SharedBufferedInputStream::IORange>* ranges, int64_t* end_offset,
                                     ColumnIOType type) {
     int64_t end = 0;
+    // The ranges are tagged with their columns, by which the datacache policies of the columns are applied.
+    auto tag_ranges = [ranges](size_t from, const std::string& column) {
+        for (size_t i = from; i < ranges->size(); i++) {
+            (*ranges)[i].column = column;
+        }
+    };
     // collect io of active column
     for (const auto& index : _active_column_indices) {
         const auto& column = _param.read_cols[index];
         SlotId slot_id = column.slot_id();
+        size_t from = ranges->size();
         _column_readers[slot_id]->collect_column_io_range(ranges, &end, type, true);
+        tag_ranges(from, column.slot_desc->col_name());
     }
 
     // collect io of lazy column
     for (const auto& index : _lazy_column_indices) {
         const auto& column = _param.read_cols[index];
         SlotId slot_id = column.slot_id();
+        size_t from = ranges->size();
         _column_readers[slot_id]->collect_column_io_range(ranges, &end, type, false);
+        tag_ranges(from, column.slot_desc->col_name());
     }
     *end_offset = end;
 }
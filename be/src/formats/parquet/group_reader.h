@@ -39,6 +39,7 @@
 #include "gen_cpp/parquet_types.h"
 #include "io/shared_buffered_input_stream.h"
 #include "runtime/descriptors.h"
+#include "runtime/global_dict/types.h"
 #include "runtime/runtime_state.h"
 #include "storage/range.h"
 #include "util/runtime_profile.h"
@@ -101,6 +102,9 @@ struct GroupReaderParam {
 
     // used for pageIndex
     std::vector<ExprContext*> min_max_conjunct_ctxs;
+
+    // the query global dicts of the columns read as dict codes, by slot id
+    const ColumnIdToGlobalDictMap* global_dictmaps = nullptr;
 };
 
 class PageIndexReader;
@@ -145,6 +149,9 @@ public:
 
     StatusOr<size_t> _read_range_round_by_round(const Range<uint64_t>& range, Filter* filter, ChunkPtr* chunk);
 
+    // Removes the long runs of rows in `_need_skip_rowids` from `_range`, the others are filtered after reading.
+    void _skip_deleted_row_runs();
+
     // row group meta
     const tparquet::RowGroup* _row_group_metadata = nullptr;
     int64_t _row_group_first_row = 0;
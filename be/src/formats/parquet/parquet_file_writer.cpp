@@ -24,14 +24,18 @@
 #include <parquet/statistics.h>
 #include <runtime/current_thread.h>
 
+#include <atomic>
 #include <future>
+#include <mutex>
 #include <ostream>
 #include <utility>
 
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "formats/file_writer.h"
 #include "formats/parquet/chunk_writer.h"
 #include "formats/parquet/file_writer.h"
+#include "formats/parquet/level_builder.h"
 #include "formats/utils.h"
 #include "fs/fs.h"
 #include "runtime/runtime_state.h"
@@ -46,10 +50,17 @@ class Chunk;
 namespace starrocks::formats {
 
 std::future<Status> ParquetFileWriter::write(ChunkPtr chunk) {
+    if (_rowgroup_writer != nullptr && _rowgroup_writer->closed()) {
+        // flushed by the last write
+        _rowgroup_writer = nullptr;
+    }
     if (_rowgroup_writer == nullptr) {
         _rowgroup_writer = std::make_unique<parquet::ChunkWriter>(_writer->AppendBufferedRowGroup(), _type_descs,
                                                                   _schema, _eval_func);
     }
+    if (_executors != nullptr && _type_descs.size() > 1 && config::parquet_writer_parallel_column_enable) {
+        return _write_columns_async(chunk);
+    }
     if (auto status = _rowgroup_writer->write(chunk.get()); !status.ok()) {
         return make_ready_future(std::move(status));
     }
@@ -115,7 +126,7 @@ std::future<FileWriter::CommitResult> ParquetFileWriter::commit() {
 
 int64_t ParquetFileWriter::get_written_bytes() {
     int n = _output_stream->Tell().MoveValueUnsafe();
-    if (_rowgroup_writer != nullptr) {
+    if (_rowgroup_writer != nullptr && !_rowgroup_writer->closed()) {
         n += _rowgroup_writer->estimated_buffered_bytes();
     }
     return n;
@@ -169,6 +180,88 @@ std::future<Status> ParquetFileWriter::_flush_row_group() {
     return future;
 }
 
+std::future<Status> ParquetFileWriter::_write_columns_async(const ChunkPtr& chunk) {
+    DCHECK(_rowgroup_writer != nullptr);
+    // the columns are evaluated on the sink driver, the evaluators are not thread safe
+    Columns columns;
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        auto column = _eval_func(chunk.get(), i);
+        if (!column.ok()) {
+            return make_ready_future(column.status());
+        }
+        columns.emplace_back(std::move(column).value());
+    }
+
+    struct WriteState {
+        WriteState(size_t num_rows, size_t num_tasks) : ctx(num_rows), num_unfinished_tasks(num_tasks) {}
+
+        parquet::LevelBuilderContext ctx;
+        Columns columns;
+        std::promise<Status> promise;
+        std::atomic<size_t> num_unfinished_tasks;
+        std::mutex mu;
+        Status status;
+    };
+    auto write_state = std::make_shared<WriteState>(chunk->num_rows(), columns.size());
+    write_state->columns = std::move(columns);
+    std::future<Status> future = write_state->promise.get_future();
+
+    {
+        std::lock_guard lock(_execution_state->mu);
+        _execution_state->has_unfinished_task = true;
+    }
+
+    for (size_t i = 0; i < write_state->columns.size(); i++) {
+        auto task = [rowgroup_writer = _rowgroup_writer, write_state, col_idx = i, state = _runtime_state,
+                     execution_state = _execution_state, rowgroup_size = _writer_options->rowgroup_size] {
+#ifndef BE_TEST
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->instance_mem_tracker());
+            CurrentThread::current().set_query_id(state->query_id());
+            CurrentThread::current().set_fragment_instance_id(state->fragment_instance_id());
+#endif
+            Status status;
+            try {
+                status = rowgroup_writer->write_column(write_state->ctx, col_idx, write_state->columns[col_idx]);
+            } catch (const ::parquet::ParquetStatusException& e) {
+                status = Status::IOError(fmt::format("{}: {}", "write column error", e.what()));
+            }
+            if (!status.ok()) {
+                std::lock_guard lock(write_state->mu);
+                write_state->status.update(status);
+            }
+            if (write_state->num_unfinished_tasks.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+
+            // the last finished task releases the columns and flushes the row group
+            write_state->columns.clear();
+            status = write_state->status;
+            if (status.ok() && rowgroup_writer->estimated_buffered_bytes() >= rowgroup_size) {
+                try {
+                    rowgroup_writer->close();
+                } catch (const ::parquet::ParquetStatusException& e) {
+                    status = Status::IOError(fmt::format("{}: {}", "flush rowgroup error", e.what()));
+                }
+            }
+            if (!status.ok()) {
+                LOG(WARNING) << status;
+            }
+            write_state->promise.set_value(status);
+
+            {
+                std::lock_guard lock(execution_state->mu);
+                execution_state->has_unfinished_task = false;
+                execution_state->cv.notify_one();
+            }
+        };
+        if (!_executors->try_offer(task)) {
+            // write it on the sink driver if the executors are busy
+            task();
+        }
+    }
+    return future;
+}
+
 #define MERGE_STATS_CASE(ParquetType)                                                                              \
     case ParquetType: {                                                                                            \
         auto typed_left_stat =                                                                                     \
@@ -128,6 +128,10 @@ private:
 
     std::future<Status> _flush_row_group();
 
+    // Writes the columns of `chunk` by a task per column on `_executors`, and flushes the row group at last if it
+    // is large enough. The next chunk must not be written until the returned future is ready.
+    std::future<Status> _write_columns_async(const ChunkPtr& chunk);
+
     std::shared_ptr<::parquet::WriterProperties> _properties;
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
 
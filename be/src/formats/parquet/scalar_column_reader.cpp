@@ -14,9 +14,16 @@
 
 #include "formats/parquet/scalar_column_reader.h"
 
+#include <fmt/format.h>
+
+#include <algorithm>
+
 #include "formats/parquet/stored_column_reader_with_index.h"
 #include "gutil/casts.h"
 #include "io/shared_buffered_input_stream.h"
+#include "runtime/global_dict/config.h"
+#include "runtime/global_dict/dict_column.h"
+#include "simd/gather.h"
 #include "simd/simd.h"
 #include "utils.h"
 
@@ -24,6 +31,9 @@ namespace starrocks::parquet {
 
 Status ScalarColumnReader::read_range(const Range<uint64_t>& range, const Filter* filter, ColumnPtr& dst) {
     DCHECK(_field->is_nullable ? dst->is_nullable() : true);
+    if (_global_dict != nullptr) {
+        return _read_range_with_global_dict(range, filter, dst);
+    }
     _need_lazy_decode =
             _dict_filter_ctx != nullptr || (_can_lazy_decode && filter != nullptr &&
                                             SIMD::count_nonzero(*filter) * 1.0 / filter->size() < FILTER_RATIO);
@@ -56,7 +66,8 @@ bool ScalarColumnReader::try_to_use_dict_filter(ExprContext* ctx, bool is_decode
         return false;
     }
 
-    if (!_col_type->is_string_type()) {
+    // The conjuncts of a column of the global dict are evaluated on the global dict codes.
+    if (!_col_type->is_string_type() || _global_dict != nullptr) {
         return false;
     }
 
@@ -105,6 +116,124 @@ Status ScalarColumnReader::fill_dst_column(ColumnPtr& dst, const ColumnPtr& src)
     return Status::OK();
 }
 
+Status ScalarColumnReader::_read_range_with_global_dict(const Range<uint64_t>& range, const Filter* filter,
+                                                        ColumnPtr& dst) {
+    if (!_local_to_global_inited) {
+        RETURN_IF_ERROR(_init_local_to_global_codes());
+        _local_to_global_inited = true;
+    }
+    const size_t num_rows = range.span_size();
+    auto* codes = ColumnHelper::get_data_column(dst.get());
+    auto& code_data = down_cast<LowCardDictColumn*>(codes)->get_data();
+    const size_t old_size = code_data.size();
+
+    if (!_local_to_global.empty()) {
+        if (_dict_code == nullptr) {
+            _dict_code = ColumnHelper::create_column(
+                    TypeDescriptor::from_logical_type(ColumnDictFilterContext::kDictCodePrimitiveType), true);
+        }
+        _dict_code->reset_column();
+        {
+            SCOPED_RAW_TIMER(&_opts.stats->column_read_ns);
+            RETURN_IF_ERROR(_reader->read_range(range, filter, ColumnContentType::DICT_CODE, _dict_code.get()));
+        }
+        DCHECK_EQ(num_rows, _dict_code->size());
+        const auto& local_codes = down_cast<NullableColumn*>(_dict_code.get())->data_column();
+        const auto& local_data = down_cast<const Int32Column*>(local_codes.get())->get_data();
+        code_data.resize(old_size + num_rows);
+        // code_data[i] = _local_to_global[local_data[i]]
+        SIMDGather::gather(code_data.data() + old_size, _local_to_global.data(), local_data.data(),
+                           _local_to_global.size(), num_rows);
+        if (dst->is_nullable()) {
+            const auto* local_nulls = down_cast<NullableColumn*>(_dict_code.get());
+            auto* nulls = down_cast<NullableColumn*>(dst.get());
+            nulls->mutable_null_column()->append(*local_nulls->null_column(), 0, num_rows);
+            nulls->set_has_null(local_nulls->has_null());
+        }
+    } else {
+        if (_global_dict_values == nullptr) {
+            _global_dict_values = ColumnHelper::create_column(*_col_type, true);
+        }
+        _global_dict_values->reset_column();
+        // The converters for strings do nothing.
+        DCHECK(!_converter->need_convert);
+        {
+            SCOPED_RAW_TIMER(&_opts.stats->column_read_ns);
+            RETURN_IF_ERROR(
+                    _reader->read_range(range, filter, ColumnContentType::VALUE, _global_dict_values.get()));
+        }
+        DCHECK_EQ(num_rows, _global_dict_values->size());
+        RETURN_IF_ERROR(_encode_to_global_codes(*_global_dict_values, filter, dst.get()));
+    }
+
+    if (dst->is_nullable()) {
+        // The codes of the nulls are 0, like the global dict codes of the native tables.
+        const auto& null_data = down_cast<NullableColumn*>(dst.get())->immutable_null_column_data();
+        for (size_t i = old_size; i < old_size + num_rows; i++) {
+            code_data[i] = null_data[i] ? 0 : code_data[i];
+        }
+    }
+    return Status::OK();
+}
+
+Status ScalarColumnReader::_init_local_to_global_codes() {
+    if (!_column_all_pages_dict_encoded()) {
+        return Status::OK();
+    }
+    auto dict_values = ColumnHelper::create_column(*_col_type, true);
+    RETURN_IF_ERROR(_reader->get_dict_values(dict_values.get()));
+    const auto* values = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(dict_values.get()));
+    // The local dict can not be larger than the global dict if all its values are in the global dict.
+    if (values->size() > DICT_DECODE_MAX_SIZE) {
+        return Status::OK();
+    }
+    // The codes of the nulls and the rows not selected may be any code, or 0 if the dict is empty.
+    std::vector<int16_t> local_to_global(std::max<size_t>(values->size(), 1), 0);
+    for (size_t i = 0; i < values->size(); i++) {
+        auto iter = _global_dict->find(values->get_slice(i));
+        if (iter == _global_dict->end()) {
+            // Some values may be out of the query or of the selected rows, which are left to the row by row way.
+            return Status::OK();
+        }
+        local_to_global[i] = iter->second;
+    }
+    _local_to_global = std::move(local_to_global);
+    return Status::OK();
+}
+
+Status ScalarColumnReader::_encode_to_global_codes(const Column& values, const Filter* filter, Column* codes) {
+    const auto* binary = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(&values));
+    const size_t num_rows = values.size();
+    const NullData* value_nulls =
+            values.is_nullable() ? &down_cast<const NullableColumn&>(values).immutable_null_column_data() : nullptr;
+    auto& code_data = down_cast<LowCardDictColumn*>(ColumnHelper::get_data_column(codes))->get_data();
+    const size_t old_size = code_data.size();
+    code_data.resize(old_size + num_rows, 0);
+    const auto end = _global_dict->end();
+    for (size_t i = 0; i < num_rows; i++) {
+        if ((value_nulls != nullptr && (*value_nulls)[i]) || (filter != nullptr && !(*filter)[i])) {
+            continue;
+        }
+        auto iter = _global_dict->find(binary->get_slice(i));
+        if (UNLIKELY(iter == end)) {
+            return Status::GlobalDictError(
+                    fmt::format("not found slice:{} in global dict", binary->get_slice(i).to_string()));
+        }
+        code_data[old_size + i] = iter->second;
+    }
+    if (codes->is_nullable()) {
+        auto* nulls = down_cast<NullableColumn*>(codes);
+        if (value_nulls != nullptr) {
+            const auto& value_null_column = down_cast<const NullableColumn&>(values).null_column();
+            nulls->mutable_null_column()->append(*value_null_column, 0, num_rows);
+            nulls->set_has_null(values.has_null());
+        } else {
+            nulls->mutable_null_column()->append_default(num_rows);
+        }
+    }
+    return Status::OK();
+}
+
 bool ScalarColumnReader::_column_all_pages_dict_encoded() {
     // The Parquet spec allows for column chunks to have mixed encodings
     // where some data pages are dictionary-encoded and others are plain
@@ -250,7 +379,8 @@ void ScalarColumnReader::select_offset_index(const SparseRange<uint64_t>& range,
     bool has_dict_page = column_metadata.__isset.dictionary_page_offset;
     // be compatible with PARQUET-1850
     has_dict_page |= _offset_index_ctx->check_dictionary_page(column_metadata.data_page_offset);
-    _reader = std::make_unique<StoredColumnReaderWithIndex>(std::move(_reader), _offset_index_ctx.get(), has_dict_page);
+    _reader = std::make_unique<StoredColumnReaderWithIndex>(std::move(_reader), _offset_index_ctx.get(), has_dict_page,
+                                                            _field->max_rep_level() == 0, _opts.stats);
 }
 
 } // namespace starrocks::parquet
\ No newline at end of file
@@ -58,6 +58,11 @@ public:
         return _dict_filter_ctx->rewrite_conjunct_ctxs_to_predicate(_reader.get(), is_group_filtered);
     }
 
+    Status set_global_dict(const GlobalDictMap* global_dict) override {
+        _global_dict = global_dict;
+        return Status::OK();
+    }
+
     void set_can_lazy_decode(bool can_lazy_decode) override {
         _can_lazy_decode = can_lazy_decode && _col_type->is_string_type() && _column_all_pages_dict_encoded();
     }
@@ -100,6 +105,14 @@ private:
     // Returns true if all of the data pages in the column chunk are dict encoded
     bool _column_all_pages_dict_encoded();
 
+    Status _read_range_with_global_dict(const Range<uint64_t>& range, const Filter* filter, ColumnPtr& dst);
+    // Maps the dict codes of the column chunk to the codes of the global dict, if all the pages are dict
+    // encoded and all the dict values are in the global dict.
+    Status _init_local_to_global_codes();
+    // Encodes the strings by the global dict, where the strings of the rows not selected by `filter` may be not
+    // in the global dict.
+    Status _encode_to_global_codes(const Column& values, const Filter* filter, Column* codes);
+
     const ColumnReaderOptions& _opts;
 
     std::unique_ptr<StoredColumnReader> _reader;
@@ -119,6 +132,12 @@ private:
     bool _need_lazy_decode = false;
     // dict code
     ColumnPtr _dict_code = nullptr;
+
+    const GlobalDictMap* _global_dict = nullptr;
+    bool _local_to_global_inited = false;
+    // The global dict code of each dict code, empty if the dict codes can not be mapped.
+    std::vector<int16_t> _local_to_global;
+    ColumnPtr _global_dict_values = nullptr;
 };
 
 } // namespace starrocks::parquet
\ No newline at end of file
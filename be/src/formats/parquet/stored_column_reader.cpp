@@ -439,8 +439,14 @@ Status OptionalStoredColumnReader::_read_values_on_levels(size_t num_values,
         DCHECK_EQ(num_values, level_parsed);
         _is_nulls.resize(num_values);
         // decode def levels
+        uint16_t has_null = 0;
         for (size_t i = 0; i < num_values; ++i) {
             _is_nulls[i] = def_levels[i] < _field->max_def_level();
+            has_null |= _is_nulls[i];
+        }
+        if (!has_null) {
+            // the values are decoded in a batch, without looking for the runs of nulls
+            return _reader->decode_values(num_values, content_type, dst);
         }
         return _reader->decode_values(num_values, &_is_nulls[0], content_type, dst);
     }
@@ -16,7 +16,11 @@
 
 #include <glog/logging.h>
 
+#include "column/column.h"
+#include "common/config.h"
+#include "exec/hdfs_scanner.h"
 #include "gen_cpp/parquet_types.h"
+#include "simd/simd.h"
 #include "util/defer_op.h"
 
 namespace starrocks {
@@ -27,6 +31,53 @@ namespace starrocks::parquet {
 
 Status StoredColumnReaderWithIndex::read_range(const Range<uint64_t>& range, const Filter* filter,
                                                ColumnContentType content_type, Column* dst) {
+    if (filter == nullptr || !_can_skip_pages || _need_parse_levels ||
+        !config::parquet_page_late_materialization_enable) {
+        return _read_selected_pages(range, filter, content_type, dst);
+    }
+    // Split the range into the runs of pages with and without selected rows. The rows of the pages without selected
+    // rows are filtered out by the caller, so default values are appended for them instead of loading the pages,
+    // which saves the decoding as well as the io of the pages not coalesced with others.
+    size_t page_idx = _cur_page_idx;
+    uint64_t run_begin = range.begin();
+    bool run_selected = true;
+    size_t run_pages = 0;
+    auto flush_run = [&](uint64_t run_end) -> Status {
+        if (run_end <= run_begin) {
+            return Status::OK();
+        }
+        if (run_selected) {
+            Filter run_filter{filter->begin() + (run_begin - range.begin()),
+                              filter->begin() + (run_end - range.begin())};
+            return _read_selected_pages(Range<uint64_t>(run_begin, run_end), &run_filter, content_type, dst);
+        }
+        dst->append_default(run_end - run_begin);
+        _stats->page_skip += run_pages;
+        return Status::OK();
+    };
+    for (uint64_t begin = range.begin(); begin < range.end();) {
+        while (page_idx < _page_num - 1 && begin >= _page_first_row(page_idx + 1)) {
+            page_idx++;
+        }
+        const uint64_t end = page_idx < _page_num - 1 ? std::min(_page_first_row(page_idx + 1), range.end())
+                                                      : range.end();
+        const bool selected = SIMD::contain_nonzero(*filter, begin - range.begin(), end - begin);
+        if (begin == range.begin()) {
+            run_selected = selected;
+        } else if (selected != run_selected) {
+            RETURN_IF_ERROR(flush_run(begin));
+            run_begin = begin;
+            run_selected = selected;
+            run_pages = 0;
+        }
+        run_pages++;
+        begin = end;
+    }
+    return flush_run(range.end());
+}
+
+Status StoredColumnReaderWithIndex::_read_selected_pages(const Range<uint64_t>& range, const Filter* filter,
+                                                         ColumnContentType content_type, Column* dst) {
     DCHECK(range.begin() >= _offset_index_ctx->offset_index.page_locations[_cur_page_idx].first_row_index +
                                     _offset_index_ctx->rg_first_row);
     size_t stop_page_idx = _cur_page_idx;
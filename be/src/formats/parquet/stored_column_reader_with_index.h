@@ -32,15 +32,22 @@
 namespace starrocks {
 class Column;
 class NullableColumn;
+struct HdfsScanStats;
 } // namespace starrocks
 
 namespace starrocks::parquet {
 
 class StoredColumnReaderWithIndex : public StoredColumnReader {
 public:
+    // The pages without any row selected by the filter of a read are skipped without being loaded if
+    // `can_skip_pages`, which requires the column not to be repeated.
     StoredColumnReaderWithIndex(std::unique_ptr<StoredColumnReader> reader, ColumnOffsetIndexCtx* offset_index_ctx,
-                                bool has_dict_page)
-            : _inner_reader(std::move(reader)), _offset_index_ctx(offset_index_ctx), _has_dict_page(has_dict_page) {
+                                bool has_dict_page, bool can_skip_pages, HdfsScanStats* stats)
+            : _inner_reader(std::move(reader)),
+              _offset_index_ctx(offset_index_ctx),
+              _has_dict_page(has_dict_page),
+              _can_skip_pages(can_skip_pages),
+              _stats(stats) {
         _page_num = _offset_index_ctx->page_selected.size();
         _inner_reader->set_page_num(_page_num);
         _inner_reader->set_page_change_on_record_boundry();
@@ -49,6 +56,7 @@ public:
     ~StoredColumnReaderWithIndex() = default;
 
     void set_need_parse_levels(bool need_parse_levels) override {
+        _need_parse_levels = need_parse_levels;
         _inner_reader->set_need_parse_levels(need_parse_levels);
     }
 
@@ -67,12 +75,24 @@ public:
     }
 
 private:
+    // Reads the rows of the selected pages in `range`.
+    Status _read_selected_pages(const Range<uint64_t>& range, const Filter* filter, ColumnContentType content_type,
+                                Column* dst);
+    uint64_t _page_first_row(size_t page_idx) const {
+        return _offset_index_ctx->offset_index.page_locations[page_idx].first_row_index +
+               _offset_index_ctx->rg_first_row;
+    }
+
     std::unique_ptr<StoredColumnReader> _inner_reader;
     ColumnOffsetIndexCtx* _offset_index_ctx;
     size_t _cur_page_idx = 0;
     size_t _page_num = 0;
     bool _dict_page_loaded = false;
     bool _has_dict_page;
+    const bool _can_skip_pages;
+    // The levels of the skipped pages can not be provided.
+    bool _need_parse_levels = false;
+    HdfsScanStats* _stats;
 };
 
 } // namespace starrocks::parquet
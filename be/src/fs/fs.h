@@ -96,6 +96,8 @@ struct RandomAccessFileOptions {
     bool skip_fill_local_cache = false;
     // Specify different buffer size for different read scenarios
     int64_t buffer_size = -1;
+    // The modification time of the file if it is known, which the filesystem may use to reuse the handles of it.
+    int64_t modification_time = 0;
 };
 
 struct DirEntry {
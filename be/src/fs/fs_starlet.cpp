@@ -31,12 +31,14 @@
 #include "fs/output_stream_adapter.h"
 #include "gutil/strings/util.h"
 #include "io/input_stream.h"
+#include "io/io_profiler.h"
 #include "io/output_stream.h"
 #include "io/seekable_input_stream.h"
 #include "io/throttled_output_stream.h"
 #include "io/throttled_seekable_input_stream.h"
 #include "service/staros_worker.h"
 #include "storage/olap_common.h"
+#include "util/stopwatch.hpp"
 #include "util/string_parser.hpp"
 
 namespace starrocks {
@@ -142,10 +144,17 @@ public:
         if (!stream_st.ok()) {
             return to_status(stream_st.status());
         }
+        // the read is from the cache of starlet unless it reads some bytes from the remote storage
+        const int64_t bytes_read_remote = (*stream_st)->get_io_stats().bytes_read_remote;
+        MonotonicStopWatch watch;
+        watch.start();
         auto res = (*stream_st)->read(data, count);
         if (res.ok()) {
             g_starlet_io_num_reads << 1;
             g_starlet_io_read << *res;
+            const bool is_remote = (*stream_st)->get_io_stats().bytes_read_remote > bytes_read_remote;
+            IOProfiler::add_read_of_source(is_remote ? IOProfiler::READ_REMOTE : IOProfiler::READ_CACHE, *res,
+                                           watch.elapsed_time());
             return *res;
         } else {
             return to_status(res.status());
@@ -23,10 +23,12 @@
 #include "fs/fs_util.h"
 #include "fs/hdfs/hdfs_fs_cache.h"
 #include "gutil/strings/substitute.h"
+#include "io/io_profiler.h"
 #include "runtime/file_result_writer.h"
 #include "testutil/sync_point.h"
 #include "udf/java/utils.h"
 #include "util/hdfs_util.h"
+#include "util/stopwatch.hpp"
 
 using namespace fmt::literals;
 
@@ -34,8 +36,8 @@ namespace starrocks {
 
 class GetHdfsFileReadOnlyHandle {
 public:
-    GetHdfsFileReadOnlyHandle(const FSOptions options, std::string path, int buffer_size)
-            : _options(std::move(options)), _path(std::move(path)), _buffer_size(buffer_size) {}
+    GetHdfsFileReadOnlyHandle(const FSOptions options, std::string path, int buffer_size, int64_t mtime = 0)
+            : _options(std::move(options)), _path(std::move(path)), _buffer_size(buffer_size), _mtime(mtime) {}
 
     StatusOr<hdfsFS> getOrCreateFS() {
         if (_hdfs_client == nullptr) {
@@ -52,6 +54,15 @@ public:
             auto st = getOrCreateFS();
             SCOPED_RAW_TIMER(&_total_open_file_time_ns);
             if (!st.ok()) return st.status();
+            if (cacheable()) {
+                _file = HdfsFileHandleCache::instance()->take(_hdfs_client, _path, _mtime);
+                if (_file != nullptr) {
+                    // the statistics of a cached handle are accumulated by its previous readers
+                    (void)hdfsFileClearReadStatistics(_file);
+                    _file_handle_cache_hits++;
+                    return _file;
+                }
+            }
             _file = hdfsOpenFile(st.value(), _path.c_str(), O_RDONLY, _buffer_size, 0, 0);
             if (_file == nullptr) {
                 if (errno == ENOENT) {
@@ -69,6 +80,7 @@ public:
     hdfsFile getFile() { return _file; }
     int64_t getTotalOpenFSTimeNs() const { return _total_open_fs_time_ns; }
     int64_t getTotalOpenFileTimeNs() const { return _total_open_file_time_ns; }
+    int64_t getFileHandleCacheHits() const { return _file_handle_cache_hits; }
     const std::string& getPath() const { return _path; }
     void setOffset(int64_t offset) { _offset = offset; }
 
@@ -87,11 +99,17 @@ public:
         return Status::OK();
     }
 
-    int close() {
+    // If |keep_in_cache| is true and the file is cacheable, the handle is given back to HdfsFileHandleCache
+    // instead of being closed, so that the next reader of the same file can skip opening it.
+    int close(bool keep_in_cache = false) {
         int r = 0;
         if (_file != nullptr) {
-            hdfsFS fs = getFS();
-            r = hdfsCloseFile(fs, _file);
+            if (keep_in_cache && cacheable()) {
+                HdfsFileHandleCache::instance()->put(_hdfs_client, _path, _mtime, _file);
+            } else {
+                hdfsFS fs = getFS();
+                r = hdfsCloseFile(fs, _file);
+            }
             _file = nullptr;
         }
         return r;
@@ -154,13 +172,19 @@ public:
     }
 
 private:
+    // Only the handles of the files whose modification time is known are cached, so that a handle is never
+    // reused after the file is rewritten.
+    bool cacheable() const { return _mtime > 0 && config::hdfs_client_enable_file_handle_cache; }
+
     const FSOptions _options;
     std::string _path;
     int _buffer_size;
+    int64_t _mtime;
     std::shared_ptr<HdfsFsClient> _hdfs_client = nullptr;
     hdfsFile _file = nullptr;
     int64_t _total_open_fs_time_ns = 0;
     int64_t _total_open_file_time_ns = 0;
+    int64_t _file_handle_cache_hits = 0;
     int64_t _offset = 0;
 };
 
@@ -190,7 +214,7 @@ private:
 
 HdfsInputStream::~HdfsInputStream() {
     auto ret = call_hdfs_scan_function_in_pthread([this]() {
-        int r = _handle->close();
+        int r = _handle->close(true);
         if (r == -1) {
             auto error_msg = fmt::format("Fail to close file {}: {}", _handle->getPath(), get_hdfs_err_msg());
             LOG(WARNING) << error_msg;
@@ -206,7 +230,11 @@ StatusOr<int64_t> HdfsInputStream::read(void* data, int64_t size) {
     if (UNLIKELY(size > std::numeric_limits<tSize>::max())) {
         size = std::numeric_limits<tSize>::max();
     }
-    return _handle->pread(static_cast<uint8_t*>(data), size, config::hdfs_client_io_read_retry);
+    MonotonicStopWatch watch;
+    watch.start();
+    ASSIGN_OR_RETURN(auto res, _handle->pread(static_cast<uint8_t*>(data), size, config::hdfs_client_io_read_retry));
+    IOProfiler::add_read_of_source(IOProfiler::READ_REMOTE, res, watch.elapsed_time());
+    return res;
     // return _handle->read(static_cast<uint8_t*>(data), size, config::hdfs_client_io_read_retry);
 }
 
@@ -248,6 +276,7 @@ StatusOr<std::unique_ptr<io::NumericStatistics>> HdfsInputStream::get_numeric_st
         }
         stats->append(HdfsReadMetricsKey::kTotalOpenFSTimeNs, _handle->getTotalOpenFSTimeNs());
         stats->append(HdfsReadMetricsKey::kTotalOpenFileTimeNs, _handle->getTotalOpenFileTimeNs());
+        stats->append(HdfsReadMetricsKey::kTotalFileHandleCacheHits, _handle->getFileHandleCacheHits());
 
         struct hdfsReadStatistics* hdfs_statistics = nullptr;
         auto r = hdfsFileGetReadStatistics(file, &hdfs_statistics);
@@ -630,7 +659,8 @@ StatusOr<std::unique_ptr<RandomAccessFile>> HdfsFileSystem::new_random_access_fi
     if (_options.download != nullptr && _options.download->__isset.hdfs_read_buffer_size_kb) {
         hdfs_read_buffer_size = _options.download->hdfs_read_buffer_size_kb;
     }
-    auto handle = std::make_unique<GetHdfsFileReadOnlyHandle>(_options, path, hdfs_read_buffer_size);
+    auto handle =
+            std::make_unique<GetHdfsFileReadOnlyHandle>(_options, path, hdfs_read_buffer_size, opts.modification_time);
     auto stream = std::make_shared<HdfsInputStream>(std::move(handle));
     return std::make_unique<RandomAccessFile>(std::move(stream), path);
 }
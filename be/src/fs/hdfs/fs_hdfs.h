@@ -21,6 +21,7 @@ namespace starrocks {
 struct HdfsReadMetricsKey {
     static constexpr const char* kTotalOpenFSTimeNs = "TotalOpenFSTimeNs";
     static constexpr const char* kTotalOpenFileTimeNs = "TotalOpenFileTimeNs";
+    static constexpr const char* kTotalFileHandleCacheHits = "TotalFileHandleCacheHits";
 
     static constexpr const char* kTotalBytesRead = "TotalBytesRead";
     static constexpr const char* kTotalLocalBytesRead = "TotalLocalBytesRead";
@@ -14,7 +14,9 @@
 
 #include "fs/hdfs/hdfs_fs_cache.h"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "common/config.h"
 #include "gutil/strings/substitute.h"
@@ -70,6 +72,11 @@ static Status create_hdfs_fs_handle(const std::string& namenode, const std::shar
         }
     }
 
+    if (config::hdfs_client_enable_short_circuit_read && !config::hdfs_client_domain_socket_path.empty()) {
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.read.shortcircuit", "true");
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.domain.socket.path", config::hdfs_client_domain_socket_path.data());
+    }
+
     // Set for hdfs client hedged read
     std::string hedged_read_threadpool_size = std::to_string(config::hdfs_client_hedged_read_threadpool_size);
     std::string hedged_read_threshold_millis = std::to_string(config::hdfs_client_hedged_read_threshold_millis);
@@ -131,4 +138,53 @@ Status HdfsFsCache::get_connection(const std::string& namenode, std::shared_ptr<
     return Status::OK();
 }
 
+void HdfsFileHandleCache::close(const Entry& entry) {
+    if (hdfsCloseFile(entry.hdfs_client->hdfs_fs, entry.file) == -1) {
+        LOG(WARNING) << "Fail to close file " << entry.path << ": " << get_hdfs_err_msg();
+    }
+}
+
+hdfsFile HdfsFileHandleCache::take(const std::shared_ptr<HdfsFsClient>& hdfs_client, const std::string& path,
+                                   int64_t mtime) {
+    std::lock_guard<std::mutex> l(_lock);
+    auto [begin, end] = _path_to_entries.equal_range(path);
+    for (auto it = begin; it != end; ++it) {
+        auto entry_it = it->second;
+        if (entry_it->hdfs_client == hdfs_client && entry_it->mtime == mtime) {
+            hdfsFile file = entry_it->file;
+            _path_to_entries.erase(it);
+            _entries.erase(entry_it);
+            return file;
+        }
+    }
+    return nullptr;
+}
+
+void HdfsFileHandleCache::put(const std::shared_ptr<HdfsFsClient>& hdfs_client, const std::string& path, int64_t mtime,
+                              hdfsFile file) {
+    std::vector<Entry> evicted;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _entries.push_front(Entry{hdfs_client, path, mtime, file});
+        _path_to_entries.emplace(path, _entries.begin());
+        const auto capacity = static_cast<size_t>(std::max(config::hdfs_client_file_handle_cache_capacity, 0));
+        while (_entries.size() > capacity) {
+            auto entry_it = std::prev(_entries.end());
+            auto [begin, end] = _path_to_entries.equal_range(entry_it->path);
+            for (auto it = begin; it != end; ++it) {
+                if (it->second == entry_it) {
+                    _path_to_entries.erase(it);
+                    break;
+                }
+            }
+            evicted.emplace_back(std::move(*entry_it));
+            _entries.erase(entry_it);
+        }
+    }
+    // close the handles outside the lock, as it talks to the DataNodes
+    for (const auto& entry : evicted) {
+        close(entry);
+    }
+}
+
 } // namespace starrocks
@@ -17,6 +17,7 @@
 #include <hdfs/hdfs.h>
 
 #include <atomic>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -65,4 +66,45 @@ private:
     const HdfsFsCache& operator=(const HdfsFsCache&) = delete;
 };
 
+// Cache for the read-only handles of HDFS files. A handle is taken out of the cache while it is used, so it is never
+// shared, and it is keyed by the modification time of the file, so a rewritten file is not read through a handle of
+// the old one. Beyond the capacity, the handles returned least recently are closed.
+class HdfsFileHandleCache {
+public:
+    // The handles still cached at exit are released with the process, as the JVM may be gone by then.
+    ~HdfsFileHandleCache() = default;
+    static HdfsFileHandleCache* instance() {
+        static HdfsFileHandleCache s_instance;
+        return &s_instance;
+    }
+
+    // Take a handle of |path| opened by |hdfs_client|, or return nullptr if there is none.
+    // This function is thread-safe
+    hdfsFile take(const std::shared_ptr<HdfsFsClient>& hdfs_client, const std::string& path, int64_t mtime);
+
+    // Give back a handle taken from the cache or opened by the caller.
+    // This function is thread-safe
+    void put(const std::shared_ptr<HdfsFsClient>& hdfs_client, const std::string& path, int64_t mtime,
+             hdfsFile file);
+
+private:
+    struct Entry {
+        std::shared_ptr<HdfsFsClient> hdfs_client;
+        std::string path;
+        int64_t mtime;
+        hdfsFile file;
+    };
+
+    static void close(const Entry& entry);
+
+    std::mutex _lock;
+    // the handles returned most recently are at the front
+    std::list<Entry> _entries;
+    std::unordered_multimap<std::string, std::list<Entry>::iterator> _path_to_entries;
+
+    HdfsFileHandleCache() = default;
+    HdfsFileHandleCache(const HdfsFileHandleCache&) = delete;
+    const HdfsFileHandleCache& operator=(const HdfsFileHandleCache&) = delete;
+};
+
 } // namespace starrocks
@@ -22,6 +22,7 @@
 #include <string>
 
 #include "block_cache/block_cache.h"
+#include "block_cache/datacache_policy.h"
 #include "http/http_channel.h"
 #include "http/http_headers.h"
 #include "http/http_request.h"
@@ -32,6 +33,7 @@ namespace starrocks {
 const static std::string HEADER_JSON = "application/json";
 const static std::string ACTION_KEY = "action";
 const static std::string ACTION_STAT = "stat";
+const static std::string ACTION_COLUMN_STAT = "column_stat";
 const static std::string ACTION_INVALIDATE_ALL = "invalidate_all";
 
 std::string cache_status_str(const DataCacheStatus& status) {
@@ -58,7 +60,7 @@ bool DataCacheAction::_check_request(HttpRequest* req) {
         HttpChannel::send_reply(req, HttpStatus::METHOD_NOT_ALLOWED, "Method Not Allowed");
         return false;
     }
-    if (req->param(ACTION_KEY) != ACTION_STAT) {
+    if (req->param(ACTION_KEY) != ACTION_STAT && req->param(ACTION_KEY) != ACTION_COLUMN_STAT) {
         HttpChannel::send_reply(req, HttpStatus::NOT_FOUND, "Not Found");
         return false;
     }
@@ -73,6 +75,8 @@ void DataCacheAction::handle(HttpRequest* req) {
     auto block_cache = _exec_env->block_cache();
     if (!block_cache || !block_cache->is_initialized()) {
         _handle_error(req, strings::Substitute("Cache system is not ready"));
+    } else if (req->param(ACTION_KEY) == ACTION_COLUMN_STAT) {
+        _handle_column_stat(req);
     } else if (block_cache->engine_type() != DataCacheEngineType::STARCACHE) {
         _handle_error(req, strings::Substitute("No more metrics for current cache engine type"));
     } else {
@@ -173,6 +177,29 @@ void DataCacheAction::_handle_stat(HttpRequest* req, BlockCache* cache) {
     });
 }
 
+void DataCacheAction::_handle_column_stat(HttpRequest* req) {
+    _handle(req, [](rapidjson::Document& root) {
+        auto& allocator = root.GetAllocator();
+        rapidjson::Value columns(rapidjson::kArrayType);
+        for (const auto& [name, stats] : DataCachePolicy::instance()->tag_stats()) {
+            rapidjson::Value column(rapidjson::kObjectType);
+            column.AddMember("name", rapidjson::Value(name.c_str(), name.size(), allocator), allocator);
+            column.AddMember("hit_count", rapidjson::Value(stats.hit_count), allocator);
+            column.AddMember("miss_count", rapidjson::Value(stats.miss_count), allocator);
+            const int64_t total_reads = stats.hit_count + stats.miss_count;
+            auto hit_rate = total_reads == 0
+                                    ? 0.0
+                                    : std::round(double(stats.hit_count) / double(total_reads) * 100.0) / 100.0;
+            column.AddMember("hit_rate", rapidjson::Value(hit_rate), allocator);
+            column.AddMember("write_count", rapidjson::Value(stats.write_count), allocator);
+            column.AddMember("write_bytes", rapidjson::Value(stats.write_bytes), allocator);
+            column.AddMember("reject_count", rapidjson::Value(stats.reject_count), allocator);
+            columns.PushBack(column, allocator);
+        }
+        root.AddMember("columns", columns, allocator);
+    });
+}
+
 void DataCacheAction::_handle_error(HttpRequest* req, const std::string& err_msg) {
     _handle(req, [err_msg](rapidjson::Document& root) {
         auto& allocator = root.GetAllocator();
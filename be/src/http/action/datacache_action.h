@@ -40,6 +40,8 @@ private:
     bool _check_request(HttpRequest* req);
     void _handle(HttpRequest* req, const std::function<void(rapidjson::Document& root)>& func);
     void _handle_stat(HttpRequest* req, BlockCache* cache);
+    // Reports the statistics of each table and column tagged in the cache, see DataCachePolicy.
+    void _handle_column_stat(HttpRequest* req);
     void _handle_error(HttpRequest* req, const std::string& error_msg);
 
     ExecEnv* _exec_env;
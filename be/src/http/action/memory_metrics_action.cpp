@@ -24,6 +24,7 @@
 #include "http/http_channel.h"
 #include "http/http_headers.h"
 #include "http/http_request.h"
+#include "runtime/memory/jemalloc_arenas.h"
 
 namespace starrocks {
 
@@ -68,6 +69,10 @@ void MemoryMetricsAction::handle(HttpRequest* req) {
     result << ",";
     getMemoryMetricTree(GlobalEnv::GetInstance()->update_mem_tracker(), result, process_mem_tracker->consumption(),
                         metric_labels_to_print);
+    if (JemallocArenas::instance()->enabled()) {
+        result << ",";
+        getJemallocArenaMetrics(result, process_mem_tracker->consumption());
+    }
     result << "]";
     req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain; version=0.0.4");
     LOG(INFO) << "End collect memory metrics. " << result.str();
@@ -96,4 +101,37 @@ void MemoryMetricsAction::getMemoryMetricTree(MemTracker* memTracker, std::strin
     result << "]}";
 }
 
+// The active, dirty and muzzy bytes of the jemalloc arenas of each memory class.
+void MemoryMetricsAction::getJemallocArenaMetrics(std::stringstream& result, int64_t total_size) {
+    auto* arenas = JemallocArenas::instance();
+    JemallocArenas::refresh_stats();
+    std::vector<JemallocArenas::Stats> stats;
+    int64_t total_active = 0;
+    for (size_t i = 0; i < JemallocArenas::kNumClasses; i++) {
+        stats.emplace_back(arenas->stats(static_cast<MemoryClass>(i)));
+        total_active += stats.back().active_bytes;
+    }
+    result << "{";
+    result << R"("name":"jemalloc_arenas",)";
+    result << R"("size":")" << total_active << "\",";
+    result << R"("percent":")" << std::setprecision(3) << static_cast<double>(total_active) / total_size * 100
+           << "%\",";
+    result << "\"child\":[";
+    for (size_t i = 0; i < stats.size(); i++) {
+        if (i > 0) {
+            result << ",";
+        }
+        result << "{";
+        result << R"("name":")" << JemallocArenas::name(static_cast<MemoryClass>(i)) << "\",";
+        result << R"("size":")" << stats[i].active_bytes << "\",";
+        result << R"("percent":")" << std::setprecision(3)
+               << static_cast<double>(stats[i].active_bytes) / total_size * 100 << "%\",";
+        result << R"("dirty":")" << stats[i].dirty_bytes << "\",";
+        result << R"("muzzy":")" << stats[i].muzzy_bytes << "\",";
+        result << R"("mapped":")" << stats[i].mapped_bytes << "\"";
+        result << "}";
+    }
+    result << "]}";
+}
+
 } // namespace starrocks
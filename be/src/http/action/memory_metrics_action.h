@@ -56,6 +56,8 @@ public:
 private:
     void getMemoryMetricTree(MemTracker* memTracker, std::stringstream& result, int64_t total_size,
                              std::vector<std::string> metric_labels_to_print);
+
+    void getJemallocArenaMetrics(std::stringstream& result, int64_t total_size);
 };
 
 } // namespace starrocks
@@ -0,0 +1,39 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "http/action/pk_index_warmup_action.h"
+
+#include <string>
+
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "storage/primary_index_warmer.h"
+#include "storage/storage_engine.h"
+#include "storage/update_manager.h"
+
+namespace starrocks {
+
+void PkIndexWarmupAction::handle(HttpRequest* req) {
+    auto* warmer = StorageEngine::instance()->update_manager()->get_primary_index_warmer();
+    if (warmer == nullptr) {
+        HttpChannel::send_reply(req, HttpStatus::SERVICE_UNAVAILABLE, "pk index warmer is not initialized");
+        return;
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+    HttpChannel::send_reply(req, HttpStatus::OK, warmer->progress_json());
+}
+
+} // end namespace starrocks
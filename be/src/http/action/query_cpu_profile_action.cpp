@@ -0,0 +1,98 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "http/action/query_cpu_profile_action.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
+#include <string>
+
+#include "common/config.h"
+#include "exec/pipeline/query_cpu_sampler.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+const static std::string HEADER_JSON = "application/json";
+
+void QueryCpuProfileAction::handle(HttpRequest* req) {
+    int minutes = 5;
+    const std::string& minutes_str = req->param("minutes");
+    if (!minutes_str.empty()) {
+        minutes = std::max(1, std::atoi(minutes_str.c_str()));
+    }
+    int topn = 10;
+    const std::string& topn_str = req->param("topn");
+    if (!topn_str.empty()) {
+        topn = std::max(1, std::atoi(topn_str.c_str()));
+    }
+
+    auto queries = pipeline::QueryCpuSampler::instance()->top_queries(minutes, topn);
+
+    if (req->param("format") == "folded") {
+        std::string folded;
+        for (const auto& query : queries) {
+            const std::string query_id = print_id(query.query_id);
+            for (const auto& op : query.operators) {
+                folded.append(query_id)
+                        .append(";")
+                        .append(op.name)
+                        .append("_(")
+                        .append(std::to_string(op.plan_node_id))
+                        .append(") ")
+                        .append(std::to_string(op.samples))
+                        .append("\n");
+            }
+        }
+        HttpChannel::send_reply(req, folded);
+        return;
+    }
+
+    rapidjson::Document root;
+    root.SetObject();
+    auto& allocator = root.GetAllocator();
+    root.AddMember("interval_ms", rapidjson::Value(config::query_cpu_sampler_interval_ms), allocator);
+    rapidjson::Value queries_obj(rapidjson::kArrayType);
+    for (const auto& query : queries) {
+        rapidjson::Value operators_obj(rapidjson::kArrayType);
+        for (const auto& op : query.operators) {
+            rapidjson::Value op_obj(rapidjson::kObjectType);
+            op_obj.AddMember("plan_node_id", rapidjson::Value(op.plan_node_id), allocator);
+            op_obj.AddMember("name", rapidjson::Value(op.name.c_str(), allocator), allocator);
+            op_obj.AddMember("samples", rapidjson::Value(op.samples), allocator);
+            operators_obj.PushBack(op_obj, allocator);
+        }
+        rapidjson::Value query_obj(rapidjson::kObjectType);
+        query_obj.AddMember("query_id", rapidjson::Value(print_id(query.query_id).c_str(), allocator), allocator);
+        query_obj.AddMember("samples", rapidjson::Value(query.samples), allocator);
+        query_obj.AddMember("operators", operators_obj, allocator);
+        queries_obj.PushBack(query_obj, allocator);
+    }
+    root.AddMember("queries", queries_obj, allocator);
+
+    rapidjson::StringBuffer strbuf;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
+    root.Accept(writer);
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, strbuf.GetString());
+}
+
+} // namespace starrocks
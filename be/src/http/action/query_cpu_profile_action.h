@@ -0,0 +1,43 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+// Shows the queries which took the most cpu time of the pipeline engine in the last minutes, and their operators,
+// sampled by pipeline::QueryCpuSampler.
+//
+// GET /api/query_cpu_profile?minutes=5&topn=10 returns:
+// {
+//      "interval_ms": 10,
+//      "queries": [{
+//          "query_id": "str",
+//          "samples": 123,
+//          "operators": [{"plan_node_id": 1, "name": "hash_join_probe", "samples": 100}]
+//      }]
+// }
+// With format=folded, the samples are returned as "query_id;name_(plan_node_id) samples" lines, the input of
+// flamegraph.pl.
+class QueryCpuProfileAction : public HttpHandler {
+public:
+    QueryCpuProfileAction() = default;
+    ~QueryCpuProfileAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace starrocks
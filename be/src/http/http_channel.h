@@ -45,7 +45,8 @@ public:
 
     static void send_reply(HttpRequest* request, HttpStatus status, std::string_view content);
 
-    static void send_file(HttpRequest* request, int fd, size_t off, size_t size);
+    static void send_file(HttpRequest* request, int fd, size_t off, size_t size,
+                          HttpStatus status = HttpStatus::OK);
 };
 
 } // namespace starrocks
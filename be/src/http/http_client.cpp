@@ -176,7 +176,7 @@ Status HttpClient::execute(const std::function<bool(const void* data, size_t len
     return Status::OK();
 }
 
-StatusOr<uint64_t> HttpClient::download(const std::string& local_path) {
+StatusOr<uint64_t> HttpClient::download(const std::string& local_path, bool resume) {
     // set method to GET
     set_method(GET);
 
@@ -184,10 +184,16 @@ StatusOr<uint64_t> HttpClient::download(const std::string& local_path) {
     // at system level
     curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_LIMIT, config::download_low_speed_limit_kbps * 1024);
     curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_TIME, config::download_low_speed_time);
-    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE, config::max_download_speed_kbps * 1024);
+    int64_t max_speed_kbps = _max_download_speed_kbps > 0 ? _max_download_speed_kbps : config::max_download_speed_kbps;
+    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE, (curl_off_t)max_speed_kbps * 1024);
 
-    WritableFileOptions opts{.sync_on_close = true, .mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
+    WritableFileOptions opts{.sync_on_close = true, .mode = resume ? FileSystem::CREATE_OR_OPEN
+                                                                    : FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
     ASSIGN_OR_RETURN(auto output_file, fs::new_writable_file(opts, local_path));
+    if (output_file->size() > 0) {
+        // curl fails the transfer if the server does not answer the range
+        curl_easy_setopt(_curl, CURLOPT_RESUME_FROM_LARGE, (curl_off_t)output_file->size());
+    }
 
     Status status;
     auto callback = [&status, &output_file, &local_path](const void* data, size_t length) {
@@ -212,7 +218,8 @@ Status HttpClient::download(const std::function<Status(const void* data, size_t
     // at system level
     curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_LIMIT, config::download_low_speed_limit_kbps * 1024);
     curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_TIME, config::download_low_speed_time);
-    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE, config::max_download_speed_kbps * 1024);
+    int64_t max_speed_kbps = _max_download_speed_kbps > 0 ? _max_download_speed_kbps : config::max_download_speed_kbps;
+    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE, (curl_off_t)max_speed_kbps * 1024);
 
     Status status;
     auto download_cb = [&callback, &status](const void* data, size_t length) {
@@ -109,9 +109,13 @@ public:
         return execute();
     }
 
+    // Caps the receive speed of the downloads of this client, config::max_download_speed_kbps by default.
+    void set_max_download_speed_kbps(int64_t kbps) { _max_download_speed_kbps = kbps; }
+
     // helper function to download a file, you can call this function to downlaod
-    // a file to local_path
-    StatusOr<uint64_t> download(const std::string& local_path);
+    // a file to local_path. With `resume`, the bytes already in local_path are kept and only the rest of the
+    // file is requested, the server must support ranges then. Returns the size of local_path.
+    StatusOr<uint64_t> download(const std::string& local_path, bool resume = false);
 
     Status download(const std::function<Status(const void* data, size_t length)>& callback);
 
@@ -136,6 +140,7 @@ private:
     const HttpCallback* _callback = nullptr;
     char _error_buf[CURL_ERROR_SIZE];
     curl_slist* _header_list = nullptr;
+    int64_t _max_download_speed_kbps = -1;
 };
 
 } // namespace starrocks
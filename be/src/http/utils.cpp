@@ -35,8 +35,11 @@
 #include "http/utils.h"
 
 #include <fcntl.h>
+#include <fmt/format.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+
 #include "common/logging.h"
 #include "common/status.h"
 #include "common/utils.h"
@@ -45,6 +48,7 @@
 #include "http/http_headers.h"
 #include "http/http_request.h"
 #include "util/path_util.h"
+#include "util/string_parser.hpp"
 #include "util/url_coding.h"
 
 namespace starrocks {
@@ -101,6 +105,32 @@ bool parse_basic_auth(const HttpRequest& req, AuthInfo* auth) {
     return true;
 }
 
+bool parse_byte_range(const std::string& range_header, int64_t* first, int64_t* last) {
+    static const std::string kPrefix = "bytes=";
+    if (range_header.compare(0, kPrefix.size(), kPrefix) != 0) {
+        return false;
+    }
+    const std::string spec = range_header.substr(kPrefix.size());
+    const size_t dash = spec.find('-');
+    if (dash == 0 || dash == std::string::npos || spec.find(',') != std::string::npos) {
+        return false;
+    }
+    StringParser::ParseResult result;
+    int64_t value = StringParser::string_to_int<int64_t>(spec.data(), dash, &result);
+    if (result != StringParser::PARSE_SUCCESS || value < 0) {
+        return false;
+    }
+    *first = value;
+    if (dash + 1 < spec.size()) {
+        value = StringParser::string_to_int<int64_t>(spec.data() + dash + 1, spec.size() - dash - 1, &result);
+        if (result != StringParser::PARSE_SUCCESS || value < 0) {
+            return false;
+        }
+        *last = value;
+    }
+    return true;
+}
+
 // Do a simple decision, only deal a few type
 std::string get_content_type(const std::string& file_name) {
     std::string file_ext = path_util::file_extension(file_name);
@@ -148,13 +178,24 @@ void do_file_response(const std::string& file_path, HttpRequest* req) {
     int64_t file_size = st.st_size;
 
     // TODO(lingbin): process "IF_MODIFIED_SINCE" header
-    // TODO(lingbin): process "RANGE" header
+    // Only a single "bytes=<first>-[<last>]" range is served, any other range header gets the whole file.
+    int64_t first = 0;
+    int64_t last = file_size - 1;
+    bool partial = false;
     const std::string& range_header = req->header(HttpHeaders::RANGE);
-    if (!range_header.empty()) {
-        // analyse range header
+    if (!range_header.empty() && parse_byte_range(range_header, &first, &last)) {
+        if (first >= file_size || first > last) {
+            close(fd);
+            req->add_output_header(HttpHeaders::CONTENT_RANGE, fmt::format("bytes */{}", file_size).c_str());
+            HttpChannel::send_error(req, HttpStatus::REQUESTED_RANGE_NOT_SATISFIED);
+            return;
+        }
+        last = std::min(last, file_size - 1);
+        partial = true;
     }
 
     req->add_output_header(HttpHeaders::CONTENT_TYPE, get_content_type(file_path).c_str());
+    req->add_output_header(HttpHeaders::ACCEPT_RANGES, "bytes");
 
     if (req->method() == HttpMethod::HEAD) {
         close(fd);
@@ -163,7 +204,13 @@ void do_file_response(const std::string& file_path, HttpRequest* req) {
         return;
     }
 
-    HttpChannel::send_file(req, fd, 0, file_size);
+    if (partial) {
+        req->add_output_header(HttpHeaders::CONTENT_RANGE,
+                               fmt::format("bytes {}-{}/{}", first, last, file_size).c_str());
+        HttpChannel::send_file(req, fd, first, last - first + 1, HttpStatus::PARTIAL_CONTENT);
+    } else {
+        HttpChannel::send_file(req, fd, 0, file_size);
+    }
 }
 
 void do_dir_response(const std::string& dir_path, HttpRequest* req) {
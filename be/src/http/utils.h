@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include "common/utils.h"
@@ -35,6 +36,10 @@ bool parse_basic_auth(const HttpRequest& req, std::string* user, std::string* pa
 
 bool parse_basic_auth(const HttpRequest& req, AuthInfo* auth);
 
+// Parses a "bytes=<first>-[<last>]" range header, `last` is left untouched if it is omitted.
+// Returns false for any other form, including suffix and multiple ranges.
+bool parse_byte_range(const std::string& range_header, int64_t* first, int64_t* last);
+
 void do_file_response(const std::string& dir_path, HttpRequest* req);
 
 void do_dir_response(const std::string& dir_path, HttpRequest* req);
@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "gutil/strings/fastmem.h"
+#include "io/io_profiler.h"
 #include "util/hash_util.hpp"
 #include "util/runtime_profile.h"
 #include "util/stack_util.h"
@@ -87,6 +88,39 @@ CacheInputStream::~CacheInputStream() {
     }
 }
 
+void CacheInputStream::enable_prefetch(ThreadPool* pool, CachePrefetcher::StreamOpener opener,
+                                       std::atomic<int64_t>* query_prefetch_bytes) {
+    _prefetcher = std::make_unique<CachePrefetcher>(_cache, _cache_key, _size, pool, std::move(opener),
+                                                    query_prefetch_bytes);
+}
+
+const CacheInputStream::Stats& CacheInputStream::stats() {
+    if (_prefetcher != nullptr) {
+        _stats.prefetch_count = _prefetcher->prefetch_count();
+        _stats.prefetch_bytes = _prefetcher->prefetch_bytes();
+        _stats.prefetch_hit_count = _prefetcher->hit_count();
+        _stats.prefetch_waste_count = _prefetcher->waste_count();
+    }
+    return _stats;
+}
+
+void CacheInputStream::_notify_prefetcher(int64_t offset, int64_t count, bool read_remote) {
+    if (_prefetcher == nullptr) {
+        return;
+    }
+    _prefetcher->on_read(offset, count, read_remote, [this](int64_t block_offset, int64_t size) {
+        return _sb_stream->find_shared_buffer(block_offset, std::min(size, _size - block_offset)).ok();
+    });
+}
+
+const DataCacheTag* CacheInputStream::_tag_of(int64_t offset) {
+    if (_tag.table.empty()) {
+        return nullptr;
+    }
+    _tag.column.assign(_sb_stream->column_of(offset));
+    return &_tag;
+}
+
 Status CacheInputStream::_read_block_from_local(const int64_t offset, const int64_t size, char* out) {
     if (UNLIKELY(size == 0)) {
         return Status::OK();
@@ -133,6 +167,7 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
     size_t read_size = 0;
     {
         options.use_adaptor = _enable_cache_io_adaptor;
+        options.tag = _tag_of(block_offset);
         SCOPED_RAW_TIMER(&read_cache_ns);
         if (_enable_block_buffer) {
             res = _cache->read_buffer(_cache_key, block_offset, load_size, &block.buffer, &options);
@@ -154,9 +189,13 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
         _stats.read_mem_cache_bytes += options.stats.read_mem_bytes;
         _stats.read_disk_cache_bytes += options.stats.read_disk_bytes;
         _stats.read_cache_ns += read_cache_ns;
+        IOProfiler::add_read_of_source(IOProfiler::READ_CACHE, read_size, read_cache_ns);
         if (_enable_cache_io_adaptor) {
             _cache->record_read_cache(read_size, read_cache_ns / 1000);
         }
+        if (_prefetcher != nullptr) {
+            _prefetcher->on_cache_hit(block_id);
+        }
         return Status::OK();
     } else if (res.is_resource_busy()) {
         _stats.skip_read_cache_count += 1;
@@ -236,6 +275,7 @@ Status CacheInputStream::_populate_to_cache(const int64_t offset, const int64_t
         DCHECK(write_offset_cursor % _block_size == 0);
         WriteCacheOptions options{};
         options.async = _enable_async_populate_mode;
+        options.tag = _tag_of(write_offset_cursor);
         const int64_t write_size = std::min(_block_size, write_end_offset - write_offset_cursor);
 
         SharedBufferPtr sb = nullptr;
@@ -342,6 +382,7 @@ Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count)
     }
     DCHECK(p == pe);
 
+    _notify_prefetcher(origin_offset, count, !need_read_from_remote.empty());
     if (need_read_from_remote.size() == 0) {
         return Status::OK();
     }
@@ -431,6 +472,7 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
         SCOPED_RAW_TIMER(&_stats.write_cache_ns);
         WriteCacheOptions options;
         options.async = _enable_async_populate_mode;
+        options.tag = _tag_of(offset);
         if (options.async) {
             auto cb = [sb](int code, const std::string& msg) {
                 // We only need to keep the shared buffer pointer
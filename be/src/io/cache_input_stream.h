@@ -19,6 +19,7 @@
 
 #include "block_cache/block_cache.h"
 #include "block_cache/io_buffer.h"
+#include "io/cache_prefetcher.h"
 #include "io/shared_buffered_input_stream.h"
 
 namespace starrocks::io {
@@ -44,6 +45,10 @@ public:
         int64_t write_cache_fail_bytes = 0;
         int64_t read_block_buffer_bytes = 0;
         int64_t read_block_buffer_count = 0;
+        int64_t prefetch_count = 0;
+        int64_t prefetch_bytes = 0;
+        int64_t prefetch_hit_count = 0;
+        int64_t prefetch_waste_count = 0;
     };
 
     explicit CacheInputStream(const std::shared_ptr<SharedBufferedInputStream>& stream, const std::string& filename,
@@ -55,13 +60,20 @@ public:
 
     Status read_at_fully(int64_t offset, void* data, int64_t count) override;
 
+    // The ranges are read through the cache one after another.
+    Status read_at_fully_batch(const std::vector<ReadRange>& ranges) override {
+        return SeekableInputStream::read_at_fully_batch(ranges);
+    }
+
+    bool support_batch_read() const override { return false; }
+
     Status seek(int64_t offset) override;
 
     StatusOr<int64_t> position() override;
 
     StatusOr<int64_t> get_size() override;
 
-    const Stats& stats() { return _stats; }
+    const Stats& stats();
 
     void set_enable_populate_cache(bool v) { _enable_populate_cache = v; }
 
@@ -71,6 +83,14 @@ public:
 
     void set_enable_cache_io_adaptor(bool v) { _enable_cache_io_adaptor = v; }
 
+    // Prefetches the next blocks into the cache in the background on sequential reads, see CachePrefetcher.
+    void enable_prefetch(ThreadPool* pool, CachePrefetcher::StreamOpener opener,
+                         std::atomic<int64_t>* query_prefetch_bytes);
+
+    // Tags the blocks with the table, and the columns of the io ranges of `_sb_stream` containing them, by which
+    // the datacache policies are applied, see DataCachePolicy.
+    void set_cache_tag_table(std::string table) { _tag.table = std::move(table); }
+
     int64_t get_align_size() const;
 
     StatusOr<std::string_view> peek(int64_t count) override;
@@ -94,6 +114,9 @@ private:
     Status _populate_to_cache(const int64_t offset, const int64_t size, char* src);
     void _populate_cache_from_zero_copy_buffer(const char* p, int64_t offset, int64_t count, const SharedBufferPtr& sb);
     void _deduplicate_shared_buffer(const SharedBufferPtr& sb);
+    void _notify_prefetcher(int64_t offset, int64_t count, bool read_remote);
+    // Returns the tag of the block at `offset`, or nullptr if the blocks are not tagged.
+    const DataCacheTag* _tag_of(int64_t offset);
 
     std::string _cache_key;
     std::string _filename;
@@ -110,6 +133,8 @@ private:
     BlockCache* _cache = nullptr;
     int64_t _block_size = 0;
     std::unordered_map<int64_t, BlockBuffer> _block_map;
+    std::unique_ptr<CachePrefetcher> _prefetcher;
+    DataCacheTag _tag;
 };
 
 } // namespace starrocks::io
@@ -0,0 +1,148 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/cache_prefetcher.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "block_cache/block_cache.h"
+#include "common/config.h"
+#include "common/logging.h"
+#include "util/raw_container.h"
+#include "util/threadpool.h"
+
+namespace starrocks::io {
+
+CachePrefetcher::CachePrefetcher(BlockCache* cache, std::string cache_key, int64_t file_size, ThreadPool* pool,
+                                 StreamOpener opener, std::atomic<int64_t>* query_prefetch_bytes)
+        : _cache(cache),
+          _cache_key(std::move(cache_key)),
+          _file_size(file_size),
+          _block_size(cache->block_size()),
+          _opener(std::move(opener)),
+          _token(pool->new_token(ThreadPool::ExecutionMode::SERIAL)),
+          _query_prefetch_bytes(query_prefetch_bytes) {}
+
+CachePrefetcher::~CachePrefetcher() {
+    // Wait for the running prefetching and drop the queued ones, whose bytes are not released by themselves.
+    _token->shutdown();
+    _query_prefetch_bytes->fetch_sub(_pending_bytes);
+}
+
+void CachePrefetcher::on_read(int64_t offset, int64_t count, bool read_remote, const SkipFunc& skip) {
+    if (_last_read_end >= 0 && offset >= _last_read_end && offset - _last_read_end <= _block_size) {
+        _sequential_reads++;
+    } else {
+        _sequential_reads = 0;
+    }
+    _last_read_end = offset + count;
+    _started |= read_remote;
+    if (!_started || _sequential_reads < config::datacache_prefetch_sequential_reads || count <= 0) {
+        return;
+    }
+
+    const int64_t num_blocks = (_file_size + _block_size - 1) / _block_size;
+    const int64_t end_block = std::min((offset + count - 1) / _block_size + config::datacache_prefetch_blocks,
+                                       num_blocks - 1);
+    int64_t block = std::max(_next_block, (offset + count - 1) / _block_size + 1);
+    while (block <= end_block) {
+        // The blocks in the shared buffers are read by the reader anyway.
+        while (block <= end_block && skip(block * _block_size, _block_size)) {
+            block++;
+        }
+        int64_t first = block;
+        int64_t bytes = 0;
+        while (block <= end_block && !skip(block * _block_size, _block_size)) {
+            bytes += std::min(_block_size, _file_size - block * _block_size);
+            block++;
+        }
+        if (first == block) {
+            break;
+        }
+        if (_query_prefetch_bytes->fetch_add(bytes) + bytes > config::datacache_prefetch_max_bytes_per_query) {
+            _query_prefetch_bytes->fetch_sub(bytes);
+            return;
+        }
+        _pending_bytes += bytes;
+        auto st = _token->submit_func([this, first, num = block - first, bytes]() { _prefetch(first, num, bytes); });
+        if (!st.ok()) {
+            _pending_bytes -= bytes;
+            _query_prefetch_bytes->fetch_sub(bytes);
+            return;
+        }
+        _next_block = block;
+    }
+    _next_block = std::max(_next_block, end_block + 1);
+}
+
+void CachePrefetcher::_prefetch(int64_t first_block, int64_t num_blocks, int64_t bytes) {
+    if (_stream == nullptr && !_open_failed) {
+        auto res = _opener();
+        if (res.ok()) {
+            _stream = std::move(res).value();
+        } else {
+            LOG(WARNING) << "Failed to open the file to prefetch into datacache: " << res.status();
+            _open_failed = true;
+        }
+    }
+    if (_stream != nullptr) {
+        std::string data;
+        raw::stl_string_resize_uninitialized(&data, bytes);
+        std::vector<ReadRange> ranges;
+        for (int64_t i = 0, pos = 0; i < num_blocks; i++) {
+            const int64_t offset = (first_block + i) * _block_size;
+            const int64_t size = std::min(_block_size, _file_size - offset);
+            ranges.push_back(ReadRange{.offset = offset, .count = size, .data = data.data() + pos});
+            pos += size;
+        }
+        if (auto st = _stream->read_at_fully_batch(ranges); !st.ok()) {
+            LOG(WARNING) << "Failed to prefetch into datacache: " << st;
+            _failed_count += num_blocks;
+        } else {
+            for (int64_t i = 0; i < num_blocks; i++) {
+                const auto& range = ranges[i];
+                // Fails if the block exists in the cache, e.g. written by other readers of the file.
+                auto st = _cache->write_buffer(_cache_key, range.offset, range.count,
+                                               static_cast<const char*>(range.data));
+                if (!st.ok()) {
+                    _failed_count++;
+                    continue;
+                }
+                std::lock_guard l(_mutex);
+                _prefetched_blocks.insert(first_block + i);
+                _prefetch_count++;
+                _prefetch_bytes += range.count;
+            }
+        }
+    } else {
+        _failed_count += num_blocks;
+    }
+    _pending_bytes -= bytes;
+    _query_prefetch_bytes->fetch_sub(bytes);
+}
+
+void CachePrefetcher::on_cache_hit(int64_t block_id) {
+    std::lock_guard l(_mutex);
+    if (_prefetched_blocks.erase(block_id) > 0) {
+        _hit_count++;
+    }
+}
+
+int64_t CachePrefetcher::waste_count() const {
+    std::lock_guard l(_mutex);
+    return _failed_count + _prefetched_blocks.size();
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,103 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "common/statusor.h"
+#include "io/seekable_input_stream.h"
+
+namespace starrocks {
+class BlockCache;
+class ThreadPool;
+class ThreadPoolToken;
+} // namespace starrocks
+
+namespace starrocks::io {
+
+// CachePrefetcher populates the next blocks of a remote file into the BlockCache in the background when the file
+// is read sequentially by a CacheInputStream, so that a sequential scan of a cold file does not wait for the remote
+// storage at every block boundary.
+//
+// The access is sequential after `config::datacache_prefetch_sequential_reads` reads each starting at most one block
+// after the end of the previous one, and the prefetching is started by a read missing the cache. Then the blocks
+// up to `config::datacache_prefetch_blocks` after the end of each read are prefetched, one run of blocks at a time
+// by a serial token of `pool`, through a stream of the file opened by `opener` on the first prefetching. The bytes
+// being prefetched by all the files of a query are bounded by `config::datacache_prefetch_max_bytes_per_query`,
+// by `query_prefetch_bytes` shared by them.
+class CachePrefetcher {
+public:
+    using StreamOpener = std::function<StatusOr<std::shared_ptr<SeekableInputStream>>()>;
+    // Returns whether the range is being read by other means, e.g. the shared buffers of the reader.
+    using SkipFunc = std::function<bool(int64_t offset, int64_t size)>;
+
+    CachePrefetcher(BlockCache* cache, std::string cache_key, int64_t file_size, ThreadPool* pool,
+                    StreamOpener opener, std::atomic<int64_t>* query_prefetch_bytes);
+    ~CachePrefetcher();
+
+    CachePrefetcher(const CachePrefetcher&) = delete;
+    void operator=(const CachePrefetcher&) = delete;
+
+    // Called by the reader for each read, with whether it has read from the remote storage.
+    void on_read(int64_t offset, int64_t count, bool read_remote, const SkipFunc& skip);
+
+    // Called by the reader for each block read from the cache.
+    void on_cache_hit(int64_t block_id);
+
+    // The blocks written into the cache by the prefetching.
+    int64_t prefetch_count() const { return _prefetch_count; }
+    int64_t prefetch_bytes() const { return _prefetch_bytes; }
+    // The prefetched blocks read by the reader.
+    int64_t hit_count() const { return _hit_count; }
+    // The prefetched blocks failed to be written or not read by the reader so far.
+    int64_t waste_count() const;
+
+private:
+    void _prefetch(int64_t first_block, int64_t num_blocks, int64_t bytes);
+
+    BlockCache* _cache;
+    const std::string _cache_key;
+    const int64_t _file_size;
+    const int64_t _block_size;
+    StreamOpener _opener;
+    std::shared_ptr<SeekableInputStream> _stream;
+    bool _open_failed = false;
+    std::unique_ptr<ThreadPoolToken> _token;
+    std::atomic<int64_t>* _query_prefetch_bytes;
+    // The bytes of the blocks submitted but not prefetched yet.
+    std::atomic<int64_t> _pending_bytes{0};
+
+    // Accessed by the reader only.
+    int64_t _last_read_end = -1;
+    int64_t _sequential_reads = 0;
+    bool _started = false;
+    // The next block to prefetch.
+    int64_t _next_block = 0;
+
+    mutable std::mutex _mutex;
+    // The blocks prefetched and not read by the reader yet.
+    std::unordered_set<int64_t> _prefetched_blocks;
+    std::atomic<int64_t> _prefetch_count{0};
+    std::atomic<int64_t> _prefetch_bytes{0};
+    std::atomic<int64_t> _failed_count{0};
+    int64_t _hit_count = 0;
+};
+
+} // namespace starrocks::io
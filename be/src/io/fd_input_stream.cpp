@@ -18,9 +18,12 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #include "common/logging.h"
 #include "gutil/macros.h"
 #include "io/io_error.h"
+#include "io/io_uring_reader.h"
 #include "io_profiler.h"
 #include "util/stopwatch.hpp"
 
@@ -85,7 +88,9 @@ StatusOr<int64_t> FdInputStream::read(void* data, int64_t count) {
     s_posixread_iosize.Observe(res);
 #endif
     _offset += res;
-    IOProfiler::add_read(res, watch.elapsed_time());
+    const int64_t latency = watch.elapsed_time();
+    IOProfiler::add_read(res, latency);
+    IOProfiler::add_read_of_source(IOProfiler::READ_LOCAL_DISK, res, latency);
     return res;
 }
 
@@ -106,5 +111,23 @@ Status FdInputStream::seek(int64_t offset) {
     return Status::OK();
 }
 
+Status FdInputStream::read_at_fully_batch(const std::vector<ReadRange>& ranges) {
+    CHECK_IS_CLOSED(_is_closed);
+    MonotonicStopWatch watch;
+    watch.start();
+    RETURN_IF_ERROR(IoUringReader::read_fully(_fd, ranges.data(), ranges.size()));
+    // The reads are in flight at the same time, so each of them is accounted with its share of the latency.
+    const int64_t latency = watch.elapsed_time() / std::max<size_t>(ranges.size(), 1);
+    for (const auto& range : ranges) {
+        IOProfiler::add_read(range.count, latency);
+        IOProfiler::add_read_of_source(IOProfiler::READ_LOCAL_DISK, range.count, latency);
+    }
+    return Status::OK();
+}
+
+bool FdInputStream::support_batch_read() const {
+    return IoUringReader::available();
+}
+
 #undef CHECK_IS_CLOSED
 } // namespace starrocks::io
@@ -38,6 +38,12 @@ public:
 
     Status seek(int64_t offset) override;
 
+    // Reads the ranges by io_uring if `IoUringReader::available()`, otherwise by pread() one after another.
+    // Unlike `read_at_fully()`, the offset of the stream is not changed.
+    Status read_at_fully_batch(const std::vector<ReadRange>& ranges) override;
+
+    bool support_batch_read() const override;
+
     // closes the underlying file.
     //
     // Returns error if an error occurs during the process;
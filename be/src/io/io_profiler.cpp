@@ -14,11 +14,14 @@
 
 #include "io_profiler.h"
 
+#include <algorithm>
+#include <cmath>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
 
 #include "fmt/format.h"
+#include "util/runtime_profile.h"
 
 namespace starrocks {
 
@@ -316,4 +319,81 @@ std::string IOProfiler::profile_and_get_topn_stats_str(const std::string& mode,
     return ss.str();
 }
 
+static thread_local IOProfiler::ReadHistograms* tls_read_histograms = nullptr;
+
+int IOProfiler::ReadHistograms::_bucket_of(int64_t value) {
+    // the bucket i holds the values in (2^(i-1), 2^i]
+    if (value <= 1) {
+        return 0;
+    }
+    return std::min(kNumBuckets - 1, 64 - __builtin_clzll(static_cast<uint64_t>(value - 1)));
+}
+
+void IOProfiler::ReadHistograms::add(ReadSource source, int64_t bytes, int64_t latency_ns) {
+    auto& histogram = _histograms[source];
+    histogram.count.fetch_add(1, std::memory_order_relaxed);
+    histogram.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    histogram.latency_buckets[_bucket_of(latency_ns)].fetch_add(1, std::memory_order_relaxed);
+    histogram.size_buckets[_bucket_of(bytes)].fetch_add(1, std::memory_order_relaxed);
+}
+
+int64_t IOProfiler::ReadHistograms::_percentile(const Buckets& buckets, int64_t count, double percentile) {
+    if (count == 0) {
+        return 0;
+    }
+    const auto target = std::max<int64_t>(1, static_cast<int64_t>(std::ceil(count * percentile / 100)));
+    int64_t accumulated = 0;
+    for (int i = 0; i < kNumBuckets; i++) {
+        accumulated += buckets[i].load(std::memory_order_relaxed);
+        if (accumulated >= target) {
+            return int64_t(1) << i;
+        }
+    }
+    return int64_t(1) << (kNumBuckets - 1);
+}
+
+int64_t IOProfiler::ReadHistograms::latency_percentile(ReadSource source, double percentile) const {
+    const auto& histogram = _histograms[source];
+    return _percentile(histogram.latency_buckets, histogram.count.load(std::memory_order_relaxed), percentile);
+}
+
+int64_t IOProfiler::ReadHistograms::size_percentile(ReadSource source, double percentile) const {
+    const auto& histogram = _histograms[source];
+    return _percentile(histogram.size_buckets, histogram.count.load(std::memory_order_relaxed), percentile);
+}
+
+void IOProfiler::ReadHistograms::to_profile(RuntimeProfile* profile) const {
+    static const char* const kSourceNames[READ_SOURCE_SIZE] = {"LocalDisk", "Cache", "Remote"};
+    for (int i = 0; i < READ_SOURCE_SIZE; i++) {
+        const auto source = static_cast<ReadSource>(i);
+        if (count(source) == 0) {
+            continue;
+        }
+        const std::string prefix = kSourceNames[i];
+        COUNTER_SET(ADD_COUNTER(profile, prefix + "ReadCount", TUnit::UNIT), count(source));
+        COUNTER_SET(ADD_COUNTER(profile, prefix + "ReadBytes", TUnit::BYTES), bytes(source));
+        // averaged rather than summed when the profiles of the drivers are merged
+        auto* size_p50 = profile->add_counter(prefix + "ReadSizeP50", TUnit::BYTES,
+                                              RuntimeProfile::Counter::create_strategy(TCounterAggregateType::AVG));
+        COUNTER_SET(size_p50, size_percentile(source, 50));
+        COUNTER_SET(ADD_COUNTER(profile, prefix + "ReadLatencyP50", TUnit::TIME_NS), latency_percentile(source, 50));
+        COUNTER_SET(ADD_COUNTER(profile, prefix + "ReadLatencyP90", TUnit::TIME_NS), latency_percentile(source, 90));
+        COUNTER_SET(ADD_COUNTER(profile, prefix + "ReadLatencyP99", TUnit::TIME_NS), latency_percentile(source, 99));
+    }
+}
+
+void IOProfiler::add_read_of_source(ReadSource source, int64_t bytes, int64_t latency_ns) {
+    if (tls_read_histograms != nullptr) {
+        tls_read_histograms->add(source, bytes, latency_ns);
+    }
+}
+
+IOProfiler::ReadHistogramsScope::ReadHistogramsScope(ReadHistograms* histograms) : _old(tls_read_histograms) {
+    tls_read_histograms = histograms;
+}
+
+IOProfiler::ReadHistogramsScope::~ReadHistogramsScope() {
+    tls_read_histograms = _old;
+}
+
 } // namespace starrocks
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 
 #include "common/status.h"
@@ -22,6 +23,7 @@
 namespace starrocks {
 
 class IOStatEntry;
+class RuntimeProfile;
 
 class IOProfiler {
 public:
@@ -123,6 +125,62 @@ public:
 
     static inline void add_sync(int64_t latency_ns) { _add_tls_sync(latency_ns); }
 
+    // Where the data of a read comes from.
+    enum ReadSource {
+        READ_LOCAL_DISK = 0,
+        READ_CACHE,
+        READ_REMOTE,
+        READ_SOURCE_SIZE,
+    };
+
+    // The reads of a scan by their sizes and latencies in power-of-two buckets, for each source, cheap enough to be
+    // always on. The reads may be added by several threads at the same time.
+    class ReadHistograms {
+    public:
+        static constexpr int kNumBuckets = 48;
+
+        void add(ReadSource source, int64_t bytes, int64_t latency_ns);
+
+        int64_t count(ReadSource source) const { return _histograms[source].count.load(std::memory_order_relaxed); }
+        int64_t bytes(ReadSource source) const { return _histograms[source].bytes.load(std::memory_order_relaxed); }
+        // Returns the upper bound of the bucket of the latency which `percentile` percent of the reads are within.
+        int64_t latency_percentile(ReadSource source, double percentile) const;
+        // Returns the upper bound of the bucket of the size which `percentile` percent of the reads are within.
+        int64_t size_percentile(ReadSource source, double percentile) const;
+
+        // Sets the counters of the reads of each source to `profile`, e.g. RemoteReadCount, RemoteReadLatencyP99.
+        void to_profile(RuntimeProfile* profile) const;
+
+    private:
+        using Buckets = std::array<std::atomic<int64_t>, kNumBuckets>;
+        struct Histogram {
+            std::atomic<int64_t> count = 0;
+            std::atomic<int64_t> bytes = 0;
+            Buckets latency_buckets{};
+            Buckets size_buckets{};
+        };
+
+        static int _bucket_of(int64_t value);
+        static int64_t _percentile(const Buckets& buckets, int64_t count, double percentile);
+
+        std::array<Histogram, READ_SOURCE_SIZE> _histograms;
+    };
+
+    // Adds a read to the histograms of the current thread, if any.
+    static void add_read_of_source(ReadSource source, int64_t bytes, int64_t latency_ns);
+
+    // The reads of the current thread are added to `histograms` during the life of the scope.
+    class ReadHistogramsScope {
+    public:
+        explicit ReadHistogramsScope(ReadHistograms* histograms);
+        ~ReadHistogramsScope();
+        ReadHistogramsScope(const ReadHistogramsScope&) = delete;
+        ReadHistogramsScope& operator=(const ReadHistogramsScope&) = delete;
+
+    private:
+        ReadHistograms* _old;
+    };
+
     static StatusOr<std::vector<std::string>> get_topn_read_stats(size_t n);
     static StatusOr<std::vector<std::string>> get_topn_write_stats(size_t n);
     static StatusOr<std::vector<std::string>> get_topn_total_stats(size_t n);
@@ -0,0 +1,344 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/io_uring_reader.h"
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "gutil/macros.h"
+#include "io/io_error.h"
+#include "testutil/sync_point.h"
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#define STARROCKS_HAVE_IO_URING 1
+#endif
+
+namespace starrocks::io {
+
+static Status pread_fully(int fd, const ReadRange& range) {
+    auto* data = static_cast<char*>(range.data);
+    int64_t done = 0;
+    while (done < range.count) {
+        ssize_t res;
+        RETRY_ON_EINTR(res, ::pread(fd, data + done, range.count - done, range.offset + done));
+        if (UNLIKELY(res < 0)) {
+            return io_error("pread", errno);
+        }
+        if (UNLIKELY(res == 0)) {
+            return Status::IOError(fmt::format("reached the end of file at {}", range.offset + done));
+        }
+        done += res;
+    }
+    return Status::OK();
+}
+
+#ifdef STARROCKS_HAVE_IO_URING
+
+namespace {
+
+constexpr unsigned kRingEntries = 64;
+
+// A ring without SQPOLL, whose submission queue is consumed by the kernel only in io_uring_enter().
+class Ring {
+public:
+    Ring() = default;
+    ~Ring();
+
+    Ring(const Ring&) = delete;
+    void operator=(const Ring&) = delete;
+
+    Status init();
+    Status read_fully(int fd, const ReadRange* ranges, size_t num_ranges);
+
+    // Whether io_uring_enter() failed unexpectedly, after which the ring is not used anymore.
+    bool broken() const { return _broken; }
+
+private:
+    void _push_read(int fd, uint64_t index, int64_t offset, const iovec* iov);
+    // Submits the pushed reads and waits for at least one completion.
+    Status _enter();
+    // Marks the ring broken, drops the `inflight` reads not consumed by the kernel yet, and waits for the others
+    // to complete, so that no buffer is written after the ring is abandoned.
+    void _abandon(unsigned inflight);
+
+    bool _broken = false;
+
+    int _ring_fd = -1;
+    void* _sq_ring = nullptr;
+    size_t _sq_ring_size = 0;
+    void* _cq_ring = nullptr;
+    size_t _cq_ring_size = 0;
+    io_uring_sqe* _sqes = nullptr;
+    size_t _sqes_size = 0;
+
+    unsigned _sq_entries = 0;
+    unsigned* _sq_head = nullptr;
+    unsigned* _sq_tail = nullptr;
+    unsigned* _sq_mask = nullptr;
+    unsigned* _sq_array = nullptr;
+    unsigned* _cq_head = nullptr;
+    unsigned* _cq_tail = nullptr;
+    unsigned* _cq_mask = nullptr;
+    io_uring_cqe* _cqes = nullptr;
+};
+
+Ring::~Ring() {
+    if (_sqes != nullptr) {
+        munmap(_sqes, _sqes_size);
+    }
+    if (_cq_ring != nullptr && _cq_ring != _sq_ring) {
+        munmap(_cq_ring, _cq_ring_size);
+    }
+    if (_sq_ring != nullptr) {
+        munmap(_sq_ring, _sq_ring_size);
+    }
+    if (_ring_fd >= 0) {
+        ::close(_ring_fd);
+    }
+}
+
+Status Ring::init() {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    _ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, kRingEntries, &params));
+    if (_ring_fd < 0) {
+        return io_error("io_uring_setup", errno);
+    }
+
+    _sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    _cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        _sq_ring_size = _cq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+    }
+    void* ptr = mmap(nullptr, _sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd,
+                     IORING_OFF_SQ_RING);
+    if (ptr == MAP_FAILED) {
+        return io_error("mmap io_uring sq ring", errno);
+    }
+    _sq_ring = ptr;
+    if (single_mmap) {
+        _cq_ring = _sq_ring;
+    } else {
+        ptr = mmap(nullptr, _cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd,
+                   IORING_OFF_CQ_RING);
+        if (ptr == MAP_FAILED) {
+            return io_error("mmap io_uring cq ring", errno);
+        }
+        _cq_ring = ptr;
+    }
+    _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    ptr = mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd, IORING_OFF_SQES);
+    if (ptr == MAP_FAILED) {
+        return io_error("mmap io_uring sqes", errno);
+    }
+    _sqes = static_cast<io_uring_sqe*>(ptr);
+
+    auto* sq = static_cast<char*>(_sq_ring);
+    _sq_entries = params.sq_entries;
+    _sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    _sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    _sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    _sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    auto* cq = static_cast<char*>(_cq_ring);
+    _cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    _cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    _cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    _cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return Status::OK();
+}
+
+void Ring::_push_read(int fd, uint64_t index, int64_t offset, const iovec* iov) {
+    const unsigned tail = *_sq_tail;
+    const unsigned slot = tail & *_sq_mask;
+    io_uring_sqe* sqe = &_sqes[slot];
+    memset(sqe, 0, sizeof(*sqe));
+    // IORING_OP_READV is available since the first kernel supporting io_uring.
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = fd;
+    sqe->off = offset;
+    sqe->addr = reinterpret_cast<uint64_t>(iov);
+    sqe->len = 1;
+    sqe->user_data = index;
+    _sq_array[slot] = slot;
+    __atomic_store_n(_sq_tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+Status Ring::_enter() {
+    while (true) {
+        // The reads pushed but not consumed by the kernel yet, including the ones of an interrupted call.
+        const unsigned to_submit = *_sq_tail - __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE);
+        auto res = syscall(__NR_io_uring_enter, _ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+        TEST_SYNC_POINT_CALLBACK("IoUringReader::enter", &res);
+        if (res >= 0) {
+            return Status::OK();
+        }
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            return io_error("io_uring_enter", errno);
+        }
+    }
+}
+
+Status Ring::read_fully(int fd, const ReadRange* ranges, size_t num_ranges) {
+    std::vector<iovec> iovs(num_ranges);
+    std::vector<int64_t> done(num_ranges, 0);
+    std::deque<size_t> pending;
+    for (size_t i = 0; i < num_ranges; i++) {
+        if (ranges[i].count > 0) {
+            pending.push_back(i);
+        }
+    }
+
+    Status st;
+    unsigned inflight = 0;
+    while (inflight > 0 || (st.ok() && !pending.empty())) {
+        while (st.ok() && !pending.empty() && inflight < _sq_entries) {
+            const size_t i = pending.front();
+            pending.pop_front();
+            iovs[i].iov_base = static_cast<char*>(ranges[i].data) + done[i];
+            iovs[i].iov_len = ranges[i].count - done[i];
+            _push_read(fd, i, ranges[i].offset + done[i], &iovs[i]);
+            inflight++;
+        }
+        if (auto enter_st = _enter(); !enter_st.ok()) {
+            // The buffers may still be written by the reads in flight, which must complete before returning.
+            _abandon(inflight);
+            return enter_st;
+        }
+
+        unsigned head = *_cq_head;
+        const unsigned tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; head++) {
+            const io_uring_cqe& cqe = _cqes[head & *_cq_mask];
+            const auto i = static_cast<size_t>(cqe.user_data);
+            inflight--;
+            if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+                pending.push_back(i);
+            } else if (cqe.res < 0) {
+                if (st.ok()) st = io_error("io_uring read", -cqe.res);
+            } else if (cqe.res == 0) {
+                if (st.ok()) {
+                    st = Status::IOError(fmt::format("reached the end of file at {}", ranges[i].offset + done[i]));
+                }
+            } else {
+                done[i] += cqe.res;
+                if (done[i] < ranges[i].count) {
+                    pending.push_back(i);
+                }
+            }
+        }
+        __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+    }
+    return st;
+}
+
+void Ring::_abandon(unsigned inflight) {
+    _broken = true;
+    // Without SQPOLL the kernel consumes the submission queue only in io_uring_enter(), which is not called again.
+    const unsigned sq_head = __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE);
+    unsigned submitted = inflight - (*_sq_tail - sq_head);
+    __atomic_store_n(_sq_tail, sq_head, __ATOMIC_RELEASE);
+    while (submitted > 0) {
+        const unsigned head = *_cq_head;
+        const unsigned tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+        submitted -= std::min(submitted, tail - head);
+        __atomic_store_n(_cq_head, tail, __ATOMIC_RELEASE);
+        if (submitted > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+thread_local std::unique_ptr<Ring> tls_ring;
+thread_local bool tls_ring_failed = false;
+
+// Returns the ring of the calling thread, or nullptr if it can not be set up or is broken.
+Ring* thread_ring() {
+    if (tls_ring == nullptr && !tls_ring_failed) {
+        auto new_ring = std::make_unique<Ring>();
+        if (auto st = new_ring->init(); st.ok()) {
+            tls_ring = std::move(new_ring);
+        } else {
+            LOG(WARNING) << "Failed to set up io_uring, fall back to pread: " << st;
+            tls_ring_failed = true;
+        }
+    }
+    return tls_ring.get();
+}
+
+} // namespace
+
+bool IoUringReader::available() {
+    if (!config::enable_io_uring) {
+        return false;
+    }
+    static const bool supported = [] {
+        Ring ring;
+        auto st = ring.init();
+        LOG_IF(WARNING, !st.ok()) << "io_uring is not supported by the kernel, fall back to pread: " << st;
+        return st.ok();
+    }();
+    return supported;
+}
+
+Status IoUringReader::read_fully(int fd, const ReadRange* ranges, size_t num_ranges) {
+    if (auto* ring = available() ? thread_ring() : nullptr; ring != nullptr) {
+        auto st = ring->read_fully(fd, ranges, num_ranges);
+        if (!ring->broken()) {
+            return st;
+        }
+        // All the reads of the broken ring have completed, so the ranges can be read again by pread.
+        LOG(WARNING) << "io_uring is broken, fall back to pread: " << st;
+        tls_ring.reset();
+        tls_ring_failed = true;
+    }
+    for (size_t i = 0; i < num_ranges; i++) {
+        RETURN_IF_ERROR(pread_fully(fd, ranges[i]));
+    }
+    return Status::OK();
+}
+
+#else
+
+bool IoUringReader::available() {
+    if (config::enable_io_uring) {
+        LOG_FIRST_N(WARNING, 1) << "io_uring is not supported by the build, fall back to pread";
+    }
+    return false;
+}
+
+Status IoUringReader::read_fully(int fd, const ReadRange* ranges, size_t num_ranges) {
+    for (size_t i = 0; i < num_ranges; i++) {
+        RETURN_IF_ERROR(pread_fully(fd, ranges[i]));
+    }
+    return Status::OK();
+}
+
+#endif
+
+} // namespace starrocks::io
@@ -0,0 +1,41 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/status.h"
+#include "io/seekable_input_stream.h"
+
+namespace starrocks::io {
+
+// IoUringReader reads a batch of ranges of a local file with all the reads in flight at the same time, by an
+// io_uring owned by the calling thread, instead of issuing one pread() after another.
+//
+// The ring is set up by the io_uring syscalls directly and lazily for each thread. It is only used when
+// `config::enable_io_uring` is set and the kernel supports io_uring, which is checked once by `available()`;
+// otherwise the ranges are read by pread().
+class IoUringReader {
+public:
+    // Returns whether io_uring is enabled and supported by the kernel.
+    static bool available();
+
+    // Reads all the `ranges` of `fd` fully, and resubmits the short reads. Returns an IO error if any read fails
+    // or reaches the end of the file, leaving the content of the buffers unspecified. The ranges are read by
+    // pread() one after another if io_uring is not available.
+    static Status read_fully(int fd, const ReadRange* ranges, size_t num_ranges);
+};
+
+} // namespace starrocks::io
@@ -20,6 +20,13 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <deque>
+
+#include "common/config.h"
+#include "io/io_profiler.h"
+#include "util/stopwatch.hpp"
+
 #ifdef USE_STAROS
 #include "fslib/metric_key.h"
 #include "metrics/metrics.h"
@@ -47,11 +54,14 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     request.SetKey(_object);
     request.SetRange(std::move(range));
 
+    MonotonicStopWatch watch;
+    watch.start();
     Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
     if (outcome.IsSuccess()) {
         Aws::IOStream& body = outcome.GetResult().GetBody();
         body.read(static_cast<char*>(out), count);
         _offset += body.gcount();
+        IOProfiler::add_read_of_source(IOProfiler::READ_REMOTE, body.gcount(), watch.elapsed_time());
         return body.gcount();
     } else {
         return make_error_status(outcome.GetError());
@@ -100,4 +110,69 @@ StatusOr<std::string> S3InputStream::read_all() {
     }
 }
 
+Status S3InputStream::read_at_fully_batch(const std::vector<ReadRange>& ranges) {
+    std::vector<const ReadRange*> sorted_ranges;
+    sorted_ranges.reserve(ranges.size());
+    for (const auto& range : ranges) {
+        if (range.count > 0) {
+            sorted_ranges.push_back(&range);
+        }
+    }
+    std::sort(sorted_ranges.begin(), sorted_ranges.end(),
+              [](const ReadRange* lhs, const ReadRange* rhs) { return lhs->offset < rhs->offset; });
+
+    // The ranges of a request are not overlapped, so that they are copied from the body one after another.
+    struct MergedRange {
+        int64_t offset;
+        int64_t end;
+        std::vector<const ReadRange*> ranges;
+    };
+    std::vector<MergedRange> merged_ranges;
+    for (const auto* range : sorted_ranges) {
+        const int64_t end = range->offset + range->count;
+        if (!merged_ranges.empty()) {
+            auto& last = merged_ranges.back();
+            if (range->offset >= last.end && range->offset - last.end <= config::s3_vectored_read_max_merge_distance &&
+                end - last.offset <= config::s3_vectored_read_max_merged_size) {
+                last.end = end;
+                last.ranges.push_back(range);
+                continue;
+            }
+        }
+        merged_ranges.push_back(MergedRange{.offset = range->offset, .end = end, .ranges = {range}});
+    }
+
+    const size_t max_parallelism = std::max(config::s3_vectored_read_max_parallelism, 1);
+    std::deque<std::pair<const MergedRange*, Aws::S3::Model::GetObjectOutcomeCallable>> inflight;
+    size_t next = 0;
+    while (next < merged_ranges.size() || !inflight.empty()) {
+        while (next < merged_ranges.size() && inflight.size() < max_parallelism) {
+            const auto& merged = merged_ranges[next++];
+            Aws::S3::Model::GetObjectRequest request;
+            request.SetBucket(_bucket);
+            request.SetKey(_object);
+            request.SetRange(fmt::format("bytes={}-{}", merged.offset, merged.end - 1));
+            inflight.emplace_back(&merged, _s3client->GetObjectCallable(request));
+        }
+        // The body is owned by the outcome, so the requests in flight can be abandoned on errors.
+        const MergedRange* merged = inflight.front().first;
+        Aws::S3::Model::GetObjectOutcome outcome = inflight.front().second.get();
+        inflight.pop_front();
+        if (!outcome.IsSuccess()) {
+            return make_error_status(outcome.GetError());
+        }
+        Aws::IOStream& body = outcome.GetResult().GetBody();
+        int64_t position = merged->offset;
+        for (const auto* range : merged->ranges) {
+            body.ignore(range->offset - position);
+            body.read(static_cast<char*>(range->data), range->count);
+            if (body.gcount() != range->count) {
+                return Status::IOError(fmt::format("reached the end of {} at {}", _object, range->offset));
+            }
+            position = range->offset + range->count;
+        }
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks::io
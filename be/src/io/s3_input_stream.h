@@ -52,6 +52,11 @@ public:
 
     StatusOr<std::string> read_all() override;
 
+    // Merges the nearby ranges into fewer ranged GETs, and issues them concurrently by the executor of the client.
+    Status read_at_fully_batch(const std::vector<ReadRange>& ranges) override;
+
+    bool support_batch_read() const override { return true; }
+
 private:
     std::shared_ptr<Aws::S3::S3Client> _s3client;
     std::string _bucket;
@@ -19,12 +19,21 @@
 #include <aws/s3/model/CreateMultipartUploadRequest.h>
 #include <aws/s3/model/PutObjectRequest.h>
 #include <aws/s3/model/UploadPartRequest.h>
+#include <bvar/bvar.h>
 #include <fmt/format.h>
 
+#include "common/config.h"
 #include "common/logging.h"
+#include "util/time.h"
 
 namespace starrocks::io {
 
+bvar::Adder<int64_t> g_s3_upload_bytes;
+bvar::PerSecond<bvar::Adder<int64_t>> g_s3_upload_bytes_second("s3_upload_bytes_second", &g_s3_upload_bytes);
+// latency in microseconds of the single PUTs and of the part uploads
+bvar::LatencyRecorder g_s3_put_object_latency("s3_put_object");
+bvar::LatencyRecorder g_s3_upload_part_latency("s3_upload_part");
+
 S3OutputStream::S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
                                int64_t max_single_part_size, int64_t min_upload_part_size)
         : _client(std::move(client)),
@@ -38,6 +47,13 @@ S3OutputStream::S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::s
     CHECK(_client != nullptr);
 }
 
+S3OutputStream::~S3OutputStream() {
+    // The uploads in flight use the client, so they must finish before it is released.
+    for (auto& part : _inflight_parts) {
+        part.wait();
+    }
+}
+
 Status S3OutputStream::write(const void* data, int64_t size) {
     _buffer.append(static_cast<const char*>(data), size);
     if (_upload_id.empty() && _buffer.size() > _max_single_part_size) {
@@ -80,6 +96,7 @@ Status S3OutputStream::close() {
         RETURN_IF_ERROR(singlepart_upload());
     } else {
         RETURN_IF_ERROR(multipart_upload());
+        RETURN_IF_ERROR(wait_for_inflight_parts(0));
         RETURN_IF_ERROR(complete_multipart_upload());
     }
     _client = nullptr;
@@ -105,10 +122,16 @@ Status S3OutputStream::singlepart_upload() {
     Aws::S3::Model::PutObjectRequest req;
     req.SetBucket(_bucket);
     req.SetKey(_object);
-    req.SetContentLength(static_cast<int64_t>(_buffer.size()));
-    req.SetBody(std::make_shared<Aws::StringStream>(_buffer));
+    const auto size = static_cast<int64_t>(_buffer.size());
+    req.SetContentLength(size);
+    req.SetBody(std::make_shared<Aws::StringStream>(std::move(_buffer)));
+    _buffer.clear();
+    const int64_t start_us = MonotonicMicros();
     Aws::S3::Model::PutObjectOutcome outcome = _client->PutObject(req);
-    if (!outcome.IsSuccess()) {
+    g_s3_put_object_latency << MonotonicMicros() - start_us;
+    if (outcome.IsSuccess()) {
+        g_s3_upload_bytes << size;
+    } else {
         std::string error_msg =
                 fmt::format("S3: Fail to put object {}/{}, msg: {}", _bucket, _object, outcome.GetError().GetMessage());
         LOG(WARNING) << error_msg;
@@ -122,20 +145,48 @@ Status S3OutputStream::multipart_upload() {
     if (_buffer.empty()) {
         return Status::OK();
     }
+    // Bound the parts in flight, and so the buffers they hold.
+    const auto max_inflight_parts = static_cast<size_t>(std::max(config::experimental_s3_max_inflight_upload_parts, 1));
+    RETURN_IF_ERROR(wait_for_inflight_parts(max_inflight_parts - 1));
+
     Aws::S3::Model::UploadPartRequest req;
     req.SetBucket(_bucket);
     req.SetKey(_object);
-    req.SetPartNumber(static_cast<int>(_etags.size() + 1));
+    req.SetPartNumber(static_cast<int>(_etags.size() + _inflight_parts.size() + 1));
     req.SetUploadId(_upload_id);
-    req.SetContentLength(static_cast<int64_t>(_buffer.size()));
-    req.SetBody(std::make_shared<Aws::StringStream>(_buffer));
-    auto outcome = _client->UploadPart(req);
-    if (outcome.IsSuccess()) {
+    const auto size = static_cast<int64_t>(_buffer.size());
+    req.SetContentLength(size);
+    // The part takes over the buffer, and the stream goes on writing the next part into a new one.
+    req.SetBody(std::make_shared<Aws::StringStream>(std::move(_buffer)));
+    _buffer.clear();
+
+    auto promise = std::make_shared<std::promise<Aws::S3::Model::UploadPartOutcome>>();
+    _inflight_parts.emplace_back(promise->get_future());
+    const int64_t start_us = MonotonicMicros();
+    auto on_uploaded = [promise, start_us, size](const Aws::S3::S3Client*, const Aws::S3::Model::UploadPartRequest&,
+                                                 const Aws::S3::Model::UploadPartOutcome& outcome,
+                                                 const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) {
+        g_s3_upload_part_latency << MonotonicMicros() - start_us;
+        if (outcome.IsSuccess()) {
+            g_s3_upload_bytes << size;
+        }
+        promise->set_value(outcome);
+    };
+    _client->UploadPartAsync(req, on_uploaded);
+    return Status::OK();
+}
+
+Status S3OutputStream::wait_for_inflight_parts(size_t max_inflight_parts) {
+    while (_inflight_parts.size() > max_inflight_parts) {
+        auto outcome = _inflight_parts.front().get();
+        _inflight_parts.pop_front();
+        if (!outcome.IsSuccess()) {
+            return Status::IOError(fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object,
+                                               outcome.GetError().GetMessage()));
+        }
         _etags.push_back(outcome.GetResult().GetETag());
-        return Status::OK();
     }
-    return Status::IOError(
-            fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object, outcome.GetError().GetMessage()));
+    return Status::OK();
 }
 
 Status S3OutputStream::complete_multipart_upload() {
@@ -16,6 +16,9 @@
 
 #include <aws/s3/S3Client.h>
 
+#include <deque>
+#include <future>
+
 #include "io/output_stream.h"
 
 namespace starrocks::io {
@@ -25,7 +28,7 @@ public:
     explicit S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
                             int64_t max_single_part_size, int64_t min_upload_part_size);
 
-    ~S3OutputStream() override = default;
+    ~S3OutputStream() override;
 
     // Disallow copy and assignment
     S3OutputStream(const S3OutputStream&) = delete;
@@ -54,6 +57,8 @@ private:
     Status multipart_upload();
     Status singlepart_upload();
     Status complete_multipart_upload();
+    // Wait for the oldest parts in flight until at most |max_inflight_parts| are left.
+    Status wait_for_inflight_parts(size_t max_inflight_parts);
 
     std::shared_ptr<Aws::S3::S3Client> _client;
     const Aws::String _bucket;
@@ -63,6 +68,8 @@ private:
     Aws::String _buffer;
     Aws::String _upload_id;
     std::vector<Aws::String> _etags;
+    // The parts being uploaded, in the order of their part numbers, which follow the ones in |_etags|.
+    std::deque<std::future<Aws::S3::Model::UploadPartOutcome>> _inflight_parts;
 };
 
 } // namespace starrocks::io
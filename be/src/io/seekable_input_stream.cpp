@@ -30,6 +30,13 @@ Status SeekableInputStream::read_at_fully(int64_t offset, void* data, int64_t co
     return read_fully(data, count);
 }
 
+Status SeekableInputStream::read_at_fully_batch(const std::vector<ReadRange>& ranges) {
+    for (const auto& range : ranges) {
+        RETURN_IF_ERROR(read_at_fully(range.offset, range.data, range.count));
+    }
+    return Status::OK();
+}
+
 Status SeekableInputStream::skip(int64_t count) {
     ASSIGN_OR_RETURN(auto pos, position());
     return seek(pos + count);
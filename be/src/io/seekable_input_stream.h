@@ -14,10 +14,19 @@
 
 #pragma once
 
+#include <vector>
+
 #include "io/input_stream.h"
 
 namespace starrocks::io {
 
+// A range of the stream to read into |data| by `SeekableInputStream::read_at_fully_batch()`.
+struct ReadRange {
+    int64_t offset;
+    int64_t count;
+    void* data;
+};
+
 class SeekableInputStream : public InputStream {
 public:
     ~SeekableInputStream() override = default;
@@ -57,6 +66,14 @@ public:
     // ```
     virtual Status read_at_fully(int64_t offset, void* out, int64_t count);
 
+    // Reads all the |ranges| fully, as `read_at_fully()` does for each of them.
+    //
+    // Default implementation calls `read_at_fully()` for the ranges one after another, and the implementations
+    // returning true from `support_batch_read()` have the reads in flight at the same time.
+    virtual Status read_at_fully_batch(const std::vector<ReadRange>& ranges);
+
+    virtual bool support_batch_read() const { return false; }
+
     // Return the total file size in bytes, or error.
     virtual StatusOr<int64_t> get_size() = 0;
 
@@ -126,6 +143,12 @@ public:
         return _impl->read_at_fully(offset, out, count);
     }
 
+    Status read_at_fully_batch(const std::vector<ReadRange>& ranges) override {
+        return _impl->read_at_fully_batch(ranges);
+    }
+
+    bool support_batch_read() const override { return _impl->support_batch_read(); }
+
     StatusOr<int64_t> get_size() override { return _impl->get_size(); }
 
     Status seek(int64_t offset) override { return _impl->seek(offset); }
@@ -20,6 +20,7 @@
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "util/runtime_profile.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -27,6 +28,13 @@ SharedBufferedInputStream::SharedBufferedInputStream(std::shared_ptr<SeekableInp
                                                      size_t file_size)
         : _stream(std::move(stream)), _filename(std::move(filename)), _file_size(file_size) {}
 
+SharedBufferedInputStream::~SharedBufferedInputStream() {
+    if (_prefetch_token != nullptr) {
+        // Wait for the running prefetching and drop the queued ones, which write to the buffers of `_map`.
+        _prefetch_token->shutdown();
+    }
+}
+
 void SharedBufferedInputStream::SharedBuffer::align(int64_t align_size, int64_t file_size) {
     if (align_size != 0) {
         offset = raw_offset / align_size * align_size;
@@ -187,6 +195,11 @@ Status SharedBufferedInputStream::_set_io_ranges_active_and_lazy_columns(const s
 }
 
 Status SharedBufferedInputStream::set_io_ranges(const std::vector<IORange>& ranges, bool coalesce_lazy_column) {
+    for (const auto& r : ranges) {
+        if (!r.column.empty() && r.size > 0) {
+            _column_ranges[r.offset + r.size] = {r.offset, r.column};
+        }
+    }
     if (coalesce_lazy_column || !config::io_coalesce_adaptive_lazy_active) {
         return _set_io_ranges_all_columns(ranges);
     } else {
@@ -194,6 +207,67 @@ Status SharedBufferedInputStream::set_io_ranges(const std::vector<IORange>& rang
     }
 }
 
+void SharedBufferedInputStream::enable_prefetch(ThreadPool* pool) {
+    _prefetch_token = pool->new_token(ThreadPool::ExecutionMode::SERIAL);
+}
+
+Status SharedBufferedInputStream::prefetch_io_ranges(const std::vector<IORange>& ranges, bool coalesce_lazy_column) {
+    RETURN_IF_ERROR(set_io_ranges(ranges, coalesce_lazy_column));
+    if (_prefetch_token == nullptr) {
+        return Status::OK();
+    }
+    for (const auto& r : ranges) {
+        // The lazy columns may not be read at all if they are not coalesced with the active ones.
+        if (r.size == 0 || (!r.is_active && !coalesce_lazy_column)) {
+            continue;
+        }
+        auto res = find_shared_buffer(r.offset, r.size);
+        if (!res.ok() || res.value()->buffer.capacity() > 0) {
+            continue;
+        }
+        SharedBuffer* sb = res.value().get();
+        // Stop prefetching if the memory is not enough, and the buffers are read by the reader when used.
+        if (!CurrentThread::mem_tracker()->check_mem_limit("prefetch into shared buffer").ok()) {
+            break;
+        }
+        _count_shared_io(*sb);
+        sb->buffer.reserve(sb->size);
+        auto promise = std::make_shared<std::promise<Status>>();
+        sb->prefetch = promise->get_future();
+        auto st = _prefetch_token->submit_func([this, sb, promise]() {
+            std::lock_guard l(_stream_mutex);
+            promise->set_value(_stream->read_at_fully(sb->offset, sb->buffer.data(), sb->size));
+        });
+        if (!st.ok()) {
+            sb->prefetch = std::future<Status>();
+            std::vector<uint8_t>().swap(sb->buffer);
+            break;
+        }
+        _prefetch_io_count++;
+        _prefetch_io_bytes += sb->size;
+    }
+    return Status::OK();
+}
+
+void SharedBufferedInputStream::_wait_prefetch(SharedBuffer* sb) {
+    if (!sb->prefetch.valid()) {
+        return;
+    }
+    SCOPED_RAW_TIMER(&_prefetch_wait_timer);
+    Status st = sb->prefetch.get();
+    if (!st.ok()) {
+        LOG(WARNING) << "Failed to prefetch " << _filename << ", " << sb->debug_string() << ": " << st;
+        std::vector<uint8_t>().swap(sb->buffer);
+    }
+}
+
+void SharedBufferedInputStream::_wait_prefetch(std::map<int64_t, SharedBufferPtr>::iterator begin,
+                                               std::map<int64_t, SharedBufferPtr>::iterator end) {
+    for (auto iter = begin; iter != end; ++iter) {
+        _wait_prefetch(iter->second.get());
+    }
+}
+
 StatusOr<SharedBufferedInputStream::SharedBufferPtr> SharedBufferedInputStream::find_shared_buffer(size_t offset,
                                                                                                    size_t count) {
     auto iter = _map.upper_bound(offset);
@@ -204,6 +278,7 @@ StatusOr<SharedBufferedInputStream::SharedBufferPtr> SharedBufferedInputStream::
     if ((sb->offset > offset) || (sb->offset + sb->size) < (offset + count)) {
         return Status::RuntimeError("bad construction of shared buffer");
     }
+    _wait_prefetch(sb.get());
     return sb;
 }
 
@@ -215,30 +290,91 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
     }
 
     SharedBuffer& sb = *shared_buffer;
+    _wait_prefetch(&sb);
     if (sb.buffer.capacity() == 0) {
         RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
         SCOPED_RAW_TIMER(&_shared_io_timer);
-        _shared_io_count += 1;
-        _shared_io_bytes += sb.size;
-        if (sb.size > sb.raw_size) {
-            // after called _deduplicate_shared_buffer(), sb.size maybe is larger than sb.raw_size
-            // we will count how many extra bytes we read because of alignment.
-            _shared_align_io_bytes += sb.size - sb.raw_size;
+        if (_stream->support_batch_read() && config::io_coalesce_read_batch_size > 1) {
+            RETURN_IF_ERROR(_read_shared_buffers_batch(shared_buffer));
+        } else {
+            _count_shared_io(sb);
+            sb.buffer.reserve(sb.size);
+            std::lock_guard l(_stream_mutex);
+            RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
         }
-        sb.buffer.reserve(sb.size);
-        RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
 }
 
+void SharedBufferedInputStream::_count_shared_io(const SharedBuffer& sb) {
+    _shared_io_count += 1;
+    _shared_io_bytes += sb.size;
+    if (sb.size > sb.raw_size) {
+        // after called _deduplicate_shared_buffer(), sb.size maybe is larger than sb.raw_size
+        // we will count how many extra bytes we read because of alignment.
+        _shared_align_io_bytes += sb.size - sb.raw_size;
+    }
+}
+
+Status SharedBufferedInputStream::_read_shared_buffers_batch(const SharedBufferPtr& shared_buffer) {
+    // Read the following buffers not read yet together with `shared_buffer`, within the size of a coalesced buffer.
+    std::vector<SharedBuffer*> buffers{shared_buffer.get()};
+    int64_t bytes = shared_buffer->size;
+    for (auto iter = _map.upper_bound(shared_buffer->raw_offset + shared_buffer->raw_size - 1); iter != _map.end();
+         ++iter) {
+        SharedBuffer* sb = iter->second.get();
+        if (sb == shared_buffer.get() || sb->buffer.capacity() > 0) {
+            continue;
+        }
+        if (static_cast<int64_t>(buffers.size()) >= config::io_coalesce_read_batch_size ||
+            bytes + sb->size > _options.max_buffer_size) {
+            break;
+        }
+        buffers.push_back(sb);
+        bytes += sb->size;
+    }
+
+    std::vector<ReadRange> ranges;
+    ranges.reserve(buffers.size());
+    for (auto* sb : buffers) {
+        _count_shared_io(*sb);
+        sb->buffer.reserve(sb->size);
+        ranges.push_back(ReadRange{.offset = sb->offset, .count = sb->size, .data = sb->buffer.data()});
+    }
+    Status st;
+    {
+        std::lock_guard l(_stream_mutex);
+        st = _stream->read_at_fully_batch(ranges);
+    }
+    if (!st.ok()) {
+        // Read the buffers again next time.
+        for (auto* sb : buffers) {
+            std::vector<uint8_t>().swap(sb->buffer);
+        }
+    }
+    return st;
+}
+
 void SharedBufferedInputStream::release() {
+    _wait_prefetch(_map.begin(), _map.end());
     _map.clear();
+    _column_ranges.clear();
 }
 
 void SharedBufferedInputStream::release_to_offset(int64_t offset) {
     auto it = _map.upper_bound(offset);
+    _wait_prefetch(_map.begin(), it);
     _map.erase(_map.begin(), it);
+    _column_ranges.erase(_column_ranges.begin(), _column_ranges.upper_bound(offset));
+}
+
+std::string_view SharedBufferedInputStream::column_of(int64_t offset) const {
+    auto iter = _column_ranges.upper_bound(offset);
+    if (iter == _column_ranges.end() || iter->second.first > offset) {
+        return {};
+    }
+    return iter->second.second;
 }
 
 Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
@@ -247,6 +383,7 @@ Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64
         SCOPED_RAW_TIMER(&_direct_io_timer);
         _direct_io_count += 1;
         _direct_io_bytes += count;
+        std::lock_guard l(_stream_mutex);
         RETURN_IF_ERROR(_stream->read_at_fully(offset, out, count));
         return Status::OK();
     }
@@ -261,7 +398,9 @@ StatusOr<int64_t> SharedBufferedInputStream::get_size() {
 }
 
 StatusOr<int64_t> SharedBufferedInputStream::read(void* data, int64_t count) {
+    std::unique_lock l(_stream_mutex);
     auto n = _stream->read_at(_offset, data, count);
+    l.unlock();
     RETURN_IF_ERROR(n);
     _offset += n.value();
     return n;
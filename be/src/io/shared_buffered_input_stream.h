@@ -16,11 +16,21 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
 
 #include "common/status.h"
 #include "io/seekable_input_stream.h"
 
+namespace starrocks {
+class ThreadPool;
+class ThreadPoolToken;
+} // namespace starrocks
+
 namespace starrocks::io {
 
 class SharedBufferedInputStream : public SeekableInputStream {
@@ -31,6 +41,8 @@ public:
         int64_t offset;
         int64_t size;
         bool is_active = true;
+        // The column the range belongs to, if any, by which the range is tagged in the datacache.
+        std::string column;
         bool operator<(const IORange& x) const { return offset < x.offset; }
     };
     struct CoalesceOptions {
@@ -47,16 +59,19 @@ public:
         int64_t size;
         int64_t ref_count;
         std::vector<uint8_t> buffer;
+        // Valid when the buffer is being read by the prefetching, which is waited before the buffer is used.
+        std::future<Status> prefetch;
         void align(int64_t align_size, int64_t file_size);
         std::string debug_string() const;
     };
     using SharedBufferPtr = std::shared_ptr<SharedBuffer>;
 
     SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, std::string filename, size_t file_size);
-    ~SharedBufferedInputStream() override = default;
+    ~SharedBufferedInputStream() override;
 
     Status seek(int64_t position) override {
         _offset = position;
+        std::lock_guard l(_stream_mutex);
         return _stream->seek(position);
     }
     StatusOr<int64_t> position() override { return _offset; }
@@ -65,21 +80,33 @@ public:
     StatusOr<int64_t> get_size() override;
     Status skip(int64_t count) override {
         _offset += count;
+        std::lock_guard l(_stream_mutex);
         return _stream->skip(count);
     }
 
+    // Returns the shared buffer containing the range, after waiting for the prefetching of it if any.
     StatusOr<SharedBufferPtr> find_shared_buffer(size_t offset, size_t count);
     // Get bytes from shared buffer or remote storage, when the shared_buffer is not NULL, the function
     // will use it directely instead of finding it repeatedly.
     Status get_bytes(const uint8_t** buffer, size_t offset, size_t count, SharedBufferPtr shared_buffer);
 
     StatusOr<std::unique_ptr<NumericStatistics>> get_numeric_statistics() override {
+        std::lock_guard l(_stream_mutex);
         return _stream->get_numeric_statistics();
     }
 
     Status set_io_ranges(const std::vector<IORange>& ranges, bool coalesce_lazy_column = true);
+    // Reads the shared buffers of `prefetch_io_ranges()` in the background by a serial token of `pool`.
+    void enable_prefetch(ThreadPool* pool);
+    bool prefetch_enabled() const { return _prefetch_token != nullptr; }
+    // Sets the io ranges as set_io_ranges(), and starts to read the shared buffers of the active ranges in the
+    // background if the prefetching is enabled, e.g. the ranges of the next stripe of an ORC file while the current
+    // one is being decoded. The ranges must not overlap with the ones set before and not released yet.
+    Status prefetch_io_ranges(const std::vector<IORange>& ranges, bool coalesce_lazy_column = true);
     void release_to_offset(int64_t offset);
     void release();
+    // Returns the column of the io range containing `offset` set by set_io_ranges, or an empty string.
+    std::string_view column_of(int64_t offset) const;
     void set_coalesce_options(const CoalesceOptions& options) { _options = options; }
     void set_align_size(int64_t size) { _align_size = size; }
 
@@ -91,6 +118,10 @@ public:
     int64_t direct_io_bytes() const { return _direct_io_bytes; }
     int64_t direct_io_timer() const { return _direct_io_timer; }
     int64_t estimated_mem_usage() const { return _estimated_mem_usage; }
+    int64_t prefetch_io_count() const { return _prefetch_io_count; }
+    int64_t prefetch_io_bytes() const { return _prefetch_io_bytes; }
+    // The time waiting for the prefetching by the reader.
+    int64_t prefetch_wait_timer() const { return _prefetch_wait_timer; }
 
     StatusOr<std::string_view> peek(int64_t count) override;
     const std::string& filename() const override { return _filename; }
@@ -99,13 +130,25 @@ public:
 
 private:
     void _update_estimated_mem_usage();
+    // Waits for the prefetching of `sb` if any, and leaves the buffer to be read again if the prefetching fails.
+    void _wait_prefetch(SharedBuffer* sb);
+    void _wait_prefetch(std::map<int64_t, SharedBufferPtr>::iterator begin,
+                        std::map<int64_t, SharedBufferPtr>::iterator end);
+    void _count_shared_io(const SharedBuffer& sb);
+    // Reads `shared_buffer` and the next buffers not read yet in one batch, for the streams supporting batch read.
+    Status _read_shared_buffers_batch(const SharedBufferPtr& shared_buffer);
     Status _sort_and_check_overlap(std::vector<IORange>& ranges);
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
     Status _set_io_ranges_active_and_lazy_columns(const std::vector<IORange>& ranges);
     const std::shared_ptr<SeekableInputStream> _stream;
+    // Serializes the reads of `_stream` by the prefetching and the reader.
+    std::mutex _stream_mutex;
+    std::unique_ptr<ThreadPoolToken> _prefetch_token;
     const std::string _filename;
     std::map<int64_t, SharedBufferPtr> _map;
+    // The io ranges of the columns keyed by their end offsets, with their begin offsets and column names.
+    std::map<int64_t, std::pair<int64_t, std::string>> _column_ranges;
     CoalesceOptions _options;
     int64_t _offset = 0;
     int64_t _file_size = 0;
@@ -118,6 +161,9 @@ private:
     int64_t _direct_io_timer = 0;
     int64_t _align_size = 0;
     int64_t _estimated_mem_usage = 0;
+    int64_t _prefetch_io_count = 0;
+    int64_t _prefetch_io_bytes = 0;
+    int64_t _prefetch_wait_timer = 0;
 };
 
 } // namespace starrocks::io
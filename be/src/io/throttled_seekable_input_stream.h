@@ -53,6 +53,11 @@ public:
         return SeekableInputStreamWrapper::read_at_fully(offset, out, count);
     }
 
+    Status read_at_fully_batch(const std::vector<ReadRange>& ranges) override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(_wait_per_read));
+        return SeekableInputStreamWrapper::read_at_fully_batch(ranges);
+    }
+
 private:
     int64_t _wait_per_read;
 };
@@ -10,6 +10,9 @@
 #ifdef __SSE4_1__
 #include <smmintrin.h>
 #endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 namespace starrocks {
 
@@ -237,6 +240,54 @@ public:
     }
 };
 
+/** Searches by comparing the first and the last characters of the needle with 32 positions of the haystack at once,
+  * and comparing the middle of the needle only at the positions both match, which rarely happens for the real needles.
+  * It is faster than Volnitsky for searching the short needles in all the values of a column at once.
+  */
+class FirstLastByteStringSearcher {
+public:
+    FirstLastByteStringSearcher(const char* needle, size_t needle_size, size_t haystack_size_hint = 0)
+            : _needle(needle), _needle_size(needle_size) {}
+
+    // Returns the first position of the needle in the haystack, or `haystack + haystack_size` if not found.
+    const char* search(const char* haystack, size_t haystack_size) const {
+        const char* const haystack_end = haystack + haystack_size;
+        if (_needle_size == 0) {
+            return haystack;
+        }
+        if (haystack_size < _needle_size) {
+            return haystack_end;
+        }
+        const char* pos = haystack;
+#ifdef __AVX2__
+        constexpr size_t AVX2_WIDTH = sizeof(__m256i);
+        const size_t middle_size = _needle_size > 2 ? _needle_size - 2 : 0;
+        const __m256i first = _mm256_set1_epi8(_needle[0]);
+        const __m256i last = _mm256_set1_epi8(_needle[_needle_size - 1]);
+        // Both loads are in the haystack.
+        for (; pos + _needle_size - 1 + AVX2_WIDTH <= haystack_end; pos += AVX2_WIDTH) {
+            const auto v_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos));
+            const auto v_last = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos + _needle_size - 1));
+            auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(v_first, first), _mm256_cmpeq_epi8(v_last, last))));
+            while (mask != 0) {
+                const size_t offset = __builtin_ctz(mask);
+                if (memcmp(pos + offset + 1, _needle + 1, middle_size) == 0) {
+                    return pos + offset;
+                }
+                mask &= mask - 1;
+            }
+        }
+#endif
+        const void* res = memmem(pos, haystack_end - pos, _needle, _needle_size);
+        return res == nullptr ? haystack_end : static_cast<const char*>(res);
+    }
+
+private:
+    const char* const _needle;
+    const size_t _needle_size;
+};
+
 /** Uses functions from libc.
   * It makes sense to use only with short haystacks when cheap initialization is required.
   */
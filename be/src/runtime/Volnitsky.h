@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <optional>
 
 #include "runtime/StringSearcher.h"
 
@@ -165,4 +166,33 @@ protected:
 
 using VolnitskyUTF8 = VolnitskyBase<StringSearcher>;
 
+/// The searcher to search a needle in the bytes of all the values of a BinaryColumn at once, by
+/// FirstLastByteStringSearcher for the short needles if AVX2 is supported, and by Volnitsky otherwise, which is
+/// faster for the long needles.
+class ColumnStringSearcher {
+public:
+    static constexpr size_t MAX_FIRST_LAST_BYTE_NEEDLE_SIZE = 16;
+
+    ColumnStringSearcher(const char* needle, size_t needle_size, size_t haystack_size_hint) {
+#ifdef __AVX2__
+        if (needle_size < MAX_FIRST_LAST_BYTE_NEEDLE_SIZE) {
+            _first_last_byte_searcher.emplace(needle, needle_size);
+            return;
+        }
+#endif
+        _volnitsky_searcher.emplace(needle, needle_size, haystack_size_hint);
+    }
+
+    const char* search(const char* haystack, size_t haystack_size) const {
+        if (_first_last_byte_searcher.has_value()) {
+            return _first_last_byte_searcher->search(haystack, haystack_size);
+        }
+        return _volnitsky_searcher->search(haystack, haystack_size);
+    }
+
+private:
+    std::optional<FirstLastByteStringSearcher> _first_last_byte_searcher;
+    std::optional<VolnitskyUTF8> _volnitsky_searcher;
+};
+
 } // namespace starrocks
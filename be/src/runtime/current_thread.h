@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 
@@ -66,7 +67,7 @@ private:
             _cache_size += size;
             _allocated_cache_size += size;
             _total_consumed_bytes += size;
-            if (_cache_size >= BATCH_SIZE) {
+            if (_cache_size >= _batch_size) {
                 commit(false);
             }
         }
@@ -78,10 +79,11 @@ private:
             _cache_size += size;
             _allocated_cache_size += size;
             _total_consumed_bytes += size;
-            if (cur_tracker != nullptr && _cache_size >= BATCH_SIZE) {
+            if (cur_tracker != nullptr && _cache_size >= _batch_size) {
                 MemTracker* limit_tracker = cur_tracker->try_consume(_cache_size);
                 if (LIKELY(limit_tracker == nullptr)) {
                     _cache_size = 0;
+                    _update_batch_size(cur_tracker);
                     return true;
                 } else {
                     _reserved_bytes = prev_reserved;
@@ -100,10 +102,11 @@ private:
             _cache_size += size;
             _allocated_cache_size += size;
             _total_consumed_bytes += size;
-            if (cur_tracker != nullptr && _cache_size >= BATCH_SIZE) {
+            if (cur_tracker != nullptr && _cache_size >= _batch_size) {
                 MemTracker* limit_tracker = cur_tracker->try_consume_with_limited(_cache_size);
                 if (LIKELY(limit_tracker == nullptr)) {
                     _cache_size = 0;
+                    _update_batch_size(cur_tracker);
                     return true;
                 } else {
                     _cache_size -= size;
@@ -147,6 +150,8 @@ private:
                 cur_tracker->consume(_cache_size);
             }
             _cache_size = 0;
+            // the tracker may be switched after a context shift, so start with the full batch again.
+            _update_batch_size(is_ctx_shift ? nullptr : cur_tracker);
             if (is_ctx_shift) {
                 // Flush all cached info
                 if (cur_tracker != nullptr) {
@@ -166,7 +171,22 @@ private:
 
         int64_t get_consumed_bytes() const { return _total_consumed_bytes; }
 
+        int64_t batch_size() const { return _batch_size; }
+
     private:
+        // The bytes batched by all the threads are not seen by the limits, which is fine far from the limits, but
+        // lets the consumption overshoot them a lot when the tracker is nearly full. So the batch shrinks to a share
+        // of the spare capacity of the tracker near the limits. It keeps a small minimum, or every allocation of every
+        // thread would hit the shared atomics while a tracker stays over its limit.
+        void _update_batch_size(MemTracker* tracker) {
+            if (tracker == nullptr) {
+                _batch_size = BATCH_SIZE;
+                return;
+            }
+            int64_t spare = tracker->spare_capacity();
+            _batch_size = std::clamp<int64_t>(spare / SPARE_CAPACITY_SHARES, MIN_BATCH_SIZE, BATCH_SIZE);
+        }
+
         int64_t _consume_from_reserved(int64_t size) {
             if (_reserved_bytes > size) {
                 _reserved_bytes -= size;
@@ -179,9 +199,15 @@ private:
         }
 
         const static int64_t BATCH_SIZE = 2 * 1024 * 1024;
+        // at most this many threads are assumed to batch the bytes of the same tracker at the same time.
+        const static int64_t SPARE_CAPACITY_SHARES = 256;
+        const static int64_t MIN_BATCH_SIZE = 32 * 1024;
 
         std::function<MemTracker*()> _loader;
 
+        // commit the cached bytes to the tracker once they reach this size, see _update_batch_size.
+        int64_t _batch_size = BATCH_SIZE;
+
         int64_t _reserved_bytes = 0;
 
         // Allocated or delocated but not committed memory bytes, can be negative
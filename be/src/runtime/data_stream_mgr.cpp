@@ -127,7 +127,32 @@ std::shared_ptr<DataStreamRecvr> DataStreamMgr::find_recvr(const TUniqueId& frag
     return {};
 }
 
-Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done) {
+namespace {
+// Sets the buffer credit of the receiver in the response right before it is sent, which may be long after
+// the request is received if the receiver holds the closure until its buffer drains.
+class CreditClosure final : public google::protobuf::Closure {
+public:
+    CreditClosure(google::protobuf::Closure* done, std::weak_ptr<DataStreamRecvr> recvr,
+                  PTransmitChunkResult* response)
+            : _done(done), _recvr(std::move(recvr)), _response(response) {}
+
+    void Run() override {
+        std::unique_ptr<CreditClosure> self_guard(this);
+        if (auto recvr = _recvr.lock(); recvr != nullptr) {
+            _response->set_receiver_credit_bytes(recvr->buffer_credit_bytes());
+        }
+        _done->Run();
+    }
+
+private:
+    google::protobuf::Closure* _done;
+    std::weak_ptr<DataStreamRecvr> _recvr;
+    PTransmitChunkResult* _response;
+};
+} // namespace
+
+Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done,
+                                     bool* receiver_finished, PTransmitChunkResult* response) {
     const PUniqueId& finst_id = request.finst_id();
     // TODO(zc): Use PUniqueId directly
     // We can use PUniqueId directly, because old version StarRocks has already use
@@ -147,6 +172,9 @@ Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::goog
         // errors from receiver-initiated teardowns.
         VLOG_QUERY << request.sender_id() << " sender transmits chunks to a non-existing receiver fragment "
                    << print_id(request.finst_id());
+        if (receiver_finished != nullptr) {
+            *receiver_finished = true;
+        }
         return Status::OK();
     }
 
@@ -164,6 +192,9 @@ Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::goog
         }
     });
     if (request.chunks_size() > 0 || request.use_pass_through()) {
+        if (!eos && response != nullptr && *done != nullptr) {
+            *done = new CreditClosure(*done, recvr, response);
+        }
         RETURN_IF_ERROR(recvr->add_chunks(request, eos ? nullptr : done));
     }
 
@@ -65,6 +65,7 @@ class DataStreamRecvr;
 class RuntimeState;
 class PUniqueId;
 class PTransmitChunkParams;
+class PTransmitChunkResult;
 
 // Singleton class which manages all incoming data streams at a backend node. It
 // provides both producer and consumer functionality for each data stream.
@@ -98,7 +99,10 @@ public:
                                                   std::shared_ptr<QueryStatisticsRecvr> sub_plan_query_statistics_recvr,
                                                   bool is_pipeline, int32_t degree_of_parallelism, bool keep_order);
 
-    Status transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
+    // `receiver_finished` is set if the receiver does not exist any more, so the sender can stop sending to it.
+    // If `response` is given, the buffer credit of the receiver is set in it when `done` is run.
+    Status transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done,
+                          bool* receiver_finished = nullptr, PTransmitChunkResult* response = nullptr);
     // Closes all receivers registered for fragment_instance_id immediately.
     void cancel(const TUniqueId& fragment_instance_id);
     void close();
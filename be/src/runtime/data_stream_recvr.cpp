@@ -36,6 +36,7 @@
 
 #include <util/time.h>
 
+#include <algorithm>
 #include <condition_variable>
 #include <deque>
 #include <utility>
@@ -164,6 +165,7 @@ DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtim
           _row_desc(row_desc),
           _is_merging(is_merging),
           _num_buffered_bytes(0),
+          _num_remaining_senders(num_senders),
           _instance_profile(runtime_state->runtime_profile_ptr()),
           _query_mem_tracker(runtime_state->query_mem_tracker_ptr()),
           _instance_mem_tracker(runtime_state->instance_mem_tracker_ptr()),
@@ -245,6 +247,7 @@ Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google
     SCOPED_TIMER(metrics.process_total_timer);
     COUNTER_UPDATE(metrics.request_received_counter, 1);
     int use_sender_id = _is_merging ? request.sender_id() : 0;
+    DeferOp notify_observers([this]() { _observers.notify_all(); });
     // Add all batches to the same queue if _is_merging is false.
 
     if (_keep_order) {
@@ -258,12 +261,20 @@ Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google
 void DataStreamRecvr::remove_sender(int sender_id, int be_number) {
     int use_sender_id = _is_merging ? sender_id : 0;
     _sender_queues[use_sender_id]->decrement_senders(be_number);
+    --_num_remaining_senders;
+    _observers.notify_all();
+}
+
+int64_t DataStreamRecvr::buffer_credit_bytes() const {
+    const int64_t free_bytes = static_cast<int64_t>(_total_buffer_limit) - static_cast<int64_t>(_num_buffered_bytes);
+    return std::max<int64_t>(0, free_bytes) / std::max(1, _num_remaining_senders.load());
 }
 
 void DataStreamRecvr::cancel_stream() {
     for (auto& _sender_queue : _sender_queues) {
         _sender_queue->cancel();
     }
+    _observers.notify_all();
 }
 
 void DataStreamRecvr::close() {
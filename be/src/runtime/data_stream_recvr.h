@@ -39,6 +39,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/sorting/merge_path.h"
 #include "gen_cpp/Types_types.h" // for TUniqueId
 #include "runtime/descriptors.h"
@@ -126,12 +127,20 @@ public:
 
     bool has_output_for_pipeline(const int32_t driver_sequence) const;
 
+    // The observers are notified when has_output_for_pipeline() or is_finished() may change,
+    // that is, chunks are added, a sender is removed, or the stream is cancelled.
+    void attach_observer(pipeline::PipelineObserver* observer) { _observers.add(observer); }
+    void detach_observer(pipeline::PipelineObserver* observer) { _observers.remove(observer); }
+
     bool is_finished() const;
 
     bool is_data_ready();
 
     bool get_encode_level() const { return _encode_level; }
 
+    // The bytes each remaining sender may have in flight, that is, its share of the free buffer.
+    int64_t buffer_credit_bytes() const;
+
 private:
     friend class DataStreamMgr;
     class SenderQueue;
@@ -184,6 +193,9 @@ private:
     // total number of bytes held across all sender queues.
     std::atomic<size_t> _num_buffered_bytes{0};
 
+    // number of senders which have not sent eos yet.
+    std::atomic<int> _num_remaining_senders{0};
+
     // One or more queues of row batches received from senders. If _is_merging is true,
     // there is one SenderQueue for each sender. Otherwise, row batches from all senders
     // are placed in the same SenderQueue. The SenderQueue instances are owned by the
@@ -197,6 +209,9 @@ private:
     // Pool of sender queues.
     ObjectPool _sender_queue_pool;
 
+    // The observers of the exchange source operators.
+    pipeline::PipelineObserverList _observers;
+
     // instance profile and mem_tracker
     std::shared_ptr<RuntimeProfile> _instance_profile;
     std::shared_ptr<MemTracker> _query_mem_tracker;
@@ -47,11 +47,13 @@
 #include "exec/pipeline/driver_limiter.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/query_context.h"
+#include "exec/pipeline/query_cpu_sampler.h"
 #include "exec/spill/dir_manager.h"
 #include "exec/workgroup/scan_executor.h"
 #include "exec/workgroup/work_group.h"
 #include "exprs/jit/jit_engine.h"
 #include "fs/fs_s3.h"
+#include "io/io_uring_reader.h"
 #include "gen_cpp/BackendService.h"
 #include "gen_cpp/TFileBrokerService.h"
 #include "gutil/strings/join.h"
@@ -242,8 +244,7 @@ Status GlobalEnv::_init_mem_tracker() {
 
     SetMemTrackerForColumnPool op(_column_pool_mem_tracker);
     ForEach<ColumnPoolList>(op);
-    _init_storage_page_cache(); // TODO: move to StorageEngine
-    return Status::OK();
+    return _init_storage_page_cache(); // TODO: move to StorageEngine
 }
 
 void GlobalEnv::_reset_tracker() {
@@ -252,10 +253,21 @@ void GlobalEnv::_reset_tracker() {
     }
 }
 
-void GlobalEnv::_init_storage_page_cache() {
+Status GlobalEnv::_init_storage_page_cache() {
     int64_t storage_cache_limit = get_storage_page_cache_size();
     storage_cache_limit = check_storage_page_cache_size(storage_cache_limit);
     StoragePageCache::create_global_cache(page_cache_mem_tracker(), storage_cache_limit);
+    if (!config::disable_storage_page_cache && !config::storage_page_disk_cache_path.empty()) {
+        auto st = StoragePageCache::instance()->init_disk_cache(config::storage_page_disk_cache_path,
+                                                                config::storage_page_disk_cache_capacity);
+        // A directory not owned by the cache is a misconfiguration, which must not be ignored silently.
+        if (st.is_invalid_argument()) {
+            return st;
+        }
+        LOG_IF(WARNING, !st.ok()) << "Failed to init the disk cache of storage page cache at "
+                                  << config::storage_page_disk_cache_path << ": " << st;
+    }
+    return Status::OK();
 }
 
 int64_t GlobalEnv::get_storage_page_cache_size() {
@@ -343,6 +355,13 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_automatic_partition_pool));
 
+    RETURN_IF_ERROR(ThreadPoolBuilder("lake_vacuum_collect") // thread pool for reading metadata in lake vacuum
+                            .set_min_threads(0)
+                            .set_max_threads(std::max(1, config::lake_vacuum_collect_thread_num))
+                            .set_max_queue_size(INT32_MAX)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_lake_vacuum_collect_pool));
+
     int num_prepare_threads = config::pipeline_prepare_thread_pool_thread_num;
     if (num_prepare_threads == 0) {
         num_prepare_threads = CpuInfo::num_cores();
@@ -391,6 +410,28 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_dictionary_cache_pool));
 
+    int num_hash_join_build_threads = config::hash_join_build_thread_pool_thread_num;
+    if (num_hash_join_build_threads <= 0) {
+        num_hash_join_build_threads = CpuInfo::num_cores();
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("hash_join_build") // thread pool for linking large hash join tables
+                            .set_min_threads(0)
+                            .set_max_threads(num_hash_join_build_threads)
+                            .set_max_queue_size(INT32_MAX)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_hash_join_build_pool));
+
+    int num_column_parallel_threads = config::column_parallel_thread_pool_thread_num;
+    if (num_column_parallel_threads <= 0) {
+        num_column_parallel_threads = CpuInfo::num_cores();
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("column_parallel") // thread pool for encoding and sorting wide chunks by columns
+                            .set_min_threads(0)
+                            .set_max_threads(num_column_parallel_threads)
+                            .set_max_queue_size(INT32_MAX)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_column_parallel_pool));
+
     std::unique_ptr<ThreadPool> driver_executor_thread_pool;
     _max_executor_threads = CpuInfo::num_cores();
     if (config::pipeline_exec_thread_pool_thread_num > 0) {
@@ -469,6 +510,47 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                     .build(&load_segment_pool));
     _load_segment_thread_pool = load_segment_pool.release();
 
+    std::unique_ptr<ThreadPool> index_prefetch_pool;
+    RETURN_IF_ERROR(
+            ThreadPoolBuilder("index_prefetch")
+                    .set_min_threads(0)
+                    .set_max_threads(config::index_prefetch_thread_num)
+                    .set_max_queue_size(config::load_segment_thread_pool_queue_size)
+                    .set_idle_timeout(MonoDelta::FromMilliseconds(config::streaming_load_thread_pool_idle_time_ms))
+                    .build(&index_prefetch_pool));
+    _index_prefetch_thread_pool = index_prefetch_pool.release();
+
+    std::unique_ptr<ThreadPool> column_read_ahead_pool;
+    RETURN_IF_ERROR(
+            ThreadPoolBuilder("column_read_ahead")
+                    .set_min_threads(0)
+                    .set_max_threads(config::column_read_ahead_thread_num)
+                    .set_idle_timeout(MonoDelta::FromMilliseconds(config::streaming_load_thread_pool_idle_time_ms))
+                    .build(&column_read_ahead_pool));
+    _column_read_ahead_thread_pool = column_read_ahead_pool.release();
+
+    std::unique_ptr<ThreadPool> datacache_prefetch_pool;
+    RETURN_IF_ERROR(
+            ThreadPoolBuilder("datacache_prefetch")
+                    .set_min_threads(0)
+                    .set_max_threads(config::datacache_prefetch_thread_num)
+                    .set_idle_timeout(MonoDelta::FromMilliseconds(config::streaming_load_thread_pool_idle_time_ms))
+                    .build(&datacache_prefetch_pool));
+    _datacache_prefetch_thread_pool = datacache_prefetch_pool.release();
+
+    std::unique_ptr<ThreadPool> scan_io_prefetch_pool;
+    RETURN_IF_ERROR(
+            ThreadPoolBuilder("scan_io_prefetch")
+                    .set_min_threads(0)
+                    .set_max_threads(config::scan_io_prefetch_thread_num)
+                    .set_idle_timeout(MonoDelta::FromMilliseconds(config::streaming_load_thread_pool_idle_time_ms))
+                    .build(&scan_io_prefetch_pool));
+    _scan_io_prefetch_thread_pool = scan_io_prefetch_pool.release();
+
+    // Probe the kernel support of io_uring at startup, which falls back to pread() if not supported.
+    LOG_IF(INFO, config::enable_io_uring) << "io_uring for the batch reads of local files: "
+                                          << (io::IoUringReader::available() ? "enabled" : "not supported");
+
     _broker_mgr = new BrokerMgr(this);
 #ifndef BE_TEST
     _bfd_parser = BfdParser::create();
@@ -488,6 +570,7 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
     _runtime_filter_cache = new RuntimeFilterCache(8);
     RETURN_IF_ERROR(_runtime_filter_cache->init());
     _profile_report_worker = new ProfileReportWorker(this);
+    pipeline::QueryCpuSampler::instance()->start();
     auto runtime_filter_event_func = [] {
         auto pool = ExecEnv::GetInstance()->runtime_filter_worker();
         return (pool == nullptr) ? 0U : pool->queue_size();
@@ -621,11 +704,16 @@ void ExecEnv::stop() {
     if (_profile_report_worker) {
         _profile_report_worker->close();
     }
+    pipeline::QueryCpuSampler::instance()->stop();
 
     if (_automatic_partition_pool) {
         _automatic_partition_pool->shutdown();
     }
 
+    if (_lake_vacuum_collect_pool) {
+        _lake_vacuum_collect_pool->shutdown();
+    }
+
     if (_query_rpc_pool) {
         _query_rpc_pool->shutdown();
     }
@@ -666,6 +754,14 @@ void ExecEnv::stop() {
         _dictionary_cache_pool->shutdown();
     }
 
+    if (_hash_join_build_pool) {
+        _hash_join_build_pool->shutdown();
+    }
+
+    if (_column_parallel_pool) {
+        _column_parallel_pool->shutdown();
+    }
+
 #ifndef BE_TEST
     close_s3_clients();
 #endif
@@ -699,6 +795,10 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_thread_pool);
     SAFE_DELETE(_streaming_load_thread_pool);
     SAFE_DELETE(_load_segment_thread_pool);
+    SAFE_DELETE(_index_prefetch_thread_pool);
+    SAFE_DELETE(_column_read_ahead_thread_pool);
+    SAFE_DELETE(_datacache_prefetch_thread_pool);
+    SAFE_DELETE(_scan_io_prefetch_thread_pool);
 
     if (_lake_tablet_manager != nullptr) {
         _lake_tablet_manager->prune_metacache();
@@ -723,7 +823,10 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_lake_replication_txn_manager);
     SAFE_DELETE(_cache_mgr);
     _dictionary_cache_pool.reset();
+    _hash_join_build_pool.reset();
+    _column_parallel_pool.reset();
     _automatic_partition_pool.reset();
+    _lake_vacuum_collect_pool.reset();
     _metrics = nullptr;
 }
 
@@ -160,7 +160,7 @@ private:
     Status _init_mem_tracker();
     void _reset_tracker();
 
-    void _init_storage_page_cache();
+    Status _init_storage_page_cache();
 
     template <class... Args>
     std::shared_ptr<MemTracker> regist_tracker(Args&&... args);
@@ -272,6 +272,10 @@ public:
     workgroup::ScanExecutor* connector_scan_executor() { return _connector_scan_executor; }
     ThreadPool* load_rowset_thread_pool() { return _load_rowset_thread_pool; }
     ThreadPool* load_segment_thread_pool() { return _load_segment_thread_pool; };
+    ThreadPool* index_prefetch_thread_pool() { return _index_prefetch_thread_pool; }
+    ThreadPool* column_read_ahead_thread_pool() { return _column_read_ahead_thread_pool; }
+    ThreadPool* datacache_prefetch_thread_pool() { return _datacache_prefetch_thread_pool; }
+    ThreadPool* scan_io_prefetch_thread_pool() { return _scan_io_prefetch_thread_pool; }
 
     PriorityThreadPool* udf_call_pool() { return _udf_call_pool; }
     PriorityThreadPool* pipeline_prepare_pool() { return _pipeline_prepare_pool; }
@@ -279,6 +283,8 @@ public:
     PriorityThreadPool* query_rpc_pool() { return _query_rpc_pool; }
     ThreadPool* load_rpc_pool() { return _load_rpc_pool.get(); }
     ThreadPool* dictionary_cache_pool() { return _dictionary_cache_pool.get(); }
+    ThreadPool* hash_join_build_pool() { return _hash_join_build_pool.get(); }
+    ThreadPool* column_parallel_pool() { return _column_parallel_pool.get(); }
     FragmentMgr* fragment_mgr() { return _fragment_mgr; }
     starrocks::pipeline::DriverExecutor* wg_driver_executor() { return _wg_driver_executor; }
     BaseLoadPathMgr* load_path_mgr() { return _load_path_mgr; }
@@ -298,6 +304,7 @@ public:
     HeartbeatFlags* heartbeat_flags() { return _heartbeat_flags; }
 
     ThreadPool* automatic_partition_pool() { return _automatic_partition_pool.get(); }
+    ThreadPool* lake_vacuum_collect_pool() { return _lake_vacuum_collect_pool.get(); }
 
     RuntimeFilterWorker* runtime_filter_worker() { return _runtime_filter_worker; }
 
@@ -354,6 +361,10 @@ private:
 
     ThreadPool* _load_segment_thread_pool = nullptr;
     ThreadPool* _load_rowset_thread_pool = nullptr;
+    ThreadPool* _index_prefetch_thread_pool = nullptr;
+    ThreadPool* _column_read_ahead_thread_pool = nullptr;
+    ThreadPool* _datacache_prefetch_thread_pool = nullptr;
+    ThreadPool* _scan_io_prefetch_thread_pool = nullptr;
 
     workgroup::ScanExecutor* _scan_executor = nullptr;
     workgroup::ScanExecutor* _connector_scan_executor = nullptr;
@@ -364,6 +375,8 @@ private:
     PriorityThreadPool* _query_rpc_pool = nullptr;
     std::unique_ptr<ThreadPool> _load_rpc_pool;
     std::unique_ptr<ThreadPool> _dictionary_cache_pool;
+    std::unique_ptr<ThreadPool> _hash_join_build_pool;
+    std::unique_ptr<ThreadPool> _column_parallel_pool;
     FragmentMgr* _fragment_mgr = nullptr;
     pipeline::QueryContextManager* _query_context_mgr = nullptr;
     pipeline::DriverExecutor* _wg_driver_executor = nullptr;
@@ -388,6 +401,8 @@ private:
     HeartbeatFlags* _heartbeat_flags = nullptr;
 
     std::unique_ptr<ThreadPool> _automatic_partition_pool;
+    // Reads the metadata of the tablets in a lake vacuum request in parallel
+    std::unique_ptr<ThreadPool> _lake_vacuum_collect_pool;
 
     RuntimeFilterWorker* _runtime_filter_worker = nullptr;
     RuntimeFilterCache* _runtime_filter_cache = nullptr;
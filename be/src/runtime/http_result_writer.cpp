@@ -51,20 +51,16 @@ void HttpResultWriter::_init_profile() {
     _sent_rows_counter = ADD_COUNTER(_parent_profile, "NumSentRows", TUnit::UNIT);
 }
 
-// transform one row into json format
-Status HttpResultWriter::_transform_row_to_json(const Columns& result_columns, int idx) {
-    int num_columns = result_columns.size();
-
-    _row_str.append("{\"data\":[");
-    for (auto& result_column : result_columns) {
-        std::string row;
-        ASSIGN_OR_RETURN(row, cast_type_to_json_str(result_column, idx));
-        _row_str.append(row);
-        if (result_column != result_columns[num_columns - 1]) {
-            _row_str.append(",");
-        }
+// transform the values of one column into json format
+Status HttpResultWriter::_transform_column_to_json(const ColumnPtr& column, size_t num_rows, ColumnFields* fields) {
+    auto& offsets = fields->offsets;
+    offsets.resize(num_rows + 1);
+    offsets[0] = 0;
+    for (size_t i = 0; i < num_rows; ++i) {
+        ASSIGN_OR_RETURN(auto value, cast_type_to_json_str(column, i));
+        fields->data.append(value);
+        offsets[i + 1] = fields->data.size();
     }
-    _row_str.append("]}\n");
     return Status::OK();
 }
 
@@ -95,52 +91,24 @@ StatusOr<TFetchDataResultPtrs> HttpResultWriter::process_chunk(Chunk* chunk) {
         result_columns.emplace_back(std::move(column));
     }
 
-    // Step 2: convert chunk to http json row format row by row
+    // Step 2: convert chunk to http json row format column by column, and split the rows into results of
+    // bounded size
     {
         TRY_CATCH_ALLOC_SCOPE_START()
-        _row_str.reserve(128);
-        size_t current_bytes = 0;
-        int current_rows = 0;
         SCOPED_TIMER(_convert_tuple_timer);
-        auto result = std::make_unique<TFetchDataResult>();
-        auto& result_rows = result->result_batch.rows;
-        result_rows.resize(num_rows);
-
-        for (int i = 0; i < num_rows; ++i) {
-            switch (_format_type) {
-            case TResultSinkFormatType::type::JSON:
-                RETURN_IF_ERROR(_transform_row_to_json(result_columns, i));
-                break;
-            case TResultSinkFormatType::type::OTHERS:
-                return Status::NotSupported("HttpResultWriter only support json format right now");
-            }
-            size_t len = _row_str.size();
-
-            if (UNLIKELY(current_bytes + len >= _max_row_buffer_size)) {
-                result_rows.resize(current_rows);
-                results.emplace_back(std::move(result));
-
-                result = std::make_unique<TFetchDataResult>();
-                result_rows = result->result_batch.rows;
-                result_rows.resize(num_rows - i);
-
-                current_bytes = 0;
-                current_rows = 0;
-            }
-
-            // VLOG_ROW << "written row:" << row_str;
-            result_rows[current_rows] = std::move(_row_str);
-            _row_str.clear();
-
-            _row_str.reserve(len * 1.1);
-
-            current_bytes += len;
-            current_rows += 1;
+        switch (_format_type) {
+        case TResultSinkFormatType::type::JSON:
+            break;
+        case TResultSinkFormatType::type::OTHERS:
+            return Status::NotSupported("HttpResultWriter only support json format right now");
         }
-        if (current_rows > 0) {
-            result_rows.resize(current_rows);
-            results.emplace_back(std::move(result));
+        std::vector<ColumnFields> columns(num_columns);
+        for (int i = 0; i < num_columns; ++i) {
+            RETURN_IF_ERROR(_transform_column_to_json(result_columns[i], num_rows, &columns[i]));
         }
+        std::vector<std::string> rows;
+        build_rows(columns, num_rows, Slice("{\"data\":["), Slice(","), Slice("]}\n"), &rows);
+        move_rows_to_results(&rows, _max_row_buffer_size, &results);
         TRY_CATCH_ALLOC_SCOPE_END()
     }
     return results;
@@ -37,7 +37,6 @@
 #include "common/statusor.h"
 #include "runtime/result_writer.h"
 #include "runtime/runtime_state.h"
-#include "util/raw_container.h"
 
 namespace starrocks {
 
@@ -65,12 +64,10 @@ public:
 private:
     void _init_profile();
 
-    Status _transform_row_to_json(const Columns& column, int idx);
+    Status _transform_column_to_json(const ColumnPtr& column, size_t num_rows, ColumnFields* fields);
 
     BufferControlBlock* _sinker;
     const std::vector<ExprContext*>& _output_expr_ctxs;
-
-    raw::RawString _row_str;
     RuntimeProfile* _parent_profile; // parent profile from result sink. not owned
     // total time cost on append chunk operation
     RuntimeProfile::Counter* _append_chunk_timer = nullptr;
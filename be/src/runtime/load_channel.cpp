@@ -302,7 +302,8 @@ Status LoadChannel::_build_chunk_meta(const ChunkPB& pb_chunk) {
 Status LoadChannel::_deserialize_chunk(const ChunkPB& pchunk, Chunk& chunk, faststring* uncompressed_buffer) {
     if (pchunk.compress_type() == CompressionTypePB::NO_COMPRESSION) {
         TRY_CATCH_BAD_ALLOC({
-            serde::ProtobufChunkDeserializer des(_chunk_meta);
+            // the senders only set the encode levels with load_transmission_encode_level
+            serde::ProtobufChunkDeserializer des(_chunk_meta, &pchunk, pchunk.encode_level_size());
             StatusOr<Chunk> res = des.deserialize(pchunk.data());
             if (!res.ok()) return res.status();
             chunk = std::move(res).value();
@@ -320,7 +321,7 @@ Status LoadChannel::_deserialize_chunk(const ChunkPB& pchunk, Chunk& chunk, fast
         {
             TRY_CATCH_BAD_ALLOC({
                 std::string_view buff(reinterpret_cast<const char*>(uncompressed_buffer->data()), uncompressed_size);
-                serde::ProtobufChunkDeserializer des(_chunk_meta);
+                serde::ProtobufChunkDeserializer des(_chunk_meta, &pchunk, pchunk.encode_level_size());
                 StatusOr<Chunk> res = Status::OK();
                 TRY_CATCH_BAD_ALLOC(res = des.deserialize(buff));
                 if (!res.ok()) return res.status();
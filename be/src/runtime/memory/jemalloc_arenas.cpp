@@ -0,0 +1,176 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/jemalloc_arenas.h"
+
+#include <fmt/format.h>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "jemalloc/jemalloc.h"
+
+namespace starrocks {
+
+JemallocArenas* JemallocArenas::instance() {
+    static JemallocArenas s_instance;
+    return &s_instance;
+}
+
+Status JemallocArenas::init() {
+#if defined(ADDRESS_SANITIZER) || defined(LEAK_SANITIZER) || defined(THREAD_SANITIZER)
+    return Status::OK();
+#else
+    if (!config::enable_jemalloc_arena_per_memory_class || _enabled) {
+        return Status::OK();
+    }
+    std::array<unsigned, kNumClasses> indexes{};
+    std::array<int, kNumClasses> flags{};
+    for (size_t i = 0; i < kNumClasses; i++) {
+        if (static_cast<MemoryClass>(i) == MemoryClass::QUERY) {
+            continue;
+        }
+        unsigned index = 0;
+        size_t sz = sizeof(index);
+        if (je_mallctl("arenas.create", &index, &sz, nullptr, 0) != 0) {
+            return Status::InternalError(
+                    fmt::format("failed to create jemalloc arena for {}", name(static_cast<MemoryClass>(i))));
+        }
+        indexes[i] = index;
+        // Skip the thread cache so that the freed memory of a class goes back to its own arena
+        // instead of being reused by the other classes through the tcache.
+        flags[i] = MALLOCX_ARENA(index) | MALLOCX_TCACHE_NONE;
+        LOG(INFO) << "created jemalloc arena " << index << " for memory class " << name(static_cast<MemoryClass>(i));
+    }
+    _arena_indexes = indexes;
+    _flags = flags;
+    _enabled = true;
+    return Status::OK();
+#endif
+}
+
+void JemallocArenas::purge(MemoryClass cls) {
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+    if (!_enabled) {
+        return;
+    }
+    if (cls != MemoryClass::QUERY) {
+        auto key = fmt::format("arena.{}.purge", _arena_indexes[static_cast<size_t>(cls)]);
+        je_mallctl(key.c_str(), nullptr, nullptr, nullptr, 0);
+        return;
+    }
+    unsigned narenas = 0;
+    size_t sz = sizeof(narenas);
+    if (je_mallctl("opt.narenas", &narenas, &sz, nullptr, 0) != 0) {
+        return;
+    }
+    for (unsigned i = 0; i < narenas; i++) {
+        auto key = fmt::format("arena.{}.purge", i);
+        je_mallctl(key.c_str(), nullptr, nullptr, nullptr, 0);
+    }
+#endif
+}
+
+int64_t JemallocArenas::purge_dirty_arenas() {
+    if (!_enabled) {
+        return 0;
+    }
+    refresh_stats();
+    int64_t purged = 0;
+    for (size_t i = 0; i < kNumClasses; i++) {
+        auto cls = static_cast<MemoryClass>(i);
+        if (cls == MemoryClass::QUERY) {
+            continue;
+        }
+        int64_t dirty_bytes = stats(cls).dirty_bytes;
+        if (dirty_bytes > config::jemalloc_arena_purge_dirty_bytes) {
+            purge(cls);
+            purged += dirty_bytes;
+        }
+    }
+    return purged;
+}
+
+void JemallocArenas::refresh_stats() {
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+    uint64_t epoch = 1;
+    size_t sz = sizeof(epoch);
+    je_mallctl("epoch", &epoch, &sz, &epoch, sz);
+#endif
+}
+
+JemallocArenas::Stats JemallocArenas::_arena_stats(unsigned arena_index) {
+    Stats stats;
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+    size_t page_size = 0;
+    size_t sz = sizeof(page_size);
+    if (je_mallctl("arenas.page", &page_size, &sz, nullptr, 0) != 0) {
+        return stats;
+    }
+    size_t value = 0;
+    sz = sizeof(value);
+    if (je_mallctl(fmt::format("stats.arenas.{}.pactive", arena_index).c_str(), &value, &sz, nullptr, 0) == 0) {
+        stats.active_bytes = value * page_size;
+    }
+    if (je_mallctl(fmt::format("stats.arenas.{}.pdirty", arena_index).c_str(), &value, &sz, nullptr, 0) == 0) {
+        stats.dirty_bytes = value * page_size;
+    }
+    if (je_mallctl(fmt::format("stats.arenas.{}.pmuzzy", arena_index).c_str(), &value, &sz, nullptr, 0) == 0) {
+        stats.muzzy_bytes = value * page_size;
+    }
+    if (je_mallctl(fmt::format("stats.arenas.{}.mapped", arena_index).c_str(), &value, &sz, nullptr, 0) == 0) {
+        stats.mapped_bytes = value;
+    }
+#endif
+    return stats;
+}
+
+JemallocArenas::Stats JemallocArenas::stats(MemoryClass cls) const {
+    if (cls != MemoryClass::QUERY) {
+        return _enabled ? _arena_stats(_arena_indexes[static_cast<size_t>(cls)]) : Stats();
+    }
+    Stats stats;
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+    // QUERY owns all the automatic arenas.
+    unsigned narenas = 0;
+    size_t sz = sizeof(narenas);
+    if (je_mallctl("opt.narenas", &narenas, &sz, nullptr, 0) != 0) {
+        return stats;
+    }
+    for (unsigned i = 0; i < narenas; i++) {
+        auto arena = _arena_stats(i);
+        stats.active_bytes += arena.active_bytes;
+        stats.dirty_bytes += arena.dirty_bytes;
+        stats.muzzy_bytes += arena.muzzy_bytes;
+        stats.mapped_bytes += arena.mapped_bytes;
+    }
+#endif
+    return stats;
+}
+
+const char* JemallocArenas::name(MemoryClass cls) {
+    switch (cls) {
+    case MemoryClass::QUERY:
+        return "query";
+    case MemoryClass::STORAGE_CACHE:
+        return "storage_cache";
+    case MemoryClass::METADATA:
+        return "metadata";
+    case MemoryClass::LOAD:
+        return "load";
+    default:
+        return "unknown";
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,96 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "common/status.h"
+#include "gutil/macros.h"
+
+namespace starrocks {
+
+// The classes of memory that are allocated from their own jemalloc arenas when
+// enable_jemalloc_arena_per_memory_class is on. The long-lived pages of the storage caches and the metadata
+// then do not fragment the arenas of the query execution, and the dirty pages of each class are purged
+// independently. QUERY is served by the automatic arenas of jemalloc.
+enum class MemoryClass : uint8_t { QUERY = 0, STORAGE_CACHE, METADATA, LOAD, NUM_CLASSES };
+
+// The mallocx flags of the memory class bound to the current thread, 0 means the automatic arenas.
+// Read by the malloc hooks on every allocation.
+inline thread_local int tls_jemalloc_arena_flags = 0;
+
+class JemallocArenas {
+public:
+    static constexpr size_t kNumClasses = static_cast<size_t>(MemoryClass::NUM_CLASSES);
+
+    struct Stats {
+        int64_t active_bytes = 0;
+        int64_t dirty_bytes = 0;
+        int64_t muzzy_bytes = 0;
+        int64_t mapped_bytes = 0;
+    };
+
+    static JemallocArenas* instance();
+
+    // Create one arena for each memory class except QUERY. Does nothing if the config is off.
+    Status init();
+
+    bool enabled() const { return _enabled; }
+
+    // The mallocx flags to allocate memory of |cls|, 0 if the class has no dedicated arena.
+    int mallocx_flags(MemoryClass cls) const { return _flags[static_cast<size_t>(cls)]; }
+
+    // Return the dirty and muzzy pages of the arenas of |cls| to the OS.
+    void purge(MemoryClass cls);
+
+    // Purge the dedicated arenas whose dirty pages exceed jemalloc_arena_purge_dirty_bytes.
+    // Returns the number of dirty bytes purged.
+    int64_t purge_dirty_arenas();
+
+    // Refreshes the statistics of jemalloc, so call it once before reading the stats of the classes.
+    static void refresh_stats();
+
+    Stats stats(MemoryClass cls) const;
+
+    static const char* name(MemoryClass cls);
+
+private:
+    JemallocArenas() = default;
+
+    static Stats _arena_stats(unsigned arena_index);
+
+    bool _enabled = false;
+    std::array<unsigned, kNumClasses> _arena_indexes{};
+    std::array<int, kNumClasses> _flags{};
+};
+
+// Binds the allocations of the current thread to the arenas of a memory class until the end of the scope.
+class ScopedMemoryClass {
+public:
+    explicit ScopedMemoryClass(MemoryClass cls) : _prev_flags(tls_jemalloc_arena_flags) {
+        tls_jemalloc_arena_flags = JemallocArenas::instance()->mallocx_flags(cls);
+    }
+    ~ScopedMemoryClass() { tls_jemalloc_arena_flags = _prev_flags; }
+
+private:
+    DISALLOW_COPY_AND_MOVE(ScopedMemoryClass);
+
+    int _prev_flags;
+};
+
+#define SCOPED_MEMORY_CLASS(cls) ScopedMemoryClass VARNAME_LINENUM(scoped_memory_class)(cls)
+
+} // namespace starrocks
@@ -37,6 +37,7 @@
 #include <memory>
 #include <mutex>
 
+#include "common/config.h"
 #include "gutil/dynamic_annotations.h"
 #include "runtime/current_thread.h"
 #include "runtime/memory/mem_chunk.h"
@@ -55,6 +56,7 @@ MemChunkAllocator* MemChunkAllocator::_s_instance = nullptr;
 
 static IntCounter local_core_alloc_count(MetricUnit::NOUNIT);
 static IntCounter other_core_alloc_count(MetricUnit::NOUNIT);
+static IntCounter other_numa_node_alloc_count(MetricUnit::NOUNIT);
 static IntCounter system_alloc_count(MetricUnit::NOUNIT);
 static IntCounter system_free_count(MetricUnit::NOUNIT);
 static IntCounter system_alloc_cost_ns(MetricUnit::NANOSECONDS);
@@ -130,6 +132,7 @@ void MemChunkAllocator::init_instance(MemTracker* mem_tracker, size_t reserve_li
 
     REGISTER_METIRC(local_core_alloc_count);
     REGISTER_METIRC(other_core_alloc_count);
+    REGISTER_METIRC(other_numa_node_alloc_count);
     REGISTER_METIRC(system_alloc_count);
     REGISTER_METIRC(system_free_count);
     REGISTER_METIRC(system_alloc_cost_ns);
@@ -175,15 +178,36 @@ bool MemChunkAllocator::allocate(size_t size, MemChunk* chunk) {
         ret = true;
         return ret;
     }
+    const int numa_node = CpuInfo::get_numa_node_of_core(core_id);
     if (_reserved_bytes > size) {
+        // try to allocate from the arenas of the other cores on the same NUMA node
+        for (int other_core_id : CpuInfo::get_cores_of_numa_node(numa_node)) {
+            if (other_core_id != core_id && _arenas[other_core_id]->pop_free_chunk(size, &chunk->data)) {
+                _reserved_bytes.fetch_sub(size);
+                other_core_alloc_count.increment(1);
+                // reset chunk's core_id to other
+                chunk->core_id = other_core_id;
+                ret = true;
+                return ret;
+            }
+        }
+    }
+    // The chunks freed on other NUMA nodes are remote memory, so they are not reused in NUMA aware mode,
+    // and the chunk is allocated from system allocator and touched first by the current node instead.
+    if (_reserved_bytes > size && !config::enable_numa_aware_scheduling) {
         // try to allocate from other core's arena
         ++core_id;
         for (int i = 1; i < _arenas.size(); ++i, ++core_id) {
-            if (_arenas[core_id % _arenas.size()]->pop_free_chunk(size, &chunk->data)) {
+            const int other_core_id = core_id % _arenas.size();
+            if (CpuInfo::get_numa_node_of_core(other_core_id) == numa_node) {
+                continue;
+            }
+            if (_arenas[other_core_id]->pop_free_chunk(size, &chunk->data)) {
                 _reserved_bytes.fetch_sub(size);
                 other_core_alloc_count.increment(1);
+                other_numa_node_alloc_count.increment(1);
                 // reset chunk's core_id to other
-                chunk->core_id = core_id % _arenas.size();
+                chunk->core_id = other_core_id;
                 ret = true;
                 return ret;
             }
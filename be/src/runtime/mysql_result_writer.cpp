@@ -65,6 +65,7 @@ Status MysqlResultWriter::init(RuntimeState* state) {
     }
 
     _row_buffer = new (std::nothrow) MysqlRowBuffer(_is_binary_format);
+    _column_buffer_hint.assign(_output_expr_ctxs.size(), 128);
 
     if (nullptr == _row_buffer) {
         return Status::InternalError("no memory to alloc.");
@@ -112,15 +113,8 @@ Status MysqlResultWriter::close() {
     return Status::OK();
 }
 
-StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
-    SCOPED_TIMER(_append_chunk_timer);
-    int num_rows = chunk->num_rows();
-    auto result = std::make_unique<TFetchDataResult>();
-    auto& result_rows = result->result_batch.rows;
-    result_rows.resize(num_rows);
-
+StatusOr<Columns> MysqlResultWriter::_evaluate_output_exprs(Chunk* chunk) {
     Columns result_columns;
-    // Step 1: compute expr
     int num_columns = _output_expr_ctxs.size();
     result_columns.reserve(num_columns);
 
@@ -131,93 +125,72 @@ StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
                          : column;
         result_columns.emplace_back(std::move(column));
     }
+    return result_columns;
+}
 
-    // Step 2: convert chunk to mysql row format row by row
-    {
-        _row_buffer->reserve(128);
-        SCOPED_TIMER(_convert_tuple_timer);
-        for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
-            if (_is_binary_format) {
-                _row_buffer->start_binary_row(num_columns);
-            };
-            for (auto& result_column : result_columns) {
-                if (_is_binary_format && !result_column->is_nullable()) {
-                    _row_buffer->update_field_pos();
-                }
-                result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
+void MysqlResultWriter::_convert_to_rows(const Columns& result_columns, size_t num_rows,
+                                         std::vector<std::string>* rows) {
+    SCOPED_TIMER(_convert_tuple_timer);
+    if (!_is_binary_format) {
+        // The text protocol keeps no state across the fields of a row, so serialize the result column by column,
+        // and then assemble the rows from the fields in a single pass.
+        std::vector<ColumnFields> columns(result_columns.size());
+        for (size_t col = 0; col < result_columns.size(); col++) {
+            auto& offsets = columns[col].offsets;
+            offsets.resize(num_rows + 1);
+            offsets[0] = 0;
+            _row_buffer->reserve(_column_buffer_hint[col]);
+            for (size_t i = 0; i < num_rows; ++i) {
+                result_columns[col]->put_mysql_row_buffer(_row_buffer, i, false);
+                offsets[i + 1] = _row_buffer->length();
             }
-            size_t len = _row_buffer->length();
-            _row_buffer->move_content(&result_rows[i]);
-            _row_buffer->reserve(len * 1.1);
+            _column_buffer_hint[col] = offsets[num_rows] * 1.1;
+            _row_buffer->move_content(&columns[col].data);
         }
+        build_rows(columns, num_rows, Slice(), Slice(), Slice(), rows);
+        return;
     }
+
+    // The binary protocol tracks the null bitmap of a row, so it is converted row by row.
+    rows->resize(num_rows);
+    _row_buffer->reserve(128);
+    for (size_t i = 0; i < num_rows; ++i) {
+        DCHECK_EQ(0, _row_buffer->length());
+        _row_buffer->start_binary_row(result_columns.size());
+        for (auto& result_column : result_columns) {
+            if (!result_column->is_nullable()) {
+                _row_buffer->update_field_pos();
+            }
+            result_column->put_mysql_row_buffer(_row_buffer, i, true);
+        }
+        size_t len = _row_buffer->length();
+        _row_buffer->move_content(&(*rows)[i]);
+        _row_buffer->reserve(len * 1.1);
+    }
+}
+
+StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
+    SCOPED_TIMER(_append_chunk_timer);
+    auto result = std::make_unique<TFetchDataResult>();
+    // Step 1: compute expr
+    ASSIGN_OR_RETURN(auto result_columns, _evaluate_output_exprs(chunk));
+    // Step 2: convert chunk to mysql row format
+    _convert_to_rows(result_columns, chunk->num_rows(), &result->result_batch.rows);
     return result;
 }
 
 StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
     SCOPED_TIMER(_append_chunk_timer);
-    int num_rows = chunk->num_rows();
     std::vector<TFetchDataResultPtr> results;
-
-    Columns result_columns;
     // Step 1: compute expr
-    int num_columns = _output_expr_ctxs.size();
-    result_columns.reserve(num_columns);
-
-    for (int i = 0; i < num_columns; ++i) {
-        ASSIGN_OR_RETURN(ColumnPtr column, _output_expr_ctxs[i]->evaluate(chunk));
-        column = _output_expr_ctxs[i]->root()->type().type == TYPE_TIME
-                         ? ColumnHelper::convert_time_column_from_double_to_str(column)
-                         : column;
-        result_columns.emplace_back(std::move(column));
-    }
+    ASSIGN_OR_RETURN(auto result_columns, _evaluate_output_exprs(chunk));
 
-    // Step 2: convert chunk to mysql row format row by row
+    // Step 2: convert chunk to mysql row format, and split the rows into results of bounded size
     {
         TRY_CATCH_ALLOC_SCOPE_START()
-        _row_buffer->reserve(128);
-        size_t current_bytes = 0;
-        int current_rows = 0;
-        SCOPED_TIMER(_convert_tuple_timer);
-        auto result = std::make_unique<TFetchDataResult>();
-        auto& result_rows = result->result_batch.rows;
-        result_rows.resize(num_rows);
-
-        for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
-            if (_is_binary_format) {
-                _row_buffer->start_binary_row(num_columns);
-            }
-            for (auto& result_column : result_columns) {
-                if (_is_binary_format && !result_column->is_nullable()) {
-                    _row_buffer->update_field_pos();
-                }
-                result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
-            }
-            size_t len = _row_buffer->length();
-
-            if (UNLIKELY(current_bytes + len >= _max_row_buffer_size)) {
-                result_rows.resize(current_rows);
-                results.emplace_back(std::move(result));
-
-                result = std::make_unique<TFetchDataResult>();
-                result_rows = result->result_batch.rows;
-                result_rows.resize(num_rows - i);
-
-                current_bytes = 0;
-                current_rows = 0;
-            }
-            _row_buffer->move_content(&result_rows[current_rows]);
-            _row_buffer->reserve(len * 1.1);
-
-            current_bytes += len;
-            current_rows += 1;
-        }
-        if (current_rows > 0) {
-            result_rows.resize(current_rows);
-            results.emplace_back(std::move(result));
-        }
+        std::vector<std::string> rows;
+        _convert_to_rows(result_columns, chunk->num_rows(), &rows);
+        move_rows_to_results(&rows, _max_row_buffer_size, &results);
         TRY_CATCH_ALLOC_SCOPE_END()
     }
     return results;
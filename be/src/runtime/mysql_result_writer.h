@@ -68,11 +68,15 @@ private:
     void _init_profile();
     // this function is only used in non-pipeline engine
     StatusOr<TFetchDataResultPtr> _process_chunk(Chunk* chunk);
+    StatusOr<Columns> _evaluate_output_exprs(Chunk* chunk);
+    void _convert_to_rows(const Columns& result_columns, size_t num_rows, std::vector<std::string>* rows);
 
     BufferControlBlock* _sinker;
     const std::vector<ExprContext*>& _output_expr_ctxs;
     MysqlRowBuffer* _row_buffer;
     bool _is_binary_format;
+    // the reserved size of the text protocol buffer of each column, from the size of the last chunk
+    std::vector<size_t> _column_buffer_hint;
 
     RuntimeProfile* _parent_profile; // parent profile from result sink. not owned
     // total time cost on append chunk operation
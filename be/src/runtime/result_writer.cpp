@@ -0,0 +1,96 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/result_writer.h"
+
+#include <algorithm>
+
+#include "common/logging.h"
+#include "gutil/strings/fastmem.h"
+#include "util/raw_container.h"
+
+namespace starrocks {
+
+void ResultWriter::build_rows(const std::vector<ColumnFields>& columns, size_t num_rows, const Slice& prefix,
+                              const Slice& separator, const Slice& suffix, std::vector<std::string>* rows) {
+    DCHECK(std::all_of(columns.begin(), columns.end(),
+                       [num_rows](const auto& column) { return column.offsets.size() == num_rows + 1; }));
+    const size_t num_separators = columns.empty() ? 0 : columns.size() - 1;
+    const size_t fixed_length = prefix.size + num_separators * separator.size + suffix.size;
+
+    // 1. allocate each row once with its total length
+    rows->resize(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        size_t length = fixed_length;
+        for (const auto& column : columns) {
+            length += column.offsets[i + 1] - column.offsets[i];
+        }
+        raw::stl_string_resize_uninitialized(&(*rows)[i], length);
+    }
+
+    // 2. fill the rows column by column
+    std::vector<char*> positions(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        positions[i] = (*rows)[i].data();
+        strings::memcpy_inlined(positions[i], prefix.data, prefix.size);
+        positions[i] += prefix.size;
+    }
+    for (size_t col = 0; col < columns.size(); col++) {
+        const char* data = columns[col].data.data();
+        const auto& offsets = columns[col].offsets;
+        const bool append_separator = col + 1 < columns.size();
+        for (size_t i = 0; i < num_rows; i++) {
+            const size_t length = offsets[i + 1] - offsets[i];
+            strings::memcpy_inlined(positions[i], data + offsets[i], length);
+            positions[i] += length;
+            if (append_separator) {
+                strings::memcpy_inlined(positions[i], separator.data, separator.size);
+                positions[i] += separator.size;
+            }
+        }
+    }
+    for (size_t i = 0; i < num_rows; i++) {
+        strings::memcpy_inlined(positions[i], suffix.data, suffix.size);
+    }
+}
+
+void ResultWriter::move_rows_to_results(std::vector<std::string>* rows, size_t max_bytes,
+                                        TFetchDataResultPtrs* results) {
+    size_t total_bytes = 0;
+    for (const auto& row : *rows) {
+        total_bytes += row.size();
+    }
+    if (total_bytes < max_bytes) {
+        auto result = std::make_unique<TFetchDataResult>();
+        result->result_batch.rows = std::move(*rows);
+        results->emplace_back(std::move(result));
+        return;
+    }
+
+    auto result = std::make_unique<TFetchDataResult>();
+    size_t current_bytes = 0;
+    for (auto& row : *rows) {
+        if (current_bytes + row.size() >= max_bytes && !result->result_batch.rows.empty()) {
+            results->emplace_back(std::move(result));
+            result = std::make_unique<TFetchDataResult>();
+            current_bytes = 0;
+        }
+        current_bytes += row.size();
+        result->result_batch.rows.emplace_back(std::move(row));
+    }
+    results->emplace_back(std::move(result));
+    rows->clear();
+}
+
+} // namespace starrocks
@@ -39,6 +39,7 @@
 #include "common/statusor.h"
 #include "gen_cpp/InternalService_types.h"
 #include "gen_cpp/PlanNodes_types.h"
+#include "util/slice.h"
 
 namespace starrocks {
 
@@ -78,6 +79,22 @@ public:
     int64_t get_written_rows() const { return _written_rows; }
 
 protected:
+    // The fields of one column of the result rows, the field of row i is data[offsets[i], offsets[i + 1]).
+    struct ColumnFields {
+        std::string data;
+        std::vector<size_t> offsets;
+    };
+
+    // Build the rows from the fields of each column. Each row is allocated once with its total length, and then
+    // filled column by column with the fields, which are separated by |separator| and enclosed by |prefix| and
+    // |suffix|.
+    static void build_rows(const std::vector<ColumnFields>& columns, size_t num_rows, const Slice& prefix,
+                           const Slice& separator, const Slice& suffix, std::vector<std::string>* rows);
+
+    // Move |rows| into the results of less than |max_bytes| each, or of one row if the row is not less.
+    static void move_rows_to_results(std::vector<std::string>* rows, size_t max_bytes,
+                                     TFetchDataResultPtrs* results);
+
     int64_t _written_rows = 0; // number of rows written
 };
 
@@ -34,6 +34,9 @@
 
 #pragma once
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "runtime/routine_load/data_consumer.h"
 #include "util/blocking_queue.hpp"
 #include "util/priority_thread_pool.hpp"
@@ -80,7 +83,8 @@ protected:
 // for kafka
 class KafkaDataConsumerGroup : public DataConsumerGroup {
 public:
-    KafkaDataConsumerGroup(size_t sz) : DataConsumerGroup(sz), _queue(500) {}
+    KafkaDataConsumerGroup(size_t sz)
+            : DataConsumerGroup(sz), _queue(std::max(1, config::routine_load_consumer_group_queue_size)) {}
 
     ~KafkaDataConsumerGroup() override;
 
@@ -101,7 +105,8 @@ private:
 // for pulsar
 class PulsarDataConsumerGroup : public DataConsumerGroup {
 public:
-    PulsarDataConsumerGroup(size_t sz) : DataConsumerGroup(sz), _queue(500) {}
+    PulsarDataConsumerGroup(size_t sz)
+            : DataConsumerGroup(sz), _queue(std::max(1, config::routine_load_consumer_group_queue_size)) {}
 
     ~PulsarDataConsumerGroup() override;
 
@@ -38,6 +38,7 @@
 #include <memory>
 #include <thread>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "runtime/routine_load/data_consumer_group.h"
 #include "runtime/routine_load/kafka_consumer_pipe.h"
@@ -379,7 +380,7 @@ void RoutineLoadTaskExecutor::exec_task(StreamLoadContext* ctx, DataConsumerPool
     std::shared_ptr<StreamLoadPipe> pipe;
     switch (ctx->load_src_type) {
     case TLoadSourceType::KAFKA: {
-        pipe = std::make_shared<KafkaConsumerPipe>();
+        pipe = std::make_shared<KafkaConsumerPipe>(std::max<int64_t>(1, config::routine_load_pipe_max_buffered_bytes));
         Status st = std::static_pointer_cast<KafkaDataConsumerGroup>(consumer_grp)->assign_topic_partitions(ctx);
         if (!st.ok()) {
             err_handler(ctx, st, st.message());
@@ -389,7 +390,7 @@ void RoutineLoadTaskExecutor::exec_task(StreamLoadContext* ctx, DataConsumerPool
         break;
     }
     case TLoadSourceType::PULSAR: {
-        pipe = std::make_shared<PulsarConsumerPipe>();
+        pipe = std::make_shared<PulsarConsumerPipe>(std::max<int64_t>(1, config::routine_load_pipe_max_buffered_bytes));
         Status st = std::static_pointer_cast<PulsarDataConsumerGroup>(consumer_grp)->assign_topic_partitions(ctx);
         if (!st.ok()) {
             err_handler(ctx, st, st.message());
@@ -315,6 +315,30 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
     _send_total_runtime_filter(rf_version, filter_id);
 }
 
+// The global runtime filter is broadcast along a tree, every node sends it to some targets directly, and each of
+// them forwards it to a part of the rest targets. `remaining` is the number of the targets not sent yet, `sent` is
+// the number of the targets this node has sent to directly. Return how many of the remaining targets after the next
+// one are forwarded by the next one.
+// Small filters are split in halves, so the tree has the least depth, but a node sends log2(n) copies. Large filters
+// are split into at most runtime_filter_broadcast_max_fanout subtrees, which bounds the bytes every node sends.
+static size_t num_forward_targets(size_t remaining, size_t sent, size_t data_size) {
+    if (remaining == 0) {
+        return 0;
+    }
+    const int64_t max_fanout = config::runtime_filter_broadcast_max_fanout;
+    if (max_fanout <= 0 ||
+        static_cast<int64_t>(data_size) < config::runtime_filter_broadcast_bounded_fanout_min_bytes) {
+        return remaining / 2;
+    }
+    if (static_cast<int64_t>(sent) + 1 >= max_fanout) {
+        // the last subtree takes all the rest.
+        return remaining - 1;
+    }
+    // split the rest evenly into the subtrees left.
+    const size_t subtrees = static_cast<size_t>(max_fanout) - sent;
+    return (remaining + subtrees - 1) / subtrees - 1;
+}
+
 struct BatchClosuresJoinAndClean {
 public:
     BatchClosuresJoinAndClean(RuntimeFilterRpcClosures& closures) : _closures(closures) {}
@@ -408,6 +432,7 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
               << ", send-first = " << status->broadcast_filter_ts - status->recv_first_filter_ts << ")"
               << ", filter = " << out->debug_string();
     request.set_broadcast_timestamp(now);
+    request.set_merge_latency_ms(status->broadcast_filter_ts - status->recv_first_filter_ts);
 
     std::map<TNetworkAddress, std::vector<TUniqueId>> nodes_to_frag_insts;
     for (const auto& node : (*target_nodes)) {
@@ -443,6 +468,8 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
 
     size_t index = 0;
     size_t size = targets.size();
+    // the number of remote targets sent directly.
+    size_t num_sent = 0;
 
     RuntimeFilterRpcClosures rpc_closures;
     rpc_closures.reserve(size);
@@ -460,7 +487,7 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
 
         // add forward targets.
         // forward [index+1, index+1+half) to [index]
-        size_t half = (size - index) / 2;
+        size_t half = num_forward_targets(size - index, num_sent, send_data->size());
         // if X->X, and we split into two half [A, B]
         // then in next step,  X->A, and X->B, which is in-efficient
         // so if X->X, we don't do split.
@@ -485,6 +512,7 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
         }
 
         index += (1 + half);
+        num_sent += !is_local;
         _exec_env->add_rf_event({request.query_id(), request.filter_id(), t.first.hostname, "SEND_TOTAL_RF_RPC"});
         rpc_closures.push_back(new RuntimeFilterRpcClosure);
         auto* closure = rpc_closures.back();
@@ -678,6 +706,12 @@ void RuntimeFilterWorker::_receive_total_runtime_filter(PTransmitRuntimeFilterPa
         return;
     }
     rf->set_global();
+    if (request.has_broadcast_timestamp()) {
+        // the clocks of the merge node and this node may differ a little.
+        int64_t broadcast_latency_ms = std::max<int64_t>(0, UnixMillis() - request.broadcast_timestamp());
+        rf->set_global_latency(request.has_merge_latency_ms() ? request.merge_latency_ms() : -1,
+                               broadcast_latency_ms);
+    }
     std::shared_ptr<JoinRuntimeFilter> shared_rf(rf);
     // for pipeline engine
     if (request.has_is_pipeline() && request.is_pipeline()) {
@@ -696,6 +730,7 @@ void RuntimeFilterWorker::_receive_total_runtime_filter(PTransmitRuntimeFilterPa
     }
 
     size_t index = 0;
+    size_t num_sent = 0;
     RuntimeFilterRpcClosures rpc_closures;
     rpc_closures.reserve(size);
     BatchClosuresJoinAndClean join_and_clean(rpc_closures);
@@ -714,7 +749,7 @@ void RuntimeFilterWorker::_receive_total_runtime_filter(PTransmitRuntimeFilterPa
         }
 
         // add forward targets.
-        size_t half = (size - index) / 2;
+        size_t half = num_forward_targets(size - index, num_sent++, data.size());
         for (size_t i = 0; i < half; i++) {
             PTransmitRuntimeFilterForwardTarget* fwd = request.add_forward_targets();
             *fwd = targets[index + 1 + i];
@@ -364,6 +364,9 @@ public:
     bool enable_nl_join_spill() const {
         return _query_options.spillable_operator_mask & (1LL << TSpillableOperatorType::NL_JOIN);
     }
+    bool enable_analytic_spill() const {
+        return _query_options.spillable_operator_mask & (1LL << TSpillableOperatorType::ANALYTIC);
+    }
 
     int32_t spill_mem_table_size() const { return _query_options.spill_mem_table_size; }
 
@@ -697,7 +697,6 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
         DCHECK(!request.has_is_pipeline_level_shuffle() && !request.is_pipeline_level_shuffle());
     }
     const bool use_pass_through = request.use_pass_through();
-    DCHECK(!(keep_order && use_pass_through));
     DCHECK(request.chunks_size() > 0 || use_pass_through);
     if (_is_cancelled || _num_remaining_senders <= 0) {
         VLOG_ROW << print_id(request.finst_id()) << " adds chunks to "
@@ -714,13 +713,16 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
     // there is no chance to handle deserialize error, so the lazy deserialization is not supported now,
     // we can change related interface's defination to do this later.
     ChunkList chunks;
-    ASSIGN_OR_RETURN(chunks,
-                     use_pass_through
-                             ? get_chunks_from_pass_through(request.sender_id(), total_chunk_bytes)
-                             : (keep_order ? get_chunks_from_request<true>(request, metrics, total_chunk_bytes)
-                                           : get_chunks_from_request<false>(request, metrics, total_chunk_bytes)));
-    COUNTER_UPDATE(use_pass_through ? metrics.bytes_pass_through_counter : metrics.bytes_received_counter,
-                   total_chunk_bytes);
+    // To keep order, the chunks passed through are pulled under the lock below, see the comment there.
+    if (!(keep_order && use_pass_through)) {
+        ASSIGN_OR_RETURN(chunks,
+                         use_pass_through
+                                 ? get_chunks_from_pass_through(request.sender_id(), total_chunk_bytes)
+                                 : (keep_order ? get_chunks_from_request<true>(request, metrics, total_chunk_bytes)
+                                               : get_chunks_from_request<false>(request, metrics, total_chunk_bytes)));
+        COUNTER_UPDATE(use_pass_through ? metrics.bytes_pass_through_counter : metrics.bytes_received_counter,
+                       total_chunk_bytes);
+    }
 
     if (_is_cancelled) {
         return Status::OK();
@@ -738,37 +740,8 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
             return Status::OK();
         }
 
-        _max_processed_sequences.lazy_emplace(be_number, [be_number](const auto& ctor) { ctor(be_number, -1); });
-
-        _buffered_chunk_queues.lazy_emplace(be_number, [be_number](const auto& ctor) {
-            ctor(be_number, phmap::flat_hash_map<int64_t, ChunkList>());
-        });
-
-        auto& chunk_queues = _buffered_chunk_queues[be_number];
-
-        if (!chunks.empty() && done != nullptr && _recvr->exceeds_limit(total_chunk_bytes)) {
-            chunks.back().closure = *done;
-            chunks.back().queue_enter_time = MonotonicNanos();
-            COUNTER_UPDATE(metrics.closure_block_counter, 1);
-            *done = nullptr;
-        }
-
-        // The queue in chunk_queues cannot be changed, so it must be
-        // assigned to chunk_queues after local_chunk_queue is initialized
-        // Otherwise, other threads may see the intermediate state because
-        // the initialization of local_chunk_queue is beyond mutex
-        chunk_queues[sequence] = std::move(chunks);
-
-        phmap::flat_hash_map<int64_t, ChunkList>::iterator it;
-        int64_t& max_processed_sequence = _max_processed_sequences[be_number];
-
-        // max_processed_sequence + 1 means the first unprocessed sequence
-        while ((it = chunk_queues.find(max_processed_sequence + 1)) != chunk_queues.end()) {
-            ChunkList& unprocessed_chunk_queue = (*it).second;
-
-            // Now, all the packets with sequance <= unprocessed_sequence have been received
-            // so chunks of unprocessed_sequence can be flushed to ready queue
-            for (auto& item : unprocessed_chunk_queue) {
+        auto enqueue_chunks = [&](ChunkList& ready_chunks) {
+            for (auto& item : ready_chunks) {
                 size_t chunk_bytes = item.chunk_bytes;
                 auto* closure = item.closure;
                 _chunk_queues[0].enqueue(*_producer_token, std::move(item));
@@ -777,9 +750,57 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
                 _recvr->_num_buffered_bytes += chunk_bytes;
                 COUNTER_ADD(metrics.peak_buffer_mem_bytes, chunk_bytes);
             }
+        };
+
+        if (use_pass_through) {
+            // A request may pull the chunks appended for the requests after it, so the sequences of the requests
+            // say nothing about the order of the chunks passed through. Instead, the chunks of a sender are
+            // pulled in the order they are appended, and they keep it if they are enqueued under the same lock.
+            ASSIGN_OR_RETURN(chunks, get_chunks_from_pass_through(request.sender_id(), total_chunk_bytes));
+            COUNTER_UPDATE(metrics.bytes_pass_through_counter, total_chunk_bytes);
+            if (!chunks.empty() && done != nullptr && _recvr->exceeds_limit(total_chunk_bytes)) {
+                chunks.back().closure = *done;
+                chunks.back().queue_enter_time = MonotonicNanos();
+                COUNTER_UPDATE(metrics.closure_block_counter, 1);
+                *done = nullptr;
+            }
+            enqueue_chunks(chunks);
+        } else {
+            _max_processed_sequences.lazy_emplace(be_number, [be_number](const auto& ctor) { ctor(be_number, -1); });
+
+            _buffered_chunk_queues.lazy_emplace(be_number, [be_number](const auto& ctor) {
+                ctor(be_number, phmap::flat_hash_map<int64_t, ChunkList>());
+            });
+
+            auto& chunk_queues = _buffered_chunk_queues[be_number];
+
+            if (!chunks.empty() && done != nullptr && _recvr->exceeds_limit(total_chunk_bytes)) {
+                chunks.back().closure = *done;
+                chunks.back().queue_enter_time = MonotonicNanos();
+                COUNTER_UPDATE(metrics.closure_block_counter, 1);
+                *done = nullptr;
+            }
+
+            // The queue in chunk_queues cannot be changed, so it must be
+            // assigned to chunk_queues after local_chunk_queue is initialized
+            // Otherwise, other threads may see the intermediate state because
+            // the initialization of local_chunk_queue is beyond mutex
+            chunk_queues[sequence] = std::move(chunks);
+
+            phmap::flat_hash_map<int64_t, ChunkList>::iterator it;
+            int64_t& max_processed_sequence = _max_processed_sequences[be_number];
+
+            // max_processed_sequence + 1 means the first unprocessed sequence
+            while ((it = chunk_queues.find(max_processed_sequence + 1)) != chunk_queues.end()) {
+                ChunkList& unprocessed_chunk_queue = (*it).second;
 
-            chunk_queues.erase(it);
-            ++max_processed_sequence;
+                // Now, all the packets with sequance <= unprocessed_sequence have been received
+                // so chunks of unprocessed_sequence can be flushed to ready queue
+                enqueue_chunks(unprocessed_chunk_queue);
+
+                chunk_queues.erase(it);
+                ++max_processed_sequence;
+            }
         }
     } else {
         // NOTICE: The enqueue process use a lock-free approach to avoid lock contention,
@@ -50,6 +50,7 @@
 #include "gen_cpp/TFileBrokerService.h"
 #include "runtime/broker_mgr.h"
 #include "runtime/exec_env.h"
+#include "storage/inverted/builtin/builtin_plugin.h"
 #include "storage/inverted/clucene/clucene_plugin.h"
 #include "storage/snapshot_manager.h"
 #include "storage/storage_engine.h"
@@ -1010,7 +1011,7 @@ Status SnapshotLoader::_replace_tablet_id(const std::string& file_name, int64_t
                _end_with(file_name, ".del") || _end_with(file_name, ".cols") || _end_with(file_name, ".upt")) {
         *new_file_name = file_name;
         return Status::OK();
-    } else if (CLucenePlugin::is_index_files(file_name)) {
+    } else if (CLucenePlugin::is_index_files(file_name) || BuiltinPlugin::is_index_files(file_name)) {
         *new_file_name = file_name;
         return Status::OK();
     } else {
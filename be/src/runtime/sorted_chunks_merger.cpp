@@ -146,44 +146,39 @@ Status SortedChunksMerger::get_next(ChunkPtr* chunk, bool* eos) {
 
     // multiple sources
     *eos = false;
-    ChunkCursor* cursor = _min_heap[0];
-    *chunk = cursor->clone_empty_chunk(_state->chunk_size());
+    *chunk = _min_heap[0]->clone_empty_chunk(_state->chunk_size());
 
-    ChunkPtr current_chunk = cursor->get_current_chunk();
+    ChunkPtr current_chunk;
     std::vector<uint32_t> selective_values; // for append_selective call
     selective_values.reserve(_state->chunk_size());
-    selective_values.push_back(cursor->get_current_position_in_chunk());
-    size_t row_number = 1;
-
-    std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
-    cursor->next();
-    if (cursor->is_valid()) {
-        std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
-    } else {
-        _min_heap.pop_back();
-    }
+    size_t row_number = 0;
 
     while (row_number < _state->chunk_size() && !_min_heap.empty()) {
-        cursor = _min_heap[0];
-        const auto& ptr = cursor->get_current_chunk();
-        if (current_chunk == ptr) {
-            selective_values.push_back(cursor->get_current_position_in_chunk());
-        } else {
-            (*chunk)->append_selective(*current_chunk, selective_values.data(), 0, selective_values.size());
-            current_chunk = ptr;
-            selective_values.clear();
+        ChunkCursor* cursor = _min_heap[0];
+        std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        // Take the rows of |cursor| while they are not greater than the smallest row of the other cursors, which
+        // costs one comparison per row instead of a pop and a push of the heap, so the runs of rows that do not
+        // overlap the other sources are emitted in bulk.
+        do {
+            const auto& ptr = cursor->get_current_chunk();
+            if (current_chunk != ptr) {
+                if (current_chunk != nullptr) {
+                    (*chunk)->append_selective(*current_chunk, selective_values.data(), 0, selective_values.size());
+                }
+                current_chunk = ptr;
+                selective_values.clear();
+            }
             selective_values.push_back(cursor->get_current_position_in_chunk());
-        }
+            ++row_number;
+            cursor->next();
+        } while (row_number < _state->chunk_size() && cursor->is_valid() &&
+                 (_min_heap.size() == 1 || !(*_min_heap[0] < *cursor)));
 
-        std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
-        cursor->next();
         if (cursor->is_valid()) {
             std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
         } else {
             _min_heap.pop_back();
         }
-
-        ++row_number;
     }
 
     (*chunk)->append_selective(*current_chunk, selective_values.data(), 0, selective_values.size());
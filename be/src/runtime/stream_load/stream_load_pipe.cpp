@@ -34,8 +34,11 @@
 
 #include "runtime/stream_load/stream_load_pipe.h"
 
+#include "common/config.h"
+#include "io/compressed_input_stream.h"
 #include "util/alignment.h"
 #include "util/compression/compression_utils.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -372,4 +375,39 @@ Status StreamLoadPipeInputStream::skip(int64_t n) {
     return Status::OK();
 }
 
+StatusOr<std::shared_ptr<StreamLoadPipe>> start_pipelined_decompression(std::shared_ptr<StreamLoadPipe> pipe,
+                                                                        CompressionTypePB compression,
+                                                                        ThreadPool* pool) {
+    static constexpr size_t kDecompressedBlockSize = 1024 * 1024;
+    std::unique_ptr<StreamCompression> decompressor;
+    RETURN_IF_ERROR(StreamCompression::create_decompressor(compression, &decompressor));
+    auto output = std::make_shared<StreamLoadPipe>(
+            std::max<int64_t>(kDecompressedBlockSize, config::stream_load_pipelined_decompression_buffer_bytes),
+            kDecompressedBlockSize);
+    auto source = std::make_shared<io::CompressedInputStream>(
+            std::make_shared<StreamLoadPipeInputStream>(std::move(pipe), false),
+            std::shared_ptr<StreamCompression>(decompressor.release()));
+    RETURN_IF_ERROR(pool->submit_func([source, output]() {
+        while (true) {
+            auto buf = ByteBuffer::allocate(kDecompressedBlockSize);
+            auto res = source->read(buf->ptr, buf->capacity);
+            if (!res.ok()) {
+                output->cancel(res.status());
+                return;
+            }
+            if (res.value() == 0) {
+                (void)output->finish();
+                return;
+            }
+            buf->pos = res.value();
+            buf->flip();
+            // the reader closed the output pipe if it is cancelled with an ok status
+            if (!output->append(std::move(buf)).ok() || output->is_cancelled()) {
+                return;
+            }
+        }
+    }));
+    return output;
+}
+
 } // namespace starrocks
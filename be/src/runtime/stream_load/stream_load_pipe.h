@@ -47,6 +47,8 @@
 
 namespace starrocks {
 
+class ThreadPool;
+
 // StreamLoadPipe use to transfer data from producer to consumer
 // Data in pip is stored in chunks.
 class StreamLoadPipe : public MessageBodySink {
@@ -83,6 +85,11 @@ public:
 
     void set_non_blocking_read() { _non_blocking_read = true; }
 
+    bool is_cancelled() {
+        std::lock_guard<std::mutex> l(_lock);
+        return _cancelled;
+    }
+
 private:
     Status _append(const ByteBufferPtr& buf);
 
@@ -150,4 +157,11 @@ private:
     std::shared_ptr<StreamLoadPipe> _pipe;
 };
 
+// Decompress the body in |pipe| by a task on |pool| into the returned pipe, so that the decompression of the next
+// blocks overlaps with the parsing of the previous ones. The task stops when the returned pipe is closed, and
+// cancels the returned pipe if it fails to read or decompress the body.
+StatusOr<std::shared_ptr<StreamLoadPipe>> start_pipelined_decompression(std::shared_ptr<StreamLoadPipe> pipe,
+                                                                        CompressionTypePB compression,
+                                                                        ThreadPool* pool);
+
 } // namespace starrocks
@@ -14,10 +14,12 @@
 
 #include "runtime/time_types.h"
 
+#include <cstring>
 #include <string>
 
 #include "gutil/strings/substitute.h"
 #include "util/raw_container.h"
+#include "util/string_parser.hpp"
 
 namespace starrocks {
 
@@ -307,9 +309,15 @@ bool date::from_string(const char* date_str, size_t len, int* year, int* month,
 // compare every char.
 // Note that this method does not check whether the parsed year, month, and day are in valid range.
 bool date::from_string_to_date_internal(const char* ptr, int* pyear, int* pmonth, int* pday) {
-    const bool is_valid = isdigit(ptr[0]) && isdigit(ptr[1]) && isdigit(ptr[2]) && isdigit(ptr[3]) &&
-                          !isdigit(ptr[4]) && isdigit(ptr[5]) && isdigit(ptr[6]) && !isdigit(ptr[7]) &&
-                          isdigit(ptr[8]) && isdigit(ptr[9]);
+    // Digits at 0-3, 5, 6, 8 and 9, and separators at 4 and 7, checked on all the chars at once.
+    uint64_t head;
+    uint16_t tail;
+    memcpy(&head, ptr, sizeof(head));
+    memcpy(&tail, ptr + sizeof(head), sizeof(tail));
+    const uint64_t non_digits = StringParser::non_digit_bytes(head);
+    const bool is_valid = (non_digits & 0x00FFFF00FFFFFFFFULL) == 0 && (non_digits & 0x000000FF00000000ULL) != 0 &&
+                          (non_digits & 0xFF00000000000000ULL) != 0 &&
+                          (StringParser::non_digit_bytes(tail) & 0xFFFF) == 0;
     if (!is_valid) {
         return false;
     }
@@ -327,6 +335,11 @@ bool date::from_string_to_date_internal(const char* ptr, int* pyear, int* pmonth
 
 // try to obtain date base on format "%Y-%m-%d", if failed use uncommon approach to process.
 bool date::from_string_to_date(const char* date_str, size_t len, int* year, int* month, int* day) {
+    // the common "%Y-%m-%d" without spaces
+    if (len == 10 && date::from_string_to_date_internal(date_str, year, month, day)) {
+        return true;
+    }
+
     const char* ptr = date_str;
     const char* end = date_str + len;
     // Skip space character
@@ -36,6 +36,8 @@
 #include "serde/protobuf_serde.h"
 #include "types/hll.h"
 #include "util/coding.h"
+#include "util/faststring.h"
+#include "util/frame_of_reference_coding.h"
 #include "util/json.h"
 #include "util/percentile_value.h"
 
@@ -147,11 +149,54 @@ const uint8_t* decode_string_lz4(const uint8_t* buff, void* target, size_t size)
     return buff + encode_size;
 }
 
+// Integers are bit-packed by frame of reference instead of streamvbyte when ENCODE_BIT_PACKING is set, which
+// suits the narrow-range and sorted integers better, e.g. dates, ids and offsets.
+template <typename T>
+constexpr bool support_bit_packing_v = std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8;
+
+template <typename T>
+int64_t max_bit_packing_size(size_t num_values) {
+    // In the worst case, each frame of 128 values keeps the original values, and has a min value of up to
+    // 8 bytes and 2 bytes meta. The footer has 5 bytes.
+    size_t num_frames = (num_values + 127) / 128;
+    return sizeof(uint64_t) + sizeof(T) * num_values + num_frames * (sizeof(uint64_t) + 2) + 5;
+}
+
+template <typename T>
+uint8_t* encode_bit_packing(const T* data, size_t num_values, uint8_t* buff) {
+    faststring encoded;
+    ForEncoder<T> encoder(&encoded);
+    encoder.put_batch(data, num_values);
+    uint64_t encode_size = encoder.flush();
+    buff = write_little_endian_64(encode_size, buff);
+
+    VLOG_ROW << fmt::format("raw size = {}, encoded size = {}, bit packing compression ratio = {}\n",
+                            num_values * sizeof(T), encode_size, encode_size * 1.0 / (num_values * sizeof(T)));
+    return write_raw(encoded.data(), encode_size, buff);
+}
+
+template <typename T>
+const uint8_t* decode_bit_packing(const uint8_t* buff, T* target, size_t num_values) {
+    uint64_t encode_size = 0;
+    buff = read_little_endian_64(buff, &encode_size);
+    ForDecoder<T> decoder(buff, encode_size);
+    if (!decoder.init() || decoder.count() != num_values || !decoder.get_batch(target, num_values)) {
+        throw std::runtime_error(
+                fmt::format("bit packing decode error, encode size = {}, raw count = {}.", encode_size, num_values));
+    }
+    return buff + encode_size;
+}
+
 template <typename T, bool sorted>
 class FixedLengthColumnSerde {
 public:
     static int64_t max_serialized_size(const FixedLengthColumnBase<T>& column, const int encode_level) {
         uint32_t size = sizeof(T) * column.size();
+        if constexpr (support_bit_packing_v<T>) {
+            if (EncodeContext::enable_bit_packing(encode_level) && size >= ENCODE_SIZE_LIMIT) {
+                return sizeof(uint32_t) + max_bit_packing_size<T>(column.size());
+            }
+        }
         if (EncodeContext::enable_encode_integer(encode_level) && size >= ENCODE_SIZE_LIMIT) {
             return sizeof(uint32_t) + sizeof(uint64_t) +
                    std::max((int64_t)size, (int64_t)streamvbyte_max_compressedbytes(upper_int32(size)));
@@ -163,6 +208,11 @@ public:
     static uint8_t* serialize(const FixedLengthColumnBase<T>& column, uint8_t* buff, const int encode_level) {
         uint32_t size = sizeof(T) * column.size();
         buff = write_little_endian_32(size, buff);
+        if constexpr (support_bit_packing_v<T>) {
+            if (EncodeContext::enable_bit_packing(encode_level) && size >= ENCODE_SIZE_LIMIT) {
+                return encode_bit_packing(column.get_data().data(), column.size(), buff);
+            }
+        }
         if (EncodeContext::enable_encode_integer(encode_level) && size >= ENCODE_SIZE_LIMIT) {
             if (sizeof(T) == 4 && sorted) { // only support sorted 32-bit integers
                 buff = encode_integers<true>(column.raw_data(), size, buff, encode_level);
@@ -180,6 +230,11 @@ public:
         buff = read_little_endian_32(buff, &size);
         std::vector<T>& data = column->get_data();
         raw::make_room(&data, size / sizeof(T));
+        if constexpr (support_bit_packing_v<T>) {
+            if (EncodeContext::enable_bit_packing(encode_level) && size >= ENCODE_SIZE_LIMIT) {
+                return decode_bit_packing(buff, data.data(), size / sizeof(T));
+            }
+        }
         if (EncodeContext::enable_encode_integer(encode_level) && size >= ENCODE_SIZE_LIMIT) {
             if (sizeof(T) == 4 && sorted) { // only support sorted 32-bit integers
                 buff = decode_integers<true>(buff, data.data(), size);
@@ -201,7 +256,9 @@ public:
         const auto& offsets = column.get_offset();
         int64_t res = sizeof(T) * 2;
         int64_t offsets_size = offsets.size() * sizeof(typename BinaryColumnBase<T>::Offset);
-        if (EncodeContext::enable_encode_integer(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
+        if (EncodeContext::enable_bit_packing(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
+            res += max_bit_packing_size<T>(offsets.size());
+        } else if (EncodeContext::enable_encode_integer(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
             res += sizeof(uint64_t) +
                    std::max((int64_t)offsets_size, (int64_t)streamvbyte_max_compressedbytes(upper_int32(offsets_size)));
         } else {
@@ -239,7 +296,9 @@ public:
         } else {
             buff = write_little_endian_64(offsets_size, buff);
         }
-        if (EncodeContext::enable_encode_integer(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
+        if (EncodeContext::enable_bit_packing(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
+            buff = encode_bit_packing(offsets.data(), offsets.size(), buff);
+        } else if (EncodeContext::enable_encode_integer(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
             if (sizeof(T) == 4) { // only support sorted 32-bit integers
                 buff = encode_integers<true>(offsets.data(), offsets_size, buff, encode_level);
             } else {
@@ -273,7 +332,10 @@ public:
             buff = read_little_endian_64(buff, &offsets_size);
         }
         raw::make_room(&column->get_offset(), offsets_size / sizeof(typename BinaryColumnBase<T>::Offset));
-        if (EncodeContext::enable_encode_integer(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
+        if (EncodeContext::enable_bit_packing(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
+            buff = decode_bit_packing(buff, column->get_offset().data(),
+                                      offsets_size / sizeof(typename BinaryColumnBase<T>::Offset));
+        } else if (EncodeContext::enable_encode_integer(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
             if (sizeof(T) == 4) { // only support sorted 32-bit integers
                 buff = decode_integers<true>(buff, column->get_offset().data(), offsets_size);
             } else {
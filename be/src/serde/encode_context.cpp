@@ -14,49 +14,67 @@
 
 #include "serde/encode_context.h"
 
+#include <algorithm>
+
 #include "gen_cpp/data.pb.h" // ChunkPB
 
 namespace starrocks::serde {
 
 EncodeContext::EncodeContext(const int col_num, const int encode_level) : _session_encode_level(encode_level) {
-    for (auto i = 0; i < col_num; ++i) {
-        _column_encode_level.emplace_back(_session_encode_level);
-        _raw_bytes.emplace_back(0);
-        _encoded_bytes.emplace_back(0);
-    }
     // the lowest bit is set and other bits are not zero, then enable adjust.
     if (_session_encode_level & 1 && (_session_encode_level >> 1)) {
         _enable_adjust = true;
     }
+    if (_enable_adjust && enable_bit_packing(_session_encode_level)) {
+        _candidate_levels.emplace_back(_session_encode_level & ~ENCODE_BIT_PACKING);
+    }
+    _candidate_levels.emplace_back(_session_encode_level);
+    for (auto i = 0; i < col_num; ++i) {
+        _column_encode_level.emplace_back(_candidate_levels[0]);
+        _raw_bytes.emplace_back(_candidate_levels.size(), 0);
+        _encoded_bytes.emplace_back(_candidate_levels.size(), 0);
+    }
+    _column_stats.resize(col_num);
 }
 
-void EncodeContext::update(const int col_id, uint64_t mem_bytes, uint64_t encode_byte) {
+void EncodeContext::update(const int col_id, uint64_t mem_bytes, uint64_t encode_byte, uint64_t encode_ns) {
+    _column_stats[col_id].raw_bytes += mem_bytes;
+    _column_stats[col_id].encoded_bytes += encode_byte;
+    _column_stats[col_id].encode_ns += encode_ns;
     if (!_enable_adjust) {
         return;
     }
     // decide to encode or not by the encoding ratio of the first EncodeSamplingNum of every _frequency chunks
     if (_times % _frequency < EncodeSamplingNum) {
-        _raw_bytes[col_id] += mem_bytes;
-        _encoded_bytes[col_id] += encode_byte;
+        size_t candidate = (_times % _frequency) % _candidate_levels.size();
+        _raw_bytes[col_id][candidate] += mem_bytes;
+        _encoded_bytes[col_id][candidate] += encode_byte;
     }
 }
 
-// if encode ratio < EncodeRatioLimit, encode it, otherwise not.
+// if encode ratio < EncodeRatioLimit, encode it with the candidate of the lowest ratio, otherwise not.
 void EncodeContext::_adjust(const int col_id) {
     auto old_level = _column_encode_level[col_id];
-    if (_encoded_bytes[col_id] < _raw_bytes[col_id] * EncodeRatioLimit) {
-        _column_encode_level[col_id] = _session_encode_level;
-    } else {
-        _column_encode_level[col_id] = 0;
+    double best_ratio = EncodeRatioLimit;
+    _column_encode_level[col_id] = 0;
+    for (size_t i = 0; i < _candidate_levels.size(); ++i) {
+        if (_raw_bytes[col_id][i] == 0) {
+            continue;
+        }
+        double ratio = _encoded_bytes[col_id][i] * 1.0 / _raw_bytes[col_id][i];
+        if (ratio < best_ratio) {
+            best_ratio = ratio;
+            _column_encode_level[col_id] = _candidate_levels[i];
+        }
     }
     if (old_level != _column_encode_level[col_id] || _session_encode_level < -1) {
         VLOG_ROW << "Old encode level " << old_level << " is changed to " << _column_encode_level[col_id]
                  << " because the first " << EncodeSamplingNum << " of " << _frequency << " in total " << _times
-                 << " chunks' compression ratio is " << _encoded_bytes[col_id] * 1.0 / _raw_bytes[col_id]
-                 << " higher than limit " << EncodeRatioLimit;
+                 << " chunks' best compression ratio is " << best_ratio << " compared with limit "
+                 << EncodeRatioLimit;
     }
-    _encoded_bytes[col_id] = 0;
-    _raw_bytes[col_id] = 0;
+    std::fill(_encoded_bytes[col_id].begin(), _encoded_bytes[col_id].end(), 0);
+    std::fill(_raw_bytes[col_id].begin(), _raw_bytes[col_id].end(), 0);
 }
 
 void EncodeContext::set_encode_levels_in_pb(ChunkPB* const res) {
@@ -70,11 +88,19 @@ void EncodeContext::set_encode_levels_in_pb(ChunkPB* const res) {
 void EncodeContext::adjust_encode_levels() {
     ++_times;
     // must adjust after writing the current encode_level
-    if (_enable_adjust && (_times % _frequency == EncodeSamplingNum)) {
+    if (!_enable_adjust) {
+        return;
+    }
+    uint64_t pos = _times % _frequency;
+    if (pos == EncodeSamplingNum) {
         for (auto col_id = 0; col_id < _column_encode_level.size(); ++col_id) {
             _adjust(col_id);
         }
         _frequency = _frequency > 1000000000 ? _frequency : _frequency * 2;
+    } else if (pos < EncodeSamplingNum) {
+        // re-evaluate all the candidates, including the ones given up by the last sampling.
+        uint32_t level = _candidate_levels[pos % _candidate_levels.size()];
+        std::fill(_column_encode_level.begin(), _column_encode_level.end(), level);
     }
 }
 } // namespace starrocks::serde
\ No newline at end of file
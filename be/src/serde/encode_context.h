@@ -33,6 +33,8 @@ constexpr uint32_t EncodeSamplingNum = 5;
 // EncodeContext adaptively adjusts encode_level according to the compression ratio. In detail,
 // for every _frequency chunks, if the compression ratio for the first EncodeSamplingNum chunks is less than
 // EncodeRatioLimit, then encode the rest chunks, otherwise not.
+// If both ENCODE_INTEGER and ENCODE_BIT_PACKING are set in the session encode level, the sampling chunks try
+// streamvbyte and bit packing in turn, and each column picks the one with the lower compression ratio.
 
 class EncodeContext {
 public:
@@ -41,7 +43,7 @@ public:
     }
     EncodeContext(const int col_num, const int encode_level);
     // update encode_level for each column
-    void update(const int col_id, uint64_t mem_bytes, uint64_t encode_byte);
+    void update(const int col_id, uint64_t mem_bytes, uint64_t encode_byte, uint64_t encode_ns = 0);
 
     int get_encode_level(const int col_id) { return _column_encode_level[col_id]; }
 
@@ -61,9 +63,22 @@ public:
 
     static bool enable_encode_string(const int encode_level) { return encode_level & ENCODE_STRING; }
 
+    static bool enable_bit_packing(const int encode_level) {
+        return (encode_level & ENCODE_INTEGER) && (encode_level & ENCODE_BIT_PACKING);
+    }
+
+    // The statistics of all the chunks encoded by this context, used for profile.
+    struct ColumnEncodeStats {
+        uint64_t raw_bytes = 0;
+        uint64_t encoded_bytes = 0;
+        uint64_t encode_ns = 0;
+    };
+    const std::vector<ColumnEncodeStats>& column_encode_stats() const { return _column_stats; }
+
 private:
     static constexpr int ENCODE_INTEGER = 2;
     static constexpr int ENCODE_STRING = 4;
+    static constexpr int ENCODE_BIT_PACKING = 8;
 
     // if encode ratio < EncodeRatioLimit, encode it, otherwise not.
     void _adjust(const int col_id);
@@ -71,7 +86,11 @@ private:
     uint64_t _times = 0;
     uint64_t _frequency = 64;
     bool _enable_adjust = false;
-    std::vector<uint64_t> _raw_bytes, _encoded_bytes;
+    // The encode levels tried by the sampling chunks in turn.
+    std::vector<uint32_t> _candidate_levels;
+    // The sampled bytes of each column for each candidate level.
+    std::vector<std::vector<uint64_t>> _raw_bytes, _encoded_bytes;
     std::vector<uint32_t> _column_encode_level;
+    std::vector<ColumnEncodeStats> _column_stats;
 };
 } // namespace starrocks::serde
\ No newline at end of file
@@ -25,6 +25,7 @@
 #include "storage/chunk_helper.h"
 #include "util/coding.h"
 #include "util/raw_container.h"
+#include "util/time.h"
 
 namespace starrocks::serde {
 
@@ -110,9 +111,10 @@ StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const Chunk& chunk,
     } else {
         for (auto i = 0; i < chunk.columns().size(); ++i) {
             auto buff_begin = buff;
+            int64_t begin_ns = MonotonicNanos();
             buff = ColumnArraySerde::serialize(*chunk.columns()[i], buff, false, context->get_encode_level(i));
             if (UNLIKELY(buff == nullptr)) return Status::InternalError("has unsupported column");
-            context->update(i, chunk.columns()[i]->byte_size(), buff - buff_begin);
+            context->update(i, chunk.columns()[i]->byte_size(), buff - buff_begin, MonotonicNanos() - begin_ns);
             if (EncodeContext::enable_encode_integer(context->get_encode_level(i))) { // may be use streamvbyte
                 padding_size = context->STREAMVBYTE_PADDING_SIZE;
             }
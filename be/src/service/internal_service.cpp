@@ -197,7 +197,12 @@ void PInternalServiceImplBase<T>::_transmit_chunk(google::protobuf::RpcControlle
         }
     }
 
-    st = _exec_env->stream_mgr()->transmit_chunk(*request, &wrapped_done);
+    bool receiver_finished = false;
+    st = _exec_env->stream_mgr()->transmit_chunk(*request, &wrapped_done, &receiver_finished, response);
+    // wrapped_done is not taken by a finished receiver, so the response is not sent yet
+    if (receiver_finished) {
+        response->set_receiver_finished(true);
+    }
 }
 
 template <typename T>
@@ -20,6 +20,7 @@
 #include "glog/logging.h"
 #include "jemalloc/jemalloc.h"
 #include "runtime/current_thread.h"
+#include "runtime/memory/jemalloc_arenas.h"
 #include "util/failpoint/fail_point.h"
 #include "util/stack_util.h"
 
@@ -186,12 +187,46 @@ void operator delete[](void* p, size_t size, std::align_val_t al) noexcept {
 }
 */
 
+// The allocations of a thread bound to a memory class by SCOPED_MEMORY_CLASS go to the arena of the class.
+// nallocx does not depend on the arena, so the accounting below is the same for all the classes.
+inline void* starrocks_arena_malloc(size_t size) {
+    int flags = starrocks::tls_jemalloc_arena_flags;
+    if (LIKELY(flags == 0)) {
+        return je_malloc(size);
+    }
+    // mallocx does not accept a zero size
+    return je_mallocx(size == 0 ? 1 : size, flags);
+}
+
+inline void* starrocks_arena_realloc(void* ptr, size_t size) {
+    int flags = starrocks::tls_jemalloc_arena_flags;
+    if (LIKELY(flags == 0)) {
+        return je_realloc(ptr, size);
+    }
+    if (ptr == nullptr) {
+        return starrocks_arena_malloc(size);
+    }
+    return je_rallocx(ptr, size == 0 ? 1 : size, flags);
+}
+
+inline void* starrocks_arena_calloc(size_t number, size_t size) {
+    int flags = starrocks::tls_jemalloc_arena_flags;
+    if (LIKELY(flags == 0)) {
+        return je_calloc(number, size);
+    }
+    size_t total = number * size;
+    if (UNLIKELY(number != 0 && total / number != size)) {
+        return nullptr;
+    }
+    return je_mallocx(total == 0 ? 1 : total, flags | MALLOCX_ZERO);
+}
+
 #define STARROCKS_MALLOC_SIZE(ptr) je_malloc_usable_size(ptr)
 #define STARROCKS_NALLOX(size, flags) je_nallocx(size, flags)
-#define STARROCKS_MALLOC(size) je_malloc(size)
+#define STARROCKS_MALLOC(size) starrocks_arena_malloc(size)
 #define STARROCKS_FREE(ptr) je_free(ptr)
-#define STARROCKS_REALLOC(ptr, size) je_realloc(ptr, size)
-#define STARROCKS_CALLOC(number, size) je_calloc(number, size)
+#define STARROCKS_REALLOC(ptr, size) starrocks_arena_realloc(ptr, size)
+#define STARROCKS_CALLOC(number, size) starrocks_arena_calloc(number, size)
 #define STARROCKS_ALIGNED_ALLOC(align, size) je_aligned_alloc(align, size)
 #define STARROCKS_POSIX_MEMALIGN(ptr, align, size) je_posix_memalign(ptr, align, size)
 #define STARROCKS_CFREE(ptr) je_free(ptr)
@@ -47,8 +47,10 @@
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
 #include "http/action/pipeline_blocking_drivers_action.h"
+#include "http/action/pk_index_warmup_action.h"
 #include "http/action/pprof_actions.h"
 #include "http/action/query_cache_action.h"
+#include "http/action/query_cpu_profile_action.h"
 #include "http/action/reload_tablet_action.h"
 #include "http/action/restore_tablet_action.h"
 #include "http/action/runtime_filter_cache_action.h"
@@ -185,6 +187,10 @@ Status HttpServiceBE::start() {
     _ev_http_server->register_handler(HttpMethod::GET, "/ioprofile", ioprofile_action);
     _http_handlers.emplace_back(ioprofile_action);
 
+    auto* query_cpu_profile_action = new QueryCpuProfileAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_cpu_profile", query_cpu_profile_action);
+    _http_handlers.emplace_back(query_cpu_profile_action);
+
     // register metrics
     {
         auto action = new MetricsAction(StarRocksMetrics::instance()->metrics());
@@ -271,6 +277,10 @@ Status HttpServiceBE::start() {
                                       pipeline_driver_poller_action);
     _http_handlers.emplace_back(pipeline_driver_poller_action);
 
+    auto* pk_index_warmup_action = new PkIndexWarmupAction(_env);
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/pk_index_warmup", pk_index_warmup_action);
+    _http_handlers.emplace_back(pk_index_warmup_action);
+
     auto* greplog_action = new GrepLogAction();
     _ev_http_server->register_handler(HttpMethod::GET, "/greplog", greplog_action);
     _http_handlers.emplace_back(greplog_action);
@@ -110,6 +110,7 @@ int get_num_vacuum_active_tasks(void*) {
 }
 
 bvar::Adder<int64_t> g_publish_version_failed_tasks("lake_publish_version_failed_tasks");
+bvar::LatencyRecorder g_publish_version_latency("lake_publish_version");
 bvar::LatencyRecorder g_publish_tablet_version_latency("lake_publish_tablet_version");
 bvar::LatencyRecorder g_publish_tablet_version_queuing_latency("lake_publish_tablet_version_queuing");
 bvar::PassiveStatus<int> g_publish_version_queued_tasks("lake_publish_version_queued_tasks",
@@ -127,9 +128,20 @@ std::string txn_info_string(const TxnInfoPB& info) {
 
 using BThreadCountDownLatch = GenericCountDownLatch<bthread::Mutex, bthread::ConditionVariable>;
 
-LakeServiceImpl::LakeServiceImpl(ExecEnv* env, lake::TabletManager* tablet_mgr) : _env(env), _tablet_mgr(tablet_mgr) {}
+LakeServiceImpl::LakeServiceImpl(ExecEnv* env, lake::TabletManager* tablet_mgr) : _env(env), _tablet_mgr(tablet_mgr) {
+    auto st = ThreadPoolBuilder("lake_publish_prefetch")
+                      .set_min_threads(0)
+                      .set_max_threads(std::max(1, config::lake_publish_version_prefetch_thread_num))
+                      .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                      .build(&_publish_prefetch_pool);
+    LOG_IF(WARNING, !st.ok()) << "Fail to create publish prefetch thread pool: " << st;
+}
 
-LakeServiceImpl::~LakeServiceImpl() = default;
+LakeServiceImpl::~LakeServiceImpl() {
+    if (_publish_prefetch_pool != nullptr) {
+        _publish_prefetch_pool->shutdown();
+    }
+}
 
 void LakeServiceImpl::publish_version(::google::protobuf::RpcController* controller,
                                       const ::starrocks::PublishVersionRequest* request,
@@ -169,6 +181,31 @@ void LakeServiceImpl::publish_version(::google::protobuf::RpcController* control
              JoinInts(request->txn_ids(), ","), request->base_version(), request->new_version(),
              request->tablet_ids_size());
 
+    auto request_txns = std::vector<TxnInfoPB>();
+    if (request->txn_infos_size() > 0) {
+        request_txns.insert(request_txns.begin(), request->txn_infos().begin(), request->txn_infos().end());
+    } else { // This is a request from older version FE
+        // Construct TxnInfoPB from other fields
+        request_txns.reserve(request->txn_ids_size());
+        for (auto i = 0, sz = request->txn_ids_size(); i < sz; i++) {
+            auto& info = request_txns.emplace_back();
+            info.set_txn_id(request->txn_ids(i));
+            info.set_txn_type(TXN_NORMAL);
+            info.set_combined_txn_log(false);
+            info.set_commit_time(request->commit_time());
+        }
+    }
+
+    // Read the inputs of all tablets with many reads in flight, instead of one by one in each publish task.
+    if (_publish_prefetch_pool != nullptr && config::lake_publish_version_prefetch_min_tablets > 0 &&
+        request->tablet_ids_size() >= config::lake_publish_version_prefetch_min_tablets) {
+        ADOPT_TRACE(trace);
+        lake::prefetch_publish_version_inputs(_tablet_mgr, _publish_prefetch_pool.get(),
+                                              std::span<const int64_t>(request->tablet_ids().data(),
+                                                                       request->tablet_ids_size()),
+                                              request->base_version(), request_txns, timeout_deadline);
+    }
+
     Status::OK().to_protobuf(response->mutable_status());
     for (auto tablet_id : request->tablet_ids()) {
         auto task = [&, tablet_id]() {
@@ -186,20 +223,7 @@ void LakeServiceImpl::publish_version(::google::protobuf::RpcController* control
 
             auto base_version = request->base_version();
             auto new_version = request->new_version();
-            auto txns = std::vector<TxnInfoPB>();
-            if (request->txn_infos_size() > 0) {
-                txns.insert(txns.begin(), request->txn_infos().begin(), request->txn_infos().end());
-            } else { // This is a request from older version FE
-                // Construct TxnInfoPB from other fields
-                txns.reserve(request->txn_ids_size());
-                for (auto i = 0, sz = request->txn_ids_size(); i < sz; i++) {
-                    auto& info = txns.emplace_back();
-                    info.set_txn_id(request->txn_ids(i));
-                    info.set_txn_type(TXN_NORMAL);
-                    info.set_combined_txn_log(false);
-                    info.set_commit_time(request->commit_time());
-                }
-            }
+            const auto& txns = request_txns;
 
             TRACE_COUNTER_INCREMENT("tablet_id", tablet_id);
             TRACE_COUNTER_INCREMENT("queuing_latency_us", queuing_latency);
@@ -247,6 +271,7 @@ void LakeServiceImpl::publish_version(::google::protobuf::RpcController* control
 
     latch.wait();
     auto cost = butil::gettimeofday_us() - start_ts;
+    g_publish_version_latency << cost;
     auto is_slow = cost >= config::lake_publish_version_slow_log_ms * 1000;
     if (config::lake_enable_publish_version_trace_log && is_slow) {
         LOG(INFO) << "Published txns=" << JoinInts(request->txn_ids(), ",") << ". cost=" << cost << "us\n"
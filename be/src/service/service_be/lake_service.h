@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #pragma once
+#include <memory>
 #include <span>
 
 #include "gen_cpp/lake_service.pb.h"
@@ -20,6 +21,7 @@
 namespace starrocks {
 
 class ExecEnv;
+class ThreadPool;
 
 namespace lake {
 class TabletManager;
@@ -105,6 +107,8 @@ private:
 
     ExecEnv* _env;
     lake::TabletManager* _tablet_mgr;
+    // Reads the inputs of the tablets in a publish request ahead of the publish tasks
+    std::unique_ptr<ThreadPool> _publish_prefetch_pool;
 };
 
 } // namespace starrocks
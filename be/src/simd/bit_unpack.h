@@ -0,0 +1,135 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace starrocks {
+
+// SIMDBitUnpack unpacks a batch of 32 little-endian bit-packed values, the batch of BitPacking::Unpack32Values(),
+// by shuffling out the 4 bytes containing each value, shifting them right by the bit offset of the value and
+// masking them, for 8 values by AVX2 or 16 values by AVX-512 at a time.
+//
+// Each group of 4 values is loaded by a 16-byte load from the byte of its first bit, so the kernels read up to
+// `bytes_read<BIT_WIDTH>()` bytes from the input, which is further than the 4 * BIT_WIDTH bytes of the batch.
+struct SIMDBitUnpack {
+    // A value wider than 24 bits may not fit in the 4 bytes starting from the byte of its first bit.
+    static constexpr int max_bit_width = 24;
+
+    template <int BIT_WIDTH>
+    static constexpr int64_t bytes_read() {
+        return _lane_offset(BIT_WIDTH, 7) + 16;
+    }
+
+    // Returns whether the values of BIT_WIDTH bits can be unpacked into OutType by the kernels of the build.
+    template <typename OutType, int BIT_WIDTH>
+    static constexpr bool supported() {
+#ifdef __AVX2__
+        return std::is_integral_v<OutType> && (sizeof(OutType) == 2 || sizeof(OutType) == 4) && BIT_WIDTH > 0 &&
+               BIT_WIDTH <= max_bit_width && BIT_WIDTH <= sizeof(OutType) * 8;
+#else
+        return false;
+#endif
+    }
+
+    // 'in' must point to bytes_read<BIT_WIDTH>() bytes of addressable memory.
+    template <typename OutType, int BIT_WIDTH>
+    static void unpack32(const uint8_t* in, OutType* out) {
+        static_assert(supported<OutType, BIT_WIDTH>());
+#ifdef __AVX2__
+        using T = Tables<BIT_WIDTH>;
+        constexpr uint32_t mask = (1U << BIT_WIDTH) - 1;
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+        for (int h = 0; h < 2; h++) {
+            __m512i v = _mm512_castsi128_si512(_load_lane<BIT_WIDTH>(in, 4 * h));
+            v = _mm512_inserti32x4(v, _load_lane<BIT_WIDTH>(in, 4 * h + 1), 1);
+            v = _mm512_inserti32x4(v, _load_lane<BIT_WIDTH>(in, 4 * h + 2), 2);
+            v = _mm512_inserti32x4(v, _load_lane<BIT_WIDTH>(in, 4 * h + 3), 3);
+            v = _mm512_shuffle_epi8(v, _mm512_loadu_si512(T::shuffles.data() + 64 * h));
+            v = _mm512_srlv_epi32(v, _mm512_loadu_si512(T::shifts.data() + 16 * h));
+            v = _mm512_and_si512(v, _mm512_set1_epi32(mask));
+            if constexpr (sizeof(OutType) == 4) {
+                _mm512_storeu_si512(out + 16 * h, v);
+            } else {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16 * h), _mm512_cvtepi32_epi16(v));
+            }
+        }
+#else
+        __m256i prev = _mm256_setzero_si256();
+        for (int g = 0; g < 4; g++) {
+            __m256i v = _mm256_castsi128_si256(_load_lane<BIT_WIDTH>(in, 2 * g));
+            v = _mm256_inserti128_si256(v, _load_lane<BIT_WIDTH>(in, 2 * g + 1), 1);
+            const auto* shuffle = reinterpret_cast<const __m256i*>(T::shuffles.data() + 32 * g);
+            const auto* shift = reinterpret_cast<const __m256i*>(T::shifts.data() + 8 * g);
+            v = _mm256_shuffle_epi8(v, _mm256_loadu_si256(shuffle));
+            v = _mm256_srlv_epi32(v, _mm256_loadu_si256(shift));
+            v = _mm256_and_si256(v, _mm256_set1_epi32(mask));
+            if constexpr (sizeof(OutType) == 4) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8 * g), v);
+            } else if (g % 2 == 0) {
+                prev = v;
+            } else {
+                // packus interleaves the 128-bit lanes of the two groups, which are put back in order by permute.
+                __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(prev, v), 0xD8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8 * (g - 1)), packed);
+            }
+        }
+#endif
+#endif
+    }
+
+private:
+    // The byte of the first bit of the lane-th group of 4 values.
+    static constexpr int _lane_offset(int bit_width, int lane) { return lane * 4 * bit_width / 8; }
+
+    template <int BIT_WIDTH>
+    struct Tables {
+        // The bytes of each value relative to the offset of its lane, for the 8 lanes of 4 values.
+        static constexpr std::array<uint8_t, 128> shuffles = [] {
+            std::array<uint8_t, 128> res{};
+            for (int i = 0; i < 32; i++) {
+                const int first_byte = i * BIT_WIDTH / 8 - _lane_offset(BIT_WIDTH, i / 4);
+                for (int b = 0; b < 4; b++) {
+                    res[i * 4 + b] = static_cast<uint8_t>(first_byte + b);
+                }
+            }
+            return res;
+        }();
+        // The bit offset of each value in its first byte.
+        static constexpr std::array<uint32_t, 32> shifts = [] {
+            std::array<uint32_t, 32> res{};
+            for (int i = 0; i < 32; i++) {
+                res[i] = i * BIT_WIDTH % 8;
+            }
+            return res;
+        }();
+    };
+
+#ifdef __AVX2__
+    template <int BIT_WIDTH>
+    static __m128i _load_lane(const uint8_t* in, int lane) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + _lane_offset(BIT_WIDTH, lane)));
+    }
+#endif
+};
+
+} // namespace starrocks
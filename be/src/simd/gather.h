@@ -65,5 +65,53 @@ struct SIMDGather {
             c++;
         }
     }
+
+    // b[i] = dict[c[i]], e.g. the decoding of a dictionary-encoded fixed-width column.
+    // TV was a trivially copyable type of 4 or 8 bytes, TC was int32_t or uint32_t, and every c[i] < dict_size.
+    template <class TV, class TC>
+    static void gather_dict(TV* b, const TV* dict, size_t dict_size, const TC* c, int num_rows) {
+        static_assert(sizeof(TV) == 4 || sizeof(TV) == 8);
+        static_assert(std::is_trivially_copyable_v<TV>);
+        static_assert(sizeof(TC) == 4);
+        static_assert(std::is_integral_v<TC>);
+        int i = 0;
+#ifdef __AVX2__
+        if (dict_size * sizeof(TV) < max_process_size) {
+#if defined(__AVX512F__)
+            for (; i + 16 <= num_rows; i += 16) {
+                if constexpr (sizeof(TV) == 4) {
+                    __m512i loaded = _mm512_loadu_si512(c + i);
+                    // The masked gathers with a zeroed source avoid -Wmaybe-uninitialized in the headers of gcc.
+                    __m512i gathered = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, loaded, dict, 4);
+                    _mm512_storeu_si512(b + i, gathered);
+                } else {
+                    __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + i));
+                    __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + i + 8));
+                    _mm512_storeu_si512(b + i, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), 0xFF, lo, dict, 8));
+                    _mm512_storeu_si512(b + i + 8,
+                                        _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), 0xFF, hi, dict, 8));
+                }
+            }
+#endif
+            for (; i + 8 <= num_rows; i += 8) {
+                __m256i loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + i));
+                if constexpr (sizeof(TV) == 4) {
+                    __m256i gathered = _mm256_i32gather_epi32(reinterpret_cast<const int32_t*>(dict), loaded, 4);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i), gathered);
+                } else {
+                    const auto* base = reinterpret_cast<const long long*>(dict);
+                    __m256i lo = _mm256_i32gather_epi64(base, _mm256_castsi256_si128(loaded), 8);
+                    __m256i hi = _mm256_i32gather_epi64(base, _mm256_extracti128_si256(loaded, 1), 8);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i), lo);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i + 4), hi);
+                }
+            }
+            _mm256_zeroupper();
+        }
+#endif
+        for (; i < num_rows; i++) {
+            b[i] = dict[c[i]];
+        }
+    }
 };
 } // namespace starrocks
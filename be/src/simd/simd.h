@@ -17,6 +17,9 @@
 #include <cstdint>
 #include <cstring>
 #include <vector>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 #ifdef __SSE2__
 #include <emmintrin.h>
 #elif defined(__ARM_NEON) && defined(__aarch64__)
@@ -193,6 +196,33 @@ inline bool contain_nonzero(const std::vector<uint8_t>& list, size_t start, size
     return pos < list.size() && pos < start + count;
 }
 
+// Returns a 64-bit mask of the 64 bytes from `data`, whose bit i is set iff data[i] equals to `c`.
+inline uint64_t eq_mask64(const char* data, char c) {
+#if defined(__AVX2__)
+    const __m256i target = _mm256_set1_epi8(c);
+    const auto lo = static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), target)));
+    const auto hi = static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32)), target)));
+    return static_cast<uint64_t>(lo) | (static_cast<uint64_t>(hi) << 32u);
+#elif defined(__SSE2__)
+    const __m128i target = _mm_set1_epi8(c);
+    uint64_t mask = 0;
+    for (int i = 0; i < 4; i++) {
+        const auto m = static_cast<uint16_t>(_mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)), target)));
+        mask |= static_cast<uint64_t>(m) << (i * 16u);
+    }
+    return mask;
+#else
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; i++) {
+        mask |= static_cast<uint64_t>(data[i] == c) << i;
+    }
+    return mask;
+#endif
+}
+
 #if defined(__ARM_NEON) && defined(__aarch64__)
 
 /// Returns a 64-bit mask, each 4-bit represents a byte of the input.
@@ -14,9 +14,9 @@
 
 #include "storage/binlog_reader.h"
 
+#include <numeric>
 #include <utility>
 
-#include "column/datum.h"
 #include "storage/chunk_helper.h"
 #include "storage/rowset/rowid_range_option.h"
 #include "storage/rowset/segment_options.h"
@@ -85,6 +85,27 @@ Status BinlogReader::seek(int64_t version, int64_t seq_id) {
 }
 
 Status BinlogReader::get_next(ChunkPtr* chunk, int64_t max_version_exclusive) {
+    Chunk* output_chunk = chunk->get();
+    RETURN_IF_ERROR(_next_log_entry(max_version_exclusive));
+    RETURN_IF_ERROR(_read_log_entry(output_chunk));
+    // Fill the chunk with the following log entries as long as their change events fit in it, so that
+    // small log entries do not each produce a small chunk
+    while (output_chunk->num_rows() < _reader_params.chunk_size) {
+        Status status = _next_log_entry(max_version_exclusive);
+        if (status.is_end_of_file()) {
+            break;
+        }
+        RETURN_IF_ERROR(status);
+        int64_t num_left_events = _log_entry_info->end_seq_id - _next_seq_id + 1;
+        if (num_left_events > _reader_params.chunk_size - output_chunk->num_rows()) {
+            break;
+        }
+        RETURN_IF_ERROR(_read_log_entry(output_chunk));
+    }
+    return Status::OK();
+}
+
+Status BinlogReader::_next_log_entry(int64_t max_version_exclusive) {
     // Invariant: if _log_entry_info is not nullptr, change event with
     // <_next_version, _next_seq_id> must be in this log entry, otherwise
     // need to find the log entry first
@@ -139,12 +160,29 @@ Status BinlogReader::get_next(ChunkPtr* chunk, int64_t max_version_exclusive) {
     if (_next_version >= max_version_exclusive) {
         return Status::EndOfFile(fmt::format("End of max version {}", max_version_exclusive));
     }
+    return Status::OK();
+}
 
+Status BinlogReader::_read_log_entry(Chunk* output_chunk) {
     LogEntryInfo* log_entry_info = _log_entry_info;
-    _swap_output_and_data_chunk(chunk->get());
-    status = _segment_iterator->get_next(_data_chunk.get());
-    int32_t num_rows = _data_chunk->num_rows();
-    _swap_output_and_data_chunk(chunk->get());
+    Status status;
+    int32_t num_rows;
+    if (output_chunk->num_rows() == 0) {
+        _swap_output_and_data_chunk(output_chunk);
+        status = _segment_iterator->get_next(_data_chunk.get());
+        num_rows = _data_chunk->num_rows();
+        _swap_output_and_data_chunk(output_chunk);
+    } else {
+        status = _segment_iterator->get_next(_data_chunk.get());
+        num_rows = _data_chunk->num_rows();
+        if (status.ok()) {
+            Columns& output_columns = output_chunk->columns();
+            for (size_t i = 0; i < _data_column_index.size(); i++) {
+                output_columns[_data_column_index[i]]->append(*_data_chunk->get_column_by_index(i));
+            }
+        }
+        _data_chunk->reset();
+    }
     // sanity check: should not meet the end of file
     if (status.is_end_of_file()) {
         std::string err_msg = fmt::format(
@@ -158,7 +196,8 @@ Status BinlogReader::get_next(ChunkPtr* chunk, int64_t max_version_exclusive) {
     if (!status.ok()) {
         return status;
     }
-    _append_meta_column(chunk->get(), num_rows, log_entry_info->version, log_entry_info->timestamp_in_us, _next_seq_id);
+    _append_meta_column(output_chunk, num_rows, log_entry_info->version, log_entry_info->timestamp_in_us,
+                        _next_seq_id);
     _next_seq_id += num_rows;
     // read all change events in this log entry
     if (_next_seq_id > log_entry_info->end_seq_id) {
@@ -196,11 +235,9 @@ void BinlogReader::_append_meta_column(Chunk* output_chunk, int32_t num_rows, in
 
     if (_binlog_seq_id_column_index > -1) {
         ColumnPtr& column = output_chunk->get_column_by_index(_binlog_seq_id_column_index);
-        int64_t end_seq_id = start_seq_id + num_rows - 1;
-        for (int64_t seq_id = start_seq_id; seq_id <= end_seq_id; seq_id++) {
-            Datum datum(seq_id);
-            column->append_datum(datum);
-        }
+        std::vector<int64_t> seq_ids(num_rows);
+        std::iota(seq_ids.begin(), seq_ids.end(), start_seq_id);
+        (void)column->append_numbers(seq_ids.data(), num_rows * sizeof(int64_t));
     }
 
     if (_binlog_timestamp_column_index > -1) {
@@ -88,6 +88,8 @@ public:
 
     // Get a chunk of change events less than the *max_version_exclusive*.
     // The schema of chunk should be the same with BinlogReaderParams#schema.
+    // The chunk may contain the change events of several log entries, and has
+    // at most BinlogReaderParams#chunk_size rows.
     // Return Status::OK() if there is at least one change event in the chunk
     // Return Status::EndOfFile() if there is no more change events, or the
     // version of left change events are no less than *max_version_exclusive*.
@@ -108,6 +110,10 @@ public:
     int64_t reader_id() { return _reader_id; }
 
 private:
+    // Positions _log_entry_info at the non-empty log entry of <_next_version, _next_seq_id>.
+    Status _next_log_entry(int64_t max_version_exclusive);
+    // Appends the next batch of change events of _log_entry_info to the output chunk.
+    Status _read_log_entry(Chunk* output_chunk);
     Status _seek_binlog_file_reader(int64_t version, int64_t seq_id);
     Status _init_segment_iterator();
     void _release_segment_iterator(bool release_rowset);
@@ -22,17 +22,22 @@
 #include "column/schema.h"
 #include "column/struct_column.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "simd/simd.h"
 #include "storage/olap_type_infra.h"
 #include "storage/tablet_schema.h"
 #include "storage/type_traits.h"
 #include "storage/type_utils.h"
 #include "storage/types.h"
+#include "types/logical_type_infra.h"
+#include "util/countdown_latch.h"
 #include "util/metrics.h"
 #include "util/percentile_value.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -322,6 +327,42 @@ Chunk* ChunkHelper::new_chunk_pooled(const Schema& schema, size_t chunk_size, bo
     return new Chunk(std::move(columns), std::make_shared<Schema>(schema));
 }
 
+struct SlotColumnPtrBuilder {
+    template <LogicalType ltype>
+    ColumnPtr operator()(size_t chunk_size, const TypeDescriptor& type) {
+        using ColumnType = RunTimeColumnType<ltype>;
+        if constexpr (HasColumnPool<ColumnType>::value) {
+            auto column = get_column_ptr<ColumnType, true>(chunk_size);
+            if constexpr (lt_is_decimal<ltype>) {
+                column->set_precision(type.precision);
+                column->set_scale(type.scale);
+            }
+            return column;
+        } else {
+            return ColumnHelper::create_column(type, false);
+        }
+    }
+};
+
+ChunkUniquePtr ChunkHelper::new_chunk_pooled(const std::vector<SlotDescriptor*>& slots, size_t n) {
+    auto chunk = std::make_unique<Chunk>();
+    for (const auto slot : slots) {
+        const auto& type = slot->type();
+        ColumnPtr column;
+        if (type.is_complex_type() || type.type == TYPE_NULL) {
+            column = ColumnHelper::create_column(type, slot->is_nullable());
+        } else {
+            column = type_dispatch_column(type.type, SlotColumnPtrBuilder(), n, type);
+            if (slot->is_nullable()) {
+                column = NullableColumn::create(std::move(column), get_column_ptr<NullColumn, true>(n));
+            }
+        }
+        column->reserve(n);
+        chunk->append_column(column, slot->id());
+    }
+    return chunk;
+}
+
 std::vector<size_t> ChunkHelper::get_char_field_indexes(const Schema& schema) {
     std::vector<size_t> char_field_indexes;
     for (size_t i = 0; i < schema.num_fields(); ++i) {
@@ -476,6 +517,38 @@ void ChunkHelper::reorder_chunk(const std::vector<SlotDescriptor*>& slots, Chunk
     original_chunk.swap_chunk(reordered_chunk);
 }
 
+Status ChunkHelper::parallel_for_columns(size_t num_columns, const std::function<Status(size_t, size_t)>& func) {
+    ThreadPool* pool = ExecEnv::GetInstance()->column_parallel_pool();
+    const size_t min_columns = std::max(config::column_parallel_min_columns, 1);
+    const size_t dop = std::min<size_t>(std::max(config::column_parallel_dop, 1), num_columns / min_columns);
+    if (pool == nullptr || dop <= 1) {
+        return func(0, num_columns);
+    }
+
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    std::vector<Status> statuses(dop);
+    CountDownLatch latch(dop - 1);
+    for (size_t i = 1; i < dop; i++) {
+        const size_t begin = i * num_columns / dop;
+        const size_t end = (i + 1) * num_columns / dop;
+        auto task = [&func, &statuses, &latch, mem_tracker, i, begin, end]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            statuses[i] = func(begin, end);
+            latch.count_down();
+        };
+        if (!pool->submit_func(task).ok()) {
+            // the pool is full or shutting down, run it in the current thread.
+            task();
+        }
+    }
+    statuses[0] = func(0, num_columns / dop);
+    latch.wait();
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 ChunkAccumulator::ChunkAccumulator(size_t desired_size) : _desired_size(desired_size) {}
 
 void ChunkAccumulator::set_desired_size(size_t desired_size) {
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <queue>
 
@@ -71,6 +72,10 @@ public:
 
     static Chunk* new_chunk_pooled(const Schema& schema, size_t n, bool force);
 
+    // Create an empty chunk according to the |slots| like new_chunk, the columns of the types which have a column
+    // pool are taken from the pool of this thread and returned to it when the chunk is destroyed.
+    static ChunkUniquePtr new_chunk_pooled(const std::vector<SlotDescriptor*>& slots, size_t n);
+
     // Create a vectorized column from field .
     // REQUIRE: |type| must be scalar type.
     static std::shared_ptr<Column> column_from_field_type(LogicalType type, bool nullable);
@@ -89,6 +94,12 @@ public:
     static void reorder_chunk(const TupleDescriptor& tuple_desc, Chunk* chunk);
     // Reorder columns of `chunk` according to the order of |slots|.
     static void reorder_chunk(const std::vector<SlotDescriptor*>& slots, Chunk* chunk);
+
+    // Calls `func(begin, end)` for the disjoint ranges covering the columns [0, num_columns), in parallel by the
+    // calling thread and the threads of ExecEnv::column_parallel_pool() if there are at least
+    // `config::column_parallel_min_columns` columns, or by the calling thread alone otherwise. The memory allocated
+    // by `func` is charged to the memory tracker of the calling thread. Returns the first error returned by `func`.
+    static Status parallel_for_columns(size_t num_columns, const std::function<Status(size_t, size_t)>& func);
 };
 
 // Accumulate small chunk into desired size
@@ -155,6 +155,10 @@ public:
     // Return false to filter out a data page.
     virtual bool zone_map_filter(const ZoneMapDetail& detail) const { return true; }
 
+    // Return true if all the rows of a data page satisfy this predicate, which is only checked for the pages
+    // without null.
+    virtual bool zone_map_all_match(const ZoneMapDetail& detail) const { return false; }
+
     virtual bool support_original_bloom_filter() const { return false; }
 
     // return true means this predicate can support ngram bloom filter, don't consider gram number(N)
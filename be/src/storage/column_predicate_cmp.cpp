@@ -263,6 +263,10 @@ public:
         return this->type_info()->cmp(Datum(this->_value), max) <= 0;
     }
 
+    bool zone_map_all_match(const ZoneMapDetail& detail) const override {
+        return this->type_info()->cmp(Datum(this->_value), detail.min_value()) <= 0;
+    }
+
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
         range->clear();
         bool exact_match;
@@ -307,6 +311,10 @@ public:
         return this->type_info()->cmp(Datum(this->_value), max) < 0;
     }
 
+    bool zone_map_all_match(const ZoneMapDetail& detail) const override {
+        return this->type_info()->cmp(Datum(this->_value), detail.min_value()) < 0;
+    }
+
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
         range->clear();
         bool exact_match = false;
@@ -352,6 +360,10 @@ public:
         return (this->type_info()->cmp(Datum(this->_value), min) >= 0) & !max.is_null();
     }
 
+    bool zone_map_all_match(const ZoneMapDetail& detail) const override {
+        return this->type_info()->cmp(Datum(this->_value), detail.max_value()) >= 0;
+    }
+
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
         range->clear();
         bool exact_match = false;
@@ -397,6 +409,10 @@ public:
         return (this->type_info()->cmp(Datum(this->_value), min) > 0) & !max.is_null();
     }
 
+    bool zone_map_all_match(const ZoneMapDetail& detail) const override {
+        return this->type_info()->cmp(Datum(this->_value), detail.max_value()) > 0;
+    }
+
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
         range->clear();
         bool exact_match = false;
@@ -443,6 +459,12 @@ public:
         return type_info->cmp(Datum(this->_value), min) >= 0 && type_info->cmp(Datum(this->_value), max) <= 0;
     }
 
+    bool zone_map_all_match(const ZoneMapDetail& detail) const override {
+        const auto type_info = this->type_info();
+        return type_info->cmp(Datum(this->_value), detail.min_value()) == 0 &&
+               type_info->cmp(Datum(this->_value), detail.max_value()) == 0;
+    }
+
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
         range->clear();
         bool exact_match = false;
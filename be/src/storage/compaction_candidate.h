@@ -28,6 +28,8 @@ struct CompactionCandidate {
     TabletSharedPtr tablet;
     CompactionType type;
     double score = 0;
+    // the read amplification of the recent queries, which has been folded into score
+    double read_amp_score = 0;
 
     CompactionCandidate() : tablet(nullptr), type(INVALID_COMPACTION) {}
 
@@ -40,12 +42,14 @@ struct CompactionCandidate {
         tablet = other.tablet;
         type = other.type;
         score = other.score;
+        read_amp_score = other.read_amp_score;
     }
 
     CompactionCandidate& operator=(const CompactionCandidate& rhs) {
         tablet = rhs.tablet;
         type = rhs.type;
         score = rhs.score;
+        read_amp_score = rhs.read_amp_score;
         return *this;
     }
 
@@ -53,12 +57,14 @@ struct CompactionCandidate {
         tablet = std::move(other.tablet);
         type = other.type;
         score = other.score;
+        read_amp_score = other.read_amp_score;
     }
 
     CompactionCandidate& operator=(CompactionCandidate&& rhs) {
         tablet = std::move(rhs.tablet);
         type = rhs.type;
         score = rhs.score;
+        read_amp_score = rhs.read_amp_score;
         return *this;
     }
 
@@ -71,6 +77,7 @@ struct CompactionCandidate {
         }
         ss << ", type:" << starrocks::to_string(type);
         ss << ", score:" << score;
+        ss << ", read_amp_score:" << read_amp_score;
         return ss.str();
     }
 };
@@ -15,9 +15,11 @@
 #include "storage/compaction_manager.h"
 
 #include <chrono>
+#include <cmath>
 #include <thread>
 
 #include "storage/data_dir.h"
+#include "util/cpu_info.h"
 #include "util/starrocks_metrics.h"
 #include "util/thread.h"
 
@@ -25,7 +27,17 @@ using namespace std::chrono_literals;
 
 namespace starrocks {
 
-CompactionManager::CompactionManager() : _next_task_id(0) {}
+CompactionManager::CompactionManager() : _next_task_id(0) {
+    // Each running compaction task runs at most one read-ahead task, so the pool is sized by cores
+    // and the number of compaction tasks bounds its use.
+    auto st = ThreadPoolBuilder("compact_read_ahead")
+                      .set_min_threads(0)
+                      .set_max_threads(CpuInfo::num_cores())
+                      .set_max_queue_size(INT32_MAX)
+                      .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                      .build(&_read_ahead_pool);
+    LOG_IF(WARNING, !st.ok()) << "failed to create compaction read-ahead pool: " << st;
+}
 
 void CompactionManager::stop() {
     _stop.store(true, std::memory_order_release);
@@ -35,6 +47,9 @@ void CompactionManager::stop() {
     if (_compaction_pool) {
         _compaction_pool->shutdown();
     }
+    if (_read_ahead_pool) {
+        _read_ahead_pool->shutdown();
+    }
     if (_dispatch_update_candidate_thread.joinable()) {
         _dispatch_update_candidate_thread.join();
     }
@@ -345,6 +360,11 @@ void CompactionManager::update_tablet(const TabletSharedPtr& tablet) {
         CompactionCandidate candidate;
         candidate.tablet = tablet;
         candidate.score = tablet->compaction_score();
+        if (config::compaction_read_amp_weight > 0) {
+            // prefer the tablets whose queries would gain the most from the compaction
+            candidate.read_amp_score = tablet->read_amplification_score();
+            candidate.score *= 1 + config::compaction_read_amp_weight * std::log2(1 + candidate.read_amp_score);
+        }
         candidate.type = tablet->compaction_type();
         update_candidates({candidate});
     }
@@ -128,6 +128,10 @@ public:
 
     int get_waiting_task_num();
 
+    // pool of the tasks merging the input of vertical compactions ahead of their writers,
+    // at most one per running compaction task
+    ThreadPool* read_ahead_pool() { return _read_ahead_pool.get(); }
+
 private:
     CompactionManager(const CompactionManager& compaction_manager) = delete;
     CompactionManager(CompactionManager&& compaction_manager) = delete;
@@ -173,6 +177,7 @@ private:
     uint64_t _round = 0;
 
     std::unique_ptr<ThreadPool> _compaction_pool = nullptr;
+    std::unique_ptr<ThreadPool> _read_ahead_pool = nullptr;
     std::thread _scheduler_thread;
 };
 
@@ -35,9 +35,12 @@
 #include "storage/data_dir.h"
 
 #include <filesystem>
+#include <mutex>
 #include <set>
 #include <sstream>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "fs/fs.h"
@@ -59,6 +62,7 @@
 #include "util/errno.h"
 #include "util/monotime.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 
 using strings::Substitute;
 
@@ -278,10 +282,12 @@ Status DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta " << _path;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_lock;
+    auto load_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_lock](
+                               int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status st =
                 _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(tablet_ids_lock);
         if (!st.ok() && !st.is_not_found() && !st.is_already_exist()) {
             // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
             // This may happen when the tablet was just deleted before the BE restarted,
@@ -295,10 +301,54 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+
+    // The scan of rocksdb only copies the metas out in batches, the threads of `load_pool` parse them and create
+    // the tablets. A batch is loaded by the scanning thread itself if the queue of the pool is full.
+    std::unique_ptr<ThreadPool> load_pool;
+    if (config::load_tablet_threads_per_data_dir > 1) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("load_tablet")
+                                .set_min_threads(1)
+                                .set_max_threads(config::load_tablet_threads_per_data_dir)
+                                .set_max_queue_size(config::load_tablet_threads_per_data_dir * 2)
+                                .build(&load_pool));
+    }
+    using TabletMetaBatch = std::vector<std::tuple<int64_t, int32_t, std::string>>;
+    constexpr size_t kTabletMetaBatchSize = 64;
+    TabletMetaBatch batch;
+    auto submit_batch = [&]() {
+        auto task = [&load_tablet, metas = std::move(batch)]() {
+            for (const auto& [tablet_id, schema_hash, value] : metas) {
+                load_tablet(tablet_id, schema_hash, value);
+            }
+        };
+        batch = TabletMetaBatch();
+        if (!load_pool->submit_func(task).ok()) {
+            task();
+        }
+    };
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash, std::string_view value) -> bool {
+        if (load_pool == nullptr) {
+            load_tablet(tablet_id, schema_hash, value);
+            return true;
+        }
+        batch.emplace_back(tablet_id, schema_hash, value);
+        if (batch.size() >= kTabletMetaBatchSize) {
+            submit_batch();
+        }
         return true;
     };
-    Status load_tablet_status =
-            TabletMetaManager::walk_until_timeout(_kv_store, load_tablet_func, config::load_tablet_timeout_seconds);
+    auto walk_tablets = [&](int64_t timeout_seconds) {
+        Status st = TabletMetaManager::walk_until_timeout(_kv_store, load_tablet_func, timeout_seconds);
+        if (load_pool != nullptr) {
+            if (!batch.empty()) {
+                submit_batch();
+            }
+            load_pool->wait();
+        }
+        return st;
+    };
+    Status load_tablet_status = walk_tablets(config::load_tablet_timeout_seconds);
     if (load_tablet_status.is_time_out()) {
         LOG(WARNING) << "load tablets from rocksdb timeout, try to compact meta and retry. path: " << _path;
         Status s = _kv_store->compact();
@@ -316,7 +366,7 @@ Status DataDir::load() {
         LOG(WARNING) << "compact meta finished, retry load tablets from rocksdb. path: " << _path;
         tablet_ids.clear();
         failed_tablet_ids.clear();
-        load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+        load_tablet_status = walk_tablets(-1);
     }
 
     if (failed_tablet_ids.size() != 0) {
@@ -14,6 +14,8 @@
 
 #include "storage/del_vector.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 #include "gutil/strings/substitute.h"
@@ -120,6 +122,27 @@ void DelVector::_update_stats() {
     }
 }
 
+void DelVector::fill_deleted(uint32_t from, uint32_t to, uint8_t* deleted) const {
+    DCHECK_LE(from, to);
+    memset(deleted, 0, to - from);
+    if (!_roaring) {
+        return;
+    }
+    roaring::api::roaring_uint32_iterator_t iter;
+    roaring_init_iterator(&_roaring->roaring, &iter);
+    if (!roaring_move_uint32_iterator_equalorlarger(&iter, from)) {
+        return;
+    }
+    constexpr uint32_t kBatchSize = 256;
+    uint32_t rowids[kBatchSize];
+    while (iter.has_value && iter.current_value < to) {
+        const uint32_t n = roaring_read_uint32_iterator(&iter, rowids, std::min(kBatchSize, to - iter.current_value));
+        for (uint32_t i = 0; i < n && rowids[i] < to; i++) {
+            deleted[rowids[i] - from] = 1;
+        }
+    }
+}
+
 void DelVector::copy_from(const DelVector& delvec) {
     _loaded = delvec._loaded;
     _version = delvec._version;
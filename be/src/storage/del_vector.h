@@ -61,6 +61,12 @@ public:
 
     Roaring* roaring() { return _roaring.get(); }
 
+    const Roaring* roaring() const { return _roaring.get(); }
+
+    // Sets deleted[i] to 1 if the row `from + i` is deleted and to 0 otherwise, for the rows in [from, to).
+    // The deleted rows are read from the containers in batches instead of testing each row.
+    void fill_deleted(uint32_t from, uint32_t to, uint8_t* deleted) const;
+
     void copy_from(const DelVector& delvec);
 
 private:
@@ -76,12 +82,14 @@ private:
 };
 
 typedef std::shared_ptr<DelVector> DelVectorPtr;
+// A DelVector shared by the readers, e.g. the one in the cache of the UpdateManager or the Metacache.
+typedef std::shared_ptr<const DelVector> DelVectorCSPtr;
 
 class DelvecLoader {
 public:
     DelvecLoader() = default;
     virtual ~DelvecLoader() = default;
-    virtual Status load(const TabletSegmentId& tsid, int64_t version, DelVectorPtr* pdelvec) = 0;
+    virtual Status load(const TabletSegmentId& tsid, int64_t version, DelVectorCSPtr* pdelvec) = 0;
 };
 
 } // namespace starrocks
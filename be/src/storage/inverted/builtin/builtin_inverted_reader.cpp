@@ -0,0 +1,362 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/inverted/builtin/builtin_inverted_reader.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "io/seekable_input_stream.h"
+#include "storage/inverted/builtin/builtin_inverted_util.hpp"
+#include "storage/page_cache.h"
+#include "util/coding.h"
+
+namespace starrocks {
+
+static Status read_bitmap(Slice* input, roaring::Roaring* bitmap) {
+    Slice bytes;
+    if (!get_length_prefixed_slice(input, &bytes) ||
+        roaring_bitmap_portable_deserialize_size(bytes.data, bytes.size) != bytes.size) {
+        return Status::Corruption("the bitmap of the builtin inverted index maybe broken");
+    }
+    *bitmap = roaring::Roaring::readSafe(bytes.data, bytes.size);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::create(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                                     LogicalType field_type, std::unique_ptr<InvertedReader>* res) {
+    if (!is_string_type(field_type)) {
+        return Status::InvalidArgument(fmt::format("Not supported type {}", field_type));
+    }
+    InvertedIndexParserType parser_type = get_inverted_index_parser_type_from_string(
+            get_parser_string_from_properties(tablet_index->index_properties()));
+    if (parser_type == InvertedIndexParserType::PARSER_CHINESE) {
+        return Status::NotSupported("The builtin inverted index does not support the chinese parser");
+    }
+    *res = std::make_unique<BuiltinInvertedReader>(path, tablet_index->index_id(), parser_type);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::new_iterator(const std::shared_ptr<TabletIndex> index_meta,
+                                           InvertedIndexIterator** iterator) {
+    *iterator = new InvertedIndexIterator(index_meta, this);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_load() {
+    std::lock_guard l(_load_lock);
+    if (_loaded) {
+        return Status::OK();
+    }
+    const std::string file_path = _index_path + "/" + BUILTIN_INDEX_FILE_NAME;
+    if (!index_exists(file_path)) {
+        LOG(WARNING) << "inverted index path: " << file_path << " not exist.";
+        return Status::NotFound(fmt::format("Not exists index_file {}", file_path));
+    }
+    ASSIGN_OR_RETURN(auto file, FileSystem::Default()->new_random_access_file(file_path));
+    ASSIGN_OR_RETURN(const int64_t file_size, file->get_size());
+    if (file_size < static_cast<int64_t>(BUILTIN_INDEX_FOOTER_SIZE)) {
+        return Status::Corruption(
+                fmt::format("Bad builtin inverted index file {}: file size {}", file_path, file_size));
+    }
+    uint8_t footer[BUILTIN_INDEX_FOOTER_SIZE];
+    RETURN_IF_ERROR(file->read_at_fully(file_size - BUILTIN_INDEX_FOOTER_SIZE, footer, BUILTIN_INDEX_FOOTER_SIZE));
+    const uint64_t meta_offset = decode_fixed64_le(footer);
+    const uint32_t meta_size = decode_fixed32_le(footer + sizeof(uint64_t));
+    const uint32_t magic = decode_fixed32_le(footer + sizeof(uint64_t) + sizeof(uint32_t));
+    if (magic != BUILTIN_INDEX_MAGIC || meta_offset + meta_size + BUILTIN_INDEX_FOOTER_SIZE != file_size) {
+        return Status::Corruption(fmt::format("Bad builtin inverted index file {}: broken footer", file_path));
+    }
+
+    std::string meta(meta_size, '\0');
+    RETURN_IF_ERROR(file->read_at_fully(meta_offset, meta.data(), meta_size));
+    Slice input(meta);
+    uint32_t flags = 0;
+    uint32_t num_docs = 0;
+    uint32_t num_terms = 0;
+    if (!get_varint32(&input, &flags) || !get_varint32(&input, &num_docs)) {
+        return Status::Corruption(fmt::format("Bad builtin inverted index file {}: broken meta", file_path));
+    }
+    RETURN_IF_ERROR(read_bitmap(&input, &_null_bitmap));
+    _has_positions = (flags & BUILTIN_INDEX_HAS_POSITIONS) != 0;
+    if (_has_positions) {
+        RETURN_IF_ERROR(read_bitmap(&input, &_doc_starts));
+    }
+    if (!get_varint32(&input, &num_terms)) {
+        return Status::Corruption(fmt::format("Bad builtin inverted index file {}: broken meta", file_path));
+    }
+    _terms.resize(num_terms);
+    for (auto& entry : _terms) {
+        Slice term;
+        if (!get_length_prefixed_slice(&input, &term) || !get_varint64(&input, &entry.offset) ||
+            !get_varint32(&input, &entry.doc_size) || !get_varint32(&input, &entry.positions_size) ||
+            entry.offset + entry.doc_size + entry.positions_size > meta_offset) {
+            return Status::Corruption(fmt::format("Bad builtin inverted index file {}: broken terms", file_path));
+        }
+        entry.term = term.to_string();
+    }
+    _file = std::move(file);
+    _loaded = true;
+    return Status::OK();
+}
+
+std::vector<const BuiltinInvertedReader::TermEntry*> BuiltinInvertedReader::_find_terms(
+        const std::vector<std::string>& terms) const {
+    std::vector<size_t> order(terms.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return terms[a] < terms[b]; });
+
+    // The terms are looked up in order, each search starts from where the last one stopped.
+    std::vector<const TermEntry*> entries(terms.size(), nullptr);
+    auto it = _terms.cbegin();
+    for (size_t i : order) {
+        it = std::lower_bound(it, _terms.cend(), terms[i],
+                              [](const TermEntry& entry, const std::string& term) { return entry.term < term; });
+        if (it != _terms.cend() && it->term == terms[i]) {
+            entries[i] = &*it;
+        }
+    }
+    return entries;
+}
+
+Status BuiltinInvertedReader::_read_postings(const std::vector<const TermEntry*>& entries, bool with_positions,
+                                             std::vector<Postings>* postings) {
+    DCHECK(!with_positions || _has_positions);
+    // The docs and the positions of a term are cached as two pages of the index file.
+    struct Page {
+        StoragePageCache::CacheKey key;
+        int64_t size;
+        roaring::Roaring* bitmap;
+        PageCacheHandle handle;
+        std::unique_ptr<char[]> data;
+    };
+    postings->resize(entries.size());
+    std::vector<Page> pages;
+    pages.reserve(entries.size() * (with_positions ? 2 : 1));
+    for (size_t i = 0; i < entries.size(); i++) {
+        pages.push_back({{_file->filename(), static_cast<int64_t>(entries[i]->offset)},
+                         entries[i]->doc_size,
+                         &(*postings)[i].docs,
+                         {},
+                         nullptr});
+        if (with_positions) {
+            pages.push_back({{_file->filename(), static_cast<int64_t>(entries[i]->offset + entries[i]->doc_size)},
+                             entries[i]->positions_size,
+                             &(*postings)[i].positions,
+                             {},
+                             nullptr});
+        }
+    }
+
+    auto* cache = StoragePageCache::instance();
+    std::vector<io::ReadRange> ranges;
+    for (auto& page : pages) {
+        if (cache == nullptr || !cache->lookup(page.key, &page.handle)) {
+            page.data.reset(new char[page.size]);
+            ranges.push_back({page.key.offset, page.size, page.data.get()});
+        }
+    }
+    if (!ranges.empty()) {
+        RETURN_IF_ERROR(_file->read_at_fully_batch(ranges));
+    }
+
+    for (auto& page : pages) {
+        Slice input;
+        if (page.data != nullptr) {
+            input = Slice(page.data.get(), page.size);
+        } else {
+            input = page.handle.data();
+        }
+        RETURN_IF_ERROR(read_bitmap(&input, page.bitmap));
+        if (page.data != nullptr && cache != nullptr) {
+            cache->insert(page.key, Slice(page.data.get(), page.size), &page.handle);
+            page.data.release(); // memory now managed by handle
+        }
+    }
+    return Status::OK();
+}
+
+template <typename Pred>
+Status BuiltinInvertedReader::_union_terms(std::vector<TermEntry>::const_iterator begin,
+                                           std::vector<TermEntry>::const_iterator end, Pred&& pred,
+                                           roaring::Roaring* result) {
+    std::vector<const TermEntry*> entries;
+    for (auto it = begin; it < end; ++it) {
+        if (pred(it->term)) {
+            entries.push_back(&*it);
+        }
+    }
+    std::vector<Postings> postings;
+    RETURN_IF_ERROR(_read_postings(entries, false, &postings));
+    std::vector<const roaring::Roaring*> docs;
+    docs.reserve(postings.size());
+    for (const auto& p : postings) {
+        docs.push_back(&p.docs);
+    }
+    *result = roaring::Roaring::fastunion(docs.size(), docs.data());
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_match_all(const std::vector<std::string>& tokens, roaring::Roaring* result) {
+    std::vector<const TermEntry*> entries = _find_terms(tokens);
+    if (tokens.empty() || std::find(entries.begin(), entries.end(), nullptr) != entries.end()) {
+        return Status::OK();
+    }
+    std::vector<Postings> postings;
+    RETURN_IF_ERROR(_read_postings(entries, false, &postings));
+    std::sort(postings.begin(), postings.end(),
+              [](const Postings& a, const Postings& b) { return a.docs.cardinality() < b.docs.cardinality(); });
+    *result = std::move(postings[0].docs);
+    for (size_t i = 1; i < postings.size() && !result->isEmpty(); i++) {
+        *result &= postings[i].docs;
+    }
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_match_phrase(const std::vector<std::string>& tokens, roaring::Roaring* result) {
+    if (tokens.size() <= 1 || !builtin_is_tokenized(_parser_type)) {
+        return _match_all(tokens, result);
+    }
+    if (!_has_positions) {
+        return Status::NotSupported("The builtin inverted index has no positions for the phrase query");
+    }
+    std::vector<const TermEntry*> entries = _find_terms(tokens);
+    if (std::find(entries.begin(), entries.end(), nullptr) != entries.end()) {
+        return Status::OK();
+    }
+    std::vector<Postings> postings;
+    RETURN_IF_ERROR(_read_postings(entries, true, &postings));
+
+    // The positions of the rarest token drive the search, the other tokens must follow at their offsets in
+    // the phrase.
+    size_t driver = 0;
+    for (size_t i = 1; i < postings.size(); i++) {
+        if (postings[i].positions.cardinality() < postings[driver].positions.cardinality()) {
+            driver = i;
+        }
+    }
+    for (uint32_t position : postings[driver].positions) {
+        if (position < driver) {
+            continue;
+        }
+        const uint64_t start = position - driver;
+        bool matched = true;
+        for (size_t i = 0; i < postings.size() && matched; i++) {
+            matched = i == driver || (start + i <= std::numeric_limits<uint32_t>::max() &&
+                                      postings[i].positions.contains(static_cast<uint32_t>(start + i)));
+        }
+        if (matched) {
+            // the doc of the phrase is the last doc starting at or before its first position
+            result->add(static_cast<uint32_t>(_doc_starts.rank(start) - 1));
+        }
+    }
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_match_wildcard(const std::string& pattern, roaring::Roaring* result) {
+    auto first_wildcard = std::find_if(pattern.begin(), pattern.end(), builtin_is_wildcard);
+    if (first_wildcard == pattern.end()) {
+        return _match_all({pattern}, result);
+    }
+    // Only the terms starting with the literal prefix of the pattern are matched.
+    const std::string prefix(pattern.begin(), first_wildcard);
+    auto begin = std::lower_bound(_terms.cbegin(), _terms.cend(), prefix,
+                                  [](const TermEntry& entry, const std::string& term) { return entry.term < term; });
+    auto end = std::find_if(begin, _terms.cend(),
+                            [&](const TermEntry& entry) { return entry.term.compare(0, prefix.size(), prefix) != 0; });
+    return _union_terms(begin, end, [&](const std::string& term) { return builtin_wildcard_match(pattern, term); },
+                        result);
+}
+
+Status BuiltinInvertedReader::_match_range(const std::string& bound, InvertedIndexQueryType query_type,
+                                           roaring::Roaring* result) {
+    auto less = [](const TermEntry& entry, const std::string& term) { return entry.term < term; };
+    auto greater = [](const std::string& term, const TermEntry& entry) { return term < entry.term; };
+    auto begin = _terms.cbegin();
+    auto end = _terms.cend();
+    switch (query_type) {
+    case InvertedIndexQueryType::LESS_THAN_QUERY:
+        end = std::lower_bound(_terms.cbegin(), _terms.cend(), bound, less);
+        break;
+    case InvertedIndexQueryType::LESS_EQUAL_QUERY:
+        end = std::upper_bound(_terms.cbegin(), _terms.cend(), bound, greater);
+        break;
+    case InvertedIndexQueryType::GREATER_THAN_QUERY:
+        begin = std::upper_bound(_terms.cbegin(), _terms.cend(), bound, greater);
+        break;
+    case InvertedIndexQueryType::GREATER_EQUAL_QUERY:
+        begin = std::lower_bound(_terms.cbegin(), _terms.cend(), bound, less);
+        break;
+    default:
+        return Status::InvalidArgument("Unknown query type");
+    }
+    return _union_terms(begin, end, [](const std::string&) { return true; }, result);
+}
+
+Status BuiltinInvertedReader::query(OlapReaderStatistics* stats, const std::string& column_name,
+                                    const void* query_value, InvertedIndexQueryType query_type,
+                                    roaring::Roaring* bit_map) {
+    RETURN_IF_ERROR(_load());
+    const auto* search_query = reinterpret_cast<const Slice*>(query_value);
+    Slice search_str(search_query->data, strnlen(search_query->data, search_query->size));
+    VLOG(1) << "begin to query the builtin inverted index, column_name: " << column_name
+            << ", search_str: " << search_str.to_string();
+
+    std::vector<std::string> tokens;
+    builtin_tokenize(_parser_type, search_str, [&](std::string&& token) { tokens.push_back(std::move(token)); });
+
+    roaring::Roaring result;
+    switch (query_type) {
+    case InvertedIndexQueryType::MATCH_ALL_QUERY:
+    case InvertedIndexQueryType::EQUAL_QUERY:
+        RETURN_IF_ERROR(_match_all(tokens, &result));
+        break;
+    case InvertedIndexQueryType::MATCH_PHRASE_QUERY:
+        RETURN_IF_ERROR(_match_phrase(tokens, &result));
+        break;
+    case InvertedIndexQueryType::MATCH_WILDCARD_QUERY: {
+        // the wildcards are not split by the tokenizer, only the case is folded
+        std::string pattern = search_str.to_string();
+        if (builtin_is_tokenized(_parser_type)) {
+            std::transform(pattern.begin(), pattern.end(), pattern.begin(), [](unsigned char c) {
+                return static_cast<char>(std::tolower(c));
+            });
+        }
+        RETURN_IF_ERROR(_match_wildcard(pattern, &result));
+        break;
+    }
+    case InvertedIndexQueryType::LESS_THAN_QUERY:
+    case InvertedIndexQueryType::LESS_EQUAL_QUERY:
+    case InvertedIndexQueryType::GREATER_THAN_QUERY:
+    case InvertedIndexQueryType::GREATER_EQUAL_QUERY:
+        RETURN_IF_ERROR(_match_range(search_str.to_string(), query_type, &result));
+        break;
+    default:
+        return Status::InvalidArgument("Unknown query type");
+    }
+    bit_map->swap(result);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::query_null(OlapReaderStatistics* stats, const std::string& column_name,
+                                         roaring::Roaring* bit_map) {
+    RETURN_IF_ERROR(_load());
+    *bit_map = _null_bitmap;
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,97 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fs/fs.h"
+#include "storage/inverted/inverted_reader.h"
+
+namespace starrocks {
+
+class InvertedIndexIterator;
+enum class InvertedIndexQueryType;
+enum class InvertedIndexReaderType;
+
+// Reads the builtin index file, see builtin_inverted_util.hpp for the layout.
+//
+// The terms are loaded once into memory on the first query, the postings are read on demand through the
+// StoragePageCache, and all the postings missing from the cache for a query are read in one batch.
+class BuiltinInvertedReader : public InvertedReader {
+public:
+    BuiltinInvertedReader(std::string path, const uint32_t index_id, InvertedIndexParserType parser_type)
+            : InvertedReader(std::move(path), index_id), _parser_type(parser_type) {}
+
+    static Status create(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                         LogicalType field_type, std::unique_ptr<InvertedReader>* res);
+
+    Status new_iterator(const std::shared_ptr<TabletIndex> index_meta, InvertedIndexIterator** iterator) override;
+
+    Status query(OlapReaderStatistics* stats, const std::string& column_name, const void* query_value,
+                 InvertedIndexQueryType query_type, roaring::Roaring* bit_map) override;
+
+    Status query_null(OlapReaderStatistics* stats, const std::string& column_name, roaring::Roaring* bit_map) override;
+
+    InvertedIndexReaderType get_inverted_index_reader_type() override { return InvertedIndexReaderType::TEXT; }
+
+private:
+    struct TermEntry {
+        std::string term;
+        uint64_t offset;
+        uint32_t doc_size;
+        uint32_t positions_size;
+    };
+
+    struct Postings {
+        roaring::Roaring docs;
+        roaring::Roaring positions;
+    };
+
+    Status _load();
+
+    // Returns the entries of `terms` in their order, nullptr for a term not in the index.
+    std::vector<const TermEntry*> _find_terms(const std::vector<std::string>& terms) const;
+
+    // Reads the postings of `entries`, with the positions if `with_positions`.
+    Status _read_postings(const std::vector<const TermEntry*>& entries, bool with_positions,
+                          std::vector<Postings>* postings);
+
+    // Unions the docs of the terms in [begin, end) that `pred` accepts.
+    template <typename Pred>
+    Status _union_terms(std::vector<TermEntry>::const_iterator begin, std::vector<TermEntry>::const_iterator end,
+                        Pred&& pred, roaring::Roaring* result);
+
+    Status _match_all(const std::vector<std::string>& tokens, roaring::Roaring* result);
+    Status _match_phrase(const std::vector<std::string>& tokens, roaring::Roaring* result);
+    Status _match_wildcard(const std::string& pattern, roaring::Roaring* result);
+    Status _match_range(const std::string& bound, InvertedIndexQueryType query_type, roaring::Roaring* result);
+
+    InvertedIndexParserType _parser_type;
+
+    std::mutex _load_lock;
+    bool _loaded = false;
+    std::unique_ptr<RandomAccessFile> _file;
+    bool _has_positions = false;
+    roaring::Roaring _null_bitmap;
+    roaring::Roaring _doc_starts;
+    // sorted by the term
+    std::vector<TermEntry> _terms;
+};
+
+} // namespace starrocks
@@ -0,0 +1,107 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The builtin inverted index keeps all the postings of a segment column in a single file inside the index
+// directory:
+//   Postings, one block for each term in the term order
+//     doc ids of the term (portable roaring bitmap)
+//     token positions of the term (portable roaring bitmap), only when the index has positions
+//   Meta
+//     flags (varint32)
+//     num_docs (varint32)
+//     null bitmap (length prefixed portable roaring bitmap)
+//     positions of the first token of each doc (length prefixed portable roaring bitmap), only with positions
+//     num_terms (varint32)
+//     terms, each of: term (length prefixed), block offset (varint64), doc size (varint32), positions size (varint32)
+//   Footer
+//     meta offset (64-bit fixed)
+//     meta size (32-bit fixed)
+//     magic (32-bit fixed)
+//
+// The tokens of the docs are numbered in the segment, the docs are separated by one unused position so that
+// each doc has a distinct first position and a phrase never spans two docs.
+
+#pragma once
+
+#include <cctype>
+#include <string>
+
+#include "storage/inverted/inverted_index_common.hpp"
+#include "util/slice.h"
+
+namespace starrocks {
+
+const std::string BUILTIN_INDEX_FILE_NAME = "builtin.bidx";
+constexpr uint32_t BUILTIN_INDEX_MAGIC = 0x58444942; // "BIDX"
+constexpr size_t BUILTIN_INDEX_FOOTER_SIZE = sizeof(uint64_t) + 2 * sizeof(uint32_t);
+constexpr uint32_t BUILTIN_INDEX_HAS_POSITIONS = 1;
+
+inline bool builtin_is_tokenized(InvertedIndexParserType parser_type) {
+    return parser_type != InvertedIndexParserType::PARSER_NONE;
+}
+
+// Splits `value` into the lower case runs of ASCII letters and digits, the bytes of multi-byte UTF-8 characters
+// are kept in the tokens. The untokenized index takes the whole value as its only token.
+template <typename F>
+void builtin_tokenize(InvertedIndexParserType parser_type, const Slice& value, F&& on_token) {
+    if (!builtin_is_tokenized(parser_type)) {
+        on_token(std::string(value.data, value.size));
+        return;
+    }
+    std::string token;
+    for (size_t i = 0; i < value.size; i++) {
+        auto c = static_cast<unsigned char>(value.data[i]);
+        if (c >= 0x80 || std::isalnum(c)) {
+            token.push_back(static_cast<char>(std::tolower(c)));
+        } else if (!token.empty()) {
+            on_token(std::move(token));
+            token.clear();
+        }
+    }
+    if (!token.empty()) {
+        on_token(std::move(token));
+    }
+}
+
+inline bool builtin_is_wildcard(char c) {
+    return c == '*' || c == '%' || c == '?';
+}
+
+// Matches `term` with `pattern`, in which '*' and '%' match any bytes and '?' matches a single byte.
+inline bool builtin_wildcard_match(const std::string& pattern, const std::string& term) {
+    size_t p = 0;
+    size_t t = 0;
+    size_t star = std::string::npos;
+    size_t star_t = 0;
+    while (t < term.size()) {
+        if (p < pattern.size() && (pattern[p] == '*' || pattern[p] == '%')) {
+            star = p++;
+            star_t = t;
+        } else if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == term[t])) {
+            p++;
+            t++;
+        } else if (star != std::string::npos) {
+            p = star + 1;
+            t = ++star_t;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && (pattern[p] == '*' || pattern[p] == '%')) {
+        p++;
+    }
+    return p == pattern.size();
+}
+
+} // namespace starrocks
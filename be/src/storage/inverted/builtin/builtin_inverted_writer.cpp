@@ -0,0 +1,228 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/inverted/builtin/builtin_inverted_writer.h"
+
+#include <algorithm>
+#include <limits>
+#include <roaring/roaring.hh>
+#include <vector>
+
+#include "common/status.h"
+#include "fs/fs.h"
+#include "fs/fs_util.h"
+#include "gutil/strings/substitute.h"
+#include "storage/inverted/builtin/builtin_inverted_util.hpp"
+#include "storage/inverted/inverted_index_option.h"
+#include "storage/olap_common.h"
+#include "types/logical_type.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+template <LogicalType field_type>
+class BuiltinInvertedWriterImpl : public BuiltinInvertedWriter {
+public:
+    BuiltinInvertedWriterImpl(std::string directory, InvertedIndexParserType parser_type)
+            : _directory(std::move(directory)),
+              _parser_type(parser_type),
+              _has_positions(builtin_is_tokenized(parser_type)) {}
+
+    uint64_t size() const override { return _rid; }
+
+    uint64_t estimate_buffer_size() const override { return _mem_usage; }
+
+    uint64_t total_mem_footprint() const override { return _mem_usage; }
+
+    Status init() override {
+        if constexpr (is_string_type(field_type)) {
+            return Status::OK();
+        }
+        return Status::NotFound("Field type not supported");
+    }
+
+    void add_values(const void* values, size_t count) override {
+        if constexpr (is_string_type(field_type)) {
+            const auto* slices = reinterpret_cast<const Slice*>(values);
+            for (size_t i = 0; i < count; i++) {
+                _add_doc(slices[i]);
+            }
+        } else {
+            LOG(ERROR) << "Inverted not supported type: " << field_type;
+        }
+    }
+
+    void add_nulls(uint32_t count) override {
+        _null_bitmap.addRange(_rid, _rid + count);
+        for (uint32_t i = 0; i < count; i++) {
+            // nulls have no tokens, but each one still takes a doc start position
+            _start_doc(0);
+            _finish_doc();
+        }
+    }
+
+    Status finish() override {
+        RETURN_IF_ERROR(fs::create_directories(_directory));
+        const std::string path = _directory + "/" + BUILTIN_INDEX_FILE_NAME;
+        ASSIGN_OR_RETURN(auto file, FileSystem::Default()->new_writable_file(path));
+
+        std::vector<std::pair<const std::string*, Posting*>> terms;
+        terms.reserve(_postings.size());
+        for (auto& [term, posting] : _postings) {
+            terms.emplace_back(&term, &posting);
+        }
+        std::sort(terms.begin(), terms.end(), [](const auto& a, const auto& b) { return *a.first < *b.first; });
+
+        faststring meta;
+        put_varint32(&meta, _has_positions ? BUILTIN_INDEX_HAS_POSITIONS : 0);
+        put_varint32(&meta, _rid);
+        _put_bitmap(&_null_bitmap, &meta);
+        if (_has_positions) {
+            _put_bitmap(&_doc_starts, &meta);
+        }
+        put_varint32(&meta, terms.size());
+
+        uint64_t offset = 0;
+        faststring block;
+        for (auto& [term, posting] : terms) {
+            block.clear();
+            _put_bitmap(&posting->docs, &block);
+            const uint32_t doc_size = block.size();
+            if (_has_positions) {
+                _put_bitmap(&posting->positions, &block);
+            }
+            RETURN_IF_ERROR(file->append(Slice(block.data(), block.size())));
+            put_length_prefixed_slice(&meta, Slice(*term));
+            put_varint64(&meta, offset);
+            put_varint32(&meta, doc_size);
+            put_varint32(&meta, block.size() - doc_size);
+            offset += block.size();
+        }
+
+        const uint32_t meta_size = meta.size();
+        put_fixed64_le(&meta, offset);
+        put_fixed32_le(&meta, meta_size);
+        put_fixed32_le(&meta, BUILTIN_INDEX_MAGIC);
+        RETURN_IF_ERROR(file->append(Slice(meta.data(), meta.size())));
+        RETURN_IF_ERROR(file->close());
+
+        _postings.clear();
+        _mem_usage = 0;
+        return Status::OK();
+    }
+
+private:
+    struct Posting {
+        roaring::Roaring docs;
+        roaring::Roaring positions;
+    };
+
+    // The approximate bytes taken by a term in the hash map and by each entry of a roaring bitmap.
+    static constexpr size_t kTermOverhead = sizeof(std::string) + sizeof(Posting) + 16;
+    static constexpr size_t kBitmapEntrySize = 2;
+
+    void _add_doc(const Slice& value) {
+        _start_doc(value.size);
+        builtin_tokenize(_parser_type, value, [&](std::string&& token) {
+            auto [it, inserted] = _postings.try_emplace(std::move(token));
+            if (inserted) {
+                _mem_usage += it->first.size() + kTermOverhead;
+            }
+            it->second.docs.add(_rid);
+            _mem_usage += kBitmapEntrySize;
+            if (_has_positions) {
+                it->second.positions.add(static_cast<uint32_t>(_next_position++));
+                _mem_usage += kBitmapEntrySize;
+            }
+        });
+        _finish_doc();
+    }
+
+    // `max_tokens` bounds the number of the tokens of the doc.
+    void _start_doc(size_t max_tokens) {
+        if (_has_positions) {
+            if (_next_position + max_tokens >= std::numeric_limits<uint32_t>::max()) {
+                // The token positions no longer fit in 32 bits, the phrase queries are left to the
+                // predicates on this segment.
+                _drop_positions();
+            } else {
+                _doc_starts.add(static_cast<uint32_t>(_next_position));
+                _mem_usage += kBitmapEntrySize;
+            }
+        }
+    }
+
+    void _finish_doc() {
+        // one unused position separates the docs
+        _next_position++;
+        _rid++;
+    }
+
+    void _drop_positions() {
+        _has_positions = false;
+        _doc_starts = roaring::Roaring();
+        for (auto& [term, posting] : _postings) {
+            posting.positions = roaring::Roaring();
+        }
+    }
+
+    static void _put_bitmap(roaring::Roaring* bitmap, faststring* dst) {
+        bitmap->runOptimize();
+        const size_t size = bitmap->getSizeInBytes(true);
+        put_varint32(dst, size);
+        const size_t begin = dst->size();
+        dst->resize(begin + size);
+        bitmap->write(reinterpret_cast<char*>(dst->data() + begin), true);
+    }
+
+    std::string _directory;
+    InvertedIndexParserType _parser_type;
+    bool _has_positions;
+    rowid_t _rid = 0;
+    uint64_t _next_position = 0;
+    uint64_t _mem_usage = 0;
+    phmap::flat_hash_map<std::string, Posting> _postings;
+    roaring::Roaring _null_bitmap;
+    roaring::Roaring _doc_starts;
+};
+
+Status BuiltinInvertedWriter::create(const TypeInfoPtr& typeinfo, const std::string& field_name,
+                                     const std::string& directory, TabletIndex* tablet_index,
+                                     std::unique_ptr<InvertedWriter>* res) {
+    InvertedIndexParserType parser_type = get_inverted_index_parser_type_from_string(
+            get_parser_string_from_properties(tablet_index->index_properties()));
+    if (parser_type == InvertedIndexParserType::PARSER_CHINESE) {
+        return Status::NotSupported("The builtin inverted index does not support the chinese parser");
+    }
+
+    LogicalType type = typeinfo->type();
+    switch (type) {
+    case LogicalType::TYPE_CHAR: {
+        *res = std::make_unique<BuiltinInvertedWriterImpl<LogicalType::TYPE_CHAR>>(directory, parser_type);
+        break;
+    }
+    case LogicalType::TYPE_VARCHAR: {
+        *res = std::make_unique<BuiltinInvertedWriterImpl<LogicalType::TYPE_VARCHAR>>(directory, parser_type);
+        break;
+    }
+    default:
+        return Status::NotSupported(
+                strings::Substitute("Unsupported type for inverted index: $0", type_to_string_v2(type)));
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,41 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storage/inverted/inverted_writer.h"
+#include "storage/tablet_schema.h"
+
+namespace starrocks {
+
+// Builds the postings of the terms in memory and writes them into the builtin index file on finish(), see
+// builtin_inverted_util.hpp for the layout.
+class BuiltinInvertedWriter : public InvertedWriter {
+public:
+    BuiltinInvertedWriter(const BuiltinInvertedWriter&) = delete;
+
+    const BuiltinInvertedWriter& operator=(const BuiltinInvertedWriter&) = delete;
+
+    BuiltinInvertedWriter() = default;
+
+    ~BuiltinInvertedWriter() override = default;
+
+    static Status create(const TypeInfoPtr& typeinfo, const std::string& field_name, const std::string& directory,
+                         TabletIndex* tablet_index, std::unique_ptr<InvertedWriter>* res);
+};
+
+} // namespace starrocks
@@ -22,6 +22,7 @@
 #include "storage/olap_common.h"
 
 #define INVERTED_INDEX_MARK_NAME "ivt"
+#define VECTOR_INDEX_MARK_NAME "vi"
 
 namespace starrocks {
 class IndexDescriptor {
@@ -33,6 +34,12 @@ public:
         return fmt::format("{}/{}_{}_{}.{}", rowset_dir, rowset_id, segment_id, index_id, INVERTED_INDEX_MARK_NAME);
     }
 
+    static std::string vector_index_file_path(const std::string& rowset_dir, const std::string& rowset_id,
+                                              int segment_id, int64_t index_id) {
+        // vector index is a single file, {rowset_dir}/{rowset_id}_{seg_num}_{index_id}.vi
+        return fmt::format("{}/{}_{}_{}.{}", rowset_dir, rowset_id, segment_id, index_id, VECTOR_INDEX_MARK_NAME);
+    }
+
     static const std::string get_temporary_null_bitmap_file_name() { return "null_bitmap"; }
 };
 
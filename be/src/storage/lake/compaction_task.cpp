@@ -14,8 +14,11 @@
 
 #include "storage/lake/compaction_task.h"
 
+#include "common/config.h"
 #include "runtime/exec_env.h"
+#include "storage/lake/rowset.h"
 #include "storage/lake/tablet.h"
+#include "storage/lake/txn_log.h"
 #include "storage/lake/update_manager.h"
 
 namespace starrocks::lake {
@@ -42,4 +45,29 @@ Status CompactionTask::execute_index_major_compaction(TxnLogPB* txn_log) {
     return Status::OK();
 }
 
+bool CompactionTask::should_fill_data_cache() const {
+    auto max_bytes = config::lake_compaction_fill_data_cache_max_bytes;
+    if (max_bytes < 0) {
+        return true;
+    }
+    int64_t input_bytes = 0;
+    for (const auto& rowset : _input_rowsets) {
+        input_bytes += rowset->data_size();
+    }
+    return input_bytes <= max_bytes;
+}
+
+void CompactionTask::warm_up_output_segments(const TxnLogPB& txn_log) const {
+    if (!config::lake_compaction_warm_up_output_segments || !txn_log.has_op_compaction() ||
+        txn_log.op_compaction().output_rowset().segments_size() == 0) {
+        return;
+    }
+    Rowset output(_tablet.tablet_manager(), _tablet.id(), &txn_log.op_compaction().output_rowset(), -1 /*unused*/,
+                  _tablet.get_schema());
+    LakeIOOptions lake_io_opts{.fill_data_cache = true};
+    auto res = output.segments(lake_io_opts, true /*fill_metadata_cache*/);
+    LOG_IF(WARNING, !res.ok()) << "Fail to warm up the output segments of tablet " << _tablet.id()
+                               << ", txn_id: " << _txn_id << ": " << res.status();
+}
+
 } // namespace starrocks::lake
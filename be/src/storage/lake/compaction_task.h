@@ -45,6 +45,15 @@ public:
 
     Status execute_index_major_compaction(TxnLogPB* txn_log);
 
+    // Whether the output of this task is admitted to the local data cache, i.e. the size of the input rowsets is
+    // no more than lake_compaction_fill_data_cache_max_bytes. A large compaction would otherwise evict the hot data
+    // of many other tablets.
+    bool should_fill_data_cache() const;
+
+    // Open the output segments of |txn_log| into the metacache, so that the first queries after the compaction
+    // is published do not read the segment footers from the object storage.
+    void warm_up_output_segments(const TxnLogPB& txn_log) const;
+
     inline static const CancelFunc kNoCancelFn = []() { return false; };
     inline static const CancelFunc kCancelledFn = []() { return true; };
 
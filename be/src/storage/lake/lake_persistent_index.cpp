@@ -15,6 +15,7 @@
 #include "storage/lake/lake_persistent_index.h"
 
 #include "fs/fs_util.h"
+#include "runtime/current_thread.h"
 #include "storage/chunk_helper.h"
 #include "storage/lake/filenames.h"
 #include "storage/lake/meta_file.h"
@@ -29,6 +30,8 @@
 #include "storage/sstable/merger.h"
 #include "storage/sstable/options.h"
 #include "storage/sstable/table_builder.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 
 namespace starrocks::lake {
@@ -304,10 +307,13 @@ Status LakePersistentIndex::prepare_merging_iterator(
     return Status::OK();
 }
 
-Status LakePersistentIndex::merge_sstables(std::unique_ptr<sstable::Iterator> iter_ptr,
-                                           sstable::TableBuilder* builder) {
+Status LakePersistentIndex::merge_sstables(std::unique_ptr<sstable::Iterator> iter_ptr, sstable::TableBuilder* builder,
+                                           const std::string& upper) {
     auto merger = std::make_unique<KeyValueMerger>(iter_ptr->key().to_string(), builder);
     while (iter_ptr->Valid()) {
+        if (!upper.empty() && iter_ptr->key().compare(Slice(upper)) >= 0) {
+            break;
+        }
         RETURN_IF_ERROR(merger->merge(iter_ptr->key().to_string(), iter_ptr->value().to_string()));
         iter_ptr->Next();
     }
@@ -316,6 +322,118 @@ Status LakePersistentIndex::merge_sstables(std::unique_ptr<sstable::Iterator> it
     return builder->Finish();
 }
 
+std::vector<std::string> LakePersistentIndex::pick_merge_split_keys(
+        const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables) {
+    std::vector<std::string> split_keys;
+    int64_t input_bytes = 0;
+    for (const auto& sstable : sstables) {
+        input_bytes += sstable->sstable_pb().filesize();
+    }
+    const int64_t min_range_bytes = std::max<int64_t>(1, config::lake_pk_index_sst_merge_min_range_bytes);
+    const auto num_ranges = static_cast<size_t>(
+            std::min<int64_t>(std::max(1, config::lake_pk_index_sst_merge_dop), input_bytes / min_range_bytes));
+    if (num_ranges <= 1) {
+        return split_keys;
+    }
+    // Each input contributes one index key per data block, so the quantiles of the index keys split
+    // the input into ranges of about the same number of blocks.
+    std::vector<std::string> index_keys;
+    for (const auto& sstable : sstables) {
+        sstable->get_index_keys(&index_keys);
+    }
+    if (index_keys.size() < num_ranges) {
+        return split_keys;
+    }
+    std::sort(index_keys.begin(), index_keys.end());
+    for (size_t i = 1; i < num_ranges; i++) {
+        auto& key = index_keys[i * index_keys.size() / num_ranges];
+        if (!key.empty() && (split_keys.empty() || split_keys.back() < key)) {
+            split_keys.emplace_back(std::move(key));
+        }
+    }
+    return split_keys;
+}
+
+Status LakePersistentIndex::merge_sstables_in_range(
+        const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables, const std::string& lower,
+        const std::string& upper, PersistentIndexSstablePB* output) {
+    sstable::ReadOptions read_options;
+    // No need to cache input sst's blocks.
+    read_options.fill_cache = false;
+    std::vector<sstable::Iterator*> iters;
+    iters.reserve(sstables.size());
+    for (const auto& sstable : sstables) {
+        iters.emplace_back(sstable->new_iterator(read_options));
+    }
+    sstable::Options options;
+    // the merging iterator takes the ownership of iters
+    std::unique_ptr<sstable::Iterator> iter_ptr(
+            sstable::NewMergingIterator(options.comparator, iters.data(), iters.size()));
+    if (lower.empty()) {
+        iter_ptr->SeekToFirst();
+    } else {
+        iter_ptr->Seek(Slice(lower));
+    }
+    if (!iter_ptr->Valid() || (!upper.empty() && iter_ptr->key().compare(Slice(upper)) >= 0)) {
+        return iter_ptr->status();
+    }
+
+    auto filename = gen_sst_filename();
+    ASSIGN_OR_RETURN(auto wf, fs::new_writable_file(_tablet_mgr->sst_location(_tablet_id, filename)));
+    std::unique_ptr<sstable::FilterPolicy> filter_policy;
+    filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
+    options.filter_policy = filter_policy.get();
+    sstable::TableBuilder builder(options, wf.get());
+    RETURN_IF_ERROR(merge_sstables(std::move(iter_ptr), &builder, upper));
+    RETURN_IF_ERROR(wf->close());
+    output->set_filename(filename);
+    output->set_filesize(builder.FileSize());
+    return Status::OK();
+}
+
+Status LakePersistentIndex::parallel_merge_sstables(
+        const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables,
+        const std::vector<std::string>& split_keys, TxnLogPB* txn_log) {
+    ThreadPool* pool = _tablet_mgr->update_mgr()->sst_merge_pool();
+    const size_t num_ranges = split_keys.size() + 1;
+    const std::string unbounded;
+    std::vector<PersistentIndexSstablePB> outputs(num_ranges);
+    std::vector<Status> statuses(num_ranges);
+    auto merge_range = [&](size_t i) {
+        const std::string& lower = i == 0 ? unbounded : split_keys[i - 1];
+        const std::string& upper = i + 1 == num_ranges ? unbounded : split_keys[i];
+        statuses[i] = merge_sstables_in_range(sstables, lower, upper, &outputs[i]);
+    };
+
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    CountDownLatch latch(num_ranges - 1);
+    for (size_t i = 1; i < num_ranges; i++) {
+        auto task = [&merge_range, &latch, mem_tracker, i]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            merge_range(i);
+            latch.count_down();
+        };
+        if (!pool->submit_func(task).ok()) {
+            // the pool is shutting down, merge the range in the current thread.
+            task();
+        }
+    }
+    merge_range(0);
+    latch.wait();
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+
+    // record output sstables pb, ordered by key
+    for (const auto& output : outputs) {
+        if (!output.filename().empty()) {
+            txn_log->mutable_op_compaction()->add_output_sstables()->CopyFrom(output);
+        }
+    }
+    VLOG(2) << "merge sst in " << num_ranges << " ranges, tablet: " << _tablet_id;
+    return Status::OK();
+}
+
 Status LakePersistentIndex::major_compact(const TabletMetadata& metadata, int64_t min_retain_version,
                                           TxnLogPB* txn_log) {
     if (metadata.sstable_meta().sstables_size() < config::lake_pk_index_sst_min_compaction_versions) {
@@ -330,6 +448,14 @@ Status LakePersistentIndex::major_compact(const TabletMetadata& metadata, int64_
         return merging_iter_ptr->status();
     }
 
+    // Split a large input into key ranges and merge them in parallel, into one output sstable per range.
+    // The outputs have disjoint key ranges, so a lookup still probes at most one of them per key.
+    auto split_keys = pick_merge_split_keys(sstable_vec);
+    if (!split_keys.empty() && _tablet_mgr->update_mgr()->sst_merge_pool() != nullptr) {
+        merging_iter_ptr.reset();
+        return parallel_merge_sstables(sstable_vec, split_keys, txn_log);
+    }
+
     auto filename = gen_sst_filename();
     auto location = _tablet_mgr->sst_location(_tablet_id, filename);
     ASSIGN_OR_RETURN(auto wf, fs::new_writable_file(location));
@@ -352,16 +478,28 @@ Status LakePersistentIndex::apply_opcompaction(const TxnLogPB_OpCompaction& op_c
         return Status::OK();
     }
 
-    PersistentIndexSstablePB sstable_pb;
-    sstable_pb.CopyFrom(op_compaction.output_sstable());
-    sstable_pb.set_version(op_compaction.input_sstables(op_compaction.input_sstables().size() - 1).version());
-    auto sstable = std::make_unique<PersistentIndexSstable>();
-    ASSIGN_OR_RETURN(auto rf, fs::new_random_access_file(_tablet_mgr->sst_location(_tablet_id, sstable_pb.filename())));
+    // A compaction merged by key ranges has several output sstables of disjoint key ranges and the same version.
+    std::vector<PersistentIndexSstablePB> output_sstables;
+    if (op_compaction.output_sstables_size() > 0) {
+        output_sstables.assign(op_compaction.output_sstables().begin(), op_compaction.output_sstables().end());
+    } else {
+        output_sstables.emplace_back(op_compaction.output_sstable());
+    }
     auto* block_cache = _tablet_mgr->update_mgr()->block_cache();
     if (block_cache == nullptr) {
         return Status::InternalError("Block cache is null.");
     }
-    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+    const int64_t version = op_compaction.input_sstables(op_compaction.input_sstables().size() - 1).version();
+    std::vector<std::unique_ptr<PersistentIndexSstable>> new_sstables;
+    new_sstables.reserve(output_sstables.size());
+    for (auto& sstable_pb : output_sstables) {
+        sstable_pb.set_version(version);
+        auto sstable = std::make_unique<PersistentIndexSstable>();
+        ASSIGN_OR_RETURN(auto rf,
+                         fs::new_random_access_file(_tablet_mgr->sst_location(_tablet_id, sstable_pb.filename())));
+        RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+        new_sstables.emplace_back(std::move(sstable));
+    }
 
     std::unordered_set<std::string> filenames;
     for (const auto& input_sstable : op_compaction.input_sstables()) {
@@ -372,7 +510,8 @@ Status LakePersistentIndex::apply_opcompaction(const TxnLogPB_OpCompaction& op_c
                                        return filenames.contains(sstable->sstable_pb().filename());
                                    }),
                     _sstables.end());
-    _sstables.insert(_sstables.begin(), std::move(sstable));
+    _sstables.insert(_sstables.begin(), std::make_move_iterator(new_sstables.begin()),
+                     std::make_move_iterator(new_sstables.end()));
     return Status::OK();
 }
 
@@ -155,7 +155,24 @@ private:
                                     std::vector<std::shared_ptr<PersistentIndexSstable>>* merging_sstables,
                                     std::unique_ptr<sstable::Iterator>* merging_iter_ptr);
 
-    Status merge_sstables(std::unique_ptr<sstable::Iterator> iter_ptr, sstable::TableBuilder* builder);
+    // merge the keys of |iter_ptr| less than |upper| into |builder|, an empty |upper| means no upper bound
+    Status merge_sstables(std::unique_ptr<sstable::Iterator> iter_ptr, sstable::TableBuilder* builder,
+                          const std::string& upper = "");
+
+    // pick the keys to split the key space of |sstables| into ranges of similar size to merge in parallel,
+    // return an empty vector if the input is too small to split
+    static std::vector<std::string> pick_merge_split_keys(
+            const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables);
+
+    // merge the keys in [|lower|, |upper|) of |sstables| into a new sstable, an empty bound means no bound.
+    // |output| is left empty if there is no key in the range.
+    Status merge_sstables_in_range(const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables,
+                                   const std::string& lower, const std::string& upper,
+                                   PersistentIndexSstablePB* output);
+
+    // merge the ranges split by |split_keys| in parallel, one output sstable per range
+    Status parallel_merge_sstables(const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables,
+                                   const std::vector<std::string>& split_keys, TxnLogPB* txn_log);
 
 private:
     std::unique_ptr<PersistentIndexMemtable> _memtable;
@@ -284,44 +284,53 @@ void MetaFileBuilder::finalize_sstable_meta(const PersistentIndexSstableMetaPB&
     _tablet_meta->mutable_sstable_meta()->CopyFrom(sstable_meta);
 }
 
-Status get_del_vec(TabletManager* tablet_mgr, const TabletMetadata& metadata, uint32_t segment_id, DelVector* delvec) {
+Status get_del_vec(TabletManager* tablet_mgr, const TabletMetadata& metadata, uint32_t segment_id,
+                   DelVectorCSPtr* pdelvec) {
     // find delvec by segment id
     auto iter = metadata.delvec_meta().delvecs().find(segment_id);
-    if (iter != metadata.delvec_meta().delvecs().end()) {
-        VLOG(2) << fmt::format("get_del_vec {} segid {}", metadata.delvec_meta().ShortDebugString(), segment_id);
-        std::string buf;
-        raw::stl_string_resize_uninitialized(&buf, iter->second.size());
-        // find in cache
-        std::string cache_key = delvec_cache_key(metadata.id(), iter->second);
-        auto cached_delvec = tablet_mgr->metacache()->lookup_delvec(cache_key);
-        if (cached_delvec != nullptr) {
-            delvec->copy_from(*cached_delvec);
-            return Status::OK();
-        }
-
-        // lookup delvec file name and then read it
-        auto iter2 = metadata.delvec_meta().version_to_file().find(iter->second.version());
-        if (iter2 == metadata.delvec_meta().version_to_file().end()) {
-            LOG(ERROR) << "Can't find delvec file name for tablet: " << metadata.id()
-                       << ", version: " << iter->second.version();
-            return Status::InternalError("Can't find delvec file name");
-        }
-        const auto& delvec_name = iter2->second.name();
-        RandomAccessFileOptions opts{.skip_fill_local_cache = true};
-        ASSIGN_OR_RETURN(auto rf,
-                         fs::new_random_access_file(opts, tablet_mgr->delvec_location(metadata.id(), delvec_name)));
-        RETURN_IF_ERROR(rf->read_at_fully(iter->second.offset(), buf.data(), iter->second.size()));
-        // parse delvec
-        RETURN_IF_ERROR(delvec->load(iter->second.version(), buf.data(), iter->second.size()));
-        // put in cache
-        auto delvec_cache_ptr = std::make_shared<DelVector>();
-        delvec_cache_ptr->copy_from(*delvec);
-        tablet_mgr->metacache()->cache_delvec(cache_key, delvec_cache_ptr);
-        TRACE("end load delvec");
+    if (iter == metadata.delvec_meta().delvecs().end()) {
+        VLOG(2) << fmt::format("get_del_vec not found, segmentid {} tablet_meta {}", segment_id,
+                               metadata.delvec_meta().ShortDebugString());
+        *pdelvec = std::make_shared<DelVector>();
+        return Status::OK();
+    }
+    VLOG(2) << fmt::format("get_del_vec {} segid {}", metadata.delvec_meta().ShortDebugString(), segment_id);
+    // find in cache, the decoded delvec is shared by all the readers of this version
+    std::string cache_key = delvec_cache_key(metadata.id(), iter->second);
+    auto cached_delvec = tablet_mgr->metacache()->lookup_delvec(cache_key);
+    if (cached_delvec != nullptr) {
+        *pdelvec = std::move(cached_delvec);
         return Status::OK();
     }
-    VLOG(2) << fmt::format("get_del_vec not found, segmentid {} tablet_meta {}", segment_id,
-                           metadata.delvec_meta().ShortDebugString());
+
+    // lookup delvec file name and then read it
+    auto iter2 = metadata.delvec_meta().version_to_file().find(iter->second.version());
+    if (iter2 == metadata.delvec_meta().version_to_file().end()) {
+        LOG(ERROR) << "Can't find delvec file name for tablet: " << metadata.id()
+                   << ", version: " << iter->second.version();
+        return Status::InternalError("Can't find delvec file name");
+    }
+    const auto& delvec_name = iter2->second.name();
+    std::string buf;
+    raw::stl_string_resize_uninitialized(&buf, iter->second.size());
+    RandomAccessFileOptions opts{.skip_fill_local_cache = true};
+    ASSIGN_OR_RETURN(auto rf,
+                     fs::new_random_access_file(opts, tablet_mgr->delvec_location(metadata.id(), delvec_name)));
+    RETURN_IF_ERROR(rf->read_at_fully(iter->second.offset(), buf.data(), iter->second.size()));
+    // parse delvec
+    auto delvec = std::make_shared<DelVector>();
+    RETURN_IF_ERROR(delvec->load(iter->second.version(), buf.data(), iter->second.size()));
+    // put in cache
+    tablet_mgr->metacache()->cache_delvec(cache_key, delvec);
+    TRACE("end load delvec");
+    *pdelvec = std::move(delvec);
+    return Status::OK();
+}
+
+Status get_del_vec(TabletManager* tablet_mgr, const TabletMetadata& metadata, uint32_t segment_id, DelVector* delvec) {
+    DelVectorCSPtr shared_delvec;
+    RETURN_IF_ERROR(get_del_vec(tablet_mgr, metadata, segment_id, &shared_delvec));
+    delvec->copy_from(*shared_delvec);
     return Status::OK();
 }
 
@@ -79,6 +79,10 @@ private:
     RecoverFlag _recover_flag = RecoverFlag::OK;
 };
 
+// Returns the delvec of the segment shared through the Metacache, an empty one if the segment has no deletes.
+Status get_del_vec(TabletManager* tablet_mgr, const TabletMetadata& metadata, uint32_t segment_id,
+                   DelVectorCSPtr* pdelvec);
+// Same as above, but copies the delvec into `delvec`.
 Status get_del_vec(TabletManager* tablet_mgr, const TabletMetadata& metadata, uint32_t segment_id, DelVector* delvec);
 bool is_primary_key(TabletMetadata* metadata);
 bool is_primary_key(const TabletMetadata& metadata);
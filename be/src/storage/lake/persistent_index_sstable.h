@@ -56,6 +56,9 @@ public:
 
     sstable::Iterator* new_iterator(const sstable::ReadOptions& options) { return _sst->NewIterator(options); }
 
+    // Append the index block keys of the sstable, one per data block, used to split it into key ranges.
+    void get_index_keys(std::vector<std::string>* keys) const { _sst->GetIndexKeys(keys); }
+
     const PersistentIndexSstablePB& sstable_pb() const { return _sstable_pb; }
 
 private:
@@ -21,6 +21,7 @@
 #include "storage/lake/tablet.h"
 #include "storage/lake/update_manager.h"
 #include "storage/projection_iterator.h"
+#include "storage/rowset/index_prefetcher.h"
 #include "storage/rowset/rowid_range_option.h"
 #include "storage/rowset/rowset_options.h"
 #include "storage/rowset/segment.h"
@@ -116,6 +117,11 @@ StatusOr<std::vector<ChunkIteratorPtr>> Rowset::read(const Schema& schema, const
 
     std::vector<SegmentPtr> segments;
     RETURN_IF_ERROR(load_segments(&segments, options.lake_io_opts.fill_data_cache, options.lake_io_opts.buffer_size));
+    // Prefetch the bloom filter indexes of all the segments before they are iterated one after another.
+    std::vector<ColumnUID> bf_column_uids;
+    if (config::enable_index_prefetch && config::enable_index_bloom_filter && options.reader_type == READER_QUERY) {
+        bf_column_uids = IndexPrefetcher::bloom_filter_columns(seg_options.pred_tree, *options.tablet_schema);
+    }
     for (auto& seg_ptr : segments) {
         if (seg_ptr->num_rows() == 0) {
             continue;
@@ -135,6 +141,7 @@ StatusOr<std::vector<ChunkIteratorPtr>> Rowset::read(const Schema& schema, const
             seg_options.is_first_split_of_segment = true;
         }
 
+        seg_options.index_prefetch = IndexPrefetcher::submit(seg_ptr, bf_column_uids, seg_options);
         auto res = seg_ptr->new_iterator(*segment_schema, seg_options);
         if (res.status().is_end_of_file()) {
             continue;
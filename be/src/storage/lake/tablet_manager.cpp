@@ -17,17 +17,22 @@
 #include <butil/time.h>
 #include <bvar/bvar.h>
 
+#include <google/protobuf/util/message_differencer.h>
+
 #include <atomic>
+#include <unordered_map>
 #include <utility>
 
 #include "agent/master_info.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "fmt/format.h"
 #include "fs/fs.h"
 #include "fs/fs_util.h"
 #include "gutil/strings/util.h"
 #include "storage/lake/compaction_policy.h"
 #include "storage/lake/compaction_scheduler.h"
+#include "storage/lake/filenames.h"
 #include "storage/lake/horizontal_compaction_task.h"
 #include "storage/lake/join_path.h"
 #include "storage/lake/location_provider.h"
@@ -192,22 +197,110 @@ StatusOr<Tablet> TabletManager::get_tablet(int64_t tablet_id) {
     return tablet;
 }
 
+static bool is_tablet_metadata_delta(const TabletMetadataPB& metadata) {
+    return metadata.checkpoint_version() > 0 && metadata.checkpoint_version() < metadata.version();
+}
+
+// Keep the rowsets and the schema, which are the bulk of the metadata, only when they differ from the checkpoint.
+static TabletMetadataPtr build_tablet_metadata_delta(const TabletMetadataPB& checkpoint,
+                                                     const TabletMetadataPB& metadata) {
+    std::unordered_map<uint32_t, const RowsetMetadataPB*> checkpoint_rowsets;
+    for (const auto& rowset : checkpoint.rowsets()) {
+        checkpoint_rowsets[rowset.id()] = &rowset;
+    }
+    auto delta = std::make_shared<TabletMetadataPB>(metadata);
+    delta->clear_rowsets();
+    for (const auto& rowset : metadata.rowsets()) {
+        delta->add_delta_rowset_ids(rowset.id());
+        auto iter = checkpoint_rowsets.find(rowset.id());
+        if (iter == checkpoint_rowsets.end() ||
+            !google::protobuf::util::MessageDifferencer::Equals(*iter->second, rowset)) {
+            delta->add_rowsets()->CopyFrom(rowset);
+        }
+    }
+    if (google::protobuf::util::MessageDifferencer::Equals(checkpoint.schema(), metadata.schema())) {
+        delta->clear_schema();
+        delta->set_delta_inherit_schema(true);
+    }
+    return delta;
+}
+
+static StatusOr<TabletMetadataPtr> apply_tablet_metadata_delta(const TabletMetadataPB& checkpoint,
+                                                               const TabletMetadataPB& delta) {
+    if (checkpoint.version() != delta.checkpoint_version() || is_tablet_metadata_delta(checkpoint)) {
+        return Status::Corruption(fmt::format("tablet {} version {} is not a checkpoint of version {}", delta.id(),
+                                              checkpoint.version(), delta.version()));
+    }
+    std::unordered_map<uint32_t, const RowsetMetadataPB*> rowsets;
+    for (const auto& rowset : checkpoint.rowsets()) {
+        rowsets[rowset.id()] = &rowset;
+    }
+    for (const auto& rowset : delta.rowsets()) {
+        rowsets[rowset.id()] = &rowset;
+    }
+    auto metadata = std::make_shared<TabletMetadataPB>(delta);
+    metadata->clear_rowsets();
+    metadata->clear_delta_rowset_ids();
+    for (auto rowset_id : delta.delta_rowset_ids()) {
+        auto iter = rowsets.find(rowset_id);
+        if (iter == rowsets.end()) {
+            return Status::Corruption(fmt::format("rowset {} of tablet {} version {} not found in checkpoint {}",
+                                                  rowset_id, delta.id(), delta.version(), checkpoint.version()));
+        }
+        metadata->add_rowsets()->CopyFrom(*iter->second);
+    }
+    if (delta.delta_inherit_schema()) {
+        metadata->mutable_schema()->CopyFrom(checkpoint.schema());
+        metadata->clear_delta_inherit_schema();
+    }
+    return metadata;
+}
+
+// Returns <the metadata to save, the metadata to cache>. The metadata is saved as a delta of its checkpoint when
+// the checkpoint is within lake_tablet_metadata_checkpoint_interval versions and still readable, otherwise as a
+// new checkpoint.
+std::pair<TabletMetadataPtr, TabletMetadataPtr> TabletManager::prepare_incremental_tablet_metadata(
+        const TabletMetadataPtr& metadata) {
+    auto checkpoint_version = metadata->checkpoint_version();
+    if (is_tablet_metadata_delta(*metadata) &&
+        metadata->version() - checkpoint_version < config::lake_tablet_metadata_checkpoint_interval) {
+        auto checkpoint_or = get_tablet_metadata(metadata->id(), checkpoint_version);
+        if (checkpoint_or.ok() && !is_tablet_metadata_delta(**checkpoint_or)) {
+            return {build_tablet_metadata_delta(**checkpoint_or, *metadata), metadata};
+        }
+        LOG_IF(WARNING, !checkpoint_or.ok()) << "Fail to read checkpoint " << checkpoint_version << " of tablet "
+                                             << metadata->id() << ": " << checkpoint_or.status();
+    }
+    if (checkpoint_version == metadata->version()) {
+        return {metadata, metadata};
+    }
+    auto checkpoint = std::make_shared<TabletMetadataPB>(*metadata);
+    checkpoint->set_checkpoint_version(checkpoint->version());
+    return {checkpoint, checkpoint};
+}
+
 Status TabletManager::put_tablet_metadata(const TabletMetadataPtr& metadata) {
     TEST_ERROR_POINT("TabletManager::put_tablet_metadata");
     // write metadata file
     auto t0 = butil::gettimeofday_us();
     auto filepath = tablet_metadata_location(metadata->id(), metadata->version());
 
+    auto metadata_to_save = metadata;
+    auto metadata_to_cache = metadata;
+    if (config::lake_enable_incremental_tablet_metadata) {
+        std::tie(metadata_to_save, metadata_to_cache) = prepare_incremental_tablet_metadata(metadata);
+    }
+
     ProtobufFile file(filepath);
-    RETURN_IF_ERROR(file.save(*metadata));
+    RETURN_IF_ERROR(file.save(*metadata_to_save));
 
-    _metacache->cache_tablet_metadata(filepath, metadata);
+    _metacache->cache_tablet_metadata(filepath, metadata_to_cache);
     bool skip_cache_latest_metadata = false;
     TEST_SYNC_POINT_CALLBACK("TabletManager::skip_cache_latest_metadata", &skip_cache_latest_metadata);
     if (skip_cache_latest_metadata) {
         return Status::OK();
     }
-    _metacache->cache_tablet_metadata(tablet_latest_metadata_cache_key(metadata->id()), metadata);
+    _metacache->cache_tablet_metadata(tablet_latest_metadata_cache_key(metadata->id()), metadata_to_cache);
 
     auto t1 = butil::gettimeofday_us();
     g_put_tablet_metadata_latency << (t1 - t0);
@@ -244,6 +337,14 @@ StatusOr<TabletMetadataPtr> TabletManager::get_tablet_metadata(const string& pat
         return ptr;
     }
     ASSIGN_OR_RETURN(auto ptr, load_tablet_metadata(path, fill_cache));
+    if (is_tablet_metadata_delta(*ptr)) {
+        // The checkpoint is in the same directory as the delta.
+        auto checkpoint_path = join_path(path.substr(0, path.find_last_of('/')),
+                                         tablet_metadata_filename(ptr->id(), ptr->checkpoint_version()));
+        ASSIGN_OR_RETURN(auto checkpoint, get_tablet_metadata(checkpoint_path, fill_cache));
+        ASSIGN_OR_RETURN(ptr, apply_tablet_metadata_delta(*checkpoint, *ptr));
+        TRACE("end apply tablet metadata delta");
+    }
     if (fill_cache) {
         _metacache->cache_tablet_metadata(path, ptr);
     }
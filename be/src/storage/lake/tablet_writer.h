@@ -129,6 +129,9 @@ public:
 
     const OlapWriterStatistics& stats() const { return _stats; }
 
+    // Whether the segment files are written through to the local data cache, true by default.
+    void set_fill_data_cache(bool fill_data_cache) { _fill_data_cache = fill_data_cache; }
+
 protected:
     TabletManager* _tablet_mgr;
     int64_t _tablet_id;
@@ -138,6 +141,7 @@ protected:
     std::vector<FileInfo> _files;
     int64_t _num_rows = 0;
     int64_t _data_size = 0;
+    bool _fill_data_cache = true;
     uint32_t _seg_id = 0;
     bool _finished = false;
     OlapWriterStatistics _stats;
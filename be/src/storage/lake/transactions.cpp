@@ -14,6 +14,13 @@
 
 #include "storage/lake/transactions.h"
 
+#include <bthread/condition_variable.h>
+#include <bthread/mutex.h>
+#include <butil/time.h>
+#include <bvar/bvar.h>
+
+#include <functional>
+
 #include "fs/fs_util.h"
 #include "gen_cpp/lake_types.pb.h"
 #include "gutil/strings/join.h"
@@ -26,7 +33,11 @@
 #include "storage/lake/txn_log_applier.h"
 #include "storage/lake/update_manager.h"
 #include "storage/lake/vacuum.h" // delete_files_async
+#include "util/countdown_latch.h"
+#include "util/defer_op.h"
 #include "util/lru_cache.h"
+#include "util/threadpool.h"
+#include "util/trace.h"
 
 namespace {
 
@@ -132,8 +143,57 @@ StatusOr<TxnLogPtr> load_txn_log(TabletManager* tablet_mgr, int64_t tablet_id, c
     }
 }
 
+bvar::LatencyRecorder g_publish_prefetch_latency("lake_publish_version_prefetch");
+bvar::Adder<int64_t> g_publish_prefetch_failed_reads("lake_publish_version_prefetch_failed_reads");
+
 } // namespace
 
+void prefetch_publish_version_inputs(TabletManager* tablet_mgr, ThreadPool* io_pool,
+                                     std::span<const int64_t> tablet_ids, int64_t base_version,
+                                     std::span<const TxnInfoPB> txns, std::chrono::system_clock::time_point deadline) {
+    auto t0 = butil::gettimeofday_us();
+    std::vector<std::function<Status()>> reads;
+    reads.reserve(tablet_ids.size() * (1 + txns.size()));
+    for (auto tablet_id : tablet_ids) {
+        reads.emplace_back([=]() { return tablet_mgr->get_tablet_metadata(tablet_id, base_version).status(); });
+        for (const auto& txn : txns) {
+            // A combined txn log holds the logs of all tablets of the txn, read it with the first tablet only.
+            if (txn.combined_txn_log() && tablet_id != tablet_ids.front()) {
+                continue;
+            }
+            reads.emplace_back([=, &txn]() {
+                if (txn.combined_txn_log()) {
+                    auto path = tablet_mgr->combined_txn_log_location(tablet_id, txn.txn_id());
+                    return tablet_mgr->get_combined_txn_log(path, true).status();
+                }
+                auto path = tablet_mgr->txn_log_location(tablet_id, txn.txn_id());
+                return tablet_mgr->get_txn_log(path, true).status();
+            });
+        }
+    }
+
+    GenericCountDownLatch<bthread::Mutex, bthread::ConditionVariable> latch(reads.size());
+    for (auto& read : reads) {
+        auto task = [&latch, &read, deadline]() {
+            DeferOp defer([&] { latch.count_down(); });
+            if (std::chrono::system_clock::now() >= deadline) {
+                return;
+            }
+            // The log of a txn published before is not found, which is not an error.
+            auto st = read();
+            if (!st.ok() && !st.is_not_found()) {
+                g_publish_prefetch_failed_reads << 1;
+            }
+        };
+        if (!io_pool->submit_func(std::move(task)).ok()) {
+            latch.count_down();
+        }
+    }
+    latch.wait();
+    g_publish_prefetch_latency << (butil::gettimeofday_us() - t0);
+    TRACE("prefetched $0 publish inputs", reads.size());
+}
+
 StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t tablet_id, int64_t base_version,
                                             int64_t new_version, std::span<const TxnInfoPB> txns) {
     if (!add_tablet(tablet_id)) {
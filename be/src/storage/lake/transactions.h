@@ -14,14 +14,16 @@
 
 #pragma once
 
+#include <chrono>
 #include <span>
 
 #include "common/statusor.h"
 #include "storage/lake/tablet_metadata.h"
 
 namespace starrocks {
+class ThreadPool;
 class TxnInfoPB;
-}
+} // namespace starrocks
 
 namespace starrocks::lake {
 
@@ -50,6 +52,18 @@ class TabletManager;
 StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t tablet_id, int64_t base_version,
                                             int64_t new_version, std::span<const TxnInfoPB> txns);
 
+// Read the base metadata and the transaction logs of a batch of tablets to be published into the metacache, with
+// up to the number of threads of 'io_pool' reads in flight, and wait for all reads to finish.
+//
+// The publish tasks of a partition with thousands of tablets are limited by the size of the publish thread pool,
+// and each of them used to read its inputs one by one before applying them. After the prefetch, publish_version()
+// finds its inputs in the metacache and only applies the logs and writes the new metadata.
+//
+// Reads that fail or start after 'deadline' are skipped, publish_version() reads them again and reports the error.
+void prefetch_publish_version_inputs(TabletManager* tablet_mgr, ThreadPool* io_pool,
+                                     std::span<const int64_t> tablet_ids, int64_t base_version,
+                                     std::span<const TxnInfoPB> txns, std::chrono::system_clock::time_point deadline);
+
 // Publish a batch new versions of transaction logs.
 //
 // For every transaction log, this function does the following:
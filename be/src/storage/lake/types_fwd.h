@@ -46,6 +46,7 @@ using ColumnUniquePtr = std::unique_ptr<Column>;
 using segment_rowid_t = uint32_t;
 using DeletesMap = std::unordered_map<uint32_t, std::vector<segment_rowid_t>>;
 using DelVectorPtr = std::shared_ptr<DelVector>;
+using DelVectorCSPtr = std::shared_ptr<const DelVector>;
 
 } // namespace lake
 
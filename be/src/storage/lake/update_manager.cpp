@@ -58,9 +58,20 @@ UpdateManager::UpdateManager(LocationProvider* location_provider, MemTracker* me
     const int64_t block_cache_mem_limit =
             update_mem_limit * std::max(std::min(100, config::lake_pk_index_block_cache_limit_percent), 0) / 100;
     _block_cache = std::make_unique<PersistentIndexBlockCache>(mem_tracker, block_cache_mem_limit);
+
+    auto st = ThreadPoolBuilder("pk_index_sst_merge")
+                      .set_min_threads(0)
+                      .set_max_threads(std::max(1, config::lake_pk_index_sst_merge_thread_num))
+                      .set_max_queue_size(INT32_MAX)
+                      .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                      .build(&_sst_merge_pool);
+    LOG_IF(WARNING, !st.ok()) << "failed to create pk index sst merge pool, merge sstables serially: " << st;
 }
 
 UpdateManager::~UpdateManager() {
+    if (_sst_merge_pool != nullptr) {
+        _sst_merge_pool->shutdown();
+    }
     _index_cache.clear();
     _update_state_cache.clear();
     _compaction_cache.clear();
@@ -70,7 +81,7 @@ inline std::string cache_key(uint32_t tablet_id, int64_t txn_id) {
     return strings::Substitute("$0_$1", tablet_id, txn_id);
 }
 
-Status LakeDelvecLoader::load(const TabletSegmentId& tsid, int64_t version, DelVectorPtr* pdelvec) {
+Status LakeDelvecLoader::load(const TabletSegmentId& tsid, int64_t version, DelVectorCSPtr* pdelvec) {
     return _update_mgr->get_del_vec(tsid, version, _pk_builder, pdelvec);
 }
 
@@ -218,7 +229,7 @@ Status UpdateManager::publish_primary_key_tablet(const TxnLogPB_OpWrite& op_writ
             TabletSegmentId tsid;
             tsid.tablet_id = tablet->id();
             tsid.segment_id = rssid;
-            DelVectorPtr old_del_vec;
+            DelVectorCSPtr old_del_vec;
             RETURN_IF_ERROR(get_del_vec(tsid, base_version, builder, &old_del_vec));
             new_del_vecs[idx].first = rssid;
             old_del_vec->add_dels_as_new_version(new_delete.second, metadata.version(), &(new_del_vecs[idx].second));
@@ -507,20 +518,23 @@ Status UpdateManager::get_column_values(Tablet* tablet, const TabletMetadata& me
 }
 
 Status UpdateManager::get_del_vec(const TabletSegmentId& tsid, int64_t version, const MetaFileBuilder* builder,
-                                  DelVectorPtr* pdelvec) {
+                                  DelVectorCSPtr* pdelvec) {
     if (builder != nullptr) {
         // 1. find in meta builder first
-        auto found = builder->find_delvec(tsid, pdelvec);
+        DelVectorPtr delvec;
+        auto found = builder->find_delvec(tsid, &delvec);
         if (!found.ok()) {
             return found.status();
         }
         if (*found) {
+            *pdelvec = std::move(delvec);
             return Status::OK();
         }
     }
-    (*pdelvec).reset(new DelVector());
-    // 2. find in delvec file
-    return get_del_vec_in_meta(tsid, version, pdelvec->get());
+    // 2. find in delvec file, shared with the metacache instead of copied out of it
+    std::string filepath = _tablet_mgr->tablet_metadata_location(tsid.tablet_id, version);
+    ASSIGN_OR_RETURN(auto metadata, _tablet_mgr->get_tablet_metadata(filepath, false));
+    return lake::get_del_vec(_tablet_mgr, *metadata, tsid.segment_id, pdelvec);
 }
 
 // get delvec in meta file
@@ -584,7 +598,7 @@ void UpdateManager::evict_cache(int64_t memory_urgent_level, int64_t memory_high
 size_t UpdateManager::get_rowset_num_deletes(int64_t tablet_id, int64_t version, const RowsetMetadataPB& rowset_meta) {
     size_t num_dels = 0;
     for (int i = 0; i < rowset_meta.segments_size(); i++) {
-        DelVectorPtr delvec;
+        DelVectorCSPtr delvec;
         TabletSegmentId tsid;
         tsid.tablet_id = tablet_id;
         tsid.segment_id = rowset_meta.id() + i;
@@ -46,7 +46,7 @@ class LakeDelvecLoader : public DelvecLoader {
 public:
     LakeDelvecLoader(UpdateManager* update_mgr, const MetaFileBuilder* pk_builder)
             : _update_mgr(update_mgr), _pk_builder(pk_builder) {}
-    Status load(const TabletSegmentId& tsid, int64_t version, DelVectorPtr* pdelvec);
+    Status load(const TabletSegmentId& tsid, int64_t version, DelVectorCSPtr* pdelvec);
 
 private:
     UpdateManager* _update_mgr = nullptr;
@@ -97,7 +97,7 @@ public:
                              AutoIncrementPartialUpdateState* auto_increment_state = nullptr);
     // get delvec by version
     Status get_del_vec(const TabletSegmentId& tsid, int64_t version, const MetaFileBuilder* builder,
-                       DelVectorPtr* pdelvec);
+                       DelVectorCSPtr* pdelvec);
 
     // get delvec from tablet meta file
     Status get_del_vec_in_meta(const TabletSegmentId& tsid, int64_t meta_ver, DelVector* delvec);
@@ -184,6 +184,9 @@ public:
 
     PersistentIndexBlockCache* block_cache() { return _block_cache.get(); }
 
+    // pool to merge the sstables of a pk index major compaction by key ranges in parallel
+    ThreadPool* sst_merge_pool() { return _sst_merge_pool.get(); }
+
     Status pk_index_major_compaction(int64_t tablet_id, DataDir* data_dir);
 
 private:
@@ -239,6 +242,8 @@ private:
     std::vector<PkIndexShard> _pk_index_shards;
 
     std::unique_ptr<PersistentIndexBlockCache> _block_cache;
+
+    std::unique_ptr<ThreadPool> _sst_merge_pool;
 };
 
 } // namespace lake
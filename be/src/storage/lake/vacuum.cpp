@@ -17,8 +17,11 @@
 #include <butil/time.h>
 #include <bvar/bvar.h>
 
+#include <deque>
+#include <mutex>
 #include <set>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 
 #include "common/config.h"
@@ -26,6 +29,7 @@
 #include "fs/fs.h"
 #include "gutil/stl_util.h"
 #include "gutil/strings/util.h"
+#include "runtime/exec_env.h"
 #include "storage/lake/filenames.h"
 #include "storage/lake/join_path.h"
 #include "storage/lake/location_provider.h"
@@ -36,8 +40,10 @@
 #include "storage/lake/update_manager.h"
 #include "storage/protobuf_file.h"
 #include "testutil/sync_point.h"
+#include "util/countdown_latch.h"
 #include "util/defer_op.h"
 #include "util/raw_container.h"
+#include "util/time.h"
 
 namespace starrocks::lake {
 
@@ -96,8 +102,51 @@ int64_t calculate_retry_delay(int64_t attempted_retries) {
     return min_delay * (1 << attempted_retries);
 }
 
+// Spaces the delete requests sent to each bucket of the object storage, so that the requests of all vacuum tasks
+// on this node stay within lake_vacuum_delete_qps_per_bucket and do not trigger the throttling of the storage.
+class DeleteRateLimiter {
+public:
+    static DeleteRateLimiter* instance() {
+        static DeleteRateLimiter limiter;
+        return &limiter;
+    }
+
+    void acquire(std::string_view path) {
+        auto qps = config::lake_vacuum_delete_qps_per_bucket;
+        if (qps <= 0) {
+            return;
+        }
+        int64_t wait_us = 0;
+        {
+            std::lock_guard l(_mutex);
+            auto now = MonotonicMicros();
+            auto& next_slot = _next_slots[std::string(bucket_of(path))];
+            auto slot = std::max(now, next_slot);
+            next_slot = slot + 1000000 / qps;
+            wait_us = slot - now;
+        }
+        if (wait_us > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+        }
+    }
+
+private:
+    // "s3://bucket/path/to/file" => "s3://bucket"
+    static std::string_view bucket_of(std::string_view path) {
+        auto pos = path.find("://");
+        if (pos == std::string_view::npos) {
+            return {};
+        }
+        return path.substr(0, path.find('/', pos + 3));
+    }
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, int64_t> _next_slots;
+};
+
 Status delete_files_with_retry(FileSystem* fs, std::span<const std::string> paths) {
     for (int64_t attempted_retries = 0; /**/; attempted_retries++) {
+        DeleteRateLimiter::instance()->acquire(paths.front());
         auto st = fs->delete_files(paths);
         if (!st.ok() && should_retry(st, attempted_retries)) {
             int64_t delay = calculate_retry_delay(attempted_retries);
@@ -156,6 +205,8 @@ Status do_delete_files(FileSystem* fs, const std::vector<std::string>& paths) {
 //
 // The AsyncFileDeleter class provides a mechanism to delete files in batches in an asynchronous manner.
 // It allows specifying the batch size, which determines the number of files to be deleted in each batch.
+// Up to lake_vacuum_max_inflight_delete_batches batches are deleted at the same time, and files can be added
+// from multiple threads.
 class AsyncFileDeleter {
 public:
     using DeleteCallback = std::function<void(const std::vector<std::string>&)>;
@@ -164,6 +215,7 @@ public:
     explicit AsyncFileDeleter(int64_t batch_size, DeleteCallback cb) : _batch_size(batch_size), _cb(std::move(cb)) {}
 
     Status delete_file(std::string path) {
+        std::lock_guard l(_mutex);
         _batch.emplace_back(std::move(path));
         if (_batch.size() < _batch_size) {
             return Status::OK();
@@ -172,41 +224,50 @@ public:
     }
 
     Status finish() {
+        std::lock_guard l(_mutex);
         if (!_batch.empty()) {
             RETURN_IF_ERROR(submit(&_batch));
         }
-        return wait();
+        return wait(0);
     }
 
-    int64_t delete_count() const { return _delete_count; }
+    int64_t delete_count() const {
+        std::lock_guard l(_mutex);
+        return _delete_count;
+    }
 
 private:
-    // Wait for all submitted deletion tasks to finish and return task execution results.
-    Status wait() {
-        if (_prev_task_status.valid()) {
-            return _prev_task_status.get();
-        } else {
-            return Status::OK();
+    // Wait until at most |max_inflight| submitted deletion tasks are running and return the first failure.
+    Status wait(size_t max_inflight) {
+        Status ret;
+        while (_inflight_tasks.size() > max_inflight) {
+            auto st = _inflight_tasks.front().get();
+            _inflight_tasks.pop_front();
+            if (ret.ok()) {
+                ret = std::move(st);
+            }
         }
+        return ret;
     }
 
     Status submit(std::vector<std::string>* files_to_delete) {
-        // Await previous task completion before submitting a new deletion.
-        RETURN_IF_ERROR(wait());
+        // Await the completion of the oldest tasks before submitting a new deletion.
+        RETURN_IF_ERROR(wait(std::max<int64_t>(1, config::lake_vacuum_max_inflight_delete_batches) - 1));
         _delete_count += files_to_delete->size();
         if (_cb) {
             _cb(*files_to_delete);
         }
-        _prev_task_status = delete_files_callable(std::move(*files_to_delete));
+        _inflight_tasks.emplace_back(delete_files_callable(std::move(*files_to_delete)));
         files_to_delete->clear();
-        DCHECK(_prev_task_status.valid());
+        DCHECK(_inflight_tasks.back().valid());
         return Status::OK();
     }
 
+    mutable std::mutex _mutex;
     int64_t _batch_size;
     int64_t _delete_count = 0;
     std::vector<std::string> _batch;
-    std::future<Status> _prev_task_status;
+    std::deque<std::future<Status>> _inflight_tasks;
     DeleteCallback _cb;
 };
 
@@ -276,6 +337,7 @@ static Status collect_files_to_vacuum(TabletManager* tablet_mgr, std::string_vie
     auto data_dir = join_path(root_dir, kSegmentDirectoryName);
     auto final_retain_version = min_retain_version;
     auto version = final_retain_version;
+    int64_t retain_checkpoint_version = 0;
     // grace_timestamp <= 0 means no grace timestamp
     auto skip_check_grace_timestamp = grace_timestamp <= 0;
     ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(root_dir));
@@ -327,6 +389,9 @@ static Status collect_files_to_vacuum(TabletManager* tablet_mgr, std::string_vie
                 }
             }
 
+            if (version == final_retain_version) {
+                retain_checkpoint_version = metadata->checkpoint_version();
+            }
             CHECK_LT(metadata->prev_garbage_version(), version);
             version = metadata->prev_garbage_version();
         }
@@ -339,6 +404,10 @@ static Status collect_files_to_vacuum(TabletManager* tablet_mgr, std::string_vie
         return Status::OK();
     }
     DCHECK_LE(version, final_retain_version);
+    // The retained metadata may be a delta of an older checkpoint, which must be retained too.
+    if (retain_checkpoint_version > 0 && retain_checkpoint_version < final_retain_version) {
+        final_retain_version = retain_checkpoint_version;
+    }
     for (auto v = version + 1; v < final_retain_version; v++) {
         RETURN_IF_ERROR(metafile_deleter->delete_file(join_path(meta_dir, tablet_metadata_filename(tablet_id, v))));
     }
@@ -369,17 +438,50 @@ static Status vacuum_tablet_metadata(TabletManager* tablet_mgr, std::string_view
         erase_tablet_metadata_from_metacache(tablet_mgr, files);
     };
 
-    for (auto tablet_id : tablet_ids) {
-        AsyncFileDeleter datafile_deleter(config::lake_vacuum_min_batch_delete_size);
-        AsyncFileDeleter metafile_deleter(INT64_MAX, metafile_delete_cb);
-        RETURN_IF_ERROR(collect_files_to_vacuum(tablet_mgr, root_dir, tablet_id, grace_timestamp, min_retain_version,
-                                                &datafile_deleter, &metafile_deleter, vacuumed_file_size));
-        RETURN_IF_ERROR(datafile_deleter.finish());
-        RETURN_IF_ERROR(metafile_deleter.finish());
-        (*vacuumed_files) += datafile_deleter.delete_count();
-        (*vacuumed_files) += metafile_deleter.delete_count();
+    // The garbage files of all tablets share the delete batches, which are deleted while the metadata of other
+    // tablets is still being read. The metadata files are deleted after all garbage data files have been deleted,
+    // so that a failed vacuum can be retried from the metadata.
+    AsyncFileDeleter datafile_deleter(config::lake_vacuum_min_batch_delete_size);
+    AsyncFileDeleter metafile_deleter(INT64_MAX, metafile_delete_cb);
+    std::vector<Status> statuses(tablet_ids.size());
+    std::vector<int64_t> datafile_sizes(tablet_ids.size(), 0);
+    auto collect = [&](size_t i) {
+        statuses[i] = collect_files_to_vacuum(tablet_mgr, root_dir, tablet_ids[i], grace_timestamp, min_retain_version,
+                                              &datafile_deleter, &metafile_deleter, &datafile_sizes[i]);
+    };
+    auto pool = ExecEnv::GetInstance()->lake_vacuum_collect_pool();
+    if (pool == nullptr || tablet_ids.size() == 1) {
+        for (size_t i = 0; i < tablet_ids.size() && (i == 0 || statuses[i - 1].ok()); i++) {
+            collect(i);
+        }
+    } else {
+        CountDownLatch latch(tablet_ids.size());
+        for (size_t i = 0; i < tablet_ids.size(); i++) {
+            auto st = pool->submit_func([&, i]() {
+                collect(i);
+                latch.count_down();
+            });
+            if (!st.ok()) {
+                statuses[i] = std::move(st);
+                latch.count_down();
+            }
+        }
+        latch.wait();
     }
-    return Status::OK();
+    // A tablet whose metadata failed to be read adds no metadata file to delete.
+    auto datafile_st = datafile_deleter.finish();
+    if (datafile_st.ok()) {
+        datafile_st = metafile_deleter.finish();
+    }
+    for (size_t i = 0; i < tablet_ids.size(); i++) {
+        (*vacuumed_file_size) += datafile_sizes[i];
+    }
+    (*vacuumed_files) += datafile_deleter.delete_count();
+    (*vacuumed_files) += metafile_deleter.delete_count();
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return datafile_st;
 }
 
 static Status vacuum_txn_log(std::string_view root_location, int64_t min_active_txn_id, int64_t* vacuumed_files,
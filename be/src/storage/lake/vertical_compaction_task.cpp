@@ -50,6 +50,8 @@ Status VerticalCompactionTask::execute(CancelFunc cancel_func, ThreadPool* flush
             CompactionUtils::get_segment_max_rows(config::max_segment_file_size, _total_num_rows, _total_data_size);
     ASSIGN_OR_RETURN(auto writer, _tablet.new_writer(kVertical, _txn_id, max_rows_per_segment, flush_pool,
                                                      true /** is compaction**/));
+    const bool fill_data_cache = should_fill_data_cache();
+    writer->set_fill_data_cache(fill_data_cache);
     RETURN_IF_ERROR(writer->open());
     DeferOp defer([&]() { writer->close(); });
 
@@ -102,6 +104,9 @@ Status VerticalCompactionTask::execute(CancelFunc cancel_func, ThreadPool* flush
     op_compaction->mutable_output_rowset()->set_overlapped(false);
     RETURN_IF_ERROR(execute_index_major_compaction(txn_log.get()));
     RETURN_IF_ERROR(_tablet.tablet_manager()->put_txn_log(txn_log));
+    if (fill_data_cache) {
+        warm_up_output_segments(*txn_log);
+    }
     if (_tablet_schema->keys_type() == KeysType::PRIMARY_KEYS) {
         // preload primary key table's compaction state
         Tablet t(_tablet.tablet_manager(), _tablet.id());
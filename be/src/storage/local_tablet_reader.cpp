@@ -14,9 +14,12 @@
 
 #include "storage/local_tablet_reader.h"
 
+#include <numeric>
+
 #include "gen_cpp/internal_service.pb.h"
 #include "serde/protobuf_serde.h"
 #include "storage/chunk_helper.h"
+#include "storage/pk_row_cache.h"
 #include "storage/primary_index.h"
 #include "storage/primary_key_encoder.h"
 #include "storage/projection_iterator.h"
@@ -118,10 +121,38 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_
     RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(*tablet_schema->schema(), &pk_column));
     PrimaryKeyEncoder::encode(*tablet_schema->schema(), keys, 0, keys.num_rows(), pk_column.get());
 
+    values.reset();
+    size_t num_found = 0;
+    auto* row_cache = PkRowCache::instance();
+    if (row_cache->enabled()) {
+        RETURN_IF_ERROR(_cached_multi_get(row_cache, *pk_column, value_column_ids, found, values, &num_found));
+    } else {
+        MutableColumns read_columns;
+        vector<uint32_t> idxes;
+        RETURN_IF_ERROR(_read_by_pks(*pk_column, value_column_ids, found, &read_columns, &idxes));
+        // reorder read values to input keys' order and put into values output parameter
+        for (size_t col_idx = 0; col_idx < value_column_ids.size(); col_idx++) {
+            values.get_column_by_index(col_idx)->append_selective(*read_columns[col_idx], idxes.data(), 0,
+                                                                  idxes.size());
+        }
+        num_found = idxes.size();
+    }
+    int64_t t_end = MonotonicMillis();
+    LOG(INFO) << strings::Substitute("multi_get tablet:$0 version:$1 #columns:$2 #rows:$3 found:$4 time:$5ms",
+                                     _tablet->tablet_id(), _version, value_column_ids.size(), n, num_found,
+                                     t_end - t_start);
+    return Status::OK();
+}
+
+Status LocalTabletReader::_read_by_pks(const Column& pks, const std::vector<uint32_t>& column_ids,
+                                       std::vector<bool>& found, MutableColumns* read_columns,
+                                       std::vector<uint32_t>* idxes) {
+    const auto& tablet_schema = _tablet->tablet_schema();
+    size_t n = pks.size();
     // search pks in pk index to get rowids
     EditVersion edit_version;
     std::vector<uint64_t> rowids(n);
-    RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), *pk_column, &edit_version, &rowids));
+    RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), pks, &edit_version, &rowids));
     if (edit_version.major_number() != _version) {
         return Status::InternalError(
                 strings::Substitute("multi_get version not match tablet:$0 current_version:$1 read_version:$2",
@@ -134,26 +165,72 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_
 
     // sort rowids by rssid, so we can plan&perform read operations by rowset/segment
     std::map<uint32_t, std::vector<uint32_t>> rowids_by_rssid;
-    vector<uint32_t> idxes;
-    plan_read_by_rssid(rowids, found, rowids_by_rssid, idxes);
+    plan_read_by_rssid(rowids, found, rowids_by_rssid, *idxes);
 
-    auto read_column_schema = ChunkHelper::convert_schema(tablet_schema, value_column_ids);
-    std::vector<std::unique_ptr<Column>> read_columns(value_column_ids.size());
-    for (uint32_t i = 0; i < read_columns.size(); ++i) {
-        read_columns[i] = ChunkHelper::column_from_field(*read_column_schema.field(i).get())->clone_empty();
+    auto read_column_schema = ChunkHelper::convert_schema(tablet_schema, column_ids);
+    read_columns->resize(column_ids.size());
+    for (uint32_t i = 0; i < read_columns->size(); ++i) {
+        (*read_columns)[i] = ChunkHelper::column_from_field(*read_column_schema.field(i).get())->clone_empty();
     }
-    RETURN_IF_ERROR(_tablet->updates()->get_column_values(value_column_ids, _version, false, rowids_by_rssid,
-                                                          &read_columns, nullptr, tablet_schema));
+    return _tablet->updates()->get_column_values(column_ids, _version, false, rowids_by_rssid, read_columns, nullptr,
+                                                 tablet_schema);
+}
 
-    // reorder read values to input keys' order and put into values output parameter
-    values.reset();
-    for (size_t col_idx = 0; col_idx < value_column_ids.size(); col_idx++) {
-        values.get_column_by_index(col_idx)->append_selective(*read_columns[col_idx], idxes.data(), 0, idxes.size());
+// The keys missing in the row cache read all the columns, so that their rows serve any projection later.
+Status LocalTabletReader::_cached_multi_get(PkRowCache* row_cache, const Column& pks,
+                                            const std::vector<uint32_t>& value_column_ids, std::vector<bool>& found,
+                                            Chunk& values, size_t* num_found) {
+    const auto& tablet_schema = _tablet->tablet_schema();
+    size_t n = pks.size();
+    // must be taken before reading the primary index, see PkRowCache
+    auto ctx = row_cache->begin_read(_tablet->tablet_id());
+    std::vector<PkRowCacheHandle> hits(n);
+    vector<uint32_t> miss_idxes;
+    for (uint32_t i = 0; i < n; i++) {
+        if (!row_cache->lookup(ctx, PkRowCache::pk_slice(pks, i), _version, tablet_schema, &hits[i])) {
+            miss_idxes.push_back(i);
+        }
+    }
+
+    std::vector<bool> miss_found;
+    MutableColumns read_columns;
+    vector<uint32_t> read_idxes;
+    if (!miss_idxes.empty()) {
+        auto miss_pks = pks.clone_empty();
+        miss_pks->append_selective(pks, miss_idxes.data(), 0, miss_idxes.size());
+        vector<uint32_t> all_column_ids(tablet_schema->num_columns());
+        std::iota(all_column_ids.begin(), all_column_ids.end(), 0);
+        RETURN_IF_ERROR(_read_by_pks(*miss_pks, all_column_ids, miss_found, &read_columns, &read_idxes));
+        size_t read_pos = 0;
+        for (size_t j = 0; j < miss_idxes.size(); j++) {
+            if (miss_found[j]) {
+                row_cache->insert(ctx, PkRowCache::pk_slice(*miss_pks, j), _version, tablet_schema, read_columns,
+                                  read_idxes[read_pos++]);
+            }
+        }
+    }
+
+    found.assign(n, false);
+    size_t miss_pos = 0;
+    size_t read_pos = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        const Columns* row_columns = nullptr;
+        size_t row = 0;
+        if (hits[i].valid()) {
+            row_columns = &hits[i].entry()->columns;
+        } else if (miss_found[miss_pos++]) {
+            row = read_idxes[read_pos++];
+        } else {
+            continue;
+        }
+        found[i] = true;
+        (*num_found)++;
+        for (size_t col_idx = 0; col_idx < value_column_ids.size(); col_idx++) {
+            uint32_t cid = value_column_ids[col_idx];
+            const Column& src = row_columns != nullptr ? *(*row_columns)[cid] : *read_columns[cid];
+            values.get_column_by_index(col_idx)->append(src, row, 1);
+        }
     }
-    int64_t t_end = MonotonicMillis();
-    LOG(INFO) << strings::Substitute("multi_get tablet:$0 version:$1 #columns:$2 #rows:$3 found:$4 time:$5ms",
-                                     _tablet->tablet_id(), _version, value_column_ids.size(), n, idxes.size(),
-                                     t_end - t_start);
     return Status::OK();
 }
 
@@ -20,6 +20,7 @@
 namespace starrocks {
 
 class ColumnPredicate;
+class PkRowCache;
 class PTabletReaderMultiGetRequest;
 class PTabletReaderMultiGetResult;
 
@@ -46,6 +47,14 @@ public:
                                     const std::vector<const ColumnPredicate*>& predicates);
 
 private:
+    // Read |column_ids| of the rows of the encoded primary keys |pks|, the i-th found key is read into the
+    // idxes[i]-th row of |read_columns|.
+    Status _read_by_pks(const Column& pks, const std::vector<uint32_t>& column_ids, std::vector<bool>& found,
+                        MutableColumns* read_columns, std::vector<uint32_t>* idxes);
+
+    Status _cached_multi_get(PkRowCache* row_cache, const Column& pks, const std::vector<uint32_t>& value_column_ids,
+                             std::vector<bool>& found, Chunk& values, size_t* num_found);
+
     TabletSharedPtr _tablet;
     int64_t _version{0};
 };
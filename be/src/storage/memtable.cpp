@@ -24,6 +24,7 @@
 #include "io/io_profiler.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/memory/jemalloc_arenas.h"
 #include "storage/chunk_helper.h"
 #include "storage/memtable_sink.h"
 #include "storage/primary_key_encoder.h"
@@ -162,6 +163,7 @@ bool MemTable::check_supported_column_partial_update(const Chunk& chunk) {
 }
 
 StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size) {
+    SCOPED_MEMORY_CLASS(MemoryClass::LOAD);
     if (_chunk == nullptr) {
         _chunk = ChunkHelper::new_chunk(*_vectorized_schema, 0);
     }
@@ -431,11 +433,21 @@ Status MemTable::_sort(bool is_final, bool by_sort_key) {
 void MemTable::_append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final) {
     DCHECK_EQ(src->num_rows(), _permutations.size());
     permutate_to_selective(_permutations, &_selective_values);
-    if (is_final) {
-        dest->rolling_append_selective(*src, _selective_values.data(), 0, src->num_rows());
-    } else {
-        dest->append_selective(*src, _selective_values.data(), 0, src->num_rows());
-    }
+    const uint32_t* indexes = _selective_values.data();
+    const auto num_rows = static_cast<uint32_t>(src->num_rows());
+    DCHECK_EQ(dest->num_columns(), src->num_columns());
+    // Gather the columns of wide chunks in parallel, same as Chunk::append_selective() and
+    // Chunk::rolling_append_selective() otherwise.
+    auto st = ChunkHelper::parallel_for_columns(src->num_columns(), [&](size_t begin, size_t end) -> Status {
+        for (size_t i = begin; i < end; ++i) {
+            dest->get_column_by_index(i)->append_selective(*src->get_column_by_index(i), indexes, 0, num_rows);
+            if (is_final) {
+                src->get_column_by_index(i).reset();
+            }
+        }
+        return Status::OK();
+    });
+    DCHECK(st.ok());
 }
 
 Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::unique_ptr<Column>* deletes) {
@@ -486,6 +498,30 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::u
     return Status::OK();
 }
 
+bool MemTable::_is_sorted_by(const Chunk& chunk, const std::vector<ColumnId>& sort_key_idxes) {
+    std::vector<const Column*> columns;
+    columns.reserve(sort_key_idxes.size());
+    for (auto sort_key_idx : sort_key_idxes) {
+        columns.push_back(chunk.get_column_by_index(sort_key_idx).get());
+    }
+    // The rows arriving in the order of the sort key, e.g. the time series, are checked in one pass, while the
+    // other rows usually stop at the first few rows.
+    const size_t num_rows = chunk.num_rows();
+    for (size_t i = 1; i < num_rows; ++i) {
+        for (const auto* column : columns) {
+            // ascending and nulls first, same as the sort below
+            int r = column->compare_at(i - 1, i, *column, -1);
+            if (r < 0) {
+                break;
+            }
+            if (r > 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 Status MemTable::_sort_column_inc(bool by_sort_key) {
     Columns columns;
     std::vector<ColumnId> sort_key_idxes;
@@ -516,6 +552,22 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
         }
     }
 
+    if (config::enable_memtable_sorted_input_fast_path && _merge_condition.empty() &&
+        _is_sorted_by(*_chunk, sort_key_idxes)) {
+        // _permutations is the identity permutation set by _sort(), which is also the result of a stable sort
+        return Status::OK();
+    }
+
+    if (config::enable_memtable_radix_sort && _merge_condition.empty() && sort_key_idxes.size() > 1 &&
+        PrimaryKeyEncoder::is_supported(*_vectorized_schema, sort_key_idxes)) {
+        // Sort the memcmp-able encoded keys in one contiguous buffer by a radix sort, to avoid comparing the
+        // columns one by one through the virtual calls.
+        BinaryColumn sort_keys;
+        RETURN_IF_ERROR(PrimaryKeyEncoder::encode_sort_key(*_vectorized_schema, sort_key_idxes, *_chunk, 0,
+                                                           _chunk->num_rows(), &sort_keys));
+        return stable_radix_sort_encoded_keys(false, sort_keys, &_permutations);
+    }
+
     for (auto sort_key_idx : sort_key_idxes) {
         columns.push_back(_chunk->get_column_by_index(sort_key_idx));
     }
@@ -76,6 +76,8 @@ private:
 
     Status _sort(bool is_final, bool by_sort_key = false);
     Status _sort_column_inc(bool by_sort_key = false);
+    // Whether the rows of |chunk| are already in the ascending order of the columns |sort_key_idxes|.
+    static bool _is_sorted_by(const Chunk& chunk, const std::vector<ColumnId>& sort_key_idxes);
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
     void _init_aggregator_if_needed();
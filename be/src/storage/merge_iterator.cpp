@@ -16,7 +16,7 @@
 
 #include <boost/heap/skew_heap.hpp>
 #include <memory>
-#include <queue>
+#include <optional>
 #include <vector>
 
 #include "column/chunk.h"
@@ -106,14 +106,30 @@ public:
 
     // return the next row number of last row whose key value is less than all values in |rhs|
     size_t last_row_less_than(const ComparableChunk& rhs, size_t limit_num) {
-        // As we previously pop this chunk from the heap top, `_compared_row` in this chunk
-        // must be less than all rows in rhs, thus here we start comparision from _compared_row + 1;
-        size_t next_compare_row = _compared_row + 1;
+        // As this chunk is the smallest one, `_compared_row` in this chunk must be less than
+        // all rows in rhs, thus here we start comparision from _compared_row + 1.
+        // The rows less than |rhs| are a prefix of the sorted rows, which is found by galloping then a
+        // binary search, so a long run costs O(log(run length)) comparisons instead of one per row.
+        size_t lo = _compared_row + 1;
         size_t upper_bound = std::min(_compared_row + limit_num, _chunk->num_rows());
-        while (next_compare_row < upper_bound && less_than(next_compare_row, rhs)) {
-            next_compare_row++;
+        size_t hi = upper_bound;
+        for (size_t step = 1; lo < upper_bound; step *= 2) {
+            size_t probe = std::min(lo + step - 1, upper_bound - 1);
+            if (!less_than(probe, rhs)) {
+                hi = probe;
+                break;
+            }
+            lo = probe + 1;
+        }
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (less_than(mid, rhs)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
         }
-        return next_compare_row;
+        return lo;
     }
 
     bool less_than(size_t lhs_row, const ComparableChunk& rhs) {
@@ -216,6 +232,9 @@ inline void MergeIterator::close() {
     _chunk_pool.clear();
 }
 
+// Merges the children through a loser tree over the children. Replacing the smallest chunk costs one comparison
+// per tree level, and no chunk is copied in and out of a heap. The rows of the smallest chunk are emitted in runs,
+// up to the first row that is not less than the second smallest chunk.
 class HeapMergeIterator final : public MergeIterator {
 public:
     explicit HeapMergeIterator(std::vector<ChunkIteratorPtr> children) : MergeIterator(std::move(children)) {}
@@ -238,29 +257,88 @@ protected:
     Status fill(size_t child) override;
 
 private:
-    template <typename T, typename Container = std::vector<T>>
-    using MinPriorityQueue = std::priority_queue<T, Container, std::greater<T>>;
-    using ChunkHeap = MinPriorityQueue<ComparableChunk>;
+    // whether the current row of child |a| is less than the one of child |b|, an exhausted child is the greatest.
+    bool _less(size_t a, size_t b) const {
+        if (!_chunks[a].has_value()) {
+            return false;
+        }
+        if (!_chunks[b].has_value()) {
+            return true;
+        }
+        return *_chunks[b] > *_chunks[a];
+    }
+
+    // Builds the subtree of |node|, returns its winner.
+    size_t _build(size_t node);
 
-    ChunkHeap _heap;
+    // Replays the matches of the winner after its current row changed.
+    void _replay();
+
+    // Returns the child of the second smallest row, or -1 if the other children are exhausted.
+    int64_t _runner_up() const;
+
+    // The current chunk of each child, nullopt once the child is exhausted.
+    std::vector<std::optional<ComparableChunk>> _chunks;
+    // _losers[node] is the loser of the match at the internal node, the leaf of child i is node i + size.
+    std::vector<size_t> _losers;
+    size_t _winner = 0;
 };
 
+inline size_t HeapMergeIterator::_build(size_t node) {
+    const size_t num_children = _chunks.size();
+    if (node >= num_children) {
+        return node - num_children;
+    }
+    size_t left = _build(2 * node);
+    size_t right = _build(2 * node + 1);
+    if (_less(right, left)) {
+        std::swap(left, right);
+    }
+    _losers[node] = right;
+    return left;
+}
+
+inline void HeapMergeIterator::_replay() {
+    const size_t num_children = _chunks.size();
+    for (size_t node = (_winner + num_children) / 2; node > 0; node /= 2) {
+        if (_less(_losers[node], _winner)) {
+            std::swap(_losers[node], _winner);
+        }
+    }
+}
+
+inline int64_t HeapMergeIterator::_runner_up() const {
+    // the second smallest row lost its match against the winner, on the path of the winner to the root
+    const size_t num_children = _chunks.size();
+    int64_t runner_up = -1;
+    for (size_t node = (_winner + num_children) / 2; node > 0; node /= 2) {
+        const size_t child = _losers[node];
+        if (_chunks[child].has_value() && (runner_up < 0 || _less(child, runner_up))) {
+            runner_up = child;
+        }
+    }
+    return runner_up;
+}
+
 inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSourceMask>* source_masks,
                                              std::vector<uint64_t>* rssid_rowids) {
     if (!_inited) {
+        _chunks.resize(_children.size());
+        _losers.resize(_children.size());
         RETURN_IF_ERROR(init());
+        _winner = _build(1);
     }
     size_t rows = 0;
     Status st;
 
-    while (!_heap.empty() && rows < _chunk_size) {
-        ComparableChunk min_chunk = _heap.top();
-        _heap.pop();
+    while (_chunks[_winner].has_value() && rows < _chunk_size) {
+        ComparableChunk& min_chunk = *_chunks[_winner];
         DCHECK_GT(min_chunk.remaining_rows(), 0);
 
+        const int64_t runner_up = _runner_up();
         size_t offset = min_chunk.compared_row();
         size_t append_row_num = 0;
-        bool less_than_all = _heap.empty() || min_chunk.less_than_all(_heap.top());
+        bool less_than_all = runner_up < 0 || min_chunk.less_than_all(*_chunks[runner_up]);
 
         if (less_than_all) {
             if (offset == 0) {
@@ -281,7 +359,6 @@ inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSource
                     return fill(min_chunk._order);
                 } else {
                     // retrieve |min_chunk| next time to avoid memory copy.
-                    _heap.push(min_chunk);
                     break;
                 }
             } else {
@@ -295,9 +372,9 @@ inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSource
                 }
             }
         } else {
-            // find the last row in |min_chunk| whose key is less than all values in _heap.top(),
+            // find the last row in |min_chunk| whose key is less than all values in the runner up,
             // subtract it with the offset to get the append_row_num
-            append_row_num = min_chunk.last_row_less_than(_heap.top(), _chunk_size - rows) - offset;
+            append_row_num = min_chunk.last_row_less_than(*_chunks[runner_up], _chunk_size - rows) - offset;
         }
 
         DCHECK_GT(append_row_num, 0);
@@ -318,7 +395,7 @@ inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSource
             source_masks->insert(source_masks->end(), append_row_num, RowSourceMask{min_chunk._order, false});
         }
         if (min_chunk.remaining_rows() > 0) {
-            _heap.push(min_chunk);
+            _replay();
         } else {
             st = fill(min_chunk._order);
             if (!st.ok()) {
@@ -355,19 +432,25 @@ inline Status HeapMergeIterator::fill(size_t child) {
                     "Merge iterator only supports merging chunks with rows less than $0", max_merge_chunk_size));
         }
         if (need_rssid_rowids) {
-            _heap.push(ComparableChunk{chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(),
-                                       merge_condition, std::move(rssid_rowids)});
+            _chunks[child].emplace(chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(), merge_condition,
+                                   std::move(rssid_rowids));
         } else {
-            _heap.push(
-                    ComparableChunk{chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(), merge_condition});
+            _chunks[child].emplace(chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(), merge_condition);
         }
     } else if (st.is_end_of_file()) {
         // ignore Status::EndOfFile.
+        _chunks[child].reset();
         close_child(child);
     } else {
+        _chunks[child].reset();
         close_child(child);
         return st;
     }
+    // the children are filled before the tree is built by the first do_get_next()
+    if (_inited) {
+        DCHECK_EQ(child, _winner);
+        _replay();
+    }
     return Status::OK();
 }
 
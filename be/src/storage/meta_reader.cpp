@@ -34,7 +34,7 @@
 namespace starrocks {
 
 std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"flat_json_meta", "dict_merge", "max", "min",
-                                                                         "count"};
+                                                                         "count", "histogram"};
 
 Status SegmentMetaCollecter::parse_field_and_colname(const std::string& item, std::string* field,
                                                      std::string* col_name) {
@@ -131,7 +131,7 @@ Status MetaReader::_fill_result_chunk(Chunk* chunk) {
             desc.children.emplace_back(item_desc);
             ColumnPtr column = ColumnHelper::create_column(desc, false);
             chunk->append_column(std::move(column), slot->id());
-        } else if (field == "flat_json_meta") {
+        } else if (field == "flat_json_meta" || field == "histogram") {
             TypeDescriptor item_desc;
             item_desc.type = TYPE_VARCHAR;
             TypeDescriptor desc;
@@ -229,6 +229,8 @@ Status SegmentMetaCollecter::_collect(const std::string& name, ColumnId cid, Col
         return _collect_count(column, type);
     } else if (name == "flat_json_meta") {
         return _collect_flat_json(cid, column);
+    } else if (name == "histogram") {
+        return _collect_histogram(cid, column);
     }
     return Status::NotSupported("Not Support Collect Meta: " + name);
 }
@@ -261,6 +263,31 @@ Status SegmentMetaCollecter::_collect_flat_json(ColumnId cid, Column* column) {
     return Status::OK();
 }
 
+// Each bucket of the segment histogram is collected as "<count>:<upper bound>", an empty array if the segment has
+// no histogram.
+Status SegmentMetaCollecter::_collect_histogram(ColumnId cid, Column* column) {
+    if (cid >= _segment->num_columns()) {
+        return Status::NotFound("error column id");
+    }
+    const ColumnReader* col_reader = _segment->column(cid);
+    if (col_reader == nullptr) {
+        return Status::NotFound("don't found column");
+    }
+    auto* array_column = down_cast<ArrayColumn*>(column);
+    size_t size = array_column->offsets_column()->get_data().back();
+    const ZoneMapPB* zone_map = col_reader->segment_zone_map();
+    if (zone_map != nullptr && zone_map->has_histogram()) {
+        const ZoneMapHistogramPB& histogram = zone_map->histogram();
+        for (int i = 0; i < histogram.upper_bounds_size() && i < histogram.counts_size(); i++) {
+            std::string str = fmt::format("{}:{}", histogram.counts(i), histogram.upper_bounds(i));
+            array_column->elements_column()->append_datum(Slice(str));
+            size++;
+        }
+    }
+    array_column->offsets_column()->append(size);
+    return Status::OK();
+}
+
 // collect dict
 Status SegmentMetaCollecter::_collect_dict(ColumnId cid, Column* column, LogicalType type) {
     if (!_column_iterators[cid]) {
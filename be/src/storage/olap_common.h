@@ -209,6 +209,16 @@ struct HashOfVersion {
 };
 
 // ReaderStatistics used to collect statistics when scan data from storage
+// The statistics of the predicates of a column evaluated one by one by the adaptive predicate order of the
+// segment iterators.
+struct PredicateColumnStats {
+    // The rows selected before and after the predicates are evaluated.
+    int64_t input_rows = 0;
+    int64_t output_rows = 0;
+    // The time of reading the column and evaluating the predicates.
+    int64_t evaluate_ns = 0;
+};
+
 struct OlapReaderStatistics {
     int64_t create_segment_iter_ns = 0;
     int64_t io_ns = 0;
@@ -228,10 +238,15 @@ struct OlapReaderStatistics {
 
     int64_t decode_dict_ns = 0;
     int64_t late_materialize_ns = 0;
+    // the segments whose value columns are decoded from the row column, and the time of decoding them
+    int64_t row_store_segments = 0;
+    int64_t row_store_decode_ns = 0;
 
     int64_t raw_rows_read = 0;
 
     int64_t rows_vec_cond_filtered = 0;
+    int64_t rows_encoded_pred_filtered = 0;
+    int64_t encoded_pred_evaluate_ns = 0;
     int64_t vec_cond_ns = 0;
     int64_t vec_cond_evaluate_ns = 0;
     int64_t vec_cond_chunk_copy_ns = 0;
@@ -247,6 +262,10 @@ struct OlapReaderStatistics {
     int64_t zone_map_filter_ns = 0;
     int64_t rows_key_range_filter_ns = 0;
     int64_t bf_filter_ns = 0;
+    // The time of waiting for the bloom filter indexes prefetched in the background, and the reads to prefetch them.
+    int64_t index_prefetch_wait_ns = 0;
+    int64_t index_prefetch_io_count = 0;
+    int64_t index_prefetch_io_bytes = 0;
 
     int64_t segment_stats_filtered = 0;
     int64_t rows_key_range_filtered = 0;
@@ -254,6 +273,10 @@ struct OlapReaderStatistics {
     int64_t rows_key_range_num = 0;
     int64_t rows_stats_filtered = 0;
     int64_t rows_bf_filtered = 0;
+    // The pages whose ngram bloom filters are checked, and the pages of them filtered out. The pages kept but
+    // filtered out later by the predicates are the false positives of the ngram bloom filters.
+    int64_t ngram_bf_pages_checked = 0;
+    int64_t ngram_bf_pages_filtered = 0;
     int64_t rows_del_filtered = 0;
     int64_t del_filter_ns = 0;
 
@@ -267,12 +290,16 @@ struct OlapReaderStatistics {
 
     int64_t rows_gin_filtered = 0;
     int64_t gin_index_filter_ns = 0;
+    int64_t rows_vector_index_filtered = 0;
+    int64_t vector_index_filter_ns = 0;
 
     int64_t rowsets_read_count = 0;
     int64_t segments_read_count = 0;
     int64_t total_columns_data_page_count = 0;
 
     int64_t runtime_stats_filtered = 0;
+    // Number of the segments skipped entirely by the zone map of the segments and the runtime filters.
+    int64_t runtime_segments_filtered = 0;
 
     int64_t read_pk_index_ns = 0;
 
@@ -297,6 +324,11 @@ struct OlapReaderStatistics {
     int64_t prefetch_hit_count = 0;
     int64_t prefetch_wait_finish_ns = 0;
     int64_t prefetch_pending_ns = 0;
+    // The pages read ahead by PageReadAheadStream, those that are read by the column iterators, and the time of
+    // waiting for them.
+    int64_t read_ahead_count = 0;
+    int64_t read_ahead_hit_count = 0;
+    int64_t read_ahead_wait_ns = 0;
     // ------ for lake tablet ------
 
     // ------ for json type, to count flat column ------
@@ -304,6 +336,9 @@ struct OlapReaderStatistics {
     int64_t json_flatten_ns = 0;
     std::unordered_map<std::string, int64_t> flat_json_hits;
     std::unordered_map<std::string, int64_t> dynamic_json_hits;
+
+    // key: column name
+    std::unordered_map<std::string, PredicateColumnStats> predicate_column_stats;
 };
 
 // OlapWriterStatistics used to collect statistics when write data to storage
@@ -322,6 +357,9 @@ const char* const kIONsRemote = "io_ns_remote";
 const char* const kPrefetchHitCount = "prefetch_hit_count";
 const char* const kPrefetchWaitFinishNs = "prefetch_wait_finish_ns";
 const char* const kPrefetchPendingNs = "prefetch_pending_ns";
+const char* const kReadAheadCount = "read_ahead_count";
+const char* const kReadAheadHitCount = "read_ahead_hit_count";
+const char* const kReadAheadWaitNs = "read_ahead_wait_ns";
 
 // The position index of a column in a specific TabletSchema starts from 0.
 // The position of the same column in different TabletSchema may be different, which
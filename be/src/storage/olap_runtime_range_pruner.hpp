@@ -16,8 +16,10 @@
 
 #include <cstddef>
 #include <memory>
+#include <set>
 #include <utility>
 
+#include "common/config.h"
 #include "exec/olap_common.h"
 #include "exprs/runtime_filter_bank.h"
 #include "runtime/global_dict/config.h"
@@ -75,6 +77,9 @@ struct RuntimeColumnPredicateBuilder {
                 }
             } else {
                 build_minmax_range<RangeType, value_type, mapping_type, DummyDecoder>(range, rf, nullptr);
+                if constexpr (RuntimeBloomFilter<mapping_type>::kCanUseBitset) {
+                    RETURN_IF_ERROR((build_in_range<RangeType, value_type, mapping_type>(range, rf)));
+                }
             }
 
             std::vector<TCondition> filters;
@@ -165,6 +170,26 @@ struct RuntimeColumnPredicateBuilder {
         auto max_value = parser.max_value();
         (void)range.add_range(max_op, static_cast<value_type>(max_value));
     }
+
+    // The exact bitset of a small set of values is turned into an IN predicate, which is tested with the zone maps
+    // and the bitmap indexes more precisely than the min/max range.
+    template <class Range, class value_type, LogicalType mapping_type>
+    static Status build_in_range(Range& range, const JoinRuntimeFilter* rf) {
+        const auto* filter = down_cast<const RuntimeBloomFilter<mapping_type>*>(rf);
+        const int64_t max_values = config::runtime_filter_in_pushdown_max_values;
+        if (max_values <= 0 || !filter->has_bitset()) {
+            return Status::OK();
+        }
+        std::vector<typename RunTimeTypeTraits<mapping_type>::CppType> values;
+        if (!filter->get_bitset_values(max_values, &values)) {
+            return Status::OK();
+        }
+        std::set<value_type> value_set;
+        for (auto value : values) {
+            value_set.insert(static_cast<value_type>(value));
+        }
+        return range.add_fixed_values(FILTER_IN, value_set);
+    }
 };
 } // namespace detail
 
@@ -52,6 +52,7 @@
 #include "storage/olap_common.h"
 #include "storage/olap_define.h"
 #include "storage/persistent_index_compaction_manager.h"
+#include "storage/primary_index_warmer.h"
 #include "storage/publish_version_manager.h"
 #include "storage/replication_txn_manager.h"
 #include "storage/storage_engine.h"
@@ -104,6 +105,10 @@ Status StorageEngine::start_bg_threads() {
     _pk_dump_thread = std::thread([this] { _pk_dump_thread_callback(nullptr); });
     Thread::set_thread_name(_pk_dump_thread, "pk_dump");
 
+    if (config::enable_pk_index_warmup) {
+        _update_manager->get_primary_index_warmer()->warm_up_recent_tablets();
+    }
+
 #ifdef USE_STAROS
     _local_pk_index_shared_data_gc_evict_thread =
             std::thread([this] { _local_pk_index_shared_data_gc_evict_thread_callback(nullptr); });
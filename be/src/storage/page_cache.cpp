@@ -35,9 +35,13 @@
 #include "storage/page_cache.h"
 
 #include <malloc.h>
+#include <strings.h>
 
+#include "column/column.h"
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
+#include "storage/page_disk_cache.h"
 #include "util/defer_op.h"
 #include "util/lru_cache.h"
 #include "util/metrics.h"
@@ -48,6 +52,9 @@ namespace starrocks {
 METRIC_DEFINE_UINT_GAUGE(page_cache_lookup_count, MetricUnit::OPERATIONS);
 METRIC_DEFINE_UINT_GAUGE(page_cache_hit_count, MetricUnit::OPERATIONS);
 METRIC_DEFINE_UINT_GAUGE(page_cache_capacity, MetricUnit::BYTES);
+METRIC_DEFINE_UINT_GAUGE(page_disk_cache_lookup_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(page_disk_cache_hit_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(page_disk_cache_usage, MetricUnit::BYTES);
 
 StoragePageCache* StoragePageCache::_s_instance = nullptr;
 
@@ -85,13 +92,50 @@ static void init_metrics() {
     });
 }
 
+static CachePolicy page_cache_policy() {
+    if (strcasecmp(config::storage_page_cache_policy.c_str(), "tiny_lfu") == 0) {
+        return CachePolicy::TINY_LFU;
+    }
+    return CachePolicy::LRU;
+}
+
 StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity)
-        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE)) {
+        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE, page_cache_policy())) {
     init_metrics();
 }
 
 StoragePageCache::~StoragePageCache() = default;
 
+static void init_disk_cache_metrics() {
+    auto* metrics = StarRocksMetrics::instance()->metrics();
+    metrics->register_metric("page_disk_cache_lookup_count", &page_disk_cache_lookup_count);
+    metrics->register_hook("page_disk_cache_lookup_count", []() {
+        page_disk_cache_lookup_count.set_value(StoragePageCache::instance()->disk_cache()->get_lookup_count());
+    });
+
+    metrics->register_metric("page_disk_cache_hit_count", &page_disk_cache_hit_count);
+    metrics->register_hook("page_disk_cache_hit_count", []() {
+        page_disk_cache_hit_count.set_value(StoragePageCache::instance()->disk_cache()->get_hit_count());
+    });
+
+    metrics->register_metric("page_disk_cache_usage", &page_disk_cache_usage);
+    metrics->register_hook("page_disk_cache_usage", []() {
+        page_disk_cache_usage.set_value(StoragePageCache::instance()->disk_cache()->disk_usage());
+    });
+}
+
+Status StoragePageCache::init_disk_cache(const std::string& dir, int64_t capacity) {
+    DCHECK(_disk_cache == nullptr);
+    auto disk_cache = std::make_unique<PageDiskCache>(dir, capacity, config::storage_page_disk_cache_max_pending_bytes,
+                                                      _mem_tracker);
+    RETURN_IF_ERROR(disk_cache->init());
+    _disk_cache = std::move(disk_cache);
+    if (this == _s_instance) {
+        init_disk_cache_metrics();
+    }
+    return Status::OK();
+}
+
 void StoragePageCache::set_capacity(size_t capacity) {
 #ifndef BE_TEST
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
@@ -119,15 +163,35 @@ bool StoragePageCache::adjust_capacity(int64_t delta, size_t min_capacity) {
 }
 
 bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle) {
-    auto* lru_handle = _cache->lookup(key.encode());
-    if (lru_handle == nullptr) {
+    std::string encoded_key = key.encode();
+    auto* lru_handle = _cache->lookup(encoded_key);
+    if (lru_handle != nullptr) {
+        *handle = PageCacheHandle(_cache.get(), lru_handle);
+        return true;
+    }
+    if (_disk_cache == nullptr) {
         return false;
     }
-    *handle = PageCacheHandle(_cache.get(), lru_handle);
+    size_t size = 0;
+    // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work, like the page read from file.
+    auto page = _disk_cache->lookup(encoded_key, Column::APPEND_OVERFLOW_MAX_SIZE, &size);
+    if (page == nullptr) {
+        return false;
+    }
+    _insert(encoded_key, Slice(page.get(), size), handle, false);
+    page.release();
     return true;
 }
 
 void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory) {
+    std::string encoded_key = key.encode();
+    if (_disk_cache != nullptr) {
+        _disk_cache->write_back(encoded_key, data);
+    }
+    _insert(encoded_key, data, handle, in_memory);
+}
+
+void StoragePageCache::_insert(const std::string& key, const Slice& data, PageCacheHandle* handle, bool in_memory) {
     // mem size should equals to data size when running UT
     int64_t mem_size = data.size;
 #ifndef BE_TEST
@@ -145,7 +209,7 @@ void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheH
     }
     // Use mem size managed by memory allocator as this record charge size. At the same time, we should record this record size
     // for data fetching when lookup.
-    auto* lru_handle = _cache->insert(key.encode(), data.data, mem_size, deleter, priority, data.size);
+    auto* lru_handle = _cache->insert(key, data.data, mem_size, deleter, priority, data.size);
     *handle = PageCacheHandle(_cache.get(), lru_handle);
 }
 
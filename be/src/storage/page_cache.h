@@ -47,6 +47,7 @@
 namespace starrocks {
 
 class PageCacheHandle;
+class PageDiskCache;
 class MemTracker;
 
 // Page cache min size is 256MB
@@ -95,6 +96,7 @@ public:
     // destructs.
     //
     // Return true if entry is found, otherwise return false.
+    // If the page is not in memory but in the disk cache, it is read from the disk cache and inserted into memory.
     bool lookup(const CacheKey& key, PageCacheHandle* handle);
 
     // Insert a page with key into this cache.
@@ -102,8 +104,14 @@ public:
     // This function is thread-safe, and when two clients insert two same key
     // concurrently, this function can assure that only one page is cached.
     // The in_memory page will have higher priority.
+    // The page is also written to the disk cache in the background if it is enabled.
     void insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory = false);
 
+    // Enable the second tier on the local disk at `dir`, which keeps at most `capacity` bytes of pages.
+    Status init_disk_cache(const std::string& dir, int64_t capacity);
+
+    PageDiskCache* disk_cache() const { return _disk_cache.get(); }
+
     size_t memory_usage() const { return _cache->get_memory_usage(); }
 
     void set_capacity(size_t capacity);
@@ -121,8 +129,11 @@ public:
 private:
     static StoragePageCache* _s_instance;
 
+    void _insert(const std::string& key, const Slice& data, PageCacheHandle* handle, bool in_memory);
+
     MemTracker* _mem_tracker = nullptr;
     std::unique_ptr<Cache> _cache = nullptr;
+    std::unique_ptr<PageDiskCache> _disk_cache = nullptr;
 };
 
 // A handle for StoragePageCache entry. This class make it easy to handle
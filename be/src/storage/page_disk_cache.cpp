@@ -0,0 +1,220 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/page_disk_cache.h"
+
+#include <fmt/format.h>
+
+#include "common/logging.h"
+#include "fs/fs.h"
+#include "gutil/strings/util.h"
+#include "runtime/current_thread.h"
+#include "util/crc32c.h"
+#include "util/threadpool.h"
+
+namespace starrocks {
+
+PageDiskCache::PageDiskCache(std::string dir, int64_t capacity, int64_t max_pending_bytes, MemTracker* mem_tracker)
+        : _dir(std::move(dir)),
+          _capacity(capacity),
+          _max_pending_bytes(max_pending_bytes),
+          _mem_tracker(mem_tracker) {}
+
+PageDiskCache::~PageDiskCache() {
+    if (_write_pool != nullptr) {
+        _write_pool->shutdown();
+    }
+    if (_write_file != nullptr) {
+        (void)_write_file->close();
+    }
+}
+
+Status PageDiskCache::init() {
+    _fs = FileSystem::Default();
+    RETURN_IF_ERROR(_init_dir());
+    return ThreadPoolBuilder("page_disk_cache").set_min_threads(1).set_max_threads(1).build(&_write_pool);
+}
+
+Status PageDiskCache::_init_dir() {
+    const std::string marker = fmt::format("{}/{}", _dir, kMarkerFile);
+    if (!_fs->path_exists(_dir).ok()) {
+        RETURN_IF_ERROR(_fs->create_dir_recursive(_dir));
+        ASSIGN_OR_RETURN(auto file, _fs->new_writable_file(marker));
+        return file->close();
+    }
+
+    std::vector<std::string> children;
+    RETURN_IF_ERROR(_fs->get_children(_dir, &children));
+    if (!_fs->path_exists(marker).ok()) {
+        // Never remove the files of a directory not created by the cache, e.g. a misconfigured storage root.
+        if (!children.empty()) {
+            return Status::InvalidArgument(
+                    fmt::format("Page disk cache directory {} is not empty and not created by the cache", _dir));
+        }
+        ASSIGN_OR_RETURN(auto file, _fs->new_writable_file(marker));
+        return file->close();
+    }
+    // The pages left by the last process are not indexed, so its block files are removed.
+    for (const auto& name : children) {
+        if (HasSuffixString(name, kBlockFileSuffix)) {
+            RETURN_IF_ERROR(_fs->delete_file(fmt::format("{}/{}", _dir, name)));
+        }
+    }
+    return Status::OK();
+}
+
+void PageDiskCache::write_back(const std::string& key, const Slice& data) {
+    const auto size = static_cast<int64_t>(data.size);
+    if (_pending_bytes.fetch_add(size) + size > _max_pending_bytes) {
+        _pending_bytes.fetch_sub(size);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (_index.count(key) > 0) {
+            _pending_bytes.fetch_sub(size);
+            return;
+        }
+    }
+
+#ifndef BE_TEST
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
+    auto page = std::make_shared<std::string>(data.data, data.size);
+    auto st = _write_pool->submit_func([this, key, page, size]() mutable {
+        _write_page(key, *page);
+#ifndef BE_TEST
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
+        page.reset();
+        _pending_bytes.fetch_sub(size);
+    });
+    if (!st.ok()) {
+        _pending_bytes.fetch_sub(size);
+    }
+}
+
+void PageDiskCache::_write_page(const std::string& key, const std::string& data) {
+    std::lock_guard<std::mutex> l(_write_mutex);
+    auto st = _append_locked(key, data);
+    if (!st.ok()) {
+        LOG_EVERY_N(WARNING, 100) << "Failed to write page to disk cache " << _dir << ": " << st;
+        // Start a new block file next time, the failed one is dropped with its pages when it is the oldest.
+        if (_write_file != nullptr) {
+            (void)_write_file->close();
+            _write_file.reset();
+        }
+    }
+}
+
+Status PageDiskCache::_append_locked(const std::string& key, const std::string& data) {
+    if (_write_file == nullptr || _write_file->size() + data.size() > kBlockSize) {
+        RETURN_IF_ERROR(_open_block_locked());
+    }
+    const auto offset = static_cast<int64_t>(_write_file->size());
+    RETURN_IF_ERROR(_write_file->append(Slice(data)));
+    const uint32_t checksum = crc32c::Value(data.data(), data.size());
+
+    std::lock_guard<std::mutex> l(_mutex);
+    _write_block->keys.push_back(key);
+    _write_block->size += data.size();
+    _disk_usage += data.size();
+    _index.emplace(key, Entry{_write_block, offset, static_cast<uint32_t>(data.size()), checksum});
+    while (_disk_usage > _capacity && _blocks.size() > 1) {
+        _drop_oldest_block_locked();
+    }
+    return Status::OK();
+}
+
+Status PageDiskCache::_open_block_locked() {
+    if (_write_file != nullptr) {
+        RETURN_IF_ERROR(_write_file->close());
+        _write_file.reset();
+    }
+    auto block = std::make_shared<Block>();
+    block->id = _next_block_id++;
+    block->path = fmt::format("{}/{}{}", _dir, block->id, kBlockFileSuffix);
+    ASSIGN_OR_RETURN(_write_file, _fs->new_writable_file(block->path));
+    ASSIGN_OR_RETURN(block->read_file, _fs->new_random_access_file(block->path));
+    _write_block = block;
+
+    std::lock_guard<std::mutex> l(_mutex);
+    _blocks.emplace_back(std::move(block));
+    return Status::OK();
+}
+
+void PageDiskCache::_drop_oldest_block_locked() {
+    BlockPtr block = std::move(_blocks.front());
+    _blocks.pop_front();
+    for (const auto& key : block->keys) {
+        auto it = _index.find(key);
+        if (it != _index.end() && it->second.block == block) {
+            _index.erase(it);
+        }
+    }
+    _disk_usage -= block->size;
+    // The lookups reading this block keep the file open.
+    auto st = _fs->delete_file(block->path);
+    LOG_IF(WARNING, !st.ok()) << "Failed to delete page disk cache block " << block->path << ": " << st;
+}
+
+void PageDiskCache::_erase(const std::string& key, const BlockPtr& block) {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto it = _index.find(key);
+    if (it != _index.end() && it->second.block == block) {
+        _index.erase(it);
+    }
+}
+
+std::unique_ptr<char[]> PageDiskCache::lookup(const std::string& key, size_t extra_bytes, size_t* size) {
+    _lookup_count.fetch_add(1, std::memory_order_relaxed);
+    Entry entry;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        auto it = _index.find(key);
+        if (it == _index.end()) {
+            return nullptr;
+        }
+        entry = it->second;
+    }
+
+    std::unique_ptr<char[]> page(new char[entry.size + extra_bytes]);
+    auto st = entry.block->read_file->read_at_fully(entry.offset, page.get(), entry.size);
+    if (!st.ok()) {
+        LOG_EVERY_N(WARNING, 100) << "Failed to read page from disk cache " << entry.block->path << ": " << st;
+        _erase(key, entry.block);
+        return nullptr;
+    }
+    if (crc32c::Value(page.get(), entry.size) != entry.checksum) {
+        LOG_EVERY_N(WARNING, 100) << "Checksum mismatch of page in disk cache " << entry.block->path
+                                  << ", offset=" << entry.offset;
+        _corrupted_count.fetch_add(1, std::memory_order_relaxed);
+        _erase(key, entry.block);
+        return nullptr;
+    }
+    _hit_count.fetch_add(1, std::memory_order_relaxed);
+    *size = entry.size;
+    return page;
+}
+
+void PageDiskCache::flush() {
+    _write_pool->wait();
+}
+
+int64_t PageDiskCache::disk_usage() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _disk_usage;
+}
+
+} // namespace starrocks
@@ -0,0 +1,123 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+#include "common/statusor.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+class FileSystem;
+class MemTracker;
+class RandomAccessFile;
+class ThreadPool;
+class WritableFile;
+
+// PageDiskCache is the second tier of StoragePageCache on the local disk, which keeps the decoded pages so that
+// a page missing in memory does not need to be read from the remote storage and decompressed again.
+//
+// The pages are appended asynchronously to the block files of `kBlockSize` under `dir`, and the oldest block file
+// is dropped as a whole once the block files exceed `capacity`. The index is kept in memory only, so the block
+// files left by the last process are removed by `init()`. Each page is validated by its crc32c when it is read.
+//
+// `dir` is marked by the file `kMarkerFile` when the cache creates it or finds it empty, and `init()` fails on
+// a non-empty directory without the marker, so that the files not written by the cache are never removed.
+class PageDiskCache {
+public:
+    static constexpr int64_t kBlockSize = 64 * 1024 * 1024;
+    static constexpr const char* kMarkerFile = "PAGE_DISK_CACHE";
+    static constexpr const char* kBlockFileSuffix = ".blk";
+
+    PageDiskCache(std::string dir, int64_t capacity, int64_t max_pending_bytes, MemTracker* mem_tracker);
+    ~PageDiskCache();
+
+    Status init();
+
+    // Copies the page `data` and writes it to the disk in the background. The page is dropped if the pages waiting
+    // for writing exceed `max_pending_bytes`, or it is already in the disk cache.
+    void write_back(const std::string& key, const Slice& data);
+
+    // Reads the page of `key` into a buffer allocated by `new char[size + extra_bytes]`, and returns nullptr if the
+    // page is not found or corrupted.
+    std::unique_ptr<char[]> lookup(const std::string& key, size_t extra_bytes, size_t* size);
+
+    // Waits for all the pages submitted by `write_back` to be written.
+    void flush();
+
+    int64_t disk_usage() const;
+    uint64_t get_lookup_count() const { return _lookup_count.load(std::memory_order_relaxed); }
+    uint64_t get_hit_count() const { return _hit_count.load(std::memory_order_relaxed); }
+    uint64_t get_corrupted_count() const { return _corrupted_count.load(std::memory_order_relaxed); }
+
+private:
+    struct Block {
+        uint64_t id = 0;
+        std::string path;
+        std::unique_ptr<RandomAccessFile> read_file;
+        // The keys of the pages in this block, to be removed from the index when the block is dropped.
+        std::vector<std::string> keys;
+        int64_t size = 0;
+    };
+    using BlockPtr = std::shared_ptr<Block>;
+
+    struct Entry {
+        BlockPtr block;
+        int64_t offset = 0;
+        uint32_t size = 0;
+        uint32_t checksum = 0;
+    };
+
+    // Creates `dir`, or removes the block files in it left by the last process.
+    Status _init_dir();
+    void _write_page(const std::string& key, const std::string& data);
+    Status _append_locked(const std::string& key, const std::string& data);
+    Status _open_block_locked();
+    void _drop_oldest_block_locked();
+    void _erase(const std::string& key, const BlockPtr& block);
+
+    const std::string _dir;
+    const int64_t _capacity;
+    const int64_t _max_pending_bytes;
+    MemTracker* _mem_tracker = nullptr;
+    FileSystem* _fs = nullptr;
+    std::unique_ptr<ThreadPool> _write_pool;
+
+    // Serializes the appends to the last block, and `_mutex` is not held while writing the file.
+    std::mutex _write_mutex;
+    BlockPtr _write_block;
+    std::unique_ptr<WritableFile> _write_file;
+    uint64_t _next_block_id = 0;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, Entry> _index;
+    std::deque<BlockPtr> _blocks;
+    int64_t _disk_usage = 0;
+
+    std::atomic<int64_t> _pending_bytes{0};
+    std::atomic<uint64_t> _lookup_count{0};
+    std::atomic<uint64_t> _hit_count{0};
+    std::atomic<uint64_t> _corrupted_count{0};
+};
+
+} // namespace starrocks
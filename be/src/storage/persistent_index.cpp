@@ -22,6 +22,7 @@
 #include "gutil/strings/escaping.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
+#include "runtime/mem_pool.h"
 #include "storage/chunk_helper.h"
 #include "storage/chunk_iterator.h"
 #include "storage/persistent_index_tablet_loader.h"
@@ -1044,21 +1045,34 @@ size_t MutableIndex::estimate_nbucket(size_t key_size, size_t size, size_t nshar
     return kBucketPerPage;
 }
 
-struct StringHasher2 {
-    uint64_t operator()(const std::string& s) const { return key_index_hash(s.data(), s.length() - kIndexValueSize); }
+// A composite key of SliceMutableIndex: the key followed by its 8 byte IndexValue, stored in the arena of the index.
+// A probe may point to the key alone with the size of the composite key, the value is never read from it.
+struct CompositeKeyRef {
+    const uint8_t* data;
+    uint32_t size;
+
+    CompositeKeyRef(const uint8_t* data, uint32_t size) : data(data), size(size) {}
+
+    Slice key() const { return {data, size - kIndexValueSize}; }
+    uint64_t value() const { return UNALIGNED_LOAD64(data + size - kIndexValueSize); }
 };
 
-class EqualOnStringWithHash {
-public:
-    bool operator()(const std::string& lhs, const std::string& rhs) const {
-        return memequal_padded(lhs.data(), lhs.size() - kIndexValueSize, rhs.data(), rhs.size() - kIndexValueSize);
+struct CompositeKeyRefHash {
+    uint64_t operator()(const CompositeKeyRef& k) const { return key_index_hash(k.data, k.size - kIndexValueSize); }
+};
+
+struct CompositeKeyRefEq {
+    bool operator()(const CompositeKeyRef& lhs, const CompositeKeyRef& rhs) const {
+        return lhs.size == rhs.size && strings::memeq(lhs.data, rhs.data, lhs.size - kIndexValueSize);
     }
 };
 
+// The composite keys live in a MemPool, and the hash set only keeps a 16 byte reference to each of them, instead of
+// a std::string with its own heap allocation. The keys of this index are longer than kSliceMaxFixLength, so the
+// strings were always allocated on the heap. A key is never removed from the set (erase writes a NullIndexValue),
+// so a new value of an existing key overwrites the old one in place and the pool only grows with new keys.
 class SliceMutableIndex : public MutableIndex {
 public:
-    using KeyType = std::string;
-
     using WALKVSizeType = uint32_t;
     static constexpr size_t kWALKVSize = 4;
     static_assert(sizeof(WALKVSizeType) == kWALKVSize);
@@ -1071,20 +1085,14 @@ public:
                const std::vector<size_t>& idxes) const override {
         size_t nfound = 0;
         for (const auto idx : idxes) {
-            std::string composite_key;
-            const auto& skey = keys[idx];
-            const auto value = values[idx];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            auto iter = _set.find(composite_key, hash);
+            const auto probe = _probe(keys[idx]);
+            uint64_t hash = CompositeKeyRefHash()(probe);
+            auto iter = _set.find(probe, hash);
             if (iter == _set.end()) {
                 values[idx] = NullIndexValue;
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
             } else {
-                const auto& composite_key = *iter;
-                auto value = UNALIGNED_LOAD64(composite_key.data() + composite_key.size() - kIndexValueSize);
+                auto value = iter->value();
                 values[idx] = IndexValue(value);
                 nfound += value != NullIndexValue;
             }
@@ -1097,23 +1105,17 @@ public:
                   size_t* num_found, const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
         for (const auto idx : idxes) {
-            std::string composite_key;
-            const auto& skey = keys[idx];
-            const auto value = values[idx];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
+            const auto probe = _probe(keys[idx]);
+            uint64_t hash = CompositeKeyRefHash()(probe);
+            auto iter = _set.find(probe, hash);
+            if (iter == _set.end()) {
+                _insert(hash, keys[idx], values[idx].get_value());
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
-                _total_kv_pairs_usage += composite_key.size();
             } else {
-                const auto& old_compose_key = *it;
-                auto old_value = UNALIGNED_LOAD64(old_compose_key.data() + old_compose_key.size() - kIndexValueSize);
+                auto old_value = iter->value();
                 old_values[idx] = old_value;
                 nfound += old_value != NullIndexValue;
-                _set.erase(it);
-                _set.emplace_with_hash(hash, composite_key);
+                _set_value(*iter, values[idx].get_value());
             }
         }
         *num_found = nfound;
@@ -1124,24 +1126,15 @@ public:
                   const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
         for (const auto idx : idxes) {
-            std::string composite_key;
-            const auto& skey = keys[idx];
-            const auto value = values[idx];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
+            const auto probe = _probe(keys[idx]);
+            uint64_t hash = CompositeKeyRefHash()(probe);
+            auto iter = _set.find(probe, hash);
+            if (iter == _set.end()) {
+                _insert(hash, keys[idx], values[idx].get_value());
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
-                _total_kv_pairs_usage += composite_key.size();
             } else {
-                const auto& old_compose_key = *it;
-                const auto old_value =
-                        UNALIGNED_LOAD64(old_compose_key.data() + old_compose_key.size() - kIndexValueSize);
-                nfound += old_value != NullIndexValue;
-                // TODO: find a way to modify iterator directly, currently just erase then re-insert
-                _set.erase(it);
-                _set.emplace_with_hash(hash, composite_key);
+                nfound += iter->value() != NullIndexValue;
+                _set_value(*iter, values[idx].get_value());
             }
         }
         *num_found = nfound;
@@ -1150,26 +1143,22 @@ public:
 
     Status insert(const Slice* keys, const IndexValue* values, const std::vector<size_t>& idxes) override {
         for (const auto idx : idxes) {
-            std::string composite_key;
             const auto& skey = keys[idx];
-            const auto value = values[idx];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
-                _total_kv_pairs_usage += composite_key.size();
+            const auto probe = _probe(skey);
+            uint64_t hash = CompositeKeyRefHash()(probe);
+            auto iter = _set.find(probe, hash);
+            if (iter == _set.end()) {
+                _insert(hash, skey, values[idx].get_value());
             } else {
-                auto& old_compose_key = *it;
-                auto old_value = UNALIGNED_LOAD64(old_compose_key.data() + old_compose_key.size() - kIndexValueSize);
+                auto old_value = iter->value();
                 auto old_rssid = (uint32_t)(old_value >> 32);
                 auto old_rowid = (uint32_t)(old_value & ROWID_MASK);
-                auto new_value = reinterpret_cast<uint64_t*>(const_cast<IndexValue*>(&value));
+                auto new_value = values[idx].get_value();
                 std::string msg = strings::Substitute(
                         "SliceMutableIndex key_size=$0 insert found duplicate key $1, "
                         "new(rssid=$2 rowid=$3), old(rssid=$4 rowid=$5)",
-                        skey.size, hexdump((const char*)skey.data, skey.size), (uint32_t)((*new_value) >> 32),
-                        (uint32_t)((*new_value) & ROWID_MASK), old_rssid, old_rowid);
+                        skey.size, hexdump((const char*)skey.data, skey.size), (uint32_t)(new_value >> 32),
+                        (uint32_t)(new_value & ROWID_MASK), old_rssid, old_rowid);
                 LOG(WARNING) << msg;
                 return Status::AlreadyExist(msg);
             }
@@ -1181,25 +1170,18 @@ public:
                  const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
         for (const auto idx : idxes) {
-            std::string composite_key;
-            const auto& skey = keys[idx];
-            const auto value = NullIndexValue;
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value);
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
+            const auto probe = _probe(keys[idx]);
+            uint64_t hash = CompositeKeyRefHash()(probe);
+            auto iter = _set.find(probe, hash);
+            if (iter == _set.end()) {
+                _insert(hash, keys[idx], NullIndexValue);
                 old_values[idx] = NullIndexValue;
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
-                _total_kv_pairs_usage += composite_key.size();
             } else {
-                auto& old_compose_key = *it;
-                auto old_value = UNALIGNED_LOAD64(old_compose_key.data() + old_compose_key.size() - kIndexValueSize);
+                auto old_value = iter->value();
                 old_values[idx] = old_value;
                 nfound += old_value != NullIndexValue;
-                // TODO: find a way to modify iterator directly, currently just erase then re-insert
-                _set.erase(it);
-                _set.emplace_with_hash(hash, composite_key);
+                _set_value(*iter, NullIndexValue);
             }
         }
         *num_found = nfound;
@@ -1208,20 +1190,7 @@ public:
 
     Status replace(const Slice* keys, const IndexValue* values, const std::vector<size_t>& idxes) override {
         for (const auto idx : idxes) {
-            std::string composite_key;
-            const auto& skey = keys[idx];
-            const auto value = values[idx];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
-                _total_kv_pairs_usage += composite_key.size();
-            } else {
-                // TODO: find a way to modify iterator directly, currently just erase then re-insert
-                _set.erase(it);
-                _set.emplace_with_hash(hash, composite_key);
-            }
+            _upsert(keys[idx], values[idx].get_value());
         }
         return Status::OK();
     }
@@ -1254,20 +1223,7 @@ public:
 
     Status load_wals(size_t n, const Slice* keys, const IndexValue* values) override {
         for (size_t i = 0; i < n; i++) {
-            std::string composite_key;
-            const auto& skey = keys[i];
-            const auto value = values[i];
-            composite_key.reserve(skey.size + kIndexValueSize);
-            composite_key.append(skey.data, skey.size);
-            put_fixed64_le(&composite_key, value.get_value());
-            uint64_t hash = StringHasher2()(composite_key);
-            if (auto [it, inserted] = _set.emplace_with_hash(hash, composite_key); inserted) {
-                _total_kv_pairs_usage += composite_key.size();
-            } else {
-                // TODO: find a way to modify iterator directly, currently just erase then re-insert
-                _set.erase(it);
-                _set.emplace_with_hash(hash, composite_key);
-            }
+            _upsert(keys[i], values[i].get_value());
         }
         return Status::OK();
     }
@@ -1287,14 +1243,11 @@ public:
             return true;
         }
         for (const auto& composite_key : _set) {
-            if (!ar.dump(static_cast<size_t>(composite_key.size()))) {
+            if (!ar.dump(static_cast<size_t>(composite_key.size))) {
                 LOG(ERROR) << "Failed to dump compose_key_size";
                 return false;
             }
-            if (composite_key.size() == 0) {
-                continue;
-            }
-            if (!ar.dump(composite_key.data(), composite_key.size())) {
+            if (!ar.dump(reinterpret_cast<const char*>(composite_key.data), composite_key.size)) {
                 LOG(ERROR) << "Failed to dump composite_key";
                 return false;
             }
@@ -1302,15 +1255,12 @@ public:
         return true;
 
         // TODO: construct a large buffer and write instead of one by one.
-        // TODO: dive in phmap internal detail and implement dump of std::string type inside, use ctrl_&slot_ directly to improve performance
-        // return _set.dump(ar);
     }
 
     Status pk_dump(PrimaryKeyDump* dump, PrimaryIndexDumpPB* dump_pb) override {
         for (const auto& composite_key : _set) {
-            auto value = UNALIGNED_LOAD64(composite_key.data() + composite_key.size() - kIndexValueSize);
-            RETURN_IF_ERROR(dump->add_pindex_kvs(
-                    std::string_view(composite_key.data(), composite_key.size() - kIndexValueSize), value, dump_pb));
+            auto key = composite_key.key();
+            RETURN_IF_ERROR(dump->add_pindex_kvs(std::string_view(key.data, key.size), composite_key.value(), dump_pb));
         }
         return dump->finish_pindex_kvs(dump_pb);
     }
@@ -1325,6 +1275,7 @@ public:
             return true;
         }
         reserve(size);
+        std::string composite_key;
         for (auto i = 0; i < size; ++i) {
             size_t compose_key_size = 0;
             if (!ar.load(&compose_key_size)) {
@@ -1334,25 +1285,17 @@ public:
             if (compose_key_size == 0) {
                 continue;
             }
-            std::string composite_key;
             raw::stl_string_resize_uninitialized(&composite_key, compose_key_size);
             if (!ar.load(composite_key.data(), composite_key.size())) {
                 LOG(ERROR) << "Failed to load composite_key";
                 return false;
             }
-            auto [it, inserted] = _set.emplace(composite_key);
-            if (inserted) {
-                _total_kv_pairs_usage += composite_key.size();
-            } else {
-                _set.erase(it);
-                _set.emplace(composite_key);
-            }
+            Slice key(composite_key.data(), compose_key_size - kIndexValueSize);
+            _upsert(key, UNALIGNED_LOAD64(composite_key.data() + key.size));
         }
         return true;
 
         // TODO: read a large buffer and parse instead of one by one.
-        // TODO: dive in phmap internal detail and implement load of std::string type inside, use ctrl_&slot_ directly to improve performance
-        // return _set.load(ar);
     }
 
     // TODO: read data in less batch, not one by one.
@@ -1397,12 +1340,11 @@ public:
             ret[i].reserve(num_entry / nshard * 100 / 85);
         }
         for (const auto& composite_key : _set) {
-            const auto value = UNALIGNED_LOAD64(composite_key.data() + composite_key.size() - kIndexValueSize);
-            IndexHash h(StringHasher2()(composite_key));
-            if (!with_null && value == NullIndexValue) {
+            if (!with_null && composite_key.value() == NullIndexValue) {
                 continue;
             }
-            ret[h.shard(shard_bits)].emplace_back((uint8_t*)(composite_key.data()), h.hash, composite_key.size());
+            IndexHash h(CompositeKeyRefHash()(composite_key));
+            ret[h.shard(shard_bits)].emplace_back(composite_key.data, h.hash, composite_key.size);
         }
         return ret;
     }
@@ -1428,25 +1370,47 @@ public:
 
     void clear() override {
         _set.clear();
+        _pool.free_all();
         _total_kv_pairs_usage = 0;
     }
 
-    // TODO: more accurate estimation for phmap::flat_hash_set<std::string, ...
     size_t memory_usage() override {
-        auto ret = capacity() * (1 + 32);
-        if (size() > 0 && _total_kv_pairs_usage / size() > 15) {
-            // std::string with size > 15 will alloc new memory for storage
-            ret += _total_kv_pairs_usage;
-            // an malloc extra cost estimation
-            ret += size() * 8;
-        }
-        return ret;
+        return capacity() * (1 + sizeof(CompositeKeyRef)) + _pool.total_reserved_bytes();
     }
 
 private:
+    static CompositeKeyRef _probe(const Slice& key) {
+        return {reinterpret_cast<const uint8_t*>(key.data), static_cast<uint32_t>(key.size + kIndexValueSize)};
+    }
+
+    static void _set_value(const CompositeKeyRef& composite_key, uint64_t value) {
+        UNALIGNED_STORE64(const_cast<uint8_t*>(composite_key.data) + composite_key.size - kIndexValueSize, value);
+    }
+
+    void _insert(uint64_t hash, const Slice& key, uint64_t value) {
+        size_t size = key.size + kIndexValueSize;
+        uint8_t* data = _pool.allocate(size);
+        memcpy(data, key.data, key.size);
+        UNALIGNED_STORE64(data + key.size, value);
+        _set.emplace_with_hash(hash, data, size);
+        _total_kv_pairs_usage += size;
+    }
+
+    void _upsert(const Slice& key, uint64_t value) {
+        const auto probe = _probe(key);
+        uint64_t hash = CompositeKeyRefHash()(probe);
+        auto iter = _set.find(probe, hash);
+        if (iter == _set.end()) {
+            _insert(hash, key, value);
+        } else {
+            _set_value(*iter, value);
+        }
+    }
+
     friend ShardByLengthMutableIndex;
     friend PersistentIndex;
-    phmap::flat_hash_set<KeyType, StringHasher2, EqualOnStringWithHash> _set;
+    phmap::flat_hash_set<CompositeKeyRef, CompositeKeyRefHash, CompositeKeyRefEq> _set;
+    MemPool _pool;
     size_t _total_kv_pairs_usage = 0;
 };
 
@@ -2421,6 +2385,17 @@ bool ImmutableIndex::_filter(size_t shard_idx, std::vector<KeyInfo>& keys_info,
     return true;
 }
 
+// Sort the keys of a shard by their pages and buckets, so that the probes of a batch walk the shard once in
+// address order instead of jumping between its pages.
+static void sort_keys_info_by_bucket(size_t npage, size_t nbucket, std::vector<KeyInfo>* keys_info) {
+    auto bucket_order = [&](const KeyInfo& info) {
+        IndexHash h(info.second);
+        return (h.page() % npage) * nbucket + h.bucket() % nbucket;
+    };
+    std::stable_sort(keys_info->begin(), keys_info->end(),
+                     [&](const KeyInfo& a, const KeyInfo& b) { return bucket_order(a) < bucket_order(b); });
+}
+
 Status ImmutableIndex::_split_keys_info_by_page(size_t shard_idx, std::vector<KeyInfo>& keys_info,
                                                 std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page) const {
     const auto& shard_info = _shards[shard_idx];
@@ -2645,6 +2620,9 @@ Status ImmutableIndex::_get_in_shard(size_t shard_idx, size_t n, const Slice* ke
         stat->read_iops++;
         stat->read_io_bytes += shard_info.bytes;
     }
+    if (config::enable_pindex_sorted_shard_lookup) {
+        sort_keys_info_by_bucket(shard_info.npage, shard_info.nbucket, &check_keys_info);
+    }
     if (shard_info.key_size != 0) {
         return _get_in_fixlen_shard(shard_idx, n, keys, check_keys_info, values, found_keys_info, &shard);
     } else {
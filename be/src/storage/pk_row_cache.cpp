@@ -0,0 +1,210 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/pk_row_cache.h"
+
+#include "column/binary_column.h"
+#include "column/column.h"
+#include "common/config.h"
+#include "gutil/casts.h"
+#include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
+#include "util/coding.h"
+#include "util/metrics.h"
+#include "util/starrocks_metrics.h"
+
+namespace starrocks {
+
+METRIC_DEFINE_UINT_GAUGE(pk_row_cache_lookup_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(pk_row_cache_hit_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(pk_row_cache_usage, MetricUnit::BYTES);
+
+#ifndef BE_TEST
+#define SCOPED_PK_ROW_CACHE_MEM_TRACKER() \
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(GlobalEnv::GetInstance()->update_mem_tracker())
+#else
+#define SCOPED_PK_ROW_CACHE_MEM_TRACKER()
+#endif
+
+PkRowCacheHandle::~PkRowCacheHandle() {
+    if (_handle != nullptr) {
+        _cache->_release(_handle);
+    }
+}
+
+const PkRowCacheEntry* PkRowCacheHandle::entry() const {
+    return reinterpret_cast<const PkRowCacheEntry*>(_cache->_cache->value(_handle));
+}
+
+static void init_metrics() {
+    auto* metrics = StarRocksMetrics::instance()->metrics();
+    metrics->register_metric("pk_row_cache_lookup_count", &pk_row_cache_lookup_count);
+    metrics->register_hook("pk_row_cache_lookup_count", []() {
+        pk_row_cache_lookup_count.set_value(PkRowCache::instance()->get_lookup_count());
+    });
+
+    metrics->register_metric("pk_row_cache_hit_count", &pk_row_cache_hit_count);
+    metrics->register_hook("pk_row_cache_hit_count",
+                           []() { pk_row_cache_hit_count.set_value(PkRowCache::instance()->get_hit_count()); });
+
+    metrics->register_metric("pk_row_cache_usage", &pk_row_cache_usage);
+    metrics->register_hook("pk_row_cache_usage",
+                           []() { pk_row_cache_usage.set_value(PkRowCache::instance()->get_memory_usage()); });
+}
+
+PkRowCache* PkRowCache::instance() {
+    static PkRowCache* s_instance = []() {
+        auto* cache = new PkRowCache(std::max<int64_t>(0, config::pk_row_cache_capacity));
+        init_metrics();
+        return cache;
+    }();
+    return s_instance;
+}
+
+PkRowCache::PkRowCache(size_t capacity) {
+    if (capacity > 0) {
+        _cache.reset(new_lru_cache(capacity, ChargeMode::MEMSIZE));
+    }
+}
+
+PkRowCache::~PkRowCache() = default;
+
+PkRowCache::ReadContext PkRowCache::begin_read(int64_t tablet_id) {
+    std::lock_guard l(_mutex);
+    auto& state = _tablets[tablet_id];
+    return ReadContext{tablet_id, state.generation, state.epoch};
+}
+
+bool PkRowCache::lookup(const ReadContext& ctx, const Slice& pk, int64_t version, const TabletSchemaCSPtr& schema,
+                        PkRowCacheHandle* handle) {
+    _lookup_count++;
+    auto* lru_handle = _cache->lookup(_encode_key(ctx.tablet_id, ctx.epoch, pk));
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    PkRowCacheHandle h(this, lru_handle);
+    const auto* entry = h.entry();
+    // a row cached under another schema misses the columns added or changed since then
+    if (entry->version > version || entry->schema != schema) {
+        return false;
+    }
+    _hit_count++;
+    *handle = std::move(h);
+    return true;
+}
+
+void PkRowCache::insert(const ReadContext& ctx, const Slice& pk, int64_t version, const TabletSchemaCSPtr& schema,
+                        const MutableColumns& columns, size_t row) {
+    SCOPED_PK_ROW_CACHE_MEM_TRACKER();
+    auto* entry = new PkRowCacheEntry();
+    entry->schema = schema;
+    entry->version = version;
+    entry->columns.reserve(columns.size());
+    size_t charge = pk.size;
+    for (const auto& column : columns) {
+        auto col = column->clone_empty();
+        col->append(*column, row, 1);
+        charge += col->memory_usage();
+        entry->columns.emplace_back(std::move(col));
+    }
+    auto deleter = [](const CacheKey& key, void* value) { delete reinterpret_cast<PkRowCacheEntry*>(value); };
+    auto key = _encode_key(ctx.tablet_id, ctx.epoch, pk);
+
+    std::lock_guard l(_mutex);
+    auto& state = _tablets[ctx.tablet_id];
+    if (state.generation != ctx.generation || state.running_updates > 0) {
+        delete entry;
+        return;
+    }
+    _cache->release(_cache->insert(key, entry, charge, deleter));
+}
+
+void PkRowCache::begin_update(int64_t tablet_id) {
+    if (!enabled()) {
+        return;
+    }
+    std::lock_guard l(_mutex);
+    auto& state = _tablets[tablet_id];
+    state.generation++;
+    state.running_updates++;
+}
+
+void PkRowCache::end_update(int64_t tablet_id) {
+    if (!enabled()) {
+        return;
+    }
+    std::lock_guard l(_mutex);
+    auto& state = _tablets[tablet_id];
+    DCHECK_GT(state.running_updates, 0);
+    state.generation++;
+    state.running_updates--;
+}
+
+void PkRowCache::erase(int64_t tablet_id, const Column& pks) {
+    if (!enabled()) {
+        return;
+    }
+    SCOPED_PK_ROW_CACHE_MEM_TRACKER();
+    uint64_t epoch = 0;
+    {
+        std::lock_guard l(_mutex);
+        epoch = _tablets[tablet_id].epoch;
+    }
+    for (size_t i = 0; i < pks.size(); i++) {
+        _cache->erase(_encode_key(tablet_id, epoch, pk_slice(pks, i)));
+    }
+}
+
+void PkRowCache::invalidate_tablet(int64_t tablet_id) {
+    if (!enabled()) {
+        return;
+    }
+    // The rows under the old epoch are never looked up again and age out of the cache.
+    std::lock_guard l(_mutex);
+    auto& state = _tablets[tablet_id];
+    state.generation++;
+    state.epoch++;
+}
+
+size_t PkRowCache::get_capacity() const {
+    return _cache != nullptr ? _cache->get_capacity() : 0;
+}
+
+size_t PkRowCache::get_memory_usage() const {
+    return _cache != nullptr ? _cache->get_memory_usage() : 0;
+}
+
+Slice PkRowCache::pk_slice(const Column& pks, size_t i) {
+    if (pks.is_binary()) {
+        return down_cast<const BinaryColumn&>(pks).get_slice(i);
+    }
+    size_t size = pks.type_size();
+    return {reinterpret_cast<const char*>(pks.raw_data()) + i * size, size};
+}
+
+std::string PkRowCache::_encode_key(int64_t tablet_id, uint64_t epoch, const Slice& pk) {
+    std::string key;
+    key.reserve(sizeof(tablet_id) + sizeof(epoch) + pk.size);
+    put_fixed64_le(&key, tablet_id);
+    put_fixed64_le(&key, epoch);
+    key.append(pk.data, pk.size);
+    return key;
+}
+
+void PkRowCache::_release(Cache::Handle* handle) {
+    SCOPED_PK_ROW_CACHE_MEM_TRACKER();
+    _cache->release(handle);
+}
+
+} // namespace starrocks
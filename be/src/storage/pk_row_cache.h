@@ -0,0 +1,145 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "column/vectorized_fwd.h"
+#include "gutil/macros.h"
+#include "storage/tablet_schema.h"
+#include "util/lru_cache.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+class PkRowCache;
+
+// The columns of one row cached by PkRowCache, indexed by the column ids of the tablet schema.
+struct PkRowCacheEntry {
+    TabletSchemaCSPtr schema;
+    // the version the row was read at, the row is unchanged from this version until it is erased
+    int64_t version = 0;
+    Columns columns;
+};
+
+class PkRowCacheHandle {
+public:
+    PkRowCacheHandle() = default;
+    PkRowCacheHandle(PkRowCache* cache, Cache::Handle* handle) : _cache(cache), _handle(handle) {}
+    ~PkRowCacheHandle();
+
+    PkRowCacheHandle(PkRowCacheHandle&& other) noexcept {
+        std::swap(_cache, other._cache);
+        std::swap(_handle, other._handle);
+    }
+    PkRowCacheHandle& operator=(PkRowCacheHandle&& other) noexcept {
+        std::swap(_cache, other._cache);
+        std::swap(_handle, other._handle);
+        return *this;
+    }
+
+    bool valid() const { return _handle != nullptr; }
+    const PkRowCacheEntry* entry() const;
+
+private:
+    DISALLOW_COPY(PkRowCacheHandle);
+
+    PkRowCache* _cache = nullptr;
+    Cache::Handle* _handle = nullptr;
+};
+
+// PkRowCache caches the rows of the primary key tablets read by the point queries of the short circuit path,
+// keyed by the tablet and the encoded primary key, so that the hot keys skip the primary index and the
+// segment reads. The entries are charged by their memory usage to the update mem tracker.
+//
+// A cached row stays valid until its key is written: TabletUpdates erases the upserted and deleted keys of
+// a rowset while applying it, and drops all the rows of a tablet when it can not tell the keys, e.g. for the
+// column mode partial updates. A reader snapshots the generation of the tablet before reading the primary
+// index, and its rows are only inserted if no apply started or finished since then, so a row read from an
+// older version is never inserted after the apply that changed it.
+class PkRowCache {
+public:
+    struct ReadContext {
+        int64_t tablet_id = 0;
+        uint64_t generation = 0;
+        uint64_t epoch = 0;
+    };
+
+    // The global instance with the capacity of config::pk_row_cache_capacity.
+    static PkRowCache* instance();
+
+    explicit PkRowCache(size_t capacity);
+    ~PkRowCache();
+
+    bool enabled() const { return _cache != nullptr; }
+
+    // Snapshot the state of the tablet, must be called before reading the primary index.
+    ReadContext begin_read(int64_t tablet_id);
+
+    // Returns true and sets |handle| if the row of |pk| is cached and valid at |version| for |schema|.
+    bool lookup(const ReadContext& ctx, const Slice& pk, int64_t version, const TabletSchemaCSPtr& schema,
+                PkRowCacheHandle* handle);
+
+    // Copy the |row|-th row of |columns| into the cache. |columns| holds all the columns of |schema|.
+    // Does nothing if the tablet was written since |ctx| was taken.
+    void insert(const ReadContext& ctx, const Slice& pk, int64_t version, const TabletSchemaCSPtr& schema,
+                const MutableColumns& columns, size_t row);
+
+    // An apply of the tablet is running, no rows are inserted until the matching end_update.
+    void begin_update(int64_t tablet_id);
+    void end_update(int64_t tablet_id);
+
+    // Erase the rows of the encoded primary keys |pks|.
+    void erase(int64_t tablet_id, const Column& pks);
+
+    // Drop all the rows of the tablet.
+    void invalidate_tablet(int64_t tablet_id);
+
+    size_t get_capacity() const;
+    size_t get_memory_usage() const;
+    uint64_t get_lookup_count() const { return _lookup_count; }
+    uint64_t get_hit_count() const { return _hit_count; }
+
+    // The bytes of the |i|-th key of an encoded primary key column.
+    static Slice pk_slice(const Column& pks, size_t i);
+
+private:
+    friend class PkRowCacheHandle;
+
+    struct TabletState {
+        uint64_t generation = 0;
+        // part of the cache key, bumped to drop all the rows of the tablet
+        uint64_t epoch = 0;
+        int32_t running_updates = 0;
+    };
+
+    static std::string _encode_key(int64_t tablet_id, uint64_t epoch, const Slice& pk);
+
+    void _release(Cache::Handle* handle);
+
+    std::unique_ptr<Cache> _cache;
+
+    std::mutex _mutex;
+    std::unordered_map<int64_t, TabletState> _tablets;
+
+    std::atomic<uint64_t> _lookup_count{0};
+    std::atomic<uint64_t> _hit_count{0};
+};
+
+} // namespace starrocks
@@ -16,7 +16,9 @@
 
 #include <memory>
 #include <mutex>
+#include <numeric>
 
+#include "common/config.h"
 #include "common/tracer.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
@@ -103,6 +105,20 @@ public:
 };
 
 const uint32_t PREFETCHN = 8;
+// batches smaller than this are probed in their own order even for a large index
+const uint32_t SORTED_LOOKUP_MIN_BATCH = 1024;
+
+// Sort the positions [idx_begin, idx_end) of a batch by the hashes of their keys. The slot of a key in a phmap
+// sub map is taken from the high bits of its hash, so a batch probed in this order walks the sub maps from low to
+// high slots instead of jumping randomly. The sort is stable, so the duplicated keys keep their order in the batch.
+static void sort_positions_by_hash(const std::vector<size_t>& hashes, uint32_t idx_begin,
+                                   std::vector<uint32_t>* positions) {
+    positions->resize(hashes.size());
+    std::iota(positions->begin(), positions->end(), idx_begin);
+    std::stable_sort(positions->begin(), positions->end(), [&](uint32_t a, uint32_t b) {
+        return hashes[a - idx_begin] < hashes[b - idx_begin];
+    });
+}
 
 template <typename Key>
 class HashIndexImpl : public HashIndex {
@@ -163,6 +179,29 @@ public:
                 DeletesMap* deletes) override {
         auto* keys = reinterpret_cast<const Key*>(pks.raw_data());
         uint64_t base = (((uint64_t)rssid) << 32) + rowid_start;
+        if (_use_sorted_lookup(idx_begin, idx_end)) {
+            std::vector<size_t> hashes;
+            std::vector<uint32_t> positions;
+            _sort_by_hash(keys, idx_begin, idx_end, &hashes, &positions);
+            for (uint32_t n = 0; n < positions.size(); n++) {
+                if (LIKELY(n + PREFETCHN < positions.size())) {
+                    _map.prefetch_hash(hashes[positions[n + PREFETCHN] - idx_begin]);
+                }
+                uint32_t i = positions[n];
+                RowIdPack4 v(base + i);
+                auto p = _map.emplace_with_hash(hashes[i - idx_begin], keys[i], v);
+                if (!p.second) {
+                    uint64_t old = p.first->second.value;
+                    if ((old >> 32) == rssid) {
+                        LOG(ERROR) << "found duplicate in upsert data rssid:" << rssid << " key=" << keys[i]
+                                   << " idx=" << i << " rowid=" << rowid_start + i;
+                    }
+                    (*deletes)[(uint32_t)(old >> 32)].push_back((uint32_t)(old & ROWID_MASK));
+                    p.first->second = v;
+                }
+            }
+            return;
+        }
         for (uint32_t i = idx_begin; i < idx_end; i++) {
             uint32_t prefetch_i = i + PREFETCHN;
             if (LIKELY(prefetch_i < idx_end)) _map.prefetch(keys[prefetch_i]);
@@ -231,6 +270,20 @@ public:
 
     void get(const Column& pks, uint32_t idx_begin, uint32_t idx_end, std::vector<uint64_t>* rowids) override {
         auto* keys = reinterpret_cast<const Key*>(pks.raw_data());
+        if (_use_sorted_lookup(idx_begin, idx_end)) {
+            std::vector<size_t> hashes;
+            std::vector<uint32_t> positions;
+            _sort_by_hash(keys, idx_begin, idx_end, &hashes, &positions);
+            for (uint32_t n = 0; n < positions.size(); n++) {
+                if (LIKELY(n + PREFETCHN < positions.size())) {
+                    _map.prefetch_hash(hashes[positions[n + PREFETCHN] - idx_begin]);
+                }
+                uint32_t i = positions[n];
+                auto iter = _map.find(keys[i], hashes[i - idx_begin]);
+                (*rowids)[i] = iter != _map.end() ? iter->second.value : -1;
+            }
+            return;
+        }
         for (auto i = idx_begin; i < idx_end; i++) {
             uint32_t prefetch_i = i + PREFETCHN;
             if (LIKELY(prefetch_i < idx_end)) _map.prefetch(keys[prefetch_i]);
@@ -254,6 +307,23 @@ public:
         }
         return dump->finish_pindex_kvs(dump_pb);
     }
+
+private:
+    // Only an index much larger than the cache gains from probing a batch in hash order.
+    bool _use_sorted_lookup(uint32_t idx_begin, uint32_t idx_end) const {
+        return config::primary_index_sorted_lookup_min_size > 0 &&
+               _map.size() >= static_cast<size_t>(config::primary_index_sorted_lookup_min_size) &&
+               idx_end - idx_begin >= SORTED_LOOKUP_MIN_BATCH;
+    }
+
+    void _sort_by_hash(const Key* keys, uint32_t idx_begin, uint32_t idx_end, std::vector<size_t>* hashes,
+                       std::vector<uint32_t>* positions) const {
+        hashes->resize(idx_end - idx_begin);
+        for (uint32_t i = idx_begin; i < idx_end; i++) {
+            (*hashes)[i - idx_begin] = _map.hash_function()(keys[i]);
+        }
+        sort_positions_by_hash(*hashes, idx_begin, positions);
+    }
 };
 
 template <size_t S>
@@ -0,0 +1,138 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/primary_index_warmer.h"
+
+#include <fmt/format.h>
+
+#include "common/config.h"
+#include "storage/storage_engine.h"
+#include "storage/tablet.h"
+#include "storage/tablet_manager.h"
+#include "storage/tablet_updates.h"
+#include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+PrimaryIndexWarmer::~PrimaryIndexWarmer() {
+    stop();
+}
+
+Status PrimaryIndexWarmer::init() {
+    const int max_threads =
+            std::max<int>(1, StorageEngine::instance()->get_store_num() * config::pk_index_warmup_threads_per_disk);
+    RETURN_IF_ERROR(ThreadPoolBuilder("pk_index_warmup")
+                            .set_min_threads(0)
+                            .set_max_threads(max_threads)
+                            .build(&_thread_pool));
+    REGISTER_THREAD_POOL_METRICS(pk_index_warmup, _thread_pool);
+    return Status::OK();
+}
+
+void PrimaryIndexWarmer::stop() {
+    _stopped = true;
+    if (_thread_pool != nullptr) {
+        _thread_pool->shutdown();
+    }
+}
+
+void PrimaryIndexWarmer::warm_up_recent_tablets() {
+    int64_t min_creation_time = UnixSeconds() - config::pk_index_warmup_recent_write_seconds;
+    auto tablets = StorageEngine::instance()->tablet_manager()->pick_tablets_to_warm_up_pk_index(min_creation_time);
+    LOG(INFO) << fmt::format("found {} tablets to warm up pk index", tablets.size());
+    _enqueue(std::move(tablets));
+}
+
+void PrimaryIndexWarmer::submit(const TabletSharedPtr& tablet) {
+    _enqueue({tablet});
+}
+
+void PrimaryIndexWarmer::_enqueue(std::vector<TabletSharedPtr> tablets) {
+    if (_thread_pool == nullptr || tablets.empty()) {
+        return;
+    }
+    std::vector<DataDir*> to_start;
+    {
+        std::lock_guard l(_mutex);
+        for (auto& tablet : tablets) {
+            _queues[tablet->data_dir()].push_back(std::move(tablet));
+        }
+        _total += tablets.size();
+        const int32_t max_tasks = std::max(1, config::pk_index_warmup_threads_per_disk);
+        for (auto& [data_dir, queue] : _queues) {
+            auto& running = _running_tasks[data_dir];
+            while (running < max_tasks && running < static_cast<int32_t>(queue.size())) {
+                running++;
+                to_start.push_back(data_dir);
+            }
+        }
+    }
+    for (auto* data_dir : to_start) {
+        auto st = _thread_pool->submit_func([this, data_dir]() { _run(data_dir); });
+        if (!st.ok()) {
+            LOG(WARNING) << "submit pk index warmup task failed: " << st;
+            std::lock_guard l(_mutex);
+            _running_tasks[data_dir]--;
+        }
+    }
+}
+
+// Each task loads the tablets of one disk one by one, so a disk has at most pk_index_warmup_threads_per_disk
+// indexes loading at the same time and the warmup does not take the IO of the disk from the loads.
+void PrimaryIndexWarmer::_run(DataDir* data_dir) {
+    while (!_stopped) {
+        TabletSharedPtr tablet;
+        {
+            std::lock_guard l(_mutex);
+            auto& queue = _queues[data_dir];
+            if (queue.empty()) {
+                _running_tasks[data_dir]--;
+                return;
+            }
+            tablet = std::move(queue.front());
+            queue.pop_front();
+        }
+        if (tablet->tablet_state() == TABLET_SHUTDOWN) {
+            _finished++;
+            continue;
+        }
+        auto st = tablet->updates()->load_primary_index();
+        if (st.ok()) {
+            _finished++;
+        } else {
+            _failed++;
+            LOG(WARNING) << "failed to warm up pk index of tablet " << tablet->tablet_id() << ": " << st;
+        }
+    }
+    std::lock_guard l(_mutex);
+    _running_tasks[data_dir]--;
+}
+
+PrimaryIndexWarmer::Progress PrimaryIndexWarmer::progress() const {
+    Progress progress;
+    progress.total = _total;
+    progress.finished = _finished;
+    progress.failed = _failed;
+    return progress;
+}
+
+std::string PrimaryIndexWarmer::progress_json() const {
+    auto p = progress();
+    return fmt::format(R"({{"total": {}, "finished": {}, "failed": {}, "pending": {}}})", p.total, p.finished,
+                       p.failed, p.total - p.finished - p.failed);
+}
+
+} // namespace starrocks
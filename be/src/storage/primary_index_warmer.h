@@ -0,0 +1,80 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+
+namespace starrocks {
+
+class DataDir;
+class Tablet;
+class ThreadPool;
+using TabletSharedPtr = std::shared_ptr<Tablet>;
+
+// PrimaryIndexWarmer loads the primary indexes of the recently written primary key tablets in the background,
+// so that the first writes after a BE restart or a clone do not stall on loading or rebuilding the index.
+// The tablets are loaded from the most recently written one, by at most pk_index_warmup_threads_per_disk
+// tasks per disk at the same time.
+class PrimaryIndexWarmer {
+public:
+    struct Progress {
+        int64_t total = 0;
+        int64_t finished = 0;
+        int64_t failed = 0;
+    };
+
+    PrimaryIndexWarmer() = default;
+    ~PrimaryIndexWarmer();
+
+    Status init();
+
+    void stop();
+
+    // Queue the primary key tablets written within pk_index_warmup_recent_write_seconds.
+    void warm_up_recent_tablets();
+
+    // Queue one tablet, e.g. a tablet just cloned.
+    void submit(const TabletSharedPtr& tablet);
+
+    Progress progress() const;
+
+    std::string progress_json() const;
+
+private:
+    void _enqueue(std::vector<TabletSharedPtr> tablets);
+    void _run(DataDir* data_dir);
+
+    std::unique_ptr<ThreadPool> _thread_pool;
+
+    mutable std::mutex _mutex;
+    // tablets waiting to be loaded per disk, the hottest first
+    std::unordered_map<DataDir*, std::deque<TabletSharedPtr>> _queues;
+    std::unordered_map<DataDir*, int32_t> _running_tasks;
+    std::atomic<bool> _stopped{false};
+
+    std::atomic<int64_t> _total{0};
+    std::atomic<int64_t> _finished{0};
+    std::atomic<int64_t> _failed{0};
+};
+
+} // namespace starrocks
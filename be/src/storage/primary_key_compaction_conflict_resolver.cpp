@@ -39,7 +39,8 @@ Status PrimaryKeyCompactionConflictResolver::execute() {
     RETURN_IF_ERROR(segment_iterator(
             [&](const CompactConflictResolveParams& params, const std::vector<ChunkIteratorPtr>& segment_iters,
                 const std::function<void(uint32_t, const DelVectorPtr&, uint32_t)>& handle_delvec_result_func) {
-                std::map<uint32_t, DelVectorPtr> rssid_to_delvec;
+                std::map<uint32_t, DelVectorCSPtr> rssid_to_delvec;
+                std::vector<uint8_t> deleted;
                 for (size_t segment_id = 0; segment_id < segment_iters.size(); segment_id++) {
                     // only hold pkey, so can use larger chunk size
                     auto chunk_shared_ptr = ChunkHelper::new_chunk(pkey_schema, config::vector_chunk_size);
@@ -70,12 +71,11 @@ Status PrimaryKeyCompactionConflictResolver::execute() {
                                 std::vector<uint32_t> replace_indexes;
                                 RETURN_IF_ERROR(mapper_iter.next_values(chunk->num_rows(), &rssid_rowids));
                                 DCHECK(chunk->num_rows() == rssid_rowids.size());
-                                for (int i = 0; i < rssid_rowids.size(); i++) {
+                                for (size_t i = 0; i < rssid_rowids.size();) {
                                     const uint32_t rssid = rssid_rowids[i] >> 32;
-                                    const uint32_t rowid = rssid_rowids[i] & 0xffffffff;
                                     if (rssid_to_delvec.count(rssid) == 0) {
                                         // get delvec by loader
-                                        DelVectorPtr delvec_ptr;
+                                        DelVectorCSPtr delvec_ptr;
                                         {
                                             TRACE_COUNTER_SCOPE_LATENCY_US("compaction_delvec_loader_latency_us");
                                             RETURN_IF_ERROR(params.delvec_loader->load(
@@ -83,13 +83,31 @@ Status PrimaryKeyCompactionConflictResolver::execute() {
                                         }
                                         rssid_to_delvec[rssid] = delvec_ptr;
                                     }
-                                    if (!rssid_to_delvec[rssid]->empty() &&
-                                        rssid_to_delvec[rssid]->roaring()->contains(rowid)) {
-                                        // Input row had been deleted, so we need to delete it from output rowset
-                                        tmp_deletes.push_back(current_rowid + i);
-                                    } else {
-                                        // replace pk index
-                                        replace_indexes.push_back(i);
+                                    const DelVector& delvec = *rssid_to_delvec[rssid];
+                                    // The rows of one input segment come in runs of increasing row ids, the deleted
+                                    // rows of a dense run are read into a mask at once.
+                                    size_t end = i + 1;
+                                    while (end < rssid_rowids.size() && (rssid_rowids[end] >> 32) == rssid &&
+                                           rssid_rowids[end] > rssid_rowids[end - 1]) {
+                                        end++;
+                                    }
+                                    const uint32_t first = rssid_rowids[i] & 0xffffffff;
+                                    const uint32_t last = rssid_rowids[end - 1] & 0xffffffff;
+                                    const bool use_mask = !delvec.empty() && last - first < 8 * (end - i);
+                                    if (use_mask) {
+                                        deleted.resize(last - first + 1);
+                                        delvec.fill_deleted(first, last + 1, deleted.data());
+                                    }
+                                    for (; i < end; i++) {
+                                        const uint32_t rowid = rssid_rowids[i] & 0xffffffff;
+                                        if (use_mask ? deleted[rowid - first]
+                                                     : !delvec.empty() && delvec.roaring()->contains(rowid)) {
+                                            // Input row had been deleted, so we need to delete it from output rowset
+                                            tmp_deletes.push_back(current_rowid + i);
+                                        } else {
+                                            // replace pk index
+                                            replace_indexes.push_back(i);
+                                        }
                                     }
                                 }
                                 // 6. replace pk index
@@ -502,18 +502,23 @@ void PrimaryKeyEncoder::encode(const Schema& schema, const Chunk& chunk, size_t
 
 Status PrimaryKeyEncoder::encode_sort_key(const Schema& schema, const Chunk& chunk, size_t offset, size_t len,
                                           Column* dest) {
+    return encode_sort_key(schema, schema.sort_key_idxes(), chunk, offset, len, dest);
+}
+
+Status PrimaryKeyEncoder::encode_sort_key(const Schema& schema, const std::vector<ColumnId>& sort_key_idxes,
+                                          const Chunk& chunk, size_t offset, size_t len, Column* dest) {
     RETURN_ERROR_IF_FALSE(dest->is_binary() || dest->is_large_binary());
-    int ncol = schema.sort_key_idxes().size();
+    int ncol = sort_key_idxes.size();
     std::vector<EncodeOp> ops(ncol);
     std::vector<const void*> datas(ncol);
-    prepare_ops_datas(schema, schema.sort_key_idxes(), chunk, &ops, &datas);
+    prepare_ops_datas(schema, sort_key_idxes, chunk, &ops, &datas);
     std::vector<std::shared_ptr<Column>> cols(ncol);
     for (int i = 0; i < ncol; i++) {
-        cols[i] = chunk.get_column_by_index(schema.sort_key_idxes()[i]);
+        cols[i] = chunk.get_column_by_index(sort_key_idxes[i]);
     }
     bool has_nullable_sort_key = false;
     for (int i = 0; i < ncol; i++) {
-        if (schema.field(schema.sort_key_idxes()[i])->is_nullable()) {
+        if (schema.field(sort_key_idxes[i])->is_nullable()) {
             has_nullable_sort_key = true;
             break;
         }
@@ -534,7 +539,7 @@ Status PrimaryKeyEncoder::encode_sort_key(const Schema& schema, const Chunk& chu
             for (size_t i = 0; i < len; i++) {
                 buff.clear();
                 for (int j = 0; j < ncol; j++) {
-                    if (cols[j]->is_null(i)) {
+                    if (cols[j]->is_null(offset + i)) {
                         buff.push_back(SORT_KEY_NULL_FIRST_MARKER);
                     } else {
                         buff.push_back(SORT_KEY_NORMAL_MARKER);
@@ -560,7 +565,7 @@ Status PrimaryKeyEncoder::encode_sort_key(const Schema& schema, const Chunk& chu
             for (size_t i = 0; i < len; i++) {
                 buff.clear();
                 for (int j = 0; j < ncol; j++) {
-                    if (cols[j]->is_null(i)) {
+                    if (cols[j]->is_null(offset + i)) {
                         buff.push_back(SORT_KEY_NULL_FIRST_MARKER);
                     } else {
                         buff.push_back(SORT_KEY_NORMAL_MARKER);
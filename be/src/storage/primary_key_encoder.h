@@ -63,6 +63,11 @@ public:
 
     static Status encode_sort_key(const Schema& schema, const Chunk& chunk, size_t offset, size_t len, Column* dest);
 
+    // encode the memcmp-able sort keys of the columns `sort_key_idxes` instead of the sort key columns of |schema|,
+    // with the nulls before all the other values
+    static Status encode_sort_key(const Schema& schema, const std::vector<ColumnId>& sort_key_idxes, const Chunk& chunk,
+                                  size_t offset, size_t len, Column* dest);
+
     static void encode_selective(const Schema& schema, const Chunk& chunk, const uint32_t* indexes, size_t len,
                                  Column* dest);
 
@@ -46,11 +46,17 @@ public:
     }
 
 protected:
-    Status do_get_next(Chunk* chunk) override;
+    Status do_get_next(Chunk* chunk) override { return _do_get_next(chunk); }
+    Status do_get_next(Chunk* chunk, std::vector<uint64_t>* rssid_rowids) override {
+        return _do_get_next(chunk, rssid_rowids);
+    }
 
 private:
     void build_index_map(const Schema& output, const Schema& input);
 
+    template <typename... Args>
+    Status _do_get_next(Chunk* chunk, Args&&... args);
+
     ChunkIteratorPtr _child;
     // mapping from index of column in output chunk to index of column in input chunk.
     std::vector<size_t> _index_map;
@@ -72,13 +78,14 @@ void ProjectionIterator::build_index_map(const Schema& output, const Schema& inp
     }
 }
 
-Status ProjectionIterator::do_get_next(Chunk* chunk) {
+template <typename... Args>
+Status ProjectionIterator::_do_get_next(Chunk* chunk, Args&&... args) {
     if (_chunk == nullptr) {
         DCHECK_GT(_child->output_schema().num_fields(), 0);
         _chunk = ChunkHelper::new_chunk(_child->output_schema(), _chunk_size);
     }
     _chunk->reset();
-    Status st = _child->get_next(_chunk.get());
+    Status st = _child->get_next(_chunk.get(), std::forward<Args>(args)...);
     if (st.ok()) {
         Columns& input_columns = _chunk->columns();
         for (size_t i = 0; i < _index_map.size(); i++) {
@@ -34,6 +34,8 @@ Status PublishVersionManager::init() {
     RETURN_IF_ERROR(ThreadPoolBuilder("finish_publish_version")
                             .set_min_threads(MIN_FINISH_PUBLISH_WORKER_COUNT)
                             .set_max_threads(max_thread_count)
+                            .set_work_stealing(config::enable_publish_version_work_stealing)
+                            .set_queue_time_metric(true)
                             .build(&_finish_publish_version_thread_pool));
     return Status::OK();
 }
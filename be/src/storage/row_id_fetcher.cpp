@@ -0,0 +1,114 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/row_id_fetcher.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include "column/chunk.h"
+#include "fs/fs.h"
+#include "storage/rowset/column_iterator.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+RowIdFetcher::RowIdFetcher(TabletSchemaCSPtr tablet_schema, std::vector<SegmentSharedPtr> segments,
+                           bool use_page_cache)
+        : _tablet_schema(std::move(tablet_schema)), _segments(std::move(segments)), _use_page_cache(use_page_cache) {}
+
+RowIdFetcher::~RowIdFetcher() = default;
+
+Status RowIdFetcher::fetch(const std::vector<uint64_t>& rssid_rowids, Chunk* chunk) {
+    const size_t size = rssid_rowids.size();
+    RETURN_IF(size == 0, Status::OK());
+    // The union iterator outputs the rows of one segment in ascending order for each chunk, while the merge iterator
+    // interleaves the rows of different segments, which are sorted for reading and then restored to the input order.
+    if (std::is_sorted(rssid_rowids.begin(), rssid_rowids.end())) {
+        return _fetch_sorted(rssid_rowids.data(), size, chunk);
+    }
+
+    _positions.resize(size);
+    std::iota(_positions.begin(), _positions.end(), 0);
+    std::sort(_positions.begin(), _positions.end(),
+              [&](uint32_t lhs, uint32_t rhs) { return rssid_rowids[lhs] < rssid_rowids[rhs]; });
+    _sorted_rssid_rowids.resize(size);
+    for (size_t i = 0; i < size; i++) {
+        _sorted_rssid_rowids[i] = rssid_rowids[_positions[i]];
+    }
+    auto sorted_chunk = chunk->clone_empty(size);
+    RETURN_IF_ERROR(_fetch_sorted(_sorted_rssid_rowids.data(), size, sorted_chunk.get()));
+
+    // The i-th input row is at the position of i in the sorted chunk.
+    std::vector<uint32_t> indexes(size);
+    for (size_t i = 0; i < size; i++) {
+        indexes[_positions[i]] = static_cast<uint32_t>(i);
+    }
+    chunk->append_selective(*sorted_chunk, indexes.data(), 0, static_cast<uint32_t>(size));
+    return Status::OK();
+}
+
+Status RowIdFetcher::_fetch_sorted(const uint64_t* rssid_rowids, size_t size, Chunk* chunk) {
+    size_t i = 0;
+    while (i < size) {
+        const auto rssid = static_cast<uint32_t>(rssid_rowids[i] >> 32);
+        _rowids.clear();
+        for (; i < size && static_cast<uint32_t>(rssid_rowids[i] >> 32) == rssid; i++) {
+            _rowids.push_back(static_cast<rowid_t>(rssid_rowids[i] & 0xFFFFFFFF));
+        }
+        RETURN_IF_ERROR(_fetch_segment(rssid, chunk));
+    }
+    return Status::OK();
+}
+
+Status RowIdFetcher::_fetch_segment(uint32_t rssid, Chunk* chunk) {
+    if (rssid != _rssid) {
+        RETURN_IF_ERROR(_init_iterators(rssid, *chunk->schema()));
+    }
+    DCHECK_EQ(_iterators.size(), chunk->num_columns());
+    for (size_t i = 0; i < _iterators.size(); i++) {
+        auto* column = chunk->get_column_by_index(i).get();
+        RETURN_IF_ERROR(_iterators[i]->fetch_values_by_rowid(_rowids.data(), _rowids.size(), column));
+    }
+    return Status::OK();
+}
+
+Status RowIdFetcher::_init_iterators(uint32_t rssid, const Schema& schema) {
+    if (rssid >= _segments.size()) {
+        return Status::InternalError(fmt::format("invalid rssid {} of {} segments", rssid, _segments.size()));
+    }
+    SCOPED_RAW_TIMER(&_stats.column_iterator_init_ns);
+    _rssid = UINT32_MAX;
+    _iterators.clear();
+    _read_file.reset();
+
+    const auto& segment = _segments[rssid];
+    ASSIGN_OR_RETURN(_read_file, segment->file_system()->new_random_access_file(segment->file_info()));
+    ColumnIteratorOptions iter_opts;
+    iter_opts.stats = &_stats;
+    iter_opts.use_page_cache = _use_page_cache;
+    iter_opts.read_file = _read_file.get();
+    for (const auto& field : schema.fields()) {
+        const TabletColumn& column = _tablet_schema->column(field->id());
+        ASSIGN_OR_RETURN(auto iter, segment->new_column_iterator_or_default(column, nullptr));
+        RETURN_IF_ERROR(iter->init(iter_opts));
+        _iterators.emplace_back(std::move(iter));
+    }
+    _rssid = rssid;
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "storage/olap_common.h"
+#include "storage/rowset/segment.h"
+#include "storage/tablet_schema.h"
+
+namespace starrocks {
+
+class ColumnIterator;
+class RandomAccessFile;
+
+// RowIdFetcher reads the columns of the rows identified by the row ids output by `TabletReader` with
+// `TabletReaderParams::output_row_ids`, that is `| rssid (32bit) | rowid (32bit) |`, where the rssid is the index of
+// the segment in `segments`.
+//
+// The column iterators of the last segment are kept, so fetching the consecutive chunks of the same segment does not
+// open the column readers again.
+class RowIdFetcher {
+public:
+    RowIdFetcher(TabletSchemaCSPtr tablet_schema, std::vector<SegmentSharedPtr> segments, bool use_page_cache);
+    ~RowIdFetcher();
+
+    // Appends the values of the rows `rssid_rowids` to the columns of `chunk` in the same order, where the field ids
+    // of the schema of `chunk` are the column ids in the tablet schema.
+    Status fetch(const std::vector<uint64_t>& rssid_rowids, Chunk* chunk);
+
+    const OlapReaderStatistics& stats() const { return _stats; }
+
+private:
+    Status _fetch_sorted(const uint64_t* rssid_rowids, size_t size, Chunk* chunk);
+    Status _fetch_segment(uint32_t rssid, Chunk* chunk);
+    Status _init_iterators(uint32_t rssid, const Schema& schema);
+
+    TabletSchemaCSPtr _tablet_schema;
+    std::vector<SegmentSharedPtr> _segments;
+    const bool _use_page_cache;
+    OlapReaderStatistics _stats;
+
+    // The column iterators of the segment `_rssid`.
+    uint32_t _rssid = UINT32_MAX;
+    std::unique_ptr<RandomAccessFile> _read_file;
+    std::vector<std::unique_ptr<ColumnIterator>> _iterators;
+
+    std::vector<rowid_t> _rowids;
+    std::vector<uint64_t> _sorted_rssid_rowids;
+    std::vector<uint32_t> _positions;
+};
+
+} // namespace starrocks
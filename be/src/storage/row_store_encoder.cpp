@@ -60,6 +60,17 @@ bool RowStoreEncoder::is_field_supported(const Field& f) {
     }
 }
 
+Status RowStoreEncoder::decode_columns_from_full_row_column(const Schema& schema, const BinaryColumn& full_row_column,
+                                                            const std::vector<uint32_t>& read_column_ids,
+                                                            std::vector<std::unique_ptr<Column>>* dest) {
+    std::vector<Column*> columns;
+    columns.reserve(dest->size());
+    for (auto& column : *dest) {
+        columns.emplace_back(column.get());
+    }
+    return decode_columns_from_full_row_column(schema, full_row_column, read_column_ids, columns);
+}
+
 Status RowStoreEncoder::is_supported(const Schema& schema) {
     for (size_t i = schema.num_key_fields(); i < schema.num_fields(); i++) {
         if (!is_field_supported(*(schema.field(i).get()))) {
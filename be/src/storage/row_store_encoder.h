@@ -40,9 +40,13 @@ public:
     // columns only contain value column, exclude key columns
     virtual Status encode_columns_to_full_row_column(const Schema& schema, const Columns& columns,
                                                      BinaryColumn& dest) = 0;
+    // read_column_ids are ascending value column ids of |schema|, the values are appended to |dest| in that order
     virtual Status decode_columns_from_full_row_column(const Schema& schema, const BinaryColumn& full_row_column,
                                                        const std::vector<uint32_t>& read_column_ids,
-                                                       std::vector<std::unique_ptr<Column>>* dest) = 0;
+                                                       const std::vector<Column*>& dest) = 0;
+    Status decode_columns_from_full_row_column(const Schema& schema, const BinaryColumn& full_row_column,
+                                               const std::vector<uint32_t>& read_column_ids,
+                                               std::vector<std::unique_ptr<Column>>* dest);
     Status is_supported(const Schema& schema);
 
 protected:
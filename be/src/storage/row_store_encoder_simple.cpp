@@ -106,8 +106,7 @@ Status RowStoreEncoderSimple::encode_chunk_to_full_row_column(const Schema& sche
 Status RowStoreEncoderSimple::decode_columns_from_full_row_column(const Schema& schema,
                                                                   const BinaryColumn& full_row_column,
                                                                   const std::vector<uint32_t>& read_column_ids,
-                                                                  std::vector<std::unique_ptr<Column>>* pdest) {
-    auto& dest = *pdest;
+                                                                  const std::vector<Column*>& dest) {
     int num_rows = full_row_column.size();
     for (size_t i = 0; i < num_rows; i++) {
         Slice s = full_row_column.get_slice(i);
@@ -131,7 +130,7 @@ Status RowStoreEncoderSimple::decode_columns_from_full_row_column(const Schema&
         for (uint j = num_key_cols; j <= read_column_ids.back(); j++) {
             size_t idx = j - num_key_cols;
             if (read_column_ids[cur_read_idx] == j) {
-                dest_column = dest[cur_read_idx].get();
+                dest_column = dest[cur_read_idx];
                 if (null_bitmap.contains(idx)) {
                     dest_column->append_nulls(1);
                     cur_read_idx++;
@@ -30,9 +30,10 @@ public:
     Status encode_chunk_to_full_row_column(const Schema& schema, const Chunk& chunk,
                                            BinaryColumn* dest_column) override;
     Status encode_columns_to_full_row_column(const Schema& schema, const Columns& columns, BinaryColumn& dest) override;
+    using RowStoreEncoder::decode_columns_from_full_row_column;
     Status decode_columns_from_full_row_column(const Schema& schema, const BinaryColumn& full_row_column,
                                                const std::vector<uint32_t>& read_column_ids,
-                                               std::vector<std::unique_ptr<Column>>* dest) override;
+                                               const std::vector<Column*>& dest) override;
 
 private: // -- for simple and length
     void encode_null_bitmap(BitmapValue& null_bitmap, std::string* dest);
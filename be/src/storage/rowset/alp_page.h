@@ -0,0 +1,377 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ALP (Adaptive Lossless floating-Point) page encoding for FLOAT and DOUBLE.
+//
+// Most floating point columns hold decimals of a few digits, e.g. prices or measurements, which are represented
+// exactly by `v = n * 10^f / 10^e` with a small integer n. The builder picks the exponent e and the factor f of a
+// page from a sample of its values, encodes every value as the integer `round(v * 10^e / 10^f)`, and packs the
+// integers by frame-of-reference coding. The values which are not restored bit by bit from their integers, e.g.
+// NaN, infinity, -0.0 or the values with too many digits, are stored raw as exceptions.
+//
+// The page consists of:
+//   Header
+//     num_elems (32-bit fixed)
+//     exponent (8-bit fixed)
+//     factor (8-bit fixed)
+//     num_exceptions (32-bit fixed)
+//     for_size (32-bit fixed)
+//   Integers
+//     the frame-of-reference coded integers of `for_size` bytes
+//   Exceptions
+//     the positions of the exceptions (32-bit fixed each)
+//     the raw values of the exceptions
+//
+// The whole page is decoded when the decoder is initialized.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "column/column.h"
+#include "gutil/strings/substitute.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+#include "storage/type_traits.h"
+#include "storage/types.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/frame_of_reference_coding.h"
+
+namespace starrocks {
+
+template <typename T>
+struct AlpConstants {};
+
+template <>
+struct AlpConstants<double> {
+    static constexpr uint8_t kMaxExponent = 18;
+    // The integers are kept within 2^62 so that the frame-of-reference deltas of a page never overflow.
+    static constexpr double kMaxEncoded = 4611686018427387904.0;
+};
+
+template <>
+struct AlpConstants<float> {
+    static constexpr uint8_t kMaxExponent = 10;
+    static constexpr double kMaxEncoded = 2147483648.0;
+};
+
+// The encoding and decoding of a single value with the exponent `e` and the factor `f`.
+// Both are computed in double: the powers of ten up to 10^18 are exact doubles, so `n / 10^e` is the double
+// nearest to the decimal, which is the value parsed from the decimal string in the first place.
+template <typename T>
+struct AlpCoder {
+    static constexpr double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                                        1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+
+    // Returns false if `value` can not be restored from an integer with `e` and `f`.
+    static bool encode(T value, uint8_t e, uint8_t f, int64_t* encoded) {
+        double scaled = static_cast<double>(value) * kPow10[e] / kPow10[f];
+        // also rejects NaN, for which all comparisons are false
+        if (!(std::abs(scaled) < AlpConstants<T>::kMaxEncoded)) {
+            return false;
+        }
+        *encoded = static_cast<int64_t>(std::nearbyint(scaled));
+        T restored = decode(*encoded, e, f);
+        return memcmp(&restored, &value, sizeof(T)) == 0;
+    }
+
+    static T decode(int64_t encoded, uint8_t e, uint8_t f) {
+        return static_cast<T>(static_cast<double>(encoded) * kPow10[f] / kPow10[e]);
+    }
+};
+
+template <LogicalType Type>
+class AlpPageBuilder final : public PageBuilder {
+    typedef typename TypeTraits<Type>::CppType CppType;
+    static_assert(Type == TYPE_FLOAT || Type == TYPE_DOUBLE, "unexpected field type");
+
+public:
+    static constexpr size_t kHeaderSize = 14;
+    // The number of the values sampled to pick the exponent and the factor of a page.
+    static constexpr size_t kSampleSize = 256;
+
+    explicit AlpPageBuilder(const PageBuilderOptions& options)
+            : _max_count(std::max<size_t>(1, options.data_page_size / sizeof(CppType))) {}
+
+    ~AlpPageBuilder() override = default;
+
+    bool is_page_full() override { return _values.size() >= _max_count; }
+
+    uint32_t add(const uint8_t* vals, uint32_t count) override {
+        DCHECK(!_finished);
+        uint32_t to_add = std::min<uint32_t>(_max_count - _values.size(), count);
+        const auto* new_vals = reinterpret_cast<const CppType*>(vals);
+        _values.insert(_values.end(), new_vals, new_vals + to_add);
+        return to_add;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        const auto count = static_cast<uint32_t>(_values.size());
+        uint8_t e = 0;
+        uint8_t f = 0;
+        _choose_exponent_and_factor(&e, &f);
+
+        std::vector<int64_t> encoded(count);
+        std::vector<uint32_t> exception_positions;
+        for (uint32_t i = 0; i < count; i++) {
+            if (!AlpCoder<CppType>::encode(_values[i], e, f, &encoded[i])) {
+                exception_positions.push_back(i);
+            }
+        }
+        // The slots of the exceptions take an encoded value of the page, so they do not widen the frames.
+        if (!exception_positions.empty()) {
+            // the exceptions are sorted by their positions, `first` is the first value which is not an exception
+            uint32_t first = 0;
+            while (first < exception_positions.size() && exception_positions[first] == first) {
+                first++;
+            }
+            const int64_t fill = first < count ? encoded[first] : 0;
+            for (uint32_t pos : exception_positions) {
+                encoded[pos] = fill;
+            }
+        }
+
+        faststring for_buf;
+        ForEncoder<int64_t> encoder(&for_buf);
+        encoder.put_batch(encoded.data(), count);
+        encoder.flush();
+
+        _buf.clear();
+        _buf.reserve(kHeaderSize + for_buf.size() + exception_positions.size() * (sizeof(uint32_t) + sizeof(CppType)));
+        put_fixed32_le(&_buf, count);
+        _buf.push_back(e);
+        _buf.push_back(f);
+        put_fixed32_le(&_buf, exception_positions.size());
+        put_fixed32_le(&_buf, for_buf.size());
+        _buf.append(for_buf.data(), for_buf.size());
+        for (uint32_t pos : exception_positions) {
+            put_fixed32_le(&_buf, pos);
+        }
+        for (uint32_t pos : exception_positions) {
+            _buf.append(&_values[pos], sizeof(CppType));
+        }
+        return &_buf;
+    }
+
+    void reset() override {
+        _values.clear();
+        _buf.clear();
+        _finished = false;
+    }
+
+    uint32_t count() const override { return _values.size(); }
+
+    // The raw size of the values, the page is at most that large unless most of the values are exceptions.
+    uint64_t size() const override { return _finished ? _buf.size() : _values.size() * sizeof(CppType); }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    // Picks the exponent and the factor with the smallest estimated size of the sampled values, i.e. the bits of
+    // the range of their integers plus the raw bits and the position of each exception.
+    void _choose_exponent_and_factor(uint8_t* best_e, uint8_t* best_f) const {
+        const size_t count = _values.size();
+        if (count == 0) {
+            return;
+        }
+        const size_t step = std::max<size_t>(1, count / kSampleSize);
+        uint64_t best_cost = std::numeric_limits<uint64_t>::max();
+        for (int e = AlpConstants<CppType>::kMaxExponent; e >= 0; e--) {
+            for (int f = e; f >= 0; f--) {
+                size_t exceptions = 0;
+                size_t sampled = 0;
+                int64_t min = std::numeric_limits<int64_t>::max();
+                int64_t max = std::numeric_limits<int64_t>::min();
+                for (size_t i = 0; i < count; i += step) {
+                    int64_t encoded;
+                    sampled++;
+                    if (AlpCoder<CppType>::encode(_values[i], e, f, &encoded)) {
+                        min = std::min(min, encoded);
+                        max = std::max(max, encoded);
+                    } else {
+                        exceptions++;
+                    }
+                }
+                uint64_t bit_width = 0;
+                if (min < max) {
+                    bit_width = bits_less_than_64(static_cast<uint64_t>(max) - static_cast<uint64_t>(min));
+                }
+                uint64_t cost = (sampled - exceptions) * bit_width + exceptions * (sizeof(CppType) + 4) * 8;
+                // Prefers the smaller exponent on ties, whose integers are smaller.
+                if (cost <= best_cost) {
+                    best_cost = cost;
+                    *best_e = e;
+                    *best_f = f;
+                }
+            }
+        }
+    }
+
+    const size_t _max_count;
+    std::vector<CppType> _values;
+    faststring _buf;
+    bool _finished{false};
+};
+
+template <LogicalType Type>
+class AlpPageDecoder final : public PageDecoder {
+    typedef typename TypeTraits<Type>::CppType CppType;
+    static_assert(Type == TYPE_FLOAT || Type == TYPE_DOUBLE, "unexpected field type");
+
+public:
+    explicit AlpPageDecoder(Slice data) : _data(data) {}
+
+    ~AlpPageDecoder() override = default;
+
+    [[nodiscard]] Status init() override {
+        RETURN_IF(_parsed, Status::OK());
+        if (_data.size < AlpPageBuilder<Type>::kHeaderSize) {
+            return Status::Corruption(
+                    strings::Substitute("not enough bytes for the header of the ALP page: $0", _data.size));
+        }
+        const auto* p = reinterpret_cast<const uint8_t*>(_data.data);
+        const uint32_t num_elements = decode_fixed32_le(p);
+        const uint8_t e = p[4];
+        const uint8_t f = p[5];
+        const uint32_t num_exceptions = decode_fixed32_le(p + 6);
+        const uint32_t for_size = decode_fixed32_le(p + 10);
+        p += AlpPageBuilder<Type>::kHeaderSize;
+        const size_t expected_size = AlpPageBuilder<Type>::kHeaderSize + static_cast<size_t>(for_size) +
+                                     static_cast<size_t>(num_exceptions) * (sizeof(uint32_t) + sizeof(CppType));
+        if (e > AlpConstants<CppType>::kMaxExponent || f > e || num_exceptions > num_elements ||
+            _data.size != expected_size) {
+            return Status::Corruption(strings::Substitute(
+                    "the ALP page metadata maybe broken, size: $0, num_elements: $1, exponent: $2, factor: $3, "
+                    "num_exceptions: $4, for_size: $5",
+                    _data.size, num_elements, static_cast<int>(e), static_cast<int>(f), num_exceptions, for_size));
+        }
+
+        ForDecoder<int64_t> decoder(p, for_size);
+        if (!decoder.init() || decoder.count() != num_elements) {
+            return Status::Corruption("the frame of reference block of the ALP page maybe broken");
+        }
+        std::vector<int64_t> encoded(num_elements);
+        if (num_elements > 0 && !decoder.get_batch(encoded.data(), num_elements)) {
+            return Status::Corruption("the frame of reference block of the ALP page maybe broken");
+        }
+        _values.resize(num_elements);
+        for (uint32_t i = 0; i < num_elements; i++) {
+            _values[i] = AlpCoder<CppType>::decode(encoded[i], e, f);
+        }
+        p += for_size;
+        const uint8_t* exception_values = p + num_exceptions * sizeof(uint32_t);
+        for (uint32_t i = 0; i < num_exceptions; i++) {
+            uint32_t pos = decode_fixed32_le(p + i * sizeof(uint32_t));
+            if (pos >= num_elements) {
+                return Status::Corruption(strings::Substitute("invalid exception position $0 of the ALP page", pos));
+            }
+            memcpy(&_values[pos], exception_values + i * sizeof(CppType), sizeof(CppType));
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK(_parsed) << "Must call init()";
+        DCHECK_LE(pos, _values.size());
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status seek_at_or_after_value(const void* value, bool* exact_match) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        size_t left = 0;
+        size_t right = _values.size();
+        while (left < right) {
+            size_t mid = left + (right - left) / 2;
+            if (TypeComparator<Type>::cmp(&_values[mid], value) < 0) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+        if (left >= _values.size()) {
+            return Status::NotFound("all value small than the value");
+        }
+        *exact_match = TypeComparator<Type>::cmp(&_values[left], value) == 0;
+        _cur_index = left;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(size_t* n, Column* dst) override {
+        SparseRange<> read_range;
+        uint32_t begin = current_index();
+        read_range.add(Range<>(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(_cur_index >= _values.size())) {
+            return Status::OK();
+        }
+        size_t to_read = std::min(static_cast<size_t>(range.span_size()), _values.size() - _cur_index);
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (to_read > 0) {
+            _cur_index = iter.begin();
+            Range<> r = iter.next(to_read);
+            int n = dst->append_numbers(&_values[_cur_index], r.span_size() * sizeof(CppType));
+            DCHECK_EQ(r.span_size(), n);
+            _cur_index += r.span_size();
+            to_read -= r.span_size();
+        }
+        return Status::OK();
+    }
+
+    uint32_t count() const override { return _values.size(); }
+
+    uint32_t current_index() const override { return _cur_index; }
+
+    EncodingTypePB encoding_type() const override { return ALP_ENCODING; }
+
+private:
+    Slice _data;
+    bool _parsed{false};
+    std::vector<CppType> _values;
+    size_t _cur_index{0};
+};
+
+} // namespace starrocks
@@ -17,6 +17,7 @@
 #include "common/status.h"
 #include "gutil/casts.h"
 #include "storage/rowset/column_writer.h"
+#include "storage/vector_index/vector_index_writer.h"
 
 namespace starrocks {
 
@@ -46,6 +47,8 @@ public:
 
     Status write_bloom_filter_index() override { return Status::OK(); }
 
+    Status write_vector_index() override;
+
     ordinal_t get_next_rowid() const override { return _array_size_writer->get_next_rowid(); }
 
     uint64_t total_mem_footprint() const override;
@@ -56,6 +59,7 @@ private:
     std::unique_ptr<ScalarColumnWriter> _null_writer;
     std::unique_ptr<ScalarColumnWriter> _array_size_writer;
     std::unique_ptr<ColumnWriter> _element_writer;
+    std::unique_ptr<VectorIndexWriter> _vector_index_writer;
 };
 
 StatusOr<std::unique_ptr<ColumnWriter>> create_array_column_writer(const ColumnWriterOptions& opts,
@@ -130,6 +134,10 @@ Status ArrayColumnWriter::init() {
     }
     RETURN_IF_ERROR(_array_size_writer->init());
     RETURN_IF_ERROR(_element_writer->init());
+    if (_opts.need_vector_index) {
+        ASSIGN_OR_RETURN(_vector_index_writer, VectorIndexWriter::create(_opts.tablet_index.at(VECTOR),
+                                                                         _opts.standalone_index_file_paths.at(VECTOR)));
+    }
 
     return Status::OK();
 }
@@ -156,6 +164,11 @@ Status ArrayColumnWriter::append(const Column& column) {
     // 3. writer elements column recursively
     RETURN_IF_ERROR(_element_writer->append(array_column->elements()));
 
+    // 4. collect the vectors of the vector index
+    if (_vector_index_writer != nullptr) {
+        RETURN_IF_ERROR(_vector_index_writer->append(column));
+    }
+
     return Status::OK();
 }
 
@@ -164,6 +177,9 @@ uint64_t ArrayColumnWriter::estimate_buffer_size() {
     if (is_nullable()) {
         estimate_size += _null_writer->estimate_buffer_size();
     }
+    if (_vector_index_writer != nullptr) {
+        estimate_size += _vector_index_writer->total_mem_footprint();
+    }
     return estimate_size;
 }
 
@@ -207,6 +223,14 @@ Status ArrayColumnWriter::write_ordinal_index() {
     return Status::OK();
 }
 
+Status ArrayColumnWriter::write_vector_index() {
+    if (_vector_index_writer != nullptr) {
+        RETURN_IF_ERROR(_vector_index_writer->finish());
+        _vector_index_writer.reset();
+    }
+    return Status::OK();
+}
+
 Status ArrayColumnWriter::finish_current_page() {
     if (is_nullable()) {
         RETURN_IF_ERROR(_null_writer->finish_current_page());
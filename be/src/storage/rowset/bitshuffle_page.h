@@ -48,6 +48,7 @@
 #include "storage/olap_common.h"
 #include "storage/rowset/bitshuffle_wrapper.h"
 #include "storage/rowset/common.h"
+#include "storage/rowset/encoded_predicate.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/page_builder.h"
 #include "storage/rowset/page_decoder.h"
@@ -358,6 +359,8 @@ public:
 
     [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override;
 
+    [[nodiscard]] Status evaluate(const ColumnPredicate& predicate, size_t* n, uint8_t* selection) override;
+
     uint32_t count() const override { return _num_elements; }
 
     uint32_t current_index() const override { return _cur_index; }
@@ -411,4 +414,18 @@ inline Status BitShufflePageDecoder<Type>::next_batch(const SparseRange<>& range
     return Status::OK();
 }
 
+template <LogicalType Type>
+inline Status BitShufflePageDecoder<Type>::evaluate(const ColumnPredicate& predicate, size_t* n, uint8_t* selection) {
+    DCHECK(_parsed);
+    EncodedPredicate<Type> pred;
+    if (!pred.init(predicate)) {
+        return Status::NotSupported("evaluate() not supported");
+    }
+    // The page has been un-shuffled when it is loaded, so the values are compared in place.
+    *n = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+    pred.evaluate(reinterpret_cast<const CppType*>(get_data(_cur_index * SIZE_OF_TYPE)), *n, selection);
+    _cur_index += *n;
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -74,6 +74,9 @@ struct NgramBloomFilterState {
     std::vector<Slice> ngram_set;
     // when index is case_insensitive, buffer is used to store the lower case of ngram_set
     std::string buffer;
+    // hashes of ngram_set, computed on the first page and reused for all the pages, whose bloom filters hash
+    // with the same strategy
+    std::vector<uint64_t> ngram_hashes;
 };
 
 // Base class for bloom filter
@@ -76,6 +76,9 @@ public:
 
     bool loaded() const { return invoked(_load_once); }
 
+    // REQUIRES: the index data has been successfully `load()`ed into memory.
+    const IndexedColumnReader* bloom_filter_reader() const { return _bloom_filter_reader.get(); }
+
     size_t mem_usage() const {
         size_t size = sizeof(BloomFilterIndexReader);
         if (_bloom_filter_reader != nullptr) {
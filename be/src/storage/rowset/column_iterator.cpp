@@ -36,6 +36,7 @@
 
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
+#include "storage/rowset/page_read_ahead_stream.h"
 
 namespace starrocks {
 
@@ -64,6 +65,31 @@ Status ColumnIterator::fetch_dict_codes_by_rowid(const Column& rowids, Column* v
     return fetch_dict_codes_by_rowid(p, rowids.size(), values);
 }
 
+Status ColumnIterator::init_read_ahead(const SparseRange<>& range) {
+    auto* stream = dynamic_cast<PageReadAheadStream*>(_opts.read_file);
+    auto* reader = get_column_reader();
+    if (stream == nullptr || reader == nullptr) {
+        return Status::OK();
+    }
+    std::vector<PagePointer> pages;
+    int next_page_index = 0;
+    for (size_t i = 0; i < range.size(); i++) {
+        OrdinalPageIndexIterator iter_start;
+        OrdinalPageIndexIterator iter_end;
+        RETURN_IF_ERROR(reader->seek_at_or_before(range[i].begin(), &iter_start));
+        RETURN_IF_ERROR(reader->seek_at_or_before(range[i].end() - 1, &iter_end));
+        for (int page_index = std::max(iter_start.page_index(), next_page_index); page_index <= iter_end.page_index();
+             page_index++) {
+            OrdinalPageIndexIterator iter;
+            RETURN_IF_ERROR(reader->seek_by_page_index(page_index, &iter));
+            pages.emplace_back(iter.page());
+        }
+        next_page_index = std::max(next_page_index, iter_end.page_index() + 1);
+    }
+    stream->set_pages(std::move(pages));
+    return Status::OK();
+}
+
 Status ColumnIterator::next_batch(const SparseRange<>& range, Column* dst) {
     auto iter = range.new_iterator();
     auto to_read = range.span_size();
@@ -153,6 +153,9 @@ public:
         return dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file)->set_io_ranges(result);
     }
 
+    // Sets the data pages covering |range| to be read ahead, if the column is read by PageReadAheadStream.
+    Status init_read_ahead(const SparseRange<>& range);
+
     virtual ordinal_t get_current_ordinal() const = 0;
 
     /// Store the row ranges that satisfy the given predicates into |row_ranges|.
@@ -245,6 +248,14 @@ public:
 
     Status fetch_dict_codes_by_rowid(const Column& rowids, Column* values);
 
+    // Evaluates |predicate| on the encoded pages of the rows in |range| without decoding them into a column, and
+    // sets selection[i] to whether the i-th row of |range| satisfies it. The iterator must be seeked again before
+    // the next read. Returns NotSupported if the predicate can not be evaluated on the pages of this column.
+    virtual Status evaluate_on_encoded_pages(const ColumnPredicate& predicate, const SparseRange<>& range,
+                                             uint8_t* selection) {
+        return Status::NotSupported("evaluate_on_encoded_pages() not supported");
+    }
+
     // for Struct type (Struct)
     virtual Status next_batch(size_t* n, Column* dst, ColumnAccessPath* path) { return next_batch(n, dst); }
 
@@ -36,6 +36,7 @@
 
 #include <fmt/format.h>
 
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -46,6 +47,7 @@
 #include "common/compiler_util.h"
 #include "common/logging.h"
 #include "runtime/types.h"
+#include "storage/chunk_helper.h"
 #include "storage/column_predicate.h"
 #include "storage/inverted/index_descriptor.hpp"
 #include "storage/inverted/inverted_plugin_factory.h"
@@ -342,6 +344,31 @@ Status ColumnReader::_parse_zone_map(LogicalType type, const ZoneMapPB& zm, Zone
     return Status::OK();
 }
 
+// The strings point into `value` as in datum_from_string() without a MemPool.
+static Status zone_map_datum_from_slice(TypeInfo* type_info, const Slice& value, Datum* dst) {
+    const LogicalType type = type_info->type();
+    if (type != TYPE_CHAR && type != TYPE_VARCHAR) {
+        return datum_from_string(type_info, dst, value.to_string(), nullptr);
+    }
+    // If type is TYPE_CHAR, strip its tailing '\0'
+    dst->set_slice(Slice(value.data, type == TYPE_CHAR ? strnlen(value.data, value.size) : value.size));
+    return Status::OK();
+}
+
+Status ColumnReader::_parse_page_zone_map(LogicalType type, int32_t page, ZoneMapDetail* detail) const {
+    TypeInfoPtr type_info = get_type_info(delegate_type(type));
+    detail->set_has_null(_zonemap_index->page_has_null(page));
+
+    if (_zonemap_index->page_has_not_null(page)) {
+        RETURN_IF_ERROR(
+                zone_map_datum_from_slice(type_info.get(), _zonemap_index->page_min(page), &(detail->min_value())));
+        RETURN_IF_ERROR(
+                zone_map_datum_from_slice(type_info.get(), _zonemap_index->page_max(page), &(detail->max_value())));
+    }
+    detail->set_num_rows(static_cast<size_t>(num_rows()));
+    return Status::OK();
+}
+
 template <bool is_original_bf>
 Status ColumnReader::bloom_filter(const std::vector<const ColumnPredicate*>& predicates, SparseRange<>* row_ranges,
                                   const IndexReadOptions& opts) {
@@ -363,6 +390,11 @@ Status ColumnReader::bloom_filter(const std::vector<const ColumnPredicate*>& pre
         }
     }
 
+    NgramBloomFilterReaderOptions ngram_options;
+    if constexpr (!is_original_bf) {
+        ngram_options = _get_reader_options_for_ngram();
+    }
+    int64_t filtered_pages = 0;
     for (const auto& pid : page_ids) {
         std::unique_ptr<BloomFilter> bf;
         RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, &bf));
@@ -371,13 +403,20 @@ Status ColumnReader::bloom_filter(const std::vector<const ColumnPredicate*>& pre
             if constexpr (is_original_bf) {
                 return pred->support_original_bloom_filter() && pred->original_bloom_filter(bf.get());
             } else {
-                return pred->support_ngram_bloom_filter() &&
-                       pred->ngram_bloom_filter(bf.get(), _get_reader_options_for_ngram());
+                return pred->support_ngram_bloom_filter() && pred->ngram_bloom_filter(bf.get(), ngram_options);
             }
         });
         if (satisfy) {
             bf_row_ranges.add(
                     Range<>(_ordinal_index->get_first_ordinal(pid), _ordinal_index->get_last_ordinal(pid) + 1));
+        } else {
+            filtered_pages++;
+        }
+    }
+    if constexpr (!is_original_bf) {
+        if (opts.stats != nullptr) {
+            opts.stats->ngram_bf_pages_checked += page_ids.size();
+            opts.stats->ngram_bf_pages_filtered += filtered_pages;
         }
     }
     *row_ranges = row_ranges->intersection(bf_row_ranges);
@@ -395,6 +434,31 @@ Status ColumnReader::ngram_bloom_filter(const std::vector<const ::starrocks::Col
     return bloom_filter<false>(p, ranges, opts);
 }
 
+std::optional<PagePointer> ColumnReader::bloom_filter_index_root_page() const {
+    if (_bloom_filter_index == nullptr || _bloom_filter_index->loaded()) {
+        return std::nullopt;
+    }
+    const auto& meta = _bloom_filter_index_meta->bloom_filter();
+    // The sole data page is not read by loading.
+    if (!meta.has_ordinal_index_meta() || meta.ordinal_index_meta().is_root_data_page()) {
+        return std::nullopt;
+    }
+    return PagePointer(meta.ordinal_index_meta().root_page());
+}
+
+std::vector<PagePointer> ColumnReader::bloom_filter_pages() const {
+    if (_bloom_filter_index == nullptr || !_bloom_filter_index->loaded()) {
+        return {};
+    }
+    return _bloom_filter_index->bloom_filter_reader()->data_pages();
+}
+
+Status ColumnReader::read_bloom_filter_page(const IndexReadOptions& opts, const PagePointer& pp) const {
+    DCHECK(_bloom_filter_index != nullptr && _bloom_filter_index->loaded());
+    SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
+    return _bloom_filter_index->bloom_filter_reader()->read_data_page(opts, pp);
+}
+
 Status ColumnReader::load_ordinal_index(const IndexReadOptions& opts) {
     if (_ordinal_index == nullptr || _ordinal_index->loaded()) return Status::OK();
     SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
@@ -496,6 +560,28 @@ Status ColumnReader::_load_inverted_index(const std::shared_ptr<TabletIndex>& in
             .status();
 }
 
+Status ColumnReader::load_vector_index(const std::shared_ptr<TabletIndex>& index_meta, const SegmentReadOptions& opts,
+                                       const VectorIndexReader** reader) {
+    SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
+    auto load = [&]() -> Status {
+        std::string index_path = IndexDescriptor::vector_index_file_path(opts.rowset_path, opts.rowsetid.to_string(),
+                                                                         _segment->id(), index_meta->index_id());
+        auto res = VectorIndexReader::load(index_path);
+        if (res.status().is_not_found()) {
+            // e.g. a replica cloned before the index files were copied, the segment is scanned as a whole
+            LOG(WARNING) << "Vector index file " << index_path << " is missing, read without the index";
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(res.status());
+        _vector_index = std::move(res).value();
+        _meta_mem_usage.fetch_add(_vector_index->mem_usage(), std::memory_order_relaxed);
+        return Status::OK();
+    };
+    RETURN_IF_ERROR(success_once(_vector_index_load_once, load).status());
+    *reader = _vector_index.get();
+    return Status::OK();
+}
+
 Status ColumnReader::seek_to_first(OrdinalPageIndexIterator* iter) {
     *iter = _ordinal_index->begin();
     if (!iter->valid()) {
@@ -566,12 +652,10 @@ Status ColumnReader::_zone_map_filter(const std::vector<const ColumnPredicate*>&
         }
     };
 
-    const std::vector<ZoneMapPB>& zone_maps = _zonemap_index->page_zone_maps();
     int32_t page_size = _zonemap_index->num_pages();
     for (int32_t i = 0; i < page_size; ++i) {
-        const ZoneMapPB& zm = zone_maps[i];
         ZoneMapDetail detail;
-        RETURN_IF_ERROR(_parse_zone_map(lt, zm, &detail));
+        RETURN_IF_ERROR(_parse_page_zone_map(lt, i, &detail));
 
         if (!page_satisfies_zone_map_filter(detail)) {
             continue;
@@ -585,6 +669,97 @@ Status ColumnReader::_zone_map_filter(const std::vector<const ColumnPredicate*>&
     return Status::OK();
 }
 
+Status ColumnReader::zone_map_aggregate(const std::vector<const ColumnPredicate*>& predicates,
+                                        const ColumnIteratorOptions& iter_opts, ZoneMapAggregateResult* result) {
+    if (!has_zone_map()) {
+        return Status::NotSupported("column has no page zone map");
+    }
+    // the min and max of the decoded strings would point into the column reused across the batches
+    if (is_string_type(_column_type) || is_binary_type(_column_type)) {
+        return Status::NotSupported("zone map aggregation of strings");
+    }
+    for (const auto* pred : predicates) {
+        if (pred->type_info()->type() != _column_type) {
+            return Status::NotSupported(fmt::format("predicate type {} differs from column type {}",
+                                                    logical_type_to_string(pred->type_info()->type()),
+                                                    logical_type_to_string(_column_type)));
+        }
+    }
+
+    IndexReadOptions opts;
+    opts.use_page_cache = config::enable_zonemap_index_memory_page_cache || !config::disable_storage_page_cache;
+    opts.kept_in_memory = config::enable_zonemap_index_memory_page_cache;
+    opts.lake_io_opts = iter_opts.lake_io_opts;
+    opts.read_file = iter_opts.read_file;
+    opts.stats = iter_opts.stats;
+    RETURN_IF_ERROR(_load_zonemap_index(opts));
+    // the ordinal index is loaded by the iterator, which also reads the boundary pages
+    ASSIGN_OR_RETURN(auto iter, new_iterator());
+    RETURN_IF_ERROR(iter->init(iter_opts));
+
+    TypeInfoPtr type_info = get_type_info(delegate_type(_column_type));
+    auto merge = [&](const Datum& min, const Datum& max, int64_t count) {
+        if (result->min.is_null() || type_info->cmp(min, result->min) < 0) {
+            result->min = min;
+        }
+        if (result->max.is_null() || type_info->cmp(max, result->max) > 0) {
+            result->max = max;
+        }
+        result->count += count;
+    };
+
+    ColumnPtr column = ChunkHelper::column_from_field_type(_column_type, true);
+    std::vector<uint8_t> selection;
+    const int32_t num_pages = _zonemap_index->num_pages();
+    for (int32_t page = 0; page < num_pages; page++) {
+        ZoneMapDetail detail;
+        RETURN_IF_ERROR(_parse_page_zone_map(_column_type, page, &detail));
+        if (!std::ranges::all_of(predicates, [&](const auto* pred) { return pred->zone_map_filter(detail); })) {
+            result->pruned_pages++;
+            continue;
+        }
+        const ordinal_t first = _ordinal_index->get_first_ordinal(page);
+        const ordinal_t last = _ordinal_index->get_last_ordinal(page);
+        if (!detail.has_null() && detail.has_not_null() &&
+            std::ranges::all_of(predicates, [&](const auto* pred) { return pred->zone_map_all_match(detail); })) {
+            merge(detail.min_value(), detail.max_value(), static_cast<int64_t>(last - first + 1));
+            result->covered_pages++;
+            continue;
+        }
+
+        result->decoded_pages++;
+        RETURN_IF_ERROR(iter->seek_to_ordinal(first));
+        for (ordinal_t ordinal = first; ordinal <= last;) {
+            size_t n = std::min<size_t>(last + 1 - ordinal, config::vector_chunk_size);
+            column->reset_column();
+            RETURN_IF_ERROR(iter->next_batch(&n, column.get()));
+            if (n == 0) {
+                return Status::Corruption(
+                        fmt::format("page {} ends at row {} before its last row {}", page, ordinal, last));
+            }
+            selection.assign(n, 1);
+            for (const auto* pred : predicates) {
+                RETURN_IF_ERROR(pred->evaluate_and(column.get(), selection.data(), 0, static_cast<uint16_t>(n)));
+            }
+            for (size_t i = 0; i < n; i++) {
+                if (selection[i] && !column->is_null(i)) {
+                    Datum value = column->get(i);
+                    merge(value, value, 1);
+                }
+            }
+            ordinal += n;
+        }
+    }
+    return Status::OK();
+}
+
+Status ColumnReader::segment_zone_map_detail(ZoneMapDetail* detail) const {
+    if (_segment_zone_map == nullptr) {
+        return Status::NotFound("no segment zone map");
+    }
+    return _parse_zone_map(_column_type, *_segment_zone_map, detail);
+}
+
 bool ColumnReader::segment_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates) const {
     if (_segment_zone_map == nullptr || predicates.empty()) {
         return true;
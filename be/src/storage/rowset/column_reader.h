@@ -39,7 +39,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include "column/datum.h"
 #include "column/fixed_length_column.h"
@@ -48,6 +50,7 @@
 #include "gen_cpp/segment.pb.h"
 #include "runtime/mem_pool.h"
 #include "storage/inverted/inverted_index_iterator.h"
+#include "storage/vector_index/vector_index_reader.h"
 #include "storage/predicate_tree/predicate_tree_fwd.h"
 #include "storage/range.h"
 #include "storage/rowset/bitmap_index_reader.h"
@@ -81,6 +84,19 @@ class ZoneMapPB;
 class Segment;
 struct NgramBloomFilterReaderOptions;
 
+// The result of ColumnReader::zone_map_aggregate().
+struct ZoneMapAggregateResult {
+    // the number of the non-null values satisfying the predicates
+    int64_t count = 0;
+    // the min and max of those values, null if there is none
+    Datum min;
+    Datum max;
+    // the number of the pages answered by their zone maps, pruned by them and decoded respectively
+    int64_t covered_pages = 0;
+    int64_t pruned_pages = 0;
+    int64_t decoded_pages = 0;
+};
+
 // There will be concurrent users to read the same column. So
 // we should do our best to reduce resource usage through share
 // same information, such as OrdinalPageIndex and Page data.
@@ -136,6 +152,9 @@ public:
 
     ZoneMapPB* segment_zone_map() const { return _segment_zone_map.get(); }
 
+    // Parses the segment-level zone map, NotFound if the column has none.
+    Status segment_zone_map_detail(ZoneMapDetail* detail) const;
+
     PagePointer get_dict_page_pointer() const { return _dict_page_pointer; }
     LogicalType column_type() const { return _column_type; }
     bool has_all_dict_encoded() const { return _flags & kHasAllDictEncodedMask; }
@@ -152,6 +171,14 @@ public:
                            std::unordered_set<uint32_t>* del_partial_filtered_pages, SparseRange<>* row_ranges,
                            const IndexReadOptions& opts, CompoundNodeType pred_relation);
 
+    // Compute COUNT/MIN/MAX of the non-null values satisfying all of |predicates| with the page zone maps.
+    // The pages entirely inside the predicates contribute their zone-map min/max and row counts without being
+    // decoded, the pages entirely outside them are skipped, and only the remaining boundary pages are read.
+    // The column must be of a fixed-length type and the predicates of its type. The deleted rows, if any, are not
+    // excluded.
+    Status zone_map_aggregate(const std::vector<const ::starrocks::ColumnPredicate*>& predicates,
+                              const ColumnIteratorOptions& iter_opts, ZoneMapAggregateResult* result);
+
     // segment-level zone map filter.
     // Return false to filter out this segment.
     // same as `match_condition`, used by vector engine.
@@ -173,9 +200,25 @@ public:
 
     Status load_ordinal_index(const IndexReadOptions& opts);
 
+    // Used to prefetch the bloom filter index before the bloom filter is evaluated.
+    //
+    // Returns the root page of the bloom filter index, which is read to load the index, or nullopt if there is no
+    // bloom filter index or it has been loaded.
+    std::optional<PagePointer> bloom_filter_index_root_page() const;
+    Status load_bloom_filter_index(const IndexReadOptions& opts) { return _load_bloom_filter_index(opts); }
+    // Returns all the bloom filter pages of the loaded bloom filter index.
+    std::vector<PagePointer> bloom_filter_pages() const;
+    // Reads the bloom filter page `pp`, which is kept by the page cache if `opts.use_page_cache`.
+    Status read_bloom_filter_page(const IndexReadOptions& opts, const PagePointer& pp) const;
+
     Status new_inverted_index_iterator(const std::shared_ptr<TabletIndex>& index_meta, InvertedIndexIterator** iterator,
                                        const SegmentReadOptions& opts);
 
+    // Loads the vector index of `index_meta` on the first call, the returned reader lives as long as this reader.
+    // The returned reader is nullptr if the index file does not exist.
+    Status load_vector_index(const std::shared_ptr<TabletIndex>& index_meta, const SegmentReadOptions& opts,
+                             const VectorIndexReader** reader);
+
     uint32_t num_rows() const { return _segment->num_rows(); }
 
     void print_debug_info() { _ordinal_index->print_debug_info(); }
@@ -206,6 +249,8 @@ private:
     Status _load_bloom_filter_index(const IndexReadOptions& opts);
 
     Status _parse_zone_map(LogicalType type, const ZoneMapPB& zm, ZoneMapDetail* detail) const;
+    // Same as above, for the zone map of `page` in the loaded zone map index.
+    Status _parse_page_zone_map(LogicalType type, int32_t page, ZoneMapDetail* detail) const;
 
     Status _calculate_row_ranges(const std::vector<uint32_t>& page_indexes, SparseRange<>* row_ranges);
 
@@ -242,6 +287,7 @@ private:
     std::unique_ptr<BitmapIndexReader> _bitmap_index;
     std::unique_ptr<BloomFilterIndexReader> _bloom_filter_index;
     std::unique_ptr<InvertedReader> _inverted_index;
+    std::unique_ptr<VectorIndexReader> _vector_index;
 
     std::unique_ptr<ZoneMapPB> _segment_zone_map;
 
@@ -262,6 +308,8 @@ private:
 
     // only used for inverted index load
     OnceFlag _inverted_index_load_once;
+    // only used for vector index load
+    OnceFlag _vector_index_load_once;
 };
 
 } // namespace starrocks
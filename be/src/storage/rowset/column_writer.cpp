@@ -35,6 +35,7 @@
 #include "storage/rowset/column_writer.h"
 
 #include <cstddef>
+#include <limits>
 #include <memory>
 
 #include "column/array_column.h"
@@ -377,6 +378,18 @@ Status ScalarColumnWriter::init() {
     if (!_opts.need_speculate_encoding) {
         auto st = set_encoding(_opts.meta->encoding());
         CHECK(st.ok()) << st;
+        // The dictionary encoding needs a dictionary for the whole column, and the strings are left to the
+        // speculation of StringColumnWriter.
+        if (config::enable_adaptive_page_encoding && _encoding_info->encoding() != DICT_ENCODING &&
+            !is_string_type(type_info()->type())) {
+            for (EncodingTypePB encoding : {BIT_SHUFFLE, FOR_ENCODING, DELTA_ENCODING, ALP_ENCODING}) {
+                const EncodingInfo* info = nullptr;
+                if (encoding != _encoding_info->encoding() &&
+                    EncodingInfo::get(type_info()->type(), encoding, &info).ok()) {
+                    _adaptive_encodings.push_back(info);
+                }
+            }
+        }
     }
     // create ordinal builder
     _ordinal_index_builder = std::make_unique<OrdinalIndexWriter>();
@@ -573,6 +586,55 @@ Status ScalarColumnWriter::write_inverted_index() {
     return Status::OK();
 }
 
+Status ScalarColumnWriter::_encode_page_adaptively(std::unique_ptr<PageBuilder>* builder, EncodingTypePB* encoding) {
+    const size_t field_size = type_info()->size();
+    const size_t num_values = _page_values.size() / field_size;
+    const size_t num_samples = std::min<size_t>(num_values, config::adaptive_page_encoding_sample_size);
+    PageBuilderOptions opts;
+    // large enough for the values of the page in any encoding
+    opts.data_page_size = _opts.data_page_size + _page_values.size();
+    auto create_builder = [&](const EncodingInfo* info, std::unique_ptr<PageBuilder>* out) -> Status {
+        PageBuilder* page_builder = nullptr;
+        RETURN_IF_ERROR(info->create_page_builder(opts, &page_builder));
+        out->reset(page_builder);
+        return Status::OK();
+    };
+    auto trial_size = [&](const EncodingInfo* info, size_t* size) -> Status {
+        std::unique_ptr<PageBuilder> trial;
+        RETURN_IF_ERROR(create_builder(info, &trial));
+        if (trial->add(_page_values.data(), num_samples) != num_samples) {
+            *size = std::numeric_limits<size_t>::max();
+        } else {
+            *size = trial->finish()->size();
+        }
+        return Status::OK();
+    };
+
+    // The encoding of the column is kept unless another one saves enough space to pay for a different decoder.
+    size_t column_size = 0;
+    RETURN_IF_ERROR(trial_size(_encoding_info, &column_size));
+    auto best_size = static_cast<size_t>(column_size * (1 - config::adaptive_page_encoding_min_space_saving));
+    const EncodingInfo* best = nullptr;
+    for (const EncodingInfo* info : _adaptive_encodings) {
+        size_t size = 0;
+        RETURN_IF_ERROR(trial_size(info, &size));
+        if (size < best_size) {
+            best = info;
+            best_size = size;
+        }
+    }
+    if (best == nullptr) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(create_builder(best, builder));
+    if ((*builder)->add(_page_values.data(), num_values) != num_values) {
+        builder->reset();
+        return Status::OK();
+    }
+    *encoding = best->encoding();
+    return Status::OK();
+}
+
 // write a data page into file and update ordinal index
 Status ScalarColumnWriter::_write_data_page(Page* page) {
     PagePointer pp;
@@ -596,7 +658,12 @@ Status ScalarColumnWriter::finish_current_page() {
 
     // build data page body : encoded values + [nullmap]
     std::vector<Slice> body;
-    faststring* encoded_values = _page_builder->finish();
+    std::unique_ptr<PageBuilder> adaptive_builder;
+    EncodingTypePB page_encoding = _encoding_info->encoding();
+    if (!_adaptive_encodings.empty() && _page_builder->count() > 0) {
+        RETURN_IF_ERROR(_encode_page_adaptively(&adaptive_builder, &page_encoding));
+    }
+    faststring* encoded_values = adaptive_builder != nullptr ? adaptive_builder->finish() : _page_builder->finish();
     body.emplace_back(*encoded_values);
 
     OwnedSlice nullmap;
@@ -631,6 +698,9 @@ Status ScalarColumnWriter::finish_current_page() {
         // for page format v2 or above, use the encoding type of config::null_encoding
         data_page_footer->set_null_encoding(_null_map_builder_v2->null_encoding());
     }
+    if (adaptive_builder != nullptr) {
+        data_page_footer->set_encoding(page_encoding);
+    }
     // trying to compress page body
     faststring compressed_body;
     RETURN_IF_ERROR(
@@ -673,6 +743,7 @@ Status ScalarColumnWriter::finish_current_page() {
         _null_map_builder_v2->reset();
     }
     _page_builder->reset();
+    _page_values.clear();
     _first_rowid = _next_rowid;
 
     return Status::OK();
@@ -711,7 +782,7 @@ Status ScalarColumnWriter::append_array_offsets(const Column& column) {
     while (remaining > 0) {
         bool page_full = false;
         size_t num_written = 0;
-        num_written = _page_builder->add(raw_data, remaining);
+        num_written = _add_to_page(raw_data, remaining);
         page_full = num_written < remaining;
 
         _next_rowid += num_written;
@@ -735,7 +806,7 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
         bool has_null_in_page = false;
         size_t num_written = 0;
         if (_curr_page_format == 2) {
-            num_written = _page_builder->add(data, remaining);
+            num_written = _add_to_page(data, remaining);
             page_full = num_written < remaining;
             if (_null_map_builder_v2 != nullptr) {
                 _null_map_builder_v2->add_null_flags(null_flags, num_written);
@@ -746,7 +817,7 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                 _null_map_builder_v2->set_has_null(has_null_in_page);
             }
         } else if (!has_null) {
-            num_written = _page_builder->add(data, remaining);
+            num_written = _add_to_page(data, remaining);
             page_full = num_written < remaining;
             if (_null_map_builder_v1 != nullptr) {
                 _null_map_builder_v1->add_run(false, num_written);
@@ -758,7 +829,7 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                 auto [run, is_null] = pair;
                 size_t num_add = run;
                 if (!is_null) {
-                    num_add = _page_builder->add(ptr, run);
+                    num_add = _add_to_page(ptr, run);
                     _null_map_builder_v1->add_run(false, run);
                 } else {
                     _null_map_builder_v1->add_run(true, run);
@@ -875,6 +946,9 @@ inline EncodingTypePB StringColumnWriter::speculate_string_encoding(const Binary
             size_t hash = SliceHash()(bin_col.get_slice(i));
             hash_set.insert(hash);
             if (hash_set.size() > max_card) {
+                if (config::enable_fsst_string_encoding && type_info()->type() == TYPE_VARCHAR) {
+                    return FSST_ENCODING;
+                }
                 return PLAIN_ENCODING;
             }
         }
@@ -35,6 +35,7 @@
 #pragma once
 
 #include <memory> // for unique_ptr
+#include <vector>
 
 #include "column/vectorized_fwd.h"
 #include "common/status.h"      // for Status
@@ -47,6 +48,7 @@
 #include "storage/rowset/page_pointer.h" // for PagePointer
 #include "storage/tablet_schema.h"       // for TabletColumn
 #include "util/bitmap.h"                 // for BitmapChange
+#include "util/faststring.h"
 #include "util/slice.h"                  // for OwnedSlice
 
 namespace starrocks {
@@ -73,6 +75,7 @@ struct ColumnWriterOptions {
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
     bool need_inverted_index = false;
+    bool need_vector_index = false;
     std::unordered_map<IndexType, std::string> standalone_index_file_paths;
     std::unordered_map<IndexType, TabletIndex> tablet_index;
 
@@ -132,6 +135,8 @@ public:
 
     virtual Status write_inverted_index() { return Status::OK(); }
 
+    virtual Status write_vector_index() { return Status::OK(); }
+
     virtual ordinal_t get_next_rowid() const = 0;
 
     // only invalid in the case of global_dict is not nullptr
@@ -229,6 +234,19 @@ private:
 
     Status append(const uint8_t* data, const uint8_t* null_flags, size_t count, bool has_null);
 
+    // Adds the values to _page_builder, and keeps a copy of them if the encoding of each page is chosen adaptively.
+    size_t _add_to_page(const uint8_t* data, size_t count) {
+        size_t num_written = _page_builder->add(data, count);
+        if (!_adaptive_encodings.empty()) {
+            _page_values.append(data, num_written * type_info()->size());
+        }
+        return num_written;
+    }
+
+    // Trial-encodes a sample of the current page with the encoding of the column and _adaptive_encodings.
+    // If one of _adaptive_encodings saves enough space, the whole page is added to `builder` of its `encoding`.
+    Status _encode_page_adaptively(std::unique_ptr<PageBuilder>* builder, EncodingTypePB* encoding);
+
     Status _write_data_page(Page* page);
 
     ColumnWriterOptions _opts;
@@ -247,6 +265,12 @@ private:
 
     std::unique_ptr<PageBuilder> _page_builder;
 
+    // The candidate encodings of each page other than the encoding of the column, empty if
+    // config::enable_adaptive_page_encoding is off or the column is not of a fixed-length type.
+    std::vector<const EncodingInfo*> _adaptive_encodings;
+    // The values added to _page_builder for the current page, only kept if _adaptive_encodings is not empty.
+    faststring _page_values;
+
     // Used when _opts.page_format == 1, using Run-Length encoding to build the null map.
     std::unique_ptr<NullMapRLEBuilder> _null_map_builder_v1;
 
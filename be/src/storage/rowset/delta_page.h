@@ -0,0 +1,461 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Delta page encoding for the integer, DATE and DATETIME columns.
+//
+// The values of a page are split into miniblocks of 128 values. A miniblock stores its first value as the anchor
+// and the bit packed differences of the following values, either the deltas `v[i] - v[i-1]` or, for the values
+// growing at a steady pace like timestamps, the deltas of the deltas. Each kind of differences is stored minus
+// their minimum, and the miniblock picks the kind taking fewer bits. All the arithmetic wraps around in 64 bits,
+// so any values are restored exactly.
+//
+// The page consists of:
+//   Header
+//     num_elems (32-bit fixed)
+//     min value (64-bit fixed)
+//     max value (64-bit fixed)
+//     offsets of the miniblocks, (num_elems + 127) / 128 (32-bit fixed each), relative to the first miniblock
+//   Miniblocks
+//     anchor (64-bit fixed)
+//     mode (8-bit fixed), kDelta or kDeltaOfDelta
+//     bit_width (8-bit fixed)
+//     first delta (64-bit fixed), only for kDeltaOfDelta
+//     base (64-bit fixed), the minimum of the differences
+//     the differences minus base, bit packed by BitWriter
+//
+// Seeking to a position only decodes the miniblock of the position, and the page min/max allow the decoder to
+// evaluate a predicate without decoding when no value or every value of the page satisfies it.
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "column/column.h"
+#include "gutil/strings/substitute.h"
+#include "storage/range.h"
+#include "storage/rowset/encoded_predicate.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+#include "storage/type_traits.h"
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+struct DeltaPageConstants {
+    static constexpr size_t kMiniblockSize = 128;
+    static constexpr size_t kHeaderSize = sizeof(uint32_t) + 2 * sizeof(uint64_t);
+    static constexpr uint8_t kDelta = 0;
+    static constexpr uint8_t kDeltaOfDelta = 1;
+};
+
+template <LogicalType Type>
+class DeltaPageBuilder final : public PageBuilder {
+    typedef typename TypeTraits<Type>::CppType CppType;
+    static_assert(std::is_integral_v<CppType> && sizeof(CppType) <= sizeof(int64_t), "unexpected field type");
+
+public:
+    explicit DeltaPageBuilder(const PageBuilderOptions& options)
+            : _options(options), _max_count(std::max<size_t>(1, options.data_page_size / sizeof(CppType))) {
+        reset();
+    }
+
+    ~DeltaPageBuilder() override = default;
+
+    bool is_page_full() override { return _values.size() >= _max_count; }
+
+    uint32_t add(const uint8_t* vals, uint32_t count) override {
+        DCHECK(!_finished);
+        const uint32_t to_add = std::min<size_t>(_max_count - _values.size(), count);
+        const auto* values = reinterpret_cast<const CppType*>(vals);
+        _values.insert(_values.end(), values, values + to_add);
+        return to_add;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        const size_t num_blocks = (_values.size() + DeltaPageConstants::kMiniblockSize - 1) /
+                                  DeltaPageConstants::kMiniblockSize;
+        CppType min_value = 0;
+        CppType max_value = 0;
+        if (!_values.empty()) {
+            auto [min_it, max_it] = std::minmax_element(_values.begin(), _values.end());
+            min_value = *min_it;
+            max_value = *max_it;
+        }
+        _buffer.clear();
+        put_fixed32_le(&_buffer, _values.size());
+        put_fixed64_le(&_buffer, static_cast<uint64_t>(static_cast<int64_t>(min_value)));
+        put_fixed64_le(&_buffer, static_cast<uint64_t>(static_cast<int64_t>(max_value)));
+        const size_t offsets_pos = _buffer.size();
+        _buffer.resize(offsets_pos + num_blocks * sizeof(uint32_t));
+        const size_t blocks_pos = _buffer.size();
+        for (size_t b = 0; b < num_blocks; b++) {
+            encode_fixed32_le(_buffer.data() + offsets_pos + b * sizeof(uint32_t), _buffer.size() - blocks_pos);
+            const size_t begin = b * DeltaPageConstants::kMiniblockSize;
+            const size_t n = std::min(DeltaPageConstants::kMiniblockSize, _values.size() - begin);
+            _encode_miniblock(_values.data() + begin, n);
+        }
+        _finished = true;
+        return &_buffer;
+    }
+
+    void reset() override {
+        _values.clear();
+        _values.reserve(_max_count);
+        _buffer.clear();
+        _finished = false;
+    }
+
+    uint32_t count() const override { return _values.size(); }
+
+    uint64_t size() const override { return _finished ? _buffer.size() : _values.size() * sizeof(CppType); }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    // The width of the differences minus their minimum, which are within [0, max - min] as unsigned.
+    static uint8_t _bit_width(const uint64_t* diffs, size_t n, uint64_t* base) {
+        if (n == 0) {
+            *base = 0;
+            return 0;
+        }
+        auto [min_it, max_it] = std::minmax_element(reinterpret_cast<const int64_t*>(diffs),
+                                                    reinterpret_cast<const int64_t*>(diffs) + n);
+        *base = static_cast<uint64_t>(*min_it);
+        const uint64_t range = static_cast<uint64_t>(*max_it) - *base;
+        return range == 0 ? 0 : 64 - __builtin_clzll(range);
+    }
+
+    void _encode_miniblock(const CppType* values, size_t n) {
+        uint64_t deltas[DeltaPageConstants::kMiniblockSize];
+        uint64_t dods[DeltaPageConstants::kMiniblockSize];
+        for (size_t i = 1; i < n; i++) {
+            deltas[i - 1] = static_cast<uint64_t>(static_cast<int64_t>(values[i])) -
+                            static_cast<uint64_t>(static_cast<int64_t>(values[i - 1]));
+        }
+        for (size_t i = 1; i + 1 < n; i++) {
+            dods[i - 1] = deltas[i] - deltas[i - 1];
+        }
+        uint64_t delta_base = 0;
+        const uint8_t delta_width = _bit_width(deltas, n > 1 ? n - 1 : 0, &delta_base);
+        uint64_t dod_base = 0;
+        const uint8_t dod_width = _bit_width(dods, n > 2 ? n - 2 : 0, &dod_base);
+        // The delta of deltas mode takes 64 more bits for the first delta.
+        const bool use_dod = n > 2 && (n - 2) * dod_width + 64 < (n - 1) * delta_width;
+
+        put_fixed64_le(&_buffer, static_cast<uint64_t>(static_cast<int64_t>(values[0])));
+        _buffer.push_back(use_dod ? DeltaPageConstants::kDeltaOfDelta : DeltaPageConstants::kDelta);
+        _buffer.push_back(use_dod ? dod_width : delta_width);
+        if (use_dod) {
+            put_fixed64_le(&_buffer, deltas[0]);
+        }
+        put_fixed64_le(&_buffer, use_dod ? dod_base : delta_base);
+
+        const uint64_t* diffs = use_dod ? dods : deltas;
+        const size_t num_diffs = use_dod ? n - 2 : n - 1;
+        const uint8_t width = use_dod ? dod_width : delta_width;
+        const uint64_t base = use_dod ? dod_base : delta_base;
+        if (width == 0 || num_diffs == 0) {
+            return;
+        }
+        BitWriter writer(&_packed);
+        for (size_t i = 0; i < num_diffs; i++) {
+            writer.PutValue(diffs[i] - base, width);
+        }
+        writer.Flush();
+        _buffer.append(_packed.data(), _packed.size());
+    }
+
+    PageBuilderOptions _options;
+    size_t _max_count;
+    std::vector<CppType> _values;
+    faststring _buffer;
+    faststring _packed;
+    bool _finished{false};
+};
+
+template <LogicalType Type>
+class DeltaPageDecoder final : public PageDecoder {
+    typedef typename TypeTraits<Type>::CppType CppType;
+    static_assert(std::is_integral_v<CppType> && sizeof(CppType) <= sizeof(int64_t), "unexpected field type");
+
+public:
+    explicit DeltaPageDecoder(Slice data) : _data(data) {}
+
+    ~DeltaPageDecoder() override = default;
+
+    [[nodiscard]] Status init() override {
+        RETURN_IF(_parsed, Status::OK());
+        if (_data.size < DeltaPageConstants::kHeaderSize) {
+            return Status::Corruption(
+                    strings::Substitute("not enough bytes for the header of the delta page: $0", _data.size));
+        }
+        const auto* p = reinterpret_cast<const uint8_t*>(_data.data);
+        _num_elems = decode_fixed32_le(p);
+        _min_value = static_cast<CppType>(decode_fixed64_le(p + sizeof(uint32_t)));
+        _max_value = static_cast<CppType>(decode_fixed64_le(p + sizeof(uint32_t) + sizeof(uint64_t)));
+        _num_blocks = (static_cast<size_t>(_num_elems) + DeltaPageConstants::kMiniblockSize - 1) /
+                      DeltaPageConstants::kMiniblockSize;
+        _offsets = p + DeltaPageConstants::kHeaderSize;
+        if (_data.size < DeltaPageConstants::kHeaderSize + _num_blocks * sizeof(uint32_t)) {
+            return Status::Corruption(strings::Substitute("the delta page maybe broken, size: $0, num_elems: $1",
+                                                          _data.size, _num_elems));
+        }
+        _blocks = _offsets + _num_blocks * sizeof(uint32_t);
+        _blocks_size = reinterpret_cast<const uint8_t*>(_data.data) + _data.size - _blocks;
+        uint32_t prev_offset = 0;
+        for (size_t b = 0; b < _num_blocks; b++) {
+            const uint32_t offset = _block_offset(b);
+            if (offset < prev_offset || offset > _blocks_size) {
+                return Status::Corruption(strings::Substitute("invalid offset $0 of the miniblock $1", offset, b));
+            }
+            prev_offset = offset;
+        }
+        _decoded_block = _num_blocks;
+        _parsed = true;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK(_parsed) << "Must call init()";
+        DCHECK_LE(pos, _num_elems);
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    // The values of the page are expected to be sorted, so the miniblocks are found by their anchors.
+    [[nodiscard]] Status seek_at_or_after_value(const void* value, bool* exact_match) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (_num_elems == 0) {
+            return Status::NotFound("page is empty");
+        }
+        const CppType target = *reinterpret_cast<const CppType*>(value);
+        // the first miniblock whose anchor is not less than the target
+        size_t left = 0;
+        size_t right = _num_blocks;
+        while (left < right) {
+            size_t mid = left + (right - left) / 2;
+            if (_anchor(mid) < target) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+        size_t pos = left * DeltaPageConstants::kMiniblockSize;
+        if (left > 0) {
+            // the target is between the anchors of the previous miniblock and this one
+            RETURN_IF_ERROR(_decode_block(left - 1));
+            const CppType* end = _block_values + _block_size(left - 1);
+            const CppType* it = std::lower_bound(_block_values, end, target);
+            if (it != end) {
+                pos = (left - 1) * DeltaPageConstants::kMiniblockSize + (it - _block_values);
+            }
+        }
+        if (pos >= _num_elems) {
+            return Status::NotFound("all value small than the value");
+        }
+        RETURN_IF_ERROR(_decode_block(pos / DeltaPageConstants::kMiniblockSize));
+        *exact_match = _block_values[pos % DeltaPageConstants::kMiniblockSize] == target;
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(size_t* n, Column* dst) override {
+        SparseRange<> read_range;
+        uint32_t begin = current_index();
+        read_range.add(Range<>(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(_cur_index >= _num_elems)) {
+            return Status::OK();
+        }
+        size_t to_read = std::min(static_cast<size_t>(range.span_size()), static_cast<size_t>(_num_elems - _cur_index));
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (to_read > 0) {
+            _cur_index = iter.begin();
+            Range<> r = iter.next(to_read);
+            const size_t end = _cur_index + r.span_size();
+            while (_cur_index < end) {
+                const size_t block = _cur_index / DeltaPageConstants::kMiniblockSize;
+                RETURN_IF_ERROR(_decode_block(block));
+                const size_t offset = _cur_index % DeltaPageConstants::kMiniblockSize;
+                const size_t n = std::min(end - _cur_index, _block_size(block) - offset);
+                int appended = dst->append_numbers(_block_values + offset, n * sizeof(CppType));
+                DCHECK_EQ(n, appended);
+                _cur_index += n;
+            }
+            to_read -= r.span_size();
+        }
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status evaluate(const ColumnPredicate& predicate, size_t* n, uint8_t* selection) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        EncodedPredicate<Type> pred;
+        if (!pred.init(predicate)) {
+            return Status::NotSupported("evaluate() not supported");
+        }
+        *n = std::min(*n, static_cast<size_t>(_num_elems - _cur_index));
+        if (pred.empty() || pred.hi() < _min_value || pred.lo() > _max_value) {
+            // no value of the page is within [lo, hi]
+            memset(selection, 0, *n);
+            pred.finish(*n, selection);
+            _cur_index += *n;
+            return Status::OK();
+        }
+        if (pred.lo() <= _min_value && pred.hi() >= _max_value) {
+            memset(selection, 1, *n);
+            pred.finish(*n, selection);
+            _cur_index += *n;
+            return Status::OK();
+        }
+        const size_t end = _cur_index + *n;
+        while (_cur_index < end) {
+            const size_t block = _cur_index / DeltaPageConstants::kMiniblockSize;
+            RETURN_IF_ERROR(_decode_block(block));
+            const size_t offset = _cur_index % DeltaPageConstants::kMiniblockSize;
+            const size_t count = std::min(end - _cur_index, _block_size(block) - offset);
+            pred.evaluate(_block_values + offset, count, selection);
+            selection += count;
+            _cur_index += count;
+        }
+        return Status::OK();
+    }
+
+    uint32_t count() const override { return _num_elems; }
+
+    uint32_t current_index() const override { return _cur_index; }
+
+    EncodingTypePB encoding_type() const override { return DELTA_ENCODING; }
+
+private:
+    uint32_t _block_offset(size_t block) const { return decode_fixed32_le(_offsets + block * sizeof(uint32_t)); }
+
+    size_t _block_size(size_t block) const {
+        return std::min(DeltaPageConstants::kMiniblockSize,
+                        _num_elems - block * DeltaPageConstants::kMiniblockSize);
+    }
+
+    CppType _anchor(size_t block) const {
+        return static_cast<CppType>(decode_fixed64_le(_blocks + _block_offset(block)));
+    }
+
+    // Decodes the miniblock `block` into _block_values, a no-op if it is already decoded.
+    Status _decode_block(size_t block) {
+        if (_decoded_block == block) {
+            return Status::OK();
+        }
+        const size_t n = _block_size(block);
+        const uint8_t* p = _blocks + _block_offset(block);
+        const uint8_t* end = block + 1 < _num_blocks ? _blocks + _block_offset(block + 1) : _blocks + _blocks_size;
+        constexpr size_t kFixedSize = sizeof(uint64_t) + 2;
+        if (end - p < static_cast<ptrdiff_t>(kFixedSize + sizeof(uint64_t))) {
+            return Status::Corruption(strings::Substitute("the miniblock $0 of the delta page maybe broken", block));
+        }
+        const uint64_t anchor = decode_fixed64_le(p);
+        const uint8_t mode = p[sizeof(uint64_t)];
+        const uint8_t width = p[sizeof(uint64_t) + 1];
+        p += kFixedSize;
+        uint64_t first_delta = 0;
+        if (mode == DeltaPageConstants::kDeltaOfDelta) {
+            first_delta = decode_fixed64_le(p);
+            p += sizeof(uint64_t);
+        }
+        if (end - p < static_cast<ptrdiff_t>(sizeof(uint64_t)) || mode > DeltaPageConstants::kDeltaOfDelta ||
+            width > 64 || (mode == DeltaPageConstants::kDeltaOfDelta && n < 3)) {
+            return Status::Corruption(strings::Substitute("the miniblock $0 of the delta page maybe broken", block));
+        }
+        const uint64_t base = decode_fixed64_le(p);
+        p += sizeof(uint64_t);
+
+        const size_t num_diffs = mode == DeltaPageConstants::kDelta ? n - 1 : n - 2;
+        uint64_t diffs[DeltaPageConstants::kMiniblockSize];
+        if (width == 0) {
+            std::fill(diffs, diffs + num_diffs, 0);
+        } else if (num_diffs > 0) {
+            auto [next, unpacked] = BitPacking::UnpackValues(width, p, end - p, num_diffs, diffs);
+            if (unpacked != static_cast<int64_t>(num_diffs)) {
+                return Status::Corruption(
+                        strings::Substitute("the miniblock $0 of the delta page maybe broken", block));
+            }
+        }
+        // The differences are rebased first in a loop to be vectorized, then restored by prefix sums.
+        for (size_t i = 0; i < num_diffs; i++) {
+            diffs[i] += base;
+        }
+        uint64_t value = anchor;
+        _block_values[0] = static_cast<CppType>(value);
+        if (mode == DeltaPageConstants::kDelta) {
+            for (size_t i = 0; i < num_diffs; i++) {
+                value += diffs[i];
+                _block_values[i + 1] = static_cast<CppType>(value);
+            }
+        } else {
+            uint64_t delta = first_delta;
+            value += delta;
+            _block_values[1] = static_cast<CppType>(value);
+            for (size_t i = 0; i < num_diffs; i++) {
+                delta += diffs[i];
+                value += delta;
+                _block_values[i + 2] = static_cast<CppType>(value);
+            }
+        }
+        _decoded_block = block;
+        return Status::OK();
+    }
+
+    Slice _data;
+    bool _parsed{false};
+    uint32_t _num_elems{0};
+    CppType _min_value{0};
+    CppType _max_value{0};
+    size_t _num_blocks{0};
+    const uint8_t* _offsets{nullptr};
+    const uint8_t* _blocks{nullptr};
+    size_t _blocks_size{0};
+    size_t _cur_index{0};
+    // The miniblock decoded into _block_values, _num_blocks if none.
+    size_t _decoded_block{0};
+    CppType _block_values[DeltaPageConstants::kMiniblockSize];
+};
+
+} // namespace starrocks
@@ -0,0 +1,132 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstring>
+#include <limits>
+
+#include "storage/column_predicate.h"
+#include "storage/type_traits.h"
+
+namespace starrocks {
+
+// EncodedPredicate is a comparison ColumnPredicate reduced to `lo <= value <= hi` on the storage values of `Type`,
+// or the negation of it for `!=`, which is evaluated by the page decoders on the encoded values before they are
+// decoded into a Column, e.g. on the deltas of a frame-of-reference page or on the runs of a RLE page.
+template <LogicalType Type>
+class EncodedPredicate {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    // clang-format off
+    static constexpr bool kSupported = Type == TYPE_BOOLEAN ||
+                                       Type == TYPE_TINYINT ||
+                                       Type == TYPE_SMALLINT ||
+                                       Type == TYPE_INT ||
+                                       Type == TYPE_BIGINT ||
+                                       Type == TYPE_LARGEINT ||
+                                       Type == TYPE_DATE ||
+                                       Type == TYPE_DATETIME ||
+                                       Type == TYPE_DECIMAL32 ||
+                                       Type == TYPE_DECIMAL64 ||
+                                       Type == TYPE_DECIMAL128;
+    // clang-format on
+
+    // Returns false if `predicate` can not be evaluated on the encoded values of `Type`.
+    bool init(const ColumnPredicate& predicate) {
+        if constexpr (!kSupported) {
+            return false;
+        } else {
+            if (predicate.type_info()->type() != Type || predicate.is_expr_predicate()) {
+                return false;
+            }
+            const Datum datum = predicate.value();
+            if (datum.is_null()) {
+                return false;
+            }
+            constexpr CppType kMin = std::numeric_limits<CppType>::lowest();
+            constexpr CppType kMax = std::numeric_limits<CppType>::max();
+            const auto value = datum.get<CppType>();
+            _lo = kMin;
+            _hi = kMax;
+            _negate = false;
+            _empty = false;
+            switch (predicate.type()) {
+            case PredicateType::kEQ:
+                _lo = _hi = value;
+                break;
+            case PredicateType::kNE:
+                _lo = _hi = value;
+                _negate = true;
+                break;
+            case PredicateType::kGT:
+                _empty = value == kMax;
+                _lo = _empty ? kMax : static_cast<CppType>(value + 1);
+                break;
+            case PredicateType::kGE:
+                _lo = value;
+                break;
+            case PredicateType::kLT:
+                _empty = value == kMin;
+                _hi = _empty ? kMin : static_cast<CppType>(value - 1);
+                break;
+            case PredicateType::kLE:
+                _hi = value;
+                break;
+            default:
+                return false;
+            }
+            return true;
+        }
+    }
+
+    CppType lo() const { return _lo; }
+    CppType hi() const { return _hi; }
+    // Whether no value satisfies the predicate.
+    bool empty() const { return _empty; }
+
+    bool test(CppType value) const { return ((value >= _lo) & (value <= _hi) & !_empty) != _negate; }
+
+    // Sets selection[i] to whether values[i] satisfies the predicate, the loop is branchless to be vectorized.
+    void evaluate(const CppType* values, size_t n, uint8_t* selection) const {
+        if (_empty) {
+            memset(selection, 0, n);
+            return;
+        }
+        const CppType lo = _lo;
+        const CppType hi = _hi;
+        for (size_t i = 0; i < n; i++) {
+            selection[i] = (values[i] >= lo) & (values[i] <= hi);
+        }
+        finish(n, selection);
+    }
+
+    // Applies the negation of `!=` to the results of `lo <= value <= hi`.
+    void finish(size_t n, uint8_t* selection) const {
+        if (_negate) {
+            for (size_t i = 0; i < n; i++) {
+                selection[i] ^= 1;
+            }
+        }
+    }
+
+private:
+    CppType _lo{};
+    CppType _hi{};
+    bool _negate = false;
+    bool _empty = false;
+};
+
+} // namespace starrocks
@@ -38,12 +38,15 @@
 
 #include "gutil/strings/substitute.h"
 #include "storage/olap_common.h"
+#include "storage/rowset/alp_page.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/binary_plain_page.h"
 #include "storage/rowset/binary_prefix_page.h"
 #include "storage/rowset/bitshuffle_page.h"
+#include "storage/rowset/delta_page.h"
 #include "storage/rowset/dict_page.h"
 #include "storage/rowset/frame_of_reference_page.h"
+#include "storage/rowset/fsst_page.h"
 #include "storage/rowset/plain_page.h"
 #include "storage/rowset/rle_page.h"
 
@@ -168,6 +171,44 @@ struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     }
 };
 
+template <LogicalType type, typename CppType>
+struct TypeEncodingTraits<type, ALP_ENCODING, CppType,
+                          typename std::enable_if<std::is_floating_point<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new AlpPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, PageDecoder** decoder) {
+        *decoder = new AlpPageDecoder<type>(data);
+        return Status::OK();
+    }
+};
+
+template <LogicalType type, typename CppType>
+struct TypeEncodingTraits<type, DELTA_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new DeltaPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, PageDecoder** decoder) {
+        *decoder = new DeltaPageDecoder<type>(data);
+        return Status::OK();
+    }
+};
+
+template <>
+struct TypeEncodingTraits<TYPE_VARCHAR, FSST_ENCODING, Slice> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new FsstPageBuilder(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, PageDecoder** decoder) {
+        *decoder = new FsstPageDecoder<TYPE_VARCHAR>(data);
+        return Status::OK();
+    }
+};
+
 template <LogicalType field_type, EncodingTypePB encoding_type>
 struct EncodingTraits : TypeEncodingTraits<field_type, encoding_type, typename CppTypeTraits<field_type>::CppType> {
     static const LogicalType type = field_type;
@@ -183,13 +224,25 @@ public:
     // This function is used to obtain the default encoding based on the field type, considering the following scenarios:
     // 1. If the user has enabled dictionary encoding for number types, the field supports dictionary encoding,
     //    and it is not for optimizing value seek, return DICT_ENCODING.
-    // 2. If optimization for value seek is required, retrieve the encoding method from _value_seek_encoding_map.
-    // 3. In the last scenario, directly retrieve it from _default_encoding_type_map.
+    // 2. If config::enable_alp_float_encoding is set, the float and double columns not for optimizing value seek
+    //    return ALP_ENCODING.
+    // 3. If config::enable_delta_integer_encoding is set, the integer, date and datetime columns not for optimizing
+    //    value seek return DELTA_ENCODING.
+    // 4. If optimization for value seek is required, retrieve the encoding method from _value_seek_encoding_map.
+    // 5. In the last scenario, directly retrieve it from _default_encoding_type_map.
     EncodingTypePB get_default_encoding(LogicalType type, bool optimize_value_seek) const {
         if (enable_non_string_column_dict_encoding() && numeric_types_support_dict_encoding(delegate_type(type)) &&
             !optimize_value_seek) {
             return DICT_ENCODING;
         }
+        if (config::enable_alp_float_encoding && !optimize_value_seek &&
+            (delegate_type(type) == TYPE_FLOAT || delegate_type(type) == TYPE_DOUBLE)) {
+            return ALP_ENCODING;
+        }
+        if (config::enable_delta_integer_encoding && !optimize_value_seek &&
+            _encoding_map.count(std::make_pair(delegate_type(type), DELTA_ENCODING)) > 0) {
+            return DELTA_ENCODING;
+        }
         auto& encoding_map = optimize_value_seek ? _value_seek_encoding_map : _default_encoding_type_map;
         auto it = encoding_map.find(delegate_type(type));
         if (it != encoding_map.end()) {
@@ -309,6 +362,18 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<TYPE_DATE, DICT_ENCODING>();
     _add_map<TYPE_DATETIME, DICT_ENCODING>();
     _add_map<TYPE_DECIMALV2, DICT_ENCODING>();
+
+    // Chosen by config::enable_alp_float_encoding, config::enable_delta_integer_encoding and
+    // config::enable_fsst_string_encoding, see get_default_encoding() and StringColumnWriter.
+    _add_map<TYPE_FLOAT, ALP_ENCODING>();
+    _add_map<TYPE_DOUBLE, ALP_ENCODING>();
+    _add_map<TYPE_TINYINT, DELTA_ENCODING>();
+    _add_map<TYPE_SMALLINT, DELTA_ENCODING>();
+    _add_map<TYPE_INT, DELTA_ENCODING>();
+    _add_map<TYPE_BIGINT, DELTA_ENCODING>();
+    _add_map<TYPE_DATE, DELTA_ENCODING>();
+    _add_map<TYPE_DATETIME, DELTA_ENCODING>();
+    _add_map<TYPE_VARCHAR, FSST_ENCODING>();
 }
 
 EncodingInfoResolver::~EncodingInfoResolver() {
@@ -35,6 +35,7 @@
 #pragma once
 
 #include "column/column.h"
+#include "storage/rowset/encoded_predicate.h"
 #include "storage/rowset/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "storage/rowset/page_builder.h" // for PageBuilder
 #include "storage/rowset/page_decoder.h" // for PageDecoder
@@ -204,6 +205,27 @@ public:
         return Status::OK();
     }
 
+    [[nodiscard]] Status evaluate(const ColumnPredicate& predicate, size_t* n, uint8_t* selection) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        EncodedPredicate<Type> pred;
+        if (!pred.init(predicate)) {
+            return Status::NotSupported("evaluate() not supported");
+        }
+        *n = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        if (PREDICT_FALSE(*n == 0)) {
+            return Status::OK();
+        }
+        bool res = _decoder.evaluate_range(pred.lo(), pred.hi(), *n, selection);
+        DCHECK(res);
+        if (PREDICT_FALSE(pred.empty())) {
+            // e.g. `> max`, the values are evaluated only to move the decoder forwards.
+            memset(selection, 0, *n);
+        }
+        pred.finish(*n, selection);
+        _cur_index += *n;
+        return Status::OK();
+    }
+
     uint32_t count() const override { return _num_elements; }
 
     uint32_t current_index() const override { return _cur_index; }
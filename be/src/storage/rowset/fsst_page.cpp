@@ -0,0 +1,233 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/fsst_page.h"
+
+#include <cstring>
+
+#include "column/binary_column.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "gutil/casts.h"
+#include "gutil/strings/substitute.h"
+#include "storage/column_predicate.h"
+
+namespace starrocks {
+
+static constexpr size_t kFsstPageTrailerSize = 2 * sizeof(uint32_t);
+
+FsstPageBuilder::FsstPageBuilder(const PageBuilderOptions& options) : _options(options) {
+    reset();
+}
+
+uint32_t FsstPageBuilder::add(const uint8_t* vals, uint32_t count) {
+    DCHECK(!_finished);
+    const auto* slices = reinterpret_cast<const Slice*>(vals);
+    for (uint32_t i = 0; i < count; i++) {
+        if (is_page_full()) {
+            return i;
+        }
+        _raw_offsets.push_back(_raw.size());
+        _raw.append(slices[i].data, slices[i].size);
+        _raw_size += slices[i].size + sizeof(uint32_t);
+    }
+    return count;
+}
+
+Slice FsstPageBuilder::_raw_value(size_t idx) const {
+    size_t end = idx + 1 < _raw_offsets.size() ? _raw_offsets[idx + 1] : _raw.size();
+    return {reinterpret_cast<const char*>(_raw.data()) + _raw_offsets[idx], end - _raw_offsets[idx]};
+}
+
+faststring* FsstPageBuilder::finish() {
+    DCHECK(!_finished);
+    const size_t num_elems = _raw_offsets.size();
+    // Samples the strings evenly over the page.
+    std::vector<Slice> sample;
+    const size_t step = std::max<size_t>(1, _raw.size() / FsstSymbolTable::kSampleBytes);
+    for (size_t i = 0; i < num_elems; i += step) {
+        sample.emplace_back(_raw_value(i));
+    }
+    FsstSymbolTable table;
+    table.build(sample);
+
+    _buffer.clear();
+    _buffer.reserve(_raw_size + kFsstPageTrailerSize);
+    table.serialize(&_buffer);
+    const size_t table_size = _buffer.size();
+    std::vector<uint32_t> offsets;
+    offsets.reserve(num_elems + 1);
+    for (size_t i = 0; i < num_elems; i++) {
+        offsets.push_back(_buffer.size() - table_size);
+        table.compress(_raw_value(i), &_buffer);
+    }
+    offsets.push_back(_buffer.size() - table_size);
+    for (uint32_t offset : offsets) {
+        put_fixed32_le(&_buffer, offset);
+    }
+    put_fixed32_le(&_buffer, table_size);
+    put_fixed32_le(&_buffer, num_elems);
+
+    if (num_elems > 0) {
+        Slice first = _raw_value(0);
+        Slice last = _raw_value(num_elems - 1);
+        _first_value.assign_copy(reinterpret_cast<const uint8_t*>(first.data), first.size);
+        _last_value.assign_copy(reinterpret_cast<const uint8_t*>(last.data), last.size);
+    }
+    _finished = true;
+    return &_buffer;
+}
+
+void FsstPageBuilder::reset() {
+    _raw.clear();
+    _raw_offsets.clear();
+    _raw_size = 0;
+    _buffer.clear();
+    _finished = false;
+}
+
+Status FsstPageBuilder::get_first_value(void* value) const {
+    DCHECK(_finished);
+    if (_raw_offsets.empty()) {
+        return Status::NotFound("page is empty");
+    }
+    *reinterpret_cast<Slice*>(value) = Slice(_first_value);
+    return Status::OK();
+}
+
+Status FsstPageBuilder::get_last_value(void* value) const {
+    DCHECK(_finished);
+    if (_raw_offsets.empty()) {
+        return Status::NotFound("page is empty");
+    }
+    *reinterpret_cast<Slice*>(value) = Slice(_last_value);
+    return Status::OK();
+}
+
+template <LogicalType Type>
+Status FsstPageDecoder<Type>::init() {
+    RETURN_IF(_parsed, Status::OK());
+    if (_data.size < kFsstPageTrailerSize) {
+        return Status::Corruption(
+                strings::Substitute("not enough bytes for the trailer of the FSST page: $0", _data.size));
+    }
+    const auto* end = reinterpret_cast<const uint8_t*>(_data.data) + _data.size;
+    const uint32_t num_elems = decode_fixed32_le(end - sizeof(uint32_t));
+    const uint32_t table_size = decode_fixed32_le(end - kFsstPageTrailerSize);
+    const size_t offsets_size = (static_cast<size_t>(num_elems) + 1) * sizeof(uint32_t);
+    if (_data.size < kFsstPageTrailerSize + offsets_size + table_size) {
+        return Status::Corruption(strings::Substitute("the FSST page maybe broken, size: $0, num_elems: $1, table: $2",
+                                                      _data.size, num_elems, table_size));
+    }
+    size_t consumed = 0;
+    if (!_table.deserialize(Slice(_data.data, table_size), &consumed) || consumed != table_size) {
+        return Status::Corruption("the symbol table of the FSST page maybe broken");
+    }
+    _num_elems = num_elems;
+    _strings = reinterpret_cast<const uint8_t*>(_data.data) + table_size;
+    _offsets = end - kFsstPageTrailerSize - offsets_size;
+    if (_strings + _offset(_num_elems) != _offsets) {
+        return Status::Corruption("the offsets of the FSST page maybe broken");
+    }
+    _parsed = true;
+    return Status::OK();
+}
+
+template <LogicalType Type>
+Status FsstPageDecoder<Type>::next_batch(size_t* count, Column* dst) {
+    SparseRange<> read_range;
+    uint32_t begin = current_index();
+    read_range.add(Range<>(begin, begin + *count));
+    RETURN_IF_ERROR(next_batch(read_range, dst));
+    *count = current_index() - begin;
+    return Status::OK();
+}
+
+template <LogicalType Type>
+Status FsstPageDecoder<Type>::next_batch(const SparseRange<>& range, Column* dst) {
+    DCHECK(_parsed);
+    if (PREDICT_FALSE(_cur_idx >= _num_elems)) {
+        return Status::OK();
+    }
+    size_t to_read = std::min(range.span_size(), _num_elems - _cur_idx);
+    SparseRangeIterator<> iter = range.new_iterator();
+    while (to_read > 0) {
+        _cur_idx = iter.begin();
+        Range<> r = iter.next(to_read);
+        size_t end = _cur_idx + r.span_size();
+        _append_range(_cur_idx, end, dst);
+        to_read -= r.span_size();
+        _cur_idx = end;
+    }
+    return Status::OK();
+}
+
+template <LogicalType Type>
+void FsstPageDecoder<Type>::_append_range(uint32_t idx, uint32_t end, Column* dst) const {
+    auto* data_column = down_cast<BinaryColumn*>(ColumnHelper::get_data_column(dst));
+    auto& bytes = data_column->get_bytes();
+    auto& offsets = data_column->get_offset();
+    DCHECK_GE(offsets.size(), 1);
+
+    // The strings are decompressed in place into the bytes of the column, which are reserved for the longest
+    // possible strings and shrunk to the actual size afterwards.
+    const uint32_t begin_offset = _offset(idx);
+    const size_t old_bytes_size = bytes.size();
+    bytes.resize(old_bytes_size + FsstSymbolTable::max_decompressed_size(_offset(end) - begin_offset));
+    uint8_t* out = bytes.data() + old_bytes_size;
+    offsets.reserve(offsets.size() + end - idx);
+    for (uint32_t i = idx; i < end; i++) {
+        const uint32_t offset = _offset(i);
+        out += _table.decompress(_strings + offset, _offset(i + 1) - offset, out);
+        offsets.push_back(static_cast<uint32_t>(out - bytes.data()));
+    }
+    bytes.resize(out - bytes.data());
+
+    if (dst->is_nullable()) {
+        auto& null_data = down_cast<NullableColumn*>(dst)->null_column_data();
+        null_data.resize(null_data.size() + end - idx, 0);
+    }
+#ifndef NDEBUG
+    dst->check_or_die();
+#endif
+}
+
+template <LogicalType Type>
+Status FsstPageDecoder<Type>::evaluate(const ColumnPredicate& predicate, size_t* n, uint8_t* selection) {
+    DCHECK(_parsed);
+    if (predicate.type_info()->type() != Type || predicate.is_expr_predicate() ||
+        (predicate.type() != PredicateType::kEQ && predicate.type() != PredicateType::kNE)) {
+        return Status::NotSupported("evaluate() not supported");
+    }
+    const Datum datum = predicate.value();
+    if (datum.is_null()) {
+        return Status::NotSupported("evaluate() not supported");
+    }
+    faststring target;
+    _table.compress(datum.get_slice(), &target);
+
+    *n = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+    const uint8_t negate = predicate.type() == PredicateType::kNE;
+    for (size_t i = 0; i < *n; i++) {
+        const uint32_t offset = _offset(_cur_idx + i);
+        const uint32_t size = _offset(_cur_idx + i + 1) - offset;
+        selection[i] = (size == target.size() && memcmp(_strings + offset, target.data(), size) == 0) ^ negate;
+    }
+    _cur_idx += *n;
+    return Status::OK();
+}
+
+template class FsstPageDecoder<TYPE_VARCHAR>;
+
+} // namespace starrocks
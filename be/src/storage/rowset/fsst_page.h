@@ -0,0 +1,131 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// FSST page encoding for strings, see util/fsst.h.
+//
+// The strings of a page are compressed one by one with a symbol table built from a sample of the page, so each
+// string is decompressed on its own, and the equality predicates are evaluated on the compressed strings.
+//
+// The page consists of:
+//   Symbol table
+//   Compressed strings
+//   Trailer
+//     offsets of the compressed strings, num_elems + 1 (32-bit fixed each), relative to the first string
+//     symbol_table_size (32-bit fixed)
+//     num_elems (32-bit fixed)
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storage/range.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/fsst.h"
+
+namespace starrocks {
+
+class Column;
+
+class FsstPageBuilder final : public PageBuilder {
+public:
+    explicit FsstPageBuilder(const PageBuilderOptions& options);
+
+    bool is_page_full() override {
+        // data_page_size is 0, do not limit the page size
+        return (_options.data_page_size != 0) & (_raw_size > _options.data_page_size);
+    }
+
+    uint32_t add(const uint8_t* vals, uint32_t count) override;
+
+    faststring* finish() override;
+
+    void reset() override;
+
+    uint32_t count() const override { return _raw_offsets.size(); }
+
+    // The raw size of the strings, the page is smaller unless the strings can not be compressed.
+    uint64_t size() const override { return _finished ? _buffer.size() : _raw_size; }
+
+    Status get_first_value(void* value) const override;
+
+    Status get_last_value(void* value) const override;
+
+private:
+    Slice _raw_value(size_t idx) const;
+
+    PageBuilderOptions _options;
+    // The raw strings are buffered until finish(), which builds the symbol table from them.
+    faststring _raw;
+    std::vector<uint32_t> _raw_offsets;
+    size_t _raw_size{0};
+    faststring _buffer;
+    faststring _first_value;
+    faststring _last_value;
+    bool _finished{false};
+};
+
+template <LogicalType Type>
+class FsstPageDecoder final : public PageDecoder {
+public:
+    explicit FsstPageDecoder(Slice data) : _data(data) {}
+
+    [[nodiscard]] Status init() override;
+
+    [[nodiscard]] Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK_LE(pos, _num_elems);
+        _cur_idx = pos;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(size_t* count, Column* dst) override;
+
+    [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override;
+
+    // Evaluates `=` and `!=` by comparing the compressed strings with the compressed value of the predicate.
+    [[nodiscard]] Status evaluate(const ColumnPredicate& predicate, size_t* n, uint8_t* selection) override;
+
+    uint32_t count() const override {
+        DCHECK(_parsed);
+        return _num_elems;
+    }
+
+    uint32_t current_index() const override {
+        DCHECK(_parsed);
+        return _cur_idx;
+    }
+
+    EncodingTypePB encoding_type() const override { return FSST_ENCODING; }
+
+private:
+    // Appends the decompressed strings [idx, end) to `dst`.
+    void _append_range(uint32_t idx, uint32_t end, Column* dst) const;
+
+    uint32_t _offset(uint32_t idx) const { return decode_fixed32_le(_offsets + idx * sizeof(uint32_t)); }
+
+    Slice _data;
+    bool _parsed{false};
+    FsstSymbolTable _table;
+    const uint8_t* _strings{nullptr};
+    const uint8_t* _offsets{nullptr};
+    uint32_t _num_elems{0};
+    // Index of the currently seeked element in the page.
+    uint32_t _cur_idx{0};
+};
+
+} // namespace starrocks
@@ -0,0 +1,210 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/index_prefetcher.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "fs/fs.h"
+#include "io/io_profiler.h"
+#include "io/shared_buffered_input_stream.h"
+#include "runtime/exec_env.h"
+#include "storage/column_predicate.h"
+#include "storage/predicate_tree/predicate_tree.hpp"
+#include "storage/rowset/column_reader.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "util/runtime_profile.h"
+#include "util/threadpool.h"
+
+namespace starrocks {
+
+namespace {
+
+struct BloomFilterColumnCollector {
+    void operator()(const PredicateColumnNode& node) const {
+        const auto* col_pred = node.col_pred();
+        if (col_pred != nullptr &&
+            (col_pred->support_original_bloom_filter() || col_pred->support_ngram_bloom_filter())) {
+            cids.push_back(col_pred->column_id());
+        }
+    }
+
+    template <CompoundNodeType Type>
+    void operator()(const PredicateCompoundNode<Type>& node) const {
+        for (const auto& child : node.children()) {
+            child.visit(*this);
+        }
+    }
+
+    std::vector<ColumnId>& cids;
+};
+
+StatusOr<std::unique_ptr<io::SharedBufferedInputStream>> new_coalesced_stream(
+        Segment* segment, const std::shared_ptr<io::SeekableInputStream>& stream) {
+    ASSIGN_OR_RETURN(auto file_size, segment->get_data_size());
+    auto input = std::make_unique<io::SharedBufferedInputStream>(stream, segment->file_name(), file_size);
+    input->set_coalesce_options(io::SharedBufferedInputStream::CoalesceOptions{
+            .max_dist_size = config::io_coalesce_read_max_distance_size,
+            .max_buffer_size = config::io_coalesce_read_max_buffer_size});
+    return input;
+}
+
+void update_io_stats(const io::SharedBufferedInputStream& input, OlapReaderStatistics* stats) {
+    stats->index_prefetch_io_count += input.shared_io_count() + input.direct_io_count();
+    stats->index_prefetch_io_bytes += input.shared_io_bytes() + input.direct_io_bytes();
+}
+
+} // namespace
+
+void IndexPrefetcher::Task::wait(OlapReaderStatistics* stats) {
+    if (_waited) {
+        return;
+    }
+    _waited = true;
+    if (!_started.exchange(true)) {
+        return;
+    }
+    {
+        SCOPED_RAW_TIMER(&stats->index_prefetch_wait_ns);
+        _future.wait();
+    }
+    stats->total_pages_num += _stats.total_pages_num;
+    stats->cached_pages_num += _stats.cached_pages_num;
+    stats->pages_from_local_disk += _stats.pages_from_local_disk;
+    stats->io_ns += _stats.io_ns;
+    stats->decompress_ns += _stats.decompress_ns;
+    stats->compressed_bytes_read_request += _stats.compressed_bytes_read_request;
+    stats->io_count_request += _stats.io_count_request;
+    stats->uncompressed_bytes_read += _stats.uncompressed_bytes_read;
+    stats->index_prefetch_io_count += _stats.index_prefetch_io_count;
+    stats->index_prefetch_io_bytes += _stats.index_prefetch_io_bytes;
+}
+
+std::vector<ColumnUID> IndexPrefetcher::bloom_filter_columns(const PredicateTree& pred_tree,
+                                                             const TabletSchema& schema) {
+    std::vector<ColumnId> cids;
+    pred_tree.root().visit(BloomFilterColumnCollector{cids});
+    std::sort(cids.begin(), cids.end());
+    cids.erase(std::unique(cids.begin(), cids.end()), cids.end());
+
+    std::vector<ColumnUID> uids;
+    uids.reserve(cids.size());
+    for (auto cid : cids) {
+        if (cid < schema.num_columns()) {
+            uids.push_back(schema.column(cid).unique_id());
+        }
+    }
+    return uids;
+}
+
+IndexPrefetcher::TaskPtr IndexPrefetcher::submit(std::shared_ptr<Segment> segment,
+                                                 const std::vector<ColumnUID>& column_uids,
+                                                 const SegmentReadOptions& opts) {
+    RETURN_IF(column_uids.empty(), nullptr);
+    auto* pool = ExecEnv::GetInstance()->index_prefetch_thread_pool();
+    RETURN_IF(pool == nullptr, nullptr);
+    const bool need_prefetch = std::any_of(column_uids.begin(), column_uids.end(), [&](ColumnUID uid) {
+        const auto* reader = segment->column_with_uid(uid);
+        return reader != nullptr && reader->has_bloom_filter_index();
+    });
+    RETURN_IF(!need_prefetch, nullptr);
+
+    // Only the options used by `prefetch()` are kept by the task.
+    SegmentReadOptions prefetch_opts;
+    prefetch_opts.fs = opts.fs;
+    prefetch_opts.tablet_id = opts.tablet_id;
+    prefetch_opts.lake_io_opts = opts.lake_io_opts;
+
+    auto task = std::make_shared<Task>();
+    auto st = pool->submit_func([weak_task = std::weak_ptr<Task>(task), segment = std::move(segment), column_uids,
+                                 opts = std::move(prefetch_opts)]() {
+        auto task = weak_task.lock();
+        // The scan has finished or the segment iterator has not waited for it.
+        if (task == nullptr || task->_started.exchange(true)) {
+            return;
+        }
+        auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, opts.tablet_id);
+        auto st = prefetch(segment.get(), column_uids, opts, &task->_stats);
+        LOG_IF(WARNING, !st.ok()) << "Failed to prefetch the bloom filter indexes of " << segment->file_name()
+                                  << ": " << st;
+        task->_promise.set_value();
+    });
+    RETURN_IF(!st.ok(), nullptr);
+    return task;
+}
+
+Status IndexPrefetcher::prefetch(Segment* segment, const std::vector<ColumnUID>& column_uids,
+                                 const SegmentReadOptions& opts, OlapReaderStatistics* stats) {
+    std::vector<ColumnReader*> readers;
+    for (auto uid : column_uids) {
+        auto* reader = segment->column_with_uid(uid);
+        if (reader != nullptr && reader->has_bloom_filter_index()) {
+            readers.push_back(reader);
+        }
+    }
+    RETURN_IF(readers.empty(), Status::OK());
+
+    RandomAccessFileOptions file_opts{.skip_fill_local_cache = !opts.lake_io_opts.fill_data_cache,
+                                      .buffer_size = opts.lake_io_opts.buffer_size};
+    ASSIGN_OR_RETURN(auto rfile, opts.fs->new_random_access_file(file_opts, segment->file_info()));
+
+    IndexReadOptions index_opts;
+    index_opts.use_page_cache = !config::disable_storage_page_cache;
+    index_opts.kept_in_memory = false;
+    index_opts.lake_io_opts = opts.lake_io_opts;
+    index_opts.stats = stats;
+
+    // Load the index pages of the bloom filter indexes.
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    for (auto* reader : readers) {
+        if (auto pp = reader->bloom_filter_index_root_page(); pp.has_value()) {
+            ranges.emplace_back(pp->offset, pp->size);
+        }
+    }
+    {
+        ASSIGN_OR_RETURN(auto input, new_coalesced_stream(segment, rfile->stream()));
+        if (!ranges.empty()) {
+            RETURN_IF_ERROR(input->set_io_ranges(ranges));
+        }
+        index_opts.read_file = input.get();
+        for (auto* reader : readers) {
+            RETURN_IF_ERROR(reader->load_bloom_filter_index(index_opts));
+        }
+        update_io_stats(*input, stats);
+    }
+
+    // The bloom filter pages read without the page cache would be dropped at once.
+    RETURN_IF(!index_opts.use_page_cache, Status::OK());
+    ranges.clear();
+    std::vector<std::pair<ColumnReader*, PagePointer>> pages;
+    for (auto* reader : readers) {
+        for (const auto& pp : reader->bloom_filter_pages()) {
+            ranges.emplace_back(pp.offset, pp.size);
+            pages.emplace_back(reader, pp);
+        }
+    }
+    RETURN_IF(pages.empty(), Status::OK());
+    ASSIGN_OR_RETURN(auto input, new_coalesced_stream(segment, rfile->stream()));
+    RETURN_IF_ERROR(input->set_io_ranges(ranges));
+    index_opts.read_file = input.get();
+    for (const auto& [reader, pp] : pages) {
+        RETURN_IF_ERROR(reader->read_bloom_filter_page(index_opts, pp));
+    }
+    update_io_stats(*input, stats);
+    return Status::OK();
+}
+
+} // namespace starrocks
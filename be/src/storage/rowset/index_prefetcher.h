@@ -0,0 +1,74 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "common/status.h"
+#include "storage/olap_common.h"
+
+namespace starrocks {
+
+class PredicateTree;
+class Segment;
+class SegmentReadOptions;
+class TabletSchema;
+
+// IndexPrefetcher loads the bloom filter indexes of the predicate columns of a segment in the background, so that
+// the indexes of all the segments to scan are read concurrently once the segment iterators are created, instead of
+// one segment after another when each segment iterator is initialized.
+//
+// The index pages and then the bloom filter pages of a segment are read by SharedBufferedInputStream, which
+// coalesces the adjacent pages into fewer reads. The bloom filter pages are kept by the page cache for the
+// SegmentIterator, and are not prefetched if the page cache is disabled.
+class IndexPrefetcher {
+public:
+    class Task {
+    public:
+        // Waits for the prefetching to finish and adds its statistics to `stats`, or cancels it if it has not
+        // started, in which case the caller would not wait behind the tasks of other segments in the queue.
+        // The errors are ignored, and the indexes not loaded are loaded again by the SegmentIterator.
+        void wait(OlapReaderStatistics* stats);
+
+    private:
+        friend class IndexPrefetcher;
+
+        // Set by whichever of the background thread and `wait()` comes first.
+        std::atomic<bool> _started{false};
+        std::promise<void> _promise;
+        std::future<void> _future = _promise.get_future();
+        // Written by the background thread only before `_promise` is fulfilled.
+        OlapReaderStatistics _stats;
+        bool _waited = false;
+    };
+    using TaskPtr = std::shared_ptr<Task>;
+
+    // Returns the unique ids of the columns whose bloom filter index may be used by the predicates of `pred_tree`.
+    static std::vector<ColumnUID> bloom_filter_columns(const PredicateTree& pred_tree, const TabletSchema& schema);
+
+    // Prefetches the bloom filter indexes of `column_uids` of `segment` in the background, and returns nullptr if
+    // there is nothing to prefetch or the task can not be submitted.
+    static TaskPtr submit(std::shared_ptr<Segment> segment, const std::vector<ColumnUID>& column_uids,
+                          const SegmentReadOptions& opts);
+
+    // Reads the bloom filter indexes of `column_uids` of `segment` in the calling thread.
+    static Status prefetch(Segment* segment, const std::vector<ColumnUID>& column_uids, const SegmentReadOptions& opts,
+                           OlapReaderStatistics* stats);
+};
+
+} // namespace starrocks
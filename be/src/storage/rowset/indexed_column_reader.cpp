@@ -100,6 +100,29 @@ Status IndexedColumnReader::read_page(const IndexReadOptions& opts, const PagePo
     return PageIO::read_and_decompress_page(page_opts, handle, body, footer);
 }
 
+std::vector<PagePointer> IndexedColumnReader::data_pages() const {
+    std::vector<PagePointer> pages;
+    if (!_has_index_page) {
+        if (_num_values > 0) {
+            pages.push_back(_sole_data_page);
+        }
+        return pages;
+    }
+    const IndexPageReader& index_reader = support_ordinal_seek() ? _ordinal_index_reader : _value_index_reader;
+    pages.reserve(index_reader.count());
+    for (int i = 0; i < index_reader.count(); i++) {
+        pages.push_back(index_reader.get_value(i));
+    }
+    return pages;
+}
+
+Status IndexedColumnReader::read_data_page(const IndexReadOptions& opts, const PagePointer& pp) const {
+    PageHandle handle;
+    Slice body;
+    PageFooterPB footer;
+    return read_page(opts, pp, &handle, &body, &footer);
+}
+
 Status IndexedColumnReader::new_iterator(const IndexReadOptions& opts, std::unique_ptr<IndexedColumnIterator>* iter) {
     iter->reset(new IndexedColumnIterator(this, opts));
     return Status::OK();
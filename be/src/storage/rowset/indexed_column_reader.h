@@ -36,6 +36,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "fs/fs.h"
@@ -124,6 +125,13 @@ public:
     bool support_ordinal_seek() const { return _meta.has_ordinal_index_meta(); }
     bool support_value_seek() const { return _meta.has_value_index_meta(); }
 
+    // Returns the pointers of all the data pages.
+    // REQUIRES: the reader has been successfully `load()`ed.
+    std::vector<PagePointer> data_pages() const;
+
+    // Reads the data page `pp`, which is kept by the page cache if `opts.use_page_cache`.
+    Status read_data_page(const IndexReadOptions& opts, const PagePointer& pp) const;
+
     size_t mem_usage() const {
         size_t size = sizeof(IndexedColumnReader) - sizeof(IndexedColumnMetaPB);
         size += _meta.SpaceUsedLong() + _ordinal_index_reader.mem_usage() + _value_index_reader.mem_usage();
@@ -14,7 +14,11 @@
 
 #include "storage/rowset/map_column_iterator.h"
 
+#include <algorithm>
+
+#include "column/binary_column.h"
 #include "column/column_access_path.h"
+#include "column/column_helper.h"
 #include "column/const_column.h"
 #include "column/map_column.h"
 #include "column/nullable_column.h"
@@ -52,6 +56,8 @@ Status MapColumnIterator::init(const ColumnIteratorOptions& opts) {
     // KEY: read key & offset
     // OFFSET: read offset
     // ALL/INDEX: read key & value & offset
+    bool index_keys_known = true;
+    std::vector<std::string> index_keys;
     for (const auto& p : _path->children()) {
         if (p->is_key()) {
             _access_keys |= true;
@@ -60,9 +66,62 @@ Status MapColumnIterator::init(const ColumnIteratorOptions& opts) {
         if (p->is_all() || p->is_index()) {
             _access_values |= true;
             _access_keys |= true;
+            if (p->is_index() && !p->index_keys().empty()) {
+                index_keys.insert(index_keys.end(), p->index_keys().begin(), p->index_keys().end());
+            } else {
+                index_keys_known = false;
+            }
+        }
+    }
+
+    // INDEX: read keys first, and then only the values of the matched keys
+    auto* keys_reader = _keys->get_column_reader();
+    if (_access_values && index_keys_known && keys_reader != nullptr && keys_reader->column_type() == TYPE_VARCHAR) {
+        _index_keys = std::move(index_keys);
+    }
+    return Status::OK();
+}
+
+Status MapColumnIterator::_next_values_of_index_keys(const SparseRange<>& element_range, const Column& keys,
+                                                     size_t keys_offset, Column* values) {
+    const auto* key_data = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(&keys));
+    std::vector<uint8_t> matched(element_range.span_size(), 0);
+    SparseRange<> read_range;
+    size_t pos = 0;
+    SparseRangeIterator<> iter = element_range.new_iterator();
+    while (iter.has_more()) {
+        Range<> r = iter.next(element_range.span_size());
+        for (rowid_t ordinal = r.begin(); ordinal < r.end(); ordinal++, pos++) {
+            if (keys.is_null(keys_offset + pos)) {
+                continue;
+            }
+            Slice key = key_data->get_slice(keys_offset + pos);
+            if (std::any_of(_index_keys.begin(), _index_keys.end(), [&](const auto& k) { return key == Slice(k); })) {
+                matched[pos] = 1;
+                read_range.add(Range<>(ordinal, ordinal + 1));
+            }
         }
     }
 
+    auto matched_values = values->clone_empty();
+    if (!read_range.empty()) {
+        RETURN_IF_ERROR(_values->seek_to_ordinal(read_range.begin()));
+        RETURN_IF_ERROR(_values->next_batch(read_range, matched_values.get()));
+    }
+    // copy the matched values and fill the others run by run
+    size_t num_matched = 0;
+    for (size_t begin = 0, end = 0; begin < matched.size(); begin = end) {
+        end = begin + 1;
+        while (end < matched.size() && matched[end] == matched[begin]) {
+            end++;
+        }
+        if (matched[begin]) {
+            values->append(*matched_values, num_matched, end - begin);
+            num_matched += end - begin;
+        } else {
+            values->append_default(end - begin);
+        }
+    }
     return Status::OK();
 }
 
@@ -104,6 +163,8 @@ Status MapColumnIterator::next_batch(size_t* n, Column* dst) {
     num_to_read = end_offset - num_to_read;
 
     // 3. Read elements
+    const ordinal_t element_ordinal = _keys->get_current_ordinal();
+    const size_t keys_offset = map_column->keys_column()->size();
     if (_access_keys) {
         RETURN_IF_ERROR(_keys->next_batch(&num_to_read, map_column->keys_column().get()));
     } else {
@@ -115,7 +176,11 @@ Status MapColumnIterator::next_batch(size_t* n, Column* dst) {
         }
     }
 
-    if (_access_values) {
+    if (_access_values && !_index_keys.empty()) {
+        SparseRange<> element_range(element_ordinal, element_ordinal + num_to_read);
+        RETURN_IF_ERROR(_next_values_of_index_keys(element_range, *map_column->keys_column(), keys_offset,
+                                                   map_column->values_column().get()));
+    } else if (_access_values) {
         RETURN_IF_ERROR(_values->next_batch(&num_to_read, map_column->values_column().get()));
     } else {
         if (!map_column->values_column()->is_constant()) {
@@ -193,6 +258,7 @@ Status MapColumnIterator::next_batch(const SparseRange<>& range, Column* dst) {
 
     // if array column is nullable, element_read_range may be empty
     DCHECK(element_read_range.empty() || (element_read_range.begin() == _keys->get_current_ordinal()));
+    const size_t keys_offset = map_column->keys_column()->size();
     if (_access_keys) {
         RETURN_IF_ERROR(_keys->next_batch(element_read_range, map_column->keys_column().get()));
     } else {
@@ -204,7 +270,10 @@ Status MapColumnIterator::next_batch(const SparseRange<>& range, Column* dst) {
         }
     }
 
-    if (_access_values) {
+    if (_access_values && !_index_keys.empty()) {
+        RETURN_IF_ERROR(_next_values_of_index_keys(element_read_range, *map_column->keys_column(), keys_offset,
+                                                   map_column->values_column().get()));
+    } else if (_access_values) {
         RETURN_IF_ERROR(_values->next_batch(element_read_range, map_column->values_column().get()));
     } else {
         if (!map_column->values_column()->is_constant()) {
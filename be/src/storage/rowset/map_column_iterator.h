@@ -47,6 +47,11 @@ public:
     ColumnReader* get_column_reader() override { return _reader; }
 
 private:
+    // Read the values of the entries in |element_range| whose keys are in |_index_keys|, and fill the values of the
+    // other entries with defaults. The keys of the entries start at |keys_offset| of |keys|.
+    Status _next_values_of_index_keys(const SparseRange<>& element_range, const Column& keys, size_t keys_offset,
+                                      Column* values);
+
     ColumnReader* _reader;
 
     std::unique_ptr<ColumnIterator> _nulls;
@@ -57,6 +62,8 @@ private:
 
     bool _access_keys;
     bool _access_values;
+    // If not empty, only the values of the entries with these keys are accessed, e.g. by m['a'] and m['b'].
+    std::vector<std::string> _index_keys;
 };
 
 } // namespace starrocks
@@ -42,6 +42,7 @@
 
 namespace starrocks {
 class Column;
+class ColumnPredicate;
 }
 
 namespace starrocks {
@@ -91,6 +92,14 @@ public:
         return Status::NotSupported("PageDecoder Not Support");
     }
 
+    // Evaluates |predicate| on up to |*n| values from the current position on the encoded values, without decoding
+    // them into a column, and sets selection[i] to whether the i-th value satisfies it. The number of values
+    // evaluated is stored in |*n| and the position is advanced by this number.
+    // Returns NotSupported without changing the position if the predicate can not be evaluated on this page.
+    [[nodiscard]] virtual Status evaluate(const ColumnPredicate& predicate, size_t* n, uint8_t* selection) {
+        return Status::NotSupported("evaluate() not supported");
+    }
+
     // Return the number of elements in this page.
     virtual uint32_t count() const = 0;
 
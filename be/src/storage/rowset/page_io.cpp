@@ -41,6 +41,7 @@
 #include "common/logging.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
+#include "runtime/memory/jemalloc_arenas.h"
 #include "storage/page_cache.h"
 #include "storage/rowset/storage_page_decoder.h"
 #include "util/coding.h"
@@ -164,6 +165,9 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
                 strings::Substitute("Bad page: too small size ($0), file($1)", page_size, opts.read_file->filename()));
     }
 
+    // the pages that will be kept in the page cache are allocated from the arena of the storage caches
+    SCOPED_MEMORY_CLASS(opts.use_page_cache ? MemoryClass::STORAGE_CACHE : MemoryClass::QUERY);
+
     // hold compressed page at first, reset to decompressed page later
     // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
     std::unique_ptr<char[]> page(new char[page_size + Column::APPEND_OVERFLOW_MAX_SIZE]);
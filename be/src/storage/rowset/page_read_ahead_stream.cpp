@@ -0,0 +1,217 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/page_read_ahead_stream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "io/input_stream.h"
+#include "storage/olap_common.h"
+#include "util/runtime_profile.h"
+#include "util/threadpool.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+// The weight of the latest sample in the moving averages.
+static constexpr double kMovingAverageWeight = 0.25;
+
+static void update_moving_average(double* average, int64_t sample) {
+    *average = *average == 0 ? sample : *average * (1 - kMovingAverageWeight) + sample * kMovingAverageWeight;
+}
+
+PageReadAheadStream::PageReadAheadStream(std::shared_ptr<io::SeekableInputStream> stream, ThreadPool* pool,
+                                         int64_t max_pages, int64_t max_buffer_size)
+        : _stream(std::move(stream)),
+          _token(pool->new_token(ThreadPool::ExecutionMode::SERIAL)),
+          _max_pages(std::max<int64_t>(max_pages, 1)),
+          _max_buffer_size(max_buffer_size) {
+    // The pages are cached by the name of the underlying file.
+    _filename = _stream->filename();
+}
+
+PageReadAheadStream::~PageReadAheadStream() {
+    // Wait for the running read and drop the queued ones, which refer to `_stream`.
+    _token->shutdown();
+}
+
+void PageReadAheadStream::set_pages(std::vector<PagePointer> pages) {
+    DCHECK(std::is_sorted(pages.begin(), pages.end(),
+                          [](const PagePointer& lhs, const PagePointer& rhs) { return lhs.offset < rhs.offset; }));
+    for (auto& buffer : _buffers) {
+        buffer->cancelled = true;
+    }
+    _buffers.clear();
+    _buffered_bytes = 0;
+    _pages = std::move(pages);
+    _next = 0;
+}
+
+int64_t PageReadAheadStream::_page_index(int64_t offset) const {
+    auto iter = std::lower_bound(_pages.begin(), _pages.end(), offset,
+                                 [](const PagePointer& page, int64_t offset) { return page.offset < offset; });
+    if (iter == _pages.end() || iter->offset != offset) {
+        return -1;
+    }
+    return iter - _pages.begin();
+}
+
+Status PageReadAheadStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    const int64_t index = _page_index(offset);
+    if (index < 0) {
+        return _read_directly(offset, out, count);
+    }
+    if (_last_read_end_ns > 0) {
+        update_moving_average(&_consume_ns_per_page, MonotonicNanos() - _last_read_end_ns);
+    }
+
+    // Drop the pages skipped by the reader.
+    bool skipped = false;
+    while (!_buffers.empty() && _buffers.front()->index < index) {
+        _buffered_bytes -= _buffers.front()->page.size;
+        _buffers.front()->cancelled = true;
+        _buffers.pop_front();
+        skipped = true;
+    }
+    if (skipped) {
+        _window = std::max<int64_t>(_window / 2, 1);
+    }
+
+    Status st;
+    if (!_buffers.empty() && _buffers.front()->index == index && _buffers.front()->page.size >= count) {
+        BufferPtr buffer = std::move(_buffers.front());
+        _buffers.pop_front();
+        _buffered_bytes -= buffer->page.size;
+        {
+            SCOPED_RAW_TIMER(&_wait_ns);
+            buffer->future.wait();
+        }
+        update_moving_average(&_io_ns_per_page, buffer->io_ns);
+        if (buffer->status.ok()) {
+            _hit_count++;
+            memcpy(out, buffer->data.get(), count);
+        } else {
+            st = _read_directly(offset, out, count);
+        }
+    } else {
+        _next = std::max<size_t>(_next, index + 1);
+        const int64_t start_ns = MonotonicNanos();
+        st = _read_directly(offset, out, count);
+        update_moving_average(&_io_ns_per_page, MonotonicNanos() - start_ns);
+    }
+    _started = true;
+
+    _adjust_window();
+    _fill_window();
+    _last_read_end_ns = MonotonicNanos();
+    return st;
+}
+
+void PageReadAheadStream::_adjust_window() {
+    if (_io_ns_per_page <= 0 || _consume_ns_per_page <= 0) {
+        return;
+    }
+    // Read ahead the pages decoded during the IO of one page, and one more to cover the variance of the IO time.
+    const auto pages = static_cast<int64_t>(std::ceil(_io_ns_per_page / _consume_ns_per_page)) + 1;
+    _window = std::clamp<int64_t>(pages, 1, _max_pages);
+}
+
+void PageReadAheadStream::_fill_window() {
+    while (_started && _next < _pages.size() && static_cast<int64_t>(_buffers.size()) < _window) {
+        const auto& page = _pages[_next];
+        if (!_buffers.empty() && _buffered_bytes + page.size > _max_buffer_size) {
+            break;
+        }
+        auto buffer = std::make_shared<Buffer>();
+        buffer->page = page;
+        buffer->index = _next;
+        // Allocated by the reader to be tracked by the memory tracker of the query.
+        buffer->data.reset(new char[page.size]);
+        if (!_token->submit_func([this, buffer]() { _read_buffer(buffer.get()); }).ok()) {
+            break;
+        }
+        _next++;
+        _buffered_bytes += page.size;
+        _buffers.emplace_back(std::move(buffer));
+        _read_ahead_count++;
+    }
+}
+
+void PageReadAheadStream::_read_buffer(Buffer* buffer) {
+    if (buffer->cancelled) {
+        buffer->promise.set_value();
+        return;
+    }
+    const int64_t start_ns = MonotonicNanos();
+    {
+        std::lock_guard<std::mutex> l(_stream_mutex);
+        buffer->status = _stream->read_at_fully(buffer->page.offset, buffer->data.get(), buffer->page.size);
+    }
+    buffer->io_ns = MonotonicNanos() - start_ns;
+    buffer->promise.set_value();
+}
+
+Status PageReadAheadStream::_read_directly(int64_t offset, void* out, int64_t count) {
+    std::lock_guard<std::mutex> l(_stream_mutex);
+    return _stream->read_at_fully(offset, out, count);
+}
+
+StatusOr<int64_t> PageReadAheadStream::read_at(int64_t offset, void* out, int64_t count) {
+    std::lock_guard<std::mutex> l(_stream_mutex);
+    return _stream->read_at(offset, out, count);
+}
+
+StatusOr<int64_t> PageReadAheadStream::read(void* data, int64_t count) {
+    std::lock_guard<std::mutex> l(_stream_mutex);
+    return _stream->read(data, count);
+}
+
+Status PageReadAheadStream::seek(int64_t position) {
+    std::lock_guard<std::mutex> l(_stream_mutex);
+    return _stream->seek(position);
+}
+
+StatusOr<int64_t> PageReadAheadStream::position() {
+    std::lock_guard<std::mutex> l(_stream_mutex);
+    return _stream->position();
+}
+
+StatusOr<int64_t> PageReadAheadStream::get_size() {
+    std::lock_guard<std::mutex> l(_stream_mutex);
+    return _stream->get_size();
+}
+
+Status PageReadAheadStream::skip(int64_t count) {
+    std::lock_guard<std::mutex> l(_stream_mutex);
+    return _stream->skip(count);
+}
+
+StatusOr<std::unique_ptr<io::NumericStatistics>> PageReadAheadStream::get_numeric_statistics() {
+    std::unique_ptr<io::NumericStatistics> stats;
+    {
+        std::lock_guard<std::mutex> l(_stream_mutex);
+        ASSIGN_OR_RETURN(stats, _stream->get_numeric_statistics());
+    }
+    if (stats == nullptr) {
+        stats = std::make_unique<io::NumericStatistics>();
+    }
+    stats->append(kReadAheadCount, _read_ahead_count);
+    stats->append(kReadAheadHitCount, _hit_count);
+    stats->append(kReadAheadWaitNs, _wait_ns);
+    return stats;
+}
+
+} // namespace starrocks
@@ -0,0 +1,113 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/status.h"
+#include "io/seekable_input_stream.h"
+#include "storage/rowset/page_pointer.h"
+
+namespace starrocks {
+
+class ThreadPool;
+class ThreadPoolToken;
+
+// PageReadAheadStream reads the data pages of a column asynchronously ahead of the ColumnIterator, so that the IO
+// of the next pages overlaps with the decoding of the current one, which is mainly for the segments on the object
+// storage.
+//
+// The pages to read are set by `set_pages()` in ascending order of offset, and are read one after another by a
+// serial token of `pool`, as the underlying stream may not be read concurrently. The read-ahead starts from the
+// first page missing the page cache. The number of pages read ahead is adapted to the measured IO time of a page
+// and the time of decoding a page, so that the next read finishes before the reader reaches it, within
+// `max_pages` and `max_buffer_size`. The window is halved when the pages read ahead are skipped by the reader,
+// e.g. found in the page cache or filtered out by the runtime filters.
+//
+// The reads of the offsets other than the pages, e.g. the dictionary page, go to the underlying stream directly.
+class PageReadAheadStream final : public io::SeekableInputStream {
+public:
+    PageReadAheadStream(std::shared_ptr<io::SeekableInputStream> stream, ThreadPool* pool, int64_t max_pages,
+                        int64_t max_buffer_size);
+    ~PageReadAheadStream() override;
+
+    void set_pages(std::vector<PagePointer> pages);
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override;
+    StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override;
+    StatusOr<int64_t> read(void* data, int64_t count) override;
+    Status seek(int64_t position) override;
+    StatusOr<int64_t> position() override;
+    StatusOr<int64_t> get_size() override;
+    Status skip(int64_t count) override;
+    StatusOr<std::unique_ptr<io::NumericStatistics>> get_numeric_statistics() override;
+
+    int64_t window() const { return _window; }
+    int64_t read_ahead_count() const { return _read_ahead_count; }
+    int64_t hit_count() const { return _hit_count; }
+    int64_t wait_ns() const { return _wait_ns; }
+
+private:
+    struct Buffer {
+        PagePointer page;
+        size_t index = 0;
+        std::unique_ptr<char[]> data;
+        Status status;
+        int64_t io_ns = 0;
+        // Set when the page is skipped by the reader before it is read.
+        std::atomic<bool> cancelled{false};
+        std::promise<void> promise;
+        std::future<void> future = promise.get_future();
+    };
+    using BufferPtr = std::shared_ptr<Buffer>;
+
+    // Returns the index of the page at `offset` in `_pages`, or -1.
+    int64_t _page_index(int64_t offset) const;
+    void _read_buffer(Buffer* buffer);
+    Status _read_directly(int64_t offset, void* out, int64_t count);
+    void _adjust_window();
+    void _fill_window();
+
+    std::shared_ptr<io::SeekableInputStream> _stream;
+    // Serializes the reads of `_stream` by the background thread and the reader.
+    std::mutex _stream_mutex;
+    std::unique_ptr<ThreadPoolToken> _token;
+    const int64_t _max_pages;
+    const int64_t _max_buffer_size;
+
+    std::vector<PagePointer> _pages;
+    // The index of the next page to read ahead.
+    size_t _next = 0;
+    std::deque<BufferPtr> _buffers;
+    int64_t _buffered_bytes = 0;
+    bool _started = false;
+    int64_t _window = 1;
+
+    // The exponential moving averages of the IO time of a page and the time between the reads of two pages.
+    double _io_ns_per_page = 0;
+    double _consume_ns_per_page = 0;
+    int64_t _last_read_end_ns = 0;
+
+    int64_t _read_ahead_count = 0;
+    int64_t _hit_count = 0;
+    int64_t _wait_ns = 0;
+};
+
+} // namespace starrocks
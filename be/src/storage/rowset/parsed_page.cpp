@@ -154,6 +154,16 @@ public:
         return Status::OK();
     }
 
+    Status evaluate(const ColumnPredicate& predicate, size_t* count, uint8_t* selection) override {
+        if (_has_null) {
+            return Status::NotSupported("evaluate() not supported for the nullable page v1");
+        }
+        *count = std::min(*count, remaining());
+        RETURN_IF_ERROR(_data_decoder->evaluate(predicate, count, selection));
+        _offset_in_page += *count;
+        return Status::OK();
+    }
+
     Status read_dict_codes(Column* column, size_t* count) override {
         *count = std::min(*count, remaining());
         size_t nrows_to_read = *count;
@@ -265,6 +275,20 @@ public:
         return Status::OK();
     }
 
+    Status evaluate(const ColumnPredicate& predicate, size_t* count, uint8_t* selection) override {
+        DCHECK_EQ(_offset_in_page, _data_decoder->current_index());
+        RETURN_IF_ERROR(_data_decoder->evaluate(predicate, count, selection));
+        if (_null_flags.size() > 0) {
+            // The data of the NULL records are also encoded in the page v2.
+            const uint8_t* null_flags = _null_flags.data() + _offset_in_page;
+            for (size_t i = 0; i < *count; i++) {
+                selection[i] &= !null_flags[i];
+            }
+        }
+        _offset_in_page += *count;
+        return Status::OK();
+    }
+
     Status read_dict_codes(Column* column, size_t* count) override {
         if (_null_flags.size() == 0) {
             RETURN_IF_ERROR(_data_decoder->next_dict_codes(count, column));
@@ -398,6 +422,10 @@ Status parse_page_v2(std::unique_ptr<ParsedPage>* result, PageHandle handle, con
 Status parse_page(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                   const DataPageFooterPB& footer, const EncodingInfo* encoding, const PagePointer& page_pointer,
                   uint32_t page_index) {
+    if (footer.has_encoding() && footer.encoding() != encoding->encoding()) {
+        // the page is encoded differently from the column, see config::enable_adaptive_page_encoding
+        RETURN_IF_ERROR(EncodingInfo::get(encoding->type(), footer.encoding(), &encoding));
+    }
     uint32_t version = footer.has_format_version() ? footer.format_version() : 1;
     if (version == 1) {
         return parse_page_v1(result, std::move(handle), body, footer, encoding, page_pointer, page_index);
@@ -45,6 +45,7 @@ namespace starrocks {
 class Slice;
 class Status;
 class Column;
+class ColumnPredicate;
 class DataPageFooterPB;
 class EncodingInfo;
 class PageHandle;
@@ -98,6 +99,14 @@ public:
         return Status::NotSupported("Read by range Not Support");
     }
 
+    // Evaluates |predicate| on up to |*count| records from the current offset on the encoded data, and sets
+    // selection[i] to whether the i-th record satisfies it, where the NULL records never satisfy it.
+    // On success, the number of records evaluated is stored in |*count| and the page offset is advanced
+    // by this number. Returns NotSupported without changing the offset if it can not be evaluated on this page.
+    virtual Status evaluate(const ColumnPredicate& predicate, size_t* count, uint8_t* selection) {
+        return Status::NotSupported("evaluate() not supported");
+    }
+
     // prerequisite: encoding_type() is `DICT_ENCODING`.
     // Attempts to read up to |*count| dictionary codes from this page into the |column|.
     // On success, `Status::OK` is returned, and the number of codes read will be updated to
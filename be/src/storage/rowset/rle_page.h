@@ -36,6 +36,7 @@
 
 #include "column/column.h"
 #include "storage/range.h"
+#include "storage/rowset/encoded_predicate.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/page_builder.h"
 #include "storage/rowset/page_decoder.h"
@@ -240,6 +241,29 @@ public:
         return Status::OK();
     }
 
+    [[nodiscard]] Status evaluate(const ColumnPredicate& predicate, size_t* n, uint8_t* selection) override {
+        DCHECK(_parsed);
+        EncodedPredicate<Type> pred;
+        if (!pred.init(predicate)) {
+            return Status::NotSupported("evaluate() not supported");
+        }
+        *n = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        // The predicate is evaluated once for each run of the same value.
+        CppType value{};
+        size_t remaining = *n;
+        while (remaining > 0) {
+            size_t run = _rle_decoder.GetNextRun(&value, remaining);
+            if (PREDICT_FALSE(run == 0)) {
+                return Status::Corruption("RLE decode failed");
+            }
+            memset(selection, pred.test(value), run);
+            selection += run;
+            remaining -= run;
+        }
+        _cur_index += *n;
+        return Status::OK();
+    }
+
     uint32_t count() const override { return _num_elements; }
 
     uint32_t current_index() const override { return _cur_index; }
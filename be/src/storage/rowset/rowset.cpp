@@ -51,6 +51,7 @@
 #include "storage/inverted/index_descriptor.hpp"
 #include "storage/merge_iterator.h"
 #include "storage/projection_iterator.h"
+#include "storage/rowset/index_prefetcher.h"
 #include "storage/rowset/rowid_range_option.h"
 #include "storage/rowset/short_key_range_option.h"
 #include "storage/storage_engine.h"
@@ -310,6 +311,12 @@ Status Rowset::remove() {
                 auto ist = fs->delete_dir_recursive(inverted_index_path);
                 LOG_IF(WARNING, !ist.ok()) << "Fail to delete vector_index_path " << inverted_index_path << ": " << ist;
                 merge_status(ist);
+            } else if (index.index_type() == IndexType::VECTOR) {
+                std::string vector_index_path = IndexDescriptor::vector_index_file_path(
+                        _rowset_path, rowset_id().to_string(), i, index.index_id());
+                auto vst = fs->delete_file(vector_index_path);
+                LOG_IF(WARNING, !vst.ok()) << "Fail to delete vector_index_path " << vector_index_path << ": " << vst;
+                merge_status(vst);
             }
         }
     }
@@ -417,6 +424,20 @@ Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId
                                                                             src_absolute_path, dst_absolute_path));
                         }
                     }
+                } else if (index.index_type() == IndexType::VECTOR) {
+                    std::string src_vector_file_path = IndexDescriptor::vector_index_file_path(
+                            _rowset_path, rowset_id().to_string(), segment_n, index.index_id());
+                    // the segments written before the index was created have no index file
+                    if (!fs::path_exist(src_vector_file_path)) {
+                        continue;
+                    }
+                    std::string dst_vector_link_path = IndexDescriptor::vector_index_file_path(
+                            dir, new_rowset_id.to_string(), segment_n, index.index_id());
+                    if (link(src_vector_file_path.c_str(), dst_vector_link_path.c_str()) != 0) {
+                        PLOG(WARNING) << "Fail to link " << src_vector_file_path << " to " << dst_vector_link_path;
+                        return Status::RuntimeError(strings::Substitute("Fail to link vector index file from $0 to $1",
+                                                                        src_vector_file_path, dst_vector_link_path));
+                    }
                 }
             }
         }
@@ -524,6 +545,20 @@ Status Rowset::copy_files_to(KVStore* kvstore, const std::string& dir) {
                                                                std::strerror(Errno::no())));
                         }
                     }
+                } else if (index.index_type() == IndexType::VECTOR) {
+                    std::string src_index_path = IndexDescriptor::vector_index_file_path(
+                            _rowset_path, rowset_id().to_string(), i, index.index_id());
+                    if (!fs::path_exist(src_index_path)) {
+                        continue;
+                    }
+                    std::string dst_index_path =
+                            IndexDescriptor::vector_index_file_path(dir, rowset_id().to_string(), i, index.index_id());
+                    if (!fs::copy_file(src_index_path, dst_index_path).ok()) {
+                        LOG(WARNING) << "Error to copy index. src:" << src_index_path << ", dst:" << dst_index_path
+                                     << ", errno=" << std::strerror(Errno::no());
+                        return Status::IOError(fmt::format("Error to copy file. src: {}, dst: {}, error:{} ",
+                                                           src_index_path, dst_index_path, std::strerror(Errno::no())));
+                    }
                 }
             }
         }
@@ -632,6 +667,9 @@ public:
 protected:
     Status do_get_next(Chunk* chunk) override { return _iter->get_next(chunk); }
     Status do_get_next(Chunk* chunk, vector<uint32_t>* rowid) override { return _iter->get_next(chunk, rowid); }
+    Status do_get_next(Chunk* chunk, vector<uint64_t>* rssid_rowids) override {
+        return _iter->get_next(chunk, rssid_rowids);
+    }
 
 private:
     RowsetReleaseGuard _guard;
@@ -678,6 +716,8 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
         seg_options.rowset_id = rowset_meta()->get_rowset_seg_id();
         seg_options.version = options.version;
         seg_options.delvec_loader = std::make_shared<LocalDelvecLoader>(options.meta);
+    } else if (options.rssid_base >= 0) {
+        seg_options.rowset_id = static_cast<uint32_t>(options.rssid_base);
     }
     seg_options.rowset_path = _rowset_path;
     seg_options.tablet_id = rowset_meta()->tablet_id();
@@ -692,6 +732,7 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
     }
     seg_options.prune_column_after_index_filter = options.prune_column_after_index_filter;
     seg_options.enable_gin_filter = options.enable_gin_filter;
+    seg_options.vector_search_option = options.vector_search_option;
 
     auto segment_schema = schema;
     // Append the columns with delete condition to segment schema.
@@ -705,6 +746,12 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
         }
     }
 
+    // Prefetch the bloom filter indexes of all the segments before they are iterated one after another.
+    std::vector<ColumnUID> bf_column_uids;
+    if (config::enable_index_prefetch && config::enable_index_bloom_filter && options.reader_type == READER_QUERY) {
+        bf_column_uids = IndexPrefetcher::bloom_filter_columns(seg_options.pred_tree, *options.tablet_schema);
+    }
+
     std::vector<ChunkIteratorPtr> tmp_seg_iters;
     tmp_seg_iters.reserve(num_segments());
     if (options.stats) {
@@ -729,6 +776,7 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
             seg_options.is_first_split_of_segment = true;
         }
 
+        seg_options.index_prefetch = IndexPrefetcher::submit(seg_ptr, bf_column_uids, seg_options);
         auto res = seg_ptr->new_iterator(segment_schema, seg_options);
         if (res.status().is_end_of_file()) {
             continue;
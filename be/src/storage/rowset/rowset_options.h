@@ -26,6 +26,7 @@
 #include "storage/predicate_tree/predicate_tree.hpp"
 #include "storage/seek_range.h"
 #include "storage/tablet_schema.h"
+#include "storage/vector_index/vector_index_option.h"
 
 namespace starrocks {
 class Conditions;
@@ -87,6 +88,11 @@ public:
 
     bool prune_column_after_index_filter = false;
     bool enable_gin_filter = false;
+    VectorSearchOptionPtr vector_search_option = nullptr;
+
+    // If >= 0, the segment iterators of a non primary key rowset encode the rssid of the segment as
+    // `rssid_base + segment_id` in the row ids, so the readers can identify the rows across rowsets.
+    int64_t rssid_base = -1;
 };
 
 } // namespace starrocks
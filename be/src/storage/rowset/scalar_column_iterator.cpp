@@ -34,6 +34,8 @@
 
 #include "storage/rowset/scalar_column_iterator.h"
 
+#include "column/binary_column.h"
+#include "column/nullable_column.h"
 #include "storage/column_predicate.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/bitshuffle_page.h"
@@ -562,6 +564,32 @@ Status ScalarColumnIterator::_do_next_batch_dict_codes(const SparseRange<>& rang
 template <LogicalType Type>
 Status ScalarColumnIterator::_do_decode_dict_codes(const int32_t* codes, size_t size, Column* words) {
     auto dict = down_cast<BinaryPlainPageDecoder<Type>*>(_dict_decoder.get());
+    const uint32_t dict_size = dict->count();
+    _num_decoded_codes += size;
+    if (_dict_words == nullptr && _num_decoded_codes > dict_size) {
+        std::vector<Slice> dict_words;
+        RETURN_IF_ERROR(_fetch_all_dict_words<Type>(&dict_words));
+        dict_words.emplace_back("");
+        auto dict_column = BinaryColumn::create();
+        [[maybe_unused]] bool ok = dict_column->append_strings(dict_words);
+        DCHECK(ok);
+        _dict_words = std::move(dict_column);
+    }
+    if (_dict_words != nullptr) {
+        Buffer<uint32_t> indexes(size);
+        for (size_t i = 0; i < size; i++) {
+            indexes[i] = codes[i] >= 0 ? static_cast<uint32_t>(codes[i]) : dict_size;
+        }
+        if (words->is_nullable()) {
+            auto* nullable_words = down_cast<NullableColumn*>(words);
+            nullable_words->data_column()->append_selective(*_dict_words, indexes);
+            nullable_words->null_column_data().resize(nullable_words->data_column()->size(), 0);
+        } else {
+            words->append_selective(*_dict_words, indexes);
+        }
+        _opts.stats->bytes_read += static_cast<int64_t>(words->byte_size() + BitmapSize(size));
+        return Status::OK();
+    }
     std::vector<Slice> slices;
     slices.reserve(size);
     for (size_t i = 0; i < size; i++) {
@@ -628,6 +656,34 @@ Status ScalarColumnIterator::fetch_dict_codes_by_rowid(const rowid_t* rowids, si
     return _fetch_by_rowid(rowids, size, values, page_parse);
 }
 
+Status ScalarColumnIterator::evaluate_on_encoded_pages(const ColumnPredicate& predicate, const SparseRange<>& range,
+                                                       uint8_t* selection) {
+    SparseRangeIterator<> iter = range.new_iterator();
+    while (iter.has_more()) {
+        Range<> r = iter.next(range.span_size());
+        RETURN_IF_ERROR(seek_to_ordinal(r.begin()));
+        size_t remaining = r.span_size();
+        while (remaining > 0) {
+            if (_page->remaining() == 0) {
+                bool eos = false;
+                RETURN_IF_ERROR(_load_next_page(&eos));
+                if (eos) {
+                    return Status::InternalError("evaluate the rows out of the column");
+                }
+            }
+            size_t n = remaining;
+            RETURN_IF_ERROR(_page->evaluate(predicate, &n, selection));
+            if (PREDICT_FALSE(n == 0)) {
+                return Status::InternalError("no row is evaluated in the page");
+            }
+            _current_ordinal += n;
+            selection += n;
+            remaining -= n;
+        }
+    }
+    return Status::OK();
+}
+
 int ScalarColumnIterator::dict_size() {
     if (_reader->column_type() == TYPE_CHAR) {
         auto dict = down_cast<BinaryPlainPageDecoder<TYPE_CHAR>*>(_dict_decoder.get());
@@ -90,6 +90,9 @@ public:
 
     [[nodiscard]] Status fetch_dict_codes_by_rowid(const rowid_t* rowids, size_t size, Column* values) override;
 
+    [[nodiscard]] Status evaluate_on_encoded_pages(const ColumnPredicate& predicate, const SparseRange<>& range,
+                                                   uint8_t* selection) override;
+
     ParsedPage* get_current_page() { return _page.get(); }
 
     ColumnReader* get_column_reader() override { return _reader; }
@@ -147,6 +150,12 @@ private:
     // keep dict page handle to avoid released
     PageHandle _dict_page_handle;
 
+    // The words of the dictionary materialized as a column, with an empty word appended for the negative codes,
+    // so that a batch of codes is decoded by one gather instead of one lookup per code. Built once the decoded
+    // codes outnumber the words of the dictionary, which amortizes the copy of the dictionary.
+    ColumnPtr _dict_words;
+    size_t _num_decoded_codes = 0;
+
     // page iterator used to get next page when current page is finished.
     // This value will be reset when a new seek is issued
     OrdinalPageIndexIterator _page_iter;
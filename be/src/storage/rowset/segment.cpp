@@ -327,6 +327,20 @@ Status Segment::new_inverted_index_iterator(uint32_t ucid, InvertedIndexIterator
     return Status::OK();
 }
 
+Status Segment::get_vector_index(uint32_t ucid, const SegmentReadOptions& opts, const VectorIndexReader** reader,
+                                 std::shared_ptr<TabletIndex>* index_meta) {
+    *reader = nullptr;
+    auto column_reader_iter = _column_readers.find(ucid);
+    if (column_reader_iter == _column_readers.end()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_tablet_schema->get_indexes_for_column(ucid, VECTOR, *index_meta));
+    if (*index_meta == nullptr) {
+        return Status::OK();
+    }
+    return column_reader_iter->second->load_vector_index(*index_meta, opts, reader);
+}
+
 Status Segment::load_index(const LakeIOOptions& lake_io_opts) {
     auto res = success_once(_load_index_once, [&] {
         SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
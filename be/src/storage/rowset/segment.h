@@ -67,6 +67,7 @@ class SegmentReadOptions;
 
 class BitmapIndexIterator;
 class ColumnReader;
+class VectorIndexReader;
 class ColumnIterator;
 class Segment;
 using SegmentSharedPtr = std::shared_ptr<Segment>;
@@ -181,6 +182,10 @@ public:
         return _column_readers.count(uid) > 0 ? _column_readers.at(uid).get() : nullptr;
     }
 
+    ColumnReader* column_with_uid(size_t uid) {
+        return _column_readers.count(uid) > 0 ? _column_readers.at(uid).get() : nullptr;
+    }
+
     FileSystem* file_system() const { return _fs.get(); }
 
     const TabletSchema& tablet_schema() const { return *_tablet_schema; }
@@ -200,6 +205,10 @@ public:
 
     Status new_inverted_index_iterator(uint32_t cid, InvertedIndexIterator** iter, const SegmentReadOptions& opts);
 
+    // Returns the vector index of the column `ucid` with its meta, or nullptr if the column has none.
+    Status get_vector_index(uint32_t ucid, const SegmentReadOptions& opts, const VectorIndexReader** reader,
+                            std::shared_ptr<TabletIndex>* index_meta);
+
     const ShortKeyIndexDecoder* decoder() const { return _sk_index_decoder.get(); }
 
     size_t mem_usage() const;
@@ -30,6 +30,7 @@
 #include "gutil/casts.h"
 #include "gutil/stl_util.h"
 #include "io/shared_buffered_input_stream.h"
+#include "runtime/exec_env.h"
 #include "segment_options.h"
 #include "simd/simd.h"
 #include "storage/chunk_helper.h"
@@ -45,12 +46,15 @@
 #include "storage/projection_iterator.h"
 #include "storage/range.h"
 #include "storage/roaring2range.h"
+#include "storage/row_store_encoder_factory.h"
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/column_decoder.h"
+#include "storage/rowset/column_reader.h"
 #include "storage/rowset/common.h"
 #include "storage/rowset/default_value_column_iterator.h"
 #include "storage/rowset/dictcode_column_iterator.h"
 #include "storage/rowset/fill_subfield_iterator.h"
+#include "storage/rowset/page_read_ahead_stream.h"
 #include "storage/rowset/rowid_column_iterator.h"
 #include "storage/rowset/rowid_range_option.h"
 #include "storage/rowset/segment.h"
@@ -58,6 +62,7 @@
 #include "storage/storage_engine.h"
 #include "storage/types.h"
 #include "storage/update_manager.h"
+#include "storage/vector_index/vector_index_reader.h"
 #include "types/array_type_info.h"
 #include "types/logical_type.h"
 #include "util/starrocks_metrics.h"
@@ -118,6 +123,23 @@ protected:
     }
 
 private:
+    // Decodes the value columns of a primary key table from the row column of the segment,
+    // see `_init_row_store_columns`.
+    struct RowStoreReader {
+        ColumnIterator* iterator = nullptr;
+        // the schema of the segment, which the rows are encoded with
+        const Schema* schema = nullptr;
+        RowStoreEncoderPtr encoder;
+        OlapReaderStatistics* stats = nullptr;
+        BinaryColumn rows;
+
+        // Decodes |rows| into |dest|, whose ids in |schema| are the ascending |column_ids|.
+        Status decode(const std::vector<uint32_t>& column_ids, const std::vector<Column*>& dest) {
+            SCOPED_RAW_TIMER(&stats->row_store_decode_ns);
+            return encoder->decode_columns_from_full_row_column(*schema, rows, column_ids, dest);
+        }
+    };
+
     struct ScanContext {
         ScanContext() = default;
 
@@ -131,8 +153,10 @@ private:
         }
 
         Status seek_columns(ordinal_t pos) {
-            for (auto iter : _column_iterators) {
-                RETURN_IF_ERROR(iter->seek_to_ordinal(pos));
+            for (size_t i = 0; i < _column_iterators.size(); i++) {
+                if (!is_row_store_column(i)) {
+                    RETURN_IF_ERROR(_column_iterators[i]->seek_to_ordinal(pos));
+                }
             }
             return Status::OK();
         }
@@ -146,13 +170,43 @@ private:
                     col->resize(range.span_size());
                     continue;
                 }
+                if (is_row_store_column(i)) {
+                    continue;
+                }
                 RETURN_IF_ERROR(_column_iterators[i]->next_batch(range, col.get()));
                 may_has_del_row |= (col->delete_state() != DEL_NOT_SATISFIED);
             }
+            if (!_row_store_indexes.empty()) {
+                RETURN_IF_ERROR(read_row_store_columns(chunk, range));
+            }
             chunk->set_delete_state(may_has_del_row ? DEL_PARTIAL_SATISFIED : DEL_NOT_SATISFIED);
             return Status::OK();
         }
 
+        bool is_row_store_column(size_t i) const { return !_row_store_indexes.empty() && _is_row_store_column[i]; }
+
+        // Reads the row column for |range| and decodes the columns of |_row_store_indexes| in |chunk| from it.
+        Status read_row_store_columns(Chunk* chunk, const SparseRange<>& range) {
+            RETURN_IF_ERROR(_row_store->iterator->seek_to_ordinal(range.begin()));
+            _row_store->rows.reset_column();
+            RETURN_IF_ERROR(_row_store->iterator->next_batch(range, &_row_store->rows));
+            std::vector<Column*> dest;
+            dest.reserve(_row_store_indexes.size());
+            for (size_t index : _row_store_indexes) {
+                dest.emplace_back(chunk->get_column_by_index(index).get());
+            }
+            return _row_store->decode(_row_store_column_ids, dest);
+        }
+
+        ordinal_t current_ordinal() const {
+            for (size_t i = 0; i < _column_iterators.size(); i++) {
+                if (!is_row_store_column(i)) {
+                    return _column_iterators[i]->get_current_ordinal();
+                }
+            }
+            return _row_store->iterator->get_current_ordinal();
+        }
+
         int64_t memory_usage() const {
             int64_t usage = 0;
             usage += (_read_chunk != nullptr) ? _read_chunk->memory_usage() : 0;
@@ -200,10 +254,18 @@ private:
         // for inverted index.
         std::unordered_set<size_t> _prune_cols;
         bool _prune_column_after_index_filter = false;
+
+        // The columns decoded from the row column by |_row_store| instead of being read by |_column_iterators|:
+        // their indexes in |_read_schema|, and their ids in the segment schema in ascending order.
+        RowStoreReader* _row_store{nullptr};
+        std::vector<size_t> _row_store_indexes;
+        std::vector<uint32_t> _row_store_column_ids;
+        std::vector<bool> _is_row_store_column;
     };
 
     Status _init();
     Status _try_to_update_ranges_by_runtime_filter();
+    StatusOr<bool> _filter_segment_by_runtime_filter(ColumnId cid, const PredicateList& predicates);
     Status _do_get_next(Chunk* result, vector<rowid_t>* rowid);
 
     template <bool check_global_dict>
@@ -226,8 +288,20 @@ private:
 
     StatusOr<uint16_t> _filter_by_non_expr_predicates(Chunk* chunk, vector<rowid_t>* rowid, uint16_t from, uint16_t to);
     StatusOr<uint16_t> _filter_by_expr_predicates(Chunk* chunk, vector<rowid_t>* rowid);
+    // Removes the rows not satisfying `_encoded_predicates` from `range`, which are evaluated on the encoded pages.
+    Status _filter_by_encoded_predicates(SparseRange<>* range);
+    // Reads the columns of `_context` for `range`, and evaluates `_pred_columns` one by one in `_pred_column_order`
+    // while reading them, so that the next columns are read only for the rows passing the previous predicates.
+    // `range` is set to the rows passing all of them.
+    Status _read_by_predicate_order(Chunk* chunk, SparseRange<>* range);
+    void _reorder_predicate_columns();
 
     void _init_column_predicates();
+    void _init_encoded_predicates();
+    void _init_predicate_columns();
+
+    // Chooses the value columns decoded from the row column instead of being read from their own pages.
+    Status _init_row_store_columns();
 
     Status _init_context();
 
@@ -258,6 +332,9 @@ private:
     bool _can_using_global_dict(const FieldPtr& field) const;
 
     Status _init_bitmap_index_iterators();
+    Status _init_bitmap_index_iterator(ColumnId cid, ColumnUID ucid);
+    StatusOr<bool> _get_row_ranges_by_runtime_bitmap_index(ColumnId cid, const PredicateList& predicates,
+                                                           SparseRange<>* row_ranges);
 
     Status _apply_bitmap_index();
 
@@ -267,6 +344,8 @@ private:
 
     Status _apply_inverted_index();
 
+    Status _apply_vector_index();
+
     Status _read(Chunk* chunk, vector<rowid_t>* rowid, size_t n);
 
     void _init_column_access_paths();
@@ -296,6 +375,7 @@ private:
     SegmentReadOptions _opts;
     RawColumnIterators _column_iterators;
     std::vector<int> _io_coalesce_column_index;
+    std::vector<int> _read_ahead_column_index;
     ColumnDecoders _column_decoders;
     std::vector<BitmapIndexIterator*> _bitmap_index_iterators;
     // delete predicates
@@ -303,7 +383,7 @@ private:
 
     Status _get_del_vec_st;
     Status _get_dcg_st;
-    DelVectorPtr _del_vec;
+    DelVectorCSPtr _del_vec;
     DeltaColumnGroupList _dcgs;
     roaring::api::roaring_uint32_iterator_t _roaring_iter;
 
@@ -315,6 +395,31 @@ private:
     ColumnPredicateMap _cid_to_predicates;
     PredicateTree _non_expr_pred_tree;
     PredicateTree _expr_pred_tree;
+    // The comparison predicates ANDed at the root of `_non_expr_pred_tree` to be evaluated on the encoded pages
+    // before the columns are read. They are still evaluated by `_non_expr_pred_tree` after the columns are read.
+    std::vector<const ColumnPredicate*> _encoded_predicates;
+    Buffer<uint8_t> _encoded_selection;
+    Buffer<uint8_t> _encoded_selection_tmp;
+
+    // A column of the predicates ANDed at the root of `_non_expr_pred_tree`, which is read and evaluated by
+    // `_read_by_predicate_order` when `_non_expr_pred_tree` has no other predicates.
+    struct PredicateColumn {
+        ColumnId cid = 0;
+        ColumnPredicates predicates;
+        PredicateColumnStats* stats = nullptr;
+        // The rows read, the rows selected before and after evaluating `predicates`, and the time of reading and
+        // evaluating since the last reordering.
+        int64_t rows_read = 0;
+        int64_t input_rows = 0;
+        int64_t output_rows = 0;
+        int64_t cost_ns = 0;
+        // The cost per row filtered, the columns of lower rank are read first.
+        double rank = 0;
+    };
+    std::vector<PredicateColumn> _pred_columns;
+    std::vector<size_t> _pred_column_order;
+    std::vector<uint8_t> _column_read_flags;
+    int64_t _predicate_order_reads = 0;
 
     // _selection is used to accelerate
     Buffer<uint8_t> _selection;
@@ -353,6 +458,10 @@ private:
     std::unordered_map<ColumnId, ColumnAccessPath*> _predicate_column_access_paths;
 
     std::unordered_set<ColumnId> _prune_cols_candidate_by_inverted_index;
+
+    RowStoreReader _row_store;
+    // column id -> id in the segment schema, of the columns decoded from the row column.
+    std::unordered_map<ColumnId, uint32_t> _row_store_columns;
 };
 
 SegmentIterator::SegmentIterator(std::shared_ptr<Segment> segment, Schema schema, SegmentReadOptions options)
@@ -454,11 +563,16 @@ Status SegmentIterator::_init() {
     if (apply_del_vec_after_all_index_filter) {
         RETURN_IF_ERROR(_apply_del_vector());
     }
+    // after every other filter, so that the top-k rows are searched among the rows left
+    RETURN_IF_ERROR(_apply_vector_index());
     // rewrite stage
     // Rewriting predicates using segment dictionary codes
     RETURN_IF_ERROR(_rewrite_predicates());
+    RETURN_IF_ERROR(_init_row_store_columns());
     RETURN_IF_ERROR(_init_context());
     _init_column_predicates();
+    _init_encoded_predicates();
+    _init_predicate_columns();
 
     // reverse scan_range
     if (!_opts.asc_hint) {
@@ -470,6 +584,9 @@ Status SegmentIterator::_init() {
     for (auto column_index : _io_coalesce_column_index) {
         RETURN_IF_ERROR(_column_iterators[column_index]->convert_sparse_range_to_io_range(_scan_range));
     }
+    for (auto column_index : _read_ahead_column_index) {
+        RETURN_IF_ERROR(_column_iterators[column_index]->init_read_ahead(_scan_range));
+    }
 
     return Status::OK();
 }
@@ -482,8 +599,20 @@ Status SegmentIterator::_try_to_update_ranges_by_runtime_filter() {
                 auto iter = _del_predicates.find(cid);
                 del_pred = iter != _del_predicates.end() ? &(iter->second) : nullptr;
                 SparseRange<> r;
-                RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(predicates, del_pred, &r,
-                                                                                   CompoundNodeType::AND));
+                ASSIGN_OR_RETURN(bool segment_filtered, _filter_segment_by_runtime_filter(cid, predicates));
+                if (segment_filtered) {
+                    // Leave |r| empty to skip the rest of the segment.
+                    _opts.stats->runtime_segments_filtered++;
+                } else {
+                    RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(predicates, del_pred, &r,
+                                                                                       CompoundNodeType::AND));
+                    SparseRange<> bitmap_range;
+                    ASSIGN_OR_RETURN(bool use_bitmap,
+                                     _get_row_ranges_by_runtime_bitmap_index(cid, predicates, &bitmap_range));
+                    if (use_bitmap) {
+                        r &= bitmap_range;
+                    }
+                }
                 size_t prev_size = _scan_range.span_size();
                 SparseRange<> res;
                 res.set_sorted(_scan_range.is_sorted());
@@ -496,6 +625,24 @@ Status SegmentIterator::_try_to_update_ranges_by_runtime_filter() {
             _opts.stats->raw_rows_read);
 }
 
+// The runtime filters updated during the scan, e.g. the boundary of the top-n heap, only get tighter, so check the
+// zone map of the whole segment first, which avoids loading the page zone maps of the segments that cannot satisfy
+// the runtime filters any more.
+StatusOr<bool> SegmentIterator::_filter_segment_by_runtime_filter(ColumnId cid, const PredicateList& predicates) {
+    if (!config::enable_index_segment_level_zonemap_filter) {
+        return false;
+    }
+    auto tablet_schema = _opts.tablet_schema ? _opts.tablet_schema : _segment->tablet_schema_share_ptr();
+    const auto ucid = tablet_schema->column(cid).unique_id();
+    // The zone map of the segment doesn't cover the values in the delta column groups.
+    ASSIGN_OR_RETURN(auto dcg_segment, _get_dcg_segment(ucid));
+    if (dcg_segment != nullptr) {
+        return false;
+    }
+    const ColumnReader* reader = _segment->column_with_uid(ucid);
+    return reader != nullptr && reader->has_zone_map() && !reader->segment_zone_map_filter(predicates);
+}
+
 StatusOr<std::shared_ptr<Segment>> SegmentIterator::_get_dcg_segment(uint32_t ucid) {
     // iterate dcg from new ver to old ver
     for (const auto& dcg : _dcgs) {
@@ -585,6 +732,15 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
             iter_opts.is_io_coalesce = true;
             _column_files[cid] = std::move(shared_buffered_input_stream);
             _io_coalesce_column_index.emplace_back(cid);
+        } else if (auto* pool = ExecEnv::GetInstance()->column_read_ahead_thread_pool();
+                   config::enable_column_read_ahead && _opts.asc_hint && pool != nullptr &&
+                   !_segment->is_default_column(col) && _segment->lake_tablet_manager() != nullptr) {
+            auto read_ahead_stream =
+                    std::make_unique<PageReadAheadStream>(rfile->stream(), pool, config::column_read_ahead_max_pages,
+                                                          config::column_read_ahead_max_buffer_size);
+            iter_opts.read_file = read_ahead_stream.get();
+            _column_files[cid] = std::move(read_ahead_stream);
+            _read_ahead_column_index.emplace_back(cid);
         } else {
             iter_opts.read_file = rfile.get();
             _column_files[cid] = std::move(rfile);
@@ -700,6 +856,59 @@ void SegmentIterator::_init_column_predicates() {
     _non_expr_pred_tree = PredicateTree::create(std::move(non_expr_pred_root));
 }
 
+void SegmentIterator::_init_encoded_predicates() {
+    if (!config::enable_encoded_page_predicate) {
+        return;
+    }
+    // Only the predicates ANDed at the root can remove the rows before the other predicates are evaluated.
+    for (const auto& [cid, preds] : _non_expr_pred_tree.get_immediate_column_predicate_map()) {
+        if (_column_iterators[cid] == nullptr) {
+            continue;
+        }
+        for (const ColumnPredicate* pred : preds) {
+            switch (pred->type()) {
+            case PredicateType::kEQ:
+            case PredicateType::kNE:
+            case PredicateType::kGT:
+            case PredicateType::kGE:
+            case PredicateType::kLT:
+            case PredicateType::kLE:
+                _encoded_predicates.emplace_back(pred);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+void SegmentIterator::_init_predicate_columns() {
+    if (!config::enable_adaptive_predicate_order || _opts.prune_column_after_index_filter ||
+        !_predicate_column_access_paths.empty() || !_non_expr_pred_tree.root().compound_children().empty()) {
+        return;
+    }
+    ColumnPredicateMap pred_map = _non_expr_pred_tree.get_immediate_column_predicate_map();
+    if (pred_map.size() < 2) {
+        return;
+    }
+    std::vector<FieldPtr> fields;
+    for (const FieldPtr& field : _schema.fields()) {
+        if (pred_map.count(field->id()) > 0) {
+            fields.push_back(field);
+        }
+    }
+    if (fields.size() != pred_map.size()) {
+        return;
+    }
+    for (const FieldPtr& field : fields) {
+        PredicateColumn& pred_column = _pred_columns.emplace_back();
+        pred_column.cid = field->id();
+        pred_column.predicates = std::move(pred_map[field->id()]);
+        pred_column.stats = &_opts.stats->predicate_column_stats[std::string(field->name())];
+        _pred_column_order.push_back(_pred_column_order.size());
+    }
+}
+
 Status SegmentIterator::_get_row_ranges_by_keys() {
     if (_opts.is_first_split_of_segment) {
         StarRocksMetrics::instance()->segment_row_total.increment(num_rows());
@@ -1079,17 +1288,34 @@ inline Status SegmentIterator::_read(Chunk* chunk, vector<rowid_t>* rowids, size
     size_t read_num = 0;
     SparseRange<> range;
 
-    if (_cur_rowid != _range_iter.begin() || _cur_rowid == 0) {
-        _cur_rowid = _range_iter.begin();
-        _opts.stats->block_seek_num += 1;
-        SCOPED_RAW_TIMER(&_opts.stats->block_seek_ns);
-        RETURN_IF_ERROR(_context->seek_columns(_cur_rowid));
-    }
-
+    bool need_seek = _cur_rowid != _range_iter.begin() || _cur_rowid == 0;
     _range_iter.next_range(n, &range);
     read_num += range.span_size();
 
-    {
+    if (!_encoded_predicates.empty()) {
+        RETURN_IF_ERROR(_filter_by_encoded_predicates(&range));
+        // The predicate columns have been moved by the evaluation.
+        need_seek = true;
+        if (range.empty()) {
+            // Set to 0 to seek the columns in the next read.
+            _cur_rowid = 0;
+            _opts.stats->raw_rows_read += read_num;
+            return Status::OK();
+        }
+    }
+
+    if (!_pred_columns.empty()) {
+        _opts.stats->blocks_load += 1;
+        RETURN_IF_ERROR(_read_by_predicate_order(chunk, &range));
+        chunk->check_or_die();
+    } else {
+        if (need_seek) {
+            _cur_rowid = range.begin();
+            _opts.stats->block_seek_num += 1;
+            SCOPED_RAW_TIMER(&_opts.stats->block_seek_ns);
+            RETURN_IF_ERROR(_context->seek_columns(_cur_rowid));
+        }
+
         _opts.stats->blocks_load += 1;
         SCOPED_RAW_TIMER(&_opts.stats->block_fetch_ns);
         RETURN_IF_ERROR(_context->read_columns(chunk, range));
@@ -1107,7 +1333,8 @@ inline Status SegmentIterator::_read(Chunk* chunk, vector<rowid_t>* rowids, size
         }
     }
 
-    _cur_rowid = range.end();
+    // The columns read by `_read_by_predicate_order` stop at different rows, set to 0 to seek them in the next read.
+    _cur_rowid = _pred_columns.empty() ? range.end() : 0;
     _opts.stats->raw_rows_read += read_num;
     chunk->check_or_die();
     return Status::OK();
@@ -1179,7 +1406,8 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
 
     const uint32_t chunk_capacity = _reserve_chunk_size;
     const uint32_t return_chunk_threshold = std::max<uint32_t>(chunk_capacity - chunk_capacity / 4, 1);
-    const bool has_non_expr_predicate = !_non_expr_pred_tree.empty();
+    // The predicates of `_pred_columns` have been evaluated by `_read_by_predicate_order`.
+    const bool has_non_expr_predicate = !_non_expr_pred_tree.empty() && _pred_columns.empty();
     const bool scan_range_normalized = _scan_range.is_sorted();
     const int64_t prev_raw_rows_read = _opts.stats->raw_rows_read;
 
@@ -1288,9 +1516,11 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
 
 Status SegmentIterator::_switch_context(ScanContext* to) {
     if (_context != nullptr) {
-        const ordinal_t ordinal = _context->_column_iterators[0]->get_current_ordinal();
-        for (ColumnIterator* iter : to->_column_iterators) {
-            RETURN_IF_ERROR(iter->seek_to_ordinal(ordinal));
+        const ordinal_t ordinal = _context->current_ordinal();
+        for (size_t i = 0; i < to->_column_iterators.size(); i++) {
+            if (!to->is_row_store_column(i)) {
+                RETURN_IF_ERROR(to->_column_iterators[i]->seek_to_ordinal(ordinal));
+            }
         }
         _context->close();
     }
@@ -1382,6 +1612,201 @@ StatusOr<uint16_t> SegmentIterator::_filter_by_non_expr_predicates(Chunk* chunk,
     return chunk_size;
 }
 
+// Returns the rows of `range` whose `selection` is not zero.
+static SparseRange<> selected_range(const SparseRange<>& range, const uint8_t* selection) {
+    SparseRange<> selected;
+    SparseRangeIterator<> iter = range.new_iterator();
+    while (iter.has_more()) {
+        Range<> r = iter.next(range.span_size());
+        rowid_t begin = r.begin();
+        for (rowid_t rowid = r.begin(); rowid < r.end(); rowid++, selection++) {
+            if (!*selection) {
+                if (begin < rowid) {
+                    selected.add(Range<>(begin, rowid));
+                }
+                begin = rowid + 1;
+            }
+        }
+        if (begin < r.end()) {
+            selected.add(Range<>(begin, r.end()));
+        }
+    }
+    return selected;
+}
+
+Status SegmentIterator::_read_by_predicate_order(Chunk* chunk, SparseRange<>* range) {
+    // Reading a range costs about as much as reading `kRangeCostRows` more rows.
+    static constexpr size_t kRangeCostRows = 8;
+    static constexpr int64_t kReorderInterval = 16;
+
+    const size_t from = chunk->num_rows();
+    const size_t num_columns = _context->_column_iterators.size();
+    const size_t num_rows = range->span_size();
+    uint8_t* selection = _selection.data();
+    // false if some rows in `range` have been filtered by the predicates but not removed from `range`.
+    bool all_selected = true;
+    bool may_has_del_row = chunk->delete_state() != DEL_NOT_SATISFIED;
+    _column_read_flags.assign(num_columns, 0);
+
+    auto read_column = [&](size_t index) -> Status {
+        ColumnIterator* iter = _context->_column_iterators[index];
+        Column* column = chunk->get_column_by_index(index).get();
+        _opts.stats->block_seek_num += 1;
+        {
+            SCOPED_RAW_TIMER(&_opts.stats->block_seek_ns);
+            RETURN_IF_ERROR(iter->seek_to_ordinal(range->begin()));
+        }
+        SCOPED_RAW_TIMER(&_opts.stats->block_fetch_ns);
+        RETURN_IF_ERROR(iter->next_batch(*range, column));
+        may_has_del_row |= (column->delete_state() != DEL_NOT_SATISFIED);
+        _column_read_flags[index] = 1;
+        return Status::OK();
+    };
+
+    for (size_t k = 0; k < _pred_columns.size(); k++) {
+        PredicateColumn& pred_column = _pred_columns[_pred_column_order[k]];
+        size_t index = 0;
+        while (_context->_read_schema.field(index)->id() != pred_column.cid) {
+            index++;
+        }
+        const size_t size = range->span_size();
+        const auto to = static_cast<uint16_t>(from + size);
+        const int64_t input_rows = all_selected ? size : SIMD::count_nonzero(selection + from, size);
+
+        MonotonicStopWatch watch;
+        watch.start();
+        RETURN_IF_ERROR(read_column(index));
+        {
+            SCOPED_RAW_TIMER(&_opts.stats->vec_cond_evaluate_ns);
+            const Column* column = chunk->get_column_by_index(index).get();
+            for (size_t i = 0; i < pred_column.predicates.size(); i++) {
+                if (i == 0 && all_selected) {
+                    RETURN_IF_ERROR(pred_column.predicates[i]->evaluate(column, selection, from, to));
+                } else {
+                    RETURN_IF_ERROR(pred_column.predicates[i]->evaluate_and(column, selection, from, to));
+                }
+            }
+        }
+        const int64_t output_rows = SIMD::count_nonzero(selection + from, size);
+        const int64_t cost_ns = watch.elapsed_time();
+        pred_column.rows_read += size;
+        pred_column.input_rows += input_rows;
+        pred_column.output_rows += output_rows;
+        pred_column.cost_ns += cost_ns;
+        pred_column.stats->input_rows += input_rows;
+        pred_column.stats->output_rows += output_rows;
+        pred_column.stats->evaluate_ns += cost_ns;
+
+        if (output_rows == 0) {
+            for (size_t i = 0; i < num_columns; i++) {
+                if (_column_read_flags[i]) {
+                    chunk->get_column_by_index(i)->resize(from);
+                }
+            }
+            *range = SparseRange<>();
+            all_selected = true;
+            break;
+        }
+        all_selected = output_rows == size;
+        const bool has_more_columns = k + 1 < _pred_columns.size() || num_columns > _pred_columns.size();
+        if (!all_selected && has_more_columns) {
+            SparseRange<> selected = selected_range(*range, selection + from);
+            if (selected.span_size() + selected.size() * kRangeCostRows < size) {
+                SCOPED_RAW_TIMER(&_opts.stats->vec_cond_chunk_copy_ns);
+                for (size_t i = 0; i < num_columns; i++) {
+                    if (_column_read_flags[i]) {
+                        chunk->get_column_by_index(i)->filter_range(_selection, from, to);
+                    }
+                }
+                *range = std::move(selected);
+                all_selected = true;
+            }
+        }
+    }
+
+    if (!range->empty()) {
+        for (size_t i = 0; i < num_columns; i++) {
+            if (!_column_read_flags[i] && !_context->is_row_store_column(i)) {
+                RETURN_IF_ERROR(read_column(i));
+            }
+        }
+        if (!_context->_row_store_indexes.empty()) {
+            SCOPED_RAW_TIMER(&_opts.stats->block_fetch_ns);
+            RETURN_IF_ERROR(_context->read_row_store_columns(chunk, *range));
+        }
+        if (!all_selected) {
+            SCOPED_RAW_TIMER(&_opts.stats->vec_cond_chunk_copy_ns);
+            const size_t size = range->span_size();
+            *range = selected_range(*range, selection + from);
+            chunk->filter_range(_selection, from, from + size);
+        }
+    }
+    chunk->set_delete_state(may_has_del_row ? DEL_PARTIAL_SATISFIED : DEL_NOT_SATISFIED);
+    _opts.stats->rows_vec_cond_filtered += num_rows - range->span_size();
+
+    if (++_predicate_order_reads % kReorderInterval == 0) {
+        _reorder_predicate_columns();
+    }
+    return Status::OK();
+}
+
+void SegmentIterator::_reorder_predicate_columns() {
+    for (PredicateColumn& pred_column : _pred_columns) {
+        // The rank of the columns not read since the last reordering is kept.
+        if (pred_column.input_rows > 0) {
+            const double cost_per_row = static_cast<double>(pred_column.cost_ns) / pred_column.rows_read;
+            const double filtered_ratio = 1.0 - static_cast<double>(pred_column.output_rows) / pred_column.input_rows;
+            pred_column.rank = cost_per_row / std::max(filtered_ratio, 1e-6);
+        }
+        pred_column.rows_read = 0;
+        pred_column.input_rows = 0;
+        pred_column.output_rows = 0;
+        pred_column.cost_ns = 0;
+    }
+    std::stable_sort(_pred_column_order.begin(), _pred_column_order.end(),
+                     [&](size_t lhs, size_t rhs) { return _pred_columns[lhs].rank < _pred_columns[rhs].rank; });
+}
+
+Status SegmentIterator::_filter_by_encoded_predicates(SparseRange<>* range) {
+    SCOPED_RAW_TIMER(&_opts.stats->encoded_pred_evaluate_ns);
+    const size_t size = range->span_size();
+    _encoded_selection.resize(size);
+    _encoded_selection_tmp.resize(size);
+
+    bool evaluated = false;
+    for (size_t i = 0; i < _encoded_predicates.size();) {
+        const ColumnPredicate* pred = _encoded_predicates[i];
+        uint8_t* selection = evaluated ? _encoded_selection_tmp.data() : _encoded_selection.data();
+        Status st = _column_iterators[pred->column_id()]->evaluate_on_encoded_pages(*pred, *range, selection);
+        if (st.is_not_supported()) {
+            // e.g. the pages are not encoded by BIT_SHUFFLE, FOR_ENCODING or RLE.
+            _encoded_predicates.erase(_encoded_predicates.begin() + i);
+            continue;
+        }
+        RETURN_IF_ERROR(st);
+        if (evaluated) {
+            for (size_t j = 0; j < size; j++) {
+                _encoded_selection[j] &= selection[j];
+            }
+        }
+        evaluated = true;
+        i++;
+    }
+    if (!evaluated) {
+        return Status::OK();
+    }
+
+    SparseRange<> filtered = selected_range(*range, _encoded_selection.data());
+    // Reading too many small ranges costs more than filtering the rows after they are read.
+    static constexpr size_t kMinAvgRangeSize = 8;
+    if (!filtered.empty() && filtered.span_size() < filtered.size() * kMinAvgRangeSize) {
+        return Status::OK();
+    }
+    _opts.stats->rows_encoded_pred_filtered += size - filtered.span_size();
+    *range = std::move(filtered);
+    return Status::OK();
+}
+
 StatusOr<uint16_t> SegmentIterator::_filter_by_expr_predicates(Chunk* chunk, vector<rowid_t>* rowid) {
     size_t chunk_size = chunk->num_rows();
     if (chunk_size > 0 && !_expr_pred_tree.empty()) {
@@ -1528,6 +1953,24 @@ Status SegmentIterator::_build_context(ScanContext* ctx) {
         }
     }
 
+    if (!_row_store_columns.empty()) {
+        std::vector<std::pair<uint32_t, size_t>> row_store_columns;
+        for (size_t i = 0; i < early_materialize_fields; i++) {
+            auto iter = _row_store_columns.find(_schema.field(i)->id());
+            if (iter != _row_store_columns.end() && !ctx->_prune_cols.count(i)) {
+                row_store_columns.emplace_back(iter->second, i);
+            }
+        }
+        std::sort(row_store_columns.begin(), row_store_columns.end());
+        ctx->_row_store = &_row_store;
+        ctx->_is_row_store_column.resize(ctx_fields, false);
+        for (const auto& [segment_cid, index] : row_store_columns) {
+            ctx->_row_store_column_ids.emplace_back(segment_cid);
+            ctx->_row_store_indexes.emplace_back(index);
+            ctx->_is_row_store_column[index] = true;
+        }
+    }
+
     size_t build_read_index_size = ctx->_read_schema.num_fields();
     if (late_materialization && (predicate_count < _schema.num_fields() || !ctx->_subfield_columns.empty())) {
         // ordinal column
@@ -1585,6 +2028,85 @@ Status SegmentIterator::_build_context(ScanContext* ctx) {
     return Status::OK();
 }
 
+Status SegmentIterator::_init_row_store_columns() {
+    if (!config::enable_hybrid_row_column_scan || !_opts.is_primary_keys || _opts.tablet_schema == nullptr ||
+        _segment->lake_tablet_manager() != nullptr || _scan_range.empty()) {
+        return Status::OK();
+    }
+    const TabletSchema& read_schema = *_opts.tablet_schema;
+    const TabletSchema& segment_schema = _segment->tablet_schema();
+    if (read_schema.num_columns() == 0 || read_schema.columns().back().name() != Schema::FULL_ROW_COLUMN ||
+        segment_schema.num_columns() == 0 || segment_schema.columns().back().name() != Schema::FULL_ROW_COLUMN) {
+        return Status::OK();
+    }
+    const ColumnId row_cid = read_schema.num_columns() - 1;
+    const ColumnUID row_uid = read_schema.column(row_cid).unique_id();
+    ColumnReader* row_reader = _segment->column_with_uid(row_uid);
+    if (row_reader == nullptr) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(auto row_dcg_segment, _get_dcg_segment(row_uid));
+    if (row_dcg_segment != nullptr) {
+        return Status::OK();
+    }
+
+    // The bytes of a column read for the ranges to scan: a page for each range at least, the whole column at most.
+    const double selectivity = static_cast<double>(_scan_range.span_size()) / num_rows();
+    const size_t num_ranges = _scan_range.size();
+    auto read_bytes = [&](ColumnReader* reader) {
+        const auto total = static_cast<double>(reader->total_mem_footprint());
+        const double page = total / std::max(1, reader->num_data_pages());
+        return std::min(total, total * selectivity + page * num_ranges);
+    };
+
+    // Only the value columns read after the predicates, in the values not the dictionary codes, are candidates.
+    std::vector<std::pair<ColumnId, uint32_t>> candidates;
+    double column_bytes = 0;
+    for (size_t i = _predicate_columns; i < _schema.num_fields(); i++) {
+        const FieldPtr& f = _schema.field(i);
+        const ColumnId cid = f->id();
+        if (cid == row_cid) {
+            return Status::OK();
+        }
+        if (cid < read_schema.num_key_columns() || _opts.global_dictmaps->count(cid) ||
+            _column_access_paths.count(cid) || _can_using_dict_code(f)) {
+            continue;
+        }
+        const int32_t segment_cid = segment_schema.field_index(f->uid());
+        ColumnReader* reader = _segment->column_with_uid(f->uid());
+        if (segment_cid < 0 || reader == nullptr || segment_schema.column(segment_cid).type() != f->type()->type()) {
+            continue;
+        }
+        ASSIGN_OR_RETURN(auto dcg_segment, _get_dcg_segment(f->uid()));
+        if (dcg_segment != nullptr) {
+            continue;
+        }
+        candidates.emplace_back(cid, segment_cid);
+        column_bytes += read_bytes(reader);
+    }
+    if (candidates.empty()) {
+        return Status::OK();
+    }
+
+    // The iterator loads the ordinal index, which the number of pages of the row column is known from.
+    _column_iterators.resize(std::max<size_t>(_column_iterators.size(), row_cid + 1));
+    RETURN_IF_ERROR(_init_column_iterator_by_cid(row_cid, row_uid, false));
+    const double row_cost = read_bytes(row_reader) * config::hybrid_row_column_scan_decode_cost_ratio;
+    if (row_cost >= column_bytes) {
+        _column_iterators[row_cid].reset();
+        _column_files.erase(row_cid);
+        return Status::OK();
+    }
+
+    _row_store.iterator = _column_iterators[row_cid].get();
+    _row_store.schema = segment_schema.schema();
+    _row_store.encoder = RowStoreEncoderFactory::instance()->get_or_create_encoder(SIMPLE);
+    _row_store.stats = _opts.stats;
+    _row_store_columns.insert(candidates.begin(), candidates.end());
+    _opts.stats->row_store_segments += 1;
+    return Status::OK();
+}
+
 Status SegmentIterator::_init_context() {
     _late_materialization_ratio = config::late_materialization_ratio;
 
@@ -1729,6 +2251,7 @@ Status SegmentIterator::_finish_late_materialization(ScanContext* ctx) {
     if (_predicate_columns < _schema.num_fields()) {
         const size_t n = _schema.num_fields();
         const size_t start_pos = ctx->_read_index_map.size();
+        std::vector<std::pair<uint32_t, Column*>> row_store_columns;
         for (size_t i = m - 1, j = start_pos; i < n; i++, j++) {
             const FieldPtr& f = _schema.field(i);
             const ColumnId cid = f->id();
@@ -1736,10 +2259,27 @@ Status SegmentIterator::_finish_late_materialization(ScanContext* ctx) {
             col->reserve(ordinals->size());
             col->resize(0);
 
+            if (auto iter = _row_store_columns.find(cid); iter != _row_store_columns.end()) {
+                row_store_columns.emplace_back(iter->second, col.get());
+                continue;
+            }
             RETURN_IF_ERROR(_column_decoders[cid].decode_values_by_rowid(*ordinals, col.get()));
             DCHECK_EQ(ordinals->size(), col->size());
             may_has_del_row |= (col->delete_state() != DEL_NOT_SATISFIED);
         }
+
+        if (!row_store_columns.empty()) {
+            std::sort(row_store_columns.begin(), row_store_columns.end());
+            std::vector<uint32_t> column_ids;
+            std::vector<Column*> dest;
+            for (const auto& [segment_cid, col] : row_store_columns) {
+                column_ids.emplace_back(segment_cid);
+                dest.emplace_back(col);
+            }
+            _row_store.rows.reset_column();
+            RETURN_IF_ERROR(_row_store.iterator->fetch_values_by_rowid(*ordinals, &_row_store.rows));
+            RETURN_IF_ERROR(_row_store.decode(column_ids, dest));
+        }
     }
 
     // fill subfield of early materialization columns
@@ -1797,28 +2337,85 @@ Status SegmentIterator::_init_bitmap_index_iterators() {
     for (const auto& pair : _cid_to_predicates) {
         ColumnId cid = pair.first;
         if (_bitmap_index_iterators[cid] == nullptr) {
-            ColumnUID ucid = cid_2_ucid[cid];
-            // the column's index in this segment file
-            ASSIGN_OR_RETURN(std::shared_ptr<Segment> segment_ptr, _get_dcg_segment(ucid));
-            if (segment_ptr == nullptr) {
-                // find segment from delta column group failed, using main segment
-                segment_ptr = _segment;
-            }
-
-            IndexReadOptions opts;
-            opts.use_page_cache = config::enable_bitmap_index_memory_page_cache || !config::disable_storage_page_cache;
-            opts.kept_in_memory = config::enable_bitmap_index_memory_page_cache;
-            opts.lake_io_opts = _opts.lake_io_opts;
-            opts.read_file = _column_files[cid].get();
-            opts.stats = _opts.stats;
-
-            RETURN_IF_ERROR(segment_ptr->new_bitmap_index_iterator(ucid, opts, &_bitmap_index_iterators[cid]));
-            _has_bitmap_index |= (_bitmap_index_iterators[cid] != nullptr);
+            RETURN_IF_ERROR(_init_bitmap_index_iterator(cid, cid_2_ucid[cid]));
         }
     }
     return Status::OK();
 }
 
+Status SegmentIterator::_init_bitmap_index_iterator(ColumnId cid, ColumnUID ucid) {
+    // the column's index in this segment file
+    ASSIGN_OR_RETURN(std::shared_ptr<Segment> segment_ptr, _get_dcg_segment(ucid));
+    if (segment_ptr == nullptr) {
+        // find segment from delta column group failed, using main segment
+        segment_ptr = _segment;
+    }
+
+    IndexReadOptions opts;
+    opts.use_page_cache = config::enable_bitmap_index_memory_page_cache || !config::disable_storage_page_cache;
+    opts.kept_in_memory = config::enable_bitmap_index_memory_page_cache;
+    opts.lake_io_opts = _opts.lake_io_opts;
+    opts.read_file = _column_files[cid].get();
+    opts.stats = _opts.stats;
+
+    RETURN_IF_ERROR(segment_ptr->new_bitmap_index_iterator(ucid, opts, &_bitmap_index_iterators[cid]));
+    _has_bitmap_index |= (_bitmap_index_iterators[cid] != nullptr);
+    return Status::OK();
+}
+
+// The runtime filters of the exact sets, e.g. of the small dimension tables, are pushed down as IN predicates,
+// seek them in the bitmap index of the column if it has one. Return false if the bitmap index is not used.
+StatusOr<bool> SegmentIterator::_get_row_ranges_by_runtime_bitmap_index(ColumnId cid,
+                                                                        const PredicateList& predicates,
+                                                                        SparseRange<>* row_ranges) {
+    if (!config::enable_index_bitmap_filter) {
+        return false;
+    }
+    bool has_in_predicate = std::any_of(predicates.begin(), predicates.end(),
+                                        [](const auto* pred) { return pred->type() == PredicateType::kInList; });
+    if (!has_in_predicate) {
+        return false;
+    }
+    if (_bitmap_index_iterators.size() <= cid) {
+        _bitmap_index_iterators.resize(ChunkHelper::max_column_id(_schema) + 1, nullptr);
+    }
+    if (_bitmap_index_iterators[cid] == nullptr) {
+        auto tablet_schema = _opts.tablet_schema ? _opts.tablet_schema : _segment->tablet_schema_share_ptr();
+        RETURN_IF_ERROR(_init_bitmap_index_iterator(cid, tablet_schema->column(cid).unique_id()));
+    }
+    BitmapIndexIterator* bitmap_iter = _bitmap_index_iterators[cid];
+    if (bitmap_iter == nullptr) {
+        return false;
+    }
+
+    SCOPED_RAW_TIMER(&_opts.stats->bitmap_index_filter_timer);
+    size_t cardinality = bitmap_iter->bitmap_nums();
+    SparseRange<> selected(0, cardinality);
+    for (const ColumnPredicate* pred : predicates) {
+        SparseRange<> r;
+        Status st = pred->seek_bitmap_dictionary(bitmap_iter, &r);
+        if (st.ok()) {
+            selected &= r;
+        } else if (!st.is_cancelled()) {
+            return st;
+        }
+    }
+    // same selectivity estimation as _apply_bitmap_index
+    if (selected.span_size() * 1000 > cardinality * config::bitmap_max_filter_ratio) {
+        return false;
+    }
+
+    Roaring roaring;
+    RETURN_IF_ERROR(bitmap_iter->read_union_bitmap(selected, &roaring));
+    if (bitmap_iter->has_null_bitmap()) {
+        Roaring null_bitmap;
+        RETURN_IF_ERROR(bitmap_iter->read_null_bitmap(&null_bitmap));
+        roaring -= null_bitmap;
+    }
+    *row_ranges = roaring2range(roaring);
+    return true;
+}
+
 static void erase_column_pred_from_pred_tree(PredicateTree& pred_tree,
                                              const std::unordered_set<const ColumnPredicate*>& erased_preds) {
     PredicateAndNode new_root;
@@ -1962,6 +2559,36 @@ Status SegmentIterator::_init_inverted_index_iterators() {
     return Status::OK();
 }
 
+Status SegmentIterator::_apply_vector_index() {
+    RETURN_IF(_scan_range.empty(), Status::OK());
+    RETURN_IF(_opts.vector_search_option == nullptr, Status::OK());
+    // The rows filtered by the predicates evaluated later would leave fewer than k rows, so the segment is
+    // scanned as a whole.
+    RETURN_IF(!_opts.pred_tree.empty() || !_opts.delete_predicates.empty(), Status::OK());
+
+    const VectorSearchOption& option = *_opts.vector_search_option;
+    const VectorIndexReader* reader = nullptr;
+    std::shared_ptr<TabletIndex> index_meta;
+    RETURN_IF_ERROR(_segment->get_vector_index(option.column_unique_id, _opts, &reader, &index_meta));
+    // the segments written before the index was created, or without the index file, are scanned as a whole
+    RETURN_IF(reader == nullptr, Status::OK());
+    SCOPED_RAW_TIMER(&_opts.stats->vector_index_filter_ns);
+
+    ASSIGN_OR_RETURN(auto index_options, get_vector_index_options(*index_meta));
+    const size_t nprobe = option.nprobe > 0 ? option.nprobe : index_options.nprobe;
+    std::vector<std::pair<rowid_t, float>> nearest;
+    RETURN_IF_ERROR(reader->search(option.query_vector, option.k, nprobe, range2roaring(_scan_range), &nearest));
+
+    roaring::Roaring row_bitmap;
+    for (const auto& [rowid, distance] : nearest) {
+        row_bitmap.add(rowid);
+    }
+    size_t input_rows = _scan_range.span_size();
+    _scan_range = roaring2range(row_bitmap);
+    _opts.stats->rows_vector_index_filtered += input_rows - _scan_range.span_size();
+    return Status::OK();
+}
+
 Status SegmentIterator::_apply_inverted_index() {
     RETURN_IF(_scan_range.empty(), Status::OK());
     RETURN_IF(!_opts.enable_gin_filter, Status::OK());
@@ -2113,6 +2740,9 @@ Status SegmentIterator::_get_row_ranges_by_bloom_filter() {
     RETURN_IF(_scan_range.empty(), Status::OK());
     RETURN_IF(_opts.pred_tree.empty(), Status::OK());
 
+    if (_opts.index_prefetch != nullptr) {
+        _opts.index_prefetch->wait(_opts.stats);
+    }
     SCOPED_RAW_TIMER(&_opts.stats->bf_filter_ns);
 
     std::unordered_set<const PredicateBaseNode*> used_nodes;
@@ -2211,6 +2841,12 @@ void SegmentIterator::_update_stats(io::SeekableInputStream* rfile) {
             _opts.stats->prefetch_wait_finish_ns += value;
         } else if (name == kPrefetchPendingNs) {
             _opts.stats->prefetch_pending_ns += value;
+        } else if (name == kReadAheadCount) {
+            _opts.stats->read_ahead_count += value;
+        } else if (name == kReadAheadHitCount) {
+            _opts.stats->read_ahead_hit_count += value;
+        } else if (name == kReadAheadWaitNs) {
+            _opts.stats->read_ahead_wait_ns += value;
         }
     }
 }
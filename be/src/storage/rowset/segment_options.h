@@ -26,8 +26,10 @@
 #include "storage/olap_runtime_range_pruner.h"
 #include "storage/options.h"
 #include "storage/predicate_tree/predicate_tree.hpp"
+#include "storage/rowset/index_prefetcher.h"
 #include "storage/seek_range.h"
 #include "storage/tablet_schema.h"
+#include "storage/vector_index/vector_index_option.h"
 
 namespace starrocks {
 class Condition;
@@ -103,6 +105,11 @@ public:
 
     bool prune_column_after_index_filter = false;
     bool enable_gin_filter = false;
+    // The top-k search in the vector index, only the rows found are read.
+    VectorSearchOptionPtr vector_search_option = nullptr;
+
+    // The bloom filter indexes prefetched in the background, waited for before the bloom filters are evaluated.
+    IndexPrefetcher::TaskPtr index_prefetch;
 
 public:
     Status convert_to(SegmentReadOptions* dst, const std::vector<LogicalType>& new_types, ObjectPool* obj_pool) const;
@@ -45,6 +45,7 @@
 #include "common/logging.h" // LOG
 #include "fs/fs.h"          // FileSystem
 #include "gen_cpp/segment.pb.h"
+#include "storage/chunk_helper.h"
 #include "storage/inverted/index_descriptor.hpp"
 #include "storage/row_store_encoder.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
@@ -179,6 +180,16 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
                                                                    _opts.segment_file_mark.rowset_id, _segment_id,
                                                                    opts.tablet_index.at(GIN).index_id()));
         }
+        opts.need_vector_index = _tablet_schema->has_index(column.unique_id(), VECTOR);
+        if (opts.need_vector_index) {
+            if (column.type() != LogicalType::TYPE_ARRAY || column.subcolumn(0).type() != LogicalType::TYPE_FLOAT) {
+                return Status::NotSupported("Vector index only supports ARRAY<FLOAT> columns");
+            }
+            opts.standalone_index_file_paths.emplace(
+                    VECTOR, IndexDescriptor::vector_index_file_path(_opts.segment_file_mark.rowset_path_prefix,
+                                                                    _opts.segment_file_mark.rowset_id, _segment_id,
+                                                                    opts.tablet_index.at(VECTOR).index_id()));
+        }
 
         if (column.type() == LogicalType::TYPE_ARRAY) {
             if (opts.need_bloom_filter) {
@@ -294,6 +305,7 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
         RETURN_IF_ERROR(column_writer->write_bitmap_index());
         RETURN_IF_ERROR(column_writer->write_bloom_filter_index());
         RETURN_IF_ERROR(column_writer->write_inverted_index());
+        RETURN_IF_ERROR(column_writer->write_vector_index());
         *index_size += _wfile->size() - index_offset;
 
         // check global dict valid
@@ -372,10 +384,15 @@ Status SegmentWriter::_write_raw_data(const std::vector<Slice>& slices) {
 Status SegmentWriter::append_chunk(const Chunk& chunk) {
     size_t chunk_num_rows = chunk.num_rows();
     size_t chunk_num_columns = chunk.num_columns();
-    for (size_t i = 0; i < chunk_num_columns; ++i) {
-        const Column* col = chunk.get_column_by_index(i).get();
-        RETURN_IF_ERROR(_column_writers[i]->append(*col));
-    }
+    // The pages are encoded and compressed in memory by the appends, and written to the file in column order by
+    // finalize_columns(), so the column writers can append in parallel without changing the layout of the file.
+    RETURN_IF_ERROR(ChunkHelper::parallel_for_columns(chunk_num_columns, [&](size_t begin, size_t end) -> Status {
+        for (size_t i = begin; i < end; ++i) {
+            const Column* col = chunk.get_column_by_index(i).get();
+            RETURN_IF_ERROR(_column_writers[i]->append(*col));
+        }
+        return Status::OK();
+    }));
 
     // TODO(cbl): put the fill full row column logic here is a bit hacky, this segment writer is used in many other
     //            situations(compaction etc.), so better to put it into somewhere early in the write pipeline
@@ -133,6 +133,9 @@ DataDecoder* DataDecoder::get_data_decoder(EncodingTypePB encoding) {
         return &g_binary_dict_decoder;
     }
     case FOR_ENCODING:
+    case ALP_ENCODING:
+    case FSST_ENCODING:
+    case DELTA_ENCODING:
     case PLAIN_ENCODING:
     case PREFIX_ENCODING:
     case RLE: {
@@ -169,6 +172,9 @@ Status StoragePageDecoder::decode_page(PageFooterPB* footer, uint32_t footer_siz
         DCHECK(footer->dict_page_footer().encoding() == BIT_SHUFFLE);
         return g_dict_dict_decoder.decode_page_data(footer, footer_size, encoding, page, page_slice);
     case DATA_PAGE: {
+        if (footer->data_page_footer().has_encoding()) {
+            encoding = footer->data_page_footer().encoding();
+        }
         DataDecoder* decoder = DataDecoder::get_data_decoder(encoding);
         if (decoder == nullptr) {
             std::stringstream ss;
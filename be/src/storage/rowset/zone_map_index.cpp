@@ -36,8 +36,13 @@
 
 #include <bthread/sys_futex.h>
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
+#include "common/config.h"
 #include "storage/chunk_helper.h"
 #include "storage/decimal_type_info.h"
 #include "storage/olap_define.h"
@@ -134,6 +139,27 @@ struct ZoneMap {
     }
 };
 
+// The values sampled for the histogram of a segment, the strings are copied as the values added are not kept.
+template <LogicalType type>
+struct ZoneMapSample {
+    using CppType = typename TypeTraits<type>::CppType;
+    using ValueType = CppType;
+
+    static ValueType copy(const CppType& value) { return value; }
+    static CppType view(const ValueType& value) { return value; }
+};
+
+template <>
+struct ZoneMapSample<TYPE_CHAR> {
+    using ValueType = std::string;
+
+    static ValueType copy(const Slice& value) { return value.to_string(); }
+    static Slice view(const ValueType& value) { return Slice(value); }
+};
+
+template <>
+struct ZoneMapSample<TYPE_VARCHAR> : public ZoneMapSample<TYPE_CHAR> {};
+
 template <LogicalType type>
 class ZoneMapIndexWriterImpl final : public ZoneMapIndexWriter {
     using CppType = typename TypeTraits<type>::CppType;
@@ -155,6 +181,15 @@ public:
     uint64_t size() const override { return _estimated_size; }
 
 private:
+    using SampleType = typename ZoneMapSample<type>::ValueType;
+
+    static constexpr size_t kHistogramSampleSize = 4096;
+
+    // Reservoir sampling of the not-null values of the segment.
+    void _sample_values(const CppType* values, size_t count);
+
+    void _build_histogram(ZoneMapHistogramPB* histogram);
+
     void _reset_zone_map(ZoneMap<type>* zone_map) {
         // we should allocate max varchar length and set to max for min value
         zone_map->min_value.reset(_type_info);
@@ -171,10 +206,17 @@ private:
     // serialized ZoneMapPB for each data page
     std::vector<std::string> _values;
     uint64_t _estimated_size = 0;
+
+    // the number of buckets of the segment histogram, 0 if it is not built
+    const int32_t _histogram_buckets;
+    std::vector<SampleType> _samples;
+    uint64_t _num_not_null = 0;
+    std::minstd_rand _rand;
 };
 
 template <LogicalType type>
-ZoneMapIndexWriterImpl<type>::ZoneMapIndexWriterImpl(TypeInfo* type_info) : _type_info(type_info) {
+ZoneMapIndexWriterImpl<type>::ZoneMapIndexWriterImpl(TypeInfo* type_info)
+        : _type_info(type_info), _histogram_buckets(std::max(config::segment_zone_map_histogram_buckets, 0)) {
     _reset_zone_map(&_page_zone_map);
     _reset_zone_map(&_segment_zone_map);
 }
@@ -202,6 +244,63 @@ void ZoneMapIndexWriterImpl<type>::add_values(const void* values, size_t count)
             _type_info->direct_copy(&_page_zone_map.max_value.value, pmax);
         }
         _page_zone_map.has_not_null = true;
+        if (_histogram_buckets > 0) {
+            _sample_values(vals, count);
+        }
+    }
+}
+
+template <LogicalType type>
+void ZoneMapIndexWriterImpl<type>::_sample_values(const CppType* values, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if constexpr (std::is_floating_point_v<CppType>) {
+            // NaN is not ordered for sorting the samples
+            if (std::isnan(unaligned_load<CppType>(values + i))) {
+                continue;
+            }
+        }
+        _num_not_null++;
+        if (_samples.size() < kHistogramSampleSize) {
+            _samples.emplace_back(ZoneMapSample<type>::copy(unaligned_load<CppType>(values + i)));
+            continue;
+        }
+        const uint64_t pos = _rand() % _num_not_null;
+        if (pos < kHistogramSampleSize) {
+            _samples[pos] = ZoneMapSample<type>::copy(unaligned_load<CppType>(values + i));
+        }
+    }
+}
+
+// The equi-depth buckets split the sorted samples evenly, and the counts of the segment are scaled from the
+// samples. Buckets with the same upper bound, e.g. of a frequent value, are merged.
+template <LogicalType type>
+void ZoneMapIndexWriterImpl<type>::_build_histogram(ZoneMapHistogramPB* histogram) {
+    std::sort(_samples.begin(), _samples.end());
+    const size_t num_samples = _samples.size();
+    const size_t num_buckets = std::min<size_t>(_histogram_buckets, num_samples);
+    const double scale = static_cast<double>(_num_not_null) / num_samples;
+    size_t prev_end = 0;
+    ZoneMapDatum<type> bound;
+    for (size_t b = 1; b <= num_buckets; b++) {
+        size_t end = b * num_samples / num_buckets;
+        // the bucket ends after all the samples equal to its upper bound
+        while (end < num_samples && !(_samples[end - 1] < _samples[end])) {
+            end++;
+        }
+        if (end <= prev_end) {
+            continue;
+        }
+        if (end == num_samples) {
+            // the last bucket ends at the max of the segment, which may not be sampled
+            histogram->add_upper_bounds(_segment_zone_map.max_value.to_zone_map_string(_type_info));
+        } else {
+            const auto value = ZoneMapSample<type>::view(_samples[end - 1]);
+            bound.resize_container_for_fit(_type_info, &value);
+            _type_info->direct_copy(&bound.value, &value);
+            histogram->add_upper_bounds(bound.to_zone_map_string(_type_info));
+        }
+        histogram->add_counts(static_cast<uint64_t>((end - prev_end) * scale + 0.5));
+        prev_end = end;
     }
 }
 
@@ -263,6 +362,9 @@ Status ZoneMapIndexWriterImpl<type>::finish(WritableFile* wfile, ColumnIndexMeta
     ZoneMapIndexPB* meta = index_meta->mutable_zone_map_index();
     // store segment zone map
     _segment_zone_map.to_proto(meta->mutable_segment_zone_map(), _type_info);
+    if (!_samples.empty()) {
+        _build_histogram(meta->mutable_segment_zone_map()->mutable_histogram());
+    }
 
     // write out zone map for each data pages
     TypeInfoPtr typeinfo = get_type_info(TYPE_OBJECT);
@@ -309,9 +411,10 @@ Status ZoneMapIndexReader::_do_load(const IndexReadOptions& opts, const ZoneMapI
     std::unique_ptr<IndexedColumnIterator> iter;
     RETURN_IF_ERROR(reader.new_iterator(opts, &iter));
 
-    _page_zone_maps.resize(reader.num_values());
+    _pages.resize(reader.num_values());
 
     auto column = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+    ZoneMapPB zone_map;
     // read and cache all page zone maps
     for (int i = 0; i < reader.num_values(); ++i) {
         RETURN_IF_ERROR(iter->seek_to_ordinal(i));
@@ -322,31 +425,54 @@ Status ZoneMapIndexReader::_do_load(const IndexReadOptions& opts, const ZoneMapI
 
         ColumnViewer<TYPE_VARCHAR> viewer(column);
         auto value = viewer.value(0);
-        if (!_page_zone_maps[i].ParseFromArray(value.data, value.size)) {
+        zone_map.Clear();
+        if (!zone_map.ParseFromArray(value.data, value.size)) {
             return Status::Corruption("Failed to parse zone map");
         }
 
+        PageZoneMap& page = _pages[i];
+        page.offset = _values.size();
+        page.flags = (zone_map.has_null() ? kHasNull : 0) | (zone_map.has_not_null() ? kHasNotNull : 0);
         // Currently if the column type is varchar(length) and the values is all null,
         // a zonemap string of length will be written to the segment file,
         // causing the loaded metadata to occupy a large amount of memory.
         //
         // The main purpose of this code is to optimize the reading of segment files
         // generated by the old version.
-        if (_page_zone_maps[i].has_has_not_null() && !_page_zone_maps[i].has_not_null()) {
-            delete _page_zone_maps[i].release_min();
-            delete _page_zone_maps[i].release_max();
+        if (zone_map.has_has_not_null() && !zone_map.has_not_null()) {
+            page.min_size = 0;
+            page.max_size = 0;
+        } else {
+            page.flags |= (zone_map.has_min() ? kHasMin : 0) | (zone_map.has_max() ? kHasMax : 0);
+            page.min_size = zone_map.min().size();
+            page.max_size = zone_map.max().size();
+            _values.append(zone_map.min());
+            _values.append(zone_map.max());
         }
         column->resize(0);
     }
+    _values.shrink_to_fit();
     return Status::OK();
 }
 
-size_t ZoneMapIndexReader::mem_usage() const {
-    size_t size = sizeof(ZoneMapIndexReader);
-    for (const auto& zone_map : _page_zone_maps) {
-        size += zone_map.SpaceUsedLong();
+std::vector<ZoneMapPB> ZoneMapIndexReader::page_zone_maps() const {
+    std::vector<ZoneMapPB> zone_maps(_pages.size());
+    for (int32_t i = 0; i < num_pages(); i++) {
+        const uint8_t flags = _pages[i].flags;
+        zone_maps[i].set_has_null(flags & kHasNull);
+        zone_maps[i].set_has_not_null(flags & kHasNotNull);
+        if (flags & kHasMin) {
+            zone_maps[i].set_min(page_min(i).to_string());
+        }
+        if (flags & kHasMax) {
+            zone_maps[i].set_max(page_max(i).to_string());
+        }
     }
-    return size;
+    return zone_maps;
+}
+
+size_t ZoneMapIndexReader::mem_usage() const {
+    return sizeof(ZoneMapIndexReader) + _pages.capacity() * sizeof(PageZoneMap) + _values.capacity();
 }
 
 } // namespace starrocks
@@ -90,22 +90,48 @@ public:
     StatusOr<bool> load(const IndexReadOptions& opts, const ZoneMapIndexPB& meta);
 
     // REQUIRES: the index data has been successfully `load()`ed into memory.
-    const std::vector<ZoneMapPB>& page_zone_maps() const { return _page_zone_maps; }
+    int32_t num_pages() const { return static_cast<int32_t>(_pages.size()); }
 
     // REQUIRES: the index data has been successfully `load()`ed into memory.
-    int32_t num_pages() const { return static_cast<int32_t>(_page_zone_maps.size()); }
+    bool page_has_null(int32_t page) const { return _pages[page].flags & kHasNull; }
+    bool page_has_not_null(int32_t page) const { return _pages[page].flags & kHasNotNull; }
+    // The min and the max not-null value of the page, empty without not-null values.
+    Slice page_min(int32_t page) const { return {_values.data() + _pages[page].offset, _pages[page].min_size}; }
+    Slice page_max(int32_t page) const {
+        return {_values.data() + _pages[page].offset + _pages[page].min_size, _pages[page].max_size};
+    }
+
+    // Rebuilds the ZoneMapPB of each page, for tests and debugging.
+    std::vector<ZoneMapPB> page_zone_maps() const;
 
     bool loaded() const { return invoked(_load_once); }
 
     size_t mem_usage() const;
 
 private:
-    void _reset() { std::vector<ZoneMapPB>{}.swap(_page_zone_maps); }
+    // The page zone maps are kept flat instead of as one ZoneMapPB per page: the min and the max values of all
+    // the pages are in `_values`, and a page takes 16 bytes besides its values.
+    struct PageZoneMap {
+        uint32_t offset;
+        uint32_t min_size;
+        uint32_t max_size;
+        uint8_t flags;
+    };
+    static constexpr uint8_t kHasNull = 1;
+    static constexpr uint8_t kHasNotNull = 2;
+    static constexpr uint8_t kHasMin = 4;
+    static constexpr uint8_t kHasMax = 8;
+
+    void _reset() {
+        std::vector<PageZoneMap>{}.swap(_pages);
+        std::string{}.swap(_values);
+    }
 
     Status _do_load(const IndexReadOptions& opts, const ZoneMapIndexPB& meta);
 
     OnceFlag _load_once;
-    std::vector<ZoneMapPB> _page_zone_maps;
+    std::vector<PageZoneMap> _pages;
+    std::string _values;
 };
 
 } // namespace starrocks
@@ -400,22 +400,35 @@ static void cut_rowids_in_order(const std::vector<RowidPairs>& rowid_pairs,
 Status RowsetColumnUpdateState::_update_source_chunk_by_upt(const UptidToRowidPairs& upt_id_to_rowid_pairs,
                                                             const Schema& partial_schema, Rowset* rowset,
                                                             OlapReaderStatistics* stats, MemTracker* tracker,
-                                                            ChunkPtr* source_chunk) {
+                                                            ChunkPtr* source_chunk, UptChunkCache* upt_chunk_cache) {
     // handle upt files one by one
     for (const auto& each : upt_id_to_rowid_pairs) {
         const uint32_t upt_id = each.first;
-        // 1. get chunk from upt file
-        ChunkUniquePtr upt_chunk = ChunkHelper::new_chunk(partial_schema, DEFAULT_CHUNK_SIZE);
-        ASSIGN_OR_RETURN(auto update_iterator, rowset->get_update_file_iterator(partial_schema, upt_id, stats));
-        DeferOp iter_defer([&]() {
-            if (update_iterator != nullptr) {
-                update_iterator->close();
+        // 1. get chunk from upt file, or from the cache if it has been read for the previous segments
+        ChunkPtr upt_chunk;
+        size_t uncached_size = 0;
+        if (auto iter = upt_chunk_cache->chunks.find(upt_id); iter != upt_chunk_cache->chunks.end()) {
+            upt_chunk = iter->second;
+        } else {
+            ChunkUniquePtr chunk = ChunkHelper::new_chunk(partial_schema, DEFAULT_CHUNK_SIZE);
+            ASSIGN_OR_RETURN(auto update_iterator, rowset->get_update_file_iterator(partial_schema, upt_id, stats));
+            DeferOp iter_defer([&]() {
+                if (update_iterator != nullptr) {
+                    update_iterator->close();
+                }
+            });
+            RETURN_IF_ERROR(read_chunk_from_update_file(update_iterator, chunk));
+            upt_chunk = std::move(chunk);
+            const size_t upt_chunk_size = upt_chunk->memory_usage();
+            tracker->consume(upt_chunk_size);
+            if (upt_chunk_cache->bytes + upt_chunk_size <= config::partial_update_column_mode_cache_bytes) {
+                upt_chunk_cache->chunks.emplace(upt_id, upt_chunk);
+                upt_chunk_cache->bytes += upt_chunk_size;
+            } else {
+                uncached_size = upt_chunk_size;
             }
-        });
-        RETURN_IF_ERROR(read_chunk_from_update_file(update_iterator, upt_chunk));
-        const size_t upt_chunk_size = upt_chunk->memory_usage();
-        tracker->consume(upt_chunk_size);
-        DeferOp tracker_defer([&]() { tracker->release(upt_chunk_size); });
+        }
+        DeferOp tracker_defer([&]() { tracker->release(uncached_size); });
         // 2. update source chunk
         std::vector<std::vector<uint32_t>> inorder_source_rowids;
         std::vector<std::vector<uint32_t>> inorder_upt_rowids;
@@ -684,6 +697,8 @@ Status RowsetColumnUpdateState::finalize(Tablet* tablet, Rowset* rowset, uint32_
     // 3. read from raw segment file and update file, and generate `.col` files one by one
     int idx = 0; // It is used for generate different .cols filename
     for (uint32_t col_index = 0; col_index < update_column_ids.size(); col_index += BATCH_HANDLE_COLUMN_CNT) {
+        UptChunkCache upt_chunk_cache;
+        DeferOp cache_defer([&]() { tracker->release(upt_chunk_cache.bytes); });
         for (const auto& each : rss_upt_id_to_rowid_pairs) {
             int64_t t1 = MonotonicMillis();
             // 3.1 build column id range
@@ -709,7 +724,7 @@ Status RowsetColumnUpdateState::finalize(Tablet* tablet, Rowset* rowset, uint32_
             // 3.2 read from update segment
             int64_t t2 = MonotonicMillis();
             RETURN_IF_ERROR(_update_source_chunk_by_upt(each.second, partial_schema, rowset, &stats, tracker,
-                                                        &source_chunk_ptr));
+                                                        &source_chunk_ptr, &upt_chunk_cache));
             int64_t t3 = MonotonicMillis();
             uint64_t segment_file_size = 0;
             uint64_t index_size = 0;
@@ -118,6 +118,13 @@ public:
     using DeltaColumnGroupPtr = std::shared_ptr<DeltaColumnGroup>;
     // update file id -> <source rowid, upt rowid>
     using UptidToRowidPairs = std::map<uint32_t, std::vector<RowidPairs>>;
+    // The columns of the update files read for a group of updated columns, shared by all the segments updated by
+    // them, so that each update file is read once for each group of columns instead of once for each segment.
+    struct UptChunkCache {
+        // update file id -> the rows of update file
+        std::map<uint32_t, ChunkPtr> chunks;
+        size_t bytes = 0;
+    };
 
     RowsetColumnUpdateState();
     ~RowsetColumnUpdateState();
@@ -208,7 +215,7 @@ private:
 
     Status _update_source_chunk_by_upt(const UptidToRowidPairs& upt_id_to_rowid_pairs, const Schema& partial_schema,
                                        Rowset* rowset, OlapReaderStatistics* stats, MemTracker* tracker,
-                                       ChunkPtr* source_chunk);
+                                       ChunkPtr* source_chunk, UptChunkCache* upt_chunk_cache);
 
 private:
     int64_t _tablet_id = 0;
@@ -34,6 +34,7 @@
 
 #include "storage/schema_change.h"
 
+#include <algorithm>
 #include <csignal>
 #include <memory>
 #include <utility>
@@ -57,6 +58,8 @@
 #include "storage/tablet_manager.h"
 #include "storage/tablet_meta_manager.h"
 #include "storage/tablet_updates.h"
+#include "util/threadpool.h"
+#include "util/time.h"
 #include "util/unaligned_access.h"
 
 namespace starrocks {
@@ -1019,11 +1022,10 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
     std::vector<std::vector<DeltaColumnGroupList>> all_historical_dcgs;
     std::vector<RowsetId> new_rowset_ids;
 
-    for (int i = 0; i < sc_params.rowset_readers.size(); ++i) {
-        VLOG(3) << "begin to convert a history rowset. version=" << sc_params.rowsets_to_change[i]->version();
-
+    const size_t num_rowsets = sc_params.rowset_readers.size();
+    std::vector<std::unique_ptr<RowsetWriter>> rowset_writers(num_rowsets);
+    for (size_t i = 0; i < num_rowsets; ++i) {
         TabletSharedPtr new_tablet = sc_params.new_tablet;
-        TabletSharedPtr base_tablet = sc_params.base_tablet;
         RowsetWriterContext writer_context;
         writer_context.rowset_id = StorageEngine::instance()->next_rowset_id();
         writer_context.tablet_uid = new_tablet->tablet_uid();
@@ -1040,14 +1042,49 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
             writer_context.schema_change_sorting = true;
         }
 
-        std::unique_ptr<RowsetWriter> rowset_writer;
-        status = RowsetFactory::create_rowset_writer(writer_context, &rowset_writer);
+        status = RowsetFactory::create_rowset_writer(writer_context, &rowset_writers[i]);
         if (!status.ok()) {
             return Status::InternalError(_alter_msg_header + "build rowset writer failed");
         }
+    }
 
-        auto st = sc_procedure->process(sc_params.rowset_readers[i].get(), rowset_writer.get(), new_tablet, base_tablet,
-                                        sc_params.rowsets_to_change[i], sc_params.base_tablet_schema);
+    std::vector<Status> process_status(num_rowsets);
+    auto process_rowset = [&](size_t i) {
+        VLOG(3) << "begin to convert a history rowset. version=" << sc_params.rowsets_to_change[i]->version();
+        process_status[i] = sc_procedure->process(sc_params.rowset_readers[i].get(), rowset_writers[i].get(),
+                                                  sc_params.new_tablet, sc_params.base_tablet,
+                                                  sc_params.rowsets_to_change[i], sc_params.base_tablet_schema);
+    };
+    // The rowsets are converted independently of each other. The sorting conversion already takes the memory of a
+    // whole thread and a changer evaluating expressions can not be shared between threads, so both stay serial.
+    const int parallelism = std::min<int>(config::schema_change_rowset_parallelism, num_rowsets);
+    const bool parallel = sc_params.sc_directly && !chunk_changer->evaluates_exprs() && parallelism > 1;
+    const int64_t convert_start = MonotonicMillis();
+    if (parallel) {
+        std::unique_ptr<ThreadPool> pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("schema_change").set_max_threads(parallelism).build(&pool));
+        MemTracker* mem_tracker = CurrentThread::mem_tracker();
+        for (size_t i = 0; i < num_rowsets; ++i) {
+            auto task = [&process_rowset, mem_tracker, i]() {
+                SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+                process_rowset(i);
+            };
+            if (!pool->submit_func(task).ok()) {
+                task();
+            }
+        }
+        pool->wait();
+    }
+
+    int64_t converted_rows = 0;
+    for (int i = 0; i < num_rowsets; ++i) {
+        TabletSharedPtr new_tablet = sc_params.new_tablet;
+        TabletSharedPtr base_tablet = sc_params.base_tablet;
+        auto& rowset_writer = rowset_writers[i];
+        if (!parallel) {
+            process_rowset(i);
+        }
+        const Status& st = process_status[i];
         if (!st.ok()) {
             LOG(WARNING) << _alter_msg_header << "failed to process the schema change. from tablet "
                          << base_tablet->get_tablet_info().to_string() << " to tablet "
@@ -1130,6 +1167,7 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
         }
         all_historical_dcgs.emplace_back(historical_dcgs);
         new_rowset_ids.emplace_back((*new_rowset)->rowset_meta()->rowset_id());
+        converted_rows += (*new_rowset)->num_rows();
 
         VLOG(10) << "succeed to convert a history version."
                  << " version=" << sc_params.version.first << "-" << sc_params.version.second;
@@ -1162,9 +1200,13 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
     }
     sc_params.new_tablet->update_max_continuous_version();
 
+    const int64_t convert_ms = MonotonicMillis() - convert_start;
     LOG(INFO) << _alter_msg_header << "finish converting rowsets for new_tablet from base_tablet. "
               << "base_tablet=" << sc_params.base_tablet->full_name()
-              << ", new_tablet=" << sc_params.new_tablet->full_name() << ", status is " << status.to_string();
+              << ", new_tablet=" << sc_params.new_tablet->full_name() << ", rowsets=" << num_rowsets
+              << ", parallel=" << parallel << ", rows=" << converted_rows << ", duration=" << convert_ms
+              << "ms, rows/s=" << converted_rows * 1000 / std::max<int64_t>(convert_ms, 1) << ", status is "
+              << status.to_string();
 
     return status;
 }
@@ -92,6 +92,10 @@ public:
     Status append_generated_columns(ChunkPtr& read_chunk, ChunkPtr& new_chunk,
                                     const std::vector<uint32_t>& all_ref_columns_ids, int base_schema_columns);
 
+    // Whether change_chunk_v2() or fill_generated_columns() evaluate expressions. Otherwise several threads may
+    // convert chunks with this changer at once.
+    bool evaluates_exprs() const { return _alter_job_type == TAlterJobType::ROLLUP || !_gc_exprs.empty(); }
+
     const std::vector<ColumnId>& get_selected_column_indexes() const { return _selected_column_indexes; }
     std::vector<ColumnId>* get_mutable_selected_column_indexes() { return &_selected_column_indexes; }
 
@@ -16,9 +16,11 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
+#include "common/config.h"
 #include "fs/fs_posix.h"
 #include "gen_cpp/data.pb.h"
 #include "runtime/current_thread.h"
@@ -47,18 +49,22 @@ private:
 
 ReplicateChannel::ReplicateChannel(const DeltaWriterOptions* opt, std::string host, int32_t port, int64_t node_id)
         : _opt(opt), _host(std::move(host)), _port(port), _node_id(node_id) {
-    _closure = new ReusableClosure<PTabletWriterAddSegmentResult>();
-    _closure->ref();
+    const size_t max_inflight_requests = std::max<int64_t>(1, config::segment_replicate_max_inflight_requests);
+    for (size_t i = 0; i < max_inflight_requests; ++i) {
+        auto* closure = new ReusableClosure<PTabletWriterAddSegmentResult>();
+        closure->ref();
+        _closures.emplace_back(closure);
+    }
 }
 
 ReplicateChannel::~ReplicateChannel() {
-    if (_closure != nullptr) {
-        _closure->join();
-        if (_closure->unref()) {
-            delete _closure;
+    for (auto* closure : _closures) {
+        closure->join();
+        if (closure->unref()) {
+            delete closure;
         }
-        _closure = nullptr;
     }
+    _closures.clear();
 }
 
 std::string ReplicateChannel::debug_string() {
@@ -97,13 +103,15 @@ Status ReplicateChannel::sync_segment(SegmentPB* segment, butil::IOBuf& data, bo
     RETURN_IF_ERROR(_st);
 
     // 2. send segment sync request
-    _send_request(segment, data, eos);
+    RETURN_IF_ERROR(_wait_all_responses(replicate_tablet_infos, failed_tablet_infos));
+    auto* closure = _closures[0];
+    _send_request(closure, segment, data, eos);
 
     // 3. wait result
-    RETURN_IF_ERROR(_wait_response(replicate_tablet_infos, failed_tablet_infos));
+    RETURN_IF_ERROR(_wait_response(closure, replicate_tablet_infos, failed_tablet_infos));
 
     VLOG(1) << "Sync tablet " << _opt->tablet_id << " segment id " << (segment == nullptr ? -1 : segment->segment_id())
-            << " eos " << eos << " to [" << _host << ":" << _port << "] res " << _closure->result.DebugString();
+            << " eos " << eos << " to [" << _host << ":" << _port << "] res " << closure->result.DebugString();
 
     return _st;
 }
@@ -120,25 +128,33 @@ Status ReplicateChannel::async_segment(SegmentPB* segment, butil::IOBuf& data, b
     _st = _init();
     RETURN_IF_ERROR(_st);
 
-    // 2. wait pre request's result
-    RETURN_IF_ERROR(_wait_response(replicate_tablet_infos, failed_tablet_infos));
+    // 2. wait the result of the oldest in-flight request, whose closure is reused. The eos request must be the
+    // last one handled by the secondary replica, so it is only sent after all the previous requests finished.
+    auto* closure = _closures[_next_closure];
+    _next_closure = (_next_closure + 1) % _closures.size();
+    if (eos) {
+        RETURN_IF_ERROR(_wait_all_responses(replicate_tablet_infos, failed_tablet_infos));
+    } else {
+        RETURN_IF_ERROR(_wait_response(closure, replicate_tablet_infos, failed_tablet_infos));
+    }
 
     // 3. send segment sync request
-    _send_request(segment, data, eos);
+    _send_request(closure, segment, data, eos);
 
     // 4. wait if eos=true
     if (eos || _mem_tracker->limit_exceeded()) {
-        RETURN_IF_ERROR(_wait_response(replicate_tablet_infos, failed_tablet_infos));
+        RETURN_IF_ERROR(_wait_all_responses(replicate_tablet_infos, failed_tablet_infos));
     }
 
     VLOG(1) << "Asynced tablet " << _opt->tablet_id << " segment id "
             << (segment == nullptr ? -1 : segment->segment_id()) << " eos " << eos << " to [" << _host << ":" << _port
-            << "] res " << _closure->result.DebugString();
+            << "] res " << closure->result.DebugString();
 
     return _st;
 }
 
-void ReplicateChannel::_send_request(SegmentPB* segment, butil::IOBuf& data, bool eos) {
+void ReplicateChannel::_send_request(ReusableClosure<PTabletWriterAddSegmentResult>* closure, SegmentPB* segment,
+                                     butil::IOBuf& data, bool eos) {
     PTabletWriterAddSegmentRequest request;
     request.set_allocated_id(const_cast<starrocks::PUniqueId*>(&_opt->load_id));
     request.set_tablet_id(_opt->tablet_id);
@@ -146,20 +162,20 @@ void ReplicateChannel::_send_request(SegmentPB* segment, butil::IOBuf& data, boo
     request.set_txn_id(_opt->txn_id);
     request.set_index_id(_opt->index_id);
 
-    _closure->ref();
-    _closure->reset();
-    _closure->cntl.set_timeout_ms(_opt->timeout_ms);
-    _closure->cntl.ignore_eovercrowded();
+    closure->ref();
+    closure->reset();
+    closure->cntl.set_timeout_ms(_opt->timeout_ms);
+    closure->cntl.ignore_eovercrowded();
 
     if (segment != nullptr) {
         request.set_allocated_segment(segment);
-        _closure->cntl.request_attachment().append(data);
+        closure->cntl.request_attachment().append(data);
     }
-    _closure->request_size = _closure->cntl.request_attachment().size();
+    closure->request_size = closure->cntl.request_attachment().size();
     // brpc send buffer is also considered as part of the memory used by load
-    _mem_tracker->consume(_closure->request_size);
+    _mem_tracker->consume(closure->request_size);
 
-    _stub->tablet_writer_add_segment(&_closure->cntl, &request, &_closure->result, _closure);
+    _stub->tablet_writer_add_segment(&closure->cntl, &request, &closure->result, closure);
 
     request.release_id();
     if (segment != nullptr) {
@@ -167,35 +183,46 @@ void ReplicateChannel::_send_request(SegmentPB* segment, butil::IOBuf& data, boo
     }
 }
 
-Status ReplicateChannel::_wait_response(std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
+Status ReplicateChannel::_wait_response(ReusableClosure<PTabletWriterAddSegmentResult>* closure,
+                                        std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
                                         std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos) {
-    if (_closure->join()) {
-        _mem_tracker->release(_closure->request_size);
-        if (_closure->cntl.Failed()) {
-            _st = Status::InternalError(_closure->cntl.ErrorText());
+    if (closure->join()) {
+        _mem_tracker->release(closure->request_size);
+        if (closure->cntl.Failed()) {
+            _st = Status::InternalError(closure->cntl.ErrorText());
             LOG(WARNING) << "Failed to send rpc to " << debug_string() << " err=" << _st;
             return _st;
         }
-        _st = _closure->result.status();
+        _st = closure->result.status();
         if (!_st.ok()) {
             LOG(WARNING) << "Failed to send rpc to " << debug_string() << " err=" << _st;
             return _st;
         }
 
-        for (size_t i = 0; i < _closure->result.tablet_vec_size(); ++i) {
+        for (size_t i = 0; i < closure->result.tablet_vec_size(); ++i) {
             replicate_tablet_infos->emplace_back(std::make_unique<PTabletInfo>());
-            replicate_tablet_infos->back()->Swap(_closure->result.mutable_tablet_vec(i));
+            replicate_tablet_infos->back()->Swap(closure->result.mutable_tablet_vec(i));
         }
 
-        for (size_t i = 0; i < _closure->result.failed_tablet_vec_size(); ++i) {
+        for (size_t i = 0; i < closure->result.failed_tablet_vec_size(); ++i) {
             failed_tablet_infos->emplace_back(std::make_unique<PTabletInfo>());
-            failed_tablet_infos->back()->Swap(_closure->result.mutable_failed_tablet_vec(i));
+            failed_tablet_infos->back()->Swap(closure->result.mutable_failed_tablet_vec(i));
         }
     }
 
     return Status::OK();
 }
 
+Status ReplicateChannel::_wait_all_responses(std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
+                                             std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos) {
+    for (size_t i = 0; i < _closures.size(); ++i) {
+        // in the order the requests were sent
+        auto* closure = _closures[(_next_closure + i) % _closures.size()];
+        RETURN_IF_ERROR(_wait_response(closure, replicate_tablet_infos, failed_tablet_infos));
+    }
+    return Status::OK();
+}
+
 void ReplicateChannel::cancel() {
     if (!_init().ok()) {
         return;
@@ -203,7 +230,9 @@ void ReplicateChannel::cancel() {
 
     // cancel rpc request, accelerate the release of related resources
     // Cancel an already-cancelled call_id has no effect.
-    _closure->cancel();
+    for (auto* closure : _closures) {
+        closure->cancel();
+    }
 }
 
 ReplicateToken::ReplicateToken(std::unique_ptr<ThreadPoolToken> replicate_pool_token, const DeltaWriterOptions* opt)
@@ -57,16 +57,22 @@ public:
 
 private:
     Status _init();
-    void _send_request(SegmentPB* segment, butil::IOBuf& data, bool eos);
-    Status _wait_response(std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
+    void _send_request(ReusableClosure<PTabletWriterAddSegmentResult>* closure, SegmentPB* segment,
+                       butil::IOBuf& data, bool eos);
+    Status _wait_response(ReusableClosure<PTabletWriterAddSegmentResult>* closure,
+                          std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
                           std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos);
+    Status _wait_all_responses(std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
+                               std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos);
 
     const DeltaWriterOptions* _opt;
     const std::string _host;
     const int32_t _port;
     const int64_t _node_id;
 
-    ReusableClosure<PTabletWriterAddSegmentResult>* _closure = nullptr;
+    // up to segment_replicate_max_inflight_requests requests are in flight, reusing the closures round robin
+    std::vector<ReusableClosure<PTabletWriterAddSegmentResult>*> _closures;
+    size_t _next_closure = 0;
     PInternalService_Stub* _stub = nullptr;
     MemTracker* _mem_tracker = nullptr;
 
@@ -46,6 +46,7 @@
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "storage/del_vector.h"
+#include "storage/inverted/builtin/builtin_plugin.h"
 #include "storage/inverted/clucene/clucene_plugin.h"
 #include "storage/inverted/index_descriptor.hpp"
 #include "storage/rowset/rowset.h"
@@ -207,7 +208,7 @@ Status SnapshotManager::convert_rowset_ids(const string& clone_dir, int64_t tabl
     std::vector<std::string> new_inverted_index_files;
     RETURN_IF_ERROR(FileSystem::Default()->get_children(clone_dir, &all_files));
     for (const auto& file : all_files) {
-        if (CLucenePlugin::is_index_files(file)) {
+        if (CLucenePlugin::is_index_files(file) || BuiltinPlugin::is_index_files(file)) {
             auto* p1 = (char*)std::memchr(file.data(), '_', file.size());
             auto* p2 = (char*)std::memchr(p1 + 1, '_', file.size() - (p1 - file.data() + 1));
             auto* p3 = (char*)std::memchr(p2 + 1, '_', file.size() - (p2 - file.data() + 1));
@@ -811,6 +812,16 @@ Status SnapshotManager::assign_new_rowset_id(SnapshotMeta* snapshot_meta, const
                                                             src_absolute_path, dst_absolute_path));
                             }
                         }
+                    } else if (index.index_type() == VECTOR) {
+                        std::string src_vector_file_path = IndexDescriptor::vector_index_file_path(
+                                clone_dir, old_rowset_id.to_string(), segment_n, index.index_id());
+                        std::string dst_vector_link_path = IndexDescriptor::vector_index_file_path(
+                                clone_dir, new_rowset_id.to_string(), segment_n, index.index_id());
+                        // the segments written before the index was created have no index file
+                        if (fs::path_exist(src_vector_file_path)) {
+                            RETURN_IF_ERROR(FileSystem::Default()->link_file(src_vector_file_path,
+                                                                             dst_vector_link_path));
+                        }
                     }
                 }
             }
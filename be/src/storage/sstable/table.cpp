@@ -5,6 +5,7 @@
 #include "storage/sstable/table.h"
 
 #include <butil/time.h> // NOLINT
+#include <limits>
 
 #include "common/status.h"
 #include "fs/fs.h"
@@ -254,16 +255,16 @@ Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt
 
     size_t i = 0;
     bool founded = false;
+    // offset of the block of current_block_itr_ptr
+    uint64_t current_block_offset = std::numeric_limits<uint64_t>::max();
     for (auto it = begin; it != end; ++it, ++i) {
         auto& k = keys[*it];
-        if (current_block_itr_ptr != nullptr && current_block_itr_ptr->Valid()) {
+        if (current_block_itr_ptr != nullptr) {
             // keep searching current block
             ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get()));
             if (founded) {
                 TRACE_COUNTER_INCREMENT("continue_block_read", 1);
                 continue;
-            } else {
-                current_block_itr_ptr.reset(nullptr);
             }
         }
         iiter->Seek(k);
@@ -271,13 +272,17 @@ Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt
             Slice handle_value = iiter->value();
             FilterBlockReader* filter = rep_->filter;
             BlockHandle handle;
-            if (filter != nullptr && handle.DecodeFrom(&handle_value).ok() &&
-                !filter->KeyMayMatch(handle.offset(), k)) {
+            const bool handle_decoded = handle.DecodeFrom(&handle_value).ok();
+            if (current_block_itr_ptr != nullptr && handle_decoded && handle.offset() == current_block_offset) {
+                // k belongs to the block just searched, no need to read it again.
+                TRACE_COUNTER_INCREMENT("skip_block_read", 1);
+            } else if (filter != nullptr && handle_decoded && !filter->KeyMayMatch(handle.offset(), k)) {
                 // Not found
                 TRACE_COUNTER_INCREMENT("sst_bloom_filter_rows", 1);
             } else {
                 auto start_ts = butil::gettimeofday_us();
                 current_block_itr_ptr.reset(BlockReader(this, options, iiter->value()));
+                current_block_offset = handle_decoded ? handle.offset() : std::numeric_limits<uint64_t>::max();
                 auto end_ts = butil::gettimeofday_us();
                 TRACE_COUNTER_INCREMENT("read_block", end_ts - start_ts);
                 ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get()));
@@ -296,5 +301,16 @@ template Status Table::MultiGet<std::set<size_t>::iterator>(const ReadOptions& o
                                                             std::set<size_t>::iterator begin,
                                                             std::set<size_t>::iterator end,
                                                             std::vector<std::string>* values);
+template Status Table::MultiGet<std::vector<size_t>::iterator>(const ReadOptions& options, const Slice* keys,
+                                                               std::vector<size_t>::iterator begin,
+                                                               std::vector<size_t>::iterator end,
+                                                               std::vector<std::string>* values);
+
+void Table::GetIndexKeys(std::vector<std::string>* keys) const {
+    std::unique_ptr<Iterator> iiter(rep_->index_block->NewIterator(rep_->options.comparator));
+    for (iiter->SeekToFirst(); iiter->Valid(); iiter->Next()) {
+        keys->emplace_back(iiter->key().to_string());
+    }
+}
 
 } // namespace starrocks::sstable
@@ -51,6 +51,10 @@ public:
     Status MultiGet(const ReadOptions&, const Slice* keys, ForwardIt begin, ForwardIt end,
                     std::vector<std::string>* values);
 
+    // Append the keys of the index block to "*keys". There is one key per data block, which is
+    // not less than the last key of the block, so they split the table into ranges of blocks.
+    void GetIndexKeys(std::vector<std::string>* keys) const;
+
 private:
     struct Rep;
 
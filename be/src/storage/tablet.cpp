@@ -39,6 +39,7 @@
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
 
+#include <cmath>
 #include <map>
 #include <memory>
 #include <utility>
@@ -1204,6 +1205,29 @@ void Tablet::pick_all_candicate_rowsets(vector<RowsetSharedPtr>* candidate_rowse
 }
 
 // For http compaction action
+static double decay_read_amplification(double score, int64_t elapsed_millis) {
+    const int64_t half_life_millis = std::max<int64_t>(1, config::compaction_read_amp_half_life_seconds) * 1000;
+    return score * std::exp2(-static_cast<double>(std::max<int64_t>(0, elapsed_millis)) / half_life_millis);
+}
+
+void Tablet::add_query_read_amplification(int64_t rowsets, int64_t merged_rows) {
+    // the work a compaction of the tablet would save this query
+    const double cost = std::max<int64_t>(0, rowsets - 1) +
+                        static_cast<double>(merged_rows) / std::max<int64_t>(1, config::vector_chunk_size);
+    if (cost <= 0) {
+        return;
+    }
+    const int64_t now = UnixMillis();
+    std::lock_guard l(_read_amp_lock);
+    _read_amp_score = decay_read_amplification(_read_amp_score, now - _read_amp_update_millis) + cost;
+    _read_amp_update_millis = now;
+}
+
+double Tablet::read_amplification_score() const {
+    std::lock_guard l(_read_amp_lock);
+    return decay_read_amplification(_read_amp_score, UnixMillis() - _read_amp_update_millis);
+}
+
 void Tablet::get_compaction_status(std::string* json_result) {
     if (keys_type() == PRIMARY_KEYS) {
         return _updates->get_compaction_status(json_result);
@@ -1328,6 +1352,7 @@ void Tablet::get_compaction_status(std::string* json_result) {
     format_str = ToStringFromUnixMillis(_last_base_compaction_failure_millis.load());
     base_value.SetString(format_str.c_str(), format_str.length(), root.GetAllocator());
     root.AddMember("last_base_failure_time", base_value, root.GetAllocator());
+    root.AddMember("read_amp_score", read_amplification_score(), root.GetAllocator());
     rapidjson::Value cumu_success_value;
     format_str = ToStringFromUnixMillis(_last_cumu_compaction_success_millis.load());
     cumu_success_value.SetString(format_str.c_str(), format_str.length(), root.GetAllocator());
@@ -254,6 +254,14 @@ public:
     // return a json string to show the compaction status of this tablet
     void get_compaction_status(std::string* json_result);
 
+    // Called by the readers of the queries when they finish, with the number of non-empty rowsets they read
+    // and the number of rows merged away by the merge and aggregate iterators.
+    void add_query_read_amplification(int64_t rowsets, int64_t merged_rows);
+
+    // The read amplification of the recent queries, decayed by time, which raises the compaction
+    // priority of the tablets queried often over many overlapping segments.
+    double read_amplification_score() const;
+
     // updatable tablet specific operations
     TabletUpdates* updates() { return _updates.get(); }
     [[nodiscard]] Status rowset_commit(int64_t version, const RowsetSharedPtr& rowset, uint32_t wait_time = 0);
@@ -438,6 +446,11 @@ private:
 
     std::atomic<int64_t> _cumulative_point{0};
     std::atomic<int32_t> _newly_created_rowset_num{0};
+
+    // read amplification of the recent queries, see read_amplification_score()
+    mutable std::mutex _read_amp_lock;
+    double _read_amp_score = 0;
+    int64_t _read_amp_update_millis = 0;
     std::atomic<int64_t> _last_checkpoint_time{0};
 
     std::unique_ptr<BinlogManager> _binlog_manager;
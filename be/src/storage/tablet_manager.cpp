@@ -47,6 +47,7 @@
 #include "fs/fs_util.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "runtime/memory/jemalloc_arenas.h"
 #include "storage/compaction_manager.h"
 #include "storage/data_dir.h"
 #include "storage/olap_common.h"
@@ -780,6 +781,34 @@ std::vector<TabletAndScore> TabletManager::pick_tablets_to_do_pk_index_major_com
     return pick_tablets;
 }
 
+std::vector<TabletSharedPtr> TabletManager::pick_tablets_to_warm_up_pk_index(int64_t min_creation_time) {
+    std::vector<TabletSharedPtr> tablet_ptr_list;
+    for (const auto& tablets_shard : _tablets_shards) {
+        std::shared_lock rlock(tablets_shard.lock);
+        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+            if (tablet_ptr->keys_type() != PRIMARY_KEYS || tablet_ptr->tablet_state() == TABLET_NOTREADY) {
+                continue;
+            }
+            tablet_ptr_list.push_back(tablet_ptr);
+        }
+    }
+    std::vector<std::pair<int64_t, TabletSharedPtr>> tablets_by_time;
+    for (auto& tablet_ptr : tablet_ptr_list) {
+        int64_t creation_time = tablet_ptr->updates()->max_rowset_creation_time();
+        if (creation_time >= min_creation_time) {
+            tablets_by_time.emplace_back(creation_time, std::move(tablet_ptr));
+        }
+    }
+    std::sort(tablets_by_time.begin(), tablets_by_time.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+    std::vector<TabletSharedPtr> pick_tablets;
+    pick_tablets.reserve(tablets_by_time.size());
+    for (auto& [_, tablet_ptr] : tablets_by_time) {
+        pick_tablets.push_back(std::move(tablet_ptr));
+    }
+    return pick_tablets;
+}
+
 TabletSharedPtr TabletManager::find_best_tablet_to_do_update_compaction(DataDir* data_dir) {
     int64_t highest_score = 0;
     TabletSharedPtr best_tablet;
@@ -825,6 +854,7 @@ Status TabletManager::load_tablet_from_meta(DataDir* data_dir, TTabletId tablet_
                                             std::string_view meta_binary, bool update_meta, bool force, bool restore,
                                             bool check_path) {
     std::unique_lock wlock(_get_tablets_shard_lock(tablet_id));
+    SCOPED_MEMORY_CLASS(MemoryClass::METADATA);
     TabletMetaSharedPtr tablet_meta(new TabletMeta());
     if (Status st = tablet_meta->deserialize(meta_binary); !st.ok()) {
         LOG(WARNING) << "Fail to load tablet because can not parse meta_binary string. "
@@ -966,9 +996,25 @@ Status TabletManager::report_all_tablets_info(std::map<TTabletId, TTablet>* tabl
     StarRocksMetrics::instance()->report_all_tablets_requests_total.increment(1);
 
     size_t max_tablet_rowset_num = 0;
+    std::vector<TabletSharedPtr> shard_tablets;
     for (const auto& tablets_shard : _tablets_shards) {
-        std::shared_lock rlock(tablets_shard.lock);
-        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+        // Build the report of the tablets without the lock of the shard, which would otherwise block the writers of
+        // the shard behind the locks of the tablets, and then the readers of the shard, e.g. get_tablet(), behind
+        // the writers.
+        shard_tablets.clear();
+        {
+            std::shared_lock rlock(tablets_shard.lock);
+            shard_tablets.reserve(tablets_shard.tablet_map.size());
+            for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+                shard_tablets.push_back(tablet_ptr);
+            }
+        }
+        for (const auto& tablet_ptr : shard_tablets) {
+            if (tablet_ptr->tablet_state() == TABLET_SHUTDOWN) {
+                // dropped after the snapshot
+                continue;
+            }
+            const TTabletId tablet_id = tablet_ptr->tablet_id();
             TTablet t_tablet;
             TTabletInfo tablet_info;
             tablet_ptr->build_tablet_report_info(&tablet_info);
@@ -196,6 +196,9 @@ public:
 
     std::vector<TabletAndScore> pick_tablets_to_do_pk_index_major_compaction();
 
+    // primary key tablets with rowsets created after |min_creation_time|, the most recently written first
+    std::vector<TabletSharedPtr> pick_tablets_to_warm_up_pk_index(int64_t min_creation_time);
+
     Status generate_pk_dump();
 
 private:
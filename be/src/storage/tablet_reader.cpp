@@ -18,6 +18,7 @@
 #include <utility>
 
 #include "column/datum_convert.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "gen_cpp/tablet_schema.pb.h"
 #include "gutil/stl_util.h"
@@ -32,12 +33,15 @@
 #include "storage/empty_iterator.h"
 #include "storage/merge_iterator.h"
 #include "storage/predicate_parser.h"
+#include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowid_range_option.h"
+#include "storage/rowset/segment.h"
 #include "storage/seek_range.h"
 #include "storage/tablet.h"
 #include "storage/tablet_updates.h"
 #include "storage/types.h"
 #include "storage/union_iterator.h"
+#include "storage/zone_map_detail.h"
 
 namespace starrocks {
 
@@ -81,6 +85,9 @@ TabletReader::TabletReader(TabletSharedPtr tablet, const Version& version, const
 
 void TabletReader::close() {
     if (_collect_iter != nullptr) {
+        if (_is_query && _tablet != nullptr && config::compaction_read_amp_weight > 0) {
+            _tablet->add_query_read_amplification(_num_input_rowsets, _collect_iter->merged_rows());
+        }
         _collect_iter->close();
         _collect_iter.reset();
     }
@@ -266,6 +273,13 @@ Status TabletReader::do_get_next(Chunk* chunk, std::vector<RowSourceMask>* sourc
     return Status::OK();
 }
 
+Status TabletReader::do_get_next(Chunk* chunk, std::vector<uint64_t>* rssid_rowids) {
+    DCHECK(!_is_vertical_merge);
+    DCHECK(_collect_iter != nullptr);
+    RETURN_IF_ERROR(_collect_iter->get_next(chunk, rssid_rowids));
+    return Status::OK();
+}
+
 Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std::vector<ChunkIteratorPtr>* iters) {
     RowsetReadOptions rs_opts;
     KeysType keys_type = _tablet_schema->keys_type();
@@ -302,6 +316,7 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     }
     rs_opts.prune_column_after_index_filter = params.prune_column_after_index_filter;
     rs_opts.enable_gin_filter = params.enable_gin_filter;
+    rs_opts.vector_search_option = params.vector_search_option;
 
     SCOPED_RAW_TIMER(&_stats.create_segment_iter_ns);
     for (auto& rowset : _rowsets) {
@@ -309,14 +324,62 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
             continue;
         }
 
+        if (params.output_row_ids) {
+            DCHECK_NE(keys_type, PRIMARY_KEYS);
+            rs_opts.rssid_base = static_cast<int64_t>(_row_id_segments.size());
+        }
         RETURN_IF_ERROR(rowset->get_segment_iterators(schema(), rs_opts, iters));
+        if (params.output_row_ids) {
+            const auto& segments = rowset->segments();
+            _row_id_segments.insert(_row_id_segments.end(), segments.begin(), segments.end());
+        }
     }
     return Status::OK();
 }
 
+bool TabletReader::_segments_have_disjoint_keys() {
+    const uint32_t key_uid = _tablet_schema->column(0).unique_id();
+    std::vector<ZoneMapDetail> ranges;
+    LogicalType key_type = TYPE_UNKNOWN;
+    for (const auto& rowset : _rowsets) {
+        for (const auto& segment : rowset->segments()) {
+            if (segment->num_rows() == 0) {
+                continue;
+            }
+            const ColumnReader* reader = segment->column_with_uid(key_uid);
+            // the key column of a segment written before a schema change may have another type
+            if (reader == nullptr || (key_type != TYPE_UNKNOWN && reader->column_type() != key_type)) {
+                return false;
+            }
+            key_type = reader->column_type();
+            auto& detail = ranges.emplace_back();
+            if (!reader->segment_zone_map_detail(&detail).ok() || detail.has_null() || !detail.has_not_null()) {
+                return false;
+            }
+        }
+    }
+    if (ranges.size() <= 1) {
+        return !ranges.empty();
+    }
+    TypeInfoPtr type_info = get_type_info(delegate_type(key_type));
+    std::sort(ranges.begin(), ranges.end(), [&](const ZoneMapDetail& a, const ZoneMapDetail& b) {
+        return type_info->cmp(a.min_value(), b.min_value()) < 0;
+    });
+    for (size_t i = 1; i < ranges.size(); i++) {
+        if (type_info->cmp(ranges[i - 1].max_value(), ranges[i].min_value()) >= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status TabletReader::_init_collector(const TabletReaderParams& params) {
     std::vector<ChunkIteratorPtr> seg_iters;
     RETURN_IF_ERROR(get_segment_iterators(params, &seg_iters));
+    _is_query = params.reader_type == ReaderType::READER_QUERY;
+    // a compaction can merge the rowsets, not the segments of one rowset
+    _num_input_rowsets = std::count_if(_rowsets.begin(), _rowsets.end(),
+                                       [](const RowsetSharedPtr& rowset) { return rowset->num_rows() > 0; });
 
     // Put each SegmentIterator into a TimedChunkIterator, if a profile is provided.
     if (params.profile != nullptr) {
@@ -335,6 +398,11 @@ Status TabletReader::_init_collector(const TabletReaderParams& params) {
     const auto skip_aggr = params.skip_aggregation;
     const auto select_all_keys = _schema.num_key_fields() == _tablet_schema->num_key_columns();
     DCHECK_LE(_schema.num_key_fields(), _tablet_schema->num_key_columns());
+    // Without a key in more than one segment the merge and the aggregation change nothing, except the order of the
+    // rows which only matters if they must be sorted by the keys.
+    const bool disjoint_keys = _is_query && (keys_type == UNIQUE_KEYS || keys_type == AGG_KEYS) && !skip_aggr &&
+                               select_all_keys && !params.sorted_by_keys_per_tablet && seg_iters.size() > 1 &&
+                               config::enable_disjoint_keys_merge_elimination && _segments_have_disjoint_keys();
 
     if (seg_iters.empty()) {
         _collect_iter = new_empty_iterator(_schema, params.chunk_size);
@@ -370,7 +438,7 @@ Status TabletReader::_init_collector(const TabletReaderParams& params) {
             _collect_iter = new_heap_merge_iterator(seg_iters);
         }
     } else if (keys_type == PRIMARY_KEYS || keys_type == DUP_KEYS || (keys_type == UNIQUE_KEYS && skip_aggr) ||
-               (select_all_keys && seg_iters.size() == 1)) {
+               (select_all_keys && seg_iters.size() == 1) || disjoint_keys) {
         // The segments may be in order after compaction. At this time, we prefer to read the later segments first.
         if (!_is_asc_hint) {
             std::reverse(seg_iters.begin(), seg_iters.end());
@@ -64,6 +64,10 @@ public:
 
     Status get_segment_iterators(const TabletReaderParams& params, std::vector<ChunkIteratorPtr>* iters);
 
+    // The segments indexed by the rssids output by `get_next(chunk, rssid_rowids)`, only available if
+    // `TabletReaderParams::output_row_ids` is true.
+    const std::vector<SegmentSharedPtr>& row_id_segments() const { return _row_id_segments; }
+
     static Status parse_seek_range(const TabletSchemaCSPtr& tablet_schema,
                                    TabletReaderParams::RangeStartOperation range_start_op,
                                    TabletReaderParams::RangeEndOperation range_end_op,
@@ -74,6 +78,7 @@ public:
 public:
     Status do_get_next(Chunk* chunk) override;
     Status do_get_next(Chunk* chunk, std::vector<RowSourceMask>* source_masks) override;
+    Status do_get_next(Chunk* chunk, std::vector<uint64_t>* rssid_rowids) override;
 
 private:
     using PredicateList = std::vector<const ColumnPredicate*>;
@@ -83,6 +88,10 @@ private:
     Status _init_delete_predicates(const TabletReaderParams& read_params, DeletePredicates* dels);
     Status _init_collector(const TabletReaderParams& read_params);
 
+    // Whether the [min, max] ranges of the first key column in the segment zone maps are pairwise disjoint, so that
+    // no key is in more than one segment and the segments need no merge.
+    bool _segments_have_disjoint_keys();
+
     static Status _to_seek_tuple(const TabletSchemaCSPtr& tablet_schema, const OlapTuple& input, SeekTuple* tuple,
                                  MemPool* mempool);
 
@@ -103,6 +112,7 @@ private:
 
     std::vector<RowsetSharedPtr> _rowsets;
     std::shared_ptr<ChunkIterator> _collect_iter;
+    std::vector<SegmentSharedPtr> _row_id_segments;
 
     OlapReaderStatistics _stats;
 
@@ -116,6 +126,10 @@ private:
     bool _is_asc_hint = true;
 
     bool _use_gtid = false;
+
+    // fed back to the tablet as the read amplification of the query on close
+    bool _is_query = false;
+    size_t _num_input_rowsets = 0;
 };
 
 } // namespace starrocks
@@ -26,6 +26,7 @@
 #include "storage/olap_runtime_range_pruner.h"
 #include "storage/predicate_tree/predicate_tree.hpp"
 #include "storage/tuple.h"
+#include "storage/vector_index/vector_index_option.h"
 
 namespace starrocks {
 
@@ -93,6 +94,11 @@ struct TabletReaderParams {
 
     bool prune_column_after_index_filter = false;
     bool enable_gin_filter = false;
+    VectorSearchOptionPtr vector_search_option = nullptr;
+
+    // Whether the reader outputs the row ids of a non primary key tablet by `get_next(chunk, rssid_rowids)`,
+    // where the rssid is the index of the segment in `TabletReader::row_id_segments()`.
+    bool output_row_ids = false;
 
 public:
     std::string to_string() const;
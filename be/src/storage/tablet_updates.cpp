@@ -44,6 +44,7 @@
 #include "storage/local_primary_key_recover.h"
 #include "storage/merge_iterator.h"
 #include "storage/persistent_index.h"
+#include "storage/pk_row_cache.h"
 #include "storage/primary_key_dump.h"
 #include "storage/rows_mapper.h"
 #include "storage/rowset/default_value_column_iterator.h"
@@ -902,6 +903,8 @@ void TabletUpdates::do_apply() {
             int64_t duration_ns = 0;
             {
                 StarRocksMetrics::instance()->update_rowset_commit_apply_total.increment(1);
+                StarRocksMetrics::instance()->update_rowset_commit_apply_lag_seconds.increment(
+                        std::max<int64_t>(0, UnixSeconds() - version_info_apply->creation_time));
                 SCOPED_RAW_TIMER(&duration_ns);
                 _apply_rowset_commit(*version_info_apply);
             }
@@ -1124,7 +1127,12 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
     auto scope = IOProfiler::scope(IOProfiler::TAG_LOAD, _tablet.tablet_id());
     uint32_t rowset_id = version_info.deltas[0];
     RowsetSharedPtr rowset = get_rowset(rowset_id);
+    // no rows are cached while applying, the written keys are erased as they are applied
+    PkRowCache::instance()->begin_update(_tablet.tablet_id());
+    DeferOp end_row_cache_update([&]() { PkRowCache::instance()->end_update(_tablet.tablet_id()); });
     if (rowset->is_column_mode_partial_update()) {
+        // the keys of the partial rows are only known by their rowids
+        PkRowCache::instance()->invalidate_tablet(_tablet.tablet_id());
         StarRocksMetrics::instance()->column_partial_update_apply_total.increment(1);
         int64_t duration_ns = 0;
         {
@@ -1299,6 +1307,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
                 }
                 manager->index_cache().update_object_size(index_entry, index.memory_usage());
                 if (delete_pks != nullptr) {
+                    PkRowCache::instance()->erase(tablet_id, *delete_pks);
                     st = index.erase(*delete_pks, &new_deletes);
                     if (!st.ok()) {
                         std::string msg = strings::Substitute("_apply_rowset_commit error: index erase failed: $0 $1",
@@ -1324,6 +1333,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
             }
             auto& deletes = state.deletes();
             delete_op += deletes[i]->size();
+            PkRowCache::instance()->erase(tablet_id, *deletes[i]);
             st = index.erase(*deletes[i], &new_deletes);
             if (!st.ok()) {
                 std::string msg = strings::Substitute("_apply_rowset_commit error: index erase failed: $0 $1",
@@ -1379,6 +1389,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
                     }
                     manager->index_cache().update_object_size(index_entry, index.memory_usage());
                     if (delete_pks != nullptr) {
+                        PkRowCache::instance()->erase(tablet_id, *delete_pks);
                         st = index.erase(*delete_pks, &new_deletes);
                         if (!st.ok()) {
                             std::string msg =
@@ -1404,6 +1415,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
                 }
                 auto& deletes = state.deletes();
                 delete_op += deletes[loaded_delfile]->size();
+                PkRowCache::instance()->erase(tablet_id, *deletes[loaded_delfile]);
                 st = index.erase(*deletes[loaded_delfile], &new_deletes);
                 if (!st.ok()) {
                     std::string msg = strings::Substitute("_apply_rowset_commit error: index erase failed: $0 $1",
@@ -1632,7 +1644,8 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
               << " txn_id: " << rowset->txn_id() << " total del/row:" << _cur_total_dels << "/" << _cur_total_rows
               << " " << del_percent << "% rowset:" << rowset_id << " #seg:" << rowset->num_segments()
               << " #op(upsert:" << rowset->num_rows() << " del:" << delete_op << ") #del:" << old_total_del << "+"
-              << new_del << "=" << total_del << " #dv:" << ndelvec << " duration:" << t_write - t_start << "ms"
+              << new_del << "=" << total_del << " #dv:" << ndelvec
+              << " lag:" << UnixSeconds() - version_info.creation_time << "s duration:" << t_write - t_start << "ms"
               << strings::Substitute("($0/$1/$2/$3)", t_apply - t_start, t_index - t_apply, t_delvec - t_index,
                                      t_write - t_delvec);
     VLOG(1) << "rowset commit apply " << delvec_change_info << " " << _debug_string(true, true);
@@ -1702,6 +1715,7 @@ Status TabletUpdates::_wait_for_version(const EditVersion& version, int64_t time
 Status TabletUpdates::_do_update(uint32_t rowset_id, int32_t upsert_idx, int32_t condition_column, int64_t read_version,
                                  const std::vector<ColumnUniquePtr>& upserts, PrimaryIndex& index, int64_t tablet_id,
                                  DeletesMap* new_deletes, const TabletSchemaCSPtr& tablet_schema) {
+    PkRowCache::instance()->erase(tablet_id, *upserts[upsert_idx]);
     if (condition_column >= 0) {
         auto tablet_column = tablet_schema->column(condition_column);
         std::vector<uint32_t> read_column_ids;
@@ -3072,6 +3086,17 @@ StatusOr<std::vector<std::pair<uint32_t, uint32_t>>> TabletUpdates::list_rowsets
     return ret;
 }
 
+void TabletUpdates::get_apply_lag(size_t* pending_versions, int64_t* lag_seconds) {
+    std::lock_guard rl(_lock);
+    *pending_versions = 0;
+    *lag_seconds = 0;
+    if (_apply_version_idx + 1 >= _edit_version_infos.size()) {
+        return;
+    }
+    *pending_versions = _edit_version_infos.size() - _apply_version_idx - 1;
+    *lag_seconds = std::max<int64_t>(0, UnixSeconds() - _edit_version_infos[_apply_version_idx + 1]->creation_time);
+}
+
 void TabletUpdates::get_compaction_status(std::string* json_result) {
     rapidjson::Document root;
     root.SetObject();
@@ -3129,6 +3154,16 @@ void TabletUpdates::get_compaction_status(std::string* json_result) {
     rowsets_count.SetUint64(rowsets.size());
     root.AddMember("rowsets_count", rowsets_count, root.GetAllocator());
 
+    size_t pending_apply_versions = 0;
+    int64_t apply_lag_seconds = 0;
+    get_apply_lag(&pending_apply_versions, &apply_lag_seconds);
+    rapidjson::Value pending_apply_versions_value;
+    pending_apply_versions_value.SetUint64(pending_apply_versions);
+    root.AddMember("pending_apply_versions", pending_apply_versions_value, root.GetAllocator());
+    rapidjson::Value apply_lag_value;
+    apply_lag_value.SetInt64(apply_lag_seconds);
+    root.AddMember("apply_lag_seconds", apply_lag_value, root.GetAllocator());
+
     rapidjson::Value last_version_value;
     std::string last_version_str =
             strings::Substitute("$0_$1", last_version.major_number(), last_version.minor_number());
@@ -4507,6 +4542,25 @@ void TabletUpdates::get_basic_info_extra(TabletBasicInfo& info) {
     }
 }
 
+Status TabletUpdates::load_primary_index() {
+    auto manager = StorageEngine::instance()->update_manager();
+    auto index_entry = manager->index_cache().get_or_create(_tablet.tablet_id());
+    index_entry->update_expire_time(MonotonicMillis() + manager->get_index_cache_expire_ms(_tablet));
+    auto& index = index_entry->value();
+    Status st;
+    {
+        std::lock_guard lg(_index_lock);
+        st = index.load(&_tablet);
+    }
+    manager->index_cache().update_object_size(index_entry, index.memory_usage());
+    if (!st.ok()) {
+        manager->index_cache().remove(index_entry);
+        return st;
+    }
+    manager->index_cache().release(index_entry);
+    return Status::OK();
+}
+
 Status TabletUpdates::pk_index_major_compaction() {
     auto manager = StorageEngine::instance()->update_manager();
     auto index_entry = manager->index_cache().get_or_create(_tablet.tablet_id());
@@ -4596,6 +4650,12 @@ Status TabletUpdates::load_snapshot(const SnapshotMeta& snapshot_meta, bool rest
                 strings::Substitute("load snapshot failed, tablet updates is in error state: tablet:$0 $1",
                                     _tablet.tablet_id(), _error_msg));
     }
+    // the rows of the snapshot replace or add to the rows of the tablet without going through the apply
+    PkRowCache::instance()->begin_update(_tablet.tablet_id());
+    DeferOp end_row_cache_update([&]() {
+        PkRowCache::instance()->invalidate_tablet(_tablet.tablet_id());
+        PkRowCache::instance()->end_update(_tablet.tablet_id());
+    });
     // disable compaction temporarily when doing load_snapshot
     int64_t prev_last_compaction_time_ms = _last_compaction_time_ms;
     DeferOp op([&] { _last_compaction_time_ms = prev_last_compaction_time_ms; });
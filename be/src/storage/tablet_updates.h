@@ -203,6 +203,11 @@ public:
 
     void get_compaction_status(std::string* json_result);
 
+    // Get the number of committed versions waiting to be applied, and how long the
+    // oldest of them has been waiting in seconds.
+    // [thread-safe]
+    void get_apply_lag(size_t* pending_versions, int64_t* lag_seconds);
+
     // Remove version whose creation time is less than |expire_time|.
     // [thread-safe]
     void remove_expired_versions(int64_t expire_time);
@@ -344,6 +349,9 @@ public:
 
     Status pk_index_major_compaction();
 
+    // Load the primary index of this tablet into the index cache, used to warm the index up before the first write
+    Status load_primary_index();
+
     // get the max rowset creation time for largest major version
     int64_t max_rowset_creation_time();
 
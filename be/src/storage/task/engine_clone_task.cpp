@@ -37,6 +37,7 @@
 #include <fmt/format.h>
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <set>
 
@@ -57,13 +58,17 @@
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "service/backend_options.h"
+#include "storage/primary_index_warmer.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/snapshot_manager.h"
+#include "storage/tablet_manager.h"
 #include "storage/tablet_updates.h"
+#include "storage/update_manager.h"
 #include "util/defer_op.h"
 #include "util/network_util.h"
 #include "util/string_parser.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 
 using std::set;
@@ -577,18 +582,12 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
         }
     }
 
-    // Get copy from remote
-    uint64_t total_file_size = 0;
-    MonotonicStopWatch watch;
-    watch.start();
-    for (int i = 0; i < file_name_list.size(); ++i) {
-        std::string& file_name = file_name_list[i];
-        auto remote_file_url = remote_url_prefix + file_name;
-
-        uint64_t file_size = 0;
-        if (use_file_name_and_size_format) {
-            file_size = file_size_list[i];
-        } else {
+    // Get the file sizes and check the disk capacity for all of them
+    if (!use_file_name_and_size_format) {
+        file_size_list.resize(file_name_list.size());
+        for (int i = 0; i < file_name_list.size(); ++i) {
+            auto remote_file_url = remote_url_prefix + file_name_list[i];
+            int64_t& file_size = file_size_list[i];
             auto get_file_size_cb = [&remote_file_url, &file_size](HttpClient* client) {
                 RETURN_IF_ERROR(client->init(remote_file_url));
                 client->set_timeout_ms(GET_LENGTH_TIMEOUT * 1000);
@@ -598,13 +597,25 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             };
             RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, get_file_size_cb));
         }
+    }
+    uint64_t total_file_size = 0;
+    for (int64_t file_size : file_size_list) {
+        total_file_size += file_size;
+    }
+    if (data_dir->capacity_limit_reached(total_file_size)) {
+        return Status::InternalError("Disk reach capacity limit");
+    }
 
-        // check disk capacity
-        if (data_dir->capacity_limit_reached(file_size)) {
-            return Status::InternalError("Disk reach capacity limit");
+    // The files are downloaded in parallel and share the download speed limit
+    const int parallelism = std::max<int>(1, std::min<int>(config::clone_download_parallelism, file_name_list.size()));
+    const int64_t speed_kbps = std::max<int64_t>(1, config::max_download_speed_kbps / parallelism);
+    auto download_file = [&](int i) -> Status {
+        if (StorageEngine::instance()->bg_worker_stopped()) {
+            return Status::InternalError("Process is going to quit. The download will stop.");
         }
-
-        total_file_size += file_size;
+        const std::string& file_name = file_name_list[i];
+        auto remote_file_url = remote_url_prefix + file_name;
+        const uint64_t file_size = file_size_list[i];
         uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
         if (estimate_timeout < config::download_low_speed_time) {
             estimate_timeout = config::download_low_speed_time;
@@ -615,13 +626,18 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
         VLOG(1) << "Downloading " << remote_file_url << " to " << local_path << ". bytes=" << file_size
                 << " timeout=" << estimate_timeout;
 
-        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size](HttpClient* client) {
+        int attempt = 0;
+        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size, speed_kbps,
+                            &attempt](HttpClient* client) {
             RETURN_IF_ERROR(client->init(remote_file_url));
             client->set_timeout_ms(estimate_timeout * 1000);
-            RETURN_IF_ERROR(client->download(local_file_path));
+            client->set_max_download_speed_kbps(speed_kbps);
+            // A retry resumes from the bytes already downloaded. The one after a failed resume starts over, in
+            // case the remote backend does not serve ranges.
+            const bool resume = (attempt++ % 2) == 1;
+            ASSIGN_OR_RETURN(uint64_t local_file_size, client->download(local_file_path, resume));
 
             // Check file length
-            uint64_t local_file_size = std::filesystem::file_size(local_file_path);
             if (local_file_size != file_size) {
                 LOG(WARNING) << "Fail to download " << remote_file_url << ". file_size=" << local_file_size << "/"
                              << file_size;
@@ -630,8 +646,38 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
             return Status::OK();
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    MonotonicStopWatch watch;
+    watch.start();
+    // The header file is downloaded alone after all the others
+    const int num_data_files = static_cast<int>(file_name_list.size()) - 1;
+    std::vector<Status> download_status(std::max(num_data_files, 0));
+    if (parallelism > 1 && num_data_files > 1) {
+        std::unique_ptr<ThreadPool> pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("clone_download").set_max_threads(parallelism).build(&pool));
+        for (int i = 0; i < num_data_files; ++i) {
+            auto task = [&download_status, &download_file, i]() { download_status[i] = download_file(i); };
+            if (!pool->submit_func(task).ok()) {
+                task();
+            }
+        }
+        pool->wait();
+    } else {
+        for (int i = 0; i < num_data_files; ++i) {
+            download_status[i] = download_file(i);
+            if (!download_status[i].ok()) {
+                break;
+            }
+        }
+    }
+    for (const auto& st : download_status) {
+        RETURN_IF_ERROR(st);
+    }
+    if (!file_name_list.empty()) {
+        RETURN_IF_ERROR(download_file(num_data_files));
+    }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
@@ -991,6 +1037,12 @@ Status EngineCloneTask::_finish_clone_primary(Tablet* tablet, const std::string&
 
     int64_t expired_stale_sweep_endtime = UnixSeconds() - config::tablet_rowset_stale_sweep_time_sec;
     tablet->updates()->remove_expired_versions(expired_stale_sweep_endtime);
+    if (st.ok() && config::enable_pk_index_warmup) {
+        auto tablet_ptr = StorageEngine::instance()->tablet_manager()->get_tablet(tablet->tablet_id());
+        if (tablet_ptr != nullptr) {
+            StorageEngine::instance()->update_manager()->get_primary_index_warmer()->submit(tablet_ptr);
+        }
+    }
     LOG(INFO) << "Loaded snapshot of tablet " << tablet->tablet_id() << ", removing directory " << clone_dir;
     st = fs::remove_all(clone_dir);
     LOG_IF(WARNING, !st.ok()) << "Fail to remove clone directory " << clone_dir << ": " << st;
@@ -125,6 +125,8 @@ TxnManager::TxnManager(int32_t txn_map_shard_size, int32_t txn_shard_size, uint3
     _txn_map_locks = std::unique_ptr<std::shared_mutex[]>(new std::shared_mutex[_txn_map_shard_size]);
     _txn_tablet_maps = std::unique_ptr<txn_tablet_map_t[]>(new txn_tablet_map_t[_txn_map_shard_size]);
     _txn_partition_maps = std::unique_ptr<txn_partition_map_t[]>(new txn_partition_map_t[_txn_map_shard_size]);
+    _tablet_txn_maps = std::unique_ptr<tablet_txn_map_t[]>(new tablet_txn_map_t[_txn_map_shard_size]);
+    _tablet_txn_map_locks = std::unique_ptr<std::mutex[]>(new std::mutex[_txn_map_shard_size]);
     // we will get "store_num = 0" if it acts as cn, just ignore flush pool
     if (store_num > 0) {
         auto st = ThreadPoolBuilder("meta-flush")
@@ -208,6 +210,7 @@ Status TxnManager::prepare_txn(TPartitionId partition_id, TTransactionId transac
     TabletTxnInfo load_info(load_id, nullptr);
     txn_tablet_map[key][tablet_info] = load_info;
     _insert_txn_partition_map_unlocked(transaction_id, partition_id);
+    _add_tablet_txn_unlocked(tablet_id, key);
 
     VLOG(3) << "add transaction to engine successfully."
             << "partition_id: " << key.first << ", txn_id: " << key.second << ", tablet: " << tablet_info.to_string();
@@ -295,6 +298,7 @@ Status TxnManager::commit_txn(KVStore* meta, TPartitionId partition_id, TTransac
         }
         // [tablet_info] = load_info;
         _insert_txn_partition_map_unlocked(transaction_id, partition_id);
+        _add_tablet_txn_unlocked(tablet_id, key);
         VLOG(1) << "Commit txn successfully. "
                 << " tablet: " << tablet_id << ", txn_id: " << key.second << ", rowsetid: " << rowset_ptr->rowset_id()
                 << " #segment:" << rowset_ptr->num_segments() << " #delfile:" << rowset_ptr->num_delete_files()
@@ -335,7 +339,7 @@ Status TxnManager::publish_txn(TPartitionId partition_id, const TabletSharedPtr&
             txn_info.publish_time = UnixSeconds();
             txn_info.version = version;
             add_txn_info_history(txn_info);
-            it->second.erase(tablet_txn_info_itr);
+            _erase_tablet_txn_unlocked(key, &it->second, tablet_txn_info_itr);
             VLOG(1) << "add txn info history. txn_id: " << transaction_id << ", partition_id: " << partition_id
                     << ", tablet_id: " << tablet->tablet_id() << ", schema_hash: " << tablet->schema_hash()
                     << ", rowset_id: " << rowset->rowset_id() << ", version: " << version;
@@ -449,8 +453,8 @@ Status TxnManager::rollback_txn(TPartitionId partition_id, TTransactionId transa
                 return Status::AlreadyExist(
                         fmt::format("Txn already exists. tablet_id: {}, txn_id: {}", tablet_id, transaction_id));
             }
+            _erase_tablet_txn_unlocked(key, &it->second, load_itr);
         }
-        it->second.erase(tablet_info);
         if (with_log) {
             VLOG(1) << "rollback transaction partition_id: " << key.first << ", txn_id: " << key.second
                     << ", tablet: " << tablet_info.to_string();
@@ -500,8 +504,8 @@ Status TxnManager::delete_txn(KVStore* meta, TPartitionId partition_id, TTransac
                         << (load_info.rowset != nullptr ? load_info.rowset->rowset_id().to_string() : "0");
             }
         }
+        _erase_tablet_txn_unlocked(key, &it->second, load_itr);
     }
-    it->second.erase(tablet_info);
     if (it->second.empty()) {
         txn_tablet_map.erase(it);
         _clear_txn_partition_map_unlocked(transaction_id, partition_id);
@@ -517,17 +521,16 @@ void TxnManager::get_tablet_related_txns(TTabletId tablet_id, SchemaHash schema_
     }
 
     TabletInfo tablet_info(tablet_id, schema_hash, tablet_uid);
-    for (int32_t i = 0; i < _txn_map_shard_size; i++) {
-        std::shared_lock txn_rdlock(_txn_map_locks[i]);
-        txn_tablet_map_t& txn_tablet_map = _txn_tablet_maps[i];
-        for (auto& it : txn_tablet_map) {
-            if (it.second.find(tablet_info) != it.second.end()) {
-                *partition_id = it.first.first;
-                transaction_ids->insert(it.first.second);
-                VLOG(3) << "find transaction on tablet."
-                        << "partition_id: " << it.first.first << ", txn_id: " << it.first.second
-                        << ", tablet: " << tablet_info.to_string();
-            }
+    for (const auto& key : _get_tablet_txn_keys(tablet_id)) {
+        std::shared_lock txn_rdlock(_get_txn_map_lock(key.second));
+        txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(key.second);
+        auto it = txn_tablet_map.find(key);
+        if (it != txn_tablet_map.end() && it->second.find(tablet_info) != it->second.end()) {
+            *partition_id = key.first;
+            transaction_ids->insert(key.second);
+            VLOG(3) << "find transaction on tablet."
+                    << "partition_id: " << key.first << ", txn_id: " << key.second
+                    << ", tablet: " << tablet_info.to_string();
         }
     }
 }
@@ -537,31 +540,31 @@ void TxnManager::get_tablet_related_txns(TTabletId tablet_id, SchemaHash schema_
 void TxnManager::force_rollback_tablet_related_txns(KVStore* meta, TTabletId tablet_id, SchemaHash schema_hash,
                                                     const TabletUid& tablet_uid) {
     TabletInfo tablet_info(tablet_id, schema_hash, tablet_uid);
-    for (int32_t i = 0; i < _txn_map_shard_size; i++) {
-        std::unique_lock txn_wrlock(_txn_map_locks[i]);
-        txn_tablet_map_t& txn_tablet_map = _txn_tablet_maps[i];
-        for (auto it = txn_tablet_map.begin(); it != txn_tablet_map.end();) {
-            auto load_itr = it->second.find(tablet_info);
-            if (load_itr != it->second.end()) {
-                TabletTxnInfo& load_info = load_itr->second;
-                if (load_info.rowset != nullptr && meta != nullptr) {
-                    LOG(INFO) << " delete transaction from engine "
-                              << ", tablet: " << tablet_info.to_string()
-                              << ", rowset id: " << load_info.rowset->rowset_id();
-                    (void)RowsetMetaManager::remove(meta, tablet_uid, load_info.rowset->rowset_id());
-                }
-                LOG(INFO) << "remove tablet related txn."
-                          << " partition_id: " << it->first.first << ", txn_id: " << it->first.second
-                          << ", tablet: " << tablet_info.to_string() << ", rowset: "
-                          << (load_info.rowset != nullptr ? load_info.rowset->rowset_id().to_string() : "0");
-                it->second.erase(tablet_info);
-            }
-            if (it->second.empty()) {
-                _clear_txn_partition_map_unlocked(it->first.second, it->first.first);
-                it = txn_tablet_map.erase(it);
-            } else {
-                ++it;
+    for (const auto& key : _get_tablet_txn_keys(tablet_id)) {
+        std::unique_lock txn_wrlock(_get_txn_map_lock(key.second));
+        txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(key.second);
+        auto it = txn_tablet_map.find(key);
+        if (it == txn_tablet_map.end()) {
+            continue;
+        }
+        auto load_itr = it->second.find(tablet_info);
+        if (load_itr != it->second.end()) {
+            TabletTxnInfo& load_info = load_itr->second;
+            if (load_info.rowset != nullptr && meta != nullptr) {
+                LOG(INFO) << " delete transaction from engine "
+                          << ", tablet: " << tablet_info.to_string()
+                          << ", rowset id: " << load_info.rowset->rowset_id();
+                (void)RowsetMetaManager::remove(meta, tablet_uid, load_info.rowset->rowset_id());
             }
+            LOG(INFO) << "remove tablet related txn."
+                      << " partition_id: " << key.first << ", txn_id: " << key.second
+                      << ", tablet: " << tablet_info.to_string() << ", rowset: "
+                      << (load_info.rowset != nullptr ? load_info.rowset->rowset_id().to_string() : "0");
+            _erase_tablet_txn_unlocked(key, &it->second, load_itr);
+        }
+        if (it->second.empty()) {
+            _clear_txn_partition_map_unlocked(key.second, key.first);
+            txn_tablet_map.erase(it);
         }
     }
 }
@@ -665,4 +668,42 @@ void TxnManager::_clear_txn_partition_map_unlocked(int64_t transaction_id, int64
     }
 }
 
+void TxnManager::_add_tablet_txn_unlocked(int64_t tablet_id, const TxnKey& key) {
+    const int64_t shard = tablet_id & (_txn_map_shard_size - 1);
+    std::lock_guard lock(_tablet_txn_map_locks[shard]);
+    _tablet_txn_maps[shard][tablet_id].insert(key);
+}
+
+void TxnManager::_erase_tablet_txn_unlocked(const TxnKey& key, std::map<TabletInfo, TabletTxnInfo>* tablet_txn_infos,
+                                            std::map<TabletInfo, TabletTxnInfo>::iterator itr) {
+    const int64_t tablet_id = itr->first.tablet_id;
+    auto next = tablet_txn_infos->erase(itr);
+    // TabletInfo is ordered by tablet id first, so another one of the same tablet id would be next to it
+    if ((next != tablet_txn_infos->end() && next->first.tablet_id == tablet_id) ||
+        (next != tablet_txn_infos->begin() && std::prev(next)->first.tablet_id == tablet_id)) {
+        return;
+    }
+    const int64_t shard = tablet_id & (_txn_map_shard_size - 1);
+    std::lock_guard lock(_tablet_txn_map_locks[shard]);
+    auto& tablet_txn_map = _tablet_txn_maps[shard];
+    auto it = tablet_txn_map.find(tablet_id);
+    if (it != tablet_txn_map.end()) {
+        it->second.erase(key);
+        if (it->second.empty()) {
+            tablet_txn_map.erase(it);
+        }
+    }
+}
+
+std::vector<TxnManager::TxnKey> TxnManager::_get_tablet_txn_keys(int64_t tablet_id) {
+    const int64_t shard = tablet_id & (_txn_map_shard_size - 1);
+    std::lock_guard lock(_tablet_txn_map_locks[shard]);
+    auto& tablet_txn_map = _tablet_txn_maps[shard];
+    auto it = tablet_txn_map.find(tablet_id);
+    if (it == tablet_txn_map.end()) {
+        return {};
+    }
+    return {it->second.begin(), it->second.end()};
+}
+
 } // namespace starrocks
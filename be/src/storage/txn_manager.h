@@ -190,6 +190,19 @@ private:
     void _insert_txn_partition_map_unlocked(int64_t transaction_id, int64_t partition_id);
     void _clear_txn_partition_map_unlocked(int64_t transaction_id, int64_t partition_id);
 
+    typedef std::unordered_map<int64_t, std::set<TxnKey>> tablet_txn_map_t;
+
+    // add the txn `key` of the tablet to _tablet_txn_maps, or erase the txn of the tablet of `itr` from
+    // `tablet_txn_infos`, the tablets of the txn `key`, and from _tablet_txn_maps if it is the last one of its
+    // tablet id.
+    // get _txn_map_lock of the txn before calling
+    void _add_tablet_txn_unlocked(int64_t tablet_id, const TxnKey& key);
+    void _erase_tablet_txn_unlocked(const TxnKey& key, std::map<TabletInfo, TabletTxnInfo>* tablet_txn_infos,
+                                    std::map<TabletInfo, TabletTxnInfo>::iterator itr);
+
+    // the keys of the txns of the tablet in _tablet_txn_maps
+    std::vector<TxnKey> _get_tablet_txn_keys(int64_t tablet_id);
+
 private:
     const int32_t _txn_map_shard_size;
 
@@ -205,6 +218,12 @@ private:
 
     std::unique_ptr<std::shared_mutex[]> _txn_map_locks;
 
+    // tablet_id -> the keys of its txns in _txn_tablet_maps, so that the txns of a tablet are found without scanning
+    // all the txns. Sharded by tablet id with _txn_map_shard_size shards, _tablet_txn_map_locks[i] protect
+    // _tablet_txn_maps[i], which are modified alongside with '_txn_tablet_maps' and locked after _txn_map_locks.
+    std::unique_ptr<tablet_txn_map_t[]> _tablet_txn_maps;
+    std::unique_ptr<std::mutex[]> _tablet_txn_map_locks;
+
     // Dynamic thread pool used to concurrently flush WAL to disk
     std::unique_ptr<ThreadPool> _flush_thread_pool;
 
@@ -23,6 +23,7 @@
 #include "storage/del_vector.h"
 #include "storage/kv_store.h"
 #include "storage/persistent_index_compaction_manager.h"
+#include "storage/primary_index_warmer.h"
 #include "storage/rowset_column_update_state.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet.h"
@@ -33,8 +34,11 @@
 
 namespace starrocks {
 
-Status LocalDelvecLoader::load(const TabletSegmentId& tsid, int64_t version, DelVectorPtr* pdelvec) {
-    return StorageEngine::instance()->update_manager()->get_del_vec(_meta, tsid, version, pdelvec);
+Status LocalDelvecLoader::load(const TabletSegmentId& tsid, int64_t version, DelVectorCSPtr* pdelvec) {
+    DelVectorPtr delvec;
+    RETURN_IF_ERROR(StorageEngine::instance()->update_manager()->get_del_vec(_meta, tsid, version, &delvec));
+    *pdelvec = std::move(delvec);
+    return Status::OK();
 }
 
 Status LocalDeltaColumnGroupLoader::load(const TabletSegmentId& tsid, int64_t version, DeltaColumnGroupList* pdcgs) {
@@ -106,10 +110,16 @@ Status UpdateManager::init() {
 
     _persistent_index_compaction_mgr = std::make_unique<PersistentIndexCompactionManager>();
     RETURN_IF_ERROR(_persistent_index_compaction_mgr->init());
+
+    _primary_index_warmer = std::make_unique<PrimaryIndexWarmer>();
+    RETURN_IF_ERROR(_primary_index_warmer->init());
     return Status::OK();
 }
 
 void UpdateManager::stop() {
+    if (_primary_index_warmer) {
+        _primary_index_warmer->stop();
+    }
     if (_get_pindex_thread_pool) {
         _get_pindex_thread_pool->shutdown();
     }
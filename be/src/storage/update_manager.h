@@ -38,11 +38,12 @@ class RowsetUpdateState;
 class RowsetColumnUpdateState;
 class Tablet;
 class PersistentIndexCompactionManager;
+class PrimaryIndexWarmer;
 
 class LocalDelvecLoader : public DelvecLoader {
 public:
     LocalDelvecLoader(KVStore* meta) : _meta(meta) {}
-    Status load(const TabletSegmentId& tsid, int64_t version, DelVectorPtr* pdelvec);
+    Status load(const TabletSegmentId& tsid, int64_t version, DelVectorCSPtr* pdelvec);
 
 private:
     KVStore* _meta = nullptr;
@@ -96,6 +97,7 @@ public:
     ThreadPool* apply_thread_pool() { return _apply_thread_pool.get(); }
     ThreadPool* get_pindex_thread_pool() { return _get_pindex_thread_pool.get(); }
     PersistentIndexCompactionManager* get_pindex_compaction_mgr() { return _persistent_index_compaction_mgr.get(); }
+    PrimaryIndexWarmer* get_primary_index_warmer() { return _primary_index_warmer.get(); }
 
     DynamicCache<uint64_t, PrimaryIndex>& index_cache() { return _index_cache; }
 
@@ -179,6 +181,7 @@ private:
     std::unique_ptr<ThreadPool> _apply_thread_pool;
     std::unique_ptr<ThreadPool> _get_pindex_thread_pool;
     std::unique_ptr<PersistentIndexCompactionManager> _persistent_index_compaction_mgr;
+    std::unique_ptr<PrimaryIndexWarmer> _primary_index_warmer;
 
     bool _keep_pindex_bf = true;
 
@@ -0,0 +1,62 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "storage/vector_index/vector_index_option.h"
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <map>
+
+#include "gutil/strings/numbers.h"
+
+namespace starrocks {
+
+static Status parse_uint32_property(const std::map<std::string, std::string>& properties, const std::string& key,
+                                    uint32_t* value) {
+    auto it = properties.find(key);
+    if (it == properties.end()) {
+        return Status::OK();
+    }
+    if (!safe_strtou32(it->second, value)) {
+        return Status::InvalidArgument("Invalid vector index property " + key + ": " + it->second);
+    }
+    return Status::OK();
+}
+
+StatusOr<VectorIndexOptions> get_vector_index_options(const TabletIndex& tablet_index) {
+    VectorIndexOptions options;
+    const auto& properties = tablet_index.index_properties();
+    RETURN_IF_ERROR(parse_uint32_property(properties, VECTOR_INDEX_DIM_KEY, &options.dim));
+    if (options.dim == 0) {
+        return Status::InvalidArgument("The vector index needs a positive " + VECTOR_INDEX_DIM_KEY);
+    }
+    RETURN_IF_ERROR(parse_uint32_property(properties, VECTOR_INDEX_NLIST_KEY, &options.nlist));
+    RETURN_IF_ERROR(
+            parse_uint32_property(tablet_index.search_properties(), VECTOR_INDEX_NPROBE_KEY, &options.nprobe));
+
+    auto metric = properties.find(VECTOR_INDEX_METRIC_TYPE_KEY);
+    if (metric != properties.end()) {
+        const auto lower_metric = boost::algorithm::to_lower_copy(metric->second);
+        if (lower_metric == VECTOR_METRIC_L2_DISTANCE) {
+            options.metric = VectorIndexMetric::L2_DISTANCE;
+        } else if (lower_metric == VECTOR_METRIC_COSINE_SIMILARITY) {
+            options.metric = VectorIndexMetric::COSINE_SIMILARITY;
+        } else {
+            return Status::InvalidArgument("Do not support vector index metric_type: " + metric->second);
+        }
+    }
+    return options;
+}
+
+} // namespace starrocks
@@ -0,0 +1,70 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/statusor.h"
+#include "storage/tablet_schema.h"
+
+namespace starrocks {
+
+// The index properties of a VECTOR index.
+const std::string VECTOR_INDEX_DIM_KEY = "dim";
+const std::string VECTOR_INDEX_METRIC_TYPE_KEY = "metric_type";
+const std::string VECTOR_INDEX_NLIST_KEY = "nlist";
+// The search properties of a VECTOR index.
+const std::string VECTOR_INDEX_NPROBE_KEY = "nprobe";
+
+const std::string VECTOR_METRIC_L2_DISTANCE = "l2_distance";
+const std::string VECTOR_METRIC_COSINE_SIMILARITY = "cosine_similarity";
+
+// The number of the lists probed by a search when neither the query nor the index sets it.
+constexpr uint32_t VECTOR_INDEX_DEFAULT_NPROBE = 8;
+
+enum class VectorIndexMetric : uint32_t {
+    // squared euclidean distance
+    L2_DISTANCE = 0,
+    // the vectors are normalized, and the distance is 1 - cosine similarity
+    COSINE_SIMILARITY = 1,
+};
+
+struct VectorIndexOptions {
+    uint32_t dim = 0;
+    VectorIndexMetric metric = VectorIndexMetric::L2_DISTANCE;
+    // the number of the inverted lists, 0 picks sqrt(num vectors) when the index is built
+    uint32_t nlist = 0;
+    uint32_t nprobe = VECTOR_INDEX_DEFAULT_NPROBE;
+};
+
+StatusOr<VectorIndexOptions> get_vector_index_options(const TabletIndex& tablet_index);
+
+// The approximate nearest neighbor search pushed down into the segments: only the `k` rows nearest to
+// `query_vector` in the index on the column `column_unique_id` are read from each segment.
+struct VectorSearchOption {
+    int32_t column_unique_id = -1;
+    std::vector<float> query_vector;
+    uint32_t k = 0;
+    // 0 uses the nprobe of the index
+    uint32_t nprobe = 0;
+};
+
+using VectorSearchOptionPtr = std::shared_ptr<const VectorSearchOption>;
+
+} // namespace starrocks
@@ -0,0 +1,133 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "storage/vector_index/vector_index_reader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <queue>
+
+#include "fs/fs.h"
+#include "gutil/strings/substitute.h"
+#include "storage/vector_index/vector_index_util.hpp"
+#include "util/coding.h"
+
+namespace starrocks {
+
+template <typename T>
+static void read_array(const char** data, size_t count, std::vector<T>* dst) {
+    dst->resize(count);
+    std::memcpy(dst->data(), *data, count * sizeof(T));
+    *data += count * sizeof(T);
+}
+
+StatusOr<std::unique_ptr<VectorIndexReader>> VectorIndexReader::load(const std::string& path) {
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(path));
+    ASSIGN_OR_RETURN(auto file, fs->new_random_access_file(path));
+    ASSIGN_OR_RETURN(auto content, file->read_all());
+    auto corruption = [&](const std::string& reason) {
+        return Status::Corruption(strings::Substitute("Bad vector index file $0: $1", path, reason));
+    };
+    if (content.size() < VECTOR_INDEX_HEADER_SIZE + VECTOR_INDEX_FOOTER_SIZE) {
+        return corruption("file too small");
+    }
+    const char* data = content.data();
+    if (decode_fixed32_le(reinterpret_cast<const uint8_t*>(data)) != VECTOR_INDEX_MAGIC ||
+        decode_fixed32_le(reinterpret_cast<const uint8_t*>(data + content.size() - VECTOR_INDEX_FOOTER_SIZE)) !=
+                VECTOR_INDEX_MAGIC) {
+        return corruption("bad magic");
+    }
+
+    auto reader = std::make_unique<VectorIndexReader>();
+    reader->_dim = decode_fixed32_le(reinterpret_cast<const uint8_t*>(data + 4));
+    const uint32_t metric = decode_fixed32_le(reinterpret_cast<const uint8_t*>(data + 8));
+    const uint64_t nlist = decode_fixed32_le(reinterpret_cast<const uint8_t*>(data + 12));
+    const uint64_t num_vectors = decode_fixed32_le(reinterpret_cast<const uint8_t*>(data + 16));
+    if (metric > static_cast<uint32_t>(VectorIndexMetric::COSINE_SIMILARITY)) {
+        return corruption("unknown metric " + std::to_string(metric));
+    }
+    reader->_metric = static_cast<VectorIndexMetric>(metric);
+    const uint64_t dim = reader->_dim;
+    const uint64_t expected_size = VECTOR_INDEX_HEADER_SIZE + nlist * dim * sizeof(float) +
+                                   (nlist + 1) * sizeof(uint32_t) + num_vectors * sizeof(rowid_t) +
+                                   num_vectors * dim * sizeof(float) + VECTOR_INDEX_FOOTER_SIZE;
+    if (content.size() != expected_size) {
+        return corruption(strings::Substitute("size $0 does not match $1", content.size(), expected_size));
+    }
+
+    data += VECTOR_INDEX_HEADER_SIZE;
+    read_array(&data, nlist * dim, &reader->_centroids);
+    read_array(&data, nlist + 1, &reader->_list_offsets);
+    read_array(&data, num_vectors, &reader->_rowids);
+    read_array(&data, num_vectors * dim, &reader->_vectors);
+    const auto& offsets = reader->_list_offsets;
+    if (offsets.front() != 0 || offsets.back() != num_vectors || !std::is_sorted(offsets.begin(), offsets.end())) {
+        return corruption("bad list offsets");
+    }
+    return reader;
+}
+
+Status VectorIndexReader::search(const std::vector<float>& query, size_t k, size_t nprobe,
+                                 const roaring::Roaring& candidates,
+                                 std::vector<std::pair<rowid_t, float>>* result) const {
+    if (query.size() != _dim) {
+        return Status::InvalidArgument(
+                strings::Substitute("The query vector has $0 dimensions, but the index has $1", query.size(), _dim));
+    }
+    result->clear();
+    const size_t nlist = _list_offsets.size() - 1;
+    if (k == 0 || nlist == 0) {
+        return Status::OK();
+    }
+
+    std::vector<float> q(query);
+    if (_metric == VectorIndexMetric::COSINE_SIMILARITY) {
+        vector_normalize(q.data(), _dim);
+    }
+
+    std::vector<std::pair<float, uint32_t>> lists(nlist);
+    for (uint32_t c = 0; c < nlist; c++) {
+        lists[c] = {vector_distance(_metric, q.data(), _centroids.data() + c * _dim, _dim), c};
+    }
+    std::sort(lists.begin(), lists.end());
+
+    // a max heap of the k nearest rows found so far
+    std::priority_queue<std::pair<float, rowid_t>> nearest;
+    nprobe = std::max<size_t>(nprobe, 1);
+    for (size_t probed = 0; probed < nlist && (probed < nprobe || nearest.size() < k); probed++) {
+        const uint32_t c = lists[probed].second;
+        for (uint32_t i = _list_offsets[c]; i < _list_offsets[c + 1]; i++) {
+            if (!candidates.contains(_rowids[i])) {
+                continue;
+            }
+            const float distance = vector_distance(_metric, q.data(), _vectors.data() + size_t(i) * _dim, _dim);
+            if (nearest.size() < k) {
+                nearest.emplace(distance, _rowids[i]);
+            } else if (distance < nearest.top().first) {
+                nearest.pop();
+                nearest.emplace(distance, _rowids[i]);
+            }
+        }
+    }
+
+    result->resize(nearest.size());
+    for (size_t i = nearest.size(); i > 0; i--) {
+        (*result)[i - 1] = {nearest.top().second, nearest.top().first};
+        nearest.pop();
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks
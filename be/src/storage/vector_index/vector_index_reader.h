@@ -0,0 +1,60 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+#include <roaring/roaring.hh>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/statusor.h"
+#include "storage/olap_common.h"
+#include "storage/vector_index/vector_index_option.h"
+
+namespace starrocks {
+
+// Loads the whole IVF-flat index written by VectorIndexWriter into memory, see vector_index_util.hpp for the
+// layout.
+class VectorIndexReader {
+public:
+    static StatusOr<std::unique_ptr<VectorIndexReader>> load(const std::string& path);
+
+    uint32_t dim() const { return _dim; }
+    VectorIndexMetric metric() const { return _metric; }
+    uint32_t num_vectors() const { return _rowids.size(); }
+
+    // Finds the `k` vectors nearest to `query` among the rows of `candidates`, nearest first, in the `nprobe` lists
+    // whose centroids are nearest to `query`. More lists are probed while fewer than `k` rows are found, so that a
+    // selective `candidates` still returns `k` rows when the segment has them.
+    Status search(const std::vector<float>& query, size_t k, size_t nprobe, const roaring::Roaring& candidates,
+                  std::vector<std::pair<rowid_t, float>>* result) const;
+
+    size_t mem_usage() const {
+        return (_centroids.size() + _vectors.size()) * sizeof(float) +
+               (_list_offsets.size() + _rowids.size()) * sizeof(uint32_t);
+    }
+
+private:
+    uint32_t _dim = 0;
+    VectorIndexMetric _metric = VectorIndexMetric::L2_DISTANCE;
+    std::vector<float> _centroids;
+    std::vector<uint32_t> _list_offsets;
+    std::vector<rowid_t> _rowids;
+    std::vector<float> _vectors;
+};
+
+} // namespace starrocks
@@ -0,0 +1,77 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "storage/vector_index/vector_index_option.h"
+
+namespace starrocks {
+
+// The vector index of a segment column is an IVF-flat index, stored in one file next to the segment, see
+// IndexDescriptor::vector_index_file_path:
+//
+//   header    : magic(4) dim(4) metric(4) nlist(4) num_vectors(4)
+//   centroids : float[nlist * dim]
+//   offsets   : uint32[nlist + 1], the vectors of list i are [offsets[i], offsets[i + 1])
+//   rowids    : uint32[num_vectors], in list order
+//   vectors   : float[num_vectors * dim], in list order
+//   footer    : magic(4)
+//
+// All the integers and floats are little endian. The vectors of COSINE_SIMILARITY are normalized when written.
+
+constexpr uint32_t VECTOR_INDEX_MAGIC = 0x58445649;
+constexpr size_t VECTOR_INDEX_HEADER_SIZE = 20;
+constexpr size_t VECTOR_INDEX_FOOTER_SIZE = 4;
+
+inline float vector_l2_distance(const float* a, const float* b, size_t dim) {
+    float sum = 0;
+    for (size_t i = 0; i < dim; i++) {
+        const float diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+inline float vector_inner_product(const float* a, const float* b, size_t dim) {
+    float sum = 0;
+    for (size_t i = 0; i < dim; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+// The distance of `metric` between `a` and `b`, smaller is nearer.
+inline float vector_distance(VectorIndexMetric metric, const float* a, const float* b, size_t dim) {
+    if (metric == VectorIndexMetric::COSINE_SIMILARITY) {
+        return 1 - vector_inner_product(a, b, dim);
+    }
+    return vector_l2_distance(a, b, dim);
+}
+
+// Scales `v` to the unit length, a zero vector is left as is.
+inline void vector_normalize(float* v, size_t dim) {
+    const float norm = std::sqrt(vector_inner_product(v, v, dim));
+    if (norm > 0) {
+        for (size_t i = 0; i < dim; i++) {
+            v[i] /= norm;
+        }
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,192 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "storage/vector_index/vector_index_writer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+#include "column/array_column.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "fs/fs.h"
+#include "gutil/casts.h"
+#include "gutil/strings/substitute.h"
+#include "storage/vector_index/vector_index_util.hpp"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+// k-means is trained on at most this many vectors per list, evenly strided over the segment.
+static constexpr size_t kTrainVectorsPerList = 64;
+static constexpr int kKMeansIterations = 10;
+static constexpr uint32_t kMaxNlist = 65536;
+
+static uint32_t nearest_centroid(VectorIndexMetric metric, const float* v, const std::vector<float>& centroids,
+                                 uint32_t nlist, size_t dim) {
+    uint32_t nearest = 0;
+    float nearest_distance = std::numeric_limits<float>::max();
+    for (uint32_t c = 0; c < nlist; c++) {
+        const float distance = vector_distance(metric, v, centroids.data() + c * dim, dim);
+        if (distance < nearest_distance) {
+            nearest = c;
+            nearest_distance = distance;
+        }
+    }
+    return nearest;
+}
+
+StatusOr<std::unique_ptr<VectorIndexWriter>> VectorIndexWriter::create(const TabletIndex& tablet_index,
+                                                                       std::string path) {
+    ASSIGN_OR_RETURN(auto options, get_vector_index_options(tablet_index));
+    return std::make_unique<VectorIndexWriter>(std::move(path), options);
+}
+
+Status VectorIndexWriter::append(const Column& column) {
+    const auto* array_column = down_cast<const ArrayColumn*>(ColumnHelper::get_data_column(&column));
+    const auto& offsets = array_column->offsets().get_data();
+    const Column& elements = array_column->elements();
+    const auto* values = down_cast<const FloatColumn*>(ColumnHelper::get_data_column(&elements));
+    const size_t dim = _options.dim;
+
+    for (size_t row = 0; row < column.size(); row++, _next_rowid++) {
+        if (column.is_null(row)) {
+            continue;
+        }
+        const uint32_t begin = offsets[row];
+        const uint32_t size = offsets[row + 1] - begin;
+        if (size != dim) {
+            return Status::InvalidArgument(
+                    strings::Substitute("The vector index needs $0 dimensions, but the row has $1", dim, size));
+        }
+        if (elements.has_null()) {
+            for (uint32_t i = begin; i < begin + size; i++) {
+                if (elements.is_null(i)) {
+                    return Status::InvalidArgument("The vector index does not support the null elements");
+                }
+            }
+        }
+        const float* v = values->get_data().data() + begin;
+        _vectors.insert(_vectors.end(), v, v + dim);
+        if (_options.metric == VectorIndexMetric::COSINE_SIMILARITY) {
+            vector_normalize(_vectors.data() + _vectors.size() - dim, dim);
+        }
+        _rowids.push_back(_next_rowid);
+    }
+    return Status::OK();
+}
+
+std::vector<float> VectorIndexWriter::_train(uint32_t nlist) const {
+    const size_t dim = _options.dim;
+    const size_t num_vectors = _rowids.size();
+    const size_t num_train = std::min(num_vectors, nlist * kTrainVectorsPerList);
+    auto train_vector = [&](size_t i) { return _vectors.data() + (i * num_vectors / num_train) * dim; };
+
+    std::vector<float> centroids(nlist * dim);
+    for (uint32_t c = 0; c < nlist; c++) {
+        const float* v = train_vector(c * num_train / nlist);
+        std::copy(v, v + dim, centroids.data() + c * dim);
+    }
+
+    std::vector<double> sums(nlist * dim);
+    std::vector<uint32_t> counts(nlist);
+    for (int iteration = 0; iteration < kKMeansIterations; iteration++) {
+        std::fill(sums.begin(), sums.end(), 0);
+        std::fill(counts.begin(), counts.end(), 0);
+        for (size_t i = 0; i < num_train; i++) {
+            const float* v = train_vector(i);
+            const uint32_t c = nearest_centroid(_options.metric, v, centroids, nlist, dim);
+            counts[c]++;
+            for (size_t d = 0; d < dim; d++) {
+                sums[c * dim + d] += v[d];
+            }
+        }
+        for (uint32_t c = 0; c < nlist; c++) {
+            // an empty list keeps its previous centroid
+            if (counts[c] == 0) {
+                continue;
+            }
+            float* centroid = centroids.data() + c * dim;
+            for (size_t d = 0; d < dim; d++) {
+                centroid[d] = static_cast<float>(sums[c * dim + d] / counts[c]);
+            }
+            if (_options.metric == VectorIndexMetric::COSINE_SIMILARITY) {
+                vector_normalize(centroid, dim);
+            }
+        }
+    }
+    return centroids;
+}
+
+Status VectorIndexWriter::finish() {
+    const size_t dim = _options.dim;
+    const auto num_vectors = static_cast<uint32_t>(_rowids.size());
+    uint32_t nlist = 0;
+    if (num_vectors > 0) {
+        nlist = _options.nlist > 0 ? _options.nlist : static_cast<uint32_t>(std::sqrt(num_vectors));
+        nlist = std::clamp<uint32_t>(nlist, 1, std::min(num_vectors, kMaxNlist));
+    }
+    const std::vector<float> centroids = _train(nlist);
+
+    // group the vectors by their nearest centroid
+    std::vector<uint32_t> lists(num_vectors);
+    std::vector<uint32_t> list_offsets(nlist + 1, 0);
+    for (uint32_t i = 0; i < num_vectors; i++) {
+        lists[i] = nearest_centroid(_options.metric, _vectors.data() + i * dim, centroids, nlist, dim);
+        list_offsets[lists[i] + 1]++;
+    }
+    for (uint32_t c = 0; c < nlist; c++) {
+        list_offsets[c + 1] += list_offsets[c];
+    }
+    std::vector<uint32_t> next(list_offsets.begin(), list_offsets.end() - 1);
+    std::vector<rowid_t> rowids(num_vectors);
+    std::vector<float> vectors(_vectors.size());
+    for (uint32_t i = 0; i < num_vectors; i++) {
+        const uint32_t pos = next[lists[i]]++;
+        rowids[pos] = _rowids[i];
+        std::copy(_vectors.data() + i * dim, _vectors.data() + (i + 1) * dim, vectors.data() + pos * dim);
+    }
+    _rowids.clear();
+    _rowids.shrink_to_fit();
+    _vectors.clear();
+    _vectors.shrink_to_fit();
+
+    faststring header;
+    put_fixed32_le(&header, VECTOR_INDEX_MAGIC);
+    put_fixed32_le(&header, _options.dim);
+    put_fixed32_le(&header, static_cast<uint32_t>(_options.metric));
+    put_fixed32_le(&header, nlist);
+    put_fixed32_le(&header, num_vectors);
+    faststring footer;
+    put_fixed32_le(&footer, VECTOR_INDEX_MAGIC);
+
+    const Slice slices[] = {
+            Slice(header.data(), header.size()),
+            Slice(reinterpret_cast<const char*>(centroids.data()), centroids.size() * sizeof(float)),
+            Slice(reinterpret_cast<const char*>(list_offsets.data()), list_offsets.size() * sizeof(uint32_t)),
+            Slice(reinterpret_cast<const char*>(rowids.data()), rowids.size() * sizeof(rowid_t)),
+            Slice(reinterpret_cast<const char*>(vectors.data()), vectors.size() * sizeof(float)),
+            Slice(footer.data(), footer.size())};
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(_path));
+    ASSIGN_OR_RETURN(auto file, fs->new_writable_file(_path));
+    RETURN_IF_ERROR(file->appendv(slices, std::size(slices)));
+    return file->close();
+}
+
+} // namespace starrocks
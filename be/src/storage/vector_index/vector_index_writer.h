@@ -0,0 +1,57 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/statusor.h"
+#include "storage/olap_common.h"
+#include "storage/vector_index/vector_index_option.h"
+
+namespace starrocks {
+
+class Column;
+
+// Collects the vectors of an ARRAY<FLOAT> column in memory and builds the IVF-flat index of them on finish(),
+// see vector_index_util.hpp for the layout. The null rows are not indexed, so they are never returned by a search.
+class VectorIndexWriter {
+public:
+    VectorIndexWriter(std::string path, const VectorIndexOptions& options)
+            : _path(std::move(path)), _options(options) {}
+
+    static StatusOr<std::unique_ptr<VectorIndexWriter>> create(const TabletIndex& tablet_index, std::string path);
+
+    // Appends the rows of the ARRAY<FLOAT> `column`, every non null row must have `dim` non null elements.
+    Status append(const Column& column);
+
+    uint64_t total_mem_footprint() const { return _vectors.size() * sizeof(float) + _rowids.size() * sizeof(rowid_t); }
+
+    Status finish();
+
+private:
+    // Clusters the vectors into `nlist` lists by k-means, returns the centroids.
+    std::vector<float> _train(uint32_t nlist) const;
+
+    std::string _path;
+    VectorIndexOptions _options;
+    rowid_t _next_rowid = 0;
+    std::vector<rowid_t> _rowids;
+    std::vector<float> _vectors;
+};
+
+} // namespace starrocks
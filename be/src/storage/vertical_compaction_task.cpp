@@ -19,14 +19,19 @@
 #include "column/schema.h"
 #include "runtime/current_thread.h"
 #include "storage/chunk_helper.h"
+#include "storage/compaction_manager.h"
 #include "storage/compaction_utils.h"
 #include "storage/olap_common.h"
 #include "storage/row_source_mask.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_writer.h"
+#include "storage/storage_engine.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_reader_params.h"
+#include "util/blocking_queue.hpp"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 #include "util/trace.h"
 
@@ -191,6 +196,12 @@ StatusOr<size_t> VerticalCompactionTask::_compact_data(bool is_key, int32_t chun
                                                        RowSourceMaskBuffer* mask_buffer,
                                                        std::vector<RowSourceMask>* source_masks) {
     DCHECK(reader);
+    ThreadPool* read_ahead_pool = StorageEngine::instance()->compaction_manager()->read_ahead_pool();
+    if (read_ahead_pool != nullptr && config::vertical_compaction_read_ahead_chunks > 0) {
+        return _compact_data_with_read_ahead(read_ahead_pool, is_key, chunk_size, column_group, schema, reader,
+                                             output_rs_writer, mask_buffer, source_masks);
+    }
+
     size_t output_rows = 0;
     auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
     auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
@@ -247,4 +258,96 @@ StatusOr<size_t> VerticalCompactionTask::_compact_data(bool is_key, int32_t chun
     return output_rows;
 }
 
+// The reader merges the chunks of the column group in a task of the read-ahead pool and hands them over through
+// a bounded queue, while the current thread encodes and writes them. The reader task is the only one touching
+// the reader and the mask buffer until it finishes.
+StatusOr<size_t> VerticalCompactionTask::_compact_data_with_read_ahead(
+        ThreadPool* pool, bool is_key, int32_t chunk_size, const std::vector<uint32_t>& column_group,
+        const Schema& schema, TabletReader* reader, RowsetWriter* output_rs_writer, RowSourceMaskBuffer* mask_buffer,
+        std::vector<RowSourceMask>* source_masks) {
+    struct ReadChunk {
+        ChunkPtr chunk;
+        // the counters of the reader after reading the chunk
+        int64_t del_filtered_rows = 0;
+        size_t merged_rows = 0;
+    };
+    BlockingQueue<ReadChunk> queue(config::vertical_compaction_read_ahead_chunks);
+    Status read_status;
+    CountDownLatch read_finished(1);
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    auto read_task = [&, mem_tracker]() {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+        auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
+        while (LIKELY(!should_stop())) {
+            auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
+            auto st = reader->get_next(chunk.get(), source_masks);
+            if (!st.ok()) {
+                if (!st.is_end_of_file()) {
+                    LOG(WARNING) << "reader get next error. tablet=" << _tablet->tablet_id()
+                                 << ", err=" << st.to_string();
+                    read_status = Status::InternalError(fmt::format("reader get_next error: {}", st.to_string()));
+                }
+                break;
+            }
+            ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet_schema, chunk.get());
+            if (is_key && !source_masks->empty()) {
+                read_status = mask_buffer->write(*source_masks);
+                if (!read_status.ok()) {
+                    break;
+                }
+            }
+            source_masks->clear();
+            ReadChunk read_chunk{std::move(chunk), reader->stats().rows_del_filtered, reader->merged_rows()};
+            if (!queue.blocking_put(std::move(read_chunk))) {
+                // the writer has given up
+                break;
+            }
+        }
+        queue.shutdown();
+        read_finished.count_down();
+    };
+    // the queue of the pool is unbounded, so it fails only when the pool is shutting down
+    RETURN_IF_ERROR(pool->submit_func(read_task));
+
+    Status status;
+    size_t output_rows = 0;
+    int64_t column_group_del_filtered_rows = 0;
+    size_t column_group_merged_rows = 0;
+    ReadChunk read_chunk;
+    while (queue.blocking_get(&read_chunk)) {
+#ifndef BE_TEST
+        status = tls_thread_status.mem_tracker()->check_mem_limit("Compaction");
+        if (!status.ok()) {
+            LOG(WARNING) << "fail to execute compaction: " << status.message() << std::endl;
+            break;
+        }
+#endif
+        status = output_rs_writer->add_columns(*read_chunk.chunk, column_group, is_key);
+        if (!status.ok()) {
+            break;
+        }
+
+        const size_t num_rows = read_chunk.chunk->num_rows();
+        _task_info.total_output_num_rows += num_rows;
+        _task_info.total_del_filtered_rows += read_chunk.del_filtered_rows - column_group_del_filtered_rows;
+        _task_info.total_merged_rows += read_chunk.merged_rows - column_group_merged_rows;
+        column_group_del_filtered_rows = read_chunk.del_filtered_rows;
+        column_group_merged_rows = read_chunk.merged_rows;
+        if (is_key) {
+            output_rows += num_rows;
+        }
+    }
+    // wake up the reader if the writer stops early, and wait for it to release the reader and the mask buffer
+    queue.shutdown();
+    read_finished.wait();
+    RETURN_IF_ERROR(status);
+    RETURN_IF_ERROR(read_status);
+    if (should_stop()) {
+        LOG(INFO) << "vertical compaction task_id:" << _task_info.task_id << ", tablet:" << _task_info.tablet_id
+                  << " is stopped.";
+        return Status::Cancelled("vertical compaction task is stopped.");
+    }
+    return output_rows;
+}
+
 } // namespace starrocks
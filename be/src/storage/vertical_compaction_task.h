@@ -26,6 +26,7 @@ namespace starrocks {
 
 class RowsetWriter;
 class TabletReader;
+class ThreadPool;
 class RowSourceMaskBuffer;
 struct RowSourceMask;
 
@@ -48,6 +49,12 @@ private:
                                    const Schema& schema, TabletReader* reader, RowsetWriter* output_rs_writer,
                                    RowSourceMaskBuffer* mask_buffer, std::vector<RowSourceMask>* source_masks);
 
+    StatusOr<size_t> _compact_data_with_read_ahead(ThreadPool* pool, bool is_key, int32_t chunk_size,
+                                                   const std::vector<uint32_t>& column_group, const Schema& schema,
+                                                   TabletReader* reader, RowsetWriter* output_rs_writer,
+                                                   RowSourceMaskBuffer* mask_buffer,
+                                                   std::vector<RowSourceMask>* source_masks);
+
     StatusOr<int32_t> _calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group);
 };
 
@@ -216,6 +216,49 @@ BitmapValue& BitmapValue::operator|=(const BitmapValue& rhs) {
     return *this;
 }
 
+void BitmapValue::fast_union(const std::vector<const BitmapValue*>& values) {
+    std::vector<const detail::Roaring64Map*> bitmaps;
+    for (const auto* value : values) {
+        if (value->_type == BITMAP) {
+            bitmaps.push_back(value->_bitmap.get());
+        }
+    }
+    if (bitmaps.size() <= 1) {
+        for (const auto* value : values) {
+            *this |= *value;
+        }
+        return;
+    }
+
+    _mem_usage = 0;
+    if (_type == BITMAP) {
+        bitmaps.push_back(_bitmap.get());
+    }
+    auto bitmap =
+            std::make_shared<detail::Roaring64Map>(detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+    switch (_type) {
+    case SINGLE:
+        bitmap->add(_sv);
+        break;
+    case SET:
+        for (auto x : *_set) {
+            bitmap->add(x);
+        }
+        _set.reset();
+        break;
+    default:
+        break;
+    }
+    _bitmap = std::move(bitmap);
+    _type = BITMAP;
+
+    for (const auto* value : values) {
+        if (value->_type != BITMAP) {
+            *this |= *value;
+        }
+    }
+}
+
 // Note: rhs BitmapValue is only readable after this method
 // Compute the intersection between the current bitmap and the provided bitmap.
 // Possible type transitions are:
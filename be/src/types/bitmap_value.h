@@ -134,6 +134,9 @@ public:
     // SINGLE -> BITMAP
     BitmapValue& operator|=(const BitmapValue& rhs);
 
+    // Same as |= each of `values` in turn, but the roaring bitmaps among them are unioned in one multi-way pass.
+    void fast_union(const std::vector<const BitmapValue*>& values);
+
     // Note: rhs BitmapValue is only readable after this method
     // Compute the intersection between the current bitmap and the provided bitmap.
     // Possible type transitions are:
@@ -38,7 +38,9 @@
 // the detail class such as Roaring64Map.
 // So other files should not include this file except bitmap_value.cpp.
 #include <cstdint>
+#include <map>
 #include <optional>
+#include <vector>
 
 #include "roaring/array_util.h"
 #include "roaring/bitset_util.h"
@@ -880,10 +882,22 @@ public:
      * pointer).
      */
     static Roaring64Map fastunion(size_t n, const Roaring64Map** inputs) {
-        Roaring64Map ans;
-        // not particularly fast
+        // Partition the 32-bit bitmaps of the inputs by their high 32 bits, then union each partition in one
+        // multi-way Roaring::fastunion, which computes the cardinality of a container once at the end instead of
+        // after each pairwise union.
+        std::map<uint32_t, std::vector<const Roaring*>> partitions;
         for (size_t lcv = 0; lcv < n; ++lcv) {
-            ans |= *(inputs[lcv]);
+            for (const auto& map_entry : inputs[lcv]->roarings) {
+                partitions[map_entry.first].push_back(&map_entry.second);
+            }
+        }
+        Roaring64Map ans;
+        for (auto& [high, parts] : partitions) {
+            if (parts.size() == 1) {
+                ans.roarings.emplace(high, *parts[0]);
+            } else {
+                ans.roarings.emplace(high, Roaring::fastunion(parts.size(), parts.data()));
+            }
         }
         return ans;
     }
@@ -34,6 +34,7 @@
 
 #include "types/hll.h"
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 
@@ -58,7 +59,8 @@ std::string HyperLogLog::empty() {
     return buf;
 }
 
-HyperLogLog::HyperLogLog(const HyperLogLog& other) : _type(other._type), _hash_set(other._hash_set) {
+HyperLogLog::HyperLogLog(const HyperLogLog& other)
+        : _type(other._type), _hash_set(other._hash_set), _sparse_registers(other._sparse_registers) {
     if (other._registers.data != nullptr) {
         MemChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
         DCHECK_NE(_registers.data, nullptr);
@@ -71,6 +73,7 @@ HyperLogLog& HyperLogLog::operator=(const HyperLogLog& other) {
     if (this != &other) {
         this->_type = other._type;
         this->_hash_set = other._hash_set;
+        this->_sparse_registers = other._sparse_registers;
 
         if (_registers.data != nullptr) {
             MemChunkAllocator::instance()->free(_registers);
@@ -87,7 +90,10 @@ HyperLogLog& HyperLogLog::operator=(const HyperLogLog& other) {
     return *this;
 }
 
-HyperLogLog::HyperLogLog(HyperLogLog&& other) noexcept : _type(other._type), _hash_set(std::move(other._hash_set)) {
+HyperLogLog::HyperLogLog(HyperLogLog&& other) noexcept
+        : _type(other._type),
+          _hash_set(std::move(other._hash_set)),
+          _sparse_registers(std::move(other._sparse_registers)) {
     _registers = other._registers;
 
     other._type = HLL_DATA_EMPTY;
@@ -98,6 +104,7 @@ HyperLogLog& HyperLogLog::operator=(HyperLogLog&& other) noexcept {
     if (this != &other) {
         this->_type = other._type;
         this->_hash_set = std::move(other._hash_set);
+        this->_sparse_registers = std::move(other._sparse_registers);
 
         if (_registers.data != nullptr) {
             MemChunkAllocator::instance()->free(_registers);
@@ -128,15 +135,19 @@ HyperLogLog::~HyperLogLog() {
     }
 }
 
-// Convert explicit values to register format, and clear explicit values.
-// NOTE: this function won't modify _type.
-void HyperLogLog::_convert_explicit_to_register() {
-    DCHECK(_type == HLL_DATA_EXPLICIT) << "_type(" << _type << ") should be explicit(" << HLL_DATA_EXPLICIT << ")";
+void HyperLogLog::_allocate_registers() {
     DCHECK_EQ(_registers.data, nullptr);
     MemChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
     DCHECK_NE(_registers.data, nullptr);
     DCHECK_EQ(_registers.size, HLL_REGISTERS_COUNT);
     memset(_registers.data, 0, HLL_REGISTERS_COUNT);
+}
+
+// Convert explicit values to register format, and clear explicit values.
+// NOTE: this function won't modify _type.
+void HyperLogLog::_convert_explicit_to_register() {
+    DCHECK(_type == HLL_DATA_EXPLICIT) << "_type(" << _type << ") should be explicit(" << HLL_DATA_EXPLICIT << ")";
+    _allocate_registers();
 
     for (auto value : _hash_set) {
         _update_registers(value);
@@ -146,8 +157,94 @@ void HyperLogLog::_convert_explicit_to_register() {
     phmap::flat_hash_set<uint64_t>().swap(_hash_set);
 }
 
-// Change HLL_DATA_EXPLICIT to HLL_DATA_FULL directly, because HLL_DATA_SPARSE
-// is implemented in the same way in memory with HLL_DATA_FULL.
+// Convert explicit values to sparse registers, and clear explicit values.
+// NOTE: this function won't modify _type.
+void HyperLogLog::_convert_explicit_to_sparse() {
+    DCHECK(_type == HLL_DATA_EXPLICIT) << "_type(" << _type << ") should be explicit(" << HLL_DATA_EXPLICIT << ")";
+    DCHECK(_sparse_registers.empty());
+    _sparse_registers.reserve(_hash_set.size());
+    for (auto value : _hash_set) {
+        _sparse_registers.push_back(_register_of(value));
+    }
+    // the same index is ordered by value, keep the last one of each index
+    std::sort(_sparse_registers.begin(), _sparse_registers.end());
+    size_t size = 0;
+    for (size_t i = 0; i < _sparse_registers.size(); ++i) {
+        if (i + 1 < _sparse_registers.size() && (_sparse_registers[i] >> 8) == (_sparse_registers[i + 1] >> 8)) {
+            continue;
+        }
+        _sparse_registers[size++] = _sparse_registers[i];
+    }
+    _sparse_registers.resize(size);
+
+    phmap::flat_hash_set<uint64_t>().swap(_hash_set);
+}
+
+// Convert sparse registers to register format, and clear sparse registers.
+// NOTE: this function won't modify _type.
+void HyperLogLog::_convert_sparse_to_registers() {
+    DCHECK(_type == HLL_DATA_SPARSE) << "_type(" << _type << ") should be sparse(" << HLL_DATA_SPARSE << ")";
+    _allocate_registers();
+    for (auto reg : _sparse_registers) {
+        _registers.data[reg >> 8] = (uint8_t)reg;
+    }
+    std::vector<uint32_t>().swap(_sparse_registers);
+}
+
+void HyperLogLog::_check_sparse_size() {
+    if (_sparse_registers.size() > HLL_SPARSE_MEMORY_THRESHOLD) {
+        _convert_sparse_to_registers();
+        _type = HLL_DATA_FULL;
+    }
+}
+
+void HyperLogLog::_update_sparse(uint32_t reg) {
+    // the value of a register is never 0, so (index << 8) is ordered before the register of the same index
+    auto iter = std::lower_bound(_sparse_registers.begin(), _sparse_registers.end(), reg & ~0xFFu);
+    if (iter != _sparse_registers.end() && (*iter >> 8) == (reg >> 8)) {
+        *iter = std::max(*iter, reg);
+    } else {
+        _sparse_registers.insert(iter, reg);
+    }
+}
+
+void HyperLogLog::_merge_sparse(const std::vector<uint32_t>& other) {
+    std::vector<uint32_t> merged;
+    merged.reserve(_sparse_registers.size() + other.size());
+    auto lhs = _sparse_registers.begin();
+    auto rhs = other.begin();
+    while (lhs != _sparse_registers.end() && rhs != other.end()) {
+        if ((*lhs >> 8) < (*rhs >> 8)) {
+            merged.push_back(*lhs++);
+        } else if ((*rhs >> 8) < (*lhs >> 8)) {
+            merged.push_back(*rhs++);
+        } else {
+            merged.push_back(std::max(*lhs++, *rhs++));
+        }
+    }
+    merged.insert(merged.end(), lhs, _sparse_registers.end());
+    merged.insert(merged.end(), rhs, other.end());
+    _sparse_registers.swap(merged);
+}
+
+bool HyperLogLog::_load_sparse(const uint8_t* ptr, uint32_t num_registers) {
+    DCHECK(_sparse_registers.empty());
+    _sparse_registers.reserve(num_registers);
+    for (uint32_t i = 0; i < num_registers; ++i, ptr += 3) {
+        uint32_t register_idx = decode_fixed16_le(ptr);
+        uint8_t value = ptr[2];
+        if (register_idx >= HLL_REGISTERS_COUNT || value == 0 ||
+            (!_sparse_registers.empty() && (_sparse_registers.back() >> 8) >= register_idx)) {
+            std::vector<uint32_t>().swap(_sparse_registers);
+            return false;
+        }
+        _sparse_registers.push_back(register_idx << 8 | value);
+    }
+    return true;
+}
+
+// Change HLL_DATA_EXPLICIT to HLL_DATA_SPARSE, and then to HLL_DATA_FULL when the
+// sparse registers take too much memory.
 void HyperLogLog::update(uint64_t hash_value) {
     switch (_type) {
     case HLL_DATA_EMPTY:
@@ -159,10 +256,13 @@ void HyperLogLog::update(uint64_t hash_value) {
             _hash_set.insert(hash_value);
             break;
         }
-        _convert_explicit_to_register();
-        _type = HLL_DATA_FULL;
+        _convert_explicit_to_sparse();
+        _type = HLL_DATA_SPARSE;
         // fall through
     case HLL_DATA_SPARSE:
+        _update_sparse(_register_of(hash_value));
+        _check_sparse_size();
+        break;
     case HLL_DATA_FULL:
         _update_registers(hash_value);
         break;
@@ -211,6 +311,38 @@ MFV_DEFAULT(void merge_registers_impl(uint8_t* dest, const uint8_t* other) {
     }
 })
 
+MFV_AVX2(int count_zero_registers_impl(const uint8_t* registers) {
+    constexpr int SIMD_SIZE = sizeof(__m256i);
+    static_assert(HLL_REGISTERS_COUNT % SIMD_SIZE == 0);
+    const __m256i zero = _mm256_setzero_si256();
+    int count = 0;
+    for (int i = 0; i < HLL_REGISTERS_COUNT; i += SIMD_SIZE) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(registers + i));
+        count += __builtin_popcount(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, zero)));
+    }
+    return count;
+})
+
+MFV_SSE42(int count_zero_registers_impl(const uint8_t* registers) {
+    constexpr int SIMD_SIZE = sizeof(__m128i);
+    static_assert(HLL_REGISTERS_COUNT % SIMD_SIZE == 0);
+    const __m128i zero = _mm_setzero_si128();
+    int count = 0;
+    for (int i = 0; i < HLL_REGISTERS_COUNT; i += SIMD_SIZE) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(registers + i));
+        count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero)));
+    }
+    return count;
+})
+
+MFV_DEFAULT(int count_zero_registers_impl(const uint8_t* registers) {
+    int count = 0;
+    for (int i = 0; i < HLL_REGISTERS_COUNT; i++) {
+        count += (registers[i] == 0);
+    }
+    return count;
+})
+
 void HyperLogLog::merge(const HyperLogLog& other) {
     // fast path
     if (other._type == HLL_DATA_EMPTY) {
@@ -225,11 +357,10 @@ void HyperLogLog::merge(const HyperLogLog& other) {
             _hash_set = other._hash_set;
             break;
         case HLL_DATA_SPARSE:
+            _sparse_registers = other._sparse_registers;
+            break;
         case HLL_DATA_FULL:
-            DCHECK_EQ(_registers.data, nullptr);
-            MemChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
-            DCHECK_NE(_registers.data, nullptr);
-            DCHECK_EQ(_registers.size, HLL_REGISTERS_COUNT);
+            _allocate_registers();
             memcpy(_registers.data, other._registers.data, HLL_REGISTERS_COUNT);
             break;
         default:
@@ -244,11 +375,17 @@ void HyperLogLog::merge(const HyperLogLog& other) {
             // HLL_EXPLICLIT_INT64_NUM. This is OK because the max value is 2 * 160.
             _hash_set.insert(other._hash_set.begin(), other._hash_set.end());
             if (_hash_set.size() > HLL_EXPLICLIT_INT64_NUM) {
-                _convert_explicit_to_register();
-                _type = HLL_DATA_FULL;
+                _convert_explicit_to_sparse();
+                _type = HLL_DATA_SPARSE;
+                _check_sparse_size();
             }
             break;
         case HLL_DATA_SPARSE:
+            _convert_explicit_to_sparse();
+            _type = HLL_DATA_SPARSE;
+            _merge_sparse(other._sparse_registers);
+            _check_sparse_size();
+            break;
         case HLL_DATA_FULL:
             _convert_explicit_to_register();
             merge_registers_impl(_registers.data, other._registers.data);
@@ -259,7 +396,28 @@ void HyperLogLog::merge(const HyperLogLog& other) {
         }
         break;
     }
-    case HLL_DATA_SPARSE:
+    case HLL_DATA_SPARSE: {
+        switch (other._type) {
+        case HLL_DATA_EXPLICIT:
+            for (auto hash_value : other._hash_set) {
+                _update_sparse(_register_of(hash_value));
+            }
+            _check_sparse_size();
+            break;
+        case HLL_DATA_SPARSE:
+            _merge_sparse(other._sparse_registers);
+            _check_sparse_size();
+            break;
+        case HLL_DATA_FULL:
+            _convert_sparse_to_registers();
+            merge_registers_impl(_registers.data, other._registers.data);
+            _type = HLL_DATA_FULL;
+            break;
+        default:
+            break;
+        }
+        break;
+    }
     case HLL_DATA_FULL: {
         switch (other._type) {
         case HLL_DATA_EXPLICIT:
@@ -268,6 +426,11 @@ void HyperLogLog::merge(const HyperLogLog& other) {
             }
             break;
         case HLL_DATA_SPARSE:
+            for (auto reg : other._sparse_registers) {
+                uint8_t& value = _registers.data[reg >> 8];
+                value = std::max(value, (uint8_t)reg);
+            }
+            break;
         case HLL_DATA_FULL:
             merge_registers_impl(_registers.data, other._registers.data);
             break;
@@ -287,6 +450,22 @@ size_t HyperLogLog::max_serialized_size() const {
     case HLL_DATA_EXPLICIT:
         return 2 + _hash_set.size() * 8;
     case HLL_DATA_SPARSE:
+        return 1 + 4 + _sparse_registers.size() * 3;
+    case HLL_DATA_FULL:
+        return 1 + HLL_REGISTERS_COUNT;
+    }
+}
+
+uint64_t HyperLogLog::mem_usage() const {
+    switch (_type) {
+    case HLL_DATA_EMPTY:
+    default:
+        return 1;
+    case HLL_DATA_EXPLICIT:
+        // one control byte for each slot of the hash set
+        return 1 + _hash_set.capacity() * (sizeof(uint64_t) + 1);
+    case HLL_DATA_SPARSE:
+        return 1 + _sparse_registers.capacity() * sizeof(uint32_t);
     case HLL_DATA_FULL:
         return 1 + HLL_REGISTERS_COUNT;
     }
@@ -314,7 +493,18 @@ size_t HyperLogLog::serialize(uint8_t* dst) const {
         }
         break;
     }
-    case HLL_DATA_SPARSE:
+    case HLL_DATA_SPARSE: {
+        static_assert(HLL_SPARSE_MEMORY_THRESHOLD <= HLL_SPARSE_THRESHOLD);
+        *ptr++ = HLL_DATA_SPARSE;
+        encode_fixed32_le(ptr, _sparse_registers.size());
+        ptr += 4;
+        for (auto reg : _sparse_registers) {
+            encode_fixed16_le(ptr, reg >> 8);
+            ptr += 2;
+            *ptr++ = (uint8_t)reg;
+        }
+        break;
+    }
     case HLL_DATA_FULL: {
         uint32_t num_non_zero_registers = 0;
         for (int i = 0; i < HLL_REGISTERS_COUNT; i++) {
@@ -423,15 +613,14 @@ bool HyperLogLog::deserialize(const Slice& slice) {
         break;
     }
     case HLL_DATA_SPARSE: {
-        DCHECK_EQ(_registers.data, nullptr);
-        MemChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
-        DCHECK_NE(_registers.data, nullptr);
-        DCHECK_EQ(_registers.size, HLL_REGISTERS_COUNT);
-        memset(_registers.data, 0, HLL_REGISTERS_COUNT);
-
         // 2-5(4 byte): number of registers
         uint32_t num_registers = decode_fixed32_le(ptr);
         ptr += 4;
+        if (num_registers <= HLL_SPARSE_MEMORY_THRESHOLD && _load_sparse(ptr, num_registers)) {
+            break;
+        }
+        _type = HLL_DATA_FULL;
+        _allocate_registers();
         for (uint32_t i = 0; i < num_registers; ++i) {
             // 2 bytes: register index
             // 1 byte: register value
@@ -442,10 +631,7 @@ bool HyperLogLog::deserialize(const Slice& slice) {
         break;
     }
     case HLL_DATA_FULL: {
-        DCHECK_EQ(_registers.data, nullptr);
-        MemChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
-        DCHECK_NE(_registers.data, nullptr);
-        DCHECK_EQ(_registers.size, HLL_REGISTERS_COUNT);
+        _allocate_registers();
         // 2+ : hll register value
         memcpy(_registers.data, ptr, HLL_REGISTERS_COUNT);
         break;
@@ -548,15 +734,21 @@ int64_t HyperLogLog::estimate_cardinality() const {
         alpha = 0.7213f / (1 + 1.079f / num_streams);
     }
 
-    float harmonic_mean = 0;
-    int num_zero_registers = 0;
+    int num_zero_registers = _type == HLL_DATA_SPARSE ? num_streams - static_cast<int>(_sparse_registers.size())
+                                                      : count_zero_registers_impl(_registers.data);
+    // Each zero register adds 1 to the harmonic sum below, so with a third of the registers zero the
+    // estimate is at most 3 * alpha * num_streams < 2.5 * num_streams, and linear counting is used
+    // without summing the registers. Sparse registers always have that many zero registers.
+    static_assert(HLL_SPARSE_MEMORY_THRESHOLD <= HLL_REGISTERS_COUNT * 2 / 3);
+    if (num_zero_registers >= num_streams / 3) {
+        double estimate = num_streams * std::log(static_cast<float>(num_streams) / num_zero_registers);
+        return std::lround(estimate);
+    }
 
+    // NOTE: keep the order of the sum, the estimate should be the same as the one of FE.
+    float harmonic_mean = 0;
     for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
         harmonic_mean += harmomic_tables[_registers.data[i]];
-
-        if (_registers.data[i] == 0) {
-            ++num_zero_registers;
-        }
     }
 
     harmonic_mean = 1.0f / harmonic_mean;
@@ -588,6 +780,8 @@ std::string HyperLogLog::to_string() const {
         return strings::Substitute("hash set size: $0\ncardinality:$1\ntype:$2", _hash_set.size(),
                                    estimate_cardinality(), _type);
     case HLL_DATA_SPARSE:
+        return strings::Substitute("sparse registers: $0\ncardinality:$1\ntype:$2", _sparse_registers.size(),
+                                   estimate_cardinality(), _type);
     case HLL_DATA_FULL: {
         return strings::Substitute("cardinality:$1\ntype:$2", estimate_cardinality(), _type);
     }
@@ -599,6 +793,11 @@ std::string HyperLogLog::to_string() const {
 void HyperLogLog::clear() {
     _type = HLL_DATA_EMPTY;
     _hash_set.clear();
+    std::vector<uint32_t>().swap(_sparse_registers);
+    if (_registers.data != nullptr) {
+        MemChunkAllocator::instance()->free(_registers);
+        _registers.data = nullptr;
+    }
 }
 
 DataSketchesHll::DataSketchesHll(const Slice& src) {
@@ -76,6 +76,9 @@ class Slice;
 //
 // HLL_DATA_FULL: most space-consuming, store all registers
 //
+// In memory, a sparse HLL keeps its non-zero registers in a sorted vector until there are more
+// than HLL_SPARSE_MEMORY_THRESHOLD of them, and then switches to the full registers.
+//
 // A HLL value will change in the sequence empty -> explicit -> sparse -> full, and not
 // allow reverse.
 //
@@ -142,7 +145,8 @@ public:
 
     uint64_t serialize_size() const { return max_serialized_size(); }
 
-    uint64_t mem_usage() const { return max_serialized_size(); }
+    // Return the bytes taken in memory by the current representation
+    uint64_t mem_usage() const;
 
     // common interface
     void clear();
@@ -161,20 +165,47 @@ private:
     // Allocate memory by MemChunkAllocator in order to reuse memory.
     MemChunk _registers;
 
+    // The non-zero registers of HLL_DATA_SPARSE, each is (index << 8 | value), sorted by index.
+    std::vector<uint32_t> _sparse_registers;
+
 private:
+    void _allocate_registers();
+
     void _convert_explicit_to_register();
+    void _convert_explicit_to_sparse();
+    void _convert_sparse_to_registers();
 
-    // update one hash value into this registers
-    void _update_registers(uint64_t hash_value) {
+    // Change to HLL_DATA_FULL if there are too many sparse registers.
+    void _check_sparse_size();
+
+    // Return the register of a hash value as (index << 8 | value).
+    static uint32_t _register_of(uint64_t hash_value) {
         // Use the lower bits to index into the number of streams and then
         // find the first 1 bit after the index bits.
-        int idx = hash_value % HLL_REGISTERS_COUNT;
+        uint32_t idx = hash_value % HLL_REGISTERS_COUNT;
         hash_value >>= HLL_COLUMN_PRECISION;
         // make sure max first_one_bit is HLL_ZERO_COUNT_BITS + 1
         hash_value |= ((uint64_t)1 << HLL_ZERO_COUNT_BITS);
-        auto first_one_bit = (uint8_t)(__builtin_ctzl(hash_value) + 1);
-        _registers.data[idx] = std::max((uint8_t)_registers.data[idx], first_one_bit);
+        auto first_one_bit = (uint32_t)(__builtin_ctzl(hash_value) + 1);
+        return idx << 8 | first_one_bit;
     }
+
+    // update one hash value into this registers
+    void _update_registers(uint64_t hash_value) {
+        uint32_t reg = _register_of(hash_value);
+        uint8_t& value = _registers.data[reg >> 8];
+        value = std::max(value, (uint8_t)reg);
+    }
+
+    // update one register into the sparse registers
+    void _update_sparse(uint32_t reg);
+
+    // merge sorted sparse registers into the sparse registers
+    void _merge_sparse(const std::vector<uint32_t>& other);
+
+    // Load the registers of a sparse payload as sparse registers, return false if they are not
+    // ordered by distinct indexes or have a zero value.
+    bool _load_sparse(const uint8_t* ptr, uint32_t num_registers);
 };
 
 const static datasketches::target_hll_type HLL_TGT_TYPE = datasketches::HLL_6;
@@ -137,6 +137,7 @@ public:
     void clear(DirectByteBuffer* buffer, FunctionContext* ctx);
 
     jclass object_class() { return _object_class; }
+    jclass direct_buffer_class() { return _direct_buffer_class; }
 
     JVMClass& function_state_clazz();
 
@@ -455,6 +456,17 @@ struct JavaUDFContext {
     std::unique_ptr<JavaMethodDescriptor> prepare;
     std::unique_ptr<JavaMethodDescriptor> evaluate;
     std::unique_ptr<JavaMethodDescriptor> close;
+
+    // The optional vectorized method of a scalar UDF, which receives the columns of a whole chunk as direct
+    // ByteBuffers on the memory of the columns, and writes the nulls and the values of the result into the
+    // direct ByteBuffers of the result column. No value is boxed on either side.
+    //   void evaluateBatch(int numRows, ByteBuffer[] inputs, ByteBuffer resultNulls, ByteBuffer resultData)
+    // |inputs| has, for each argument, the null flags (one byte per row, null if the argument is not nullable)
+    // followed by the values, or by the int32 offsets and the bytes for a string argument.
+    static constexpr const char* EVALUATE_BATCH_METHOD_NAME = "evaluateBatch";
+    static constexpr const char* EVALUATE_BATCH_METHOD_SIGNATURE =
+            "(I[Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;)V";
+    jmethodID evaluate_batch = nullptr;
 };
 
 // Function
@@ -177,48 +177,70 @@ Status convert_to_arrow_schema(const RowDescriptor& row_desc,
     return Status::OK();
 }
 
-Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::string* result) {
-    // create sink memory buffer outputstream with the computed capacity
-    int64_t capacity;
-    arrow::Status a_st = arrow::ipc::GetRecordBatchSize(record_batch, &capacity);
-    if (!a_st.ok()) {
-        std::stringstream msg;
-        msg << "GetRecordBatchSize failure, reason: " << a_st.ToString();
-        return Status::InternalError(msg.str());
+namespace {
+
+// An arrow output stream appending to a std::string, so the IPC messages are written once, directly into the
+// string returned to the client.
+class StringOutputStream final : public arrow::io::OutputStream {
+public:
+    explicit StringOutputStream(std::string* output) : _output(output) {}
+
+    arrow::Status Write(const void* data, int64_t nbytes) override {
+        _output->append(static_cast<const char*>(data), nbytes);
+        return arrow::Status::OK();
     }
-    auto sink_res = arrow::io::BufferOutputStream::Create(capacity, arrow::default_memory_pool());
-    if (!sink_res.ok()) {
-        std::stringstream msg;
-        msg << "create BufferOutputStream failure, reason: " << sink_res.status().ToString();
-        return Status::InternalError(msg.str());
+    arrow::Result<int64_t> Tell() const override { return static_cast<int64_t>(_output->size()); }
+    arrow::Status Close() override {
+        _closed = true;
+        return arrow::Status::OK();
+    }
+    bool closed() const override { return _closed; }
+
+private:
+    std::string* _output;
+    bool _closed = false;
+};
+
+int64_t buffers_size(const arrow::ArrayData& data) {
+    int64_t size = 0;
+    for (const auto& buffer : data.buffers) {
+        size += buffer != nullptr ? buffer->size() : 0;
+    }
+    for (const auto& child : data.child_data) {
+        size += buffers_size(*child);
+    }
+    return size;
+}
+
+} // namespace
+
+Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::string* result) {
+    // Reserve the size of the buffers plus some room for the schema and the metadata, instead of computing the
+    // exact size with a dry run of the serialization.
+    int64_t capacity = 4096;
+    for (int i = 0; i < record_batch.num_columns(); ++i) {
+        capacity += buffers_size(*record_batch.column_data(i));
     }
-    std::shared_ptr<arrow::io::BufferOutputStream> sink = sink_res.ValueOrDie();
+    result->clear();
+    result->reserve(capacity);
+    StringOutputStream sink(result);
     // create RecordBatch Writer
-    auto writer_res = arrow::ipc::MakeStreamWriter(sink.get(), record_batch.schema());
+    auto writer_res = arrow::ipc::MakeStreamWriter(&sink, record_batch.schema());
     if (!writer_res.ok()) {
         std::stringstream msg;
         msg << "open RecordBatchStreamWriter failure, reason: " << writer_res.status().ToString();
         return Status::InternalError(msg.str());
     }
     std::shared_ptr<arrow::ipc::RecordBatchWriter> record_batch_writer = writer_res.ValueOrDie();
-    // write RecordBatch to memory buffer outputstream
-    a_st = record_batch_writer->WriteRecordBatch(record_batch);
+    // write RecordBatch to the result string
+    arrow::Status a_st = record_batch_writer->WriteRecordBatch(record_batch);
     if (!a_st.ok()) {
         std::stringstream msg;
         msg << "write record batch failure, reason: " << a_st.ToString();
         return Status::InternalError(msg.str());
     }
     [[maybe_unused]] auto wr_close_st = record_batch_writer->Close();
-    auto finish_res = sink->Finish();
-    if (!finish_res.ok()) {
-        std::stringstream msg;
-        msg << "allocate result buffer failure, reason: " << finish_res.status().ToString();
-        return Status::InternalError(msg.str());
-    }
-    std::shared_ptr<arrow::Buffer> buffer = finish_res.ValueOrDie();
-    *result = buffer->ToString();
-    // close the sink
-    [[maybe_unused]] auto sk_close_st = sink->Close();
+    [[maybe_unused]] auto sk_close_st = sink.Close();
     return Status::OK();
 }
 
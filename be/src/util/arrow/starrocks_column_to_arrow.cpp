@@ -14,10 +14,15 @@
 
 #include "util/arrow/starrocks_column_to_arrow.h"
 
+#include <arrow/c/bridge.h>
+
+#include <limits>
+
 #include "column/array_column.h"
 #include "column/column_helper.h"
 #include "column/map_column.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/arrow_type_traits.h"
 #include "exprs/expr.h"
@@ -547,6 +552,92 @@ static inline StarRocksToArrowConvertFunc resolve_convert_func(LogicalType lt, A
     return it != end ? it->second : nullptr;
 }
 
+// A buffer viewing the memory of a column, which it keeps alive as long as an arrow array refers to it.
+class ColumnBuffer : public arrow::Buffer {
+public:
+    ColumnBuffer(const uint8_t* data, int64_t size, ColumnPtr column)
+            : arrow::Buffer(data, size), _column(std::move(column)) {}
+
+private:
+    ColumnPtr _column;
+};
+
+template <typename T>
+static std::shared_ptr<arrow::Buffer> make_column_buffer(const T* data, size_t count, const ColumnPtr& column) {
+    return std::make_shared<ColumnBuffer>(reinterpret_cast<const uint8_t*>(data), count * sizeof(T), column);
+}
+
+// Build the array of |column| on the buffers of the column when the layouts of StarRocks and arrow agree:
+// the integers and floating points have the same values buffer, and a BinaryColumn has the same offsets
+// and bytes buffers as an arrow string array. Only the validity bitmap of a nullable column is built,
+// because arrow uses one bit per row where a NullColumn uses one byte.
+// Leaves |array| null if the column has to be converted value by value.
+static arrow::Status share_column_buffers(const ColumnPtr& column, const TypeDescriptor& type_desc,
+                                          const std::shared_ptr<arrow::DataType>& arrow_type, arrow::MemoryPool* pool,
+                                          std::shared_ptr<arrow::Array>* array) {
+    if (!config::enable_arrow_zero_copy_export || column->is_constant()) {
+        return arrow::Status::OK();
+    }
+    const ColumnPtr& data_column =
+            column->is_nullable() ? down_cast<const NullableColumn*>(column.get())->data_column() : column;
+    const auto num_rows = static_cast<int64_t>(column->size());
+
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+    const auto lt = type_desc.type;
+    const auto at = arrow_type->id();
+#define SHARE_FIXED_LENGTH(LT, AT)                                                                 \
+    case LT: {                                                                                     \
+        if (at != AT) {                                                                            \
+            return arrow::Status::OK();                                                            \
+        }                                                                                          \
+        const auto& data = down_cast<const RunTimeColumnType<LT>*>(data_column.get())->get_data(); \
+        buffers = {nullptr, make_column_buffer(data.data(), data.size(), data_column)};            \
+        break;                                                                                     \
+    }
+    switch (lt) {
+        SHARE_FIXED_LENGTH(TYPE_TINYINT, ArrowTypeId::INT8)
+        SHARE_FIXED_LENGTH(TYPE_SMALLINT, ArrowTypeId::INT16)
+        SHARE_FIXED_LENGTH(TYPE_INT, ArrowTypeId::INT32)
+        SHARE_FIXED_LENGTH(TYPE_BIGINT, ArrowTypeId::INT64)
+        SHARE_FIXED_LENGTH(TYPE_FLOAT, ArrowTypeId::FLOAT)
+        SHARE_FIXED_LENGTH(TYPE_DOUBLE, ArrowTypeId::DOUBLE)
+    case TYPE_CHAR:
+    case TYPE_VARCHAR: {
+        if (at != ArrowTypeId::STRING || !data_column->is_binary()) {
+            return arrow::Status::OK();
+        }
+        const auto* binary = down_cast<const BinaryColumn*>(data_column.get());
+        const auto& offsets = binary->get_offset();
+        const auto& bytes = binary->get_bytes();
+        // arrow string arrays have int32 offsets
+        if (bytes.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+            return arrow::Status::OK();
+        }
+        buffers = {nullptr, make_column_buffer(offsets.data(), offsets.size(), data_column),
+                   make_column_buffer(bytes.data(), bytes.size(), data_column)};
+        break;
+    }
+    default:
+        return arrow::Status::OK();
+    }
+#undef SHARE_FIXED_LENGTH
+
+    int64_t null_count = 0;
+    if (column->is_nullable() && column->has_null()) {
+        const auto& nulls = down_cast<const NullableColumn*>(column.get())->immutable_null_column_data();
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Buffer> bitmap, arrow::AllocateBitmap(num_rows, pool));
+        uint8_t* bits = bitmap->mutable_data();
+        memset(bits, 0, bitmap->size());
+        for (int64_t i = 0; i < num_rows; ++i) {
+            bits[i >> 3] |= static_cast<uint8_t>(!nulls[i]) << (i & 7);
+            null_count += nulls[i];
+        }
+        buffers[0] = std::move(bitmap);
+    }
+    *array = arrow::MakeArray(arrow::ArrayData::Make(arrow_type, num_rows, std::move(buffers), null_count));
+    return arrow::Status::OK();
+}
+
 class ColumnToArrowArrayConverter : public arrow::TypeVisitor {
 public:
     ColumnToArrowArrayConverter(const ColumnPtr& column, arrow::MemoryPool* pool, const TypeDescriptor& type_desc,
@@ -564,6 +655,10 @@ public:
                     fmt::format("Not support to convert type {} with nullable {} to arrow type {}",     \
                                 type_to_string(_type_desc.type), _column->is_nullable(), type.name())); \
         }                                                                                               \
+        ARROW_RETURN_NOT_OK(share_column_buffers(_column, _type_desc, _arrow_type, _pool, &_array));    \
+        if (_array != nullptr) {                                                                        \
+            return arrow::Status::OK();                                                                 \
+        }                                                                                               \
         ColumnContext column_context(_type_desc, _arrow_type, func);                                    \
         std::unique_ptr<arrow::ArrayBuilder> builder;                                                   \
         ARROW_RETURN_NOT_OK(arrow::MakeBuilder(_pool, _arrow_type, &builder));                          \
@@ -651,4 +746,17 @@ Status convert_chunk_to_arrow_batch(Chunk* chunk, const std::vector<const TypeDe
     *result = arrow::RecordBatch::Make(schema, num_rows, std::move(arrays));
     return Status::OK();
 }
+
+Status export_chunk_to_arrow_c_data(Chunk* chunk, const std::vector<const TypeDescriptor*>& slot_types,
+                                    const std::vector<SlotId>& slot_ids, const std::shared_ptr<arrow::Schema>& schema,
+                                    arrow::MemoryPool* pool, struct ArrowArray* out_array,
+                                    struct ArrowSchema* out_schema) {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    RETURN_IF_ERROR(convert_chunk_to_arrow_batch(chunk, slot_types, slot_ids, schema, pool, &batch));
+    auto arrow_st = arrow::ExportRecordBatch(*batch, out_array, out_schema);
+    if (!arrow_st.ok()) {
+        return Status::InternalError(arrow_st.ToString());
+    }
+    return Status::OK();
+}
 } // namespace starrocks
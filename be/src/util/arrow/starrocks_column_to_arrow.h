@@ -18,6 +18,7 @@
 #include <arrow/array/builder_primitive.h>
 #include <arrow/buffer.h>
 #include <arrow/builder.h>
+#include <arrow/c/abi.h>
 #include <arrow/io/memory.h>
 #include <arrow/ipc/writer.h>
 #include <arrow/memory_pool.h>
@@ -43,4 +44,12 @@ Status convert_chunk_to_arrow_batch(Chunk* chunk, std::vector<ExprContext*>& _ou
 Status convert_chunk_to_arrow_batch(Chunk* chunk, const std::vector<const TypeDescriptor*>& _slot_types,
                                     const std::vector<SlotId>& _slot_ids, const std::shared_ptr<arrow::Schema>& schema,
                                     arrow::MemoryPool* pool, std::shared_ptr<arrow::RecordBatch>* result);
+
+// Export the chunk through the Arrow C Data Interface, e.g. to hand it to a Java UDF or a JNI scanner without
+// serializing it. With enable_arrow_zero_copy_export the exported buffers of the fixed-width and string columns
+// are the ones of the chunk, and stay valid until the consumer calls the release callbacks.
+Status export_chunk_to_arrow_c_data(Chunk* chunk, const std::vector<const TypeDescriptor*>& slot_types,
+                                    const std::vector<SlotId>& slot_ids, const std::shared_ptr<arrow::Schema>& schema,
+                                    arrow::MemoryPool* pool, struct ArrowArray* out_array,
+                                    struct ArrowSchema* out_schema);
 } // namespace starrocks
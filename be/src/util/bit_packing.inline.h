@@ -36,6 +36,7 @@
 
 #include <boost/preprocessor/repetition/repeat_from_to.hpp>
 
+#include "simd/bit_unpack.h"
 #include "util/bit_packing.h"
 
 namespace starrocks {
@@ -169,6 +170,14 @@ template <typename OutType, int BIT_WIDTH>
 const uint8_t* BitPacking::Unpack32Values(const uint8_t* __restrict__ in, int64_t in_bytes, OutType* __restrict__ out) {
     constexpr int BYTES_TO_READ = BitUtil::RoundUpNumBytes(32 * BIT_WIDTH);
 
+    if constexpr (SIMDBitUnpack::supported<OutType, BIT_WIDTH>()) {
+        // The SIMD kernel reads further than the batch, the last batches of the buffer are unpacked below.
+        if (in_bytes >= SIMDBitUnpack::bytes_read<BIT_WIDTH>()) {
+            SIMDBitUnpack::unpack32<OutType, BIT_WIDTH>(in, out);
+            return in + BYTES_TO_READ;
+        }
+    }
+
     // Call UnpackValue for 0 <= i < 32.
 #pragma push_macro("UNPACK_VALUE_CALL")
 #define UNPACK_VALUE_CALL(ignore1, i, ignore2) out[i] = static_cast<OutType>(UnpackValue<BIT_WIDTH, i, true>(in));
@@ -118,6 +118,11 @@ public:
     template <typename T>
     bool GetValue(int num_bits, T* v);
 
+    // Gets the next 'num_values' values into 'v', which are unpacked in batches from the first byte boundary.
+    // Returns false, without reading any value, if there are not enough bytes left. num_bits must be <= 64.
+    template <typename T>
+    bool GetBatch(int num_bits, T* v, int num_values);
+
     // Reads a 'num_bytes'-sized value from the buffer and stores it in 'v'. T needs to be a
     // little-endian native type and big enough to store 'num_bytes'. The value is assumed
     // to be byte-aligned so the stream will be advanced to the start of the next byte
@@ -144,6 +144,29 @@ inline bool BitReader::GetValue(int num_bits, T* v) {
     return true;
 }
 
+template <typename T>
+inline bool BitReader::GetBatch(int num_bits, T* v, int num_values) {
+    DCHECK_LE(num_bits, 64);
+    DCHECK_LE(num_bits, sizeof(T) * 8);
+
+    if (PREDICT_FALSE(position() + static_cast<int64_t>(num_bits) * num_values > max_bytes_ * 8L)) return false;
+
+    // The position reaches a byte boundary in at most 8 values if the values start from one.
+    int i = 0;
+    for (; i < num_values && position() % 8 != 0; i++) {
+        GetValue(num_bits, v + i);
+    }
+    if (i < num_values) {
+        const int start = position();
+        const int64_t num_unpacked =
+                BitPacking::UnpackValues(num_bits, buffer_ + start / 8, max_bytes_ - start / 8, num_values - i, v + i)
+                        .second;
+        DCHECK_EQ(num_unpacked, num_values - i);
+        SeekToBit(start + num_unpacked * num_bits);
+    }
+    return true;
+}
+
 inline void BitReader::Rewind(int num_bits) {
     bit_offset_ -= num_bits;
     if (bit_offset_ >= 0) {
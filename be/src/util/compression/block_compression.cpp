@@ -45,6 +45,7 @@
 #include <zstd/zstd.h>
 #include <zstd/zstd_errors.h>
 
+#include "common/config.h"
 #include "gutil/endian.h"
 #include "gutil/strings/substitute.h"
 #include "util/coding.h"
@@ -744,6 +745,27 @@ public:
     size_t max_compressed_len(size_t len) const override { return ZSTD_compressBound(len); }
 
 private:
+    // Compresses a large block by config::zstd_compress_workers threads. The pooled context is reset with its
+    // parameters before its next use. If the zstd library is built without multi-threading, setting the workers
+    // fails and the block is compressed by the calling thread.
+    static void _set_workers(ZSTD_CCtx* ctx, const std::vector<Slice>& inputs) {
+        const int32_t workers = config::zstd_compress_workers;
+        if (workers <= 0) {
+            return;
+        }
+        size_t total_size = 0;
+        for (const auto& input : inputs) {
+            total_size += input.size;
+        }
+        if (total_size < config::zstd_multithread_min_block_bytes) {
+            return;
+        }
+        size_t ret = ZSTD_CCtx_setParameter(ctx, ZSTD_c_nbWorkers, workers);
+        if (ZSTD_isError(ret)) {
+            VLOG(2) << "ZSTD multi-threaded compression is unavailable: " << ZSTD_getErrorName(ret);
+        }
+    }
+
     Status _compress(const std::vector<Slice>& inputs, Slice* output, bool use_compression_buffer,
                      size_t uncompressed_size, faststring* compressed_body1, raw::RawString* compressed_body2) const {
         StatusOr<compression::ZSTD_CCtx_Pool::Ref> ref = compression::getZSTD_CCtx();
@@ -778,11 +800,15 @@ private:
             }
         }
 
+        _set_workers(ctx, inputs);
+
         ZSTD_outBuffer out_buf;
         out_buf.dst = output->data;
         out_buf.size = output->size;
         out_buf.pos = 0;
 
+        // With workers, a call may return before consuming the whole input, so keep calling until it is consumed,
+        // which fails only if the output is full.
         size_t ret;
         for (auto& input : inputs) {
             ZSTD_inBuffer in_buf;
@@ -790,26 +816,31 @@ private:
             in_buf.size = input.size;
             in_buf.pos = 0;
 
-            ret = ZSTD_compressStream(ctx, &out_buf, &in_buf);
+            do {
+                ret = ZSTD_compressStream2(ctx, &out_buf, &in_buf, ZSTD_e_continue);
+                if (ZSTD_isError(ret)) {
+                    context->compression_fail = true;
+                    return Status::InvalidArgument(strings::Substitute(
+                            "ZSTD compress failed: $0", ZSTD_getErrorString(ZSTD_getErrorCode(ret))));
+                } else if (in_buf.pos < in_buf.size && out_buf.pos == out_buf.size) {
+                    context->compression_fail = true;
+                    return Status::InvalidArgument(strings::Substitute("ZSTD compress failed, buffer is too small"));
+                }
+            } while (in_buf.pos < in_buf.size);
+        }
+
+        ZSTD_inBuffer end_buf{nullptr, 0, 0};
+        do {
+            ret = ZSTD_compressStream2(ctx, &out_buf, &end_buf, ZSTD_e_end);
             if (ZSTD_isError(ret)) {
                 context->compression_fail = true;
                 return Status::InvalidArgument(
                         strings::Substitute("ZSTD compress failed: $0", ZSTD_getErrorString(ZSTD_getErrorCode(ret))));
-            } else if (input.size != in_buf.pos) {
+            } else if (ret > 0 && out_buf.pos == out_buf.size) {
                 context->compression_fail = true;
                 return Status::InvalidArgument(strings::Substitute("ZSTD compress failed, buffer is too small"));
             }
-        }
-
-        ret = ZSTD_endStream(ctx, &out_buf);
-        if (ZSTD_isError(ret)) {
-            context->compression_fail = true;
-            return Status::InvalidArgument(
-                    strings::Substitute("ZSTD compress failed: $0", ZSTD_getErrorString(ZSTD_getErrorCode(ret))));
-        } else if (ret > 0) {
-            context->compression_fail = true;
-            return Status::InvalidArgument(strings::Substitute("ZSTD compress failed, buffer is too small"));
-        }
+        } while (ret > 0);
         output->size = out_buf.pos;
 
         if (use_compression_buffer) {
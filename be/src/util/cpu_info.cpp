@@ -354,6 +354,43 @@ int CpuInfo::get_current_core() {
 #endif
 }
 
+bool CpuInfo::bind_current_thread_to_numa_node(int node) {
+    DCHECK(initialized_);
+    if (node < 0 || node >= max_num_numa_nodes_) {
+        return false;
+    }
+    cpu_set_t allowed_cores;
+    CPU_ZERO(&allowed_cores);
+    if (sched_getaffinity(0, sizeof(allowed_cores), &allowed_cores) != 0) {
+        return false;
+    }
+    cpu_set_t node_cores;
+    CPU_ZERO(&node_cores);
+    int num_node_cores = 0;
+    for (int core : numa_node_to_cores_[node]) {
+        if (core < CPU_SETSIZE && CPU_ISSET(core, &allowed_cores)) {
+            CPU_SET(core, &node_cores);
+            ++num_node_cores;
+        }
+    }
+    if (num_node_cores == 0) {
+        return false;
+    }
+    return sched_setaffinity(0, sizeof(node_cores), &node_cores) == 0;
+}
+
+#ifdef BE_TEST
+void CpuInfo::init_fake_numa_for_test(int max_num_numa_nodes, const std::vector<int>& core_to_numa_node) {
+    DCHECK_EQ(max_num_cores_, core_to_numa_node.size());
+    max_num_numa_nodes_ = max_num_numa_nodes;
+    for (int core = 0; core < max_num_cores_; ++core) {
+        core_to_numa_node_[core] = core_to_numa_node[core];
+    }
+    numa_node_to_cores_.clear();
+    _init_numa_node_to_cores();
+}
+#endif
+
 void CpuInfo::_get_cache_info(long cache_sizes[NUM_CACHE_LEVELS], long cache_line_sizes[NUM_CACHE_LEVELS]) {
 #ifdef __APPLE__
     // On Mac OS X use sysctl() to get the cache sizes
@@ -80,6 +80,34 @@ public:
     /// remain stable.
     static int get_current_core();
 
+    /// Returns the NUMA node of the core, which is in range [0, max_num_numa_nodes_).
+    static int get_numa_node_of_core(int core) {
+        DCHECK(core >= 0 && core < max_num_cores_);
+        return core_to_numa_node_[core];
+    }
+
+    /// Returns the NUMA node of the core that the current thread is running on.
+    static int get_current_numa_node() { return get_numa_node_of_core(get_current_core()); }
+
+    /// Returns the maximum possible number of NUMA nodes.
+    static int get_max_num_numa_nodes() { return max_num_numa_nodes_; }
+
+    /// Returns the cores belonging to the NUMA node.
+    static const std::vector<int>& get_cores_of_numa_node(int node) {
+        DCHECK(node >= 0 && node < max_num_numa_nodes_);
+        return numa_node_to_cores_[node];
+    }
+
+    /// Binds the current thread to the cores of the NUMA node, which are also allowed by the
+    /// current affinity mask of the thread, e.g. the cpuset of cgroup.
+    /// Returns false and leaves the affinity unchanged if there is no such core.
+    static bool bind_current_thread_to_numa_node(int node);
+
+#ifdef BE_TEST
+    /// Replaces the NUMA info of this machine. 'core_to_numa_node' has an entry for each core.
+    static void init_fake_numa_for_test(int max_num_numa_nodes, const std::vector<int>& core_to_numa_node);
+#endif
+
     static std::string debug_string();
 
 private:
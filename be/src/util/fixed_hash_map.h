@@ -17,8 +17,10 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
+#include <new>
 #include <limits>
 #include <optional>
 #include <type_traits>
@@ -31,6 +33,9 @@ namespace starrocks {
 // FixedSizeHashMap
 // Key: KeyType integer type eg: uint8 uint16
 // value shouldn't be nullptr
+// A direct mapped table over the whole domain of the key, no hashing nor probing. The table is zeroed by calloc, which
+// gets the zero pages of a large table from the os instead of writing them, so creating the table of a 16 bits key
+// for each streaming batch is cheap, and only the pages of the keys present are touched.
 
 template <typename KeyType, typename ValueType, PhmapSeed seed>
 class SmallFixedSizeHashMap {
@@ -42,11 +47,18 @@ public:
     using key_type = KeyType;
     using search_key_type = typename std::make_unsigned<KeyType>::type;
 
-    SmallFixedSizeHashMap() {
-        memset(_hash_table, 0, sizeof(ValueType) * hash_table_size);
+    SmallFixedSizeHashMap() : _hash_table(static_cast<ValueType*>(calloc(hash_table_size + 1, sizeof(ValueType)))) {
+        if (_hash_table == nullptr) {
+            throw std::bad_alloc();
+        }
         _hash_table[hash_table_size] = reinterpret_cast<ValueType>(0xFFFF);
     }
 
+    ~SmallFixedSizeHashMap() { free(_hash_table); }
+
+    SmallFixedSizeHashMap(const SmallFixedSizeHashMap&) = delete;
+    SmallFixedSizeHashMap& operator=(const SmallFixedSizeHashMap&) = delete;
+
     struct PPair {
         using Cell = std::pair<KeyType, ValueType>;
         PPair(KeyType key, ValueType value) : _data(key, value) {}
@@ -118,7 +130,7 @@ public:
     }
 
     struct HashFunction {
-        size_t operator()(KeyType key) { return static_cast<size_t>(key); }
+        size_t operator()(KeyType key) { return static_cast<search_key_type>(key); }
     };
 
     HashFunction hash_function() { return HashFunction(); }
@@ -133,7 +145,7 @@ public:
 
 private:
     size_t _size = 0;
-    ValueType _hash_table[hash_table_size + 1];
+    ValueType* _hash_table;
 };
 
 template <typename KeyType, PhmapSeed seed>
@@ -171,11 +183,18 @@ public:
         int32_t _cursor;
     };
 
-    SmallFixedSizeHashSet() {
-        memset(_hash_table, 0, sizeof(uint8_t) * hash_table_size);
+    SmallFixedSizeHashSet() : _hash_table(static_cast<uint8_t*>(calloc(hash_table_size + 1, sizeof(uint8_t)))) {
+        if (_hash_table == nullptr) {
+            throw std::bad_alloc();
+        }
         _hash_table[hash_table_size] = 0xFF;
     }
 
+    ~SmallFixedSizeHashSet() { free(_hash_table); }
+
+    SmallFixedSizeHashSet(const SmallFixedSizeHashSet&) = delete;
+    SmallFixedSizeHashSet& operator=(const SmallFixedSizeHashSet&) = delete;
+
     iterator begin() {
         auto iter = iterator(_hash_table, 0);
         iter.skip_empty_value();
@@ -199,7 +218,7 @@ public:
 
 private:
     size_t _size = 0;
-    uint8_t _hash_table[hash_table_size + 1];
+    uint8_t* _hash_table;
 };
 
 } // namespace starrocks
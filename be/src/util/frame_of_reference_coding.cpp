@@ -36,6 +36,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <type_traits>
 
 #include "util/bit_util.h"
 #include "util/coding.h"
@@ -483,6 +484,86 @@ bool ForDecoder<T>::seek_at_or_after_value(const void* value, bool* exact_match)
     return found;
 }
 
+namespace {
+// The unsigned type to compare the non-negative deltas of a frame.
+template <typename T>
+struct ForDeltaType {
+    using type = std::make_unsigned_t<T>;
+};
+template <>
+struct ForDeltaType<int128_t> {
+    using type = uint128_t;
+};
+template <>
+struct ForDeltaType<uint128_t> {
+    using type = uint128_t;
+};
+template <>
+struct ForDeltaType<uint24_t> {
+    using type = uint32_t;
+};
+} // namespace
+
+template <typename T>
+bool ForDecoder<T>::evaluate_range(T lo, T hi, size_t count, uint8_t* selection) {
+    using U = typename ForDeltaType<T>::type;
+    if (_current_index + count > _values_num) {
+        return false;
+    }
+    while (count > 0) {
+        const uint32_t frame_index = _current_index / _max_frame_size;
+        const uint32_t pos_in_frame = _current_index % _max_frame_size;
+        const uint8_t current_frame_size = frame_size(frame_index);
+        const size_t n = std::min<size_t>(count, current_frame_size - pos_in_frame);
+        const uint8_t bit_width = _bit_widths[frame_index];
+        const uint8_t storage_format = _storage_formats[frame_index];
+
+        if (storage_format == 0 && bit_width < sizeof(U) * 8) {
+            const T min = decode_frame_min_value(frame_index);
+            const U max_delta = static_cast<U>((U(1) << bit_width) - 1);
+            // min + delta is in [lo, hi] iff delta is in [delta_lo, delta_hi].
+            const U delta_lo = lo > min ? static_cast<U>(static_cast<U>(lo) - static_cast<U>(min)) : U(0);
+            const U delta_hi = static_cast<U>(static_cast<U>(hi) - static_cast<U>(min));
+            if (hi < min || delta_lo > max_delta) {
+                memset(selection, 0, n);
+            } else if (delta_lo == 0 && delta_hi >= max_delta) {
+                memset(selection, 1, n);
+            } else {
+                if (frame_index != _current_delta_frame) {
+                    _current_delta_frame = frame_index;
+                    _delta_buffer.resize(_max_frame_size);
+                    const uint32_t min_size = sizeof(T) > 8 ? 16 : (sizeof(T) > 4 ? 8 : 4);
+                    const uint32_t delta_offset = _frame_offsets[frame_index] + min_size;
+                    bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, _delta_buffer.data());
+                }
+                const T* deltas = _delta_buffer.data() + pos_in_frame;
+                for (size_t i = 0; i < n; i++) {
+                    const auto delta = static_cast<U>(deltas[i]);
+                    selection[i] = (delta >= delta_lo) & (delta <= delta_hi);
+                }
+            }
+        } else {
+            decode_current_frame(_out_buffer.data());
+            const T* values = _out_buffer.data() + pos_in_frame;
+            if (storage_format == 1) {
+                // The values of an ascending frame in [lo, hi] are continuous.
+                const T* begin = std::lower_bound(values, values + n, lo);
+                const T* end = std::upper_bound(begin, values + n, hi);
+                memset(selection, 0, n);
+                memset(selection + (begin - values), 1, end - begin);
+            } else {
+                for (size_t i = 0; i < n; i++) {
+                    selection[i] = (values[i] >= lo) & (values[i] <= hi);
+                }
+            }
+        }
+        _current_index += n;
+        selection += n;
+        count -= n;
+    }
+    return true;
+}
+
 template class ForEncoder<int8_t>;
 template class ForEncoder<int16_t>;
 template class ForEncoder<int32_t>;
@@ -159,6 +159,12 @@ public:
 
     bool seek_at_or_after_value(const void* value, bool* exact_match);
 
+    // Sets selection[i] to whether the i-th of the next `count` values is in [lo, hi], and moves forwards.
+    // A non-ascending frame is skipped or selected as a whole if its value range [min, min + 2^bit_width - 1] is
+    // outside or inside of [lo, hi], otherwise its deltas are compared with [lo - min, hi - min] without adding
+    // the min value back. Returns false if there are not enough values.
+    bool evaluate_range(T lo, T hi, size_t count, uint8_t* selection);
+
     uint32_t current_index() const { return _current_index; }
 
     uint32_t count() const { return _values_num; }
@@ -200,6 +206,8 @@ private:
 
     uint32_t _current_index = 0;
     uint32_t _current_decoded_frame = -1;
-    std::vector<T> _out_buffer; // store values of decoded frame
+    std::vector<T> _out_buffer;   // store values of decoded frame
+    uint32_t _current_delta_frame = -1;
+    std::vector<T> _delta_buffer; // store deltas of the frame being evaluated by evaluate_range
 };
 } // namespace starrocks
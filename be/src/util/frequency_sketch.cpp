@@ -0,0 +1,105 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/frequency_sketch.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "util/bit_util.h"
+
+namespace starrocks {
+
+static constexpr uint64_t kSeeds[] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL,
+                                      0xcbf29ce484222325ULL};
+static constexpr uint64_t kResetMask = 0x7777777777777777ULL;
+// Limit the sketch to 512KB of each instance.
+static constexpr size_t kMaxTableSize = 1 << 16;
+
+void FrequencySketch::ensure_capacity(size_t num_entries) {
+    const auto num_words = static_cast<int64_t>(std::clamp<size_t>(num_entries, 1, kMaxTableSize));
+    const auto table_size = static_cast<size_t>(BitUtil::RoundUpToPowerOfTwo(num_words));
+    if (_table.size() >= table_size) {
+        return;
+    }
+    // The counter of a key at `hash & mask` in the new table is copied from `hash & _table_mask` in the old table,
+    // so the frequencies are kept.
+    std::vector<uint64_t> table(table_size, 0);
+    if (!_table.empty()) {
+        for (size_t i = 0; i < table_size; i++) {
+            table[i] = _table[i & _table_mask];
+        }
+    }
+    _table = std::move(table);
+    _table_mask = table_size - 1;
+    _sample_size = 10 * table_size;
+}
+
+size_t FrequencySketch::_index_of(uint32_t hash, int i) const {
+    uint64_t h = (hash + kSeeds[i]) * kSeeds[i];
+    h += h >> 32;
+    return h & _table_mask;
+}
+
+int FrequencySketch::_counter_at(size_t index, int offset) const {
+    return static_cast<int>((_table[index] >> (offset << 2)) & 0xf);
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    if (_table.empty()) {
+        return;
+    }
+    // The 4 counters of a key are at the offsets [start, start + 4) of the 16 counters in their words.
+    const int start = (hash & 3) << 2;
+    size_t indexes[4];
+    int min_count = kMaxFrequency;
+    for (int i = 0; i < 4; i++) {
+        indexes[i] = _index_of(hash, i);
+        min_count = std::min(min_count, _counter_at(indexes[i], start + i));
+    }
+    if (min_count == kMaxFrequency) {
+        return;
+    }
+    // Conservative update: only the smallest counters are incremented, so the counters shared with the other keys
+    // are not inflated beyond the estimate of this key.
+    for (int i = 0; i < 4; i++) {
+        if (_counter_at(indexes[i], start + i) == min_count) {
+            _table[indexes[i]] += 1ULL << ((start + i) << 2);
+        }
+    }
+    if (++_size >= _sample_size) {
+        _reset();
+    }
+}
+
+int FrequencySketch::frequency(uint32_t hash) const {
+    if (_table.empty()) {
+        return 0;
+    }
+    const int start = (hash & 3) << 2;
+    int frequency = kMaxFrequency;
+    for (int i = 0; i < 4; i++) {
+        frequency = std::min(frequency, _counter_at(_index_of(hash, i), start + i));
+    }
+    return frequency;
+}
+
+void FrequencySketch::_reset() {
+    for (auto& word : _table) {
+        word = (word >> 1) & kResetMask;
+    }
+    _size /= 2;
+}
+
+} // namespace starrocks
@@ -0,0 +1,55 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace starrocks {
+
+// FrequencySketch estimates the access frequency of the keys in the recent history by a count-min sketch of 4-bit
+// counters, which is the admission filter of TinyLFU. Each 64-bit word holds 16 counters, and a key is counted by
+// 4 counters in 4 different words, of which only the smallest ones are incremented. The counters are halved once the
+// number of increments reaches 10 times of the capacity, so the frequencies decay and follow the change of the
+// workload.
+//
+// It is not thread-safe.
+class FrequencySketch {
+public:
+    static constexpr int kMaxFrequency = 15;
+
+    // Grow the sketch to count about `num_entries` keys, and the frequencies counted before are kept.
+    void ensure_capacity(size_t num_entries);
+
+    void increment(uint32_t hash);
+
+    // Returns the estimated frequency of `hash` in [0, kMaxFrequency].
+    int frequency(uint32_t hash) const;
+
+    size_t capacity() const { return _table.size(); }
+
+private:
+    size_t _index_of(uint32_t hash, int i) const;
+    int _counter_at(size_t index, int offset) const;
+    void _reset();
+
+    std::vector<uint64_t> _table;
+    uint64_t _table_mask = 0;
+    size_t _sample_size = 0;
+    size_t _size = 0;
+};
+
+} // namespace starrocks
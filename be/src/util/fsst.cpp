@@ -0,0 +1,159 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/fsst.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+namespace starrocks {
+
+static inline uint64_t load_symbol(const uint8_t* data, size_t len) {
+    uint64_t symbol = 0;
+    memcpy(&symbol, data, len);
+    return symbol;
+}
+
+void FsstSymbolTable::build(const std::vector<Slice>& sample, int rounds) {
+    _num_symbols = 0;
+    _build_index();
+    for (int round = 0; round < rounds; round++) {
+        // The gain of a candidate symbol is the bytes it covers in the compressed sample.
+        std::unordered_map<std::string, uint64_t> gains;
+        for (const Slice& str : sample) {
+            const auto* data = reinterpret_cast<const uint8_t*>(str.data);
+            size_t prev_pos = 0;
+            size_t prev_len = 0;
+            for (size_t pos = 0; pos < str.size;) {
+                const uint8_t code = _find_longest_symbol(data, pos, str.size);
+                const size_t len = code == kEscapeCode ? 1 : _lengths[code];
+                gains[std::string(str.data + pos, len)] += len;
+                if (prev_len > 0 && prev_len + len <= kMaxSymbolLength) {
+                    gains[std::string(str.data + prev_pos, prev_len + len)] += prev_len + len;
+                }
+                prev_pos = pos;
+                prev_len = len;
+                pos += len;
+            }
+        }
+
+        std::vector<std::pair<uint64_t, const std::string*>> candidates;
+        candidates.reserve(gains.size());
+        for (const auto& [symbol, gain] : gains) {
+            candidates.emplace_back(gain, &symbol);
+        }
+        const size_t n = std::min(candidates.size(), kMaxSymbols);
+        // ordered by the gain and then by the symbol, so the table is deterministic
+        auto cmp = [](const auto& lhs, const auto& rhs) {
+            return lhs.first != rhs.first ? lhs.first > rhs.first : *lhs.second < *rhs.second;
+        };
+        std::partial_sort(candidates.begin(), candidates.begin() + n, candidates.end(), cmp);
+        _num_symbols = n;
+        for (size_t i = 0; i < n; i++) {
+            const std::string& symbol = *candidates[i].second;
+            _symbols[i] = load_symbol(reinterpret_cast<const uint8_t*>(symbol.data()), symbol.size());
+            _lengths[i] = symbol.size();
+        }
+        _build_index();
+    }
+}
+
+void FsstSymbolTable::serialize(faststring* buf) const {
+    buf->push_back(static_cast<char>(_num_symbols));
+    buf->append(_lengths, _num_symbols);
+    for (size_t i = 0; i < _num_symbols; i++) {
+        buf->append(&_symbols[i], _lengths[i]);
+    }
+}
+
+bool FsstSymbolTable::deserialize(const Slice& data, size_t* consumed) {
+    const auto* p = reinterpret_cast<const uint8_t*>(data.data);
+    if (data.size < 1) {
+        return false;
+    }
+    const size_t num_symbols = p[0];
+    if (num_symbols > kMaxSymbols || data.size < 1 + num_symbols) {
+        return false;
+    }
+    size_t offset = 1 + num_symbols;
+    for (size_t i = 0; i < num_symbols; i++) {
+        const uint8_t len = p[1 + i];
+        if (len == 0 || len > kMaxSymbolLength || offset + len > data.size) {
+            return false;
+        }
+        _lengths[i] = len;
+        _symbols[i] = load_symbol(p + offset, len);
+        offset += len;
+    }
+    _num_symbols = num_symbols;
+    _build_index();
+    *consumed = offset;
+    return true;
+}
+
+void FsstSymbolTable::compress(const Slice& str, faststring* dst) const {
+    const auto* data = reinterpret_cast<const uint8_t*>(str.data);
+    for (size_t pos = 0; pos < str.size;) {
+        const uint8_t code = _find_longest_symbol(data, pos, str.size);
+        if (code == kEscapeCode) {
+            dst->push_back(static_cast<char>(kEscapeCode));
+            dst->push_back(static_cast<char>(data[pos]));
+            pos++;
+        } else {
+            dst->push_back(static_cast<char>(code));
+            pos += _lengths[code];
+        }
+    }
+}
+
+void FsstSymbolTable::_build_index() {
+    uint16_t counts[256] = {};
+    for (size_t i = 0; i < _num_symbols; i++) {
+        counts[_symbols[i] & 0xFF]++;
+    }
+    _index_begin[0] = 0;
+    for (size_t b = 0; b < 256; b++) {
+        _index_begin[b + 1] = _index_begin[b] + counts[b];
+    }
+    uint16_t next[256];
+    memcpy(next, _index_begin, sizeof(next));
+    for (size_t i = 0; i < _num_symbols; i++) {
+        _index_codes[next[_symbols[i] & 0xFF]++] = i;
+    }
+    for (size_t b = 0; b < 256; b++) {
+        std::stable_sort(_index_codes + _index_begin[b], _index_codes + _index_begin[b + 1],
+                         [this](uint8_t lhs, uint8_t rhs) { return _lengths[lhs] > _lengths[rhs]; });
+    }
+}
+
+uint8_t FsstSymbolTable::_find_longest_symbol(const uint8_t* str, size_t pos, size_t size) const {
+    const size_t remaining = std::min(size - pos, kMaxSymbolLength);
+    const uint64_t word = load_symbol(str + pos, remaining);
+    const uint8_t first = str[pos];
+    for (uint16_t i = _index_begin[first]; i < _index_begin[first + 1]; i++) {
+        const uint8_t code = _index_codes[i];
+        const size_t len = _lengths[code];
+        if (len > remaining) {
+            continue;
+        }
+        const uint64_t mask = len == kMaxSymbolLength ? ~0ULL : (1ULL << (len * 8)) - 1;
+        if ((word & mask) == _symbols[code]) {
+            return code;
+        }
+    }
+    return kEscapeCode;
+}
+
+} // namespace starrocks
@@ -0,0 +1,98 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// FsstSymbolTable implements FSST (Fast Static Symbol Table) string compression, see
+// "FSST: Fast Random Access String Compression" by Boncz, Neumann and Leis, VLDB 2020.
+//
+// The table maps the one-byte codes 0-254 to the symbols of 1 to 8 bytes which are frequent in a sample of
+// strings. A string is compressed by replacing its longest matching symbols by their codes, the bytes matching no
+// symbol are escaped by the code 255 followed by the byte. Every string is compressed on its own, so any string
+// is decompressed without the others, and since the compression is deterministic, two strings are equal iff
+// their compressed forms are equal.
+class FsstSymbolTable {
+public:
+    static constexpr uint8_t kEscapeCode = 255;
+    static constexpr size_t kMaxSymbols = 255;
+    static constexpr size_t kMaxSymbolLength = 8;
+    // The bytes of the strings sampled to build a table.
+    static constexpr size_t kSampleBytes = 16 * 1024;
+
+    FsstSymbolTable() = default;
+
+    // Builds the symbols from the sample of strings in `rounds` rounds, each round compresses the sample with the
+    // current symbols and picks the symbols and the concatenations of two adjacent symbols covering the most bytes.
+    void build(const std::vector<Slice>& sample, int rounds = 5);
+
+    size_t num_symbols() const { return _num_symbols; }
+
+    // Appends the table to `buf`.
+    void serialize(faststring* buf) const;
+
+    // Parses the table serialized at the start of `data`, sets `consumed` to the bytes of the table.
+    // Returns false if the table is broken.
+    bool deserialize(const Slice& data, size_t* consumed);
+
+    // Appends the compressed `str` to `dst`.
+    void compress(const Slice& str, faststring* dst) const;
+
+    // The bytes to be writable at the destination to decompress `size` bytes.
+    static size_t max_decompressed_size(size_t size) { return size * kMaxSymbolLength; }
+
+    // Decompresses `size` bytes at `src` to `dst`, which has max_decompressed_size(size) writable bytes, and
+    // returns the size of the decompressed string. Each symbol is copied as 8 bytes, the bytes past its length
+    // are overwritten by the following symbols.
+    size_t decompress(const uint8_t* src, size_t size, uint8_t* dst) const {
+        uint8_t* out = dst;
+        for (size_t i = 0; i < size; i++) {
+            const uint8_t code = src[i];
+            if (code == kEscapeCode) {
+                // a valid compressed string never ends with the escape code
+                *out++ = i + 1 < size ? src[++i] : 0;
+            } else {
+                memcpy(out, &_symbols[code], sizeof(uint64_t));
+                out += _lengths[code];
+            }
+        }
+        return out - dst;
+    }
+
+private:
+    // Rebuilds the index of the symbols by their first bytes for compress().
+    void _build_index();
+
+    // Returns the code of the longest symbol matching `str` at `pos`, or kEscapeCode.
+    uint8_t _find_longest_symbol(const uint8_t* str, size_t pos, size_t size) const;
+
+    size_t _num_symbols = 0;
+    // The bytes of each symbol in the order of the memory, padded with zero.
+    uint64_t _symbols[kMaxSymbols] = {};
+    uint8_t _lengths[kMaxSymbols] = {};
+    // The codes of the symbols starting with the byte b are _index_codes[_index_begin[b], _index_begin[b + 1]),
+    // ordered by the lengths of the symbols, descending.
+    uint16_t _index_begin[257] = {};
+    uint8_t _index_codes[kMaxSymbols] = {};
+};
+
+} // namespace starrocks
@@ -46,6 +46,9 @@
 #endif
 #include <zlib.h>
 
+#include <array>
+#include <cstring>
+
 #include "gen_cpp/Types_types.h"
 #include "storage/decimal12.h"
 #include "storage/uint24.h"
@@ -55,12 +58,55 @@
 
 namespace starrocks {
 
+namespace hash_util_detail {
+// The slicing-by-4 tables of the zlib crc32 (the reflected polynomial 0xEDB88320).
+constexpr std::array<std::array<uint32_t, 256>, 4> make_zlib_crc_tables() {
+    std::array<std::array<uint32_t, 256>, 4> tables{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int k = 0; k < 8; k++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320U : crc >> 1;
+        }
+        tables[0][i] = crc;
+    }
+    for (size_t t = 1; t < tables.size(); t++) {
+        for (uint32_t i = 0; i < 256; i++) {
+            tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xff];
+        }
+    }
+    return tables;
+}
+
+inline constexpr auto ZLIB_CRC_TABLES = make_zlib_crc_tables();
+} // namespace hash_util_detail
+
 // Utility class to compute hash values.
 class HashUtil {
 public:
     static uint32_t zlib_crc_hash(const void* data, int32_t bytes, uint32_t hash) {
         return crc32(hash, (const unsigned char*)data, bytes);
     }
+
+    // The same as zlib_crc_hash() of `BYTES` bytes, computed inline by the slicing-by-4 tables instead of calling
+    // into zlib, which is several times faster for the short values of the fixed length columns hashed one by one.
+    template <size_t BYTES>
+    ALWAYS_INLINE static uint32_t zlib_crc_hash_fixed(const void* data, uint32_t hash) {
+        const auto& tables = hash_util_detail::ZLIB_CRC_TABLES;
+        const auto* p = reinterpret_cast<const uint8_t*>(data);
+        uint32_t crc = ~hash;
+        size_t i = 0;
+        for (; i + sizeof(uint32_t) <= BYTES; i += sizeof(uint32_t)) {
+            uint32_t word;
+            memcpy(&word, p + i, sizeof(uint32_t));
+            crc ^= word;
+            crc = tables[3][crc & 0xff] ^ tables[2][(crc >> 8) & 0xff] ^ tables[1][(crc >> 16) & 0xff] ^
+                  tables[0][crc >> 24];
+        }
+        for (; i < BYTES; i++) {
+            crc = tables[0][(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
 #ifdef __SSE4_2__
     // Compute the Crc32 hash for data using SSE4 instructions.  The input hash parameter is
     // the current hash/seed value.
@@ -0,0 +1,113 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/iobuf_util.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace starrocks {
+
+namespace {
+
+// The deleter of an IOBuf user data block only gets the data pointer, so the strings are kept here and looked
+// up by their data pointers. The map is sharded to reduce the contention between the exchange senders.
+class HeldStrings {
+public:
+    static HeldStrings* instance() {
+        // Leaked on purpose, since IOBuf blocks may be released after the static variables are destroyed.
+        static auto* held_strings = new HeldStrings();
+        return held_strings;
+    }
+
+    void* hold(std::unique_ptr<std::string> str) {
+        void* data = str->data();
+        Shard& shard = _shard(data);
+        std::lock_guard<std::mutex> l(shard.mutex);
+        shard.strings.emplace(data, std::move(str));
+        return data;
+    }
+
+    void release(void* data) {
+        std::unique_ptr<std::string> str;
+        {
+            Shard& shard = _shard(data);
+            std::lock_guard<std::mutex> l(shard.mutex);
+            auto it = shard.strings.find(data);
+            if (it == shard.strings.end()) {
+                return;
+            }
+            str = std::move(it->second);
+            shard.strings.erase(it);
+        }
+        // Free the string out of the lock.
+        str.reset();
+    }
+
+    size_t size() {
+        size_t num_strings = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> l(shard.mutex);
+            num_strings += shard.strings.size();
+        }
+        return num_strings;
+    }
+
+private:
+    static constexpr size_t kNumShards = 32;
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<const void*, std::unique_ptr<std::string>> strings;
+    };
+
+    Shard& _shard(const void* data) {
+        // The low bits of heap addresses are mostly zero because of alignment.
+        return _shards[(reinterpret_cast<uintptr_t>(data) >> 4) % kNumShards];
+    }
+
+    Shard _shards[kNumShards];
+};
+
+void release_held_string(void* data) {
+    HeldStrings::instance()->release(data);
+}
+
+} // namespace
+
+size_t iobuf_append_string_without_copy(butil::IOBuf* buf, std::string&& str) {
+    if (str.empty()) {
+        return 0;
+    }
+    const size_t size = str.size();
+    const size_t capacity = str.capacity();
+    auto* held_strings = HeldStrings::instance();
+    void* data = held_strings->hold(std::make_unique<std::string>(std::move(str)));
+    if (buf->append_user_data(data, size, release_held_string) == 0) {
+        return capacity;
+    }
+
+    // The block is not created, e.g. the size exceeds the limit of a user data block.
+    size_t before_size = buf->size();
+    buf->append(data, size);
+    held_strings->release(data);
+    return buf->size() - before_size;
+}
+
+size_t iobuf_num_held_strings() {
+    return HeldStrings::instance()->size();
+}
+
+} // namespace starrocks
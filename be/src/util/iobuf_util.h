@@ -0,0 +1,33 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <butil/iobuf.h>
+
+#include <string>
+
+namespace starrocks {
+
+// Appends the bytes of `str` to `buf` without copying them. The string is moved into a holder owned by the
+// appended block, and is destroyed when the last IOBuf referencing the block is released, which may happen in
+// another thread, e.g. the brpc thread writing the socket.
+// Falls back to copying when the string can't be referenced as a user data block.
+// Returns the number of bytes allocated on behalf of `buf`.
+size_t iobuf_append_string_without_copy(butil::IOBuf* buf, std::string&& str);
+
+// Returns the number of strings held by IOBuf blocks, only used for tests.
+size_t iobuf_num_held_strings();
+
+} // namespace starrocks
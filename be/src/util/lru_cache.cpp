@@ -154,6 +154,10 @@ LRUCache::LRUCache() {
     // Make empty circular linked list
     _lru.next = &_lru;
     _lru.prev = &_lru;
+    _probation.next = &_probation;
+    _probation.prev = &_probation;
+    _protected.next = &_protected;
+    _protected.prev = &_protected;
 }
 
 LRUCache::~LRUCache() noexcept {
@@ -161,9 +165,47 @@ LRUCache::~LRUCache() noexcept {
 }
 
 bool LRUCache::_unref(LRUHandle* e) {
-    DCHECK(e->refs > 0);
-    e->refs--;
-    return e->refs == 0;
+    DCHECK(_num_refs(e) > 0);
+    return e->refs.fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+void LRUCache::_unref_locked(LRUHandle* e, std::vector<LRUHandle*>* deleted) {
+    const uint32_t refs = e->refs.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    if (refs == (kDetached | 1)) {
+        // Only the cache holds it, and no lookup runs under the lock to take it again.
+        e->refs.fetch_and(~kDetached, std::memory_order_relaxed);
+        _lru_append(_list_of(e), e);
+    } else if (refs == 0) {
+        _usage -= e->charge;
+        deleted->push_back(e);
+    }
+}
+
+uint32_t LRUCache::_num_refs(const LRUHandle* e) {
+    return e->refs.load(std::memory_order_acquire) & ~kDetached;
+}
+
+bool LRUCache::_is_detached(const LRUHandle* e) {
+    return (e->refs.load(std::memory_order_relaxed) & kDetached) != 0;
+}
+
+bool LRUCache::_detach_if_in_use(LRUHandle* e) {
+    if (_num_refs(e) == 1) {
+        return false;
+    }
+    // The handles may be released concurrently, but no new one is taken under the lock.
+    if (e->refs.fetch_or(kDetached, std::memory_order_acq_rel) == 1) {
+        e->refs.fetch_and(~kDetached, std::memory_order_relaxed);
+        return false;
+    }
+    _lru_remove(e);
+    return true;
+}
+
+void LRUCache::_remove_from_list(LRUHandle* e) {
+    if ((e->refs.fetch_and(~kDetached, std::memory_order_acq_rel) & kDetached) == 0) {
+        _lru_remove(e);
+    }
 }
 
 void LRUCache::_lru_remove(LRUHandle* e) {
@@ -185,7 +227,8 @@ void LRUCache::set_capacity(size_t capacity) {
     {
         std::lock_guard l(_mutex);
         _capacity = capacity;
-        _evict_from_lru(0, &last_ref_list);
+        _drain_read_buffers(&last_ref_list);
+        _evict(0, &last_ref_list);
     }
 
     for (auto entry : last_ref_list) {
@@ -197,39 +240,131 @@ void LRUCache::set_charge_mode(ChargeMode charge_mode) {
     _charge_mode = charge_mode;
 }
 
+void LRUCache::set_policy(CachePolicy policy) {
+    _policy = policy;
+}
+
 uint64_t LRUCache::get_lookup_count() const {
-    std::lock_guard l(_mutex);
-    return _lookup_count;
+    return _lookup_count.load(std::memory_order_relaxed);
 }
 
 uint64_t LRUCache::get_hit_count() const {
+    return _hit_count.load(std::memory_order_relaxed);
+}
+
+uint64_t LRUCache::get_rejected_count() const {
     std::lock_guard l(_mutex);
-    return _hit_count;
+    return _rejected_count;
 }
 
 size_t LRUCache::get_usage() const {
-    std::lock_guard l(_mutex);
-    return _usage;
+    return _usage.load(std::memory_order_relaxed);
 }
 
 size_t LRUCache::get_capacity() const {
-    std::lock_guard l(_mutex);
-    return _capacity;
+    return _capacity.load(std::memory_order_relaxed);
+}
+
+// Spread the threads to the read buffers of a shard.
+static uint32_t read_buffer_index() {
+    static std::atomic<uint32_t> s_next_index{0};
+    thread_local uint32_t index = s_next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+bool LRUCache::_record_read(LRUHandle* e) {
+    auto& buffer = _read_buffers[read_buffer_index() % kNumReadBuffers];
+    const uint32_t pos = buffer.write_pos.fetch_add(1, std::memory_order_relaxed);
+    if (pos >= ReadBuffer::kSize) {
+        return true;
+    }
+    // The caller holds a reference, so it does not drop to 0 here.
+    e->refs.fetch_add(1, std::memory_order_relaxed);
+    LRUHandle* expected = nullptr;
+    if (!buffer.slots[pos].compare_exchange_strong(expected, e, std::memory_order_release,
+                                                   std::memory_order_relaxed)) {
+        // The slot is taken by the lookup before the last drain with the same position.
+        e->refs.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return pos + 1 == ReadBuffer::kSize;
+}
+
+void LRUCache::_drain_read_buffers(std::vector<LRUHandle*>* deleted) {
+    for (auto& buffer : _read_buffers) {
+        if (buffer.write_pos.load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        for (auto& slot : buffer.slots) {
+            LRUHandle* e = slot.exchange(nullptr, std::memory_order_acquire);
+            if (e == nullptr) {
+                continue;
+            }
+            if (e->in_cache) {
+                _on_hit(e);
+            }
+            _unref_locked(e, deleted);
+        }
+        buffer.write_pos.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LRUCache::_on_hit(LRUHandle* e) {
+    // A detached entry is put back to the list of its segment when released.
+    const bool detached = _is_detached(e);
+    if (!detached) {
+        _lru_remove(e);
+    }
+    bool promoted = false;
+    if (_policy == CachePolicy::TINY_LFU && e->segment == LRUSegment::PROBATION) {
+        e->segment = LRUSegment::PROTECTED;
+        _protected_usage += e->charge;
+        promoted = true;
+    }
+    if (!detached) {
+        _lru_append(_list_of(e), e);
+    }
+    if (promoted) {
+        _demote_protected();
+    }
 }
 
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
-    std::lock_guard l(_mutex);
-    ++_lookup_count;
-    LRUHandle* e = _table.lookup(key, hash);
-    if (e != nullptr) {
-        // we get it from _table, so in_cache must be true
-        DCHECK(e->in_cache);
-        if (e->refs == 1) {
-            // only in LRU free list, remove it from list
-            _lru_remove(e);
+    _lookup_count.fetch_add(1, std::memory_order_relaxed);
+    LRUHandle* e = nullptr;
+    bool need_drain = false;
+    {
+        std::shared_lock l(_mutex);
+        if (_policy == CachePolicy::TINY_LFU) {
+            // TinyLFU counts the accesses of both hits and misses.
+            std::lock_guard sketch_lock(_sketch_mutex);
+            _sketch.increment(hash);
+        }
+        e = _table.lookup(key, hash);
+        if (e != nullptr) {
+            // we get it from _table, so in_cache must be true
+            DCHECK(e->in_cache);
+            e->refs.fetch_add(1, std::memory_order_relaxed);
+            need_drain = _record_read(e);
+        }
+    }
+
+    if (e == nullptr) {
+        return nullptr;
+    }
+    _hit_count.fetch_add(1, std::memory_order_relaxed);
+    if (need_drain) {
+        std::vector<LRUHandle*> last_ref_list;
+        {
+            // Someone else is draining or updating the lists if the lock is held.
+            std::unique_lock l(_mutex, std::try_to_lock);
+            if (l.owns_lock()) {
+                _drain_read_buffers(&last_ref_list);
+            }
+        }
+        for (auto entry : last_ref_list) {
+            entry->free();
         }
-        e->refs++;
-        ++_hit_count;
     }
     return reinterpret_cast<Cache::Handle*>(e);
 }
@@ -239,31 +374,34 @@ void LRUCache::release(Cache::Handle* handle) {
         return;
     }
     auto* e = reinterpret_cast<LRUHandle*>(handle);
-    bool last_ref = false;
-    {
-        std::lock_guard l(_mutex);
-        last_ref = _unref(e);
-        if (last_ref) {
-            _usage -= e->charge;
-        } else if (e->in_cache && e->refs == 1) {
-            // only exists in cache
-            if (_usage > _capacity) {
-                // take this opportunity and remove the item
-                _table.remove(e->key(), e->hash);
-                e->in_cache = false;
-                _unref(e);
+    uint32_t refs = e->refs.load(std::memory_order_relaxed);
+    // The last handle of a detached entry puts it back under the lock, and the entries over the capacity are left
+    // to the next insert.
+    while (refs != (kDetached | 2)) {
+        if (e->refs.compare_exchange_weak(refs, refs - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            if (refs == 1) {
+                // the entry has been removed from the cache
                 _usage -= e->charge;
-                last_ref = true;
-            } else {
-                // put it to LRU free list
-                _lru_append(&_lru, e);
+                e->free();
             }
+            return;
         }
     }
+    std::vector<LRUHandle*> last_ref_list;
+    {
+        std::lock_guard l(_mutex);
+        _unref_locked(e, &last_ref_list);
+    }
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+}
 
-    // free handle out of mutex
-    if (last_ref) {
-        e->free();
+void LRUCache::_evict(size_t charge, std::vector<LRUHandle*>* deleted) {
+    if (_policy == CachePolicy::TINY_LFU) {
+        _evict_from_tiny_lfu(charge, deleted);
+    } else {
+        _evict_from_lru(charge, deleted);
     }
 }
 
@@ -272,6 +410,9 @@ void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted)
     // 1. evict normal cache entries
     while (_usage + charge > _capacity && cur->next != &_lru) {
         LRUHandle* old = cur->next;
+        if (_detach_if_in_use(old)) {
+            continue;
+        }
         if (old->priority == CachePriority::DURABLE) {
             cur = cur->next;
             continue;
@@ -280,8 +421,12 @@ void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted)
         deleted->push_back(old);
     }
     // 2. evict durable cache entries if need
-    while (_usage + charge > _capacity && _lru.next != &_lru) {
-        LRUHandle* old = _lru.next;
+    cur = &_lru;
+    while (_usage + charge > _capacity && cur->next != &_lru) {
+        LRUHandle* old = cur->next;
+        if (_detach_if_in_use(old)) {
+            continue;
+        }
         DCHECK(old->priority == CachePriority::DURABLE);
         _evict_one_entry(old);
         deleted->push_back(old);
@@ -290,14 +435,111 @@ void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted)
 
 void LRUCache::_evict_one_entry(LRUHandle* e) {
     DCHECK(e->in_cache);
-    DCHECK(e->refs == 1); // LRU list contains elements which may be evicted
+    DCHECK(e->refs == 1); // Only the cache holds the entry, which is not detached
     _lru_remove(e);
     _table.remove(e->key(), e->hash);
     e->in_cache = false;
+    _remove_from_segment(e);
     _unref(e);
     _usage -= e->charge;
 }
 
+LRUHandle* LRUCache::_list_of(LRUHandle* e) {
+    switch (e->segment) {
+    case LRUSegment::PROBATION:
+        return &_probation;
+    case LRUSegment::PROTECTED:
+        return &_protected;
+    default:
+        return &_lru;
+    }
+}
+
+void LRUCache::_remove_from_segment(LRUHandle* e) {
+    if (e->segment == LRUSegment::WINDOW) {
+        _window_usage -= e->charge;
+    } else if (e->segment == LRUSegment::PROTECTED) {
+        _protected_usage -= e->charge;
+    }
+}
+
+void LRUCache::_demote_protected() {
+    // Demote the least recently used entries of the protected segment exceeding 80% of the main cache.
+    const size_t window_capacity = _capacity / 100;
+    const size_t protected_capacity = (_capacity - window_capacity) / 5 * 4;
+    while (_protected_usage > protected_capacity && _protected.next != &_protected) {
+        LRUHandle* old = _protected.next;
+        _lru_remove(old);
+        old->segment = LRUSegment::PROBATION;
+        _protected_usage -= old->charge;
+        _lru_append(&_probation, old);
+    }
+}
+
+LRUHandle* LRUCache::_oldest(LRUHandle* list, bool include_durable) {
+    for (LRUHandle* e = list->next; e != list;) {
+        LRUHandle* next = e->next;
+        if (!_detach_if_in_use(e) && (include_durable || e->priority != CachePriority::DURABLE)) {
+            return e;
+        }
+        e = next;
+    }
+    return nullptr;
+}
+
+void LRUCache::_evict_from_tiny_lfu(size_t charge, std::vector<LRUHandle*>* deleted) {
+    // 1. Move the least recently used entries exceeding the window (1% of the capacity) to the most recently used
+    // end of the probation segment, as the candidates to be admitted.
+    const size_t window_capacity = _capacity / 100;
+    LRUHandle* candidate = nullptr;
+    while (_window_usage + charge > window_capacity && _lru.next != &_lru) {
+        LRUHandle* e = _lru.next;
+        _lru_remove(e);
+        e->segment = LRUSegment::PROBATION;
+        _window_usage -= e->charge;
+        _lru_append(&_probation, e);
+        if (candidate == nullptr) {
+            candidate = e;
+        }
+    }
+
+    // 2. Evict the less frequently used one of the least recently used entry of the probation segment (victim)
+    // and the candidate, and the durable entries are evicted at last.
+    while (_usage + charge > _capacity) {
+        // The candidates in use are not evicted, so they are not detached by _oldest() before the first one left.
+        while (candidate != nullptr && _num_refs(candidate) > 1) {
+            candidate = candidate->next != &_probation ? candidate->next : nullptr;
+        }
+        LRUHandle* victim = _oldest(&_probation, false);
+        if (victim == nullptr) {
+            victim = _oldest(&_lru, false);
+        }
+        if (victim == nullptr) {
+            victim = _oldest(&_protected, false);
+        }
+        for (LRUHandle* list : {&_probation, &_lru, &_protected}) {
+            if (victim == nullptr) {
+                victim = _oldest(list, true);
+            }
+        }
+        if (victim == nullptr) {
+            break;
+        }
+        if (candidate != nullptr && candidate != victim && victim->segment == LRUSegment::PROBATION &&
+            candidate->priority != CachePriority::DURABLE &&
+            _sketch.frequency(candidate->hash) <= _sketch.frequency(victim->hash)) {
+            // reject the candidate
+            victim = candidate;
+            ++_rejected_count;
+        }
+        if (victim == candidate) {
+            candidate = candidate->next != &_probation ? candidate->next : nullptr;
+        }
+        _evict_one_entry(victim);
+        deleted->push_back(victim);
+    }
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                                 void (*deleter)(const CacheKey& key, void* value), CachePriority priority,
                                 size_t value_size) {
@@ -307,34 +549,43 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->charge = charge;
     e->key_length = key.size();
     e->hash = hash;
-    e->refs = 2; // one for the returned handle, one for LRUCache.
+    e->refs.store(2, std::memory_order_relaxed); // one for the returned handle, one for LRUCache.
     e->next = e->prev = nullptr;
     e->in_cache = true;
     e->priority = priority;
     e->value_size = value_size;
+    e->segment = LRUSegment::WINDOW;
     memcpy(e->key_data, key.data(), key.size());
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
-
-        // Free the space following strict LRU policy until enough space
-        // is freed or the lru list is empty
-        _evict_from_lru(charge, &last_ref_list);
+        _drain_read_buffers(&last_ref_list);
+
+        if (_policy == CachePolicy::TINY_LFU) {
+            _sketch.ensure_capacity(_table.size() + 1);
+            _sketch.increment(hash);
+        } else {
+            // Free the space following strict LRU policy until enough space
+            // is freed or the lru list is empty
+            _evict_from_lru(charge, &last_ref_list);
+        }
 
         // insert into the cache
         // note that the cache might get larger than its capacity if not enough
         // space was freed
         auto old = _table.insert(e);
         _usage += charge;
+        _window_usage += charge;
+        _lru_append(&_lru, e);
         if (old != nullptr) {
             old->in_cache = false;
-            if (_unref(old)) {
-                _usage -= old->charge;
-                // old is on LRU because it's in cache and its reference count
-                // was just 1 (Unref returned 0)
-                _lru_remove(old);
-                last_ref_list.push_back(old);
-            }
+            _remove_from_list(old);
+            _remove_from_segment(old);
+            _unref_locked(old, &last_ref_list);
+        }
+        if (_policy == CachePolicy::TINY_LFU) {
+            // The new entry is in use, so it is not evicted.
+            _evict_from_tiny_lfu(0, &last_ref_list);
         }
     }
 
@@ -348,49 +599,53 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
 }
 
 void LRUCache::erase(const CacheKey& key, uint32_t hash) {
-    LRUHandle* e = nullptr;
-    bool last_ref = false;
+    std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
-        e = _table.remove(key, hash);
+        _drain_read_buffers(&last_ref_list);
+        LRUHandle* e = _table.remove(key, hash);
         if (e != nullptr) {
-            last_ref = _unref(e);
-            if (last_ref) {
-                _usage -= e->charge;
-                if (e->in_cache) {
-                    // locate in free list
-                    _lru_remove(e);
-                }
-            }
+            DCHECK(e->in_cache);
+            _remove_from_list(e);
+            _remove_from_segment(e);
             e->in_cache = false;
+            _unref_locked(e, &last_ref_list);
         }
     }
-    // free handle out of mutex, when last_ref is true, e must not be nullptr
-    if (last_ref) {
-        e->free();
+    // free handle out of mutex
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+}
+
+int LRUCache::_prune_list(LRUHandle* list, std::vector<LRUHandle*>* deleted) {
+    int num_prune = 0;
+    for (LRUHandle* e = list->next; e != list;) {
+        LRUHandle* next = e->next;
+        if (_num_refs(e) == 1) {
+            _evict_one_entry(e);
+            deleted->push_back(e);
+            num_prune++;
+        }
+        e = next;
     }
+    return num_prune;
 }
 
 int LRUCache::prune() {
     std::vector<LRUHandle*> last_ref_list;
+    int num_prune = 0;
     {
         std::lock_guard l(_mutex);
-        while (_lru.next != &_lru) {
-            LRUHandle* old = _lru.next;
-            DCHECK(old->in_cache);
-            DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
-            _lru_remove(old);
-            _table.remove(old->key(), old->hash);
-            old->in_cache = false;
-            _unref(old);
-            _usage -= old->charge;
-            last_ref_list.push_back(old);
-        }
+        _drain_read_buffers(&last_ref_list);
+        num_prune += _prune_list(&_lru, &last_ref_list);
+        num_prune += _prune_list(&_probation, &last_ref_list);
+        num_prune += _prune_list(&_protected, &last_ref_list);
     }
     for (auto entry : last_ref_list) {
         entry->free();
     }
-    return last_ref_list.size();
+    return num_prune;
 }
 
 inline uint32_t ShardedLRUCache::_hash_slice(const CacheKey& s) {
@@ -401,10 +656,11 @@ uint32_t ShardedLRUCache::_shard(uint32_t hash) {
     return hash >> (32 - kNumShardBits);
 }
 
-ShardedLRUCache::ShardedLRUCache(size_t capacity, ChargeMode charge_mode)
-        : _last_id(0), _capacity(capacity), _charge_mode(charge_mode) {
+ShardedLRUCache::ShardedLRUCache(size_t capacity, ChargeMode charge_mode, CachePolicy policy)
+        : _last_id(0), _capacity(capacity), _charge_mode(charge_mode), _policy(policy) {
     const size_t per_shard = (_capacity + (kNumShards - 1)) / kNumShards;
     for (auto& _shard : _shards) {
+        _shard.set_policy(_policy);
         _shard.set_capacity(per_shard);
         _shard.set_charge_mode(_charge_mode);
     }
@@ -532,12 +788,16 @@ void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
         }
 
         shard_info.AddMember("hit_ratio", hit_ratio, document->GetAllocator());
+        if (_policy == CachePolicy::TINY_LFU) {
+            shard_info.AddMember("rejected_count", static_cast<double>(_shards[i].get_rejected_count()),
+                                 document->GetAllocator());
+        }
         document->PushBack(shard_info, document->GetAllocator());
     }
 }
 
-Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode) {
-    return new ShardedLRUCache(capacity, charge_mode);
+Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode, CachePolicy policy) {
+    return new ShardedLRUCache(capacity, charge_mode, policy);
 }
 
 } // namespace starrocks
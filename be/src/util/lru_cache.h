@@ -6,13 +6,16 @@
 
 #include <rapidjson/document.h>
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include "util/frequency_sketch.h"
 #include "util/slice.h"
 
 namespace starrocks {
@@ -27,9 +30,20 @@ enum class ChargeMode {
     MEMSIZE = 1
 };
 
+enum class CachePolicy {
+    // evict the least recently used entry
+    LRU = 0,
+    // W-TinyLFU: the new entries are kept in a small LRU window, and the entries leaving the window are admitted to
+    // the main cache only if they are accessed more frequently than the entries to be evicted from the probation
+    // segment of the main cache, so a large scan accessing each entry once does not flush the frequently used
+    // entries. The entries hit in the probation segment are promoted to the protected segment.
+    TINY_LFU = 1
+};
+
 // Create a new cache with a fixed size capacity.  This implementation
-// of Cache uses a least-recently-used eviction policy.
-extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+// of Cache uses a least-recently-used eviction policy by default.
+extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE,
+                            CachePolicy policy = CachePolicy::LRU);
 
 class CacheKey {
 public:
@@ -199,6 +213,9 @@ private:
     const Cache& operator=(const Cache&) = delete;
 };
 
+// The segment of the cache holding an entry. The entries of CachePolicy::LRU are always in WINDOW.
+enum class LRUSegment : uint8_t { WINDOW = 0, PROBATION = 1, PROTECTED = 2 };
+
 // An entry is a variable length heap-allocated structure.  Entries
 // are kept in a circular doubly linked list ordered by access time.
 typedef struct LRUHandle {
@@ -210,9 +227,12 @@ typedef struct LRUHandle {
     size_t charge;
     size_t key_length;
     bool in_cache; // Whether entry is in the cache.
-    uint32_t refs;
+    // Released without the lock of the shard, and only the one decreasing it to 0 frees the entry. The highest bit
+    // marks an entry in cache taken off its list by eviction while in use.
+    std::atomic<uint32_t> refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
+    LRUSegment segment = LRUSegment::WINDOW;
     size_t value_size;
     char key_data[1]; // Beginning of key
 
@@ -251,6 +271,8 @@ public:
 
     LRUHandle* remove(const CacheKey& key, uint32_t hash);
 
+    uint32_t size() const { return _elems; }
+
 private:
     // The tablet consists of an array of buckets where each bucket is
     // a linked list of cache entries that hash into the bucket.
@@ -276,45 +298,106 @@ public:
 
     void set_charge_mode(ChargeMode charge_mode);
 
+    void set_policy(CachePolicy policy);
+
     // Like Cache methods, but with an extra "hash" parameter.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                           void (*deleter)(const CacheKey& key, void* value),
                           CachePriority priority = CachePriority::NORMAL, size_t value_size = 0);
+    // Takes the lock in the shared mode only, and the hit is recorded in a read buffer to update the LRU lists later
+    // under the exclusive lock.
     Cache::Handle* lookup(const CacheKey& key, uint32_t hash);
+    // Takes the lock only to put an entry detached from its list back, when its last handle is released.
     void release(Cache::Handle* handle);
     void erase(const CacheKey& key, uint32_t hash);
     int prune();
 
     uint64_t get_lookup_count() const;
     uint64_t get_hit_count() const;
+    // Number of the new entries not admitted by CachePolicy::TINY_LFU.
+    uint64_t get_rejected_count() const;
     size_t get_usage() const;
     size_t get_capacity() const;
 
 private:
+    // A lossy buffer of the entries hit by lookups, which are moved to the most recently used end of their lists
+    // when the buffers are drained under the exclusive lock. The accesses are dropped when the buffer is full.
+    // Each recorded entry holds a reference, so it is not freed before being drained.
+    struct alignas(64) ReadBuffer {
+        static constexpr uint32_t kSize = 16;
+        std::atomic<uint32_t> write_pos{0};
+        std::atomic<LRUHandle*> slots[kSize] = {};
+    };
+    static constexpr int kNumReadBuffers = 4;
+
+    // Returns true if the read buffer is full and should be drained.
+    bool _record_read(LRUHandle* e);
+    void _drain_read_buffers(std::vector<LRUHandle*>* deleted);
+    void _on_hit(LRUHandle* e);
+
+    // The entries in use met by eviction are taken off their lists, so they are skipped only once, and the last
+    // release puts them back. It is marked by kDetached in the refs, which is set and cleared under the lock.
+    static constexpr uint32_t kDetached = 1U << 31;
+    static uint32_t _num_refs(const LRUHandle* e);
+    static bool _is_detached(const LRUHandle* e);
+    // Detaches `e` if it is in use, and returns whether it is detached.
+    bool _detach_if_in_use(LRUHandle* e);
+    // Removes `e` leaving the cache from its list, unless it is detached.
+    void _remove_from_list(LRUHandle* e);
+
     void _lru_remove(LRUHandle* e);
     void _lru_append(LRUHandle* list, LRUHandle* e);
     bool _unref(LRUHandle* e);
+    // Drops a reference under the lock, puts back the detached entry held only by the cache, and collects the
+    // entry to free into `deleted`.
+    void _unref_locked(LRUHandle* e, std::vector<LRUHandle*>* deleted);
+    void _evict(size_t charge, std::vector<LRUHandle*>* deleted);
     void _evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted);
     void _evict_one_entry(LRUHandle* e);
+    int _prune_list(LRUHandle* list, std::vector<LRUHandle*>* deleted);
+
+    // The list of the segment of `e`.
+    LRUHandle* _list_of(LRUHandle* e);
+    // Update the usage of the segment when `e` is removed from the cache.
+    void _remove_from_segment(LRUHandle* e);
+    void _demote_protected();
+    void _evict_from_tiny_lfu(size_t charge, std::vector<LRUHandle*>* deleted);
+    // The least recently used entry of `list` not in use, and the ones in use before it are detached.
+    LRUHandle* _oldest(LRUHandle* list, bool include_durable);
 
     // Initialized before use.
-    size_t _capacity{0};
+    std::atomic<size_t> _capacity{0};
 
     ChargeMode _charge_mode;
 
-    // _mutex protects the following state.
-    mutable std::mutex _mutex;
-    size_t _usage{0};
+    // _mutex protects the following state, and the lookups read `_table` in the shared mode.
+    mutable std::shared_mutex _mutex;
+    // Charges of the entries not freed yet, including the ones removed from the cache but still in use.
+    std::atomic<size_t> _usage{0};
 
     // Dummy head of LRU list.
     // lru.prev is newest entry, lru.next is oldest entry.
-    // Entries have refs==1 and in_cache==true.
+    // Entries have in_cache==true, and the ones with refs > 1 are in use until detached by eviction.
     LRUHandle _lru;
 
     HandleTable _table;
 
-    uint64_t _lookup_count{0};
-    uint64_t _hit_count{0};
+    ReadBuffer _read_buffers[kNumReadBuffers];
+
+    std::atomic<uint64_t> _lookup_count{0};
+    std::atomic<uint64_t> _hit_count{0};
+
+    // CachePolicy::TINY_LFU uses `_lru` as the list of the window, and the following state.
+    CachePolicy _policy = CachePolicy::LRU;
+    LRUHandle _probation;
+    LRUHandle _protected;
+    // Charges of the entries in cache of the window and the protected segment, including the ones in use.
+    size_t _window_usage{0};
+    size_t _protected_usage{0};
+    FrequencySketch _sketch;
+    // Serializes the lookups counting the accesses in `_sketch` under the shared `_mutex`.
+    std::mutex _sketch_mutex;
+    uint64_t _rejected_count{0};
 };
 
 static const int kNumShardBits = 5;
@@ -322,7 +405,8 @@ static const int kNumShards = 1 << kNumShardBits;
 
 class ShardedLRUCache : public Cache {
 public:
-    explicit ShardedLRUCache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+    explicit ShardedLRUCache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE,
+                             CachePolicy policy = CachePolicy::LRU);
     ~ShardedLRUCache() override = default;
     Handle* insert(const CacheKey& key, void* value, size_t charge, void (*deleter)(const CacheKey& key, void* value),
                    CachePriority priority = CachePriority::NORMAL, size_t value_size = 0) override;
@@ -352,6 +436,7 @@ private:
     uint64_t _last_id;
     size_t _capacity;
     ChargeMode _charge_mode;
+    CachePolicy _policy;
 };
 
 } // namespace starrocks
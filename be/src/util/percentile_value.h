@@ -34,6 +34,8 @@ public:
 
     void add(float value) { _tdigest.add(value); }
 
+    void add(const float* values, size_t size) { _tdigest.add(values, size); }
+
     void merge(const PercentileValue* other) { _tdigest.merge(&other->_tdigest); }
 
     uint64_t serialize_size() const {
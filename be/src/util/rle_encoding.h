@@ -36,6 +36,7 @@
 #include <glog/logging.h>
 
 #include "gutil/port.h"
+#include "simd/gather.h"
 #include "util/bit_stream_utils.inline.h"
 #include "util/bit_util.h"
 
@@ -431,11 +432,9 @@ inline size_t RleDecoder<T>::GetBatch(T* vals, size_t batch_num) {
             read_num += read_this_time;
         } else if (literal_count_ > 0) {
             read_this_time = std::min((size_t)literal_count_, read_this_time);
-            for (int i = 0; i < read_this_time; ++i) {
-                bool result = bit_reader_.GetValue(bit_width_, vals);
-                DCHECK(result);
-                vals++;
-            }
+            bool result = bit_reader_.GetBatch(bit_width_, vals, read_this_time);
+            DCHECK(result);
+            vals += read_this_time;
             literal_count_ -= read_this_time;
             read_num += read_this_time;
         } else {
@@ -953,8 +952,12 @@ inline int RleBatchDecoder<T>::GetBatchWithDict(const TV* dictionary, int32_t di
         if (UNLIKELY(!IndicesInRange(indices, num_literals_to_set, dictionary_length))) {
             return -1;
         }
-        for (int i = 0; i < num_literals_to_set; ++i) {
-            values[num_consumed + i] = dictionary[indices[i]];
+        if constexpr ((sizeof(TV) == 4 || sizeof(TV) == 8) && std::is_trivially_copyable_v<TV> && sizeof(T) == 4) {
+            SIMDGather::gather_dict(values + num_consumed, dictionary, dictionary_length, indices, num_literals_to_set);
+        } else {
+            for (int i = 0; i < num_literals_to_set; ++i) {
+                values[num_consumed + i] = dictionary[indices[i]];
+            }
         }
         num_consumed += num_literals_to_set;
     }
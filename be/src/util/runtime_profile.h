@@ -49,6 +49,7 @@
 #include "common/object_pool.h"
 #include "gen_cpp/RuntimeProfile_types.h"
 #include "gutil/casts.h"
+#include "gutil/walltime.h"
 #include "util/stopwatch.hpp"
 
 namespace starrocks {
@@ -758,4 +759,27 @@ private:
     int64_t* _counter;
 };
 
+// Adds the cpu cycles elapsed when the object goes out of scope, multiplied by `scale`, to `*counter`, or does
+// nothing if `counter` is nullptr. Reading the cycle counter costs a few nanoseconds instead of a clock_gettime, but
+// the cycles have to be converted to time by the caller, e.g. by the time and cycles of an enclosing scope.
+class ScopedCycleTimer {
+public:
+    ScopedCycleTimer(int64_t* counter, int64_t scale)
+            : _counter(counter), _scale(scale), _start(counter != nullptr ? CycleClock::Now() : 0) {}
+    ~ScopedCycleTimer() {
+        if (_counter != nullptr) {
+            *_counter += (CycleClock::Now() - _start) * _scale;
+        }
+    }
+
+    // Disable copy constructor and assignment
+    ScopedCycleTimer(const ScopedCycleTimer& timer) = delete;
+    ScopedCycleTimer& operator=(const ScopedCycleTimer& timer) = delete;
+
+private:
+    int64_t* _counter;
+    const int64_t _scale;
+    const int64_t _start;
+};
+
 } // namespace starrocks
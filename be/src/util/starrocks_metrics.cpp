@@ -53,6 +53,7 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(http_request_send_bytes);
     REGISTER_STARROCKS_METRIC(query_scan_bytes);
     REGISTER_STARROCKS_METRIC(query_scan_rows);
+    REGISTER_STARROCKS_METRIC(pipe_scan_cross_numa_node_chunks);
 
     REGISTER_STARROCKS_METRIC(load_channel_add_chunks_total);
     REGISTER_STARROCKS_METRIC(load_channel_add_chunks_duration_us);
@@ -83,6 +84,7 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(update_rowset_commit_request_failed);
     REGISTER_STARROCKS_METRIC(update_rowset_commit_apply_total);
     REGISTER_STARROCKS_METRIC(update_rowset_commit_apply_duration_us);
+    REGISTER_STARROCKS_METRIC(update_rowset_commit_apply_lag_seconds);
     REGISTER_STARROCKS_METRIC(update_primary_index_num);
     REGISTER_STARROCKS_METRIC(update_primary_index_bytes_total);
     REGISTER_STARROCKS_METRIC(update_del_vector_num);
@@ -97,6 +99,12 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(delta_column_group_get_non_pk_total);
     REGISTER_STARROCKS_METRIC(delta_column_group_get_non_pk_hit_cache);
 
+    REGISTER_STARROCKS_METRIC(datacache_auto_tune_mem_quota_bytes);
+    REGISTER_STARROCKS_METRIC(datacache_auto_tune_disk_quota_bytes);
+    REGISTER_STARROCKS_METRIC(datacache_auto_tune_estimated_hit_ratio);
+    REGISTER_STARROCKS_METRIC(datacache_auto_tune_grow_total);
+    REGISTER_STARROCKS_METRIC(datacache_auto_tune_shrink_total);
+
     // push request
     _metrics.register_metric("push_requests_total", MetricLabels().add("status", "SUCCESS"),
                              &push_requests_success_total);
@@ -95,11 +95,14 @@ public:
     METRIC_DEFINE_INT_GAUGE(pipe_driver_schedule_count, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_driver_execution_time, MetricUnit::NANOSECONDS);
     METRIC_DEFINE_INT_GAUGE(pipe_driver_queue_len, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_GAUGE(pipe_driver_local_run_queue_hit_count, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_GAUGE(pipe_driver_steal_count, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_poller_block_queue_len, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(query_scan_bytes_per_second, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(runtime_filter_event_queue_len, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_COUNTER(query_scan_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_COUNTER(query_scan_rows, MetricUnit::ROWS);
+    METRIC_DEFINE_INT_COUNTER(pipe_scan_cross_numa_node_chunks, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_drivers, MetricUnit::NOUNIT);
 
     // counters
@@ -245,6 +248,7 @@ public:
     METRIC_DEFINE_INT_COUNTER(update_rowset_commit_request_failed, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(update_rowset_commit_apply_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(update_rowset_commit_apply_duration_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_INT_COUNTER(update_rowset_commit_apply_lag_seconds, MetricUnit::SECONDS);
     METRIC_DEFINE_UINT_GAUGE(update_primary_index_num, MetricUnit::OPERATIONS);
     METRIC_DEFINE_UINT_GAUGE(update_primary_index_bytes_total, MetricUnit::BYTES);
     METRIC_DEFINE_UINT_GAUGE(update_del_vector_num, MetricUnit::OPERATIONS);
@@ -259,6 +263,13 @@ public:
     METRIC_DEFINE_INT_COUNTER(delta_column_group_get_non_pk_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(delta_column_group_get_non_pk_hit_cache, MetricUnit::REQUESTS);
 
+    // the decisions of the datacache quota auto tuning
+    METRIC_DEFINE_INT_GAUGE(datacache_auto_tune_mem_quota_bytes, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_GAUGE(datacache_auto_tune_disk_quota_bytes, MetricUnit::BYTES);
+    METRIC_DEFINE_DOUBLE_GAUGE(datacache_auto_tune_estimated_hit_ratio, MetricUnit::PERCENT);
+    METRIC_DEFINE_INT_COUNTER(datacache_auto_tune_grow_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(datacache_auto_tune_shrink_total, MetricUnit::OPERATIONS);
+
     // Gauges
     METRIC_DEFINE_INT_GAUGE(memory_pool_bytes_total, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(process_thread_num, MetricUnit::NOUNIT);
@@ -340,6 +351,7 @@ public:
     METRICS_DEFINE_THREAD_POOL(segment_flush);
     METRICS_DEFINE_THREAD_POOL(update_apply);
     METRICS_DEFINE_THREAD_POOL(pk_index_compaction);
+    METRICS_DEFINE_THREAD_POOL(pk_index_warmup);
 
     METRIC_DEFINE_UINT_GAUGE(load_rpc_threadpool_size, MetricUnit::NOUNIT);
 
@@ -227,6 +227,22 @@ public:
         return LIKELY(c == ' ') || UNLIKELY(c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r');
     }
 
+    // Classifies the 8 chars of `v`, loaded from memory in little-endian order, in one step: a byte of the result
+    // is zero iff the char is an ASCII digit. The high bits are masked before the add so no byte carries into the
+    // next one, the chars >= 0x80 fail the first check anyway.
+    static inline uint64_t non_digit_bytes(uint64_t v) {
+        return ((v & 0xF0F0F0F0F0F0F0F0ULL) ^ 0x3030303030303030ULL) |
+               ((((v & 0x7F7F7F7F7F7F7F7FULL) + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) ^
+                0x3030303030303030ULL);
+    }
+
+    // Returns the value of the 8 ASCII digits of `v`, loaded from memory in little-endian order.
+    static inline uint32_t parse_eight_digits(uint64_t v) {
+        v = ((v & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+        v = ((v & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+        return static_cast<uint32_t>(((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+    }
+
 }; // end of class StringParser
 
 template <typename T>
@@ -407,7 +423,19 @@ inline T StringParser::string_to_int_no_overflow(const char* s, int len, ParseRe
         *result = PARSE_FAILURE;
         return 0;
     }
-    for (int i = 1; i < len; ++i) {
+    int i = 1;
+    if constexpr (sizeof(T) >= sizeof(uint32_t)) {
+        // Consume the digits 8 at a time, the rest and the chars after them are left to the loop below.
+        for (; i + 8 <= len; i += 8) {
+            uint64_t chars;
+            memcpy(&chars, s + i, sizeof(chars));
+            if (non_digit_bytes(chars) != 0) {
+                break;
+            }
+            val = val * 100000000 + parse_eight_digits(chars);
+        }
+    }
+    for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
             val = val * 10 + digit;
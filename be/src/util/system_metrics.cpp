@@ -265,6 +265,8 @@ void SystemMetrics::_install_memory_metrics(MetricRegistry* registry) {
     registry->register_metric("decimal_column_pool_bytes", &_memory_metrics->column_pool_decimal_bytes);
     registry->register_metric("date_column_pool_bytes", &_memory_metrics->column_pool_date_bytes);
     registry->register_metric("datetime_column_pool_bytes", &_memory_metrics->column_pool_datetime_bytes);
+    registry->register_metric("column_pool_hit_count", &_memory_metrics->column_pool_hit_count);
+    registry->register_metric("column_pool_miss_count", &_memory_metrics->column_pool_miss_count);
 }
 
 void SystemMetrics::_update_memory_metrics() {
@@ -332,9 +334,15 @@ void SystemMetrics::_update_memory_metrics() {
     SET_MEM_METRIC_VALUE(datacache_mem_tracker, datacache_mem_bytes)
 #undef SET_MEM_METRIC_VALUE
 
-#define UPDATE_COLUMN_POOL_METRIC(var, type)                 \
-    value = describe_column_pool<type>().central_free_bytes; \
-    var.set_value(value);
+    int64_t column_pool_hit_count = 0;
+    int64_t column_pool_miss_count = 0;
+#define UPDATE_COLUMN_POOL_METRIC(var, type)                  \
+    {                                                         \
+        auto info = describe_column_pool<type>();             \
+        var.set_value(info.central_free_bytes);               \
+        column_pool_hit_count += info.hit_count;              \
+        column_pool_miss_count += info.miss_count;            \
+    }
 
     UPDATE_COLUMN_POOL_METRIC(_memory_metrics->column_pool_binary_bytes, BinaryColumn)
     UPDATE_COLUMN_POOL_METRIC(_memory_metrics->column_pool_uint8_bytes, UInt8Column)
@@ -348,6 +356,8 @@ void SystemMetrics::_update_memory_metrics() {
     UPDATE_COLUMN_POOL_METRIC(_memory_metrics->column_pool_decimal_bytes, DecimalColumn)
     UPDATE_COLUMN_POOL_METRIC(_memory_metrics->column_pool_date_bytes, DateColumn)
     UPDATE_COLUMN_POOL_METRIC(_memory_metrics->column_pool_datetime_bytes, TimestampColumn)
+    _memory_metrics->column_pool_hit_count.set_value(column_pool_hit_count);
+    _memory_metrics->column_pool_miss_count.set_value(column_pool_miss_count);
 
 #undef UPDATE_COLUMN_POOL_METRIC
 }
@@ -84,6 +84,8 @@ public:
     METRIC_DEFINE_INT_GAUGE(column_pool_decimal_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(column_pool_date_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(column_pool_datetime_bytes, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_GAUGE(column_pool_hit_count, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_GAUGE(column_pool_miss_count, MetricUnit::NOUNIT);
 };
 
 class SystemMetrics {
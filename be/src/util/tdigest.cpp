@@ -381,6 +381,31 @@ bool TDigest::add(Value x, Weight w) {
     return true;
 }
 
+void TDigest::add(const Value* values, size_t size) {
+    size_t i = 0;
+    while (i < size) {
+        // add(x) processes once the buffer holds more than _max_unprocessed centroids, so append up to that
+        // many at a time, or one at a time if the processed centroids are still too many
+        size_t room = 1;
+        if (_processed.size() <= _max_processed && _unprocessed.size() < _max_unprocessed) {
+            room = _max_unprocessed + 1 - _unprocessed.size();
+        }
+        const size_t end = std::min(size, i + room);
+        bool added = false;
+        for (; i < end; i++) {
+            if (std::isnan(values[i])) {
+                continue;
+            }
+            _unprocessed.emplace_back(values[i], 1);
+            _unprocessed_weight += 1;
+            added = true;
+        }
+        if (added) {
+            processIfNecessary();
+        }
+    }
+}
+
 void TDigest::add(std::vector<Centroid>::const_iterator iter, std::vector<Centroid>::const_iterator end) {
     while (iter != end) {
         const size_t diff = std::distance(iter, end);
@@ -169,6 +169,8 @@ public:
     // add a single centroid to the unprocessed vector, processing previously unprocessed sorted if our limit has
     // been reached.
     bool add(Value x, Weight w);
+    // add values of weight 1 in bulk, the same as calling add(x) for each of them
+    void add(const Value* values, size_t size);
     void add(std::vector<Centroid>::const_iterator iter, std::vector<Centroid>::const_iterator end);
     uint64_t serialize_size() const;
     size_t serialize(uint8_t* writer) const;
@@ -34,6 +34,8 @@
 
 #include "util/threadpool.h"
 
+#include <bvar/bvar.h>
+
 #include <limits>
 #include <ostream>
 
@@ -52,6 +54,14 @@ namespace starrocks {
 using std::string;
 using strings::Substitute;
 
+// The max number of tokenless tasks a worker of a work stealing pool runs before
+// checking the token-based ones again.
+static constexpr int kLocalTaskBatchSize = 64;
+
+// The pool of the current worker thread, and its index in the pool.
+static thread_local const ThreadPool* tls_pool = nullptr;
+static thread_local int tls_worker_index = 0;
+
 class FunctionRunnable : public Runnable {
 public:
     explicit FunctionRunnable(std::function<void()> func) : _func(std::move(func)) {}
@@ -67,7 +77,9 @@ ThreadPoolBuilder::ThreadPoolBuilder(string name)
           _min_threads(0),
           _max_threads(CpuInfo::num_cores()),
           _max_queue_size(std::numeric_limits<int>::max()),
-          _idle_timeout(MonoDelta::FromMilliseconds(500)) {}
+          _idle_timeout(MonoDelta::FromMilliseconds(500)),
+          _work_stealing(false),
+          _queue_time_metric(false) {}
 
 ThreadPoolBuilder& ThreadPoolBuilder::set_min_threads(int min_threads) {
     CHECK_GE(min_threads, 0);
@@ -91,6 +103,16 @@ ThreadPoolBuilder& ThreadPoolBuilder::set_idle_timeout(const MonoDelta& idle_tim
     return *this;
 }
 
+ThreadPoolBuilder& ThreadPoolBuilder::set_work_stealing(bool work_stealing) {
+    _work_stealing = work_stealing;
+    return *this;
+}
+
+ThreadPoolBuilder& ThreadPoolBuilder::set_queue_time_metric(bool queue_time_metric) {
+    _queue_time_metric = queue_time_metric;
+    return *this;
+}
+
 Status ThreadPoolBuilder::build(std::unique_ptr<ThreadPool>* pool) const {
     pool->reset(new ThreadPool(*this));
     RETURN_IF_ERROR((*pool)->init());
@@ -250,7 +272,17 @@ ThreadPool::ThreadPool(const ThreadPoolBuilder& builder)
           _num_threads_pending_start(0),
           _active_threads(0),
           _total_queued_tasks(0),
-          _tokenless(new_token(ExecutionMode::CONCURRENT)) {}
+          _tokenless(new_token(ExecutionMode::CONCURRENT)),
+          _work_stealing(builder._work_stealing) {
+    if (_work_stealing) {
+        for (int i = 0; i < builder._max_threads; i++) {
+            _local_queues.emplace_back(std::make_unique<LocalQueue>());
+        }
+    }
+    if (builder._queue_time_metric) {
+        _queue_time_us = std::make_unique<bvar::LatencyRecorder>("thread_pool_" + _name, "queue_time");
+    }
+}
 
 ThreadPool::~ThreadPool() noexcept {
     // There should only be one live token: the one used in tokenless submission.
@@ -264,7 +296,9 @@ Status ThreadPool::init() {
         return Status::NotSupported("The thread pool is already initialized");
     }
     _pool_status = Status::OK();
+    _local_queues_closed = false;
     _num_threads_pending_start = _min_threads;
+    _num_live_threads = _min_threads;
     for (int i = 0; i < _min_threads; i++) {
         Status status = create_thread();
         if (!status.ok()) {
@@ -296,6 +330,14 @@ void ThreadPool::shutdown() {
     // locks, etc, so this also prevents lock inversions.
     _queue.clear();
     std::deque<PriorityQueue<NUM_PRIORITY, Task>> to_release;
+    _local_queues_closed = true;
+    for (auto& queue : _local_queues) {
+        std::lock_guard queue_lock(queue->lock);
+        if (!queue->tasks.empty()) {
+            _local_queued_tasks -= static_cast<int>(queue->tasks.size());
+            to_release.emplace_back(std::move(queue->tasks));
+        }
+    }
     for (auto* t : _tokens) {
         if (!t->_entries.empty()) {
             to_release.emplace_back(std::move(t->_entries));
@@ -325,6 +367,7 @@ void ThreadPool::shutdown() {
     while (!_idle_threads.empty()) {
         _idle_threads.front().not_empty.notify_one();
         _idle_threads.pop_front();
+        _num_idle_threads--;
     }
     _no_threads_cond.wait(l, [&]() { return _num_threads + _num_threads_pending_start <= 0; });
 
@@ -349,6 +392,9 @@ void ThreadPool::release_token(ThreadPoolToken* t) {
 }
 
 Status ThreadPool::submit(std::shared_ptr<Runnable> r, Priority pri) {
+    if (_work_stealing) {
+        return do_submit_local(std::move(r), pri);
+    }
     return do_submit(std::move(r), _tokenless.get(), pri);
 }
 
@@ -404,13 +450,14 @@ Status ThreadPool::do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token
     //
     // Of course, we never create more than _max_threads threads no matter what.
     int threads_from_this_submit = token->is_active() && token->mode() == ExecutionMode::SERIAL ? 0 : 1;
-    int inactive_threads = _num_threads + _num_threads_pending_start - _active_threads;
+    int inactive_threads = _num_threads + _num_threads_pending_start - _active_threads - _local_active_tasks.load();
     int additional_threads = static_cast<int>(_queue.size()) + threads_from_this_submit - inactive_threads;
     bool need_a_thread = false;
     if (additional_threads > 0 &&
         _num_threads + _num_threads_pending_start < _max_threads.load(std::memory_order_acquire)) {
         need_a_thread = true;
         _num_threads_pending_start++;
+        _num_live_threads++;
     }
 
     Task task;
@@ -438,6 +485,7 @@ Status ThreadPool::do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token
     if (!_idle_threads.empty()) {
         _idle_threads.front().not_empty.notify_one();
         _idle_threads.pop_front();
+        _num_idle_threads--;
     }
     unique_lock.unlock();
 
@@ -446,6 +494,7 @@ Status ThreadPool::do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token
         if (!status.ok()) {
             unique_lock.lock();
             _num_threads_pending_start--;
+            _num_live_threads--;
             if (_num_threads + _num_threads_pending_start == 0) {
                 // If we have no threads, we can't do any work.
                 return status;
@@ -459,10 +508,122 @@ Status ThreadPool::do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token
     return Status::OK();
 }
 
+Status ThreadPool::do_submit_local(std::shared_ptr<Runnable> r, Priority pri) {
+    MonoTime submit_time = MonoTime::Now();
+
+    // Size limit check, racy without _lock, which is fine for a limit.
+    const int64_t capacity_remaining =
+            static_cast<int64_t>(_max_threads.load(std::memory_order_acquire)) - _local_active_tasks.load() +
+            static_cast<int64_t>(_max_queue_size) - _local_queued_tasks.load();
+    if (capacity_remaining < 1) {
+        return Status::ServiceUnavailable(strings::Substitute(
+                "Thread pool is at capacity ($0/$1 tasks running, $2/$3 tasks queued)", _local_active_tasks.load(),
+                _max_threads.load(std::memory_order_acquire), _local_queued_tasks.load(), _max_queue_size));
+    }
+
+    const uint32_t index = tls_pool == this ? tls_worker_index : _next_local_queue.fetch_add(1);
+    LocalQueue& queue = *_local_queues[index % _local_queues.size()];
+    {
+        std::lock_guard queue_lock(queue.lock);
+        if (PREDICT_FALSE(_local_queues_closed.load())) {
+            // Not _pool_status, whose lock is taken before the lock of a queue by shutdown().
+            return Status::ServiceUnavailable("The pool has been shut down.");
+        }
+        Task task;
+        task.runnable = std::move(r);
+        task.submit_time = submit_time;
+        queue.tasks.emplace_back(pri, std::move(task));
+        _local_queued_tasks++;
+    }
+
+    // An idle worker checks _local_queued_tasks after counting itself in
+    // _num_idle_threads, and an exiting one leaves _num_live_threads before
+    // _num_idle_threads, so either it sees the task or we see it here.
+    if (_num_idle_threads.load() == 0 && _num_live_threads.load() >= _max_threads.load(std::memory_order_acquire)) {
+        // All the threads are busy, one of them will take the task.
+        return Status::OK();
+    }
+
+    std::unique_lock unique_lock(_lock);
+    bool need_a_thread = false;
+    if (!_idle_threads.empty()) {
+        _idle_threads.front().not_empty.notify_one();
+        _idle_threads.pop_front();
+        _num_idle_threads--;
+    } else if (_num_threads + _num_threads_pending_start < _max_threads.load(std::memory_order_acquire)) {
+        need_a_thread = true;
+        _num_threads_pending_start++;
+        _num_live_threads++;
+    }
+    unique_lock.unlock();
+
+    if (need_a_thread) {
+        Status status = create_thread();
+        if (!status.ok()) {
+            unique_lock.lock();
+            _num_threads_pending_start--;
+            _num_live_threads--;
+            if (_num_threads + _num_threads_pending_start == 0) {
+                // If we have no threads, we can't do any work.
+                return status;
+            }
+            LOG(ERROR) << "Thread pool failed to create thread: " << status.to_string();
+        }
+    }
+
+    return Status::OK();
+}
+
+bool ThreadPool::pop_local_task(int index, Task* task) {
+    const int num_queues = _local_queues.size();
+    for (int i = 0; i < num_queues; i++) {
+        LocalQueue& queue = *_local_queues[(index + i) % num_queues];
+        std::lock_guard queue_lock(queue.lock);
+        if (!queue.tasks.empty()) {
+            *task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            // count it as active before it leaves the queued ones, for wait()
+            _local_active_tasks++;
+            _local_queued_tasks--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::run_local_tasks(int index) {
+    auto current_thread = Thread::current_thread();
+    Task task;
+    for (int i = 0; i < kLocalTaskBatchSize && pop_local_task(index, &task); i++) {
+        MonoTime start_time = MonoTime::Now();
+        task.runnable->run();
+        current_thread->inc_finished_tasks();
+        // Destruct the task without the lock of its queue or of the pool, see dispatch_thread().
+        task.runnable.reset();
+        MonoTime finish_time = MonoTime::Now();
+        record_task(task.submit_time, start_time, finish_time);
+
+        if (--_local_active_tasks == 0 && _local_queued_tasks.load() == 0) {
+            std::lock_guard l(_lock);
+            _idle_cond.notify_all();
+        }
+    }
+}
+
+void ThreadPool::record_task(const MonoTime& submit_time, const MonoTime& start_time, const MonoTime& finish_time) {
+    const int64_t pending_time_ns = start_time.GetDeltaSince(submit_time).ToNanoseconds();
+    _total_executed_tasks.increment(1);
+    _total_pending_time_ns.increment(pending_time_ns);
+    _total_execute_time_ns.increment(finish_time.GetDeltaSince(start_time).ToNanoseconds());
+    if (_queue_time_us != nullptr) {
+        *_queue_time_us << pending_time_ns / 1000;
+    }
+}
+
 void ThreadPool::wait() {
     std::unique_lock l(_lock);
     check_not_pool_thread_unlocked();
-    while (_total_queued_tasks > 0 || _active_threads > 0) {
+    while (!is_idle_unlocked()) {
         _idle_cond.wait(l);
     }
 }
@@ -471,7 +632,7 @@ bool ThreadPool::wait_for(const MonoDelta& delta) {
     std::unique_lock l(_lock);
     check_not_pool_thread_unlocked();
     return _idle_cond.wait_for(l, std::chrono::nanoseconds(delta.ToNanoseconds()),
-                               [&]() { return _total_queued_tasks <= 0 && _active_threads <= 0; });
+                               [&]() { return is_idle_unlocked(); });
 }
 
 Status ThreadPool::update_max_threads(int max_threads) {
@@ -497,6 +658,11 @@ void ThreadPool::dispatch_thread() {
     // If we are one of the first '_min_threads' to start, we must be
     // a "permanent" thread.
     bool permanent = _num_threads <= _min_threads;
+    const int worker_index = _next_worker_index++;
+    tls_pool = this;
+    tls_worker_index = worker_index;
+    // Whether this thread has left _num_live_threads, before exiting when idle.
+    bool left_live_threads = false;
 
     // Owned by this worker thread and added/removed from _idle_threads as needed.
     IdleThread me;
@@ -508,20 +674,35 @@ void ThreadPool::dispatch_thread() {
             break;
         }
 
+        if (_queue.empty() && _local_queued_tasks.load() > 0) {
+            current_thread->set_idle(false);
+            l.unlock();
+            run_local_tasks(worker_index);
+            l.lock();
+            _last_active_timestamp = MonoTime::Now();
+            continue;
+        }
+
         if (_queue.empty()) {
             current_thread->set_idle(true);
             // There's no work to do, let's go idle.
             //
             // Note: if FIFO behavior is desired, it's as simple as changing this to push_back().
             _idle_threads.push_front(me);
+            _num_idle_threads++;
             SCOPED_CLEANUP({
                 // For some wake ups (i.e. shutdown or do_submit) this thread is
                 // guaranteed to be unlinked after being awakened. In others (i.e.
                 // spurious wake-up or Wait timeout), it'll still be linked.
                 if (me.is_linked()) {
                     _idle_threads.erase(_idle_threads.iterator_to(me));
+                    _num_idle_threads--;
                 }
             });
+            // The tasks of the local queues are submitted without _lock, see do_submit_local().
+            if (_local_queued_tasks.load() > 0) {
+                continue;
+            }
             if (permanent) {
                 me.not_empty.wait(l);
             } else {
@@ -534,6 +715,13 @@ void ThreadPool::dispatch_thread() {
                     // protecting the state, signal, and release again before we get the mutex. So,
                     // we'll recheck the empty queue case regardless.
                     if (_queue.empty()) {
+                        _num_live_threads--;
+                        left_live_threads = true;
+                        if (_local_queued_tasks.load() > 0) {
+                            _num_live_threads++;
+                            left_live_threads = false;
+                            continue;
+                        }
                         VLOG(3) << "Releasing worker thread from pool " << _name << " after "
                                 << _idle_timeout.ToMilliseconds() << "ms of idle time.";
                         break;
@@ -570,10 +758,7 @@ void ThreadPool::dispatch_thread() {
         // with this threadpool, and produce a deadlock.
         task.runnable.reset();
         MonoTime finish_time = MonoTime::Now();
-
-        _total_executed_tasks.increment(1);
-        _total_pending_time_ns.increment(start_time.GetDeltaSince(task.submit_time).ToNanoseconds());
-        _total_execute_time_ns.increment(finish_time.GetDeltaSince(start_time).ToNanoseconds());
+        record_task(task.submit_time, start_time, finish_time);
 
         l.lock();
         _last_active_timestamp = MonoTime::Now();
@@ -606,6 +791,10 @@ void ThreadPool::dispatch_thread() {
 
     CHECK_EQ(_threads.erase(Thread::current_thread()), 1);
     _num_threads--;
+    if (!left_live_threads) {
+        _num_live_threads--;
+    }
+    tls_pool = nullptr;
     if (_num_threads + _num_threads_pending_start == 0) {
         _no_threads_cond.notify_all();
 
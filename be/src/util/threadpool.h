@@ -47,6 +47,7 @@
 #include <string>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "gutil/ref_counted.h"
@@ -57,6 +58,10 @@
 #include "util/monotime.h"
 #include "util/priority_queue.h"
 
+namespace bvar {
+class LatencyRecorder;
+} // namespace bvar
+
 namespace starrocks {
 
 class Thread;
@@ -111,6 +116,16 @@ public:
 //    We always keep at least min_threads.
 //    Default: 500 milliseconds.
 //
+// work_stealing: Whether the tasks submitted without a token are queued into
+//    one of the per-worker queues, instead of the FIFO shared with the tokens,
+//    see ThreadPool.
+//    Default: false.
+//
+// queue_time_metric: Whether to export the latencies of the tasks from their
+//    submission to their start as the bvar "thread_pool_<name>_queue_time",
+//    in microseconds. The name of the pool should be unique.
+//    Default: false.
+//
 // metrics: Histograms, counters, etc. to update on various threadpool events.
 //    Default: not set.
 //
@@ -124,6 +139,8 @@ public:
     ThreadPoolBuilder& set_max_threads(int max_threads);
     ThreadPoolBuilder& set_max_queue_size(int max_queue_size);
     ThreadPoolBuilder& set_idle_timeout(const MonoDelta& idle_timeout);
+    ThreadPoolBuilder& set_work_stealing(bool work_stealing);
+    ThreadPoolBuilder& set_queue_time_metric(bool queue_time_metric);
 
     // Instantiate a new ThreadPool with the existing builder arguments.
     [[nodiscard]] Status build(std::unique_ptr<ThreadPool>* pool) const;
@@ -135,6 +152,8 @@ private:
     int _max_threads;
     int _max_queue_size;
     MonoDelta _idle_timeout;
+    bool _work_stealing;
+    bool _queue_time_metric;
 
     ThreadPoolBuilder(const ThreadPoolBuilder&) = delete;
     const ThreadPoolBuilder& operator=(const ThreadPoolBuilder&) = delete;
@@ -161,6 +180,15 @@ private:
 // from starving one another. However, tokenless (and CONCURRENT token-based)
 // tasks can starve SERIAL token-based tasks.
 //
+// In a work stealing pool, the tokenless tasks are queued into one of the
+// per-worker queues, each with its own lock, so that submitting them at a high
+// rate does not contend on the lock of the pool when all the threads are busy.
+// A task submitted by a worker goes to its own queue, others are spread round
+// robin. A worker runs the tasks of its own queue first, then steals the ones
+// of the other queues, and runs the token-based tasks before both. The tasks
+// of a queue are run in FIFO order, but there is no order across the queues.
+// The token-based tasks keep the semantics above.
+//
 // Usage Example:
 //    static void Func(int n) { ... }
 //    class Task : public Runnable { ... }
@@ -234,7 +262,7 @@ public:
 
     int num_queued_tasks() const {
         std::lock_guard l(_lock);
-        return _total_queued_tasks;
+        return _total_queued_tasks + _local_queued_tasks.load();
     }
 
     MonoTime last_active_timestamp() const {
@@ -244,7 +272,7 @@ public:
 
     int active_threads() const {
         std::lock_guard l(_lock);
-        return _active_threads;
+        return _active_threads + _local_active_tasks.load();
     }
 
     int max_threads() const { return _max_threads.load(std::memory_order_acquire); }
@@ -291,6 +319,27 @@ private:
     // Releases token 't' and invalidates it.
     void release_token(ThreadPoolToken* t);
 
+    // Submits a tokenless task of a work stealing pool.
+    Status do_submit_local(std::shared_ptr<Runnable> r, ThreadPool::Priority pri);
+
+    // Takes the next task of the queue 'index', or of another queue if it is empty.
+    bool pop_local_task(int index, Task* task);
+
+    // Runs a batch of the tasks of the queue 'index' and the stolen ones.
+    // NOTE: _lock should not be held.
+    void run_local_tasks(int index);
+
+    // Updates the statistics with a task which has finished.
+    void record_task(const MonoTime& submit_time, const MonoTime& start_time, const MonoTime& finish_time);
+
+    // Whether there are no queued or running tasks.
+    //
+    // REQUIRES: caller holds _lock.
+    bool is_idle_unlocked() const {
+        return _total_queued_tasks <= 0 && _active_threads <= 0 && _local_queued_tasks.load() <= 0 &&
+               _local_active_tasks.load() <= 0;
+    }
+
     const std::string _name;
     const int _min_threads;
     std::atomic<int> _max_threads;
@@ -379,6 +428,41 @@ private:
     // ExecutionMode::CONCURRENT token used by the pool for tokenless submission.
     std::unique_ptr<ThreadPoolToken> _tokenless;
 
+    // The queues of the tokenless tasks of a work stealing pool, one per thread
+    // up to the max_threads of the builder. Worker 'i' owns the queue 'i' modulo
+    // their number.
+    struct LocalQueue {
+        std::mutex lock;
+        PriorityQueue<NUM_PRIORITY, Task> tasks;
+    };
+    const bool _work_stealing;
+    std::vector<std::unique_ptr<LocalQueue>> _local_queues;
+
+    // Set before the pool is initialized and when it is shut down. Checked with
+    // the lock of the queue into which a task is submitted.
+    std::atomic<bool> _local_queues_closed{true};
+
+    // The tasks in the local queues, and the ones which are running. Updated
+    // without _lock, so that they are read by an idle worker, and by wait().
+    std::atomic<int> _local_queued_tasks{0};
+    std::atomic<int> _local_active_tasks{0};
+
+    // Mirrors of _idle_threads.size() and _num_threads + _num_threads_pending_start,
+    // for do_submit_local() to tell without _lock whether it needs to wake up
+    // or to create a thread.
+    std::atomic<int> _num_idle_threads{0};
+    std::atomic<int> _num_live_threads{0};
+
+    // The queue of the next task submitted by a thread which is not a worker.
+    std::atomic<uint32_t> _next_local_queue{0};
+
+    // The index of the next worker thread.
+    //
+    // Protected by _lock.
+    int _next_worker_index{0};
+
+    std::unique_ptr<bvar::LatencyRecorder> _queue_time_us;
+
     // Total number of tasks that have finished
     CoreLocalCounter<int64_t> _total_executed_tasks{MetricUnit::NOUNIT};
 
@@ -37,7 +37,9 @@
 
 #include <cctz/time_zone.h>
 
+#include <algorithm>
 #include <charconv>
+#include <limits>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -208,6 +210,43 @@ bool TimezoneUtils::find_cctz_time_zone(const TimezoneHsScan& timezone_hsscan, s
     }
 }
 
+static const cctz::civil_second kCivilEpoch(1970, 1, 1, 0, 0, 0);
+// 2400-01-01 00:00:00 UTC. cctz enumerates the transitions of a zone only up to some centuries after its
+// last rule change, so the later times are not cached.
+static constexpr int64_t kMaxCachedUnixSeconds = 13569465600L;
+
+void TimezoneOffsetCache::_load(int64_t unix_seconds) {
+    const cctz::time_point<cctz::seconds> tp(cctz::seconds{unix_seconds});
+    _offset = _ctz.lookup(tp).offset;
+    if (unix_seconds >= kMaxCachedUnixSeconds) {
+        _utc_begin = unix_seconds;
+        _utc_end = unix_seconds + 1;
+        _local_begin = _local_end = 0;
+        return;
+    }
+    _utc_begin = _local_begin = std::numeric_limits<int64_t>::min();
+    _utc_end = kMaxCachedUnixSeconds;
+    _local_end = kMaxCachedUnixSeconds + _offset;
+    cctz::time_zone::civil_transition trans;
+    // a transition at tp itself starts the range of tp
+    if (_ctz.prev_transition(tp + cctz::seconds{1}, &trans)) {
+        _utc_begin = _ctz.lookup(trans.to).trans.time_since_epoch().count();
+        // the civil times right after a backward jump are also those right before it
+        _local_begin = std::max(trans.from, trans.to) - kCivilEpoch;
+    }
+    if (_ctz.next_transition(tp, &trans)) {
+        _utc_end = std::min(_utc_end, _ctz.lookup(trans.to).trans.time_since_epoch().count());
+        // the civil times skipped by a forward jump have no unix time
+        _local_end = std::min(_local_end, trans.from - kCivilEpoch);
+    }
+}
+
+int64_t TimezoneOffsetCache::_local_to_utc_slow(int64_t civil_seconds) {
+    int64_t unix_seconds = cctz::convert(kCivilEpoch + civil_seconds, _ctz).time_since_epoch().count();
+    _load(unix_seconds);
+    return unix_seconds;
+}
+
 int64_t TimezoneUtils::to_utc_offset(const cctz::time_zone& ctz) {
     cctz::time_zone utc = cctz::utc_time_zone();
     const std::chrono::time_point<std::chrono::system_clock> tp;
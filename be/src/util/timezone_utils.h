@@ -38,6 +38,7 @@
 #include <re2/re2.h>
 
 #include <string_view>
+#include <utility>
 
 #include "cctz/time_zone.h"
 #include "types/date_value.h"
@@ -61,4 +62,40 @@ public:
 private:
     static bool _match_cctz_time_zone(std::string_view timezone, cctz::time_zone& ctz);
 };
+
+// Converts between unix seconds and the civil seconds of a time zone (the seconds since its
+// 1970-01-01 00:00:00) with the results of cctz::convert(). The UTC offset range of the last conversion
+// is cached, so converting sorted or clustered times costs an add instead of a time zone lookup.
+class TimezoneOffsetCache {
+public:
+    explicit TimezoneOffsetCache(cctz::time_zone ctz) : _ctz(std::move(ctz)) {}
+
+    int64_t utc_to_local(int64_t unix_seconds) {
+        if (unix_seconds < _utc_begin || unix_seconds >= _utc_end) {
+            _load(unix_seconds);
+        }
+        return unix_seconds + _offset;
+    }
+
+    // A repeated civil time gets the earlier unix time, and a skipped one the time of the transition.
+    int64_t local_to_utc(int64_t civil_seconds) {
+        if (civil_seconds >= _local_begin && civil_seconds < _local_end) {
+            return civil_seconds - _offset;
+        }
+        return _local_to_utc_slow(civil_seconds);
+    }
+
+private:
+    void _load(int64_t unix_seconds);
+    int64_t _local_to_utc_slow(int64_t civil_seconds);
+
+    cctz::time_zone _ctz;
+    int64_t _offset = 0;
+    // the unix seconds which have _offset, empty before the first load
+    int64_t _utc_begin = 0;
+    int64_t _utc_end = 0;
+    // the civil seconds which map back to the range above without ambiguity
+    int64_t _local_begin = 0;
+    int64_t _local_end = 0;
+};
 } // namespace starrocks
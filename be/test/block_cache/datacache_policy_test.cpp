@@ -0,0 +1,109 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "block_cache/datacache_policy.h"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+
+#include "common/config.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class DataCachePolicyTest : public ::testing::Test {
+protected:
+    void TearDown() override { config::datacache_column_policies = ""; }
+
+    static std::optional<DataCachePolicy::TagStats> _stats_of(const std::string& name) {
+        for (const auto& [tag, stats] : DataCachePolicy::instance()->tag_stats()) {
+            if (tag == name) {
+                return stats;
+            }
+        }
+        return std::nullopt;
+    }
+};
+
+TEST_F(DataCachePolicyTest, test_parse) {
+    ASSIGN_OR_ABORT(auto policies,
+                    DataCachePolicy::parse("db.t1:admission_ratio=0.2; db.t1.c1 : pinned=true ;db.t2:priority=-1"));
+    ASSERT_EQ(3, policies.size());
+    ASSERT_DOUBLE_EQ(0.2, policies["db.t1"].admission_ratio);
+    ASSERT_FALSE(policies["db.t1"].pinned);
+    ASSERT_TRUE(policies["db.t1.c1"].pinned);
+    ASSERT_EQ(-1, policies["db.t2"].priority);
+
+    ASSERT_FALSE(DataCachePolicy::parse("db.t1").ok());
+    ASSERT_FALSE(DataCachePolicy::parse("db.t1:admission_ratio=2").ok());
+    ASSERT_FALSE(DataCachePolicy::parse("db.t1:priority=high").ok());
+    ASSERT_FALSE(DataCachePolicy::parse("db.t1:pinned").ok());
+}
+
+TEST_F(DataCachePolicyTest, test_admit) {
+    config::datacache_column_policies = "db.t1:admission_ratio=0;db.t1.c1:pinned=true;db.t2:priority=-1";
+    auto* policy = DataCachePolicy::instance();
+    auto no_pressure = [] { return false; };
+    auto pressure = [] { return true; };
+
+    // The column policy overrides the table policy.
+    ASSERT_FALSE(policy->admit(DataCacheTag{"db.t1", "c2"}, "file/0", no_pressure));
+    ASSERT_TRUE(policy->admit(DataCacheTag{"db.t1", "c1"}, "file/0", pressure));
+    ASSERT_TRUE(policy->admit(DataCacheTag{"db.t2", "c1"}, "file/0", no_pressure));
+    ASSERT_FALSE(policy->admit(DataCacheTag{"db.t2", "c1"}, "file/0", pressure));
+    ASSERT_TRUE(policy->admit(DataCacheTag{"db.t3", ""}, "file/0", pressure));
+
+    // Invalid policies are ignored.
+    config::datacache_column_policies = "db.t1";
+    ASSERT_TRUE(policy->admit(DataCacheTag{"db.t1", "c2"}, "file/0", no_pressure));
+}
+
+TEST_F(DataCachePolicyTest, test_admission_ratio) {
+    config::datacache_column_policies = "db.ratio:admission_ratio=0.5";
+    auto* policy = DataCachePolicy::instance();
+    int admitted = 0;
+    for (int i = 0; i < 1000; i++) {
+        auto key = "file/" + std::to_string(i);
+        bool res = policy->admit(DataCacheTag{"db.ratio", ""}, key, [] { return false; });
+        // The same block is always admitted or rejected.
+        ASSERT_EQ(res, policy->admit(DataCacheTag{"db.ratio", ""}, key, [] { return false; }));
+        admitted += res;
+    }
+    ASSERT_GT(admitted, 350);
+    ASSERT_LT(admitted, 650);
+}
+
+TEST_F(DataCachePolicyTest, test_tag_stats) {
+    auto* policy = DataCachePolicy::instance();
+    DataCacheTag tag{"db.stats", "c1"};
+    policy->record_read(tag, true);
+    policy->record_read(tag, false);
+    policy->record_read(tag, true);
+    policy->record_write(tag, 100);
+    policy->record_read(DataCacheTag{"db.stats", ""}, false);
+
+    auto stats = _stats_of("db.stats.c1");
+    ASSERT_TRUE(stats.has_value());
+    ASSERT_EQ(2, stats->hit_count);
+    ASSERT_EQ(1, stats->miss_count);
+    ASSERT_EQ(1, stats->write_count);
+    ASSERT_EQ(100, stats->write_bytes);
+    stats = _stats_of("db.stats");
+    ASSERT_TRUE(stats.has_value());
+    ASSERT_EQ(1, stats->miss_count);
+}
+
+} // namespace starrocks
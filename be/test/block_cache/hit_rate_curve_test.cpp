@@ -0,0 +1,59 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/hit_rate_curve.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace starrocks {
+
+// NOLINTNEXTLINE
+TEST(HitRateCurveTest, test_cyclic_accesses) {
+    // An LRU cache hits the cyclic accesses of 1000 blocks only if it holds all of them.
+    HitRateCurve curve(1024, 1, 4096);
+    ASSERT_EQ(0, curve.hit_ratio(1024 * 1024));
+    for (int round = 0; round < 20; round++) {
+        for (uint64_t block = 0; block < 1000; block++) {
+            curve.record(block);
+        }
+    }
+    ASSERT_EQ(20000, curve.num_accesses());
+    ASSERT_EQ(0, curve.hit_ratio(500 * 1024));
+    ASSERT_NEAR(0.95, curve.hit_ratio(1001 * 1024), 0.001);
+    ASSERT_NEAR(0.95, curve.hit_ratio(2000 * 1024), 0.001);
+
+    curve.decay();
+    ASSERT_EQ(10000, curve.num_accesses());
+    ASSERT_NEAR(0.95, curve.hit_ratio(2000 * 1024), 0.001);
+}
+
+// NOLINTNEXTLINE
+TEST(HitRateCurveTest, test_sampled_uniform_accesses) {
+    // The hit ratio of the uniform accesses of 10000 blocks is proportional to the capacity, which is estimated by
+    // the sampled blocks.
+    HitRateCurve curve(1, 8, 4096);
+    std::mt19937_64 rand(0);
+    std::uniform_int_distribution<uint64_t> blocks(0, 9999);
+    for (int i = 0; i < 400000; i++) {
+        curve.record(blocks(rand));
+    }
+    ASSERT_NEAR(0.1, curve.hit_ratio(1000), 0.05);
+    ASSERT_NEAR(0.5, curve.hit_ratio(5000), 0.05);
+    ASSERT_NEAR(0.97, curve.hit_ratio(20000), 0.05);
+    ASSERT_LT(curve.hit_ratio(1000), curve.hit_ratio(5000));
+}
+
+} // namespace starrocks
@@ -443,4 +443,30 @@ TEST_F(ChunkTest, test_reset_with_extra_data) {
     ASSERT_TRUE(!chunk1->has_extra_data());
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_selection) {
+    // 0, 1, 2, 3, 4, 5
+    auto chunk = std::make_unique<Chunk>(make_columns(1, 6), make_schema(1));
+    chunk->set_selection(std::make_shared<Filter>(Filter{1, 1, 0, 1, 0, 1}));
+    ASSERT_TRUE(chunk->has_selection());
+    ASSERT_EQ(6, chunk->num_rows());
+
+    auto cloned = chunk->clone_unique();
+    ASSERT_TRUE(cloned->has_selection());
+
+    // filter() removes the rows filtered out by the selection as well.
+    Filter filter{0, 1, 1, 1, 1, 1};
+    ASSERT_EQ(3, chunk->filter(filter));
+    ASSERT_FALSE(chunk->has_selection());
+    check_column(reinterpret_cast<FixedLengthColumn<int32_t>*>(chunk->columns()[0].get()), {1, 3, 5});
+
+    ASSERT_EQ(4, cloned->compact_selection());
+    ASSERT_FALSE(cloned->has_selection());
+    check_column(reinterpret_cast<FixedLengthColumn<int32_t>*>(cloned->columns()[0].get()), {0, 1, 3, 5});
+
+    cloned->set_selection(std::make_shared<Filter>(Filter{1, 0, 1, 1}));
+    cloned->reset();
+    ASSERT_FALSE(cloned->has_selection());
+}
+
 } // namespace starrocks
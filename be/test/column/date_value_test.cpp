@@ -239,6 +239,19 @@ TEST(DateValueTest, cast) {
     ASSERT_EQ("2004-03-31 00:00:00", v.to_string());
 }
 
+TEST(DateValueTest, fromString) {
+    DateValue dv;
+    ASSERT_TRUE(dv.from_string("2023-07-09", 10));
+    ASSERT_EQ("2023-07-09", dv.to_string());
+    ASSERT_TRUE(dv.from_string("2023/07/09", 10));
+    ASSERT_EQ("2023-07-09", dv.to_string());
+    ASSERT_TRUE(dv.from_string("  2023-07-09 ", 13));
+    ASSERT_EQ("2023-07-09", dv.to_string());
+
+    ASSERT_FALSE(dv.from_string("2023-02-30", 10));
+    ASSERT_FALSE(dv.from_string("2023-13-09", 10));
+}
+
 TEST(DateValueTest, weekday) {
     DateValue dv;
     dv.from_date(2020, 5, 31);
@@ -21,6 +21,7 @@
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
 #include "exec/sorting/sorting.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks {
 
@@ -546,6 +547,47 @@ TEST(FixedLengthColumnTest, test_xor_checksum) {
     ASSERT_EQ(checksum, expected_checksum);
 }
 
+// NOLINTNEXTLINE
+TEST(FixedLengthColumnTest, test_crc32_hash) {
+    // The crc32 hash decides the buckets of the loaded rows, so it must keep the same as the zlib crc32.
+    auto check = [](const auto& column, auto&& bytes_of) {
+        std::vector<uint32_t> hashes(column->size(), 0x12345678u);
+        column->crc32_hash(hashes.data(), 1, column->size());
+        ASSERT_EQ(0x12345678u, hashes[0]);
+        for (size_t i = 1; i < column->size(); i++) {
+            std::string bytes = bytes_of(column->get_data()[i]);
+            ASSERT_EQ(HashUtil::zlib_crc_hash(bytes.data(), bytes.size(), 0x12345678u), hashes[i]);
+        }
+    };
+    auto raw_bytes = [](const auto& value) {
+        return std::string(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto to_string = [](const auto& value) { return value.to_string(); };
+
+    auto int8_column = Int8Column::create();
+    auto int16_column = Int16Column::create();
+    auto int64_column = Int64Column::create();
+    auto int128_column = Int128Column::create();
+    auto date_column = DateColumn::create();
+    auto timestamp_column = TimestampColumn::create();
+    for (int i = -50; i < 50; i++) {
+        int8_column->append(static_cast<int8_t>(i));
+        int16_column->append(static_cast<int16_t>(i * 997));
+        int64_column->append(i * 1000000007LL);
+        int128_column->append(static_cast<int128_t>(i) << 70);
+        int month = 1 + (i + 50) % 12;
+        int day = 1 + (i + 50) % 28;
+        date_column->append(DateValue::create(2000 + i, month, day));
+        timestamp_column->append(TimestampValue::create(2000 + i, month, day, 12, 30, 45, i % 2 == 0 ? 0 : 123456));
+    }
+    check(int8_column, raw_bytes);
+    check(int16_column, raw_bytes);
+    check(int64_column, raw_bytes);
+    check(int128_column, raw_bytes);
+    check(date_column, to_string);
+    check(timestamp_column, to_string);
+}
+
 TEST(FixedLengthColumnTest, test_compare_row) {
     auto column = FixedLengthColumn<int32_t>::create();
     for (int i = 0; i <= 100; i++) {
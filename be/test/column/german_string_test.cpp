@@ -0,0 +1,84 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "column/german_string.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "testutil/parallel_test.h"
+
+namespace starrocks {
+
+static int normalize(int x) {
+    return x < 0 ? -1 : (x > 0 ? 1 : 0);
+}
+
+PARALLEL_TEST(GermanStringTest, test_inline_and_long) {
+    std::string short_str = "CN";
+    std::string inline_str = "123456789012";
+    std::string long_str = "1234567890123";
+
+    GermanString empty;
+    ASSERT_EQ(0, empty.size());
+    ASSERT_EQ(Slice(), empty.to_slice());
+
+    GermanString s1{Slice(short_str)};
+    ASSERT_TRUE(s1.is_inline());
+    ASSERT_EQ(Slice(short_str), s1.to_slice());
+
+    GermanString s2{Slice(inline_str)};
+    ASSERT_TRUE(s2.is_inline());
+    ASSERT_NE(inline_str.data(), s2.data());
+    ASSERT_EQ(Slice(inline_str), s2.to_slice());
+
+    GermanString s3{Slice(long_str)};
+    ASSERT_FALSE(s3.is_inline());
+    ASSERT_EQ(long_str.data(), s3.data());
+    ASSERT_EQ(Slice(long_str), s3.to_slice());
+
+    ASSERT_EQ(-1, s2.compare(s3));
+    ASSERT_EQ(1, s3.compare(s2));
+    ASSERT_EQ(0, s3.compare(GermanString(Slice(std::string(long_str)))));
+    ASSERT_TRUE(s3 == GermanString(Slice(long_str)));
+    ASSERT_TRUE(s2 != s3);
+}
+
+PARALLEL_TEST(GermanStringTest, test_compare_as_slice) {
+    // Short strings over a small alphabet with '\0', so that many of them share prefixes or are prefixes of others.
+    std::mt19937 rng(42);
+    std::vector<std::string> values;
+    for (int i = 0; i < 300; i++) {
+        std::string value(rng() % 20, '\0');
+        for (auto& c : value) {
+            c = "\0ab\xff"[rng() % 4];
+        }
+        values.push_back(std::move(value));
+    }
+
+    for (const auto& lhs : values) {
+        for (const auto& rhs : values) {
+            GermanString gl{Slice(lhs)};
+            GermanString gr{Slice(rhs)};
+            int expected = normalize(Slice(lhs).compare(Slice(rhs)));
+            ASSERT_EQ(expected, gl.compare(gr)) << "lhs size " << lhs.size() << " rhs size " << rhs.size();
+            ASSERT_EQ(expected == 0, gl == gr);
+        }
+    }
+}
+
+} // namespace starrocks
@@ -21,6 +21,7 @@
 #include <future>
 #include <thread>
 
+#include "common/config.h"
 #include "connector/connector_chunk_sink.h"
 #include "exec/pipeline/fragment_context.h"
 #include "formats/file_writer.h"
@@ -230,6 +231,52 @@ TEST_F(HiveChunkSinkTest, test_partitioned_sink) {
     }
 }
 
+TEST_F(HiveChunkSinkTest, test_max_open_partition_writers) {
+    const int32_t old_max_open_writers = config::connector_sink_max_open_partition_writers;
+    config::connector_sink_max_open_partition_writers = 1;
+    DeferOp defer([&]() { config::connector_sink_max_open_partition_writers = old_max_open_writers; });
+
+    std::vector<std::string> partition_column_names = {"k1"};
+    std::vector<std::unique_ptr<ColumnEvaluator>> partition_column_evaluators =
+            ColumnSlotIdEvaluator::from_types({TypeDescriptor::from_logical_type(TYPE_VARCHAR)});
+    auto mock_file_writer_factory = std::make_unique<MockFileWriterFactory>();
+    EXPECT_CALL(*mock_file_writer_factory, init()).WillOnce(Return(Status::OK()));
+    std::vector<std::shared_ptr<MockFileWriter>> mock_file_writers;
+    for (int i = 0; i < 3; i++) {
+        auto mock_file_writer = std::make_shared<MockFileWriter>();
+        EXPECT_CALL(*mock_file_writer, init()).WillOnce(Return(Status::OK()));
+        EXPECT_CALL(*mock_file_writer, write(_)).WillOnce(Return(ByMove(make_ready_future(Status::OK()))));
+        EXPECT_CALL(*mock_file_writer, commit())
+                .WillOnce(Return(ByMove(make_ready_future(CommitResult{.io_status = Status::OK()}))));
+        mock_file_writers.emplace_back(std::move(mock_file_writer));
+    }
+    EXPECT_CALL(*mock_file_writer_factory, create(_))
+            .WillOnce(Return(ByMove(mock_file_writers[0])))
+            .WillOnce(Return(ByMove(mock_file_writers[1])))
+            .WillOnce(Return(ByMove(mock_file_writers[2])));
+    auto location_provider = std::make_unique<LocationProvider>("base_path", "ffffff", 0, 0, "parquet");
+    auto sink = std::make_unique<HiveChunkSink>(partition_column_names, std::move(partition_column_evaluators),
+                                                std::move(location_provider), std::move(mock_file_writer_factory),
+                                                100, _runtime_state);
+    EXPECT_OK(sink->init());
+
+    // the file of the previous partition is committed before the one of a new partition is opened
+    for (const auto& [partition, num_commits] : std::vector<std::pair<std::string, size_t>>{
+                 {"hello", 0}, {"world", 1}, {"hello", 1}}) {
+        auto chunk = std::make_shared<Chunk>();
+        auto partition_column = BinaryColumn::create();
+        partition_column->append(partition);
+        chunk->append_column(partition_column, 0);
+        auto futures = sink->add(chunk);
+        ASSERT_TRUE(futures.ok());
+        ASSERT_EQ(num_commits, futures.value().commit_file_futures.size());
+        ASSERT_EQ(1, futures.value().add_chunk_futures.size());
+        EXPECT_OK(futures.value().add_chunk_futures[0].get());
+    }
+
+    ASSERT_EQ(1, sink->finish().commit_file_futures.size());
+}
+
 TEST_F(HiveChunkSinkTest, test_callback) {
     {
         std::vector<std::string> partition_column_names = {"k1"};
@@ -17,6 +17,8 @@
 #include <gtest/gtest.h>
 
 #include <any>
+#include <set>
+#include <string>
 
 #include "column/column_helper.h"
 #include "column/datum.h"
@@ -101,6 +103,35 @@ TEST(HashMapTest, Basic) {
     }
 }
 
+TEST(HashMapTest, Int16DirectMapping) {
+    Int16AggHashMap<PhmapSeed1> hash_map;
+    MemPool pool;
+    const std::vector<int16_t> keys = {-32768, -1, 0, 7, 32767, 7, -1};
+    std::set<AggDataPtr> states;
+    for (int16_t key : keys) {
+        auto iter = hash_map.lazy_emplace(key, [&](const auto& ctor) { ctor(key, pool.allocate(16)); });
+        states.insert(iter->second);
+    }
+    ASSERT_EQ(5, hash_map.size());
+    ASSERT_EQ(5, states.size());
+    ASSERT_TRUE(hash_map.find(3) == hash_map.end());
+    ASSERT_TRUE(hash_map.find(-32768) != hash_map.end());
+
+    std::set<int16_t> result;
+    for (auto iter = hash_map.begin(); iter != hash_map.end(); ++iter) {
+        result.insert(iter->first);
+    }
+    ASSERT_EQ(std::set<int16_t>(keys.begin(), keys.end()), result);
+
+    Int16AggHashSet<PhmapSeed1> hash_set;
+    for (int16_t key : keys) {
+        hash_set.emplace(key);
+    }
+    ASSERT_EQ(5, hash_set.size());
+    ASSERT_TRUE(hash_set.contains(-1));
+    ASSERT_FALSE(hash_set.contains(1));
+}
+
 TEST(HashMapTest, Insert) {
     // Test AggHashMapWithSerializedKeyFixedSize
     {
@@ -111,7 +142,8 @@ TEST(HashMapTest, Insert) {
         AggStatistics statis(&profile);
         TestAggHashMapKey key(chunk_size, &statis);
         key.has_null_column = true;
-        key.fixed_byte_size = 8;
+        key.fixed_byte_size = 9;
+        key.key_byte_sizes = {4, 4};
         MemPool pool;
         // chunk size
         // key columns
@@ -154,6 +186,69 @@ TEST(HashMapTest, Insert) {
     }
 }
 
+// Three nullable ints and a nullable smallint take 15 bytes with a null bitmap, and fit in a fixed size 16 key.
+TEST(HashMapTest, InsertNullableFixedSizeKeys) {
+    const int chunk_size = 64;
+    using TestAggHashMap = FixedSize16SliceAggHashMap<PhmapSeed1>;
+    using TestAggHashMapKey = AggHashMapWithSerializedKeyFixedSize<TestAggHashMap>;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+    TestAggHashMapKey key(chunk_size, &statis);
+    key.has_null_column = true;
+    key.fixed_byte_size = 15;
+    key.key_byte_sizes = {4, 4, 4, 2};
+    MemPool pool;
+
+    const std::vector<LogicalType> types = {TYPE_INT, TYPE_INT, TYPE_INT, TYPE_SMALLINT};
+    auto create_columns = [&]() {
+        Columns columns;
+        for (auto type : types) {
+            columns.emplace_back(ColumnHelper::create_column(TypeDescriptor(type), true));
+        }
+        return columns;
+    };
+    // the rows (i % 3, null or 7, i % 2, null or i % 5), 30 distinct keys
+    Columns key_columns = create_columns();
+    const int num_rows = 60;
+    for (int i = 0; i < num_rows; ++i) {
+        key_columns[0]->append_datum(Datum(int32_t(i % 3)));
+        key_columns[1]->append_datum(i % 2 ? Datum() : Datum(int32_t(7)));
+        key_columns[2]->append_datum(Datum(int32_t(i % 2)));
+        key_columns[3]->append_datum(i % 5 == 4 ? Datum() : Datum(int16_t(i % 5)));
+    }
+    // the data under a null must not make a different key
+    down_cast<Int32Column*>(down_cast<NullableColumn*>(key_columns[1].get())->data_column().get())
+            ->get_data()[1] = 100;
+
+    Buffer<AggDataPtr> agg_states(num_rows);
+    auto allocate_func = [&pool](auto& key) { return pool.allocate(16); };
+    key.build_hash_map(num_rows, key_columns, &pool, allocate_func, &agg_states);
+    ASSERT_EQ(30, key.hash_map.size());
+    for (int i = 0; i < num_rows; ++i) {
+        ASSERT_EQ(agg_states[i % 30], agg_states[i]);
+    }
+
+    std::vector<TestAggHashMap::key_type> resv;
+    for (auto [key, _] : key.hash_map) {
+        resv.emplace_back(key);
+    }
+    Columns res_columns = create_columns();
+    key.insert_keys_to_columns(resv, res_columns, resv.size());
+    std::set<std::string> expected;
+    std::set<std::string> actual;
+    for (int i = 0; i < 30; ++i) {
+        std::string row;
+        std::string res_row;
+        for (size_t j = 0; j < types.size(); ++j) {
+            row += key_columns[j]->debug_item(i) + ",";
+            res_row += res_columns[j]->debug_item(i) + ",";
+        }
+        expected.insert(row);
+        actual.insert(res_row);
+    }
+    ASSERT_EQ(expected, actual);
+}
+
 TEST(HashMapTest, TwoLevelConvert) {
     std::vector<std::string> keys(1000);
     for (int i = 0; i < 1000; i++) {
@@ -175,6 +270,38 @@ TEST(HashMapTest, TwoLevelConvert) {
     }
 }
 
+TEST(HashMapTest, NumberKeyVariantConvertToTwoLevel) {
+    RuntimeState dummy;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+
+    std::vector<int64_t> values(1000);
+    AggHashMapVariant variant;
+    variant.init(&dummy, AggHashMapVariant::Type::phase2_int64, &statis);
+    variant.visit([&](auto& hash_map_with_key) {
+        if constexpr (std::is_same_v<typename decltype(hash_map_with_key->hash_map)::key_type, int64_t>) {
+            for (int64_t i = 0; i < 1000; i++) {
+                hash_map_with_key->hash_map.emplace(i * 7, (AggDataPtr)&values[i]);
+            }
+        }
+    });
+    ASSERT_EQ(1000, variant.size());
+
+    variant.convert_to_two_level(&dummy);
+    ASSERT_EQ(1000, variant.size());
+    variant.visit([&](auto& hash_map_with_key) {
+        using HashMapWithKey = std::decay_t<decltype(*hash_map_with_key)>;
+        ASSERT_TRUE((std::is_same_v<HashMapWithKey, Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>));
+        if constexpr (std::is_same_v<typename decltype(hash_map_with_key->hash_map)::key_type, int64_t>) {
+            for (int64_t i = 0; i < 1000; i++) {
+                auto iter = hash_map_with_key->hash_map.find(i * 7);
+                ASSERT_TRUE(iter != hash_map_with_key->hash_map.end());
+                ASSERT_EQ((AggDataPtr)&values[i], iter->second);
+            }
+        }
+    });
+}
+
 class AggHashMapKeyNotFoundsTest : public ::testing::Test {
 public:
     template <typename HashMapWithKey>
@@ -223,8 +350,9 @@ public:
         // For fixed size key, need set key's fixed size
         if constexpr (std::is_same_v<TestAggHashMapKey,
                                      AggHashMapWithSerializedKeyFixedSize<FixedSize16SliceAggHashMap<PhmapSeed1>>>) {
-            key.fixed_byte_size = sizeof(CppType);
+            key.fixed_byte_size = sizeof(CppType) + nullable;
             key.has_null_column = nullable;
+            key.key_byte_sizes = {sizeof(CppType)};
         }
 
         {
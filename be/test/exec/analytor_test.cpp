@@ -16,7 +16,21 @@
 
 #include <gtest/gtest.h>
 
+#include <optional>
+#include <random>
+
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/spill/dir_manager.h"
+#include "exec/spill/log_block_manager.h"
+#include "exec/spill/options.h"
+#include "exec/spill/spiller.h"
+#include "exec/spill/spiller_factory.h"
+#include "fs/fs.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/uid_util.h"
 
 namespace starrocks {
 class AnalytorTest : public ::testing::Test {
@@ -126,4 +140,165 @@ TEST_F(AnalytorTest, find_partition_end) {
     ASSERT_EQ(analytor3._partition.end, 0);
 }
 
+
+// NOLINTNEXTLINE
+TEST_F(AnalytorTest, sliding_frame_extreme) {
+    constexpr int64_t N = 1000;
+    // The rows before `base` have been removed from the buffer.
+    constexpr int64_t base = 100;
+    std::mt19937 rng(42);
+    auto data = Int32Column::create();
+    auto nulls = NullColumn::create();
+    for (int64_t i = 0; i < N; i++) {
+        data->append(static_cast<int32_t>(rng() % 50));
+        nulls->append(rng() % 10 == 0);
+    }
+    auto column = NullableColumn::create(data, nulls);
+
+    // ROWS BETWEEN 7 PRECEDING AND 2 FOLLOWING, and ROWS BETWEEN 3 PRECEDING AND 1 PRECEDING
+    for (auto [start_offset, end_offset] : {std::pair<int64_t, int64_t>{-7, 2}, {-3, -1}}) {
+        for (bool is_max : {true, false}) {
+            SlidingFrameExtreme extreme(is_max);
+            for (int64_t current = base; current < base + N; current++) {
+                const int64_t frame_start = std::max(base, current + start_offset);
+                const int64_t frame_end = std::min(base + N, current + end_offset + 1);
+                extreme.slide(column.get(), base, frame_start, std::max(frame_start, frame_end));
+
+                std::optional<int32_t> expected;
+                for (int64_t p = frame_start; p < frame_end; p++) {
+                    if (!nulls->get_data()[p - base]) {
+                        const int32_t v = data->get_data()[p - base];
+                        expected = !expected ? v : (is_max ? std::max(*expected, v) : std::min(*expected, v));
+                    }
+                }
+                const int64_t position = extreme.extreme_position();
+                if (!expected) {
+                    ASSERT_EQ(-1, position) << current;
+                } else {
+                    ASSERT_GE(position, frame_start);
+                    ASSERT_LT(position, frame_end);
+                    ASSERT_EQ(*expected, data->get_data()[position - base]) << current;
+                }
+            }
+        }
+    }
+}
+
+class AnalytorSpillTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        const TUniqueId query_id = generate_uuid();
+        const auto path = config::storage_root_path + "/analytor_spill_test/" + print_id(query_id);
+        ASSERT_OK(FileSystem::Default()->create_dir_recursive(path));
+        _dir_mgr = std::make_unique<spill::DirManager>();
+        ASSERT_OK(_dir_mgr->init(path));
+        _block_mgr = std::make_unique<spill::LogBlockManager>(query_id, _dir_mgr.get());
+        _query_ctx = std::make_shared<pipeline::QueryContext>();
+        _state.set_query_ctx(_query_ctx.get());
+        _state.set_chunk_size(config::vector_chunk_size);
+
+        _spill_options.mem_table_pool_size = 2;
+        _spill_options.spill_mem_table_bytes_size = 1024 * 1024;
+        _spill_options.spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+        _spill_options.block_manager = _block_mgr.get();
+        _spill_options.name = "analytor-spill-test";
+        _spill_metrics = spill::SpillProcessMetrics(&_profile, &_spill_bytes);
+    }
+
+protected:
+    static constexpr int kNumChunks = 6;
+    static constexpr int kRowsPerChunk = 100;
+
+    // The second column of the chunks [2, 4) is nullable, so they are spilled by another spiller.
+    static ChunkPtr make_chunk(int index) {
+        auto c0 = Int32Column::create();
+        auto c1 = Int32Column::create();
+        for (int i = 0; i < kRowsPerChunk; i++) {
+            c0->append(index * kRowsPerChunk + i);
+            c1->append(i % 7);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(c0), 0);
+        if (index == 2 || index == 3) {
+            auto nulls = NullColumn::create(kRowsPerChunk, 0);
+            nulls->get_data()[index] = 1;
+            chunk->append_column(NullableColumn::create(std::move(c1), std::move(nulls)), 1);
+        } else {
+            chunk->append_column(std::move(c1), 1);
+        }
+        return chunk;
+    }
+
+    // Outputs two chunks after the first four chunks are added, and the others after all chunks are added.
+    // If |spill| is true, the chunks not output yet are spilled after the chunks are added each time.
+    void run(bool spill, std::vector<ChunkPtr>* outputs) {
+        TPlanNode tnode;
+        RowDescriptor row_desc;
+        RuntimeProfile profile("analytor");
+        Analytor analytor(tnode, row_desc, nullptr, false);
+        analytor._state = &_state;
+        analytor._limit = -1;
+        analytor._peak_buffered_rows = ADD_PEAK_COUNTER(&profile, "PeakBufferedRows", TUnit::UNIT);
+        analytor._column_resize_timer = ADD_TIMER(&profile, "ColumnResizeTime");
+
+        auto add_chunks_and_output = [&](int begin, int end, int num_outputs) {
+            for (int i = begin; i < end; i++) {
+                ASSERT_OK(analytor._add_chunk(make_chunk(i)));
+            }
+            if (spill) {
+                ASSERT_OK(analytor.spill_buffered_chunks(_spill_factory, _spill_options, _spill_metrics));
+                // Only the chunk to output next stays in memory.
+                ASSERT_EQ(analytor._input_chunks[analytor._output_chunk_index]->bytes_usage(),
+                          analytor.spillable_bytes());
+            }
+            for (int i = 0; i < num_outputs; i++) {
+                ASSERT_TRUE(analytor._has_output());
+                ChunkPtr chunk;
+                ASSERT_OK(analytor._output_result_chunk(&chunk));
+                outputs->push_back(std::move(chunk));
+            }
+        };
+        ASSERT_NO_FATAL_FAILURE(add_chunks_and_output(0, 4, 2));
+        ASSERT_NO_FATAL_FAILURE(add_chunks_and_output(4, kNumChunks, kNumChunks - 2));
+        ASSERT_FALSE(analytor._has_output());
+        ASSERT_EQ(0, analytor.spillable_bytes());
+    }
+
+    std::unique_ptr<spill::DirManager> _dir_mgr;
+    std::unique_ptr<spill::LogBlockManager> _block_mgr;
+    std::shared_ptr<pipeline::QueryContext> _query_ctx;
+    RuntimeState _state;
+    RuntimeProfile _profile{"spill"};
+    std::atomic_int64_t _spill_bytes = 0;
+    spill::SpilledOptions _spill_options;
+    spill::SpillProcessMetrics _spill_metrics;
+    std::shared_ptr<spill::SpillerFactory> _spill_factory = std::make_shared<spill::SpillerFactory>();
+};
+
+// NOLINTNEXTLINE
+TEST_F(AnalytorSpillTest, restore_spilled_chunks) {
+    std::vector<ChunkPtr> expected;
+    ASSERT_NO_FATAL_FAILURE(run(false, &expected));
+    std::vector<ChunkPtr> actual;
+    ASSERT_NO_FATAL_FAILURE(run(true, &actual));
+
+    // All chunks except the first one are spilled, and the chunks spilled again are only the ones added after.
+    ASSERT_EQ((kNumChunks - 1) * kRowsPerChunk, _spill_metrics.spill_rows->value());
+    ASSERT_EQ((kNumChunks - 1) * kRowsPerChunk, _spill_metrics.restore_rows->value());
+
+    ASSERT_EQ(kNumChunks, expected.size());
+    ASSERT_EQ(kNumChunks, actual.size());
+    for (int i = 0; i < kNumChunks; i++) {
+        ASSERT_EQ(expected[i]->num_rows(), actual[i]->num_rows()) << i;
+        ASSERT_EQ(expected[i]->get_slot_id_to_index_map(), actual[i]->get_slot_id_to_index_map()) << i;
+        for (size_t j = 0; j < expected[i]->num_columns(); j++) {
+            ASSERT_EQ(expected[i]->get_column_by_index(j)->is_nullable(),
+                      actual[i]->get_column_by_index(j)->is_nullable());
+        }
+        for (size_t row = 0; row < expected[i]->num_rows(); row++) {
+            ASSERT_EQ(expected[i]->debug_row(row), actual[i]->debug_row(row)) << i << ":" << row;
+        }
+    }
+}
+
 } // namespace starrocks
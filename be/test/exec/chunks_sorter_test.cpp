@@ -20,8 +20,10 @@
 
 #include <cstdio>
 #include <memory>
+#include <random>
 #include <string_view>
 
+#include "column/binary_column.h"
 #include "column/column_helper.h"
 #include "column/datum.h"
 #include "column/datum_tuple.h"
@@ -30,6 +32,7 @@
 #include "common/object_pool.h"
 #include "exec/chunks_sorter_full_sort.h"
 #include "exec/chunks_sorter_topn.h"
+#include "exec/pipeline/sort/local_partition_topn_context.h"
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
@@ -855,6 +858,92 @@ TEST_F(ChunksSorterTest, stable_sort) {
     ASSERT_EQ(expect, result);
 }
 
+TEST_F(ChunksSorterTest, stable_radix_sort_encoded_keys) {
+    // Keys of few distinct bytes sharing long prefixes, with duplicates and keys being prefixes of others.
+    constexpr int N = 5000;
+    std::mt19937 rng(42);
+    BinaryColumn keys;
+    for (int i = 0; i < N; i++) {
+        std::string key(rng() % 3 == 0 ? 20 : 0, 'p');
+        const int len = rng() % 6;
+        for (int j = 0; j < len; j++) {
+            key.push_back(static_cast<char>(rng() % 3 == 0 ? 0xff : rng() % 3));
+        }
+        keys.append(Slice(key));
+    }
+
+    SmallPermutation perm = create_small_permutation(N);
+    ASSERT_OK(stable_radix_sort_encoded_keys(false, keys, &perm));
+    SmallPermutation expect = create_small_permutation(N);
+    std::stable_sort(expect.begin(), expect.end(), [&](SmallPermuteItem lhs, SmallPermuteItem rhs) {
+        return keys.get_slice(lhs.index_in_chunk).compare(keys.get_slice(rhs.index_in_chunk)) < 0;
+    });
+    ASSERT_EQ(expect, perm);
+
+    std::atomic<bool> cancel{true};
+    ASSERT_TRUE(stable_radix_sort_encoded_keys(cancel, keys, &perm).is_cancelled());
+}
+
+TEST_F(ChunksSorterTest, sort_by_normalized_key) {
+    // Few distinct values with nulls, so that the rows tie on the keys and are sorted by the remaining columns.
+    constexpr int N = 5000;
+    std::mt19937 rng(42);
+    auto random_column = [&](LogicalType type, bool nullable) {
+        TypeDescriptor type_desc = type == TYPE_VARCHAR ? TypeDescriptor::create_varchar_type(32) : TypeDescriptor(type);
+        ColumnPtr column = ColumnHelper::create_column(type_desc, nullable);
+        for (int i = 0; i < N; i++) {
+            const int64_t value = static_cast<int64_t>(rng() % 7) - 3;
+            if (nullable && value == 0) {
+                column->append_nulls(1);
+            } else if (type == TYPE_TINYINT) {
+                column->append_datum(Datum(static_cast<int8_t>(value)));
+            } else if (type == TYPE_SMALLINT) {
+                column->append_datum(Datum(static_cast<int16_t>(value * 1000)));
+            } else if (type == TYPE_INT) {
+                column->append_datum(Datum(static_cast<int32_t>(value * 100000)));
+            } else if (type == TYPE_BIGINT) {
+                column->append_datum(Datum(value * (int64_t(1) << 40)));
+            } else {
+                // Strings sharing a long prefix, some being prefixes of the others.
+                std::string str(rng() % 2 == 0 ? 10 : 0, 'p');
+                str.append(rng() % 3, static_cast<char>('a' + value + 3));
+                column->append_datum(Datum(Slice(str)));
+            }
+        }
+        return column;
+    };
+
+    // An exact key of integers, and a key truncated in a string column.
+    std::vector<std::vector<LogicalType>> cases = {{TYPE_INT, TYPE_TINYINT, TYPE_SMALLINT},
+                                                   {TYPE_BIGINT, TYPE_VARCHAR, TYPE_INT, TYPE_TINYINT}};
+    for (const auto& types : cases) {
+        Columns columns;
+        std::vector<int> orders;
+        std::vector<int> null_firsts;
+        for (size_t i = 0; i < types.size(); i++) {
+            columns.push_back(random_column(types[i], i % 2 == 0));
+            orders.push_back(i % 3 == 1 ? -1 : 1);
+            null_firsts.push_back(i % 4 == 2 ? 1 : -1);
+        }
+        SortDescs sort_desc(orders, null_firsts);
+
+        Permutation perm;
+        ASSERT_OK(sort_and_tie_columns_by_normalized_key(false, columns, sort_desc, &perm));
+        Permutation expect;
+        ASSERT_OK(sort_and_tie_columns(false, columns, sort_desc, &expect));
+
+        // The order of the equal rows is not defined, so compare the values.
+        ASSERT_EQ(expect.size(), perm.size());
+        for (size_t i = 0; i < perm.size(); i++) {
+            for (size_t c = 0; c < columns.size(); c++) {
+                ASSERT_EQ(0, columns[c]->compare_at(perm[i].index_in_chunk, expect[i].index_in_chunk, *columns[c],
+                                                    sort_desc.get_column_desc(c).nan_direction()))
+                        << "row " << i << " column " << c;
+            }
+        }
+    }
+}
+
 void pack_nullable(const ChunkPtr& chunk) {
     for (auto& col : chunk->columns()) {
         col = std::make_shared<NullableColumn>(col, std::make_shared<NullColumn>(col->size()));
@@ -1169,4 +1258,42 @@ TEST_F(ChunksSorterTest, test_nan) {
     ::pdqsort(begin, end, greater);
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunksSorterTest, partition_topn_rows) {
+    std::vector<ExprContext*> sort_exprs{new ExprContext(_expr_ranking_key.get())};
+    ASSERT_OK(Expr::prepare(sort_exprs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, _runtime_state.get()));
+    const SortDescs sort_descs(std::vector<bool>{true}, std::vector<bool>{true});
+    constexpr size_t kLimit = 5;
+
+    std::mt19937 rng(42);
+    std::vector<int32_t> all_values;
+    pipeline::PartitionTopnRows topn_rows;
+    size_t num_dropped = 0;
+    for (int batch = 0; batch < 20; batch++) {
+        std::vector<int32_t> values(1 + rng() % 16);
+        for (auto& value : values) {
+            value = rng() % 100;
+        }
+        all_values.insert(all_values.end(), values.begin(), values.end());
+        Chunk::SlotHashMap map{{0, 0}};
+        auto chunk = std::make_shared<Chunk>(Columns{make_int32_column(values)}, map);
+        ASSIGN_OR_ABORT(auto dropped, topn_rows.add(_runtime_state.get(), sort_exprs, sort_descs, kLimit, chunk));
+        num_dropped += dropped;
+    }
+    EXPECT_GT(num_dropped, 0);
+
+    std::sort(all_values.begin(), all_values.end());
+    all_values.resize(kLimit);
+    const auto& rows = topn_rows.rows();
+    ASSERT_EQ(kLimit, rows->num_rows());
+    std::vector<int32_t> result;
+    for (size_t i = 0; i < rows->num_rows(); i++) {
+        result.push_back(rows->get(i).get(0).get_int32());
+    }
+    EXPECT_EQ(all_values, result);
+
+    clear_sort_exprs(sort_exprs);
+}
+
 } // namespace starrocks
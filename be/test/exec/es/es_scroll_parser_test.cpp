@@ -79,6 +79,54 @@ TupleDescriptor* ScrollParserTest::_create_tuple_desc(SlotDesc* descs) {
     return tuple_desc;
 }
 
+TEST_F(ScrollParserTest, FillChunkTest) {
+    {
+        SlotDesc slot_descs[] = {{"_id", TypeDescriptor::create_varchar_type(20)},
+                                 {"k", TypeDescriptor(TYPE_INT)},
+                                 {""}};
+        auto* tuple_desc = _create_tuple_desc(slot_descs);
+        ScrollParser scroll_parser(false);
+        ASSERT_TRUE(scroll_parser
+                            .parse(R"({"_scroll_id":"s1","hits":{"total":3,"hits":[)"
+                                   R"({"_id":"a","_source":{"k":1}},{"_id":"b","_source":{"x":2}},{"_id":"c"}]}})")
+                            .ok());
+        ASSERT_EQ(3, scroll_parser.get_size());
+        std::map<std::string, std::string> docvalue_context;
+        scroll_parser.set_params(tuple_desc, &docvalue_context, "");
+
+        ChunkPtr chunk;
+        bool eos = false;
+        ASSERT_TRUE(scroll_parser.fill_chunk(_runtime_state, &chunk, &eos).ok());
+        ASSERT_FALSE(eos);
+        ASSERT_EQ(3, chunk->num_rows());
+        ASSERT_EQ("['a', 1]", chunk->debug_row(0));
+        // a missing field and a hit without `_source` are nulls
+        ASSERT_EQ("['b', NULL]", chunk->debug_row(1));
+        ASSERT_EQ("[NULL, NULL]", chunk->debug_row(2));
+        ASSERT_TRUE(scroll_parser.fill_chunk(_runtime_state, &chunk, &eos).ok());
+        ASSERT_TRUE(eos);
+    }
+
+    {
+        SlotDesc slot_descs[] = {{"k", TypeDescriptor(TYPE_INT)}, {"v", TypeDescriptor(TYPE_INT)}, {""}};
+        auto* tuple_desc = _create_tuple_desc(slot_descs);
+        ScrollParser scroll_parser(true);
+        ASSERT_TRUE(scroll_parser
+                            .parse(R"({"_scroll_id":"s1","hits":{"total":2,"hits":[)"
+                                   R"({"fields":{"k":[1],"v.raw":[2]}},{"fields":{"k":[3],"v.raw":[]}}]}})")
+                            .ok());
+        std::map<std::string, std::string> docvalue_context{{"k", "k"}, {"v", "v.raw"}};
+        scroll_parser.set_params(tuple_desc, &docvalue_context, "");
+
+        ChunkPtr chunk;
+        bool eos = false;
+        ASSERT_TRUE(scroll_parser.fill_chunk(_runtime_state, &chunk, &eos).ok());
+        ASSERT_EQ(2, chunk->num_rows());
+        ASSERT_EQ("[1, 2]", chunk->debug_row(0));
+        ASSERT_EQ("[3, NULL]", chunk->debug_row(1));
+    }
+}
+
 TEST_F(ScrollParserTest, ArrayTest) {
     std::unique_ptr<ScrollParser> scroll_parser = std::make_unique<ScrollParser>(false);
 
@@ -0,0 +1,52 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/exchange_node.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+// NOLINTNEXTLINE
+TEST(ExchangeNodeTest, parallel_merge_of_many_senders_off) {
+    const int32_t old_min_senders = config::exchange_parallel_merge_min_senders;
+    DeferOp defer([&]() { config::exchange_parallel_merge_min_senders = old_min_senders; });
+    config::exchange_parallel_merge_min_senders = 0;
+
+    // the plan decides.
+    ASSERT_FALSE(ExchangeNode::use_parallel_merge(false, false, 1024, 8));
+    ASSERT_TRUE(ExchangeNode::use_parallel_merge(true, false, 1024, 8));
+    ASSERT_TRUE(ExchangeNode::use_parallel_merge(false, true, 1024, 8));
+}
+
+// NOLINTNEXTLINE
+TEST(ExchangeNodeTest, parallel_merge_of_many_senders_on) {
+    const int32_t old_min_senders = config::exchange_parallel_merge_min_senders;
+    DeferOp defer([&]() { config::exchange_parallel_merge_min_senders = old_min_senders; });
+    config::exchange_parallel_merge_min_senders = 64;
+
+    ASSERT_TRUE(ExchangeNode::use_parallel_merge(false, false, 64, 8));
+    ASSERT_TRUE(ExchangeNode::use_parallel_merge(false, false, 1024, 2));
+    // too few senders.
+    ASSERT_FALSE(ExchangeNode::use_parallel_merge(false, false, 63, 8));
+    // nothing to merge in parallel with a single driver.
+    ASSERT_FALSE(ExchangeNode::use_parallel_merge(false, false, 1024, 1));
+    // the plan still forces it.
+    ASSERT_TRUE(ExchangeNode::use_parallel_merge(true, false, 1, 1));
+}
+
+} // namespace starrocks
@@ -51,6 +51,14 @@ protected:
     std::string _parquet_data_path = "parquet_data_file.parquet";
 
     std::set<int64_t> _need_skip_rowids;
+
+    // the rows of the data file deleted by the delete file, read without the cache
+    std::set<int64_t> _need_skip_rowids_of_data_file() {
+        std::set<int64_t> rowids;
+        ParquetPositionDeleteBuilder builder(FileSystem::Default(), _parquet_data_path);
+        EXPECT_OK(builder.build(TQueryGlobals().time_zone, _parquet_delete_path, 845, &rowids));
+        return rowids;
+    }
 };
 
 TEST_F(IcebergDeleteBuilderTest, TestParquetBuilder) {
@@ -60,4 +68,54 @@ TEST_F(IcebergDeleteBuilderTest, TestParquetBuilder) {
     ASSERT_EQ(1, _need_skip_rowids.size());
 }
 
+TEST_F(IcebergDeleteBuilderTest, TestParquetBuilderWithCache) {
+    IcebergDeleteCache cache(nullptr);
+    TIcebergDeleteFile delete_file;
+    delete_file.__set_full_path(_parquet_delete_path);
+    delete_file.__set_length(845);
+    delete_file.__set_file_content(TIcebergFileContent::POSITION_DELETES);
+
+    // the scanners of two splits of the data file share the delete file read by the first one
+    for (int i = 0; i < 2; i++) {
+        std::set<int64_t> need_skip_rowids;
+        IcebergDeleteBuilder builder(FileSystem::Default(), _parquet_data_path, {}, {}, &need_skip_rowids, &cache);
+        ASSERT_OK(builder.build_parquet(TQueryGlobals().time_zone, delete_file, {}, nullptr, nullptr, nullptr,
+                                        nullptr));
+        ASSERT_EQ(_need_skip_rowids_of_data_file(), need_skip_rowids);
+        ASSERT_EQ(1, cache.num_loaded());
+    }
+
+    // a data file which has no deleted rows
+    std::set<int64_t> need_skip_rowids;
+    IcebergDeleteBuilder builder(FileSystem::Default(), "other_data_file.parquet", {}, {}, &need_skip_rowids, &cache);
+    ASSERT_OK(builder.build_parquet(TQueryGlobals().time_zone, delete_file, {}, nullptr, nullptr, nullptr, nullptr));
+    ASSERT_TRUE(need_skip_rowids.empty());
+    ASSERT_EQ(1, cache.num_loaded());
+}
+
+TEST_F(IcebergDeleteBuilderTest, TestDeleteCacheLoadOnce) {
+    IcebergDeleteCache cache(nullptr);
+    int loads = 0;
+    auto loader = [&](IcebergPositionDeletes* positions) {
+        loads++;
+        (*positions)["a"] = {1, 2};
+        return Status::OK();
+    };
+    for (int i = 0; i < 2; i++) {
+        ASSIGN_OR_ABORT(auto positions, cache.get_position_deletes("delete_file", loader));
+        ASSERT_EQ(std::vector<int64_t>({1, 2}), positions->at("a"));
+    }
+    ASSERT_EQ(1, loads);
+
+    // a failed load is not retried
+    auto failed_loader = [&](std::vector<ChunkPtr>*) {
+        loads++;
+        return Status::IOError("injected");
+    };
+    ASSERT_FALSE(cache.get_equality_deletes("delete_file#1", failed_loader).ok());
+    ASSERT_FALSE(cache.get_equality_deletes("delete_file#1", failed_loader).ok());
+    ASSERT_EQ(2, loads);
+    ASSERT_EQ(2, cache.num_loaded());
+}
+
 } // namespace starrocks
\ No newline at end of file
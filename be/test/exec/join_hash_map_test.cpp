@@ -20,6 +20,8 @@
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
 #include "testutil/assert.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 class JoinHashMapTest : public ::testing::Test {
@@ -1126,6 +1128,83 @@ TEST_F(JoinHashMapTest, JoinBuildProbeFuncNullable) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, JoinBuildProbeFuncRadixPartition) {
+    const uint32_t build_row_count = 300000;
+    const uint32_t probe_row_count = 4000;
+
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_INT);
+    auto build_column = ColumnHelper::create_column(type, true);
+    build_column->append_default();
+    build_column->append(*JoinHashMapTest::create_int32_nullable_column(build_row_count, 0), 0, build_row_count);
+    auto probe_column = JoinHashMapTest::create_int32_nullable_column(probe_row_count, 0);
+    Columns probe_columns{probe_column};
+
+    std::unique_ptr<ThreadPool> build_pool;
+    ASSERT_OK(ThreadPoolBuilder("hash_join_build_test").set_max_threads(3).build(&build_pool));
+
+    auto build_and_probe = [&](uint32_t radix_partition_min_rows, uint32_t parallel_build_dop,
+                               JoinHashTableItems* table_items, HashTableProbeState* probe_state) {
+        table_items->key_columns.emplace_back(build_column);
+        table_items->row_count = build_row_count;
+        table_items->radix_partition_min_rows = radix_partition_min_rows;
+        table_items->parallel_build_dop = parallel_build_dop;
+        table_items->build_pool = build_pool.get();
+        probe_state->probe_row_count = probe_row_count;
+        probe_state->buckets.resize(config::vector_chunk_size);
+        probe_state->next.resize(config::vector_chunk_size, 0);
+        probe_state->key_columns = &probe_columns;
+
+        JoinBuildFunc<TYPE_INT>::prepare(nullptr, table_items);
+        JoinProbeFunc<TYPE_INT>::prepare(_runtime_state.get(), probe_state);
+        JoinBuildFunc<TYPE_INT>::construct_hash_table(_runtime_state.get(), table_items, probe_state);
+        JoinProbeFunc<TYPE_INT>::lookup_init(*table_items, probe_state);
+    };
+
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+    build_and_probe(0, 1, &table_items, &probe_state);
+    ASSERT_FALSE(table_items.is_radix_partitioned());
+
+    JoinHashTableItems radix_table_items;
+    HashTableProbeState radix_probe_state;
+    build_and_probe(1, 1, &radix_table_items, &radix_probe_state);
+    ASSERT_TRUE(radix_table_items.is_radix_partitioned());
+    ASSERT_GT(radix_table_items.radix_partition_num, 1);
+    ASSERT_TRUE(radix_table_items.radix_build_buckets.empty());
+
+    // the radix partitioned table must have exactly the same chains.
+    ASSERT_EQ(table_items.bucket_size, radix_table_items.bucket_size);
+    ASSERT_TRUE(table_items.first == radix_table_items.first);
+    ASSERT_TRUE(table_items.next == radix_table_items.next);
+    for (uint32_t i = 0; i < probe_row_count; i++) {
+        ASSERT_EQ(probe_state.next[i], radix_probe_state.next[i]);
+    }
+
+    // partitions linked concurrently must produce the same chains too.
+    JoinHashTableItems parallel_table_items;
+    HashTableProbeState parallel_probe_state;
+    build_and_probe(1, 3, &parallel_table_items, &parallel_probe_state);
+    ASSERT_TRUE(parallel_table_items.is_radix_partitioned());
+    ASSERT_TRUE(parallel_table_items.radix_build_buckets.empty());
+    ASSERT_TRUE(table_items.first == parallel_table_items.first);
+    ASSERT_TRUE(table_items.next == parallel_table_items.next);
+
+    // the driver links all the partitions itself when the helpers are stuck in the queue.
+    std::unique_ptr<ThreadPool> busy_pool;
+    ASSERT_OK(ThreadPoolBuilder("hash_join_build_busy").set_max_threads(1).build(&busy_pool));
+    CountDownLatch unblock(1);
+    ASSERT_OK(busy_pool->submit_func([&unblock]() { unblock.wait(); }));
+    build_pool = std::move(busy_pool);
+    JoinHashTableItems queued_table_items;
+    HashTableProbeState queued_probe_state;
+    build_and_probe(1, 3, &queued_table_items, &queued_probe_state);
+    unblock.count_down();
+    ASSERT_TRUE(table_items.first == queued_table_items.first);
+    ASSERT_TRUE(table_items.next == queued_table_items.next);
+    build_pool->wait();
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFunc) {
     TDescriptorTableBuilder row_desc_builder;
@@ -1174,6 +1253,60 @@ TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFunc) {
     ASSERT_TRUE(result_data == check_data);
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, CloneReadableTableSharesTableItems) {
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false, 1);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false, 1);
+
+    auto probe_row_desc = create_probe_desc(&row_desc_builder);
+    auto build_row_desc = create_build_desc(&row_desc_builder);
+
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 2);
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+    param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+
+    JoinHashTable ht;
+    ht.create(param);
+    auto build_chunk = std::make_shared<Chunk>();
+    auto build_column = Int32Column::create();
+    down_cast<Int32Column*>(build_column.get())->append({1, 3, 5, 7, 9});
+    build_chunk->append_column(build_column, 1);
+    Columns build_key_columns{build_chunk->columns()[0]};
+    ht.append_chunk(build_chunk, build_key_columns);
+    ASSERT_OK(ht.build(_runtime_state.get()));
+
+    // every prober of a broadcast join reads the same table items with its own probe state.
+    JoinHashTable shared_ht1 = ht.clone_readable_table();
+    JoinHashTable shared_ht2 = ht.clone_readable_table();
+    ASSERT_EQ(ht.table_items(), shared_ht1.table_items());
+    ASSERT_EQ(ht.table_items(), shared_ht2.table_items());
+
+    auto probe = [&](JoinHashTable* table, const Buffer<int32_t>& keys) {
+        auto probe_chunk = std::make_shared<Chunk>();
+        auto probe_column = Int32Column::create();
+        probe_column->append(keys);
+        probe_chunk->append_column(probe_column, 0);
+        Columns probe_key_columns{probe_column};
+        ChunkPtr result_chunk = std::make_shared<Chunk>();
+        bool has_remain = false;
+        EXPECT_OK(table->probe(_runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &has_remain));
+        auto result_data = down_cast<Int32Column*>(result_chunk->get_column_by_slot_id(1).get())->get_data();
+        std::sort(result_data.begin(), result_data.end());
+        return result_data;
+    };
+
+    Buffer<int32_t> check_data1 = {1, 5, 9};
+    Buffer<int32_t> check_data2 = {3, 7};
+    ASSERT_TRUE(probe(&shared_ht1, {0, 1, 5, 9, 10}) == check_data1);
+    ASSERT_TRUE(probe(&shared_ht2, {2, 3, 7}) == check_data2);
+
+    shared_ht1.close();
+    shared_ht2.close();
+    ht.close();
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFuncNullable) {
     TDescriptorTableBuilder row_desc_builder;
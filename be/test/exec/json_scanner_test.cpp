@@ -389,6 +389,37 @@ TEST_F(JsonScannerTest, test_json_with_path) {
     EXPECT_EQ("['v2', 'server', '10.20.1.1', 20]", chunk->debug_row(1));
 }
 
+// The jsonpaths of the top-level fields, which are matched by one scan of each object.
+TEST_F(JsonScannerTest, test_json_with_flat_path) {
+    std::vector<TypeDescriptor> types;
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+    types.emplace_back(TYPE_INT);
+    types.emplace_back(TYPE_INT);
+
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.format_type = TFileFormatType::FORMAT_JSON;
+    range.file_type = TFileType::FILE_LOCAL;
+    range.strip_outer_array = false;
+    range.__isset.strip_outer_array = true;
+    range.__isset.jsonpaths = true;
+    range.jsonpaths = R"(["$.a", "$.b", "$.c"])";
+    range.__isset.json_root = false;
+    range.__set_path("./be/test/exec/test_data/json_scanner/test_flat_json_paths.json");
+    ranges.emplace_back(range);
+
+    auto scanner = create_json_scanner(types, ranges, {"col_a", "col_b", "col_c"});
+    ASSERT_OK(scanner->open());
+
+    ChunkPtr chunk = scanner->get_next().value();
+    EXPECT_EQ(3, chunk->num_columns());
+    EXPECT_EQ(3, chunk->num_rows());
+
+    EXPECT_EQ("['x', 1, 10]", chunk->debug_row(0));
+    EXPECT_EQ("[NULL, 2, 20]", chunk->debug_row(1));
+    EXPECT_EQ("['y', 3, NULL]", chunk->debug_row(2));
+}
+
 TEST_F(JsonScannerTest, test_one_level_array) {
     std::vector<TypeDescriptor> types;
     TypeDescriptor t1(TYPE_ARRAY);
@@ -0,0 +1,86 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/adaptive_chunk_size.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "testutil/parallel_test.h"
+
+namespace starrocks::pipeline {
+
+static ChunkPtr make_int_chunk(size_t num_rows) {
+    auto column = Int64Column::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        column->append(i);
+    }
+    return std::make_shared<Chunk>(Columns{column}, Chunk::SlotHashMap{{0, 0}});
+}
+
+static ChunkPtr make_string_chunk(size_t num_rows, size_t row_width) {
+    auto column = BinaryColumn::create();
+    std::string value(row_width, 'x');
+    for (size_t i = 0; i < num_rows; i++) {
+        column->append(value);
+    }
+    return std::make_shared<Chunk>(Columns{column}, Chunk::SlotHashMap{{0, 0}});
+}
+
+PARALLEL_TEST(AdaptiveChunkSizeTest, test_narrow_rows_keep_max_size) {
+    AdaptiveChunkSizeController controller(4096, 1024 * 1024);
+    ASSERT_EQ(4096, controller.chunk_size());
+    ASSERT_EQ(512, controller.min_chunk_size());
+
+    controller.update(*make_int_chunk(4096));
+    ASSERT_EQ(8, static_cast<int64_t>(controller.bytes_per_row()));
+    ASSERT_EQ(4096, controller.chunk_size());
+}
+
+PARALLEL_TEST(AdaptiveChunkSizeTest, test_wide_rows_shrink) {
+    AdaptiveChunkSizeController controller(4096, 1024 * 1024);
+
+    // About 1KB per row, so 1MB holds 1024 rows.
+    controller.update(*make_string_chunk(256, 1000));
+    ASSERT_EQ(1024, controller.chunk_size());
+
+    // Only one of every 8 chunks is sampled.
+    for (int i = 0; i < 7; i++) {
+        controller.update(*make_string_chunk(16, 100000));
+    }
+    ASSERT_EQ(1024, controller.chunk_size());
+
+    // Very wide rows never shrink the chunks below 1/8 of the max size.
+    for (int i = 0; i < 64; i++) {
+        controller.update(*make_string_chunk(16, 100000));
+    }
+    ASSERT_EQ(512, controller.chunk_size());
+
+    // Back to narrow rows.
+    for (int i = 0; i < 256; i++) {
+        controller.update(*make_int_chunk(4096));
+    }
+    ASSERT_EQ(4096, controller.chunk_size());
+}
+
+PARALLEL_TEST(AdaptiveChunkSizeTest, test_empty_chunk_ignored) {
+    AdaptiveChunkSizeController controller(4096, 1024 * 1024);
+    controller.update(*make_string_chunk(0, 1000));
+    ASSERT_EQ(0, controller.bytes_per_row());
+    ASSERT_EQ(4096, controller.chunk_size());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,96 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/adaptive/collect_stats_context.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "exec/pipeline/adaptive/adaptive_dop_param.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+static ChunkPtr make_int_chunk(size_t num_rows) {
+    auto column = Int64Column::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        column->append(i);
+    }
+    return std::make_shared<Chunk>(Columns{column}, Chunk::SlotHashMap{{0, 0}});
+}
+
+class CollectStatsContextTest : public ::testing::Test {
+protected:
+    // Returns a context of `dop` drivers in the passthrough state.
+    std::shared_ptr<CollectStatsContext> make_passthrough_context(size_t dop, bool allow_steal) {
+        AdaptiveDopParam param;
+        param.max_block_rows_per_driver_seq = 1;
+        auto ctx = std::make_shared<CollectStatsContext>(&_state, dop, param);
+        for (size_t i = 0; i < dop; i++) {
+            ctx->incr_sinker();
+        }
+        ctx->set_allow_steal(allow_steal);
+        EXPECT_TRUE(ctx->push_chunk(0, make_int_chunk(dop)).ok());
+        EXPECT_EQ("Passthrough", ctx->readable_state());
+        return ctx;
+    }
+
+    RuntimeState _state{TUniqueId(), TQueryOptions(), TQueryGlobals(), nullptr};
+};
+
+// NOLINTNEXTLINE
+TEST_F(CollectStatsContextTest, test_steal_backlog) {
+    auto ctx = make_passthrough_context(4, true);
+    // the chunk buffered by the block state, and 17 chunks backed up for the driver 0
+    for (int i = 0; i < 17; i++) {
+        ASSERT_TRUE(ctx->push_chunk(0, make_int_chunk(2)).ok());
+    }
+
+    // the idle driver 1 takes the chunks of the driver 0, and keeps doing so after its own input is finished
+    ASSERT_TRUE(ctx->has_output(1));
+    ASSERT_TRUE(ctx->set_finishing(1).ok());
+    auto chunk = ctx->pull_chunk(1);
+    ASSERT_TRUE(chunk.ok());
+    ASSERT_EQ(2, chunk.value()->num_rows());
+    ASSERT_FALSE(ctx->is_downstream_finished(1));
+
+    // no more backlog after the second one
+    ASSERT_TRUE(ctx->pull_chunk(1).ok());
+    ASSERT_FALSE(ctx->has_output(1));
+    ASSERT_TRUE(ctx->is_downstream_finished(1));
+
+    // the driver 0 still gets the rest of its chunks, the one buffered by the block state and the 15 left
+    ASSERT_TRUE(ctx->set_finishing(0).ok());
+    size_t num_chunks = 0;
+    while (ctx->has_output(0)) {
+        auto res = ctx->pull_chunk(0);
+        ASSERT_TRUE(res.ok());
+        num_chunks += res.value() != nullptr;
+    }
+    ASSERT_EQ(16, num_chunks);
+}
+
+// NOLINTNEXTLINE
+TEST_F(CollectStatsContextTest, test_no_steal) {
+    auto ctx = make_passthrough_context(4, false);
+    for (int i = 0; i < 17; i++) {
+        ASSERT_TRUE(ctx->push_chunk(0, make_int_chunk(2)).ok());
+    }
+    ASSERT_FALSE(ctx->has_output(1));
+    ASSERT_TRUE(ctx->set_finishing(1).ok());
+    ASSERT_TRUE(ctx->is_downstream_finished(1));
+}
+
+} // namespace starrocks::pipeline
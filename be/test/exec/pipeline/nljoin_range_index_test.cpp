@@ -0,0 +1,137 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/object_pool.h"
+#include "exprs/binary_predicate.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "exprs/exprs_test_helper.h"
+
+namespace starrocks::pipeline {
+
+class NLJoinRangeIndexTest : public ::testing::Test {
+protected:
+    ExprContext* make_conjunct(TExprOpcode::type op, SlotId left, SlotId right, TPrimitiveType::type type) {
+        TExprNode node;
+        node.node_type = TExprNodeType::BINARY_PRED;
+        node.opcode = op;
+        node.__isset.opcode = true;
+        node.child_type = type;
+        node.__isset.child_type = true;
+        node.num_children = 2;
+        node.type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BOOLEAN);
+        Expr* expr = _pool.add(VectorizedBinaryPredicateFactory::from_thrift(node));
+        TypeDescriptor child_type = TypeDescriptor::from_thrift(ExprsTestHelper::create_scalar_type_desc(type));
+        expr->add_child(_pool.add(new ColumnRef(child_type, left)));
+        expr->add_child(_pool.add(new ColumnRef(child_type, right)));
+        return _pool.add(new ExprContext(expr));
+    }
+
+    // Returns the build rows at the positions [begin, end) of `index`, in the numbering of the build rows.
+    static std::vector<uint32_t> rows_of(const NLJoinRangeIndex& index, size_t begin, size_t end, size_t chunk_size) {
+        std::vector<Buffer<uint32_t>> chunk_rows;
+        index.group_by_chunk(begin, end, &chunk_rows);
+        std::vector<uint32_t> rows;
+        for (size_t i = 0; i < chunk_rows.size(); i++) {
+            for (uint32_t row : chunk_rows[i]) {
+                rows.emplace_back(i * chunk_size + row);
+            }
+        }
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    }
+
+    ObjectPool _pool;
+};
+
+// NOLINTNEXTLINE
+TEST_F(NLJoinRangeIndexTest, test_find_range_conjunct) {
+    std::vector<SlotId> probe_slots{1, 2};
+    std::vector<SlotId> build_slots{3, 4};
+
+    auto conjunct = NLJoinRangeIndex::find_range_conjunct(
+            {make_conjunct(TExprOpcode::EQ, 1, 3, TPrimitiveType::INT),
+             make_conjunct(TExprOpcode::LE, 4, 2, TPrimitiveType::BIGINT)},
+            probe_slots, build_slots);
+    ASSERT_TRUE(conjunct.has_value());
+    ASSERT_EQ(2, conjunct->probe_slot);
+    ASSERT_EQ(4, conjunct->build_slot);
+    ASSERT_EQ(TYPE_BIGINT, conjunct->type);
+    // build <= probe is probe >= build
+    ASSERT_EQ(TExprOpcode::GE, conjunct->op);
+
+    // both slots on the same side, or an unsupported type
+    ASSERT_FALSE(NLJoinRangeIndex::find_range_conjunct({make_conjunct(TExprOpcode::LT, 1, 2, TPrimitiveType::INT)},
+                                                       probe_slots, build_slots)
+                         .has_value());
+    ASSERT_FALSE(NLJoinRangeIndex::find_range_conjunct({make_conjunct(TExprOpcode::LT, 1, 3, TPrimitiveType::DOUBLE)},
+                                                       probe_slots, build_slots)
+                         .has_value());
+}
+
+// NOLINTNEXTLINE
+TEST_F(NLJoinRangeIndexTest, test_probe) {
+    const size_t chunk_size = 4;
+    // the build keys 5, 1, null, 3 | 7, 3, 9
+    std::vector<ChunkPtr> build_chunks;
+    for (const auto& [keys, nulls] : std::vector<std::pair<std::vector<int32_t>, std::vector<uint8_t>>>{
+                 {{5, 1, 0, 3}, {0, 0, 1, 0}}, {{7, 3, 9}, {0, 0, 0}}}) {
+        auto data = Int32Column::create();
+        data->append_numbers(keys.data(), keys.size() * sizeof(int32_t));
+        auto null_column = NullColumn::create();
+        null_column->append_numbers(nulls.data(), nulls.size());
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(NullableColumn::create(data, null_column), 3);
+        build_chunks.emplace_back(std::move(chunk));
+    }
+
+    auto probe_column = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    probe_column->append_datum(Datum(int32_t(3)));
+    probe_column->append_nulls(1);
+
+    auto probe = [&](TExprOpcode::type op, size_t row) {
+        auto index = NLJoinRangeIndex::build(NLJoinRangeConjunct{1, 3, TYPE_INT, op}, build_chunks, chunk_size);
+        EXPECT_TRUE(index != nullptr);
+        EXPECT_EQ(6, index->num_rows());
+        auto [begin, end] = index->probe(*probe_column, row);
+        return rows_of(*index, begin, end, chunk_size);
+    };
+    // probe < build
+    ASSERT_EQ(std::vector<uint32_t>({0, 4, 6}), probe(TExprOpcode::LT, 0));
+    // probe <= build
+    ASSERT_EQ(std::vector<uint32_t>({0, 3, 4, 5, 6}), probe(TExprOpcode::LE, 0));
+    // probe > build
+    ASSERT_EQ(std::vector<uint32_t>({1}), probe(TExprOpcode::GT, 0));
+    // probe >= build
+    ASSERT_EQ(std::vector<uint32_t>({1, 3, 5}), probe(TExprOpcode::GE, 0));
+    // a null probe value matches nothing
+    ASSERT_TRUE(probe(TExprOpcode::GE, 1).empty());
+
+    // the build rows can not be numbered if a chunk other than the last one is not full
+    ASSERT_EQ(nullptr, NLJoinRangeIndex::build(NLJoinRangeConjunct{1, 3, TYPE_INT, TExprOpcode::LT},
+                                               {build_chunks[1], build_chunks[0]}, chunk_size));
+}
+
+} // namespace starrocks::pipeline
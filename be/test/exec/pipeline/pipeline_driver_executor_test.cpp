@@ -0,0 +1,171 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_driver_executor.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "exec/pipeline/pipeline.h"
+#include "exec/pipeline/source_operator.h"
+#include "pipeline_test_base.h"
+#include "testutil/sync_point.h"
+#include "util/defer_op.h"
+
+namespace starrocks::pipeline {
+
+// The drivers of the test, all of which become ready at the same time once the gate is open.
+struct StealTestContext {
+    size_t num_drivers = 0;
+    std::atomic<bool> gate_open = false;
+    // The source operator of the first driver of the first batch parked in a run queue.
+    std::atomic<const Operator*> blocker = nullptr;
+    std::atomic<size_t> num_finished = 0;
+    std::atomic<bool> blocker_timed_out = false;
+};
+using StealTestContextPtr = std::shared_ptr<StealTestContext>;
+
+// Output one chunk. The blocker keeps its worker busy until all the other drivers finish, so the drivers parked
+// behind it can only finish by being stolen.
+class GateSourceOperator final : public SourceOperator {
+public:
+    GateSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                       StealTestContextPtr ctx)
+            : SourceOperator(factory, id, "gate_source", plan_node_id, false, driver_sequence), _ctx(std::move(ctx)) {}
+
+    bool has_output() const override { return _ctx->gate_open && !_pulled; }
+    bool is_finished() const override { return _pulled; }
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override {
+        _pulled = true;
+        if (_ctx->blocker == this) {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (_ctx->num_finished < _ctx->num_drivers - 1) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    _ctx->blocker_timed_out = true;
+                    break;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        } else {
+            _ctx->num_finished++;
+        }
+        return PipelineTestBase::_create_and_fill_chunk(1);
+    }
+
+private:
+    StealTestContextPtr _ctx;
+    bool _pulled = false;
+};
+
+class GateSourceOperatorFactory final : public SourceOperatorFactory {
+public:
+    GateSourceOperatorFactory(int32_t id, int32_t plan_node_id, StealTestContextPtr ctx)
+            : SourceOperatorFactory(id, "gate_source", plan_node_id), _ctx(std::move(ctx)) {}
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<GateSourceOperator>(this, _id, _plan_node_id, driver_sequence, _ctx);
+    }
+    SourceOperatorFactory::AdaptiveState adaptive_initial_state() const override { return AdaptiveState::ACTIVE; }
+
+private:
+    StealTestContextPtr _ctx;
+};
+
+class DiscardSinkOperator final : public Operator {
+public:
+    DiscardSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence)
+            : Operator(factory, id, "discard_sink", plan_node_id, false, driver_sequence) {}
+
+    bool need_input() const override { return true; }
+    bool has_output() const override { return false; }
+    bool is_finished() const override { return _is_finished; }
+    Status set_finishing(RuntimeState* state) override {
+        _is_finished = true;
+        return Status::OK();
+    }
+
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override { return Status::OK(); }
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override {
+        return Status::InternalError("Shouldn't pull chunk from sink operator");
+    }
+
+private:
+    bool _is_finished = false;
+};
+
+class DiscardSinkOperatorFactory final : public OperatorFactory {
+public:
+    DiscardSinkOperatorFactory(int32_t id, int32_t plan_node_id) : OperatorFactory(id, "discard_sink", plan_node_id) {}
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<DiscardSinkOperator>(this, _id, _plan_node_id, driver_sequence);
+    }
+};
+
+class GlobalDriverExecutorTest : public PipelineTestBase {};
+
+TEST_F(GlobalDriverExecutorTest, test_idle_worker_steals_parked_drivers) {
+    if (ExecEnv::GetInstance()->max_executor_threads() < 2) {
+        GTEST_SKIP() << "stealing needs at least two executor threads";
+    }
+    const int32_t old_batch_size = config::pipeline_driver_queue_take_batch_size;
+    DeferOp restore_batch_size([&]() { config::pipeline_driver_queue_take_batch_size = old_batch_size; });
+    // A worker woken while all the drivers are ready takes a batch of 4 and parks 3 of them, and the other workers
+    // take the rest one by one.
+    config::pipeline_driver_queue_take_batch_size = 4;
+    auto ctx = std::make_shared<StealTestContext>();
+    ctx->num_drivers = 8;
+
+    // Park the batch only after the other workers have run the drivers left in the shared queue and gone to sleep
+    // on it, so that nothing but the wakeup of the parking worker lets them steal the parked drivers.
+    std::atomic<bool> parked = false;
+    SyncPoint::GetInstance()->SetCallBack("GlobalDriverExecutor::_get_next_driver::park_batch",
+                                          [&ctx, &parked](void* arg) {
+                                              auto* batch = static_cast<std::vector<DriverRawPtr>*>(arg);
+                                              if (!ctx->gate_open || parked.exchange(true)) {
+                                                  return;
+                                              }
+                                              ctx->blocker = (*batch)[0]->source_operator();
+                                              std::this_thread::sleep_for(std::chrono::milliseconds(500));
+                                          });
+    SyncPoint::GetInstance()->EnableProcessing();
+    DeferOp disable_sync_point([]() {
+        SyncPoint::GetInstance()->ClearCallBack("GlobalDriverExecutor::_get_next_driver::park_batch");
+        SyncPoint::GetInstance()->DisableProcessing();
+    });
+
+    _pipeline_builder = [&](RuntimeState* state) {
+        OpFactories op_factories;
+        auto source = std::make_shared<GateSourceOperatorFactory>(next_operator_id(), next_plan_node_id(), ctx);
+        source->set_degree_of_parallelism(ctx->num_drivers);
+        op_factories.push_back(std::move(source));
+        op_factories.push_back(std::make_shared<DiscardSinkOperatorFactory>(next_operator_id(), next_plan_node_id()));
+        _pipelines.push_back(std::make_shared<Pipeline>(next_pipeline_id(), op_factories, exec_group.get()));
+    };
+
+    // All the drivers wait in the poller, which puts them back to the shared queue at once when the gate opens.
+    start_test();
+    ctx->gate_open = true;
+
+    ASSERT_EQ(std::future_status::ready, _fragment_future.wait_for(std::chrono::seconds(30)));
+    ASSERT_TRUE(parked);
+    ASSERT_FALSE(ctx->blocker_timed_out);
+    ASSERT_EQ(ctx->num_drivers - 1, ctx->num_finished.load());
+}
+
+} // namespace starrocks::pipeline
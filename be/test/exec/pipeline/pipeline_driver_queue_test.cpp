@@ -16,11 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <thread>
 
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/workgroup/work_group.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
@@ -151,6 +153,61 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_block) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_batch) {
+    QuerySharedDriverQueue queue;
+
+    // Prepare drivers.
+    QueryContext query_context;
+    std::vector<std::shared_ptr<PipelineDriver>> drivers;
+    for (int i = 0; i < 4; i++) {
+        drivers.emplace_back(std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1));
+        _set_driver_level(drivers.back().get(), 1);
+        queue.put_back(drivers.back().get());
+    }
+
+    // The batch stops taking drivers once the queue holds less than max_num drivers.
+    std::vector<size_t> batch_sizes = {2, 1, 1};
+    size_t next_driver = 0;
+    for (size_t batch_size : batch_sizes) {
+        std::vector<DriverRawPtr> out_drivers;
+        ASSERT_TRUE(queue.take_batch(true, 2, &out_drivers).ok());
+        ASSERT_EQ(batch_size, out_drivers.size());
+        for (auto* out_driver : out_drivers) {
+            ASSERT_EQ(drivers[next_driver++].get(), out_driver);
+            ASSERT_FALSE(out_driver->is_in_ready_queue());
+        }
+    }
+    ASSERT_EQ(0, queue.size());
+
+    std::vector<DriverRawPtr> out_drivers;
+    ASSERT_TRUE(queue.take_batch(false, 2, &out_drivers).ok());
+    ASSERT_TRUE(out_drivers.empty());
+
+    queue.close();
+    ASSERT_TRUE(queue.take_batch(true, 2, &out_drivers).is_cancelled());
+}
+
+PARALLEL_TEST(QuerySharedDriverQueueTest, test_wake_up_idle_takers) {
+    QuerySharedDriverQueue queue;
+
+    // No thread is blocked, so the wakeup is dropped rather than kept for a later taker.
+    queue.wake_up_idle_takers(1);
+
+    std::atomic<int> num_returned = 0;
+    auto consumer_thread = std::make_shared<std::thread>([&queue, &num_returned] {
+        std::vector<DriverRawPtr> out_drivers;
+        ASSERT_TRUE(queue.take_batch(true, 2, &out_drivers).ok());
+        ASSERT_TRUE(out_drivers.empty());
+        num_returned++;
+    });
+
+    sleep(1);
+    ASSERT_EQ(0, num_returned);
+    queue.wake_up_idle_takers(1);
+    consumer_thread->join();
+    ASSERT_EQ(1, num_returned);
+}
+
 PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_close) {
     QuerySharedDriverQueue queue;
 
@@ -291,6 +348,41 @@ TEST_F(WorkGroupDriverQueueTest, test_take_block) {
     consumer_thread->join();
 }
 
+TEST_F(WorkGroupDriverQueueTest, test_wake_up_idle_takers) {
+    WorkGroupDriverQueue queue;
+
+    // No thread is blocked, so the wakeup is dropped rather than kept for a later taker.
+    queue.wake_up_idle_takers(1);
+
+    std::atomic<int> num_returned = 0;
+    std::vector<std::thread> consumer_threads;
+    for (int i = 0; i < 2; i++) {
+        consumer_threads.emplace_back([&queue, &num_returned] {
+            std::vector<DriverRawPtr> out_drivers;
+            auto status = queue.take_batch(true, 2, &out_drivers);
+            if (status.ok()) {
+                ASSERT_TRUE(out_drivers.empty());
+                num_returned++;
+            } else {
+                ASSERT_TRUE(status.is_cancelled());
+            }
+        });
+    }
+
+    sleep(1);
+    ASSERT_EQ(0, num_returned);
+    // Only one of the two blocked threads returns.
+    queue.wake_up_idle_takers(1);
+    sleep(1);
+    ASSERT_EQ(1, num_returned);
+
+    queue.close();
+    for (auto& consumer_thread : consumer_threads) {
+        consumer_thread.join();
+    }
+    ASSERT_EQ(1, num_returned);
+}
+
 TEST_F(WorkGroupDriverQueueTest, test_take_close) {
     WorkGroupDriverQueue queue;
 
@@ -305,4 +397,54 @@ TEST_F(WorkGroupDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+TEST_F(WorkGroupDriverQueueTest, test_short_query_strict_priority) {
+    auto normal_wg = std::make_shared<workgroup::WorkGroup>("wg500", 500, workgroup::WorkGroup::DEFAULT_VERSION, 1,
+                                                            0.5, 10, 1.0, workgroup::WorkGroupType::WG_NORMAL);
+    auto sq_wg = std::make_shared<workgroup::WorkGroup>("wg600", 600, workgroup::WorkGroup::DEFAULT_VERSION, 1, 0.5,
+                                                        10, 1.0, workgroup::WorkGroupType::WG_SHORT_QUERY);
+    normal_wg = workgroup::WorkGroupManager::instance()->add_workgroup(normal_wg);
+    sq_wg = workgroup::WorkGroupManager::instance()->add_workgroup(sq_wg);
+
+    QueryContext query_ctx;
+    WorkGroupDriverQueue queue;
+
+    auto normal_driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, -1);
+    _set_driver_level(normal_driver.get(), 1);
+    normal_driver->driver_acct().update_last_time_spent(1'000'000L);
+    normal_driver->set_workgroup(normal_wg);
+
+    // The short query workgroup has run much longer, so it would be picked last by the vruntime.
+    auto sq_driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, -1);
+    _set_driver_level(sq_driver.get(), 1);
+    sq_driver->driver_acct().update_last_time_spent(1'000'000'000L);
+    sq_driver->set_workgroup(sq_wg);
+
+    config::enable_short_query_workgroup_strict_priority = true;
+    DeferOp defer([] { config::enable_short_query_workgroup_strict_priority = false; });
+
+    for (auto* driver : {normal_driver.get(), sq_driver.get()}) {
+        queue.update_statistics(driver);
+        queue.put_back(driver);
+    }
+    ASSERT_TRUE(queue.should_yield(normal_driver.get(), 0));
+    ASSERT_FALSE(queue.should_yield(sq_driver.get(), 0));
+
+    auto* sq_entity = sq_wg->driver_sched_entity();
+    int64_t num_sq_schedules = 0;
+    for (size_t i = 0; i < workgroup::WorkGroupDriverSchedEntity::NUM_SCHEDULE_LATENCY_BUCKETS; i++) {
+        num_sq_schedules -= sq_entity->schedule_latency_count(i);
+    }
+
+    for (auto* out_driver : {sq_driver.get(), normal_driver.get()}) {
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+
+    for (size_t i = 0; i < workgroup::WorkGroupDriverSchedEntity::NUM_SCHEDULE_LATENCY_BUCKETS; i++) {
+        num_sq_schedules += sq_entity->schedule_latency_count(i);
+    }
+    ASSERT_EQ(1, num_sq_schedules);
+}
+
 } // namespace starrocks::pipeline
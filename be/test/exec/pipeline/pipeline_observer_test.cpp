@@ -0,0 +1,246 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_observer.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <thread>
+
+#include "exec/pipeline/pipeline.h"
+#include "exec/pipeline/pipeline_driver_poller.h"
+#include "exec/pipeline/pipeline_driver_queue.h"
+#include "pipeline_test_base.h"
+#include "testutil/parallel_test.h"
+#include "util/defer_op.h"
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+PARALLEL_TEST(PipelineObserverTest, test_take_notification) {
+    PipelineObserver observer;
+    // A new observer is always checked once.
+    ASSERT_TRUE(observer.take_notification());
+    ASSERT_FALSE(observer.take_notification());
+
+    // Notifications are merged until being taken.
+    observer.notify();
+    observer.notify();
+    ASSERT_TRUE(observer.take_notification());
+    ASSERT_FALSE(observer.take_notification());
+
+    QuerySharedDriverQueue queue;
+    PipelineDriverPoller poller(&queue);
+    observer.attach_poller(&poller);
+    ASSERT_TRUE(observer.take_notification());
+    observer.notify();
+    ASSERT_TRUE(observer.take_notification());
+}
+
+PARALLEL_TEST(PipelineObserverTest, test_observer_list) {
+    PipelineObserver observer1;
+    PipelineObserver observer2;
+    ASSERT_TRUE(observer1.take_notification());
+    ASSERT_TRUE(observer2.take_notification());
+
+    PipelineObserverList observers;
+    observers.add(&observer1);
+    observers.add(&observer2);
+    observers.notify_all();
+    ASSERT_TRUE(observer1.take_notification());
+    ASSERT_TRUE(observer2.take_notification());
+
+    observers.remove(&observer1);
+    observers.notify_all();
+    ASSERT_FALSE(observer1.take_notification());
+    ASSERT_TRUE(observer2.take_notification());
+}
+
+static constexpr int32_t kNumObservableDrivers = 2;
+
+// The states of the observable source operators, shared with the test body.
+struct ObservableSourceContext {
+    std::atomic<bool> ready[kNumObservableDrivers] = {false, false};
+    std::atomic<int64_t> num_checks[kNumObservableDrivers] = {0, 0};
+    std::atomic<SourceOperator*> operators[kNumObservableDrivers] = {nullptr, nullptr};
+};
+
+// An observable source outputs one chunk once it's ready, and records how many times the poller checks it.
+class ObservableSourceOperator final : public SourceOperator {
+public:
+    ObservableSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                             ObservableSourceContext* ctx)
+            : SourceOperator(factory, id, "observable_source", plan_node_id, false, driver_sequence), _ctx(ctx) {}
+    ~ObservableSourceOperator() override = default;
+
+    bool is_observable() const override { return true; }
+    bool has_output() const override {
+        _ctx->num_checks[_driver_sequence]++;
+        return !_is_finished && _ctx->ready[_driver_sequence];
+    }
+    bool is_finished() const override { return _is_finished; }
+    Status set_finishing(RuntimeState* state) override {
+        _is_finished = true;
+        return Status::OK();
+    }
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override {
+        _is_finished = true;
+        return PipelineTestBase::_create_and_fill_chunk(1);
+    }
+
+    void notify() { notify_observer(); }
+
+private:
+    ObservableSourceContext* _ctx;
+    std::atomic<bool> _is_finished = false;
+};
+
+class ObservableSourceOperatorFactory final : public SourceOperatorFactory {
+public:
+    ObservableSourceOperatorFactory(int32_t id, int32_t plan_node_id, ObservableSourceContext* ctx)
+            : SourceOperatorFactory(id, "observable_source", plan_node_id), _ctx(ctx) {}
+    ~ObservableSourceOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        auto op = std::make_shared<ObservableSourceOperator>(this, _id, _plan_node_id, driver_sequence, _ctx);
+        _ctx->operators[driver_sequence] = op.get();
+        return op;
+    }
+    SourceOperatorFactory::AdaptiveState adaptive_initial_state() const override { return AdaptiveState::ACTIVE; }
+
+private:
+    ObservableSourceContext* _ctx;
+};
+
+class DiscardSinkOperator final : public Operator {
+public:
+    DiscardSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence)
+            : Operator(factory, id, "discard_sink", plan_node_id, false, driver_sequence) {}
+    ~DiscardSinkOperator() override = default;
+
+    bool need_input() const override { return true; }
+    bool has_output() const override { return false; }
+    bool is_finished() const override { return _is_finished; }
+    Status set_finishing(RuntimeState* state) override {
+        _is_finished = true;
+        return Status::OK();
+    }
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override { return Status::OK(); }
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override {
+        return Status::InternalError("Shouldn't pull chunk from sink operator");
+    }
+
+private:
+    bool _is_finished = false;
+};
+
+class DiscardSinkOperatorFactory final : public OperatorFactory {
+public:
+    DiscardSinkOperatorFactory(int32_t id, int32_t plan_node_id) : OperatorFactory(id, "discard_sink", plan_node_id) {}
+    ~DiscardSinkOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<DiscardSinkOperator>(this, _id, _plan_node_id, driver_sequence);
+    }
+};
+
+class PipelineDriverPollerTest : public PipelineTestBase {};
+
+// The poller checks a blocked driver waiting for notification only when it's notified,
+// and checks the un-notified ones in the periodic full scan.
+TEST_F(PipelineDriverPollerTest, test_check_notified_drivers) {
+    const int32_t full_scan_interval_ms = 1000;
+    const int32_t prev_full_scan_interval_ms = config::pipeline_poller_full_scan_interval_ms;
+    const bool prev_event_driven_wakeup = config::enable_pipeline_event_driven_wakeup;
+    config::pipeline_poller_full_scan_interval_ms = full_scan_interval_ms;
+    config::enable_pipeline_event_driven_wakeup = true;
+    DeferOp defer([&]() {
+        config::pipeline_poller_full_scan_interval_ms = prev_full_scan_interval_ms;
+        config::enable_pipeline_event_driven_wakeup = prev_event_driven_wakeup;
+    });
+
+    ObservableSourceContext ctx;
+    _pipeline_builder = [&](RuntimeState* state) {
+        OpFactories op_factories;
+        auto source = std::make_shared<ObservableSourceOperatorFactory>(next_operator_id(), next_plan_node_id(), &ctx);
+        source->set_degree_of_parallelism(kNumObservableDrivers);
+        op_factories.push_back(std::move(source));
+        op_factories.push_back(std::make_shared<DiscardSinkOperatorFactory>(next_operator_id(), next_plan_node_id()));
+        _pipelines.push_back(std::make_shared<Pipeline>(next_pipeline_id(), op_factories, exec_group.get()));
+    };
+    prepare_test();
+
+    std::vector<DriverRawPtr> drivers;
+    _fragment_ctx->iterate_drivers([&](const DriverPtr& driver) { drivers.push_back(driver.get()); });
+    ASSERT_EQ(kNumObservableDrivers, drivers.size());
+
+    auto wait_until = [](const std::function<bool()>& pred, int64_t timeout_ms) {
+        const int64_t deadline_ms = MonotonicMillis() + timeout_ms;
+        while (!pred()) {
+            if (MonotonicMillis() >= deadline_ms) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    };
+    auto notify = [&](int32_t seq) { down_cast<ObservableSourceOperator*>(ctx.operators[seq].load())->notify(); };
+
+    QuerySharedDriverQueue queue;
+    PipelineDriverPoller poller(&queue);
+    const int64_t start_ms = MonotonicMillis();
+    poller.start();
+    for (auto* driver : drivers) {
+        driver->set_driver_state(DriverState::INPUT_EMPTY);
+        poller.add_blocked_driver(driver);
+    }
+
+    // A new blocked driver is checked once, and then skipped without notifications.
+    ASSERT_TRUE(wait_until([&]() { return ctx.num_checks[0] > 0 && ctx.num_checks[1] > 0; }, 500));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const int64_t num_checks0 = ctx.num_checks[0];
+    const int64_t num_checks1 = ctx.num_checks[1];
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ASSERT_EQ(num_checks0, ctx.num_checks[0].load());
+    ASSERT_EQ(num_checks1, ctx.num_checks[1].load());
+
+    // The notified driver is re-checked on the next wakeup, while the other one is still skipped.
+    notify(0);
+    ASSERT_TRUE(wait_until([&]() { return ctx.num_checks[0] > num_checks0; }, 200));
+    ASSERT_EQ(num_checks1, ctx.num_checks[1].load());
+
+    ctx.ready[0] = true;
+    notify(0);
+    DriverRawPtr ready_driver = nullptr;
+    ASSERT_TRUE(wait_until([&]() { return (ready_driver = queue.take(false).value()) != nullptr; }, 200));
+    ASSERT_EQ(drivers[0], ready_driver);
+
+    // The un-notified driver becomes ready only after the full scan.
+    ctx.ready[1] = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(nullptr, queue.take(false).value());
+    ASSERT_TRUE(wait_until([&]() { return (ready_driver = queue.take(false).value()) != nullptr; },
+                           2 * full_scan_interval_ms));
+    ASSERT_EQ(drivers[1], ready_driver);
+    ASSERT_GE(MonotonicMillis() - start_ms, full_scan_interval_ms);
+    poller.shutdown();
+
+    for (auto* driver : drivers) {
+        _exec_env->wg_driver_executor()->submit(driver);
+    }
+    ASSERT_EQ(std::future_status::ready, _fragment_future.wait_for(std::chrono::seconds(15)));
+}
+
+} // namespace starrocks::pipeline
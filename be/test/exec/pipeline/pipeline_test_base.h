@@ -51,6 +51,9 @@ protected:
 
     // Entry of test, subclass should call this method to start test
     void start_test();
+    // Prepare the drivers without submitting them to the executor, for the tests scheduling the drivers by
+    // themselves. The drivers should be submitted at last, so that the fragment finishes.
+    void prepare_test();
 
     size_t next_operator_id() { return ++_next_operator_id; }
     size_t next_plan_node_id() { return ++_next_plan_node_id; }
@@ -14,11 +14,13 @@
 
 #include <chrono>
 #include <random>
+#include <thread>
 
 #include "exec/pipeline/query_context.h"
 #include "exec/workgroup/work_group.h"
 #include "gtest/gtest.h"
 #include "testutil/assert.h"
+#include "testutil/sync_point.h"
 
 namespace starrocks::pipeline {
 
@@ -295,4 +297,81 @@ TEST(QueryContextManagerTest, testSetWorkgroup) {
     ASSERT_EQ(0, wg->num_running_queries());
 }
 
+class QueryAdmissionTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _old_max_wait_ms = config::query_admission_max_wait_ms;
+        _old_max_ready_drivers = config::query_admission_max_ready_drivers_per_workgroup;
+        // only the sync point decides whether the query is admitted.
+        config::query_admission_max_ready_drivers_per_workgroup = 0;
+        _parent_mem_tracker = std::make_shared<MemTracker>(MemTracker::QUERY_POOL, 1073741824L, "parent", nullptr);
+        _query_ctx_mgr = std::make_shared<QueryContextManager>(6);
+        ASSERT_OK(_query_ctx_mgr->init());
+        _wg = std::make_shared<workgroup::WorkGroup>("wg1", 1, 1, 1, 1, 1 /* concurrency_limit */,
+                                                     1.0 /* spill_mem_limit_threshold */,
+                                                     workgroup::WorkGroupType::WG_NORMAL);
+        _query_ctx = gen_query_ctx(_parent_mem_tracker.get(), _query_ctx_mgr.get(), 0, 1, 1, 60, 300);
+        SyncPoint::GetInstance()->EnableProcessing();
+    }
+
+    void TearDown() override {
+        SyncPoint::GetInstance()->ClearCallBack("QueryContext::try_admit::can_admit");
+        SyncPoint::GetInstance()->DisableProcessing();
+        config::query_admission_max_wait_ms = _old_max_wait_ms;
+        config::query_admission_max_ready_drivers_per_workgroup = _old_max_ready_drivers;
+    }
+
+protected:
+    // the query is admitted from the |admit_at|-th check, never if it is negative.
+    void admit_at(int admit_at) {
+        SyncPoint::GetInstance()->SetCallBack("QueryContext::try_admit::can_admit",
+                                              [this, admit_at](void* arg) {
+                                                  _num_checks++;
+                                                  *static_cast<bool*>(arg) = admit_at >= 0 && _num_checks >= admit_at;
+                                              });
+    }
+
+    int64_t _old_max_wait_ms = 0;
+    int64_t _old_max_ready_drivers = 0;
+    std::shared_ptr<MemTracker> _parent_mem_tracker;
+    std::shared_ptr<QueryContextManager> _query_ctx_mgr;
+    workgroup::WorkGroupPtr _wg;
+    QueryContext* _query_ctx = nullptr;
+    std::atomic<int> _num_checks = 0;
+};
+
+TEST_F(QueryAdmissionTest, admit) {
+    config::query_admission_max_wait_ms = 60000;
+    admit_at(3);
+    _query_ctx->init_admission_once(0);
+    // the check never blocks, the drivers retry it from the poller until the query is admitted.
+    ASSERT_FALSE(_query_ctx->try_admit(_wg.get()));
+    ASSERT_FALSE(_query_ctx->try_admit(_wg.get()));
+    ASSERT_TRUE(_query_ctx->try_admit(_wg.get()));
+    ASSERT_EQ(3, _num_checks.load());
+
+    // an admitted query stays admitted, and the following fragments of the query don't start the admission again.
+    _query_ctx->init_admission_once(0);
+    ASSERT_TRUE(_query_ctx->try_admit(_wg.get()));
+    ASSERT_EQ(3, _num_checks.load());
+}
+
+TEST_F(QueryAdmissionTest, timeout) {
+    config::query_admission_max_wait_ms = 100;
+    admit_at(-1);
+    _query_ctx->init_admission_once(0);
+    ASSERT_FALSE(_query_ctx->try_admit(_wg.get()));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_TRUE(_query_ctx->try_admit(_wg.get()));
+    ASSERT_EQ(2, _num_checks.load());
+}
+
+TEST_F(QueryAdmissionTest, disabled) {
+    config::query_admission_max_wait_ms = 0;
+    admit_at(-1);
+    _query_ctx->init_admission_once(0);
+    ASSERT_TRUE(_query_ctx->try_admit(_wg.get()));
+    ASSERT_EQ(0, _num_checks.load());
+}
+
 } // namespace starrocks::pipeline
@@ -0,0 +1,97 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/query_cpu_sampler.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "common/config.h"
+#include "util/defer_op.h"
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+// NOLINTNEXTLINE
+TEST(QueryCpuSamplerTest, test_top_queries) {
+    // keep the background thread from sampling during the test
+    const bool enabled = config::enable_query_cpu_sampler;
+    config::enable_query_cpu_sampler = false;
+    DeferOp defer([enabled]() { config::enable_query_cpu_sampler = enabled; });
+
+    auto* sampler = QueryCpuSampler::instance();
+    const int32_t scan = sampler->name_id("test_sampler_scan");
+    const int32_t agg = sampler->name_id("test_sampler_agg");
+    ASSERT_EQ(scan, sampler->name_id("test_sampler_scan"));
+    ASSERT_NE(scan, agg);
+
+    TUniqueId query1;
+    query1.__set_hi(0x7e57);
+    query1.__set_lo(1);
+    TUniqueId query2;
+    query2.__set_hi(0x7e57);
+    query2.__set_lo(2);
+
+    // another thread keeps running the scan of query2
+    std::atomic<bool> published = false;
+    std::atomic<bool> done = false;
+    std::thread worker([&]() {
+        QueryCpuSampler::set_current(query2, 1, scan);
+        published = true;
+        while (!done) {
+            std::this_thread::yield();
+        }
+        QueryCpuSampler::clear_current();
+    });
+    while (!published) {
+        std::this_thread::yield();
+    }
+
+    const int64_t now_ms = UnixMillis();
+    QueryCpuSampler::set_current(query1, 3, agg);
+    for (int i = 0; i < 3; i++) {
+        sampler->sample(now_ms);
+    }
+    QueryCpuSampler::set_current(query1, 1, scan);
+    sampler->sample(now_ms);
+    // an idle thread is not sampled
+    QueryCpuSampler::clear_current();
+    sampler->sample(now_ms);
+    done = true;
+    worker.join();
+
+    auto queries = sampler->top_queries(2, 10);
+    std::erase_if(queries, [](const auto& query) { return query.query_id.hi != 0x7e57; });
+    ASSERT_EQ(2, queries.size());
+    ASSERT_EQ(query2, queries[0].query_id);
+    ASSERT_EQ(5, queries[0].samples);
+    ASSERT_EQ(1, queries[0].operators.size());
+    ASSERT_EQ("test_sampler_scan", queries[0].operators[0].name);
+
+    ASSERT_EQ(query1, queries[1].query_id);
+    ASSERT_EQ(4, queries[1].samples);
+    ASSERT_EQ(2, queries[1].operators.size());
+    ASSERT_EQ(3, queries[1].operators[0].plan_node_id);
+    ASSERT_EQ("test_sampler_agg", queries[1].operators[0].name);
+    ASSERT_EQ(3, queries[1].operators[0].samples);
+    ASSERT_EQ(1, queries[1].operators[1].plan_node_id);
+    ASSERT_EQ(1, queries[1].operators[1].samples);
+
+    auto top1 = sampler->top_queries(2, 1);
+    ASSERT_EQ(1, top1.size());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,293 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <numeric>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "exec/pipeline/pipeline.h"
+#include "exec/pipeline/project_operator.h"
+#include "exec/pipeline/select_operator.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "pipeline_test_base.h"
+#include "util/defer_op.h"
+
+namespace starrocks::pipeline {
+
+static constexpr SlotId kInputSlotId = 1;
+static constexpr SlotId kOutputSlotId = 2;
+
+// input < bound
+class LessThanExpr final : public Expr {
+public:
+    LessThanExpr(SlotId slot_id, int32_t bound)
+            : Expr(TypeDescriptor(TYPE_BOOLEAN), false), _slot_id(slot_id), _bound(bound) {}
+
+    Expr* clone(ObjectPool* pool) const override { return pool->add(new LessThanExpr(*this)); }
+
+    StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* chunk) override {
+        const auto& values = down_cast<Int32Column*>(chunk->get_column_by_slot_id(_slot_id).get())->get_data();
+        auto result = BooleanColumn::create(values.size(), 0);
+        auto& data = result->get_data();
+        for (size_t i = 0; i < values.size(); ++i) {
+            data[i] = values[i] < _bound;
+        }
+        return result;
+    }
+
+private:
+    SlotId _slot_id;
+    int32_t _bound;
+};
+
+// Returns the input, but fails on any input >= bound, like a cast failing on the rows filtered out by the conjuncts.
+class FailOnLargeValueExpr final : public Expr {
+public:
+    FailOnLargeValueExpr(SlotId slot_id, int32_t bound)
+            : Expr(TypeDescriptor(TYPE_INT), false), _slot_id(slot_id), _bound(bound) {}
+
+    Expr* clone(ObjectPool* pool) const override { return pool->add(new FailOnLargeValueExpr(*this)); }
+
+    StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* chunk) override {
+        const auto& column = chunk->get_column_by_slot_id(_slot_id);
+        for (int32_t value : down_cast<Int32Column*>(column.get())->get_data()) {
+            if (value >= _bound) {
+                return Status::InvalidArgument(fmt::format("unexpected value {}", value));
+            }
+        }
+        return column->clone_shared();
+    }
+
+private:
+    SlotId _slot_id;
+    int32_t _bound;
+};
+
+// Outputs the chunks of the given sizes, and the rows of each chunk are 0, 1, 2, ...
+class RangeSourceOperator final : public SourceOperator {
+public:
+    RangeSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                        std::vector<size_t> chunk_sizes)
+            : SourceOperator(factory, id, "range_source", plan_node_id, false, driver_sequence),
+              _chunk_sizes(std::move(chunk_sizes)) {}
+    ~RangeSourceOperator() override = default;
+
+    bool has_output() const override { return _index < _chunk_sizes.size(); }
+    bool is_finished() const override { return !has_output(); }
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override {
+        auto column = Int32Column::create(_chunk_sizes[_index++], 0);
+        auto& data = column->get_data();
+        std::iota(data.begin(), data.end(), 0);
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), kInputSlotId);
+        return chunk;
+    }
+
+private:
+    std::vector<size_t> _chunk_sizes;
+    size_t _index = 0;
+};
+
+class RangeSourceOperatorFactory final : public SourceOperatorFactory {
+public:
+    RangeSourceOperatorFactory(int32_t id, int32_t plan_node_id, std::vector<size_t> chunk_sizes)
+            : SourceOperatorFactory(id, "range_source", plan_node_id), _chunk_sizes(std::move(chunk_sizes)) {}
+    ~RangeSourceOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<RangeSourceOperator>(this, _id, _plan_node_id, driver_sequence, _chunk_sizes);
+    }
+    SourceOperatorFactory::AdaptiveState adaptive_initial_state() const override { return AdaptiveState::ACTIVE; }
+
+private:
+    std::vector<size_t> _chunk_sizes;
+};
+
+// What the sink receives: whether each chunk has a selection, and the selected rows of all the chunks.
+struct SelectionRecord {
+    std::mutex mutex;
+    std::vector<bool> has_selection;
+    std::vector<int32_t> rows;
+};
+
+class SelectionRecordSinkOperator final : public Operator {
+public:
+    SelectionRecordSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                                bool accept_chunk_selection, SelectionRecord* record)
+            : Operator(factory, id, "selection_record_sink", plan_node_id, false, driver_sequence),
+              _accept_chunk_selection(accept_chunk_selection),
+              _record(record) {}
+    ~SelectionRecordSinkOperator() override = default;
+
+    bool accept_chunk_selection() const override { return _accept_chunk_selection; }
+    bool need_input() const override { return true; }
+    bool has_output() const override { return false; }
+    bool is_finished() const override { return _is_finished; }
+    Status set_finishing(RuntimeState* state) override {
+        _is_finished = true;
+        return Status::OK();
+    }
+
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override {
+        std::lock_guard<std::mutex> l(_record->mutex);
+        _record->has_selection.push_back(chunk->has_selection());
+        const auto& values = down_cast<Int32Column*>(chunk->get_column_by_slot_id(kOutputSlotId).get())->get_data();
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (!chunk->has_selection() || (*chunk->selection())[i]) {
+                _record->rows.push_back(values[i]);
+            }
+        }
+        return Status::OK();
+    }
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override {
+        return Status::InternalError("Shouldn't pull chunk from sink operator");
+    }
+
+private:
+    const bool _accept_chunk_selection;
+    SelectionRecord* _record;
+    bool _is_finished = false;
+};
+
+class SelectionRecordSinkOperatorFactory final : public OperatorFactory {
+public:
+    SelectionRecordSinkOperatorFactory(int32_t id, int32_t plan_node_id, bool accept_chunk_selection,
+                                       SelectionRecord* record)
+            : OperatorFactory(id, "selection_record_sink", plan_node_id),
+              _accept_chunk_selection(accept_chunk_selection),
+              _record(record) {}
+    ~SelectionRecordSinkOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<SelectionRecordSinkOperator>(this, _id, _plan_node_id, driver_sequence,
+                                                             _accept_chunk_selection, _record);
+    }
+
+private:
+    const bool _accept_chunk_selection;
+    SelectionRecord* _record;
+};
+
+// source -> select(input < bound) -> project(output = input) -> sink, with enable_lazy_chunk_selection on.
+class SelectProjectOperatorTest : public PipelineTestBase {
+public:
+    void SetUp() override {
+        _prev_enable_lazy_chunk_selection = config::enable_lazy_chunk_selection;
+        _prev_lazy_chunk_selection_min_density = config::lazy_chunk_selection_min_density;
+        config::enable_lazy_chunk_selection = true;
+        config::lazy_chunk_selection_min_density = 0.5;
+        _vector_chunk_size = 1000;
+    }
+
+    void TearDown() override {
+        config::enable_lazy_chunk_selection = _prev_enable_lazy_chunk_selection;
+        config::lazy_chunk_selection_min_density = _prev_lazy_chunk_selection_min_density;
+    }
+
+protected:
+    void run(const std::vector<size_t>& chunk_sizes, int32_t bound, bool safe_projection, bool sink_accepts) {
+        _pipeline_builder = [&](RuntimeState* state) {
+            OpFactories op_factories;
+            op_factories.push_back(
+                    std::make_shared<RangeSourceOperatorFactory>(next_operator_id(), next_plan_node_id(), chunk_sizes));
+
+            std::vector<ExprContext*> conjunct_ctxs{
+                    _obj_pool->add(new ExprContext(_obj_pool->add(new LessThanExpr(kInputSlotId, bound))))};
+            op_factories.push_back(std::make_shared<SelectOperatorFactory>(next_operator_id(), next_plan_node_id(),
+                                                                           std::move(conjunct_ctxs)));
+
+            Expr* projection = safe_projection
+                                       ? static_cast<Expr*>(new ColumnRef(TypeDescriptor(TYPE_INT), kInputSlotId))
+                                       : static_cast<Expr*>(new FailOnLargeValueExpr(kInputSlotId, bound));
+            std::vector<ExprContext*> expr_ctxs{_obj_pool->add(new ExprContext(_obj_pool->add(projection)))};
+            op_factories.push_back(std::make_shared<ProjectOperatorFactory>(
+                    next_operator_id(), next_plan_node_id(), std::vector<int32_t>{kOutputSlotId}, std::move(expr_ctxs),
+                    std::vector<bool>{false}, std::vector<int32_t>{}, std::vector<ExprContext*>{}));
+
+            op_factories.push_back(std::make_shared<SelectionRecordSinkOperatorFactory>(
+                    next_operator_id(), next_plan_node_id(), sink_accepts, &_record));
+            _pipelines.push_back(std::make_shared<Pipeline>(next_pipeline_id(), op_factories, exec_group.get()));
+        };
+
+        start_test();
+        ASSERT_EQ(std::future_status::ready, _fragment_future.wait_for(std::chrono::seconds(15)));
+    }
+
+    // The rows 0, 1, ..., bound - 1 of each chunk.
+    static std::vector<int32_t> expected_rows(const std::vector<size_t>& chunk_sizes, int32_t bound) {
+        std::vector<int32_t> rows;
+        for (size_t chunk_size : chunk_sizes) {
+            for (int32_t i = 0; i < std::min<int32_t>(chunk_size, bound); ++i) {
+                rows.push_back(i);
+            }
+        }
+        return rows;
+    }
+
+    SelectionRecord _record;
+
+private:
+    bool _prev_enable_lazy_chunk_selection = false;
+    double _prev_lazy_chunk_selection_min_density = 0;
+};
+
+TEST_F(SelectProjectOperatorTest, test_density_above_threshold) {
+    const std::vector<size_t> chunk_sizes{1000, 1000};
+    run(chunk_sizes, 501, true, true);
+    // the selection passes through the project to the sink.
+    ASSERT_EQ(std::vector<bool>({true, true}), _record.has_selection);
+    ASSERT_EQ(expected_rows(chunk_sizes, 501), _record.rows);
+}
+
+TEST_F(SelectProjectOperatorTest, test_density_below_threshold) {
+    const std::vector<size_t> chunk_sizes{1000, 1000};
+    run(chunk_sizes, 499, true, true);
+    for (bool has_selection : _record.has_selection) {
+        ASSERT_FALSE(has_selection);
+    }
+    ASSERT_EQ(expected_rows(chunk_sizes, 499), _record.rows);
+}
+
+TEST_F(SelectProjectOperatorTest, test_small_chunks_compacted) {
+    // dense enough, but the small chunks are compacted to be merged.
+    const std::vector<size_t> chunk_sizes{200, 200, 200};
+    run(chunk_sizes, 150, true, true);
+    ASSERT_FALSE(_record.has_selection.empty());
+    for (bool has_selection : _record.has_selection) {
+        ASSERT_FALSE(has_selection);
+    }
+    ASSERT_EQ(expected_rows(chunk_sizes, 150), _record.rows);
+}
+
+TEST_F(SelectProjectOperatorTest, test_next_operator_not_accepting_selection) {
+    const std::vector<size_t> chunk_sizes{1000, 1000};
+    run(chunk_sizes, 600, true, false);
+    ASSERT_EQ(std::vector<bool>({false, false}), _record.has_selection);
+    ASSERT_EQ(expected_rows(chunk_sizes, 600), _record.rows);
+}
+
+TEST_F(SelectProjectOperatorTest, test_unsafe_projection_compacted) {
+    // the projection fails on the rows filtered out, so it never sees them.
+    const std::vector<size_t> chunk_sizes{1000, 1000};
+    run(chunk_sizes, 600, false, true);
+    ASSERT_EQ(std::vector<bool>({false, false}), _record.has_selection);
+    ASSERT_EQ(expected_rows(chunk_sizes, 600), _record.rows);
+}
+
+} // namespace starrocks::pipeline
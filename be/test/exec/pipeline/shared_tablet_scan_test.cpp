@@ -0,0 +1,186 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/scan/shared_tablet_scan.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "column/schema.h"
+#include "storage/chunk_helper.h"
+
+namespace starrocks::pipeline {
+
+class SharedTabletScanTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        auto c0 = std::make_shared<Field>(0, "c0", TYPE_INT, false);
+        _schema = std::make_shared<Schema>(Fields{c0});
+    }
+
+protected:
+    ChunkPtr _create_chunk(int32_t start, size_t num_rows) {
+        ChunkPtr chunk = ChunkHelper::new_chunk(*_schema, num_rows);
+        auto* column = down_cast<Int32Column*>(chunk->get_column_by_index(0).get());
+        for (size_t i = 0; i < num_rows; i++) {
+            column->append(start + i);
+        }
+        return chunk;
+    }
+
+    static int32_t _first_value(const ChunkUniquePtr& chunk) {
+        return down_cast<Int32Column*>(chunk->get_column_by_index(0).get())->get_data()[0];
+    }
+
+    std::shared_ptr<Schema> _schema;
+};
+
+TEST_F(SharedTabletScanTest, test_publish_and_consume) {
+    SharedTabletScan scan("key", 1L << 30);
+    int f0 = scan.attach();
+    ASSERT_GE(f0, 0);
+
+    ASSERT_TRUE(scan.need_publish());
+    scan.publish(*_create_chunk(0, 10));
+    scan.publish(*_create_chunk(10, 10));
+
+    // Attach after publishing still sees the chunks from the beginning.
+    int f1 = scan.attach();
+    ASSERT_GE(f1, 0);
+    ASSERT_EQ(2, scan.num_followers());
+
+    for (int f : {f0, f1}) {
+        auto res = scan.next(f, 0);
+        ASSERT_TRUE(res.ok());
+        ASSERT_EQ(10, res.value()->num_rows());
+        ASSERT_EQ(0, _first_value(res.value()));
+        res = scan.next(f, 0);
+        ASSERT_TRUE(res.ok());
+        ASSERT_EQ(10, _first_value(res.value()));
+        // No more chunks before the leader finishes.
+        ASSERT_TRUE(scan.next(f, 0).status().is_time_out());
+    }
+
+    scan.finish();
+    for (int f : {f0, f1}) {
+        auto res = scan.next(f, 0);
+        ASSERT_TRUE(res.ok());
+        ASSERT_EQ(nullptr, res.value());
+    }
+}
+
+TEST_F(SharedTabletScanTest, test_consumed_chunks_released) {
+    const int64_t chunk_bytes = _create_chunk(0, 100)->memory_usage();
+    SharedTabletScan scan("key", chunk_bytes * 3 / 2);
+    int f0 = scan.attach();
+
+    scan.publish(*_create_chunk(0, 100));
+    auto res = scan.next(f0, 0);
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(0, _first_value(res.value()));
+    // The consumed chunk is kept for the followers attaching later.
+    ASSERT_TRUE(scan.accept_followers());
+    ASSERT_GT(scan.buffered_bytes(), 0);
+
+    // Exceeding the limit stops accepting followers, and releases the chunks consumed by all the followers.
+    scan.publish(*_create_chunk(100, 100));
+    ASSERT_FALSE(scan.accept_followers());
+    ASSERT_EQ(-1, scan.attach());
+    ASSERT_LE(scan.buffered_bytes(), chunk_bytes * 3 / 2);
+
+    res = scan.next(f0, 0);
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(100, _first_value(res.value()));
+    ASSERT_EQ(0, scan.buffered_bytes());
+
+    scan.detach(f0);
+    ASSERT_FALSE(scan.need_publish());
+}
+
+TEST_F(SharedTabletScanTest, test_evict_slow_follower) {
+    const int64_t chunk_bytes = _create_chunk(0, 100)->memory_usage();
+    SharedTabletScan scan("key", chunk_bytes * 5 / 2);
+    int fast = scan.attach();
+    int slow = scan.attach();
+
+    scan.publish(*_create_chunk(0, 100));
+    scan.publish(*_create_chunk(100, 100));
+    ASSERT_TRUE(scan.next(fast, 0).ok());
+    ASSERT_TRUE(scan.next(fast, 0).ok());
+
+    // The slow follower blocks releasing the chunks, and is evicted when exceeding the limit.
+    scan.publish(*_create_chunk(200, 100));
+    ASSERT_TRUE(scan.next(slow, 0).status().is_aborted());
+    auto res = scan.next(fast, 0);
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(200, _first_value(res.value()));
+    ASSERT_EQ(0, scan.buffered_bytes());
+}
+
+TEST_F(SharedTabletScanTest, test_leader_abort) {
+    SharedTabletScan scan("key", 1L << 30);
+    int f0 = scan.attach();
+    scan.publish(*_create_chunk(0, 10));
+    scan.abort();
+    ASSERT_TRUE(scan.next(f0, 0).status().is_aborted());
+    ASSERT_EQ(-1, scan.attach());
+
+    // Abort after finishing has no effect.
+    SharedTabletScan finished_scan("key", 1L << 30);
+    int f1 = finished_scan.attach();
+    finished_scan.publish(*_create_chunk(0, 10));
+    finished_scan.finish();
+    finished_scan.abort();
+    ASSERT_TRUE(finished_scan.next(f1, 0).ok());
+}
+
+TEST_F(SharedTabletScanTest, test_wait_for_leader) {
+    SharedTabletScan scan("key", 1L << 30);
+    int f0 = scan.attach();
+    std::thread leader([&] {
+        scan.publish(*_create_chunk(0, 10));
+        scan.finish();
+    });
+    auto res = scan.next(f0, 10L * 1000 * 1000);
+    leader.join();
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(0, _first_value(res.value()));
+}
+
+TEST_F(SharedTabletScanTest, test_manager) {
+    auto* manager = SharedTabletScanManager::instance();
+    int follower_id = 0;
+    auto leader_scan = manager->attach_or_create("test_manager", &follower_id);
+    ASSERT_EQ(-1, follower_id);
+
+    auto follower_scan = manager->attach_or_create("test_manager", &follower_id);
+    ASSERT_EQ(leader_scan, follower_scan);
+    ASSERT_GE(follower_id, 0);
+
+    // A different key creates another shared scan.
+    auto other_scan = manager->attach_or_create("test_manager_other", &follower_id);
+    ASSERT_NE(leader_scan, other_scan);
+    ASSERT_EQ(-1, follower_id);
+
+    // The scan not accepting followers is replaced by a new one.
+    leader_scan->abort();
+    auto new_scan = manager->attach_or_create("test_manager", &follower_id);
+    ASSERT_NE(leader_scan, new_scan);
+    ASSERT_EQ(-1, follower_id);
+}
+
+} // namespace starrocks::pipeline
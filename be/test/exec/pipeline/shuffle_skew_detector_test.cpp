@@ -0,0 +1,75 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/shuffle_skew_detector.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/parallel_test.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks::pipeline {
+
+PARALLEL_TEST(ShuffleSkewDetectorTest, test_detect_hot_keys) {
+    const size_t num_partitions = 4;
+    ShuffleSkewDetector detector(num_partitions, 1000);
+
+    // Half of the rows have key 7, a quarter have key 8, and the others are distinct.
+    std::vector<uint32_t> hash_values;
+    std::vector<uint32_t> partitions;
+    for (uint32_t i = 0; i < 600; i++) {
+        uint32_t hash = i % 2 == 0 ? 7 : (i % 4 == 1 ? 8 : 100 + i);
+        hash_values.push_back(hash);
+        partitions.push_back(hash % num_partitions);
+    }
+    detector.sample(hash_values.data(), partitions.data(), hash_values.size());
+    ASSERT_TRUE(detector.is_sampling());
+    // Only 400 rows of the second chunk are sampled.
+    detector.sample(hash_values.data(), partitions.data(), hash_values.size());
+    ASSERT_FALSE(detector.is_sampling());
+    ASSERT_EQ(1000, detector.num_sampled_rows());
+
+    const auto& hot_keys = detector.hot_keys();
+    ASSERT_EQ(1, hot_keys.size());
+    ASSERT_EQ(7, hot_keys[0].hash);
+    ASSERT_EQ(500, hot_keys[0].num_rows);
+    // Partition 3 has the rows of key 7.
+    ASSERT_GT(detector.skew_ratio(), 2);
+
+    RuntimeProfile profile("test");
+    detector.update_profile(&profile);
+    ASSERT_EQ("1 (50.00% of sampled rows)", *profile.get_info_string("ShuffleHotKeys"));
+}
+
+PARALLEL_TEST(ShuffleSkewDetectorTest, test_no_skew) {
+    const size_t num_partitions = 4;
+    ShuffleSkewDetector detector(num_partitions, 1000);
+    std::vector<uint32_t> hash_values;
+    std::vector<uint32_t> partitions;
+    for (uint32_t i = 0; i < 100; i++) {
+        hash_values.push_back(i);
+        partitions.push_back(i % num_partitions);
+    }
+    detector.sample(hash_values.data(), partitions.data(), hash_values.size());
+    ASSERT_TRUE(detector.is_sampling());
+
+    // Detect with the sampled rows.
+    RuntimeProfile profile("test");
+    detector.update_profile(&profile);
+    ASSERT_TRUE(detector.hot_keys().empty());
+    ASSERT_DOUBLE_EQ(1, detector.skew_ratio());
+    ASSERT_EQ("1.00", *profile.get_info_string("ShuffleSkewRatio"));
+}
+
+} // namespace starrocks::pipeline
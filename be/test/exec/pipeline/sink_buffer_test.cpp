@@ -0,0 +1,104 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/sink_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "common/config.h"
+
+namespace starrocks::pipeline {
+
+class ChannelFlowControlTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _saved_enable = config::enable_exchange_sink_credit_flow_control;
+        config::enable_exchange_sink_credit_flow_control = true;
+    }
+    void TearDown() override { config::enable_exchange_sink_credit_flow_control = _saved_enable; }
+
+private:
+    bool _saved_enable = false;
+};
+
+TEST_F(ChannelFlowControlTest, test_no_credit_advertised) {
+    ChannelFlowControl flow_control;
+    flow_control.on_sent(1L << 30);
+    ASSERT_FALSE(flow_control.is_blocked(1, 1L << 30));
+}
+
+// A receiver without credit acks the only request in flight and advertises its credit again,
+// so one request is always allowed.
+TEST_F(ChannelFlowControlTest, test_one_request_in_flight_allowed) {
+    ChannelFlowControl flow_control;
+    flow_control.credit_bytes = 0;
+    ASSERT_FALSE(flow_control.is_blocked(0, 1000));
+
+    flow_control.on_sent(1000);
+    ASSERT_TRUE(flow_control.is_blocked(1, 1));
+
+    flow_control.on_acked(1000);
+    ASSERT_EQ(0, flow_control.in_flight_bytes);
+    ASSERT_FALSE(flow_control.is_blocked(0, 1000));
+}
+
+// Requests are blocked while the credit left after the bytes in flight would be negative.
+TEST_F(ChannelFlowControlTest, test_blocked_while_credit_exceeded) {
+    ChannelFlowControl flow_control;
+    flow_control.credit_bytes = 1000;
+    flow_control.on_sent(600);
+    ASSERT_FALSE(flow_control.is_blocked(1, 400));
+    ASSERT_TRUE(flow_control.is_blocked(1, 401));
+
+    flow_control.on_sent(400);
+    ASSERT_TRUE(flow_control.is_blocked(2, 1));
+
+    // The ack of the first request advertises the credit left after it is received.
+    flow_control.on_acked(600);
+    flow_control.credit_bytes = 500;
+    ASSERT_FALSE(flow_control.is_blocked(1, 100));
+    ASSERT_TRUE(flow_control.is_blocked(1, 101));
+    ASSERT_EQ(1000, flow_control.bytes_sent);
+}
+
+TEST_F(ChannelFlowControlTest, test_wait_time) {
+    ChannelFlowControl flow_control;
+    flow_control.credit_bytes = 0;
+    flow_control.on_sent(100);
+    flow_control.on_blocked();
+    const int64_t wait_start_timestamp = flow_control.wait_start_timestamp;
+    ASSERT_NE(-1, wait_start_timestamp);
+    // Blocked again before sending, the wait keeps its start.
+    flow_control.on_blocked();
+    ASSERT_EQ(wait_start_timestamp, flow_control.wait_start_timestamp);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    flow_control.on_acked(100);
+    flow_control.on_sent(100);
+    ASSERT_EQ(-1, flow_control.wait_start_timestamp);
+    ASSERT_GE(flow_control.wait_time, 1000000);
+    ASSERT_EQ(200, flow_control.bytes_sent);
+}
+
+TEST_F(ChannelFlowControlTest, test_disabled) {
+    config::enable_exchange_sink_credit_flow_control = false;
+    ChannelFlowControl flow_control;
+    flow_control.credit_bytes = 0;
+    flow_control.on_sent(1000);
+    ASSERT_FALSE(flow_control.is_blocked(1, 1000));
+}
+
+} // namespace starrocks::pipeline
@@ -181,4 +181,31 @@ TEST_F(MemStateTableTest, TestPrefixSeek) {
                       });
 }
 
+TEST_F(MemStateTableTest, TestEpochCheckpoint) {
+    auto tuple_desc = _tbl->get_tuple_descriptor(0);
+    auto state_table = std::make_unique<MemStateTable>(tuple_desc->slots(), 1);
+    auto chunk_ptr = MakeStreamChunk<int32_t>({{1, 2, 3}, {1, 2, 3}, {1, 2, 3}, {11, 12, 13}}, {0, 0, 0});
+    ASSERT_TRUE(state_table->write(_runtime_state, chunk_ptr).ok());
+    ASSERT_TRUE(state_table->commit(_runtime_state).ok());
+
+    // update key 1 and delete key 2 in the next epoch, which are visible before the commit
+    auto chunk_ptr2 = MakeStreamChunk<int32_t>({{1, 2}, {1, 2}, {1, 2}, {21, 12}}, {0, 1});
+    ASSERT_TRUE(state_table->write(_runtime_state, chunk_ptr2).ok());
+    check_seek(state_table.get(), {1}, {1, 1, 21});
+    check_seek_not_found(state_table.get(), {2});
+    check_seek(state_table.get(), {3}, {3, 3, 13});
+
+    // the epoch fails, and the state goes back to the last commit
+    ASSERT_TRUE(state_table->reset_epoch(_runtime_state).ok());
+    check_seek(state_table.get(), {1}, {1, 1, 11});
+    check_seek(state_table.get(), {2}, {2, 2, 12});
+
+    ASSERT_TRUE(state_table->write(_runtime_state, chunk_ptr2).ok());
+    ASSERT_TRUE(state_table->commit(_runtime_state).ok());
+    ASSERT_TRUE(state_table->reset_epoch(_runtime_state).ok());
+    check_seek(state_table.get(), {1}, {1, 1, 21});
+    check_seek_not_found(state_table.get(), {2});
+    check_seek(state_table.get(), {3}, {3, 3, 13});
+}
+
 } // namespace starrocks::stream
@@ -339,6 +339,48 @@ TEST_F(AggregateTest, test_sum) {
                                                       DecimalV2Value{24});
 }
 
+TEST_F(AggregateTest, test_sum_count_update_batch_with_state_runs) {
+    const AggregateFunction* sum_func = get_aggregate_function("sum", TYPE_INT, TYPE_BIGINT, false);
+    const AggregateFunction* count_func = get_aggregate_function("count", TYPE_BIGINT, TYPE_BIGINT, false);
+    auto input = Int32Column::create();
+    for (int i = 0; i < 1024; i++) {
+        input->append(i);
+    }
+    const Column* columns[] = {input.get()};
+
+    // group of row i is (i / run_length) % 3, run_length 1 doesn't have runs.
+    for (size_t run_length : {1, 7, 64}) {
+        std::vector<std::unique_ptr<ManagedAggrState>> sum_states;
+        std::vector<std::unique_ptr<ManagedAggrState>> count_states;
+        for (int g = 0; g < 3; g++) {
+            sum_states.emplace_back(ManagedAggrState::create(ctx, sum_func));
+            count_states.emplace_back(ManagedAggrState::create(ctx, count_func));
+        }
+        std::vector<AggDataPtr> sum_ptrs(input->size());
+        std::vector<AggDataPtr> count_ptrs(input->size());
+        int64_t expected_sums[3] = {0, 0, 0};
+        int64_t expected_counts[3] = {0, 0, 0};
+        for (size_t i = 0; i < input->size(); i++) {
+            size_t g = (i / run_length) % 3;
+            sum_ptrs[i] = sum_states[g]->state();
+            count_ptrs[i] = count_states[g]->state();
+            expected_sums[g] += i;
+            expected_counts[g]++;
+        }
+        sum_func->update_batch(ctx, input->size(), 0, columns, sum_ptrs.data());
+        count_func->update_batch(ctx, input->size(), 0, columns, count_ptrs.data());
+
+        for (int g = 0; g < 3; g++) {
+            auto sum_result = Int64Column::create();
+            sum_func->finalize_to_column(ctx, sum_states[g]->state(), sum_result.get());
+            ASSERT_EQ(expected_sums[g], sum_result->get_data()[0]);
+            auto count_result = Int64Column::create();
+            count_func->finalize_to_column(ctx, count_states[g]->state(), count_result.get());
+            ASSERT_EQ(expected_counts[g], count_result->get_data()[0]);
+        }
+    }
+}
+
 TEST_F(AggregateTest, test_decimal_sum) {
     {
         const auto* func = get_aggregate_function("decimal_sum", TYPE_DECIMAL32, TYPE_DECIMAL128, false,
@@ -1014,6 +1056,49 @@ TEST_F(AggregateTest, test_count_distinct) {
     test_agg_function<DateValue, int64_t>(ctx, func, 20, 21, 40);
 }
 
+TEST_F(AggregateTest, test_count_distinct_merge_batch) {
+    for (const char* name : {"multi_distinct_count", "multi_distinct_count2"}) {
+        const AggregateFunction* func = get_aggregate_function(name, TYPE_INT, TYPE_BIGINT, false);
+
+        // single values as passed through by the pre-aggregation, followed by a serialized hash set
+        auto values = Int32Column::create();
+        for (int i = 0; i < 1024; i++) {
+            values->append(i % 1000);
+        }
+        ColumnPtr serde_column = BinaryColumn::create();
+        func->convert_to_serialize_format(ctx, Columns{values}, values->size(), &serde_column);
+
+        auto set_state = ManagedAggrState::create(ctx, func);
+        auto set_values = Int32Column::create();
+        for (int i = 500; i < 1500; i++) {
+            set_values->append(i);
+        }
+        const Column* row_column = set_values.get();
+        func->update_batch_single_state(ctx, row_column->size(), &row_column, set_state->state());
+        func->serialize_to_column(ctx, set_state->state(), serde_column.get());
+
+        auto state = ManagedAggrState::create(ctx, func);
+        func->merge_batch_single_state(ctx, state->state(), serde_column.get(), 0, serde_column->size());
+
+        // even rows to state1, odd rows and the hash set to state2
+        auto state1 = ManagedAggrState::create(ctx, func);
+        auto state2 = ManagedAggrState::create(ctx, func);
+        std::vector<AggDataPtr> states;
+        for (size_t i = 0; i < serde_column->size(); i++) {
+            states.push_back(i % 2 == 0 && i < values->size() ? state1->state() : state2->state());
+        }
+        func->merge_batch(ctx, serde_column->size(), 0, serde_column.get(), states.data());
+
+        auto result_column = Int64Column::create();
+        func->finalize_to_column(ctx, state->state(), result_column.get());
+        func->finalize_to_column(ctx, state1->state(), result_column.get());
+        func->finalize_to_column(ctx, state2->state(), result_column.get());
+        ASSERT_EQ(1500, result_column->get_data()[0]);
+        ASSERT_EQ(500, result_column->get_data()[1]);
+        ASSERT_EQ(1250, result_column->get_data()[2]);
+    }
+}
+
 TEST_F(AggregateTest, test_sum_distinct) {
     const AggregateFunction* func = get_aggregate_function("multi_distinct_sum", TYPE_SMALLINT, TYPE_BIGINT, false);
     test_agg_function<int16_t, int64_t>(ctx, func, 523776, 2499500, 3023276);
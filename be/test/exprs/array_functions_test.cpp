@@ -4824,6 +4824,17 @@ TEST_F(ArrayFunctionsTest, array_distinct_only_null) {
         ASSERT_EQ(dest_column->size(), 1);
         ASSERT_STREQ(dest_column->debug_string().c_str(), "[['5','33','666']]");
     }
+    // test null rows and null elements
+    {
+        auto src_column = ColumnHelper::create_column(TYPE_ARRAY_INT, true);
+        src_column->append_datum(DatumArray{1, Datum(), 1, 2, Datum(), 2});
+        src_column->append_datum(Datum());
+        src_column->append_datum(DatumArray{});
+        src_column->append_datum(DatumArray{3, 3, 4, 3});
+        auto dest_column = ArrayDistinct<TYPE_INT>::process(nullptr, {src_column});
+        ASSERT_EQ(dest_column->size(), 4);
+        ASSERT_STREQ(dest_column->debug_string().c_str(), "[[1,NULL,2], NULL, [], [3,4]]");
+    }
 }
 
 TEST_F(ArrayFunctionsTest, array_sortby_tinyint_with_nullable) {
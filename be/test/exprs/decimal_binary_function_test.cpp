@@ -3130,6 +3130,49 @@ TEST_F(DecimalBinaryFunctionTest, test_decimal_fast_mul_64x64) {
                                                                                                 4, 38, 8);
 }
 
+TEST_F(DecimalBinaryFunctionTest, test_decimal128_narrow_evaluate) {
+    // the operands fit in 64 bits
+    DecimalTestCaseArray mul_cases = {{"12345.6789", "2.5", "30864.19725000000000000000"},
+                                      {"-98765.4321", "-0.0001", "9.87654321000000000000"},
+                                      {"0", "123.45", "0"},
+                                      {"922337.2036854775", "-1.0000000001", "-922337.20377771122036854775"}};
+    test_vector_vector<TYPE_DECIMAL128, MulOp, OverflowMode::OUTPUT_NULL>(mul_cases, 38, 10, 38, 10, 38, 20);
+    test_vector_const<TYPE_DECIMAL128, MulOp, OverflowMode::OUTPUT_NULL>(mul_cases, 38, 10, 38, 10, 38, 20);
+    test_const_vector<TYPE_DECIMAL128, MulOp, OverflowMode::IGNORE>(mul_cases, 38, 10, 38, 10, 38, 20);
+
+    // the operands are wider than 64 bits, but the products can not overflow
+    mul_cases.emplace_back("123456789012.3456789012", "0.0000000123", "1518.51850485185185048476");
+    mul_cases.emplace_back("-9999999999999999999.9999999999", "0.0000000001", "-999999999.99999999999999999999");
+    test_vector_vector<TYPE_DECIMAL128, MulOp, OverflowMode::OUTPUT_NULL>(mul_cases, 38, 10, 38, 10, 38, 20);
+
+    // one product overflows, so the chunk is left to the checked loop
+    mul_cases.emplace_back("9999999999999999999.9999999999", "9999999999999999999.9999999999", "0");
+    std::vector<bool> mul_overflows = {false, false, false, false, false, false, true};
+    test_vector_vector_assert_overflow<TYPE_DECIMAL128, MulOp, OverflowMode::OUTPUT_NULL>(mul_cases, 38, 10, 38, 10,
+                                                                                          38, 20, mul_overflows);
+
+    // the lhs is scaled up by 10^6, the last row is too wide to skip the overflow checks
+    DecimalTestCaseArray add_cases = {{"12345.6789", "2.5000000001", "12348.1789000001"},
+                                      {"-0.0001", "-922337203.6854775807", "-922337203.6855775807"}};
+    test_vector_vector<TYPE_DECIMAL128, AddOp, OverflowMode::OUTPUT_NULL>(add_cases, 38, 4, 38, 10, 38, 10);
+    test_vector_vector<TYPE_DECIMAL128, SubOp, OverflowMode::OUTPUT_NULL>(
+            {{"12345.6789", "2.5000000001", "12343.1788999999"}}, 38, 4, 38, 10, 38, 10);
+    add_cases.emplace_back("9999999999999999999999999999.9999", "0.0000000001",
+                           "9999999999999999999999999999.9999000001");
+    test_vector_vector<TYPE_DECIMAL128, AddOp, OverflowMode::OUTPUT_NULL>(add_cases, 38, 4, 38, 10, 38, 10);
+
+    // the scaled dividends and the divisors fit in 63 bits, a zero divisor leaves the chunk to the checked loop
+    DecimalTestCaseArray div_cases = {{"12345.678901", "2.5", "4938.271560400000"},
+                                      {"-1.000001", "3", "-0.333333666667"},
+                                      {"922337.203685", "-0.000007", "-131762457669.285714285714"}};
+    test_vector_vector<TYPE_DECIMAL128, DivOp, OverflowMode::OUTPUT_NULL>(div_cases, 38, 6, 38, 6, 38, 12);
+    test_const_vector<TYPE_DECIMAL128, DivOp, OverflowMode::OUTPUT_NULL>(div_cases, 38, 6, 38, 6, 38, 12);
+    div_cases.emplace_back("1", "0", "0");
+    std::vector<bool> div_overflows = {false, false, false, true};
+    test_vector_vector_assert_overflow<TYPE_DECIMAL128, DivOp, OverflowMode::OUTPUT_NULL>(div_cases, 38, 6, 38, 6, 38,
+                                                                                          12, div_overflows);
+}
+
 TEST_F(DecimalBinaryFunctionTest, test_overflow_report_error) {
     ASSERT_THROW((test_overflow_report_error<TYPE_DECIMAL32, TYPE_DECIMAL32, TYPE_DECIMAL32, MulOp>(
                          "274.97790", "1.0000", 9, 5, 9, 4)),
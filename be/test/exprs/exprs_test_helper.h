@@ -19,6 +19,7 @@
 #include <random>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exprs/array_expr.h"
 #include "exprs/jit/jit_expr.h"
 #include "exprs/mock_vectorized_expr.h"
@@ -29,6 +30,7 @@
 #include "runtime/runtime_state.h"
 #include "storage/chunk_helper.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 class ExprsTestHelper {
@@ -219,6 +221,10 @@ public:
         }
         DCHECK(runtime_state != nullptr);
         runtime_state->set_jit_level(-1);
+        // Compiles in place to verify the compiled function.
+        auto async_compile = config::jit_async_compile;
+        config::jit_async_compile = false;
+        DeferOp restore([async_compile]() { config::jit_async_compile = async_compile; });
         ObjectPool pool;
         auto* jit_expr = JITExpr::create(&pool, expr);
         jit_expr->set_uncompilable_children(runtime_state);
@@ -243,6 +249,10 @@ public:
         }
         DCHECK(runtime_state != nullptr);
         runtime_state->set_jit_level(-1);
+        // Compiles in place to verify the compiled function.
+        auto async_compile = config::jit_async_compile;
+        config::jit_async_compile = false;
+        DeferOp restore([async_compile]() { config::jit_async_compile = async_compile; });
         ObjectPool pool;
         auto* jit_expr = JITExpr::create(&pool, expr);
         jit_expr->set_uncompilable_children(runtime_state);
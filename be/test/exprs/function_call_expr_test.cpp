@@ -20,9 +20,11 @@
 #include <cmath>
 
 #include "butil/time.h"
+#include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
 #include "exprs/cast_expr.h"
+#include "exprs/column_ref.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/mem_tracker.h"
 #include "runtime/runtime_state.h"
@@ -307,4 +309,55 @@ TEST_F(VectorizedFunctionCallExprTest, prepare_close) {
     expr_context.close(&_runtime_state);
 }
 
+TEST_F(VectorizedFunctionCallExprTest, evaluateWithFilter) {
+    TFunction function;
+    TFunctionName functionName;
+    functionName.__set_db_name("db");
+    functionName.__set_function_name("mod");
+    function.__set_name(functionName);
+    function.__set_binary_type(TFunctionBinaryType::BUILTIN);
+    function.__set_arg_types({});
+    function.__set_has_var_args(false);
+    function.__set_fid(10252);
+    expr_node.__set_fn(function);
+
+    VectorizedFunctionCallExpr expr(expr_node);
+    ColumnRef col1(TypeDescriptor(TYPE_INT), 1);
+    MockVectorizedExpr<TYPE_INT> col2(expr_node, 10, 3);
+    expr.add_child(&col1);
+    expr.add_child(&col2);
+
+    auto chunk = std::make_shared<Chunk>();
+    auto column = Int32Column::create();
+    for (int i = 0; i < 10; i++) {
+        column->append(i);
+    }
+    chunk->append_column(std::move(column), 1);
+
+    ExprContext exprContext(&expr);
+    std::vector<ExprContext*> expr_ctxs = {&exprContext};
+    ASSERT_OK(Expr::prepare(expr_ctxs, &_runtime_state));
+    ASSERT_OK(Expr::open(expr_ctxs, &_runtime_state));
+
+    // The selected rows are evaluated only and scattered back.
+    Filter filter(10, 0);
+    filter[4] = 1;
+    filter[8] = 1;
+    ASSIGN_OR_ABORT(auto result, exprContext.evaluate(chunk.get(), filter.data()));
+    ASSERT_EQ(10, result->size());
+    ASSERT_EQ(1, result->get(4).get_int32());
+    ASSERT_EQ(2, result->get(8).get_int32());
+
+    // Too many selected rows, all the rows are evaluated.
+    filter.assign(10, 1);
+    filter[0] = 0;
+    ASSIGN_OR_ABORT(result, exprContext.evaluate(chunk.get(), filter.data()));
+    ASSERT_EQ(10, result->size());
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(i % 3, result->get(i).get_int32());
+    }
+
+    Expr::close(expr_ctxs, &_runtime_state);
+}
+
 } // namespace starrocks
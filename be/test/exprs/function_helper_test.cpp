@@ -118,4 +118,21 @@ TEST_F(FunctionHelperTest, testMergeNotNullableColumnMergeWithNullColumn) {
         }
     }
 }
+
+TEST_F(FunctionHelperTest, testUnionNullableColumnWithNullFreeColumn) {
+    ColumnPtr null_free = NullableColumn::create(Int32Column::create(10, 1), NullColumn::create(10, 0));
+    auto null_column = NullColumn::create();
+    for (int i = 0; i < 10; ++i) {
+        null_column->append(i % 2 == 0 ? DATUM_NOT_NULL : DATUM_NULL);
+    }
+    ColumnPtr nullable = NullableColumn::create(Int32Column::create(10, 1), std::move(null_column));
+
+    for (const auto& result : {FunctionHelper::union_nullable_column(null_free, nullable),
+                               FunctionHelper::union_nullable_column(nullable, null_free)}) {
+        ASSERT_EQ(10, result->size());
+        for (int i = 0; i < 10; ++i) {
+            ASSERT_EQ(i % 2, result->get_data()[i]);
+        }
+    }
+}
 } // namespace starrocks
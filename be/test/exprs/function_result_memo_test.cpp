@@ -0,0 +1,97 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/function_result_memo.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+// NOLINTNEXTLINE
+TEST(FunctionResultMemoTest, test_evaluate) {
+    ASSERT_TRUE(FunctionResultMemo::is_memoizable_function("regexp_extract"));
+    ASSERT_FALSE(FunctionResultMemo::is_memoizable_function("rand"));
+
+    // concat(value, suffix), which counts the values it is called on
+    size_t num_calls = 0;
+    FunctionResultMemo::Function fn = [&num_calls](const Columns& args) -> StatusOr<ColumnPtr> {
+        const size_t num_rows = args[0]->size();
+        num_calls += num_rows;
+        const Slice suffix = ColumnHelper::get_const_value<TYPE_VARCHAR>(args[1]);
+        auto result = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+        for (size_t i = 0; i < num_rows; i++) {
+            if (args[0]->is_null(i)) {
+                result->append_nulls(1);
+            } else {
+                result->append_datum(Datum(Slice(args[0]->get(i).get_slice().to_string() + suffix.to_string())));
+            }
+        }
+        return result;
+    };
+
+    auto values = BinaryColumn::create();
+    auto nulls = NullColumn::create();
+    for (int i = 0; i < 10; i++) {
+        values->append(std::to_string(i % 3));
+        nulls->append(i == 5);
+    }
+    ColumnPtr input = NullableColumn::create(std::move(values), std::move(nulls));
+    Columns args{input, ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice("x"), 10)};
+    size_t arg_index = 0;
+    ASSERT_TRUE(FunctionResultMemo::is_memoizable_args(args, &arg_index));
+    ASSERT_EQ(0, arg_index);
+
+    FunctionResultMemo memo;
+    for (int round = 0; round < 2; round++) {
+        ASSIGN_OR_ABORT(auto result, memo.evaluate(args, arg_index, 10, fn));
+        ASSERT_EQ(10, result->size());
+        for (int i = 0; i < 10; i++) {
+            if (i == 5) {
+                ASSERT_TRUE(result->is_null(i));
+            } else {
+                ASSERT_EQ(std::to_string(i % 3) + "x", result->get(i).get_slice().to_string());
+            }
+        }
+        // the 3 values and the null are evaluated once only
+        ASSERT_EQ(4, num_calls);
+        ASSERT_EQ(4, memo.size());
+    }
+    ASSERT_TRUE(memo.enabled());
+
+    // the memo is given up for the distinct values
+    const int32_t probe_rows = config::expr_result_memoization_probe_rows;
+    config::expr_result_memoization_probe_rows = 10;
+    DeferOp defer([probe_rows]() { config::expr_result_memoization_probe_rows = probe_rows; });
+    auto distinct = BinaryColumn::create();
+    for (int i = 0; i < 10; i++) {
+        distinct->append("d" + std::to_string(i));
+    }
+    Columns distinct_args{std::move(distinct), args[1]};
+    FunctionResultMemo distinct_memo;
+    ASSIGN_OR_ABORT(auto result, distinct_memo.evaluate(distinct_args, 0, 10, fn));
+    ASSERT_EQ("d9x", result->get(9).get_slice().to_string());
+    ASSERT_FALSE(distinct_memo.enabled());
+
+    // the arguments with more than one non-constant column are not memoized
+    ASSERT_FALSE(FunctionResultMemo::is_memoizable_args({input, input}, &arg_index));
+}
+
+} // namespace starrocks
@@ -20,7 +20,9 @@
 #include "butil/time.h"
 #include "column/binary_column.h"
 #include "column/column_helper.h"
+#include "column/column_viewer.h"
 #include "column/fixed_length_column.h"
+#include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
 
 namespace starrocks {
@@ -59,6 +61,7 @@ public:
     }
 
 public:
+    RuntimeState runtime_state;
     TExprNode expr_node;
     TTypeDesc ttype_desc;
     std::vector<bool> is_not_in;
@@ -479,4 +482,41 @@ TEST_F(VectorizedInPredicateTest, inArrayConstAllNULL) {
     }
 }
 
+TEST_F(VectorizedInPredicateTest, intInWithJit) {
+    for (bool not_in : is_not_in) {
+        expr_node.child_type = TPrimitiveType::INT;
+        expr_node.opcode = TExprOpcode::FILTER_IN;
+        expr_node.type = gen_type_desc(TPrimitiveType::INT);
+        expr_node.in_predicate.is_not_in = not_in;
+
+        auto expr = std::unique_ptr<Expr>(VectorizedInPredicateFactory::from_thrift(expr_node));
+
+        // 1, 7, 1, 7, ...
+        MockMultiVectorizedExpr<TYPE_INT> col1(expr_node, 10, 1, 7);
+        MockConstVectorizedExpr<TYPE_INT> col2(expr_node, 1);
+        MockConstVectorizedExpr<TYPE_INT> col3(expr_node, 2);
+        MockConstVectorizedExpr<TYPE_INT> col4(expr_node, 3);
+
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+        expr->_children.push_back(&col3);
+        expr->_children.push_back(&col4);
+
+        ASSERT_TRUE(expr->prepare(nullptr, nullptr).ok());
+        ASSERT_TRUE(expr->open(nullptr, nullptr, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+        ASSERT_TRUE(expr->is_compilable(&runtime_state));
+
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [not_in](ColumnPtr const& ptr) {
+            ASSERT_EQ(10, ptr->size());
+            ColumnViewer<TYPE_BOOLEAN> viewer(ptr);
+            for (int j = 0; j < ptr->size(); ++j) {
+                ASSERT_FALSE(viewer.is_null(j));
+                bool found = j % 2 == 0;
+                ASSERT_EQ(found != not_in, viewer.value(j) != 0) << j;
+            }
+        });
+    }
+}
+
 } // namespace starrocks
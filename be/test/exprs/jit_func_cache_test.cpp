@@ -18,10 +18,13 @@
 #include "butil/time.h"
 #include "column/column_hash.h"
 #include "column/fixed_length_column.h"
+#include "common/config.h"
 #include "exprs/arithmetic_expr.h"
 #include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -200,4 +203,49 @@ TEST_F(JITFunctionCacheTest, cache) {
         }
     }
 }
+
+// The original expression is evaluated until the function is compiled in the background, which is inserted into the
+// cache for the later queries.
+TEST_F(JITFunctionCacheTest, async_compile) {
+    if (!engine->support_jit()) {
+        return;
+    }
+    auto async_compile = config::jit_async_compile;
+    config::jit_async_compile = true;
+    DeferOp restore([async_compile]() { config::jit_async_compile = async_compile; });
+
+    expr_node.opcode = TExprOpcode::MULTIPLY;
+    expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+    std::unique_ptr<Expr> expr(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+    MockVectorizedExpr<TYPE_BIGINT> col1(expr_node, 10, 3);
+    MockVectorizedExpr<TYPE_BIGINT> col2(expr_node, 10, 5);
+    expr->_children.push_back(&col1);
+    expr->_children.push_back(&col2);
+
+    runtime_state.set_jit_level(-1);
+    auto func_obj = std::make_unique<JitObjectCache>(expr->jit_func_name(&runtime_state), engine->get_func_cache());
+    ASSERT_FALSE(engine->lookup_function(func_obj.get()));
+
+    ObjectPool pool;
+    auto* jit_expr = JITExpr::create(&pool, expr.get());
+    jit_expr->set_uncompilable_children(&runtime_state);
+    ExprContext context(jit_expr);
+    std::vector<ExprContext*> expr_ctxs = {&context};
+    ASSERT_OK(Expr::prepare(expr_ctxs, &runtime_state));
+    ASSERT_OK(Expr::open(expr_ctxs, &runtime_state));
+
+    // Evaluated either by the interpreter or by the compiled function.
+    auto ptr = jit_expr->evaluate(&context, nullptr);
+    auto v = std::static_pointer_cast<Int64Column>(ptr);
+    ASSERT_EQ(10, v->size());
+    for (int j = 0; j < v->size(); ++j) {
+        ASSERT_EQ(15, v->get_data()[j]);
+    }
+
+    // Waits for the compilation.
+    Expr::close(expr_ctxs, &runtime_state);
+    ASSERT_TRUE(jit_expr->is_jit_compiled());
+    ASSERT_TRUE(engine->lookup_function(func_obj.get()));
+}
+
 } // namespace starrocks
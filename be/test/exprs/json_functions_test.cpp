@@ -1235,6 +1235,55 @@ TEST_F(JsonFunctionsTest, extract_from_object_test) {
     EXPECT_STATUS(Status::NotFound(""), test_extract_from_object(R"({"key1": null})", "$.key1[1].key4", &output));
 }
 
+TEST_F(JsonFunctionsTest, extract_by_shape_cache_test) {
+    std::vector<std::string> docs = {
+            R"({"a": 1, "b": {"c": 2, "d": [1, 2]}, "e": 3})",
+            R"({"a": 4, "b": {"c": 5, "d": [3, 4]}, "e": 6})",
+            // other keys before the path
+            R"({"0": 0, "a": 7, "b": {"0": 0, "c": 8, "d": [5]}})",
+            R"({"a": 9})",
+            R"({"b": 10})",
+            R"({"b": {"c": [{"x": 1}, {"x": 2}]}})",
+            R"([1, 2])",
+            R"({"a": 11, "b": {"c": 12, "d": [6, 7]}, "e": 13})",
+    };
+    std::vector<std::string> paths = {"$.a", "$.b.c", "$.b.d[1]", "$.b.c[*].x", "$.e", "$.f"};
+    for (const auto& path_str : paths) {
+        auto path = JsonPath::parse(path_str);
+        ASSERT_OK(path.status());
+        JsonPathShapeCache cache;
+        // repeats the documents for the consecutive hits and misses
+        for (int i = 0; i < 3 * docs.size(); i++) {
+            auto json = JsonValue::parse(docs[i % docs.size()]);
+            ASSERT_OK(json.status());
+            vpack::Builder expected_builder;
+            vpack::Builder builder;
+            vpack::Slice expected = JsonPath::extract(&json.value(), path.value(), &expected_builder);
+            vpack::Slice actual = JsonPath::extract(&json.value(), path.value(), &builder, &cache);
+            ASSERT_EQ(expected.isNone(), actual.isNone()) << path_str << " of " << docs[i % docs.size()];
+            if (!expected.isNone()) {
+                ASSERT_EQ(JsonValue(expected).to_string_uncheck(), JsonValue(actual).to_string_uncheck())
+                        << path_str << " of " << docs[i % docs.size()];
+            }
+        }
+    }
+
+    // a column of the same shape
+    auto path = JsonPath::parse("$.b.c");
+    ASSERT_OK(path.status());
+    JsonPathShapeCache cache;
+    for (int i = 0; i < 10; i++) {
+        auto json = JsonValue::parse(fmt::format(R"({{"a": {}, "b": {{"c": {}, "d": 0}}}})", i, i * 2));
+        ASSERT_OK(json.status());
+        vpack::Builder builder;
+        vpack::Slice slice = JsonPath::extract(&json.value(), path.value(), &builder, &cache);
+        ASSERT_EQ(i * 2, slice.getInt());
+    }
+    // "c" is at the initial position 0 of the first document, and both keys are at the remembered positions
+    // since the second one
+    ASSERT_EQ(19, cache.hit_count());
+}
+
 class JsonLengthTestFixture : public ::testing::TestWithParam<std::tuple<std::string, std::string, int>> {};
 
 TEST_P(JsonLengthTestFixture, json_length_test) {
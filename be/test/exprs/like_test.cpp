@@ -18,6 +18,8 @@
 #include "butil/time.h"
 #include "exprs/like_predicate.h"
 #include "exprs/mock_vectorized_expr.h"
+#include "exprs/multi_pattern_matcher.h"
+#include "testutil/assert.h"
 
 namespace starrocks {
 
@@ -658,4 +660,57 @@ TEST_F(LikeTest, constValueLikeComplicateForHyperscan) {
                         .ok());
 }
 
+TEST_F(LikeTest, multiPatternMatch) {
+    std::vector<MultiPatternMatcher::Pattern> patterns = {{"%abc%", true}, {"x.*y", false}, {"start_%", true}};
+    auto matcher = MultiPatternMatcher::get_or_compile(patterns);
+    ASSERT_TRUE(matcher.ok()) << matcher.status();
+    // Shared by the same patterns.
+    ASSERT_EQ(matcher.value().get(), MultiPatternMatcher::get_or_compile(patterns).value().get());
+
+    auto str = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    for (const auto& value : {"zzabczz", "ax12ya", "starting", "start", "nothing", ""}) {
+        str->append_datum(Datum(Slice(value)));
+    }
+    str->append_nulls(1);
+
+    auto result = matcher.value()->match(str).value();
+    ASSERT_EQ(7, result->size());
+    std::vector<int> expected = {1, 1, 1, 0, 0, 0};
+    for (int i = 0; i < expected.size(); ++i) {
+        ASSERT_FALSE(result->is_null(i));
+        ASSERT_EQ(expected[i], result->get(i).get_uint8()) << i;
+    }
+    ASSERT_TRUE(result->is_null(6));
+
+    // Back references are not supported by hyperscan.
+    ASSERT_FALSE(MultiPatternMatcher::get_or_compile({{"(a)\\1", false}, {"%b%", true}}).ok());
+}
+
+TEST_F(LikeTest, constPatternNotAcrossValues) {
+    for (const auto& [pattern, expected] : std::vector<std::pair<std::string, std::vector<int>>>{
+                 {"%cde%", {0, 1, 0, 0, 1}}, {"ab%", {1, 0, 1, 0, 1}}, {"%ab", {0, 0, 1, 0, 0}}}) {
+        auto context = FunctionContext::create_test_context();
+        std::unique_ptr<FunctionContext> ctx(context);
+
+        // "abc" followed by "de" contains "cde" across the values only.
+        auto str = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+        for (const auto& value : {"abc", "decde", "ab_ab", "", "abcdexxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"}) {
+            str->append_datum(Datum(Slice(value)));
+        }
+        str->append_nulls(1);
+        Columns columns{str, ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice(pattern), 1)};
+        context->set_constant_columns(columns);
+        ASSERT_OK(LikePredicate::like_prepare(context, FunctionContext::FunctionStateScope::THREAD_LOCAL));
+
+        auto result = LikePredicate::like(context, columns).value();
+        ASSERT_EQ(6, result->size());
+        for (int i = 0; i < expected.size(); ++i) {
+            ASSERT_FALSE(result->is_null(i));
+            ASSERT_EQ(expected[i], result->get(i).get_uint8()) << pattern << " " << i;
+        }
+        ASSERT_TRUE(result->is_null(5));
+        ASSERT_OK(LikePredicate::like_close(context, FunctionContext::FunctionStateScope::THREAD_LOCAL));
+    }
+}
+
 } // namespace starrocks
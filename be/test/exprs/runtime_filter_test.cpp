@@ -162,6 +162,73 @@ TEST_F(RuntimeFilterTest, TestJoinRuntimeFilter) {
     EXPECT_EQ(chunk.num_rows(), 12);
 }
 
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterBitset) {
+    RuntimeBloomFilter<TYPE_INT> bf;
+    JoinRuntimeFilter* rf = &bf;
+    bf.init(100);
+    for (int i = -100; i <= 200; i += 17) {
+        bf.insert(i);
+    }
+    // the range [-100, 189] does not fit in 100 bits
+    EXPECT_FALSE(bf.init_bitset(100));
+    EXPECT_FALSE(bf.has_bitset());
+    EXPECT_TRUE(bf.init_bitset(400));
+    for (int i = -100; i <= 200; i += 17) {
+        bf.insert_bitset(i);
+    }
+    EXPECT_TRUE(bf.has_bitset());
+
+    TypeDescriptor type_desc(TYPE_INT);
+    ColumnPtr column = ColumnHelper::create_column(type_desc, true);
+    for (int i = -300; i <= 300; i += 1) {
+        column->append_datum(Datum(i));
+    }
+    column->append_nulls(1);
+    Chunk chunk;
+    chunk.append_column(column, 0);
+    JoinRuntimeFilter::RunningContext ctx;
+    ctx.use_merged_selection = false;
+    auto& selection = ctx.selection;
+    selection.assign(column->size(), 1);
+    RuntimeFilterLayout layout;
+    layout.init(1, {});
+    rf->compute_partition_index(layout, {column.get()}, &ctx);
+    rf->evaluate(column.get(), &ctx);
+    for (int i = -300; i <= 300; i += 1) {
+        bool expected = i >= -100 && i <= 200 && (i + 100) % 17 == 0;
+        EXPECT_EQ(selection[i + 300], expected) << i;
+    }
+    EXPECT_FALSE(selection[column->size() - 1]);
+
+    // merging another filter falls back to the bloom filter
+    RuntimeBloomFilter<TYPE_INT> bf2;
+    bf2.init(100);
+    bf2.insert(1000);
+    rf->merge(&bf2);
+    EXPECT_FALSE(bf.has_bitset());
+    EXPECT_TRUE(bf._test_data(1000));
+    EXPECT_TRUE(bf._test_data(-100));
+}
+
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterBitsetValues) {
+    RuntimeBloomFilter<TYPE_BIGINT> bf;
+    bf.init(10);
+    std::vector<int64_t> inserted = {-5, -1, 0, 63, 64, 130};
+    for (auto v : inserted) {
+        bf.insert(v);
+    }
+    std::vector<int64_t> values;
+    EXPECT_FALSE(bf.get_bitset_values(10, &values));
+    ASSERT_TRUE(bf.init_bitset(1000));
+    for (auto v : inserted) {
+        bf.insert_bitset(v);
+    }
+    EXPECT_TRUE(bf.get_bitset_values(10, &values));
+    EXPECT_EQ(values, inserted);
+    values.clear();
+    EXPECT_FALSE(bf.get_bitset_values(5, &values));
+}
+
 TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterSlice) {
     RuntimeBloomFilter<TYPE_VARCHAR> bf;
     // JoinRuntimeFilter* rf = &bf;
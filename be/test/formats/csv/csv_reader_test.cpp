@@ -0,0 +1,98 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "formats/csv/csv_reader.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+class StringCSVReader : public CSVReader {
+public:
+    StringCSVReader(const CSVParseOptions& parse_options, std::string data)
+            : CSVReader(parse_options), _data(std::move(data)) {}
+
+protected:
+    Status _fill_buffer() override {
+        size_t n = std::min(_buff.free_space(), _data.size() - _offset);
+        memcpy(_buff.limit(), _data.data() + _offset, n);
+        _buff.add_limit(n);
+        _offset += n;
+        if (n == 0 && _buff.available() == 0) {
+            return Status::EndOfFile("");
+        }
+        return Status::OK();
+    }
+
+    char* _find_line_delimiter(CSVBuffer& buffer, size_t pos) override {
+        return buffer.find(_parse_options.row_delimiter, pos);
+    }
+
+private:
+    std::string _data;
+    size_t _offset = 0;
+};
+
+// NOLINTNEXTLINE
+TEST(CSVReaderTest, test_split_record) {
+    std::vector<std::string> expected;
+    std::string record;
+    for (int i = 0; i < 100; i++) {
+        expected.emplace_back(std::string(i % 70, 'a' + i % 26));
+        record += expected.back();
+        record += (i == 99) ? "" : ",";
+    }
+    StringCSVReader reader(CSVParseOptions("\n", ","), "");
+    CSVReader::Fields fields;
+    reader.split_record(Slice(record), &fields);
+    ASSERT_EQ(expected.size(), fields.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i], fields[i].to_string());
+    }
+
+    fields.clear();
+    CSVParseOptions trim_options("\n", ",", 0, true);
+    StringCSVReader trim_reader(trim_options, "");
+    std::string padded = std::string(80, 'x') + "  , " + std::string(70, 'y') + " ,z";
+    trim_reader.split_record(Slice(padded), &fields);
+    ASSERT_EQ(3, fields.size());
+    EXPECT_EQ(std::string(80, 'x'), fields[0].to_string());
+    EXPECT_EQ(std::string(70, 'y'), fields[1].to_string());
+    EXPECT_EQ("z", fields[2].to_string());
+}
+
+// NOLINTNEXTLINE
+TEST(CSVReaderTest, test_enclose_and_escape) {
+    std::string x(100, 'x');
+    std::string y(150, 'y');
+    std::string data = x + ",\"" + y + ",\n" + y + "\"," + x + "\n" + "a\\,b," + x + "\\\n" + x + ",z\n";
+    StringCSVReader reader(CSVParseOptions("\n", ",", 0, false, '\\', '"'), data);
+
+    std::vector<std::vector<std::string>> rows;
+    CSVRow row;
+    while (reader.next_record(row).ok()) {
+        std::vector<std::string> columns;
+        for (const auto& column : row.columns) {
+            const char* base = column.is_escaped_column ? reader.escapeDataPtr() : reader.buffBasePtr();
+            columns.emplace_back(base + column.start_pos, column.length);
+        }
+        rows.emplace_back(std::move(columns));
+    }
+    ASSERT_EQ(2, rows.size());
+    EXPECT_EQ((std::vector<std::string>{x, y + ",\n" + y, x}), rows[0]);
+    EXPECT_EQ((std::vector<std::string>{"a,b", x + "\n" + x, "z"}), rows[1]);
+}
+
+} // namespace starrocks
@@ -3067,4 +3067,86 @@ TEST_F(OrcChunkReaderTest, TestORCIntToSRFloat) {
     }
 }
 
+TEST_F(OrcChunkReaderTest, TestReadDictEncodedString) {
+    MemoryOutputStream buffer(1024000);
+    const std::vector<std::string> dict = {"a", "bb", "", "ccc  "};
+    const size_t batch_size = 100;
+    {
+        // prepare data
+        orc::WriterOptions writerOptions;
+        writerOptions.setDictionaryKeySizeThreshold(1.0);
+        ORC_UNIQUE_PTR<orc::Type> schema(
+                orc::Type::buildTypeFromString("struct<c0:string,c1:char(5),c2:array<string>>"));
+        ORC_UNIQUE_PTR<orc::Writer> writer = createWriter(*schema, &buffer, writerOptions);
+
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = writer->createRowBatch(batch_size * 2);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* c0 = dynamic_cast<orc::StringVectorBatch*>(root->fields[0]);
+        auto* c1 = dynamic_cast<orc::StringVectorBatch*>(root->fields[1]);
+        auto* c2 = dynamic_cast<orc::ListVectorBatch*>(root->fields[2]);
+        auto* c2_elements = dynamic_cast<orc::StringVectorBatch*>(c2->elements.get());
+        for (size_t i = 0; i < batch_size; i++) {
+            const std::string& value = dict[i % dict.size()];
+            c0->data[i] = const_cast<char*>(value.data());
+            c0->length[i] = value.length();
+            c0->notNull[i] = (i % 3 != 0);
+            c1->data[i] = const_cast<char*>(value.data());
+            c1->length[i] = value.length();
+            c2->offsets[i] = i * 2;
+            for (size_t j = i * 2; j < i * 2 + 2; j++) {
+                c2_elements->data[j] = const_cast<char*>(dict[j % dict.size()].data());
+                c2_elements->length[j] = dict[j % dict.size()].length();
+            }
+        }
+        c2->offsets[batch_size] = batch_size * 2;
+        c0->hasNulls = true;
+        c0->numElements = batch_size;
+        c1->numElements = batch_size;
+        c2->numElements = batch_size;
+        c2_elements->numElements = batch_size * 2;
+        root->numElements = batch_size;
+        writer->add(*batch);
+        writer->close();
+    }
+
+    TypeDescriptor array_type = TypeDescriptor::from_logical_type(LogicalType::TYPE_ARRAY);
+    array_type.children.push_back(TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR));
+    SlotDesc slot_descs[] = {
+            {"c0", TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR)},
+            {"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_CHAR)},
+            {"c2", array_type},
+            {""},
+    };
+    std::vector<SlotDescriptor*> src_slot_descriptors;
+    ObjectPool pool;
+    create_slot_descriptors(_runtime_state.get(), &pool, &src_slot_descriptors, slot_descs);
+
+    std::vector<std::string> rows[2];
+    for (bool direct_decode : {false, true}) {
+        OrcChunkReader reader(_runtime_state->chunk_size(), src_slot_descriptors);
+        reader.disable_broker_load_mode();
+        reader.set_dict_string_direct_decode(direct_decode);
+        auto input_stream =
+                ORC_UNIQUE_PTR<orc::InputStream>(new MemoryInputStream(buffer.getData(), buffer.getLength()));
+        Status st = reader.init(std::move(input_stream));
+        ASSERT_TRUE(st.ok()) << st.message();
+
+        st = reader.read_next();
+        ASSERT_TRUE(st.ok()) << st.message();
+        ChunkPtr ckptr = reader.create_chunk();
+        st = reader.fill_chunk(&ckptr);
+        ASSERT_TRUE(st.ok()) << st.message();
+        ChunkPtr result = reader.cast_chunk(&ckptr);
+        ASSERT_EQ(batch_size, result->num_rows());
+        for (size_t i = 0; i < result->num_rows(); i++) {
+            rows[direct_decode].emplace_back(result->debug_row(i));
+        }
+    }
+    EXPECT_EQ(rows[0], rows[1]);
+    EXPECT_EQ("[NULL, 'a', ['a','bb']]", rows[1][0]);
+    EXPECT_EQ("['bb', 'bb', ['','ccc  ']]", rows[1][1]);
+    EXPECT_EQ("[NULL, 'ccc', ['','ccc  ']]", rows[1][3]);
+    EXPECT_EQ("['a', 'a', ['a','bb']]", rows[1][4]);
+}
+
 } // namespace starrocks
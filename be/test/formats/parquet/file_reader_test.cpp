@@ -1064,6 +1064,65 @@ TEST_F(FileReaderTest, TestGetNextDictFilter) {
     ASSERT_EQ(1, shared_buffered_input_stream->shared_io_count());
 }
 
+TEST_F(FileReaderTest, TestGetNextGlobalDict) {
+    auto file = _create_file(_file2_path);
+    auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(),
+                                                    std::filesystem::file_size(_file2_path), 100000);
+
+    // c3 is read as the codes of the global dict
+    auto* ctx = _create_scan_context();
+    Utils::SlotDesc slot_descs[] = {
+            {"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)},
+            {"c2", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
+            {"c3", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)},
+            {"c4", TypeDescriptor::from_logical_type(LogicalType::TYPE_DATETIME)},
+            {""},
+    };
+    ctx->tuple_desc = Utils::create_tuple_descriptor(_runtime_state, &_pool, slot_descs);
+    Utils::make_column_info_vector(ctx->tuple_desc, &ctx->materialized_columns);
+    ctx->scan_range = (_create_scan_range(_file2_path, 850));
+
+    GlobalDictMap dict;
+    dict.emplace(Slice("a"), 1);
+    dict.emplace(Slice("b"), 2);
+    dict.emplace(Slice("c"), 3);
+    dict.emplace(Slice("d"), 4);
+    ColumnIdToGlobalDictMap dictmaps;
+    dictmaps[2] = &dict;
+    ctx->global_dictmaps = &dictmaps;
+
+    Status status = file_reader->init(ctx);
+    ASSERT_TRUE(status.ok()) << status;
+
+    ChunkPtr chunk = std::make_shared<Chunk>();
+    _append_column_for_chunk(LogicalType::TYPE_INT, &chunk);
+    _append_column_for_chunk(LogicalType::TYPE_BIGINT, &chunk);
+    _append_column_for_chunk(LogicalType::TYPE_INT, &chunk);
+    _append_column_for_chunk(LogicalType::TYPE_DATETIME, &chunk);
+    status = file_reader->get_next(&chunk);
+    ASSERT_TRUE(status.ok()) << status;
+    ASSERT_EQ(11, chunk->num_rows());
+
+    const int32_t expected[] = {1, 2, 2, 3, 3, 3, 4, 4, 4, 4};
+    ColumnPtr c3 = chunk->get_column_by_slot_id(2);
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(expected[i], c3->get(i).get_int32());
+    }
+    ASSERT_TRUE(c3->is_null(10));
+
+    status = file_reader->get_next(&chunk);
+    ASSERT_TRUE(status.is_end_of_file());
+
+    // the strings missing in the global dict are reported
+    auto file_reader2 = std::make_shared<FileReader>(config::vector_chunk_size, file.get(),
+                                                     std::filesystem::file_size(_file2_path), 100000);
+    dict.erase(Slice("d"));
+    ASSERT_OK(file_reader2->init(ctx));
+    chunk->reset();
+    status = file_reader2->get_next(&chunk);
+    ASSERT_EQ(TStatusCode::GLOBAL_DICT_ERROR, status.code()) << status;
+}
+
 TEST_F(FileReaderTest, TestGetNextOtherFilter) {
     auto file = _create_file(_file2_path);
     auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(),
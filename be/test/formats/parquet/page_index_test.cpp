@@ -16,6 +16,7 @@
 
 #include <filesystem>
 #include <random>
+#include <set>
 #include <vector>
 
 #include "column/column_helper.h"
@@ -30,6 +31,7 @@
 #include "io/shared_buffered_input_stream.h"
 #include "runtime/descriptor_helper.h"
 #include "runtime/mem_tracker.h"
+#include "testutil/assert.h"
 
 namespace starrocks::parquet {
 
@@ -479,4 +481,62 @@ TEST_F(PageIndexTest, TestTwoColumnIntersectPageIndex) {
     EXPECT_EQ(total_row_nums, 10000);
 }
 
+TEST_F(PageIndexTest, TestSkipPagesWithoutSelectedRows) {
+    const std::string small_page_file = "./be/test/formats/parquet/test_data/page_index_small_page.parquet";
+    Utils::SlotDesc min_max_slots[] = {
+            {"c0", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT), 0},
+            {""},
+    };
+    // The rows of the 3rd and 4th pages of the first row group, whose c0 are 2001-4000, are deleted.
+    std::set<int64_t> need_skip_rowids;
+    for (int64_t i = 2000; i < 4000; i++) {
+        need_skip_rowids.insert(i);
+    }
+
+    for (bool enable : {false, true}) {
+        config::parquet_page_late_materialization_enable = enable;
+        auto ctx = _create_file_c0_c1_c2_context(small_page_file);
+        auto file = _create_file(small_page_file);
+        ctx->min_max_conjunct_ctxs.clear();
+        ctx->min_max_tuple_desc = Utils::create_tuple_descriptor(_runtime_state, &_pool, min_max_slots);
+        // Filters the first page by the page index, so that the offset index of the first row group is used.
+        std::vector<TExpr> t_conjuncts;
+        ParquetUTBase::append_int_conjunct(TExprOpcode::GT, 0, 1000, &t_conjuncts);
+        ParquetUTBase::create_conjunct_ctxs(&_pool, _runtime_state, &t_conjuncts, &ctx->min_max_conjunct_ctxs);
+
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(),
+                                                        std::filesystem::file_size(small_page_file), 100000, nullptr,
+                                                        &need_skip_rowids);
+        ASSERT_OK(file_reader->init(ctx));
+
+        const int64_t page_skip = g_hdfs_scan_stats.page_skip;
+        auto chunk = std::make_shared<Chunk>();
+        for (auto type : {TYPE_INT, TYPE_INT, TYPE_VARCHAR}) {
+            chunk->append_column(ColumnHelper::create_column(TypeDescriptor::from_logical_type(type), true),
+                                 chunk->num_columns());
+        }
+        size_t total_row_nums = 0;
+        Status status;
+        while (!status.is_end_of_file()) {
+            chunk->reset();
+            status = file_reader->get_next(&chunk);
+            ASSERT_TRUE(status.ok() || status.is_end_of_file()) << status;
+            chunk->check_or_die();
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                int32_t c0 = chunk->get_column_by_slot_id(0)->get(i).get_int32();
+                int32_t c1 = chunk->get_column_by_slot_id(1)->get(i).get_int32();
+                ASSERT_TRUE(c0 > 1000 && (c0 <= 2000 || c0 > 4000)) << c0;
+                ASSERT_EQ(20001, c0 + c1);
+            }
+            total_row_nums += chunk->num_rows();
+        }
+        EXPECT_EQ(total_row_nums, 17000);
+        if (enable) {
+            // The two pages of the three columns are not loaded.
+            EXPECT_GE(g_hdfs_scan_stats.page_skip - page_skip, 6);
+        }
+    }
+    config::parquet_page_late_materialization_enable = true;
+}
+
 } // namespace starrocks::parquet
@@ -987,6 +987,69 @@ TEST_F(ParquetFileWriterTest, TestFlushRowgroupAndCommitDependency) {
     ASSERT_EQ(result.file_statistics.record_count, 4);
 }
 
+TEST_F(ParquetFileWriterTest, TestWriteColumnsWithExecutors) {
+    // a map of two leaf columns followed by an int and a boolean
+    std::vector<TypeDescriptor> type_descs;
+    auto type_int = TypeDescriptor::from_logical_type(TYPE_INT);
+    auto type_int_map = TypeDescriptor::from_logical_type(TYPE_MAP);
+    type_int_map.children.push_back(type_int);
+    type_int_map.children.push_back(type_int);
+    type_descs.push_back(type_int_map);
+    type_descs.push_back(type_int);
+    type_descs.push_back(TypeDescriptor::from_logical_type(TYPE_BOOLEAN));
+
+    auto column_names = _make_type_names(type_descs);
+    auto output_file = _fs.new_writable_file(_file_path).value();
+    auto output_stream = std::make_unique<parquet::ParquetOutputStream>(std::move(output_file));
+    auto column_evaluators = ColumnSlotIdEvaluator::from_types(type_descs);
+    auto writer_options = std::make_shared<formats::ParquetWriterOptions>();
+    auto executors = PriorityThreadPool("test", 3, 10);
+    auto writer = std::make_unique<formats::ParquetFileWriter>(
+            _file_path, std::move(output_stream), column_names, type_descs, std::move(column_evaluators),
+            TCompressionType::NO_COMPRESSION, writer_options, []() {}, &executors, nullptr);
+    ASSERT_OK(writer->init());
+
+    auto chunk = std::make_shared<Chunk>();
+    {
+        // [1 -> 1], NULL, [], [2 -> 2, 3 -> 3, 4 -> 4]
+        auto key_col = Int32Column::create();
+        std::vector<int32_t> key_nums{1, 2, 3, 4};
+        key_col->append_numbers(key_nums.data(), sizeof(int32_t) * key_nums.size());
+        auto value_col = Int32Column::create();
+        value_col->append_numbers(key_nums.data(), sizeof(int32_t) * key_nums.size());
+        auto offsets_col = UInt32Column::create();
+        std::vector<uint32_t> offsets{0, 1, 1, 1, 4};
+        offsets_col->append_numbers(offsets.data(), sizeof(uint32_t) * offsets.size());
+        auto map_col = MapColumn::create(ColumnHelper::cast_to_nullable_column(key_col),
+                                         ColumnHelper::cast_to_nullable_column(value_col), offsets_col);
+        std::vector<uint8_t> nulls{0, 1, 0, 0};
+        auto null_col = UInt8Column::create();
+        null_col->append_numbers(nulls.data(), sizeof(uint8_t) * nulls.size());
+        chunk->append_column(NullableColumn::create(map_col, null_col), chunk->num_columns());
+
+        auto int_col = Int32Column::create();
+        std::vector<int32_t> nums{5, 6, 7, 8};
+        int_col->append_numbers(nums.data(), sizeof(int32_t) * nums.size());
+        chunk->append_column(ColumnHelper::cast_to_nullable_column(int_col), chunk->num_columns());
+
+        auto bool_col = BooleanColumn::create();
+        std::vector<uint8_t> values{0, 1, 1, 0};
+        bool_col->append_numbers(values.data(), values.size() * sizeof(uint8_t));
+        chunk->append_column(ColumnHelper::cast_to_nullable_column(bool_col), chunk->num_columns());
+    }
+
+    ASSERT_TRUE(writer->write(chunk).get().ok());
+    auto result = writer->commit().get();
+
+    ASSERT_TRUE(result.io_status.ok());
+    ASSERT_EQ(result.file_statistics.record_count, 4);
+
+    auto read_chunk = _read_chunk(type_descs);
+    ASSERT_TRUE(read_chunk != nullptr);
+    ASSERT_EQ(read_chunk->num_rows(), 4);
+    parquet::Utils::assert_equal_chunk(chunk.get(), read_chunk.get());
+}
+
 TEST_F(ParquetFileWriterTest, TestWriteWithFieldID) {
     auto type_bool = TypeDescriptor::from_logical_type(TYPE_BOOLEAN);
     std::vector<TypeDescriptor> type_descs{type_bool};
@@ -89,4 +89,21 @@ TEST_F(HttpUtilsTest, parse_basic_auth) {
     }
 }
 
+TEST_F(HttpUtilsTest, parse_byte_range) {
+    int64_t first = 0;
+    int64_t last = 99;
+    ASSERT_TRUE(parse_byte_range("bytes=10-", &first, &last));
+    ASSERT_EQ(10, first);
+    ASSERT_EQ(99, last);
+    ASSERT_TRUE(parse_byte_range("bytes=20-30", &first, &last));
+    ASSERT_EQ(20, first);
+    ASSERT_EQ(30, last);
+
+    ASSERT_FALSE(parse_byte_range("bytes=-30", &first, &last));
+    ASSERT_FALSE(parse_byte_range("bytes=1-2,5-6", &first, &last));
+    ASSERT_FALSE(parse_byte_range("bytes=a-2", &first, &last));
+    ASSERT_FALSE(parse_byte_range("bytes=10", &first, &last));
+    ASSERT_FALSE(parse_byte_range("items=1-2", &first, &last));
+}
+
 } // namespace starrocks
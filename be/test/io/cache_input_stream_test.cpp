@@ -17,8 +17,11 @@
 #include <gtest/gtest.h>
 
 #include "block_cache/block_cache.h"
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -478,4 +481,56 @@ TEST_F(CacheInputStreamTest, test_peek) {
     }
 }
 
+TEST_F(CacheInputStreamTest, test_prefetch_sequential_read) {
+    CacheOptions options = cache_options();
+    ASSERT_OK(BlockCache::instance()->init(options));
+
+    auto old_sequential_reads = config::datacache_prefetch_sequential_reads;
+    auto old_prefetch_blocks = config::datacache_prefetch_blocks;
+    config::datacache_prefetch_sequential_reads = 1;
+    config::datacache_prefetch_blocks = 2;
+    DeferOp defer([&]() {
+        config::datacache_prefetch_sequential_reads = old_sequential_reads;
+        config::datacache_prefetch_blocks = old_prefetch_blocks;
+    });
+
+    const int64_t block_count = 8;
+    const int64_t data_size = block_size * block_count;
+    std::string data(data_size, '\0');
+    gen_test_data(data.data(), data_size, block_size);
+
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("datacache_prefetch_test").set_max_threads(1).build(&pool));
+    std::atomic<int64_t> query_prefetch_bytes = 0;
+
+    const std::string file_name = "test_file7";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data.data(), data_size));
+    std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+            new io::SharedBufferedInputStream(stream, file_name, data_size));
+    {
+        io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+        cache_stream.enable_prefetch(
+                pool.get(),
+                [&]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+                    return std::make_shared<MockSeekableInputStream>(data.data(), data_size);
+                },
+                &query_prefetch_bytes);
+
+        // The first two blocks are read from the backend, and the others are prefetched into the cache.
+        for (int i = 0; i < block_count; ++i) {
+            char buffer[block_size];
+            read_stream_data(&cache_stream, i * block_size, block_size, buffer);
+            ASSERT_TRUE(check_data_content(buffer, block_size, 'a' + i));
+            pool->wait();
+        }
+        const auto& stats = cache_stream.stats();
+        ASSERT_EQ(block_count - 2, stats.prefetch_count);
+        ASSERT_EQ((block_count - 2) * block_size, stats.prefetch_bytes);
+        ASSERT_EQ(block_count - 2, stats.prefetch_hit_count);
+        ASSERT_EQ(0, stats.prefetch_waste_count);
+        ASSERT_EQ(block_count - 2, stats.read_cache_count);
+    }
+    ASSERT_EQ(0, query_prefetch_bytes);
+}
+
 } // namespace starrocks::io
@@ -19,11 +19,17 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <cerrno>
 #include <cstdlib>
+#include <thread>
 
+#include "common/config.h"
 #include "common/logging.h"
+#include "io/io_uring_reader.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
+#include "testutil/sync_point.h"
+#include "util/defer_op.h"
 
 namespace starrocks::io {
 
@@ -181,4 +187,83 @@ PARALLEL_TEST(FdInputStreamTest, test_op_after_close) {
     ASSERT_ERROR(in.close());
 }
 
+static void check_read_batch() {
+    int fd = open_temp_file();
+    std::string contents;
+    for (int i = 0; i < 1000; i++) {
+        contents.append(100, static_cast<char>('a' + i % 26));
+    }
+    pwrite_or_die(fd, contents.data(), contents.size(), 0);
+
+    FdInputStream in(fd);
+    in.set_close_on_delete(true);
+
+    // More ranges than the entries of a ring.
+    std::vector<std::string> buffers(200);
+    std::vector<ReadRange> ranges;
+    for (int i = 0; i < buffers.size(); i++) {
+        buffers[i].resize(i % 2 == 0 ? 100 : 0);
+        ranges.push_back(ReadRange{.offset = i * 500, .count = (int64_t)buffers[i].size(), .data = buffers[i].data()});
+    }
+    ASSERT_OK(in.read_at_fully_batch(ranges));
+    for (int i = 0; i < buffers.size(); i++) {
+        ASSERT_EQ(contents.substr(i * 500, buffers[i].size()), buffers[i]);
+    }
+    ASSERT_EQ(0, *in.position());
+
+    // Reaches the end of file.
+    std::string buff(100, '\0');
+    ranges = {ReadRange{.offset = 0, .count = 100, .data = buff.data()},
+              ReadRange{.offset = (int64_t)contents.size() - 50, .count = 100, .data = buff.data()}};
+    ASSERT_ERROR(in.read_at_fully_batch(ranges));
+}
+
+// NOLINTNEXTLINE
+TEST(FdInputStreamTest, test_read_batch_by_pread) {
+    auto old = config::enable_io_uring;
+    config::enable_io_uring = false;
+    DeferOp defer([&]() { config::enable_io_uring = old; });
+    ASSERT_FALSE(FdInputStream(-1).support_batch_read());
+    check_read_batch();
+}
+
+// NOLINTNEXTLINE
+TEST(FdInputStreamTest, test_read_batch_by_io_uring) {
+    auto old = config::enable_io_uring;
+    config::enable_io_uring = true;
+    DeferOp defer([&]() { config::enable_io_uring = old; });
+    if (!IoUringReader::available()) {
+        GTEST_SKIP() << "io_uring is not supported";
+    }
+    check_read_batch();
+}
+
+// NOLINTNEXTLINE
+TEST(FdInputStreamTest, test_read_batch_by_broken_io_uring) {
+    auto old = config::enable_io_uring;
+    config::enable_io_uring = true;
+    DeferOp defer([&]() { config::enable_io_uring = old; });
+    if (!IoUringReader::available()) {
+        GTEST_SKIP() << "io_uring is not supported";
+    }
+
+    int enter_calls = 0;
+    SyncPoint::GetInstance()->SetCallBack("IoUringReader::enter", [&](void* arg) {
+        // The reads of the first call have been submitted, and must be waited for before falling back to pread.
+        enter_calls++;
+        *static_cast<long*>(arg) = -1;
+        errno = EFAULT;
+    });
+    SyncPoint::GetInstance()->EnableProcessing();
+    DeferOp disable([]() {
+        SyncPoint::GetInstance()->DisableProcessing();
+        SyncPoint::GetInstance()->ClearCallBack("IoUringReader::enter");
+    });
+
+    // The broken ring is given up by the calling thread only, so the reads run on a thread of their own.
+    std::thread t([]() { check_read_batch(); });
+    t.join();
+    ASSERT_EQ(1, enter_calls);
+}
+
 } // namespace starrocks::io
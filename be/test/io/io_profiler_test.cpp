@@ -131,4 +131,37 @@ TEST(IOProfilerTest, test_profile_and_get_topn_stats) {
     ASSERT_TRUE(IOProfiler::is_empty());
 }
 
+TEST(IOProfilerTest, test_read_histograms) {
+    IOProfiler::ReadHistograms histograms;
+    // not counted without a scope
+    IOProfiler::add_read_of_source(IOProfiler::READ_REMOTE, 4096, 1000);
+    ASSERT_EQ(0, histograms.count(IOProfiler::READ_REMOTE));
+
+    {
+        IOProfiler::ReadHistogramsScope scope(&histograms);
+        for (int i = 0; i < 90; i++) {
+            IOProfiler::add_read_of_source(IOProfiler::READ_REMOTE, 4096, 1000);
+        }
+        for (int i = 0; i < 9; i++) {
+            IOProfiler::add_read_of_source(IOProfiler::READ_REMOTE, 65536, 100000);
+        }
+        IOProfiler::add_read_of_source(IOProfiler::READ_REMOTE, 1048576, 10000000);
+        IOProfiler::add_read_of_source(IOProfiler::READ_CACHE, 100, 10);
+    }
+    IOProfiler::add_read_of_source(IOProfiler::READ_REMOTE, 4096, 1000);
+
+    ASSERT_EQ(100, histograms.count(IOProfiler::READ_REMOTE));
+    ASSERT_EQ(90 * 4096 + 9 * 65536 + 1048576, histograms.bytes(IOProfiler::READ_REMOTE));
+    ASSERT_EQ(1024, histograms.latency_percentile(IOProfiler::READ_REMOTE, 50));
+    ASSERT_EQ(1024, histograms.latency_percentile(IOProfiler::READ_REMOTE, 90));
+    ASSERT_EQ(131072, histograms.latency_percentile(IOProfiler::READ_REMOTE, 99));
+    ASSERT_EQ(16777216, histograms.latency_percentile(IOProfiler::READ_REMOTE, 100));
+    ASSERT_EQ(4096, histograms.size_percentile(IOProfiler::READ_REMOTE, 50));
+
+    ASSERT_EQ(1, histograms.count(IOProfiler::READ_CACHE));
+    ASSERT_EQ(16, histograms.latency_percentile(IOProfiler::READ_CACHE, 50));
+    ASSERT_EQ(0, histograms.count(IOProfiler::READ_LOCAL_DISK));
+    ASSERT_EQ(0, histograms.latency_percentile(IOProfiler::READ_LOCAL_DISK, 99));
+}
+
 } // namespace starrocks
\ No newline at end of file
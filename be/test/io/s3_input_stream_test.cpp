@@ -27,6 +27,7 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::io {
 
@@ -204,4 +205,33 @@ TEST_F(S3InputStreamTest, test_read_all) {
     EXPECT_EQ(kObjectContent, s);
 }
 
+TEST_F(S3InputStreamTest, test_read_at_fully_batch) {
+    auto f = new_random_access_file();
+    ASSERT_TRUE(f->support_batch_read());
+
+    auto old_distance = config::s3_vectored_read_max_merge_distance;
+    auto old_parallelism = config::s3_vectored_read_max_parallelism;
+    DeferOp defer([&]() {
+        config::s3_vectored_read_max_merge_distance = old_distance;
+        config::s3_vectored_read_max_parallelism = old_parallelism;
+    });
+    for (int64_t distance : {0, 1, 100}) {
+        for (int32_t parallelism : {1, 4}) {
+            config::s3_vectored_read_max_merge_distance = distance;
+            config::s3_vectored_read_max_parallelism = parallelism;
+            char buf[8];
+            std::vector<ReadRange> ranges{ReadRange{.offset = 8, .count = 2, .data = buf + 4},
+                                          ReadRange{.offset = 0, .count = 2, .data = buf},
+                                          ReadRange{.offset = 3, .count = 2, .data = buf + 2},
+                                          ReadRange{.offset = 4, .count = 2, .data = buf + 6}};
+            ASSERT_OK(f->read_at_fully_batch(ranges));
+            ASSERT_EQ("01348945", std::string_view(buf, sizeof(buf)));
+        }
+    }
+
+    char buf[4];
+    std::vector<ReadRange> ranges{ReadRange{.offset = 8, .count = 4, .data = buf}};
+    ASSERT_ERROR(f->read_at_fully_batch(ranges));
+}
+
 } // namespace starrocks::io
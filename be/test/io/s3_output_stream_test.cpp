@@ -27,6 +27,7 @@
 #include "common/logging.h"
 #include "io/s3_input_stream.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::io {
 
@@ -154,6 +155,36 @@ TEST_F(S3OutputStreamTest, test_multipart_upload) {
     delete_object(kObjectName);
 }
 
+TEST_F(S3OutputStreamTest, test_parallel_multipart_upload) {
+    const int64_t kPartSize = 5 * 1024 * 1024;
+    const int kNumParts = 4;
+    const char* kObjectName = "test_parallel_multipart_upload";
+    auto max_inflight_parts = config::experimental_s3_max_inflight_upload_parts;
+    config::experimental_s3_max_inflight_upload_parts = 2;
+    DeferOp defer([&]() { config::experimental_s3_max_inflight_upload_parts = max_inflight_parts; });
+    delete_object(kObjectName);
+    {
+        S3OutputStream os(g_s3client, kBucketName, kObjectName, 12, kPartSize);
+        for (int i = 0; i < kNumParts; i++) {
+            std::string part(kPartSize, static_cast<char>('a' + i));
+            ASSERT_OK(os.write(part.data(), part.size()));
+        }
+        ASSERT_OK(os.close());
+    }
+
+    // the parts are in order even if they are uploaded at the same time
+    S3InputStream is(g_s3client, kBucketName, kObjectName);
+    std::string buff(kPartSize * kNumParts + 1, '\0');
+    ASSIGN_OR_ABORT(auto length, is.read(buff.data(), buff.size()));
+    ASSERT_EQ(kPartSize * kNumParts, length);
+    for (int i = 0; i < kNumParts; i++) {
+        ASSERT_EQ('a' + i, buff[i * kPartSize]);
+        ASSERT_EQ('a' + i, buff[(i + 1) * kPartSize - 1]);
+    }
+
+    delete_object(kObjectName);
+}
+
 TEST_F(S3OutputStreamTest, test_skip) {
     char buff[32];
     const char* kObjectName = "test_multipart_upload";
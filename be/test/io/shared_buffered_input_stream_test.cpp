@@ -19,6 +19,7 @@
 #include "io_test_base.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -179,4 +180,50 @@ TEST_F(SharedBufferedInputStreamTest, test_orc) {
             sb.value()->debug_string());
 }
 
+TEST_F(SharedBufferedInputStreamTest, test_prefetch_io_ranges) {
+    size_t len = 1 * 1024 * 1024; // 1MB
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<TestInputStream>(rand_string, len);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    sb_stream->set_coalesce_options({.max_dist_size = 1024, .max_buffer_size = 64 * 1024});
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("shared_buffer_prefetch_test").set_max_threads(1).build(&pool));
+    sb_stream->enable_prefetch(pool.get());
+
+    // the first "stripe" is read by the reader
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    ranges.emplace_back(0, 10 * 1024);
+    ranges.emplace_back(100 * 1024, 10 * 1024);
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+
+    // the active columns of the next "stripe" are prefetched, and the lazy ones are not coalesced
+    std::vector<io::SharedBufferedInputStream::IORange> next_ranges;
+    next_ranges.emplace_back(200 * 1024, 10 * 1024, true);
+    next_ranges.emplace_back(300 * 1024, 100 * 1024, true);
+    next_ranges.emplace_back(500 * 1024, 10 * 1024, false);
+    ASSERT_OK(sb_stream->prefetch_io_ranges(next_ranges, false));
+    ASSERT_EQ(2, sb_stream->prefetch_io_count());
+    ASSERT_EQ(110 * 1024, sb_stream->prefetch_io_bytes());
+
+    std::string buf(100 * 1024, 0);
+    ASSERT_OK(sb_stream->read_at_fully(0, buf.data(), 10 * 1024));
+    ASSERT_EQ(rand_string.substr(0, 10 * 1024), buf.substr(0, 10 * 1024));
+    sb_stream->release_to_offset(200 * 1024);
+
+    ASSERT_OK(sb_stream->read_at_fully(300 * 1024 + 10, buf.data(), 1024));
+    ASSERT_EQ(rand_string.substr(300 * 1024 + 10, 1024), buf.substr(0, 1024));
+    ASSERT_OK(sb_stream->read_at_fully(200 * 1024, buf.data(), 10 * 1024));
+    ASSERT_EQ(rand_string.substr(200 * 1024, 10 * 1024), buf.substr(0, 10 * 1024));
+    ASSERT_OK(sb_stream->read_at_fully(500 * 1024, buf.data(), 10 * 1024));
+    ASSERT_EQ(rand_string.substr(500 * 1024, 10 * 1024), buf.substr(0, 10 * 1024));
+    ASSERT_EQ(2, sb_stream->prefetch_io_count());
+    ASSERT_EQ(0, sb_stream->direct_io_count());
+
+    // the buffers being prefetched are waited before released
+    next_ranges.clear();
+    next_ranges.emplace_back(600 * 1024, 100 * 1024);
+    ASSERT_OK(sb_stream->prefetch_io_ranges(next_ranges));
+    sb_stream->release();
+}
+
 } // namespace starrocks::io
\ No newline at end of file
@@ -323,4 +323,80 @@ TEST_F(SpillBlockManagerTest, hybird_block_allocation_test) {
         ASSERT_EQ(block->debug_string(), expected);
     }
 }
+
+TEST_F(SpillBlockManagerTest, hybird_cold_block_allocation_test) {
+    std::shared_ptr<spill::HyBirdBlockManager> hybird_block_mgr;
+    {
+        auto local_block_mgr = std::make_unique<spill::LogBlockManager>(dummy_query_id, local_dir_mgr.get());
+        ASSERT_OK(local_block_mgr->open());
+        auto remote_block_mgr = std::make_unique<spill::FileBlockManager>(dummy_query_id, remote_dir_mgr.get());
+        ASSERT_OK(remote_block_mgr->open());
+        hybird_block_mgr = std::make_shared<spill::HyBirdBlockManager>(
+                dummy_query_id, std::move(local_block_mgr), std::move(remote_block_mgr), local_dir_mgr.get());
+        ASSERT_OK(hybird_block_mgr->open());
+    }
+    auto acquire = [&](size_t block_size, bool is_cold) {
+        spill::AcquireBlockOptions opts{.query_id = dummy_query_id,
+                                        .fragment_instance_id = dummy_query_id,
+                                        .plan_node_id = 1,
+                                        .name = "node1",
+                                        .block_size = block_size,
+                                        .is_cold = is_cold};
+        auto res = hybird_block_mgr->acquire_block(opts);
+        CHECK(res.ok());
+        return res.value();
+    };
+    auto old_ratio = config::spill_local_cold_block_max_usage_ratio;
+    config::spill_local_cold_block_max_usage_ratio = 0.5;
+    DeferOp defer([&]() { config::spill_local_cold_block_max_usage_ratio = old_ratio; });
+
+    // 1. the local dir is empty, a cold block is still put in local
+    auto block1 = acquire(30, true);
+    ASSERT_FALSE(block1->is_remote());
+    // 2. hot blocks are put in local until the local dir is full
+    auto block2 = acquire(30, false);
+    ASSERT_FALSE(block2->is_remote());
+    // 3. the local dir is used more than 50%, cold blocks go to remote
+    auto block3 = acquire(10, true);
+    ASSERT_TRUE(block3->is_remote());
+    // 4. the hot ones still use the rest of the local dir
+    auto block4 = acquire(10, false);
+    ASSERT_FALSE(block4->is_remote());
+}
+
+TEST_F(SpillBlockManagerTest, remote_block_read_ahead_test) {
+    auto file_block_mgr = std::make_shared<spill::FileBlockManager>(dummy_query_id, remote_dir_mgr.get());
+    ASSERT_OK(file_block_mgr->open());
+    spill::AcquireBlockOptions opts{.query_id = dummy_query_id,
+                                    .fragment_instance_id = dummy_query_id,
+                                    .plan_node_id = 1,
+                                    .name = "node1",
+                                    .block_size = 10};
+    ASSIGN_OR_ABORT(auto block, file_block_mgr->acquire_block(opts));
+    std::string data;
+    for (int i = 0; i < 100; i++) {
+        data.push_back('a' + i % 26);
+    }
+    ASSERT_OK(block->append({Slice(data.data(), 30), Slice(data.data() + 30, 70)}));
+    ASSERT_OK(block->flush());
+    ASSERT_OK(file_block_mgr->release_block(block));
+    // pretend the block is in remote storage to enable the read ahead
+    block->set_is_remote(true);
+
+    auto old_buffer_bytes = config::spill_remote_read_buffer_bytes;
+    config::spill_remote_read_buffer_bytes = 16;
+    DeferOp defer([&]() { config::spill_remote_read_buffer_bytes = old_buffer_bytes; });
+
+    auto reader = block->get_reader();
+    std::string result;
+    // smaller and larger reads than the read ahead buffer
+    for (int64_t len : {3, 10, 20, 1, 40, 26}) {
+        std::string buf(len, 0);
+        ASSERT_OK(reader->read_fully(buf.data(), len));
+        result += buf;
+    }
+    ASSERT_EQ(data, result);
+    char c;
+    ASSERT_TRUE(reader->read_fully(&c, 1).is_end_of_file());
+}
 } // namespace starrocks::vectorized
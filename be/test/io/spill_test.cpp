@@ -41,6 +41,7 @@
 #include "exec/spill/executor.h"
 #include "exec/spill/log_block_manager.h"
 #include "exec/spill/mem_table.h"
+#include "exec/spill/query_spill_manager.h"
 #include "exec/spill/spill_components.h"
 #include "exec/spill/spiller.h"
 #include "exec/spill/spiller.hpp"
@@ -560,6 +561,152 @@ TEST_F(SpillTest, partition_process) {
     }
 }
 
+TEST_F(SpillTest, skewed_partition_process) {
+    ObjectPool pool;
+
+    std::vector<bool> nullables = {false};
+    TExprBuilder tuple_slots_builder;
+    tuple_slots_builder << TYPE_INT;
+    auto tuple_slots = tuple_slots_builder.get_res();
+
+    std::vector<ExprContext*> tuple;
+    ASSERT_OK(Expr::create_expr_trees(&pool, tuple_slots, &tuple, &dummy_rt_st));
+    RandomChunkBuilder chunk_builder;
+
+    SpilledOptions spill_options(4);
+    spill_options.mem_table_pool_size = 1;
+    spill_options.spill_mem_table_bytes_size = 1 * 1024 * 1024;
+    spill_options.max_partition_bytes = 1 * 1024 * 1024;
+    spill_options.spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+    spill_options.block_manager = dummy_block_mgr.get();
+
+    RuntimeProfile profile{"skewed"};
+    std::atomic_int64_t total_spill_bytes = 0;
+    SpillProcessMetrics spill_metrics(&profile, &total_spill_bytes);
+    auto spiller = spill::make_spilled_factory()->create(spill_options);
+    spiller->set_metrics(spill_metrics);
+    ASSERT_OK(spiller->prepare(&dummy_rt_st));
+
+    // all the rows have the same hash value, so they always go to the same partition
+    for (size_t i = 0; i < 1024; ++i) {
+        auto chunk = chunk_builder.gen(tuple, nullables);
+        auto hash_column = spill::SpillHashColumn::create(chunk->num_rows());
+        chunk->append_column(std::move(hash_column), -1);
+        ASSERT_OK(spiller->spill<SyncExecutor>(&dummy_rt_st, chunk, EmptyMemGuard{}));
+        ASSERT_OK(spiller->_spilled_task_status);
+    }
+    ASSERT_OK(spiller->flush<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}));
+
+    // the partition is split once, and it is not split again after all the rows went to one side
+    auto writer = spiller->_writer->as<spill::PartitionedSpillerWriter*>();
+    int32_t max_level = 0;
+    for (const auto& [level, partitions] : writer->level_to_partitions()) {
+        max_level = std::max(max_level, level);
+    }
+    ASSERT_EQ(3, max_level);
+    ASSERT_EQ(1, spill_metrics.skewed_partition_count->value());
+}
+
+TEST_F(SpillTest, compressed_process) {
+    ObjectPool pool;
+
+    TExprBuilder order_by_slots_builder;
+    order_by_slots_builder << TYPE_INT;
+    auto order_by_slots = order_by_slots_builder.get_res();
+    std::vector<bool> nullables = {false, false};
+    TExprBuilder tuple_slots_builder;
+    tuple_slots_builder << TYPE_INT << TYPE_SMALLINT;
+    auto tuple_slots = tuple_slots_builder.get_res();
+
+    auto ctx_st = no_partition_context(&pool, &dummy_rt_st, order_by_slots, tuple_slots);
+    ASSERT_OK(ctx_st.status());
+    auto ctx = ctx_st.value();
+    auto& tuple = ctx->sort_exprs.sort_tuple_slot_expr_ctxs();
+    RandomChunkBuilder chunk_builder;
+
+    // 16: lz4, 32: zstd, 16 | 7: lz4 on top of the adaptive column encodings
+    for (int encode_level : {16, 32, 16 | 7}) {
+        RuntimeProfile profile{"compressed"};
+        std::atomic_int64_t total_spill_bytes = 0;
+        SpillProcessMetrics spill_metrics(&profile, &total_spill_bytes);
+
+        SpilledOptions spill_options;
+        spill_options.mem_table_pool_size = 4;
+        spill_options.spill_mem_table_bytes_size = 1 * 1024 * 1024;
+        spill_options.spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+        spill_options.block_manager = dummy_block_mgr.get();
+        spill_options.encode_level = encode_level;
+
+        auto spiller = spill::make_spilled_factory()->create(spill_options);
+        spiller->set_metrics(spill_metrics);
+        SpillerCaller<spill::RawSpillerWriter*, spill::SpillerReader*> caller(spiller.get());
+        ASSERT_OK(spiller->prepare(&dummy_rt_st));
+
+        // low cardinality columns, which compress well
+        size_t input_rows = 0;
+        size_t input_bytes = 0;
+        for (size_t i = 0; i < 64; ++i) {
+            auto chunk = chunk_builder.gen(tuple, nullables);
+            size_t num_rows = chunk->num_rows();
+            for (auto& column : chunk->columns()) {
+                column->resize(0);
+                column->append_default(num_rows);
+            }
+            input_rows += chunk->num_rows();
+            input_bytes += chunk->bytes_usage();
+            ASSERT_OK(caller.spill<SyncExecutor>(&dummy_rt_st, chunk, EmptyMemGuard{}));
+            ASSERT_OK(spiller->_spilled_task_status);
+        }
+        ASSERT_OK(caller.flush<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}));
+        ASSERT_LT(spill_metrics.local_flush_bytes->value(), input_bytes / 4);
+
+        ASSERT_OK(caller.trigger_restore<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}));
+        size_t output_rows = 0;
+        while (true) {
+            auto chunk_st = caller.restore<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{});
+            if (chunk_st.status().is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(chunk_st.status());
+            ASSERT_OK(spiller->_spilled_task_status);
+            if (chunk_st.value() == nullptr) {
+                continue;
+            }
+            auto& chunk = chunk_st.value();
+            for (size_t i = 0; i < chunk->num_rows(); ++i) {
+                ASSERT_EQ(0, chunk->get_column_by_index(0)->get(i).get_int32());
+                ASSERT_EQ(0, chunk->get_column_by_index(1)->get(i).get_int16());
+            }
+            output_rows += chunk->num_rows();
+        }
+        ASSERT_EQ(input_rows, output_rows);
+    }
+}
+
+TEST_F(SpillTest, spill_candidates) {
+    spill::QuerySpillManager spill_manager(generate_uuid());
+    int op1 = 0, op2 = 0, op3 = 0;
+    spill_manager.update_revocable_bytes(&op1, 100);
+    spill_manager.update_revocable_bytes(&op2, 300);
+    spill_manager.update_revocable_bytes(&op3, 200);
+
+    // the operator holding the most revocable memory is enough
+    ASSERT_TRUE(spill_manager.is_spill_candidate(&op2, 250));
+    ASSERT_FALSE(spill_manager.is_spill_candidate(&op3, 250));
+    ASSERT_FALSE(spill_manager.is_spill_candidate(&op1, 250));
+    // the two largest ones are needed
+    ASSERT_TRUE(spill_manager.is_spill_candidate(&op2, 400));
+    ASSERT_TRUE(spill_manager.is_spill_candidate(&op3, 400));
+    ASSERT_FALSE(spill_manager.is_spill_candidate(&op1, 400));
+
+    // once the largest one spills, the next one is picked
+    spill_manager.remove_operator(&op2);
+    ASSERT_TRUE(spill_manager.is_spill_candidate(&op3, 100));
+    ASSERT_FALSE(spill_manager.is_spill_candidate(&op1, 100));
+    // an unknown operator is always a candidate
+    ASSERT_TRUE(spill_manager.is_spill_candidate(&op2, 100));
+}
+
 TEST_F(SpillTest, aligned_buffer) {
     spill::AlignedBuffer buffer;
     ASSERT_EQ(buffer.data(), nullptr);
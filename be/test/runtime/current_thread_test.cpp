@@ -0,0 +1,92 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/current_thread.h"
+
+#include <gtest/gtest.h>
+
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+using MemCacheManager = CurrentThread::MemCacheManager;
+
+class MemCacheManagerTest : public ::testing::Test {
+public:
+    void TearDown() override { tls_exceed_mem_tracker = nullptr; }
+
+protected:
+    static constexpr int64_t kBatchSize = MemCacheManager::BATCH_SIZE;
+    static constexpr int64_t kMinBatchSize = MemCacheManager::MIN_BATCH_SIZE;
+
+    static int64_t expected_batch_size(const MemTracker& tracker) {
+        return std::clamp<int64_t>(tracker.spare_capacity() / MemCacheManager::SPARE_CAPACITY_SHARES, kMinBatchSize,
+                                   kBatchSize);
+    }
+};
+
+// NOLINTNEXTLINE
+TEST_F(MemCacheManagerTest, full_batch_far_from_limit) {
+    MemTracker tracker(1024L * 1024 * 1024);
+    MemCacheManager cache([&] { return &tracker; });
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(cache.try_mem_consume(kBatchSize));
+        ASSERT_EQ(kBatchSize, cache.batch_size());
+    }
+    ASSERT_EQ(10 * kBatchSize, tracker.consumption());
+
+    MemTracker unlimited_tracker;
+    MemCacheManager unlimited_cache([&] { return &unlimited_tracker; });
+    ASSERT_TRUE(unlimited_cache.try_mem_consume(kBatchSize));
+    ASSERT_EQ(kBatchSize, unlimited_cache.batch_size());
+}
+
+// NOLINTNEXTLINE
+TEST_F(MemCacheManagerTest, batch_shrinks_near_limit) {
+    const int64_t limit = 64L * 1024 * 1024;
+    MemTracker tracker(limit);
+    MemCacheManager cache([&] { return &tracker; });
+    const int64_t step = 16 * 1024;
+
+    int64_t admitted = 0;
+    int64_t prev_batch_size = cache.batch_size();
+    while (cache.try_mem_consume(step)) {
+        admitted += step;
+        // The batch is recomputed from the spare capacity at each commit, and only gets smaller as it fills up.
+        ASSERT_LE(cache.batch_size(), prev_batch_size);
+        if (cache._cache_size == 0) {
+            ASSERT_EQ(expected_batch_size(tracker), cache.batch_size());
+        }
+        prev_batch_size = cache.batch_size();
+        // The committed bytes never exceed the limit, and the uncommitted ones are less than a batch.
+        ASSERT_LE(tracker.consumption(), limit);
+        ASSERT_LT(cache._cache_size, cache.batch_size());
+        ASSERT_EQ(admitted, tracker.consumption() + cache._cache_size);
+    }
+    ASSERT_EQ(kMinBatchSize, cache.batch_size());
+    ASSERT_EQ(&tracker, tls_exceed_mem_tracker);
+    ASSERT_EQ(step, cache.try_consume_mem_size());
+    // Over-admitted by less than the minimal batch, instead of the full batch.
+    ASSERT_LE(tracker.consumption(), limit);
+    ASSERT_LT(admitted - limit, kMinBatchSize);
+    ASSERT_GT(admitted + step, limit);
+
+    // Releases do not change the batch, and a context shift starts with the full batch again.
+    cache.release(kBatchSize);
+    ASSERT_EQ(kMinBatchSize, cache.batch_size());
+    cache.commit(true);
+    ASSERT_EQ(kBatchSize, cache.batch_size());
+}
+
+} // namespace starrocks
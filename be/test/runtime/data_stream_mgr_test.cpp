@@ -16,6 +16,19 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
+#include <numeric>
+#include <thread>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "gen_cpp/internal_service.pb.h"
+#include "runtime/data_stream_recvr.h"
+#include "runtime/exec_env.h"
+#include "runtime/local_pass_through_buffer.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
 namespace starrocks {
 
 TEST(DataStreamMgr, pass_through_buffer_test) {
@@ -39,4 +52,262 @@ TEST(DataStreamMgr, pass_through_buffer_test) {
     mgr.reset();
 }
 
+class CountingClosure : public google::protobuf::Closure {
+public:
+    void Run() override { ++num_runs; }
+    std::atomic<int> num_runs = 0;
+};
+
+// A receiver gets the chunks passed through by the senders on the same BE.
+class PassThroughRecvrTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _query_id.hi = 2024;
+        _query_id.lo = 1;
+        _finst_id.hi = 2024;
+        _finst_id.lo = 2;
+        _mgr = std::make_unique<DataStreamMgr>();
+        _mgr->prepare_pass_through_chunk_buffer(_query_id);
+        _state = std::make_shared<RuntimeState>(_query_id, _finst_id, TQueryOptions(), TQueryGlobals(),
+                                                ExecEnv::GetInstance());
+        _state->init_mem_trackers(_query_id);
+        _profile = std::make_shared<RuntimeProfile>("recvr");
+    }
+
+    void TearDown() override {
+        if (_recvr != nullptr) {
+            _recvr->close();
+            _recvr.reset();
+        }
+        _mgr->destroy_pass_through_chunk_buffer(_query_id);
+        _mgr->close();
+    }
+
+protected:
+    static constexpr PlanNodeId kNodeId = 1;
+
+    void create_recvr(int num_senders, int buffer_size, bool keep_order = true) {
+        _recvr = _mgr->create_recvr(_state.get(), _row_desc, _finst_id, kNodeId, num_senders, buffer_size,
+                                    false /* is_merging */, nullptr, true /* is_pipeline */, 1, keep_order);
+        _recvr->bind_profile(0, _profile);
+        _sender_ctx = std::make_unique<PassThroughContext>(_mgr->get_pass_through_chunk_buffer(_query_id), _finst_id,
+                                                           kNodeId);
+        _sender_ctx->init();
+    }
+
+    // The sender appends a chunk of the single row |sender_id * 1000 + index| to the pass-through buffer.
+    // The chunk is accounted as |chunk_bytes| if given.
+    void append_chunk(int sender_id, int index, int64_t chunk_bytes = -1) {
+        auto column = Int32Column::create();
+        column->append(sender_id * 1000 + index);
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), 0);
+        _sender_ctx->append_chunk(sender_id, chunk.get(), chunk_bytes >= 0 ? chunk_bytes : chunk->bytes_usage(), 0);
+    }
+
+    // The sender sends a pass-through request, which carries no chunk but tells the receiver to pull.
+    Status transmit(int sender_id, int64_t sequence, google::protobuf::Closure** done,
+                    PTransmitChunkResult* response = nullptr, bool eos = false) {
+        PTransmitChunkParams request;
+        request.mutable_finst_id()->set_hi(_finst_id.hi);
+        request.mutable_finst_id()->set_lo(_finst_id.lo);
+        request.set_node_id(kNodeId);
+        request.set_sender_id(sender_id);
+        request.set_be_number(sender_id);
+        request.set_eos(eos);
+        request.set_sequence(sequence);
+        request.set_use_pass_through(true);
+        return _mgr->transmit_chunk(request, done, nullptr, response);
+    }
+
+    // Pull one chunk from the receiver, and record its row for the sender it comes from.
+    bool pull_chunk(std::map<int, std::vector<int>>* rows) {
+        std::unique_ptr<Chunk> chunk;
+        CHECK_OK(_recvr->get_chunk_for_pipeline(&chunk, 0));
+        if (chunk == nullptr) {
+            return false;
+        }
+        CHECK_EQ(1, chunk->num_rows());
+        const int32_t row = chunk->get_column_by_slot_id(0)->get(0).get_int32();
+        (*rows)[row / 1000].push_back(row % 1000);
+        return true;
+    }
+
+    TUniqueId _query_id;
+    TUniqueId _finst_id;
+    RowDescriptor _row_desc;
+    std::unique_ptr<DataStreamMgr> _mgr;
+    std::shared_ptr<RuntimeState> _state;
+    std::shared_ptr<RuntimeProfile> _profile;
+    std::shared_ptr<DataStreamRecvr> _recvr;
+    std::unique_ptr<PassThroughContext> _sender_ctx;
+};
+
+// A request may pull the chunks appended for the requests after it, so the chunks keep the order they are appended
+// in, whatever the sequences of the requests are.
+TEST_F(PassThroughRecvrTest, out_of_order_sequences) {
+    create_recvr(1, 1024 * 1024);
+    google::protobuf::Closure* done = nullptr;
+
+    append_chunk(0, 0);
+    ASSERT_OK(transmit(0, 2, &done));
+    append_chunk(0, 1);
+    append_chunk(0, 2);
+    ASSERT_OK(transmit(0, 0, &done));
+    // nothing left to pull.
+    ASSERT_OK(transmit(0, 1, &done));
+    append_chunk(0, 3);
+    ASSERT_OK(transmit(0, 4, &done));
+    append_chunk(0, 4);
+    ASSERT_OK(transmit(0, 3, &done));
+
+    std::map<int, std::vector<int>> rows;
+    while (pull_chunk(&rows)) {
+    }
+    ASSERT_EQ(1, rows.size());
+    ASSERT_EQ(std::vector<int>({0, 1, 2, 3, 4}), rows[0]);
+}
+
+TEST_F(PassThroughRecvrTest, multiple_senders) {
+    static constexpr int kNumSenders = 4;
+    static constexpr int kNumChunksPerSender = 200;
+    create_recvr(kNumSenders, 1024 * 1024 * 1024);
+
+    std::atomic<bool> stop = false;
+    std::vector<std::thread> senders;
+    for (int sender_id = 0; sender_id < kNumSenders; ++sender_id) {
+        senders.emplace_back([this, sender_id]() {
+            google::protobuf::Closure* done = nullptr;
+            for (int i = 0; i < kNumChunksPerSender; ++i) {
+                append_chunk(sender_id, i);
+                // swap the sequences of each pair of requests.
+                CHECK_OK(transmit(sender_id, i ^ 1, &done));
+            }
+        });
+        // The requests of a sender are handled concurrently by the brpc threads, and race to pull its chunks.
+        senders.emplace_back([this, sender_id, &stop]() {
+            google::protobuf::Closure* done = nullptr;
+            for (int64_t sequence = kNumChunksPerSender; !stop; ++sequence) {
+                CHECK_OK(transmit(sender_id, sequence, &done));
+            }
+        });
+    }
+
+    std::map<int, std::vector<int>> rows;
+    size_t num_rows = 0;
+    while (num_rows < kNumSenders * kNumChunksPerSender) {
+        if (pull_chunk(&rows)) {
+            ++num_rows;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    stop = true;
+    for (auto& sender : senders) {
+        sender.join();
+    }
+    ASSERT_FALSE(pull_chunk(&rows));
+
+    std::vector<int> expected_rows(kNumChunksPerSender);
+    std::iota(expected_rows.begin(), expected_rows.end(), 0);
+    ASSERT_EQ(kNumSenders, rows.size());
+    for (int sender_id = 0; sender_id < kNumSenders; ++sender_id) {
+        ASSERT_EQ(expected_rows, rows[sender_id]) << "sender " << sender_id;
+    }
+}
+
+// Over the buffer limit, the receiver holds the closure of the request on the last chunk it pulls, and runs it only
+// when the chunk is consumed, which doesn't change the order of the chunks.
+TEST_F(PassThroughRecvrTest, closure_held_over_buffer_limit) {
+    create_recvr(2, 1);
+    CountingClosure closure0;
+    CountingClosure closure1;
+    CountingClosure closure2;
+
+    append_chunk(0, 0);
+    google::protobuf::Closure* done = &closure0;
+    ASSERT_OK(transmit(0, 1, &done));
+    ASSERT_EQ(nullptr, done);
+
+    append_chunk(0, 1);
+    append_chunk(0, 2);
+    done = &closure1;
+    ASSERT_OK(transmit(0, 0, &done));
+    ASSERT_EQ(nullptr, done);
+
+    append_chunk(1, 0);
+    done = &closure2;
+    ASSERT_OK(transmit(1, 0, &done));
+    ASSERT_EQ(nullptr, done);
+    ASSERT_EQ(0, closure0.num_runs + closure1.num_runs + closure2.num_runs);
+
+    std::map<int, std::vector<int>> rows;
+    ASSERT_TRUE(pull_chunk(&rows));
+    ASSERT_EQ(1, closure0.num_runs.load());
+    ASSERT_EQ(0, closure1.num_runs.load());
+    ASSERT_TRUE(pull_chunk(&rows));
+    ASSERT_EQ(0, closure1.num_runs.load());
+    ASSERT_TRUE(pull_chunk(&rows));
+    ASSERT_EQ(1, closure1.num_runs.load());
+    ASSERT_EQ(0, closure2.num_runs.load());
+    ASSERT_TRUE(pull_chunk(&rows));
+    ASSERT_EQ(1, closure2.num_runs.load());
+    ASSERT_FALSE(pull_chunk(&rows));
+
+    ASSERT_EQ(std::vector<int>({0, 1, 2}), rows[0]);
+    ASSERT_EQ(std::vector<int>({0}), rows[1]);
+}
+
+// The credit of a receiver is its free buffer shared by the senders that have not sent eos yet.
+TEST_F(PassThroughRecvrTest, credit_as_senders_finish_and_receiver_drains) {
+    create_recvr(2, 1000, false);
+    ASSERT_EQ(500, _recvr->buffer_credit_bytes());
+
+    // The credit is set in the response when the closure runs.
+    CountingClosure closure;
+    PTransmitChunkResult response;
+    google::protobuf::Closure* done = &closure;
+    append_chunk(0, 0, 100);
+    ASSERT_OK(transmit(0, 0, &done, &response));
+    ASSERT_NE(nullptr, done);
+    ASSERT_FALSE(response.has_receiver_credit_bytes());
+    done->Run();
+    ASSERT_EQ(1, closure.num_runs.load());
+    ASSERT_EQ((1000 - 100) / 2, response.receiver_credit_bytes());
+
+    // The finished sender leaves its share to the remaining one.
+    done = nullptr;
+    ASSERT_OK(transmit(1, 0, &done, nullptr, true));
+    ASSERT_EQ(1000 - 100, _recvr->buffer_credit_bytes());
+
+    std::map<int, std::vector<int>> rows;
+    ASSERT_TRUE(pull_chunk(&rows));
+    ASSERT_EQ(1000, _recvr->buffer_credit_bytes());
+
+    // Over the buffer, there is no credit at all.
+    append_chunk(0, 1, 1500);
+    ASSERT_OK(transmit(0, 1, &done));
+    ASSERT_EQ(0, _recvr->buffer_credit_bytes());
+    ASSERT_TRUE(pull_chunk(&rows));
+    ASSERT_EQ(1000, _recvr->buffer_credit_bytes());
+}
+
+// A closure held over the buffer limit reports the credit after the buffer drains, not when the request arrives.
+TEST_F(PassThroughRecvrTest, credit_of_held_closure) {
+    create_recvr(1, 1000, false);
+    CountingClosure closure;
+    PTransmitChunkResult response;
+    google::protobuf::Closure* done = &closure;
+    append_chunk(0, 0, 1500);
+    ASSERT_OK(transmit(0, 0, &done, &response));
+    ASSERT_EQ(nullptr, done);
+    ASSERT_EQ(0, closure.num_runs.load());
+    ASSERT_EQ(0, _recvr->buffer_credit_bytes());
+
+    std::map<int, std::vector<int>> rows;
+    ASSERT_TRUE(pull_chunk(&rows));
+    ASSERT_EQ(1, closure.num_runs.load());
+    ASSERT_EQ(1000, response.receiver_credit_bytes());
+}
+
 } // namespace starrocks
@@ -0,0 +1,61 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/jemalloc_arenas.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "jemalloc/jemalloc.h"
+
+namespace starrocks {
+
+TEST(JemallocArenasTest, test_memory_class_arena) {
+    config::enable_jemalloc_arena_per_memory_class = true;
+    auto* arenas = JemallocArenas::instance();
+    ASSERT_TRUE(arenas->init().ok());
+    if (!arenas->enabled()) {
+        GTEST_SKIP() << "jemalloc is not available in sanitizer builds";
+    }
+    ASSERT_EQ(0, arenas->mallocx_flags(MemoryClass::QUERY));
+    ASSERT_NE(0, arenas->mallocx_flags(MemoryClass::STORAGE_CACHE));
+    ASSERT_NE(arenas->mallocx_flags(MemoryClass::STORAGE_CACHE), arenas->mallocx_flags(MemoryClass::LOAD));
+
+    {
+        SCOPED_MEMORY_CLASS(MemoryClass::STORAGE_CACHE);
+        ASSERT_EQ(arenas->mallocx_flags(MemoryClass::STORAGE_CACHE), tls_jemalloc_arena_flags);
+        {
+            SCOPED_MEMORY_CLASS(MemoryClass::QUERY);
+            ASSERT_EQ(0, tls_jemalloc_arena_flags);
+        }
+        ASSERT_EQ(arenas->mallocx_flags(MemoryClass::STORAGE_CACHE), tls_jemalloc_arena_flags);
+    }
+    ASSERT_EQ(0, tls_jemalloc_arena_flags);
+
+    const size_t size = 8 * 1024 * 1024;
+    JemallocArenas::refresh_stats();
+    int64_t active_before = arenas->stats(MemoryClass::STORAGE_CACHE).active_bytes;
+    void* ptr = je_mallocx(size, arenas->mallocx_flags(MemoryClass::STORAGE_CACHE));
+    ASSERT_NE(nullptr, ptr);
+    JemallocArenas::refresh_stats();
+    ASSERT_GE(arenas->stats(MemoryClass::STORAGE_CACHE).active_bytes, active_before + static_cast<int64_t>(size));
+    ASSERT_LT(arenas->stats(MemoryClass::LOAD).active_bytes, static_cast<int64_t>(size));
+
+    je_free(ptr);
+    arenas->purge(MemoryClass::STORAGE_CACHE);
+    JemallocArenas::refresh_stats();
+    ASSERT_EQ(0, arenas->stats(MemoryClass::STORAGE_CACHE).dirty_bytes);
+}
+
+} // namespace starrocks
@@ -35,9 +35,12 @@
 #include "runtime/memory/mem_chunk_allocator.h"
 
 #include <gtest/gtest.h>
+#include <sched.h>
 
 #include "common/config.h"
 #include "runtime/memory/mem_chunk.h"
+#include "runtime/memory/system_allocator.h"
+#include "util/cpu_info.h"
 
 namespace starrocks {
 
@@ -51,4 +54,125 @@ TEST(MemChunkAllocatorTest, Normal) {
         MemChunkAllocator::instance()->free(chunk);
     }
 }
+
+// The current core and |_local_core| are on NUMA node 0, and the other cores are on node 1.
+class MemChunkAllocatorNumaTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        CpuInfo::init();
+        const int num_cores = CpuInfo::get_max_num_cores();
+        if (num_cores < 3) {
+            GTEST_SKIP() << "needs at least 3 cores";
+        }
+        // Pin the thread, so that the current core does not change during the test.
+        CPU_ZERO(&_saved_cores);
+        ASSERT_EQ(0, sched_getaffinity(0, sizeof(_saved_cores), &_saved_cores));
+        _current_core = CpuInfo::get_current_core();
+        cpu_set_t current_core;
+        CPU_ZERO(&current_core);
+        CPU_SET(_current_core, &current_core);
+        ASSERT_EQ(0, sched_setaffinity(0, sizeof(current_core), &current_core));
+        _pinned = true;
+
+        // The remote core comes before the local core in the order the other arenas are tried.
+        _remote_core = (_current_core + 1) % num_cores;
+        _local_core = (_current_core + 2) % num_cores;
+        _saved_num_numa_nodes = CpuInfo::get_max_num_numa_nodes();
+        std::vector<int> core_to_numa_node(num_cores, 1);
+        for (int core = 0; core < num_cores; ++core) {
+            _saved_core_to_numa_node.push_back(CpuInfo::get_numa_node_of_core(core));
+        }
+        core_to_numa_node[_current_core] = 0;
+        core_to_numa_node[_local_core] = 0;
+        CpuInfo::init_fake_numa_for_test(2, core_to_numa_node);
+        _saved_numa_aware = config::enable_numa_aware_scheduling;
+    }
+
+    void TearDown() override {
+        if (!_saved_core_to_numa_node.empty()) {
+            CpuInfo::init_fake_numa_for_test(_saved_num_numa_nodes, _saved_core_to_numa_node);
+        }
+        if (_pinned) {
+            sched_setaffinity(0, sizeof(_saved_cores), &_saved_cores);
+        }
+        config::enable_numa_aware_scheduling = _saved_numa_aware;
+    }
+
+protected:
+    static constexpr size_t kSize = 4096;
+
+    // Frees a new chunk to the arena of |core|, and returns its data.
+    uint8_t* free_to_arena(MemChunkAllocator* allocator, int core, size_t size = kSize) {
+        MemChunk chunk;
+        chunk.data = SystemAllocator::allocate(nullptr, size);
+        chunk.size = size;
+        chunk.core_id = core;
+        allocator->free(chunk);
+        return chunk.data;
+    }
+
+    int _current_core = 0;
+    int _local_core = 0;
+    int _remote_core = 0;
+
+private:
+    cpu_set_t _saved_cores;
+    bool _pinned = false;
+    int _saved_num_numa_nodes = 1;
+    std::vector<int> _saved_core_to_numa_node;
+    bool _saved_numa_aware = false;
+};
+
+TEST_F(MemChunkAllocatorNumaTest, test_arena_fallback_order) {
+    config::enable_numa_aware_scheduling = false;
+    MemChunkAllocator allocator(nullptr, 1L << 30);
+    // Keeps the reserved bytes above the size of a chunk, under which the other arenas are not tried.
+    free_to_arena(&allocator, _remote_core, kSize * 256);
+    uint8_t* remote_data = free_to_arena(&allocator, _remote_core);
+    uint8_t* local_data = free_to_arena(&allocator, _local_core);
+    uint8_t* current_data = free_to_arena(&allocator, _current_core);
+
+    std::vector<MemChunk> chunks(4);
+    ASSERT_TRUE(allocator.allocate(kSize, &chunks[0]));
+    ASSERT_EQ(_current_core, chunks[0].core_id);
+    ASSERT_EQ(current_data, chunks[0].data);
+    ASSERT_TRUE(allocator.allocate(kSize, &chunks[1]));
+    ASSERT_EQ(_local_core, chunks[1].core_id);
+    ASSERT_EQ(local_data, chunks[1].data);
+    ASSERT_TRUE(allocator.allocate(kSize, &chunks[2]));
+    ASSERT_EQ(_remote_core, chunks[2].core_id);
+    ASSERT_EQ(remote_data, chunks[2].data);
+    // Allocated from the system allocator at last.
+    ASSERT_TRUE(allocator.allocate(kSize, &chunks[3]));
+    ASSERT_EQ(_current_core, chunks[3].core_id);
+    for (const auto& chunk : chunks) {
+        allocator.free(chunk);
+    }
+}
+
+TEST_F(MemChunkAllocatorNumaTest, test_no_remote_chunk_in_numa_aware_mode) {
+    config::enable_numa_aware_scheduling = true;
+    MemChunkAllocator allocator(nullptr, 1L << 30);
+    free_to_arena(&allocator, _remote_core, kSize * 256);
+    uint8_t* remote_data = free_to_arena(&allocator, _remote_core);
+    uint8_t* local_data = free_to_arena(&allocator, _local_core);
+
+    std::vector<MemChunk> chunks(3);
+    ASSERT_TRUE(allocator.allocate(kSize, &chunks[0]));
+    ASSERT_EQ(_local_core, chunks[0].core_id);
+    ASSERT_EQ(local_data, chunks[0].data);
+    // The chunk freed on the remote node is skipped for the system allocator.
+    ASSERT_TRUE(allocator.allocate(kSize, &chunks[1]));
+    ASSERT_EQ(_current_core, chunks[1].core_id);
+    ASSERT_NE(remote_data, chunks[1].data);
+
+    config::enable_numa_aware_scheduling = false;
+    ASSERT_TRUE(allocator.allocate(kSize, &chunks[2]));
+    ASSERT_EQ(_remote_core, chunks[2].core_id);
+    ASSERT_EQ(remote_data, chunks[2].data);
+    for (const auto& chunk : chunks) {
+        allocator.free(chunk);
+    }
+}
+
 } // namespace starrocks
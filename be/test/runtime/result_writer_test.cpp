@@ -0,0 +1,217 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/result_writer.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "runtime/buffer_control_block.h"
+#include "runtime/mysql_result_writer.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/mysql_row_buffer.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+class TestResultWriter final : public ResultWriter {
+public:
+    using ResultWriter::build_rows;
+    using ResultWriter::ColumnFields;
+    using ResultWriter::move_rows_to_results;
+
+    Status init(RuntimeState* state) override { return Status::OK(); }
+    Status append_chunk(Chunk* chunk) override { return Status::OK(); }
+    Status close() override { return Status::OK(); }
+};
+
+using ColumnFields = TestResultWriter::ColumnFields;
+
+static ColumnFields make_fields(const std::vector<std::string>& values) {
+    ColumnFields fields;
+    fields.offsets.push_back(0);
+    for (const auto& value : values) {
+        fields.data.append(value);
+        fields.offsets.push_back(fields.data.size());
+    }
+    return fields;
+}
+
+static std::vector<std::string> make_rows(const std::vector<size_t>& sizes) {
+    std::vector<std::string> rows;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        rows.emplace_back(sizes[i], static_cast<char>('a' + i));
+    }
+    return rows;
+}
+
+// NOLINTNEXTLINE
+TEST(ResultWriterTest, build_rows) {
+    std::vector<ColumnFields> columns;
+    columns.emplace_back(make_fields({"1", "22", "333"}));
+    columns.emplace_back(make_fields({"\"a\"", "null", ""}));
+    columns.emplace_back(make_fields({"1.5", "", "null"}));
+
+    std::vector<std::string> rows;
+    TestResultWriter::build_rows(columns, 3, Slice(), Slice(), Slice(), &rows);
+    ASSERT_EQ(std::vector<std::string>({"1\"a\"1.5", "22null", "333null"}), rows);
+
+    // the format of the http json result.
+    TestResultWriter::build_rows(columns, 3, Slice("{\"data\":["), Slice(","), Slice("]}\n"), &rows);
+    ASSERT_EQ(std::vector<std::string>({"{\"data\":[1,\"a\",1.5]}\n", "{\"data\":[22,null,]}\n",
+                                        "{\"data\":[333,,null]}\n"}),
+              rows);
+
+    // a single column has no separator.
+    columns.resize(1);
+    TestResultWriter::build_rows(columns, 3, Slice("["), Slice(","), Slice("]"), &rows);
+    ASSERT_EQ(std::vector<std::string>({"[1]", "[22]", "[333]"}), rows);
+
+    TestResultWriter::build_rows(columns, 0, Slice("["), Slice(","), Slice("]"), &rows);
+    ASSERT_TRUE(rows.empty());
+}
+
+// NOLINTNEXTLINE
+TEST(ResultWriterTest, move_rows_to_one_result) {
+    auto rows = make_rows({4, 4, 1});
+    const auto expected = rows;
+    TFetchDataResultPtrs results;
+    TestResultWriter::move_rows_to_results(&rows, 10, &results);
+    ASSERT_EQ(1, results.size());
+    ASSERT_EQ(expected, results[0]->result_batch.rows);
+}
+
+// NOLINTNEXTLINE
+TEST(ResultWriterTest, move_rows_to_split_results) {
+    // the 4th row is not less than max_bytes, so it takes a result of its own.
+    auto rows = make_rows({4, 4, 4, 20, 4, 4, 1});
+    const auto expected = rows;
+    TFetchDataResultPtrs results;
+    TestResultWriter::move_rows_to_results(&rows, 10, &results);
+    ASSERT_TRUE(rows.empty());
+
+    ASSERT_EQ(4, results.size());
+    ASSERT_EQ(std::vector<std::string>({expected[0], expected[1]}), results[0]->result_batch.rows);
+    ASSERT_EQ(std::vector<std::string>({expected[2]}), results[1]->result_batch.rows);
+    ASSERT_EQ(std::vector<std::string>({expected[3]}), results[2]->result_batch.rows);
+    ASSERT_EQ(std::vector<std::string>({expected[4], expected[5], expected[6]}), results[3]->result_batch.rows);
+
+    // each result is a batch of its own rather than the same one appended again.
+    for (size_t i = 0; i < results.size(); i++) {
+        for (size_t j = i + 1; j < results.size(); j++) {
+            ASSERT_NE(results[i].get(), results[j].get());
+        }
+    }
+
+    // the results are appended after the existing ones.
+    rows = make_rows({6, 6});
+    TestResultWriter::move_rows_to_results(&rows, 10, &results);
+    ASSERT_EQ(6, results.size());
+    ASSERT_EQ(1, results[4]->result_batch.rows.size());
+    ASSERT_EQ(1, results[5]->result_batch.rows.size());
+}
+
+class MysqlResultWriterTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        TUniqueId fragment_id;
+        TQueryOptions query_options;
+        query_options.batch_size = config::vector_chunk_size;
+        TQueryGlobals query_globals;
+        _runtime_state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+        _runtime_state->init_instance_mem_tracker();
+    }
+
+    void TearDown() override {
+        for (ExprContext* ctx : _expr_ctxs) {
+            delete ctx;
+        }
+        for (Expr* expr : _exprs) {
+            delete expr;
+        }
+    }
+
+protected:
+    void add_output(const TypeDescriptor& type, SlotId slot_id) {
+        _exprs.push_back(new ColumnRef(type, slot_id));
+        _expr_ctxs.push_back(new ExprContext(_exprs.back()));
+    }
+
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::vector<Expr*> _exprs;
+    std::vector<ExprContext*> _expr_ctxs;
+};
+
+// NOLINTNEXTLINE
+TEST_F(MysqlResultWriterTest, text_rows_of_mixed_columns) {
+    const auto int_type = TypeDescriptor(TYPE_INT);
+    const auto double_type = TypeDescriptor(TYPE_DOUBLE);
+    const auto varchar_type = TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH);
+
+    auto int_column = ColumnHelper::create_column(int_type, true);
+    auto double_column = ColumnHelper::create_column(double_type, false);
+    auto varchar_column = ColumnHelper::create_column(varchar_type, true);
+    const size_t num_rows = 100;
+    for (size_t i = 0; i < num_rows; i++) {
+        if (i % 3 == 0) {
+            int_column->append_nulls(1);
+        } else {
+            int_column->append_datum(Datum(static_cast<int32_t>(i * 1000)));
+        }
+        double_column->append_datum(Datum(i * 0.25));
+        if (i % 5 == 0) {
+            varchar_column->append_nulls(1);
+        } else {
+            varchar_column->append_datum(Datum(Slice(std::string(i % 7, 'x'))));
+        }
+    }
+    Chunk::SlotHashMap slot_map{{0, 0}, {1, 1}, {2, 2}};
+    Chunk chunk(Columns{int_column, double_column, varchar_column}, slot_map);
+
+    add_output(varchar_type, 2);
+    add_output(int_type, 0);
+    add_output(double_type, 1);
+    ASSERT_OK(Expr::prepare(_expr_ctxs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(_expr_ctxs, _runtime_state.get()));
+
+    // the rows converted one by one, like the binary protocol does.
+    std::vector<std::string> expected(num_rows);
+    const Columns output_columns{varchar_column, int_column, double_column};
+    for (size_t i = 0; i < num_rows; i++) {
+        MysqlRowBuffer buffer(false);
+        for (const auto& column : output_columns) {
+            column->put_mysql_row_buffer(&buffer, i, false);
+        }
+        buffer.move_content(&expected[i]);
+    }
+
+    BufferControlBlock sinker(TUniqueId(), 1024);
+    RuntimeProfile profile("result_writer_test");
+    MysqlResultWriter writer(&sinker, _expr_ctxs, false, &profile);
+    ASSERT_OK(writer.init(_runtime_state.get()));
+    // twice, the second one reuses the buffer hints of the first.
+    for (int round = 0; round < 2; round++) {
+        ASSIGN_OR_ABORT(auto results, writer.process_chunk(&chunk));
+        ASSERT_EQ(1, results.size());
+        ASSERT_EQ(expected, results[0]->result_batch.rows);
+    }
+
+    Expr::close(_expr_ctxs, _runtime_state.get());
+}
+
+} // namespace starrocks
@@ -43,6 +43,7 @@
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
 #include "util/monotime.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -281,4 +282,34 @@ PARALLEL_TEST(StreamLoadPipeTest, compressed_reader) {
     producer.join();
 }
 
+PARALLEL_TEST(StreamLoadPipeTest, pipelined_decompression) {
+    auto pipe = std::make_shared<StreamLoadPipe>();
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("decompress").set_min_threads(1).set_max_threads(1).build(&pool));
+
+    auto producer = std::thread([&pipe]() {
+        auto buf = readFileAsBytes("./be/test/runtime/test_data/compressed_file/foo.json.lz4");
+        EXPECT_OK(pipe->append(buf.data(), buf.size()));
+        pipe->finish();
+    });
+
+    auto res = start_pipelined_decompression(pipe, CompressionTypePB::LZ4_FRAME, pool.get());
+    ASSERT_OK(res.status());
+    StreamLoadPipeInputStream stream(res.value(), false);
+    std::string data;
+    std::vector<char> buf(64 * 1024);
+    while (true) {
+        auto nread = stream.read(buf.data(), buf.size());
+        ASSERT_OK(nread.status());
+        if (nread.value() == 0) {
+            break;
+        }
+        data.append(buf.data(), nread.value());
+    }
+    EXPECT_EQ(42000021, data.size());
+    EXPECT_EQ(std::string_view(R"({"foo": 1, "bar": 2})"), std::string_view(data.data(), 20));
+    producer.join();
+    pool->shutdown();
+}
+
 } // namespace starrocks
@@ -152,6 +152,48 @@ PARALLEL_TEST(ColumnArraySerdeTest, int_column) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, bit_packing_int_column) {
+    auto c1 = Int64Column::create();
+    auto c2 = Int64Column::create();
+    for (int64_t i = 0; i < 4096; i++) {
+        c1->append(20240101 + i % 100);
+    }
+
+    std::vector<uint8_t> buffer;
+    for (auto level : {10, 11, 15}) {
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c1, level));
+        uint8_t* end = ColumnArraySerde::serialize(*c1, buffer.data(), false, level);
+        // 7 bits for each value.
+        ASSERT_LT(end - buffer.data(), c1->byte_size() / 8);
+        ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, level));
+        ASSERT_EQ(c1->size(), c2->size());
+        for (size_t i = 0; i < c1->size(); i++) {
+            ASSERT_EQ(c1->get_data()[i], c2->get_data()[i]);
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, bit_packing_binary_column) {
+    auto c1 = BinaryColumn::create();
+    auto c2 = BinaryColumn::create();
+    for (int i = 0; i < 1000; i++) {
+        c1->append(Slice(strings::Substitute("value_$0", i % 10)));
+    }
+
+    std::vector<uint8_t> buffer;
+    for (auto level : {10, 15}) {
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c1, level));
+        uint8_t* end = ColumnArraySerde::serialize(*c1, buffer.data(), false, level);
+        ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, level));
+        ASSERT_EQ(c1->size(), c2->size());
+        for (size_t i = 0; i < c1->size(); i++) {
+            ASSERT_EQ(c1->get_slice(i), c2->get_slice(i));
+        }
+    }
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(ColumnArraySerdeTest, double_column) {
     std::vector<double> numbers{1.0, 2, 3.3, 4, 5.9, 6, 7};
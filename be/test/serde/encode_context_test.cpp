@@ -0,0 +1,67 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "serde/encode_context.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/parallel_test.h"
+
+namespace starrocks::serde {
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(EncodeContextTest, pick_candidate_per_column) {
+    // adjust | integer | bit packing
+    EncodeContext ctx(3, 11);
+    ASSERT_EQ(3, ctx.get_encode_level(0));
+
+    for (uint32_t i = 0; i < EncodeSamplingNum; i++) {
+        bool bit_packing = EncodeContext::enable_bit_packing(ctx.get_encode_level(0));
+        ASSERT_EQ(i % 2 == 1, bit_packing);
+        // column 0 is compressed better by bit packing, column 1 by streamvbyte, column 2 by neither.
+        ctx.update(0, 1000, bit_packing ? 100 : 500, 10);
+        ctx.update(1, 1000, bit_packing ? 500 : 300, 10);
+        ctx.update(2, 1000, 950, 10);
+        ctx.adjust_encode_levels();
+    }
+    ASSERT_EQ(11, ctx.get_encode_level(0));
+    ASSERT_EQ(3, ctx.get_encode_level(1));
+    ASSERT_EQ(0, ctx.get_encode_level(2));
+
+    const auto& stats = ctx.column_encode_stats();
+    ASSERT_EQ(3, stats.size());
+    ASSERT_EQ(1000 * EncodeSamplingNum, stats[0].raw_bytes);
+    ASSERT_EQ(100 * 2 + 500 * 3, stats[0].encoded_bytes);
+    ASSERT_EQ(10 * EncodeSamplingNum, stats[0].encode_ns);
+
+    // the next sampling re-evaluates the given up column.
+    for (uint32_t i = EncodeSamplingNum; i < 128; i++) {
+        ctx.update(2, 1000, 950, 10);
+        ctx.adjust_encode_levels();
+    }
+    ASSERT_EQ(3, ctx.get_encode_level(2));
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(EncodeContextTest, no_bit_packing) {
+    EncodeContext ctx(1, 7);
+    for (uint32_t i = 0; i < EncodeSamplingNum; i++) {
+        ASSERT_EQ(7, ctx.get_encode_level(0));
+        ctx.update(0, 1000, 500);
+        ctx.adjust_encode_levels();
+    }
+    ASSERT_EQ(7, ctx.get_encode_level(0));
+}
+
+} // namespace starrocks::serde
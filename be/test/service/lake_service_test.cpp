@@ -31,6 +31,7 @@
 #include "storage/lake/tablet_manager.h"
 #include "storage/lake/tablet_metadata.h"
 #include "storage/lake/test_util.h"
+#include "storage/lake/transactions.h"
 #include "storage/lake/txn_log.h"
 #include "testutil/assert.h"
 #include "testutil/id_generator.h"
@@ -38,6 +39,7 @@
 #include "util/bthreads/util.h"
 #include "util/countdown_latch.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -489,6 +491,64 @@ TEST_F(LakeServiceTest, test_publish_version_for_write_batch) {
     }
 }
 
+TEST_F(LakeServiceTest, test_publish_version_with_prefetch) {
+    auto metadata2 = lake::generate_simple_tablet_metadata(DUP_KEYS);
+    ASSERT_OK(_tablet_mgr->put_tablet_metadata(metadata2));
+    std::vector<int64_t> tablet_ids{_tablet_id, metadata2->id()};
+    const int64_t txn_id = next_id();
+    for (auto tablet_id : tablet_ids) {
+        TxnLog txnlog;
+        txnlog.set_tablet_id(tablet_id);
+        txnlog.set_txn_id(txn_id);
+        txnlog.mutable_op_write()->mutable_rowset()->set_num_rows(10);
+        txnlog.mutable_op_write()->mutable_rowset()->set_data_size(1024);
+        txnlog.mutable_op_write()->mutable_rowset()->add_segments(fmt::format("{}.dat", tablet_id));
+        ASSERT_OK(_tablet_mgr->put_txn_log(txnlog));
+    }
+    TxnInfoPB txn_info;
+    txn_info.set_txn_id(txn_id);
+    txn_info.set_txn_type(TXN_NORMAL);
+    txn_info.set_combined_txn_log(false);
+    txn_info.set_commit_time(time(nullptr));
+
+    // The prefetch reads the txn logs and the base metadata into the metacache
+    {
+        std::unique_ptr<ThreadPool> pool;
+        ASSERT_OK(ThreadPoolBuilder("prefetch_test").set_max_threads(4).build(&pool));
+        _tablet_mgr->prune_metacache();
+        auto deadline = std::chrono::system_clock::now() + std::chrono::minutes(1);
+        lake::prefetch_publish_version_inputs(_tablet_mgr, pool.get(), tablet_ids, 1,
+                                              std::span<const TxnInfoPB>(&txn_info, 1), deadline);
+        for (auto tablet_id : tablet_ids) {
+            auto cache = _tablet_mgr->metacache();
+            EXPECT_TRUE(cache->lookup_txn_log(_tablet_mgr->txn_log_location(tablet_id, txn_id)) != nullptr);
+            EXPECT_TRUE(cache->lookup_tablet_metadata(_tablet_mgr->tablet_metadata_location(tablet_id, 1)) != nullptr);
+        }
+        pool->shutdown();
+    }
+
+    auto old_min_tablets = config::lake_publish_version_prefetch_min_tablets;
+    config::lake_publish_version_prefetch_min_tablets = 1;
+    DeferOp defer([&]() { config::lake_publish_version_prefetch_min_tablets = old_min_tablets; });
+    _tablet_mgr->prune_metacache();
+    PublishVersionRequest request;
+    PublishVersionResponse response;
+    request.set_base_version(1);
+    request.set_new_version(2);
+    for (auto tablet_id : tablet_ids) {
+        request.add_tablet_ids(tablet_id);
+    }
+    request.add_txn_infos()->CopyFrom(txn_info);
+    _lake_service.publish_version(nullptr, &request, &response, nullptr);
+    ASSERT_EQ(0, response.failed_tablets_size());
+    ASSERT_EQ(2, response.compaction_scores_size());
+    for (auto tablet_id : tablet_ids) {
+        ASSIGN_OR_ABORT(auto metadata, _tablet_mgr->get_tablet_metadata(tablet_id, 2));
+        ASSERT_EQ(1, metadata->rowsets_size());
+        ASSERT_EQ(fmt::format("{}.dat", tablet_id), metadata->rowsets(0).segments(0));
+    }
+}
+
 TEST_F(LakeServiceTest, test_publish_version_transform_single_to_batch) {
     std::vector<TxnLog> logs;
     // Empty TxnLog
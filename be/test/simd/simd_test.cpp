@@ -134,4 +134,20 @@ TEST_F(SIMDTest, count_nonzero_int32) {
     EXPECT_EQ(30u, SIMD::count_nonzero(numbers));
 }
 
+TEST_F(SIMDTest, eq_mask64) {
+    char data[64];
+    for (int i = 0; i < 64; i++) {
+        data[i] = (i % 7 == 0) ? ',' : 'a';
+    }
+    uint64_t expected = 0;
+    for (int i = 0; i < 64; i += 7) {
+        expected |= 1ULL << i;
+    }
+    EXPECT_EQ(expected, SIMD::eq_mask64(data, ','));
+    EXPECT_EQ(~expected, SIMD::eq_mask64(data, 'a'));
+    EXPECT_EQ(0u, SIMD::eq_mask64(data, '\n'));
+    data[63] = '\n';
+    EXPECT_EQ(1ULL << 63, SIMD::eq_mask64(data, '\n'));
+}
+
 } // namespace starrocks
@@ -14,9 +14,13 @@
 
 #include "storage/chunk_helper.h"
 
+#include <atomic>
+
 #include "column/chunk.h"
 #include "column/column.h"
+#include "column/column_pool.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "gtest/gtest.h"
 #include "runtime/descriptor_helper.h"
@@ -24,6 +28,7 @@
 #include "runtime/mem_tracker.h"
 #include "runtime/runtime_state.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -108,6 +113,29 @@ TEST_F(ChunkHelperTest, new_chunk_with_tuple) {
     ASSERT_EQ(chunk->get_column_by_slot_id(8)->get_name(), "binary");
 }
 
+TEST_F(ChunkHelperTest, new_chunk_pooled_with_slots) {
+    auto* tuple_desc = _create_tuple_desc();
+    auto before = describe_column_pool<Int32Column>();
+
+    {
+        auto chunk = ChunkHelper::new_chunk_pooled(tuple_desc->slots(), 1024);
+        ASSERT_EQ(chunk->num_columns(), 9);
+        ASSERT_EQ(chunk->get_column_by_slot_id(2)->get_name(), "integral-4");
+        ASSERT_EQ(chunk->get_column_by_slot_id(4)->get_name(), "int128");
+        ASSERT_EQ(chunk->get_column_by_slot_id(7)->get_name(), "binary");
+        chunk->get_column_by_slot_id(2)->append_datum(Datum(int32_t(1)));
+    }
+    // the columns are returned to the pool when the chunk is destroyed, so the next chunk reuses them.
+    {
+        auto chunk = ChunkHelper::new_chunk_pooled(tuple_desc->slots(), 1024);
+        ASSERT_EQ(chunk->get_column_by_slot_id(2)->size(), 0);
+    }
+    auto after = describe_column_pool<Int32Column>();
+    ASSERT_EQ(after.hit_count + after.miss_count, before.hit_count + before.miss_count + 2);
+    ASSERT_GE(after.hit_count, before.hit_count + 1);
+    TEST_clear_all_columns_this_thread();
+}
+
 TEST_F(ChunkHelperTest, ReorderChunk) {
     auto* tuple_desc = _create_tuple_desc();
 
@@ -185,6 +213,32 @@ TEST_F(ChunkHelperTest, Accumulator) {
     EXPECT_TRUE(accumulator.reach_limit());
 }
 
+TEST_F(ChunkHelperTest, ParallelForColumns) {
+    const int32_t old_min_columns = config::column_parallel_min_columns;
+    DeferOp defer([&]() { config::column_parallel_min_columns = old_min_columns; });
+    config::column_parallel_min_columns = 8;
+
+    for (size_t num_columns : {0, 1, 7, 8, 33, 100}) {
+        std::vector<std::atomic<int>> visits(num_columns);
+        auto st = ChunkHelper::parallel_for_columns(num_columns, [&](size_t begin, size_t end) {
+            EXPECT_LE(begin, end);
+            for (size_t i = begin; i < end; i++) {
+                visits[i]++;
+            }
+            return Status::OK();
+        });
+        ASSERT_TRUE(st.ok()) << st;
+        for (size_t i = 0; i < num_columns; i++) {
+            ASSERT_EQ(1, visits[i]) << "column " << i << " of " << num_columns;
+        }
+    }
+
+    auto st = ChunkHelper::parallel_for_columns(100, [&](size_t begin, size_t end) {
+        return end == 100 ? Status::InternalError("append failed") : Status::OK();
+    });
+    ASSERT_TRUE(st.is_internal_error()) << st;
+}
+
 class ChunkPipelineAccumulatorTest : public ::testing::Test {
 protected:
     ChunkPtr _generate_chunk(size_t rows, size_t cols, size_t reserve_size = 0);
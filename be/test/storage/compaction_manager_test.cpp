@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <memory>
 #include <random>
+#include <thread>
 
 #include "fs/fs_util.h"
 #include "runtime/mem_pool.h"
@@ -31,6 +32,7 @@
 #include "storage/tablet.h"
 #include "storage/tablet_updates.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -143,6 +145,29 @@ TEST_F(CompactionManagerTest, test_candidates) {
     }
 }
 
+TEST_F(CompactionManagerTest, test_read_amplification_score) {
+    TabletSharedPtr tablet = std::make_shared<Tablet>();
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    tablet_meta->set_tablet_id(100);
+    tablet->set_tablet_meta(tablet_meta);
+    ASSERT_EQ(0, tablet->read_amplification_score());
+
+    // a query reading a single rowset without merging has nothing to gain from a compaction
+    tablet->add_query_read_amplification(1, 0);
+    ASSERT_EQ(0, tablet->read_amplification_score());
+
+    tablet->add_query_read_amplification(5, 0);
+    ASSERT_NEAR(4, tablet->read_amplification_score(), 0.01);
+    tablet->add_query_read_amplification(1, config::vector_chunk_size * 2);
+    ASSERT_NEAR(6, tablet->read_amplification_score(), 0.01);
+
+    auto half_life = config::compaction_read_amp_half_life_seconds;
+    config::compaction_read_amp_half_life_seconds = 1;
+    DeferOp reset([&] { config::compaction_read_amp_half_life_seconds = half_life; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    ASSERT_LT(tablet->read_amplification_score(), 3);
+}
+
 TEST_F(CompactionManagerTest, test_candidates_exceede) {
     config::max_compaction_candidate_num = 10;
     std::vector<CompactionCandidate> candidates;
@@ -33,7 +33,9 @@
 #include "storage/tablet_meta.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_reader_params.h"
+#include "storage/vertical_compaction_task.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 class CompactionParallelizationTest : public testing::Test {
@@ -980,4 +982,47 @@ TEST_F(CompactionParallelizationTest, test_default_base_cumu_compaction_parallel
     ASSERT_EQ(10, versions[0].second);
 }
 
+TEST_F(CompactionParallelizationTest, test_vertical_compaction_read_ahead) {
+    config::vertical_compaction_max_columns_per_group = 1;
+    auto read_ahead_chunks = config::vertical_compaction_read_ahead_chunks;
+    config::vertical_compaction_read_ahead_chunks = 1;
+    DeferOp reset([&] { config::vertical_compaction_read_ahead_chunks = read_ahead_chunks; });
+    ASSERT_NE(nullptr, _engine->compaction_manager()->read_ahead_pool());
+
+    create_tablet_schema(UNIQUE_KEYS);
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    create_tablet_meta(tablet_meta.get());
+    TabletSharedPtr tablet = Tablet::create_tablet_from_meta(tablet_meta, _engine->get_stores()[0]);
+    ASSERT_TRUE(tablet->init().ok());
+
+    for (int i = 0; i < 5; ++i) {
+        write_new_version(tablet);
+    }
+
+    _engine->compaction_manager()->update_tablet(tablet);
+    CompactionCandidate compaction_candidate;
+    ASSERT_TRUE(_engine->compaction_manager()->pick_candidate(&compaction_candidate));
+    auto compaction_task = compaction_candidate.tablet->create_compaction_task();
+    ASSERT_NE(nullptr, dynamic_cast<VerticalCompactionTask*>(compaction_task.get()));
+    ASSERT_TRUE(_engine->compaction_manager()->register_task(compaction_task.get()));
+    {
+        std::shared_lock<std::shared_mutex> compaction_lock;
+        if (compaction_task->compaction_type() == CUMULATIVE_COMPACTION) {
+            compaction_lock = std::shared_lock(compaction_task->tablet()->get_cumulative_lock(), std::try_to_lock);
+        } else {
+            compaction_lock = std::shared_lock(compaction_task->tablet()->get_base_lock(), std::try_to_lock);
+        }
+        ASSERT_TRUE(compaction_lock.owns_lock());
+        ASSERT_OK(dynamic_cast<VerticalCompactionTask*>(compaction_task.get())->run_impl());
+    }
+    _engine->compaction_manager()->unregister_task(compaction_task.get());
+
+    ASSERT_EQ(1, tablet->version_count());
+    std::vector<Version> versions;
+    tablet->list_versions(&versions);
+    ASSERT_EQ(1, versions.size());
+    ASSERT_EQ(0, versions[0].first);
+    ASSERT_EQ(4, versions[0].second);
+}
+
 } // namespace starrocks
@@ -36,6 +36,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 namespace starrocks {
 
 // NOLINTNEXTLINE
@@ -54,4 +56,39 @@ TEST(DelVector, testLoadSave) {
     ASSERT_EQ(dv2.cardinality(), dels.size());
 };
 
+// NOLINTNEXTLINE
+TEST(DelVector, testFillDeleted) {
+    DelVector dv;
+    std::vector<uint32_t> dels = {3, 4, 5, 700, 70000, 70001};
+    for (uint32_t i = 100000; i < 101000; i++) {
+        dels.push_back(i);
+    }
+    dv.init(1, dels.data(), dels.size());
+
+    std::vector<uint8_t> deleted(200000, 0xff);
+    dv.fill_deleted(0, deleted.size(), deleted.data());
+    for (uint32_t rowid = 0; rowid < deleted.size(); rowid++) {
+        ASSERT_EQ(std::binary_search(dels.begin(), dels.end(), rowid), deleted[rowid] == 1) << rowid;
+    }
+
+    // starts and ends in the middle of the deleted rows
+    deleted.assign(69999 - 4, 0xff);
+    dv.fill_deleted(4, 69999, deleted.data());
+    ASSERT_EQ(1, deleted[0]);
+    ASSERT_EQ(1, deleted[1]);
+    ASSERT_EQ(1, deleted[700 - 4]);
+    ASSERT_EQ(3, std::count(deleted.begin(), deleted.end(), 1));
+    ASSERT_EQ(0, std::count(deleted.begin(), deleted.end(), 0xff));
+
+    deleted.assign(10, 0xff);
+    dv.fill_deleted(100500, 100510, deleted.data());
+    ASSERT_EQ(10, std::count(deleted.begin(), deleted.end(), 1));
+
+    DelVector empty;
+    empty.set_empty();
+    deleted.assign(10, 0xff);
+    empty.fill_deleted(0, 10, deleted.data());
+    ASSERT_EQ(10, std::count(deleted.begin(), deleted.end(), 0));
+}
+
 } // namespace starrocks
@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+
 #include "util/hash_util.hpp"
 #include "util/phmap/phmap.h"
 #include "util/slice.h"
@@ -193,6 +195,54 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, SparseInMemory) {
+    uint8_t buf[HLL_REGISTERS_COUNT + 1];
+    uint8_t full_buf[HLL_REGISTERS_COUNT + 1];
+
+    HyperLogLog hll;
+    for (int i = 0; i < 600; ++i) {
+        hll.update(hash(i));
+    }
+    // the registers of the sparse value are serialized just like the full ones
+    HyperLogLog full_hll;
+    for (int i = 0; i < 64 * 1024; ++i) {
+        full_hll.update(hash(64 * 1024 + i));
+    }
+    HyperLogLog other_full_hll(full_hll);
+    other_full_hll.merge(hll);
+    ASSERT_LT(hll.mem_usage(), full_hll.mem_usage());
+    ASSERT_EQ(hll.max_serialized_size(), hll.serialize(buf));
+
+    HyperLogLog deserialized_hll(Slice(buf, hll.max_serialized_size()));
+    ASSERT_EQ(hll.estimate_cardinality(), deserialized_hll.estimate_cardinality());
+    deserialized_hll.merge(full_hll);
+    ASSERT_EQ(other_full_hll.serialize(full_buf), deserialized_hll.serialize(buf));
+    ASSERT_EQ(0, memcmp(full_buf, buf, HLL_REGISTERS_COUNT + 1));
+
+    // merge sparse values until they are full
+    HyperLogLog merged_hll;
+    for (int i = 0; i < 10; ++i) {
+        HyperLogLog other_hll;
+        for (int j = 0; j < 500; ++j) {
+            other_hll.update(hash(i * 500 + j));
+        }
+        merged_hll.merge(other_hll);
+    }
+    HyperLogLog updated_hll;
+    for (int i = 0; i < 5000; ++i) {
+        updated_hll.update(hash(i));
+    }
+    ASSERT_EQ(updated_hll.mem_usage(), merged_hll.mem_usage());
+    ASSERT_EQ(updated_hll.estimate_cardinality(), merged_hll.estimate_cardinality());
+    auto cardinality = merged_hll.estimate_cardinality();
+    ASSERT_TRUE(cardinality > 4850 && cardinality < 5150);
+
+    merged_hll.clear();
+    ASSERT_EQ(0, merged_hll.estimate_cardinality());
+    merged_hll.merge(hll);
+    ASSERT_EQ(hll.estimate_cardinality(), merged_hll.estimate_cardinality());
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
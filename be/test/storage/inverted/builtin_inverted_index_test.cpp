@@ -0,0 +1,129 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fs/fs_util.h"
+#include "storage/inverted/inverted_index_option.h"
+#include "storage/inverted/inverted_plugin_factory.h"
+#include "storage/types.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class BuiltinInvertedIndexTest : public testing::Test {
+protected:
+    void SetUp() override {
+        CHECK_OK(fs::remove_all(_index_dir));
+        CHECK_OK(fs::create_directories(_index_dir));
+    }
+
+    void TearDown() override { (void)fs::remove_all(_index_dir); }
+
+    std::shared_ptr<TabletIndex> make_index(const std::string& parser) {
+        auto index = std::make_shared<TabletIndex>();
+        index->add_common_properties(INVERTED_IMP_KEY, TYPE_BUILTIN);
+        index->add_index_properties(INVERTED_INDEX_PARSER_KEY, parser);
+        return index;
+    }
+
+    // Writes `values` into the index of `parser`, with nulls at `null_rows`.
+    std::unique_ptr<InvertedReader> build(const std::string& parser, const std::vector<std::string>& values,
+                                          const std::vector<uint32_t>& null_rows = {}) {
+        auto index = make_index(parser);
+        auto imp_type = get_inverted_imp_type(*index);
+        EXPECT_TRUE(imp_type.ok());
+        EXPECT_EQ(InvertedImplementType::BUILTIN, imp_type.value());
+        auto plugin = InvertedPluginFactory::get_plugin(imp_type.value());
+        EXPECT_TRUE(plugin.ok());
+
+        const std::string path = _index_dir + "/" + parser + ".ivt";
+        std::unique_ptr<InvertedWriter> writer;
+        EXPECT_OK(plugin.value()->create_inverted_index_writer(get_type_info(TYPE_VARCHAR), "c1", path, index.get(),
+                                                               &writer));
+        EXPECT_OK(writer->init());
+        size_t next_null = 0;
+        for (uint32_t row = 0; row < values.size() + null_rows.size(); row++) {
+            if (next_null < null_rows.size() && null_rows[next_null] == row) {
+                writer->add_nulls(1);
+                next_null++;
+            } else {
+                Slice value(values[row - next_null]);
+                writer->add_values(&value, 1);
+            }
+        }
+        EXPECT_GT(writer->total_mem_footprint(), 0);
+        EXPECT_OK(writer->finish());
+
+        std::unique_ptr<InvertedReader> reader;
+        EXPECT_OK(plugin.value()->create_inverted_index_reader(path, index, TYPE_VARCHAR, &reader));
+        return reader;
+    }
+
+    static std::vector<uint32_t> query(InvertedReader* reader, const std::string& value,
+                                       InvertedIndexQueryType query_type) {
+        Slice slice(value);
+        roaring::Roaring result;
+        EXPECT_OK(reader->query(nullptr, "c1", &slice, query_type, &result));
+        std::vector<uint32_t> rows(result.begin(), result.end());
+        return rows;
+    }
+
+    const std::string _index_dir = "./builtin_inverted_index_test";
+};
+
+// NOLINTNEXTLINE
+TEST_F(BuiltinInvertedIndexTest, test_untokenized) {
+    auto reader = build(INVERTED_INDEX_PARSER_NONE, {"apple", "banana", "", "apple", "cherry", "apricot"}, {2});
+
+    ASSERT_EQ(std::vector<uint32_t>({0, 4}), query(reader.get(), "apple", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(std::vector<uint32_t>({3}), query(reader.get(), "", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_TRUE(query(reader.get(), "durian", InvertedIndexQueryType::EQUAL_QUERY).empty());
+    ASSERT_EQ(std::vector<uint32_t>({0, 4, 6}),
+              query(reader.get(), "ap%", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ(std::vector<uint32_t>({1}), query(reader.get(), "*an?na%", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ(std::vector<uint32_t>({0, 1, 3, 4, 6}),
+              query(reader.get(), "banana", InvertedIndexQueryType::LESS_EQUAL_QUERY));
+    ASSERT_EQ(std::vector<uint32_t>({5}), query(reader.get(), "banana", InvertedIndexQueryType::GREATER_THAN_QUERY));
+
+    roaring::Roaring nulls;
+    ASSERT_OK(reader->query_null(nullptr, "c1", &nulls));
+    ASSERT_EQ(roaring::Roaring::bitmapOf(1, 2), nulls);
+}
+
+// NOLINTNEXTLINE
+TEST_F(BuiltinInvertedIndexTest, test_tokenized) {
+    auto reader = build(INVERTED_INDEX_PARSER_ENGLISH,
+                        {"The quick brown fox", "quick, QUICK brown!", "brown fox jumps", "the lazy dog", "fox brown"});
+
+    ASSERT_EQ(std::vector<uint32_t>({0, 1}), query(reader.get(), "Quick", InvertedIndexQueryType::MATCH_ALL_QUERY));
+    ASSERT_EQ(std::vector<uint32_t>({0, 2, 4}),
+              query(reader.get(), "fox brown", InvertedIndexQueryType::MATCH_ALL_QUERY));
+    ASSERT_EQ(std::vector<uint32_t>({0, 1, 2, 4}),
+              query(reader.get(), "brown", InvertedIndexQueryType::MATCH_ALL_QUERY));
+    ASSERT_EQ(std::vector<uint32_t>({0, 2}),
+              query(reader.get(), "brown fox", InvertedIndexQueryType::MATCH_PHRASE_QUERY));
+    ASSERT_EQ(std::vector<uint32_t>({0, 1}),
+              query(reader.get(), "quick brown", InvertedIndexQueryType::MATCH_PHRASE_QUERY));
+    // the phrase never spans two docs
+    ASSERT_TRUE(query(reader.get(), "fox quick", InvertedIndexQueryType::MATCH_PHRASE_QUERY).empty());
+    ASSERT_TRUE(query(reader.get(), "fox dog", InvertedIndexQueryType::MATCH_PHRASE_QUERY).empty());
+    ASSERT_EQ(std::vector<uint32_t>({2}), query(reader.get(), "JUMP*", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+}
+
+} // namespace starrocks
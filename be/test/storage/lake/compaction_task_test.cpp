@@ -27,6 +27,7 @@
 #include "storage/lake/compaction_test_utils.h"
 #include "storage/lake/delta_writer.h"
 #include "storage/lake/horizontal_compaction_task.h"
+#include "storage/lake/metacache.h"
 #include "storage/lake/tablet_manager.h"
 #include "storage/lake/tablet_reader.h"
 #include "storage/lake/vertical_compaction_task.h"
@@ -155,6 +156,16 @@ TEST_P(LakeDuplicateKeyCompactionTest, test1) {
     check_task(task);
     ASSERT_OK(task->execute(CompactionTask::kNoCancelFn));
     EXPECT_EQ(100, task_context->progress.value());
+    // The output segments are opened into the metacache before any query reads them
+    {
+        ASSIGN_OR_ABORT(auto txn_log, _tablet_mgr->get_txn_log(tablet_id, txn_id));
+        const auto& output = txn_log->op_compaction().output_rowset();
+        ASSERT_GT(output.segments_size(), 0);
+        for (const auto& segment : output.segments()) {
+            auto location = _tablet_mgr->segment_location(tablet_id, segment);
+            EXPECT_TRUE(_tablet_mgr->metacache()->lookup_segment(location) != nullptr) << location;
+        }
+    }
     ASSERT_OK(publish_single_version(_tablet_metadata->id(), version + 1, txn_id).status());
     version++;
     ASSERT_EQ(kChunkSize * 3, read(version));
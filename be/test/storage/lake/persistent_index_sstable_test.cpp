@@ -16,7 +16,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <ctime>
+#include <numeric>
+#include <random>
 #include <set>
 
 #include "common/config.h"
@@ -436,4 +439,55 @@ TEST_F(PersistentIndexSstableTest, test_index_value_protobuf) {
     }
 }
 
+TEST_F(PersistentIndexSstableTest, test_multi_get_unsorted_keys) {
+    // only the even keys are in the sstable, so the odd keys fall into the blocks of their neighbours
+    const int N = 20000;
+    const std::string filename = "test_multi_get_unsorted_keys.sst";
+    ASSIGN_OR_ABORT(auto file, fs::new_writable_file(lake::join_path(kTestDir, filename)));
+    phmap::btree_map<std::string, std::list<IndexValueWithVer>, std::less<>> map;
+    for (int i = 0; i < N; i += 2) {
+        std::list<IndexValueWithVer> index_value_vers;
+        index_value_vers.emplace_front(100, i);
+        map.insert({fmt::format("test_key_{:016X}", i), index_value_vers});
+    }
+    uint64_t filesize = 0;
+    ASSERT_OK(PersistentIndexSstable::build_sstable(map, file.get(), &filesize));
+    auto sst = std::make_unique<PersistentIndexSstable>();
+    ASSIGN_OR_ABORT(auto read_file, fs::new_random_access_file(lake::join_path(kTestDir, filename)));
+    PersistentIndexSstablePB sstable_pb;
+    sstable_pb.set_filename(filename);
+    sstable_pb.set_filesize(filesize);
+    ASSERT_OK(sst->init(std::move(read_file), sstable_pb, nullptr));
+
+    std::vector<std::string> index_keys;
+    sst->get_index_keys(&index_keys);
+    ASSERT_GT(index_keys.size(), 1);
+    ASSERT_TRUE(std::is_sorted(index_keys.begin(), index_keys.end()));
+
+    std::vector<int> ids(N);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(std::random_device()()));
+    std::vector<std::string> keys_str(N);
+    std::vector<Slice> keys(N);
+    KeyIndexSet key_indexes;
+    for (int i = 0; i < N; i++) {
+        keys_str[i] = fmt::format("test_key_{:016X}", ids[i]);
+        keys[i] = Slice(keys_str[i]);
+        key_indexes.insert(i);
+    }
+    std::vector<IndexValue> values(N, IndexValue(NullIndexValue));
+    KeyIndexSet found_key_indexes;
+    ASSERT_OK(sst->multi_get(keys.data(), key_indexes, -1, values.data(), &found_key_indexes));
+    ASSERT_EQ(N / 2, found_key_indexes.size());
+    for (int i = 0; i < N; i++) {
+        if (ids[i] % 2 == 0) {
+            ASSERT_TRUE(found_key_indexes.count(i) > 0);
+            ASSERT_EQ(IndexValue(ids[i]), values[i]);
+        } else {
+            ASSERT_EQ(0, found_key_indexes.count(i));
+            ASSERT_EQ(NullIndexValue, values[i].get_value());
+        }
+    }
+}
+
 } // namespace starrocks::lake
@@ -30,10 +30,12 @@
 #include "storage/lake/update_manager.h"
 #include "storage/lake/versioned_tablet.h"
 #include "storage/options.h"
+#include "storage/protobuf_file.h"
 #include "storage/tablet_schema.h"
 #include "testutil/assert.h"
 #include "testutil/id_generator.h"
 #include "util/bthreads/util.h"
+#include "util/defer_op.h"
 #include "util/filesystem_util.h"
 
 // NOTE: intend to put the following header to the end of the include section
@@ -206,6 +208,89 @@ TEST_F(LakeTabletManagerTest, create_tablet_without_schema_file) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(LakeTabletManagerTest, incremental_tablet_metadata) {
+    auto old_enable = config::lake_enable_incremental_tablet_metadata;
+    auto old_interval = config::lake_tablet_metadata_checkpoint_interval;
+    config::lake_enable_incremental_tablet_metadata = true;
+    config::lake_tablet_metadata_checkpoint_interval = 3;
+    DeferOp defer([&]() {
+        config::lake_enable_incremental_tablet_metadata = old_enable;
+        config::lake_tablet_metadata_checkpoint_interval = old_interval;
+    });
+
+    const int64_t tablet_id = 34567;
+    auto add_rowset = [](TabletMetadata* metadata, uint32_t id) {
+        auto rowset = metadata->add_rowsets();
+        rowset->set_id(id);
+        rowset->set_num_rows(id * 10);
+        rowset->add_segments(fmt::format("segment_{}.dat", id));
+    };
+    auto load_raw = [&](int64_t version) {
+        TabletMetadata metadata;
+        ProtobufFile file(_location_provider->tablet_metadata_location(tablet_id, version));
+        CHECK_OK(file.load(&metadata));
+        return metadata;
+    };
+
+    auto metadata = std::make_shared<TabletMetadata>();
+    metadata->set_id(tablet_id);
+    metadata->set_version(2);
+    metadata->mutable_schema()->set_id(100);
+    add_rowset(metadata.get(), 1);
+    add_rowset(metadata.get(), 2);
+    ASSERT_OK(_tablet_manager->put_tablet_metadata(metadata));
+    // The first metadata is a checkpoint.
+    EXPECT_EQ(2, load_raw(2).checkpoint_version());
+    EXPECT_EQ(2, load_raw(2).rowsets_size());
+
+    // version 3 adds rowset 3, version 4 replaces rowset 2 with rowset 4
+    ASSIGN_OR_ABORT(auto v2, _tablet_manager->get_tablet_metadata(tablet_id, 2));
+    auto v3 = std::make_shared<TabletMetadata>(*v2);
+    v3->set_version(3);
+    add_rowset(v3.get(), 3);
+    ASSERT_OK(_tablet_manager->put_tablet_metadata(v3));
+    auto v4 = std::make_shared<TabletMetadata>(*v3);
+    v4->set_version(4);
+    v4->mutable_rowsets()->DeleteSubrange(1, 1);
+    add_rowset(v4.get(), 4);
+    ASSERT_OK(_tablet_manager->put_tablet_metadata(v4));
+
+    auto raw4 = load_raw(4);
+    EXPECT_EQ(2, raw4.checkpoint_version());
+    EXPECT_TRUE(raw4.delta_inherit_schema());
+    EXPECT_FALSE(raw4.has_schema());
+    ASSERT_EQ(2, raw4.rowsets_size());
+    EXPECT_EQ(3, raw4.rowsets(0).id());
+    EXPECT_EQ(4, raw4.rowsets(1).id());
+    EXPECT_EQ(3, raw4.delta_rowset_ids_size());
+
+    // Read the deltas without the metacache
+    _tablet_manager->prune_metacache();
+    for (const auto& expect : {v3, v4}) {
+        ASSIGN_OR_ABORT(auto actual, _tablet_manager->get_tablet_metadata(tablet_id, expect->version()));
+        EXPECT_EQ(expect->version(), actual->version());
+        EXPECT_EQ(2, actual->checkpoint_version());
+        EXPECT_EQ(0, actual->delta_rowset_ids_size());
+        EXPECT_EQ(100, actual->schema().id());
+        ASSERT_EQ(expect->rowsets_size(), actual->rowsets_size());
+        for (int i = 0; i < expect->rowsets_size(); i++) {
+            EXPECT_EQ(expect->rowsets(i).id(), actual->rowsets(i).id());
+            EXPECT_EQ(expect->rowsets(i).segments(0), actual->rowsets(i).segments(0));
+        }
+    }
+
+    // version 5 is lake_tablet_metadata_checkpoint_interval versions away from the checkpoint
+    ASSIGN_OR_ABORT(auto v4_read, _tablet_manager->get_tablet_metadata(tablet_id, 4));
+    auto v5 = std::make_shared<TabletMetadata>(*v4_read);
+    v5->set_version(5);
+    ASSERT_OK(_tablet_manager->put_tablet_metadata(v5));
+    auto raw5 = load_raw(5);
+    EXPECT_EQ(5, raw5.checkpoint_version());
+    EXPECT_EQ(3, raw5.rowsets_size());
+    EXPECT_EQ(0, raw5.delta_rowset_ids_size());
+}
+
 // NOLINTNEXTLINE
 TEST_F(LakeTabletManagerTest, list_tablet_meta) {
     starrocks::TabletMetadata metadata;
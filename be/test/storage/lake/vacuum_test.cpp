@@ -30,6 +30,7 @@
 #include "test_util.h"
 #include "testutil/assert.h"
 #include "testutil/sync_point.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 
 namespace starrocks::lake {
@@ -1449,6 +1450,30 @@ TEST(LakeVacuumTest2, test_delete_files_retry3) {
     EXPECT_EQ(0, attempts);
 }
 
+TEST(LakeVacuumTest2, test_delete_files_qps_limit) {
+    auto backup = config::lake_vacuum_delete_qps_per_bucket;
+    config::lake_vacuum_delete_qps_per_bucket = 10;
+    DeferOp defer([&]() { config::lake_vacuum_delete_qps_per_bucket = backup; });
+
+    WritableFileOptions options;
+    options.mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE;
+    std::vector<std::string> paths;
+    for (int i = 0; i < 3; i++) {
+        paths.emplace_back(fmt::format("test_vacuum_delete_files_qps_limit_{}.txt", i));
+        ASSIGN_OR_ABORT(auto f, fs::new_writable_file(options, paths.back()));
+        ASSERT_OK(f->append("111"));
+        ASSERT_OK(f->close());
+    }
+
+    // Each call sends one delete request, the requests are at least 100ms apart.
+    auto t0 = MonotonicMillis();
+    for (const auto& path : paths) {
+        ASSERT_OK(delete_files({path}));
+        ASSERT_FALSE(fs::path_exist(path));
+    }
+    EXPECT_GE(MonotonicMillis() - t0, 190);
+}
+
 TEST(LakeVacuumTest2, test_delete_files_retry4) {
     WritableFileOptions options;
     options.mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE;
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <random>
 
 #include "column/datum_tuple.h"
@@ -291,6 +292,60 @@ TEST_F(MemTableTest, testDupKeysInsertFlushRead) {
     ASSERT_EQ(n, pkey_read);
 }
 
+TEST_F(MemTableTest, testDupKeysSortedInsertFlushRead) {
+    const string path = "./MemTableTest_testDupKeysSortedInsertFlushRead";
+    MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::DUP_KEYS), "pk int,name varchar,pv int",
+            path);
+    const size_t n = 3000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes(n);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    // the rows in the order of the sort key are not sorted again
+    ASSERT_TRUE(_mem_table->insert(*pchunk, indexes.data(), 0, indexes.size()).ok());
+    ASSERT_TRUE(_mem_table->finalize().ok());
+    ASSERT_OK(_mem_table->flush());
+
+    // the rows out of order are still sorted
+    _mem_table =
+            std::make_unique<MemTable>(1, &_vectorized_schema, _slots, _mem_table_sink.get(), _mem_tracker.get());
+    std::reverse(indexes.begin() + n / 2, indexes.end());
+    ASSERT_TRUE(_mem_table->insert(*pchunk, indexes.data(), 0, indexes.size()).ok());
+    ASSERT_TRUE(_mem_table->finalize().ok());
+    ASSERT_OK(_mem_table->flush());
+
+    RowsetSharedPtr rowset = *_writer->build();
+    ASSERT_EQ(2, rowset->num_segments());
+    unique_ptr<Schema> read_schema = create_schema("pk int", 1);
+    OlapReaderStatistics stats;
+    RowsetReadOptions rs_opts;
+    rs_opts.sorted = false;
+    rs_opts.use_page_cache = false;
+    rs_opts.stats = &stats;
+    auto itr = rowset->new_iterator(*read_schema, rs_opts);
+    ASSERT_TRUE(itr.ok()) << itr.status().to_string();
+    std::shared_ptr<Chunk> chunk = ChunkHelper::new_chunk(*read_schema, 4096);
+    size_t pkey_read = 0;
+    // the segments are read one after another, each in the ascending order
+    size_t num_sorted_runs = 1;
+    int last_value = 0;
+    while (true) {
+        Status st = (*itr)->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        auto column = chunk->get_column_by_name("pk");
+        for (size_t i = 0; i < column->size(); i++) {
+            int new_value = column->get(i).get_int32();
+            num_sorted_runs += new_value < last_value;
+            last_value = new_value;
+        }
+        pkey_read += chunk->num_rows();
+        chunk->reset();
+    }
+    ASSERT_EQ(2, num_sorted_runs);
+    ASSERT_EQ(2 * n, pkey_read);
+}
+
 TEST_F(MemTableTest, testUniqKeysInsertFlushRead) {
     const string path = "./MemTableTest_testUniqKeysInsertFlushRead";
     MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::UNIQUE_KEYS), "pk int,name varchar,pv int",
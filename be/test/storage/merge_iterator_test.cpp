@@ -128,6 +128,51 @@ TEST_F(MergeIteratorTest, heap_merge_no_overlapping) {
     ASSERT_TRUE(iter->get_next(chunk.get()).is_end_of_file());
 }
 
+// NOLINTNEXTLINE
+TEST_F(MergeIteratorTest, heap_merge_runs) {
+    // the children mix long runs that overlap no other child with duplicated keys across the children
+    std::vector<std::vector<int32_t>> values(9);
+    std::vector<std::pair<int32_t, uint16_t>> expected;
+    for (uint16_t child = 0; child < values.size(); child++) {
+        for (int32_t i = 0; i < 300; i++) {
+            int32_t v = (i / 50) * 1000 + (i % 50 < 40 ? child * 100 + i % 50 : i % 3);
+            values[child].push_back(v);
+        }
+        std::sort(values[child].begin(), values[child].end());
+        for (int32_t v : values[child]) {
+            expected.emplace_back(v, child);
+        }
+    }
+    // the rows of the same key are ordered by the child
+    std::stable_sort(expected.begin(), expected.end());
+
+    std::vector<ChunkIteratorPtr> subs;
+    for (const auto& v : values) {
+        auto sub = std::make_shared<VectorChunkIterator>(_schema, COL_INT(v));
+        sub->chunk_size(37);
+        subs.push_back(sub);
+    }
+    auto iter = new_heap_merge_iterator(subs);
+    ASSERT_TRUE(iter->init_encoded_schema(EMPTY_GLOBAL_DICTMAPS).ok());
+
+    std::vector<RowSourceMask> source_masks;
+    std::vector<int32_t> real;
+    ChunkPtr chunk = ChunkHelper::new_chunk(iter->schema(), 100);
+    while (iter->get_next(chunk.get(), &source_masks).ok()) {
+        ColumnPtr& c = chunk->get_column_by_index(0);
+        for (size_t i = 0; i < c->size(); i++) {
+            real.push_back(c->get(i).get_int32());
+        }
+        chunk->reset();
+    }
+    ASSERT_EQ(expected.size(), real.size());
+    ASSERT_EQ(expected.size(), source_masks.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i].first, real[i]) << i;
+        ASSERT_EQ(expected[i].second, source_masks[i].get_source_num()) << i;
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(MergeIteratorTest, merge_one) {
     auto sub1 = std::make_shared<VectorChunkIterator>(_schema, COL_INT({1, 1, 2, 3, 4, 5}));
@@ -36,7 +36,12 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
+#include "fs/fs_util.h"
 #include "runtime/mem_tracker.h"
+#include "storage/page_disk_cache.h"
+#include "testutil/assert.h"
 
 namespace starrocks {
 
@@ -184,4 +189,101 @@ TEST_F(StoragePageCacheTest, metrics) {
     ASSERT_EQ(cache.get_hit_count(), 2);
 }
 
+TEST_F(StoragePageCacheTest, disk_cache) {
+    const std::string dir = "./page_disk_cache_test";
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
+    ASSERT_OK(cache.init_disk_cache(dir, 1L << 30));
+
+    StoragePageCache::CacheKey key("abc", 0);
+    {
+        char* buf = new char[1024];
+        memset(buf, 'a', 1024);
+        PageCacheHandle handle;
+        cache.insert(key, Slice(buf, 1024), &handle, false);
+    }
+    // put too many page to eliminate first page from memory
+    for (int i = 0; i < 10 * kNumShards; ++i) {
+        StoragePageCache::CacheKey key("bcd", i);
+        PageCacheHandle handle;
+        Slice data(new char[1024], 1024);
+        cache.insert(key, data, &handle, false);
+    }
+    cache.disk_cache()->flush();
+    ASSERT_EQ((10 * kNumShards + 1) * 1024, cache.disk_cache()->disk_usage());
+
+    {
+        // read from the disk cache, and inserted into memory again
+        PageCacheHandle handle;
+        ASSERT_TRUE(cache.lookup(key, &handle));
+        ASSERT_EQ(1024, handle.data().size);
+        ASSERT_EQ(std::string(1024, 'a'), handle.data().to_string());
+        ASSERT_EQ(1, cache.disk_cache()->get_hit_count());
+
+        PageCacheHandle memory_handle;
+        ASSERT_TRUE(cache.lookup(key, &memory_handle));
+        ASSERT_EQ(handle.data().data, memory_handle.data().data);
+        ASSERT_EQ(1, cache.disk_cache()->get_hit_count());
+    }
+
+    {
+        PageCacheHandle handle;
+        StoragePageCache::CacheKey miss_key("abc", 1);
+        ASSERT_FALSE(cache.lookup(miss_key, &handle));
+    }
+
+    // the corrupted page in the disk cache is dropped
+    for (int i = 0; i < 10 * kNumShards; ++i) {
+        StoragePageCache::CacheKey key("abc", i + 1);
+        PageCacheHandle handle;
+        Slice data(new char[1024], 1024);
+        cache.insert(key, data, &handle, false);
+    }
+    cache.disk_cache()->flush();
+    {
+        std::fstream block(dir + "/0.blk", std::ios::in | std::ios::out | std::ios::binary);
+        block.seekp(0);
+        block.put('b');
+    }
+    {
+        PageCacheHandle handle;
+        ASSERT_FALSE(cache.lookup(key, &handle));
+        ASSERT_EQ(1, cache.disk_cache()->get_corrupted_count());
+        ASSERT_FALSE(cache.lookup(key, &handle));
+        ASSERT_EQ(1, cache.disk_cache()->get_corrupted_count());
+    }
+    ASSERT_OK(fs::remove_all(dir));
+}
+
+TEST_F(StoragePageCacheTest, disk_cache_dir) {
+    const std::string dir = "./page_disk_cache_dir_test";
+    auto* file_system = FileSystem::Default();
+    (void)fs::remove_all(dir);
+    ASSERT_OK(file_system->create_dir_recursive(dir));
+    std::ofstream(dir + "/data") << "data";
+
+    // a non-empty directory not created by the cache is left untouched
+    {
+        PageDiskCache disk_cache(dir, 1L << 30, 1L << 20, _mem_tracker.get());
+        ASSERT_TRUE(disk_cache.init().is_invalid_argument());
+        ASSERT_OK(file_system->path_exists(dir + "/data"));
+    }
+
+    // only the block files are removed from the directory of the cache
+    ASSERT_OK(file_system->delete_file(dir + "/data"));
+    {
+        PageDiskCache disk_cache(dir, 1L << 30, 1L << 20, _mem_tracker.get());
+        ASSERT_OK(disk_cache.init());
+        ASSERT_OK(file_system->path_exists(dir + "/" + PageDiskCache::kMarkerFile));
+    }
+    std::ofstream(dir + "/7.blk") << "page";
+    std::ofstream(dir + "/data") << "data";
+    {
+        PageDiskCache disk_cache(dir, 1L << 30, 1L << 20, _mem_tracker.get());
+        ASSERT_OK(disk_cache.init());
+        ASSERT_TRUE(file_system->path_exists(dir + "/7.blk").is_not_found());
+        ASSERT_OK(file_system->path_exists(dir + "/data"));
+    }
+    ASSERT_OK(fs::remove_all(dir));
+}
+
 } // namespace starrocks
@@ -365,6 +365,17 @@ TEST_P(PersistentIndexTest, test_large_varlen_mutable_index) {
                         .ok());
     ASSERT_EQ(upsert_num_found, expect_exists);
     ASSERT_EQ(upsert_not_found.size(), expect_not_found);
+
+    // the values of the existing keys are overwritten in place
+    vector<IndexValue> get3_values(upsert_keys.size());
+    KeysInfo get3_not_found;
+    size_t get3_num_found = 0;
+    ASSERT_TRUE(
+            idx->get(upsert_key_slices.data(), get3_values.data(), &get3_not_found, &get3_num_found, idxes).ok());
+    ASSERT_EQ(N, get3_num_found);
+    for (int i = 0; i < N; i++) {
+        ASSERT_EQ(upsert_values[i], get3_values[i]);
+    }
 }
 
 TEST_P(PersistentIndexTest, test_fixlen_mutable_index_wal) {
@@ -0,0 +1,126 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/pk_row_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+#include "column/fixed_length_column.h"
+
+namespace starrocks {
+
+class PkRowCacheTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _columns.emplace_back(Int32Column::create());
+        _columns.emplace_back(BinaryColumn::create());
+        for (int i = 0; i < 3; i++) {
+            _columns[0]->append_datum(Datum(i * 10));
+            _columns[1]->append_datum(Datum(Slice(_values[i])));
+        }
+        _pks = Int32Column::create();
+        for (int i = 0; i < 3; i++) {
+            _pks->append_datum(Datum(i));
+        }
+    }
+
+    PkRowCache _cache{1024 * 1024};
+    TabletSchemaCSPtr _schema = std::make_shared<const TabletSchema>();
+    std::string _values[3] = {"a", "bb", "ccc"};
+    MutableColumns _columns;
+    MutableColumnPtr _pks;
+};
+
+// NOLINTNEXTLINE
+TEST_F(PkRowCacheTest, test_lookup_and_insert) {
+    const int64_t tablet_id = 1;
+    auto ctx = _cache.begin_read(tablet_id);
+    PkRowCacheHandle handle;
+    ASSERT_FALSE(_cache.lookup(ctx, PkRowCache::pk_slice(*_pks, 1), 5, _schema, &handle));
+    _cache.insert(ctx, PkRowCache::pk_slice(*_pks, 1), 5, _schema, _columns, 1);
+
+    ASSERT_TRUE(_cache.lookup(ctx, PkRowCache::pk_slice(*_pks, 1), 5, _schema, &handle));
+    ASSERT_TRUE(handle.valid());
+    ASSERT_EQ(2, handle.entry()->columns.size());
+    ASSERT_EQ(10, handle.entry()->columns[0]->get(0).get_int32());
+    ASSERT_EQ("bb", handle.entry()->columns[1]->get(0).get_slice().to_string());
+
+    // newer versions see the row, older versions and other schemas do not
+    PkRowCacheHandle h2;
+    ASSERT_TRUE(_cache.lookup(ctx, PkRowCache::pk_slice(*_pks, 1), 6, _schema, &h2));
+    PkRowCacheHandle h3;
+    ASSERT_FALSE(_cache.lookup(ctx, PkRowCache::pk_slice(*_pks, 1), 4, _schema, &h3));
+    ASSERT_FALSE(_cache.lookup(ctx, PkRowCache::pk_slice(*_pks, 1), 5, std::make_shared<const TabletSchema>(), &h3));
+    // the same key of another tablet
+    auto ctx2 = _cache.begin_read(tablet_id + 1);
+    ASSERT_FALSE(_cache.lookup(ctx2, PkRowCache::pk_slice(*_pks, 1), 5, _schema, &h3));
+
+    ASSERT_EQ(5, _cache.get_lookup_count());
+    ASSERT_EQ(2, _cache.get_hit_count());
+    ASSERT_GT(_cache.get_memory_usage(), 0);
+}
+
+// NOLINTNEXTLINE
+TEST_F(PkRowCacheTest, test_invalidate) {
+    const int64_t tablet_id = 1;
+    auto ctx = _cache.begin_read(tablet_id);
+    for (int i = 0; i < 3; i++) {
+        _cache.insert(ctx, PkRowCache::pk_slice(*_pks, i), 5, _schema, _columns, i);
+    }
+
+    // erase the key 0
+    _cache.begin_update(tablet_id);
+    auto erased = _pks->clone_empty();
+    erased->append(*_pks, 0, 1);
+    _cache.erase(tablet_id, *erased);
+    _cache.end_update(tablet_id);
+
+    ctx = _cache.begin_read(tablet_id);
+    PkRowCacheHandle handle;
+    ASSERT_FALSE(_cache.lookup(ctx, PkRowCache::pk_slice(*_pks, 0), 6, _schema, &handle));
+    ASSERT_TRUE(_cache.lookup(ctx, PkRowCache::pk_slice(*_pks, 1), 6, _schema, &handle));
+
+    // drop all the rows of the tablet
+    _cache.invalidate_tablet(tablet_id);
+    ctx = _cache.begin_read(tablet_id);
+    PkRowCacheHandle h2;
+    ASSERT_FALSE(_cache.lookup(ctx, PkRowCache::pk_slice(*_pks, 1), 6, _schema, &h2));
+    ASSERT_FALSE(_cache.lookup(ctx, PkRowCache::pk_slice(*_pks, 2), 6, _schema, &h2));
+}
+
+// NOLINTNEXTLINE
+TEST_F(PkRowCacheTest, test_no_insert_across_update) {
+    const int64_t tablet_id = 1;
+    // a reader started before an apply must not insert the rows it read
+    auto ctx = _cache.begin_read(tablet_id);
+    _cache.begin_update(tablet_id);
+    _cache.insert(ctx, PkRowCache::pk_slice(*_pks, 0), 5, _schema, _columns, 0);
+    _cache.end_update(tablet_id);
+    _cache.insert(ctx, PkRowCache::pk_slice(*_pks, 1), 5, _schema, _columns, 1);
+
+    // nor a reader started while applying
+    _cache.begin_update(tablet_id);
+    auto ctx2 = _cache.begin_read(tablet_id);
+    _cache.insert(ctx2, PkRowCache::pk_slice(*_pks, 2), 5, _schema, _columns, 2);
+    _cache.end_update(tablet_id);
+
+    auto ctx3 = _cache.begin_read(tablet_id);
+    PkRowCacheHandle handle;
+    for (int i = 0; i < 3; i++) {
+        ASSERT_FALSE(_cache.lookup(ctx3, PkRowCache::pk_slice(*_pks, i), 6, _schema, &handle));
+    }
+}
+
+} // namespace starrocks
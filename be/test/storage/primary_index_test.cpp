@@ -21,12 +21,14 @@
 #include "column/binary_column.h"
 #include "column/fixed_length_column.h"
 #include "column/schema.h"
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "gutil/strings/substitute.h"
 #include "storage/chunk_helper.h"
 #include "storage/primary_key_dump.h"
 #include "storage/primary_key_encoder.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
 
 using namespace starrocks;
 
@@ -205,6 +207,53 @@ PARALLEL_TEST(PrimaryIndexTest, test_largeint) {
     test_integral_pk<TYPE_LARGEINT, __int128>();
 }
 
+TEST(PrimaryIndexTest, test_sorted_lookup) {
+    auto old_min_size = config::primary_index_sorted_lookup_min_size;
+    config::primary_index_sorted_lookup_min_size = 1;
+    DeferOp defer([&]() { config::primary_index_sorted_lookup_min_size = old_min_size; });
+
+    auto f = std::make_shared<Field>(0, "c0", TYPE_BIGINT, false);
+    f->set_is_key(true);
+    auto schema = std::make_shared<Schema>(Fields{f}, PRIMARY_KEYS, std::vector<ColumnId>{0});
+    auto pk_index = TEST_create_primary_index(*schema);
+
+    constexpr int kSegmentSize = 4096;
+    auto pk_col = Int64Column::create();
+    for (int i = 0; i < kSegmentSize; i++) {
+        pk_col->append(i);
+    }
+    ASSERT_TRUE(pk_index->insert(0, 0, *pk_col).ok());
+
+    // upsert the odd keys of the segment and new keys, every key twice in the batch
+    auto upsert_col = Int64Column::create();
+    for (int i = 0; i < kSegmentSize; i++) {
+        upsert_col->append(i % 2 == 1 ? i : kSegmentSize + i);
+    }
+    for (int i = 0; i < kSegmentSize; i++) {
+        upsert_col->append(upsert_col->get_data()[i]);
+    }
+    PrimaryIndex::DeletesMap deletes;
+    ASSERT_TRUE(pk_index->upsert(1, 0, *upsert_col, &deletes).ok());
+    ASSERT_EQ(kSegmentSize / 2, deletes[0].size());
+    // the first copies in the batch are replaced by the second ones
+    ASSERT_EQ(kSegmentSize, deletes[1].size());
+    std::sort(deletes[1].begin(), deletes[1].end());
+    for (int i = 0; i < kSegmentSize; i++) {
+        ASSERT_EQ(i, deletes[1][i]);
+    }
+
+    std::vector<uint64_t> rowids(upsert_col->size());
+    ASSERT_TRUE(pk_index->get(*upsert_col, &rowids).ok());
+    for (int i = 0; i < upsert_col->size(); i++) {
+        ASSERT_EQ((((uint64_t)1) << 32) + kSegmentSize + i % kSegmentSize, rowids[i]);
+    }
+    std::vector<uint64_t> old_rowids(kSegmentSize);
+    ASSERT_TRUE(pk_index->get(*pk_col, &old_rowids).ok());
+    for (int i = 0; i < kSegmentSize; i += 2) {
+        ASSERT_EQ(i, old_rowids[i]);
+    }
+}
+
 template <LogicalType field_type>
 void test_binary_pk(int key_size) {
     std::string fill_str(key_size, 'a');
@@ -0,0 +1,121 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/row_id_fetcher.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "fs/fs_memory.h"
+#include "gutil/strings/substitute.h"
+#include "storage/chunk_helper.h"
+#include "storage/page_cache.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema_helper.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class RowIdFetcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _fs = std::make_shared<MemoryFileSystem>();
+        ASSERT_OK(_fs->create_dir(kSegmentDir));
+        _tablet_schema = TabletSchemaHelper::create_tablet_schema(
+                {create_int_key_pb(1), create_int_value_pb(2, "NONE"), create_int_value_pb(3, "NONE")});
+        for (uint32_t seg_id = 0; seg_id < kNumSegments; seg_id++) {
+            _build_segment(seg_id);
+        }
+    }
+
+    void TearDown() override { StoragePageCache::instance()->prune(); }
+
+    // The value of the column `cid` of the row `rowid` in the segment `seg_id`.
+    static int32_t _value(uint32_t seg_id, uint32_t rowid, int cid) { return seg_id * 100000 + rowid * 10 + cid; }
+
+    static uint64_t _rssid_rowid(uint32_t seg_id, uint32_t rowid) { return (uint64_t)seg_id << 32 | rowid; }
+
+    void _build_segment(uint32_t seg_id) {
+        std::string filename = strings::Substitute("$0/seg_$1.dat", kSegmentDir, seg_id);
+        ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(filename));
+        SegmentWriterOptions opts;
+        opts.num_rows_per_block = 100;
+        SegmentWriter writer(std::move(wfile), seg_id, _tablet_schema, opts);
+        ASSERT_OK(writer.init());
+
+        auto schema = ChunkHelper::convert_schema(_tablet_schema);
+        auto chunk = ChunkHelper::new_chunk(schema, kNumRows);
+        for (uint32_t rowid = 0; rowid < kNumRows; rowid++) {
+            for (int cid = 0; cid < _tablet_schema->num_columns(); cid++) {
+                chunk->get_column_by_index(cid)->append_datum(Datum(_value(seg_id, rowid, cid)));
+            }
+        }
+        ASSERT_OK(writer.append_chunk(*chunk));
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        uint64_t footer_position = 0;
+        ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+
+        ASSIGN_OR_ABORT(auto segment, Segment::open(_fs, FileInfo{filename}, seg_id, _tablet_schema));
+        _segments.emplace_back(std::move(segment));
+    }
+
+    void _check_fetch(RowIdFetcher* fetcher, const std::vector<uint64_t>& rssid_rowids) {
+        auto schema = ChunkHelper::convert_schema(_tablet_schema, std::vector<ColumnId>{1, 2});
+        auto chunk = ChunkHelper::new_chunk(schema, rssid_rowids.size());
+        ASSERT_OK(fetcher->fetch(rssid_rowids, chunk.get()));
+        ASSERT_EQ(rssid_rowids.size(), chunk->num_rows());
+        for (size_t i = 0; i < rssid_rowids.size(); i++) {
+            auto seg_id = static_cast<uint32_t>(rssid_rowids[i] >> 32);
+            auto rowid = static_cast<uint32_t>(rssid_rowids[i]);
+            ASSERT_EQ(_value(seg_id, rowid, 1), chunk->get_column_by_index(0)->get(i).get_int32());
+            ASSERT_EQ(_value(seg_id, rowid, 2), chunk->get_column_by_index(1)->get(i).get_int32());
+        }
+    }
+
+    static constexpr uint32_t kNumSegments = 3;
+    static constexpr uint32_t kNumRows = 1000;
+    const std::string kSegmentDir = "/row_id_fetcher_test";
+
+    std::shared_ptr<MemoryFileSystem> _fs;
+    std::shared_ptr<TabletSchema> _tablet_schema;
+    std::vector<SegmentSharedPtr> _segments;
+};
+
+TEST_F(RowIdFetcherTest, test_fetch_sorted) {
+    RowIdFetcher fetcher(_tablet_schema, _segments, false);
+    // The rows of one segment.
+    _check_fetch(&fetcher, {_rssid_rowid(0, 0), _rssid_rowid(0, 1), _rssid_rowid(0, 500), _rssid_rowid(0, 999)});
+    // Follow the previous chunk of the same segment.
+    _check_fetch(&fetcher, {_rssid_rowid(0, 3), _rssid_rowid(0, 4)});
+    // Cross the segments.
+    _check_fetch(&fetcher, {_rssid_rowid(0, 998), _rssid_rowid(1, 0), _rssid_rowid(1, 7), _rssid_rowid(2, 123)});
+    _check_fetch(&fetcher, {});
+}
+
+TEST_F(RowIdFetcherTest, test_fetch_unsorted) {
+    RowIdFetcher fetcher(_tablet_schema, _segments, false);
+    // The rows interleaved by the merge iterator are output in the input order.
+    _check_fetch(&fetcher, {_rssid_rowid(2, 10), _rssid_rowid(0, 10), _rssid_rowid(1, 5), _rssid_rowid(0, 3),
+                            _rssid_rowid(2, 11), _rssid_rowid(1, 999)});
+}
+
+TEST_F(RowIdFetcherTest, test_invalid_rssid) {
+    RowIdFetcher fetcher(_tablet_schema, _segments, false);
+    auto schema = ChunkHelper::convert_schema(_tablet_schema, std::vector<ColumnId>{1});
+    auto chunk = ChunkHelper::new_chunk(schema, 1);
+    ASSERT_FALSE(fetcher.fetch({_rssid_rowid(kNumSegments, 0)}, chunk.get()).ok());
+}
+
+} // namespace starrocks
@@ -0,0 +1,160 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/alp_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "storage/chunk_helper.h"
+#include "storage/range.h"
+#include "storage/rowset/encoding_info.h"
+
+namespace starrocks {
+
+class AlpPageTest : public testing::Test {
+public:
+    template <LogicalType Type>
+    OwnedSlice encode(const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        AlpPageBuilder<Type> builder(builder_options);
+        EXPECT_EQ(values.size(), builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size()));
+        return builder.finish()->build();
+    }
+
+    template <LogicalType Type>
+    void test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& values, size_t max_page_size) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        OwnedSlice s = encode<Type>(values);
+        ASSERT_LE(s.slice().size, max_page_size);
+
+        AlpPageDecoder<Type> decoder(s.slice());
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_EQ(values.size(), decoder.count());
+        ASSERT_EQ(ALP_ENCODING, decoder.encoding_type());
+
+        auto column = ChunkHelper::column_from_field_type(Type, false);
+        size_t n = values.size();
+        ASSERT_TRUE(decoder.next_batch(&n, column.get()).ok());
+        ASSERT_EQ(values.size(), n);
+        const auto* decoded = reinterpret_cast<const CppType*>(column->raw_data());
+        // bitwise, so that NaN and -0.0 are checked
+        ASSERT_EQ(0, memcmp(values.data(), decoded, values.size() * sizeof(CppType)));
+
+        // the sparse ranges after seeking
+        auto column2 = ChunkHelper::column_from_field_type(Type, false);
+        SparseRange<> range;
+        range.add(Range<>(3, 10));
+        range.add(Range<>(50, values.size() - 1));
+        ASSERT_TRUE(decoder.seek_to_position_in_page(3).ok());
+        ASSERT_TRUE(decoder.next_batch(range, column2.get()).ok());
+        ASSERT_EQ(range.span_size(), column2->size());
+        const auto* sparse = reinterpret_cast<const CppType*>(column2->raw_data());
+        ASSERT_EQ(0, memcmp(values.data() + 3, sparse, 7 * sizeof(CppType)));
+        ASSERT_EQ(0, memcmp(values.data() + 50, sparse + 7, (values.size() - 51) * sizeof(CppType)));
+    }
+};
+
+TEST_F(AlpPageTest, test_decimal_doubles) {
+    std::vector<double> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(static_cast<double>(random() % 100000) / 100.0);
+    }
+    // the integers of at most 17 bits
+    test_encode_decode<TYPE_DOUBLE>(values, values.size() * 3);
+}
+
+TEST_F(AlpPageTest, test_decimal_floats) {
+    std::vector<float> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(static_cast<float>(random() % 10000) / 10.0f);
+    }
+    test_encode_decode<TYPE_FLOAT>(values, values.size() * 2);
+}
+
+TEST_F(AlpPageTest, test_exceptions) {
+    std::vector<double> values;
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(static_cast<double>(i) / 4);
+    }
+    values[10] = std::numeric_limits<double>::quiet_NaN();
+    values[20] = std::numeric_limits<double>::infinity();
+    values[30] = -std::numeric_limits<double>::infinity();
+    values[40] = -0.0;
+    values[50] = 1.0 / 3;
+    values[999] = std::numeric_limits<double>::max();
+    test_encode_decode<TYPE_DOUBLE>(values, values.size() * 3);
+
+    // most of the values are exceptions
+    std::vector<double> randoms;
+    for (int i = 0; i < 1000; i++) {
+        randoms.push_back(static_cast<double>(random()) / 3);
+    }
+    test_encode_decode<TYPE_DOUBLE>(randoms, randoms.size() * (sizeof(double) + sizeof(uint32_t)) + 1024);
+}
+
+TEST_F(AlpPageTest, test_empty_page) {
+    OwnedSlice s = encode<TYPE_DOUBLE>({});
+    AlpPageDecoder<TYPE_DOUBLE> decoder(s.slice());
+    ASSERT_TRUE(decoder.init().ok());
+    ASSERT_EQ(0, decoder.count());
+}
+
+TEST_F(AlpPageTest, test_seek_at_or_after_value) {
+    std::vector<double> values;
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(i * 0.5);
+    }
+    OwnedSlice s = encode<TYPE_DOUBLE>(values);
+    AlpPageDecoder<TYPE_DOUBLE> decoder(s.slice());
+    ASSERT_TRUE(decoder.init().ok());
+
+    bool exact_match = false;
+    double target = 100.5;
+    ASSERT_TRUE(decoder.seek_at_or_after_value(&target, &exact_match).ok());
+    ASSERT_TRUE(exact_match);
+    ASSERT_EQ(201, decoder.current_index());
+    target = 100.7;
+    ASSERT_TRUE(decoder.seek_at_or_after_value(&target, &exact_match).ok());
+    ASSERT_FALSE(exact_match);
+    ASSERT_EQ(202, decoder.current_index());
+    target = 1000;
+    ASSERT_TRUE(decoder.seek_at_or_after_value(&target, &exact_match).is_not_found());
+}
+
+TEST_F(AlpPageTest, test_corrupted_page) {
+    std::vector<double> values = {1.5, 2.5, 3.5};
+    OwnedSlice s = encode<TYPE_DOUBLE>(values);
+    AlpPageDecoder<TYPE_DOUBLE> decoder(Slice(s.slice().data, s.slice().size - 1));
+    ASSERT_TRUE(decoder.init().is_corruption());
+}
+
+TEST_F(AlpPageTest, test_encoding_info) {
+    const EncodingInfo* info = nullptr;
+    ASSERT_TRUE(EncodingInfo::get(TYPE_DOUBLE, ALP_ENCODING, &info).ok());
+    ASSERT_EQ(ALP_ENCODING, info->encoding());
+    ASSERT_EQ(BIT_SHUFFLE, EncodingInfo::get_default_encoding(TYPE_DOUBLE, false));
+    config::enable_alp_float_encoding = true;
+    ASSERT_EQ(ALP_ENCODING, EncodingInfo::get_default_encoding(TYPE_DOUBLE, false));
+    ASSERT_EQ(ALP_ENCODING, EncodingInfo::get_default_encoding(TYPE_FLOAT, false));
+    ASSERT_NE(ALP_ENCODING, EncodingInfo::get_default_encoding(TYPE_INT, false));
+    config::enable_alp_float_encoding = false;
+}
+
+} // namespace starrocks
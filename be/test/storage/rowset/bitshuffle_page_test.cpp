@@ -40,6 +40,7 @@
 
 #include "column/datum_convert.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/page_decoder.h"
 #include "storage/rowset/storage_page_decoder.h"
@@ -506,4 +507,62 @@ TEST_F(BitShufflePageTest, TestDecodeVectorized) {
                                        BitShufflePageDecoder<TYPE_BIGINT>>();
 }
 
+// NOLINTNEXTLINE
+TEST_F(BitShufflePageTest, TestEvaluatePredicate) {
+    const uint32_t size = 10000;
+
+    std::unique_ptr<int64_t[]> bigints(new int64_t[size]);
+    for (int i = 0; i < size; i++) {
+        bigints.get()[i] = random() % 1000 - 500;
+    }
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    BitshufflePageBuilder<TYPE_BIGINT> page_builder(options);
+    page_builder.add(reinterpret_cast<const uint8_t*>(bigints.get()), size);
+    OwnedSlice s = page_builder.finish()->build();
+
+    Slice encoded_data = s.slice();
+    PageFooterPB footer;
+    footer.set_type(DATA_PAGE);
+    footer.mutable_data_page_footer()->set_nullmap_size(0);
+    std::unique_ptr<char[]> page = nullptr;
+    ASSERT_TRUE(StoragePageDecoder::decode_page(&footer, 0, BIT_SHUFFLE, &page, &encoded_data).ok());
+
+    auto column = ChunkHelper::column_from_field_type(TYPE_BIGINT, false);
+    column->append_numbers(bigints.get(), size * sizeof(int64_t));
+    for (auto pred_type : {PredicateType::kEQ, PredicateType::kNE, PredicateType::kGT, PredicateType::kGE,
+                           PredicateType::kLT, PredicateType::kLE}) {
+        for (const std::string operand : {"-9223372036854775808", "-500", "0", "123", "9223372036854775807"}) {
+            std::unique_ptr<ColumnPredicate> pred(
+                    new_column_cmp_predicate(pred_type, get_type_info(TYPE_BIGINT), 0, operand));
+            std::vector<uint8_t> expected(size);
+            ASSERT_TRUE(pred->evaluate(column.get(), expected.data()).ok());
+
+            BitShufflePageDecoder<TYPE_BIGINT> page_decoder(encoded_data);
+            ASSERT_TRUE(page_decoder.init().ok());
+            std::vector<uint8_t> selection(size);
+            size_t pos = 0;
+            while (pos < size) {
+                size_t n = random() % 300 + 1;
+                ASSERT_TRUE(page_decoder.evaluate(*pred, &n, selection.data() + pos).ok());
+                pos += n;
+                ASSERT_EQ(pos, page_decoder.current_index());
+            }
+            for (uint32_t i = 0; i < size; i++) {
+                ASSERT_EQ(expected[i], selection[i]) << "type=" << pred_type << ", operand=" << operand << ", i=" << i;
+            }
+        }
+    }
+
+    // The predicates of the other types are not evaluated on the page.
+    std::unique_ptr<ColumnPredicate> pred(
+            new_column_cmp_predicate(PredicateType::kEQ, get_type_info(TYPE_INT), 0, "1"));
+    BitShufflePageDecoder<TYPE_BIGINT> page_decoder(encoded_data);
+    ASSERT_TRUE(page_decoder.init().ok());
+    size_t n = size;
+    std::vector<uint8_t> selection(size);
+    ASSERT_TRUE(page_decoder.evaluate(*pred, &n, selection.data()).is_not_supported());
+    ASSERT_EQ(0, page_decoder.current_index());
+}
+
 } // namespace starrocks
@@ -48,6 +48,7 @@
 #include "runtime/mem_pool.h"
 #include "storage/aggregate_type.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/decimal12.h"
 #include "storage/olap_common.h"
 #include "storage/range.h"
@@ -651,6 +652,37 @@ TEST_F(ColumnReaderWriterTest, test_default_value) {
     test_read_default_value<TYPE_DECIMAL>(v_decimal, &decimal);
 }
 
+// NOLINTNEXTLINE
+TEST_F(ColumnReaderWriterTest, test_adaptive_page_encoding) {
+    // the sequences, random values and timestamps, each spanning several pages
+    auto col = ChunkHelper::column_from_field_type(TYPE_BIGINT, true);
+    int64_t ts = 1700000000000000L;
+    for (int64_t i = 0; i < 120000; i++) {
+        int64_t value = 0;
+        switch (i / 20000 % 3) {
+        case 0:
+            value = i;
+            break;
+        case 1:
+            value = static_cast<int64_t>(random()) * random();
+            break;
+        default:
+            ts += 1000000 + random() % 8;
+            value = ts;
+        }
+        (void)col->append_numbers(&value, sizeof(value));
+    }
+    for (size_t i = 0; i < col->size(); i += 1000) {
+        (void)col->set_null(i);
+    }
+
+    config::enable_adaptive_page_encoding = true;
+    test_nullable_data<TYPE_BIGINT, BIT_SHUFFLE, 1>(*col, "0", "1000");
+    test_nullable_data<TYPE_BIGINT, BIT_SHUFFLE, 2>(*col, "0", "1000");
+    test_nullable_data<TYPE_BIGINT, FOR_ENCODING, 2>(*col, "1", "1000");
+    config::enable_adaptive_page_encoding = false;
+}
+
 // test array<int>, and nullable
 TEST_F(ColumnReaderWriterTest, test_array_int) {
     test_int_array<2>();
@@ -717,6 +749,82 @@ TEST_F(ColumnReaderWriterTest, test_scalar_column_total_mem_footprint) {
     }
 }
 
+TEST_F(ColumnReaderWriterTest, test_zone_map_aggregate) {
+    // 0, 1, ..., 9999 with a null in place of 3000
+    auto col = ChunkHelper::column_from_field_type(TYPE_INT, true);
+    const int32_t count = 10000;
+    for (int32_t i = 0; i < count; ++i) {
+        if (i == 3000) {
+            (void)col->append_nulls(1);
+        } else {
+            col->append_datum(Datum(i));
+        }
+    }
+
+    ColumnMetaPB meta;
+    auto fs = std::make_shared<MemoryFileSystem>();
+    ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
+    const std::string fname = strings::Substitute("$0/test_zone_map_aggregate.data", TEST_DIR);
+    auto segment = create_dummy_segment(fs, fname);
+    {
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+
+        ColumnWriterOptions writer_opts;
+        writer_opts.page_format = 2;
+        writer_opts.meta = &meta;
+        writer_opts.meta->set_column_id(0);
+        writer_opts.meta->set_unique_id(0);
+        writer_opts.meta->set_type(TYPE_INT);
+        writer_opts.meta->set_length(0);
+        writer_opts.meta->set_encoding(BIT_SHUFFLE);
+        writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+        writer_opts.meta->set_is_nullable(true);
+        writer_opts.need_zone_map = true;
+        // many small pages
+        writer_opts.data_page_size = 1024;
+
+        TabletColumn column(STORAGE_AGGREGATE_NONE, TYPE_INT);
+        ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &column, wfile.get()));
+        ASSERT_OK(writer->init());
+        ASSERT_OK(writer->append(*col));
+        ASSERT_OK(writer->finish());
+        ASSERT_OK(writer->write_data());
+        ASSERT_OK(writer->write_ordinal_index());
+        ASSERT_OK(writer->write_zone_map());
+        ASSERT_OK(wfile->close());
+    }
+
+    ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get()));
+    ASSIGN_OR_ABORT(auto read_file, fs->new_random_access_file(fname));
+    ColumnIteratorOptions iter_opts;
+    OlapReaderStatistics stats;
+    iter_opts.stats = &stats;
+    iter_opts.read_file = read_file.get();
+
+    // 1000 <= v < 5000
+    TypeInfoPtr type_info = get_type_info(TYPE_INT);
+    std::unique_ptr<ColumnPredicate> ge(new_column_ge_predicate(type_info, 0, "1000"));
+    std::unique_ptr<ColumnPredicate> lt(new_column_lt_predicate(type_info, 0, "5000"));
+    ZoneMapAggregateResult result;
+    ASSERT_OK(reader->zone_map_aggregate({ge.get(), lt.get()}, iter_opts, &result));
+    ASSERT_EQ(3999, result.count);
+    ASSERT_EQ(1000, result.min.get_int32());
+    ASSERT_EQ(4999, result.max.get_int32());
+    // only the pages of 1000, 3000 and 5000 are decoded
+    ASSERT_GT(result.covered_pages, 0);
+    ASSERT_GT(result.pruned_pages, 0);
+    ASSERT_LE(result.decoded_pages, 3);
+    ASSERT_EQ(reader->num_data_pages(), result.covered_pages + result.pruned_pages + result.decoded_pages);
+
+    // nothing matches
+    std::unique_ptr<ColumnPredicate> gt(new_column_gt_predicate(type_info, 0, "20000"));
+    ZoneMapAggregateResult empty_result;
+    ASSERT_OK(reader->zone_map_aggregate({gt.get()}, iter_opts, &empty_result));
+    ASSERT_EQ(0, empty_result.count);
+    ASSERT_TRUE(empty_result.min.is_null());
+    ASSERT_EQ(0, empty_result.decoded_pages);
+}
+
 TEST_F(ColumnReaderWriterTest, test_large_varchar_column_writer) {
     auto fs = std::make_shared<MemoryFileSystem>();
     ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
@@ -0,0 +1,204 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/delta_page.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
+#include "storage/range.h"
+#include "storage/rowset/encoding_info.h"
+#include "storage/types.h"
+
+namespace starrocks {
+
+class DeltaPageTest : public testing::Test {
+public:
+    template <LogicalType Type>
+    OwnedSlice encode(const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        DeltaPageBuilder<Type> builder(builder_options);
+        EXPECT_EQ(values.size(), builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size()));
+        return builder.finish()->build();
+    }
+
+    template <LogicalType Type>
+    void test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& values, size_t max_page_size) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        OwnedSlice s = encode<Type>(values);
+        ASSERT_LE(s.slice().size, max_page_size);
+
+        DeltaPageDecoder<Type> decoder(s.slice());
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_EQ(values.size(), decoder.count());
+        ASSERT_EQ(DELTA_ENCODING, decoder.encoding_type());
+
+        auto column = ChunkHelper::column_from_field_type(Type, false);
+        size_t n = values.size();
+        ASSERT_TRUE(decoder.next_batch(&n, column.get()).ok());
+        ASSERT_EQ(values.size(), n);
+        const auto* decoded = reinterpret_cast<const CppType*>(column->raw_data());
+        for (size_t i = 0; i < values.size(); i++) {
+            ASSERT_EQ(values[i], decoded[i]) << i;
+        }
+
+        // the sparse ranges across the miniblocks after seeking
+        auto column2 = ChunkHelper::column_from_field_type(Type, false);
+        SparseRange<> range;
+        range.add(Range<>(3, 10));
+        range.add(Range<>(100, values.size() - 1));
+        ASSERT_TRUE(decoder.seek_to_position_in_page(3).ok());
+        ASSERT_TRUE(decoder.next_batch(range, column2.get()).ok());
+        ASSERT_EQ(range.span_size(), column2->size());
+        ASSERT_EQ(values.size() - 1, decoder.current_index());
+        const auto* sparse = reinterpret_cast<const CppType*>(column2->raw_data());
+        for (size_t i = 0; i < 7; i++) {
+            ASSERT_EQ(values[3 + i], sparse[i]);
+        }
+        for (size_t i = 100; i < values.size() - 1; i++) {
+            ASSERT_EQ(values[i], sparse[7 + i - 100]) << i;
+        }
+    }
+};
+
+TEST_F(DeltaPageTest, test_timestamps) {
+    // the timestamps of every second with some jitter, taking a few bits by delta of deltas
+    std::vector<int64_t> values;
+    int64_t ts = 1700000000000000L;
+    for (int i = 0; i < 10000; i++) {
+        ts += 1000000 + random() % 4;
+        values.push_back(ts);
+    }
+    test_encode_decode<TYPE_BIGINT>(values, values.size());
+}
+
+TEST_F(DeltaPageTest, test_sequence) {
+    std::vector<int32_t> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(1000 + i);
+    }
+    // the constant deltas take no bits
+    test_encode_decode<TYPE_INT>(values, 2048);
+}
+
+TEST_F(DeltaPageTest, test_random_values) {
+    std::vector<int64_t> values;
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(static_cast<int64_t>(random()) * random() * (i % 2 == 0 ? 1 : -1));
+    }
+    values[10] = std::numeric_limits<int64_t>::min();
+    values[11] = std::numeric_limits<int64_t>::max();
+    values[12] = std::numeric_limits<int64_t>::min();
+    test_encode_decode<TYPE_BIGINT>(values, values.size() * 10);
+
+    std::vector<int8_t> tiny;
+    for (int i = 0; i < 1000; i++) {
+        tiny.push_back(static_cast<int8_t>(random()));
+    }
+    test_encode_decode<TYPE_TINYINT>(tiny, tiny.size() * 2);
+}
+
+TEST_F(DeltaPageTest, test_empty_page) {
+    OwnedSlice s = encode<TYPE_INT>({});
+    DeltaPageDecoder<TYPE_INT> decoder(s.slice());
+    ASSERT_TRUE(decoder.init().ok());
+    ASSERT_EQ(0, decoder.count());
+}
+
+TEST_F(DeltaPageTest, test_seek_at_or_after_value) {
+    std::vector<int32_t> values;
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(i * 2);
+    }
+    OwnedSlice s = encode<TYPE_INT>(values);
+    DeltaPageDecoder<TYPE_INT> decoder(s.slice());
+    ASSERT_TRUE(decoder.init().ok());
+
+    bool exact_match = false;
+    for (int32_t target : {0, 254, 256, 1000, 1998}) {
+        ASSERT_TRUE(decoder.seek_at_or_after_value(&target, &exact_match).ok());
+        ASSERT_TRUE(exact_match);
+        ASSERT_EQ(target / 2, decoder.current_index());
+    }
+    for (int32_t target : {-5, 255, 257, 1997}) {
+        ASSERT_TRUE(decoder.seek_at_or_after_value(&target, &exact_match).ok());
+        ASSERT_FALSE(exact_match);
+        ASSERT_EQ(std::max(0, target / 2 + 1), decoder.current_index());
+    }
+    int32_t target = 1999;
+    ASSERT_TRUE(decoder.seek_at_or_after_value(&target, &exact_match).is_not_found());
+}
+
+TEST_F(DeltaPageTest, test_evaluate) {
+    std::vector<int32_t> values;
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(i);
+    }
+    OwnedSlice s = encode<TYPE_INT>(values);
+    auto type_info = get_type_info(TYPE_INT);
+    std::unique_ptr<ColumnPredicate> preds[] = {
+            std::unique_ptr<ColumnPredicate>(new_column_ge_predicate(type_info, 0, "500")),
+            std::unique_ptr<ColumnPredicate>(new_column_ne_predicate(type_info, 0, "300")),
+            // no value or every value of the page satisfies them
+            std::unique_ptr<ColumnPredicate>(new_column_gt_predicate(type_info, 0, "5000")),
+            std::unique_ptr<ColumnPredicate>(new_column_ge_predicate(type_info, 0, "-1"))};
+    for (const auto& pred : preds) {
+        DeltaPageDecoder<TYPE_INT> decoder(s.slice());
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_TRUE(decoder.seek_to_position_in_page(5).ok());
+        std::vector<uint8_t> selection(values.size());
+        size_t pos = 5;
+        while (pos < values.size()) {
+            size_t n = 100;
+            ASSERT_TRUE(decoder.evaluate(*pred, &n, selection.data() + pos).ok());
+            pos += n;
+            ASSERT_EQ(pos, decoder.current_index());
+        }
+        auto column = ChunkHelper::column_from_field_type(TYPE_INT, false);
+        column->append_numbers(values.data(), values.size() * sizeof(int32_t));
+        std::vector<uint8_t> expected(values.size());
+        ASSERT_TRUE(pred->evaluate(column.get(), expected.data(), 0, values.size()).ok());
+        for (size_t i = 5; i < values.size(); i++) {
+            ASSERT_EQ(expected[i], selection[i]) << i;
+        }
+    }
+}
+
+TEST_F(DeltaPageTest, test_corrupted_page) {
+    std::vector<int32_t> values = {1, 2, 3};
+    OwnedSlice s = encode<TYPE_INT>(values);
+    DeltaPageDecoder<TYPE_INT> decoder(Slice(s.slice().data, DeltaPageConstants::kHeaderSize));
+    ASSERT_TRUE(decoder.init().is_corruption());
+}
+
+TEST_F(DeltaPageTest, test_encoding_info) {
+    const EncodingInfo* info = nullptr;
+    ASSERT_TRUE(EncodingInfo::get(TYPE_BIGINT, DELTA_ENCODING, &info).ok());
+    ASSERT_EQ(DELTA_ENCODING, info->encoding());
+    ASSERT_EQ(BIT_SHUFFLE, EncodingInfo::get_default_encoding(TYPE_BIGINT, false));
+    config::enable_delta_integer_encoding = true;
+    ASSERT_EQ(DELTA_ENCODING, EncodingInfo::get_default_encoding(TYPE_BIGINT, false));
+    ASSERT_EQ(DELTA_ENCODING, EncodingInfo::get_default_encoding(TYPE_DATETIME, false));
+    ASSERT_NE(DELTA_ENCODING, EncodingInfo::get_default_encoding(TYPE_BIGINT, true));
+    ASSERT_NE(DELTA_ENCODING, EncodingInfo::get_default_encoding(TYPE_DOUBLE, false));
+    config::enable_delta_integer_encoding = false;
+}
+
+} // namespace starrocks
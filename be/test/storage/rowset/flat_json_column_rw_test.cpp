@@ -161,6 +161,63 @@ TEST_F(FlatJsonColumnRWTest, testNormalFlatJson) {
     EXPECT_EQ("3", read_json->get_flat_field("a")->debug_item(2));
 }
 
+TEST_F(FlatJsonColumnRWTest, testFlatJsonZoneMap) {
+    config::json_flat_internal_column_min_limit = 1;
+
+    ColumnPtr write_col = JsonColumn::create();
+    auto* json_col = down_cast<JsonColumn*>(write_col.get());
+    for (int i = 1; i <= 5; i++) {
+        ASSIGN_OR_ABORT(auto jv, JsonValue::parse(fmt::format(R"({{"a": {}, "b": "s{}"}})", i, i)));
+        json_col->append(&jv);
+    }
+
+    auto fs = std::make_shared<MemoryFileSystem>();
+    ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
+    const std::string fname = TEST_DIR + "/test_flat_json_zone_map.data";
+    auto segment = create_dummy_segment(fs, fname);
+    TabletColumn json_tablet_column = create_with_default_value<TYPE_JSON>("");
+    ColumnMetaPB meta;
+    {
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+        ColumnWriterOptions writer_opts;
+        writer_opts.meta = &meta;
+        writer_opts.meta->set_column_id(0);
+        writer_opts.meta->set_unique_id(0);
+        writer_opts.meta->set_type(TYPE_JSON);
+        writer_opts.meta->set_length(0);
+        writer_opts.meta->set_encoding(DEFAULT_ENCODING);
+        writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+        writer_opts.meta->set_is_nullable(false);
+        writer_opts.need_flat = true;
+
+        ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &json_tablet_column, wfile.get()));
+        ASSERT_OK(writer->init());
+        ASSERT_OK(writer->append(*write_col));
+        ASSERT_OK(writer->finish());
+        ASSERT_OK(writer->write_data());
+        ASSERT_OK(writer->write_ordinal_index());
+        ASSERT_OK(writer->write_zone_map());
+        ASSERT_OK(wfile->close());
+    }
+
+    ASSERT_EQ(2, meta.children_columns_size());
+    ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get()));
+    ASSERT_EQ(2, reader->sub_readers()->size());
+    // "a" is a typed sub-column with a zone map, and "b" is a string one without
+    for (int i = 0; i < meta.children_columns_size(); i++) {
+        const auto& sub_reader = (*reader->sub_readers())[i];
+        if (meta.children_columns(i).name() == "a") {
+            ASSERT_TRUE(sub_reader->has_zone_map());
+            ASSERT_NE(nullptr, sub_reader->segment_zone_map());
+            EXPECT_EQ("1", sub_reader->segment_zone_map()->min());
+            EXPECT_EQ("5", sub_reader->segment_zone_map()->max());
+        } else {
+            EXPECT_EQ("b", meta.children_columns(i).name());
+            EXPECT_FALSE(sub_reader->has_zone_map());
+        }
+    }
+}
+
 TEST_F(FlatJsonColumnRWTest, testNullFlatJson) {
     config::json_flat_internal_column_min_limit = 1;
 
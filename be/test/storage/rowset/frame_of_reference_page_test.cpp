@@ -44,6 +44,7 @@
 #include "runtime/large_int_value.h"
 #include "runtime/mem_pool.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/page_builder.h"
 #include "storage/rowset/page_decoder.h"
@@ -164,6 +165,50 @@ public:
             offset += r.span_size();
         }
     }
+
+    template <LogicalType Type>
+    void test_evaluate_page(typename TypeTraits<Type>::CppType* src, size_t size) {
+        typedef typename TypeTraits<Type>::CppType CppType;
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        FrameOfReferencePageBuilder<Type> for_page_builder(builder_options);
+        size = for_page_builder.add(reinterpret_cast<const uint8_t*>(src), size);
+        OwnedSlice s = for_page_builder.finish()->build();
+
+        auto column = ChunkHelper::column_from_field_type(Type, false);
+        column->append_numbers(src, size * sizeof(CppType));
+        std::vector<CppType> operands = {std::numeric_limits<CppType>::lowest(), std::numeric_limits<CppType>::max()};
+        for (int i = 0; i < 10; i++) {
+            operands.emplace_back(src[random() % size]);
+        }
+
+        for (auto pred_type : {PredicateType::kEQ, PredicateType::kNE, PredicateType::kGT, PredicateType::kGE,
+                               PredicateType::kLT, PredicateType::kLE}) {
+            for (CppType operand : operands) {
+                std::unique_ptr<ColumnPredicate> pred(
+                        new_column_cmp_predicate(pred_type, get_type_info(Type), 0, std::to_string(operand)));
+                std::vector<uint8_t> expected(size);
+                ASSERT_TRUE(pred->evaluate(column.get(), expected.data()).ok());
+
+                FrameOfReferencePageDecoder<Type> for_page_decoder(s.slice());
+                ASSERT_TRUE(for_page_decoder.init().ok());
+                const uint32_t start = random() % size;
+                ASSERT_TRUE(for_page_decoder.seek_to_position_in_page(start).ok());
+                std::vector<uint8_t> selection(size);
+                uint32_t pos = start;
+                while (pos < size) {
+                    size_t n = random() % 300 + 1;
+                    ASSERT_TRUE(for_page_decoder.evaluate(*pred, &n, selection.data() + pos).ok());
+                    pos += n;
+                    ASSERT_EQ(pos, for_page_decoder.current_index());
+                }
+                for (uint32_t i = start; i < size; i++) {
+                    ASSERT_EQ(expected[i], selection[i])
+                            << "type=" << pred_type << ", operand=" << operand << ", i=" << i;
+                }
+            }
+        }
+    }
 };
 
 TEST_F(FrameOfReferencePageTest, TestInt32BlockEncoderRandom) {
@@ -178,6 +223,37 @@ TEST_F(FrameOfReferencePageTest, TestInt32BlockEncoderRandom) {
     test_encode_decode_page_vectorize<TYPE_INT>(ints.get(), size);
 }
 
+TEST_F(FrameOfReferencePageTest, TestEvaluatePredicate) {
+    const uint32_t size = 10000;
+
+    std::unique_ptr<int32_t[]> ints(new int32_t[size]);
+    // The deltas of the frames are compared with the operand.
+    for (int i = 0; i < size; i++) {
+        ints.get()[i] = random() % 2000 - 1000;
+    }
+    test_evaluate_page<TYPE_INT>(ints.get(), size);
+
+    // The frames are skipped or selected as a whole by the range of the frame.
+    for (int i = 0; i < size; i++) {
+        ints.get()[i] = (i / 128) * 1000 + random() % 100;
+    }
+    test_evaluate_page<TYPE_INT>(ints.get(), size);
+
+    // The frames are ascending.
+    for (int i = 0; i < size; i++) {
+        ints.get()[i] = i * 3 - 5000;
+    }
+    test_evaluate_page<TYPE_INT>(ints.get(), size);
+
+    // The frames store the original values.
+    std::unique_ptr<int64_t[]> bigints(new int64_t[size]);
+    for (int i = 0; i < size; i++) {
+        bigints.get()[i] = i % 2 == 0 ? std::numeric_limits<int64_t>::max() - random() % 10
+                                      : std::numeric_limits<int64_t>::lowest() + random() % 10;
+    }
+    test_evaluate_page<TYPE_BIGINT>(bigints.get(), size);
+}
+
 TEST_F(FrameOfReferencePageTest, TestInt32BlockEncoderEqual) {
     const uint32_t size = 10000;
 
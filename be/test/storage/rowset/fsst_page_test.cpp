@@ -0,0 +1,174 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/fsst_page.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "column/nullable_column.h"
+#include "gutil/casts.h"
+#include "storage/column_predicate.h"
+#include "storage/range.h"
+#include "storage/types.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class FsstPageTest : public testing::Test {
+protected:
+    void SetUp() override {
+        const char* words[] = {"http://", "www.", "starrocks", ".io", "/docs/", "?id=", "&page=", "index.html"};
+        for (int i = 0; i < 5000; i++) {
+            std::string s;
+            for (int j = 0; j < 1 + i % 5; j++) {
+                s += words[(i * 7 + j * 3) % 8];
+            }
+            s += std::to_string(i % 1000);
+            if (i % 100 == 0) {
+                s.clear();
+            }
+            if (i % 77 == 0) {
+                // the bytes rare in the page
+                s.push_back('\xff');
+                s.push_back('\0');
+            }
+            _strings.push_back(std::move(s));
+        }
+        for (const auto& s : _strings) {
+            _slices.emplace_back(s);
+        }
+    }
+
+    OwnedSlice encode(FsstPageBuilder* builder) {
+        EXPECT_EQ(_slices.size(), builder->add(reinterpret_cast<const uint8_t*>(_slices.data()), _slices.size()));
+        return builder->finish()->build();
+    }
+
+    std::vector<std::string> _strings;
+    std::vector<Slice> _slices;
+};
+
+// NOLINTNEXTLINE
+TEST_F(FsstPageTest, test_encode_decode) {
+    PageBuilderOptions options;
+    options.data_page_size = 1024 * 1024;
+    FsstPageBuilder builder(options);
+    OwnedSlice page = encode(&builder);
+    size_t raw_size = 0;
+    for (const auto& s : _strings) {
+        raw_size += s.size();
+    }
+    ASSERT_LT(page.slice().size, raw_size / 2);
+
+    Slice first_value;
+    ASSERT_OK(builder.get_first_value(&first_value));
+    ASSERT_EQ(_slices.front(), first_value);
+    Slice last_value;
+    ASSERT_OK(builder.get_last_value(&last_value));
+    ASSERT_EQ(_slices.back(), last_value);
+
+    FsstPageDecoder<TYPE_VARCHAR> decoder(page.slice());
+    ASSERT_OK(decoder.init());
+    ASSERT_EQ(_strings.size(), decoder.count());
+    ASSERT_EQ(FSST_ENCODING, decoder.encoding_type());
+
+    auto column = BinaryColumn::create();
+    size_t n = _strings.size();
+    ASSERT_OK(decoder.next_batch(&n, column.get()));
+    ASSERT_EQ(_strings.size(), n);
+    for (size_t i = 0; i < _strings.size(); i++) {
+        ASSERT_EQ(_strings[i], column->get_slice(i).to_string()) << i;
+    }
+
+    // the sparse ranges into a nullable column
+    auto nullable = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    SparseRange<> range;
+    range.add(Range<>(10, 20));
+    range.add(Range<>(1000, 1500));
+    ASSERT_OK(decoder.seek_to_position_in_page(10));
+    ASSERT_OK(decoder.next_batch(range, nullable.get()));
+    ASSERT_EQ(range.span_size(), nullable->size());
+    ASSERT_EQ(1500, decoder.current_index());
+    ASSERT_FALSE(nullable->has_null());
+    const auto* data = down_cast<const BinaryColumn*>(nullable->data_column().get());
+    size_t row = 0;
+    for (const auto& [begin, end] : {std::make_pair(10, 20), std::make_pair(1000, 1500)}) {
+        for (int i = begin; i < end; i++) {
+            ASSERT_EQ(_strings[i], data->get_slice(row++).to_string()) << i;
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(FsstPageTest, test_evaluate) {
+    PageBuilderOptions options;
+    options.data_page_size = 1024 * 1024;
+    FsstPageBuilder builder(options);
+    OwnedSlice page = encode(&builder);
+    auto type_info = get_type_info(TYPE_VARCHAR);
+
+    std::vector<std::string> operands = {_strings[1], _strings[2], _strings[77], "", "not in the page", "http://"};
+    for (const auto& operand : operands) {
+        std::unique_ptr<ColumnPredicate> eq(new_column_eq_predicate(type_info, 0, operand));
+        std::unique_ptr<ColumnPredicate> ne(new_column_ne_predicate(type_info, 0, operand));
+        for (const auto& pred : {eq.get(), ne.get()}) {
+            FsstPageDecoder<TYPE_VARCHAR> decoder(page.slice());
+            ASSERT_OK(decoder.init());
+            ASSERT_OK(decoder.seek_to_position_in_page(5));
+            std::vector<uint8_t> selection(_strings.size());
+            size_t pos = 5;
+            while (pos < _strings.size()) {
+                size_t n = 333;
+                ASSERT_OK(decoder.evaluate(*pred, &n, selection.data() + pos));
+                pos += n;
+                ASSERT_EQ(pos, decoder.current_index());
+            }
+            for (size_t i = 5; i < _strings.size(); i++) {
+                bool expected = (_strings[i] == operand) == (pred == eq.get());
+                ASSERT_EQ(expected, selection[i]) << operand << " " << i;
+            }
+        }
+    }
+
+    // the range predicates are not evaluated on the compressed strings
+    std::unique_ptr<ColumnPredicate> gt(new_column_gt_predicate(type_info, 0, "a"));
+    FsstPageDecoder<TYPE_VARCHAR> decoder(page.slice());
+    ASSERT_OK(decoder.init());
+    size_t n = 10;
+    std::vector<uint8_t> selection(n);
+    ASSERT_TRUE(decoder.evaluate(*gt, &n, selection.data()).is_not_supported());
+}
+
+// NOLINTNEXTLINE
+TEST_F(FsstPageTest, test_empty_and_corrupted_page) {
+    PageBuilderOptions options;
+    options.data_page_size = 1024 * 1024;
+    FsstPageBuilder builder(options);
+    OwnedSlice empty = builder.finish()->build();
+    FsstPageDecoder<TYPE_VARCHAR> decoder(empty.slice());
+    ASSERT_OK(decoder.init());
+    ASSERT_EQ(0, decoder.count());
+
+    builder.reset();
+    OwnedSlice page = encode(&builder);
+    FsstPageDecoder<TYPE_VARCHAR> broken(Slice(page.slice().data, page.slice().size - 1));
+    ASSERT_TRUE(broken.init().is_corruption());
+}
+
+} // namespace starrocks
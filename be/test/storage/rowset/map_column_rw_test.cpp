@@ -264,4 +264,117 @@ TEST_F(MapColumnRWTest, test_map_int) {
     test_int_map();
 }
 
+// m['b'] reads the keys, and then only the values of the entries of 'b'
+TEST_F(MapColumnRWTest, test_map_index_keys) {
+    auto fs = std::make_shared<MemoryFileSystem>();
+    ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
+
+    TabletColumn map_column = create_map(0, false);
+    TabletColumn key_column = create_varchar_key(1, true, 8);
+    map_column.add_sub_column(key_column);
+    TabletColumn value_column = create_int_value(2, STORAGE_AGGREGATE_NONE, true);
+    map_column.add_sub_column(value_column);
+
+    auto src_offsets = UInt32Column::create();
+    auto src_keys = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    auto src_values = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    ColumnPtr src_column = MapColumn::create(src_keys, src_values, src_offsets);
+    // {'a':1,'b':2}, {}, {'b':3,'c':4}, {'c':5}
+    for (const auto& [key, value] : std::vector<std::pair<std::string, int32_t>>{
+                 {"a", 1}, {"b", 2}, {"b", 3}, {"c", 4}, {"c", 5}}) {
+        src_keys->append_datum(Slice(key));
+        src_values->append_datum(value);
+    }
+    for (uint32_t offset : {2, 2, 4, 5}) {
+        src_offsets->append(offset);
+    }
+
+    ColumnMetaPB meta;
+    const std::string fname = TEST_DIR + "/test_map_index_keys.data";
+    auto segment = create_dummy_segment(fs, fname);
+    {
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+
+        ColumnWriterOptions writer_opts;
+        writer_opts.meta = &meta;
+        writer_opts.meta->set_column_id(0);
+        writer_opts.meta->set_unique_id(0);
+        writer_opts.meta->set_type(TYPE_MAP);
+        writer_opts.meta->set_length(0);
+        writer_opts.meta->set_encoding(DEFAULT_ENCODING);
+        writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+        writer_opts.meta->set_is_nullable(false);
+        writer_opts.need_zone_map = false;
+
+        ColumnMetaPB* key_meta = writer_opts.meta->add_children_columns();
+        key_meta->set_column_id(0);
+        key_meta->set_unique_id(0);
+        key_meta->set_type(key_column.type());
+        key_meta->set_length(key_column.length());
+        key_meta->set_encoding(DEFAULT_ENCODING);
+        key_meta->set_compression(LZ4_FRAME);
+        key_meta->set_is_nullable(true);
+
+        ColumnMetaPB* value_meta = writer_opts.meta->add_children_columns();
+        value_meta->set_column_id(0);
+        value_meta->set_unique_id(0);
+        value_meta->set_type(value_column.type());
+        value_meta->set_length(value_column.length());
+        value_meta->set_encoding(DEFAULT_ENCODING);
+        value_meta->set_compression(LZ4_FRAME);
+        value_meta->set_is_nullable(true);
+
+        ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &map_column, wfile.get()));
+        ASSERT_OK(writer->init());
+        ASSERT_OK(writer->append(*src_column));
+        ASSERT_OK(writer->finish());
+        ASSERT_OK(writer->write_data());
+        ASSERT_OK(writer->write_ordinal_index());
+        ASSERT_OK(wfile->close());
+    }
+
+    ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get()));
+    ASSIGN_OR_ABORT(auto child_path, ColumnAccessPath::create(TAccessPathType::type::INDEX, "P", 1));
+    child_path->set_index_keys({"b"});
+    ASSIGN_OR_ABORT(auto path, ColumnAccessPath::create(TAccessPathType::type::ROOT, "root", 0));
+    path->children().emplace_back(std::move(child_path));
+
+    ASSIGN_OR_ABORT(auto iter, reader->new_iterator(path.get()));
+    ASSIGN_OR_ABORT(auto read_file, fs->new_random_access_file(fname));
+    ColumnIteratorOptions iter_opts;
+    OlapReaderStatistics stats;
+    iter_opts.stats = &stats;
+    iter_opts.read_file = read_file.get();
+    ASSERT_OK(iter->init(iter_opts));
+
+    auto new_map_column = []() {
+        return MapColumn::create(NullableColumn::create(BinaryColumn::create(), NullColumn::create()),
+                                 NullableColumn::create(Int32Column::create(), NullColumn::create()),
+                                 UInt32Column::create());
+    };
+
+    // sequence read
+    {
+        ASSERT_OK(iter->seek_to_first());
+        auto dst_column = new_map_column();
+        size_t rows_read = src_column->size();
+        ASSERT_OK(iter->next_batch(&rows_read, dst_column.get()));
+        ASSERT_EQ(src_column->size(), rows_read);
+        ASSERT_EQ("{'a':NULL,'b':2}", dst_column->debug_item(0));
+        ASSERT_EQ("{}", dst_column->debug_item(1));
+        ASSERT_EQ("{'b':3,'c':NULL}", dst_column->debug_item(2));
+        ASSERT_EQ("{'c':NULL}", dst_column->debug_item(3));
+    }
+
+    // range read
+    {
+        ASSERT_OK(iter->seek_to_ordinal(2));
+        auto dst_column = new_map_column();
+        ASSERT_OK(iter->next_batch(SparseRange<>(2, 4), dst_column.get()));
+        ASSERT_EQ(2, dst_column->size());
+        ASSERT_EQ("{'b':3,'c':NULL}", dst_column->debug_item(0));
+        ASSERT_EQ("{'c':NULL}", dst_column->debug_item(1));
+    }
+}
+
 } // namespace starrocks
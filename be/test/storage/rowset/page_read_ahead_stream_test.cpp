@@ -0,0 +1,101 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/page_read_ahead_stream.h"
+
+#include <gtest/gtest.h>
+
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+#include "util/threadpool.h"
+
+namespace starrocks {
+
+class PageReadAheadStreamTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_OK(ThreadPoolBuilder("read_ahead_test").set_min_threads(1).set_max_threads(4).build(&_pool));
+        for (int i = 0; i < kNumPages; i++) {
+            _contents.append(kPageSize, static_cast<char>('a' + i % 26));
+            _pages.emplace_back(i * kPageSize, kPageSize);
+        }
+        // The dictionary page after the data pages.
+        _contents.append(kPageSize, 'z');
+    }
+
+    std::unique_ptr<PageReadAheadStream> _new_stream(int64_t max_pages, int64_t max_buffer_size) {
+        auto stream = std::make_shared<io::StringInputStream>(_contents);
+        auto read_ahead = std::make_unique<PageReadAheadStream>(stream, _pool.get(), max_pages, max_buffer_size);
+        read_ahead->set_pages(_pages);
+        return read_ahead;
+    }
+
+    void _check_page(PageReadAheadStream* stream, int i) {
+        std::string page(kPageSize, '\0');
+        ASSERT_OK(stream->read_at_fully(i * kPageSize, page.data(), kPageSize));
+        ASSERT_EQ(std::string(kPageSize, static_cast<char>('a' + i % 26)), page);
+    }
+
+    static constexpr int kNumPages = 100;
+    static constexpr int64_t kPageSize = 1000;
+
+    std::unique_ptr<ThreadPool> _pool;
+    std::string _contents;
+    std::vector<PagePointer> _pages;
+};
+
+TEST_F(PageReadAheadStreamTest, test_read_in_order) {
+    auto stream = _new_stream(8, 1024 * 1024);
+    for (int i = 0; i < kNumPages; i++) {
+        _check_page(stream.get(), i);
+        ASSERT_LE(stream->window(), 8);
+    }
+    // The first page is read directly, which starts the read-ahead.
+    ASSERT_EQ(kNumPages - 1, stream->read_ahead_count());
+    ASSERT_EQ(kNumPages - 1, stream->hit_count());
+}
+
+TEST_F(PageReadAheadStreamTest, test_skip_pages) {
+    auto stream = _new_stream(8, 1024 * 1024);
+    _check_page(stream.get(), 0);
+    // The pages found in the page cache are not read.
+    for (int i = 10; i < kNumPages; i += 10) {
+        _check_page(stream.get(), i);
+        _check_page(stream.get(), i + 1);
+    }
+    ASSERT_GT(stream->hit_count(), 0);
+
+    // The reads of other offsets go to the underlying stream.
+    std::string dict(kPageSize, '\0');
+    ASSERT_OK(stream->read_at_fully(kNumPages * kPageSize, dict.data(), kPageSize));
+    ASSERT_EQ(std::string(kPageSize, 'z'), dict);
+}
+
+TEST_F(PageReadAheadStreamTest, test_max_buffer_size) {
+    // Only one page is buffered at a time.
+    auto stream = _new_stream(8, kPageSize);
+    for (int i = 0; i < kNumPages; i++) {
+        _check_page(stream.get(), i);
+    }
+    ASSERT_EQ(kNumPages - 1, stream->hit_count());
+}
+
+TEST_F(PageReadAheadStreamTest, test_destroy_with_pending_reads) {
+    auto stream = _new_stream(16, 1024 * 1024);
+    _check_page(stream.get(), 0);
+    stream.reset();
+    _pool->wait();
+}
+
+} // namespace starrocks
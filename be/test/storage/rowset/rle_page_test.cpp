@@ -43,6 +43,7 @@
 #include "runtime/mem_pool.h"
 #include "runtime/mem_tracker.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/page_builder.h"
 #include "storage/rowset/page_decoder.h"
@@ -258,4 +259,51 @@ TEST_F(RlePageTest, TestRleBoolBlockEncoderSize) {
     ASSERT_EQ(7, s.slice().size);
 }
 
+TEST_F(RlePageTest, TestRleEvaluatePredicate) {
+    const uint32_t size = 10000;
+
+    std::unique_ptr<bool[]> bools(new bool[size]);
+    std::unique_ptr<int32_t[]> ints(new int32_t[size]);
+    for (int i = 0; i < size; i++) {
+        // The long runs mixed with the literal values.
+        bools.get()[i] = (i / 100) % 3 == 0 || random() % 10 == 0;
+        ints.get()[i] = i % 1000 < 500 ? i / 100 : random() % 100;
+    }
+    OwnedSlice bool_page = rle_encode<TYPE_BOOLEAN>(bools.get(), size);
+    OwnedSlice int_page = rle_encode<TYPE_INT>(ints.get(), size);
+
+    auto check = [&](auto* decoder, auto* src, PredicateType pred_type, LogicalType type, const std::string& operand) {
+        std::unique_ptr<ColumnPredicate> pred(new_column_cmp_predicate(pred_type, get_type_info(type), 0, operand));
+        ASSERT_TRUE(decoder->init().ok());
+        std::vector<uint8_t> selection(size);
+        size_t pos = 0;
+        while (pos < size) {
+            size_t n = random() % 300 + 1;
+            ASSERT_TRUE(decoder->evaluate(*pred, &n, selection.data() + pos).ok());
+            pos += n;
+            ASSERT_EQ(pos, decoder->current_index());
+        }
+        auto column = ChunkHelper::column_from_field_type(type, false);
+        column->append_numbers(src, size * sizeof(*src));
+        std::vector<uint8_t> expected(size);
+        ASSERT_TRUE(pred->evaluate(column.get(), expected.data()).ok());
+        for (uint32_t i = 0; i < size; i++) {
+            ASSERT_EQ(expected[i], selection[i]) << "type=" << pred_type << ", operand=" << operand << ", i=" << i;
+        }
+    };
+    for (auto pred_type : {PredicateType::kEQ, PredicateType::kNE}) {
+        for (const std::string operand : {"0", "1"}) {
+            RlePageDecoder<TYPE_BOOLEAN> decoder(bool_page.slice());
+            check(&decoder, bools.get(), pred_type, TYPE_BOOLEAN, operand);
+        }
+    }
+    for (auto pred_type : {PredicateType::kEQ, PredicateType::kNE, PredicateType::kGT, PredicateType::kGE,
+                           PredicateType::kLT, PredicateType::kLE}) {
+        for (const std::string operand : {"-1", "0", "42", "99", "100"}) {
+            RlePageDecoder<TYPE_INT> decoder(int_page.slice());
+            check(&decoder, ints.get(), pred_type, TYPE_INT, operand);
+        }
+    }
+}
+
 } // namespace starrocks
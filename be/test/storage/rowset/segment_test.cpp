@@ -50,6 +50,7 @@
 #include "storage/olap_common.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
+#include "storage/rowset/index_prefetcher.h"
 #include "storage/rowset/segment_options.h"
 #include "storage/rowset/segment_writer.h"
 #include "storage/tablet_schema.h"
@@ -557,4 +558,202 @@ TEST_F(SegmentReaderWriterTest, TestTypeConversion) {
         EXPECT_EQ(10, read_chunk->get(0)[1].get_int64());
     }
 }
+
+TEST_F(SegmentReaderWriterTest, TestEncodedPagePredicate) {
+    auto tablet_schema = std::shared_ptr<TabletSchema>{
+            TabletSchemaHelper::create_tablet_schema({create_int_key_pb(0), create_int_value_pb(1)})};
+    auto opts = SegmentWriterOptions{};
+    opts.num_rows_per_block = 100;
+    auto file_name = kSegmentDir + "/encoded_page_predicate";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    const int32_t num_rows = 10000;
+    auto write_schema = ChunkHelper::convert_schema(tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(write_schema, num_rows);
+    auto& cols = chunk->columns();
+    for (int32_t i = 0; i < num_rows; ++i) {
+        cols[0]->append_datum(Datum(i));
+        // Some long runs of values passing the predicates, and some scattered ones.
+        cols[1]->append_datum(Datum(static_cast<int32_t>((i / 1000) % 2 == 0 ? i % 37 : i % 1000)));
+    }
+    ASSERT_OK(writer.append_chunk(*chunk));
+
+    auto file_size = uint64_t{0};
+    auto index_size = uint64_t{0};
+    auto footer_position = uint64_t{0};
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+    auto segment = *Segment::open(_fs, FileInfo{file_name}, 0, tablet_schema);
+
+    auto read_schema = ChunkHelper::convert_schema(tablet_schema);
+    auto type_info = get_type_info(LogicalType::TYPE_INT);
+    auto read_rows = [&](ColumnPredicate* predicate, std::vector<int32_t>* keys) {
+        auto pred_root = PredicateAndNode{};
+        pred_root.add_child(PredicateColumnNode{predicate});
+        auto stats = OlapReaderStatistics{};
+        auto seg_options = SegmentReadOptions{};
+        seg_options.fs = _fs;
+        seg_options.stats = &stats;
+        seg_options.tablet_schema = tablet_schema;
+        seg_options.pred_tree = PredicateTree::create(std::move(pred_root));
+        ASSIGN_OR_ABORT(auto seg_iter, segment->new_iterator(read_schema, seg_options));
+        auto read_chunk = ChunkHelper::new_chunk(read_schema, config::vector_chunk_size);
+        while (true) {
+            read_chunk->reset();
+            auto st = seg_iter->get_next(read_chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(st);
+            for (auto i = 0; i < read_chunk->num_rows(); ++i) {
+                keys->push_back(read_chunk->get(i)[0].get_int32());
+            }
+        }
+    };
+
+    const bool old_config = config::enable_encoded_page_predicate;
+    for (const char* operand : {"0", "10", "36", "500", "999"}) {
+        for (auto pred_type : {PredicateType::kEQ, PredicateType::kNE, PredicateType::kGT, PredicateType::kGE,
+                               PredicateType::kLT, PredicateType::kLE}) {
+            std::unique_ptr<ColumnPredicate> predicate{new_column_cmp_predicate(pred_type, type_info, 1, operand)};
+            std::vector<int32_t> expected;
+            std::vector<int32_t> actual;
+            config::enable_encoded_page_predicate = false;
+            read_rows(predicate.get(), &expected);
+            config::enable_encoded_page_predicate = true;
+            read_rows(predicate.get(), &actual);
+            ASSERT_EQ(expected, actual) << "operand=" << operand << " type=" << static_cast<int>(pred_type);
+        }
+    }
+    config::enable_encoded_page_predicate = old_config;
+}
+
+TEST_F(SegmentReaderWriterTest, TestAdaptivePredicateOrder) {
+    auto tablet_schema = std::shared_ptr<TabletSchema>{TabletSchemaHelper::create_tablet_schema(
+            {create_int_key_pb(0), create_int_value_pb(1), create_int_value_pb(2), create_int_value_pb(3)})};
+    auto opts = SegmentWriterOptions{};
+    opts.num_rows_per_block = 100;
+    auto file_name = kSegmentDir + "/adaptive_predicate_order";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    const int32_t num_rows = 50000;
+    auto write_schema = ChunkHelper::convert_schema(tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(write_schema, num_rows);
+    auto& cols = chunk->columns();
+    for (int32_t i = 0; i < num_rows; ++i) {
+        cols[0]->append_datum(Datum(i));
+        // c1 filters the rows in long runs, and c2 filters the scattered rows.
+        cols[1]->append_datum(Datum(static_cast<int32_t>(i / 500)));
+        cols[2]->append_datum(Datum(static_cast<int32_t>(i * 7 % 100)));
+        cols[3]->append_datum(Datum(static_cast<int32_t>(i + 1)));
+    }
+    ASSERT_OK(writer.append_chunk(*chunk));
+
+    auto file_size = uint64_t{0};
+    auto index_size = uint64_t{0};
+    auto footer_position = uint64_t{0};
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+    auto segment = *Segment::open(_fs, FileInfo{file_name}, 0, tablet_schema);
+
+    auto read_schema = ChunkHelper::convert_schema(tablet_schema);
+    auto type_info = get_type_info(LogicalType::TYPE_INT);
+    auto read_rows = [&](const std::vector<ColumnPredicate*>& predicates, std::vector<int32_t>* rows,
+                         OlapReaderStatistics* stats) {
+        auto pred_root = PredicateAndNode{};
+        for (auto* predicate : predicates) {
+            pred_root.add_child(PredicateColumnNode{predicate});
+        }
+        auto seg_options = SegmentReadOptions{};
+        seg_options.fs = _fs;
+        seg_options.stats = stats;
+        seg_options.chunk_size = 1000;
+        seg_options.tablet_schema = tablet_schema;
+        seg_options.pred_tree = PredicateTree::create(std::move(pred_root));
+        ASSIGN_OR_ABORT(auto seg_iter, segment->new_iterator(read_schema, seg_options));
+        auto read_chunk = ChunkHelper::new_chunk(read_schema, seg_options.chunk_size);
+        while (true) {
+            read_chunk->reset();
+            auto st = seg_iter->get_next(read_chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(st);
+            for (auto i = 0; i < read_chunk->num_rows(); ++i) {
+                auto row = read_chunk->get(i);
+                ASSERT_EQ(row[0].get_int32() + 1, row[3].get_int32());
+                rows->push_back(row[0].get_int32());
+            }
+        }
+    };
+
+    const bool old_config = config::enable_adaptive_predicate_order;
+    std::vector<std::pair<std::string, std::string>> operands = {{"0", "0"}, {"20", "50"}, {"99", "10"}, {"100", "99"}};
+    for (const auto& [c1_operand, c2_operand] : operands) {
+        std::unique_ptr<ColumnPredicate> c1_pred{new_column_lt_predicate(type_info, 1, c1_operand)};
+        std::unique_ptr<ColumnPredicate> c2_pred{new_column_ge_predicate(type_info, 2, c2_operand)};
+        std::unique_ptr<ColumnPredicate> c2_pred2{new_column_ne_predicate(type_info, 2, "77")};
+        std::vector<ColumnPredicate*> predicates = {c1_pred.get(), c2_pred.get(), c2_pred2.get()};
+
+        std::vector<int32_t> expected;
+        std::vector<int32_t> actual;
+        OlapReaderStatistics expected_stats;
+        OlapReaderStatistics actual_stats;
+        config::enable_adaptive_predicate_order = false;
+        read_rows(predicates, &expected, &expected_stats);
+        config::enable_adaptive_predicate_order = true;
+        read_rows(predicates, &actual, &actual_stats);
+        ASSERT_EQ(expected, actual) << c1_operand << " " << c2_operand;
+        EXPECT_TRUE(expected_stats.predicate_column_stats.empty());
+        EXPECT_EQ(2, actual_stats.predicate_column_stats.size());
+        EXPECT_EQ(expected_stats.rows_vec_cond_filtered + expected_stats.rows_encoded_pred_filtered,
+                  actual_stats.rows_vec_cond_filtered + actual_stats.rows_encoded_pred_filtered);
+    }
+    config::enable_adaptive_predicate_order = old_config;
+}
+
+TEST_F(SegmentReaderWriterTest, TestIndexPrefetch) {
+    auto tablet_schema = std::shared_ptr<TabletSchema>{TabletSchemaHelper::create_tablet_schema(
+            {create_int_key_pb(1), create_int_value_pb(2, "NONE"), create_int_value_pb(3, "NONE", true, "", true)})};
+    auto opts = SegmentWriterOptions{};
+    opts.num_rows_per_block = 100;
+    std::shared_ptr<Segment> segment;
+    build_segment(opts, tablet_schema, tablet_schema, 50000, DefaultIntGenerator, &segment);
+
+    auto type_info = get_type_info(LogicalType::TYPE_INT);
+    std::unique_ptr<ColumnPredicate> c1_pred{new_column_eq_predicate(type_info, 1, "11")};
+    std::unique_ptr<ColumnPredicate> c2_pred{new_column_eq_predicate(type_info, 2, "12")};
+    auto pred_root = PredicateAndNode{};
+    pred_root.add_child(PredicateColumnNode{c1_pred.get()});
+    pred_root.add_child(PredicateColumnNode{c2_pred.get()});
+    auto pred_tree = PredicateTree::create(std::move(pred_root));
+    auto column_uids = IndexPrefetcher::bloom_filter_columns(pred_tree, *tablet_schema);
+    ASSERT_EQ((std::vector<ColumnUID>{2, 3}), column_uids);
+
+    auto seg_options = SegmentReadOptions{};
+    seg_options.fs = _fs;
+    OlapReaderStatistics stats;
+    ASSERT_OK(IndexPrefetcher::prefetch(segment.get(), column_uids, seg_options, &stats));
+    auto* reader = segment->column_with_uid(3);
+    ASSERT_FALSE(reader->bloom_filter_index_root_page().has_value());
+    auto pages = reader->bloom_filter_pages();
+    ASSERT_FALSE(pages.empty());
+    EXPECT_GE(stats.total_pages_num, pages.size());
+    EXPECT_GT(stats.index_prefetch_io_count, 0);
+    // The adjacent pages are coalesced into fewer reads.
+    EXPECT_LE(stats.index_prefetch_io_count, stats.total_pages_num);
+    EXPECT_GT(stats.index_prefetch_io_bytes, 0);
+
+    // The bloom filter pages are read from the page cache.
+    OlapReaderStatistics cached_stats;
+    ASSERT_OK(IndexPrefetcher::prefetch(segment.get(), column_uids, seg_options, &cached_stats));
+    EXPECT_EQ(pages.size(), cached_stats.total_pages_num);
+    EXPECT_EQ(pages.size(), cached_stats.cached_pages_num);
+    EXPECT_EQ(0, cached_stats.index_prefetch_io_count);
+}
+
 } // namespace starrocks
@@ -34,11 +34,16 @@
 
 #include "storage/rowset/zone_map_index.h"
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <vector>
 
+#include "common/config.h"
 #include "fs/fs_memory.h"
 #include "storage/page_cache.h"
 #include "storage/tablet_schema_helper.h"
@@ -113,6 +118,13 @@ protected:
 
         ASSERT_EQ(true, zone_maps[2].has_null());
         ASSERT_EQ(false, zone_maps[2].has_not_null());
+
+        ASSERT_EQ("aaaaa", column_zone_map.page_min(1).to_string());
+        ASSERT_EQ("fffff", column_zone_map.page_max(1).to_string());
+        ASSERT_TRUE(column_zone_map.page_has_null(1));
+        ASSERT_TRUE(column_zone_map.page_has_not_null(1));
+        ASSERT_TRUE(column_zone_map.page_min(2).empty());
+        ASSERT_FALSE(column_zone_map.page_has_not_null(2));
     }
 
     void write_file(ZoneMapIndexWriter& builder, ColumnIndexMetaPB& meta, std::string filename);
@@ -361,4 +373,59 @@ TEST_F(ColumnZoneMapTest, NormalTestCharPage) {
     test_string("NormalTestCharPage", type_info);
 }
 
+// NOLINTNEXTLINE
+TEST_F(ColumnZoneMapTest, SegmentHistogram) {
+    config::segment_zone_map_histogram_buckets = 4;
+    TypeInfoPtr int_type = get_type_info(create_int_key(0));
+    auto builder = ZoneMapIndexWriter::create(int_type.get());
+    // 0..99999, each value once, except 7 appearing 50000 more times
+    std::vector<int> values(100000);
+    std::iota(values.begin(), values.end(), 0);
+    std::vector<int> frequent(50000, 7);
+    builder->add_values(values.data(), values.size());
+    builder->add_values(frequent.data(), frequent.size());
+    builder->add_nulls(10);
+    ASSERT_OK(builder->flush());
+    ColumnIndexMetaPB index_meta;
+    write_file(*builder, index_meta, kTestDir + "/SegmentHistogram");
+
+    const ZoneMapHistogramPB& histogram = index_meta.zone_map_index().segment_zone_map().histogram();
+    ASSERT_GE(histogram.upper_bounds_size(), 2);
+    ASSERT_LE(histogram.upper_bounds_size(), 4);
+    ASSERT_EQ(histogram.upper_bounds_size(), histogram.counts_size());
+    // the buckets of the frequent value are merged into the one ending at it
+    ASSERT_EQ("7", histogram.upper_bounds(0));
+    ASSERT_EQ("99999", histogram.upper_bounds(histogram.upper_bounds_size() - 1));
+    uint64_t total = 0;
+    for (uint64_t count : histogram.counts()) {
+        total += count;
+    }
+    ASSERT_NEAR(150000, total, 100);
+    ASSERT_NEAR(50000, histogram.counts(0), 5000);
+
+    // the strings are copied into the samples
+    TypeInfoPtr varchar_type = get_type_info(create_varchar_key(0));
+    auto string_builder = ZoneMapIndexWriter::create(varchar_type.get());
+    for (int i = 0; i < 10000; i++) {
+        std::string value = fmt::format("{:05d}", i);
+        Slice slice(value);
+        string_builder->add_values(&slice, 1);
+    }
+    ASSERT_OK(string_builder->flush());
+    ColumnIndexMetaPB string_meta;
+    write_file(*string_builder, string_meta, kTestDir + "/SegmentHistogramString");
+    const ZoneMapHistogramPB& string_histogram = string_meta.zone_map_index().segment_zone_map().histogram();
+    ASSERT_EQ(4, string_histogram.upper_bounds_size());
+    ASSERT_EQ("09999", string_histogram.upper_bounds(3));
+    ASSERT_TRUE(std::is_sorted(string_histogram.upper_bounds().begin(), string_histogram.upper_bounds().end()));
+    config::segment_zone_map_histogram_buckets = 0;
+
+    auto no_histogram_builder = ZoneMapIndexWriter::create(int_type.get());
+    no_histogram_builder->add_values(values.data(), values.size());
+    ASSERT_OK(no_histogram_builder->flush());
+    ColumnIndexMetaPB no_histogram_meta;
+    write_file(*no_histogram_builder, no_histogram_meta, kTestDir + "/NoSegmentHistogram");
+    ASSERT_FALSE(no_histogram_meta.zone_map_index().segment_zone_map().has_histogram());
+}
+
 } // namespace starrocks
@@ -368,6 +368,31 @@ TEST_F(TabletUpdatesTest, writeread_with_persistent_index) {
     test_writeread(true);
 }
 
+TEST_F(TabletUpdatesTest, apply_lag) {
+    srand(GetCurrentTimeMicros());
+    _tablet = create_tablet(rand(), rand());
+    std::vector<int64_t> keys;
+    for (int i = 0; i < 100; i++) {
+        keys.push_back(i);
+    }
+    // versions committed while apply is stopped stay pending
+    _tablet->updates()->stop_apply(true);
+    ASSERT_TRUE(_tablet->rowset_commit(2, create_rowset(_tablet, keys)).ok());
+    ASSERT_TRUE(_tablet->rowset_commit(3, create_rowset(_tablet, keys)).ok());
+    size_t pending_versions = 0;
+    int64_t lag_seconds = -1;
+    _tablet->updates()->get_apply_lag(&pending_versions, &lag_seconds);
+    ASSERT_EQ(2, pending_versions);
+    ASSERT_GE(lag_seconds, 0);
+
+    _tablet->updates()->stop_apply(false);
+    _tablet->updates()->check_for_apply();
+    ASSERT_EQ(100, read_tablet(_tablet, 3));
+    _tablet->updates()->get_apply_lag(&pending_versions, &lag_seconds);
+    ASSERT_EQ(0, pending_versions);
+    ASSERT_EQ(0, lag_seconds);
+}
+
 TEST_F(TabletUpdatesTest, test_pk_index_write_amp_score) {
     srand(GetCurrentTimeMicros());
     _tablet = create_tablet(rand(), rand());
@@ -412,6 +437,32 @@ TEST_F(TabletUpdatesTest, test_pk_index_write_amp_score) {
     config::l0_max_mem_usage = old_l0_max_mem_usage;
 }
 
+TEST_F(TabletUpdatesTest, test_load_primary_index) {
+    srand(GetCurrentTimeMicros());
+    _tablet = create_tablet(rand(), rand());
+    std::vector<int64_t> keys;
+    for (int i = 0; i < 100; i++) {
+        keys.push_back(i);
+    }
+    ASSERT_TRUE(_tablet->rowset_commit(2, create_rowset(_tablet, keys)).ok());
+    auto manager = StorageEngine::instance()->update_manager();
+    manager->index_cache().try_remove_by_key(_tablet->tablet_id());
+    ASSERT_EQ(nullptr, manager->index_cache().get(_tablet->tablet_id()));
+
+    ASSERT_TRUE(_tablet->updates()->load_primary_index().ok());
+    auto index_entry = manager->index_cache().get(_tablet->tablet_id());
+    ASSERT_NE(nullptr, index_entry);
+    ASSERT_GT(index_entry->value().memory_usage(), 0);
+    manager->index_cache().release(index_entry);
+
+    auto tablets = StorageEngine::instance()->tablet_manager()->pick_tablets_to_warm_up_pk_index(0);
+    ASSERT_TRUE(std::any_of(tablets.begin(), tablets.end(),
+                            [&](const auto& t) { return t->tablet_id() == _tablet->tablet_id(); }));
+    tablets = StorageEngine::instance()->tablet_manager()->pick_tablets_to_warm_up_pk_index(time(nullptr) + 3600);
+    ASSERT_TRUE(std::none_of(tablets.begin(), tablets.end(),
+                             [&](const auto& t) { return t->tablet_id() == _tablet->tablet_id(); }));
+}
+
 TEST_F(TabletUpdatesTest, writeread_with_sort_key) {
     srand(GetCurrentTimeMicros());
     _tablet = create_tablet_with_sort_key(rand(), rand(), {1});
@@ -2842,6 +2893,56 @@ TEST_F(TabletUpdatesTest, column_with_row_update) {
     ASSERT_TRUE(tablet->rowset_commit(1, rs.value()).ok());
 }
 
+TEST_F(TabletUpdatesTest, column_with_row_hybrid_scan) {
+    auto tablet = create_tablet_column_with_row(rand(), rand());
+    std::vector<int64_t> keys;
+    const int N = 20;
+    for (int i = 0; i < N; i++) {
+        keys.push_back(i);
+    }
+    ASSIGN_OR_ABORT(auto rs, create_rowset_column_with_row(tablet, keys));
+    ASSERT_TRUE(tablet->rowset_commit(2, rs).ok());
+
+    const bool old_enable_hybrid_row_column_scan = config::enable_hybrid_row_column_scan;
+    const double old_decode_cost_ratio = config::hybrid_row_column_scan_decode_cost_ratio;
+    DeferOp defer([&]() {
+        config::enable_hybrid_row_column_scan = old_enable_hybrid_row_column_scan;
+        config::hybrid_row_column_scan_decode_cost_ratio = old_decode_cost_ratio;
+    });
+    // cheap enough for the row column to be chosen for the value columns of the whole segment
+    config::hybrid_row_column_scan_decode_cost_ratio = 0.1;
+
+    // the key and the value columns, without the row column
+    Schema schema = ChunkHelper::convert_schema(tablet->thread_safe_get_tablet_schema(), {0, 1, 2});
+    auto read = [&](bool enable_hybrid_scan, std::vector<std::string>* rows) -> int64_t {
+        config::enable_hybrid_row_column_scan = enable_hybrid_scan;
+        TabletReader reader(tablet, Version(0, 2), schema);
+        auto iter = create_tablet_iterator(reader, schema);
+        EXPECT_TRUE(iter != nullptr);
+        auto chunk = ChunkHelper::new_chunk(iter->schema(), 8);
+        while (true) {
+            auto st = iter->get_next(chunk.get());
+            if (!st.ok()) {
+                EXPECT_TRUE(st.is_end_of_file()) << st;
+                break;
+            }
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                rows->emplace_back(chunk->debug_row(i));
+            }
+            chunk->reset();
+        }
+        iter->close();
+        return reader.stats().row_store_segments;
+    };
+
+    std::vector<std::string> columnar_rows;
+    std::vector<std::string> hybrid_rows;
+    ASSERT_EQ(0, read(false, &columnar_rows));
+    ASSERT_EQ(1, read(true, &hybrid_rows));
+    ASSERT_EQ(N, hybrid_rows.size());
+    ASSERT_EQ(columnar_rows, hybrid_rows);
+}
+
 void TabletUpdatesTest::test_get_rowsets_for_incremental_snapshot(const std::vector<int64_t>& versions,
                                                                   const std::vector<int64_t>& missing_ranges,
                                                                   const std::vector<int64_t>& expect_rowset_versions,
@@ -0,0 +1,73 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/txn_manager.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+// NOLINTNEXTLINE
+TEST(TxnManagerTest, test_tablet_related_txns) {
+    TxnManager txn_manager(4, 4, 0);
+    const TabletUid uid(1, 1);
+    const TabletUid new_uid(2, 2);
+    PUniqueId load_id;
+    load_id.set_hi(1);
+    load_id.set_lo(1);
+
+    // tablets 10 and 11 in txns 100 and 101, and tablet 10 with another uid in txn 101
+    for (int64_t txn_id : {100, 101}) {
+        for (int64_t tablet_id : {10, 11}) {
+            ASSERT_OK(txn_manager.prepare_txn(1, txn_id, tablet_id, 0, uid, load_id));
+        }
+    }
+    ASSERT_OK(txn_manager.prepare_txn(1, 101, 10, 0, new_uid, load_id));
+
+    int64_t partition_id = 0;
+    std::set<int64_t> txn_ids;
+    txn_manager.get_tablet_related_txns(10, 0, uid, &partition_id, &txn_ids);
+    ASSERT_EQ(1, partition_id);
+    ASSERT_EQ((std::set<int64_t>{100, 101}), txn_ids);
+
+    // the txn of the other uid is still found after the one of the uid is rolled back
+    ASSERT_OK(txn_manager.rollback_txn(1, 101, 10, 0, uid));
+    txn_ids.clear();
+    txn_manager.get_tablet_related_txns(10, 0, uid, &partition_id, &txn_ids);
+    ASSERT_EQ((std::set<int64_t>{100}), txn_ids);
+    txn_ids.clear();
+    txn_manager.get_tablet_related_txns(10, 0, new_uid, &partition_id, &txn_ids);
+    ASSERT_EQ((std::set<int64_t>{101}), txn_ids);
+
+    txn_manager.force_rollback_tablet_related_txns(nullptr, 11, 0, uid);
+    txn_ids.clear();
+    txn_manager.get_tablet_related_txns(11, 0, uid, &partition_id, &txn_ids);
+    ASSERT_TRUE(txn_ids.empty());
+    txn_ids.clear();
+    txn_manager.get_tablet_related_txns(10, 0, uid, &partition_id, &txn_ids);
+    ASSERT_EQ((std::set<int64_t>{100}), txn_ids);
+
+    ASSERT_OK(txn_manager.delete_txn(nullptr, 1, 100, 10, 0, uid));
+    ASSERT_OK(txn_manager.delete_txn(nullptr, 1, 101, 10, 0, new_uid));
+    std::set<TabletInfo> tablet_infos;
+    txn_manager.get_all_related_tablets(&tablet_infos);
+    ASSERT_TRUE(tablet_infos.empty());
+    txn_ids.clear();
+    txn_manager.get_tablet_related_txns(10, 0, new_uid, &partition_id, &txn_ids);
+    ASSERT_TRUE(txn_ids.empty());
+}
+
+} // namespace starrocks
@@ -0,0 +1,286 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "column/array_column.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "fs/fs_util.h"
+#include "storage/chunk_helper.h"
+#include "storage/inverted/index_descriptor.hpp"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/vector_index/vector_index_reader.h"
+#include "storage/vector_index/vector_index_util.hpp"
+#include "storage/vector_index/vector_index_writer.h"
+#include "testutil/assert.h"
+#include "util/json_util.h"
+
+namespace starrocks {
+
+class VectorIndexTest : public testing::Test {
+protected:
+    void SetUp() override {
+        CHECK_OK(fs::remove_all(_index_dir));
+        CHECK_OK(fs::create_directories(_index_dir));
+    }
+
+    void TearDown() override { (void)fs::remove_all(_index_dir); }
+
+    static TabletIndex make_index(uint32_t dim, const std::string& metric, uint32_t nlist) {
+        TabletIndex index;
+        index.add_index_properties(VECTOR_INDEX_DIM_KEY, std::to_string(dim));
+        index.add_index_properties(VECTOR_INDEX_METRIC_TYPE_KEY, metric);
+        index.add_index_properties(VECTOR_INDEX_NLIST_KEY, std::to_string(nlist));
+        return index;
+    }
+
+    // A nullable ARRAY<FLOAT> column of `vectors`, an empty vector is a null row.
+    static ColumnPtr make_column(const std::vector<std::vector<float>>& vectors) {
+        auto elements = NullableColumn::create(FloatColumn::create(), NullColumn::create());
+        auto offsets = UInt32Column::create();
+        auto nulls = NullColumn::create();
+        offsets->append(0);
+        for (const auto& v : vectors) {
+            for (float x : v) {
+                elements->append_datum(Datum(x));
+            }
+            offsets->append(elements->size());
+            nulls->append(v.empty());
+        }
+        return NullableColumn::create(ArrayColumn::create(std::move(elements), std::move(offsets)), std::move(nulls));
+    }
+
+    std::unique_ptr<VectorIndexReader> build(const TabletIndex& index, const std::vector<std::vector<float>>& vectors) {
+        const std::string path = _index_dir + "/0_0_1.vi";
+        auto writer = VectorIndexWriter::create(index, path);
+        EXPECT_TRUE(writer.ok());
+        // appends in two batches to check the rowids across the batches
+        const auto half = vectors.begin() + vectors.size() / 2;
+        EXPECT_OK(writer.value()->append(*make_column(std::vector<std::vector<float>>(vectors.begin(), half))));
+        EXPECT_OK(writer.value()->append(*make_column(std::vector<std::vector<float>>(half, vectors.end()))));
+        EXPECT_OK(writer.value()->finish());
+        auto reader = VectorIndexReader::load(path);
+        EXPECT_TRUE(reader.ok());
+        return std::move(reader.value());
+    }
+
+    const std::string _index_dir = "./vector_index_test";
+};
+
+// NOLINTNEXTLINE
+TEST_F(VectorIndexTest, test_l2_search) {
+    const uint32_t dim = 8;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-1, 1);
+    std::vector<std::vector<float>> vectors(1000);
+    roaring::Roaring all;
+    for (uint32_t row = 0; row < vectors.size(); row++) {
+        // every 100th row is null
+        if (row % 100 == 0) {
+            continue;
+        }
+        vectors[row].resize(dim);
+        std::generate(vectors[row].begin(), vectors[row].end(), [&] { return dist(rng); });
+        all.add(row);
+    }
+    auto reader = build(make_index(dim, VECTOR_METRIC_L2_DISTANCE, 16), vectors);
+    ASSERT_EQ(dim, reader->dim());
+    ASSERT_EQ(990, reader->num_vectors());
+
+    std::vector<float> query(dim, 0.1f);
+    auto brute_force = [&](const roaring::Roaring& candidates, size_t k) {
+        std::vector<std::pair<float, rowid_t>> distances;
+        for (rowid_t row : candidates) {
+            distances.emplace_back(vector_l2_distance(query.data(), vectors[row].data(), dim), row);
+        }
+        std::sort(distances.begin(), distances.end());
+        std::vector<rowid_t> rows;
+        for (size_t i = 0; i < k; i++) {
+            rows.push_back(distances[i].second);
+        }
+        return rows;
+    };
+    auto rows_of = [](const std::vector<std::pair<rowid_t, float>>& result) {
+        std::vector<rowid_t> rows;
+        for (const auto& [row, distance] : result) {
+            rows.push_back(row);
+        }
+        return rows;
+    };
+
+    // probing all the lists is exact
+    std::vector<std::pair<rowid_t, float>> result;
+    ASSERT_OK(reader->search(query, 10, 16, all, &result));
+    ASSERT_EQ(brute_force(all, 10), rows_of(result));
+    for (size_t i = 1; i < result.size(); i++) {
+        ASSERT_LE(result[i - 1].second, result[i].second);
+    }
+
+    // a selective filter probes more lists until k rows are found
+    roaring::Roaring even;
+    for (rowid_t row : all) {
+        if (row % 2 == 0) {
+            even.add(row);
+        }
+    }
+    ASSERT_OK(reader->search(query, 10, 1, even, &result));
+    ASSERT_EQ(10, result.size());
+    for (const auto& [row, distance] : result) {
+        ASSERT_TRUE(even.contains(row));
+    }
+
+    ASSERT_OK(reader->search(query, 2000, 1, all, &result));
+    ASSERT_EQ(990, result.size());
+
+    ASSERT_TRUE(reader->search(std::vector<float>(dim + 1), 10, 1, all, &result).is_invalid_argument());
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorIndexTest, test_cosine_search) {
+    auto reader = build(make_index(2, VECTOR_METRIC_COSINE_SIMILARITY, 2),
+                        {{1, 0}, {0, 3}, {10, 1}, {-1, 0}, {2, 2}, {}});
+    ASSERT_EQ(VectorIndexMetric::COSINE_SIMILARITY, reader->metric());
+
+    std::vector<std::pair<rowid_t, float>> result;
+    ASSERT_OK(reader->search({5, 0}, 3, 2, roaring::Roaring::bitmapOf(6, 0, 1, 2, 3, 4, 5), &result));
+    ASSERT_EQ(3, result.size());
+    // the length of the vectors does not matter
+    ASSERT_EQ(0, result[0].first);
+    ASSERT_NEAR(0, result[0].second, 1e-6);
+    ASSERT_EQ(2, result[1].first);
+    ASSERT_EQ(4, result[2].first);
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorIndexTest, test_bad_vectors) {
+    auto writer = VectorIndexWriter::create(make_index(2, VECTOR_METRIC_L2_DISTANCE, 0), _index_dir + "/0_0_2.vi");
+    ASSERT_TRUE(writer.ok());
+    ASSERT_TRUE(writer.value()->append(*make_column({{1, 2, 3}})).is_invalid_argument());
+
+    TabletIndex no_dim;
+    ASSERT_FALSE(VectorIndexWriter::create(no_dim, _index_dir + "/0_0_3.vi").ok());
+    ASSERT_FALSE(VectorIndexWriter::create(make_index(2, "hamming", 0), _index_dir + "/0_0_4.vi").ok());
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorIndexTest, test_segment_without_index_file) {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    schema_pb.set_num_short_key_columns(1);
+    auto* k = schema_pb.add_column();
+    k->set_unique_id(0);
+    k->set_name("k");
+    k->set_type("INT");
+    k->set_is_key(true);
+    k->set_is_nullable(false);
+    k->set_length(4);
+    k->set_index_length(4);
+    k->set_aggregation("NONE");
+    auto* v = schema_pb.add_column();
+    v->set_unique_id(1);
+    v->set_name("v");
+    v->set_type("ARRAY");
+    v->set_is_key(false);
+    v->set_is_nullable(true);
+    v->set_aggregation("NONE");
+    auto* element = v->add_children_columns();
+    element->set_unique_id(2);
+    element->set_name("element");
+    element->set_type("FLOAT");
+    element->set_is_nullable(true);
+    element->set_length(4);
+    auto* index_pb = schema_pb.add_table_indices();
+    index_pb->set_index_id(1);
+    index_pb->set_index_name("vector_index");
+    index_pb->set_index_type(VECTOR);
+    index_pb->add_col_unique_id(1);
+    std::map<std::string, std::map<std::string, std::string>> properties;
+    properties["index_properties"] = {{VECTOR_INDEX_DIM_KEY, "2"},
+                                      {VECTOR_INDEX_METRIC_TYPE_KEY, VECTOR_METRIC_L2_DISTANCE},
+                                      {VECTOR_INDEX_NLIST_KEY, "4"}};
+    index_pb->set_index_properties(to_json(properties));
+    auto tablet_schema = std::make_shared<const TabletSchema>(schema_pb);
+
+    RowsetId rowset_id;
+    rowset_id.init(2, 1, 0, 0);
+    const std::string segment_path = _index_dir + "/" + rowset_id.to_string() + "_0.dat";
+    ASSIGN_OR_ABORT(auto seg_fs, FileSystem::CreateSharedFromString(segment_path));
+    const size_t num_rows = 100;
+    {
+        SegmentWriterOptions opts;
+        opts.segment_file_mark.rowset_path_prefix = _index_dir;
+        opts.segment_file_mark.rowset_id = rowset_id.to_string();
+        ASSIGN_OR_ABORT(auto wfile, seg_fs->new_writable_file(segment_path));
+        SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+        ASSERT_OK(writer.init());
+        auto chunk = ChunkHelper::new_chunk(ChunkHelper::convert_schema(tablet_schema), num_rows);
+        for (int i = 0; i < num_rows; i++) {
+            chunk->columns()[0]->append_datum(Datum(i));
+            chunk->columns()[1]->append_datum(Datum(DatumArray{Datum(float(i)), Datum(float(i))}));
+        }
+        ASSERT_OK(writer.append_chunk(*chunk));
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        uint64_t footer_position = 0;
+        ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+    }
+
+    auto search = std::make_shared<VectorSearchOption>();
+    search->column_unique_id = 1;
+    search->query_vector = {0, 0};
+    search->k = 3;
+    // Opens the segment anew, since the index is loaded once by the column reader.
+    auto read_rows = [&]() -> size_t {
+        auto segment = *Segment::open(seg_fs, FileInfo{segment_path}, 0, tablet_schema);
+        OlapReaderStatistics stats;
+        SegmentReadOptions seg_options;
+        seg_options.fs = seg_fs;
+        seg_options.stats = &stats;
+        seg_options.rowset_path = _index_dir;
+        seg_options.rowsetid = rowset_id;
+        seg_options.vector_search_option = search;
+        auto schema = ChunkHelper::convert_schema(tablet_schema);
+        auto iter = segment->new_iterator(schema, seg_options);
+        EXPECT_OK(iter.status());
+        auto chunk = ChunkHelper::new_chunk(schema, num_rows);
+        size_t rows = 0;
+        while (true) {
+            chunk->reset();
+            auto st = iter.value()->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            EXPECT_OK(st);
+            rows += chunk->num_rows();
+        }
+        return rows;
+    };
+
+    const auto index_path = IndexDescriptor::vector_index_file_path(_index_dir, rowset_id.to_string(), 0, 1);
+    ASSERT_TRUE(fs::path_exist(index_path));
+    ASSERT_EQ(3, read_rows());
+
+    // e.g. a replica cloned before the index files were copied
+    ASSERT_OK(fs::remove(index_path));
+    ASSERT_EQ(num_rows, read_rows());
+}
+
+} // namespace starrocks
@@ -1048,6 +1048,36 @@ std::string convert_bitmap_to_string(BitmapValue& bitmap) {
     return buf;
 }
 
+TEST_F(BitmapValueTest, fast_union) {
+    // values above 2^32 land in a different partition of the 64-bit bitmap
+    const uint64_t high = (1ull << 32) + 5;
+    BitmapValue bitmap1 = gen_bitmap(0, 100);
+    BitmapValue bitmap2 = gen_bitmap(50, 200);
+    bitmap2.add(high);
+    BitmapValue bitmap3 = gen_bitmap(high, high + 100);
+    BitmapValue single(1000);
+    BitmapValue set = gen_bitmap(2000, 2010);
+    std::vector<const BitmapValue*> values = {&bitmap1, &_empty_bitmap, &bitmap2, &single, &bitmap3, &set};
+
+    for (BitmapValue init : {BitmapValue(), BitmapValue(7), gen_bitmap(3000, 3010), gen_bitmap(5000, 5040)}) {
+        BitmapValue actual = init;
+        actual.fast_union(values);
+        BitmapValue want = init;
+        for (const auto* value : values) {
+            want |= *value;
+        }
+        ASSERT_EQ(BitmapDataType::BITMAP, actual.type());
+        ASSERT_EQ(want.to_string(), actual.to_string());
+    }
+    BitmapValue actual;
+    actual.fast_union(values);
+    ASSERT_EQ(200 + 100 + 1 + 10, actual.cardinality());
+
+    // the inputs are untouched
+    check_bitmap(BitmapDataType::BITMAP, bitmap1, 0, 100);
+    ASSERT_EQ(151, bitmap2.cardinality());
+}
+
 TEST(BitmapValueTest1, bitmap_serde) {
     bool use_v1 = config::bitmap_serialize_version == 1;
     BitmapTypeCode::type type_bitmap32 = BitmapTypeCode::BITMAP32_SERIV2;
@@ -24,6 +24,7 @@
 
 #define ARROW_UTIL_LOGGING_H
 #include <arrow/buffer.h>
+#include <arrow/c/bridge.h>
 #include <arrow/json/api.h>
 #include <arrow/result.h>
 
@@ -33,7 +34,9 @@ DIAGNOSTIC_IGNORE("-Wclass-memaccess")
 #include <arrow/json/test_common.h>
 DIAGNOSTIC_POP
 
+#include <arrow/io/memory.h>
 #include <arrow/ipc/json_simple.h>
+#include <arrow/ipc/reader.h>
 #include <arrow/memory_pool.h>
 #include <arrow/pretty_print.h>
 #include <column/chunk.h>
@@ -41,8 +44,11 @@ DIAGNOSTIC_POP
 #include <exec/arrow_type_traits.h>
 
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "runtime/large_int_value.h"
 #include "storage/tablet_schema_helper.h"
+#include "util/arrow/row_batch.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 struct StarRocksColumnToArrowTest : public testing::Test {};
@@ -836,4 +842,96 @@ TEST_F(StarRocksColumnToArrowTest, testNestedArrayStructMap) {
     ASSERT_TRUE(expect_array->Equals(array));
 }
 
+TEST_F(StarRocksColumnToArrowTest, testZeroCopyExport) {
+    auto int_column = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto str_column = BinaryColumn::create();
+    for (int i = 0; i < 100; ++i) {
+        if (i % 7 == 0) {
+            int_column->append_nulls(1);
+        } else {
+            int_column->append_datum(Datum(i));
+        }
+        str_column->append(Slice(std::to_string(i)));
+    }
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(int_column, SlotId(0));
+    chunk->append_column(str_column, SlotId(1));
+
+    TypeDescriptor int_type(TYPE_INT);
+    auto str_type = TypeDescriptor::create_varchar_type(100);
+    auto arrow_schema = arrow::schema({arrow::field("c0", arrow::int32(), true), arrow::field("c1", arrow::utf8())});
+    std::vector<const TypeDescriptor*> slot_types{&int_type, &str_type};
+    std::vector<SlotId> slot_ids{SlotId(0), SlotId(1)};
+    auto memory_pool = arrow::MemoryPool::CreateDefault();
+
+    config::enable_arrow_zero_copy_export = true;
+    DeferOp defer([]() { config::enable_arrow_zero_copy_export = false; });
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ASSERT_TRUE(
+            convert_chunk_to_arrow_batch(chunk.get(), slot_types, slot_ids, arrow_schema, memory_pool.get(), &batch)
+                    .ok());
+
+    auto* int_array = down_cast<arrow::Int32Array*>(batch->column(0).get());
+    auto* str_array = down_cast<arrow::StringArray*>(batch->column(1).get());
+    // the values are not copied
+    ASSERT_EQ(reinterpret_cast<const int32_t*>(int_array->values()->data()),
+              down_cast<Int32Column*>(int_column->data_column().get())->get_data().data());
+    ASSERT_EQ(str_array->value_data()->data(), str_column->get_bytes().data());
+    ASSERT_EQ(15, int_array->null_count());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i % 7 != 0, int_array->IsValid(i));
+        if (i % 7 != 0) {
+            ASSERT_EQ(i, int_array->Value(i));
+        }
+        ASSERT_EQ(std::to_string(i), str_array->GetString(i));
+    }
+
+    // the exported arrays keep the columns alive after the chunk is released
+    struct ArrowArray c_array;
+    struct ArrowSchema c_schema;
+    ASSERT_TRUE(export_chunk_to_arrow_c_data(chunk.get(), slot_types, slot_ids, arrow_schema, memory_pool.get(),
+                                             &c_array, &c_schema)
+                        .ok());
+    chunk.reset();
+    int_column.reset();
+    str_column.reset();
+    auto imported = arrow::ImportRecordBatch(&c_array, &c_schema);
+    ASSERT_TRUE(imported.ok());
+    ASSERT_TRUE((*imported)->Equals(*batch));
+}
+
+TEST_F(StarRocksColumnToArrowTest, testSerializeRecordBatch) {
+    auto int_column = Int64Column::create();
+    auto str_column = BinaryColumn::create();
+    for (int i = 0; i < 1000; ++i) {
+        int_column->append(i);
+        str_column->append(Slice(std::string(i % 13, 'x')));
+    }
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(int_column, SlotId(0));
+    chunk->append_column(str_column, SlotId(1));
+
+    TypeDescriptor int_type(TYPE_BIGINT);
+    auto str_type = TypeDescriptor::create_varchar_type(100);
+    auto arrow_schema = arrow::schema({arrow::field("c0", arrow::int64()), arrow::field("c1", arrow::utf8())});
+    std::vector<const TypeDescriptor*> slot_types{&int_type, &str_type};
+    std::vector<SlotId> slot_ids{SlotId(0), SlotId(1)};
+    auto memory_pool = arrow::MemoryPool::CreateDefault();
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ASSERT_TRUE(
+            convert_chunk_to_arrow_batch(chunk.get(), slot_types, slot_ids, arrow_schema, memory_pool.get(), &batch)
+                    .ok());
+
+    std::string serialized;
+    ASSERT_TRUE(serialize_record_batch(*batch, &serialized).ok());
+
+    auto input = std::make_shared<arrow::io::BufferReader>(arrow::Buffer::FromString(serialized));
+    auto reader = arrow::ipc::RecordBatchStreamReader::Open(input);
+    ASSERT_TRUE(reader.ok());
+    std::shared_ptr<arrow::RecordBatch> read_batch;
+    ASSERT_OK((*reader)->ReadNext(&read_batch));
+    ASSERT_TRUE(read_batch != nullptr);
+    ASSERT_TRUE(read_batch->Equals(*batch));
+}
+
 } // namespace starrocks
@@ -14,6 +14,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <random>
+#include <utility>
+
 #include "util/bit_packing.inline.h"
 
 namespace starrocks {
@@ -53,6 +57,36 @@ TEST(BitPacking, Unpack32Values) {
     }
 }
 
+template <typename OutType, int BIT_WIDTH>
+static void check_unpack32_values(const uint8_t* data, int64_t in_bytes) {
+    OutType result[32];
+    const uint8_t* pos = BitPacking::Unpack32Values<OutType, BIT_WIDTH>(data, in_bytes, result);
+    ASSERT_EQ(pos, data + BIT_WIDTH * 32 / 8);
+    for (int i = 0; i < 32; i++) {
+        uint64_t word = 0;
+        memcpy(&word, data + i * BIT_WIDTH / 8, std::min<int64_t>(8, in_bytes - i * BIT_WIDTH / 8));
+        const uint64_t expected = (word >> (i * BIT_WIDTH % 8)) & ((1UL << BIT_WIDTH) - 1);
+        ASSERT_EQ(static_cast<OutType>(expected), result[i]) << "bit width " << BIT_WIDTH << ", value " << i;
+    }
+}
+
+template <int... BIT_WIDTHS>
+static void check_unpack32_values(std::integer_sequence<int, BIT_WIDTHS...>, const uint8_t* data, int64_t in_bytes) {
+    // With only the bytes of the batch, the values are unpacked by the scalar code.
+    (check_unpack32_values<uint32_t, BIT_WIDTHS + 1>(data, BitUtil::RoundUpNumBytes(32 * (BIT_WIDTHS + 1))), ...);
+    (check_unpack32_values<uint32_t, BIT_WIDTHS + 1>(data, in_bytes), ...);
+    (check_unpack32_values<uint16_t, std::min(BIT_WIDTHS + 1, 16)>(data, in_bytes), ...);
+}
+
+TEST(BitPacking, Unpack32ValuesAllBitWidths) {
+    uint8_t data[BitPacking::MAX_BITWIDTH * 32 / 8];
+    std::mt19937 rng(0);
+    for (unsigned char& i : data) {
+        i = rng();
+    }
+    check_unpack32_values(std::make_integer_sequence<int, 32>(), data, sizeof(data));
+}
+
 TEST(BitPacking, UnpackUpTo31Values) {
     uint8_t data[4 * 15];
     for (unsigned char& i : data) {
@@ -39,7 +39,9 @@
 #include <iostream>
 #include <thread>
 
+#include "common/config.h"
 #include "gen_cpp/segment.pb.h"
+#include "util/defer_op.h"
 #include "util/faststring.h"
 #include "util/random.h"
 #include "util/raw_container.h"
@@ -224,6 +226,40 @@ TEST_F(BlockCompressionTest, multi) {
     test_multi_slices(starrocks::CompressionTypePB::GZIP);
 }
 
+TEST_F(BlockCompressionTest, zstd_multithread) {
+    const int32_t workers = config::zstd_compress_workers;
+    const int64_t min_block_bytes = config::zstd_multithread_min_block_bytes;
+    config::zstd_compress_workers = 4;
+    config::zstd_multithread_min_block_bytes = 1024 * 1024;
+    DeferOp defer([&]() {
+        config::zstd_compress_workers = workers;
+        config::zstd_multithread_min_block_bytes = min_block_bytes;
+    });
+
+    const BlockCompressionCodec* codec = nullptr;
+    ASSERT_TRUE(get_block_compression_codec(starrocks::CompressionTypePB::ZSTD, &codec).ok());
+    // a small block and a large one, in one slice and in several slices
+    for (int len : {1024, 1024 * 1024}) {
+        std::vector<std::string> strs{random_string(len), random_string(len), random_string(len)};
+        std::vector<Slice> slices(strs.begin(), strs.end());
+        std::string orig = strs[0] + strs[1] + strs[2];
+
+        for (bool multi_slices : {false, true}) {
+            faststring compressed;
+            compressed.resize(codec->max_compressed_len(orig.size()));
+            Slice compressed_slice(compressed);
+            auto st = multi_slices ? codec->compress(slices, &compressed_slice)
+                                   : codec->compress(Slice(orig), &compressed_slice);
+            ASSERT_TRUE(st.ok()) << st;
+
+            std::string uncompressed(orig.size(), '\0');
+            Slice uncompressed_slice(uncompressed);
+            ASSERT_TRUE(codec->decompress(compressed_slice, &uncompressed_slice).ok());
+            ASSERT_EQ(orig, uncompressed_slice.to_string());
+        }
+    }
+}
+
 TEST_F(BlockCompressionTest, test_issue_10721) {
     std::string str = random_string(1024);
     const BlockCompressionCodec* codec = nullptr;
@@ -0,0 +1,70 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/cpu_info.h"
+
+#include <gtest/gtest.h>
+#include <sched.h>
+
+#include <thread>
+
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+TEST(CpuInfoTest, test_bind_current_thread_to_numa_node) {
+    CpuInfo::init();
+    const int num_cores = CpuInfo::get_max_num_cores();
+    if (num_cores < 2) {
+        GTEST_SKIP() << "needs at least 2 cores";
+    }
+    const int saved_num_numa_nodes = CpuInfo::get_max_num_numa_nodes();
+    std::vector<int> saved_core_to_numa_node;
+    for (int core = 0; core < num_cores; ++core) {
+        saved_core_to_numa_node.push_back(CpuInfo::get_numa_node_of_core(core));
+    }
+    DeferOp restore([&] { CpuInfo::init_fake_numa_for_test(saved_num_numa_nodes, saved_core_to_numa_node); });
+
+    // The affinity is changed in another thread, which leaves the one of the test thread as it is.
+    std::thread thread([&] {
+        cpu_set_t cores;
+        CPU_ZERO(&cores);
+        ASSERT_EQ(0, sched_getaffinity(0, sizeof(cores), &cores));
+        int allowed_core = 0;
+        while (!CPU_ISSET(allowed_core, &cores)) {
+            ++allowed_core;
+        }
+        // Only the allowed core is on node 0.
+        std::vector<int> core_to_numa_node(num_cores, 1);
+        core_to_numa_node[allowed_core] = 0;
+        CpuInfo::init_fake_numa_for_test(2, core_to_numa_node);
+
+        ASSERT_TRUE(CpuInfo::bind_current_thread_to_numa_node(0));
+        ASSERT_EQ(0, sched_getaffinity(0, sizeof(cores), &cores));
+        ASSERT_EQ(1, CPU_COUNT(&cores));
+        ASSERT_TRUE(CPU_ISSET(allowed_core, &cores));
+        ASSERT_EQ(allowed_core, CpuInfo::get_current_core());
+        ASSERT_EQ(0, CpuInfo::get_current_numa_node());
+
+        // No core of node 1 is allowed any more, so the affinity is left unchanged.
+        ASSERT_FALSE(CpuInfo::bind_current_thread_to_numa_node(1));
+        ASSERT_FALSE(CpuInfo::bind_current_thread_to_numa_node(2));
+        ASSERT_EQ(0, sched_getaffinity(0, sizeof(cores), &cores));
+        ASSERT_EQ(1, CPU_COUNT(&cores));
+        ASSERT_TRUE(CPU_ISSET(allowed_core, &cores));
+    });
+    thread.join();
+}
+
+} // namespace starrocks
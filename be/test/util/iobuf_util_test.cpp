@@ -0,0 +1,58 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/iobuf_util.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(IOBufUtilTest, test_append_string_without_copy) {
+    std::string str(1024 * 1024, 'a');
+    str[0] = 'b';
+    const char* data = str.data();
+    const size_t num_held_strings = iobuf_num_held_strings();
+
+    butil::IOBuf buf;
+    buf.append("head", 4);
+    ASSERT_EQ(str.capacity(), iobuf_append_string_without_copy(&buf, std::move(str)));
+    ASSERT_EQ(4 + 1024 * 1024, buf.size());
+    ASSERT_EQ(num_held_strings + 1, iobuf_num_held_strings());
+    // The block references the memory of the string.
+    ASSERT_EQ(2, buf.backing_block_num());
+    ASSERT_EQ(data, buf.backing_block(1).data());
+
+    {
+        butil::IOBuf copied = buf;
+        buf.clear();
+        ASSERT_EQ(num_held_strings + 1, iobuf_num_held_strings());
+
+        butil::IOBuf head;
+        copied.cutn(&head, 4);
+        ASSERT_EQ("head", head.to_string());
+        std::string content = copied.to_string();
+        ASSERT_EQ('b', content[0]);
+        ASSERT_EQ(std::string(1024 * 1024 - 1, 'a'), content.substr(1));
+    }
+    // The string is released with the last IOBuf referencing it.
+    ASSERT_EQ(num_held_strings, iobuf_num_held_strings());
+}
+
+TEST(IOBufUtilTest, test_append_empty_string) {
+    butil::IOBuf buf;
+    ASSERT_EQ(0, iobuf_append_string_without_copy(&buf, std::string()));
+    ASSERT_TRUE(buf.empty());
+}
+
+} // namespace starrocks
@@ -36,6 +36,8 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <thread>
 #include <vector>
 
 using namespace starrocks;
@@ -272,6 +274,171 @@ TEST_F(CacheTest, Usage) {
     ASSERT_EQ(950, cache.get_usage());
 }
 
+static int lookup_LRUCache(LRUCache& cache, const CacheKey& key) {
+    uint32_t hash = key.hash(key.data(), key.size(), 0);
+    Cache::Handle* handle = cache.lookup(key, hash);
+    if (handle == nullptr) {
+        return -1;
+    }
+    int value = DecodeValue(reinterpret_cast<LRUHandle*>(handle)->value);
+    cache.release(handle);
+    return value;
+}
+
+// Returns the number of the hot entries kept in the cache after a large scan.
+static int scan_after_hot_entries(CachePolicy policy) {
+    LRUCache cache;
+    cache.set_policy(policy);
+    cache.set_capacity(100);
+
+    std::vector<std::string> hot_keys;
+    for (int i = 0; i < 50; i++) {
+        hot_keys.emplace_back("hot_" + std::to_string(i));
+        insert_LRUCache(cache, CacheKey(hot_keys.back()), 1, CachePriority::NORMAL);
+    }
+    for (int round = 0; round < 5; round++) {
+        for (const auto& key : hot_keys) {
+            lookup_LRUCache(cache, CacheKey(key));
+        }
+    }
+    for (int i = 0; i < 1000; i++) {
+        std::string key = "scan_" + std::to_string(i);
+        insert_LRUCache(cache, CacheKey(key), 1, CachePriority::NORMAL);
+    }
+    EXPECT_LE(cache.get_usage(), 100);
+
+    int num_hot = 0;
+    for (const auto& key : hot_keys) {
+        num_hot += lookup_LRUCache(cache, CacheKey(key)) == 1;
+    }
+    if (policy == CachePolicy::TINY_LFU) {
+        EXPECT_GT(cache.get_rejected_count(), 0);
+    } else {
+        EXPECT_EQ(0, cache.get_rejected_count());
+    }
+    return num_hot;
+}
+
+TEST_F(CacheTest, TinyLFUScanResistance) {
+    ASSERT_EQ(0, scan_after_hot_entries(CachePolicy::LRU));
+    ASSERT_EQ(50, scan_after_hot_entries(CachePolicy::TINY_LFU));
+}
+
+TEST_F(CacheTest, PinnedEntriesDetached) {
+    for (auto policy : {CachePolicy::LRU, CachePolicy::TINY_LFU}) {
+        LRUCache cache;
+        cache.set_policy(policy);
+        cache.set_capacity(10);
+
+        std::vector<std::string> pinned_keys;
+        std::vector<Cache::Handle*> handles;
+        for (int i = 0; i < 10; i++) {
+            pinned_keys.emplace_back("pinned_" + std::to_string(i));
+            CacheKey key(pinned_keys.back());
+            handles.push_back(cache.insert(key, key.hash(key.data(), key.size(), 0), EncodeValue(i), 1, &deleter));
+        }
+        // The pinned entries are taken off the lists by the first eviction, and the scanned ones are evicted.
+        for (int i = 0; i < 100; i++) {
+            insert_LRUCache(cache, CacheKey("scan_" + std::to_string(i)), 1, CachePriority::NORMAL);
+        }
+        ASSERT_EQ(11, cache.get_usage());
+        for (int i = 0; i < 10; i++) {
+            ASSERT_EQ(i, lookup_LRUCache(cache, CacheKey(pinned_keys[i])));
+        }
+
+        // Releasing puts the entries back without evicting, and the next insert evicts.
+        for (auto* handle : handles) {
+            cache.release(handle);
+        }
+        ASSERT_EQ(11, cache.get_usage());
+        insert_LRUCache(cache, CacheKey("scan_100"), 1, CachePriority::NORMAL);
+        ASSERT_EQ(10, cache.get_usage());
+
+        ASSERT_GT(cache.prune(), 0);
+        ASSERT_EQ(0, cache.get_usage());
+    }
+}
+
+TEST_F(CacheTest, TinyLFUUsage) {
+    Cache* cache = new_lru_cache(kCacheSize, ChargeMode::VALUESIZE, CachePolicy::TINY_LFU);
+    std::swap(cache, _cache);
+    Insert(100, 101, 1);
+    ASSERT_EQ(101, Lookup(100));
+    Insert(100, 102, 1);
+    ASSERT_EQ(102, Lookup(100));
+    ASSERT_EQ(1, _deleted_keys.size());
+
+    for (int i = 0; i < 4 * kCacheSize; i++) {
+        Insert(1000 + i, 2000 + i, 1 + i % 10);
+        ASSERT_LE(_cache->get_memory_usage(), kCacheSize + 10 * kNumShards);
+    }
+    // The durable entry is evicted at last.
+    InsertDurable(200, 201, 1);
+    for (int i = 0; i < 2 * kCacheSize; i++) {
+        Insert(10000000 + i, 1, 1);
+    }
+    ASSERT_EQ(201, Lookup(200));
+
+    Erase(200);
+    ASSERT_EQ(-1, Lookup(200));
+    _cache->prune();
+    ASSERT_EQ(0, _cache->get_memory_usage());
+    std::swap(cache, _cache);
+    delete cache;
+}
+
+TEST(FrequencySketchTest, frequency) {
+    FrequencySketch sketch;
+    sketch.increment(1);
+    ASSERT_EQ(0, sketch.frequency(1));
+
+    sketch.ensure_capacity(64);
+    ASSERT_EQ(64, sketch.capacity());
+    for (int i = 0; i < 20; i++) {
+        sketch.increment(1);
+    }
+    sketch.increment(2);
+    ASSERT_EQ(FrequencySketch::kMaxFrequency, sketch.frequency(1));
+    ASSERT_GE(sketch.frequency(2), 1);
+    ASSERT_LE(sketch.frequency(3), 1);
+
+    // The counters are halved after 10 * 64 increments.
+    for (uint32_t i = 0; i < 10 * 64; i++) {
+        sketch.increment(1000 + i);
+    }
+    ASSERT_LT(sketch.frequency(1), FrequencySketch::kMaxFrequency);
+    ASSERT_GE(sketch.frequency(1), FrequencySketch::kMaxFrequency / 4);
+}
+
+TEST_F(CacheTest, ConcurrentLookup) {
+    for (auto policy : {CachePolicy::LRU, CachePolicy::TINY_LFU}) {
+        std::unique_ptr<Cache> cache(new_lru_cache(kNumShards * 10, ChargeMode::VALUESIZE, policy));
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; t++) {
+            threads.emplace_back([&, t]() {
+                for (int i = 0; i < 100000; i++) {
+                    std::string result;
+                    CacheKey key = EncodeKey(&result, (i * 7 + t) % (kNumShards * 20));
+                    Cache::Handle* handle = cache->lookup(key);
+                    if (handle == nullptr) {
+                        handle = cache->insert(key, EncodeValue(i), 1, [](const CacheKey& key, void* v) {});
+                    }
+                    cache->release(handle);
+                    if (i % 1000 == 0) {
+                        cache->erase(key);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        ASSERT_GT(cache->get_hit_count(), 0);
+        cache->prune();
+        ASSERT_EQ(0, cache->get_memory_usage());
+    }
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     // Add a bunch of light and heavy entries and then count the combined
     // size of items still in the cache, which must be approximately the
@@ -328,7 +495,7 @@ TEST_F(CacheTest, SetCapacity) {
     // Test2: decrease capacity
     // insert more elements to cache, then release 32,
     // then decrease capacity to 32, final capacity should be 32.
-    // then release 32, usage should be 32.
+    // then release 32, and the entries over the capacity are evicted by the next resize instead of the releases.
     for (int i = 32; i < 64; i++) {
         std::string result;
         handles[i] = _cache->insert(EncodeKey(&result, i), EncodeValue(1000 + kCacheSize), 1, &CacheTest::Deleter);
@@ -345,6 +512,8 @@ TEST_F(CacheTest, SetCapacity) {
     for (int i = 32; i < 64; i++) {
         _cache->release(handles[i]);
     }
+    ASSERT_GE(_cache->get_memory_usage(), 32);
+    _cache->set_capacity(32);
     ASSERT_EQ(32, _cache->get_memory_usage());
 }
 
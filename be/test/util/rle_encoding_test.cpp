@@ -38,6 +38,7 @@
 #include <cstring>
 #include <limits>
 #include <ostream>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -478,6 +479,36 @@ TEST_F(TestRle, TestBatch) {
     ASSERT_EQ(1024, n);
 }
 
+TEST_F(TestRle, TestGetBatchOfLiterals) {
+    for (int bit_width = 1; bit_width <= 32; bit_width++) {
+        faststring buffer;
+        RleEncoder<uint32_t> encoder(&buffer, bit_width);
+        std::mt19937 rng(bit_width);
+        std::vector<uint32_t> values;
+        for (int i = 0; i < 4000; ++i) {
+            // Mixes the literal runs with some repeated runs.
+            uint32_t value = rng() & ((1UL << bit_width) - 1);
+            int run_length = i % 100 == 0 ? 20 : 1;
+            for (int j = 0; j < run_length; j++) {
+                values.push_back(value);
+                encoder.Put(value);
+            }
+        }
+        encoder.Flush();
+
+        // The batches of different sizes start from the middle of the literal runs.
+        RleDecoder<uint32_t> decoder(buffer.data(), buffer.size(), bit_width);
+        std::vector<uint32_t> to_check(values.size());
+        size_t pos = 0;
+        for (size_t batch = 1; pos < values.size(); batch = batch % 97 + 5) {
+            size_t n = std::min(batch, values.size() - pos);
+            ASSERT_EQ(n, decoder.GetBatch(&to_check[pos], n));
+            pos += n;
+        }
+        ASSERT_EQ(values, to_check) << "bit width " << bit_width;
+    }
+}
+
 TEST_F(TestRle, TestGetBatchWithDict) {
     faststring buffer;
     RleEncoder<int> encoder(&buffer, 16);
@@ -499,6 +530,27 @@ TEST_F(TestRle, TestGetBatchWithDict) {
     ASSERT_EQ(1024, n);
 }
 
+TEST_F(TestRle, TestGetBatchWithInt64Dict) {
+    faststring buffer;
+    RleEncoder<uint32_t> encoder(&buffer, 10);
+    std::vector<int64_t> dict;
+    for (int i = 0; i < 1000; i++) {
+        dict.push_back(i * 1000000007L);
+    }
+    std::vector<int64_t> values;
+    for (int i = 0; i < 4099; ++i) {
+        uint32_t index = i * 7 % dict.size();
+        values.push_back(dict[index]);
+        encoder.Put(index);
+    }
+    encoder.Flush();
+
+    RleBatchDecoder<uint32_t> decoder(buffer.data(), buffer.size(), 10);
+    std::vector<int64_t> to_check(values.size());
+    ASSERT_EQ(values.size(), decoder.GetBatchWithDict(dict.data(), dict.size(), to_check.data(), values.size()));
+    ASSERT_EQ(values, to_check);
+}
+
 TEST_F(TestRle, TestGetBatchWithDictOutOfRange) {
     faststring buffer;
     RleEncoder<int> encoder(&buffer, 16);
@@ -19,6 +19,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 #include "common/logging.h"
 #include "gen_cpp/RuntimeProfile_types.h"
 
@@ -581,4 +584,28 @@ TEST(TestRuntimeProfile, testUpdateWithOldAndNewProfile) {
     ASSERT_EQ(2, child_profile->get_version());
 }
 
+TEST(TestRuntimeProfile, testScopedCycleTimer) {
+    { ScopedCycleTimer timer(nullptr, 1); }
+
+    int64_t cycles = 0;
+    {
+        ScopedCycleTimer timer(&cycles, 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_GT(cycles, 0);
+
+    // the cycles of a sampled call are multiplied by the sampling interval
+    int64_t scaled_cycles = 0;
+    {
+        ScopedCycleTimer timer(&scaled_cycles, 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(0, scaled_cycles);
+    {
+        ScopedCycleTimer timer(&scaled_cycles, 8);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_GT(scaled_cycles, 0);
+}
+
 } // namespace starrocks
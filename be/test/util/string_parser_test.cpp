@@ -251,6 +251,23 @@ TEST(StringToInt, Limit) {
                             StringParser::PARSE_SUCCESS);
 }
 
+TEST(StringToInt, EightDigitBlocks) {
+    test_int_value<int32_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("-098765432", -98765432, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("123456789012345678", 123456789012345678, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("-900000000000000009", -900000000000000009, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("12345678901", 12345678901, StringParser::PARSE_SUCCESS);
+
+    // a non-digit inside a block
+    test_int_value<int64_t>("1234567x9012", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("12345678 9012", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("1234:678901", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("1234/678901", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("1\xff"
+                            "3456789",
+                            0, StringParser::PARSE_FAILURE);
+}
+
 TEST(StringToUnsignedInt, Basic) {
     test_unsigned_int_value<uint8_t>("123", 123, StringParser::PARSE_SUCCESS);
     test_unsigned_int_value<uint16_t>("123", 123, StringParser::PARSE_SUCCESS);
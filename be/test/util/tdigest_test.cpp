@@ -125,6 +125,35 @@ TEST_F(TDigestTest, SingleValue) {
     EXPECT_NEAR(value, digest.quantile(1.0), 0.001f);
 }
 
+TEST_F(TDigestTest, BulkAdd) {
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(0, 1000);
+    std::vector<Value> values;
+    for (int i = 0; i < 5000; i++) {
+        values.push_back(i % 97 == 0 ? NAN : dist(gen));
+    }
+
+    TDigest digest(100);
+    TDigest bulk_digest(100);
+    size_t offset = 0;
+    for (size_t batch : {1, 7, 799, 800, 801, 2592}) {
+        for (size_t i = offset; i < offset + batch; i++) {
+            digest.add(values[i]);
+        }
+        bulk_digest.add(values.data() + offset, batch);
+        offset += batch;
+    }
+    ASSERT_EQ(values.size(), offset);
+
+    ASSERT_EQ(digest.serialize_size(), bulk_digest.serialize_size());
+    std::vector<uint8_t> buf(digest.serialize_size());
+    std::vector<uint8_t> bulk_buf(bulk_digest.serialize_size());
+    digest.serialize(buf.data());
+    bulk_digest.serialize(bulk_buf.data());
+    ASSERT_EQ(buf, bulk_buf);
+    EXPECT_EQ(digest.quantile(0.99), bulk_digest.quantile(0.99));
+}
+
 TEST_F(TDigestTest, FewValues) {
     // When there are few values in the tree, quantiles should be exact
     TDigest digest(1000);
@@ -325,6 +325,74 @@ TEST_F(ThreadPoolTest, TestMaxQueueSize) {
     _pool->shutdown();
 }
 
+TEST_F(ThreadPoolTest, TestWorkStealing) {
+    ASSERT_TRUE(rebuild_pool_with_builder(ThreadPoolBuilder(kDefaultPoolName)
+                                                  .set_min_threads(0)
+                                                  .set_max_threads(4)
+                                                  .set_work_stealing(true))
+                        .ok());
+
+    // tasks submitted by other threads and by the workers themselves
+    std::atomic<int32_t> counter(0);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(_pool->submit_func([&]() {
+                             for (int j = 0; j < 10; j++) {
+                                 CHECK(_pool->submit_func(std::bind(&simple_task_method, 10, &counter)).ok());
+                             }
+                         })
+                            .ok());
+    }
+    _pool->wait();
+    ASSERT_EQ(100 * 10 * 10, counter.load());
+    ASSERT_EQ(0, _pool->num_queued_tasks());
+    ASSERT_LE(_pool->num_threads(), 4);
+
+    // the tasks of a serial token are still run one at a time, in order
+    std::unique_ptr<ThreadPoolToken> t = _pool->new_token(ThreadPool::ExecutionMode::SERIAL);
+    string result;
+    for (char c = 'a'; c < 'f'; c++) {
+        ASSERT_TRUE(_pool->submit_func(std::bind(&simple_task_method, 10, &counter)).ok());
+        ASSERT_TRUE(t->submit_func([&result, c]() {
+                         SleepFor(MonoDelta::FromMilliseconds(1));
+                         result += c;
+                     })
+                            .ok());
+    }
+    t->wait();
+    ASSERT_EQ("abcde", result);
+    t.reset();
+
+    // an idle worker exits after the idle timeout, and a new one is created for the next task
+    SleepFor(MonoDelta::FromMilliseconds(1000));
+    ASSERT_EQ(0, _pool->num_threads());
+    ASSERT_TRUE(_pool->submit_func(std::bind(&simple_task_method, 10, &counter)).ok());
+    _pool->wait();
+    ASSERT_EQ(100 * 10 * 10 + 5 * 10 + 10, counter.load());
+
+    _pool->shutdown();
+    ASSERT_TRUE(_pool->submit_func([]() {}).is_service_unavailable());
+}
+
+TEST_F(ThreadPoolTest, TestWorkStealingMaxQueueSize) {
+    ASSERT_TRUE(rebuild_pool_with_builder(ThreadPoolBuilder(kDefaultPoolName)
+                                                  .set_min_threads(1)
+                                                  .set_max_threads(1)
+                                                  .set_max_queue_size(1)
+                                                  .set_work_stealing(true)
+                                                  .set_queue_time_metric(true))
+                        .ok());
+
+    CountDownLatch latch(1);
+    ASSERT_TRUE(_pool->submit(SlowTask::new_slow_task(&latch)).ok());
+    ASSERT_TRUE(_pool->submit(SlowTask::new_slow_task(&latch)).ok());
+    Status s = _pool->submit(SlowTask::new_slow_task(&latch));
+    ASSERT_TRUE(s.is_service_unavailable()) << s;
+    latch.count_down();
+    _pool->wait();
+    ASSERT_EQ(2, _pool->total_executed_tasks());
+    _pool->shutdown();
+}
+
 // Test that when we specify a zero-sized queue, the maximum number of threads
 // running is used for enforcement.
 TEST_F(ThreadPoolTest, TestZeroQueueSize) {
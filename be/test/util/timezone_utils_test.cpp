@@ -62,4 +62,25 @@ PARALLEL_TEST(TimezoneUtilTest, find_time_zone) {
     }
 }
 
+PARALLEL_TEST(TimezoneUtilTest, offset_cache) {
+    cctz::time_zone ctz;
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone("America/Los_Angeles", ctz));
+    const cctz::civil_second epoch(1970, 1, 1, 0, 0, 0);
+    TimezoneOffsetCache cache(ctz);
+    // 2011-01-01 .. 2012-01-01 crosses both DST transitions, back and forth to hit and miss the cache
+    for (int64_t t = 1293840000; t < 1325376000; t += 577) {
+        for (int64_t seconds : {t, t - 3600 * 24 * 30, t + 1}) {
+            const cctz::time_point<cctz::seconds> tp(cctz::seconds{seconds});
+            ASSERT_EQ(cctz::convert(tp, ctz) - epoch, cache.utc_to_local(seconds)) << seconds;
+            ASSERT_EQ(cctz::convert(epoch + seconds, ctz).time_since_epoch().count(), cache.local_to_utc(seconds))
+                    << seconds;
+        }
+    }
+    // skipped and repeated civil times
+    ASSERT_EQ(cctz::convert(cctz::civil_second(2011, 3, 13, 2, 15, 0), ctz).time_since_epoch().count(),
+              cache.local_to_utc(cctz::civil_second(2011, 3, 13, 2, 15, 0) - epoch));
+    ASSERT_EQ(cctz::convert(cctz::civil_second(2011, 11, 6, 1, 15, 0), ctz).time_since_epoch().count(),
+              cache.local_to_utc(cctz::civil_second(2011, 11, 6, 1, 15, 0) - epoch));
+}
+
 } // namespace starrocks
@@ -60,6 +60,9 @@ public class ColumnAccessPath {
     // flat json used, to mark the type of the leaf
     private Type valueType;
 
+    // the constant keys of the map entries accessed by an INDEX path, null if any of them is not a constant
+    private List<String> indexKeys;
+
     public ColumnAccessPath(TAccessPathType type, String path, Type valueType) {
         this.type = type;
         this.path = path;
@@ -92,6 +95,14 @@ public class ColumnAccessPath {
         return valueType;
     }
 
+    public void setIndexKeys(List<String> indexKeys) {
+        this.indexKeys = indexKeys;
+    }
+
+    public List<String> getIndexKeys() {
+        return indexKeys;
+    }
+
     public void setFromPredicate(boolean fromPredicate) {
         this.fromPredicate = fromPredicate;
     }
@@ -177,6 +188,9 @@ public class ColumnAccessPath {
         if (valueType != null) {
             tColumnAccessPath.setType_desc(valueType.toThrift());
         }
+        if (type == TAccessPathType.INDEX && indexKeys != null) {
+            tColumnAccessPath.setIndex_keys(indexKeys);
+        }
         return tColumnAccessPath;
     }
 }
\ No newline at end of file
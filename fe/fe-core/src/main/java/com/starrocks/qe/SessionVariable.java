@@ -1092,6 +1092,7 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // if spillable_operator_mask & 4 != 0, agg distinct operator can spill
     // if spillable_operator_mask & 8 != 0, sort operator can spill
     // if spillable_operator_mask & 16 != 0, nest loop join operator can spill
+    // if spillable_operator_mask & 32 != 0, analytic operator can spill
     // ...
     // default value is -1, means all operators can spill
     @VariableMgr.VarAttr(name = SPILLABLE_OPERATOR_MASK, flag = VariableMgr.INVISIBLE)
@@ -1264,6 +1265,8 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // if transmission_encode_level & 2, intergers are encode by streamvbyte, in order or not;
     // if transmission_encode_level & 4, binary columns are compressed by lz4
     // if transmission_encode_level & 1, enable adaptive encoding.
+    // if transmission_encode_level & 8 together with & 2, integers may be bit-packed by frame of reference instead,
+    // with adaptive encoding each column picks streamvbyte or bit packing by the sampled encoding ratio.
     // e.g.
     // if transmission_encode_level = 7, SR will adaptively encode numbers and string columns according to the proper encoding
     // ratio(< 0.9);
@@ -17,6 +17,7 @@ package com.starrocks.sql.optimizer.rule.tree.prunesubfield;
 import com.google.common.collect.Lists;
 import com.starrocks.catalog.ColumnAccessPath;
 import com.starrocks.catalog.FunctionSet;
+import com.starrocks.catalog.MapType;
 import com.starrocks.catalog.Type;
 import com.starrocks.sql.optimizer.operator.scalar.CallOperator;
 import com.starrocks.sql.optimizer.operator.scalar.CollectionElementOperator;
@@ -53,6 +54,8 @@ public class SubfieldAccessPathNormalizer {
         private Type valueType = Type.INVALID;
         private final List<String> paths = Lists.newArrayList();
         private final List<TAccessPathType> pathTypes = Lists.newArrayList();
+        // the constant map key of each INDEX path, null if it is not a constant
+        private final List<String> indexKeys = Lists.newArrayList();
 
         public AccessPath(ScalarOperator root) {
             this.root = root;
@@ -61,6 +64,13 @@ public class SubfieldAccessPathNormalizer {
         public AccessPath appendPath(String path, TAccessPathType pathType) {
             paths.add(path);
             pathTypes.add(pathType);
+            indexKeys.add(null);
+            return this;
+        }
+
+        public AccessPath appendIndexKey(String key) {
+            appendPath(ColumnAccessPath.PATH_PLACEHOLDER, TAccessPathType.INDEX);
+            indexKeys.set(indexKeys.size() - 1, key);
             return this;
         }
 
@@ -108,6 +118,16 @@ public class SubfieldAccessPathNormalizer {
                         isOffsetOrKey = isOffsetOrKey ||
                                 (childPath.getType() == TAccessPathType.KEY && pathType == TAccessPathType.OFFSET);
                         childPath.setType(isOffsetOrKey ? TAccessPathType.KEY : TAccessPathType.ALL);
+                        childPath.setIndexKeys(null);
+                    } else if (pathType == TAccessPathType.INDEX) {
+                        // m['a'] and m['b'] read the entries of both keys, m['a'] and m[k] read all entries
+                        String key = accessPath.indexKeys.get(i);
+                        List<String> keys = childPath.getIndexKeys();
+                        if (key == null || keys == null) {
+                            childPath.setIndexKeys(null);
+                        } else if (!keys.contains(key)) {
+                            keys.add(key);
+                        }
                     }
                     childPath.setValueType(
                             deriverCompatibleJsonType(childPath.getValueType(), accessPath.getValueType()));
@@ -115,6 +135,9 @@ public class SubfieldAccessPathNormalizer {
                 } else {
                     ColumnAccessPath childPath = new ColumnAccessPath(accessPath.pathTypes.get(i),
                             accessPath.paths.get(i), accessPath.valueType);
+                    if (accessPath.indexKeys.get(i) != null) {
+                        childPath.setIndexKeys(Lists.newArrayList(accessPath.indexKeys.get(i)));
+                    }
                     parentPath.addChildPath(childPath);
                     parentPath = childPath;
                 }
@@ -183,11 +206,22 @@ public class SubfieldAccessPathNormalizer {
 
             if (!collectionElementOp.getChild(1).isConstant()) {
                 return parent.map(p -> p.appendPath(ColumnAccessPath.PATH_PLACEHOLDER, TAccessPathType.ALL));
+            } else if (isVarcharMapKey(collectionElementOp)) {
+                String key = ((ConstantOperator) collectionElementOp.getChild(1)).getVarchar();
+                return parent.map(p -> p.appendIndexKey(key));
             } else {
                 return parent.map(p -> p.appendPath(ColumnAccessPath.PATH_PLACEHOLDER, TAccessPathType.INDEX));
             }
         }
 
+        // BE reads the keys of a map with VARCHAR keys first, and then only the values of the entries of this key
+        private boolean isVarcharMapKey(CollectionElementOperator collectionElementOp) {
+            ScalarOperator collection = collectionElementOp.getChild(0);
+            ScalarOperator key = collectionElementOp.getChild(1);
+            return collection.getType().isMapType() && ((MapType) collection.getType()).getKeyType().isVarchar() &&
+                    key instanceof ConstantOperator && !((ConstantOperator) key).isNull() && key.getType().isVarchar();
+        }
+
         @Override
         public Optional<AccessPath> visitCall(CallOperator call, List<Optional<AccessPath>> childrenAccessPaths) {
             if (!PruneSubfieldRule.SUPPORT_FUNCTIONS.contains(call.getFnName())) {
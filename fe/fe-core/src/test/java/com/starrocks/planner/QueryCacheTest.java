@@ -20,12 +20,15 @@ import com.google.common.collect.Sets;
 import com.google.common.io.CharStreams;
 import com.starrocks.analysis.DateLiteral;
 import com.starrocks.analysis.IntLiteral;
+import com.starrocks.catalog.OlapTable;
+import com.starrocks.catalog.Partition;
 import com.starrocks.catalog.PartitionKey;
 import com.starrocks.catalog.PrimitiveType;
 import com.starrocks.catalog.Type;
 import com.starrocks.common.AnalysisException;
 import com.starrocks.common.FeConstants;
 import com.starrocks.qe.ConnectContext;
+import com.starrocks.server.GlobalStateMgr;
 import com.starrocks.sql.plan.ExecPlan;
 import com.starrocks.statistic.StatsConstants;
 import com.starrocks.utframe.StarRocksAssert;
@@ -1268,6 +1271,29 @@ public class QueryCacheTest {
         testHelper(sqlList);
     }
 
+    @Test
+    public void testHashJoinDigestContainsDimensionVersions() {
+        String sql = "select sum(lo_revenue) as revenue\n" +
+                "from lineorder join[broadcast] dates on lo_orderdate = d_datekey\n" +
+                "where d_year = 1993 and lo_quantity < 25";
+        Optional<PlanFragment> optFrag = getCachedFragment(sql);
+        Assert.assertTrue(optFrag.isPresent());
+        ByteBuffer digest = ByteBuffer.wrap(optFrag.get().getCacheParam().getDigest());
+
+        OlapTable dates = (OlapTable) GlobalStateMgr.getCurrentState().getDb("qc_db").getTable("dates");
+        Map<Partition, Long> versions = new HashMap<>();
+        dates.getPartitions().forEach(p -> versions.put(p, p.getVisibleVersion()));
+        try {
+            // a new load into the dimension table must not hit the results cached with its old version
+            versions.forEach((p, v) -> p.setVisibleVersion(v + 1, System.currentTimeMillis()));
+            optFrag = getCachedFragment(sql);
+            Assert.assertTrue(optFrag.isPresent());
+            Assert.assertNotEquals(digest, ByteBuffer.wrap(optFrag.get().getCacheParam().getDigest()));
+        } finally {
+            versions.forEach((p, v) -> p.setVisibleVersion(v, System.currentTimeMillis()));
+        }
+    }
+
     @Test
     public void testHashJoin2() {
         List<String> sqlFormatList = Lists.newArrayList(
@@ -184,7 +184,8 @@ enum THdfsCompression {
 enum TIndexType {
   BITMAP,
   GIN,
-  NGRAMBF
+  NGRAMBF,
+  VECTOR
 }
 
 // Mapping from names defined by Avro to the enum.
@@ -512,6 +512,18 @@ struct TColumnAccessPath {
     3: optional list<TColumnAccessPath> children
     4: optional bool from_predicate
     5: optional Types.TTypeDesc type_desc
+    // The constant keys of the map entries accessed by an INDEX path, e.g. 'a' and 'b' of m['a'] and m['b'].
+    // Unset if any of them is not a constant.
+    6: optional list<string> index_keys
+}
+
+// The approximate nearest neighbor search pushed down into the scan, only the k rows nearest to
+// query_vector in the VECTOR index of vector_column_name are read from each segment.
+struct TVectorSearchOptions {
+  1: optional string vector_column_name
+  2: optional list<double> query_vector
+  3: optional i64 limit_k
+  4: optional i32 nprobe
 }
 
 // If you find yourself changing this struct, see also TLakeScanNode
@@ -543,6 +555,7 @@ struct TOlapScanNode {
   34: optional bool partition_order_hint
   35: optional bool enable_prune_column_after_index_filter
   36: optional bool enable_gin_filter
+  37: optional TVectorSearchOptions vector_search_options
 }
 
 struct TJDBCScanNode {